@@ -0,0 +1,63 @@
+# Copyright (c) 2022 The STE||AR-Group
+#
+# SPDX-License-Identifier: BSL-1.0
+# Distributed under the Boost Software License, Version 1.0. (See accompanying
+# file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+if(NOT TARGET Liburing::liburing)
+  find_package(PkgConfig QUIET)
+  pkg_check_modules(PC_LIBURING QUIET liburing)
+
+  find_path(
+    LIBURING_INCLUDE_DIR liburing.h
+    HINTS ${LIBURING_ROOT} ENV LIBURING_ROOT ${HPX_LIBURING_ROOT}
+          ${PC_LIBURING_INCLUDEDIR} ${PC_LIBURING_INCLUDE_DIRS}
+    PATH_SUFFIXES include
+  )
+
+  find_library(
+    LIBURING_LIBRARY
+    NAMES uring liburing
+    HINTS ${LIBURING_ROOT} ENV LIBURING_ROOT ${HPX_LIBURING_ROOT}
+          ${PC_LIBURING_LIBDIR} ${PC_LIBURING_LIBRARY_DIRS}
+    PATH_SUFFIXES lib lib64
+  )
+
+  # Set LIBURING_ROOT in case the other hints are used
+  if(LIBURING_ROOT)
+    # The call to file is for compatibility with windows paths
+    file(TO_CMAKE_PATH ${LIBURING_ROOT} LIBURING_ROOT)
+  elseif("$ENV{LIBURING_ROOT}")
+    file(TO_CMAKE_PATH $ENV{LIBURING_ROOT} LIBURING_ROOT)
+  else()
+    file(TO_CMAKE_PATH "${LIBURING_INCLUDE_DIR}" LIBURING_INCLUDE_DIR)
+    string(REPLACE "/include" "" LIBURING_ROOT "${LIBURING_INCLUDE_DIR}")
+  endif()
+
+  set(LIBURING_LIBRARIES ${LIBURING_LIBRARY})
+  set(LIBURING_INCLUDE_DIRS ${LIBURING_INCLUDE_DIR})
+
+  find_package_handle_standard_args(
+    Liburing DEFAULT_MSG LIBURING_LIBRARY LIBURING_INCLUDE_DIR
+  )
+
+  get_property(
+    _type
+    CACHE LIBURING_ROOT
+    PROPERTY TYPE
+  )
+  if(_type)
+    set_property(CACHE LIBURING_ROOT PROPERTY ADVANCED 1)
+    if("x${_type}" STREQUAL "xUNINITIALIZED")
+      set_property(CACHE LIBURING_ROOT PROPERTY TYPE PATH)
+    endif()
+  endif()
+
+  add_library(Liburing::liburing INTERFACE IMPORTED)
+  target_include_directories(
+    Liburing::liburing SYSTEM INTERFACE ${LIBURING_INCLUDE_DIR}
+  )
+  target_link_libraries(Liburing::liburing INTERFACE ${LIBURING_LIBRARIES})
+
+  mark_as_advanced(LIBURING_ROOT LIBURING_LIBRARY LIBURING_INCLUDE_DIR)
+endif()
@@ -0,0 +1,366 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file hpx/components/partitioned_csr_matrix/partitioned_csr_matrix.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/actions_base/traits/is_distribution_policy.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/async_base/launch_policy.hpp>
+#include <hpx/async_combinators/wait_all.hpp>
+#include <hpx/async_combinators/when_all.hpp>
+#include <hpx/async_distributed/async.hpp>
+#include <hpx/distribution_policies/container_distribution_policy.hpp>
+#include <hpx/futures/future.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/naming_base/id_type.hpp>
+
+#include <hpx/components/containers/partitioned_csr_matrix/partitioned_csr_matrix_component.hpp>
+#include <hpx/components/containers/partitioned_vector/partitioned_vector.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx {
+
+    /// The partitioned_csr_matrix is a sparse matrix stored in compressed
+    /// sparse row format, its rows are distributed in blocks of consecutive
+    /// rows over one or more partitions.
+    ///
+    /// The columns are distributed over the partitions in the same way, which
+    /// corresponds to the distribution of the elements of an
+    /// hpx::partitioned_vector with the same number of partitions. The
+    /// vectors used in a multiplication have to be partitioned accordingly:
+    /// a partitioned_vector of size \a num_cols() (or \a num_rows())
+    /// created using the distribution policy of the matrix places each of
+    /// its partitions on the same locality as the corresponding partition of
+    /// the matrix.
+    ///
+    /// Each partition precomputes the elements of the vector it needs from
+    /// the other partitions (its ghost columns) when the matrix is created,
+    /// a multiplication then exchanges exactly these elements.
+    ///
+    template <typename T>
+    class partitioned_csr_matrix
+    {
+    public:
+        typedef T value_type;
+        typedef std::size_t size_type;
+
+        typedef hpx::partitioned_vector<T> vector_type;
+
+    private:
+        typedef hpx::server::partitioned_csr_matrix<T> partition_server;
+        typedef typename partition_server::data_type partition_data_type;
+
+        typedef std::pair<hpx::id_type, std::vector<hpx::id_type>>
+            bulk_locality_result;
+
+    public:
+        /// Create a matrix with \a num_rows rows and \a num_cols columns from
+        /// the given arrays describing it in compressed sparse row format.
+        ///
+        /// \param num_rows The number of rows of the matrix
+        /// \param num_cols The number of columns of the matrix
+        /// \param row_ptr  The position of the first entry of each row in
+        ///                 \a col_idx and \a values, followed by the number
+        ///                 of entries
+        /// \param col_idx  The column of each of the entries
+        /// \param values   The value of each of the entries
+        ///
+        partitioned_csr_matrix(std::size_t num_rows, std::size_t num_cols,
+            std::vector<std::size_t> const& row_ptr,
+            std::vector<std::size_t> const& col_idx,
+            std::vector<T> const& values)
+          : num_rows_(num_rows)
+          , num_cols_(num_cols)
+        {
+            create(row_ptr, col_idx, values, hpx::container_layout);
+        }
+
+        /// Create a matrix with \a num_rows rows and \a num_cols columns from
+        /// the given arrays describing it in compressed sparse row format,
+        /// the partitions are created using the given distribution policy.
+        ///
+        template <typename DistPolicy>
+        partitioned_csr_matrix(std::size_t num_rows, std::size_t num_cols,
+            std::vector<std::size_t> const& row_ptr,
+            std::vector<std::size_t> const& col_idx,
+            std::vector<T> const& values, DistPolicy const& policy,
+            typename std::enable_if<
+                traits::is_distribution_policy<DistPolicy>::value>::type* =
+                nullptr)
+          : num_rows_(num_rows)
+          , num_cols_(num_cols)
+        {
+            create(row_ptr, col_idx, values, policy);
+        }
+
+        partitioned_csr_matrix(partitioned_csr_matrix const&) = delete;
+        partitioned_csr_matrix(partitioned_csr_matrix&&) = default;
+
+        partitioned_csr_matrix& operator=(
+            partitioned_csr_matrix const&) = delete;
+        partitioned_csr_matrix& operator=(partitioned_csr_matrix&&) = default;
+
+        /// Return the number of rows of the matrix
+        std::size_t num_rows() const noexcept
+        {
+            return num_rows_;
+        }
+
+        /// Return the number of columns of the matrix
+        std::size_t num_cols() const noexcept
+        {
+            return num_cols_;
+        }
+
+        /// Return the number of non-zero entries of the matrix
+        std::size_t num_entries() const noexcept
+        {
+            return num_entries_;
+        }
+
+        /// Return the number of partitions of the matrix
+        std::size_t num_partitions() const noexcept
+        {
+            return partitions_.size();
+        }
+
+        /// Return the number of elements of the vector the partition
+        /// \a partition receives from each of the partitions during a
+        /// multiplication
+        std::vector<std::size_t> ghost_counts(std::size_t partition) const
+        {
+            if (partition >= partitions_.size())
+            {
+                HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                    "hpx::partitioned_csr_matrix::ghost_counts",
+                    "the given partition does not exist");
+            }
+
+            typedef typename partition_server::ghost_counts_action action_type;
+            return hpx::async<action_type>(
+                partitions_[partition], partitions_.size())
+                .get();
+        }
+
+        /// Compute the product of the matrix and the vector \a x, and store
+        /// it in the vector \a y.
+        ///
+        /// All partitions of the matrix perform their part of the
+        /// multiplication concurrently. Each of them requests its ghost
+        /// elements of \a x first, and multiplies the entries referring to
+        /// the columns it owns while the ghost elements are in flight.
+        ///
+        /// \param x    The vector to multiply with, it has to be partitioned
+        ///             like the columns of the matrix
+        /// \param y    The vector receiving the result, it has to be
+        ///             partitioned like the rows of the matrix and must not
+        ///             refer to \a x
+        ///
+        /// \return This returns the hpx::future of type void which becomes
+        ///         ready once all elements of \a y have been computed
+        ///
+        hpx::future<void> spmv(vector_type const& x, vector_type& y) const
+        {
+            std::vector<hpx::id_type> const xs =
+                get_partition_ids(x, col_offsets_);
+            std::vector<hpx::id_type> const ys =
+                get_partition_ids(y, row_offsets_);
+
+            if (xs == ys)
+            {
+                HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                    "hpx::partitioned_csr_matrix::spmv",
+                    "the result vector must not refer to the vector to "
+                    "multiply with");
+            }
+
+            typedef typename partition_server::spmv_action action_type;
+
+            std::vector<hpx::future<void>> results;
+            results.reserve(partitions_.size());
+            for (std::size_t i = 0; i != partitions_.size(); ++i)
+            {
+                results.push_back(
+                    hpx::async<action_type>(partitions_[i], xs, ys[i]));
+            }
+
+            return hpx::when_all(results).then(hpx::launch::sync,
+                [](hpx::future<std::vector<hpx::future<void>>>&& f) -> void {
+                    // propagate exceptions
+                    for (hpx::future<void>& result : f.get())
+                        result.get();
+                });
+        }
+
+        /// Compute the product of the matrix and the vector \a x, and store
+        /// it in the vector \a y.
+        void spmv(
+            launch::sync_policy, vector_type const& x, vector_type& y) const
+        {
+            spmv(x, y).get();
+        }
+
+    private:
+        // The boundaries of the blocks of a partitioned_vector of the given
+        // size consisting of the given number of partitions.
+        static std::vector<std::size_t> get_offsets(
+            std::size_t size, std::size_t num_parts)
+        {
+            std::size_t const part_size = (size + num_parts - 1) / num_parts;
+
+            std::vector<std::size_t> offsets;
+            offsets.reserve(num_parts + 1);
+            for (std::size_t i = 0; i != num_parts; ++i)
+            {
+                offsets.push_back((std::min)(i * part_size, size));
+            }
+            offsets.push_back(size);
+            return offsets;
+        }
+
+        static void validate(std::size_t num_rows, std::size_t num_cols,
+            std::vector<std::size_t> const& row_ptr,
+            std::vector<std::size_t> const& col_idx,
+            std::vector<T> const& values)
+        {
+            char const* error = nullptr;
+            if (row_ptr.size() != num_rows + 1 || row_ptr.front() != 0 ||
+                !std::is_sorted(row_ptr.begin(), row_ptr.end()))
+            {
+                error = "the row pointers are not valid";
+            }
+            else if (col_idx.size() != row_ptr.back() ||
+                values.size() != row_ptr.back())
+            {
+                error = "the number of entries does not match the row pointers";
+            }
+            else if (std::any_of(col_idx.begin(), col_idx.end(),
+                         [num_cols](std::size_t col) {
+                             return col >= num_cols;
+                         }))
+            {
+                error = "the column indices are out of bounds";
+            }
+
+            if (error != nullptr)
+            {
+                HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                    "hpx::partitioned_csr_matrix::partitioned_csr_matrix",
+                    error);
+            }
+        }
+
+        template <typename DistPolicy>
+        void create(std::vector<std::size_t> const& row_ptr,
+            std::vector<std::size_t> const& col_idx,
+            std::vector<T> const& values, DistPolicy const& policy)
+        {
+            validate(num_rows_, num_cols_, row_ptr, col_idx, values);
+            num_entries_ = col_idx.size();
+
+            std::size_t const num_parts =
+                traits::num_container_partitions<DistPolicy>::call(policy);
+
+            row_offsets_ = get_offsets(num_rows_, num_parts);
+            col_offsets_ = get_offsets(num_cols_, num_parts);
+
+            // create as many partitions as required
+            hpx::future<std::vector<bulk_locality_result>> f =
+                policy.template bulk_create<partition_server>(num_parts);
+
+            // send each partition its rows
+            typedef typename partition_server::set_data_action action_type;
+
+            std::vector<hpx::future<void>> results;
+            results.reserve(num_parts);
+
+            partitions_.reserve(num_parts);
+            for (bulk_locality_result const& r : f.get())
+            {
+                for (hpx::id_type const& id : r.second)
+                {
+                    std::size_t const part = partitions_.size();
+                    std::size_t const first_row = row_offsets_[part];
+                    std::size_t const last_row = row_offsets_[part + 1];
+
+                    std::size_t const first = row_ptr[first_row];
+                    std::size_t const last = row_ptr[last_row];
+
+                    partition_data_type data;
+                    data.partition_ = part;
+                    data.row_ptr_.reserve(last_row - first_row + 1);
+                    for (std::size_t row = first_row; row <= last_row; ++row)
+                    {
+                        data.row_ptr_.push_back(row_ptr[row] - first);
+                    }
+                    data.col_idx_.assign(
+                        col_idx.begin() + first, col_idx.begin() + last);
+                    data.values_.assign(
+                        values.begin() + first, values.begin() + last);
+                    data.col_offsets_ = col_offsets_;
+
+                    results.push_back(
+                        hpx::async<action_type>(id, HPX_MOVE(data)));
+                    partitions_.push_back(id);
+                }
+            }
+            HPX_ASSERT(partitions_.size() == num_parts);
+
+            hpx::wait_all(results);
+            for (hpx::future<void>& result : results)
+                result.get();
+        }
+
+        // Return the partitions of the given vector after verifying that it
+        // is partitioned according to the given offsets.
+        static std::vector<hpx::id_type> get_partition_ids(
+            vector_type const& v, std::vector<std::size_t> const& offsets)
+        {
+            std::vector<hpx::id_type> ids;
+            ids.reserve(offsets.size() - 1);
+
+            bool matches = v.size() == offsets.back();
+            for (auto it = v.segment_begin(); matches && it != v.segment_end();
+                 ++it)
+            {
+                std::size_t const i = ids.size();
+                matches = i + 1 != offsets.size() &&
+                    it->size_ == offsets[i + 1] - offsets[i];
+                ids.push_back(it->partition_);
+            }
+
+            if (!matches || ids.size() + 1 != offsets.size())
+            {
+                HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                    "hpx::partitioned_csr_matrix::spmv",
+                    "the partitioning of the vector does not match the "
+                    "partitioning of the matrix");
+            }
+            return ids;
+        }
+
+    private:
+        std::size_t num_rows_;
+        std::size_t num_cols_;
+        std::size_t num_entries_ = 0;
+
+        // the first row (column) owned by each of the partitions, followed by
+        // the number of rows (columns)
+        std::vector<std::size_t> row_offsets_;
+        std::vector<std::size_t> col_offsets_;
+
+        std::vector<hpx::id_type> partitions_;
+    };
+}    // namespace hpx
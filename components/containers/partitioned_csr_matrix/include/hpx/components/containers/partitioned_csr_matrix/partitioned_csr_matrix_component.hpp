@@ -0,0 +1,412 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file hpx/components/partitioned_csr_matrix/partitioned_csr_matrix_component.hpp
+///
+/// \brief The partition of a partitioned_csr_matrix as an hpx component is
+///        defined here.
+///
+/// Each partition stores a block of consecutive rows of the matrix. The
+/// entries referring to the columns owned by the partition itself are stored
+/// separately from the entries referring to the columns owned by other
+/// partitions (the ghost columns), the latter are grouped by their owning
+/// partition.
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/actions_base/component_action.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/async_distributed/async.hpp>
+#include <hpx/async_distributed/dataflow.hpp>
+#include <hpx/components_base/server/component.hpp>
+#include <hpx/components_base/server/component_base.hpp>
+#include <hpx/executors/execution_policy.hpp>
+#include <hpx/futures/future.hpp>
+#include <hpx/naming_base/id_type.hpp>
+#include <hpx/parallel/algorithms/for_loop.hpp>
+#include <hpx/preprocessor/cat.hpp>
+#include <hpx/preprocessor/expand.hpp>
+#include <hpx/preprocessor/nargs.hpp>
+#include <hpx/runtime_components/component_factory.hpp>
+#include <hpx/serialization/serialize.hpp>
+#include <hpx/serialization/serialize_buffer.hpp>
+#include <hpx/serialization/vector.hpp>
+
+#include <hpx/components/containers/partitioned_vector/partitioned_vector_component.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace server {
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// The rows stored by a partition of a partitioned_csr_matrix in
+    /// compressed sparse row format, the column indices are global.
+    template <typename T>
+    struct partitioned_csr_matrix_data
+    {
+        // the index of the partition
+        std::size_t partition_ = 0;
+
+        std::vector<std::size_t> row_ptr_;
+        std::vector<std::size_t> col_idx_;
+        std::vector<T> values_;
+
+        // the first column owned by each of the partitions, followed by the
+        // number of columns of the matrix
+        std::vector<std::size_t> col_offsets_;
+
+    private:
+        friend class hpx::serialization::access;
+
+        template <typename Archive>
+        void serialize(Archive& ar, unsigned)
+        {
+            // clang-format off
+            ar & partition_ & row_ptr_ & col_idx_ & values_ & col_offsets_;
+            // clang-format on
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// This is the server side of a partition of a partitioned_csr_matrix.
+    ///
+    /// The communication pattern of the partition is computed once, when its
+    /// rows are set: for each partition owning some of the ghost columns,
+    /// the list of (local) indices of the elements of the vector needed from
+    /// that partition is stored together with the entries referring to them.
+    template <typename T>
+    class partitioned_csr_matrix
+      : public hpx::components::component_base<partitioned_csr_matrix<T>>
+    {
+    public:
+        typedef partitioned_csr_matrix_data<T> data_type;
+        typedef std::size_t size_type;
+
+        typedef hpx::server::partitioned_vector<T, std::vector<T>>
+            vector_server_type;
+        typedef serialization::serialize_buffer<T> buffer_type;
+
+    private:
+        // The entries referring to the columns owned by another partition,
+        // sorted by their row. The column of each entry refers to the
+        // position of the corresponding value in indices_.
+        struct neighbor_data
+        {
+            std::size_t partition_;
+            std::vector<std::size_t> indices_;
+
+            std::vector<std::size_t> rows_;
+            std::vector<std::size_t> cols_;
+            std::vector<T> values_;
+        };
+
+    public:
+        partitioned_csr_matrix() = default;
+
+        /// Set the rows of this partition and compute its communication
+        /// pattern
+        void set_data(data_type const& data)
+        {
+            std::size_t const num_partitions = data.col_offsets_.size() - 1;
+            HPX_ASSERT(data.partition_ < num_partitions);
+            HPX_ASSERT(!data.row_ptr_.empty());
+
+            partition_ = data.partition_;
+            num_rows_ = data.row_ptr_.size() - 1;
+
+            std::size_t const first_col = data.col_offsets_[partition_];
+            std::size_t const last_col = data.col_offsets_[partition_ + 1];
+            num_cols_ = last_col - first_col;
+
+            auto owner = [&](std::size_t col) -> std::size_t {
+                return std::upper_bound(data.col_offsets_.begin(),
+                           data.col_offsets_.end() - 1, col) -
+                    data.col_offsets_.begin() - 1;
+            };
+
+            // collect the ghost columns needed from each of the neighbors
+            std::vector<std::size_t> neighbor_of(num_partitions, npos);
+            std::vector<neighbor_data> neighbors;
+
+            for (std::size_t col : data.col_idx_)
+            {
+                if (col >= first_col && col < last_col)
+                    continue;
+
+                std::size_t const p = owner(col);
+                if (neighbor_of[p] == npos)
+                {
+                    neighbor_of[p] = neighbors.size();
+                    neighbors.push_back(neighbor_data{p, {}, {}, {}, {}});
+                }
+                neighbors[neighbor_of[p]].indices_.push_back(
+                    col - data.col_offsets_[p]);
+            }
+
+            // keep the neighbors sorted by their index
+            std::sort(neighbors.begin(), neighbors.end(),
+                [](neighbor_data const& lhs, neighbor_data const& rhs) {
+                    return lhs.partition_ < rhs.partition_;
+                });
+            for (std::size_t i = 0; i != neighbors.size(); ++i)
+            {
+                std::vector<std::size_t>& indices = neighbors[i].indices_;
+                std::sort(indices.begin(), indices.end());
+                indices.erase(
+                    std::unique(indices.begin(), indices.end()), indices.end());
+
+                neighbor_of[neighbors[i].partition_] = i;
+            }
+
+            // distribute the entries over the local and the ghost columns
+            row_ptr_.assign(1, 0);
+            row_ptr_.reserve(num_rows_ + 1);
+            col_idx_.clear();
+            values_.clear();
+
+            for (std::size_t row = 0; row != num_rows_; ++row)
+            {
+                for (std::size_t j = data.row_ptr_[row];
+                     j != data.row_ptr_[row + 1]; ++j)
+                {
+                    std::size_t const col = data.col_idx_[j];
+                    if (col >= first_col && col < last_col)
+                    {
+                        col_idx_.push_back(col - first_col);
+                        values_.push_back(data.values_[j]);
+                        continue;
+                    }
+
+                    std::size_t const p = owner(col);
+                    neighbor_data& n = neighbors[neighbor_of[p]];
+
+                    auto it = std::lower_bound(n.indices_.begin(),
+                        n.indices_.end(), col - data.col_offsets_[p]);
+                    HPX_ASSERT(it != n.indices_.end());
+
+                    n.rows_.push_back(row);
+                    n.cols_.push_back(it - n.indices_.begin());
+                    n.values_.push_back(data.values_[j]);
+                }
+                row_ptr_.push_back(col_idx_.size());
+            }
+
+            neighbors_ = HPX_MOVE(neighbors);
+        }
+
+        /// Return the number of rows stored in this partition
+        std::size_t size() const
+        {
+            return num_rows_;
+        }
+
+        /// Return the number of elements of the vector this partition
+        /// receives from each of the partitions during a multiplication
+        std::vector<std::size_t> ghost_counts(std::size_t num_partitions) const
+        {
+            std::vector<std::size_t> counts(num_partitions, 0);
+            for (neighbor_data const& n : neighbors_)
+            {
+                HPX_ASSERT(n.partition_ < num_partitions);
+                counts[n.partition_] = n.indices_.size();
+            }
+            return counts;
+        }
+
+        /// Multiply the rows of this partition with the vector \a x and store
+        /// the result in the partition \a y of the result vector.
+        ///
+        /// The ghost values are requested from all neighbors before the
+        /// entries referring to the local columns are multiplied, the
+        /// entries referring to the ghost columns of a neighbor are added
+        /// as soon as its values have arrived.
+        ///
+        /// \param x    The partitions of the vector to multiply with
+        /// \param y    The partition of the result vector corresponding to
+        ///             this partition
+        ///
+        hpx::future<void> spmv(
+            std::vector<hpx::id_type> const& x, hpx::id_type const& y) const
+        {
+            typedef typename vector_server_type::get_values_action
+                get_values_action;
+            typedef typename vector_server_type::get_value_buffer_action
+                get_value_buffer_action;
+            typedef typename vector_server_type::set_value_buffer_action
+                set_value_buffer_action;
+
+            std::vector<hpx::future<std::vector<T>>> ghosts;
+            ghosts.reserve(neighbors_.size());
+            for (neighbor_data const& n : neighbors_)
+            {
+                ghosts.push_back(hpx::async<get_values_action>(
+                    x[n.partition_], n.indices_));
+            }
+
+            // the local block of the vector is not copied if it is located
+            // on this locality
+            hpx::future<buffer_type> local =
+                hpx::async<get_value_buffer_action>(
+                    x[partition_], std::size_t(0), num_cols_);
+
+            buffer_type result(num_rows_);
+
+            hpx::future<void> f = local.then(
+                [this, result](hpx::future<buffer_type>&& f) mutable {
+                    multiply_local(f.get(), result);
+                });
+
+            for (std::size_t i = 0; i != neighbors_.size(); ++i)
+            {
+                f = hpx::dataflow(
+                    [this, i, result](hpx::future<void>&& prev,
+                        hpx::future<std::vector<T>>&& ghost) mutable {
+                        prev.get();
+                        multiply_ghosts(neighbors_[i], ghost.get(), result);
+                    },
+                    HPX_MOVE(f), HPX_MOVE(ghosts[i]));
+            }
+
+            return f.then(hpx::launch::sync,
+                [y, result](hpx::future<void>&& f) -> hpx::future<void> {
+                    f.get();
+                    return hpx::async<set_value_buffer_action>(
+                        y, std::size_t(0), result);
+                });
+        }
+
+        /// Macros to define HPX component actions for all exported functions.
+        HPX_DEFINE_COMPONENT_ACTION(partitioned_csr_matrix, set_data)
+        HPX_DEFINE_COMPONENT_DIRECT_ACTION(partitioned_csr_matrix, size)
+        HPX_DEFINE_COMPONENT_DIRECT_ACTION(
+            partitioned_csr_matrix, ghost_counts)
+        HPX_DEFINE_COMPONENT_ACTION(partitioned_csr_matrix, spmv)
+
+    private:
+        void multiply_local(buffer_type const& x, buffer_type& y) const
+        {
+            HPX_ASSERT(x.size() == num_cols_);
+
+            T const* xp = x.data();
+            T* yp = y.data();
+
+            hpx::experimental::for_loop(hpx::execution::par, std::size_t(0),
+                num_rows_, [&](std::size_t row) {
+                    T sum = T();
+                    for (std::size_t j = row_ptr_[row]; j != row_ptr_[row + 1];
+                         ++j)
+                    {
+                        sum += values_[j] * xp[col_idx_[j]];
+                    }
+                    yp[row] = sum;
+                });
+        }
+
+        static void multiply_ghosts(neighbor_data const& n,
+            std::vector<T> const& ghost, buffer_type& y)
+        {
+            HPX_ASSERT(ghost.size() == n.indices_.size());
+
+            T* yp = y.data();
+            for (std::size_t j = 0; j != n.values_.size(); ++j)
+            {
+                yp[n.rows_[j]] += n.values_[j] * ghost[n.cols_[j]];
+            }
+        }
+
+    private:
+        static constexpr std::size_t npos = std::size_t(-1);
+
+        std::size_t partition_ = 0;
+        std::size_t num_rows_ = 0;
+        std::size_t num_cols_ = 0;
+
+        // the entries referring to the columns owned by this partition, the
+        // column indices are local
+        std::vector<std::size_t> row_ptr_ = std::vector<std::size_t>(1, 0);
+        std::vector<std::size_t> col_idx_;
+        std::vector<T> values_;
+
+        // the entries referring to the ghost columns, sorted by the index of
+        // their owning partition
+        std::vector<neighbor_data> neighbors_;
+    };
+}}    // namespace hpx::server
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+
+///////////////////////////////////////////////////////////////////////////////
+#define HPX_REGISTER_PARTITIONED_CSR_MATRIX_DECLARATION(...)                   \
+    HPX_REGISTER_PARTITIONED_CSR_MATRIX_DECLARATION_(__VA_ARGS__)              \
+    /**/
+#define HPX_REGISTER_PARTITIONED_CSR_MATRIX_DECLARATION_(...)                  \
+    HPX_PP_EXPAND(HPX_PP_CAT(HPX_REGISTER_PARTITIONED_CSR_MATRIX_DECLARATION_, \
+        HPX_PP_NARGS(__VA_ARGS__))(__VA_ARGS__))                               \
+    /**/
+
+#define HPX_REGISTER_PARTITIONED_CSR_MATRIX_DECLARATION_1(type)                \
+    HPX_REGISTER_PARTITIONED_CSR_MATRIX_DECLARATION_2(type, type)              \
+    /**/
+#define HPX_REGISTER_PARTITIONED_CSR_MATRIX_DECLARATION_2(type, name)          \
+    typedef ::hpx::server::partitioned_csr_matrix<type> HPX_PP_CAT(            \
+        __partitioned_csr_matrix_, name);                                      \
+    HPX_REGISTER_ACTION_DECLARATION(                                           \
+        HPX_PP_CAT(__partitioned_csr_matrix_, name)::set_data_action,          \
+        HPX_PP_CAT(__csr_matrix_set_data_action_, name))                       \
+    HPX_REGISTER_ACTION_DECLARATION(                                           \
+        HPX_PP_CAT(__partitioned_csr_matrix_, name)::size_action,              \
+        HPX_PP_CAT(__csr_matrix_size_action_, name))                           \
+    HPX_REGISTER_ACTION_DECLARATION(                                           \
+        HPX_PP_CAT(__partitioned_csr_matrix_, name)::ghost_counts_action,      \
+        HPX_PP_CAT(__csr_matrix_ghost_counts_action_, name))                   \
+    HPX_REGISTER_ACTION_DECLARATION(                                           \
+        HPX_PP_CAT(__partitioned_csr_matrix_, name)::spmv_action,              \
+        HPX_PP_CAT(__csr_matrix_spmv_action_, name))                           \
+    /**/
+
+#define HPX_REGISTER_PARTITIONED_CSR_MATRIX(...)                               \
+    HPX_REGISTER_PARTITIONED_CSR_MATRIX_(__VA_ARGS__)                          \
+    /**/
+#define HPX_REGISTER_PARTITIONED_CSR_MATRIX_(...)                              \
+    HPX_PP_EXPAND(HPX_PP_CAT(HPX_REGISTER_PARTITIONED_CSR_MATRIX_,             \
+        HPX_PP_NARGS(__VA_ARGS__))(__VA_ARGS__))                               \
+    /**/
+
+#define HPX_REGISTER_PARTITIONED_CSR_MATRIX_1(type)                            \
+    HPX_REGISTER_PARTITIONED_CSR_MATRIX_2(type, type)                          \
+    /**/
+#define HPX_REGISTER_PARTITIONED_CSR_MATRIX_2(type, name)                      \
+    typedef ::hpx::server::partitioned_csr_matrix<type> HPX_PP_CAT(            \
+        __partitioned_csr_matrix_, name);                                      \
+    HPX_REGISTER_ACTION(                                                       \
+        HPX_PP_CAT(__partitioned_csr_matrix_, name)::set_data_action,          \
+        HPX_PP_CAT(__csr_matrix_set_data_action_, name))                       \
+    HPX_REGISTER_ACTION(                                                       \
+        HPX_PP_CAT(__partitioned_csr_matrix_, name)::size_action,              \
+        HPX_PP_CAT(__csr_matrix_size_action_, name))                           \
+    HPX_REGISTER_ACTION(                                                       \
+        HPX_PP_CAT(__partitioned_csr_matrix_, name)::ghost_counts_action,      \
+        HPX_PP_CAT(__csr_matrix_ghost_counts_action_, name))                   \
+    HPX_REGISTER_ACTION(                                                       \
+        HPX_PP_CAT(__partitioned_csr_matrix_, name)::spmv_action,              \
+        HPX_PP_CAT(__csr_matrix_spmv_action_, name))                           \
+    typedef ::hpx::components::component<HPX_PP_CAT(                           \
+        __partitioned_csr_matrix_, name)>                                      \
+        HPX_PP_CAT(__partitioned_csr_matrix_component_, name);                 \
+    HPX_REGISTER_COMPONENT(                                                    \
+        HPX_PP_CAT(__partitioned_csr_matrix_component_, name))                 \
+    /**/
+
+#else    // COMPUTE DEVICE CODE
+
+#define HPX_REGISTER_PARTITIONED_CSR_MATRIX_DECLARATION(...) /**/
+#define HPX_REGISTER_PARTITIONED_CSR_MATRIX(...)             /**/
+
+#endif
@@ -0,0 +1,18 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file src/components/containers/partitioned_csr_matrix/partitioned_csr_matrix_component.cpp
+
+/// This file defines the necessary component boilerplate code which is
+/// required for proper functioning of components in the context of HPX.
+
+#include <hpx/config.hpp>
+#include <hpx/runtime_components/component_factory.hpp>
+
+#include <hpx/components/containers/partitioned_csr_matrix/partitioned_csr_matrix.hpp>
+#include <hpx/components/containers/partitioned_csr_matrix/partitioned_csr_matrix_component.hpp>
+
+HPX_REGISTER_COMPONENT_MODULE()
@@ -0,0 +1,261 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx_main.hpp>
+#include <hpx/include/partitioned_csr_matrix.hpp>
+#include <hpx/include/partitioned_vector_predef.hpp>
+#include <hpx/include/runtime.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/runtime_distributed/find_all_localities.hpp>
+#include <hpx/runtime_distributed/find_here.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <random>
+#include <set>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// Define the matrix types to be used, the vector types are defined in the
+// partitioned_vector module.
+HPX_REGISTER_PARTITIONED_CSR_MATRIX(double)
+
+#if defined(HPX_HAVE_STATIC_LINKING)
+HPX_REGISTER_PARTITIONED_VECTOR(double)
+#endif
+
+using matrix_type = hpx::partitioned_csr_matrix<double>;
+using vector_type = hpx::partitioned_vector<double>;
+
+///////////////////////////////////////////////////////////////////////////////
+struct csr_data
+{
+    std::size_t num_rows;
+    std::size_t num_cols;
+    std::vector<std::size_t> row_ptr;
+    std::vector<std::size_t> col_idx;
+    std::vector<double> values;
+};
+
+// the one dimensional Laplacian
+csr_data make_laplacian(std::size_t n)
+{
+    csr_data m{n, n, {0}, {}, {}};
+    for (std::size_t row = 0; row != n; ++row)
+    {
+        if (row != 0)
+        {
+            m.col_idx.push_back(row - 1);
+            m.values.push_back(-1.0);
+        }
+        m.col_idx.push_back(row);
+        m.values.push_back(2.0);
+        if (row + 1 != n)
+        {
+            m.col_idx.push_back(row + 1);
+            m.values.push_back(-1.0);
+        }
+        m.row_ptr.push_back(m.col_idx.size());
+    }
+    return m;
+}
+
+// a matrix with a random sparsity pattern, the values are small integers to
+// allow for the results to be compared exactly
+csr_data make_random(std::size_t num_rows, std::size_t num_cols)
+{
+    std::mt19937 gen(42);
+    std::uniform_int_distribution<std::size_t> num_entries(0, 8);
+    std::uniform_int_distribution<std::size_t> col(0, num_cols - 1);
+    std::uniform_int_distribution<int> value(-5, 5);
+
+    csr_data m{num_rows, num_cols, {0}, {}, {}};
+    for (std::size_t row = 0; row != num_rows; ++row)
+    {
+        std::set<std::size_t> cols;
+        for (std::size_t i = num_entries(gen); i != 0; --i)
+            cols.insert(col(gen));
+
+        for (std::size_t c : cols)
+        {
+            m.col_idx.push_back(c);
+            m.values.push_back(double(value(gen)));
+        }
+        m.row_ptr.push_back(m.col_idx.size());
+    }
+    return m;
+}
+
+std::vector<double> multiply(csr_data const& m, std::vector<double> const& x)
+{
+    std::vector<double> y(m.num_rows, 0.0);
+    for (std::size_t row = 0; row != m.num_rows; ++row)
+    {
+        for (std::size_t j = m.row_ptr[row]; j != m.row_ptr[row + 1]; ++j)
+            y[row] += m.values[j] * x[m.col_idx[j]];
+    }
+    return y;
+}
+
+// the boundaries of the segments of a vector of the given size
+std::vector<std::size_t> segment_offsets(std::size_t size,
+    hpx::container_distribution_policy const& layout)
+{
+    vector_type v(size, layout);
+
+    std::vector<std::size_t> offsets(1, 0);
+    for (auto it = v.segment_begin(); it != v.segment_end(); ++it)
+        offsets.push_back(offsets.back() + (*it).size_);
+    return offsets;
+}
+
+// the number of distinct columns each partition needs from each of the
+// other partitions
+void check_ghost_counts(matrix_type const& a, csr_data const& m,
+    hpx::container_distribution_policy const& layout)
+{
+    std::vector<std::size_t> const rows = segment_offsets(m.num_rows, layout);
+    std::vector<std::size_t> const cols = segment_offsets(m.num_cols, layout);
+    std::size_t const num_partitions = rows.size() - 1;
+
+    HPX_TEST_EQ(a.num_partitions(), num_partitions);
+    HPX_TEST_EQ(cols.size(), rows.size());
+
+    for (std::size_t p = 0; p != num_partitions; ++p)
+    {
+        std::vector<std::set<std::size_t>> needed(num_partitions);
+        for (std::size_t j = m.row_ptr[rows[p]]; j != m.row_ptr[rows[p + 1]];
+             ++j)
+        {
+            std::size_t const owner =
+                std::upper_bound(cols.begin(), cols.end() - 1, m.col_idx[j]) -
+                cols.begin() - 1;
+            if (owner != p)
+                needed[owner].insert(m.col_idx[j]);
+        }
+
+        std::vector<std::size_t> const counts = a.ghost_counts(p);
+        HPX_TEST_EQ(counts.size(), num_partitions);
+        for (std::size_t q = 0; q != num_partitions && q != counts.size(); ++q)
+            HPX_TEST_EQ(counts[q], needed[q].size());
+    }
+}
+
+void spmv_test(
+    csr_data const& m, hpx::container_distribution_policy const& layout)
+{
+    matrix_type a(
+        m.num_rows, m.num_cols, m.row_ptr, m.col_idx, m.values, layout);
+    HPX_TEST_EQ(a.num_rows(), m.num_rows);
+    HPX_TEST_EQ(a.num_cols(), m.num_cols);
+    HPX_TEST_EQ(a.num_entries(), m.values.size());
+
+    check_ghost_counts(a, m, layout);
+
+    std::vector<double> values(m.num_cols);
+    for (std::size_t i = 0; i != values.size(); ++i)
+        values[i] = double(i % 17) - 8.0;
+
+    vector_type x(m.num_cols, layout);
+    x.set_values(hpx::launch::sync, 0, values);
+
+    vector_type y(m.num_rows, -1.0, layout);
+
+    a.spmv(x, y).get();
+    std::vector<double> expected = multiply(m, values);
+    HPX_TEST(y.get_values(hpx::launch::sync, 0, y.size()) == expected);
+
+    // the result does not depend on the previous contents of y
+    a.spmv(hpx::launch::sync, x, y);
+    HPX_TEST(y.get_values(hpx::launch::sync, 0, y.size()) == expected);
+
+    // the communication pattern is reused for new values of x
+    for (double& value : values)
+        value = -2.0 * value;
+    x.set_values(hpx::launch::sync, 0, values);
+
+    a.spmv(hpx::launch::sync, x, y);
+    expected = multiply(m, values);
+    HPX_TEST(y.get_values(hpx::launch::sync, 0, y.size()) == expected);
+}
+
+template <typename F>
+void test_throws(F&& f)
+{
+    bool caught_exception = false;
+    try
+    {
+        f();
+    }
+    catch (hpx::exception const&)
+    {
+        caught_exception = true;
+    }
+    HPX_TEST(caught_exception);
+}
+
+void error_tests(hpx::container_distribution_policy const& layout)
+{
+    csr_data const m = make_laplacian(100);
+    matrix_type a(
+        m.num_rows, m.num_cols, m.row_ptr, m.col_idx, m.values, layout);
+
+    // invalid matrices
+    test_throws([&]() {
+        matrix_type(m.num_rows + 1, m.num_cols, m.row_ptr, m.col_idx, m.values,
+            layout);
+    });
+    test_throws([&]() {
+        matrix_type(m.num_rows, m.num_cols - 1, m.row_ptr, m.col_idx, m.values,
+            layout);
+    });
+    test_throws([&]() {
+        std::vector<double> values(m.values.begin(), m.values.end() - 1);
+        matrix_type(
+            m.num_rows, m.num_cols, m.row_ptr, m.col_idx, values, layout);
+    });
+
+    // vectors not matching the matrix
+    vector_type x(m.num_cols, layout);
+    vector_type y(m.num_rows, layout);
+
+    test_throws([&]() { a.spmv(hpx::launch::sync, x, x); });
+
+    vector_type small(m.num_cols - 1, layout);
+    test_throws([&]() { a.spmv(hpx::launch::sync, small, y); });
+    test_throws([&]() { a.spmv(hpx::launch::sync, x, small); });
+
+    vector_type other(m.num_cols, hpx::container_layout(11));
+    test_throws([&]() { a.spmv(hpx::launch::sync, other, y); });
+
+    test_throws([&]() { a.ghost_counts(a.num_partitions()); });
+}
+
+void csr_matrix_tests(hpx::container_distribution_policy const& layout)
+{
+    spmv_test(make_laplacian(1007), layout);
+    spmv_test(make_laplacian(3), layout);
+    spmv_test(make_random(100, 257), layout);
+    spmv_test(make_random(257, 100), layout);
+
+    error_tests(layout);
+}
+
+int main()
+{
+    std::vector<hpx::id_type> const localities = hpx::find_all_localities();
+    std::vector<hpx::id_type> const here(1, hpx::find_here());
+
+    csr_matrix_tests(hpx::container_layout(here));
+    csr_matrix_tests(hpx::container_layout(4, here));
+    csr_matrix_tests(hpx::container_layout(localities));
+    csr_matrix_tests(hpx::container_layout(7, localities));
+
+    return hpx::util::report_errors();
+}
+#endif
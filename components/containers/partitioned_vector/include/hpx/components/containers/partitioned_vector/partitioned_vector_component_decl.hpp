@@ -23,9 +23,12 @@
 #include <hpx/components/client_base.hpp>
 #include <hpx/components_base/server/component_base.hpp>
 #include <hpx/components_base/server/locking_hook.hpp>
+#include <hpx/compute_local/host/target.hpp>
+#include <hpx/compute_local/traits/allocator_traits.hpp>
 #include <hpx/preprocessor/cat.hpp>
 #include <hpx/preprocessor/expand.hpp>
 #include <hpx/preprocessor/nargs.hpp>
+#include <hpx/serialization/serialize_buffer.hpp>
 
 #include <hpx/components/containers/partitioned_vector/partitioned_vector_fwd.hpp>
 
@@ -33,12 +36,28 @@
 #include <memory>
 #include <string>
 #include <tuple>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
 #include <hpx/config/warnings_prefix.hpp>
 
 namespace hpx { namespace server {
+    namespace detail {
+        // The actions of a partition access its elements directly, they have
+        // to be stored in memory which is accessible from the host.
+        template <typename Allocator>
+        struct is_host_allocator
+        {
+            using target_type = typename compute::traits::allocator_traits<
+                Allocator>::target_type;
+
+            static constexpr bool value =
+                std::is_same_v<target_type, compute::host::target> ||
+                std::is_same_v<target_type, std::vector<compute::host::target>>;
+        };
+    }    // namespace detail
+
     /// \brief This is the basic wrapper class for stl vector.
     ///
     /// This contain the implementation of the partitioned_vector_partition's
@@ -56,6 +75,10 @@ namespace hpx { namespace server {
         typedef typename data_type::iterator iterator_type;
         typedef typename data_type::const_iterator const_iterator_type;
 
+        static_assert(detail::is_host_allocator<allocator_type>::value,
+            "the elements of a partitioned_vector have to be stored in memory "
+            "accessible from the host");
+
         typedef components::locking_hook<
             components::component_base<partitioned_vector<T, Data>>>
             base_type;
@@ -72,6 +95,17 @@ namespace hpx { namespace server {
 
         explicit partitioned_vector(size_type partition_size);
 
+        /// Constructor which creates partitioned_vector_partition with
+        /// default-constructed elements using the given allocator.
+        ///
+        /// param partition_size The size of vector
+        /// param alloc The allocator used to create the elements, the host
+        ///       block allocators distribute the (first touch) initialization
+        ///       of the elements over their targets
+        ///
+        partitioned_vector(
+            size_type partition_size, allocator_type const& alloc);
+
         /// Constructor which create and initialize partitioned_vector_partition
         /// with all elements as \a val.
         ///
@@ -177,6 +211,35 @@ namespace hpx { namespace server {
         ///
         std::vector<T> get_values(std::vector<size_type> const& pos) const;
 
+        /// Return the elements in the range [\a first, \a last) of the
+        /// partitioned_vector_partition container.
+        ///
+        /// \param first Position of the first element in the
+        ///              partitioned_vector_partition
+        /// \param last  Position one past the last element in the
+        ///              partitioned_vector_partition
+        ///
+        /// \return Return the values of the elements in the given range.
+        ///
+        std::vector<T> get_value_range(size_type first, size_type last) const;
+
+        /// Return the elements in the range [\a first, \a last) of the
+        /// partitioned_vector_partition container. The returned buffer refers
+        /// to the data of this partition, the elements are sent without being
+        /// copied into an intermediate buffer. They must not be modified
+        /// before the returned buffer has been received.
+        ///
+        /// \param first Position of the first element in the
+        ///              partitioned_vector_partition
+        /// \param last  Position one past the last element in the
+        ///              partitioned_vector_partition
+        ///
+        /// \return Return a buffer referring to the elements in the given
+        ///         range.
+        ///
+        serialization::serialize_buffer<T> get_value_buffer(
+            size_type first, size_type last) const;
+
         /// Access the value of first element in the partitioned_vector_partition.
         ///
         /// Calling the function on empty container cause undefined behavior.
@@ -243,6 +306,47 @@ namespace hpx { namespace server {
         void set_values(
             std::vector<size_type> const& pos, std::vector<T> const& val);
 
+        /// Copy the values of \a val to the consecutive elements starting at
+        /// position \a first in the partitioned_vector_partition container.
+        ///
+        /// \param first Position of the first element in the
+        ///              partitioned_vector_partition
+        ///
+        /// \param val   The values to be copied
+        ///
+        void set_value_range(size_type first, std::vector<T> const& val);
+
+        /// Copy the values of the buffer \a buf to the consecutive elements
+        /// starting at position \a first in the partitioned_vector_partition
+        /// container.
+        ///
+        /// \param first Position of the first element in the
+        ///              partitioned_vector_partition
+        ///
+        /// \param buf   The values to be copied
+        ///
+        void set_value_buffer(size_type first,
+            serialization::serialize_buffer<T> const& buf);
+
+        /// Send the elements in the range [\a first, \a last) to the
+        /// partitioned_vector_partition \a dest, which stores them starting
+        /// at position \a dest_first. The elements are sent without being
+        /// copied into an intermediate buffer, they must not be modified
+        /// before the returned future has become ready.
+        ///
+        /// \param first      Position of the first element to send
+        /// \param last       Position one past the last element to send
+        /// \param dest       The partitioned_vector_partition receiving the
+        ///                   elements
+        /// \param dest_first Position of the first received element in
+        ///                   \a dest
+        ///
+        /// \return This returns the hpx::future of type void which becomes
+        ///         ready once \a dest has stored the elements
+        ///
+        hpx::future<void> transfer_range(size_type first, size_type last,
+            hpx::id_type const& dest, size_type dest_first);
+
         /// Remove all elements from the vector leaving the
         /// partitioned_vector_partition with size 0.
         ///
@@ -261,6 +365,8 @@ namespace hpx { namespace server {
 
         HPX_DEFINE_COMPONENT_DIRECT_ACTION(partitioned_vector, get_value)
         HPX_DEFINE_COMPONENT_DIRECT_ACTION(partitioned_vector, get_values)
+        HPX_DEFINE_COMPONENT_DIRECT_ACTION(partitioned_vector, get_value_range)
+        HPX_DEFINE_COMPONENT_DIRECT_ACTION(partitioned_vector, get_value_buffer)
 
         // HPX_DEFINE_COMPONENT_DIRECT_ACTION(partitioned_vector_partition, front)
         // HPX_DEFINE_COMPONENT_DIRECT_ACTION(partitioned_vector_partition, back)
@@ -270,6 +376,9 @@ namespace hpx { namespace server {
 
         HPX_DEFINE_COMPONENT_DIRECT_ACTION(partitioned_vector, set_value)
         HPX_DEFINE_COMPONENT_DIRECT_ACTION(partitioned_vector, set_values)
+        HPX_DEFINE_COMPONENT_DIRECT_ACTION(partitioned_vector, set_value_range)
+        HPX_DEFINE_COMPONENT_DIRECT_ACTION(partitioned_vector, set_value_buffer)
+        HPX_DEFINE_COMPONENT_ACTION(partitioned_vector, transfer_range)
 
         // HPX_DEFINE_COMPONENT_ACTION(partitioned_vector_partition, clear)
         HPX_DEFINE_COMPONENT_DIRECT_ACTION(partitioned_vector, get_copied_data)
@@ -291,10 +400,20 @@ namespace hpx { namespace server {
         type::get_value_action, HPX_PP_CAT(__vector_get_value_action_, name))  \
     HPX_REGISTER_ACTION_DECLARATION(type::get_values_action,                   \
         HPX_PP_CAT(__vector_get_values_action_, name))                         \
+    HPX_REGISTER_ACTION_DECLARATION(type::get_value_range_action,              \
+        HPX_PP_CAT(__vector_get_value_range_action_, name))                    \
+    HPX_REGISTER_ACTION_DECLARATION(type::get_value_buffer_action,             \
+        HPX_PP_CAT(__vector_get_value_buffer_action_, name))                   \
     HPX_REGISTER_ACTION_DECLARATION(                                           \
         type::set_value_action, HPX_PP_CAT(__vector_set_value_action_, name))  \
     HPX_REGISTER_ACTION_DECLARATION(type::set_values_action,                   \
         HPX_PP_CAT(__vector_set_values_action_, name))                         \
+    HPX_REGISTER_ACTION_DECLARATION(type::set_value_range_action,              \
+        HPX_PP_CAT(__vector_set_value_range_action_, name))                    \
+    HPX_REGISTER_ACTION_DECLARATION(type::set_value_buffer_action,             \
+        HPX_PP_CAT(__vector_set_value_buffer_action_, name))                   \
+    HPX_REGISTER_ACTION_DECLARATION(type::transfer_range_action,               \
+        HPX_PP_CAT(__vector_transfer_range_action_, name))                     \
     HPX_REGISTER_ACTION_DECLARATION(                                           \
         type::size_action, HPX_PP_CAT(__vector_size_action_, name))            \
     HPX_REGISTER_ACTION_DECLARATION(                                           \
@@ -457,6 +576,47 @@ namespace hpx {
         future<std::vector<T>> get_values(
             std::vector<std::size_t> const& pos) const;
 
+        /// Returns the values in the range [\a first, \a last) of the
+        /// partitioned_vector_partition component.
+        ///
+        /// \param first Position of the first element in the
+        ///              partitioned_vector_partition
+        /// \param last  Position one past the last element in the
+        ///              partitioned_vector_partition
+        ///
+        /// \return Returns the values of the elements in the given range
+        ///
+        std::vector<T> get_value_range(
+            launch::sync_policy, std::size_t first, std::size_t last) const;
+
+        /// Returns the values in the range [\a first, \a last) of the
+        /// partitioned_vector_partition component.
+        ///
+        /// \param first Position of the first element in the
+        ///              partitioned_vector_partition
+        /// \param last  Position one past the last element in the
+        ///              partitioned_vector_partition
+        ///
+        /// \return This returns the values as the hpx::future
+        ///
+        future<std::vector<T>> get_value_range(
+            std::size_t first, std::size_t last) const;
+
+        /// Returns the values in the range [\a first, \a last) of the
+        /// partitioned_vector_partition component. The values are sent
+        /// without being copied into an intermediate buffer, they must not be
+        /// modified before the returned future has become ready.
+        ///
+        /// \param first Position of the first element in the
+        ///              partitioned_vector_partition
+        /// \param last  Position one past the last element in the
+        ///              partitioned_vector_partition
+        ///
+        /// \return This returns the values as the hpx::future
+        ///
+        future<serialization::serialize_buffer<T>> get_value_buffer(
+            std::size_t first, std::size_t last) const;
+
         // future<T> front_async() const
         // {
         //     HPX_ASSERT(this->get_id());
@@ -539,6 +699,44 @@ namespace hpx {
         future<void> set_values(
             std::vector<std::size_t> const& pos, std::vector<T> const& val);
 
+        /// Copy the values of \a val to the consecutive elements starting at
+        /// position \a first in the partitioned_vector_partition container.
+        ///
+        /// \param first Position of the first element in the
+        ///              partitioned_vector_partition
+        /// \param val   The values to be copied
+        ///
+        void set_value_range(launch::sync_policy, std::size_t first,
+            std::vector<T> const& val);
+
+        /// Copy the values of \a val to the consecutive elements starting at
+        /// position \a first in the partitioned_vector_partition component.
+        ///
+        /// \param first Position of the first element in the
+        ///              partitioned_vector_partition
+        /// \param val   The values to be copied
+        ///
+        /// \return This returns the hpx::future of type void
+        ///
+        future<void> set_value_range(
+            std::size_t first, std::vector<T> const& val);
+
+        /// Send the elements in the range [\a first, \a last) of the
+        /// partitioned_vector_partition component to the component \a dest,
+        /// which stores them starting at position \a dest_first.
+        ///
+        /// \param first      Position of the first element to send
+        /// \param last       Position one past the last element to send
+        /// \param dest       The partitioned_vector_partition receiving the
+        ///                   elements
+        /// \param dest_first Position of the first received element in
+        ///                   \a dest
+        ///
+        /// \return This returns the hpx::future of type void
+        ///
+        future<void> transfer_range(std::size_t first, std::size_t last,
+            hpx::id_type const& dest, std::size_t dest_first);
+
         //         void clear()
         //         {
         //             HPX_ASSERT(this->get_id());
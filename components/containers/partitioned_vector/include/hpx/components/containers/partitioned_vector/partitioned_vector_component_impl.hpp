@@ -23,6 +23,7 @@
 
 #include <hpx/components/containers/partitioned_vector/partitioned_vector_decl.hpp>
 
+#include <algorithm>
 #include <cstddef>
 #include <memory>
 #include <string>
@@ -46,6 +47,14 @@ namespace hpx { namespace server {
     {
     }
 
+    template <typename T, typename Data>
+    HPX_PARTITIONED_VECTOR_SPECIALIZATION_EXPORT
+    partitioned_vector<T, Data>::partitioned_vector(
+        size_type partition_size, allocator_type const& alloc)
+      : partitioned_vector_partition_(partition_size, alloc)
+    {
+    }
+
     template <typename T, typename Data>
     HPX_PARTITIONED_VECTOR_SPECIALIZATION_EXPORT
     partitioned_vector<T, Data>::partitioned_vector(
@@ -209,6 +218,35 @@ namespace hpx { namespace server {
         return result;
     }
 
+    template <typename T, typename Data>
+    HPX_PARTITIONED_VECTOR_SPECIALIZATION_EXPORT std::vector<T>
+    partitioned_vector<T, Data>::get_value_range(
+        size_type first, size_type last) const
+    {
+        HPX_ASSERT(first <= last);
+        HPX_ASSERT(last <= partitioned_vector_partition_.size());
+
+        return std::vector<T>(partitioned_vector_partition_.begin() + first,
+            partitioned_vector_partition_.begin() + last);
+    }
+
+    template <typename T, typename Data>
+    HPX_PARTITIONED_VECTOR_SPECIALIZATION_EXPORT
+        serialization::serialize_buffer<T>
+        partitioned_vector<T, Data>::get_value_buffer(
+            size_type first, size_type last) const
+    {
+        HPX_ASSERT(first <= last);
+        HPX_ASSERT(last <= partitioned_vector_partition_.size());
+
+        // the buffer refers to the data of this partition, the caller
+        // guarantees that the data is not modified until the buffer has been
+        // received
+        using buffer_type = serialization::serialize_buffer<T>;
+        return buffer_type(partitioned_vector_partition_.data() + first,
+            last - first, buffer_type::reference);
+    }
+
     template <typename T, typename Data>
     HPX_PARTITIONED_VECTOR_SPECIALIZATION_EXPORT T
     partitioned_vector<T, Data>::front() const
@@ -264,6 +302,48 @@ namespace hpx { namespace server {
             partitioned_vector_partition_[pos[i]] = val[i];
     }
 
+    template <typename T, typename Data>
+    HPX_PARTITIONED_VECTOR_SPECIALIZATION_EXPORT void
+    partitioned_vector<T, Data>::set_value_range(
+        size_type first, std::vector<T> const& val)
+    {
+        HPX_ASSERT(
+            first + val.size() <= partitioned_vector_partition_.size());
+
+        std::copy(val.begin(), val.end(),
+            partitioned_vector_partition_.begin() + first);
+    }
+
+    template <typename T, typename Data>
+    HPX_PARTITIONED_VECTOR_SPECIALIZATION_EXPORT void
+    partitioned_vector<T, Data>::set_value_buffer(
+        size_type first, serialization::serialize_buffer<T> const& buf)
+    {
+        HPX_ASSERT(
+            first + buf.size() <= partitioned_vector_partition_.size());
+
+        std::copy(buf.data(), buf.data() + buf.size(),
+            partitioned_vector_partition_.begin() + first);
+    }
+
+    template <typename T, typename Data>
+    HPX_PARTITIONED_VECTOR_SPECIALIZATION_EXPORT hpx::future<void>
+    partitioned_vector<T, Data>::transfer_range(size_type first,
+        size_type last, hpx::id_type const& dest, size_type dest_first)
+    {
+        HPX_ASSERT(first <= last);
+        HPX_ASSERT(last <= partitioned_vector_partition_.size());
+
+        // the buffer refers to the data of this partition, the caller
+        // guarantees that the data is not modified until the returned future
+        // has become ready
+        using buffer_type = serialization::serialize_buffer<T>;
+        buffer_type buf(partitioned_vector_partition_.data() + first,
+            last - first, buffer_type::reference);
+
+        return hpx::async<set_value_buffer_action>(dest, dest_first, buf);
+    }
+
     template <typename T, typename Data>
     HPX_PARTITIONED_VECTOR_SPECIALIZATION_EXPORT void
     partitioned_vector<T, Data>::clear()
@@ -286,10 +366,20 @@ namespace hpx { namespace server {
         type::get_value_action, HPX_PP_CAT(__vector_get_value_action_, name))  \
     HPX_REGISTER_ACTION(type::get_values_action,                               \
         HPX_PP_CAT(__vector_get_values_action_, name))                         \
+    HPX_REGISTER_ACTION(type::get_value_range_action,                          \
+        HPX_PP_CAT(__vector_get_value_range_action_, name))                    \
+    HPX_REGISTER_ACTION(type::get_value_buffer_action,                         \
+        HPX_PP_CAT(__vector_get_value_buffer_action_, name))                   \
     HPX_REGISTER_ACTION(                                                       \
         type::set_value_action, HPX_PP_CAT(__vector_set_value_action_, name))  \
     HPX_REGISTER_ACTION(type::set_values_action,                               \
         HPX_PP_CAT(__vector_set_values_action_, name))                         \
+    HPX_REGISTER_ACTION(type::set_value_range_action,                          \
+        HPX_PP_CAT(__vector_set_value_range_action_, name))                    \
+    HPX_REGISTER_ACTION(type::set_value_buffer_action,                         \
+        HPX_PP_CAT(__vector_set_value_buffer_action_, name))                   \
+    HPX_REGISTER_ACTION(type::transfer_range_action,                           \
+        HPX_PP_CAT(__vector_transfer_range_action_, name))                     \
     HPX_REGISTER_ACTION(                                                       \
         type::size_action, HPX_PP_CAT(__vector_size_action_, name))            \
     HPX_REGISTER_ACTION(                                                       \
@@ -435,6 +525,49 @@ namespace hpx {
 #endif
     }
 
+    template <typename T, typename Data /*= std::vector<T> */>
+    HPX_PARTITIONED_VECTOR_SPECIALIZATION_EXPORT std::vector<T>
+    partitioned_vector_partition<T, Data>::get_value_range(
+        launch::sync_policy, std::size_t first, std::size_t last) const
+    {
+        return get_value_range(first, last).get();
+    }
+
+    template <typename T, typename Data /*= std::vector<T> */>
+    HPX_PARTITIONED_VECTOR_SPECIALIZATION_EXPORT hpx::future<std::vector<T>>
+    partitioned_vector_partition<T, Data>::get_value_range(
+        std::size_t first, std::size_t last) const
+    {
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+        HPX_ASSERT(this->get_id());
+        return hpx::async<typename server_type::get_value_range_action>(
+            this->get_id(), first, last);
+#else
+        HPX_ASSERT(false);
+        HPX_UNUSED(first);
+        HPX_UNUSED(last);
+        return hpx::make_ready_future(std::vector<T>{});
+#endif
+    }
+
+    template <typename T, typename Data /*= std::vector<T> */>
+    HPX_PARTITIONED_VECTOR_SPECIALIZATION_EXPORT
+        hpx::future<serialization::serialize_buffer<T>>
+        partitioned_vector_partition<T, Data>::get_value_buffer(
+            std::size_t first, std::size_t last) const
+    {
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+        HPX_ASSERT(this->get_id());
+        return hpx::async<typename server_type::get_value_buffer_action>(
+            this->get_id(), first, last);
+#else
+        HPX_ASSERT(false);
+        HPX_UNUSED(first);
+        HPX_UNUSED(last);
+        return hpx::make_ready_future(serialization::serialize_buffer<T>{});
+#endif
+    }
+
     template <typename T, typename Data /*= std::vector<T> */>
     HPX_PARTITIONED_VECTOR_SPECIALIZATION_EXPORT void
     partitioned_vector_partition<T, Data>::set_value(
@@ -509,6 +642,50 @@ namespace hpx {
 #endif
     }
 
+    template <typename T, typename Data /*= std::vector<T> */>
+    HPX_PARTITIONED_VECTOR_SPECIALIZATION_EXPORT void
+    partitioned_vector_partition<T, Data>::set_value_range(
+        launch::sync_policy, std::size_t first, std::vector<T> const& val)
+    {
+        set_value_range(first, val).get();
+    }
+
+    template <typename T, typename Data /*= std::vector<T> */>
+    HPX_PARTITIONED_VECTOR_SPECIALIZATION_EXPORT hpx::future<void>
+    partitioned_vector_partition<T, Data>::set_value_range(
+        std::size_t first, std::vector<T> const& val)
+    {
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+        HPX_ASSERT(this->get_id());
+        return hpx::async<typename server_type::set_value_range_action>(
+            this->get_id(), first, val);
+#else
+        HPX_ASSERT(false);
+        HPX_UNUSED(first);
+        HPX_UNUSED(val);
+        return hpx::make_ready_future();
+#endif
+    }
+
+    template <typename T, typename Data /*= std::vector<T> */>
+    HPX_PARTITIONED_VECTOR_SPECIALIZATION_EXPORT hpx::future<void>
+    partitioned_vector_partition<T, Data>::transfer_range(std::size_t first,
+        std::size_t last, hpx::id_type const& dest, std::size_t dest_first)
+    {
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+        HPX_ASSERT(this->get_id());
+        return hpx::async<typename server_type::transfer_range_action>(
+            this->get_id(), first, last, dest, dest_first);
+#else
+        HPX_ASSERT(false);
+        HPX_UNUSED(first);
+        HPX_UNUSED(last);
+        HPX_UNUSED(dest);
+        HPX_UNUSED(dest_first);
+        return hpx::make_ready_future();
+#endif
+    }
+
     template <typename T, typename Data /*= std::vector<T> */>
     HPX_PARTITIONED_VECTOR_SPECIALIZATION_EXPORT
         typename partitioned_vector_partition<T, Data>::server_type::data_type
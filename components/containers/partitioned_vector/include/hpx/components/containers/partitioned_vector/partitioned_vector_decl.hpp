@@ -247,6 +247,7 @@ namespace hpx {
     private:
         friend class segmented::vector_iterator<T, Data>;
         friend class segmented::const_vector_iterator<T, Data>;
+        friend struct segmented::detail::vector_read_ahead_cache<T, Data>;
 
         friend class segmented::segment_vector_iterator<T, Data,
             typename partitions_vector_type::iterator>;
@@ -359,6 +360,10 @@ namespace hpx {
         // Perform a deep copy from the given vector
         void copy_from(partitioned_vector const& rhs);
 
+        // Move the elements of this vector into the partitions of the given
+        // vector of the same size and take over its partitions
+        future<void> redistribute_helper(partitioned_vector&& target);
+
     public:
         /// Default Constructor which create hpx::partitioned_vector with
         /// \a num_partitions = 0 and \a partition_size = 0. Hence overall size
@@ -506,6 +511,50 @@ namespace hpx {
             return size_;
         }
 
+        /// Asynchronously redistribute the elements of this vector over new
+        /// partitions created using the given distribution policy.
+        ///
+        /// The new partitions are created before this function returns. The
+        /// elements are then moved in parallel directly from the old to the
+        /// new partitions, every overlapping piece of an old and a new
+        /// partition is transferred using a single operation. The old
+        /// partitions are released once all elements have been moved.
+        ///
+        /// \param policy   The distribution policy to use for the new
+        ///                 partitions
+        ///
+        /// \return This returns the hpx::future of type void which becomes
+        ///         ready once the redistribution has finished.
+        ///
+        /// \note The vector must not be accessed before the returned future
+        ///       has become ready. A vector registered with a symbolic name
+        ///       has to be registered again afterwards.
+        ///
+        template <typename DistPolicy>
+        typename std::enable_if<
+            traits::is_distribution_policy<DistPolicy>::value,
+            future<void>>::type
+        redistribute(DistPolicy const& policy)
+        {
+            if (size_ == 0)
+                return make_ready_future();
+            return redistribute_helper(partitioned_vector(size_, policy));
+        }
+
+        /// Redistribute the elements of this vector over new partitions
+        /// created using the given distribution policy.
+        ///
+        /// \param policy   The distribution policy to use for the new
+        ///                 partitions
+        ///
+        template <typename DistPolicy>
+        typename std::enable_if<
+            traits::is_distribution_policy<DistPolicy>::value>::type
+        redistribute(launch::sync_policy, DistPolicy const& policy)
+        {
+            redistribute(policy).get();
+        }
+
         //
         //  Element access API's in vector class
         //
@@ -714,6 +763,116 @@ namespace hpx {
             return get_values(pos_vec).get();
         }
 
+        /// Returns the elements in the range [\a first, \a last) of the
+        /// given partition in the vector container.
+        ///
+        /// \param part  Sequence number of the partition
+        /// \param first Position of the first element in the partition
+        /// \param last  Position one past the last element in the partition
+        ///
+        /// \return Returns the values of the elements in the given range.
+        ///
+        std::vector<T> get_values(launch::sync_policy, size_type part,
+            size_type first, size_type last) const
+        {
+            partition_data const& part_data = partitions_[part];
+            if (part_data.local_data_)
+                return part_data.local_data_->get_value_range(first, last);
+
+            return partitioned_vector_partition_client(part_data.partition_)
+                .get_value_range(launch::sync, first, last);
+        }
+
+        /// Asynchronously returns the elements in the range [\a first,
+        /// \a last) of the given partition in the vector container.
+        ///
+        /// \param part  Sequence number of the partition
+        /// \param first Position of the first element in the partition
+        /// \param last  Position one past the last element in the partition
+        ///
+        /// \return Returns the hpx::future to the values of the elements in
+        ///         the given range.
+        ///
+        future<std::vector<T>> get_values(
+            size_type part, size_type first, size_type last) const
+        {
+            partition_data const& part_data = partitions_[part];
+            if (part_data.local_data_)
+            {
+                return make_ready_future(
+                    part_data.local_data_->get_value_range(first, last));
+            }
+
+            return partitioned_vector_partition_client(part_data.partition_)
+                .get_value_range(first, last);
+        }
+
+        /// Asynchronously returns the elements in the range [\a first,
+        /// \a last) of the vector container. All elements stored in the
+        /// same partition are transferred using a single operation.
+        ///
+        /// \param first Global position of the first element
+        /// \param last  Global position one past the last element
+        ///
+        /// \return Returns the hpx::future to the values of the elements in
+        ///         the given range.
+        ///
+        future<std::vector<T>> get_values(size_type first, size_type last) const
+        {
+            HPX_ASSERT(first <= last && last <= size_);
+            if (first == last)
+                return make_ready_future(std::vector<T>());
+
+            // vector holding futures of the values for all partitions
+            std::vector<future<std::vector<T>>> part_values_future;
+            for (size_type pos = first; pos != last; /**/)
+            {
+                size_type part = get_partition(pos);
+                size_type local_first = get_local_index(pos);
+                size_type count = (std::min)(
+                    partitions_[part].size_ - local_first, last - pos);
+
+                part_values_future.push_back(
+                    get_values(part, local_first, local_first + count));
+                pos += count;
+            }
+
+            if (part_values_future.size() == 1)
+                return HPX_MOVE(part_values_future.front());
+
+            return dataflow(
+                launch::async,
+                [count = last - first](
+                    std::vector<future<std::vector<T>>>&& part_values_f)
+                    -> std::vector<T> {
+                    std::vector<T> values;
+                    values.reserve(count);
+
+                    for (future<std::vector<T>>& part_f : part_values_f)
+                    {
+                        std::vector<T> part_values = part_f.get();
+                        std::move(part_values.begin(), part_values.end(),
+                            std::back_inserter(values));
+                    }
+                    return values;
+                },
+                HPX_MOVE(part_values_future));
+        }
+
+        /// Returns the elements in the range [\a first, \a last) of the
+        /// vector container.
+        ///
+        /// \param first Global position of the first element
+        /// \param last  Global position one past the last element
+        ///
+        /// \return Returns the values of the elements in the given range.
+        ///
+        std::vector<T> get_values(
+            launch::sync_policy, size_type first, size_type last) const
+        {
+            return get_values(first, last).get();
+        }
+
         // //FRONT (never throws exception)
         // /** @brief Access the value of first element in the vector.
         //  *
@@ -1045,6 +1204,88 @@ namespace hpx {
             return set_values(pos, val).get();
         }
 
+        /// Asynchronously copy the values of \a val to the consecutive
+        /// elements of the partition \a part starting at position \a first.
+        ///
+        /// \param part  Sequence number of the partition
+        /// \param first Position of the first element in the partition
+        /// \param val   The values to be copied
+        ///
+        /// \return This returns the hpx::future of type void which gets ready
+        ///         once the operation is finished.
+        ///
+        future<void> set_values(
+            size_type part, size_type first, std::vector<T> const& val)
+        {
+            partition_data const& part_data = partitions_[part];
+            if (part_data.local_data_)
+            {
+                part_data.local_data_->set_value_range(first, val);
+                return make_ready_future();
+            }
+
+            return partitioned_vector_partition_client(part_data.partition_)
+                .set_value_range(first, val);
+        }
+
+        /// Asynchronously copy the values of \a val to the consecutive
+        /// elements starting at the global position \a first. All elements
+        /// stored in the same partition are transferred using a single
+        /// operation.
+        ///
+        /// \param first Global position of the first element
+        /// \param val   The values to be copied
+        ///
+        /// \return This returns the hpx::future of type void which gets ready
+        ///         once the operation is finished.
+        ///
+        future<void> set_values(size_type first, std::vector<T> const& val)
+        {
+            HPX_ASSERT(first + val.size() <= size_);
+            if (val.empty())
+                return make_ready_future();
+
+            size_type part = get_partition(first);
+            size_type local_first = get_local_index(first);
+            if (partitions_[part].size_ - local_first >= val.size())
+            {
+                // all values belong to the same partition
+                return set_values(part, local_first, val);
+            }
+
+            // vector holding futures of the state for all partitions
+            std::vector<future<void>> part_futures;
+            for (auto val_it = val.begin(); val_it != val.end(); /**/)
+            {
+                size_type count = (std::min)(
+                    partitions_[part].size_ - local_first,
+                    static_cast<size_type>(std::distance(val_it, val.end())));
+
+                part_futures.push_back(set_values(part, local_first,
+                    std::vector<T>(val_it, val_it + count)));
+
+                val_it += count;
+                first += count;
+
+                part = get_partition(first);
+                local_first = get_local_index(first);
+            }
+
+            return hpx::when_all(part_futures);
+        }
+
+        /// Copy the values of \a val to the consecutive elements starting at
+        /// the global position \a first.
+        ///
+        /// \param first Global position of the first element
+        /// \param val   The values to be copied
+        ///
+        void set_values(
+            launch::sync_policy, size_type first, std::vector<T> const& val)
+        {
+            set_values(first, val).get();
+        }
+
         // //CLEAR
         // //TODO if number of partitions is kept constant every time then
         // // clear should modified (clear each partitioned_vector_partition
@@ -38,6 +38,12 @@ namespace hpx
 
         template <typename T, typename Data, typename BaseIter>
         class local_segment_vector_iterator;
+
+        namespace detail {
+
+            template <typename T, typename Data>
+            struct vector_read_ahead_cache;
+        }
     }
 
     namespace server
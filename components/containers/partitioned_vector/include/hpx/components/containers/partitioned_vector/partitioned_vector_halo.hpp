@@ -0,0 +1,274 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file hpx/components/partitioned_vector/partitioned_vector_halo.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/async_base/launch_policy.hpp>
+#include <hpx/async_combinators/when_all.hpp>
+#include <hpx/components/containers/partitioned_vector/partitioned_vector.hpp>
+#include <hpx/futures/future.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/runtime_local/get_locality_id.hpp>
+#include <hpx/serialization/serialize_buffer.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace hpx {
+
+    /// The partitioned_vector_halo maintains copies of the boundary regions
+    /// (halos, or ghost zones) of the neighbors of all segments of a
+    /// partitioned_vector which are located on the calling locality. The
+    /// left halo of a segment holds the last \a width elements of the
+    /// preceding segment, its right halo holds the first \a width elements
+    /// of the following segment. Halos are truncated to the size of the
+    /// neighboring segment.
+    ///
+    /// Each halo is fetched from its neighbor with a single request which
+    /// sends the boundary elements without copying them into an
+    /// intermediate buffer. Halos of neighbors located on the calling
+    /// locality are copied directly. The boundary regions must not be
+    /// modified while an update is in flight, the interior of the segments
+    /// (see \a interior_begin and \a interior_end) however can be.
+    ///
+    /// The halo refers to the segments the vector had when the halo was
+    /// constructed, the vector must not be redistributed or destroyed while
+    /// the halo is in use. The halo must outlive all futures returned from
+    /// \a update_halos.
+    ///
+    template <typename T, typename Data = std::vector<T>>
+    class partitioned_vector_halo
+    {
+    public:
+        using vector_type = hpx::partitioned_vector<T, Data>;
+        using iterator = typename vector_type::iterator;
+        using halo_type = serialization::serialize_buffer<T>;
+
+    private:
+        using partition_client = hpx::partitioned_vector_partition<T, Data>;
+        using partition_server = hpx::server::partitioned_vector<T, Data>;
+
+        struct partition_data
+        {
+            partition_client partition_;
+            std::shared_ptr<partition_server> local_data_;
+            std::size_t size_;
+        };
+
+        struct segment_data
+        {
+            std::size_t segment_;
+            std::size_t offset_;
+            std::size_t size_;
+            halo_type left_;
+            halo_type right_;
+        };
+
+    public:
+        /// Create the halos for the segments of \a data located on the
+        /// calling locality.
+        ///
+        /// \param data     The partitioned_vector the halos refer to
+        /// \param width    The number of elements in each halo
+        /// \param periodic The first and the last segment of the vector are
+        ///                 neighbors of each other
+        ///
+        partitioned_vector_halo(
+            vector_type& data, std::size_t width, bool periodic = false)
+          : data_(&data)
+          , width_(width)
+          , periodic_(periodic)
+        {
+            std::uint32_t const this_locality = hpx::get_locality_id();
+
+            std::size_t offset = 0;
+            for (auto it = data.segment_begin(); it != data.segment_end(); ++it)
+            {
+                auto const& part = *it;
+                if (part.locality_id_ == this_locality)
+                {
+                    segments_.push_back(segment_data{partitions_.size(),
+                        offset, part.size_, halo_type(), halo_type()});
+                }
+
+                partitions_.push_back(partition_data{
+                    partition_client(part.partition_), part.local_data_,
+                    part.size_});
+                offset += part.size_;
+            }
+        }
+
+        /// Return the number of elements in each halo
+        std::size_t width() const noexcept
+        {
+            return width_;
+        }
+
+        /// Return whether the first and the last segment of the vector are
+        /// neighbors of each other
+        bool periodic() const noexcept
+        {
+            return periodic_;
+        }
+
+        /// Return the indices of the segments located on the calling
+        /// locality
+        std::vector<std::size_t> local_segments() const
+        {
+            std::vector<std::size_t> result;
+            result.reserve(segments_.size());
+            for (segment_data const& s : segments_)
+            {
+                result.push_back(s.segment_);
+            }
+            return result;
+        }
+
+        /// Return the left halo of the segment \a segment, which has to be
+        /// located on the calling locality. The halo is empty for the first
+        /// segment of a non-periodic vector.
+        halo_type const& left_halo(std::size_t segment) const
+        {
+            return get_segment(segment, "left_halo").left_;
+        }
+
+        /// Return the right halo of the segment \a segment, which has to be
+        /// located on the calling locality. The halo is empty for the last
+        /// segment of a non-periodic vector.
+        halo_type const& right_halo(std::size_t segment) const
+        {
+            return get_segment(segment, "right_halo").right_;
+        }
+
+        /// Return the global iterator referring to the first element of the
+        /// segment \a segment which is not part of the halos of its neighbors
+        iterator interior_begin(std::size_t segment)
+        {
+            segment_data const& s = get_segment(segment, "interior_begin");
+            return data_->begin() + interior_first(s);
+        }
+
+        /// Return the global iterator referring to one past the last element
+        /// of the segment \a segment which is not part of the halos of its
+        /// neighbors
+        iterator interior_end(std::size_t segment)
+        {
+            segment_data const& s = get_segment(segment, "interior_end");
+            std::size_t const first = interior_first(s);
+            std::size_t const last =
+                s.offset_ + s.size_ - (std::min)(width_, s.size_);
+            return data_->begin() + (std::max)(first, last);
+        }
+
+        /// Exchange the halos of all segments located on the calling
+        /// locality with their neighbors.
+        ///
+        /// \return This returns the hpx::future of type void which becomes
+        ///         ready once all halos have been updated
+        ///
+        hpx::future<void> update_halos()
+        {
+            std::size_t const num_partitions = partitions_.size();
+
+            std::vector<hpx::future<void>> updates;
+            updates.reserve(2 * segments_.size());
+
+            for (segment_data& s : segments_)
+            {
+                if (s.segment_ != 0 || periodic_)
+                {
+                    updates.push_back(fetch_halo(s.left_,
+                        (s.segment_ + num_partitions - 1) % num_partitions,
+                        true));
+                }
+                if (s.segment_ + 1 != num_partitions || periodic_)
+                {
+                    updates.push_back(fetch_halo(
+                        s.right_, (s.segment_ + 1) % num_partitions, false));
+                }
+            }
+
+            return hpx::when_all(updates).then(hpx::launch::sync,
+                [](hpx::future<std::vector<hpx::future<void>>>&& f) -> void {
+                    // propagate exceptions
+                    for (hpx::future<void>& update : f.get())
+                        update.get();
+                });
+        }
+
+        /// Exchange the halos of all segments located on the calling
+        /// locality with their neighbors.
+        void update_halos(launch::sync_policy)
+        {
+            update_halos().get();
+        }
+
+    private:
+        segment_data const& get_segment(
+            std::size_t segment, char const* name) const
+        {
+            auto it = std::lower_bound(segments_.begin(), segments_.end(),
+                segment, [](segment_data const& s, std::size_t segment) {
+                    return s.segment_ < segment;
+                });
+
+            if (it == segments_.end() || it->segment_ != segment)
+            {
+                HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                    std::string("hpx::partitioned_vector_halo::") + name,
+                    "the given segment is not located on this locality");
+            }
+            return *it;
+        }
+
+        std::size_t interior_first(segment_data const& s) const noexcept
+        {
+            return s.offset_ + (std::min)(width_, s.size_);
+        }
+
+        hpx::future<void> fetch_halo(
+            halo_type& halo, std::size_t neighbor, bool from_end)
+        {
+            partition_data const& p = partitions_[neighbor];
+
+            std::size_t const count = (std::min)(width_, p.size_);
+            std::size_t const first = from_end ? p.size_ - count : 0;
+
+            if (p.local_data_)
+            {
+                halo = halo_type(p.local_data_->get_data().data() + first,
+                    count, halo_type::copy);
+                return hpx::make_ready_future();
+            }
+
+            return p.partition_.get_value_buffer(first, first + count)
+                .then(hpx::launch::sync,
+                    [&halo](hpx::future<halo_type>&& f) -> void {
+                        halo = f.get();
+                    });
+        }
+
+    private:
+        vector_type* data_;
+        std::size_t width_;
+        bool periodic_;
+
+        // all partitions of the vector
+        std::vector<partition_data> partitions_;
+
+        // the segments located on this locality, sorted by their index
+        std::vector<segment_data> segments_;
+    };
+}    // namespace hpx
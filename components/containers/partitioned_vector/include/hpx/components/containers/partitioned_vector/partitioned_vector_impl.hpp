@@ -468,6 +468,76 @@ namespace hpx {
         std::swap(partitions_, partitions);
     }
 
+    template <typename T, typename Data /*= std::vector<T> */>
+    HPX_PARTITIONED_VECTOR_SPECIALIZATION_EXPORT hpx::future<void>
+    partitioned_vector<T, Data>::redistribute_helper(
+        partitioned_vector&& target)
+    {
+        HPX_ASSERT(target.size_ == size_);
+
+        // walk the old and the new partitions in parallel, every piece
+        // covered by one old and one new partition is sent directly from
+        // the old to the new partition
+        std::vector<future<void>> transfers;
+        transfers.reserve(partitions_.size() + target.partitions_.size());
+
+        std::size_t src = 0, dest = 0;
+        size_type src_begin = 0, dest_begin = 0;
+        for (size_type pos = 0; pos != size_; /**/)
+        {
+            size_type const src_end = src_begin + partitions_[src].size_;
+            size_type const dest_end =
+                dest_begin + target.partitions_[dest].size_;
+
+            size_type const end = (std::min)(src_end, dest_end);
+            if (pos != end)
+            {
+                partition_data const& part = partitions_[src];
+                hpx::id_type const& dest_id =
+                    target.partitions_[dest].partition_;
+
+                if (part.local_data_)
+                {
+                    transfers.push_back(part.local_data_->transfer_range(
+                        pos - src_begin, end - src_begin, dest_id,
+                        pos - dest_begin));
+                }
+                else
+                {
+                    transfers.push_back(
+                        partitioned_vector_partition_client(part.partition_)
+                            .transfer_range(pos - src_begin, end - src_begin,
+                                dest_id, pos - dest_begin));
+                }
+                pos = end;
+            }
+
+            if (pos == src_end)
+            {
+                src_begin = src_end;
+                ++src;
+            }
+            if (pos == dest_end)
+            {
+                dest_begin = dest_end;
+                ++dest;
+            }
+        }
+
+        return hpx::when_all(transfers).then(hpx::launch::sync,
+            [this, target = HPX_MOVE(target)](
+                future<std::vector<future<void>>>&& f) mutable -> void {
+                // propagate exceptions, this vector keeps its partitions if
+                // any of the transfers failed
+                for (future<void>& transfer : f.get())
+                    transfer.get();
+
+                // the old partitions are released together with 'target'
+                std::swap(partitions_, target.partitions_);
+                std::swap(partition_size_, target.partition_size_);
+            });
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     template <typename T, typename Data /*= std::vector<T> */>
     HPX_PARTITIONED_VECTOR_SPECIALIZATION_EXPORT
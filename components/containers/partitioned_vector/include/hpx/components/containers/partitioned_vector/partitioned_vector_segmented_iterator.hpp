@@ -25,6 +25,7 @@
 #include <hpx/components/containers/partitioned_vector/partitioned_vector_component_decl.hpp>
 #include <hpx/components/containers/partitioned_vector/partitioned_vector_fwd.hpp>
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
 #include <iterator>
@@ -201,19 +202,106 @@ namespace hpx { namespace segmented {
             const_local_vector_iterator<T, Data> const& it_;
         };
 
+        ///////////////////////////////////////////////////////////////////////
+        // Values of remote partitions read through a (global) vector
+        // iterator are fetched in blocks. The size of the fetched block
+        // doubles with every block that directly follows the previous one,
+        // random accesses fetch a single element only.
+        //
+        // The cached block belongs to a single iterator instance, copies of
+        // an iterator start out with an empty cache. Writes through the
+        // iterator update the cached values, modifications of the vector
+        // made by other means become visible once the block is fetched again.
+        template <typename T, typename Data>
+        struct vector_read_ahead_cache
+        {
+            static constexpr std::size_t max_block_size = 512;
+
+            vector_read_ahead_cache() = default;
+
+            vector_read_ahead_cache(vector_read_ahead_cache const&) noexcept {}
+
+            vector_read_ahead_cache& operator=(
+                vector_read_ahead_cache const& rhs) noexcept
+            {
+                if (this != &rhs)
+                    clear();
+                return *this;
+            }
+
+            bool contains(std::size_t index) const noexcept
+            {
+                return index >= first_ && index - first_ < values_.size();
+            }
+
+            T get(partitioned_vector<T, Data> const& v, std::size_t index)
+            {
+                if (contains(index))
+                    return values_[index - first_];
+
+                // partitions located on this locality are accessed directly
+                std::size_t const part = v.get_partition(index);
+                auto const& part_data = v.partitions_[part];
+                std::size_t const local_index = v.get_local_index(index);
+                if (part_data.local_data_)
+                    return part_data.local_data_->get_value(local_index);
+
+                // grow the block only while the elements are read in order
+                if (!values_.empty() && index == first_ + values_.size())
+                {
+                    block_size_ = (std::min)(2 * block_size_, max_block_size);
+                }
+                else
+                {
+                    block_size_ = 1;
+                }
+
+                std::size_t const count = (std::min)(
+                    block_size_, part_data.size_ - local_index);
+
+                values_ = v.get_values(
+                    launch::sync, part, local_index, local_index + count);
+                first_ = index;
+
+                HPX_ASSERT(!values_.empty());
+                return values_.front();
+            }
+
+            void update(std::size_t index, T const& value)
+            {
+                if (contains(index))
+                    values_[index - first_] = value;
+            }
+
+            void clear() noexcept
+            {
+                values_.clear();
+                block_size_ = 1;
+            }
+
+            std::size_t first_ = 0;
+            std::size_t block_size_ = 1;
+            std::vector<T> values_;
+        };
+
         ///////////////////////////////////////////////////////////////////////
         template <typename T, typename Data>
         struct vector_value_proxy
         {
-            explicit vector_value_proxy(
-                hpx::partitioned_vector<T, Data>& v, std::size_t index)
+            explicit vector_value_proxy(hpx::partitioned_vector<T, Data>& v,
+                std::size_t index,
+                std::shared_ptr<vector_read_ahead_cache<T, Data>> cache =
+                    nullptr)
               : v_(v)
               , index_(index)
+              , cache_(HPX_MOVE(cache))
             {
             }
 
             operator T() const
             {
+                if (cache_)
+                    return cache_->get(v_, index_);
                 return v_.get_value(launch::sync, index_);
             }
 
@@ -222,12 +310,15 @@ namespace hpx { namespace segmented {
                     !std::is_same_v<std::decay_t<T_>, vector_value_proxy>>>
             vector_value_proxy& operator=(T_&& value)
             {
+                if (cache_)
+                    cache_->update(index_, value);
                 v_.set_value(launch::sync, index_, HPX_FORWARD(T_, value));
                 return *this;
             }
 
             partitioned_vector<T, Data>& v_;
             std::size_t index_;
+            std::shared_ptr<vector_read_ahead_cache<T, Data>> cache_;
         };
     }    // namespace detail
 
@@ -784,6 +875,25 @@ namespace hpx { namespace segmented {
         {
         }
 
+        // copies of an iterator don't share the values read ahead
+        vector_iterator(vector_iterator const& rhs)
+          : base_type(rhs)
+          , data_(rhs.data_)
+          , global_index_(rhs.global_index_)
+        {
+        }
+
+        vector_iterator& operator=(vector_iterator const& rhs)
+        {
+            if (this != &rhs)
+            {
+                data_ = rhs.data_;
+                global_index_ = rhs.global_index_;
+                cache_.reset();
+            }
+            return *this;
+        }
+
         partitioned_vector<T, Data>* get_data()
         {
             return data_;
@@ -809,8 +919,17 @@ namespace hpx { namespace segmented {
         typename base_type::reference dereference() const
         {
             HPX_ASSERT(data_);
+
+            // values of remote partitions are read through the cache
+            if (!cache_ &&
+                !data_->partitions_[data_->get_partition(global_index_)]
+                     .local_data_)
+            {
+                cache_ = std::make_shared<
+                    segmented::detail::vector_read_ahead_cache<T, Data>>();
+            }
             return segmented::detail::vector_value_proxy<T, Data>(
-                *data_, global_index_);
+                *data_, global_index_, cache_);
         }
 
         void increment()
@@ -844,6 +963,12 @@ namespace hpx { namespace segmented {
 
         // global position in the referenced vector
         size_type global_index_;
+
+        // values read ahead from a remote partition, shared with the
+        // proxies returned from dereference()
+        mutable std::shared_ptr<
+            segmented::detail::vector_read_ahead_cache<T, Data>>
+            cache_;
     };
 
     ///////////////////////////////////////////////////////////////////////////
@@ -901,7 +1026,7 @@ namespace hpx { namespace segmented {
         typename base_type::reference dereference() const
         {
             HPX_ASSERT(data_);
-            return data_->get_value(launch::sync, global_index_);
+            return cache_.get(*data_, global_index_);
         }
 
         void increment()
@@ -935,6 +1060,9 @@ namespace hpx { namespace segmented {
 
         // global position in the referenced vector
         size_type global_index_;
+
+        // values read ahead from a remote partition
+        mutable segmented::detail::vector_read_ahead_cache<T, Data> cache_;
     };
 }}    // namespace hpx::segmented
 
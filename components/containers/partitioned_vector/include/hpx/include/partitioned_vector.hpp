@@ -7,6 +7,7 @@
 #pragma once
 
 #include <hpx/components/containers/partitioned_vector/partitioned_vector.hpp>
+#include <hpx/components/containers/partitioned_vector/partitioned_vector_halo.hpp>
 
 
 
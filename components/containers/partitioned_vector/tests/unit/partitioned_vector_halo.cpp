@@ -0,0 +1,204 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx_main.hpp>
+#include <hpx/include/parallel_for_each.hpp>
+#include <hpx/include/partitioned_vector_predef.hpp>
+#include <hpx/include/runtime.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/runtime_distributed/find_all_localities.hpp>
+#include <hpx/runtime_distributed/find_here.hpp>
+
+#include <hpx/components/containers/partitioned_vector/partitioned_vector_halo.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <numeric>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// The vector types to be used are defined in partitioned_vector module.
+#if defined(HPX_HAVE_STATIC_LINKING)
+HPX_REGISTER_PARTITIONED_VECTOR(int)
+#endif
+
+using halo_type = hpx::partitioned_vector_halo<int>;
+
+struct negate
+{
+    void operator()(int& value) const
+    {
+        value = -value;
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// the global offsets of all segments of the vector, followed by its size
+std::vector<std::size_t> segment_offsets(hpx::partitioned_vector<int>& v)
+{
+    std::vector<std::size_t> offsets;
+    std::size_t offset = 0;
+    for (auto it = v.segment_begin(); it != v.segment_end(); ++it)
+    {
+        offsets.push_back(offset);
+        offset += it->size_;
+    }
+    offsets.push_back(offset);
+    return offsets;
+}
+
+void check_halo(halo_type::halo_type const& halo,
+    std::vector<int> const& expected, std::size_t first, std::size_t last)
+{
+    HPX_TEST_EQ(halo.size(), last - first);
+    for (std::size_t i = 0; i != halo.size() && first + i != last; ++i)
+    {
+        HPX_TEST_EQ(halo[i], expected[first + i]);
+    }
+}
+
+void check_halos(halo_type const& halo, std::vector<std::size_t> const& offsets,
+    std::vector<int> const& expected)
+{
+    std::size_t const num_segments = offsets.size() - 1;
+    std::size_t const width = halo.width();
+
+    for (std::size_t segment : halo.local_segments())
+    {
+        if (segment != 0 || halo.periodic())
+        {
+            std::size_t const left =
+                (segment + num_segments - 1) % num_segments;
+            std::size_t const last = offsets[left + 1];
+            std::size_t const first =
+                last - (std::min)(width, last - offsets[left]);
+            check_halo(halo.left_halo(segment), expected, first, last);
+        }
+        else
+        {
+            HPX_TEST_EQ(halo.left_halo(segment).size(), std::size_t(0));
+        }
+
+        if (segment + 1 != num_segments || halo.periodic())
+        {
+            std::size_t const right = (segment + 1) % num_segments;
+            std::size_t const first = offsets[right];
+            std::size_t const last =
+                first + (std::min)(width, offsets[right + 1] - first);
+            check_halo(halo.right_halo(segment), expected, first, last);
+        }
+        else
+        {
+            HPX_TEST_EQ(halo.right_halo(segment).size(), std::size_t(0));
+        }
+    }
+}
+
+void halo_test(std::size_t size, std::size_t width, bool periodic,
+    hpx::container_distribution_policy const& layout)
+{
+    std::vector<int> values(size);
+    std::iota(values.begin(), values.end(), 0);
+
+    hpx::partitioned_vector<int> v(size, layout);
+    v.set_values(hpx::launch::sync, 0, values);
+
+    std::vector<std::size_t> const offsets = segment_offsets(v);
+
+    std::size_t num_local_segments = 0;
+    for (auto it = v.segment_begin(); it != v.segment_end(); ++it)
+    {
+        if (it->locality_id_ == hpx::get_locality_id())
+            ++num_local_segments;
+    }
+
+    halo_type halo(v, width, periodic);
+    HPX_TEST_EQ(halo.width(), width);
+    HPX_TEST_EQ(halo.periodic(), periodic);
+    HPX_TEST_EQ(halo.local_segments().size(), num_local_segments);
+
+    halo.update_halos(hpx::launch::sync);
+    check_halos(halo, offsets, values);
+
+    // modify the interior of all segments while the halos are in flight
+    hpx::future<void> f = halo.update_halos();
+    for (std::size_t segment : halo.local_segments())
+    {
+        auto first = halo.interior_begin(segment);
+        auto last = halo.interior_end(segment);
+
+        std::size_t const begin = std::distance(v.begin(), first);
+        std::size_t const end = std::distance(v.begin(), last);
+        HPX_TEST(offsets[segment] <= begin);
+        HPX_TEST(begin <= end);
+        HPX_TEST(end <= offsets[segment + 1]);
+
+        hpx::for_each(hpx::execution::par, first, last, negate());
+        std::for_each(values.begin() + begin, values.begin() + end, negate());
+    }
+    f.get();
+
+    // the halos don't overlap with the modified interiors
+    check_halos(halo, offsets, values);
+    HPX_TEST(v.get_values(hpx::launch::sync, 0, v.size()) == values);
+
+    // the halos reflect the modified values after the next update
+    hpx::for_each(hpx::execution::par, v.begin(), v.end(), negate());
+    std::for_each(values.begin(), values.end(), negate());
+
+    halo.update_halos().get();
+    check_halos(halo, offsets, values);
+}
+
+void halo_tests(std::size_t size, std::size_t width)
+{
+    std::vector<hpx::id_type> const localities = hpx::find_all_localities();
+    std::vector<hpx::id_type> const here(1, hpx::find_here());
+
+    for (bool periodic : {false, true})
+    {
+        halo_test(size, width, periodic, hpx::container_layout(here));
+        halo_test(size, width, periodic, hpx::container_layout(4, here));
+        halo_test(size, width, periodic, hpx::container_layout(localities));
+        halo_test(size, width, periodic, hpx::container_layout(7, localities));
+    }
+}
+
+int main()
+{
+    halo_tests(1007, 1);
+    halo_tests(1007, 3);
+    halo_tests(100, 50);
+    halo_tests(10, 0);
+
+    // accessing the halos of a segment which is not local throws
+    std::vector<hpx::id_type> const localities = hpx::find_all_localities();
+    if (localities.size() > 1)
+    {
+        hpx::partitioned_vector<int> v(
+            100, hpx::container_layout(localities));
+        halo_type halo(v, 1);
+        HPX_TEST_EQ(halo.local_segments().size(), std::size_t(1));
+
+        bool caught_exception = false;
+        try
+        {
+            std::size_t const segment =
+                halo.local_segments()[0] == 0 ? 1 : 0;
+            halo.left_halo(segment);
+        }
+        catch (hpx::exception const&)
+        {
+            caught_exception = true;
+        }
+        HPX_TEST(caught_exception);
+    }
+
+    return hpx::util::report_errors();
+}
+#endif
@@ -0,0 +1,89 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx_main.hpp>
+#include <hpx/include/partitioned_vector_predef.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/runtime_distributed/find_all_localities.hpp>
+#include <hpx/runtime_distributed/find_here.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <numeric>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// The vector types to be used are defined in partitioned_vector module.
+#if defined(HPX_HAVE_STATIC_LINKING)
+HPX_REGISTER_PARTITIONED_VECTOR(int)
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+void check_vector(hpx::partitioned_vector<int> const& v,
+    std::vector<int> const& expected, std::size_t num_partitions)
+{
+    HPX_TEST_EQ(v.size(), expected.size());
+    HPX_TEST_EQ(static_cast<std::size_t>(
+                    std::distance(v.segment_begin(), v.segment_end())),
+        num_partitions);
+
+    HPX_TEST(v.get_values(hpx::launch::sync, 0, v.size()) == expected);
+}
+
+void redistribute_test(std::size_t size)
+{
+    std::vector<hpx::id_type> const localities = hpx::find_all_localities();
+    std::vector<hpx::id_type> const here(1, hpx::find_here());
+
+    std::vector<int> values(size);
+    std::iota(values.begin(), values.end(), 0);
+
+    hpx::partitioned_vector<int> v(size, hpx::container_layout(localities));
+    v.set_values(hpx::launch::sync, 0, values);
+    check_vector(v, values, localities.size());
+
+    // grow the number of partitions
+    v.redistribute(hpx::launch::sync, hpx::container_layout(7, localities));
+    check_vector(v, values, 7);
+
+    // shrink the number of partitions, moving everything to one locality
+    v.redistribute(hpx::container_layout(3, here)).get();
+    check_vector(v, values, 3);
+
+    // partition boundaries which don't align with the previous ones
+    v.redistribute(hpx::container_layout(5, localities)).get();
+    check_vector(v, values, 5);
+
+    v.redistribute(hpx::launch::sync, hpx::container_layout(here));
+    check_vector(v, values, 1);
+
+    // the vector is fully usable after redistribution
+    std::vector<int> doubled(size);
+    std::transform(values.begin(), values.end(), doubled.begin(),
+        [](int value) { return 2 * value; });
+
+    v.set_values(hpx::launch::sync, 0, doubled);
+    v.redistribute(hpx::launch::sync, hpx::container_layout(4, localities));
+    check_vector(v, doubled, 4);
+}
+
+int main()
+{
+    redistribute_test(1);
+    redistribute_test(10);
+    redistribute_test(1007);
+
+    // redistributing an empty vector does nothing
+    hpx::partitioned_vector<int> v;
+    v.redistribute(hpx::launch::sync, hpx::container_layout(3));
+    HPX_TEST_EQ(v.size(), std::size_t(0));
+
+    return hpx::util::report_errors();
+}
+#endif
@@ -0,0 +1,655 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file hpx/components/containers/unordered/concurrent_hash_map.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
+#include <hpx/synchronization/spinlock.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// A hash map which can be accessed concurrently from many threads.
+    ///
+    /// The keys are distributed over a fixed number of shards based on the
+    /// high bits of their (mixed) hash value. Every shard is an open
+    /// addressing table using Robin Hood hashing with backward shift
+    /// deletion, which is protected by its own spinlock. Operations on
+    /// different shards never contend with each other, and no operation
+    /// holds a lock while the calling thread could be suspended.
+    ///
+    /// Iteration and the copy/move operations are not synchronized with
+    /// concurrent modifications of the map. Every element has an index which
+    /// stays valid as long as the map is not modified, the index of an
+    /// element is its position in the sequence of all slots of all shards.
+    template <typename Key, typename T, typename Hash = std::hash<Key>,
+        typename KeyEqual = std::equal_to<Key>>
+    class concurrent_hash_map
+    {
+    public:
+        typedef Key key_type;
+        typedef T mapped_type;
+        typedef std::pair<Key, T> value_type;
+        typedef std::size_t size_type;
+
+        typedef std::unordered_map<Key, T, Hash, KeyEqual> std_map_type;
+
+        // the number of shards, has to be a power of two
+        static constexpr std::size_t num_shards = 32;
+
+        // the index referring to the end of the map
+        static constexpr std::size_t npos = std::size_t(-1);
+
+    private:
+        static constexpr std::size_t shard_bits = 5;
+        static_assert(std::size_t(1) << shard_bits == num_shards,
+            "shard_bits has to correspond to num_shards");
+
+        // the smallest non-zero number of slots in a shard
+        static constexpr std::size_t min_shard_capacity = 8;
+
+        typedef hpx::spinlock mutex_type;
+
+        struct slot
+        {
+            // the probe sequence length plus one, zero marks an empty slot
+            std::uint32_t distance_ = 0;
+            std::size_t hash_ = 0;
+            std::optional<value_type> value_;
+        };
+
+        struct shard
+        {
+            mutable mutex_type mtx_;
+            std::vector<slot> slots_;
+            std::atomic<std::size_t> size_{0};
+        };
+
+        typedef util::cache_aligned_data_derived<shard> shard_type;
+
+        // Mix the bits of the user supplied hash value. The partitions of a
+        // hpx::unordered_map are selected based on the hash value as well,
+        // all keys stored in one partition share the same remainder.
+        static std::size_t mix(std::size_t h) noexcept
+        {
+            std::uint64_t x = static_cast<std::uint64_t>(h);
+            x ^= x >> 30;
+            x *= 0xbf58476d1ce4e5b9ULL;
+            x ^= x >> 27;
+            x *= 0x94d049bb133111ebULL;
+            x ^= x >> 31;
+            return static_cast<std::size_t>(x);
+        }
+
+        std::size_t hash_of(Key const& key) const
+        {
+            return mix(hash_(key));
+        }
+
+        shard& shard_of(std::size_t h) const
+        {
+            return shards_[h >> (std::numeric_limits<std::size_t>::digits -
+                                    shard_bits)];
+        }
+
+        // Return the slot holding the given key, or nullptr. The shard has
+        // to be locked.
+        slot* find_slot(shard& s, Key const& key, std::size_t h) const
+        {
+            std::size_t const capacity = s.slots_.size();
+            if (capacity == 0)
+                return nullptr;
+
+            std::size_t const mask = capacity - 1;
+            std::size_t pos = h & mask;
+            for (std::uint32_t distance = 1;; ++distance)
+            {
+                slot& current = s.slots_[pos];
+
+                // with Robin Hood hashing the key can't be stored further
+                // away from its home slot than the element encountered here
+                if (current.distance_ < distance)
+                    return nullptr;
+
+                if (current.hash_ == h && equal_(current.value_->first, key))
+                    return &current;
+
+                pos = (pos + 1) & mask;
+            }
+        }
+
+        // Insert a value whose key is known not to be stored in the shard.
+        // The shard has to be locked and has to have a free slot.
+        static void insert_new(shard& s, value_type&& value, std::size_t h)
+        {
+            std::size_t const mask = s.slots_.size() - 1;
+            std::size_t pos = h & mask;
+
+            slot inserted;
+            inserted.distance_ = 1;
+            inserted.hash_ = h;
+            inserted.value_.emplace(HPX_MOVE(value));
+
+            while (true)
+            {
+                slot& current = s.slots_[pos];
+                if (current.distance_ == 0)
+                {
+                    current = HPX_MOVE(inserted);
+                    return;
+                }
+
+                // steal the slot from elements closer to their home slot
+                if (current.distance_ < inserted.distance_)
+                {
+                    std::swap(current, inserted);
+                }
+
+                pos = (pos + 1) & mask;
+                ++inserted.distance_;
+            }
+        }
+
+        static void rehash(shard& s, std::size_t capacity)
+        {
+            std::vector<slot> slots(capacity);
+            std::swap(s.slots_, slots);
+
+            for (slot& current : slots)
+            {
+                if (current.distance_ != 0)
+                {
+                    insert_new(s, HPX_MOVE(*current.value_), current.hash_);
+                }
+            }
+        }
+
+        // Make sure the shard has room for one more element while keeping
+        // the load factor below 7/8. The shard has to be locked.
+        static void reserve_one(shard& s)
+        {
+            std::size_t const capacity = s.slots_.size();
+            std::size_t const size = s.size_.load(std::memory_order_relaxed);
+            if (capacity == 0)
+            {
+                rehash(s, min_shard_capacity);
+            }
+            else if ((size + 1) * 8 > capacity * 7)
+            {
+                rehash(s, 2 * capacity);
+            }
+        }
+
+        // Remove the element stored in the given slot, moving the elements
+        // following it back by one slot. The shard has to be locked.
+        static void erase_slot(shard& s, slot* current)
+        {
+            std::size_t const mask = s.slots_.size() - 1;
+            std::size_t pos = static_cast<std::size_t>(current - &s.slots_[0]);
+
+            while (true)
+            {
+                std::size_t const next_pos = (pos + 1) & mask;
+                slot& next = s.slots_[next_pos];
+                if (next.distance_ <= 1)
+                    break;
+
+                slot& hole = s.slots_[pos];
+                hole.hash_ = next.hash_;
+                hole.distance_ = next.distance_ - 1;
+                hole.value_ = HPX_MOVE(next.value_);
+                pos = next_pos;
+            }
+
+            slot& last = s.slots_[pos];
+            last.distance_ = 0;
+            last.value_.reset();
+
+            s.size_.fetch_sub(1, std::memory_order_relaxed);
+        }
+
+        static std::size_t shard_capacity(std::size_t count)
+        {
+            if (count == 0)
+                return 0;
+
+            // keep the load factor below 7/8
+            std::size_t capacity = min_shard_capacity;
+            while (count * 8 > capacity * 7)
+                capacity *= 2;
+            return capacity;
+        }
+
+        // Convert an element index into the shard number and the slot in
+        // this shard
+        std::pair<std::size_t, std::size_t> shard_position(
+            std::size_t index) const
+        {
+            for (std::size_t i = 0; i != num_shards; ++i)
+            {
+                std::size_t const capacity = shards_[i].slots_.size();
+                if (index < capacity)
+                    return std::make_pair(i, index);
+                index -= capacity;
+            }
+            return std::make_pair(num_shards, std::size_t(0));
+        }
+
+        void copy_from(concurrent_hash_map const& rhs)
+        {
+            for (std::size_t i = 0; i != num_shards; ++i)
+            {
+                shard const& src = rhs.shards_[i];
+                shard& dest = shards_[i];
+
+                std::lock_guard<mutex_type> l(src.mtx_);
+                dest.slots_ = src.slots_;
+                dest.size_.store(src.size_.load(std::memory_order_relaxed),
+                    std::memory_order_relaxed);
+            }
+        }
+
+        template <typename Shard, typename Value>
+        class iterator_base
+        {
+        public:
+            typedef std::forward_iterator_tag iterator_category;
+            typedef std::remove_const_t<Value> value_type;
+            typedef std::ptrdiff_t difference_type;
+            typedef Value* pointer;
+            typedef Value& reference;
+
+            iterator_base() = default;
+
+            iterator_base(Shard* shards, std::size_t shard, std::size_t pos)
+              : shards_(shards)
+              , shard_(shard)
+              , pos_(pos)
+            {
+                satisfy_invariant();
+            }
+
+            // allow conversion of iterator to const_iterator
+            template <typename OtherShard, typename OtherValue,
+                typename Enable = std::enable_if_t<
+                    std::is_convertible_v<OtherShard*, Shard*>>>
+            iterator_base(iterator_base<OtherShard, OtherValue> const& rhs)
+              : shards_(rhs.shards_)
+              , shard_(rhs.shard_)
+              , pos_(rhs.pos_)
+            {
+            }
+
+            reference operator*() const
+            {
+                return *shards_[shard_].slots_[pos_].value_;
+            }
+            pointer operator->() const
+            {
+                return &**this;
+            }
+
+            iterator_base& operator++()
+            {
+                ++pos_;
+                satisfy_invariant();
+                return *this;
+            }
+            iterator_base operator++(int)
+            {
+                iterator_base tmp(*this);
+                ++*this;
+                return tmp;
+            }
+
+            friend bool operator==(
+                iterator_base const& lhs, iterator_base const& rhs) noexcept
+            {
+                return lhs.shard_ == rhs.shard_ && lhs.pos_ == rhs.pos_;
+            }
+            friend bool operator!=(
+                iterator_base const& lhs, iterator_base const& rhs) noexcept
+            {
+                return !(lhs == rhs);
+            }
+
+        private:
+            template <typename, typename>
+            friend class iterator_base;
+
+            friend class concurrent_hash_map;
+
+            // advance to the next occupied slot, or to the end
+            void satisfy_invariant()
+            {
+                while (shard_ != num_shards)
+                {
+                    auto& slots = shards_[shard_].slots_;
+                    while (pos_ != slots.size())
+                    {
+                        if (slots[pos_].distance_ != 0)
+                            return;
+                        ++pos_;
+                    }
+                    ++shard_;
+                    pos_ = 0;
+                }
+            }
+
+            Shard* shards_ = nullptr;
+            std::size_t shard_ = num_shards;
+            std::size_t pos_ = 0;
+        };
+
+    public:
+        typedef iterator_base<shard_type, value_type> iterator;
+        typedef iterator_base<shard_type const, value_type const>
+            const_iterator;
+
+        ///////////////////////////////////////////////////////////////////////
+        concurrent_hash_map()
+          : shards_(new shard_type[num_shards])
+        {
+        }
+
+        explicit concurrent_hash_map(size_type bucket_count,
+            Hash const& hash = Hash(), KeyEqual const& equal = KeyEqual())
+          : hash_(hash)
+          , equal_(equal)
+          , shards_(new shard_type[num_shards])
+        {
+            std::size_t const capacity =
+                shard_capacity((bucket_count + num_shards - 1) / num_shards);
+            for (std::size_t i = 0; i != num_shards; ++i)
+            {
+                shards_[i].slots_.resize(capacity);
+            }
+        }
+
+        explicit concurrent_hash_map(std_map_type const& m)
+          : hash_(m.hash_function())
+          , equal_(m.key_eq())
+          , shards_(new shard_type[num_shards])
+        {
+            for (auto const& value : m)
+            {
+                insert_or_assign(value.first, value.second);
+            }
+        }
+
+        concurrent_hash_map(concurrent_hash_map const& rhs)
+          : hash_(rhs.hash_)
+          , equal_(rhs.equal_)
+          , shards_(new shard_type[num_shards])
+        {
+            copy_from(rhs);
+        }
+
+        concurrent_hash_map(concurrent_hash_map&& rhs)
+          : hash_(HPX_MOVE(rhs.hash_))
+          , equal_(HPX_MOVE(rhs.equal_))
+          , shards_(HPX_MOVE(rhs.shards_))
+        {
+            rhs.shards_.reset(new shard_type[num_shards]);
+        }
+
+        concurrent_hash_map& operator=(concurrent_hash_map const& rhs)
+        {
+            if (this != &rhs)
+            {
+                hash_ = rhs.hash_;
+                equal_ = rhs.equal_;
+                copy_from(rhs);
+            }
+            return *this;
+        }
+
+        concurrent_hash_map& operator=(concurrent_hash_map&& rhs)
+        {
+            if (this != &rhs)
+            {
+                hash_ = HPX_MOVE(rhs.hash_);
+                equal_ = HPX_MOVE(rhs.equal_);
+                shards_ = HPX_MOVE(rhs.shards_);
+                rhs.shards_.reset(new shard_type[num_shards]);
+            }
+            return *this;
+        }
+
+        /// Return a copy of all elements as a std::unordered_map
+        std_map_type to_std_map() const
+        {
+            std_map_type m(0, hash_, equal_);
+            m.reserve(size());
+            for (std::size_t i = 0; i != num_shards; ++i)
+            {
+                shard const& s = shards_[i];
+
+                std::lock_guard<mutex_type> l(s.mtx_);
+                for (slot const& current : s.slots_)
+                {
+                    if (current.distance_ != 0)
+                        m.insert(*current.value_);
+                }
+            }
+            return m;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        iterator begin()
+        {
+            return iterator(shards_.get(), 0, 0);
+        }
+        const_iterator begin() const
+        {
+            return const_iterator(shards_.get(), 0, 0);
+        }
+        const_iterator cbegin() const
+        {
+            return begin();
+        }
+
+        iterator end()
+        {
+            return iterator(shards_.get(), num_shards, 0);
+        }
+        const_iterator end() const
+        {
+            return const_iterator(shards_.get(), num_shards, 0);
+        }
+        const_iterator cend() const
+        {
+            return end();
+        }
+
+        /// Return an iterator referring to the element with the given index,
+        /// or to the first element following it
+        iterator iterator_at(std::size_t index)
+        {
+            auto [shard, pos] = shard_position(index);
+            return iterator(shards_.get(), shard, pos);
+        }
+        const_iterator iterator_at(std::size_t index) const
+        {
+            auto [shard, pos] = shard_position(index);
+            return const_iterator(shards_.get(), shard, pos);
+        }
+
+        /// Return the index of the element referred to by the given iterator
+        std::size_t index_of(const_iterator const& it) const
+        {
+            if (it.shard_ == num_shards)
+                return npos;
+
+            std::size_t index = it.pos_;
+            for (std::size_t i = 0; i != it.shard_; ++i)
+            {
+                index += shards_[i].slots_.size();
+            }
+            return index;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        size_type size() const noexcept
+        {
+            std::size_t result = 0;
+            for (std::size_t i = 0; i != num_shards; ++i)
+            {
+                result += shards_[i].size_.load(std::memory_order_relaxed);
+            }
+            return result;
+        }
+
+        bool empty() const noexcept
+        {
+            return size() == 0;
+        }
+
+        size_type max_size() const noexcept
+        {
+            return std::vector<slot>().max_size();
+        }
+
+        /// Returns the number of slots currently allocated
+        size_type capacity() const
+        {
+            std::size_t result = 0;
+            for (std::size_t i = 0; i != num_shards; ++i)
+            {
+                shard const& s = shards_[i];
+
+                std::lock_guard<mutex_type> l(s.mtx_);
+                result += s.slots_.size();
+            }
+            return result;
+        }
+
+        Hash hash_function() const
+        {
+            return hash_;
+        }
+
+        KeyEqual key_eq() const
+        {
+            return equal_;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// Copy the value stored for the given key into \a value, returns
+        /// whether the key was found.
+        bool find(Key const& key, T& value) const
+        {
+            std::size_t const h = hash_of(key);
+            shard& s = shard_of(h);
+
+            std::lock_guard<mutex_type> l(s.mtx_);
+            slot* current = find_slot(s, key, h);
+            if (current == nullptr)
+                return false;
+
+            value = current->value_->second;
+            return true;
+        }
+
+        /// Move the value stored for the given key into \a value and remove
+        /// the element, returns whether the key was found.
+        bool extract(Key const& key, T& value)
+        {
+            std::size_t const h = hash_of(key);
+            shard& s = shard_of(h);
+
+            std::lock_guard<mutex_type> l(s.mtx_);
+            slot* current = find_slot(s, key, h);
+            if (current == nullptr)
+                return false;
+
+            value = HPX_MOVE(current->value_->second);
+            erase_slot(s, current);
+            return true;
+        }
+
+        bool contains(Key const& key) const
+        {
+            std::size_t const h = hash_of(key);
+            shard& s = shard_of(h);
+
+            std::lock_guard<mutex_type> l(s.mtx_);
+            return find_slot(s, key, h) != nullptr;
+        }
+
+        /// Store the given value for the given key, returns whether a new
+        /// element was inserted.
+        template <typename T_>
+        bool insert_or_assign(Key const& key, T_&& value)
+        {
+            std::size_t const h = hash_of(key);
+            shard& s = shard_of(h);
+
+            std::lock_guard<mutex_type> l(s.mtx_);
+            slot* current = find_slot(s, key, h);
+            if (current != nullptr)
+            {
+                current->value_->second = HPX_FORWARD(T_, value);
+                return false;
+            }
+
+            reserve_one(s);
+            insert_new(s, value_type(key, HPX_FORWARD(T_, value)), h);
+            s.size_.fetch_add(1, std::memory_order_relaxed);
+            return true;
+        }
+
+        /// Remove the element with the given key, returns the number of
+        /// elements removed.
+        size_type erase(Key const& key)
+        {
+            std::size_t const h = hash_of(key);
+            shard& s = shard_of(h);
+
+            std::lock_guard<mutex_type> l(s.mtx_);
+            slot* current = find_slot(s, key, h);
+            if (current == nullptr)
+                return 0;
+
+            erase_slot(s, current);
+            return 1;
+        }
+
+        void clear()
+        {
+            for (std::size_t i = 0; i != num_shards; ++i)
+            {
+                shard& s = shards_[i];
+
+                std::lock_guard<mutex_type> l(s.mtx_);
+                s.slots_.clear();
+                s.size_.store(0, std::memory_order_relaxed);
+            }
+        }
+
+    private:
+        Hash hash_;
+        KeyEqual equal_;
+        std::unique_ptr<shard_type[]> shards_;
+    };
+}}    // namespace hpx::detail
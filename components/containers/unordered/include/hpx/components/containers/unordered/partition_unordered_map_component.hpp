@@ -12,8 +12,8 @@
 ///
 /// \brief The partition_unordered_map as the hpx component is defined here.
 ///
-/// The partition_unordered_map is the wrapper to the stl unordered_map class
-/// except all API'are defined as component action. All the API's in client
+/// The partition_unordered_map stores its elements in a concurrent hash map
+/// and exposes all API's as component actions. All the API's in client
 /// classes are asynchronous API which return the futures.
 
 #include <hpx/config.hpp>
@@ -28,15 +28,17 @@
 #include <hpx/components/get_ptr.hpp>
 #include <hpx/components_base/server/component.hpp>
 #include <hpx/components_base/server/component_base.hpp>
-#include <hpx/components_base/server/locking_hook.hpp>
 #include <hpx/modules/collectives.hpp>
 #include <hpx/modules/errors.hpp>
 #include <hpx/preprocessor/cat.hpp>
 #include <hpx/preprocessor/expand.hpp>
 #include <hpx/preprocessor/nargs.hpp>
 #include <hpx/runtime_components/component_factory.hpp>
+#include <hpx/serialization/map.hpp>
 #include <hpx/type_support/unused.hpp>
 
+#include <hpx/components/containers/unordered/concurrent_hash_map.hpp>
+
 #include <cstddef>
 #include <memory>
 #include <string>
@@ -46,29 +48,37 @@
 #include <vector>
 
 namespace hpx { namespace server {
-    /// \brief This is the basic wrapper class for stl unordered_map.
+    /// \brief This is the basic wrapper class for a concurrent hash map.
     ///
     /// This contain the implementation of the partition_unordered_map's
-    /// component functionality.
+    /// component functionality. The elements are stored in a concurrent
+    /// open addressing hash map, which allows for the actions (and the
+    /// direct accesses from the hpx::unordered_map on the same locality) to
+    /// run concurrently without serializing on a component wide lock.
     template <typename Key, typename T, typename Hash = std::hash<Key>,
         typename KeyEqual = std::equal_to<Key>>
     class partition_unordered_map
-      : public components::locking_hook<hpx::components::component_base<
-            partition_unordered_map<Key, T, Hash, KeyEqual>>>
+      : public hpx::components::component_base<
+            partition_unordered_map<Key, T, Hash, KeyEqual>>
     {
     public:
+        // the data of a partition is transferred as std::unordered_map
         typedef std::unordered_map<Key, T, Hash, KeyEqual> data_type;
 
-        typedef typename data_type::size_type size_type;
-        typedef typename data_type::iterator iterator_type;
-        typedef typename data_type::const_iterator const_iterator_type;
+        typedef hpx::detail::concurrent_hash_map<Key, T, Hash, KeyEqual>
+            storage_type;
+
+        typedef typename storage_type::size_type size_type;
+        typedef typename storage_type::value_type value_type;
+        typedef typename storage_type::iterator iterator_type;
+        typedef typename storage_type::const_iterator const_iterator_type;
 
-        typedef components::locking_hook<hpx::components::component_base<
-            partition_unordered_map<Key, T, Hash, KeyEqual>>>
+        typedef hpx::components::component_base<
+            partition_unordered_map<Key, T, Hash, KeyEqual>>
             base_type;
 
     private:
-        data_type partition_unordered_map_;
+        storage_type partition_unordered_map_;
 
     public:
         ///////////////////////////////////////////////////////////////////////
@@ -127,11 +137,11 @@ namespace hpx { namespace server {
         /// Duplicate the copy method for action naming
         data_type get_copied_data() const
         {
-            return partition_unordered_map_;
+            return partition_unordered_map_.to_std_map();
         }
         void set_copied_data(data_type&& d)
         {
-            partition_unordered_map_ = HPX_MOVE(d);
+            partition_unordered_map_ = storage_type(d);
         }
 
         ///////////////////////////////////////////////////////////////////////
@@ -161,6 +171,44 @@ namespace hpx { namespace server {
             return partition_unordered_map_.cend();
         }
 
+        /// Return the iterator referring to the element with the given
+        /// index, or to the first element following it.
+        iterator_type iterator_at(std::size_t index)
+        {
+            return partition_unordered_map_.iterator_at(index);
+        }
+        const_iterator_type iterator_at(std::size_t index) const
+        {
+            return partition_unordered_map_.iterator_at(index);
+        }
+
+        /// Return the index of the element referred to by the given iterator.
+        std::size_t index_of(const_iterator_type const& it) const
+        {
+            return partition_unordered_map_.index_of(it);
+        }
+
+        /// Return the index of the element with the given index, or of the
+        /// first element following it (std::size_t(-1) if there is none).
+        std::size_t normalize_index(std::size_t index) const
+        {
+            return index_of(iterator_at(index));
+        }
+
+        /// Return the element (key and value) with the given index.
+        value_type get_element(std::size_t index) const
+        {
+            const_iterator_type it = iterator_at(index);
+            if (index_of(it) != index)
+            {
+                HPX_THROW_EXCEPTION(bad_parameter,
+                    "partition_unordered_map::get_element",
+                    "there is no element with the requested index in this "
+                    "partition of the unordered_map");
+            }
+            return *it;
+        }
+
         ///////////////////////////////////////////////////////////////////////
         // Capacity Related API's in the server class
         ///////////////////////////////////////////////////////////////////////
@@ -203,39 +251,20 @@ namespace hpx { namespace server {
         /// \return Return the value of the element at position represented
         ///         by \a pos.
         ///
-        struct erase_on_exit
-        {
-            erase_on_exit(data_type& m, typename data_type::iterator& it)
-              : m_(m)
-              , it_(it)
-            {
-            }
-            ~erase_on_exit()
-            {
-                m_.erase(it_);
-            }
-
-            data_type& m_;
-            typename data_type::iterator& it_;
-        };
-
         T get_value(Key const& key, bool erase)
         {
-            typename data_type::iterator it =
-                partition_unordered_map_.find(key);
-            if (it == partition_unordered_map_.end())
+            T value;
+            bool const found = erase ?
+                partition_unordered_map_.extract(key, value) :
+                partition_unordered_map_.find(key, value);
+            if (!found)
             {
                 HPX_THROW_EXCEPTION(bad_parameter,
                     "partition_unordered_map::get_value",
                     "unable to find requested key in this partition of the "
                     "unordered_map");
             }
-
-            if (!erase)
-                return it->second;
-
-            erase_on_exit t(partition_unordered_map_, it);
-            return it->second;
+            return value;
         }
 
         /// Return the element at the position \a pos in the partition_unordered_map
@@ -248,22 +277,16 @@ namespace hpx { namespace server {
         ///
         std::vector<T> get_values(std::vector<Key> const& keys)
         {
-            std::vector<T> result;
-            result.reserve(keys.size());
-
+            std::vector<T> result(keys.size());
             for (std::size_t i = 0; i != keys.size(); ++i)
             {
-                typename data_type::iterator it =
-                    partition_unordered_map_.find(keys[i]);
-                if (it == partition_unordered_map_.end())
+                if (!partition_unordered_map_.find(keys[i], result[i]))
                 {
                     HPX_THROW_EXCEPTION(bad_parameter,
                         "partition_unordered_map::get_values",
                         "unable to find requested key in this partition of the "
                         "unordered_map");
-                    break;
                 }
-                result.push_back(it->second);
             }
             return result;
         }
@@ -281,7 +304,7 @@ namespace hpx { namespace server {
         ///
         void set_value(Key const& pos, T const& val)
         {
-            partition_unordered_map_[pos] = val;
+            partition_unordered_map_.insert_or_assign(pos, val);
         }
 
         /// Copy the value of \a val for the elements at positions \a pos in
@@ -294,10 +317,9 @@ namespace hpx { namespace server {
         void set_values(std::vector<Key> const& keys, std::vector<T> const& val)
         {
             HPX_ASSERT(keys.size() == val.size());
-            HPX_ASSERT(keys.size() <= partition_unordered_map_.size());
 
             for (std::size_t i = 0; i != keys.size(); ++i)
-                partition_unordered_map_[keys[i]] = val[i];
+                partition_unordered_map_.insert_or_assign(keys[i], val[i]);
         }
 
         /// Remove all elements from the vector leaving the
@@ -325,6 +347,11 @@ namespace hpx { namespace server {
 
         HPX_DEFINE_COMPONENT_DIRECT_ACTION(partition_unordered_map, erase)
 
+        HPX_DEFINE_COMPONENT_DIRECT_ACTION(
+            partition_unordered_map, normalize_index)
+        HPX_DEFINE_COMPONENT_DIRECT_ACTION(
+            partition_unordered_map, get_element)
+
         HPX_DEFINE_COMPONENT_DIRECT_ACTION(
             partition_unordered_map, get_copied_data)
         HPX_DEFINE_COMPONENT_DIRECT_ACTION(
@@ -376,6 +403,12 @@ namespace hpx { namespace server {
     HPX_REGISTER_ACTION_DECLARATION(                                           \
         HPX_PP_CAT(partition_unordered_map, __LINE__)::erase_action,           \
         HPX_PP_CAT(__unordered_map_erase_action_, name))                       \
+    HPX_REGISTER_ACTION_DECLARATION(                                           \
+        HPX_PP_CAT(partition_unordered_map, __LINE__)::normalize_index_action, \
+        HPX_PP_CAT(__unordered_map_normalize_index_action_, name))             \
+    HPX_REGISTER_ACTION_DECLARATION(                                           \
+        HPX_PP_CAT(partition_unordered_map, __LINE__)::get_element_action,     \
+        HPX_PP_CAT(__unordered_map_get_element_action_, name))                 \
     HPX_REGISTER_ACTION_DECLARATION(                                           \
         HPX_PP_CAT(partition_unordered_map, __LINE__)::get_copied_data_action, \
         HPX_PP_CAT(__unordered_map_get_copied_data_action_, name))             \
@@ -433,6 +466,12 @@ namespace hpx { namespace server {
     HPX_REGISTER_ACTION(                                                       \
         HPX_PP_CAT(partition_unordered_map, __LINE__)::erase_action,           \
         HPX_PP_CAT(__unordered_map_erase_action_, name))                       \
+    HPX_REGISTER_ACTION(                                                       \
+        HPX_PP_CAT(partition_unordered_map, __LINE__)::normalize_index_action, \
+        HPX_PP_CAT(__unordered_map_normalize_index_action_, name))             \
+    HPX_REGISTER_ACTION(                                                       \
+        HPX_PP_CAT(partition_unordered_map, __LINE__)::get_element_action,     \
+        HPX_PP_CAT(__unordered_map_get_element_action_, name))                 \
     HPX_REGISTER_ACTION(                                                       \
         HPX_PP_CAT(partition_unordered_map, __LINE__)::get_copied_data_action, \
         HPX_PP_CAT(__unordered_map_get_copied_data_action_, name))             \
@@ -676,6 +715,42 @@ namespace hpx {
                 this->get_id(), key);
         }
 
+        /// Return the index of the element with the given index, or of the
+        /// first element following it in the partition_unordered_map
+        ///
+        /// \param index  Index of the element in the partition_unordered_map
+        ///
+        std::size_t normalize_index(
+            launch::sync_policy, std::size_t index) const
+        {
+            return normalize_index(index).get();
+        }
+
+        future<std::size_t> normalize_index(std::size_t index) const
+        {
+            HPX_ASSERT(this->get_id());
+            return hpx::async<typename server_type::normalize_index_action>(
+                this->get_id(), index);
+        }
+
+        /// Return the element (key and value) with the given index in the
+        /// partition_unordered_map
+        ///
+        /// \param index  Index of the element in the partition_unordered_map
+        ///
+        std::pair<Key, T> get_element(
+            launch::sync_policy, std::size_t index) const
+        {
+            return get_element(index).get();
+        }
+
+        future<std::pair<Key, T>> get_element(std::size_t index) const
+        {
+            HPX_ASSERT(this->get_id());
+            return hpx::async<typename server_type::get_element_action>(
+                this->get_id(), index);
+        }
+
         /// Get/set all the data of this partition
         future<typename server_type::data_type> get_data() const
         {
@@ -12,6 +12,7 @@
 #include <hpx/actions_base/traits/is_distribution_policy.hpp>
 #include <hpx/assert.hpp>
 #include <hpx/async_combinators/wait_all.hpp>
+#include <hpx/async_combinators/when_all.hpp>
 #include <hpx/components/client_base.hpp>
 #include <hpx/components/get_ptr.hpp>
 #include <hpx/components_base/component_type.hpp>
@@ -265,6 +266,14 @@ namespace hpx {
 #endif
 
     private:
+        template <typename Key_, typename T_, typename Hash_,
+            typename KeyEqual_, typename BaseIter>
+        friend class segmented::segment_unordered_map_iterator;
+
+        template <typename Key_, typename T_, typename Hash_,
+            typename KeyEqual_, typename BaseIter>
+        friend class segmented::const_segment_unordered_map_iterator;
+
         typedef hpx::components::client_base<unordered_map,
             hpx::components::server::distributed_metadata_base<
                 server::unordered_map_config_data>>
@@ -366,6 +375,26 @@ namespace hpx {
             return this->hasher_(key) % partitions_.size();
         }
 
+        // Distribute the given keys over the partitions they belong to, the
+        // positions of the keys in the original sequence are stored in
+        // positions.
+        std::vector<std::vector<Key>> group_by_partition(
+            std::vector<Key> const& keys,
+            std::vector<std::vector<std::size_t>>& positions) const
+        {
+            std::vector<std::vector<Key>> part_keys(partitions_.size());
+            positions.clear();
+            positions.resize(partitions_.size());
+
+            for (std::size_t i = 0; i != keys.size(); ++i)
+            {
+                std::size_t const part = get_partition(keys[i]);
+                part_keys[part].push_back(keys[i]);
+                positions[part].push_back(i);
+            }
+            return part_keys;
+        }
+
         std::vector<hpx::id_type> get_partition_ids() const
         {
             std::vector<hpx::id_type> ids;
@@ -800,6 +829,148 @@ namespace hpx {
                 .set_value(pos, HPX_FORWARD(T_, val));
         }
 
+        /// Returns the elements with the given keys from the unordered_map
+        /// container.
+        ///
+        /// \param keys  Keys of the elements in the unordered_map
+        ///
+        /// \return Returns the values of the elements in the order of the
+        ///         given keys.
+        ///
+        std::vector<T> get_values(
+            launch::sync_policy, std::vector<Key> const& keys) const
+        {
+            return get_values(keys).get();
+        }
+
+        /// Asynchronously returns the elements with the given keys from the
+        /// unordered_map container. The keys are grouped by partition, every
+        /// partition is accessed using a single action.
+        ///
+        /// \param keys  Keys of the elements in the unordered_map
+        ///
+        /// \return Returns the hpx::future to the values of the elements in
+        ///         the order of the given keys.
+        ///
+        future<std::vector<T>> get_values(std::vector<Key> const& keys) const
+        {
+            std::vector<std::vector<std::size_t>> positions;
+            std::vector<std::vector<Key>> part_keys =
+                group_by_partition(keys, positions);
+
+            std::vector<std::size_t> parts;
+            std::vector<future<std::vector<T>>> values;
+            for (std::size_t part = 0; part != part_keys.size(); ++part)
+            {
+                if (part_keys[part].empty())
+                    continue;
+
+                partition_data const& part_data = partitions_[part];
+                if (part_data.local_data_)
+                {
+                    values.push_back(make_ready_future(
+                        part_data.local_data_->get_values(part_keys[part])));
+                }
+                else
+                {
+                    values.push_back(
+                        partition_unordered_map_client(part_data.partition_)
+                            .get_values(part_keys[part]));
+                }
+                parts.push_back(part);
+            }
+
+            return hpx::when_all(values).then(hpx::launch::sync,
+                [count = keys.size(), positions = HPX_MOVE(positions),
+                    parts = HPX_MOVE(parts)](
+                    future<std::vector<future<std::vector<T>>>>&& f) {
+                    std::vector<future<std::vector<T>>> part_results =
+                        f.get();
+
+                    std::vector<T> result(count);
+                    for (std::size_t i = 0; i != part_results.size(); ++i)
+                    {
+                        std::vector<T> part_values = part_results[i].get();
+                        std::vector<std::size_t> const& pos =
+                            positions[parts[i]];
+
+                        HPX_ASSERT(part_values.size() == pos.size());
+                        for (std::size_t j = 0; j != pos.size(); ++j)
+                        {
+                            result[pos[j]] = HPX_MOVE(part_values[j]);
+                        }
+                    }
+                    return result;
+                });
+        }
+
+        /// Copy the values \a vals to the elements with the given keys in
+        /// the unordered_map container.
+        ///
+        /// \param keys  Keys of the elements in the unordered_map
+        /// \param vals  The values to be copied
+        ///
+        void set_values(launch::sync_policy, std::vector<Key> const& keys,
+            std::vector<T> const& vals)
+        {
+            set_values(keys, vals).get();
+        }
+
+        /// Asynchronously copy the values \a vals to the elements with the
+        /// given keys in the unordered_map container. The keys are grouped by
+        /// partition, every partition is accessed using a single action.
+        ///
+        /// \param keys  Keys of the elements in the unordered_map
+        /// \param vals  The values to be copied
+        ///
+        /// \return This returns the hpx::future of type void which gets ready
+        ///         once the operation is finished.
+        ///
+        future<void> set_values(
+            std::vector<Key> const& keys, std::vector<T> const& vals)
+        {
+            HPX_ASSERT(keys.size() == vals.size());
+
+            std::vector<std::vector<std::size_t>> positions;
+            std::vector<std::vector<Key>> part_keys =
+                group_by_partition(keys, positions);
+
+            std::vector<future<void>> results;
+            for (std::size_t part = 0; part != part_keys.size(); ++part)
+            {
+                if (part_keys[part].empty())
+                    continue;
+
+                std::vector<T> part_vals;
+                part_vals.reserve(positions[part].size());
+                for (std::size_t pos : positions[part])
+                {
+                    part_vals.push_back(vals[pos]);
+                }
+
+                partition_data const& part_data = partitions_[part];
+                if (part_data.local_data_)
+                {
+                    part_data.local_data_->set_values(
+                        part_keys[part], part_vals);
+                }
+                else
+                {
+                    results.push_back(
+                        partition_unordered_map_client(part_data.partition_)
+                            .set_values(part_keys[part], part_vals));
+                }
+            }
+
+            return hpx::when_all(results).then(hpx::launch::sync,
+                [](future<std::vector<future<void>>>&& f) {
+                    for (future<void>& result : f.get())
+                    {
+                        result.get();    // propagate exceptions
+                    }
+                });
+        }
+
         /// Asynchronously compute the size of the unordered_map.
         ///
         /// \return Return the number of elements in the unordered_map
@@ -879,6 +1050,17 @@ namespace hpx {
         }
 
         ///////////////////////////////////////////////////////////////////////
+        typedef segmented::unordered_map_iterator<Key, T, Hash, KeyEqual>
+            iterator;
+        typedef segmented::const_unordered_map_iterator<Key, T, Hash, KeyEqual>
+            const_iterator;
+
+        typedef segmented::local_unordered_map_iterator<Key, T, Hash, KeyEqual>
+            local_iterator;
+        typedef segmented::const_local_unordered_map_iterator<Key, T, Hash,
+            KeyEqual>
+            const_local_iterator;
+
         typedef segmented::segment_unordered_map_iterator<Key, T, Hash,
             KeyEqual, typename partitions_vector_type::iterator>
             segment_iterator;
@@ -886,6 +1068,123 @@ namespace hpx {
             KeyEqual, typename partitions_vector_type::const_iterator>
             const_segment_iterator;
 
+        /// Return the iterator referring to the first element of the
+        /// unordered_map.
+        ///
+        /// \note The iterators of the unordered_map are invalidated by any
+        ///       modification of the unordered_map.
+        ///
+        iterator begin()
+        {
+            return iterator(this, 0, 0);
+        }
+        const_iterator begin() const
+        {
+            return const_iterator(this, 0, 0);
+        }
+        const_iterator cbegin() const
+        {
+            return const_iterator(this, 0, 0);
+        }
+
+        /// Return the iterator referring to the end of the unordered_map.
+        iterator end()
+        {
+            return iterator(this, partitions_.size(), std::size_t(-1));
+        }
+        const_iterator end() const
+        {
+            return const_iterator(this, partitions_.size(), std::size_t(-1));
+        }
+        const_iterator cend() const
+        {
+            return const_iterator(this, partitions_.size(), std::size_t(-1));
+        }
+
+        // Return the segment iterator referencing the given partition.
+        segment_iterator get_segment_iterator(size_type part)
+        {
+            HPX_ASSERT(part <= partitions_.size());
+            return segment_iterator(partitions_.begin() + part, this);
+        }
+        const_segment_iterator get_const_segment_iterator(size_type part) const
+        {
+            HPX_ASSERT(part <= partitions_.size());
+            return const_segment_iterator(partitions_.cbegin() + part, this);
+        }
+
+        // Return the sequence number of the partition referenced by the given
+        // segment iterator.
+        template <typename SegmentIter>
+        size_type get_segment_index(SegmentIter const& it) const
+        {
+            return std::distance(partitions_.cbegin(),
+                typename partitions_vector_type::const_iterator(it.base()));
+        }
+
+        // Return the local iterator referencing the element with the given
+        // index inside the given partition.
+        local_iterator get_local_iterator(size_type part, size_type index) const
+        {
+            HPX_ASSERT(!partitions_.empty());
+            if (part == partitions_.size())
+            {
+                // return an iterator to the end of the last partition
+                partition_data const& back = partitions_.back();
+                return local_iterator(
+                    back.partition_, std::size_t(-1), back.local_data_);
+            }
+
+            partition_data const& part_data = partitions_[part];
+            return local_iterator(
+                part_data.partition_, index, part_data.local_data_);
+        }
+        const_local_iterator get_const_local_iterator(
+            size_type part, size_type index) const
+        {
+            return const_local_iterator(get_local_iterator(part, index));
+        }
+
+        // Move the given position to the next element stored in the
+        // unordered_map, or to the end of the unordered_map.
+        void normalize_position(size_type& part, size_type& index) const
+        {
+            for (/**/; part < partitions_.size(); ++part, index = 0)
+            {
+                partition_data const& part_data = partitions_[part];
+                if (part_data.local_data_)
+                {
+                    index = part_data.local_data_->normalize_index(index);
+                }
+                else
+                {
+                    index =
+                        partition_unordered_map_client(part_data.partition_)
+                            .normalize_index(launch::sync, index);
+                }
+
+                if (index != std::size_t(-1))
+                    return;
+            }
+
+            part = partitions_.size();
+            index = std::size_t(-1);
+        }
+
+        // Return the element (key and value) with the given index inside the
+        // given partition.
+        std::pair<Key, T> get_element(size_type part, size_type index) const
+        {
+            HPX_ASSERT(part < partitions_.size());
+
+            partition_data const& part_data = partitions_[part];
+            if (part_data.local_data_)
+                return part_data.local_data_->get_element(index);
+
+            return partition_unordered_map_client(part_data.partition_)
+                .get_element(launch::sync, index);
+        }
+
         // Return global segment iterator
         segment_iterator segment_begin()
         {
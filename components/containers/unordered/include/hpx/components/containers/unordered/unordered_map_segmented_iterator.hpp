@@ -14,16 +14,24 @@
 // http://lafstern.org/matt/segmented.pdf.
 
 #include <hpx/config.hpp>
+#include <hpx/algorithms/traits/segmented_iterator_traits.hpp>
 #include <hpx/assert.hpp>
+#include <hpx/async_base/launch_policy.hpp>
 #include <hpx/iterator_support/iterator_adaptor.hpp>
+#include <hpx/iterator_support/iterator_facade.hpp>
+#include <hpx/naming_base/id_type.hpp>
+#include <hpx/runtime_local/get_locality_id.hpp>
+#include <hpx/serialization/serialize.hpp>
 
 #include <hpx/components/containers/unordered/partition_unordered_map_component.hpp>
 
+#include <cstddef>
 #include <cstdint>
 #include <iterator>
 #include <limits>
 #include <memory>
 #include <type_traits>
+#include <utility>
 #include <vector>
 
 namespace hpx {
@@ -35,12 +43,389 @@ namespace hpx {
 
 namespace hpx { namespace segmented {
 
+    template <typename Key, typename T, typename Hash, typename KeyEqual>
+    class local_unordered_map_iterator;
+    template <typename Key, typename T, typename Hash, typename KeyEqual>
+    class const_local_unordered_map_iterator;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // This class wraps plain a partition_unordered_map<>::iterator or
+    // partition_unordered_map<>::const_iterator
     template <typename Key, typename T, typename Hash, typename KeyEqual,
         typename BaseIter>
-    class segment_unordered_map_iterator;
+    class local_raw_unordered_map_iterator
+      : public hpx::util::iterator_adaptor<
+            local_raw_unordered_map_iterator<Key, T, Hash, KeyEqual, BaseIter>,
+            BaseIter>
+    {
+    private:
+        typedef hpx::util::iterator_adaptor<
+            local_raw_unordered_map_iterator<Key, T, Hash, KeyEqual, BaseIter>,
+            BaseIter>
+            base_type;
+        typedef BaseIter base_iterator;
+
+        typedef server::partition_unordered_map<Key, T, Hash, KeyEqual>
+            partition_server;
+
+    public:
+        typedef local_unordered_map_iterator<Key, T, Hash, KeyEqual>
+            local_iterator;
+        typedef const_local_unordered_map_iterator<Key, T, Hash, KeyEqual>
+            local_const_iterator;
+
+        local_raw_unordered_map_iterator() = default;
+
+        local_raw_unordered_map_iterator(base_iterator const& it,
+            std::shared_ptr<partition_server> const& data)
+          : base_type(it)
+          , data_(data)
+        {
+        }
+
+        local_iterator remote()
+        {
+            HPX_ASSERT(data_);
+            return local_iterator(
+                partition_unordered_map<Key, T, Hash, KeyEqual>(
+                    data_->get_id()),
+                data_->index_of(this->base()), data_);
+        }
+        local_const_iterator remote() const
+        {
+            HPX_ASSERT(data_);
+            return local_const_iterator(
+                partition_unordered_map<Key, T, Hash, KeyEqual>(
+                    data_->get_id()),
+                data_->index_of(this->base()), data_);
+        }
+
+    private:
+        std::shared_ptr<partition_server> data_;
+    };
+
     template <typename Key, typename T, typename Hash, typename KeyEqual,
         typename BaseIter>
-    class const_segment_unordered_map_iterator;
+    class const_local_raw_unordered_map_iterator
+      : public hpx::util::iterator_adaptor<
+            const_local_raw_unordered_map_iterator<Key, T, Hash, KeyEqual,
+                BaseIter>,
+            BaseIter>
+    {
+    private:
+        typedef hpx::util::iterator_adaptor<
+            const_local_raw_unordered_map_iterator<Key, T, Hash, KeyEqual,
+                BaseIter>,
+            BaseIter>
+            base_type;
+        typedef BaseIter base_iterator;
+
+        typedef server::partition_unordered_map<Key, T, Hash, KeyEqual>
+            partition_server;
+
+    public:
+        typedef const_local_unordered_map_iterator<Key, T, Hash, KeyEqual>
+            local_iterator;
+        typedef const_local_unordered_map_iterator<Key, T, Hash, KeyEqual>
+            local_const_iterator;
+
+        const_local_raw_unordered_map_iterator() = default;
+
+        const_local_raw_unordered_map_iterator(base_iterator const& it,
+            std::shared_ptr<partition_server> const& data)
+          : base_type(it)
+          , data_(data)
+        {
+        }
+
+        local_const_iterator remote() const
+        {
+            HPX_ASSERT(data_);
+            return local_const_iterator(
+                partition_unordered_map<Key, T, Hash, KeyEqual>(
+                    data_->get_id()),
+                data_->index_of(this->base()), data_);
+        }
+
+    private:
+        std::shared_ptr<partition_server> data_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// This class implements the local iterator functionality for the
+    /// partitioned backend of a hpx::unordered_map.
+    ///
+    /// The position of the referenced element is described by its index in
+    /// the partition. The iterator can be dereferenced on the locality of
+    /// the partition only.
+    template <typename Key, typename T, typename Hash, typename KeyEqual>
+    class local_unordered_map_iterator
+      : public hpx::util::iterator_facade<
+            local_unordered_map_iterator<Key, T, Hash, KeyEqual>,
+            std::pair<Key, T>, std::forward_iterator_tag>
+    {
+    private:
+        typedef hpx::util::iterator_facade<
+            local_unordered_map_iterator<Key, T, Hash, KeyEqual>,
+            std::pair<Key, T>, std::forward_iterator_tag>
+            base_type;
+
+        typedef server::partition_unordered_map<Key, T, Hash, KeyEqual>
+            partition_server;
+
+    public:
+        typedef std::size_t size_type;
+
+        // constructors
+        local_unordered_map_iterator()
+          : partition_()
+          , index_(size_type(-1))
+        {
+        }
+
+        local_unordered_map_iterator(
+            partition_unordered_map<Key, T, Hash, KeyEqual> partition,
+            size_type index,
+            std::shared_ptr<partition_server> const& data)
+          : partition_(partition)
+          , index_(index)
+          , data_(data)
+        {
+        }
+
+        typedef segmented::local_raw_unordered_map_iterator<Key, T, Hash,
+            KeyEqual, typename partition_server::iterator_type>
+            local_raw_iterator;
+        typedef segmented::const_local_raw_unordered_map_iterator<Key, T,
+            Hash, KeyEqual, typename partition_server::const_iterator_type>
+            local_raw_const_iterator;
+
+        ///////////////////////////////////////////////////////////////////////
+        local_raw_iterator local()
+        {
+            if (partition_ && !data_)
+                data_ = partition_.get_ptr();
+            return local_raw_iterator(data_->iterator_at(index_), data_);
+        }
+        local_raw_const_iterator local() const
+        {
+            if (partition_ && !data_)
+                data_ = partition_.get_ptr();
+            return local_raw_const_iterator(
+                static_cast<partition_server const&>(*data_).iterator_at(
+                    index_),
+                data_);
+        }
+
+    private:
+        friend class hpx::serialization::access;
+
+        template <typename Archive>
+        void load(Archive& ar, unsigned /* version */)
+        {
+            ar& partition_& index_;
+        }
+        template <typename Archive>
+        void save(Archive& ar, unsigned /* version */) const
+        {
+            ar& partition_& index_;
+        }
+
+        HPX_SERIALIZATION_SPLIT_MEMBER()
+
+    protected:
+        friend class hpx::util::iterator_core_access;
+
+        bool equal(local_unordered_map_iterator const& other) const
+        {
+            return partition_ == other.partition_ && index_ == other.index_;
+        }
+
+        typename base_type::reference dereference() const
+        {
+            HPX_ASSERT(get_data());
+            return *data_->iterator_at(index_);
+        }
+
+        void increment()
+        {
+            if (get_data())
+                index_ = data_->normalize_index(index_ + 1);
+            else
+                index_ = partition_.normalize_index(launch::sync, index_ + 1);
+        }
+
+    public:
+        partition_unordered_map<Key, T, Hash, KeyEqual>& get_partition()
+        {
+            return partition_;
+        }
+        partition_unordered_map<Key, T, Hash, KeyEqual> get_partition() const
+        {
+            return partition_;
+        }
+
+        size_type get_index() const
+        {
+            return index_;
+        }
+
+        std::shared_ptr<partition_server> const& get_data() const
+        {
+            // only partitions located on this locality can be accessed
+            // directly
+            if (partition_ && !data_ &&
+                naming::get_locality_id_from_id(partition_.get_id()) ==
+                    hpx::get_locality_id())
+            {
+                data_ = partition_.get_ptr();
+            }
+            return data_;
+        }
+
+    protected:
+        // refer to a partition of the unordered_map
+        partition_unordered_map<Key, T, Hash, KeyEqual> partition_;
+
+        // index of the referenced element in the partition
+        size_type index_;
+
+        // caching address of component
+        mutable std::shared_ptr<partition_server> data_;
+    };
+
+    template <typename Key, typename T, typename Hash, typename KeyEqual>
+    class const_local_unordered_map_iterator
+      : public hpx::util::iterator_facade<
+            const_local_unordered_map_iterator<Key, T, Hash, KeyEqual>,
+            std::pair<Key, T> const, std::forward_iterator_tag>
+    {
+    private:
+        typedef hpx::util::iterator_facade<
+            const_local_unordered_map_iterator<Key, T, Hash, KeyEqual>,
+            std::pair<Key, T> const, std::forward_iterator_tag>
+            base_type;
+
+        typedef server::partition_unordered_map<Key, T, Hash, KeyEqual>
+            partition_server;
+
+    public:
+        typedef std::size_t size_type;
+
+        // constructors
+        const_local_unordered_map_iterator()
+          : partition_()
+          , index_(size_type(-1))
+        {
+        }
+
+        const_local_unordered_map_iterator(
+            partition_unordered_map<Key, T, Hash, KeyEqual> partition,
+            size_type index,
+            std::shared_ptr<partition_server> const& data)
+          : partition_(partition)
+          , index_(index)
+          , data_(data)
+        {
+        }
+
+        const_local_unordered_map_iterator(
+            local_unordered_map_iterator<Key, T, Hash, KeyEqual> const& it)
+          : partition_(it.get_partition())
+          , index_(it.get_index())
+          , data_(it.get_data())
+        {
+        }
+
+        typedef segmented::const_local_raw_unordered_map_iterator<Key, T,
+            Hash, KeyEqual, typename partition_server::const_iterator_type>
+            local_raw_iterator;
+        typedef local_raw_iterator local_raw_const_iterator;
+
+        ///////////////////////////////////////////////////////////////////////
+        local_raw_const_iterator local() const
+        {
+            if (partition_ && !data_)
+                data_ = partition_.get_ptr();
+            return local_raw_const_iterator(
+                static_cast<partition_server const&>(*data_).iterator_at(
+                    index_),
+                data_);
+        }
+
+    private:
+        friend class hpx::serialization::access;
+
+        template <typename Archive>
+        void load(Archive& ar, unsigned /* version */)
+        {
+            ar& partition_& index_;
+        }
+        template <typename Archive>
+        void save(Archive& ar, unsigned /* version */) const
+        {
+            ar& partition_& index_;
+        }
+
+        HPX_SERIALIZATION_SPLIT_MEMBER()
+
+    protected:
+        friend class hpx::util::iterator_core_access;
+
+        bool equal(const_local_unordered_map_iterator const& other) const
+        {
+            return partition_ == other.partition_ && index_ == other.index_;
+        }
+
+        typename base_type::reference dereference() const
+        {
+            HPX_ASSERT(get_data());
+            return *static_cast<partition_server const&>(*data_).iterator_at(
+                index_);
+        }
+
+        void increment()
+        {
+            if (get_data())
+                index_ = data_->normalize_index(index_ + 1);
+            else
+                index_ = partition_.normalize_index(launch::sync, index_ + 1);
+        }
+
+    public:
+        partition_unordered_map<Key, T, Hash, KeyEqual> get_partition() const
+        {
+            return partition_;
+        }
+
+        size_type get_index() const
+        {
+            return index_;
+        }
+
+        std::shared_ptr<partition_server> const& get_data() const
+        {
+            // only partitions located on this locality can be accessed
+            // directly
+            if (partition_ && !data_ &&
+                naming::get_locality_id_from_id(partition_.get_id()) ==
+                    hpx::get_locality_id())
+            {
+                data_ = partition_.get_ptr();
+            }
+            return data_;
+        }
+
+    protected:
+        // refer to a partition of the unordered_map
+        partition_unordered_map<Key, T, Hash, KeyEqual> partition_;
+
+        // index of the referenced element in the partition
+        size_type index_;
+
+        // caching address of component
+        mutable std::shared_ptr<partition_server> data_;
+    };
 
     ///////////////////////////////////////////////////////////////////////////
     // This class wraps plain a unordered_map<>::iterator or
@@ -61,6 +446,11 @@ namespace hpx { namespace segmented {
             base_type;
 
     public:
+        segment_unordered_map_iterator()
+          : data_(nullptr)
+        {
+        }
+
         explicit segment_unordered_map_iterator(BaseIter const& it,
             unordered_map<Key, T, Hash, KeyEqual>* data = nullptr)
           : base_type(it)
@@ -79,7 +469,7 @@ namespace hpx { namespace segmented {
 
         bool is_at_end() const
         {
-            return data_ == 0 ||
+            return data_ == nullptr ||
                 this->base_type::base_reference() == data_->partitions_.end();
         }
 
@@ -103,6 +493,11 @@ namespace hpx { namespace segmented {
             base_type;
 
     public:
+        const_segment_unordered_map_iterator()
+          : data_(nullptr)
+        {
+        }
+
         explicit const_segment_unordered_map_iterator(BaseIter const& it,
             unordered_map<Key, T, Hash, KeyEqual> const* data = nullptr)
           : base_type(it)
@@ -117,7 +512,7 @@ namespace hpx { namespace segmented {
 
         bool is_at_end() const
         {
-            return data_ == 0 ||
+            return data_ == nullptr ||
                 this->base_type::base_reference() == data_->partitions_.end();
         }
 
@@ -125,95 +520,192 @@ namespace hpx { namespace segmented {
         unordered_map<Key, T, Hash, KeyEqual> const* data_;
     };
 
-    //     ///////////////////////////////////////////////////////////////////////////
-    //     namespace detail
-    //     {
-    //         template <typename BaseIterator>
-    //         struct is_requested_locality
-    //         {
-    //             typedef typename std::iterator_traits<BaseIterator>::reference
-    //                 reference;
-    //
-    //             is_requested_locality(std::uint32_t locality_id =
-    //                     naming::invalid_locality_id)
-    //               : locality_id_(locality_id)
-    //             {}
-    //
-    //             bool operator()(reference val) const
-    //             {
-    //                 return locality_id_ == naming::invalid_locality_id ||
-    //                        locality_id_ == val.locality_id_;
-    //             }
-    //
-    //             std::uint32_t locality_id_;
-    //         };
-    //     }
-    //
-    //     /// This class implement the local segmented iterator for the
-    //     /// hpx::partitioned_vector.
-    //     template <typename T, typename BaseIter>
-    //     class local_segment_vector_iterator
-    //       : public hpx::util::iterator_adaptor<
-    //             segmented::local_segment_vector_iterator<T, BaseIter>, BaseIter,
-    //             std::vector<T>, std::forward_iterator_tag
-    //         >
-    //     {
-    //     private:
-    //         typedef hpx::util::iterator_adaptor<
-    //                 segmented::local_segment_vector_iterator<T, BaseIter>, BaseIter,
-    //                 std::vector<T>, std::forward_iterator_tag
-    //             > base_type;
-    //         typedef detail::is_requested_locality<BaseIter> predicate;
-    //
-    //     public:
-    //         local_segment_vector_iterator(BaseIter const& end)
-    //           : base_type(end), predicate_(), end_(end)
-    //         {}
-    //
-    //         local_segment_vector_iterator(
-    //                 BaseIter const& it, BaseIter const& end,
-    //                 std::uint32_t locality_id)
-    //           : base_type(it), predicate_(locality_id), end_(end)
-    //         {
-    //             satisfy_predicate();
-    //         }
-    //
-    //         bool is_at_end() const
-    //         {
-    //             return !data_ || this->base() == end_;
-    //         }
-    //
-    //     private:
-    //         friend class hpx::util::iterator_core_access;
-    //
-    //         typename base_type::reference dereference() const
-    //         {
-    //             HPX_ASSERT(!is_at_end());
-    //             return data_->get_data();
-    //         }
-    //
-    //         void increment()
-    //         {
-    //             ++(this->base_reference());
-    //             satisfy_predicate();
-    //         }
-    //
-    //         void satisfy_predicate()
-    //         {
-    //             while (this->base() != end_ && !predicate_(*this->base()))
-    //                 ++(this->base_reference());
-    //
-    //             if (this->base() != end_)
-    //                 data_ = this->base()->local_data_;
-    //             else
-    //                 data_.reset();
-    //         }
-    //
-    //     private:
-    //         std::shared_ptr<server::partitioned_vector<T> > data_;
-    //         predicate predicate_;
-    //         BaseIter end_;
-    //     };
+    ///////////////////////////////////////////////////////////////////////////
+    /// This class implements the (global) iterator functionality for
+    /// hpx::unordered_map.
+    ///
+    /// The iterator refers to an element by the number of its partition and
+    /// its index in this partition. Dereferencing it returns a copy of the
+    /// element (key and value).
+    template <typename Key, typename T, typename Hash, typename KeyEqual>
+    class unordered_map_iterator
+      : public hpx::util::iterator_facade<
+            unordered_map_iterator<Key, T, Hash, KeyEqual>, std::pair<Key, T>,
+            std::forward_iterator_tag, std::pair<Key, T>>
+    {
+    private:
+        typedef hpx::util::iterator_facade<
+            unordered_map_iterator<Key, T, Hash, KeyEqual>, std::pair<Key, T>,
+            std::forward_iterator_tag, std::pair<Key, T>>
+            base_type;
+
+    public:
+        typedef std::size_t size_type;
+        typedef typename unordered_map<Key, T, Hash, KeyEqual>::segment_iterator
+            segment_iterator;
+        typedef typename unordered_map<Key, T, Hash, KeyEqual>::local_iterator
+            local_iterator;
+
+        // constructors
+        unordered_map_iterator()
+          : data_(nullptr)
+          , partition_(size_type(-1))
+          , index_(size_type(-1))
+        {
+        }
+
+        unordered_map_iterator(unordered_map<Key, T, Hash, KeyEqual>* data,
+            size_type partition, size_type index)
+          : data_(data)
+          , partition_(partition)
+          , index_(index)
+        {
+            data_->normalize_position(partition_, index_);
+        }
+
+        unordered_map<Key, T, Hash, KeyEqual>* get_data()
+        {
+            return data_;
+        }
+        unordered_map<Key, T, Hash, KeyEqual> const* get_data() const
+        {
+            return data_;
+        }
+
+        size_type get_partition() const
+        {
+            return partition_;
+        }
+
+        size_type get_index() const
+        {
+            return index_;
+        }
+
+    protected:
+        friend class hpx::util::iterator_core_access;
+
+        bool equal(unordered_map_iterator const& other) const
+        {
+            return data_ == other.data_ && partition_ == other.partition_ &&
+                index_ == other.index_;
+        }
+
+        typename base_type::reference dereference() const
+        {
+            HPX_ASSERT(data_);
+            return data_->get_element(partition_, index_);
+        }
+
+        void increment()
+        {
+            HPX_ASSERT(data_);
+            ++index_;
+            data_->normalize_position(partition_, index_);
+        }
+
+    protected:
+        // refer to the unordered_map
+        unordered_map<Key, T, Hash, KeyEqual>* data_;
+
+        // the partition and the index of the element in this partition
+        size_type partition_;
+        size_type index_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Key, typename T, typename Hash, typename KeyEqual>
+    class const_unordered_map_iterator
+      : public hpx::util::iterator_facade<
+            const_unordered_map_iterator<Key, T, Hash, KeyEqual>,
+            std::pair<Key, T> const, std::forward_iterator_tag,
+            std::pair<Key, T> const>
+    {
+    private:
+        typedef hpx::util::iterator_facade<
+            const_unordered_map_iterator<Key, T, Hash, KeyEqual>,
+            std::pair<Key, T> const, std::forward_iterator_tag,
+            std::pair<Key, T> const>
+            base_type;
+
+    public:
+        typedef std::size_t size_type;
+        typedef typename unordered_map<Key, T, Hash,
+            KeyEqual>::const_segment_iterator segment_iterator;
+        typedef typename unordered_map<Key, T, Hash,
+            KeyEqual>::const_local_iterator local_iterator;
+
+        // constructors
+        const_unordered_map_iterator()
+          : data_(nullptr)
+          , partition_(size_type(-1))
+          , index_(size_type(-1))
+        {
+        }
+
+        const_unordered_map_iterator(
+            unordered_map<Key, T, Hash, KeyEqual> const* data,
+            size_type partition, size_type index)
+          : data_(data)
+          , partition_(partition)
+          , index_(index)
+        {
+            data_->normalize_position(partition_, index_);
+        }
+
+        const_unordered_map_iterator(
+            unordered_map_iterator<Key, T, Hash, KeyEqual> const& it)
+          : data_(it.get_data())
+          , partition_(it.get_partition())
+          , index_(it.get_index())
+        {
+        }
+
+        unordered_map<Key, T, Hash, KeyEqual> const* get_data() const
+        {
+            return data_;
+        }
+
+        size_type get_partition() const
+        {
+            return partition_;
+        }
+
+        size_type get_index() const
+        {
+            return index_;
+        }
+
+    protected:
+        friend class hpx::util::iterator_core_access;
+
+        bool equal(const_unordered_map_iterator const& other) const
+        {
+            return data_ == other.data_ && partition_ == other.partition_ &&
+                index_ == other.index_;
+        }
+
+        typename base_type::reference dereference() const
+        {
+            HPX_ASSERT(data_);
+            return data_->get_element(partition_, index_);
+        }
+
+        void increment()
+        {
+            HPX_ASSERT(data_);
+            ++index_;
+            data_->normalize_position(partition_, index_);
+        }
+
+    protected:
+        // refer to the unordered_map
+        unordered_map<Key, T, Hash, KeyEqual> const* data_;
+
+        // the partition and the index of the element in this partition
+        size_type partition_;
+        size_type index_;
+    };
 }}    // namespace hpx::segmented
 
 namespace hpx {
@@ -234,3 +726,210 @@ namespace hpx {
         segmented::const_segment_unordered_map_iterator<Key, T, Hash, KeyEqual,
             BaseIter>;
 }    // namespace hpx
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx { namespace traits {
+    template <typename Key, typename T, typename Hash, typename KeyEqual>
+    struct segmented_iterator_traits<
+        segmented::unordered_map_iterator<Key, T, Hash, KeyEqual>>
+    {
+        typedef std::true_type is_segmented_iterator;
+
+        typedef segmented::unordered_map_iterator<Key, T, Hash, KeyEqual>
+            iterator;
+        typedef typename iterator::segment_iterator segment_iterator;
+        typedef typename iterator::local_iterator local_iterator;
+
+        typedef typename local_iterator::local_raw_iterator local_raw_iterator;
+
+        //  Conceptually this function is supposed to denote which segment
+        //  the iterator is currently pointing to (i.e. just global iterator).
+        static segment_iterator segment(iterator iter)
+        {
+            return iter.get_data()->get_segment_iterator(iter.get_partition());
+        }
+
+        //  This function should specify which is the current segment and
+        //  the exact position to which local iterator is pointing.
+        static local_iterator local(iterator iter)
+        {
+            HPX_ASSERT(iter.get_data());    // avoid dereferencing end iterator
+            return iter.get_data()->get_local_iterator(
+                iter.get_partition(), iter.get_index());
+        }
+
+        //  Build a full iterator from the segment and local iterators
+        static iterator compose(
+            segment_iterator seg_iter, local_iterator local_iter)
+        {
+            unordered_map<Key, T, Hash, KeyEqual>* data = seg_iter.get_data();
+            return iterator(data, data->get_segment_index(seg_iter),
+                local_iter.get_index());
+        }
+
+        //  This function should specify the local iterator which is at the
+        //  beginning of the partition.
+        static local_iterator begin(segment_iterator seg_iter)
+        {
+            std::size_t index = 0;
+            if (seg_iter.is_at_end())
+            {
+                // return iterator to the end of last segment
+                --seg_iter;
+                index = std::size_t(-1);
+            }
+
+            return local_iterator(seg_iter.base()->partition_, index,
+                seg_iter.base()->local_data_);
+        }
+
+        //  This function should specify the local iterator which is at the
+        //  end of the partition.
+        static local_iterator end(segment_iterator seg_iter)
+        {
+            if (seg_iter.is_at_end())
+                --seg_iter;    // return iterator to the end of last segment
+
+            auto& base = seg_iter.base();
+            return local_iterator(
+                base->partition_, std::size_t(-1), base->local_data_);
+        }
+
+        // Extract the base id for the segment referenced by the given segment
+        // iterator.
+        static id_type get_id(segment_iterator const& iter)
+        {
+            return iter->get_id();
+        }
+    };
+
+    template <typename Key, typename T, typename Hash, typename KeyEqual>
+    struct segmented_iterator_traits<
+        segmented::const_unordered_map_iterator<Key, T, Hash, KeyEqual>>
+    {
+        typedef std::true_type is_segmented_iterator;
+
+        typedef segmented::const_unordered_map_iterator<Key, T, Hash, KeyEqual>
+            iterator;
+        typedef typename iterator::segment_iterator segment_iterator;
+        typedef typename iterator::local_iterator local_iterator;
+
+        typedef typename local_iterator::local_raw_iterator local_raw_iterator;
+
+        //  Conceptually this function is supposed to denote which segment
+        //  the iterator is currently pointing to (i.e. just global iterator).
+        static segment_iterator segment(iterator iter)
+        {
+            return iter.get_data()->get_const_segment_iterator(
+                iter.get_partition());
+        }
+
+        //  This function should specify which is the current segment and
+        //  the exact position to which local iterator is pointing.
+        static local_iterator local(iterator const& iter)
+        {
+            HPX_ASSERT(iter.get_data());    // avoid dereferencing end iterator
+            return iter.get_data()->get_const_local_iterator(
+                iter.get_partition(), iter.get_index());
+        }
+
+        //  Build a full iterator from the segment and local iterators
+        static iterator compose(
+            segment_iterator const& seg_iter, local_iterator const& local_iter)
+        {
+            unordered_map<Key, T, Hash, KeyEqual> const* data =
+                seg_iter.get_data();
+            return iterator(data, data->get_segment_index(seg_iter),
+                local_iter.get_index());
+        }
+
+        //  This function should specify the local iterator which is at the
+        //  beginning of the partition.
+        static local_iterator begin(segment_iterator seg_iter)
+        {
+            std::size_t index = 0;
+            if (seg_iter.is_at_end())
+            {
+                // return iterator to the end of last segment
+                --seg_iter;
+                index = std::size_t(-1);
+            }
+
+            return local_iterator(seg_iter.base()->partition_, index,
+                seg_iter.base()->local_data_);
+        }
+
+        //  This function should specify the local iterator which is at the
+        //  end of the partition.
+        static local_iterator end(segment_iterator seg_iter)
+        {
+            if (seg_iter.is_at_end())
+                --seg_iter;    // return iterator to the end of last segment
+
+            auto& base = seg_iter.base();
+            return local_iterator(
+                base->partition_, std::size_t(-1), base->local_data_);
+        }
+
+        // Extract the base id for the segment referenced by the given segment
+        // iterator.
+        static id_type get_id(segment_iterator const& iter)
+        {
+            return iter->get_id();
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Some 'remote' iterators need to be mapped before being applied to the
+    // local algorithms.
+    template <typename Key, typename T, typename Hash, typename KeyEqual>
+    struct segmented_local_iterator_traits<
+        segmented::local_unordered_map_iterator<Key, T, Hash, KeyEqual>>
+    {
+        typedef std::true_type is_segmented_local_iterator;
+
+        typedef segmented::unordered_map_iterator<Key, T, Hash, KeyEqual>
+            iterator;
+        typedef segmented::local_unordered_map_iterator<Key, T, Hash, KeyEqual>
+            local_iterator;
+        typedef typename local_iterator::local_raw_iterator local_raw_iterator;
+
+        // Extract base iterator from local_iterator
+        static local_raw_iterator local(local_iterator it)
+        {
+            return it.local();
+        }
+
+        // Construct remote local_iterator from local_raw_iterator
+        static local_iterator remote(local_raw_iterator it)
+        {
+            return it.remote();
+        }
+    };
+
+    template <typename Key, typename T, typename Hash, typename KeyEqual>
+    struct segmented_local_iterator_traits<
+        segmented::const_local_unordered_map_iterator<Key, T, Hash, KeyEqual>>
+    {
+        typedef std::true_type is_segmented_local_iterator;
+
+        typedef segmented::const_unordered_map_iterator<Key, T, Hash, KeyEqual>
+            iterator;
+        typedef segmented::const_local_unordered_map_iterator<Key, T, Hash,
+            KeyEqual>
+            local_iterator;
+        typedef typename local_iterator::local_raw_iterator local_raw_iterator;
+
+        // Extract base iterator from local_iterator
+        static local_raw_iterator local(local_iterator it)
+        {
+            return it.local();
+        }
+
+        // Construct remote local_iterator from local_raw_iterator
+        static local_iterator remote(local_raw_iterator it)
+        {
+            return it.remote();
+        }
+    };
+}}    // namespace hpx::traits
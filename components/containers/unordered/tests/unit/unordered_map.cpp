@@ -7,6 +7,7 @@
 #include <hpx/config.hpp>
 #if !defined(HPX_COMPUTE_DEVICE_CODE)
 #include <hpx/hpx_main.hpp>
+#include <hpx/include/lcos.hpp>
 #include <hpx/include/runtime.hpp>
 #include <hpx/include/traits.hpp>
 #include <hpx/include/unordered_map.hpp>
@@ -153,6 +154,107 @@ void trivial_tests()
     }
 }
 
+///////////////////////////////////////////////////////////////////////////////
+template <typename Key, typename Value, typename DistPolicy>
+void bulk_tests(DistPolicy const& policy)
+{
+    hpx::unordered_map<Key, Value> m(17, policy);
+
+    std::vector<Key> keys;
+    std::vector<Value> vals;
+    for (std::size_t i = 0; i != 1007; ++i)
+    {
+        keys.push_back(std::to_string(i));
+        vals.push_back(Value(i));
+    }
+
+    m.set_values(hpx::launch::sync, keys, vals);
+    HPX_TEST_EQ(m.size(), keys.size());
+    HPX_TEST(m.get_values(hpx::launch::sync, keys) == vals);
+
+    // the values are returned in the order of the given keys
+    std::vector<Key> reversed_keys(keys.rbegin(), keys.rend());
+    std::vector<Value> reversed_vals(vals.rbegin(), vals.rend());
+    HPX_TEST(m.get_values(reversed_keys).get() == reversed_vals);
+
+    // overwrite some of the values asynchronously
+    std::vector<Key> some_keys(keys.begin(), keys.begin() + 100);
+    std::vector<Value> some_vals(some_keys.size(), Value(42));
+    m.set_values(some_keys, some_vals).get();
+    HPX_TEST_EQ(m.size(), keys.size());
+    HPX_TEST(m.get_values(hpx::launch::sync, some_keys) == some_vals);
+    HPX_TEST_EQ(m[keys[100]], vals[100]);
+
+    HPX_TEST(m.get_values(std::vector<Key>()).get().empty());
+
+    // erase half of the elements
+    for (std::size_t i = 0; i < keys.size(); i += 2)
+    {
+        HPX_TEST_EQ(m.erase(hpx::launch::sync, keys[i]), std::size_t(1));
+    }
+    HPX_TEST_EQ(m.erase(hpx::launch::sync, keys[0]), std::size_t(0));
+    HPX_TEST_EQ(m.size(), keys.size() / 2);
+
+    for (std::size_t i = 1; i < keys.size(); i += 2)
+    {
+        HPX_TEST_EQ(m.get_value(hpx::launch::sync, keys[i]),
+            i < 100 ? Value(42) : vals[i]);
+    }
+
+    // requesting a missing key reports an error
+    bool caught_exception = false;
+    try
+    {
+        m.get_values(hpx::launch::sync, keys);
+    }
+    catch (hpx::exception const&)
+    {
+        caught_exception = true;
+    }
+    HPX_TEST(caught_exception);
+}
+
+template <typename Key, typename Value, typename DistPolicy>
+void concurrent_tests(DistPolicy const& policy)
+{
+    hpx::unordered_map<Key, Value> m(policy);
+
+    constexpr std::size_t num_tasks = 16;
+    constexpr std::size_t num_values = 200;
+
+    // insert, read, and erase disjoint sets of keys from many threads
+    std::vector<hpx::future<void>> tasks;
+    for (std::size_t t = 0; t != num_tasks; ++t)
+    {
+        tasks.push_back(hpx::async([&m, t]() {
+            for (std::size_t i = 0; i != num_values; ++i)
+            {
+                std::string key = std::to_string(t * num_values + i);
+                m.set_value(hpx::launch::sync, key, Value(i));
+                HPX_TEST_EQ(m.get_value(hpx::launch::sync, key), Value(i));
+            }
+            for (std::size_t i = 0; i < num_values; i += 2)
+            {
+                std::string key = std::to_string(t * num_values + i);
+                HPX_TEST_EQ(
+                    m.get_value(hpx::launch::sync, key, true), Value(i));
+            }
+        }));
+    }
+    hpx::wait_all(tasks);
+
+    HPX_TEST_EQ(m.size(), num_tasks * num_values / 2);
+    for (std::size_t t = 0; t != num_tasks; ++t)
+    {
+        for (std::size_t i = 1; i < num_values; i += 2)
+        {
+            std::string key = std::to_string(t * num_values + i);
+            HPX_TEST_EQ(m.get_value(hpx::launch::sync, key), Value(i));
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
 int main()
 {
     trivial_tests<std::string, double>();
@@ -164,6 +266,13 @@ int main()
     trivial_tests<std::string, double>(hpx::container_layout(3, localities));
     trivial_tests<std::string, double>(hpx::container_layout(localities));
 
-    return 0;
+    bulk_tests<std::string, double>(hpx::container_layout);
+    bulk_tests<std::string, double>(hpx::container_layout(3, localities));
+
+    concurrent_tests<std::string, double>(hpx::container_layout);
+    concurrent_tests<std::string, double>(
+        hpx::container_layout(3, localities));
+
+    return hpx::util::report_errors();
 }
 #endif
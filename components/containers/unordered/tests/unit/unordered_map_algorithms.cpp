@@ -0,0 +1,241 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx_main.hpp>
+#include <hpx/include/parallel_all_any_none_of.hpp>
+#include <hpx/include/parallel_count.hpp>
+#include <hpx/include/parallel_find.hpp>
+#include <hpx/include/parallel_for_each.hpp>
+#include <hpx/include/parallel_transform_reduce.hpp>
+#include <hpx/include/runtime.hpp>
+#include <hpx/include/unordered_map.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// Define the unordered_map types to be used.
+HPX_REGISTER_UNORDERED_MAP(std::string, double)
+
+typedef hpx::unordered_map<std::string, double> map_type;
+typedef std::pair<std::string, double> element_type;
+
+///////////////////////////////////////////////////////////////////////////////
+struct increment
+{
+    void operator()(element_type& element) const
+    {
+        element.second += 1.0;
+    }
+};
+
+struct get_value
+{
+    double operator()(element_type const& element) const
+    {
+        return element.second;
+    }
+};
+
+struct value_less
+{
+    value_less(double value = 0.0)
+      : value_(value)
+    {
+    }
+
+    bool operator()(element_type const& element) const
+    {
+        return element.second < value_;
+    }
+
+    double value_;
+
+    template <typename Archive>
+    void serialize(Archive& ar, unsigned)
+    {
+        // clang-format off
+        ar & value_;
+        // clang-format on
+    }
+};
+
+struct value_equal
+{
+    value_equal(double value = 0.0)
+      : value_(value)
+    {
+    }
+
+    bool operator()(element_type const& element) const
+    {
+        return element.second == value_;
+    }
+
+    double value_;
+
+    template <typename Archive>
+    void serialize(Archive& ar, unsigned)
+    {
+        // clang-format off
+        ar & value_;
+        // clang-format on
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// fills the map with the values 0, 1, ..., count - 1, returns their sum
+double fill_map(map_type& m, std::size_t count)
+{
+    std::vector<std::string> keys;
+    std::vector<double> vals;
+    double sum = 0.0;
+    for (std::size_t i = 0; i != count; ++i)
+    {
+        keys.push_back(std::to_string(i));
+        vals.push_back(double(i));
+        sum += double(i);
+    }
+    m.set_values(hpx::launch::sync, keys, vals);
+    return sum;
+}
+
+void iteration_tests(map_type const& m, std::size_t count)
+{
+    std::vector<bool> seen(count, false);
+
+    std::size_t size = 0;
+    for (map_type::const_iterator it = m.begin(); it != m.end(); ++it, ++size)
+    {
+        element_type element = *it;
+        std::size_t const i = std::stoul(element.first);
+        HPX_TEST(i < count);
+        HPX_TEST(!seen[i]);
+        HPX_TEST_EQ(element.second, double(i));
+        seen[i] = true;
+    }
+    HPX_TEST_EQ(size, count);
+}
+
+template <typename ExPolicy>
+void algorithm_tests(ExPolicy const& policy, map_type& m, std::size_t count,
+    double sum, double offset)
+{
+    double const n = double(count);
+
+    // all values are incremented on the partitions holding them
+    hpx::for_each(policy, m.begin(), m.end(), increment());
+    offset += 1.0;
+
+    HPX_TEST_EQ(hpx::transform_reduce(policy, m.cbegin(), m.cend(), 0.0,
+                    std::plus<double>(), get_value()),
+        sum + n * offset);
+
+    HPX_TEST_EQ(hpx::count_if(policy, m.cbegin(), m.cend(),
+                    value_less(offset + n / 2)),
+        std::ptrdiff_t(count / 2 + count % 2));
+
+    map_type::const_iterator it =
+        hpx::find_if(policy, m.cbegin(), m.cend(), value_equal(offset + 3));
+    HPX_TEST(it != m.cend());
+    HPX_TEST_EQ((*it).first, std::string("3"));
+
+    it = hpx::find_if(policy, m.cbegin(), m.cend(), value_equal(-1.0));
+    HPX_TEST(it == m.cend());
+
+    HPX_TEST(hpx::all_of(policy, m.cbegin(), m.cend(), value_less(n + offset)));
+    HPX_TEST(!hpx::all_of(policy, m.cbegin(), m.cend(), value_less(offset)));
+    HPX_TEST(hpx::any_of(policy, m.cbegin(), m.cend(), value_less(offset + 1)));
+    HPX_TEST(!hpx::any_of(policy, m.cbegin(), m.cend(), value_less(offset)));
+    HPX_TEST(hpx::none_of(policy, m.cbegin(), m.cend(), value_less(offset)));
+}
+
+template <typename ExPolicy>
+void algorithm_tests_async(ExPolicy const& policy, map_type& m,
+    std::size_t count, double sum, double offset)
+{
+    double const n = double(count);
+
+    hpx::for_each(policy, m.begin(), m.end(), increment()).get();
+    offset += 1.0;
+
+    HPX_TEST_EQ(hpx::transform_reduce(policy, m.cbegin(), m.cend(), 0.0,
+                    std::plus<double>(), get_value())
+                    .get(),
+        sum + n * offset);
+
+    HPX_TEST_EQ(hpx::count_if(policy, m.cbegin(), m.cend(),
+                    value_less(offset + n / 2))
+                    .get(),
+        std::ptrdiff_t(count / 2 + count % 2));
+
+    map_type::const_iterator it =
+        hpx::find_if(policy, m.cbegin(), m.cend(), value_equal(offset + 3))
+            .get();
+    HPX_TEST(it != m.cend());
+    HPX_TEST_EQ((*it).first, std::string("3"));
+
+    HPX_TEST(
+        hpx::all_of(policy, m.cbegin(), m.cend(), value_less(n + offset))
+            .get());
+    HPX_TEST(
+        hpx::any_of(policy, m.cbegin(), m.cend(), value_less(offset + 1))
+            .get());
+}
+
+template <typename DistPolicy>
+void unordered_map_algorithm_tests(DistPolicy const& dist_policy)
+{
+    using namespace hpx::execution;
+
+    std::size_t const count = 1007;
+
+    map_type m(dist_policy);
+    double const sum = fill_map(m, count);
+    iteration_tests(m, count);
+
+    algorithm_tests(seq, m, count, sum, 0.0);
+    algorithm_tests(par, m, count, sum, 1.0);
+    algorithm_tests_async(seq(task), m, count, sum, 2.0);
+    algorithm_tests_async(par(task), m, count, sum, 3.0);
+
+    // sequential overloads
+    hpx::for_each(m.begin(), m.end(), increment());
+    HPX_TEST_EQ(hpx::transform_reduce(m.cbegin(), m.cend(), 0.0,
+                    std::plus<double>(), get_value()),
+        sum + double(count) * 5.0);
+    HPX_TEST_EQ(hpx::count_if(m.cbegin(), m.cend(), value_less(5.0)),
+        std::ptrdiff_t(0));
+
+    // algorithms on an empty map
+    map_type empty(dist_policy);
+    HPX_TEST(empty.begin() == empty.end());
+    HPX_TEST_EQ(hpx::count_if(par, empty.cbegin(), empty.cend(),
+                    value_less(1.0)),
+        std::ptrdiff_t(0));
+    HPX_TEST(hpx::find_if(par, empty.cbegin(), empty.cend(),
+                 value_equal(1.0)) == empty.cend());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    std::vector<hpx::id_type> localities = hpx::find_all_localities();
+
+    unordered_map_algorithm_tests(hpx::container_layout);
+    unordered_map_algorithm_tests(hpx::container_layout(3));
+    unordered_map_algorithm_tests(hpx::container_layout(3, localities));
+    unordered_map_algorithm_tests(hpx::container_layout(localities));
+
+    return hpx::util::report_errors();
+}
+#endif
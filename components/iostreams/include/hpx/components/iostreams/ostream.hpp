@@ -16,11 +16,14 @@
 #include <hpx/components/iostreams/server/output_stream.hpp>
 #include <hpx/lock_registration/detail/register_locks.hpp>
 #include <hpx/modules/async_distributed.hpp>
+#include <hpx/threading/thread.hpp>
 #include <hpx/type_support/unused.hpp>
 
 #include <boost/iostreams/stream.hpp>
 
 #include <atomic>
+#include <chrono>
+#include <cstddef>
 #include <cstdint>
 #include <ios>
 #include <iterator>
@@ -153,8 +156,16 @@ namespace hpx { namespace iostreams {
             release_ostream(get_outstream_name(tag), id);
         }
 
+        ///////////////////////////////////////////////////////////////////////
+        // The output of consecutive flushes is collected until it reaches
+        // hpx.iostreams.flush_size bytes or until hpx.iostreams.flush_interval
+        // microseconds have passed, and is then sent in a single write.
+        HPX_IOSTREAMS_EXPORT std::size_t get_flush_size();
+        HPX_IOSTREAMS_EXPORT std::int64_t get_flush_interval();
+
         ///////////////////////////////////////////////////////////////////////
         void register_ostreams();
+        void finalize_ostreams();
         void unregister_ostreams();
     }    // namespace detail
 
@@ -184,6 +195,82 @@ namespace hpx { namespace iostreams {
         using detail::buffer::mtx_;
         std::atomic<std::uint64_t> generational_count_;
 
+        // zero sends the output whenever the stream is flushed
+        std::size_t flush_size_;
+        std::int64_t flush_interval_;
+        bool flush_scheduled_;
+
+        // Sends the buffer asynchronously to the destination, unlocks the
+        // given lock.
+        template <typename Lock>
+        void write_async(Lock& l)
+        {
+            // Create the next buffer, returns the previous buffer
+            buffer next = this->detail::buffer::init_locked();
+
+            // Unlock the mutex before we cleanup.
+            l.unlock();
+
+            // since mtx_ is recursive and apply will do an AGAS lookup,
+            // we need to ignore the lock here in case we are called
+            // recursively
+            hpx::util::ignore_while_checking il(&l);
+            HPX_UNUSED(il);
+
+            // Perform the write operation, then destroy the old buffer and
+            // stream.
+            typedef server::output_stream::write_async_action action_type;
+            hpx::apply<action_type>(this->get_id(), hpx::get_locality_id(),
+                generational_count_++, next);
+        }
+
+        // Sends the buffer once enough output has been collected, otherwise
+        // makes sure it is sent after the flush interval. Unlocks the given
+        // lock if anything was sent or scheduled.
+        template <typename Lock>
+        void flush_async(Lock& l)
+        {
+            if (this->detail::buffer::empty_locked())
+            {
+                return;
+            }
+
+            if (this->detail::buffer::size_locked() >= flush_size_)
+            {
+                write_async(l);
+                return;
+            }
+
+            if (!flush_scheduled_)
+            {
+                flush_scheduled_ = true;
+                l.unlock();
+
+                hpx::util::ignore_while_checking il(&l);
+                HPX_UNUSED(il);
+
+                hpx::apply(&ostream::flush_scheduled, this);
+            }
+        }
+
+        // Executed as a separate HPX thread, sends whatever was collected
+        // since the flush was scheduled.
+        void flush_scheduled()
+        {
+            if (flush_interval_ != 0)
+            {
+                hpx::this_thread::sleep_for(
+                    std::chrono::microseconds(flush_interval_));
+            }
+
+            std::unique_lock<mutex_type> l(*mtx_);
+            flush_scheduled_ = false;
+            if (!this->detail::buffer::empty_locked())
+            {
+                write_async(l);
+            }
+        }
+
         // Performs a lazy streaming operation.
         template <typename T>
         ostream& streaming_operator_lazy(T const& subject)
@@ -202,21 +289,8 @@ namespace hpx { namespace iostreams {
             *static_cast<stream_base_type*>(this) << subject;
 
             // If the buffer isn't empty, send it asynchronously to the
-            // destination.
-            if (!this->detail::buffer::empty_locked())
-            {
-                // Create the next buffer, returns the previous buffer
-                buffer next = this->detail::buffer::init_locked();
-
-                // Unlock the mutex before we cleanup.
-                l.unlock();
-
-                // Perform the write operation, then destroy the old buffer and
-                // stream.
-                typedef server::output_stream::write_async_action action_type;
-                hpx::apply<action_type>(this->get_id(), hpx::get_locality_id(),
-                    generational_count_++, next);
-            }
+            // destination, possibly batched with later output.
+            flush_async(l);
 #else
             HPX_ASSERT(false);
             HPX_UNUSED(subject);
@@ -264,26 +338,7 @@ namespace hpx { namespace iostreams {
         {
 #if !defined(HPX_COMPUTE_DEVICE_CODE)
             std::unique_lock<mutex_type> l(*mtx_);
-            if (!this->detail::buffer::empty_locked())
-            {
-                // Create the next buffer, returns the previous buffer
-                buffer next = this->detail::buffer::init_locked();
-
-                // Unlock the mutex before we cleanup.
-                l.unlock();
-
-                // since mtx_ is recursive and apply will do an AGAS lookup,
-                // we need to ignore the lock here in case we are called
-                // recursively
-                hpx::util::ignore_while_checking il(&l);
-                HPX_UNUSED(il);
-
-                // Perform the write operation, then destroy the old buffer and
-                // stream.
-                typedef server::output_stream::write_async_action action_type;
-                hpx::apply<action_type>(this->get_id(), hpx::get_locality_id(),
-                    generational_count_++, next);
-            }
+            flush_async(l);
             return true;
 #else
             HPX_ASSERT(false);
@@ -293,6 +348,7 @@ namespace hpx { namespace iostreams {
 
         ///////////////////////////////////////////////////////////////////////
         friend void detail::register_ostreams();
+        friend void detail::finalize_ostreams();
         friend void detail::unregister_ostreams();
 
         // late initialization during runtime system startup
@@ -300,6 +356,22 @@ namespace hpx { namespace iostreams {
         void initialize(Tag tag)
         {
             *static_cast<base_type*>(this) = detail::create_ostream(tag);
+
+            flush_size_ = detail::get_flush_size();
+            flush_interval_ = detail::get_flush_interval();
+        }
+
+        // send all collected output during pre-shutdown, the output
+        // written afterwards is not batched anymore
+        void finalize_batching()
+        {
+            std::unique_lock<mutex_type> l(*mtx_, std::try_to_lock);
+            if (l)
+            {
+                flush_size_ = 0;
+                streaming_operator_sync(
+                    hpx::iostreams::flush_type(), l);    // unlocks
+            }
         }
 
         // reset this object during runtime system shutdown
@@ -324,6 +396,9 @@ namespace hpx { namespace iostreams {
           , buffer()
           , stream_base_type(*this)
           , generational_count_(0)
+          , flush_size_(0)
+          , flush_interval_(0)
+          , flush_scheduled_(false)
         {
         }
 
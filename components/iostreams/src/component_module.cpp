@@ -52,6 +52,17 @@ namespace hpx { namespace iostreams { namespace detail
         hpx::cout.initialize(iostreams::detail::cout_tag());
         hpx::cerr.initialize(iostreams::detail::cerr_tag());
         hpx::consolestream.initialize(iostreams::detail::consolestream_tag());
+
+        // all batched output has to reach the console before any of the
+        // shutdown functions is executed
+        hpx::register_pre_shutdown_function(finalize_ostreams);
+    }
+
+    void finalize_ostreams()
+    {
+        hpx::cout.finalize_batching();
+        hpx::cerr.finalize_batching();
+        hpx::consolestream.finalize_batching();
     }
 
     void unregister_ostreams()
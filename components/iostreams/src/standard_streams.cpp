@@ -15,10 +15,14 @@
 #include <hpx/functional/bind_back.hpp>
 #include <hpx/modules/execution.hpp>
 #include <hpx/runtime_distributed/runtime_fwd.hpp>
+#include <hpx/runtime_local/config_entry.hpp>
+#include <hpx/util/from_string.hpp>
 
 #include <hpx/components/iostreams/ostream.hpp>
 #include <hpx/components/iostreams/standard_streams.hpp>
 
+#include <cstddef>
+#include <cstdint>
 #include <functional>
 #include <iostream>
 #include <sstream>
@@ -43,6 +47,19 @@ namespace hpx { namespace iostreams { namespace detail {
         return console_stream;
     }
 
+    ///////////////////////////////////////////////////////////////////////////
+    std::size_t get_flush_size()
+    {
+        return hpx::util::from_string<std::size_t>(
+            hpx::get_config_entry("hpx.iostreams.flush_size", 4096), 4096);
+    }
+
+    std::int64_t get_flush_interval()
+    {
+        return hpx::util::from_string<std::int64_t>(
+            hpx::get_config_entry("hpx.iostreams.flush_interval", 1000), 1000);
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     hpx::id_type return_id_type(future<bool> f, hpx::id_type id)
     {
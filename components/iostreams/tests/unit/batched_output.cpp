@@ -0,0 +1,123 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify that the output written by many threads on all localities reaches
+// the console completely and in order for each writer, even though it is
+// sent in batches.
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/iostream.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+constexpr std::size_t num_writers = 16;
+constexpr std::size_t num_lines = 100;
+
+bool on_shutdown_executed = false;
+std::uint32_t here = std::uint32_t(-1);
+
+void write_lines(std::uint32_t locality_id, std::size_t writer)
+{
+    for (std::size_t i = 0; i != num_lines; ++i)
+    {
+        hpx::consolestream << locality_id << " " << writer << " " << i
+                           << std::endl;
+
+        // give other writers a chance to interleave their output
+        if (i % 10 == 0)
+        {
+            hpx::this_thread::yield();
+        }
+    }
+}
+
+void worker()
+{
+    std::uint32_t const locality_id = hpx::get_locality_id();
+    here = locality_id;
+
+    std::vector<hpx::future<void>> writers;
+    writers.reserve(num_writers);
+    for (std::size_t i = 0; i != num_writers; ++i)
+    {
+        writers.push_back(hpx::async(&write_lines, locality_id, i));
+    }
+    hpx::wait_all(writers);
+}
+HPX_PLAIN_ACTION(worker, worker_action)
+
+void on_shutdown(std::size_t num_localities)
+{
+    std::istringstream strm(hpx::get_consolestream().str());
+
+    // the next expected line of each writer
+    std::map<std::pair<std::uint32_t, std::size_t>, std::size_t> expected;
+
+    std::size_t count = 0;
+    std::uint32_t locality_id = 0;
+    std::size_t writer = 0;
+    std::size_t line = 0;
+    while (strm >> locality_id >> writer >> line)
+    {
+        std::size_t& next = expected[std::make_pair(locality_id, writer)];
+        HPX_TEST_EQ(line, next);
+        next = line + 1;
+        ++count;
+    }
+
+    HPX_TEST_EQ(expected.size(), num_localities * num_writers);
+    HPX_TEST_EQ(count, num_localities * num_writers * num_lines);
+
+    on_shutdown_executed = true;
+}
+
+int hpx_main()
+{
+    std::vector<hpx::id_type> localities = hpx::find_all_localities();
+
+    std::vector<hpx::future<void>> futures;
+    futures.reserve(localities.size());
+    for (hpx::id_type const& l : localities)
+    {
+        futures.push_back(hpx::async(worker_action(), l));
+    }
+
+    hpx::register_shutdown_function(
+        hpx::bind(&on_shutdown, localities.size()));
+    hpx::wait_all(futures);
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // make sure that the output is sent both because the batch is full and
+    // because the flush interval has passed
+    std::vector<std::string> const cfg = {
+        "hpx.iostreams.flush_size=256", "hpx.iostreams.flush_interval=500"};
+
+    hpx::init_params init_args;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::init(argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    HPX_TEST_NEQ(std::uint32_t(-1), here);
+    HPX_TEST(on_shutdown_executed || 0 != here);
+
+    return hpx::util::report_errors();
+}
+#endif
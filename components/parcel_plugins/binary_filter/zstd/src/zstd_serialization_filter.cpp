@@ -0,0 +1,230 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_COMPRESSION_ZSTD)
+#include <hpx/modules/errors.hpp>
+#include <hpx/util/from_string.hpp>
+#include <hpx/runtime_local/config_entry.hpp>
+
+#include <hpx/binary_filter/zstd_serialization_filter.hpp>
+#include <hpx/plugin_factories/binary_filter_factory.hpp>
+#include <hpx/plugin_factories/plugin_registry.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <fstream>
+#include <ios>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include <zstd.h>
+
+///////////////////////////////////////////////////////////////////////////////
+HPX_REGISTER_PLUGIN_MODULE();
+HPX_REGISTER_BINARY_FILTER_FACTORY(
+    hpx::plugins::compression::zstd_serialization_filter,
+    zstd_serialization_filter);
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx::plugins::compression {
+
+    namespace {
+
+        // The compression level and the (optional) dictionary are read
+        // from the configuration once, the dictionary has to be the same on
+        // all localities.
+        struct zstd_configuration
+        {
+            zstd_configuration()
+              : level_(hpx::util::from_string<int>(
+                    hpx::get_config_entry(
+                        "hpx.plugins.zstd_serialization_filter.level", "3"),
+                    3))
+            {
+                std::string const dictionary = hpx::get_config_entry(
+                    "hpx.plugins.zstd_serialization_filter.dictionary", "");
+                if (dictionary.empty())
+                {
+                    return;
+                }
+
+                std::ifstream in(dictionary, std::ios::binary);
+                std::vector<char> const data(
+                    (std::istreambuf_iterator<char>(in)),
+                    std::istreambuf_iterator<char>());
+                if (!in.good() && !in.eof())
+                {
+                    HPX_THROW_EXCEPTION(filesystem_error,
+                        "zstd_configuration::zstd_configuration",
+                        "could not read the zstd dictionary: {}", dictionary);
+                    return;
+                }
+
+                cdict_ = ZSTD_createCDict(data.data(), data.size(), level_);
+                ddict_ = ZSTD_createDDict(data.data(), data.size());
+            }
+
+            ~zstd_configuration()
+            {
+                ZSTD_freeCDict(cdict_);
+                ZSTD_freeDDict(ddict_);
+            }
+
+            zstd_configuration(zstd_configuration const&) = delete;
+            zstd_configuration& operator=(zstd_configuration const&) = delete;
+
+            int level_;
+            ZSTD_CDict* cdict_ = nullptr;
+            ZSTD_DDict* ddict_ = nullptr;
+        };
+
+        zstd_configuration const& get_zstd_configuration()
+        {
+            static zstd_configuration const config;
+            return config;
+        }
+
+        // the contexts are reused by all filters running on the same thread
+        struct zstd_contexts
+        {
+            zstd_contexts()
+              : cctx_(ZSTD_createCCtx())
+              , dctx_(ZSTD_createDCtx())
+            {
+            }
+
+            ~zstd_contexts()
+            {
+                ZSTD_freeCCtx(cctx_);
+                ZSTD_freeDCtx(dctx_);
+            }
+
+            zstd_contexts(zstd_contexts const&) = delete;
+            zstd_contexts& operator=(zstd_contexts const&) = delete;
+
+            ZSTD_CCtx* cctx_;
+            ZSTD_DCtx* dctx_;
+        };
+
+        zstd_contexts& get_zstd_contexts()
+        {
+            static thread_local zstd_contexts contexts;
+            return contexts;
+        }
+    }    // namespace
+
+    void zstd_serialization_filter::set_max_length(std::size_t size)
+    {
+        buffer_.reserve(size);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    std::size_t zstd_serialization_filter::init_data(
+        void const* buffer, std::size_t size, std::size_t buffer_size)
+    {
+        zstd_configuration const& config = get_zstd_configuration();
+        ZSTD_DCtx* dctx = get_zstd_contexts().dctx_;
+
+        buffer_.resize(buffer_size);
+
+        std::size_t decompressed_length = 0;
+        if (config.ddict_ != nullptr)
+        {
+            decompressed_length = ZSTD_decompress_usingDDict(dctx,
+                buffer_.data(), buffer_size, buffer, size, config.ddict_);
+        }
+        else
+        {
+            decompressed_length = ZSTD_decompressDCtx(
+                dctx, buffer_.data(), buffer_size, buffer, size);
+        }
+
+        if (ZSTD_isError(decompressed_length) ||
+            decompressed_length != buffer_size)
+        {
+            HPX_THROW_EXCEPTION(serialization_error,
+                "zstd_serialization_filter::init_data",
+                "decompression failure: {}",
+                ZSTD_isError(decompressed_length) ?
+                    ZSTD_getErrorName(decompressed_length) :
+                    "unexpected size of the decompressed data");
+            return 0;
+        }
+
+        current_ = 0;
+        return buffer_.size();
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    void zstd_serialization_filter::load(void* dst, std::size_t dst_count)
+    {
+        if (current_ + dst_count > buffer_.size())
+        {
+            HPX_THROW_EXCEPTION(serialization_error,
+                "zstd_serialization_filter::load",
+                "archive data bstream is too short");
+            return;
+        }
+
+        std::memcpy(dst, &buffer_[current_], dst_count);
+        current_ += dst_count;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    void zstd_serialization_filter::save(
+        void const* src, std::size_t src_count)
+    {
+        char const* src_begin = static_cast<char const*>(src);
+        std::copy(
+            src_begin, src_begin + src_count, std::back_inserter(buffer_));
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    bool zstd_serialization_filter::flush(
+        void* dst, std::size_t dst_count, std::size_t& written)
+    {
+        // make sure we have enough memory
+        std::size_t needed = ZSTD_compressBound(buffer_.size());
+        if (needed > dst_count)
+        {
+            written = 0;
+            return false;
+        }
+
+        // compress everything in one go
+        zstd_configuration const& config = get_zstd_configuration();
+        ZSTD_CCtx* cctx = get_zstd_contexts().cctx_;
+
+        std::size_t compressed_length = 0;
+        if (config.cdict_ != nullptr)
+        {
+            compressed_length = ZSTD_compress_usingCDict(cctx, dst, dst_count,
+                buffer_.data(), buffer_.size(), config.cdict_);
+        }
+        else
+        {
+            compressed_length = ZSTD_compressCCtx(cctx, dst, dst_count,
+                buffer_.data(), buffer_.size(), config.level_);
+        }
+
+        if (ZSTD_isError(compressed_length) || compressed_length > dst_count)
+        {
+            HPX_THROW_EXCEPTION(serialization_error,
+                "zstd_serialization_filter::flush",
+                "compression failure, flushing did not reach end of data");
+            return false;
+        }
+
+        written = compressed_length;
+        return true;
+    }
+}    // namespace hpx::plugins::compression
+
+#endif
@@ -0,0 +1,124 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCEL_COALESCING)
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+namespace hpx::plugins::parcel::detail {
+
+    // Computes the coalescing window of a message handler (which exists per
+    // destination and action) from the observed load. The window is sized to
+    // collect the current target number of parcels given the average time
+    // between parcels. The target grows whenever a message fills up before
+    // the window expires and shrinks whenever a message was flushed mostly
+    // empty, or if flushing takes longer than the configured interval.
+    //
+    // The configured number of messages and interval are used as upper
+    // bounds. All times are in nanoseconds.
+    class adaptive_window
+    {
+    public:
+        adaptive_window() = default;
+
+        adaptive_window(std::size_t max_messages, std::size_t max_interval)
+        {
+            reconfigure(max_messages, max_interval);
+            num_messages_ = max_messages_;
+        }
+
+        // max_interval is given in microseconds
+        void reconfigure(std::size_t max_messages, std::size_t max_interval)
+        {
+            max_messages_ = (std::max)(max_messages, std::size_t(1));
+            max_interval_ = std::int64_t(max_interval) * 1000;
+            num_messages_ = (std::min)(num_messages_, max_messages_);
+        }
+
+        // Record the time since the previous parcel. Long pauses are
+        // capped to not dominate the average once the load increases again.
+        void parcel_arrived(std::int64_t time_since_last_parcel) noexcept
+        {
+            std::int64_t const t = (std::min)(
+                (std::max)(time_since_last_parcel, std::int64_t(0)),
+                2 * max_interval_);
+            update(average_time_between_parcels_, t);
+        }
+
+        // Record a flushed message holding the given number of parcels,
+        // latency is the time the first parcel waited in the buffer.
+        void flushed(std::size_t num_parcels, std::int64_t latency,
+            bool buffer_full) noexcept
+        {
+            update(
+                average_flush_latency_, (std::max)(latency, std::int64_t(0)));
+
+            if (buffer_full && average_flush_latency_ <= max_interval_)
+            {
+                // the load is high enough to fill larger messages
+                num_messages_ = (std::min)(2 * num_messages_, max_messages_);
+            }
+            else if (2 * num_parcels < num_messages_ ||
+                average_flush_latency_ > max_interval_)
+            {
+                // waiting for more parcels costs latency without improving
+                // the batching
+                num_messages_ = (std::max)(num_messages_ / 2, std::size_t(1));
+            }
+        }
+
+        // The maximal number of parcels to put into one message
+        std::size_t num_messages() const noexcept
+        {
+            return num_messages_;
+        }
+
+        // The time to wait for more parcels after the first one was buffered
+        std::chrono::nanoseconds interval() const noexcept
+        {
+            std::int64_t const window =
+                average_time_between_parcels_ * std::int64_t(num_messages_);
+            return std::chrono::nanoseconds(
+                (std::min)((std::max)(window, min_interval), max_interval_));
+        }
+
+        std::int64_t average_time_between_parcels() const noexcept
+        {
+            return average_time_between_parcels_;
+        }
+
+        std::int64_t average_flush_latency() const noexcept
+        {
+            return average_flush_latency_;
+        }
+
+    private:
+        // exponential moving average with a weight of 1/8 for new samples
+        static void update(std::int64_t& average, std::int64_t value) noexcept
+        {
+            average += (value - average) / 8;
+        }
+
+        // the timer resolution is one microsecond
+        static constexpr std::int64_t min_interval = 1000;
+
+        std::size_t max_messages_ = 1;
+        std::int64_t max_interval_ = 0;
+        std::size_t num_messages_ = 1;
+
+        std::int64_t average_time_between_parcels_ = 0;
+        std::int64_t average_flush_latency_ = 0;
+    };
+}    // namespace hpx::plugins::parcel::detail
+
+#endif
@@ -47,6 +47,7 @@ namespace hpx::plugins::parcel {
             get_counter_type num_messages;
             get_counter_type num_parcels_per_message;
             get_counter_type average_time_between_parcels;
+            get_counter_type average_flush_latency;
             get_counter_values_creator_type
                 time_between_parcels_histogram_creator;
             std::int64_t min_boundary, max_boundary, num_buckets;
@@ -63,6 +64,7 @@ namespace hpx::plugins::parcel {
             get_counter_type num_parcels, get_counter_type num_messages,
             get_counter_type time_between_parcels,
             get_counter_type average_time_between_parcels,
+            get_counter_type average_flush_latency,
             get_counter_values_creator_type
                 time_between_parcels_histogram_creator);
 
@@ -72,6 +74,8 @@ namespace hpx::plugins::parcel {
             std::string const& name) const;
         get_counter_type get_average_time_between_parcels_counter(
             std::string const& name) const;
+        get_counter_type get_average_flush_latency_counter(
+            std::string const& name) const;
         get_counter_values_type get_time_between_parcels_histogram_counter(
             std::string const& name, std::int64_t min_boundary,
             std::int64_t max_boundary, std::int64_t num_buckets);
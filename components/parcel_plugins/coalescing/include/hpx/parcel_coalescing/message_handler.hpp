@@ -15,9 +15,11 @@
 #include <hpx/modules/statistics.hpp>
 #include <hpx/modules/synchronization.hpp>
 
+#include <hpx/parcel_coalescing/adaptive_window.hpp>
 #include <hpx/parcel_coalescing/message_buffer.hpp>
 #include <hpx/parcelset_base/policies/message_handler.hpp>
 
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
 #include <memory>
@@ -56,6 +58,7 @@ namespace hpx::plugins::parcel {
         std::int64_t get_messages_count(bool reset);
         std::int64_t get_parcels_per_message_count(bool reset);
         std::int64_t get_average_time_between_parcels(bool reset);
+        std::int64_t get_average_flush_latency(bool reset);
         std::vector<std::int64_t> get_time_between_parcels_histogram(
             bool reset);
         void get_time_between_parcels_histogram_creator(
@@ -75,6 +78,10 @@ namespace hpx::plugins::parcel {
         void update_num_messages();
         void update_interval();
 
+        std::size_t current_num_messages() const;
+        std::chrono::nanoseconds current_interval() const;
+        bool sender_is_idle() const;
+
     private:
         mutable mutex_type mtx_;
         parcelset::parcelport* pp_;
@@ -86,6 +93,11 @@ namespace hpx::plugins::parcel {
         bool allow_background_flush_;
         std::string action_name_;
 
+        // adjusts the coalescing parameters to the load if enabled
+        bool adaptive_;
+        detail::adaptive_window window_;
+        std::int64_t first_parcel_time_;
+
         // performance counter data
         std::int64_t num_parcels_;
         std::int64_t reset_num_parcels_;
@@ -96,6 +108,10 @@ namespace hpx::plugins::parcel {
         std::int64_t started_at_;
         std::int64_t reset_time_num_parcels_;
         std::int64_t last_parcel_time_;
+        std::int64_t num_flushes_;
+        std::int64_t flush_latency_;
+        std::int64_t reset_num_flushes_;
+        std::int64_t reset_flush_latency_;
 
         // collects percentiles
         using histogram_collector_type =
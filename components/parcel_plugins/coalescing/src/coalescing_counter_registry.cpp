@@ -33,6 +33,7 @@ namespace hpx::plugins::parcel {
         get_counter_type num_parcels, get_counter_type num_messages,
         get_counter_type num_parcels_per_message,
         get_counter_type average_time_between_parcels,
+        get_counter_type average_flush_latency,
         get_counter_values_creator_type time_between_parcels_histogram_creator)
     {
         if (name.empty())
@@ -49,7 +50,8 @@ namespace hpx::plugins::parcel {
         {
             counter_functions data = {num_parcels, num_messages,
                 num_parcels_per_message, average_time_between_parcels,
-                time_between_parcels_histogram_creator, 0, 0, 1};
+                average_flush_latency, time_between_parcels_histogram_creator,
+                0, 0, 1};
 
             map_.emplace(name, HPX_MOVE(data));
         }
@@ -61,6 +63,7 @@ namespace hpx::plugins::parcel {
             (*it).second.num_parcels_per_message = num_parcels_per_message;
             (*it).second.average_time_between_parcels =
                 average_time_between_parcels;
+            (*it).second.average_flush_latency = average_flush_latency;
             (*it).second.time_between_parcels_histogram_creator =
                 time_between_parcels_histogram_creator;
 
@@ -78,6 +81,7 @@ namespace hpx::plugins::parcel {
             (void) (*it).second.num_messages;
             (void) (*it).second.num_parcels_per_message;
             (void) (*it).second.average_time_between_parcels;
+            (void) (*it).second.average_flush_latency;
             (void) (*it).second.time_between_parcels_histogram_creator;
         }
     }
@@ -174,6 +178,25 @@ namespace hpx::plugins::parcel {
         return (*it).second.average_time_between_parcels;
     }
 
+    coalescing_counter_registry::get_counter_type
+    coalescing_counter_registry::get_average_flush_latency_counter(
+        std::string const& name) const
+    {
+        std::unique_lock<mutex_type> l(mtx_);
+
+        map_type::const_iterator it = map_.find(name);
+        if (it == map_.end())
+        {
+            l.unlock();
+            HPX_THROW_EXCEPTION(bad_parameter,
+                "coalescing_counter_registry::"
+                "get_average_flush_latency_counter",
+                "unknown action type");
+            return get_counter_type();
+        }
+        return (*it).second.average_flush_latency;
+    }
+
     coalescing_counter_registry::get_counter_values_type
     coalescing_counter_registry::get_time_between_parcels_histogram_counter(
         std::string const& name, std::int64_t min_boundary,
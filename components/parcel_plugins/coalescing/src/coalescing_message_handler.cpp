@@ -11,6 +11,7 @@
 #include <hpx/modules/functional.hpp>
 #include <hpx/modules/runtime_local.hpp>
 #include <hpx/modules/thread_support.hpp>
+#include <hpx/modules/threading_base.hpp>
 #include <hpx/modules/timing.hpp>
 #include <hpx/modules/util.hpp>
 #include <hpx/plugin/traits/plugin_config_data.hpp>
@@ -41,6 +42,10 @@ namespace hpx::traits {
     //      ...
     //      num_messages = 50
     //      interval = 100
+    //      adaptive = 0
+    //
+    // If adaptive is set, num_messages and interval are upper bounds for
+    // the coalescing parameters, which are adjusted to the observed load.
     //
     template <>
     struct plugin_config_data<hpx::plugins::parcel::coalescing_message_handler>
@@ -49,7 +54,8 @@ namespace hpx::traits {
         {
             return "num_messages = 50\n"
                    "interval = 100\n"
-                   "allow_background_flush = 1";
+                   "allow_background_flush = 1\n"
+                   "adaptive = 0";
         }
     };
 }    // namespace hpx::traits
@@ -84,6 +90,13 @@ namespace hpx::plugins::parcel {
                 "1");
             return !value.empty() && value[0] != '0';
         }
+
+        bool get_adaptive()
+        {
+            std::string value = hpx::get_config_entry(
+                "hpx.plugins.coalescing_message_handler.adaptive", "0");
+            return !value.empty() && value[0] != '0';
+        }
     }    // namespace detail
 
     void coalescing_message_handler::update_num_messages()
@@ -91,12 +104,38 @@ namespace hpx::plugins::parcel {
         std::lock_guard<mutex_type> l(mtx_);
         num_coalesced_parcels_ =
             detail::get_num_messages(num_coalesced_parcels_);
+        window_.reconfigure(num_coalesced_parcels_, interval_);
     }
 
     void coalescing_message_handler::update_interval()
     {
         std::lock_guard<mutex_type> l(mtx_);
         interval_ = detail::get_interval(interval_);
+        window_.reconfigure(num_coalesced_parcels_, interval_);
+    }
+
+    std::size_t coalescing_message_handler::current_num_messages() const
+    {
+        return adaptive_ ? window_.num_messages() : num_coalesced_parcels_;
+    }
+
+    std::chrono::nanoseconds coalescing_message_handler::current_interval()
+        const
+    {
+        if (adaptive_)
+            return window_.interval();
+        return std::chrono::microseconds(interval_);
+    }
+
+    // The sender goes idle if no other work is waiting to be executed by
+    // the thread pool running the current (background) thread.
+    bool coalescing_message_handler::sender_is_idle() const
+    {
+        threads::thread_data* self = threads::get_self_id_data();
+        if (nullptr == self)
+            return false;
+
+        return self->get_scheduler_base()->get_queue_length() == 0;
     }
 
     coalescing_message_handler::coalescing_message_handler(
@@ -112,6 +151,9 @@ namespace hpx::plugins::parcel {
       , stopped_(false)
       , allow_background_flush_(detail::get_background_flush())
       , action_name_(action_name)
+      , adaptive_(detail::get_adaptive())
+      , window_(num_coalesced_parcels_, interval_)
+      , first_parcel_time_(0)
       , num_parcels_(0)
       , reset_num_parcels_(0)
       , reset_num_parcels_per_message_parcels_(0)
@@ -121,6 +163,10 @@ namespace hpx::plugins::parcel {
       , started_at_(hpx::chrono::high_resolution_clock::now())
       , reset_time_num_parcels_(0)
       , last_parcel_time_(started_at_)
+      , num_flushes_(0)
+      , flush_latency_(0)
+      , reset_num_flushes_(0)
+      , reset_flush_latency_(0)
       , histogram_min_boundary_(-1)
       , histogram_max_boundary_(-1)
       , histogram_num_buckets_(-1)
@@ -137,6 +183,8 @@ namespace hpx::plugins::parcel {
             hpx::bind_front(
                 &coalescing_message_handler::get_average_time_between_parcels,
                 this),
+            hpx::bind_front(
+                &coalescing_message_handler::get_average_flush_latency, this),
             hpx::bind_front(&coalescing_message_handler::
                                 get_time_between_parcels_histogram_creator,
                 this));
@@ -165,7 +213,10 @@ namespace hpx::plugins::parcel {
         if (time_between_parcels_)
             (*time_between_parcels_)(time_since_last_parcel);
 
-        std::chrono::microseconds interval(interval_);
+        if (adaptive_)
+            window_.parcel_arrived(time_since_last_parcel);
+
+        std::chrono::nanoseconds interval = current_interval();
 
         // just send parcel if the coalescing was stopped or the buffer is
         // empty and time since last parcel is larger than coalescing interval.
@@ -187,6 +238,7 @@ namespace hpx::plugins::parcel {
         switch (s)
         {
         case detail::message_buffer::first_message:
+            first_parcel_time_ = parcel_time;
             [[fallthrough]];
         case detail::message_buffer::normal:
             // start deadline timer to flush buffer
@@ -246,13 +298,22 @@ namespace hpx::plugins::parcel {
     {
         HPX_ASSERT(l.owns_lock());
 
-        // proceed with background work only if explicitly allowed
-        if (!allow_background_flush_ &&
-            mode ==
-                parcelset::policies::message_handler::
-                    flush_mode_background_work)
+        if (mode ==
+            parcelset::policies::message_handler::flush_mode_background_work)
         {
-            return false;
+            // In adaptive mode the buffer is flushed as soon as the sender
+            // goes idle, as no more parcels will be coalesced in this case.
+            // Otherwise, proceed with background work only if explicitly
+            // allowed.
+            if (adaptive_)
+            {
+                if (!stop_buffering && !sender_is_idle())
+                    return false;
+            }
+            else if (!allow_background_flush_)
+            {
+                return false;
+            }
         }
 
         if (!stopped_ && stop_buffering)
@@ -272,7 +333,20 @@ namespace hpx::plugins::parcel {
         if (buffer_.empty())
             return false;
 
-        detail::message_buffer buff(num_coalesced_parcels_);
+        std::int64_t latency =
+            hpx::chrono::high_resolution_clock::now() - first_parcel_time_;
+        ++num_flushes_;
+        flush_latency_ += latency;
+
+        if (adaptive_)
+        {
+            window_.flushed(buffer_.size(), latency,
+                mode ==
+                    parcelset::policies::message_handler::
+                        flush_mode_buffer_full);
+        }
+
+        detail::message_buffer buff(current_num_messages());
         std::swap(buff, buffer_);
 
         ++num_messages_;
@@ -317,6 +391,24 @@ namespace hpx::plugins::parcel {
         return value;
     }
 
+    std::int64_t coalescing_message_handler::get_average_flush_latency(
+        bool reset)
+    {
+        std::lock_guard<mutex_type> l(mtx_);
+        std::int64_t num_flushes = num_flushes_ - reset_num_flushes_;
+        std::int64_t value = 0;
+        if (num_flushes != 0)
+            value = (flush_latency_ - reset_flush_latency_) / num_flushes;
+
+        if (reset)
+        {
+            reset_num_flushes_ = num_flushes_;
+            reset_flush_latency_ = flush_latency_;
+        }
+
+        return value;
+    }
+
     std::int64_t coalescing_message_handler::get_parcels_count(bool reset)
     {
         std::unique_lock<mutex_type> l(mtx_);
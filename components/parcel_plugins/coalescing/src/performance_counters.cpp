@@ -396,6 +396,91 @@ namespace hpx::plugins::parcel {
         }
     }
 
+    ///////////////////////////////////////////////////////////////////////////
+    struct average_flush_latency_counter_surrogate
+    {
+        explicit average_flush_latency_counter_surrogate(
+            std::string const& parameters)
+          : parameters_(parameters)
+        {
+        }
+
+        std::int64_t operator()(bool reset)
+        {
+            if (counter_.empty())
+            {
+                counter_ = coalescing_counter_registry::instance()
+                               .get_average_flush_latency_counter(parameters_);
+                if (counter_.empty())
+                    return 0;    // no counter available yet
+            }
+
+            // dispatch to actual counter
+            return counter_(reset);
+        }
+
+        hpx::function<std::int64_t(bool)> counter_;
+        std::string parameters_;
+    };
+
+    hpx::naming::gid_type average_flush_latency_counter_creator(
+        hpx::performance_counters::counter_info const& info,
+        hpx::error_code& ec)
+    {
+        switch (info.type_)
+        {
+        case performance_counters::counter_type::average_timer:
+        {
+            performance_counters::counter_path_elements paths;
+            performance_counters::get_counter_path_elements(
+                info.fullname_, paths, ec);
+            if (ec)
+                return naming::invalid_gid;
+
+            if (paths.parentinstance_is_basename_)
+            {
+                HPX_THROWS_IF(ec, bad_parameter,
+                    "average_flush_latency_counter_creator",
+                    "invalid counter name for flush latency (instance "
+                    "name must not be a valid base counter name)");
+                return naming::invalid_gid;
+            }
+
+            if (paths.parameters_.empty())
+            {
+                HPX_THROWS_IF(ec, bad_parameter,
+                    "average_flush_latency_counter_creator",
+                    "invalid counter parameter for flush latency: must "
+                    "specify an action type");
+                return naming::invalid_gid;
+            }
+
+            // ask registry
+            hpx::function<std::int64_t(bool)> f =
+                coalescing_counter_registry::instance()
+                    .get_average_flush_latency_counter(paths.parameters_);
+
+            if (!f.empty())
+            {
+                return performance_counters::detail::create_raw_counter(
+                    info, HPX_MOVE(f), ec);
+            }
+
+            // the counter is not available yet, create surrogate function
+            return performance_counters::detail::create_raw_counter(info,
+                average_flush_latency_counter_surrogate(paths.parameters_),
+                ec);
+        }
+        break;
+
+        default:
+            HPX_THROWS_IF(ec, bad_parameter,
+                "average_flush_latency_counter_creator",
+                "invalid counter type requested");
+            return naming::invalid_gid;
+        }
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     struct time_between_parcels_histogram_counter_surrogate
     {
@@ -582,6 +667,15 @@ namespace hpx::plugins::parcel {
                 HPX_PERFORMANCE_COUNTER_V1,
                 &average_time_between_parcels_counter_creator,
                 &counter_discoverer, "ns"},
+            // /coalescing(...)/time/flush-latency-average@action-name
+            {"/coalescing/time/flush-latency-average",
+                counter_type::average_timer,
+                "returns the average time parcels of the action which is "
+                "given by the counter parameter were buffered before being "
+                "sent",
+                HPX_PERFORMANCE_COUNTER_V1,
+                &average_flush_latency_counter_creator, &counter_discoverer,
+                "ns"},
             // /coalescing(...)/time/between-parcels-histogram@action-name,min,max,buckets
             {"/coalescing/time/between-parcels-histogram",
                 counter_type::histogram,
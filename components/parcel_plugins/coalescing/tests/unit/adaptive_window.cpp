@@ -0,0 +1,101 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCEL_COALESCING)
+#include <hpx/modules/testing.hpp>
+#include <hpx/parcel_coalescing/adaptive_window.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+using hpx::plugins::parcel::detail::adaptive_window;
+
+// 50 parcels per message at most, 100us interval at most
+constexpr std::size_t max_messages = 50;
+constexpr std::size_t max_interval = 100;
+
+void test_high_load()
+{
+    adaptive_window window(max_messages, max_interval);
+
+    // parcels arrive every 100ns, messages fill up
+    for (int i = 0; i != 100; ++i)
+    {
+        window.parcel_arrived(100);
+    }
+    HPX_TEST_LT(window.average_time_between_parcels(), std::int64_t(200));
+
+    window.flushed(max_messages, 5000, true);
+    HPX_TEST_EQ(window.num_messages(), max_messages);
+    HPX_TEST(window.interval() <= std::chrono::microseconds(max_interval));
+    HPX_TEST(window.interval() >= std::chrono::microseconds(1));
+}
+
+void test_low_load()
+{
+    adaptive_window window(max_messages, max_interval);
+
+    // parcels arrive every 10us, the timer flushes almost empty messages
+    for (int i = 0; i != 100; ++i)
+    {
+        window.parcel_arrived(10000);
+        window.flushed(2, 20000, false);
+    }
+    HPX_TEST_EQ(window.num_messages(), std::size_t(1));
+
+    // the window collects roughly one parcel
+    HPX_TEST(window.interval() <= std::chrono::microseconds(20));
+
+    // the load increases again, messages fill up and grow
+    std::size_t num_messages = window.num_messages();
+    for (int i = 0; i != 10; ++i)
+    {
+        window.parcel_arrived(100);
+        window.flushed(window.num_messages(), 1000, true);
+        HPX_TEST_LTE(num_messages, window.num_messages());
+        num_messages = window.num_messages();
+    }
+    HPX_TEST_EQ(window.num_messages(), max_messages);
+}
+
+void test_bounds()
+{
+    adaptive_window window(max_messages, max_interval);
+
+    // long pauses never extend the window beyond the configured interval
+    for (int i = 0; i != 100; ++i)
+    {
+        window.parcel_arrived(std::int64_t(10) * 1000 * 1000 * 1000);
+    }
+    HPX_TEST(window.interval() == std::chrono::microseconds(max_interval));
+
+    // flushes taking longer than the interval shrink the messages
+    window.flushed(max_messages, std::int64_t(1000) * 1000 * 1000, true);
+    HPX_TEST_LT(window.num_messages(), max_messages);
+
+    // reconfiguring lowers the limits
+    window.reconfigure(4, 10);
+    HPX_TEST_LTE(window.num_messages(), std::size_t(4));
+    HPX_TEST(window.interval() <= std::chrono::microseconds(10));
+}
+
+int main()
+{
+    test_high_load();
+    test_low_load();
+    test_bounds();
+
+    return hpx::util::report_errors();
+}
+#else
+int main()
+{
+    return 0;
+}
+#endif
@@ -23,5 +23,13 @@ namespace hpx { namespace performance_counters { namespace memory
     // returns total available memory
     std::uint64_t read_total_mem_avail(bool);
 #endif
+
+#if defined(__linux) || defined(linux) || defined(linux__) || defined(__linux__)
+    // returns the resident memory backed by transparent huge pages
+    std::uint64_t read_psm_huge_transparent(bool);
+
+    // returns the memory backed by explicit (hugetlbfs) huge pages
+    std::uint64_t read_psm_huge_hugetlb(bool);
+#endif
 }}}
 
@@ -32,6 +32,7 @@
 
 #include <algorithm>
 #include <cstdint>
+#include <cstdlib>
 #include <fstream>
 #include <iterator>
 #include <string>
@@ -131,6 +132,59 @@ namespace hpx { namespace performance_counters { namespace memory {
         return ps.resident * EXEC_PAGESIZE;
     }
 
+    // Sums up the sizes [kB] of the given fields of all mappings of this
+    // process. /proc/self/smaps_rollup holds the sums already, it is not
+    // available before Linux 4.14 though.
+    std::uint64_t read_smaps_fields(
+        char const* function, std::vector<std::string> const& fields)
+    {
+        ifstream_raii stm("/proc/self/smaps_rollup", std::ios_base::in);
+
+        std::ifstream& in = stm.get();
+        if (!in)
+        {
+            in.clear();
+            in.open("/proc/self/smaps", std::ios_base::in);
+        }
+        if (!in)
+        {
+            HPX_THROW_EXCEPTION(hpx::invalid_data, function,
+                "failed to open '/proc/self/smaps'");
+            return std::uint64_t(-1);
+        }
+
+        std::uint64_t kb = 0;
+        std::string line;
+        while (std::getline(in, line))
+        {
+            for (std::string const& field : fields)
+            {
+                if (line.compare(0, field.size(), field) == 0)
+                {
+                    kb += std::strtoull(
+                        line.c_str() + field.size(), nullptr, 10);
+                }
+            }
+        }
+        return kb * 1024;
+    }
+
+    // Returns resident memory backed by transparent huge pages
+    std::uint64_t read_psm_huge_transparent(bool)
+    {
+        return read_smaps_fields(
+            "hpx::performance_counters::memory::read_psm_huge_transparent",
+            {"AnonHugePages:"});
+    }
+
+    // Returns memory backed by huge pages allocated from hugetlbfs
+    std::uint64_t read_psm_huge_hugetlb(bool)
+    {
+        return read_smaps_fields(
+            "hpx::performance_counters::memory::read_psm_huge_hugetlb",
+            {"Shared_Hugetlb:", "Private_Hugetlb:"});
+    }
+
     // Returns total available memory
     std::uint64_t read_total_mem_avail(bool)
     {
@@ -38,6 +38,19 @@ namespace hpx { namespace performance_counters { namespace memory {
         pc::install_counter_type("/runtime/memory/total", &read_total_mem_avail,
             "returns the total available memory on the node", "kB",
             pc::counter_type::raw);
+#endif
+#if defined(__linux) || defined(linux) || defined(linux__) ||                  \
+    defined(__linux__)
+        pc::install_counter_type("/runtime/memory/huge_pages/transparent",
+            &read_psm_huge_transparent,
+            "returns the amount of resident memory of the referenced locality "
+            "which is backed by transparent huge pages",
+            "bytes", pc::counter_type::raw);
+        pc::install_counter_type("/runtime/memory/huge_pages/hugetlb",
+            &read_psm_huge_hugetlb,
+            "returns the amount of memory of the referenced locality which is "
+            "backed by huge pages allocated from hugetlbfs",
+            "bytes", pc::counter_type::raw);
 #endif
     }
 
@@ -0,0 +1,56 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_PAPI)
+
+#include <hpx/components/performance_counters/papi/util/papi.hpp>
+#include <hpx/threading_base/task_profiles.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace hpx { namespace performance_counters { namespace papi { namespace util
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // Reads the PAPI events given by --hpx:papi-task-events for the task
+    // profiling (see hpx::threads::set_task_counter_sampler). Every worker
+    // thread counts the events in an event set of its own, which is created
+    // when the worker reads the events for the first time.
+    class task_sampler : public hpx::threads::task_counter_sampler
+    {
+    public:
+        // throws if one of the events is unknown
+        explicit task_sampler(std::vector<std::string> const& events);
+
+        std::size_t size() const noexcept override
+        {
+            return events_.size();
+        }
+
+        bool read(std::int64_t* values) noexcept override;
+
+        std::vector<std::string> const& get_event_names() const noexcept
+        {
+            return names_;
+        }
+
+    private:
+        std::vector<std::string> names_;
+        std::vector<int> events_;
+    };
+
+    // install the sampler for the events given on the command line and the
+    // related performance counter types, does nothing if no events are given
+    void setup_task_sampler(variables_map const& vm);
+}}}}
+
+#endif
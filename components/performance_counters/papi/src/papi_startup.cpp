@@ -11,6 +11,7 @@
 
 #include <hpx/components/performance_counters/papi/server/papi.hpp>
 #include <hpx/components/performance_counters/papi/util/papi.hpp>
+#include <hpx/components/performance_counters/papi/util/task_sampler.hpp>
 #include <hpx/components_base/component_commandline.hpp>
 #include <hpx/components_base/component_startup_shutdown.hpp>
 #include <hpx/components_base/server/create_component.hpp>
@@ -307,6 +308,9 @@ namespace hpx { namespace performance_counters { namespace papi {
             std::string v = vm["hpx:papi-event-info"].as<std::string>();
             util::list_events(v);
         }
+
+        // per HPX-thread sampling of PAPI events
+        util::setup_task_sampler(vm);
     }
 
     bool check_startup(
@@ -18,6 +18,7 @@
 
 #include <asio/ip/host_name.hpp>
 
+#include <cstddef>
 #include <cstdint>
 #include <iostream>
 #include <map>
@@ -82,6 +83,14 @@ namespace hpx { namespace performance_counters { namespace papi { namespace util
              "  preset - show available predefined events,\n"
              "  native - show available native events,\n"
              "  all    - show all available events.")
+            ("hpx:papi-task-events", value<std::string>(),
+             "comma separated list of PAPI events to count for every sampled "
+             "HPX-thread, the counts are accumulated by the annotation of the "
+             "threads (see /papi-task counters).")
+            ("hpx:papi-task-interval",
+             value<std::size_t>()->default_value(16),
+             "sample every n-th HPX-thread phase run by a worker thread "
+             "(default: 16).")
             ;
         return papi_opts;
     }
@@ -146,6 +155,14 @@ namespace hpx { namespace performance_counters { namespace papi { namespace util
                 NS_STR "check_options()");
             needed = true;
         }
+        if (vm.count("hpx:papi-task-events"))
+        {
+            if (vm["hpx:papi-task-interval"].as<std::size_t>() == 0)
+                HPX_THROW_EXCEPTION(hpx::commandline_option_error,
+                    NS_STR "check_options()",
+                    "argument to --hpx:papi-task-interval must be positive");
+            needed = true;
+        }
         // FIXME: implement multiplexing properly and uncomment below when done
         if (vm.count("hpx:papi-multiplex"))
             HPX_THROW_EXCEPTION(hpx::not_implemented,
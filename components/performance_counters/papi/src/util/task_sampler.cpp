@@ -0,0 +1,245 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_PAPI)
+
+#include <hpx/components/performance_counters/papi/util/papi.hpp>
+#include <hpx/components/performance_counters/papi/util/task_sampler.hpp>
+#include <hpx/functional/bind_front.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/modules/string_util.hpp>
+#include <hpx/performance_counters/counter_creators.hpp>
+#include <hpx/performance_counters/counters.hpp>
+#include <hpx/performance_counters/manage_counter_type.hpp>
+#include <hpx/threading_base/task_profiles.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <papi.h>
+#include <pthread.h>
+
+#define NS_STR "hpx::performance_counters::papi::util::"
+
+namespace hpx { namespace performance_counters { namespace papi { namespace util
+{
+    namespace {
+
+        unsigned long get_papi_thread_id()
+        {
+            return static_cast<unsigned long>(pthread_self());
+        }
+
+        // the event set of the calling worker thread
+        struct thread_event_set
+        {
+            ~thread_event_set()
+            {
+                release();
+            }
+
+            void release() noexcept
+            {
+                if (evset_ != PAPI_NULL)
+                {
+                    long long values[hpx::threads::max_task_counters];
+                    PAPI_stop(evset_, values);
+                    PAPI_cleanup_eventset(evset_);
+                    PAPI_destroy_eventset(&evset_);
+                    evset_ = PAPI_NULL;
+                }
+            }
+
+            // (re-)creates the event set if it wasn't created for the given
+            // sampler, returns false if the events can't be counted
+            bool prepare(
+                task_sampler const* owner, std::vector<int> const& events)
+            {
+                if (owner_ == owner)
+                {
+                    return evset_ != PAPI_NULL;
+                }
+
+                release();
+                owner_ = owner;
+
+                if (PAPI_create_eventset(&evset_) != PAPI_OK)
+                {
+                    evset_ = PAPI_NULL;
+                    return false;
+                }
+                for (int event : events)
+                {
+                    if (PAPI_add_event(evset_, event) != PAPI_OK)
+                    {
+                        release();
+                        return false;
+                    }
+                }
+                if (PAPI_start(evset_) != PAPI_OK)
+                {
+                    release();
+                    return false;
+                }
+                return true;
+            }
+
+            int evset_ = PAPI_NULL;
+            task_sampler const* owner_ = nullptr;
+        };
+
+        thread_event_set& get_thread_event_set()
+        {
+            static thread_local thread_event_set evset;
+            return evset;
+        }
+    }    // namespace
+
+    ///////////////////////////////////////////////////////////////////////////
+    task_sampler::task_sampler(std::vector<std::string> const& events)
+      : names_(events)
+    {
+        if (events.size() > hpx::threads::max_task_counters)
+        {
+            HPX_THROW_EXCEPTION(hpx::commandline_option_error,
+                NS_STR "task_sampler::task_sampler()",
+                hpx::util::format(
+                    "at most {} events can be given to --hpx:papi-task-events",
+                    hpx::threads::max_task_counters));
+        }
+
+        // the event sets are created by the worker threads
+        int const rc = PAPI_thread_init(&get_papi_thread_id);
+        if (rc != PAPI_OK && rc != PAPI_EISRUN)
+        {
+            papi_call(rc, "failed to initialize PAPI thread support",
+                NS_STR "task_sampler::task_sampler()");
+        }
+
+        events_.reserve(events.size());
+        for (std::string const& name : events)
+        {
+            int code = PAPI_NULL;
+            papi_call(PAPI_event_name_to_code(
+                          const_cast<char*>(name.c_str()), &code),
+                "unknown PAPI event " + name + " in --hpx:papi-task-events",
+                NS_STR "task_sampler::task_sampler()");
+            events_.push_back(code);
+        }
+    }
+
+    bool task_sampler::read(std::int64_t* values) noexcept
+    {
+        thread_event_set& evset = get_thread_event_set();
+        try
+        {
+            if (!evset.prepare(this, events_))
+            {
+                return false;
+            }
+        }
+        catch (...)
+        {
+            return false;
+        }
+
+        long long counts[hpx::threads::max_task_counters];
+        if (PAPI_read(evset.evset_, counts) != PAPI_OK)
+        {
+            return false;
+        }
+
+        for (std::size_t i = 0; i != events_.size(); ++i)
+        {
+            values[i] = static_cast<std::int64_t>(counts[i]);
+        }
+        return true;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    namespace {
+
+        // the annotation of the sampled HPX threads is given as the counter
+        // parameter, index is the event index or -1 for the number of samples
+        hpx::naming::gid_type create_task_counter(std::size_t index,
+            counter_info const& info, hpx::error_code& ec)
+        {
+            counter_path_elements paths;
+            get_counter_path_elements(info.fullname_, paths, ec);
+            if (ec)
+                return hpx::naming::invalid_gid;
+
+            if (paths.parameters_.empty())
+            {
+                HPX_THROWS_IF(ec, hpx::bad_parameter,
+                    NS_STR "create_task_counter()",
+                    "the annotation of the sampled tasks must be given as "
+                    "the counter parameter: " +
+                        info.fullname_);
+                return hpx::naming::invalid_gid;
+            }
+
+            return locality_raw_counter_creator(info,
+                [name = paths.parameters_, index](bool reset) {
+                    if (index == std::size_t(-1))
+                    {
+                        return hpx::threads::get_task_profile_value(name,
+                            hpx::threads::task_profile_value::samples, reset);
+                    }
+                    return hpx::threads::get_task_profile_counter(
+                        name, index, reset);
+                },
+                ec);
+        }
+    }    // namespace
+
+    void setup_task_sampler(variables_map const& vm)
+    {
+        if (!vm.count("hpx:papi-task-events"))
+        {
+            return;
+        }
+
+        std::vector<std::string> events;
+        hpx::string_util::split(events,
+            vm["hpx:papi-task-events"].as<std::string>(),
+            hpx::string_util::is_any_of(","),
+            hpx::string_util::token_compress_mode::on);
+
+        auto sampler = std::make_shared<task_sampler>(events);
+
+        std::vector<generic_counter_type_data> types;
+        types.reserve(events.size() + 1);
+        for (std::size_t i = 0; i != events.size(); ++i)
+        {
+            types.push_back({"/papi-task/" + events[i], counter_type::raw,
+                "returns the count of occurrences of " + events[i] +
+                    " while the sampled HPX-threads with the annotation "
+                    "given as the counter parameter were running",
+                HPX_PERFORMANCE_COUNTER_V1,
+                hpx::bind_front(&create_task_counter, i),
+                &locality_counter_discoverer, ""});
+        }
+        types.push_back({"/papi-task/samples", counter_type::raw,
+            "returns the number of times the HPX-threads with the annotation "
+            "given as the counter parameter were sampled",
+            HPX_PERFORMANCE_COUNTER_V1,
+            hpx::bind_front(&create_task_counter, std::size_t(-1)),
+            &locality_counter_discoverer, ""});
+        install_counter_types(types.data(), types.size());
+
+        hpx::threads::set_task_counter_sampler(
+            HPX_MOVE(sampler), vm["hpx:papi-task-interval"].as<std::size_t>());
+        hpx::threads::enable_task_profiling(true);
+    }
+}}}}
+
+#endif
@@ -0,0 +1,29 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/performance_counters/counters.hpp>
+
+#include <string>
+#include <vector>
+
+namespace hpx { namespace performance_counters { namespace prometheus {
+
+    // returns the name of the metric family exposing the counters of the
+    // given type, e.g. hpx_threads_count_cumulative for
+    // /threads/count/cumulative
+    std::string get_openmetrics_name(counter_path_elements const& path);
+
+    // Formats the values of the given counters in the OpenMetrics text
+    // format (including the terminating '# EOF' line). The values are
+    // combined into one metric family per counter type, labelled by the
+    // locality, the instance and the parameters of the counter. Counters
+    // without valid data are skipped.
+    std::string format_openmetrics(std::vector<counter_info> const& infos,
+        std::vector<counter_value> const& values);
+}}}    // namespace hpx::performance_counters::prometheus
@@ -0,0 +1,212 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/performance_counters/counters.hpp>
+
+#include <hpx/components/performance_counters/prometheus/openmetrics.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace hpx { namespace performance_counters { namespace prometheus {
+
+    namespace {
+        // metric and label names may contain [a-zA-Z0-9_:] only
+        void append_name(std::string& result, std::string const& name)
+        {
+            for (char c : name)
+            {
+                if ((c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') ||
+                    (c >= '0' && c <= '9') || c == '_' || c == ':')
+                {
+                    result += c;
+                }
+                else if (!result.empty() && result.back() != '_')
+                {
+                    result += '_';
+                }
+            }
+        }
+
+        // escapes the text of label values and help texts
+        void append_escaped(std::string& result, std::string const& text)
+        {
+            for (char c : text)
+            {
+                switch (c)
+                {
+                case '\\':
+                    result += "\\\\";
+                    break;
+                case '"':
+                    result += "\\\"";
+                    break;
+                case '\n':
+                    result += "\\n";
+                    break;
+                default:
+                    result += c;
+                    break;
+                }
+            }
+        }
+
+        void append_index(std::string& result, std::int64_t index)
+        {
+            if (index != -1)
+            {
+                result += '#';
+                result += std::to_string(index);
+            }
+        }
+
+        void append_value(std::string& result, counter_value const& value)
+        {
+            // avoid rounding the (integral) raw values if possible
+            if (value.scaling_ == 1)
+            {
+                result += std::to_string(value.value_);
+                return;
+            }
+
+            char buffer[32];
+            std::snprintf(buffer, sizeof(buffer), "%.17g",
+                value.get_value<double>());
+            result += buffer;
+        }
+
+        struct metric_family
+        {
+            bool is_counter = false;
+            std::string help;
+            std::string samples;
+        };
+    }    // namespace
+
+    ///////////////////////////////////////////////////////////////////////////
+    std::string get_openmetrics_name(counter_path_elements const& path)
+    {
+        std::string name("hpx_");
+        append_name(name, path.objectname_);
+        name += '_';
+        append_name(name, path.countername_);
+        while (name.back() == '_')
+        {
+            name.pop_back();
+        }
+
+        // the samples of counters get the suffix '_total' which must not be
+        // repeated in the name of their family
+        if (name.size() > 6 && name.compare(name.size() - 6, 6, "_total") == 0)
+        {
+            name.erase(name.size() - 6);
+        }
+        return name;
+    }
+
+    std::string format_openmetrics(std::vector<counter_info> const& infos,
+        std::vector<counter_value> const& values)
+    {
+        HPX_ASSERT(infos.size() == values.size());
+
+        // the samples of a family have to be contiguous, the families are
+        // sorted by name to produce a stable output
+        std::map<std::string, metric_family> families;
+        for (std::size_t i = 0; i != infos.size() && i != values.size(); ++i)
+        {
+            counter_value const& value = values[i];
+            if (!status_is_valid(value.status_))
+            {
+                continue;
+            }
+
+            counter_path_elements path;
+            error_code ec(throwmode::lightweight);
+            get_counter_path_elements(infos[i].fullname_, path, ec);
+            if (ec)
+            {
+                continue;
+            }
+
+            std::string const name = get_openmetrics_name(path);
+
+            metric_family& family = families[name];
+            family.is_counter =
+                infos[i].type_ == counter_type::monotonically_increasing;
+            family.help = infos[i].helptext_;
+
+            std::string& samples = family.samples;
+            samples += name;
+            if (family.is_counter)
+            {
+                samples += "_total";
+            }
+
+            samples += '{';
+            if (path.parentinstancename_ == "locality")
+            {
+                samples += "locality=\"";
+                samples += std::to_string(path.parentinstanceindex_);
+                samples += "\",";
+            }
+            else if (!path.parentinstancename_.empty())
+            {
+                samples += "parent=\"";
+                append_escaped(samples, path.parentinstancename_);
+                append_index(samples, path.parentinstanceindex_);
+                samples += "\",";
+            }
+
+            samples += "instance=\"";
+            append_escaped(samples, path.instancename_);
+            append_index(samples, path.instanceindex_);
+            if (!path.subinstancename_.empty())
+            {
+                samples += '/';
+                append_escaped(samples, path.subinstancename_);
+                append_index(samples, path.subinstanceindex_);
+            }
+            samples += '"';
+
+            if (!path.parameters_.empty())
+            {
+                samples += ",parameters=\"";
+                append_escaped(samples, path.parameters_);
+                samples += '"';
+            }
+            samples += "} ";
+
+            append_value(samples, value);
+            samples += '\n';
+        }
+
+        std::string result;
+        for (auto const& family : families)
+        {
+            result += "# TYPE ";
+            result += family.first;
+            result += family.second.is_counter ? " counter\n" : " gauge\n";
+            if (!family.second.help.empty())
+            {
+                result += "# HELP ";
+                result += family.first;
+                result += ' ';
+                append_escaped(result, family.second.help);
+                result += '\n';
+            }
+            result += family.second.samples;
+        }
+        result += "# EOF\n";
+        return result;
+    }
+}}}    // namespace hpx::performance_counters::prometheus
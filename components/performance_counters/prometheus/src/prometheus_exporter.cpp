@@ -0,0 +1,353 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/async_base/launch_policy.hpp>
+#include <hpx/components_base/component_startup_shutdown.hpp>
+#include <hpx/modules/asio.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/modules/io_service.hpp>
+#include <hpx/modules/string_util.hpp>
+#include <hpx/performance_counters/counters.hpp>
+#include <hpx/performance_counters/performance_counter_set.hpp>
+#include <hpx/runtime_configuration/component_factory_base.hpp>
+#include <hpx/runtime_local/config_entry.hpp>
+#include <hpx/runtime_local/get_locality_id.hpp>
+#include <hpx/runtime_local/run_as_hpx_thread.hpp>
+#include <hpx/runtime_local/shutdown_function.hpp>
+#include <hpx/runtime_local/startup_function.hpp>
+#include <hpx/util/from_string.hpp>
+
+#include <hpx/components/performance_counters/prometheus/openmetrics.hpp>
+
+#include <asio/buffer.hpp>
+#include <asio/io_context.hpp>
+#include <asio/ip/tcp.hpp>
+#include <asio/read_until.hpp>
+#include <asio/streambuf.hpp>
+#include <asio/write.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <istream>
+#include <memory>
+#include <string>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// Add factory registration functionality, We register the module dynamically
+// as no executable links against it.
+HPX_REGISTER_COMPONENT_MODULE_DYNAMIC()
+
+///////////////////////////////////////////////////////////////////////////////
+// The exporter serves the values of a set of performance counters in the
+// OpenMetrics text format at http://<address>:<port>/metrics. It is enabled
+// on locality 0 by setting hpx.prometheus.port, the exported counters are
+// given by hpx.prometheus.counters (a comma separated list of counter
+// names, possibly containing wildcards).
+//
+// The HTTP connections are handled on a dedicated OS thread. A scrape
+// evaluates all counters in one batch on a single HPX thread, the response
+// is formatted on the exporter's thread.
+namespace hpx { namespace performance_counters { namespace prometheus {
+
+    namespace {
+        char const* const default_counters =
+            "/threads{locality#*/total}/count/cumulative,"
+            "/threads{locality#*/total}/count/instantaneous/all,"
+            "/runtime{locality#*/total}/uptime";
+
+        // the size of the request header which is accepted at most
+        constexpr std::size_t max_request_size = 8192;
+
+        class exporter;
+
+        ///////////////////////////////////////////////////////////////////////
+        class connection : public std::enable_shared_from_this<connection>
+        {
+        public:
+            connection(asio::io_context& io_service, exporter& e)
+              : socket_(io_service)
+              , request_(max_request_size)
+              , exporter_(e)
+            {
+            }
+
+            asio::ip::tcp::socket& socket() noexcept
+            {
+                return socket_;
+            }
+
+            void start()
+            {
+                asio::async_read_until(socket_, request_, "\r\n\r\n",
+                    [self = shared_from_this()](
+                        std::error_code const& ec, std::size_t) {
+                        if (!ec)
+                        {
+                            self->handle_request();
+                        }
+                    });
+            }
+
+        private:
+            void handle_request();
+
+            void respond(char const* status, std::string const& content_type,
+                std::string const& body, bool include_body = true)
+            {
+                response_ = "HTTP/1.1 ";
+                response_ += status;
+                response_ += "\r\nContent-Type: ";
+                response_ += content_type;
+                response_ += "\r\nContent-Length: ";
+                response_ += std::to_string(body.size());
+                response_ += "\r\nConnection: close\r\n\r\n";
+                if (include_body)
+                {
+                    response_ += body;
+                }
+
+                asio::async_write(socket_, asio::buffer(response_),
+                    [self = shared_from_this()](
+                        std::error_code const&, std::size_t) {
+                        std::error_code ec;
+                        self->socket_.shutdown(
+                            asio::ip::tcp::socket::shutdown_both, ec);
+                    });
+            }
+
+            asio::ip::tcp::socket socket_;
+            asio::streambuf request_;
+            std::string response_;
+            exporter& exporter_;
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        class exporter
+        {
+        public:
+            exporter(std::string const& address, std::uint16_t port,
+                std::vector<std::string> const& names)
+              : counters_(names)
+              , infos_(counters_.get_counter_infos())
+              , io_service_pool_(1, threads::policies::callback_notifier(),
+                    "prometheus_exporter")
+              , acceptor_(io_service_pool_.get_io_service())
+            {
+                asio::io_context& io_service =
+                    io_service_pool_.get_io_service();
+
+                std::string errors;
+                util::endpoint_iterator_type const end = util::accept_end();
+                for (util::endpoint_iterator_type it =
+                         util::accept_begin(address, port, io_service);
+                     it != end; ++it)
+                {
+                    try
+                    {
+                        asio::ip::tcp::endpoint ep = *it;
+                        acceptor_.open(ep.protocol());
+                        acceptor_.set_option(
+                            asio::ip::tcp::acceptor::reuse_address(true));
+                        acceptor_.bind(ep);
+                        acceptor_.listen();
+
+                        accept();
+                        io_service_pool_.run(false);
+                        return;
+                    }
+                    catch (std::system_error const& e)
+                    {
+                        std::error_code ec;
+                        acceptor_.close(ec);
+                        errors += e.what();
+                        errors += '\n';
+                    }
+                }
+
+                HPX_THROW_EXCEPTION(network_error,
+                    "prometheus::exporter::exporter",
+                    "could not listen on {}:{} for prometheus scrapes: {}",
+                    address, port, errors);
+            }
+
+            ~exporter()
+            {
+                // waits for a scrape which is in progress
+                io_service_pool_.stop();
+                io_service_pool_.join();
+
+                std::error_code ec;
+                acceptor_.close(ec);
+
+                counters_.release();
+            }
+
+            // evaluates all counters, called on the exporter's thread
+            std::string scrape()
+            {
+                std::vector<counter_value> const values =
+                    threads::run_as_hpx_thread([this]() {
+                        return counters_.get_counter_values(hpx::launch::sync);
+                    });
+                return format_openmetrics(infos_, values);
+            }
+
+        private:
+            void accept()
+            {
+                auto conn = std::make_shared<connection>(
+                    io_service_pool_.get_io_service(), *this);
+                acceptor_.async_accept(
+                    conn->socket(), [this, conn](std::error_code const& ec) {
+                        if (ec == asio::error::operation_aborted)
+                        {
+                            return;    // the exporter is being stopped
+                        }
+                        if (!ec)
+                        {
+                            conn->start();
+                        }
+                        accept();
+                    });
+            }
+
+            performance_counter_set counters_;
+            std::vector<counter_info> const infos_;
+            util::io_service_pool io_service_pool_;
+            asio::ip::tcp::acceptor acceptor_;
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        void connection::handle_request()
+        {
+            // the request line is "<method> <target> HTTP/<version>"
+            std::istream in(&request_);
+            std::string method, target;
+            in >> method >> target;
+
+            std::string::size_type const query = target.find('?');
+            if (query != std::string::npos)
+            {
+                target.erase(query);
+            }
+
+            char const* const text_plain = "text/plain; charset=utf-8";
+            if (method != "GET" && method != "HEAD")
+            {
+                respond("405 Method Not Allowed", text_plain,
+                    "only GET requests are supported\n");
+                return;
+            }
+            if (target != "/metrics")
+            {
+                respond("404 Not Found", text_plain,
+                    "the metrics are served at /metrics\n");
+                return;
+            }
+
+            try
+            {
+                respond("200 OK",
+                    "application/openmetrics-text; version=1.0.0; "
+                    "charset=utf-8",
+                    exporter_.scrape(), method == "GET");
+            }
+            catch (std::exception const& e)
+            {
+                respond("500 Internal Server Error", text_plain,
+                    std::string(e.what()) + "\n");
+            }
+        }
+
+        std::unique_ptr<exporter>& get_exporter()
+        {
+            static std::unique_ptr<exporter> instance;
+            return instance;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        void start_exporter()
+        {
+            // the counters of all localities are exported by locality 0
+            if (hpx::get_locality_id() != 0)
+            {
+                return;
+            }
+
+            std::string const port =
+                get_config_entry("hpx.prometheus.port", "");
+            std::string const address =
+                get_config_entry("hpx.prometheus.address", "0.0.0.0");
+            std::string const counters =
+                get_config_entry("hpx.prometheus.counters", default_counters);
+
+            std::vector<std::string> names;
+            hpx::string_util::split(names, counters,
+                hpx::string_util::is_any_of(","),
+                hpx::string_util::token_compress_mode::on);
+            for (std::string& name : names)
+            {
+                hpx::string_util::trim(name);
+            }
+
+            std::uint16_t const port_number =
+                hpx::util::from_string<std::uint16_t>(port, 0);
+            if (port_number == 0)
+            {
+                HPX_THROW_EXCEPTION(bad_parameter,
+                    "prometheus::start_exporter",
+                    "invalid port given as hpx.prometheus.port: {}", port);
+            }
+
+            get_exporter() =
+                std::make_unique<exporter>(address, port_number, names);
+        }
+
+        void stop_exporter()
+        {
+            get_exporter().reset();
+        }
+    }    // namespace
+
+    ///////////////////////////////////////////////////////////////////////////
+    bool get_startup(
+        hpx::startup_function_type& startup_func, bool& pre_startup)
+    {
+        if (get_config_entry("hpx.prometheus.port", "").empty())
+        {
+            return false;    // the exporter was not enabled
+        }
+
+        // the counters are created once all counter types have been
+        // registered
+        startup_func = start_exporter;
+        pre_startup = false;
+        return true;
+    }
+
+    bool get_shutdown(
+        hpx::shutdown_function_type& shutdown_func, bool& pre_shutdown)
+    {
+        if (get_config_entry("hpx.prometheus.port", "").empty())
+        {
+            return false;
+        }
+
+        shutdown_func = stop_exporter;
+        pre_shutdown = true;
+        return true;
+    }
+}}}    // namespace hpx::performance_counters::prometheus
+
+// register component's startup and shutdown functions
+HPX_REGISTER_STARTUP_SHUTDOWN_MODULE_DYNAMIC(
+    hpx::performance_counters::prometheus::get_startup,
+    hpx::performance_counters::prometheus::get_shutdown)
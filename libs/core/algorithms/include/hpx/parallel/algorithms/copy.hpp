@@ -321,20 +321,15 @@ namespace hpx {
 #include <hpx/parallel/algorithms/detail/distance.hpp>
 #include <hpx/parallel/algorithms/detail/transfer.hpp>
 #include <hpx/parallel/util/detail/algorithm_result.hpp>
-#include <hpx/parallel/util/detail/clear_container.hpp>
+#include <hpx/parallel/util/compact_partitioner.hpp>
 #include <hpx/parallel/util/foreach_partitioner.hpp>
 #include <hpx/parallel/util/loop.hpp>
 #include <hpx/parallel/util/projection_identity.hpp>
 #include <hpx/parallel/util/result_types.hpp>
-#include <hpx/parallel/util/scan_partitioner.hpp>
 #include <hpx/parallel/util/transfer.hpp>
 #include <hpx/parallel/util/zip_iterator.hpp>
 #include <hpx/type_support/unused.hpp>
 
-#if !defined(HPX_HAVE_CXX17_SHARED_PTR_ARRAY)
-#include <boost/shared_array.hpp>
-#endif
-
 #include <algorithm>
 #include <cstddef>
 #include <cstring>
@@ -573,95 +568,59 @@ namespace hpx { namespace parallel { inline namespace v1 {
             parallel(ExPolicy&& policy, FwdIter1 first, FwdIter2 last,
                 FwdIter3 dest, Pred&& pred, Proj&& proj /* = Proj()*/)
             {
-                typedef hpx::util::zip_iterator<FwdIter1, bool*> zip_iterator;
-                typedef util::detail::algorithm_result<ExPolicy,
-                    util::in_out_result<FwdIter1, FwdIter3>>
-                    result;
-                typedef typename std::iterator_traits<FwdIter1>::difference_type
-                    difference_type;
+                using result_type = util::in_out_result<FwdIter1, FwdIter3>;
+                using result =
+                    util::detail::algorithm_result<ExPolicy, result_type>;
 
                 if (first == last)
                 {
-                    return result::get(util::in_out_result<FwdIter1, FwdIter3>{
-                        HPX_MOVE(first), HPX_MOVE(dest)});
+                    return result::get(
+                        result_type{HPX_MOVE(first), HPX_MOVE(dest)});
                 }
 
-                difference_type count = detail::distance(first, last);
-
-#if defined(HPX_HAVE_CXX17_SHARED_PTR_ARRAY)
-                std::shared_ptr<bool[]> flags(new bool[count]);
-#else
-                boost::shared_array<bool> flags(new bool[count]);
-#endif
-                std::size_t init = 0;
-
-                using hpx::get;
-                using hpx::util::make_zip_iterator;
-                typedef util::scan_partitioner<ExPolicy,
-                    util::in_out_result<FwdIter1, FwdIter3>, std::size_t>
-                    scan_partitioner_type;
-
-                auto f1 = [pred = HPX_FORWARD(Pred, pred),
-                              proj = HPX_FORWARD(decltype(proj), proj)](
-                              zip_iterator part_begin,
-                              std::size_t part_size) -> std::size_t {
-                    std::size_t curr = 0;
-
-                    // Note: replacing the invoke() with HPX_INVOKE()
-                    // below makes gcc generate errors
-
-                    // MSVC complains if proj is captured by ref below
-                    util::loop_n<std::decay_t<ExPolicy>>(part_begin, part_size,
-                        [&pred, proj, &curr](zip_iterator it) mutable -> void {
-                            bool f = hpx::util::invoke(
-                                pred, hpx::util::invoke(proj, get<0>(*it)));
-
-                            if ((get<1>(*it) = f))
-                                ++curr;
-                        });
-
-                    return curr;
-                };
-                auto f3 = [dest, flags](zip_iterator part_begin,
-                              std::size_t part_size, std::size_t val) mutable {
-                    HPX_UNUSED(flags);
-                    std::advance(dest, val);
-                    util::loop_n<std::decay_t<ExPolicy>>(part_begin, part_size,
-                        [&dest](zip_iterator it) mutable {
-                            if (get<1>(*it))
-                                *dest++ = get<0>(*it);
-                        });
+                std::size_t count = detail::distance(first, last);
+
+                // step 1 flags the elements to copy
+                auto mark = [pred = HPX_FORWARD(Pred, pred),
+                                proj = HPX_FORWARD(Proj, proj)](
+                                FwdIter1 part_begin, std::size_t part_size,
+                                util::detail::compact_flags_writer& flags) {
+                    for (std::size_t i = 0; i != part_size;
+                         (void) ++part_begin, ++i)
+                    {
+                        flags.push(
+                            HPX_INVOKE(pred, HPX_INVOKE(proj, *part_begin)));
+                    }
                 };
 
-                auto f4 = [first, dest, flags](std::vector<std::size_t>&& items,
-                              std::vector<hpx::future<void>>&& data) mutable
-                    -> util::in_out_result<FwdIter1, FwdIter3> {
-                    HPX_UNUSED(flags);
-
-                    auto dist = items.back();
-                    std::advance(first, dist);
-                    std::advance(dest, dist);
-
-                    // make sure iterators embedded in function object that is
-                    // attached to futures are invalidated
-                    util::detail::clear_container(data);
-
-                    return util::in_out_result<FwdIter1, FwdIter3>{
-                        HPX_MOVE(first), HPX_MOVE(dest)};
+                // step 2 copies the flagged elements of a partition to their
+                // final position
+                auto scatter =
+                    [dest](FwdIter1 part_begin, std::size_t part_size,
+                        std::size_t, std::size_t offset,
+                        util::detail::compact_flags_view const& flags) {
+                        FwdIter3 out = dest;
+                        std::advance(out, offset);
+                        for (std::size_t i = 0; i != part_size;
+                             (void) ++part_begin, ++i)
+                        {
+                            if (flags[i])
+                            {
+                                *out++ = *part_begin;
+                            }
+                        }
+                    };
+
+                auto finalize = [first, dest, count](
+                                    std::size_t total) mutable -> result_type {
+                    std::advance(first, count);
+                    std::advance(dest, total);
+                    return result_type{HPX_MOVE(first), HPX_MOVE(dest)};
                 };
 
-                return scan_partitioner_type::call(
-                    HPX_FORWARD(ExPolicy, policy),
-                    make_zip_iterator(first, flags.get()), count, init,
-                    // step 1 performs first part of scan algorithm
-                    HPX_MOVE(f1),
-                    // step 2 propagates the partition results from left
-                    // to right
-                    std::plus<std::size_t>(),
-                    // step 3 runs final accumulation on each partition
-                    HPX_MOVE(f3),
-                    // step 4 use this return value
-                    HPX_MOVE(f4));
+                return util::compact_partitioner<ExPolicy, result_type>::call(
+                    HPX_FORWARD(ExPolicy, policy), first, count, HPX_MOVE(mark),
+                    HPX_MOVE(scatter), HPX_MOVE(finalize));
             }
         };
     }    // namespace detail
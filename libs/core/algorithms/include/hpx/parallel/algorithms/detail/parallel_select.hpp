@@ -0,0 +1,189 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/execution/executors/execution.hpp>
+#include <hpx/execution/executors/execution_information.hpp>
+#include <hpx/executors/execution_policy.hpp>
+#include <hpx/functional/invoke.hpp>
+#include <hpx/iterator_support/counting_shape.hpp>
+#include <hpx/parallel/algorithms/partition.hpp>
+#include <hpx/parallel/util/projection_identity.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace parallel { inline namespace v1 { namespace detail {
+
+    /// \cond NOINTERNAL
+
+    // Ranges with fewer elements than this are handled sequentially.
+    inline constexpr std::size_t parallel_select_limit = 32768;
+
+    // Number of elements sampled to select the pivots, and distance of both
+    // pivots from the expected rank of the nth element in the sorted sample.
+    inline constexpr std::size_t parallel_select_sample_size = 1024;
+    inline constexpr std::size_t parallel_select_sample_delta = 32;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Rearrange [first, last) such that nth refers to the element which
+    // would occur there if the range was sorted, with all elements before
+    // nth not greater and all elements after nth not less than it.
+    //
+    // Two pivots bracketing the expected rank of nth are taken from a sorted
+    // sample. A three-way partition (two parallel partition steps) splits
+    // the range into the elements less than the lower pivot, the elements
+    // between both pivots, and the elements greater than the upper pivot.
+    // Only the part containing nth is processed further, which usually is a
+    // small fraction of the range.
+    template <typename ExPolicy, typename RandomIt, typename Comp>
+    void parallel_select(ExPolicy&& policy, RandomIt first, RandomIt nth,
+        RandomIt last, Comp&& comp)
+    {
+        using value_type = typename std::iterator_traits<RandomIt>::value_type;
+
+        HPX_ASSERT(first <= nth && nth < last);
+
+        std::vector<RandomIt> sample;
+        sample.reserve(parallel_select_sample_size);
+
+        while (std::size_t(last - first) > parallel_select_limit)
+        {
+            std::size_t const count = last - first;
+            std::size_t const stride = count / parallel_select_sample_size;
+
+            sample.clear();
+            for (std::size_t i = 0; i != parallel_select_sample_size; ++i)
+            {
+                sample.push_back(first + i * stride + stride / 2);
+            }
+            std::sort(sample.begin(), sample.end(),
+                [&comp](RandomIt const& lhs, RandomIt const& rhs) {
+                    return HPX_INVOKE(comp, *lhs, *rhs);
+                });
+
+            std::size_t const rank = std::size_t(nth - first) *
+                parallel_select_sample_size / count;
+            value_type const lower =
+                *sample[rank > parallel_select_sample_delta ?
+                        rank - parallel_select_sample_delta :
+                        0];
+            value_type const upper = *sample[(std::min)(
+                rank + parallel_select_sample_delta, sample.size() - 1)];
+
+            // [first, lower_end) holds the elements less than lower
+            RandomIt const lower_end = detail::partition<RandomIt>().call(
+                policy(hpx::execution::non_task), first, last,
+                [&comp, &lower](value_type const& value) {
+                    return HPX_INVOKE(comp, value, lower);
+                },
+                util::projection_identity());
+
+            if (nth < lower_end)
+            {
+                last = lower_end;
+                continue;
+            }
+
+            // [lower_end, upper_end) holds the elements in [lower, upper]
+            RandomIt const upper_end = detail::partition<RandomIt>().call(
+                policy(hpx::execution::non_task), lower_end, last,
+                [&comp, &upper](value_type const& value) {
+                    return !HPX_INVOKE(comp, upper, value);
+                },
+                util::projection_identity());
+
+            if (nth >= upper_end)
+            {
+                first = upper_end;
+                continue;
+            }
+
+            // all elements between both pivots are equivalent
+            if (!HPX_INVOKE(comp, lower, upper))
+            {
+                return;
+            }
+
+            // the pivots did not narrow the range down
+            if (std::size_t(upper_end - lower_end) == count)
+            {
+                break;
+            }
+
+            first = lower_end;
+            last = upper_end;
+        }
+
+        std::nth_element(first, nth, last, comp);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Move the nmid smallest of the nelem elements starting at first to the
+    // beginning of the range, sorted. Every chunk of the input selects its
+    // own nmid smallest elements using a max heap, the candidates of all
+    // chunks are then gathered at the front of the range and partially
+    // sorted. This requires the candidates of all chunks to fit into the
+    // first chunk.
+    template <typename ExPolicy, typename RandomIt, typename Comp>
+    void parallel_partial_sort_top_k(ExPolicy&& policy, RandomIt first,
+        std::size_t nmid, std::size_t nelem, std::size_t num_chunks,
+        Comp&& comp)
+    {
+        std::size_t const chunk_size = (nelem + num_chunks - 1) / num_chunks;
+        HPX_ASSERT(nmid * num_chunks <= chunk_size);
+
+        auto chunk_begin = [=](std::size_t k) {
+            return (std::min)(k * chunk_size, nelem);
+        };
+        auto candidates = [=](std::size_t k) {
+            return (std::min)(nmid, chunk_begin(k + 1) - chunk_begin(k));
+        };
+
+        execution::bulk_sync_execute(
+            policy.executor(),
+            [&](std::size_t k) {
+                RandomIt const begin = first + chunk_begin(k);
+                RandomIt const end = first + chunk_begin(k + 1);
+                RandomIt const heap_end = begin + candidates(k);
+
+                // the largest candidate of the chunk is at the top
+                std::make_heap(begin, heap_end, comp);
+                for (RandomIt it = heap_end; it < end; ++it)
+                {
+                    if (HPX_INVOKE(comp, *it, *begin))
+                    {
+                        std::pop_heap(begin, heap_end, comp);
+#if defined(HPX_HAVE_CXX20_STD_RANGES_ITER_SWAP)
+                        std::ranges::iter_swap(heap_end - 1, it);
+#else
+                        std::iter_swap(heap_end - 1, it);
+#endif
+                        std::push_heap(begin, heap_end, comp);
+                    }
+                }
+            },
+            hpx::util::detail::make_counting_shape(num_chunks));
+
+        // the candidates of the first chunk are in place already
+        RandomIt dest = first + candidates(0);
+        for (std::size_t k = 1; k != num_chunks; ++k)
+        {
+            RandomIt const begin = first + chunk_begin(k);
+            dest = std::swap_ranges(begin, begin + candidates(k), dest);
+        }
+
+        std::partial_sort(first, first + nmid, dest, comp);
+    }
+
+    /// \endcond
+}}}}    // namespace hpx::parallel::v1::detail
@@ -11,9 +11,14 @@
 #include <hpx/execution/executors/execution.hpp>
 #include <hpx/execution/executors/execution_information.hpp>
 #include <hpx/executors/exception_list.hpp>
+#include <hpx/iterator_support/counting_shape.hpp>
 #include <hpx/parallel/algorithms/detail/sample_sort.hpp>
+#include <hpx/parallel/algorithms/merge.hpp>
 #include <hpx/parallel/util/detail/algorithm_result.hpp>
+#include <hpx/parallel/util/low_level.hpp>
+#include <hpx/parallel/util/projection_identity.hpp>
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
 #include <cstdlib>
@@ -101,20 +106,24 @@ namespace hpx { namespace parallel { inline namespace v1 { namespace detail {
                 return last;
             }
 
+            // If the elements can be moved without throwing, both sorted
+            // halves are moved to the buffer and merged back into the range
+            // in parallel. Otherwise only the first half is moved and the
+            // halves are merged sequentially.
+            constexpr bool merge_parallel =
+                std::is_nothrow_move_constructible_v<value_type>;
+            std::size_t const nbuffer = merge_parallel ? nelem : nptr;
+
             // leave memory uninitialized, sample_sort will manage construction
             // etc.
             ptr = static_cast<value_type*>(
-                std::malloc(sizeof(value_type) * nptr));
+                std::malloc(sizeof(value_type) * nbuffer));
             if (ptr == nullptr)
             {
                 throw std::bad_alloc();
             }
 
             // Parallel Process
-            util::range<Iter, Sent> range_first(
-                range_initial.begin(), range_initial.begin() + nptr);
-            util::range<Iter, Sent> range_second(
-                range_initial.begin() + nptr, range_initial.end());
             util::range<value_type*> range_buffer(ptr, ptr + nptr);
 
             sample_sort(exec, range_initial.begin(),
@@ -124,9 +133,56 @@ namespace hpx { namespace parallel { inline namespace v1 { namespace detail {
             sample_sort(exec, range_initial.begin() + nptr, range_initial.end(),
                 comp, nthreads, range_buffer, chunk_size);
 
-            range_buffer = parallel::util::init_move(range_buffer, range_first);
-            range_initial = parallel::util::half_merge(
-                range_initial, range_buffer, range_second, comp);
+            if constexpr (merge_parallel)
+            {
+                Iter first = range_initial.begin();
+                auto chunk_begin = [&](std::size_t k) {
+                    return nelem / nthreads * k +
+                        (std::min)(k, std::size_t(nelem % nthreads));
+                };
+
+                execution::bulk_sync_execute(
+                    exec,
+                    [&](std::size_t k) {
+                        parallel::util::uninit_move(ptr + chunk_begin(k),
+                            first + chunk_begin(k), first + chunk_begin(k + 1));
+                    },
+                    hpx::util::detail::make_counting_shape(nthreads));
+
+                // the merge partitions do not overlap, neither in the buffer
+                // nor in the destination range
+                parallel_merge_path(exec, ptr, nptr, ptr + nptr, nelem - nptr,
+                    first, nthreads, comp, util::projection_identity{},
+                    util::projection_identity{},
+                    [this](value_type* first1, value_type* last1,
+                        value_type* first2, value_type* last2, Iter dest) {
+                        parallel::util::full_merge(
+                            first1, last1, first2, last2, dest, comp);
+                    });
+
+                if constexpr (!std::is_trivially_destructible_v<value_type>)
+                {
+                    execution::bulk_sync_execute(
+                        exec,
+                        [&](std::size_t k) {
+                            parallel::util::destroy(ptr + chunk_begin(k),
+                                ptr + chunk_begin(k + 1));
+                        },
+                        hpx::util::detail::make_counting_shape(nthreads));
+                }
+            }
+            else
+            {
+                util::range<Iter, Sent> range_first(
+                    range_initial.begin(), range_initial.begin() + nptr);
+                util::range<Iter, Sent> range_second(
+                    range_initial.begin() + nptr, range_initial.end());
+
+                range_buffer =
+                    parallel::util::init_move(range_buffer, range_first);
+                range_initial = parallel::util::half_merge(
+                    range_initial, range_buffer, range_second, comp);
+            }
 
             return last;
         }
@@ -0,0 +1,352 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/execution/algorithms/detail/predicates.hpp>
+#include <hpx/execution/executors/execution.hpp>
+#include <hpx/execution/executors/execution_information.hpp>
+#include <hpx/execution/traits/is_execution_policy.hpp>
+#include <hpx/executors/execution_policy.hpp>
+#include <hpx/iterator_support/counting_shape.hpp>
+#include <hpx/parallel/util/projection_identity.hpp>
+
+#include <algorithm>
+#include <array>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace parallel { inline namespace v1 { namespace detail {
+
+    /// \cond NOINTERNAL
+
+    // Sorting fewer elements than this is left to the comparison based sort.
+    inline constexpr std::size_t radix_sort_limit = 65536;
+
+    // Minimal number of elements handled by one chunk of the histogram and
+    // scatter steps.
+    inline constexpr std::size_t radix_sort_min_chunk_size = 16384;
+
+    inline constexpr std::size_t radix_bits = 8;
+    inline constexpr std::size_t radix_buckets = std::size_t(1) << radix_bits;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Map keys onto unsigned integers of the same size preserving the order
+    // induced by operator<.
+    template <typename T, typename Enable = void>
+    struct radix_key_traits
+    {
+        static constexpr bool is_sortable = false;
+    };
+
+    template <typename T>
+    struct radix_key_traits<T,
+        std::enable_if_t<std::is_integral_v<T> && !std::is_same_v<T, bool>>>
+    {
+        static constexpr bool is_sortable = true;
+
+        using bits_type = std::make_unsigned_t<T>;
+
+        static constexpr bits_type to_bits(T value) noexcept
+        {
+            if constexpr (std::is_signed_v<T>)
+            {
+                // flip the sign bit
+                return static_cast<bits_type>(static_cast<bits_type>(value) ^
+                    (bits_type(1) << (sizeof(T) * CHAR_BIT - 1)));
+            }
+            else
+            {
+                return value;
+            }
+        }
+    };
+
+    template <typename T>
+    struct radix_key_traits<T,
+        std::enable_if_t<std::is_floating_point_v<T> &&
+            std::numeric_limits<T>::is_iec559 &&
+            (sizeof(T) == sizeof(std::uint32_t) ||
+                sizeof(T) == sizeof(std::uint64_t))>>
+    {
+        static constexpr bool is_sortable = true;
+
+        using bits_type = std::conditional_t<sizeof(T) == sizeof(std::uint32_t),
+            std::uint32_t, std::uint64_t>;
+
+        static bits_type to_bits(T value) noexcept
+        {
+            bits_type bits;
+            std::memcpy(&bits, &value, sizeof(T));
+
+            // flip all bits of negative values, flip the sign bit of all
+            // other values
+            constexpr bits_type sign_bit = bits_type(1)
+                << (sizeof(T) * CHAR_BIT - 1);
+            return bits ^ ((bits & sign_bit) ? ~bits_type(0) : sign_bit);
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Comp, typename Key>
+    inline constexpr bool is_radix_less_v =
+        std::is_same_v<Comp, detail::less> ||
+        std::is_same_v<Comp, std::less<>> ||
+        std::is_same_v<Comp, std::less<Key>>;
+
+    // A range can be sorted using radix_sort if its elements are arithmetic
+    // keys accessed directly (no proxy references) and the default ascending
+    // order is requested.
+    template <typename ExPolicy, typename Iter, typename Comp,
+        typename Proj = util::projection_identity>
+    inline constexpr bool use_radix_sort_v =
+        hpx::is_parallel_execution_policy_v<std::decay_t<ExPolicy>> &&
+        radix_key_traits<
+            typename std::iterator_traits<Iter>::value_type>::is_sortable &&
+        std::is_same_v<typename std::iterator_traits<Iter>::reference,
+            typename std::iterator_traits<Iter>::value_type&> &&
+        is_radix_less_v<std::decay_t<Comp>,
+            typename std::iterator_traits<Iter>::value_type> &&
+        std::is_same_v<std::decay_t<Proj>, util::projection_identity>;
+
+    // used as the value iterator if only keys are sorted
+    struct radix_no_values
+    {
+    };
+
+    template <typename ValueIter>
+    struct radix_value_type
+    {
+        using type = typename std::iterator_traits<ValueIter>::value_type;
+    };
+
+    template <>
+    struct radix_value_type<radix_no_values>
+    {
+        using type = radix_no_values;
+    };
+
+    template <typename ValueIter>
+    inline constexpr bool can_radix_sort_values_v =
+        std::is_same_v<ValueIter, radix_no_values> ||
+        (std::is_default_constructible_v<
+             typename radix_value_type<ValueIter>::type> &&
+            std::is_move_assignable_v<
+                typename radix_value_type<ValueIter>::type>);
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Scatter the elements of one chunk into their buckets. The elements are
+    // first collected in small per-bucket buffers which are written to their
+    // destination one cache line at a time (software write-combining).
+    template <typename Traits, typename KeySrc, typename ValueSrc,
+        typename KeyDst, typename ValueDst, typename Key, typename Value>
+    void radix_scatter_chunk(KeySrc keys, ValueSrc values, std::size_t begin,
+        std::size_t end, KeyDst key_dst, ValueDst value_dst,
+        std::size_t* offsets, std::size_t shift, Key* key_buffer,
+        Value* value_buffer)
+    {
+        constexpr bool has_values = !std::is_same_v<Value, radix_no_values>;
+        constexpr std::size_t buffer_size =
+            (std::max)(std::size_t(64) / sizeof(Key), std::size_t(4));
+
+        std::array<std::uint8_t, radix_buckets> fill{};
+
+        auto flush = [&](std::size_t bucket, std::size_t n) {
+            Key* kb = key_buffer + bucket * buffer_size;
+            std::size_t const offset = offsets[bucket];
+            for (std::size_t j = 0; j != n; ++j)
+            {
+                key_dst[offset + j] = kb[j];
+            }
+            if constexpr (has_values)
+            {
+                Value* vb = value_buffer + bucket * buffer_size;
+                for (std::size_t j = 0; j != n; ++j)
+                {
+                    value_dst[offset + j] = HPX_MOVE(vb[j]);
+                }
+            }
+            offsets[bucket] += n;
+        };
+
+        for (std::size_t i = begin; i != end; ++i)
+        {
+            Key key = keys[i];
+            std::size_t const bucket =
+                (Traits::to_bits(key) >> shift) & (radix_buckets - 1);
+
+            std::size_t const pos = bucket * buffer_size + fill[bucket];
+            key_buffer[pos] = key;
+            if constexpr (has_values)
+            {
+                value_buffer[pos] = HPX_MOVE(values[i]);
+            }
+
+            if (++fill[bucket] == buffer_size)
+            {
+                flush(bucket, buffer_size);
+                fill[bucket] = 0;
+            }
+        }
+
+        for (std::size_t bucket = 0; bucket != radix_buckets; ++bucket)
+        {
+            flush(bucket, fill[bucket]);
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Sort count keys starting at first (and the corresponding values
+    // starting at values, if given) using a parallel LSD radix sort. Each
+    // pass computes per-chunk histograms for the current digit, derives the
+    // destination offsets of every chunk and bucket, and scatters the
+    // elements into a temporary buffer. Passes for which all keys have the
+    // same digit are skipped.
+    template <typename ExPolicy, typename KeyIter, typename ValueIter>
+    void parallel_radix_sort(
+        ExPolicy&& policy, KeyIter first, std::size_t count, ValueIter values)
+    {
+        using key_type = typename std::iterator_traits<KeyIter>::value_type;
+        using value_type = typename radix_value_type<ValueIter>::type;
+        using traits = radix_key_traits<key_type>;
+
+        constexpr bool has_values =
+            !std::is_same_v<ValueIter, radix_no_values>;
+        constexpr std::size_t num_passes = sizeof(key_type);
+        constexpr std::size_t buffer_size =
+            (std::max)(std::size_t(64) / sizeof(key_type), std::size_t(4));
+
+        if (count < 2)
+        {
+            return;
+        }
+
+        std::size_t const cores = execution::processing_units_count(
+            policy.parameters(), policy.executor());
+        std::size_t const num_chunks = (std::max)(std::size_t(1),
+            (std::min)(cores, count / radix_sort_min_chunk_size));
+        std::size_t const chunk_size = (count + num_chunks - 1) / num_chunks;
+
+        auto chunk_begin = [=](std::size_t k) {
+            return (std::min)(k * chunk_size, count);
+        };
+
+        // default initialized temporary storage
+        std::unique_ptr<key_type[]> key_tmp(new key_type[count]);
+        std::unique_ptr<value_type[]> value_tmp(
+            has_values ? new value_type[count] : nullptr);
+
+        std::vector<std::size_t> histograms(num_chunks * radix_buckets);
+        auto shape = hpx::util::detail::make_counting_shape(num_chunks);
+
+        auto run_pass = [&](auto keys, auto vals, auto key_dst,
+                            auto value_dst, std::size_t shift) -> bool {
+            // per-chunk histograms
+            std::fill(histograms.begin(), histograms.end(), std::size_t(0));
+            execution::bulk_sync_execute(
+                policy.executor(),
+                [&](std::size_t k) {
+                    std::size_t* hist = histograms.data() + k * radix_buckets;
+                    std::size_t const end = chunk_begin(k + 1);
+                    for (std::size_t i = chunk_begin(k); i != end; ++i)
+                    {
+                        ++hist[(traits::to_bits(keys[i]) >> shift) &
+                            (radix_buckets - 1)];
+                    }
+                },
+                shape);
+
+            // Exclusive prefix over (bucket, chunk), the destination of the
+            // elements of chunk k in bucket b follows the elements of all
+            // smaller buckets and of bucket b in all preceding chunks.
+            std::size_t sum = 0;
+            for (std::size_t b = 0; b != radix_buckets; ++b)
+            {
+                std::size_t const bucket_begin = sum;
+                for (std::size_t k = 0; k != num_chunks; ++k)
+                {
+                    std::size_t& h = histograms[k * radix_buckets + b];
+                    std::size_t const n = h;
+                    h = sum;
+                    sum += n;
+                }
+
+                // all keys have the same digit, nothing to do
+                if (sum - bucket_begin == count)
+                {
+                    return false;
+                }
+            }
+            HPX_ASSERT(sum == count);
+
+            execution::bulk_sync_execute(
+                policy.executor(),
+                [&](std::size_t k) {
+                    std::unique_ptr<key_type[]> key_buffer(
+                        new key_type[radix_buckets * buffer_size]);
+                    std::unique_ptr<value_type[]> value_buffer(has_values ?
+                            new value_type[radix_buckets * buffer_size] :
+                            nullptr);
+
+                    radix_scatter_chunk<traits>(keys, vals, chunk_begin(k),
+                        chunk_begin(k + 1), key_dst, value_dst,
+                        histograms.data() + k * radix_buckets, shift,
+                        key_buffer.get(), value_buffer.get());
+                },
+                shape);
+            return true;
+        };
+
+        // the sorted sequence alternates between the input range and the
+        // temporary storage
+        bool in_tmp = false;
+        for (std::size_t pass = 0; pass != num_passes; ++pass)
+        {
+            std::size_t const shift = pass * radix_bits;
+            if (!in_tmp)
+            {
+                in_tmp = run_pass(
+                    first, values, key_tmp.get(), value_tmp.get(), shift);
+            }
+            else
+            {
+                in_tmp = !run_pass(
+                    key_tmp.get(), value_tmp.get(), first, values, shift);
+            }
+        }
+
+        if (in_tmp)
+        {
+            execution::bulk_sync_execute(
+                policy.executor(),
+                [&](std::size_t k) {
+                    std::size_t const end = chunk_begin(k + 1);
+                    for (std::size_t i = chunk_begin(k); i != end; ++i)
+                    {
+                        first[i] = key_tmp[i];
+                        if constexpr (has_values)
+                        {
+                            values[i] = HPX_MOVE(value_tmp[i]);
+                        }
+                    }
+                },
+                shape);
+        }
+    }
+
+    /// \endcond
+}}}}    // namespace hpx::parallel::v1::detail
@@ -0,0 +1,108 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/functional/detail/tag_fallback_invoke.hpp>
+#include <hpx/functional/invoke.hpp>
+
+#include <cstddef>
+#include <utility>
+
+namespace hpx { namespace parallel { inline namespace v1 { namespace detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Iter, typename T1, typename T2, typename Proj>
+    constexpr Iter sequential_replace_helper(Iter first, std::size_t count,
+        T1 const& old_value, T2 const& new_value, Proj&& proj)
+    {
+        for (/* */; count != 0; (void) ++first, --count)
+        {
+            if (HPX_INVOKE(proj, *first) == old_value)
+            {
+                *first = new_value;
+            }
+        }
+        return first;
+    }
+
+    struct sequential_replace_t
+      : hpx::functional::detail::tag_fallback<sequential_replace_t>
+    {
+    private:
+        template <typename ExPolicy, typename Iter, typename T1, typename T2,
+            typename Proj>
+        friend constexpr Iter tag_fallback_invoke(sequential_replace_t,
+            ExPolicy&&, Iter first, std::size_t count, T1 const& old_value,
+            T2 const& new_value, Proj&& proj)
+        {
+            return sequential_replace_helper(first, count, old_value,
+                new_value, HPX_FORWARD(Proj, proj));
+        }
+    };
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+    inline constexpr sequential_replace_t sequential_replace =
+        sequential_replace_t{};
+#else
+    template <typename ExPolicy, typename Iter, typename T1, typename T2,
+        typename Proj>
+    HPX_HOST_DEVICE HPX_FORCEINLINE Iter sequential_replace(ExPolicy&& policy,
+        Iter first, std::size_t count, T1 const& old_value,
+        T2 const& new_value, Proj&& proj)
+    {
+        return sequential_replace_t{}(HPX_FORWARD(ExPolicy, policy), first,
+            count, old_value, new_value, HPX_FORWARD(Proj, proj));
+    }
+#endif
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Iter, typename F, typename T, typename Proj>
+    constexpr Iter sequential_replace_if_helper(Iter first, std::size_t count,
+        F&& f, T const& new_value, Proj&& proj)
+    {
+        for (/* */; count != 0; (void) ++first, --count)
+        {
+            if (HPX_INVOKE(f, HPX_INVOKE(proj, *first)))
+            {
+                *first = new_value;
+            }
+        }
+        return first;
+    }
+
+    struct sequential_replace_if_t
+      : hpx::functional::detail::tag_fallback<sequential_replace_if_t>
+    {
+    private:
+        template <typename ExPolicy, typename Iter, typename F, typename T,
+            typename Proj>
+        friend constexpr Iter tag_fallback_invoke(sequential_replace_if_t,
+            ExPolicy&&, Iter first, std::size_t count, F&& f,
+            T const& new_value, Proj&& proj)
+        {
+            return sequential_replace_if_helper(first, count,
+                HPX_FORWARD(F, f), new_value, HPX_FORWARD(Proj, proj));
+        }
+    };
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+    inline constexpr sequential_replace_if_t sequential_replace_if =
+        sequential_replace_if_t{};
+#else
+    template <typename ExPolicy, typename Iter, typename F, typename T,
+        typename Proj>
+    HPX_HOST_DEVICE HPX_FORCEINLINE Iter sequential_replace_if(
+        ExPolicy&& policy, Iter first, std::size_t count, F&& f,
+        T const& new_value, Proj&& proj)
+    {
+        return sequential_replace_if_t{}(HPX_FORWARD(ExPolicy, policy), first,
+            count, HPX_FORWARD(F, f), new_value, HPX_FORWARD(Proj, proj));
+    }
+#endif
+
+}}}}    // namespace hpx::parallel::v1::detail
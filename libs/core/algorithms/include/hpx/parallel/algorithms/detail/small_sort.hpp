@@ -0,0 +1,158 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/execution/algorithms/detail/predicates.hpp>
+#include <hpx/parallel/algorithms/detail/insertion_sort.hpp>
+#include <hpx/parallel/util/compare_projected.hpp>
+#include <hpx/parallel/util/projection_identity.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+
+namespace hpx { namespace parallel { inline namespace v1 { namespace detail {
+
+    /// \cond NOINTERNAL
+
+    // Ranges with at most this many elements are sorted using the sorting
+    // network.
+    inline constexpr std::size_t sorting_network_limit = 64;
+
+    template <typename Compare, typename T>
+    struct is_sorting_network_less
+      : std::integral_constant<bool,
+            std::is_same_v<Compare, detail::less> ||
+                std::is_same_v<Compare, std::less<>> ||
+                std::is_same_v<Compare, std::less<T>>>
+    {
+    };
+
+    template <typename Compare, typename Proj, typename T>
+    struct is_sorting_network_less<util::compare_projected<Compare, Proj>, T>
+      : std::integral_constant<bool,
+            std::is_same_v<std::decay_t<Proj>, util::projection_identity> &&
+                is_sorting_network_less<std::decay_t<Compare>, T>::value>
+    {
+    };
+
+    // Sorting networks do not preserve the order of equivalent elements. For
+    // integral keys compared using operator< equivalent elements are
+    // indistinguishable, which makes the network usable by the stable sorts.
+    template <typename Iter, typename Compare>
+    inline constexpr bool use_sorting_network_v =
+        std::is_integral_v<typename std::iterator_traits<Iter>::value_type> &&
+        !std::is_same_v<typename std::iterator_traits<Iter>::value_type,
+            bool> &&
+        std::is_same_v<typename std::iterator_traits<Iter>::reference,
+            typename std::iterator_traits<Iter>::value_type&> &&
+        is_sorting_network_less<std::decay_t<Compare>,
+            typename std::iterator_traits<Iter>::value_type>::value;
+
+    template <typename T>
+    HPX_FORCEINLINE void sorting_network_exchange(
+        T* keys, std::size_t i, std::size_t j) noexcept
+    {
+        T const a = keys[i];
+        T const b = keys[j];
+        keys[i] = (std::min)(a, b);
+        keys[j] = (std::max)(a, b);
+    }
+
+    // Sort 16 keys using the 60 comparator, 10 layer network by Green. The
+    // exchanges of a layer are independent and branch free, which allows the
+    // compiler to map them onto conditional moves or vector min/max
+    // instructions.
+    template <typename T>
+    void sorting_network_sort16(T* keys) noexcept
+    {
+        constexpr std::size_t network[][2] = {{0, 13}, {1, 12}, {2, 15},
+            {3, 14}, {4, 8}, {5, 6}, {7, 11}, {9, 10}, {0, 5}, {1, 7}, {2, 9},
+            {3, 4}, {6, 13}, {8, 14}, {10, 15}, {11, 12}, {0, 1}, {2, 3},
+            {4, 5}, {6, 8}, {7, 9}, {10, 11}, {12, 13}, {14, 15}, {0, 2},
+            {1, 3}, {4, 10}, {5, 11}, {6, 7}, {8, 9}, {12, 14}, {13, 15},
+            {1, 2}, {3, 12}, {4, 6}, {5, 7}, {8, 10}, {9, 11}, {13, 14},
+            {1, 4}, {2, 6}, {5, 8}, {7, 10}, {9, 13}, {11, 14}, {2, 4}, {3, 6},
+            {9, 12}, {11, 13}, {3, 5}, {6, 8}, {7, 9}, {10, 12}, {3, 4},
+            {5, 6}, {7, 8}, {9, 10}, {11, 12}, {6, 7}, {8, 9}};
+
+        for (auto const& e : network)
+        {
+            sorting_network_exchange(keys, e[0], e[1]);
+        }
+    }
+
+    // Sort count keys, runs of at most 16 keys are padded with the largest
+    // key value and sorted by the network, longer runs are split in halves
+    // which are merged without branching on the comparison.
+    template <typename T>
+    void sorting_network_sort(T* keys, std::size_t count) noexcept
+    {
+        HPX_ASSERT(count <= sorting_network_limit);
+
+        if (count <= 16)
+        {
+            T padded[16];
+            std::copy(keys, keys + count, padded);
+            std::fill(
+                padded + count, padded + 16, (std::numeric_limits<T>::max)());
+
+            sorting_network_sort16(padded);
+            std::copy(padded, padded + count, keys);
+            return;
+        }
+
+        std::size_t const half = (count + 1) / 2;
+        sorting_network_sort(keys, half);
+        sorting_network_sort(keys + half, count - half);
+
+        T merged[sorting_network_limit];
+        std::size_t i = 0;
+        std::size_t j = half;
+        for (std::size_t k = 0; k != count; ++k)
+        {
+            bool const take_second =
+                j != count && (i == half || keys[j] < keys[i]);
+            merged[k] = take_second ? keys[j] : keys[i];
+            j += take_second;
+            i += !take_second;
+        }
+        std::copy(merged, merged + count, keys);
+    }
+
+    // Sort a short range, used as the base case of the merge based sorts.
+    template <typename Iter, typename Compare>
+    void small_sort(Iter first, Iter last, Compare comp)
+    {
+        if constexpr (use_sorting_network_v<Iter, Compare>)
+        {
+            using value_type = typename std::iterator_traits<Iter>::value_type;
+
+            std::size_t const count = last - first;
+            if (count <= sorting_network_limit)
+            {
+                if (count > 1)
+                {
+                    value_type keys[sorting_network_limit];
+                    std::copy(first, last, keys);
+                    sorting_network_sort(keys, count);
+                    std::copy(keys, keys + count, first);
+                }
+                return;
+            }
+        }
+
+        insertion_sort(first, last, comp);
+    }
+
+    /// \endcond
+}}}}    // namespace hpx::parallel::v1::detail
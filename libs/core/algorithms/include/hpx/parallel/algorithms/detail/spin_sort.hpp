@@ -8,8 +8,8 @@
 #pragma once
 
 #include <hpx/assert.hpp>
-#include <hpx/parallel/algorithms/detail/insertion_sort.hpp>
 #include <hpx/parallel/algorithms/detail/is_sorted.hpp>
+#include <hpx/parallel/algorithms/detail/small_sort.hpp>
 #include <hpx/parallel/util/nbits.hpp>
 #include <hpx/parallel/util/range.hpp>
 
@@ -31,7 +31,7 @@ namespace hpx { namespace parallel { inline namespace v1 { namespace detail {
     /// \param [in] r_input     range with the elements to sort
     /// \param [in] range_buf   range with the elements sorted
     /// \param [in] comp        object for to compare two elements
-    /// \param [in] level       when is 0, sort with the insertion_sort
+    /// \param [in] level       when is 0, sort with the small_sort
     ///                         algorithm if not make a recursive call swapping
     ///                         the ranges
     /// \return range with all the elements sorted and moved
@@ -51,8 +51,8 @@ namespace hpx { namespace parallel { inline namespace v1 { namespace detail {
 
         if (level < 2)
         {
-            insertion_sort(rng_a1.begin(), rng_a1.end(), comp);
-            insertion_sort(rng_a2.begin(), rng_a2.end(), comp);
+            small_sort(rng_a1.begin(), rng_a1.end(), comp);
+            small_sort(rng_a2.begin(), rng_a2.end(), comp);
         }
         else
         {
@@ -154,7 +154,7 @@ namespace hpx { namespace parallel { inline namespace v1 { namespace detail {
 
         if (nelem <= (sort_min << 1))
         {
-            insertion_sort(first, last, comp);
+            small_sort(first, last, comp);
             return;
         }
 
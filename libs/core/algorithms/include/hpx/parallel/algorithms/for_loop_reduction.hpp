@@ -34,9 +34,13 @@ namespace hpx::parallel { inline namespace v2 { namespace detail {
     template <typename T, typename Op>
     struct reduction_helper
     {
+        using value_type = T;
+        using combiner_type = Op;
+
         template <typename Op_>
         constexpr reduction_helper(T& var, T const& identity, Op_&& op)
           : var_(var)
+          , identity_(identity)
           , op_(HPX_FORWARD(Op_, op))
         {
             std::size_t cores =
@@ -67,8 +71,25 @@ namespace hpx::parallel { inline namespace v2 { namespace detail {
                 var_ = op_(var_, data_[i].data_);
         }
 
+        // accessors used by algorithms combining the views on their own
+        constexpr T& live_out() const noexcept
+        {
+            return var_;
+        }
+
+        constexpr T const& identity() const noexcept
+        {
+            return identity_;
+        }
+
+        constexpr Op const& combiner() const noexcept
+        {
+            return op_;
+        }
+
     private:
         T& var_;
+        T identity_;
         Op op_;
 #if defined(HPX_HAVE_CXX17_SHARED_PTR_ARRAY)
         std::shared_ptr<hpx::util::cache_line_data<T>[]> data_;
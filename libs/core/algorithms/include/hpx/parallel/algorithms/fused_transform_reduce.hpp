@@ -0,0 +1,369 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/algorithms/fused_transform_reduce.hpp
+
+#pragma once
+
+#if defined(DOXYGEN)
+namespace hpx { namespace experimental {
+    // clang-format off
+
+    /// Performs several reductions over the results of \a conv applied to
+    /// the elements of [first, last) in a single traversal of the range.
+    ///
+    /// Each reduction is described by a reduction object as returned by
+    /// \a hpx::experimental::reduction (or one of its shortcuts like
+    /// \a reduction_plus or \a reduction_min). The result of each reduction
+    /// is combined with the initial value of its live-out variable, the final
+    /// value is stored into the live-out variable when the algorithm returns.
+    ///
+    /// \note   Complexity: O(\a last - \a first) applications of \a conv and
+    ///         of the combiner of each reduction.
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    /// \tparam FwdIter     The type of the source iterators used (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     forward iterator.
+    /// \tparam Convert     The type of the unary function object used to
+    ///                     transform the elements (deduced).
+    /// \tparam Reductions  The types of the reduction objects (deduced).
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param first        Refers to the beginning of the sequence of elements
+    ///                     the algorithm will be applied to.
+    /// \param last         Refers to the end of the sequence of elements the
+    ///                     algorithm will be applied to.
+    /// \param conv         Specifies the function object which is invoked for
+    ///                     each element of the input sequence. If it returns
+    ///                     a \a hpx::tuple with one element per reduction,
+    ///                     the n-th element of the tuple is reduced by the
+    ///                     n-th reduction. Otherwise its result is reduced by
+    ///                     all reductions.
+    /// \param reductions   The reduction objects.
+    ///
+    /// The combiners of all reductions have to be associative and
+    /// commutative, the values are combined in an unspecified order.
+    ///
+    /// \returns  The \a fused_transform_reduce algorithm returns a
+    ///           \a hpx::future<void> if the execution policy is of type
+    ///           \a sequenced_task_policy or \a parallel_task_policy and
+    ///           returns \a void otherwise.
+    ///
+    template <typename ExPolicy, typename FwdIter, typename Convert,
+        typename... Reductions>
+    hpx::parallel::util::detail::algorithm_result_t<ExPolicy>
+    fused_transform_reduce(ExPolicy&& policy, FwdIter first, FwdIter last,
+        Convert&& conv, Reductions&&... reductions);
+
+    /// Performs several reductions over the results of \a conv applied to
+    /// the elements of [first, last) in a single traversal of the range,
+    /// executed sequentially in the calling thread.
+    ///
+    /// The parameters and requirements are the same as for the overload
+    /// taking an execution policy.
+    ///
+    template <typename FwdIter, typename Convert, typename... Reductions>
+    void fused_transform_reduce(FwdIter first, FwdIter last, Convert&& conv,
+        Reductions&&... reductions);
+
+    // clang-format on
+}}    // namespace hpx::experimental
+
+#else    // DOXYGEN
+
+#include <hpx/config.hpp>
+#include <hpx/concepts/concepts.hpp>
+#include <hpx/datastructures/tuple.hpp>
+#include <hpx/executors/execution_policy.hpp>
+#include <hpx/functional/invoke.hpp>
+#include <hpx/iterator_support/traits/is_iterator.hpp>
+#include <hpx/pack_traversal/unwrap.hpp>
+#include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/algorithms/detail/distance.hpp>
+#include <hpx/parallel/algorithms/for_loop_reduction.hpp>
+#include <hpx/parallel/util/detail/algorithm_result.hpp>
+#include <hpx/parallel/util/detail/sender_util.hpp>
+#include <hpx/parallel/util/partitioner.hpp>
+#include <hpx/type_support/pack.hpp>
+#include <hpx/type_support/unused.hpp>
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace parallel { inline namespace v1 {
+    ///////////////////////////////////////////////////////////////////////////
+    // fused_transform_reduce
+    namespace detail {
+        /// \cond NOINTERNAL
+
+        // Number of independent sets of accumulators used for each chunk of
+        // random access ranges. Distributing consecutive elements over
+        // several accumulators breaks the dependency chain of the reductions,
+        // which allows the compiler to vectorize the loop.
+        inline constexpr std::size_t fused_reduce_lanes = 4;
+
+        template <typename T>
+        struct is_fused_reduce_tuple : std::false_type
+        {
+        };
+
+        template <typename... Ts>
+        struct is_fused_reduce_tuple<hpx::tuple<Ts...>> : std::true_type
+        {
+        };
+
+        template <typename... Reductions>
+        using fused_reduce_values =
+            hpx::tuple<typename std::decay_t<Reductions>::value_type...>;
+
+        template <typename... Reductions>
+        fused_reduce_values<Reductions...> fused_reduce_identities(
+            hpx::tuple<Reductions...> const& reductions)
+        {
+            return hpx::util::invoke_fused(
+                [](auto const&... r) {
+                    return fused_reduce_values<Reductions...>(r.identity()...);
+                },
+                reductions);
+        }
+
+        // Accumulate the transformed value of one element into the given
+        // accumulators.
+        template <typename Values, typename... Reductions, typename Value,
+            std::size_t... Is>
+        HPX_FORCEINLINE void fused_reduce_accumulate(Values& acc,
+            hpx::tuple<Reductions...> const& reductions, Value const& value,
+            hpx::util::index_pack<Is...>)
+        {
+            if constexpr (is_fused_reduce_tuple<Value>::value)
+            {
+                static_assert(
+                    hpx::tuple_size<Value>::value == sizeof...(Reductions),
+                    "the transformation has to return one value per "
+                    "reduction");
+
+                ((hpx::get<Is>(acc) =
+                         HPX_INVOKE(hpx::get<Is>(reductions).combiner(),
+                             hpx::get<Is>(acc), hpx::get<Is>(value))),
+                    ...);
+            }
+            else
+            {
+                ((hpx::get<Is>(acc) =
+                         HPX_INVOKE(hpx::get<Is>(reductions).combiner(),
+                             hpx::get<Is>(acc), value)),
+                    ...);
+            }
+        }
+
+        // Combine the accumulators rhs into lhs.
+        template <typename Values, typename... Reductions, std::size_t... Is>
+        HPX_FORCEINLINE void fused_reduce_combine(Values& lhs,
+            Values const& rhs, hpx::tuple<Reductions...> const& reductions,
+            hpx::util::index_pack<Is...>)
+        {
+            ((hpx::get<Is>(lhs) =
+                     HPX_INVOKE(hpx::get<Is>(reductions).combiner(),
+                         hpx::get<Is>(lhs), hpx::get<Is>(rhs))),
+                ...);
+        }
+
+        // Store the combination of the live-out values and the accumulated
+        // values into the live-out variables.
+        template <typename Values, typename... Reductions, std::size_t... Is>
+        void fused_reduce_finalize(Values const& values,
+            hpx::tuple<Reductions...> const& reductions,
+            hpx::util::index_pack<Is...>)
+        {
+            ((hpx::get<Is>(reductions).live_out() =
+                     HPX_INVOKE(hpx::get<Is>(reductions).combiner(),
+                         hpx::get<Is>(reductions).live_out(),
+                         hpx::get<Is>(values))),
+                ...);
+        }
+
+        // Reduce count elements starting at first.
+        template <typename Iter, typename Convert, typename... Reductions>
+        fused_reduce_values<Reductions...> fused_reduce_chunk(Iter first,
+            std::size_t count, Convert& conv,
+            hpx::tuple<Reductions...> const& reductions)
+        {
+            using values_type = fused_reduce_values<Reductions...>;
+            using pack_type = typename hpx::util::make_index_pack<sizeof...(
+                Reductions)>::type;
+
+            values_type acc = fused_reduce_identities(reductions);
+
+            if constexpr (hpx::traits::is_random_access_iterator_v<Iter>)
+            {
+                if (count >= 2 * fused_reduce_lanes)
+                {
+                    values_type lanes[fused_reduce_lanes - 1];
+                    for (auto& lane : lanes)
+                    {
+                        lane = acc;
+                    }
+
+                    for (/**/; count >= fused_reduce_lanes;
+                         count -= fused_reduce_lanes, first +=
+                         fused_reduce_lanes)
+                    {
+                        fused_reduce_accumulate(acc, reductions,
+                            HPX_INVOKE(conv, first[0]), pack_type());
+                        for (std::size_t l = 1; l != fused_reduce_lanes; ++l)
+                        {
+                            fused_reduce_accumulate(lanes[l - 1], reductions,
+                                HPX_INVOKE(conv, first[l]), pack_type());
+                        }
+                    }
+
+                    for (auto const& lane : lanes)
+                    {
+                        fused_reduce_combine(
+                            acc, lane, reductions, pack_type());
+                    }
+                }
+            }
+
+            for (/**/; count != 0; (void) --count, ++first)
+            {
+                fused_reduce_accumulate(
+                    acc, reductions, HPX_INVOKE(conv, *first), pack_type());
+            }
+            return acc;
+        }
+
+        struct fused_transform_reduce
+          : public detail::algorithm<fused_transform_reduce>
+        {
+            constexpr fused_transform_reduce() noexcept
+              : fused_transform_reduce::algorithm("fused_transform_reduce")
+            {
+            }
+
+            template <typename ExPolicy, typename Iter, typename Sent,
+                typename Convert, typename... Reductions>
+            static hpx::util::unused_type sequential(ExPolicy&&, Iter first,
+                Sent last, Convert&& conv,
+                hpx::tuple<Reductions...> const& reductions)
+            {
+                using pack_type = typename hpx::util::make_index_pack<sizeof...(
+                    Reductions)>::type;
+
+                fused_reduce_finalize(
+                    fused_reduce_chunk(first, detail::distance(first, last),
+                        conv, reductions),
+                    reductions, pack_type());
+
+                return hpx::util::unused_type();
+            }
+
+            template <typename ExPolicy, typename Iter, typename Sent,
+                typename Convert, typename... Reductions>
+            static util::detail::algorithm_result_t<ExPolicy> parallel(
+                ExPolicy&& policy, Iter first, Sent last, Convert&& conv,
+                hpx::tuple<Reductions...> const& reductions)
+            {
+                using values_type = fused_reduce_values<Reductions...>;
+                using pack_type = typename hpx::util::make_index_pack<sizeof...(
+                    Reductions)>::type;
+
+                std::size_t const count = detail::distance(first, last);
+                if (count == 0)
+                {
+                    return util::detail::algorithm_result<ExPolicy>::get();
+                }
+
+                auto f1 = [conv = HPX_FORWARD(Convert, conv), reductions](
+                              Iter part_begin,
+                              std::size_t part_size) mutable -> values_type {
+                    return fused_reduce_chunk(
+                        part_begin, part_size, conv, reductions);
+                };
+
+                auto f2 = [reductions](auto&& results) -> void {
+                    values_type acc = fused_reduce_identities(reductions);
+                    for (auto const& result : results)
+                    {
+                        fused_reduce_combine(
+                            acc, result, reductions, pack_type());
+                    }
+                    fused_reduce_finalize(acc, reductions, pack_type());
+                };
+
+                return util::partitioner<ExPolicy, void, values_type>::call(
+                    HPX_FORWARD(ExPolicy, policy), first, count, HPX_MOVE(f1),
+                    hpx::unwrapping(HPX_MOVE(f2)));
+            }
+        };
+        /// \endcond
+    }    // namespace detail
+}}}      // namespace hpx::parallel::v1
+
+namespace hpx { namespace experimental {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // CPO for hpx::experimental::fused_transform_reduce
+    inline constexpr struct fused_transform_reduce_t final
+      : hpx::detail::tag_parallel_algorithm<fused_transform_reduce_t>
+    {
+    private:
+        // clang-format off
+        template <typename ExPolicy, typename FwdIter, typename Convert,
+            typename... Reductions,
+            HPX_CONCEPT_REQUIRES_(
+                hpx::is_execution_policy<ExPolicy>::value &&
+                hpx::traits::is_iterator<FwdIter>::value
+            )>
+        // clang-format on
+        friend hpx::parallel::util::detail::algorithm_result_t<ExPolicy>
+        tag_fallback_invoke(fused_transform_reduce_t, ExPolicy&& policy,
+            FwdIter first, FwdIter last, Convert&& conv,
+            Reductions&&... reductions)
+        {
+            static_assert(hpx::traits::is_forward_iterator<FwdIter>::value,
+                "Requires at least forward iterator.");
+            static_assert(sizeof...(Reductions) >= 1,
+                "fused_transform_reduce requires at least one reduction");
+
+            using reductions_type = hpx::tuple<std::decay_t<Reductions>...>;
+
+            return hpx::parallel::v1::detail::fused_transform_reduce().call(
+                HPX_FORWARD(ExPolicy, policy), first, last,
+                HPX_FORWARD(Convert, conv),
+                reductions_type(HPX_FORWARD(Reductions, reductions)...));
+        }
+
+        // clang-format off
+        template <typename FwdIter, typename Convert, typename... Reductions,
+            HPX_CONCEPT_REQUIRES_(
+                hpx::traits::is_iterator<FwdIter>::value
+            )>
+        // clang-format on
+        friend void tag_fallback_invoke(fused_transform_reduce_t,
+            FwdIter first, FwdIter last, Convert&& conv,
+            Reductions&&... reductions)
+        {
+            static_assert(hpx::traits::is_forward_iterator<FwdIter>::value,
+                "Requires at least forward iterator.");
+            static_assert(sizeof...(Reductions) >= 1,
+                "fused_transform_reduce requires at least one reduction");
+
+            using reductions_type = hpx::tuple<std::decay_t<Reductions>...>;
+
+            hpx::parallel::v1::detail::fused_transform_reduce().call(
+                hpx::execution::seq, first, last, HPX_FORWARD(Convert, conv),
+                reductions_type(HPX_FORWARD(Reductions, reductions)...));
+        }
+    } fused_transform_reduce{};
+}}    // namespace hpx::experimental
+
+#endif    // DOXYGEN
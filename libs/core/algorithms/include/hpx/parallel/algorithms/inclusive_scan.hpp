@@ -575,7 +575,8 @@ namespace hpx { namespace parallel { inline namespace v1 {
                 };
 
                 return util::scan_partitioner<ExPolicy,
-                    util::in_out_result<FwdIter1, FwdIter2>, T>::
+                    util::in_out_result<FwdIter1, FwdIter2>, T, void,
+                    util::scan_partitioner_single_pass_tag>::
                     call(
                         HPX_FORWARD(ExPolicy, policy),
                         make_zip_iterator(first, dest), count, init,
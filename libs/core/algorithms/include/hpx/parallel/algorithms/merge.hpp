@@ -287,7 +287,9 @@ namespace hpx {
 #include <hpx/algorithms/traits/projected.hpp>
 #include <hpx/execution/algorithms/detail/is_negative.hpp>
 #include <hpx/execution/algorithms/detail/predicates.hpp>
+#include <hpx/execution/executors/execution.hpp>
 #include <hpx/executors/execution_policy.hpp>
+#include <hpx/iterator_support/counting_shape.hpp>
 #include <hpx/parallel/algorithms/copy.hpp>
 #include <hpx/parallel/algorithms/detail/advance_to_sentinel.hpp>
 #include <hpx/parallel/algorithms/detail/dispatch.hpp>
@@ -386,6 +388,80 @@ namespace hpx { namespace parallel { inline namespace v1 {
             using another_type = upper_bound_helper;
         };
 
+        ///////////////////////////////////////////////////////////////////////
+        // Find the co-rank of the output position k in the merge of the
+        // sequences [first1, first1 + size1) and [first2, first2 + size2),
+        // i.e. the number of elements of the first sequence which precede
+        // position k in the merged sequence. Equivalent elements of the first
+        // sequence are ordered before those of the second one, which keeps the
+        // merge stable.
+        template <typename Iter1, typename Iter2, typename Comp,
+            typename Proj1, typename Proj2>
+        std::size_t merge_path_search(Iter1 first1, std::size_t size1,
+            Iter2 first2, std::size_t size2, std::size_t k, Comp&& comp,
+            Proj1&& proj1, Proj2&& proj2)
+        {
+            std::size_t low = k > size2 ? k - size2 : 0;
+            std::size_t high = (std::min)(k, size1);
+
+            while (low < high)
+            {
+                std::size_t const mid = low + (high - low) / 2;
+                if (!HPX_INVOKE(comp,
+                        HPX_INVOKE(proj2, *std::next(first2, k - mid - 1)),
+                        HPX_INVOKE(proj1, *std::next(first1, mid))))
+                {
+                    low = mid + 1;
+                }
+                else
+                {
+                    high = mid;
+                }
+            }
+            return low;
+        }
+
+        // Merge two sorted sequences in parallel by splitting the output into
+        // num_partitions pieces of equal size along the merge path. The
+        // partitions are independent of each other, each of them is handed
+        // to merge_partition(first1, last1, first2, last2, dest) which
+        // performs the (sequential) merge of its sub-sequences.
+        template <typename Exec, typename Iter1, typename Iter2,
+            typename Iter3, typename Comp, typename Proj1, typename Proj2,
+            typename F>
+        void parallel_merge_path(Exec&& exec, Iter1 first1, std::size_t size1,
+            Iter2 first2, std::size_t size2, Iter3 dest,
+            std::size_t num_partitions, Comp&& comp, Proj1&& proj1,
+            Proj2&& proj2, F&& merge_partition)
+        {
+            std::size_t const size = size1 + size2;
+            num_partitions = (std::max)(
+                std::size_t(1), (std::min)(num_partitions, size));
+
+            // first output position of partition p
+            auto partition_begin = [=](std::size_t p) {
+                return size / num_partitions * p +
+                    (std::min)(p, size % num_partitions);
+            };
+
+            execution::bulk_sync_execute(
+                HPX_FORWARD(Exec, exec),
+                [&](std::size_t p) {
+                    std::size_t const k1 = partition_begin(p);
+                    std::size_t const k2 = partition_begin(p + 1);
+
+                    std::size_t const i1 = merge_path_search(first1, size1,
+                        first2, size2, k1, comp, proj1, proj2);
+                    std::size_t const i2 = merge_path_search(first1, size1,
+                        first2, size2, k2, comp, proj1, proj2);
+
+                    merge_partition(std::next(first1, i1),
+                        std::next(first1, i2), std::next(first2, k1 - i1),
+                        std::next(first2, k2 - i2), std::next(dest, k1));
+                },
+                hpx::util::detail::make_counting_shape(num_partitions));
+        }
+
         ///////////////////////////////////////////////////////////////////////
         template <typename ExPolicy, typename Iter1, typename Sent1,
             typename Iter2, typename Sent2, typename Iter3, typename Comp,
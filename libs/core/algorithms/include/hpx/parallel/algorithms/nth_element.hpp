@@ -140,10 +140,11 @@ namespace hpx {
 #include <hpx/execution/algorithms/detail/predicates.hpp>
 #include <hpx/executors/execution_policy.hpp>
 #include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/algorithms/detail/parallel_select.hpp>
 #include <hpx/parallel/algorithms/detail/pivot.hpp>
 #include <hpx/parallel/algorithms/minmax.hpp>
 #include <hpx/parallel/algorithms/partial_sort.hpp>
-#include <hpx/parallel/algorithms/partition.hpp>
+#include <hpx/parallel/util/compare_projected.hpp>
 #include <hpx/parallel/util/detail/algorithm_result.hpp>
 
 #include <algorithm>
@@ -263,10 +264,7 @@ namespace hpx { namespace parallel { inline namespace v1 {
             parallel(ExPolicy&& policy, RandomIt first, RandomIt nth, Sent last,
                 Pred&& pred, Proj&& proj)
             {
-                using value_type =
-                    typename std::iterator_traits<RandomIt>::value_type;
-
-                RandomIt partitionIter, return_last;
+                RandomIt return_last;
 
                 if (first == last)
                 {
@@ -286,47 +284,10 @@ namespace hpx { namespace parallel { inline namespace v1 {
                         detail::advance_to_sentinel(first, last);
                     return_last = last_iter;
 
-                    while (first != last_iter)
-                    {
-                        detail::pivot9(first, last_iter, pred);
-
-                        partitionIter =
-                            hpx::parallel::v1::detail::partition<RandomIt>()
-                                .call(
-                                    policy(hpx::execution::non_task), first + 1,
-                                    last_iter,
-                                    [val = HPX_INVOKE(proj, *first), &pred](
-                                        value_type const& elem) {
-                                        return HPX_INVOKE(pred, elem, val);
-                                    },
-                                    proj);
-
-                        --partitionIter;
-                        // swap first element and partitionIter
-                        // (ending element of first group)
-#if defined(HPX_HAVE_CXX20_STD_RANGES_ITER_SWAP)
-                        std::ranges::iter_swap(first, partitionIter);
-#else
-                        std::iter_swap(first, partitionIter);
-#endif
-
-                        // if nth element < partitioned index,
-                        // it lies in [first, partitionIter)
-                        if (partitionIter < nth)
-                        {
-                            first = partitionIter + 1;
-                        }
-                        // else it lies in [partitionIter + 1, last)
-                        else if (partitionIter > nth)
-                        {
-                            last_iter = partitionIter;
-                        }
-                        // partitionIter == nth
-                        else
-                        {
-                            break;
-                        }
-                    }
+                    // sample based selection, the range is narrowed down
+                    // using parallel three-way partitions
+                    detail::parallel_select(policy, first, nth, last_iter,
+                        util::compare_projected<Pred&, Proj&>(pred, proj));
                 }
                 catch (...)
                 {
@@ -105,7 +105,6 @@ namespace hpx {
 
 #include <hpx/config.hpp>
 #include <hpx/assert.hpp>
-#include <hpx/async_local/dataflow.hpp>
 #include <hpx/concepts/concepts.hpp>
 #include <hpx/functional/invoke.hpp>
 #include <hpx/iterator_support/traits/is_iterator.hpp>
@@ -117,11 +116,11 @@ namespace hpx {
 #include <hpx/execution/executors/execution.hpp>
 #include <hpx/execution/executors/execution_information.hpp>
 #include <hpx/execution/executors/execution_parameters.hpp>
-#include <hpx/executors/exception_list.hpp>
 #include <hpx/executors/execution_policy.hpp>
 #include <hpx/parallel/algorithms/detail/dispatch.hpp>
 #include <hpx/parallel/algorithms/detail/distance.hpp>
 #include <hpx/parallel/algorithms/detail/is_sorted.hpp>
+#include <hpx/parallel/algorithms/detail/parallel_select.hpp>
 #include <hpx/parallel/algorithms/sort.hpp>
 #include <hpx/parallel/util/compare_projected.hpp>
 #include <hpx/parallel/util/detail/algorithm_result.hpp>
@@ -134,7 +133,6 @@ namespace hpx {
 #include <exception>
 #include <functional>
 #include <iterator>
-#include <list>
 #include <type_traits>
 #include <utility>
 
@@ -344,105 +342,6 @@ namespace hpx { namespace parallel { inline namespace v1 {
                 first, middle, c_last, level - 1, HPX_FORWARD(Comp, comp));
         }
 
-        ///////////////////////////////////////////////////////////////////////
-        ///
-        /// Internal function to divide and sort the ranges
-        ///
-        /// \param first : iterator to the first element
-        /// \param middle: iterator defining the last element to be sorted
-        /// \param end : iterator to the element after the end in the range
-        /// \param level : level of depth from the top level call
-        /// \param comp : object for to Comp elements
-        ///
-        struct sort_thread_helper
-        {
-            template <typename... Ts>
-            decltype(auto) operator()(Ts&&... ts) const
-            {
-                return sort_thread(HPX_FORWARD(Ts, ts)...);
-            }
-        };
-
-        template <typename ExPolicy, typename Iter, typename Comp>
-        hpx::future<Iter> parallel_partial_sort(ExPolicy&& policy, Iter first,
-            Iter middle, Iter last, std::uint32_t level, Comp&& comp = Comp());
-
-        struct parallel_partial_sort_helper
-        {
-            template <typename... Ts>
-            decltype(auto) operator()(Ts&&... ts) const
-            {
-                return parallel_partial_sort(HPX_FORWARD(Ts, ts)...);
-            }
-        };
-
-        template <typename ExPolicy, typename Iter, typename Comp>
-        hpx::future<Iter> parallel_partial_sort(ExPolicy&& policy, Iter first,
-            Iter middle, Iter last, std::uint32_t level, Comp&& comp)
-        {
-            std::int64_t nelem = last - first;
-            std::int64_t nmid = middle - first;
-            HPX_ASSERT(nelem >= nmid);
-
-            if (nelem == 0 || nmid == 0)
-            {
-                return hpx::make_ready_future(last);
-            }
-
-            if (nmid < 4096 || level < 12)
-            {
-                recursive_partial_sort(first, middle, last, level, comp);
-                return hpx::make_ready_future(last);
-            }
-
-            Iter c_last = filter(first, last, comp);
-            if (middle >= c_last)
-            {
-                // figure out the chunk size to use
-                std::size_t const cores = execution::processing_units_count(
-                    policy.parameters(), policy.executor());
-
-                // number of elements to sort
-                std::size_t chunk_size = execution::get_chunk_size(
-                    policy.parameters(), policy.executor(), 0, cores, nelem);
-
-                hpx::future<Iter> left = execution::async_execute(
-                    policy.executor(), sort_thread_helper(), policy, first,
-                    c_last, comp, chunk_size);
-
-                hpx::future<Iter> right;
-                if (middle != c_last)
-                {
-                    right = execution::async_execute(policy.executor(),
-                        parallel_partial_sort_helper(), policy, c_last + 1,
-                        middle, last, level - 1, comp);
-                }
-                else
-                {
-                    right = hpx::make_ready_future(last);
-                }
-
-                return hpx::dataflow(
-                    [last](hpx::future<Iter>&& left,
-                        hpx::future<Iter>&& right) -> Iter {
-                        if (left.has_exception() || right.has_exception())
-                        {
-                            std::list<std::exception_ptr> errors;
-                            if (left.has_exception())
-                                errors.push_back(left.get_exception_ptr());
-                            if (right.has_exception())
-                                errors.push_back(right.get_exception_ptr());
-
-                            throw exception_list(HPX_MOVE(errors));
-                        }
-                        return last;
-                    },
-                    HPX_MOVE(left), HPX_MOVE(right));
-            }
-
-            return parallel_partial_sort(HPX_FORWARD(ExPolicy, policy), first,
-                middle, c_last, level - 1, HPX_FORWARD(Comp, comp));
-        }
         /// \endcond NOINTERNAL
     }    // end namespace detail
 
@@ -501,17 +400,58 @@ namespace hpx { namespace parallel { inline namespace v1 {
         std::int64_t nmid = middle - first;
         HPX_ASSERT(nmid >= 0 && nmid <= nelem);
 
+        Iter last = first + nelem;
+        if (nmid == 0)
+        {
+            return hpx::make_ready_future(last);
+        }
+
         if (nmid > 1024)
         {
             if (detail::is_sorted_sequential(first, middle, comp))
             {
-                return hpx::make_ready_future(first + nelem);
+                return hpx::make_ready_future(last);
             }
         }
 
-        std::uint32_t level = parallel::v1::detail::nbits64(nelem) * 2;
-        return detail::parallel_partial_sort(HPX_FORWARD(ExPolicy, policy),
-            first, middle, first + nelem, level, HPX_FORWARD(Comp, comp));
+        std::size_t const cores = execution::processing_units_count(
+            policy.parameters(), policy.executor());
+        std::size_t const num_chunks = (std::min)(
+            cores, std::size_t(nelem) / detail::parallel_select_limit);
+
+        if (num_chunks <= 1)
+        {
+            std::uint32_t level = parallel::v1::detail::nbits64(nelem) * 2;
+            detail::recursive_partial_sort(
+                first, middle, last, level, HPX_FORWARD(Comp, comp));
+            return hpx::make_ready_future(last);
+        }
+
+        // A small number of elements to sort is selected by every chunk of
+        // the input on its own, the candidates of all chunks are merged.
+        std::size_t const chunk_size = (nelem + num_chunks - 1) / num_chunks;
+        if (std::size_t(nmid) * num_chunks <= chunk_size)
+        {
+            detail::parallel_partial_sort_top_k(
+                policy, first, nmid, nelem, num_chunks, comp);
+            return hpx::make_ready_future(last);
+        }
+
+        // Otherwise the elements before middle are selected first and sorted
+        // afterwards.
+        detail::parallel_select(policy, first, middle - 1, last, comp);
+
+        std::size_t const sort_chunk_size = execution::get_chunk_size(
+            policy.parameters(), policy.executor(), 0, cores, nmid);
+
+        hpx::future<Iter> sorted = execution::async_execute(policy.executor(),
+            &detail::sort_thread<std::decay_t<ExPolicy>, Iter,
+                std::decay_t<Comp>>,
+            HPX_FORWARD(ExPolicy, policy), first, middle,
+            HPX_FORWARD(Comp, comp), sort_chunk_size);
+
+        return hpx::make_future<Iter>(
+            HPX_MOVE(sorted), [last](Iter) { return last; });
     }
 
     ///////////////////////////////////////////////////////////////////////
@@ -471,6 +471,7 @@ namespace hpx {
 #include <hpx/parallel/algorithms/detail/advance_to_sentinel.hpp>
 #include <hpx/parallel/algorithms/detail/dispatch.hpp>
 #include <hpx/parallel/algorithms/detail/distance.hpp>
+#include <hpx/parallel/util/compact_partitioner.hpp>
 #include <hpx/parallel/util/detail/algorithm_result.hpp>
 #include <hpx/parallel/util/detail/chunk_size.hpp>
 #include <hpx/parallel/util/detail/handle_local_exceptions.hpp>
@@ -478,15 +479,7 @@ namespace hpx {
 #include <hpx/parallel/util/invoke_projected.hpp>
 #include <hpx/parallel/util/loop.hpp>
 #include <hpx/parallel/util/projection_identity.hpp>
-#include <hpx/parallel/util/scan_partitioner.hpp>
 #include <hpx/parallel/util/transfer.hpp>
-#include <hpx/parallel/util/zip_iterator.hpp>
-
-#if !defined(HPX_HAVE_CXX17_SHARED_PTR_ARRAY)
-#include <boost/shared_array.hpp>
-#else
-#include <memory>
-#endif
 
 #include <algorithm>
 #include <cstddef>
@@ -1545,111 +1538,63 @@ namespace hpx { namespace parallel { inline namespace v1 {
                 FwdIter2 dest_true, FwdIter3 dest_false, Pred&& pred,
                 Proj&& proj)
             {
-                using zip_iterator = hpx::util::zip_iterator<FwdIter1, bool*>;
-                using result = util::detail::algorithm_result<ExPolicy,
-                    hpx::tuple<FwdIter1, FwdIter2, FwdIter3>>;
-                using difference_type =
-                    typename std::iterator_traits<FwdIter1>::difference_type;
-                using output_iterator_offset =
-                    std::pair<std::size_t, std::size_t>;
+                using result_type = hpx::tuple<FwdIter1, FwdIter2, FwdIter3>;
+                using result =
+                    util::detail::algorithm_result<ExPolicy, result_type>;
 
                 if (first == last)
                     return result::get(
                         hpx::make_tuple(first, dest_true, dest_false));
 
                 auto last_iter = first;
-                difference_type count =
+                std::size_t count =
                     detail::advance_and_get_distance(last_iter, last);
 
-#if defined(HPX_HAVE_CXX17_SHARED_PTR_ARRAY)
-                std::shared_ptr<bool[]> flags(new bool[count]);
-#else
-                boost::shared_array<bool> flags(new bool[count]);
-#endif
-                output_iterator_offset init = {0, 0};
-
-                using hpx::get;
-                using hpx::util::make_zip_iterator;
-                using scan_partitioner_type = util::scan_partitioner<ExPolicy,
-                    hpx::tuple<FwdIter1, FwdIter2, FwdIter3>,
-                    output_iterator_offset>;
-
-                // Note: replacing the invoke() with HPX_INVOKE()
-                // below makes gcc generate errors
-                auto f1 = [pred = HPX_FORWARD(Pred, pred),
-                              proj = HPX_FORWARD(Proj, proj)](
-                              zip_iterator part_begin,
-                              std::size_t part_size) -> output_iterator_offset {
-                    std::size_t true_count = 0;
-
-                    // MSVC complains if pred or proj is captured by ref below
-                    util::loop_n<std::decay_t<ExPolicy>>(part_begin, part_size,
-                        [pred, proj, &true_count](
-                            zip_iterator it) mutable -> void {
-                            bool f = hpx::util::invoke(
-                                pred, hpx::util::invoke(proj, get<0>(*it)));
-
-                            if ((get<1>(*it) = f))
-                                ++true_count;
-                        });
-
-                    return output_iterator_offset(
-                        true_count, part_size - true_count);
+                // step 1 flags the elements satisfying the predicate
+                auto mark = [pred = HPX_FORWARD(Pred, pred),
+                                proj = HPX_FORWARD(Proj, proj)](
+                                FwdIter1 part_begin, std::size_t part_size,
+                                util::detail::compact_flags_writer& flags) {
+                    for (std::size_t i = 0; i != part_size;
+                         (void) ++part_begin, ++i)
+                    {
+                        flags.push(
+                            HPX_INVOKE(pred, HPX_INVOKE(proj, *part_begin)));
+                    }
                 };
 
-                auto f2 = [](output_iterator_offset const& prev_sum,
-                              output_iterator_offset const& curr)
-                    -> output_iterator_offset {
-                    return output_iterator_offset(
-                        get<0>(prev_sum) + get<0>(curr),
-                        get<1>(prev_sum) + get<1>(curr));
-                };
-                auto f3 = [dest_true, dest_false, flags](
-                              zip_iterator part_begin, std::size_t part_size,
-                              output_iterator_offset val) mutable -> void {
-                    HPX_UNUSED(flags);
-                    output_iterator_offset offset = val;
-                    std::size_t count_true = get<0>(offset);
-                    std::size_t count_false = get<1>(offset);
-                    std::advance(dest_true, count_true);
-                    std::advance(dest_false, count_false);
-
-                    util::loop_n<std::decay_t<ExPolicy>>(part_begin, part_size,
-                        [&dest_true, &dest_false](zip_iterator it) mutable {
-                            if (get<1>(*it))
-                                *dest_true++ = get<0>(*it);
+                // step 2 copies the elements of a partition to their final
+                // position, the elements which do not satisfy the predicate
+                // precede the partition's first element
+                auto scatter =
+                    [dest_true, dest_false](FwdIter1 part_begin,
+                        std::size_t part_size, std::size_t base_idx,
+                        std::size_t offset,
+                        util::detail::compact_flags_view const& flags) {
+                        FwdIter2 out_true = dest_true;
+                        FwdIter3 out_false = dest_false;
+                        std::advance(out_true, offset);
+                        std::advance(out_false, base_idx - offset);
+                        for (std::size_t i = 0; i != part_size;
+                             (void) ++part_begin, ++i)
+                        {
+                            if (flags[i])
+                                *out_true++ = *part_begin;
                             else
-                                *dest_false++ = get<0>(*it);
-                        });
-                };
-
-                auto f4 = [last_iter, dest_true, dest_false, flags](
-                              std::vector<output_iterator_offset>&& items,
-                              std::vector<hpx::future<void>>&&) mutable
-                    -> hpx::tuple<FwdIter1, FwdIter2, FwdIter3> {
-                    HPX_UNUSED(flags);
-
-                    output_iterator_offset count_pair = items.back();
-                    std::size_t count_true = get<0>(count_pair);
-                    std::size_t count_false = get<1>(count_pair);
-                    std::advance(dest_true, count_true);
-                    std::advance(dest_false, count_false);
+                                *out_false++ = *part_begin;
+                        }
+                    };
 
+                auto finalize = [last_iter, dest_true, dest_false, count](
+                                    std::size_t total) mutable -> result_type {
+                    std::advance(dest_true, total);
+                    std::advance(dest_false, count - total);
                     return hpx::make_tuple(last_iter, dest_true, dest_false);
                 };
 
-                return scan_partitioner_type::call(
-                    HPX_FORWARD(ExPolicy, policy),
-                    make_zip_iterator(first, flags.get()), count, init,
-                    // step 1 performs first part of scan algorithm
-                    HPX_MOVE(f1),
-                    // step 2 propagates the partition results from left
-                    // to right
-                    HPX_MOVE(f2),
-                    // step 3 runs final accumulation on each partition
-                    HPX_MOVE(f3),
-                    // step 4 use this return value
-                    HPX_MOVE(f4));
+                return util::compact_partitioner<ExPolicy, result_type>::call(
+                    HPX_FORWARD(ExPolicy, policy), first, count, HPX_MOVE(mark),
+                    HPX_MOVE(scatter), HPX_MOVE(finalize));
             }
         };
         /// \endcond
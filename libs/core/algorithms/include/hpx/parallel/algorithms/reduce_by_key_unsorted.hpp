@@ -0,0 +1,715 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/algorithms/reduce_by_key_unsorted.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/concepts/concepts.hpp>
+#include <hpx/execution/executors/execution.hpp>
+#include <hpx/execution/executors/execution_information.hpp>
+#include <hpx/execution/traits/is_execution_policy.hpp>
+#include <hpx/executors/execution_policy.hpp>
+#include <hpx/functional/invoke.hpp>
+#include <hpx/iterator_support/counting_shape.hpp>
+#include <hpx/iterator_support/traits/is_iterator.hpp>
+#include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/util/detail/algorithm_result.hpp>
+#include <hpx/parallel/util/result_types.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace parallel { inline namespace v1 {
+    ///////////////////////////////////////////////////////////////////////////
+    // reduce_by_key_unsorted, reduce_by_key_partitioned
+    namespace detail {
+        /// \cond NOINTERNAL
+
+        // Minimal number of elements handled by one chunk of the input.
+        inline constexpr std::size_t reduce_by_key_min_chunk_size = 16384;
+
+        // Number of input elements per partition the partitioned variant
+        // aims for, the table of one partition is expected to stay in cache.
+        inline constexpr std::size_t reduce_by_key_partition_size = 16384;
+        inline constexpr std::size_t reduce_by_key_max_partition_bits = 12;
+
+        // The finalizer of MurmurHash3 spreads the entropy of the user
+        // supplied hash over all bits. Many hash functions (std::hash for
+        // integers, for instance) are the identity, which would otherwise
+        // put all keys into the same partition.
+        constexpr std::uint64_t mix_key_hash(std::uint64_t h) noexcept
+        {
+            h ^= h >> 33;
+            h *= 0xff51afd7ed558ccdULL;
+            h ^= h >> 33;
+            h *= 0xc4ceb9fe1a85ec53ULL;
+            h ^= h >> 33;
+            return h;
+        }
+
+        // The partition of a key is selected by the high bits of its hash,
+        // the tables use the low bits to select a slot.
+        constexpr std::size_t key_hash_partition(
+            std::uint64_t h, std::size_t bits) noexcept
+        {
+            return bits == 0 ? 0 : static_cast<std::size_t>(h >> (64 - bits));
+        }
+
+        constexpr std::size_t ceil_log2(std::size_t n) noexcept
+        {
+            std::size_t bits = 0;
+            while ((std::size_t(1) << bits) < n)
+            {
+                ++bits;
+            }
+            return bits;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // Open addressing hash table (linear probing) accumulating one value
+        // per distinct key. The entries are stored densely in insertion
+        // order, the slots refer to them by index.
+        template <typename Key, typename Value, typename KeyEqual>
+        class reduce_by_key_table
+        {
+        public:
+            explicit reduce_by_key_table(
+                KeyEqual const& key_eq, std::size_t expected = 0)
+              : key_eq_(key_eq)
+            {
+                reserve(expected);
+            }
+
+            std::size_t size() const noexcept
+            {
+                return hashes_.size();
+            }
+
+            std::vector<std::uint64_t> const& hashes() const noexcept
+            {
+                return hashes_;
+            }
+
+            std::vector<Key>& keys() noexcept
+            {
+                return keys_;
+            }
+
+            std::vector<Value>& values() noexcept
+            {
+                return values_;
+            }
+
+            void reserve(std::size_t expected)
+            {
+                std::size_t const capacity = std::size_t(1)
+                    << ceil_log2((std::max)(2 * expected, std::size_t(16)));
+                if (capacity > slots_.size())
+                {
+                    rehash(capacity);
+                }
+                hashes_.reserve(expected);
+                keys_.reserve(expected);
+                values_.reserve(expected);
+            }
+
+            // Combine the value with the one accumulated for the key, add a
+            // new entry if the key was not seen before.
+            template <typename K, typename V, typename F>
+            void insert(std::uint64_t h, K&& key, V&& value, F& f)
+            {
+                if (2 * (hashes_.size() + 1) > slots_.size())
+                {
+                    rehash(2 * slots_.size());
+                }
+
+                std::size_t const mask = slots_.size() - 1;
+                for (std::size_t pos = h & mask; /**/; pos = (pos + 1) & mask)
+                {
+                    std::size_t const index = slots_[pos];
+                    if (index == 0)
+                    {
+                        keys_.emplace_back(HPX_FORWARD(K, key));
+                        values_.emplace_back(HPX_FORWARD(V, value));
+                        hashes_.push_back(h);
+                        slots_[pos] = hashes_.size();
+                        return;
+                    }
+
+                    if (hashes_[index - 1] == h &&
+                        HPX_INVOKE(key_eq_, keys_[index - 1], key))
+                    {
+                        values_[index - 1] = HPX_INVOKE(f,
+                            HPX_MOVE(values_[index - 1]),
+                            HPX_FORWARD(V, value));
+                        return;
+                    }
+                }
+            }
+
+        private:
+            void rehash(std::size_t capacity)
+            {
+                HPX_ASSERT((capacity & (capacity - 1)) == 0);
+
+                slots_.assign(capacity, 0);
+                std::size_t const mask = capacity - 1;
+                for (std::size_t i = 0; i != hashes_.size(); ++i)
+                {
+                    std::size_t pos = hashes_[i] & mask;
+                    while (slots_[pos] != 0)
+                    {
+                        pos = (pos + 1) & mask;
+                    }
+                    slots_[pos] = i + 1;
+                }
+            }
+
+            KeyEqual key_eq_;
+            std::vector<std::size_t> slots_;    // entry index + 1, 0 if empty
+            std::vector<std::uint64_t> hashes_;
+            std::vector<Key> keys_;
+            std::vector<Value> values_;
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        template <typename ExPolicy>
+        std::size_t reduce_by_key_chunks(ExPolicy const& policy,
+            std::size_t count, std::size_t min_chunk_size)
+        {
+            if constexpr (hpx::is_parallel_execution_policy_v<ExPolicy>)
+            {
+                std::size_t const cores = execution::processing_units_count(
+                    policy.parameters(), policy.executor());
+                return (std::max)(std::size_t(1),
+                    (std::min)(cores, count / min_chunk_size));
+            }
+            else
+            {
+                return 1;
+            }
+        }
+
+        // Move the entries of all tables to the output, the tables hold
+        // disjoint sets of keys.
+        template <typename ExPolicy, typename Table, typename FwdIter1,
+            typename FwdIter2>
+        util::in_out_result<FwdIter1, FwdIter2> reduce_by_key_write_tables(
+            ExPolicy& policy, std::vector<Table>& tables, FwdIter1 keys_output,
+            FwdIter2 values_output)
+        {
+            std::vector<std::size_t> offsets(tables.size() + 1, 0);
+            for (std::size_t k = 0; k != tables.size(); ++k)
+            {
+                offsets[k + 1] = offsets[k] + tables[k].size();
+            }
+
+            execution::bulk_sync_execute(
+                policy.executor(),
+                [&](std::size_t k) {
+                    Table& table = tables[k];
+                    FwdIter1 key_dest = std::next(keys_output, offsets[k]);
+                    FwdIter2 value_dest = std::next(values_output, offsets[k]);
+                    for (std::size_t i = 0; i != table.size(); ++i)
+                    {
+                        *key_dest++ = HPX_MOVE(table.keys()[i]);
+                        *value_dest++ = HPX_MOVE(table.values()[i]);
+                    }
+                },
+                hpx::util::detail::make_counting_shape(tables.size()));
+
+            return util::in_out_result<FwdIter1, FwdIter2>{
+                std::next(keys_output, offsets.back()),
+                std::next(values_output, offsets.back())};
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // Every chunk of the input is reduced into a table of its own. The
+        // local tables are merged in a final pass, where every task merges
+        // the keys of one range of hash values found in all local tables.
+        template <typename ExPolicy, typename RanIter, typename RanIter2,
+            typename FwdIter1, typename FwdIter2, typename Hash,
+            typename KeyEqual, typename Func>
+        util::in_out_result<FwdIter1, FwdIter2> reduce_by_key_unsorted_impl(
+            ExPolicy&& policy, RanIter key_first, std::size_t count,
+            RanIter2 values_first, FwdIter1 keys_output, FwdIter2 values_output,
+            Hash& hash, KeyEqual& key_eq, Func& func)
+        {
+            using key_type = typename std::iterator_traits<RanIter>::value_type;
+            using value_type =
+                typename std::iterator_traits<RanIter2>::value_type;
+            using table_type = reduce_by_key_table<key_type, value_type,
+                std::decay_t<KeyEqual>>;
+
+            std::size_t const num_chunks = reduce_by_key_chunks(
+                policy, count, reduce_by_key_min_chunk_size);
+            std::size_t const chunk_size =
+                (count + num_chunks - 1) / num_chunks;
+
+            std::vector<table_type> local;
+            local.reserve(num_chunks);
+            for (std::size_t k = 0; k != num_chunks; ++k)
+            {
+                local.emplace_back(key_eq);
+            }
+
+            execution::bulk_sync_execute(
+                policy.executor(),
+                [&](std::size_t k) {
+                    table_type& table = local[k];
+                    std::size_t const end =
+                        (std::min)((k + 1) * chunk_size, count);
+                    for (std::size_t i = k * chunk_size; i < end; ++i)
+                    {
+                        auto&& key = key_first[i];
+                        table.insert(
+                            mix_key_hash(hpx::util::invoke(hash, key)), key,
+                            values_first[i], func);
+                    }
+                },
+                hpx::util::detail::make_counting_shape(num_chunks));
+
+            if (num_chunks == 1)
+            {
+                return reduce_by_key_write_tables(
+                    policy, local, keys_output, values_output);
+            }
+
+            // use more merge tasks than chunks to balance the load
+            std::size_t const bits = ceil_log2(2 * num_chunks);
+
+            std::vector<table_type> merged;
+            merged.reserve(std::size_t(1) << bits);
+            for (std::size_t p = 0; p != (std::size_t(1) << bits); ++p)
+            {
+                merged.emplace_back(key_eq);
+            }
+
+            execution::bulk_sync_execute(
+                policy.executor(),
+                [&](std::size_t p) {
+                    table_type& table = merged[p];
+                    for (table_type& t : local)
+                    {
+                        auto const& hashes = t.hashes();
+                        for (std::size_t i = 0; i != hashes.size(); ++i)
+                        {
+                            if (key_hash_partition(hashes[i], bits) == p)
+                            {
+                                table.insert(hashes[i], HPX_MOVE(t.keys()[i]),
+                                    HPX_MOVE(t.values()[i]), func);
+                            }
+                        }
+                    }
+                },
+                hpx::util::detail::make_counting_shape(merged.size()));
+
+            return reduce_by_key_write_tables(
+                policy, merged, keys_output, values_output);
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // The input is first partitioned by the high bits of the hashes of
+        // its keys (a single radix pass). The partitions have disjoint sets
+        // of keys and are small enough for their tables to stay in cache,
+        // which makes this variant preferable if the number of distinct keys
+        // is large.
+        template <typename ExPolicy, typename RanIter, typename RanIter2,
+            typename FwdIter1, typename FwdIter2, typename Hash,
+            typename KeyEqual, typename Func>
+        util::in_out_result<FwdIter1, FwdIter2> reduce_by_key_partitioned_impl(
+            ExPolicy&& policy, RanIter key_first, std::size_t count,
+            RanIter2 values_first, FwdIter1 keys_output, FwdIter2 values_output,
+            Hash& hash, KeyEqual& key_eq, Func& func)
+        {
+            using key_type = typename std::iterator_traits<RanIter>::value_type;
+            using value_type =
+                typename std::iterator_traits<RanIter2>::value_type;
+            using table_type = reduce_by_key_table<key_type, value_type,
+                std::decay_t<KeyEqual>>;
+
+            static_assert(std::is_default_constructible_v<key_type> &&
+                    std::is_default_constructible_v<value_type>,
+                "reduce_by_key_partitioned requires default constructible "
+                "keys and values");
+
+            std::size_t const num_chunks = reduce_by_key_chunks(
+                policy, count, reduce_by_key_min_chunk_size);
+            std::size_t const chunk_size =
+                (count + num_chunks - 1) / num_chunks;
+            std::size_t const bits = (std::min)(
+                (std::max)(ceil_log2(count / reduce_by_key_partition_size),
+                    ceil_log2(num_chunks)),
+                reduce_by_key_max_partition_bits);
+            std::size_t const num_partitions = std::size_t(1) << bits;
+
+            auto chunk_begin = [=](std::size_t k) {
+                return (std::min)(k * chunk_size, count);
+            };
+            auto chunks = hpx::util::detail::make_counting_shape(num_chunks);
+
+            // per-chunk histograms of the partitions
+            std::vector<std::uint64_t> hashes(count);
+            std::vector<std::size_t> histograms(num_chunks * num_partitions, 0);
+            execution::bulk_sync_execute(
+                policy.executor(),
+                [&](std::size_t k) {
+                    std::size_t* hist = histograms.data() + k * num_partitions;
+                    std::size_t const end = chunk_begin(k + 1);
+                    for (std::size_t i = chunk_begin(k); i != end; ++i)
+                    {
+                        std::uint64_t const h =
+                            mix_key_hash(hpx::util::invoke(hash, key_first[i]));
+                        hashes[i] = h;
+                        ++hist[key_hash_partition(h, bits)];
+                    }
+                },
+                chunks);
+
+            // Exclusive prefix over (partition, chunk), the elements of
+            // chunk k in partition p follow the elements of all smaller
+            // partitions and of partition p in all preceding chunks.
+            std::vector<std::size_t> partition_begin(num_partitions + 1);
+            std::size_t sum = 0;
+            for (std::size_t p = 0; p != num_partitions; ++p)
+            {
+                partition_begin[p] = sum;
+                for (std::size_t k = 0; k != num_chunks; ++k)
+                {
+                    std::size_t& h = histograms[k * num_partitions + p];
+                    std::size_t const n = h;
+                    h = sum;
+                    sum += n;
+                }
+            }
+            partition_begin.back() = sum;
+            HPX_ASSERT(sum == count);
+
+            std::unique_ptr<std::uint64_t[]> hash_tmp(new std::uint64_t[count]);
+            std::unique_ptr<key_type[]> key_tmp(new key_type[count]);
+            std::unique_ptr<value_type[]> value_tmp(new value_type[count]);
+
+            execution::bulk_sync_execute(
+                policy.executor(),
+                [&](std::size_t k) {
+                    std::size_t* offsets =
+                        histograms.data() + k * num_partitions;
+                    std::size_t const end = chunk_begin(k + 1);
+                    for (std::size_t i = chunk_begin(k); i != end; ++i)
+                    {
+                        std::uint64_t const h = hashes[i];
+                        std::size_t const pos =
+                            offsets[key_hash_partition(h, bits)]++;
+                        hash_tmp[pos] = h;
+                        key_tmp[pos] = key_first[i];
+                        value_tmp[pos] = values_first[i];
+                    }
+                },
+                chunks);
+
+            hashes = std::vector<std::uint64_t>();
+            histograms = std::vector<std::size_t>();
+
+            std::vector<table_type> tables;
+            tables.reserve(num_partitions);
+            for (std::size_t p = 0; p != num_partitions; ++p)
+            {
+                tables.emplace_back(key_eq);
+            }
+
+            execution::bulk_sync_execute(
+                policy.executor(),
+                [&](std::size_t p) {
+                    table_type& table = tables[p];
+                    std::size_t const end = partition_begin[p + 1];
+                    for (std::size_t i = partition_begin[p]; i != end; ++i)
+                    {
+                        table.insert(hash_tmp[i], HPX_MOVE(key_tmp[i]),
+                            HPX_MOVE(value_tmp[i]), func);
+                    }
+                },
+                hpx::util::detail::make_counting_shape(num_partitions));
+
+            return reduce_by_key_write_tables(
+                policy, tables, keys_output, values_output);
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        template <typename FwdIter1, typename FwdIter2, bool Partitioned>
+        struct reduce_by_key_hashed
+          : public detail::algorithm<
+                reduce_by_key_hashed<FwdIter1, FwdIter2, Partitioned>,
+                util::in_out_result<FwdIter1, FwdIter2>>
+        {
+            reduce_by_key_hashed()
+              : reduce_by_key_hashed::algorithm(Partitioned ?
+                        "reduce_by_key_partitioned" :
+                        "reduce_by_key_unsorted")
+            {
+            }
+
+            template <typename ExPolicy, typename RanIter, typename RanIter2,
+                typename Hash, typename KeyEqual, typename Func>
+            static util::in_out_result<FwdIter1, FwdIter2> sequential(
+                ExPolicy&& policy, RanIter key_first, RanIter key_last,
+                RanIter2 values_first, FwdIter1 keys_output,
+                FwdIter2 values_output, Hash&& hash, KeyEqual&& key_eq,
+                Func&& func)
+            {
+                std::size_t const count = std::distance(key_first, key_last);
+                if (count == 0)
+                {
+                    return util::in_out_result<FwdIter1, FwdIter2>{
+                        keys_output, values_output};
+                }
+
+                if constexpr (Partitioned)
+                {
+                    return reduce_by_key_partitioned_impl(policy, key_first,
+                        count, values_first, keys_output, values_output, hash,
+                        key_eq, func);
+                }
+                else
+                {
+                    return reduce_by_key_unsorted_impl(policy, key_first,
+                        count, values_first, keys_output, values_output, hash,
+                        key_eq, func);
+                }
+            }
+
+            template <typename ExPolicy, typename RanIter, typename RanIter2,
+                typename Hash, typename KeyEqual, typename Func>
+            static util::detail::algorithm_result_t<ExPolicy,
+                util::in_out_result<FwdIter1, FwdIter2>>
+            parallel(ExPolicy&& policy, RanIter key_first, RanIter key_last,
+                RanIter2 values_first, FwdIter1 keys_output,
+                FwdIter2 values_output, Hash&& hash, KeyEqual&& key_eq,
+                Func&& func)
+            {
+                using result = util::detail::algorithm_result<ExPolicy,
+                    util::in_out_result<FwdIter1, FwdIter2>>;
+
+                if constexpr (hpx::is_async_execution_policy_v<
+                                  std::decay_t<ExPolicy>>)
+                {
+                    // the internal steps block on the executor, run them on
+                    // a separate task
+                    return result::get(execution::async_execute(
+                        policy.executor(),
+                        [policy = policy(hpx::execution::non_task), key_first,
+                            key_last, values_first, keys_output, values_output,
+                            hash = HPX_FORWARD(Hash, hash),
+                            key_eq = HPX_FORWARD(KeyEqual, key_eq),
+                            func = HPX_FORWARD(Func, func)]() mutable {
+                            return sequential(policy, key_first, key_last,
+                                values_first, keys_output, values_output, hash,
+                                key_eq, func);
+                        }));
+                }
+                else
+                {
+                    return result::get(sequential(policy, key_first, key_last,
+                        values_first, keys_output, values_output, hash, key_eq,
+                        func));
+                }
+            }
+        };
+        /// \endcond
+    }    // namespace detail
+}}}      // namespace hpx::parallel::v1
+
+namespace hpx { namespace experimental {
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Reduce by Key Unsorted reduces the values of all elements with equal
+    /// keys in [key_first, key_last), the keys do not have to be sorted or
+    /// grouped. The algorithm produces a single output key and value for each
+    /// distinct key, the value being the
+    /// GENERALIZED_SUM(func, *(values_first + i), ...) over all i such that
+    /// *(key_first + i) is equal to the key. The number of keys supplied must
+    /// match the number of values.
+    ///
+    /// Every thread reduces its part of the input into a hash table of its
+    /// own, the tables are merged in a final pass. For a large number of
+    /// distinct keys \a reduce_by_key_partitioned is expected to perform
+    /// better.
+    ///
+    /// \note   Complexity: O(\a key_last - \a key_first) applications of
+    ///         \a hash and of \a func.
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the algorithm may be parallelized and the manner
+    ///                     in which it applies user-provided function objects.
+    /// \tparam RanIter     The type of the key iterators used (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     random access iterator.
+    /// \tparam RanIter2    The type of the value iterators used (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     random access iterator.
+    /// \tparam FwdIter1    The type of the iterator representing the
+    ///                     destination key range (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     forward iterator.
+    /// \tparam FwdIter2    The type of the iterator representing the
+    ///                     destination value range (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     forward iterator.
+    /// \tparam Hash        The type of the function object used to hash the
+    ///                     keys (deduced). Assumed to be std::hash otherwise.
+    /// \tparam KeyEqual    The type of the function object used to compare
+    ///                     keys (deduced). Assumed to be std::equal_to
+    ///                     otherwise.
+    /// \tparam Func        The type of the function/function object to use
+    ///                     (deduced). The parallel overloads require \a Hash,
+    ///                     \a KeyEqual and \a Func to meet the requirements of
+    ///                     \a CopyConstructible.
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param key_first    Refers to the beginning of the sequence of key
+    ///                     elements the algorithm will be applied to.
+    /// \param key_last     Refers to the end of the sequence of key elements
+    ///                     the algorithm will be applied to.
+    /// \param values_first Refers to the beginning of the sequence of value
+    ///                     elements the algorithm will be applied to.
+    /// \param keys_output  Refers to the start output location for the keys
+    ///                     produced by the algorithm.
+    /// \param values_output Refers to the start output location for the values
+    ///                     produced by the algorithm.
+    /// \param hash         Specifies the function object returning the hash
+    ///                     value of a key, equal keys must have equal hash
+    ///                     values.
+    /// \param key_eq       Specifies the function object returning true if
+    ///                     the two keys it is invoked with are equal.
+    /// \param func         Specifies the function (or function object) which
+    ///                     will be invoked to combine the values of equal
+    ///                     keys. The signature of this function should be
+    ///                     equivalent to:
+    ///                     \code
+    ///                     Ret fun(const Type1 &a, const Type1 &b);
+    ///                     \endcode \n
+    ///                     The signature does not need to have const&.
+    ///                     \a func has to be associative and commutative as
+    ///                     the values are combined in an unspecified order.
+    ///
+    /// The order of the distinct keys in the output is unspecified.
+    ///
+    /// The application of function objects in parallel algorithm
+    /// invoked with an execution policy object of type
+    /// \a sequenced_policy execute in sequential order in the
+    /// calling thread.
+    ///
+    /// The application of function objects in parallel algorithm
+    /// invoked with an execution policy object of type
+    /// \a parallel_policy or \a parallel_task_policy are
+    /// permitted to execute in an unordered fashion in unspecified
+    /// threads, and indeterminately sequenced within each thread.
+    ///
+    /// \returns  The \a reduce_by_key_unsorted algorithm returns a
+    ///           \a hpx::future<in_out_result<FwdIter1, FwdIter2>> if the
+    ///           execution policy is of type \a sequenced_task_policy or
+    ///           \a parallel_task_policy and returns
+    ///           \a in_out_result<FwdIter1, FwdIter2> otherwise. The result
+    ///           refers to the end of the keys and values written.
+    ///
+    template <typename ExPolicy, typename RanIter, typename RanIter2,
+        typename FwdIter1, typename FwdIter2,
+        typename Hash =
+            std::hash<typename std::iterator_traits<RanIter>::value_type>,
+        typename KeyEqual =
+            std::equal_to<typename std::iterator_traits<RanIter>::value_type>,
+        typename Func =
+            std::plus<typename std::iterator_traits<RanIter2>::value_type>,
+        HPX_CONCEPT_REQUIRES_(hpx::is_execution_policy<ExPolicy>::value&&
+                hpx::traits::is_iterator<RanIter>::value&&
+                    hpx::traits::is_iterator<RanIter2>::value&&
+                        hpx::traits::is_iterator<FwdIter1>::value&&
+                            hpx::traits::is_iterator<FwdIter2>::value)>
+    hpx::parallel::util::detail::algorithm_result_t<ExPolicy,
+        hpx::parallel::util::in_out_result<FwdIter1, FwdIter2>>
+    reduce_by_key_unsorted(ExPolicy&& policy, RanIter key_first,
+        RanIter key_last, RanIter2 values_first, FwdIter1 keys_output,
+        FwdIter2 values_output, Hash&& hash = Hash(),
+        KeyEqual&& key_eq = KeyEqual(), Func&& func = Func())
+    {
+        static_assert(
+            (hpx::traits::is_random_access_iterator<RanIter>::value) &&
+                (hpx::traits::is_random_access_iterator<RanIter2>::value) &&
+                (hpx::traits::is_forward_iterator<FwdIter1>::value) &&
+                (hpx::traits::is_forward_iterator<FwdIter2>::value),
+            "iterators : Random_access for inputs and forward for outputs.");
+
+        return hpx::parallel::v1::detail::reduce_by_key_hashed<FwdIter1,
+            FwdIter2, false>()
+            .call(HPX_FORWARD(ExPolicy, policy), key_first, key_last,
+                values_first, keys_output, values_output,
+                HPX_FORWARD(Hash, hash), HPX_FORWARD(KeyEqual, key_eq),
+                HPX_FORWARD(Func, func));
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Reduce by Key Partitioned has the same effects as
+    /// \a reduce_by_key_unsorted. The input is first partitioned by the high
+    /// bits of the hash values of the keys, every partition is then reduced
+    /// into a hash table of its own. The partitions hold disjoint sets of
+    /// keys and their tables are small enough to stay in cache, which avoids
+    /// the cache misses of large tables if there are many distinct keys.
+    ///
+    /// The keys and values are copied to temporary storage, their types have
+    /// to be default constructible and copy assignable.
+    ///
+    /// \note   Complexity: O(\a key_last - \a key_first) applications of
+    ///         \a hash and of \a func.
+    ///
+    /// The template and function parameters, the requirements and the return
+    /// value are the same as for \a reduce_by_key_unsorted.
+    ///
+    template <typename ExPolicy, typename RanIter, typename RanIter2,
+        typename FwdIter1, typename FwdIter2,
+        typename Hash =
+            std::hash<typename std::iterator_traits<RanIter>::value_type>,
+        typename KeyEqual =
+            std::equal_to<typename std::iterator_traits<RanIter>::value_type>,
+        typename Func =
+            std::plus<typename std::iterator_traits<RanIter2>::value_type>,
+        HPX_CONCEPT_REQUIRES_(hpx::is_execution_policy<ExPolicy>::value&&
+                hpx::traits::is_iterator<RanIter>::value&&
+                    hpx::traits::is_iterator<RanIter2>::value&&
+                        hpx::traits::is_iterator<FwdIter1>::value&&
+                            hpx::traits::is_iterator<FwdIter2>::value)>
+    hpx::parallel::util::detail::algorithm_result_t<ExPolicy,
+        hpx::parallel::util::in_out_result<FwdIter1, FwdIter2>>
+    reduce_by_key_partitioned(ExPolicy&& policy, RanIter key_first,
+        RanIter key_last, RanIter2 values_first, FwdIter1 keys_output,
+        FwdIter2 values_output, Hash&& hash = Hash(),
+        KeyEqual&& key_eq = KeyEqual(), Func&& func = Func())
+    {
+        static_assert(
+            (hpx::traits::is_random_access_iterator<RanIter>::value) &&
+                (hpx::traits::is_random_access_iterator<RanIter2>::value) &&
+                (hpx::traits::is_forward_iterator<FwdIter1>::value) &&
+                (hpx::traits::is_forward_iterator<FwdIter2>::value),
+            "iterators : Random_access for inputs and forward for outputs.");
+
+        return hpx::parallel::v1::detail::reduce_by_key_hashed<FwdIter1,
+            FwdIter2, true>()
+            .call(HPX_FORWARD(ExPolicy, policy), key_first, key_last,
+                values_first, keys_output, values_output,
+                HPX_FORWARD(Hash, hash), HPX_FORWARD(KeyEqual, key_eq),
+                HPX_FORWARD(Func, func));
+    }
+}}    // namespace hpx::experimental
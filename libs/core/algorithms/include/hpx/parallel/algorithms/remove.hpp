@@ -223,19 +223,14 @@ namespace hpx {
 #include <hpx/parallel/algorithms/detail/dispatch.hpp>
 #include <hpx/parallel/algorithms/detail/find.hpp>
 #include <hpx/parallel/algorithms/detail/transfer.hpp>
+#include <hpx/parallel/util/compact_partitioner.hpp>
 #include <hpx/parallel/util/detail/algorithm_result.hpp>
-#include <hpx/parallel/util/detail/clear_container.hpp>
 #include <hpx/parallel/util/foreach_partitioner.hpp>
 #include <hpx/parallel/util/invoke_projected.hpp>
 #include <hpx/parallel/util/loop.hpp>
 #include <hpx/parallel/util/projection_identity.hpp>
 #include <hpx/parallel/util/scan_partitioner.hpp>
 #include <hpx/parallel/util/transfer.hpp>
-#include <hpx/parallel/util/zip_iterator.hpp>
-
-#if !defined(HPX_HAVE_CXX17_SHARED_PTR_ARRAY)
-#include <boost/shared_array.hpp>
-#endif
 
 #include <algorithm>
 #include <cstddef>
@@ -290,125 +285,57 @@ namespace hpx { namespace parallel { inline namespace v1 {
             parallel(ExPolicy&& policy, Iter first, Sent last, Pred&& pred,
                 Proj&& proj)
             {
-                typedef hpx::util::zip_iterator<Iter, bool*> zip_iterator;
-                typedef util::detail::algorithm_result<ExPolicy, Iter>
-                    algorithm_result;
-                typedef typename std::iterator_traits<Iter>::difference_type
-                    difference_type;
+                using algorithm_result =
+                    util::detail::algorithm_result<ExPolicy, Iter>;
 
-                difference_type count = detail::distance(first, last);
+                std::size_t count = detail::distance(first, last);
 
                 if (count == 0)
                     return algorithm_result::get(HPX_MOVE(first));
 
-#if defined(HPX_HAVE_CXX17_SHARED_PTR_ARRAY)
-                std::shared_ptr<bool[]> flags(new bool[count]);
-#else
-                boost::shared_array<bool> flags(new bool[count]);
-#endif
-                std::size_t init = 0u;
-
-                using hpx::get;
-                using hpx::util::make_zip_iterator;
-                typedef util::scan_partitioner<ExPolicy, Iter, std::size_t,
-                    void, util::scan_partitioner_sequential_f3_tag>
-                    scan_partitioner_type;
-
-                // Note: replacing the invoke() with HPX_INVOKE()
-                // below makes gcc generate errors
-                auto f1 = [pred = HPX_FORWARD(Pred, pred),
-                              proj = HPX_FORWARD(Proj, proj)](
-                              zip_iterator part_begin,
-                              std::size_t part_size) -> std::size_t {
-                    // MSVC complains if pred or proj is captured by ref below
-                    util::loop_n<std::decay_t<ExPolicy>>(part_begin, part_size,
-                        [pred, proj](zip_iterator it) mutable {
-                            bool f = hpx::util::invoke(
-                                pred, hpx::util::invoke(proj, get<0>(*it)));
-
-                            get<1>(*it) = f;
-                        });
-
-                    // There is no need to return the partition result.
-                    // But, the scan_partitioner doesn't support 'void' as
-                    // Result1. So, unavoidably return non-meaning value.
-                    return 0u;
-                };
-
-                auto f2 = hpx::unwrapping(
-                    [](std::size_t, std::size_t) -> std::size_t {
-                        // There is no need to propagate the partition
-                        // results. But, the scan_partitioner doesn't
-                        // support 'void' as Result1. So, unavoidably
-                        // return non-meaning value.
-                        return 0u;
-                    });
-
-                std::shared_ptr<Iter> dest_ptr = std::make_shared<Iter>(first);
-                auto f3 =
-                    [dest_ptr, flags](zip_iterator part_begin,
-                        std::size_t part_size,
-                        hpx::shared_future<std::size_t> curr,
-                        hpx::shared_future<std::size_t> next) mutable -> void {
-                    HPX_UNUSED(flags);
-
-                    curr.get();    // rethrow exceptions
-                    next.get();    // rethrow exceptions
-
-                    Iter& dest = *dest_ptr;
-
-                    using execution_policy_type = std::decay_t<ExPolicy>;
-                    if (dest == get<0>(part_begin.get_iterator_tuple()))
-                    {
-                        // Self-assignment must be detected.
-                        util::loop_n<execution_policy_type>(
-                            part_begin, part_size, [&dest](zip_iterator it) {
-                                if (!get<1>(*it))
-                                {
-                                    if (dest != get<0>(it.get_iterator_tuple()))
-                                        *dest++ = HPX_MOVE(get<0>(*it));
-                                    else
-                                        ++dest;
-                                }
-                            });
-                    }
-                    else
+                // step 1 flags the elements to keep
+                auto mark = [pred = HPX_FORWARD(Pred, pred),
+                                proj = HPX_FORWARD(Proj, proj)](Iter part_begin,
+                                std::size_t part_size,
+                                util::detail::compact_flags_writer& flags) {
+                    for (std::size_t i = 0; i != part_size;
+                         (void) ++part_begin, ++i)
                     {
-                        // Self-assignment can't be performed.
-                        util::loop_n<execution_policy_type>(
-                            part_begin, part_size, [&dest](zip_iterator it) {
-                                if (!get<1>(*it))
-                                    *dest++ = HPX_MOVE(get<0>(*it));
-                            });
+                        flags.push(
+                            !HPX_INVOKE(pred, HPX_INVOKE(proj, *part_begin)));
                     }
                 };
 
-                auto f4 =
-                    [dest_ptr, flags](
-                        std::vector<hpx::shared_future<std::size_t>>&& items,
-                        std::vector<hpx::future<void>>&& data) mutable -> Iter {
-                    HPX_UNUSED(flags);
-
-                    // make sure iterators embedded in function object that is
-                    // attached to futures are invalidated
-                    util::detail::clear_container(items);
-                    util::detail::clear_container(data);
-
+                // step 2 moves the kept elements of a partition to their
+                // final position, this is done for one partition after the
+                // other
+                std::shared_ptr<Iter> dest_ptr = std::make_shared<Iter>(first);
+                auto scatter =
+                    [dest_ptr](Iter part_begin, std::size_t part_size,
+                        std::size_t, std::size_t,
+                        util::detail::compact_flags_view const& flags) {
+                        Iter& dest = *dest_ptr;
+                        for (std::size_t i = 0; i != part_size;
+                             (void) ++part_begin, ++i)
+                        {
+                            if (flags[i])
+                            {
+                                // self-assignment must be detected
+                                if (dest != part_begin)
+                                    *dest = HPX_MOVE(*part_begin);
+                                ++dest;
+                            }
+                        }
+                    };
+
+                auto finalize = [dest_ptr](std::size_t) -> Iter {
                     return *dest_ptr;
                 };
 
-                return scan_partitioner_type::call(
-                    HPX_FORWARD(ExPolicy, policy),
-                    make_zip_iterator(first, flags.get()), count, init,
-                    // step 1 performs first part of scan algorithm
-                    HPX_MOVE(f1),
-                    // step 2 propagates the partition results from left
-                    // to right
-                    HPX_MOVE(f2),
-                    // step 3 runs final accumulation on each partition
-                    HPX_MOVE(f3),
-                    // step 4 use this return value
-                    HPX_MOVE(f4));
+                return util::compact_partitioner<ExPolicy, Iter,
+                    util::scan_partitioner_sequential_f3_tag>::
+                    call(HPX_FORWARD(ExPolicy, policy), first, count,
+                        HPX_MOVE(mark), HPX_MOVE(scatter), HPX_MOVE(finalize));
             }
         };
         /// \endcond
@@ -479,12 +479,16 @@ namespace hpx {
 #include <hpx/algorithms/traits/projected.hpp>
 #include <hpx/executors/execution_policy.hpp>
 #include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/algorithms/detail/distance.hpp>
+#include <hpx/parallel/algorithms/detail/replace.hpp>
 #include <hpx/parallel/algorithms/for_each.hpp>
 #include <hpx/parallel/util/detail/algorithm_result.hpp>
+#include <hpx/parallel/util/foreach_partitioner.hpp>
 #include <hpx/parallel/util/projection_identity.hpp>
 #include <hpx/parallel/util/zip_iterator.hpp>
 
 #include <algorithm>
+#include <cstddef>
 #include <iterator>
 #include <type_traits>
 #include <utility>
@@ -495,21 +499,6 @@ namespace hpx { namespace parallel { inline namespace v1 {
     namespace detail {
         /// \cond NOINTERNAL
 
-        // sequential replace
-        template <typename InIter, typename T1, typename T2, typename Proj>
-        inline InIter sequential_replace(InIter first, InIter last,
-            T1 const& old_value, T2 const& new_value, Proj&& proj)
-        {
-            for (/* */; first != last; ++first)
-            {
-                if (HPX_INVOKE(proj, *first) == old_value)
-                {
-                    *first = new_value;
-                }
-            }
-            return first;
-        }
-
         template <typename Iter>
         struct replace : public detail::algorithm<replace<Iter>, Iter>
         {
@@ -520,11 +509,13 @@ namespace hpx { namespace parallel { inline namespace v1 {
 
             template <typename ExPolicy, typename InIter, typename T1,
                 typename T2, typename Proj>
-            static InIter sequential(ExPolicy, InIter first, InIter last,
-                T1 const& old_value, T2 const& new_value, Proj&& proj)
+            static InIter sequential(ExPolicy&& policy, InIter first,
+                InIter last, T1 const& old_value, T2 const& new_value,
+                Proj&& proj)
             {
-                return sequential_replace(
-                    first, last, old_value, new_value, HPX_FORWARD(Proj, proj));
+                return sequential_replace(HPX_FORWARD(ExPolicy, policy), first,
+                    detail::distance(first, last), old_value, new_value,
+                    HPX_FORWARD(Proj, proj));
             }
 
             template <typename ExPolicy, typename FwdIter, typename T1,
@@ -534,17 +525,20 @@ namespace hpx { namespace parallel { inline namespace v1 {
                 parallel(ExPolicy&& policy, FwdIter first, FwdIter last,
                     T1 const& old_value, T2 const& new_value, Proj&& proj)
             {
-                typedef typename std::iterator_traits<FwdIter>::value_type type;
+                if (first == last)
+                {
+                    return util::detail::algorithm_result<ExPolicy,
+                        FwdIter>::get(HPX_MOVE(first));
+                }
 
-                return for_each_n<FwdIter>().call(
+                return util::foreach_partitioner<ExPolicy>::call(
                     HPX_FORWARD(ExPolicy, policy), first,
-                    std::distance(first, last),
-                    [old_value, new_value, proj = HPX_FORWARD(Proj, proj)](
-                        type& t) -> void {
-                        if (HPX_INVOKE(proj, t) == old_value)
-                        {
-                            t = new_value;
-                        }
+                    detail::distance(first, last),
+                    [policy, old_value, new_value,
+                        proj = HPX_FORWARD(Proj, proj)](FwdIter part_begin,
+                        std::size_t part_size, std::size_t) mutable -> void {
+                        sequential_replace(policy, part_begin, part_size,
+                            old_value, new_value, proj);
                     },
                     util::projection_identity());
             }
@@ -583,22 +577,6 @@ namespace hpx { namespace parallel { inline namespace v1 {
     namespace detail {
         /// \cond NOINTERNAL
 
-        // sequential replace_if
-        template <typename InIter, typename Sent, typename F, typename T,
-            typename Proj>
-        inline InIter sequential_replace_if(
-            InIter first, Sent sent, F&& f, T const& new_value, Proj&& proj)
-        {
-            for (/* */; first != sent; ++first)
-            {
-                if (HPX_INVOKE(f, HPX_INVOKE(proj, *first)))
-                {
-                    *first = new_value;
-                }
-            }
-            return first;
-        }
-
         template <typename Iter>
         struct replace_if : public detail::algorithm<replace_if<Iter>, Iter>
         {
@@ -609,10 +587,11 @@ namespace hpx { namespace parallel { inline namespace v1 {
 
             template <typename ExPolicy, typename InIter, typename Sent,
                 typename F, typename T, typename Proj>
-            static InIter sequential(ExPolicy, InIter first, Sent last, F&& f,
-                T const& new_value, Proj&& proj)
+            static InIter sequential(ExPolicy&& policy, InIter first,
+                Sent last, F&& f, T const& new_value, Proj&& proj)
             {
-                return sequential_replace_if(first, last, HPX_FORWARD(F, f),
+                return sequential_replace_if(HPX_FORWARD(ExPolicy, policy),
+                    first, detail::distance(first, last), HPX_FORWARD(F, f),
                     new_value, HPX_FORWARD(Proj, proj));
             }
 
@@ -623,18 +602,20 @@ namespace hpx { namespace parallel { inline namespace v1 {
                 parallel(ExPolicy&& policy, FwdIter first, Sent last, F&& f,
                     T const& new_value, Proj&& proj)
             {
-                typedef typename std::iterator_traits<FwdIter>::value_type type;
+                if (first == last)
+                {
+                    return util::detail::algorithm_result<ExPolicy,
+                        FwdIter>::get(HPX_MOVE(first));
+                }
 
-                return for_each_n<FwdIter>().call(
+                return util::foreach_partitioner<ExPolicy>::call(
                     HPX_FORWARD(ExPolicy, policy), first,
                     detail::distance(first, last),
-                    [new_value, f = HPX_FORWARD(F, f),
-                        proj = HPX_FORWARD(Proj, proj)](
-                        type& t) mutable -> void {
-                        if (HPX_INVOKE(f, HPX_INVOKE(proj, t)))
-                        {
-                            t = new_value;
-                        }
+                    [policy, new_value, f = HPX_FORWARD(F, f),
+                        proj = HPX_FORWARD(Proj, proj)](FwdIter part_begin,
+                        std::size_t part_size, std::size_t) mutable -> void {
+                        sequential_replace_if(
+                            policy, part_begin, part_size, f, new_value, proj);
                     },
                     util::projection_identity());
             }
@@ -958,12 +939,9 @@ namespace hpx {
             static_assert((hpx::traits::is_input_iterator<InIter>::value),
                 "Required at least input iterator.");
 
-            typedef typename std::iterator_traits<InIter>::value_type Type;
-
-            return hpx::replace_if(
-                hpx::execution::seq, first, last,
-                [old_value](Type const& a) -> bool { return old_value == a; },
-                new_value);
+            hpx::parallel::v1::detail::replace<InIter>().call(
+                hpx::execution::sequenced_policy{}, first, last, old_value,
+                new_value, hpx::parallel::util::projection_identity());
         }
 
         // clang-format off
@@ -982,12 +960,10 @@ namespace hpx {
             static_assert((hpx::traits::is_forward_iterator<FwdIter>::value),
                 "Required at least forward iterator.");
 
-            typedef typename std::iterator_traits<FwdIter>::value_type Type;
-
-            return hpx::replace_if(
-                HPX_FORWARD(ExPolicy, policy), first, last,
-                [old_value](Type const& a) -> bool { return old_value == a; },
-                new_value);
+            return parallel::util::detail::algorithm_result<ExPolicy>::get(
+                hpx::parallel::v1::detail::replace<FwdIter>().call(
+                    HPX_FORWARD(ExPolicy, policy), first, last, old_value,
+                    new_value, hpx::parallel::util::projection_identity()));
         }
     } replace{};
 
@@ -244,6 +244,7 @@ namespace hpx {
 #include <hpx/parallel/algorithms/detail/dispatch.hpp>
 #include <hpx/parallel/algorithms/detail/is_sorted.hpp>
 #include <hpx/parallel/algorithms/detail/pivot.hpp>
+#include <hpx/parallel/algorithms/detail/radix_sort.hpp>
 #include <hpx/parallel/util/compare_projected.hpp>
 #include <hpx/parallel/util/detail/algorithm_result.hpp>
 #include <hpx/parallel/util/detail/chunk_size.hpp>
@@ -412,6 +413,23 @@ namespace hpx { namespace parallel { inline namespace v1 {
                 HPX_FORWARD(Comp, comp), chunk_size);
         }
 
+        ///////////////////////////////////////////////////////////////////////
+        // Sort count arithmetic keys (and the corresponding values, if
+        // given) using a parallel radix sort, the returned future becomes
+        // ready with the given result.
+        template <typename ExPolicy, typename KeyIter, typename ValueIter,
+            typename Result>
+        hpx::future<Result> parallel_radix_sort_async(ExPolicy&& policy,
+            KeyIter first, std::size_t count, ValueIter values, Result result)
+        {
+            return execution::async_execute(policy.executor(),
+                [policy = HPX_FORWARD(ExPolicy, policy), first, count, values,
+                    result]() mutable -> Result {
+                    parallel_radix_sort(policy, first, count, values);
+                    return result;
+                });
+        }
+
         ///////////////////////////////////////////////////////////////////////
         // sort
         template <typename RandomIt>
@@ -446,6 +464,21 @@ namespace hpx { namespace parallel { inline namespace v1 {
 
                 try
                 {
+                    // arithmetic keys sorted in ascending order are handled
+                    // by the radix sort
+                    if constexpr (use_radix_sort_v<ExPolicy, RandomIt, Comp,
+                                      Proj>)
+                    {
+                        std::size_t const count = last - first;
+                        if (count >= radix_sort_limit)
+                        {
+                            return algorithm_result::get(
+                                parallel_radix_sort_async(
+                                    HPX_FORWARD(ExPolicy, policy), first,
+                                    count, radix_no_values{}, last));
+                        }
+                    }
+
                     // call the sort routine and return the right type,
                     // depending on execution policy
                     return algorithm_result::get(parallel_sort_async(
@@ -14,6 +14,7 @@
 #include <hpx/parallel/util/zip_iterator.hpp>
 
 #include <algorithm>
+#include <cstddef>
 #include <iterator>
 #include <type_traits>
 #include <utility>
@@ -136,6 +137,36 @@ namespace hpx { namespace parallel { inline namespace v1 {
 
         using iterator_type = hpx::util::zip_iterator<KeyIter, ValueIter>;
 
+        // arithmetic keys sorted in ascending order are handled by the radix
+        // sort
+        if constexpr (detail::use_radix_sort_v<ExPolicy, KeyIter, Compare> &&
+            detail::can_radix_sort_values_v<ValueIter>)
+        {
+            std::size_t const count = std::distance(key_first, key_last);
+            if (count >= detail::radix_sort_limit)
+            {
+                using algorithm_result =
+                    util::detail::algorithm_result<ExPolicy, iterator_type>;
+                try
+                {
+                    return detail::get_iter_pair<iterator_type>(
+                        algorithm_result::get(detail::parallel_radix_sort_async(
+                            HPX_FORWARD(ExPolicy, policy), key_first, count,
+                            value_first,
+                            hpx::util::make_zip_iterator(
+                                key_last, value_last))));
+                }
+                catch (...)
+                {
+                    using handle_exception =
+                        detail::handle_exception<ExPolicy, iterator_type>;
+                    return detail::get_iter_pair<iterator_type>(
+                        algorithm_result::get(handle_exception::call(
+                            std::current_exception())));
+                }
+            }
+        }
+
         return detail::get_iter_pair<iterator_type>(
             detail::sort<iterator_type>().call(HPX_FORWARD(ExPolicy, policy),
                 hpx::util::make_zip_iterator(key_first, value_first),
@@ -347,7 +347,8 @@ namespace hpx { namespace parallel { inline namespace v1 {
                         });
                 };
 
-                return util::scan_partitioner<ExPolicy, result_type, T>::call(
+                return util::scan_partitioner<ExPolicy, result_type, T, void,
+                    util::scan_partitioner_single_pass_tag>::call(
                     HPX_FORWARD(ExPolicy, policy),
                     make_zip_iterator(first, dest), count, init,
                     // step 1 performs first part of scan algorithm
@@ -472,19 +472,14 @@ namespace hpx {
 #include <hpx/parallel/algorithms/detail/dispatch.hpp>
 #include <hpx/parallel/algorithms/detail/distance.hpp>
 #include <hpx/parallel/algorithms/detail/transfer.hpp>
+#include <hpx/parallel/util/compact_partitioner.hpp>
 #include <hpx/parallel/util/detail/algorithm_result.hpp>
-#include <hpx/parallel/util/detail/clear_container.hpp>
 #include <hpx/parallel/util/detail/sender_util.hpp>
 #include <hpx/parallel/util/foreach_partitioner.hpp>
 #include <hpx/parallel/util/loop.hpp>
 #include <hpx/parallel/util/projection_identity.hpp>
 #include <hpx/parallel/util/scan_partitioner.hpp>
 #include <hpx/parallel/util/transfer.hpp>
-#include <hpx/parallel/util/zip_iterator.hpp>
-
-#if !defined(HPX_HAVE_CXX17_SHARED_PTR_ARRAY)
-#include <boost/shared_array.hpp>
-#endif
 
 #include <algorithm>
 #include <cstddef>
@@ -553,13 +548,10 @@ namespace hpx { namespace parallel { inline namespace v1 {
                 parallel(ExPolicy&& policy, FwdIter first, Sent last,
                     Pred&& pred, Proj&& proj)
             {
-                using zip_iterator = hpx::util::zip_iterator<FwdIter, bool*>;
                 using algorithm_result =
                     util::detail::algorithm_result<ExPolicy, FwdIter>;
-                using difference_type =
-                    typename std::iterator_traits<FwdIter>::difference_type;
 
-                difference_type count = detail::distance(first, last);
+                std::size_t count = detail::distance(first, last);
 
                 if (count < 2)
                 {
@@ -567,130 +559,55 @@ namespace hpx { namespace parallel { inline namespace v1 {
                     return algorithm_result::get(HPX_MOVE(first));
                 }
 
-#if defined(HPX_HAVE_CXX17_SHARED_PTR_ARRAY)
-                std::shared_ptr<bool[]> flags(new bool[count]);
-#else
-                boost::shared_array<bool> flags(new bool[count]);
-#endif
-                std::size_t init = 0u;
-
-                flags[0] = false;
-
-                using hpx::get;
-                using hpx::util::make_zip_iterator;
-                using scan_partitioner_type =
-                    util::scan_partitioner<ExPolicy, FwdIter, std::size_t, void,
-                        util::scan_partitioner_sequential_f3_tag>;
-
-                auto f1 = [pred = HPX_FORWARD(Pred, pred),
-                              proj = HPX_FORWARD(Proj, proj)](
-                              zip_iterator part_begin,
-                              std::size_t part_size) -> std::size_t {
-                    FwdIter base = get<0>(part_begin.get_iterator_tuple());
-
-                    // Note: replacing the invoke() with HPX_INVOKE()
-                    // below makes gcc generate errors
-
-                    // MSVC complains if pred or proj is captured by ref below
-                    util::loop_n<std::decay_t<ExPolicy>>(++part_begin,
-                        part_size,
-                        [base, pred, proj](zip_iterator it) mutable -> void {
-                            bool f = hpx::util::invoke(pred,
-                                hpx::util::invoke(proj, *base),
-                                hpx::util::invoke(proj, get<0>(*it)));
-
-                            if (!(get<1>(*it) = f))
-                                base = get<0>(it.get_iterator_tuple());
-                        });
-
-                    // There is no need to return the partition result.
-                    // But, the scan_partitioner doesn't support 'void' as
-                    // Result1. So, unavoidably return non-meaning value.
-                    return 0u;
-                };
-
-                std::shared_ptr<FwdIter> dest_ptr =
-                    std::make_shared<FwdIter>(first);
-                auto f3 =
-                    [dest_ptr, flags](zip_iterator part_begin,
-                        std::size_t part_size,
-                        hpx::shared_future<std::size_t> curr,
-                        hpx::shared_future<std::size_t> next) mutable -> void {
-                    HPX_UNUSED(flags);
-
-                    curr.get();    // rethrow exceptions
-                    next.get();    // rethrow exceptions
-
-                    FwdIter& dest = *dest_ptr;
-
-                    using execution_policy_type = std::decay_t<ExPolicy>;
-                    if (dest == get<0>(part_begin.get_iterator_tuple()))
-                    {
-                        // Self-assignment must be detected.
-                        util::loop_n<execution_policy_type>(
-                            part_begin, part_size, [&dest](zip_iterator it) {
-                                if (!get<1>(*it))
-                                {
-                                    if (dest != get<0>(it.get_iterator_tuple()))
-                                        *dest++ = HPX_MOVE(get<0>(*it));
-                                    else
-                                        ++dest;
-                                }
-                            });
-                    }
-                    else
+                // step 1 flags the elements to keep, the flag of the element
+                // following the partition's first element is recorded first
+                auto mark = [pred = HPX_FORWARD(Pred, pred),
+                                proj = HPX_FORWARD(Proj, proj)](
+                                FwdIter part_begin, std::size_t part_size,
+                                util::detail::compact_flags_writer& flags) {
+                    FwdIter base = part_begin;
+                    for (std::size_t i = 0; i != part_size; ++i)
                     {
-                        // Self-assignment can't be performed.
-                        util::loop_n<execution_policy_type>(
-                            part_begin, part_size, [&dest](zip_iterator it) {
-                                if (!get<1>(*it))
-                                    *dest++ = HPX_MOVE(get<0>(*it));
-                            });
+                        bool const keep = !HPX_INVOKE(pred,
+                            HPX_INVOKE(proj, *base),
+                            HPX_INVOKE(proj, *++part_begin));
+                        if (keep)
+                            base = part_begin;
+                        flags.push(keep);
                     }
                 };
 
-                auto f4 =
-                    [dest_ptr = HPX_MOVE(dest_ptr), first, count, flags](
-                        std::vector<hpx::shared_future<std::size_t>>&& items,
-                        std::vector<hpx::future<void>>&& data) mutable
-                    -> FwdIter {
-                    // make sure iterators embedded in function object that is
-                    // attached to futures are invalidated
-                    util::detail::clear_container(items);
-                    util::detail::clear_container(data);
-
-                    if (!flags[count - 1])
-                    {
-                        std::advance(first, count - 1);
-                        if (first != (*dest_ptr))
-                            *(*dest_ptr)++ = HPX_MOVE(*first);
-                        else
-                            ++(*dest_ptr);
-                    }
+                // step 2 moves the kept elements of a partition to their
+                // final position, this is done for one partition after the
+                // other, the first element is always kept
+                std::shared_ptr<FwdIter> dest_ptr =
+                    std::make_shared<FwdIter>(std::next(first));
+                auto scatter =
+                    [dest_ptr](FwdIter part_begin, std::size_t part_size,
+                        std::size_t, std::size_t,
+                        util::detail::compact_flags_view const& flags) {
+                        FwdIter& dest = *dest_ptr;
+                        for (std::size_t i = 0; i != part_size; ++i)
+                        {
+                            ++part_begin;
+                            if (flags[i])
+                            {
+                                // self-assignment must be detected
+                                if (dest != part_begin)
+                                    *dest = HPX_MOVE(*part_begin);
+                                ++dest;
+                            }
+                        }
+                    };
+
+                auto finalize = [dest_ptr](std::size_t) -> FwdIter {
                     return *dest_ptr;
                 };
 
-                return scan_partitioner_type::call(
-                    HPX_FORWARD(ExPolicy, policy),
-                    make_zip_iterator(first, flags.get()), count - 1, init,
-                    // step 1 performs first part of scan algorithm
-                    HPX_MOVE(f1),
-                    // step 2 propagates the partition results from left
-                    // to right
-                    [](hpx::shared_future<std::size_t> fut1,
-                        hpx::shared_future<std::size_t> fut2) -> std::size_t {
-                        fut1.get();
-                        fut2.get();    // propagate exceptions
-                        // There is no need to propagate the partition
-                        // results. But, the scan_partitioner doesn't
-                        // support 'void' as Result1. So, unavoidably
-                        // return non-meaning value.
-                        return 0u;
-                    },
-                    // step 3 runs final accumulation on each partition
-                    HPX_MOVE(f3),
-                    // step 4 use this return value
-                    HPX_MOVE(f4));
+                return util::compact_partitioner<ExPolicy, FwdIter,
+                    util::scan_partitioner_sequential_f3_tag>::
+                    call(HPX_FORWARD(ExPolicy, policy), first, count - 1,
+                        HPX_MOVE(mark), HPX_MOVE(scatter), HPX_MOVE(finalize));
             }
         };
         /// \endcond
@@ -825,107 +742,70 @@ namespace hpx { namespace parallel { inline namespace v1 {
             parallel(ExPolicy&& policy, FwdIter1 first, Sent last,
                 FwdIter2 dest, Pred&& pred, Proj&& proj)
             {
-                using zip_iterator = hpx::util::zip_iterator<FwdIter1, bool*>;
+                using result_type = unique_copy_result<FwdIter1, FwdIter2>;
                 using algorithm_result =
-                    util::detail::algorithm_result<ExPolicy,
-                        unique_copy_result<FwdIter1, FwdIter2>>;
-                using difference_type =
-                    typename std::iterator_traits<FwdIter1>::difference_type;
+                    util::detail::algorithm_result<ExPolicy, result_type>;
 
                 auto last_iter = first;
-                difference_type count =
+                std::size_t count =
                     detail::advance_and_get_distance(last_iter, last);
 
                 if (count == 0)
                     return algorithm_result::get(
-                        unique_copy_result<FwdIter1, FwdIter2>{
-                            HPX_MOVE(first), HPX_MOVE(dest)});
+                        result_type{HPX_MOVE(first), HPX_MOVE(dest)});
 
                 *dest++ = *first;
 
                 if (count == 1)
                 {
-                    return algorithm_result::get(unique_copy_result<FwdIter1,
-                        FwdIter2>{
+                    return algorithm_result::get(result_type{
                         // NOLINTNEXTLINE(bugprone-macro-repeated-side-effects)
                         HPX_MOVE(++first), HPX_MOVE(dest)});
                 }
 
-#if defined(HPX_HAVE_CXX17_SHARED_PTR_ARRAY)
-                std::shared_ptr<bool[]> flags(new bool[count - 1]);
-#else
-                boost::shared_array<bool> flags(new bool[count - 1]);
-#endif
-                std::size_t init = 0;
-
-                using hpx::get;
-                using hpx::util::make_zip_iterator;
-                using scan_partitioner_type = util::scan_partitioner<ExPolicy,
-                    unique_copy_result<FwdIter1, FwdIter2>, std::size_t>;
-
-                auto f1 = [pred = HPX_FORWARD(Pred, pred),
-                              proj = HPX_FORWARD(Proj, proj)](
-                              zip_iterator part_begin,
-                              std::size_t part_size) -> std::size_t {
-                    FwdIter1 base = get<0>(part_begin.get_iterator_tuple());
-                    std::size_t curr = 0;
-
-                    // MSVC complains if pred or proj is captured by ref below
-                    util::loop_n<std::decay_t<ExPolicy>>(
-                        ++part_begin, part_size, [&](zip_iterator it) mutable {
-                            bool f = HPX_INVOKE(pred, HPX_INVOKE(proj, *base),
-                                HPX_INVOKE(proj, get<0>(*it)));
-
-                            if (!(get<1>(*it) = f))
-                            {
-                                base = get<0>(it.get_iterator_tuple());
-                                ++curr;
-                            }
-                        });
-
-                    return curr;
-                };
-                auto f3 = [dest, flags](zip_iterator part_begin,
-                              std::size_t part_size,
-                              std::size_t val) mutable -> void {
-                    HPX_UNUSED(flags);
-                    std::advance(dest, val);
-                    util::loop_n<std::decay_t<ExPolicy>>(++part_begin,
-                        part_size, [&dest](zip_iterator it) mutable {
-                            if (!get<1>(*it))
-                                *dest++ = get<0>(*it);
-                        });
+                // step 1 flags the elements to copy, the flag of the element
+                // following the partition's first element is recorded first
+                auto mark = [pred = HPX_FORWARD(Pred, pred),
+                                proj = HPX_FORWARD(Proj, proj)](
+                                FwdIter1 part_begin, std::size_t part_size,
+                                util::detail::compact_flags_writer& flags) {
+                    FwdIter1 base = part_begin;
+                    for (std::size_t i = 0; i != part_size; ++i)
+                    {
+                        bool const keep = !HPX_INVOKE(pred,
+                            HPX_INVOKE(proj, *base),
+                            HPX_INVOKE(proj, *++part_begin));
+                        if (keep)
+                            base = part_begin;
+                        flags.push(keep);
+                    }
                 };
 
-                auto f4 = [last_iter, dest, flags](
-                              std::vector<std::size_t>&& items,
-                              std::vector<hpx::future<void>>&& data) mutable
-                    -> unique_copy_result<FwdIter1, FwdIter2> {
-                    HPX_UNUSED(flags);
-
-                    std::advance(dest, items.back());
-
-                    // make sure iterators embedded in function object that is
-                    // attached to futures are invalidated
-                    util::detail::clear_container(data);
-
-                    return unique_copy_result<FwdIter1, FwdIter2>{
-                        HPX_MOVE(last_iter), HPX_MOVE(dest)};
+                // step 2 copies the flagged elements of a partition to their
+                // final position
+                auto scatter =
+                    [dest](FwdIter1 part_begin, std::size_t part_size,
+                        std::size_t, std::size_t offset,
+                        util::detail::compact_flags_view const& flags) {
+                        FwdIter2 out = dest;
+                        std::advance(out, offset);
+                        for (std::size_t i = 0; i != part_size; ++i)
+                        {
+                            ++part_begin;
+                            if (flags[i])
+                                *out++ = *part_begin;
+                        }
+                    };
+
+                auto finalize = [last_iter, dest](
+                                    std::size_t total) mutable -> result_type {
+                    std::advance(dest, total);
+                    return result_type{HPX_MOVE(last_iter), HPX_MOVE(dest)};
                 };
 
-                return scan_partitioner_type::call(
-                    HPX_FORWARD(ExPolicy, policy),
-                    //make_zip_iterator(first, flags.get() - 1),
-                    make_zip_iterator(first, flags.get() - 1), count - 1, init,
-                    // step 1 performs first part of scan algorithm
-                    HPX_MOVE(f1),
-                    // step 2 propagates the partition results from left
-                    // to right
-                    std::plus<std::size_t>(),
-                    // step 3 runs final accumulation on each partition
-                    HPX_MOVE(f3),
-                    // step 4 use this return value
-                    HPX_MOVE(f4));
+                return util::compact_partitioner<ExPolicy, result_type>::call(
+                    HPX_FORWARD(ExPolicy, policy), first, count - 1,
+                    HPX_MOVE(mark), HPX_MOVE(scatter), HPX_MOVE(finalize));
             }
         };
         /// \endcond
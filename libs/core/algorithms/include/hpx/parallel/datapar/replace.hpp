@@ -0,0 +1,91 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_DATAPAR)
+#include <hpx/concepts/concepts.hpp>
+#include <hpx/execution/traits/is_execution_policy.hpp>
+#include <hpx/execution/traits/vector_pack_conditionals.hpp>
+#include <hpx/functional/invoke.hpp>
+#include <hpx/functional/tag_invoke.hpp>
+#include <hpx/parallel/algorithms/detail/replace.hpp>
+#include <hpx/parallel/datapar/loop.hpp>
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace hpx { namespace parallel { inline namespace v1 { namespace detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    struct datapar_replace
+    {
+        template <typename ExPolicy, typename Iter, typename T1, typename T2,
+            typename Proj>
+        HPX_HOST_DEVICE HPX_FORCEINLINE static Iter call(Iter first,
+            std::size_t count, T1 const& old_value, T2 const& new_value,
+            Proj&& proj)
+        {
+            // the elements to replace are selected by a mask, which avoids
+            // branching on every element
+            return util::loop_n_ind<std::decay_t<ExPolicy>>(
+                first, count, [&](auto& v) {
+                    using vector_type = std::decay_t<decltype(v)>;
+                    traits::mask_assign(HPX_INVOKE(proj, v) == old_value, v,
+                        vector_type(new_value));
+                });
+        }
+    };
+
+    template <typename ExPolicy, typename Iter, typename T1, typename T2,
+        typename Proj,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::is_vectorpack_execution_policy<ExPolicy>::value&&
+                hpx::parallel::util::detail::iterator_datapar_compatible<
+                    Iter>::value)>
+    HPX_HOST_DEVICE HPX_FORCEINLINE Iter tag_invoke(sequential_replace_t,
+        ExPolicy&&, Iter first, std::size_t count, T1 const& old_value,
+        T2 const& new_value, Proj&& proj)
+    {
+        return datapar_replace::call<ExPolicy>(
+            first, count, old_value, new_value, HPX_FORWARD(Proj, proj));
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    struct datapar_replace_if
+    {
+        template <typename ExPolicy, typename Iter, typename F, typename T,
+            typename Proj>
+        HPX_HOST_DEVICE HPX_FORCEINLINE static Iter call(Iter first,
+            std::size_t count, F&& f, T const& new_value, Proj&& proj)
+        {
+            return util::loop_n_ind<std::decay_t<ExPolicy>>(
+                first, count, [&](auto& v) {
+                    using vector_type = std::decay_t<decltype(v)>;
+                    traits::mask_assign(HPX_INVOKE(f, HPX_INVOKE(proj, v)), v,
+                        vector_type(new_value));
+                });
+        }
+    };
+
+    template <typename ExPolicy, typename Iter, typename F, typename T,
+        typename Proj,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::is_vectorpack_execution_policy<ExPolicy>::value&&
+                hpx::parallel::util::detail::iterator_datapar_compatible<
+                    Iter>::value)>
+    HPX_HOST_DEVICE HPX_FORCEINLINE Iter tag_invoke(sequential_replace_if_t,
+        ExPolicy&&, Iter first, std::size_t count, F&& f, T const& new_value,
+        Proj&& proj)
+    {
+        return datapar_replace_if::call<ExPolicy>(first, count,
+            HPX_FORWARD(F, f), new_value, HPX_FORWARD(Proj, proj));
+    }
+}}}}    // namespace hpx::parallel::v1::detail
+#endif
@@ -100,8 +100,11 @@ namespace hpx { namespace parallel { inline namespace v2 {
 
         friend struct detail::define_task_block_impl;
 
-        explicit task_block(ExPolicy const& policy = ExPolicy())
-          : id_(threads::get_self_id())
+        explicit task_block(ExPolicy const& policy = ExPolicy(),
+            hpx::execution::experimental::task_group_mode mode =
+                hpx::execution::experimental::task_group_mode::help_first)
+          : tasks_(mode)
+          , id_(threads::get_self_id())
           , policy_(policy)
         {
         }
@@ -312,12 +315,22 @@ namespace hpx { namespace parallel { inline namespace v2 {
         {
             template <typename ExPolicy, typename F>
             void operator()(ExPolicy&& policy, F&& f) const
+            {
+                (*this)(hpx::execution::experimental::task_group_mode::
+                            help_first,
+                    HPX_FORWARD(ExPolicy, policy), HPX_FORWARD(F, f));
+            }
+
+            template <typename ExPolicy, typename F>
+            void operator()(hpx::execution::experimental::task_group_mode mode,
+                ExPolicy&& policy, F&& f) const
             {
                 static_assert(hpx::is_execution_policy<ExPolicy>::value,
                     "hpx::is_execution_policy<ExPolicy>::value");
 
                 using policy_type = typename std::decay<ExPolicy>::type;
-                task_block<policy_type> trh(HPX_FORWARD(ExPolicy, policy));
+                task_block<policy_type> trh(
+                    HPX_FORWARD(ExPolicy, policy), mode);
 
                 // invoke the user supplied function
                 std::exception_ptr p;
@@ -394,6 +407,61 @@ namespace hpx { namespace parallel { inline namespace v2 {
             HPX_FORWARD(ExPolicy, policy), HPX_FORWARD(F, f));
     }
 
+    /// Constructs a \a task_block, \a tr, using the given execution policy
+    /// \a policy, and invokes the expression \a f(tr) on the user-provided
+    /// object, \a f. The tasks spawned from \a f are scheduled as described
+    /// by \a mode.
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the task block may be parallelized.
+    /// \tparam F   The type of the user defined function to invoke inside the
+    ///             define_task_block (deduced). \a F shall be MoveConstructible.
+    ///
+    /// \param mode         Selects whether the tasks spawned by tr.run are
+    ///                     always run on new threads
+    ///                     (\a task_group_mode::help_first) or may be run
+    ///                     inline by the spawning task
+    ///                     (\a task_group_mode::work_first).
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param f    The user defined function to invoke inside the task block.
+    ///             Given an lvalue \a tr of type \a task_block, the
+    ///             expression, (void)f(tr), shall be well-formed.
+    ///
+    /// Postcondition: All tasks spawned from \a f have finished execution.
+    ///                A call to define_task_block may return on a different
+    ///                thread than that on which it was called.
+    ///
+    /// \throws An \a exception_list, as specified in Exception Handling.
+    ///
+    // clang-format off
+    template <typename ExPolicy, typename F,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::is_async_execution_policy<std::decay_t<ExPolicy>>::value
+        )>
+    // clang-format on
+    hpx::future<void> define_task_block(
+        hpx::execution::experimental::task_group_mode mode, ExPolicy&& policy,
+        F&& f)
+    {
+        return hpx::async(policy.executor(), detail::define_task_block, mode,
+            HPX_FORWARD(ExPolicy, policy), HPX_FORWARD(F, f));
+    }
+
+    // clang-format off
+    template <typename ExPolicy, typename F,
+        HPX_CONCEPT_REQUIRES_(
+            !hpx::is_async_execution_policy<std::decay_t<ExPolicy>>::value
+        )>
+    // clang-format on
+    void define_task_block(hpx::execution::experimental::task_group_mode mode,
+        ExPolicy&& policy, F&& f)
+    {
+        detail::define_task_block(
+            mode, HPX_FORWARD(ExPolicy, policy), HPX_FORWARD(F, f));
+    }
+
     /// Constructs a \a task_block, tr, and invokes the expression
     /// \a f(tr) on the user-provided object, \a f. This version uses
     /// \a parallel_policy for task scheduling.
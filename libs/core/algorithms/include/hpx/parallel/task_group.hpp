@@ -17,11 +17,13 @@
 #include <hpx/execution_base/execution.hpp>
 #include <hpx/execution_base/traits/is_executor.hpp>
 #include <hpx/executors/parallel_executor.hpp>
+#include <hpx/functional/invoke.hpp>
 #include <hpx/functional/invoke_fused.hpp>
 #include <hpx/futures/detail/future_data.hpp>
 #include <hpx/modules/memory.hpp>
 #include <hpx/serialization/serialization_fwd.hpp>
 #include <hpx/synchronization/latch.hpp>
+#include <hpx/threading_base/thread_helpers.hpp>
 #include <hpx/type_support/unused.hpp>
 
 #include <atomic>
@@ -32,11 +34,30 @@
 
 namespace hpx { namespace execution { namespace experimental {
 
+    ///////////////////////////////////////////////////////////////////////////
+    // Selects how task_group::run schedules the spawned tasks.
+    enum class task_group_mode
+    {
+        // Every task is spawned as a new HPX thread, the spawning task
+        // continues right away (the default).
+        help_first,
+
+        // The spawning task runs the new task inline as long as the worker
+        // executing it has other work queued that idle workers can steal and
+        // the nesting of inline invocations stays within the limits for
+        // running continuations inline (hpx.continuation_max_recursion_depth
+        // and hpx.continuation_stack_budget). Otherwise the task is spawned
+        // as a new HPX thread. This creates far fewer threads for recursive
+        // divide-and-conquer algorithms.
+        work_first
+    };
+
     ///////////////////////////////////////////////////////////////////////////
     class task_group
     {
     public:
         HPX_CORE_EXPORT task_group();
+        HPX_CORE_EXPORT explicit task_group(task_group_mode mode);
         HPX_CORE_EXPORT ~task_group();
 
     private:
@@ -64,6 +85,16 @@ namespace hpx { namespace execution { namespace experimental {
         // clang-format on
         void run(Executor&& exec, F&& f, Ts&&... ts)
         {
+            if (mode_ == task_group_mode::work_first)
+            {
+                threads::detail::continuation_recursion_scope cnt;
+                if (cnt.can_run_inline() && has_pending_local_work())
+                {
+                    run_inline(HPX_FORWARD(F, f), HPX_FORWARD(Ts, ts)...);
+                    return;
+                }
+            }
+
             // make sure exceptions don't leave the latch in the wrong state
             on_exit l(*this);
 
@@ -109,7 +140,37 @@ namespace hpx { namespace execution { namespace experimental {
         // Add an exception to this task_group
         HPX_CORE_EXPORT void add_exception(std::exception_ptr p);
 
+        // Returns how this task_group schedules the spawned tasks
+        task_group_mode mode() const noexcept
+        {
+            return mode_;
+        }
+
     private:
+        // Returns whether the worker executing the calling thread has other
+        // threads queued
+        HPX_CORE_EXPORT static bool has_pending_local_work() noexcept;
+
+        template <typename F, typename... Ts>
+        void run_inline(F&& f, Ts&&... ts)
+        {
+            // a reused task_group has to be waited for again
+            on_exit _(*this);
+
+            std::exception_ptr p;
+            try
+            {
+                HPX_INVOKE(HPX_FORWARD(F, f), HPX_FORWARD(Ts, ts)...);
+                return;
+            }
+            catch (...)
+            {
+                p = std::current_exception();
+            }
+
+            add_exception(HPX_MOVE(p));
+        }
+
         friend class serialization::access;
 
         HPX_CORE_EXPORT void serialize(
@@ -124,5 +185,6 @@ namespace hpx { namespace execution { namespace experimental {
         hpx::intrusive_ptr<shared_state_type> state_;
         hpx::exception_list errors_;
         std::atomic<bool> has_arrived_;
+        task_group_mode mode_;
     };
 }}}    // namespace hpx::execution::experimental
@@ -0,0 +1,312 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/futures/future.hpp>
+#include <hpx/iterator_support/iterator_facade.hpp>
+#include <hpx/parallel/util/detail/algorithm_result.hpp>
+#include <hpx/parallel/util/detail/clear_container.hpp>
+#include <hpx/parallel/util/scan_partitioner.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx { namespace parallel { namespace util {
+
+    // The compaction (stream filtering) algorithms store one bit per element
+    // to record which elements are kept. The elements are grouped into
+    // blocks of this size and the partitions always consist of whole blocks,
+    // which makes every partition the sole owner of the words holding its
+    // flags.
+    inline constexpr std::size_t compact_block_size = 1024;
+
+    namespace detail {
+        inline constexpr std::size_t compact_word_bits = 64;
+
+        static_assert(compact_block_size % compact_word_bits == 0,
+            "the block size has to be a multiple of the bits per word");
+
+        ///////////////////////////////////////////////////////////////////////
+        // Iterator over the blocks of a sequence, dereferencing it yields the
+        // iterator referring to the first element of the current block.
+        template <typename FwdIter>
+        class compact_block_iterator
+          : public hpx::util::iterator_facade<compact_block_iterator<FwdIter>,
+                FwdIter const, std::forward_iterator_tag>
+        {
+            using base_type =
+                hpx::util::iterator_facade<compact_block_iterator<FwdIter>,
+                    FwdIter const, std::forward_iterator_tag>;
+
+        public:
+            compact_block_iterator() = default;
+
+            compact_block_iterator(
+                FwdIter it, std::size_t count, std::size_t pos = 0)
+              : it_(it)
+              , count_(count)
+              , pos_(pos)
+            {
+            }
+
+            // index of the first element of the current block
+            constexpr std::size_t position() const noexcept
+            {
+                return pos_;
+            }
+
+            // number of elements starting at the current block and spanning
+            // the given number of blocks
+            constexpr std::size_t elements(std::size_t blocks) const noexcept
+            {
+                return (std::min)(blocks * compact_block_size, count_ - pos_);
+            }
+
+        private:
+            friend class hpx::util::iterator_core_access;
+
+            bool equal(compact_block_iterator const& other) const noexcept
+            {
+                return pos_ == other.pos_;
+            }
+
+            typename base_type::reference dereference() const noexcept
+            {
+                return it_;
+            }
+
+            void increment()
+            {
+                std::size_t const n = elements(1);
+                std::advance(it_, n);
+                pos_ += n;
+            }
+
+            FwdIter it_;
+            std::size_t count_ = 0;
+            std::size_t pos_ = 0;
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        // Records the flags of consecutive elements starting at a word
+        // boundary.
+        class compact_flags_writer
+        {
+        public:
+            explicit compact_flags_writer(std::uint64_t* words) noexcept
+              : words_(words)
+            {
+            }
+
+            void push(bool flag) noexcept
+            {
+                word_ |= std::uint64_t(flag) << bit_;
+                count_ += flag;
+                if (++bit_ == compact_word_bits)
+                {
+                    *words_++ = word_;
+                    word_ = 0;
+                    bit_ = 0;
+                }
+            }
+
+            // store the last partial word, return the number of set flags
+            std::size_t finish() noexcept
+            {
+                if (bit_ != 0)
+                {
+                    *words_ = word_;
+                }
+                return count_;
+            }
+
+        private:
+            std::uint64_t* words_;
+            std::uint64_t word_ = 0;
+            std::size_t bit_ = 0;
+            std::size_t count_ = 0;
+        };
+
+        // Read access to the flags of consecutive elements starting at a word
+        // boundary.
+        class compact_flags_view
+        {
+        public:
+            explicit compact_flags_view(std::uint64_t const* words) noexcept
+              : words_(words)
+            {
+            }
+
+            bool operator[](std::size_t i) const noexcept
+            {
+                return (words_[i / compact_word_bits] >>
+                           (i % compact_word_bits)) &
+                    1;
+            }
+
+        private:
+            std::uint64_t const* words_;
+        };
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Run a stream compaction over count elements starting at first.
+    //
+    //  mark(part_begin, part_size, writer) pushes one flag per element of a
+    //      partition to the writer, in order.
+    //  scatter(part_begin, part_size, base_idx, offset, flags) handles the
+    //      partition starting at the element base_idx, where offset is the
+    //      number of flags set for all preceding elements. flags[i] is the
+    //      flag of the element base_idx + i.
+    //  finalize(total) returns the overall result given the number of set
+    //      flags.
+    //
+    // Using the scan_partitioner_sequential_f3_tag, the scatter steps are
+    // run in order, which is required for compacting in place.
+    //
+    // ExPolicy:    execution policy
+    // R:           overall result type
+    // ScanPartTag: the scan partitioner policy used for the scatter step
+    template <typename ExPolicy, typename R,
+        typename ScanPartTag = scan_partitioner_normal_tag>
+    struct compact_partitioner;
+
+    template <typename ExPolicy, typename R>
+    struct compact_partitioner<ExPolicy, R, scan_partitioner_normal_tag>
+    {
+        template <typename ExPolicy_, typename FwdIter, typename Mark,
+            typename Scatter, typename Finalize>
+        static decltype(auto) call(ExPolicy_&& policy, FwdIter first,
+            std::size_t count, Mark&& mark, Scatter&& scatter,
+            Finalize&& finalize)
+        {
+            HPX_ASSERT(count > 0);
+
+            using block_iterator = detail::compact_block_iterator<FwdIter>;
+            using scan_partitioner_type =
+                util::scan_partitioner<ExPolicy, R, std::size_t>;
+
+            auto flags = std::make_shared<std::vector<std::uint64_t>>(
+                (count + detail::compact_word_bits - 1) /
+                detail::compact_word_bits);
+
+            auto f1 = [flags, mark = HPX_FORWARD(Mark, mark)](
+                          block_iterator part_begin,
+                          std::size_t part_size) -> std::size_t {
+                detail::compact_flags_writer writer(flags->data() +
+                    part_begin.position() / detail::compact_word_bits);
+                mark(*part_begin, part_begin.elements(part_size), writer);
+                return writer.finish();
+            };
+
+            auto f3 = [flags, scatter = HPX_FORWARD(Scatter, scatter)](
+                          block_iterator part_begin, std::size_t part_size,
+                          std::size_t offset) mutable {
+                std::size_t const base_idx = part_begin.position();
+                scatter(*part_begin, part_begin.elements(part_size), base_idx,
+                    offset,
+                    detail::compact_flags_view(flags->data() +
+                        base_idx / detail::compact_word_bits));
+            };
+
+            auto f4 = [flags, finalize = HPX_FORWARD(Finalize, finalize)](
+                          std::vector<std::size_t>&& items,
+                          std::vector<hpx::future<void>>&& data) mutable -> R {
+                // make sure iterators embedded in function object that is
+                // attached to futures are invalidated
+                util::detail::clear_container(data);
+                return finalize(items.back());
+            };
+
+            std::size_t const blocks =
+                (count + compact_block_size - 1) / compact_block_size;
+
+            return scan_partitioner_type::call(HPX_FORWARD(ExPolicy_, policy),
+                block_iterator(first, count), blocks, std::size_t(0),
+                HPX_MOVE(f1), std::plus<std::size_t>(), HPX_MOVE(f3),
+                HPX_MOVE(f4));
+        }
+    };
+
+    template <typename ExPolicy, typename R>
+    struct compact_partitioner<ExPolicy, R, scan_partitioner_sequential_f3_tag>
+    {
+        template <typename ExPolicy_, typename FwdIter, typename Mark,
+            typename Scatter, typename Finalize>
+        static decltype(auto) call(ExPolicy_&& policy, FwdIter first,
+            std::size_t count, Mark&& mark, Scatter&& scatter,
+            Finalize&& finalize)
+        {
+            HPX_ASSERT(count > 0);
+
+            using block_iterator = detail::compact_block_iterator<FwdIter>;
+            using scan_partitioner_type = util::scan_partitioner<ExPolicy, R,
+                std::size_t, void, scan_partitioner_sequential_f3_tag>;
+
+            auto flags = std::make_shared<std::vector<std::uint64_t>>(
+                (count + detail::compact_word_bits - 1) /
+                detail::compact_word_bits);
+
+            auto f1 = [flags, mark = HPX_FORWARD(Mark, mark)](
+                          block_iterator part_begin,
+                          std::size_t part_size) -> std::size_t {
+                detail::compact_flags_writer writer(flags->data() +
+                    part_begin.position() / detail::compact_word_bits);
+                mark(*part_begin, part_begin.elements(part_size), writer);
+                return writer.finish();
+            };
+
+            auto f2 = [](hpx::shared_future<std::size_t> const& prev,
+                          hpx::shared_future<std::size_t> const& curr) {
+                return prev.get() + curr.get();
+            };
+
+            auto f3 = [flags, scatter = HPX_FORWARD(Scatter, scatter)](
+                          block_iterator part_begin, std::size_t part_size,
+                          hpx::shared_future<std::size_t> curr,
+                          hpx::shared_future<std::size_t> next) mutable {
+                next.get();    // rethrow exceptions
+
+                std::size_t const base_idx = part_begin.position();
+                scatter(*part_begin, part_begin.elements(part_size), base_idx,
+                    curr.get(),
+                    detail::compact_flags_view(flags->data() +
+                        base_idx / detail::compact_word_bits));
+            };
+
+            auto f4 = [flags, finalize = HPX_FORWARD(Finalize, finalize)](
+                          std::vector<hpx::shared_future<std::size_t>>&& items,
+                          std::vector<hpx::future<void>>&& data) mutable -> R {
+                std::size_t const total = items.back().get();
+
+                // make sure iterators embedded in function object that is
+                // attached to futures are invalidated
+                util::detail::clear_container(items);
+                util::detail::clear_container(data);
+
+                return finalize(total);
+            };
+
+            std::size_t const blocks =
+                (count + compact_block_size - 1) / compact_block_size;
+
+            return scan_partitioner_type::call(HPX_FORWARD(ExPolicy_, policy),
+                block_iterator(first, count), blocks, std::size_t(0),
+                HPX_MOVE(f1), HPX_MOVE(f2), HPX_MOVE(f3), HPX_MOVE(f4));
+        }
+    };
+}}}    // namespace hpx::parallel::util
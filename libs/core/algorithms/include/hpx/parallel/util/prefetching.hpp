@@ -7,8 +7,12 @@
 #pragma once
 
 #include <hpx/config.hpp>
+#include <hpx/concepts/concepts.hpp>
 #include <hpx/concurrency/cache_line_data.hpp>
 #include <hpx/datastructures/tuple.hpp>
+#include <hpx/execution/executors/execution_parameters.hpp>
+#include <hpx/executors/execution_policy.hpp>
+#include <hpx/iterator_support/iterator_adaptor.hpp>
 #include <hpx/iterator_support/traits/is_iterator.hpp>
 #include <hpx/iterator_support/traits/is_range.hpp>
 #include <hpx/parallel/util/loop.hpp>
@@ -232,6 +236,22 @@ namespace hpx { namespace parallel { namespace util {
             {
             }
 
+            // prefetch the given number of elements ahead
+            prefetcher_context(Itr begin, Itr end, std::size_t distance,
+                ranges_type const& rngs)
+              : it_begin_(begin)
+              , it_end_(end)
+              , rngs_(rngs)
+              , chunk_size_(distance == 0 ? 1 : distance)
+              , range_size_(std::distance(begin, end))
+            {
+            }
+
+            static constexpr std::size_t element_size() noexcept
+            {
+                return sizeof_first_value_type;
+            }
+
             prefetching_iterator<Itr, Ts...> begin()
             {
                 return prefetching_iterator<Itr, Ts...>(
@@ -274,6 +294,115 @@ namespace hpx { namespace parallel { namespace util {
         }
 #endif
 
+        ///////////////////////////////////////////////////////////////////////
+        // Prefetch the cache line holding the given address into all levels
+        // of the cache hierarchy.
+        HPX_FORCEINLINE void prefetch_address(void const* p) noexcept
+        {
+#if defined(HPX_HAVE_MM_PREFETCH)
+            _mm_prefetch(static_cast<char const*>(p), _MM_HINT_T0);
+#elif defined(__GNUC__)
+            __builtin_prefetch(p);
+#else
+            (void) p;
+#endif
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // Iterator over the elements of a data sequence selected by a sequence
+        // of indices (gather), i.e. *it refers to data[*index_it]. Whenever
+        // an element is accessed, the element referred to by the index the
+        // given distance ahead is prefetched. This hides the latency of the
+        // random accesses into the data sequence, which (unlike the accesses
+        // to the indices) can't be predicted by the hardware.
+        template <typename IndexIter, typename DataIter>
+        class gather_iterator
+          : public hpx::util::iterator_adaptor<
+                gather_iterator<IndexIter, DataIter>, IndexIter,
+                typename std::iterator_traits<DataIter>::value_type,
+                std::random_access_iterator_tag,
+                typename std::iterator_traits<DataIter>::reference>
+        {
+        private:
+            using base_type =
+                hpx::util::iterator_adaptor<gather_iterator, IndexIter,
+                    typename std::iterator_traits<DataIter>::value_type,
+                    std::random_access_iterator_tag,
+                    typename std::iterator_traits<DataIter>::reference>;
+
+        public:
+            gather_iterator() = default;
+
+            gather_iterator(IndexIter it, IndexIter last, DataIter data,
+                std::size_t distance)
+              : base_type(it)
+              , last_(last)
+              , data_(data)
+              , distance_(distance)
+            {
+            }
+
+            DataIter data() const
+            {
+                return data_;
+            }
+
+            std::size_t distance() const noexcept
+            {
+                return distance_;
+            }
+
+        private:
+            friend class hpx::util::iterator_core_access;
+
+            typename base_type::reference dereference() const
+            {
+                IndexIter const& it = this->base_reference();
+                if (distance_ < std::size_t(last_ - it))
+                {
+                    prefetch_address(&data_[it[distance_]]);
+                }
+                return data_[*it];
+            }
+
+            IndexIter last_;
+            DataIter data_;
+            std::size_t distance_ = 0;
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        // Helper class to initialize gather_iterator
+        template <typename IndexIter, typename DataIter>
+        struct gather_context
+        {
+            gather_context(IndexIter first, IndexIter last, DataIter data,
+                std::size_t distance)
+              : first_(first)
+              , last_(last)
+              , data_(data)
+              , distance_(distance == 0 ? 1 : distance)
+            {
+            }
+
+            gather_iterator<IndexIter, DataIter> begin() const
+            {
+                return gather_iterator<IndexIter, DataIter>(
+                    first_, last_, data_, distance_);
+            }
+
+            gather_iterator<IndexIter, DataIter> end() const
+            {
+                return gather_iterator<IndexIter, DataIter>(
+                    last_, last_, data_, distance_);
+            }
+
+        private:
+            IndexIter first_;
+            IndexIter last_;
+            DataIter data_;
+            std::size_t distance_;
+        };
+
         ///////////////////////////////////////////////////////////////////////
         struct loop_n_helper
         {
@@ -459,6 +588,75 @@ namespace hpx { namespace parallel { namespace util {
             base_begin, base_end, HPX_MOVE(ranges), p_factor);
     }
 
+    // function to create a prefetcher_context, the prefetch distance is
+    // determined by the executor parameters of the given execution policy
+    // (see hpx::parallel::execution::get_prefetch_distance)
+    // clang-format off
+    template <typename ExPolicy, typename Itr, typename... Ts,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::is_execution_policy_v<std::decay_t<ExPolicy>>
+        )>
+    // clang-format on
+    prefetching::prefetcher_context<Itr, Ts const...> make_prefetcher_context(
+        ExPolicy&& policy, Itr base_begin, Itr base_end, Ts const&... rngs)
+    {
+        static_assert(hpx::traits::is_random_access_iterator<Itr>::value,
+            "Iterators have to be of random access iterator category");
+        static_assert(hpx::util::all_of<hpx::traits::is_range<Ts>...>::value,
+            "All variadic parameters have to represent ranges");
+
+        using context_type = prefetching::prefetcher_context<Itr, Ts const...>;
+        using ranges_type = hpx::tuple<std::reference_wrapper<Ts const>...>;
+
+        std::size_t const distance =
+            hpx::parallel::execution::get_prefetch_distance(policy.parameters(),
+                policy.executor(), context_type::element_size());
+
+        return context_type(
+            base_begin, base_end, distance, ranges_type(std::cref(rngs)...));
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // function to create a gather_context accessing data[*it] for all it in
+    // [indices_first, indices_last), prefetching the given number of
+    // elements ahead
+    template <typename IndexIter, typename DataIter>
+    prefetching::gather_context<IndexIter, DataIter> make_gather_context(
+        IndexIter indices_first, IndexIter indices_last, DataIter data,
+        std::size_t distance)
+    {
+        static_assert(hpx::traits::is_random_access_iterator<IndexIter>::value,
+            "Index iterators have to be of random access iterator category");
+        static_assert(hpx::traits::is_random_access_iterator<DataIter>::value,
+            "Data iterators have to be of random access iterator category");
+
+        return prefetching::gather_context<IndexIter, DataIter>(
+            indices_first, indices_last, data, distance);
+    }
+
+    // function to create a gather_context, the prefetch distance is
+    // determined by the executor parameters of the given execution policy
+    // (see hpx::parallel::execution::get_prefetch_distance)
+    // clang-format off
+    template <typename ExPolicy, typename IndexIter, typename DataIter,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::is_execution_policy_v<std::decay_t<ExPolicy>>
+        )>
+    // clang-format on
+    prefetching::gather_context<IndexIter, DataIter> make_gather_context(
+        ExPolicy&& policy, IndexIter indices_first, IndexIter indices_last,
+        DataIter data)
+    {
+        using index_type = typename std::iterator_traits<IndexIter>::value_type;
+
+        std::size_t const distance =
+            hpx::parallel::execution::get_prefetch_distance(
+                policy.parameters(), policy.executor(), sizeof(index_type));
+
+        return util::make_gather_context(
+            indices_first, indices_last, data, distance);
+    }
+
     namespace detail {
         ///////////////////////////////////////////////////////////////////////
         template <typename Itr, typename... Ts>
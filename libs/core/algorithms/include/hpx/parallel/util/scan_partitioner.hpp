@@ -18,7 +18,9 @@
 #endif
 
 #include <hpx/execution/executors/execution.hpp>
+#include <hpx/execution/executors/execution_information.hpp>
 #include <hpx/execution/executors/execution_parameters.hpp>
+#include <hpx/execution_base/this_thread.hpp>
 #include <hpx/executors/execution_policy.hpp>
 #include <hpx/parallel/util/detail/algorithm_result.hpp>
 #include <hpx/parallel/util/detail/chunk_size.hpp>
@@ -27,8 +29,10 @@
 #include <hpx/parallel/util/detail/select_partitioner.hpp>
 
 #include <algorithm>
+#include <atomic>
 #include <cstddef>
 #include <exception>
+#include <iterator>
 #include <list>
 #include <memory>
 #include <type_traits>
@@ -44,6 +48,25 @@ namespace hpx { namespace parallel { namespace util {
     {
     };
 
+    // Perform the scan in a single pass over the input using decoupled
+    // look-back: every partition publishes its local result as soon as it
+    // is known and derives its prefix from its predecessors, after which it
+    // immediately runs the final step while its data is still in the cache.
+    // The partitions are combined in a non-deterministic order, the
+    // operation has to be associative. Small inputs fall back to
+    // scan_partitioner_normal_tag.
+    struct scan_partitioner_single_pass_tag
+    {
+    };
+
+    // Minimal number of elements for which the single pass scan is used.
+    inline constexpr std::size_t scan_single_pass_min_count = 1 << 18;
+
+    // Number of elements handled by one partition of the single pass scan,
+    // chosen so that the partitions stay in the cache between the first and
+    // the final step.
+    inline constexpr std::size_t scan_single_pass_chunk_size = 1 << 14;
+
     ///////////////////////////////////////////////////////////////////////////
     namespace detail {
         ///////////////////////////////////////////////////////////////////////
@@ -319,6 +342,190 @@ namespace hpx { namespace parallel { namespace util {
 #endif
             }
 
+            template <typename ExPolicy_, typename FwdIter, typename T,
+                typename F1, typename F2, typename F3, typename F4>
+            static R call(scan_partitioner_single_pass_tag, ExPolicy_ policy,
+                FwdIter first, std::size_t count, T&& init, F1&& f1, F2&& f2,
+                F3&& f3, F4&& f4)
+            {
+#if defined(HPX_COMPUTE_DEVICE_CODE)
+                HPX_UNUSED(policy);
+                HPX_UNUSED(first);
+                HPX_UNUSED(count);
+                HPX_UNUSED(init);
+                HPX_UNUSED(f1);
+                HPX_UNUSED(f2);
+                HPX_UNUSED(f3);
+                HPX_UNUSED(f4);
+                HPX_ASSERT(false);
+                return R();
+#else
+                static_assert(std::is_void_v<Result2>,
+                    "the single pass scan does not support results of the "
+                    "third step");
+
+                if (count < scan_single_pass_min_count)
+                {
+                    return call(scan_partitioner_normal_tag{},
+                        HPX_MOVE(policy), first, count, HPX_FORWARD(T, init),
+                        HPX_FORWARD(F1, f1), HPX_FORWARD(F2, f2),
+                        HPX_FORWARD(F3, f3), HPX_FORWARD(F4, f4));
+                }
+
+                // inform parameter traits
+                scoped_executor_parameters scoped_params(
+                    policy.parameters(), policy.executor());
+
+                enum status : int
+                {
+                    status_invalid = 0,
+                    status_aggregate = 1,
+                    status_prefix = 2,
+                    status_failed = 3
+                };
+
+                struct partition_status
+                {
+                    std::atomic<int> flag{status_invalid};
+                    Result1 aggregate{};
+                };
+
+                std::size_t const num_chunks =
+                    (count + scan_single_pass_chunk_size - 1) /
+                    scan_single_pass_chunk_size;
+                std::size_t const cores = execution::processing_units_count(
+                    policy.parameters(), policy.executor());
+                std::size_t const num_workers =
+                    (std::max)(std::size_t(1), (std::min)(cores, num_chunks));
+
+                // f2results[i + 1] is the inclusive prefix of partition i
+                std::vector<Result1> f2results(num_chunks + 1);
+                std::vector<hpx::future<Result2>> finalitems;
+                std::list<std::exception_ptr> errors;
+
+                std::unique_ptr<partition_status[]> partitions(
+                    new partition_status[num_chunks]);
+                std::vector<FwdIter> chunk_begins;
+                std::atomic<std::size_t> next_chunk(0);
+
+                // Compute the prefix of partition i from the results published
+                // by its predecessors. Returns false if one of them failed.
+                auto look_back = [&](std::size_t i, Result1& prefix,
+                                     auto& combine) -> bool {
+                    bool has_prefix = false;
+                    for (std::size_t j = i; j-- != 0;)
+                    {
+                        partition_status& p = partitions[j];
+
+                        int flag = status_invalid;
+                        hpx::util::yield_while([&]() {
+                            flag = p.flag.load(std::memory_order_acquire);
+                            return flag == status_invalid;
+                        });
+
+                        if (flag == status_failed)
+                        {
+                            return false;
+                        }
+
+                        Result1 const& value = flag == status_prefix ?
+                            f2results[j + 1] :
+                            p.aggregate;
+                        prefix = has_prefix ?
+                            HPX_INVOKE(combine, value, prefix) :
+                            value;
+                        has_prefix = true;
+
+                        if (flag == status_prefix)
+                        {
+                            break;
+                        }
+                    }
+                    return true;
+                };
+
+                // Partitions are claimed in order, which guarantees that all
+                // predecessors of a partition are being worked on. Every
+                // worker uses its own copy of the functions.
+                auto worker = [&, f1, f2, f3]() mutable {
+                    std::size_t i = 0;
+                    while ((i = next_chunk++) < num_chunks)
+                    {
+                        partition_status& p = partitions[i];
+                        std::size_t const size = (std::min)(
+                            scan_single_pass_chunk_size,
+                            count - i * scan_single_pass_chunk_size);
+
+                        try
+                        {
+                            Result1 aggregate =
+                                HPX_INVOKE(f1, chunk_begins[i], size);
+
+                            // the look-back always ends at a partition which
+                            // has published its inclusive prefix, the prefix
+                            // includes the initial value
+                            Result1 prefix = f2results[0];
+                            if (i != 0)
+                            {
+                                p.aggregate = aggregate;
+                                p.flag.store(status_aggregate,
+                                    std::memory_order_release);
+
+                                if (!look_back(i, prefix, f2))
+                                {
+                                    p.flag.store(status_failed,
+                                        std::memory_order_release);
+                                    continue;
+                                }
+                            }
+
+                            f2results[i + 1] =
+                                HPX_INVOKE(f2, prefix, aggregate);
+                            p.flag.store(
+                                status_prefix, std::memory_order_release);
+
+                            HPX_INVOKE(f3, chunk_begins[i], size, prefix);
+                        }
+                        catch (...)
+                        {
+                            p.flag.store(
+                                status_failed, std::memory_order_release);
+                            throw;
+                        }
+                    }
+                };
+
+                try
+                {
+                    chunk_begins.reserve(num_chunks);
+                    for (std::size_t i = 0; i != num_chunks; ++i)
+                    {
+                        chunk_begins.push_back(first);
+                        std::advance(first,
+                            (std::min)(scan_single_pass_chunk_size,
+                                count - i * scan_single_pass_chunk_size));
+                    }
+                    f2results[0] = HPX_FORWARD(T, init);
+
+                    finalitems.reserve(num_workers);
+                    for (std::size_t i = 0; i != num_workers; ++i)
+                    {
+                        finalitems.push_back(execution::async_execute(
+                            policy.executor(), worker));
+                    }
+
+                    scoped_params.mark_end_of_scheduling();
+                }
+                catch (...)
+                {
+                    handle_local_exceptions::call(
+                        std::current_exception(), errors);
+                }
+                return reduce(HPX_MOVE(f2results), HPX_MOVE(finalitems),
+                    HPX_MOVE(errors), HPX_FORWARD(F4, f4));
+#endif
+            }
+
             template <typename ExPolicy_, typename FwdIter, typename T,
                 typename F1, typename F2, typename F3, typename F4>
             static R call(ExPolicy_&& policy, FwdIter first, std::size_t count,
@@ -11,7 +11,11 @@
 #include <hpx/modules/errors.hpp>
 #include <hpx/modules/serialization.hpp>
 #include <hpx/parallel/task_group.hpp>
+#include <hpx/threading_base/scheduler_base.hpp>
+#include <hpx/threading_base/thread_data.hpp>
+#include <hpx/threading_base/thread_num_tss.hpp>
 
+#include <cstddef>
 #include <exception>
 
 namespace hpx::execution::experimental {
@@ -49,8 +53,14 @@ namespace hpx::execution::experimental {
 
     ///////////////////////////////////////////////////////////////////////////
     task_group::task_group()
+      : task_group(task_group_mode::help_first)
+    {
+    }
+
+    task_group::task_group(task_group_mode mode)
       : latch_(1)
       , has_arrived_(false)
+      , mode_(mode)
     {
     }
 
@@ -88,6 +98,25 @@ namespace hpx::execution::experimental {
         errors_.add(HPX_MOVE(p));
     }
 
+    bool task_group::has_pending_local_work() noexcept
+    {
+        threads::thread_data* self = threads::get_self_id_data();
+        if (self == nullptr)
+        {
+            return false;
+        }
+
+        std::size_t const num_thread = hpx::get_local_worker_thread_num();
+        if (num_thread == std::size_t(-1))
+        {
+            return false;
+        }
+
+        // An idle worker will steal the queued work, the new task would not
+        // be picked up any sooner if it was queued as well.
+        return self->get_scheduler_base()->get_queue_length(num_thread) != 0;
+    }
+
     void task_group::serialize(
         serialization::output_archive& ar, unsigned const)
     {
@@ -0,0 +1,546 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Strong scaling of a set of parallel algorithms for different sizes of the
+// data (from fitting into the L1 cache to being much larger than the last
+// level cache), execution policies and executors. The runtime is restarted
+// for every number of threads given with --threads. The algorithms are
+// compared to the sequential standard algorithms, the parallel standard
+// algorithms (if supported by the compiler, these are run with the default
+// number of threads of the standard library) and to TBB (if HPX was
+// configured with HPX_WITH_EXAMPLES_TBB=ON).
+//
+// For every algorithm, size, implementation and number of threads the median
+// of the timings is reported together with the speedup relative to the
+// same implementation running on the smallest number of threads and
+// relative to the sequential standard algorithm.
+
+#include <hpx/config.hpp>
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#if defined(HPX_HAVE_DATAPAR)
+#include <hpx/include/datapar.hpp>
+#endif
+#include <hpx/local/algorithm.hpp>
+#include <hpx/local/execution.hpp>
+#include <hpx/local/init.hpp>
+#include <hpx/local/numeric.hpp>
+#include <hpx/modules/compute_local.hpp>
+#include <hpx/modules/format.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <iterator>
+#include <map>
+#include <numeric>
+#include <random>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if defined(HPX_HAVE_CXX17_STD_EXECUTION_POLICES)
+#include <execution>
+#endif
+
+#if defined(HPX_ALGORITHMS_SCALING_WITH_TBB)
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/parallel_reduce.h>
+#include <tbb/parallel_sort.h>
+#include <tbb/task_arena.h>
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+std::size_t repetitions = 20;
+bool csv = false;
+std::string selected_algorithms = "all";
+
+std::vector<std::size_t> parse_list(std::string const& list)
+{
+    std::vector<std::size_t> values;
+    std::string::size_type start = 0;
+    while (start < list.size())
+    {
+        std::string::size_type end = list.find(',', start);
+        if (end == std::string::npos)
+            end = list.size();
+        if (end != start)
+            values.push_back(std::stoul(list.substr(start, end - start)));
+        start = end + 1;
+    }
+    return values;
+}
+
+bool is_selected(std::string const& algorithm)
+{
+    if (selected_algorithms == "all")
+        return true;
+    return ("," + selected_algorithms + ",").find("," + algorithm + ",") !=
+        std::string::npos;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// The medians of the timings, indexed by algorithm, size [bytes],
+// implementation and number of threads
+using key_type =
+    std::tuple<std::string, std::size_t, std::string, std::size_t>;
+std::map<key_type, double> results;
+
+template <typename F>
+void measure(char const* algorithm, std::size_t size, std::string const& impl,
+    std::size_t threads, F&& f)
+{
+    if (!is_selected(algorithm))
+        return;
+
+    std::size_t const bytes = size * sizeof(double);
+    hpx::util::perftests_statistics const stats =
+        hpx::util::perftests_report(
+            std::string(algorithm) + " - " + std::to_string(bytes),
+            impl + " - " + std::to_string(threads), repetitions,
+            HPX_FORWARD(F, f));
+
+    results[key_type(algorithm, bytes, impl, threads)] = stats.median;
+}
+
+struct benchmark_data
+{
+    explicit benchmark_data(std::size_t size)
+      : a(size)
+      , b(size)
+    {
+        std::mt19937 gen(42);
+        std::uniform_real_distribution<double> dis(0.0, 1.0);
+        std::generate(a.begin(), a.end(), [&]() { return dis(gen); });
+        b = a;
+    }
+
+    std::vector<double> a;
+    std::vector<double> b;
+    double value = 0.5;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// The fork_join_executor does not support the algorithms combining the
+// results of the partitions, neither it nor the block_executor support sort
+template <typename Policy>
+inline constexpr bool is_fork_join_policy_v =
+    std::is_same_v<std::decay_t<typename Policy::executor_type>,
+        hpx::execution::experimental::fork_join_executor>;
+
+template <typename Policy>
+inline constexpr bool is_block_policy_v =
+    std::is_same_v<std::decay_t<typename Policy::executor_type>,
+        hpx::compute::host::block_executor<>>;
+
+template <typename Policy>
+void measure_hpx(Policy const& policy, std::string const& impl,
+    std::size_t threads, benchmark_data& d)
+{
+    std::size_t const size = d.a.size();
+    auto const first = d.a.begin();
+    auto const last = d.a.end();
+    auto const dest = d.b.begin();
+    double const value = d.value;
+
+    measure("copy", size, impl, threads,
+        [&]() { hpx::copy(policy, first, last, dest); });
+    measure("fill", size, impl, threads,
+        [&]() { hpx::fill(policy, d.b.begin(), d.b.end(), value); });
+    measure("for_each", size, impl, threads, [&]() {
+        hpx::for_each(
+            policy, d.b.begin(), d.b.end(), [](auto& v) { v = v * 0.5; });
+    });
+    measure("transform", size, impl, threads, [&]() {
+        hpx::transform(
+            policy, first, last, dest, [](auto v) { return v * 2.0 + 1.0; });
+    });
+    // the value is not found, the whole range is searched
+    measure("find", size, impl, threads,
+        [&]() { hpx::find(policy, first, last, -1.0); });
+
+    if constexpr (!is_fork_join_policy_v<Policy>)
+    {
+        measure("reduce", size, impl, threads,
+            [&]() { d.value = hpx::reduce(policy, first, last, 0.0); });
+        measure("transform_reduce", size, impl, threads, [&]() {
+            d.value = hpx::transform_reduce(policy, first, last, dest, 0.0);
+        });
+        measure("count_if", size, impl, threads, [&]() {
+            hpx::count_if(
+                policy, first, last, [value](auto v) { return v > value; });
+        });
+    }
+
+    if constexpr (!hpx::is_vectorpack_execution_policy_v<Policy> &&
+        !is_fork_join_policy_v<Policy>)
+    {
+        measure("inclusive_scan", size, impl, threads,
+            [&]() { hpx::inclusive_scan(policy, first, last, dest); });
+        measure("minmax_element", size, impl, threads,
+            [&]() { hpx::minmax_element(policy, first, last); });
+    }
+
+    if constexpr (!hpx::is_vectorpack_execution_policy_v<Policy> &&
+        !is_fork_join_policy_v<Policy> && !is_block_policy_v<Policy>)
+    {
+        // sorts a copy of the input, the time includes copying the data
+        measure("sort", size, impl, threads, [&]() {
+            hpx::copy(policy, first, last, dest);
+            hpx::sort(policy, d.b.begin(), d.b.end());
+        });
+    }
+
+    d.value = 0.5;
+}
+
+void measure_std_seq(benchmark_data& d)
+{
+    std::size_t const size = d.a.size();
+    auto const first = d.a.begin();
+    auto const last = d.a.end();
+    auto const dest = d.b.begin();
+    double const value = d.value;
+    std::string const impl = "std::seq";
+
+    measure("copy", size, impl, 1, [&]() { std::copy(first, last, dest); });
+    measure("fill", size, impl, 1,
+        [&]() { std::fill(d.b.begin(), d.b.end(), value); });
+    measure("for_each", size, impl, 1, [&]() {
+        std::for_each(d.b.begin(), d.b.end(), [](double& v) { v = v * 0.5; });
+    });
+    measure("transform", size, impl, 1, [&]() {
+        std::transform(
+            first, last, dest, [](double v) { return v * 2.0 + 1.0; });
+    });
+    measure("reduce", size, impl, 1,
+        [&]() { d.value = std::reduce(first, last, 0.0); });
+    measure("transform_reduce", size, impl, 1,
+        [&]() { d.value = std::transform_reduce(first, last, dest, 0.0); });
+    measure("count_if", size, impl, 1, [&]() {
+        std::count_if(first, last, [value](double v) { return v > value; });
+    });
+    measure("find", size, impl, 1, [&]() { std::find(first, last, -1.0); });
+    measure("inclusive_scan", size, impl, 1,
+        [&]() { std::inclusive_scan(first, last, dest); });
+    measure("minmax_element", size, impl, 1,
+        [&]() { std::minmax_element(first, last); });
+    measure("sort", size, impl, 1, [&]() {
+        std::copy(first, last, dest);
+        std::sort(d.b.begin(), d.b.end());
+    });
+
+    d.value = 0.5;
+}
+
+#if defined(HPX_HAVE_CXX17_STD_EXECUTION_POLICES)
+void measure_std_par(benchmark_data& d, std::size_t threads)
+{
+    std::size_t const size = d.a.size();
+    auto const first = d.a.begin();
+    auto const last = d.a.end();
+    auto const dest = d.b.begin();
+    double const value = d.value;
+    std::string const impl = "std::par";
+    auto const& policy = std::execution::par;
+
+    measure("copy", size, impl, threads,
+        [&]() { std::copy(policy, first, last, dest); });
+    measure("fill", size, impl, threads,
+        [&]() { std::fill(policy, d.b.begin(), d.b.end(), value); });
+    measure("for_each", size, impl, threads, [&]() {
+        std::for_each(
+            policy, d.b.begin(), d.b.end(), [](double& v) { v = v * 0.5; });
+    });
+    measure("transform", size, impl, threads, [&]() {
+        std::transform(policy, first, last, dest,
+            [](double v) { return v * 2.0 + 1.0; });
+    });
+    measure("reduce", size, impl, threads,
+        [&]() { d.value = std::reduce(policy, first, last, 0.0); });
+    measure("transform_reduce", size, impl, threads, [&]() {
+        d.value = std::transform_reduce(policy, first, last, dest, 0.0);
+    });
+    measure("count_if", size, impl, threads, [&]() {
+        std::count_if(
+            policy, first, last, [value](double v) { return v > value; });
+    });
+    measure("find", size, impl, threads,
+        [&]() { std::find(policy, first, last, -1.0); });
+    measure("inclusive_scan", size, impl, threads,
+        [&]() { std::inclusive_scan(policy, first, last, dest); });
+    measure("minmax_element", size, impl, threads,
+        [&]() { std::minmax_element(policy, first, last); });
+    measure("sort", size, impl, threads, [&]() {
+        std::copy(policy, first, last, dest);
+        std::sort(policy, d.b.begin(), d.b.end());
+    });
+
+    d.value = 0.5;
+}
+#endif
+
+#if defined(HPX_ALGORITHMS_SCALING_WITH_TBB)
+// TBB has no direct counterparts of find, inclusive_scan and minmax_element
+void measure_tbb(benchmark_data& d, std::size_t threads)
+{
+    using range = tbb::blocked_range<std::size_t>;
+
+    std::size_t const size = d.a.size();
+    double* a = d.a.data();
+    double* b = d.b.data();
+    double const value = d.value;
+    std::string const impl = "tbb";
+
+    tbb::task_arena arena(static_cast<int>(threads));
+    arena.execute([&]() {
+        measure("copy", size, impl, threads, [&]() {
+            tbb::parallel_for(range(0, size), [&](range const& r) {
+                std::copy(a + r.begin(), a + r.end(), b + r.begin());
+            });
+        });
+        measure("fill", size, impl, threads, [&]() {
+            tbb::parallel_for(range(0, size), [&](range const& r) {
+                std::fill(b + r.begin(), b + r.end(), value);
+            });
+        });
+        measure("for_each", size, impl, threads, [&]() {
+            tbb::parallel_for(range(0, size), [&](range const& r) {
+                for (std::size_t i = r.begin(); i != r.end(); ++i)
+                    b[i] = b[i] * 0.5;
+            });
+        });
+        measure("transform", size, impl, threads, [&]() {
+            tbb::parallel_for(range(0, size), [&](range const& r) {
+                for (std::size_t i = r.begin(); i != r.end(); ++i)
+                    b[i] = a[i] * 2.0 + 1.0;
+            });
+        });
+        measure("reduce", size, impl, threads, [&]() {
+            d.value = tbb::parallel_reduce(
+                range(0, size), 0.0,
+                [&](range const& r, double init) {
+                    return std::accumulate(a + r.begin(), a + r.end(), init);
+                },
+                std::plus<double>());
+        });
+        measure("transform_reduce", size, impl, threads, [&]() {
+            d.value = tbb::parallel_reduce(
+                range(0, size), 0.0,
+                [&](range const& r, double init) {
+                    return std::inner_product(
+                        a + r.begin(), a + r.end(), b + r.begin(), init);
+                },
+                std::plus<double>());
+        });
+        measure("count_if", size, impl, threads, [&]() {
+            tbb::parallel_reduce(
+                range(0, size), std::ptrdiff_t(0),
+                [&](range const& r, std::ptrdiff_t init) {
+                    return init +
+                        std::count_if(a + r.begin(), a + r.end(),
+                            [value](double v) { return v > value; });
+                },
+                std::plus<std::ptrdiff_t>());
+        });
+        measure("sort", size, impl, threads, [&]() {
+            tbb::parallel_for(range(0, size), [&](range const& r) {
+                std::copy(a + r.begin(), a + r.end(), b + r.begin());
+            });
+            tbb::parallel_sort(b, b + size);
+        });
+    });
+
+    d.value = 0.5;
+}
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm, std::size_t threads,
+    bool first_run)
+{
+    hpx::util::perftests_init(vm, "algorithms_scaling");
+
+    hpx::execution::experimental::fork_join_executor fork_join;
+    hpx::compute::host::block_executor<> block(
+        hpx::compute::host::numa_domains());
+
+    for (std::size_t size : parse_list(vm["sizes"].as<std::string>()))
+    {
+        benchmark_data d(size);
+
+        using namespace hpx::execution;
+
+        // the sequential policy is independent of the number of threads
+        if (first_run)
+            measure_hpx(seq, "hpx::seq", 1, d);
+
+        measure_hpx(par, "hpx::par", threads, d);
+        measure_hpx(par_unseq, "hpx::par_unseq", threads, d);
+        measure_hpx(par.on(fork_join), "hpx::par(fork_join_executor)",
+            threads, d);
+        measure_hpx(par.on(block), "hpx::par(block_executor)", threads, d);
+#if defined(HPX_HAVE_DATAPAR)
+        if (first_run)
+            measure_hpx(simd, "hpx::simd", 1, d);
+        measure_hpx(par_simd, "hpx::par_simd", threads, d);
+#endif
+    }
+
+    return hpx::local::finalize();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void print_results()
+{
+    if (csv)
+    {
+        std::cout << "algorithm,size,implementation,threads,median,speedup,"
+                     "speedup_std_seq\n";
+    }
+
+    for (auto const& result : results)
+    {
+        std::string const& algorithm = std::get<0>(result.first);
+        std::size_t const bytes = std::get<1>(result.first);
+        std::string const& impl = std::get<2>(result.first);
+        double const median = result.second;
+
+        // the smallest number of threads of this implementation is the first
+        // entry with the same algorithm, size and implementation
+        auto const base =
+            results.lower_bound(key_type(algorithm, bytes, impl, 0));
+        double const speedup = median > 0.0 ? base->second / median : 0.0;
+
+        auto const std_seq =
+            results.find(key_type(algorithm, bytes, "std::seq", 1));
+        double const speedup_std_seq =
+            std_seq != results.end() && median > 0.0 ?
+            std_seq->second / median :
+            0.0;
+
+        if (csv)
+        {
+            hpx::util::format_to(std::cout, "{},{},{},{},{},{},{}\n",
+                algorithm, bytes, impl, std::get<3>(result.first), median,
+                speedup, speedup_std_seq);
+        }
+        else
+        {
+            hpx::util::format_to(std::cout,
+                "{:16} {:12} [B] {:30} threads {:4}: {:12.9} [s], speedup "
+                "{:8.3}, speedup vs. std::seq {:8.3}\n",
+                algorithm, bytes, impl, std::get<3>(result.first), median,
+                speedup, speedup_std_seq);
+        }
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    using namespace hpx::program_options;
+
+    std::size_t const hardware_threads =
+        (std::max)(1u, std::thread::hardware_concurrency());
+    std::string default_threads;
+    for (std::size_t threads = 1; threads < hardware_threads; threads *= 2)
+        default_threads += std::to_string(threads) + ",";
+    default_threads += std::to_string(hardware_threads);
+
+    options_description cmdline("usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    cmdline.add_options()
+        ("sizes", value<std::string>()->default_value(
+             "1024,32768,1048576,16777216"),
+         "comma separated list of the numbers of elements (doubles) of the "
+         "data the algorithms are run on (default: 8KiB to 128MiB)")
+        ("threads", value<std::string>()->default_value(default_threads),
+         "comma separated list of the numbers of threads to run the "
+         "algorithms on (default: powers of two up to all cores)")
+        ("algorithms", value<std::string>(&selected_algorithms)
+             ->default_value("all"),
+         "comma separated list of the algorithms to run (default: all)")
+        ("repetitions", value<std::size_t>(&repetitions)->default_value(20),
+         "maximal number of times each algorithm is timed (default: 20)")
+        ("csv", "output results as csv")
+        ;
+    // clang-format on
+
+    hpx::util::perftests_cfg(cmdline);
+
+    variables_map vm;
+    store(command_line_parser(argc, argv)
+              .allow_unregistered()
+              .options(cmdline)
+              .run(),
+        vm);
+    notify(vm);
+
+    csv = vm.count("csv") != 0;
+
+    std::vector<std::size_t> const thread_counts =
+        parse_list(vm["threads"].as<std::string>());
+    std::vector<std::size_t> const sizes =
+        parse_list(vm["sizes"].as<std::string>());
+    if (thread_counts.empty() || sizes.empty())
+    {
+        std::cerr << "algorithms_scaling: no sizes or numbers of threads "
+                     "given\n";
+        return 1;
+    }
+
+    bool first_run = true;
+    for (std::size_t threads : thread_counts)
+    {
+        hpx::local::init_params init_args;
+        init_args.desc_cmdline = cmdline;
+        init_args.cfg = {"hpx.os_threads=" + std::to_string(threads)};
+
+        int const result = hpx::local::init(
+            [threads, first_run](variables_map& args) {
+                return hpx_main(args, threads, first_run);
+            },
+            argc, argv, init_args);
+        if (result != 0)
+            return result;
+        first_run = false;
+
+#if defined(HPX_ALGORITHMS_SCALING_WITH_TBB)
+        // TBB runs while the HPX runtime is stopped
+        for (std::size_t size : sizes)
+        {
+            benchmark_data d(size);
+            measure_tbb(d, threads);
+        }
+#endif
+    }
+
+    for (std::size_t size : sizes)
+    {
+        benchmark_data d(size);
+        measure_std_seq(d);
+#if defined(HPX_HAVE_CXX17_STD_EXECUTION_POLICES)
+        measure_std_par(d, hardware_threads);
+#endif
+    }
+
+    print_results();
+
+    if (vm.count("perftests-output"))
+    {
+        hpx::util::perftests_print_times();
+    }
+    return 0;
+}
+#endif
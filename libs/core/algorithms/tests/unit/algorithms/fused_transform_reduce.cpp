@@ -0,0 +1,190 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/local/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/parallel/algorithms/fused_transform_reduce.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iostream>
+#include <list>
+#include <random>
+#include <string>
+#include <vector>
+
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy>
+void test_fused_transform_reduce(ExPolicy&& policy, std::size_t size)
+{
+    std::uniform_int_distribution<int> dis(-1000, 1000);
+
+    std::vector<int> c(size);
+    std::generate(c.begin(), c.end(), [&]() { return dis(gen); });
+
+    // the live-out values take part in the reductions
+    long sum = 42;
+    long sum_of_squares = 0;
+    int min = 10000;
+    int max = -10000;
+
+    hpx::experimental::fused_transform_reduce(
+        policy, c.begin(), c.end(),
+        [](int v) {
+            return hpx::make_tuple(long(v), long(v) * v, v, v);
+        },
+        hpx::experimental::reduction_plus(sum),
+        hpx::experimental::reduction_plus(sum_of_squares),
+        hpx::experimental::reduction_min(min),
+        hpx::experimental::reduction_max(max));
+
+    long expected_sum = 42;
+    long expected_sum_of_squares = 0;
+    int expected_min = 10000;
+    int expected_max = -10000;
+    for (int v : c)
+    {
+        expected_sum += v;
+        expected_sum_of_squares += long(v) * v;
+        expected_min = (std::min)(expected_min, v);
+        expected_max = (std::max)(expected_max, v);
+    }
+
+    HPX_TEST_EQ(sum, expected_sum);
+    HPX_TEST_EQ(sum_of_squares, expected_sum_of_squares);
+    HPX_TEST_EQ(min, expected_min);
+    HPX_TEST_EQ(max, expected_max);
+}
+
+template <typename ExPolicy>
+void test_fused_transform_reduce_async(ExPolicy&& policy, std::size_t size)
+{
+    std::vector<std::size_t> c(size);
+    std::generate(c.begin(), c.end(), [&]() { return gen() % 1000; });
+
+    // a single value is reduced by all reductions
+    std::size_t sum = 0;
+    std::size_t product = 1;
+    std::size_t max = 0;
+
+    auto f = hpx::experimental::fused_transform_reduce(
+        policy, c.begin(), c.end(), [](std::size_t v) { return v % 3 + 1; },
+        hpx::experimental::reduction_plus(sum),
+        hpx::experimental::reduction_multiplies(product),
+        hpx::experimental::reduction_max(max));
+    f.get();
+
+    std::size_t expected_sum = 0;
+    std::size_t expected_product = 1;
+    std::size_t expected_max = 0;
+    for (std::size_t v : c)
+    {
+        expected_sum += v % 3 + 1;
+        expected_product *= v % 3 + 1;
+        expected_max = (std::max)(expected_max, v % 3 + 1);
+    }
+
+    HPX_TEST_EQ(sum, expected_sum);
+    HPX_TEST_EQ(product, expected_product);
+    HPX_TEST_EQ(max, expected_max);
+}
+
+template <typename ExPolicy>
+void test_fused_transform_reduce_forward(ExPolicy&& policy, std::size_t size)
+{
+    std::list<double> c(size, 0.5);
+
+    double sum = 0.0;
+    double max = 0.0;
+
+    hpx::experimental::fused_transform_reduce(
+        policy, c.begin(), c.end(), [](double v) { return 2.0 * v; },
+        hpx::experimental::reduction_plus(sum),
+        hpx::experimental::reduction(max, 0.0,
+            [](double lhs, double rhs) { return (std::max)(lhs, rhs); }));
+
+    HPX_TEST_EQ(sum, double(size));
+    HPX_TEST_EQ(max, size == 0 ? 0.0 : 1.0);
+}
+
+void test_fused_transform_reduce_seq(std::size_t size)
+{
+    std::vector<int> c(size, 1);
+
+    int sum = 1;
+    int count = 0;
+
+    hpx::experimental::fused_transform_reduce(
+        c.begin(), c.end(), [](int v) { return hpx::make_tuple(v, 1); },
+        hpx::experimental::reduction_plus(sum),
+        hpx::experimental::reduction_plus(count));
+
+    HPX_TEST_EQ(sum, int(size) + 1);
+    HPX_TEST_EQ(count, int(size));
+}
+
+void test_fused_transform_reduce()
+{
+    using namespace hpx::execution;
+
+    // the sizes cover empty ranges, ranges shorter than the unrolled loop,
+    // and remainders of the unrolled loop
+    for (std::size_t size : {0, 1, 7, 8, 13, 10007, 100003})
+    {
+        test_fused_transform_reduce(seq, size);
+        test_fused_transform_reduce(par, size);
+        test_fused_transform_reduce(par_unseq, size);
+
+        test_fused_transform_reduce_async(seq(task), size);
+        test_fused_transform_reduce_async(par(task), size);
+
+        test_fused_transform_reduce_forward(seq, size);
+        test_fused_transform_reduce_forward(par, size);
+
+        test_fused_transform_reduce_seq(size);
+    }
+}
+
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    test_fused_transform_reduce();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,212 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/local/execution.hpp>
+#include <hpx/local/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/parallel/algorithms/for_each.hpp>
+#include <hpx/parallel/algorithms/for_loop.hpp>
+#include <hpx/parallel/algorithms/transform.hpp>
+#include <hpx/parallel/algorithms/transform_reduce.hpp>
+#include <hpx/parallel/util/prefetching.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+constexpr std::size_t data_size = 100007;
+constexpr std::size_t num_indices = 200003;
+
+std::vector<std::size_t> make_indices()
+{
+    std::uniform_int_distribution<std::size_t> dis(0, data_size - 1);
+
+    std::vector<std::size_t> indices(num_indices);
+    std::generate(indices.begin(), indices.end(), [&]() { return dis(gen); });
+    return indices;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy>
+void test_transform_gather(ExPolicy&& policy)
+{
+    std::vector<std::size_t> indices = make_indices();
+    std::vector<double> data(data_size);
+    std::iota(data.begin(), data.end(), 0.0);
+
+    auto ctx = hpx::parallel::util::make_gather_context(
+        policy, indices.begin(), indices.end(), data.begin());
+
+    std::vector<double> result(num_indices);
+    hpx::transform(policy, ctx.begin(), ctx.end(), result.begin(),
+        [](double v) { return 2.0 * v; });
+
+    for (std::size_t i = 0; i != num_indices; ++i)
+    {
+        HPX_TEST_EQ(result[i], 2.0 * data[indices[i]]);
+    }
+}
+
+template <typename ExPolicy>
+void test_transform_reduce_gather(ExPolicy&& policy)
+{
+    std::vector<std::size_t> indices = make_indices();
+    std::vector<std::size_t> data(data_size);
+    std::iota(data.begin(), data.end(), std::size_t(0));
+
+    auto ctx = hpx::parallel::util::make_gather_context(
+        policy, indices.begin(), indices.end(), data.begin());
+
+    std::size_t const result = hpx::transform_reduce(policy, ctx.begin(),
+        ctx.end(), std::size_t(0), std::plus<>(),
+        [](std::size_t v) { return v + 1; });
+
+    std::size_t expected = 0;
+    for (std::size_t i : indices)
+    {
+        expected += data[i] + 1;
+    }
+    HPX_TEST_EQ(result, expected);
+}
+
+template <typename ExPolicy>
+void test_for_loop_gather(ExPolicy&& policy)
+{
+    std::vector<std::size_t> indices = make_indices();
+    std::vector<double> data(data_size);
+    std::iota(data.begin(), data.end(), 0.0);
+
+    // explicit prefetch distance
+    auto ctx = hpx::parallel::util::make_gather_context(
+        indices.begin(), indices.end(), data.begin(), 16);
+
+    std::vector<double> result(num_indices);
+    hpx::experimental::for_loop(policy, ctx.begin(), ctx.end(),
+        [&](auto it) { result[it - ctx.begin()] = *it; });
+
+    for (std::size_t i = 0; i != num_indices; ++i)
+    {
+        HPX_TEST_EQ(result[i], data[indices[i]]);
+    }
+}
+
+template <typename ExPolicy>
+void test_for_each_prefetching(ExPolicy&& policy)
+{
+    std::vector<double> c(10007, 1.0);
+
+    std::vector<std::size_t> range(10007);
+    std::iota(range.begin(), range.end(), 0);
+
+    auto ctx = hpx::parallel::util::make_prefetcher_context(
+        policy, range.begin(), range.end(), c);
+
+    hpx::for_each(
+        policy, ctx.begin(), ctx.end(), [&](std::size_t i) { c[i] = 42.1; });
+
+    std::size_t count = 0;
+    std::for_each(std::begin(c), std::end(c), [&count](double v) -> void {
+        HPX_TEST_EQ(v, 42.1);
+        ++count;
+    });
+    HPX_TEST_EQ(count, c.size());
+}
+
+template <typename ExPolicy>
+void test_prefetching(ExPolicy&& policy)
+{
+    test_transform_gather(policy);
+    test_transform_reduce_gather(policy);
+    test_for_loop_gather(policy);
+    test_for_each_prefetching(policy);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_prefetch_distance()
+{
+    using namespace hpx::execution;
+    using hpx::execution::experimental::auto_prefetch_distance;
+    using hpx::execution::experimental::prefetch_distance;
+    using hpx::parallel::execution::get_prefetch_distance;
+
+    std::size_t const cache_line = hpx::threads::get_cache_line_size();
+
+    // default: two cache lines
+    HPX_TEST_EQ(get_prefetch_distance(par.parameters(), par.executor(), 8),
+        2 * cache_line / 8);
+
+    auto fixed = par.with(prefetch_distance(4));
+    HPX_TEST_EQ(get_prefetch_distance(fixed.parameters(), fixed.executor(), 8),
+        4 * cache_line / 8);
+    HPX_TEST_EQ(get_prefetch_distance(fixed.parameters(), fixed.executor(),
+                    4 * cache_line),
+        std::size_t(1));
+
+    // the tuned distance stays within the given bounds
+    auto tuned = par.with(auto_prefetch_distance(8));
+    for (int i = 0; i != 20; ++i)
+    {
+        std::size_t const distance = get_prefetch_distance(
+            tuned.parameters(), tuned.executor(), cache_line);
+        HPX_TEST_LTE(std::size_t(1), distance);
+        HPX_TEST_LTE(distance, std::size_t(8));
+
+        test_transform_gather(tuned);
+    }
+}
+
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    using namespace hpx::execution;
+
+    test_prefetching(seq);
+    test_prefetching(par);
+    test_prefetching(par_unseq);
+    test_prefetching(par.with(experimental::prefetch_distance(8)));
+
+    test_prefetch_distance();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -136,9 +136,42 @@ void test_nth_element()
     test_nth_element_async(par(task), IteratorTag());
 }
 
+// large inputs are handled by the parallel selection, the inputs include
+// many duplicates
+template <typename ExPolicy>
+void test_nth_element_large(ExPolicy policy, std::size_t max_value)
+{
+    std::size_t const size = 1 << 20;
+    std::uniform_int_distribution<std::size_t> dis(0, max_value);
+
+    std::vector<std::size_t> c(size);
+    std::generate(std::begin(c), std::end(c), [&]() { return dis(gen); });
+
+    std::vector<std::size_t> sorted = c;
+    std::sort(std::begin(sorted), std::end(sorted));
+
+    for (std::size_t nth : {std::size_t(0), std::size_t(17), size / 2,
+             size - 1, std::size_t(dis(gen) % size)})
+    {
+        std::vector<std::size_t> d = c;
+        hpx::nth_element(policy, std::begin(d), std::begin(d) + nth,
+            std::end(d));
+
+        HPX_TEST_EQ(d[nth], sorted[nth]);
+        HPX_TEST(std::all_of(std::begin(d), std::begin(d) + nth,
+            [&](std::size_t v) { return v <= d[nth]; }));
+        HPX_TEST(std::all_of(std::begin(d) + nth, std::end(d),
+            [&](std::size_t v) { return v >= d[nth]; }));
+    }
+}
+
 void nth_element_test()
 {
     test_nth_element<std::random_access_iterator_tag>();
+
+    test_nth_element_large(hpx::execution::par, 1000000000);
+    test_nth_element_large(hpx::execution::par, 15);
+    test_nth_element_large(hpx::execution::par_unseq, 0);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
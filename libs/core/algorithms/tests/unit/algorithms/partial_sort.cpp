@@ -109,6 +109,35 @@ void test_partial_sort_async(ExPolicy p, IteratorTag)
     }
 }
 
+// large inputs are handled by the parallel selection, both for few and for
+// many elements to sort
+template <typename ExPolicy>
+void test_partial_sort_large(ExPolicy policy)
+{
+    std::size_t const size = 1 << 20;
+    std::uniform_int_distribution<std::uint64_t> dis(0, 1000000);
+
+    std::vector<std::uint64_t> A(size);
+    std::generate(A.begin(), A.end(), [&]() { return dis(gen); });
+
+    std::vector<std::uint64_t> sorted = A;
+    std::sort(sorted.begin(), sorted.end());
+
+    for (std::size_t middle : {std::size_t(1), std::size_t(100),
+             std::size_t(10000), size / 2, size - 1})
+    {
+        std::vector<std::uint64_t> B = A;
+        hpx::partial_sort(policy, B.begin(), B.begin() + middle, B.end());
+
+        HPX_TEST(std::equal(B.begin(), B.begin() + middle, sorted.begin()));
+
+        // the remaining elements are a permutation of the input
+        std::sort(B.begin() + middle, B.end());
+        HPX_TEST(std::equal(B.begin() + middle, B.end(),
+            sorted.begin() + middle));
+    }
+}
+
 template <typename IteratorTag>
 void test_partial_sort()
 {
@@ -126,6 +155,9 @@ void partial_sort_test()
 {
     test_partial_sort<std::random_access_iterator_tag>();
     test_partial_sort<std::forward_iterator_tag>();
+
+    test_partial_sort_large(hpx::execution::par);
+    test_partial_sort_large(hpx::execution::par_unseq);
 }
 
 int hpx_main(hpx::program_options::variables_map& vm)
@@ -0,0 +1,211 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/local/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/parallel/algorithms/reduce_by_key_unsorted.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iostream>
+#include <map>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+///////////////////////////////////////////////////////////////////////////////
+struct reduce_unsorted
+{
+    template <typename... Ts>
+    decltype(auto) operator()(Ts&&... ts) const
+    {
+        return hpx::experimental::reduce_by_key_unsorted(
+            std::forward<Ts>(ts)...);
+    }
+};
+
+struct reduce_partitioned
+{
+    template <typename... Ts>
+    decltype(auto) operator()(Ts&&... ts) const
+    {
+        return hpx::experimental::reduce_by_key_partitioned(
+            std::forward<Ts>(ts)...);
+    }
+};
+
+// the output order is unspecified, compare the sorted results
+template <typename Key, typename Value>
+void check_result(std::vector<Key> const& keys,
+    std::vector<Value> const& values, std::vector<Key> const& out_keys,
+    std::vector<Value> const& out_values, std::size_t num_out)
+{
+    std::map<Key, Value> expected;
+    for (std::size_t i = 0; i != keys.size(); ++i)
+    {
+        expected[keys[i]] += values[i];
+    }
+
+    std::map<Key, Value> actual;
+    for (std::size_t i = 0; i != num_out; ++i)
+    {
+        HPX_TEST(actual.emplace(out_keys[i], out_values[i]).second);
+    }
+
+    HPX_TEST_EQ(num_out, expected.size());
+    HPX_TEST(actual == expected);
+}
+
+template <typename Algorithm, typename ExPolicy>
+void test_reduce_by_key_unsorted(Algorithm algorithm, ExPolicy&& policy,
+    std::size_t size, int cardinality)
+{
+    std::uniform_int_distribution<int> dis(0, cardinality - 1);
+
+    std::vector<int> keys(size);
+    std::vector<long> values(size);
+    std::generate(keys.begin(), keys.end(), [&]() { return dis(gen); });
+    std::generate(values.begin(), values.end(), [&]() { return dis(gen); });
+
+    std::vector<int> out_keys(size);
+    std::vector<long> out_values(size);
+
+    auto result = algorithm(policy, keys.begin(), keys.end(), values.begin(),
+        out_keys.begin(), out_values.begin());
+
+    std::size_t const num_out = std::distance(out_keys.begin(), result.in);
+    HPX_TEST(std::next(out_values.begin(), num_out) == result.out);
+    check_result(keys, values, out_keys, out_values, num_out);
+}
+
+template <typename Algorithm, typename ExPolicy>
+void test_reduce_by_key_unsorted_async(Algorithm algorithm,
+    ExPolicy&& policy, std::size_t size, int cardinality)
+{
+    std::uniform_int_distribution<int> dis(0, cardinality - 1);
+
+    std::vector<int> keys(size);
+    std::vector<long> values(size);
+    std::generate(keys.begin(), keys.end(), [&]() { return dis(gen); });
+    std::generate(values.begin(), values.end(), [&]() { return dis(gen); });
+
+    std::vector<int> out_keys(size);
+    std::vector<long> out_values(size);
+
+    auto f = algorithm(policy, keys.begin(), keys.end(), values.begin(),
+        out_keys.begin(), out_values.begin());
+    auto result = f.get();
+
+    std::size_t const num_out = std::distance(out_keys.begin(), result.in);
+    HPX_TEST(std::next(out_values.begin(), num_out) == result.out);
+    check_result(keys, values, out_keys, out_values, num_out);
+}
+
+// keys without a trivial hash, using a user supplied reduction
+template <typename Algorithm, typename ExPolicy>
+void test_reduce_by_key_unsorted_strings(
+    Algorithm algorithm, ExPolicy&& policy, std::size_t size)
+{
+    std::uniform_int_distribution<int> dis(0, 999);
+
+    std::vector<std::string> keys(size);
+    std::vector<int> values(size);
+    std::generate(keys.begin(), keys.end(),
+        [&]() { return "key" + std::to_string(dis(gen)); });
+    std::generate(values.begin(), values.end(), [&]() { return dis(gen); });
+
+    std::vector<std::string> out_keys(size);
+    std::vector<int> out_values(size);
+
+    auto result = algorithm(policy, keys.begin(), keys.end(), values.begin(),
+        out_keys.begin(), out_values.begin(), std::hash<std::string>(),
+        std::equal_to<std::string>(),
+        [](int lhs, int rhs) { return (std::max)(lhs, rhs); });
+
+    std::map<std::string, int> expected;
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        auto it = expected.emplace(keys[i], values[i]).first;
+        it->second = (std::max)(it->second, values[i]);
+    }
+
+    std::size_t const num_out = std::distance(out_keys.begin(), result.in);
+    std::map<std::string, int> actual;
+    for (std::size_t i = 0; i != num_out; ++i)
+    {
+        HPX_TEST(actual.emplace(out_keys[i], out_values[i]).second);
+    }
+    HPX_TEST(actual == expected);
+}
+
+template <typename Algorithm>
+void test_reduce_by_key_unsorted(Algorithm algorithm)
+{
+    using namespace hpx::execution;
+
+    // the sizes cover a single chunk and several chunks of the input, the
+    // cardinalities few keys and mostly distinct keys
+    for (std::size_t size : {0, 1, 100, 100000})
+    {
+        for (int cardinality : {1, 13, 1000000})
+        {
+            test_reduce_by_key_unsorted(algorithm, seq, size, cardinality);
+            test_reduce_by_key_unsorted(algorithm, par, size, cardinality);
+            test_reduce_by_key_unsorted(
+                algorithm, par_unseq, size, cardinality);
+
+            test_reduce_by_key_unsorted_async(
+                algorithm, seq(task), size, cardinality);
+            test_reduce_by_key_unsorted_async(
+                algorithm, par(task), size, cardinality);
+        }
+    }
+
+    test_reduce_by_key_unsorted_strings(algorithm, seq, 10000);
+    test_reduce_by_key_unsorted_strings(algorithm, par, 100000);
+}
+
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    test_reduce_by_key_unsorted(reduce_unsorted());
+    test_reduce_by_key_unsorted(reduce_partitioned());
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
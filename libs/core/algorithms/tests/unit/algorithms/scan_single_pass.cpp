@@ -0,0 +1,148 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// The scan algorithms use a single pass scan with decoupled look-back for
+// large inputs. Verify the results for sizes around the threshold and the
+// propagation of exceptions thrown by one of the partitions.
+
+#include <hpx/local/algorithm.hpp>
+#include <hpx/local/execution.hpp>
+#include <hpx/local/init.hpp>
+#include <hpx/local/numeric.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include "test_utils.hpp"
+
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy, typename IteratorTag>
+void test_scan_single_pass(ExPolicy policy, IteratorTag, std::size_t size)
+{
+    using base_iterator = std::vector<std::size_t>::iterator;
+    using iterator = test::test_iterator<base_iterator, IteratorTag>;
+
+    std::uniform_int_distribution<std::size_t> dis(0, 1000);
+
+    std::vector<std::size_t> c(size);
+    std::generate(c.begin(), c.end(), [&]() { return dis(gen); });
+
+    std::vector<std::size_t> d(size);
+    std::vector<std::size_t> e(size);
+    auto plus = [](std::size_t v1, std::size_t v2) { return v1 + v2; };
+    auto twice = [](std::size_t v) { return 2 * v; };
+
+    hpx::inclusive_scan(policy, iterator(std::begin(c)),
+        iterator(std::end(c)), std::begin(d), plus, std::size_t(42));
+    std::inclusive_scan(
+        std::begin(c), std::end(c), std::begin(e), plus, std::size_t(42));
+    HPX_TEST(d == e);
+
+    hpx::exclusive_scan(policy, iterator(std::begin(c)),
+        iterator(std::end(c)), std::begin(d), std::size_t(42), plus);
+    std::exclusive_scan(
+        std::begin(c), std::end(c), std::begin(e), std::size_t(42), plus);
+    HPX_TEST(d == e);
+
+    hpx::transform_inclusive_scan(policy, iterator(std::begin(c)),
+        iterator(std::end(c)), std::begin(d), plus, twice, std::size_t(42));
+    std::transform_inclusive_scan(std::begin(c), std::end(c), std::begin(e),
+        plus, twice, std::size_t(42));
+    HPX_TEST(d == e);
+
+    hpx::transform_exclusive_scan(policy, iterator(std::begin(c)),
+        iterator(std::end(c)), std::begin(d), std::size_t(42), plus, twice);
+    std::transform_exclusive_scan(std::begin(c), std::end(c), std::begin(e),
+        std::size_t(42), plus, twice);
+    HPX_TEST(d == e);
+
+    // in place
+    std::inclusive_scan(std::begin(c), std::end(c), std::begin(e));
+    hpx::inclusive_scan(policy, std::begin(c), std::end(c), std::begin(c));
+    HPX_TEST(c == e);
+}
+
+template <typename ExPolicy, typename IteratorTag>
+void test_scan_single_pass_exception(ExPolicy policy, IteratorTag)
+{
+    using base_iterator = std::vector<std::size_t>::iterator;
+    using iterator = test::test_iterator<base_iterator, IteratorTag>;
+
+    std::size_t const size = hpx::parallel::util::scan_single_pass_min_count;
+    std::vector<std::size_t> c(size, 1);
+    std::vector<std::size_t> d(size);
+
+    // only the partitions containing the element with the given value fail,
+    // all others have to observe the failure of their predecessors
+    c[size / 2 + 1] = 0;
+
+    bool caught_exception = false;
+    try
+    {
+        hpx::inclusive_scan(policy, iterator(std::begin(c)),
+            iterator(std::end(c)), std::begin(d),
+            [](std::size_t v1, std::size_t v2) {
+                if (v2 == 0)
+                    throw std::runtime_error("test");
+                return v1 + v2;
+            });
+
+        HPX_TEST(false);
+    }
+    catch (hpx::exception_list const&)
+    {
+        caught_exception = true;
+    }
+    catch (...)
+    {
+        HPX_TEST(false);
+    }
+
+    HPX_TEST(caught_exception);
+}
+
+template <typename IteratorTag>
+void test_scan_single_pass()
+{
+    using namespace hpx::execution;
+
+    std::size_t const threshold =
+        hpx::parallel::util::scan_single_pass_min_count;
+    for (std::size_t size : {threshold - 1, threshold,
+             std::size_t(16 * threshold + 4711)})
+    {
+        test_scan_single_pass(par, IteratorTag(), size);
+        test_scan_single_pass(par_unseq, IteratorTag(), size);
+    }
+
+    test_scan_single_pass_exception(par, IteratorTag());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    test_scan_single_pass<std::random_access_iterator_tag>();
+    test_scan_single_pass<std::forward_iterator_tag>();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,177 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Sorting arithmetic keys in ascending order using a parallel execution
+// policy is dispatched to a radix sort. Verify the results against std::sort
+// for key distributions exercising the key transformations.
+
+#include <hpx/local/algorithm.hpp>
+#include <hpx/local/execution.hpp>
+#include <hpx/local/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/parallel/algorithms/sort_by_key.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if defined(HPX_DEBUG)
+#define HPX_SORT_RADIX_TEST_SIZE (1 << 17)
+#else
+#define HPX_SORT_RADIX_TEST_SIZE (1 << 20)
+#endif
+
+namespace detail = hpx::parallel::v1::detail;
+
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+static_assert(detail::use_radix_sort_v<hpx::execution::parallel_policy,
+    std::vector<std::uint32_t>::iterator, detail::less>);
+static_assert(detail::use_radix_sort_v<hpx::execution::parallel_policy,
+    double*, std::less<double>>);
+static_assert(!detail::use_radix_sort_v<hpx::execution::sequenced_policy,
+    std::vector<std::uint32_t>::iterator, detail::less>);
+static_assert(!detail::use_radix_sort_v<hpx::execution::parallel_policy,
+    std::vector<std::uint32_t>::iterator, std::greater<>>);
+static_assert(!detail::use_radix_sort_v<hpx::execution::parallel_policy,
+    std::vector<bool>::iterator, detail::less>);
+static_assert(!detail::use_radix_sort_v<hpx::execution::parallel_policy,
+    std::vector<std::string>::iterator, detail::less>);
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+std::vector<T> make_keys(std::size_t size, bool narrow)
+{
+    std::vector<T> keys(size);
+    if constexpr (std::is_floating_point_v<T>)
+    {
+        std::uniform_real_distribution<T> dis(
+            narrow ? T(-1) : T(-1e30), narrow ? T(1) : T(1e30));
+        std::generate(keys.begin(), keys.end(), [&]() { return dis(gen); });
+
+        keys[0] = T(-0.0);
+        keys[1] = T(0.0);
+        keys[2] = (std::numeric_limits<T>::infinity)();
+        keys[3] = -(std::numeric_limits<T>::infinity)();
+        keys[4] = (std::numeric_limits<T>::lowest)();
+        keys[5] = (std::numeric_limits<T>::denorm_min)();
+    }
+    else
+    {
+        // a narrow range of keys leaves the upper digits unused, those
+        // passes are skipped
+        using dist_type = std::conditional_t<std::is_signed_v<T>,
+            std::int64_t, std::uint64_t>;
+        std::uniform_int_distribution<dist_type> dis(
+            narrow ? dist_type(0) : dist_type((std::numeric_limits<T>::min)()),
+            narrow ? dist_type(100) :
+                     dist_type((std::numeric_limits<T>::max)()));
+        std::generate(keys.begin(), keys.end(),
+            [&]() { return static_cast<T>(dis(gen)); });
+
+        keys[0] = (std::numeric_limits<T>::min)();
+        keys[1] = (std::numeric_limits<T>::max)();
+    }
+    return keys;
+}
+
+template <typename T, typename ExPolicy>
+void test_sort_radix(ExPolicy policy, bool narrow)
+{
+    std::vector<T> keys = make_keys<T>(HPX_SORT_RADIX_TEST_SIZE, narrow);
+    std::vector<T> expected = keys;
+
+    std::sort(expected.begin(), expected.end());
+    hpx::sort(policy, keys.begin(), keys.end());
+
+    HPX_TEST(keys == expected);
+}
+
+template <typename T, typename ExPolicy>
+void test_sort_radix_async(ExPolicy policy, bool narrow)
+{
+    std::vector<T> keys = make_keys<T>(HPX_SORT_RADIX_TEST_SIZE, narrow);
+    std::vector<T> expected = keys;
+
+    std::sort(expected.begin(), expected.end());
+    hpx::sort(policy, keys.begin(), keys.end(), std::less<T>()).get();
+
+    HPX_TEST(keys == expected);
+}
+
+template <typename T, typename ExPolicy>
+void test_sort_by_key_radix(ExPolicy policy, bool narrow)
+{
+    std::vector<T> keys = make_keys<T>(HPX_SORT_RADIX_TEST_SIZE, narrow);
+    std::vector<std::size_t> values(keys.size());
+    std::iota(values.begin(), values.end(), std::size_t(0));
+
+    std::vector<T> const original = keys;
+
+    auto result = hpx::parallel::sort_by_key(
+        policy, keys.begin(), keys.end(), values.begin());
+    HPX_TEST(result.first == keys.end());
+    HPX_TEST(result.second == values.end());
+
+    std::vector<T> expected = original;
+    std::sort(expected.begin(), expected.end());
+    HPX_TEST(keys == expected);
+
+    // the values have to follow their keys and form a permutation
+    std::vector<bool> seen(values.size(), false);
+    for (std::size_t i = 0; i != values.size(); ++i)
+    {
+        HPX_TEST(original[values[i]] == keys[i]);
+        HPX_TEST(!seen[values[i]]);
+        seen[values[i]] = true;
+    }
+}
+
+template <typename T>
+void test_sort_radix()
+{
+    using namespace hpx::execution;
+
+    for (bool narrow : {false, true})
+    {
+        test_sort_radix<T>(par, narrow);
+        test_sort_radix<T>(par_unseq, narrow);
+        test_sort_radix_async<T>(par(task), narrow);
+        test_sort_by_key_radix<T>(par, narrow);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    test_sort_radix<std::uint8_t>();
+    test_sort_radix<std::int16_t>();
+    test_sort_radix<std::uint32_t>();
+    test_sort_radix<std::int32_t>();
+    test_sort_radix<std::uint64_t>();
+    test_sort_radix<std::int64_t>();
+    test_sort_radix<float>();
+    test_sort_radix<double>();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
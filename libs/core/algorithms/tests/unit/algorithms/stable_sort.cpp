@@ -7,10 +7,12 @@
 #include <hpx/local/init.hpp>
 #include <hpx/modules/testing.hpp>
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
 #include <iostream>
 #include <string>
+#include <utility>
 #include <vector>
 
 // use smaller array sizes for debug tests
@@ -146,6 +148,37 @@ void test_stable_sort2()
     test_stable_sort2_async(par(task), float(), std::greater<float>());
 }
 
+////////////////////////////////////////////////////////////////////////////////
+// The parallel stable sort merges the sorted halves in parallel, equivalent
+// elements have to keep their relative order across the merge partitions.
+template <typename ExPolicy>
+void test_stable_sort_stability(ExPolicy&& policy, std::size_t num_keys)
+{
+    std::vector<std::pair<int, std::size_t>> c(HPX_SORT_TEST_SIZE);
+    for (std::size_t i = 0; i != c.size(); ++i)
+    {
+        c[i] = std::make_pair(
+            static_cast<int>(std::rand() % static_cast<int>(num_keys)), i);
+    }
+
+    hpx::stable_sort(policy, c.begin(), c.end(),
+        [](auto const& lhs, auto const& rhs) { return lhs.first < rhs.first; });
+
+    HPX_TEST(std::is_sorted(c.begin(), c.end()));
+}
+
+void test_stable_sort_stability()
+{
+    using namespace hpx::execution;
+
+    for (std::size_t num_keys : {1, 2, 100, 100000})
+    {
+        test_stable_sort_stability(seq, num_keys);
+        test_stable_sort_stability(par, num_keys);
+        test_stable_sort_stability(par_unseq, num_keys);
+    }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 int hpx_main(hpx::program_options::variables_map& vm)
 {
@@ -158,6 +191,7 @@ int hpx_main(hpx::program_options::variables_map& vm)
 
     test_stable_sort1();
     test_stable_sort2();
+    test_stable_sort_stability();
     sort_benchmark();
 
     return hpx::local::finalize();
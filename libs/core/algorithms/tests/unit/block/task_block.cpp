@@ -237,11 +237,41 @@ void define_task_block_exceptions_test4()
     }
 }
 
+///////////////////////////////////////////////////////////////////////////////
+int sum_work_first(int n)
+{
+    if (n < 2)
+    {
+        return n;
+    }
+
+    int x = 0, y = 0;
+    define_task_block(hpx::execution::experimental::task_group_mode::work_first,
+        par, [&](auto& trh) {
+            trh.run([&]() { x = sum_work_first(n / 2); });
+            trh.run([&]() { y = sum_work_first(n - n / 2); });
+        });
+    return x + y;
+}
+
+void define_task_block_test3()
+{
+    HPX_TEST_EQ(sum_work_first(10000), 10000);
+
+    hpx::future<void> f = define_task_block(
+        hpx::execution::experimental::task_group_mode::work_first, par(task),
+        [](auto& trh) {
+            trh.run([]() { HPX_TEST_EQ(sum_work_first(100), 100); });
+        });
+    f.get();
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 int hpx_main()
 {
     define_task_block_test1();
     define_task_block_test2();
+    define_task_block_test3();
 
     define_task_block_exceptions_test1();
     define_task_block_exceptions_test2();
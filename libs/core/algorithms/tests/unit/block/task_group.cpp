@@ -115,6 +115,59 @@ void task_group_test3()
     HPX_TEST(caught_exception);
 }
 
+///////////////////////////////////////////////////////////////////////////////
+int fib_work_first(int n)
+{
+    if (n < 2)
+    {
+        return n;
+    }
+
+    int x = 0, y = 0;
+
+    hpx::execution::experimental::task_group g(
+        hpx::execution::experimental::task_group_mode::work_first);
+    g.run([&x, n] { x = fib_work_first(n - 1); });
+    g.run([&y, n] { y = fib_work_first(n - 2); });
+    g.wait();
+
+    return x + y;
+}
+
+void task_group_test4()
+{
+    HPX_TEST_EQ(fib_work_first(22), 17711);
+}
+
+void task_group_test5()
+{
+    bool caught_exception = false;
+    try
+    {
+        hpx::execution::experimental::task_group g(
+            hpx::execution::experimental::task_group_mode::work_first);
+
+        // tasks which are run inline report their exceptions on wait as well
+        for (int i = 0; i != 10; ++i)
+        {
+            g.run([] { throw std::runtime_error("test"); });
+        }
+
+        g.wait();
+        HPX_TEST(false);
+    }
+    catch (hpx::exception_list const& l)
+    {
+        caught_exception = true;
+        HPX_TEST_EQ(l.size(), std::size_t(10));
+    }
+    catch (...)
+    {
+        HPX_TEST(false);
+    }
+    HPX_TEST(caught_exception);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 int hpx_main()
 {
@@ -122,6 +175,8 @@ int hpx_main()
     task_group_test1_reuse();
     task_group_test2();
     task_group_test3();
+    task_group_test4();
+    task_group_test5();
 
     return hpx::local::finalize();
 }
@@ -0,0 +1,134 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/include/datapar.hpp>
+#include <hpx/local/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/parallel/algorithms/replace.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iostream>
+#include <iterator>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../algorithms/test_utils.hpp"
+
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy, typename IteratorTag>
+void test_replace(ExPolicy policy, IteratorTag, std::size_t size)
+{
+    using base_iterator = std::vector<int>::iterator;
+    using iterator = test::test_iterator<base_iterator, IteratorTag>;
+
+    std::uniform_int_distribution<int> dis(0, 7);
+
+    std::vector<int> c(size);
+    std::generate(std::begin(c), std::end(c), [&]() { return dis(gen); });
+    std::vector<int> d = c;
+
+    hpx::replace(policy, iterator(std::begin(c)), iterator(std::end(c)), 3, 42);
+    std::replace(std::begin(d), std::end(d), 3, 42);
+    HPX_TEST(c == d);
+
+    // the predicate is invoked on vector packs as well as on single elements
+    auto pred = [](auto const& v) { return v > 4; };
+
+    hpx::replace_if(
+        policy, iterator(std::begin(c)), iterator(std::end(c)), pred, -1);
+    std::replace_if(std::begin(d), std::end(d), pred, -1);
+    HPX_TEST(c == d);
+}
+
+template <typename ExPolicy, typename IteratorTag>
+void test_replace_async(ExPolicy policy, IteratorTag, std::size_t size)
+{
+    using base_iterator = std::vector<int>::iterator;
+    using iterator = test::test_iterator<base_iterator, IteratorTag>;
+
+    std::uniform_int_distribution<int> dis(0, 7);
+
+    std::vector<int> c(size);
+    std::generate(std::begin(c), std::end(c), [&]() { return dis(gen); });
+    std::vector<int> d = c;
+
+    auto f = hpx::replace(
+        policy, iterator(std::begin(c)), iterator(std::end(c)), 3, 42);
+    f.wait();
+    std::replace(std::begin(d), std::end(d), 3, 42);
+    HPX_TEST(c == d);
+
+    auto pred = [](auto const& v) { return v > 4; };
+
+    auto g = hpx::replace_if(
+        policy, iterator(std::begin(c)), iterator(std::end(c)), pred, -1);
+    g.wait();
+    std::replace_if(std::begin(d), std::end(d), pred, -1);
+    HPX_TEST(c == d);
+}
+
+template <typename IteratorTag>
+void test_replace()
+{
+    using namespace hpx::execution;
+
+    // the sizes cover the unaligned head and the tail of the vector loops
+    for (std::size_t size : {0, 1, 7, 31, 10007})
+    {
+        test_replace(simd, IteratorTag(), size);
+        test_replace(par_simd, IteratorTag(), size);
+
+        test_replace_async(simd(task), IteratorTag(), size);
+        test_replace_async(par_simd(task), IteratorTag(), size);
+    }
+}
+
+void replace_test()
+{
+    test_replace<std::random_access_iterator_tag>();
+    test_replace<std::forward_iterator_tag>();
+}
+
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    replace_test();
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
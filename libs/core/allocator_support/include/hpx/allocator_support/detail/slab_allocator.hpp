@@ -0,0 +1,36 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_SLAB_ALLOCATOR)
+#include <cstddef>
+
+namespace hpx { namespace util { namespace detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The slab allocator serves the small allocations made through the
+    // internal_allocator. Each OS thread owns a cache holding a free list per
+    // size class, the blocks are carved from slabs owned by the cache. Blocks
+    // released by another thread are pushed onto a (lock-free) remote free
+    // list of the owning cache, which reuses them once its own free list is
+    // empty. The caches of exited threads are adopted by new threads, the
+    // slabs are never returned to the system.
+
+    // the largest allocation served by the slab allocator
+    inline constexpr std::size_t slab_allocator_max_size = 2048;
+
+    // Returns a block of at least size bytes (size must not be larger than
+    // slab_allocator_max_size), aligned like std::max_align_t.
+    HPX_CORE_EXPORT void* slab_allocate(std::size_t size);
+
+    // Releases a block returned by slab_allocate(size), from any thread.
+    HPX_CORE_EXPORT void slab_deallocate(void* p, std::size_t size) noexcept;
+}}}    // namespace hpx::util::detail
+
+#endif
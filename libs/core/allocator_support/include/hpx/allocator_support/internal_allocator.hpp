@@ -7,6 +7,7 @@
 #pragma once
 
 #include <hpx/config.hpp>
+#include <hpx/allocator_support/detail/slab_allocator.hpp>
 
 #include <cstddef>
 #include <limits>
@@ -26,8 +27,47 @@
 #include <hpx/config/warnings_prefix.hpp>
 
 namespace hpx { namespace util {
+#if defined(HPX_HAVE_JEMALLOC_PREFIX) || defined(HPX_HAVE_SLAB_ALLOCATOR)
+    namespace detail {
+
+        inline void* internal_malloc(
+            std::size_t size, [[maybe_unused]] std::size_t alignment)
+        {
 #if defined(HPX_HAVE_JEMALLOC_PREFIX)
+            void* p = HPX_PP_CAT(HPX_HAVE_JEMALLOC_PREFIX, malloc)(size);
+            if (p == nullptr)
+            {
+                throw std::bad_alloc();
+            }
+            return p;
+#else
+            if (alignment > __STDCPP_DEFAULT_NEW_ALIGNMENT__)
+            {
+                return ::operator new(size, std::align_val_t(alignment));
+            }
+            return ::operator new(size);
+#endif
+        }
+
+        inline void internal_free(
+            void* p, [[maybe_unused]] std::size_t alignment) noexcept
+        {
+#if defined(HPX_HAVE_JEMALLOC_PREFIX)
+            HPX_PP_CAT(HPX_HAVE_JEMALLOC_PREFIX, free)(p);
+#else
+            if (alignment > __STDCPP_DEFAULT_NEW_ALIGNMENT__)
+            {
+                ::operator delete(p, std::align_val_t(alignment));
+                return;
+            }
+            ::operator delete(p);
+#endif
+        }
+    }    // namespace detail
+
     ///////////////////////////////////////////////////////////////////////////
+    // Allocates the runtime-internal objects, the small objects are served by
+    // the slab allocator (if enabled).
     template <typename T = int>
     struct internal_allocator
     {
@@ -65,25 +105,35 @@ namespace hpx { namespace util {
             return &x;
         }
 
-        [[nodiscard]] pointer allocate(size_type n, void const* hint = nullptr)
+        [[nodiscard]] pointer allocate(
+            size_type n, void const* /* hint */ = nullptr)
         {
             if (max_size() < n)
             {
                 throw std::bad_array_new_length();
             }
 
-            pointer p = reinterpret_cast<pointer>(
-                HPX_PP_CAT(HPX_HAVE_JEMALLOC_PREFIX, malloc)(n * sizeof(T)));
-            if (p == nullptr)
+#if defined(HPX_HAVE_SLAB_ALLOCATOR)
+            if (uses_slab_allocator(n))
             {
-                throw std::bad_alloc();
+                return static_cast<pointer>(
+                    util::detail::slab_allocate(n * sizeof(T)));
             }
-            return p;
+#endif
+            return static_cast<pointer>(
+                util::detail::internal_malloc(n * sizeof(T), alignof(T)));
         }
 
         void deallocate(pointer p, size_type n) noexcept
         {
-            HPX_PP_CAT(HPX_HAVE_JEMALLOC_PREFIX, free)(p);
+#if defined(HPX_HAVE_SLAB_ALLOCATOR)
+            if (uses_slab_allocator(n))
+            {
+                util::detail::slab_deallocate(p, n * sizeof(T));
+                return;
+            }
+#endif
+            util::detail::internal_free(p, alignof(T));
         }
 
         size_type max_size() const noexcept
@@ -102,6 +152,15 @@ namespace hpx { namespace util {
         {
             p->~U();
         }
+
+    private:
+#if defined(HPX_HAVE_SLAB_ALLOCATOR)
+        static constexpr bool uses_slab_allocator(size_type n) noexcept
+        {
+            return alignof(T) <= alignof(std::max_align_t) &&
+                n <= util::detail::slab_allocator_max_size / sizeof(T);
+        }
+#endif
     };
 
     template <typename T>
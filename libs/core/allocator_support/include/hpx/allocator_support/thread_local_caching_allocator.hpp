@@ -0,0 +1,146 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/allocator_support/internal_allocator.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+
+namespace hpx { namespace util {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // This allocator keeps released single objects in a cache local to the
+    // calling (OS-)thread and hands them out again for subsequent allocations
+    // of the same type. Each type gets its own cache, which makes it suitable
+    // for objects that are allocated and released at a high rate (like the
+    // shared states of futures). Allocations of more than one object, and any
+    // allocation if the cache is empty, are forwarded to the underlying
+    // (stateless) allocator.
+    template <typename T = char, typename Allocator = internal_allocator<T>>
+    struct thread_local_caching_allocator
+    {
+        using underlying_allocator_type = typename std::allocator_traits<
+            Allocator>::template rebind_alloc<T>;
+        using underlying_traits =
+            std::allocator_traits<underlying_allocator_type>;
+
+        using value_type = T;
+        using pointer = T*;
+        using const_pointer = T const*;
+        using size_type = std::size_t;
+        using difference_type = std::ptrdiff_t;
+
+        template <typename U>
+        struct rebind
+        {
+            using other = thread_local_caching_allocator<U,
+                typename std::allocator_traits<
+                    Allocator>::template rebind_alloc<U>>;
+        };
+
+        using is_always_equal = std::true_type;
+        using propagate_on_container_move_assignment = std::true_type;
+
+        // The maximal number of released objects kept by each thread.
+        static constexpr std::size_t max_cached_objects = 64;
+
+        thread_local_caching_allocator() = default;
+
+        template <typename U, typename OtherAllocator>
+        explicit thread_local_caching_allocator(
+            thread_local_caching_allocator<U, OtherAllocator> const&) noexcept
+        {
+        }
+
+        [[nodiscard]] pointer allocate(size_type n)
+        {
+#if !defined(HPX_HAVE_ADDRESS_SANITIZER)
+            if (n == 1)
+            {
+                cache& c = get_cache();
+                if (c.count_ != 0)
+                {
+                    return c.objects_[--c.count_];
+                }
+            }
+#endif
+            underlying_allocator_type alloc;
+            return underlying_traits::allocate(alloc, n);
+        }
+
+        void deallocate(pointer p, size_type n) noexcept
+        {
+#if !defined(HPX_HAVE_ADDRESS_SANITIZER)
+            if (n == 1)
+            {
+                cache& c = get_cache();
+                if (c.count_ < max_cached_objects && !c.destroyed_)
+                {
+                    c.objects_[c.count_++] = p;
+                    return;
+                }
+            }
+#endif
+            underlying_allocator_type alloc;
+            underlying_traits::deallocate(alloc, p, n);
+        }
+
+    private:
+        struct cache
+        {
+            cache() = default;
+
+            cache(cache const&) = delete;
+            cache(cache&&) = delete;
+            cache& operator=(cache const&) = delete;
+            cache& operator=(cache&&) = delete;
+
+            ~cache()
+            {
+                underlying_allocator_type alloc;
+                while (count_ != 0)
+                {
+                    underlying_traits::deallocate(alloc, objects_[--count_], 1);
+                }
+
+                // objects released while the thread exits are not cached
+                destroyed_ = true;
+            }
+
+            pointer objects_[max_cached_objects];
+            std::size_t count_ = 0;
+            bool destroyed_ = false;
+        };
+
+        static cache& get_cache() noexcept
+        {
+            thread_local cache c;
+            return c;
+        }
+    };
+
+    template <typename T, typename Allocator, typename U,
+        typename OtherAllocator>
+    constexpr bool operator==(
+        thread_local_caching_allocator<T, Allocator> const&,
+        thread_local_caching_allocator<U, OtherAllocator> const&) noexcept
+    {
+        return true;
+    }
+
+    template <typename T, typename Allocator, typename U,
+        typename OtherAllocator>
+    constexpr bool operator!=(
+        thread_local_caching_allocator<T, Allocator> const&,
+        thread_local_caching_allocator<U, OtherAllocator> const&) noexcept
+    {
+        return false;
+    }
+}}    // namespace hpx::util
@@ -0,0 +1,290 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_SLAB_ALLOCATOR)
+#include <hpx/allocator_support/detail/slab_allocator.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <new>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx { namespace util { namespace detail {
+
+    namespace {
+
+        // slabs are aligned to their size, which allows to find the header
+        // of the slab a block belongs to
+        constexpr std::size_t slab_size = 64 * 1024;
+        constexpr std::size_t slabs_per_arena = 16;
+        constexpr std::size_t cache_line_size = 64;
+
+        // 16 byte steps up to 128 bytes, then four classes per doubling
+        constexpr std::size_t num_size_classes = 24;
+
+        constexpr std::size_t size_class(std::size_t size) noexcept
+        {
+            if (size <= 128)
+            {
+                return size == 0 ? 0 : (size - 1) / 16;
+            }
+            if (size <= 256)
+            {
+                return 8 + (size - 129) / 32;
+            }
+            if (size <= 512)
+            {
+                return 12 + (size - 257) / 64;
+            }
+            if (size <= 1024)
+            {
+                return 16 + (size - 513) / 128;
+            }
+            return 20 + (size - 1025) / 256;
+        }
+
+        constexpr std::size_t block_size(std::size_t size_class) noexcept
+        {
+            if (size_class < 8)
+            {
+                return 16 * (size_class + 1);
+            }
+            if (size_class < 12)
+            {
+                return 128 + 32 * (size_class - 7);
+            }
+            if (size_class < 16)
+            {
+                return 256 + 64 * (size_class - 11);
+            }
+            if (size_class < 20)
+            {
+                return 512 + 128 * (size_class - 15);
+            }
+            return 1024 + 256 * (size_class - 19);
+        }
+
+        static_assert(size_class(slab_allocator_max_size) ==
+                num_size_classes - 1,
+            "the size classes have to cover all sizes up to "
+            "slab_allocator_max_size");
+        static_assert(block_size(num_size_classes - 1) ==
+                slab_allocator_max_size,
+            "the largest block has to hold slab_allocator_max_size bytes");
+
+        struct block
+        {
+            block* next;
+        };
+
+        struct thread_cache;
+
+        // the header at the beginning of each slab, the blocks of a slab all
+        // belong to the same size class
+        struct alignas(cache_line_size) slab_header
+        {
+            thread_cache* owner;
+        };
+
+        // blocks released by other threads
+        struct alignas(cache_line_size) remote_free_list
+        {
+            std::atomic<block*> head{nullptr};
+        };
+
+        struct alignas(cache_line_size) thread_cache
+        {
+            block* free[num_size_classes] = {};
+            remote_free_list remote[num_size_classes];
+        };
+
+        struct slab_pool
+        {
+            std::mutex mtx;
+            std::vector<thread_cache*> free_caches;
+            char* arena = nullptr;
+            std::size_t free_slabs = 0;
+        };
+
+        // never destroyed, blocks are released during static destruction
+        slab_pool& get_slab_pool()
+        {
+            static slab_pool* pool = new slab_pool;
+            return *pool;
+        }
+
+        void* new_slab()
+        {
+            slab_pool& pool = get_slab_pool();
+            std::lock_guard<std::mutex> l(pool.mtx);
+            if (pool.free_slabs == 0)
+            {
+                pool.arena = static_cast<char*>(::operator new(
+                    slab_size * slabs_per_arena, std::align_val_t(slab_size)));
+                pool.free_slabs = slabs_per_arena;
+            }
+
+            --pool.free_slabs;
+            return pool.arena + pool.free_slabs * slab_size;
+        }
+
+        thread_cache* acquire_thread_cache()
+        {
+            slab_pool& pool = get_slab_pool();
+            {
+                std::lock_guard<std::mutex> l(pool.mtx);
+                if (!pool.free_caches.empty())
+                {
+                    thread_cache* cache = pool.free_caches.back();
+                    pool.free_caches.pop_back();
+                    return cache;
+                }
+            }
+            return new thread_cache;
+        }
+
+        void release_thread_cache(thread_cache* cache) noexcept
+        {
+            slab_pool& pool = get_slab_pool();
+            try
+            {
+                std::lock_guard<std::mutex> l(pool.mtx);
+                pool.free_caches.push_back(cache);
+            }
+            catch (...)
+            {
+                // the cache is not reused, the blocks released to it later
+                // are still valid
+            }
+        }
+
+        struct thread_cache_releaser
+        {
+            explicit thread_cache_releaser(thread_cache*& c) noexcept
+              : cache(c)
+            {
+            }
+
+            thread_cache_releaser(thread_cache_releaser const&) = delete;
+            thread_cache_releaser& operator=(
+                thread_cache_releaser const&) = delete;
+
+            ~thread_cache_releaser()
+            {
+                release_thread_cache(cache);
+                cache = nullptr;
+            }
+
+            thread_cache*& cache;
+        };
+
+        thread_cache* get_thread_cache()
+        {
+            // the pointer is trivially destructible and stays accessible
+            // while the thread exits
+            static thread_local thread_cache* cache = nullptr;
+            if (HPX_UNLIKELY(cache == nullptr))
+            {
+                cache = acquire_thread_cache();
+
+                // a cache acquired again after the releaser was destroyed is
+                // not released anymore
+                static thread_local thread_cache_releaser releaser(cache);
+            }
+            return cache;
+        }
+
+        // carves a new slab into blocks of the given size class
+        block* refill(thread_cache* cache, std::size_t size_class)
+        {
+            char* slab = static_cast<char*>(new_slab());
+            ::new (slab) slab_header{cache};
+
+            std::size_t const size = block_size(size_class);
+            std::size_t const count =
+                (slab_size - sizeof(slab_header)) / size;
+
+            char* first = slab + sizeof(slab_header);
+            for (std::size_t i = 0; i != count - 1; ++i)
+            {
+                reinterpret_cast<block*>(first + i * size)->next =
+                    reinterpret_cast<block*>(first + (i + 1) * size);
+            }
+            reinterpret_cast<block*>(first + (count - 1) * size)->next =
+                nullptr;
+
+            return reinterpret_cast<block*>(first);
+        }
+    }    // namespace
+
+    ///////////////////////////////////////////////////////////////////////////
+    void* slab_allocate(std::size_t size)
+    {
+        std::size_t const c = size_class(size);
+        thread_cache* cache = get_thread_cache();
+
+        block* b = cache->free[c];
+        if (HPX_UNLIKELY(b == nullptr))
+        {
+            // reuse the blocks released by other threads
+            b = cache->remote[c].head.exchange(
+                nullptr, std::memory_order_acquire);
+            if (b == nullptr)
+            {
+                b = refill(cache, c);
+            }
+        }
+
+        cache->free[c] = b->next;
+        return b;
+    }
+
+    void slab_deallocate(void* p, std::size_t size) noexcept
+    {
+        if (p == nullptr)
+        {
+            return;
+        }
+
+        std::size_t const c = size_class(size);
+        block* b = static_cast<block*>(p);
+
+        slab_header* slab = reinterpret_cast<slab_header*>(
+            reinterpret_cast<std::uintptr_t>(p) & ~(slab_size - 1));
+
+        thread_cache* cache = nullptr;
+        try
+        {
+            cache = get_thread_cache();
+        }
+        catch (...)
+        {
+            // the block is handed to its owner below
+        }
+
+        if (slab->owner == cache)
+        {
+            b->next = cache->free[c];
+            cache->free[c] = b;
+            return;
+        }
+
+        std::atomic<block*>& head = slab->owner->remote[c].head;
+        block* next = head.load(std::memory_order_relaxed);
+        do
+        {
+            b->next = next;
+        } while (!head.compare_exchange_weak(
+            next, b, std::memory_order_release, std::memory_order_relaxed));
+    }
+}}}    // namespace hpx::util::detail
+
+#endif
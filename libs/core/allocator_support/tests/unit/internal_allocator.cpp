@@ -0,0 +1,145 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/allocator_support/internal_allocator.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <list>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+struct alignas(64) overaligned
+{
+    char data[64];
+};
+
+// the blocks of all sizes are usable and don't overlap
+void test_sizes()
+{
+    hpx::util::internal_allocator<char> alloc;
+
+    std::vector<std::pair<char*, std::size_t>> blocks;
+    for (std::size_t size = 1; size <= 4096; size += 7)
+    {
+        for (int i = 0; i != 4; ++i)
+        {
+            char* p = alloc.allocate(size);
+            HPX_TEST_EQ(reinterpret_cast<std::uintptr_t>(p) %
+                    alignof(std::max_align_t),
+                std::uintptr_t(0));
+            std::memset(p, static_cast<int>(size % 251), size);
+            blocks.emplace_back(p, size);
+        }
+    }
+
+    for (auto const& block : blocks)
+    {
+        for (std::size_t i = 0; i != block.second; ++i)
+        {
+            HPX_TEST_EQ(static_cast<int>(static_cast<unsigned char>(
+                            block.first[i])),
+                static_cast<int>(block.second % 251));
+        }
+        alloc.deallocate(block.first, block.second);
+    }
+
+    hpx::util::internal_allocator<overaligned> overaligned_alloc;
+    overaligned* p = overaligned_alloc.allocate(3);
+    HPX_TEST_EQ(reinterpret_cast<std::uintptr_t>(p) % 64, std::uintptr_t(0));
+    overaligned_alloc.deallocate(p, 3);
+}
+
+// blocks allocated by one thread are released by other threads
+void test_remote_release()
+{
+    std::size_t const num_threads = 4;
+    std::size_t const num_blocks = 10000;
+
+    std::mutex mtx;
+    std::vector<std::vector<std::uint64_t*>> handed_over(num_threads);
+
+    std::vector<std::thread> threads;
+    for (std::size_t t = 0; t != num_threads; ++t)
+    {
+        threads.emplace_back([&, t]() {
+            hpx::util::internal_allocator<std::uint64_t> alloc;
+            for (int round = 0; round != 10; ++round)
+            {
+                std::vector<std::uint64_t*> blocks;
+                for (std::size_t i = 0; i != num_blocks / 10; ++i)
+                {
+                    std::uint64_t* p = alloc.allocate(4);
+                    p[0] = p[3] = t;
+                    blocks.push_back(p);
+                }
+
+                // hand the blocks to the next thread and release the blocks
+                // handed to this one
+                std::vector<std::uint64_t*> received;
+                {
+                    std::lock_guard<std::mutex> l(mtx);
+                    handed_over[(t + 1) % num_threads].insert(
+                        handed_over[(t + 1) % num_threads].end(),
+                        blocks.begin(), blocks.end());
+                    received.swap(handed_over[t]);
+                }
+
+                for (std::uint64_t* p : received)
+                {
+                    HPX_TEST_EQ(p[0], p[3]);
+                    alloc.deallocate(p, 4);
+                }
+            }
+        });
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    hpx::util::internal_allocator<std::uint64_t> alloc;
+    for (auto& blocks : handed_over)
+    {
+        for (std::uint64_t* p : blocks)
+        {
+            HPX_TEST_EQ(p[0], p[3]);
+            alloc.deallocate(p, 4);
+        }
+    }
+}
+
+// containers using the allocator
+void test_container()
+{
+    std::list<int, hpx::util::internal_allocator<int>> l;
+    for (int i = 0; i != 1000; ++i)
+    {
+        l.push_back(i);
+    }
+
+    int expected = 0;
+    for (int i : l)
+    {
+        HPX_TEST_EQ(i, expected++);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    test_sizes();
+    test_remote_release();
+    test_container();
+
+    return hpx::util::report_errors();
+}
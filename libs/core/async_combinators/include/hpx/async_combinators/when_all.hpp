@@ -220,22 +220,82 @@ namespace hpx::lcos::detail {
         }
     };
 
+    // The futures passed as individual arguments are not traversed, the
+    // frame attaches a continuation to all of them at once and counts their
+    // arrivals instead.
+    template <typename Tuple>
+    class when_all_frame
+      : public future_data_allocator<Tuple, hpx::util::internal_allocator<>,
+            when_all_frame<Tuple>>
+    {
+        using base_type = future_data_allocator<Tuple,
+            hpx::util::internal_allocator<>, when_all_frame<Tuple>>;
+
+    public:
+        using type = hpx::future<Tuple>;
+        using init_no_addref = typename base_type::init_no_addref;
+        using other_allocator = typename base_type::other_allocator;
+
+        when_all_frame(init_no_addref no_addref, other_allocator const& alloc,
+            Tuple&& futures)
+          : base_type(no_addref, alloc)
+          , futures_(HPX_MOVE(futures))
+        {
+        }
+
+        void start()
+        {
+            attach_arrival_callbacks(this, arrivals_, futures_);
+            on_arrival();
+        }
+
+        void on_arrival()
+        {
+            if (arrivals_.arrive())
+            {
+                this->set_value(HPX_MOVE(futures_));
+            }
+        }
+
+    private:
+        Tuple futures_;
+        arrival_counter arrivals_;
+    };
+
     template <typename... T>
     typename async_when_all_frame<
         hpx::tuple<hpx::traits::acquire_future_t<T>...>>::type
     when_all_impl(T&&... args)
     {
         using result_type = hpx::tuple<hpx::traits::acquire_future_t<T>...>;
-        using frame_type = async_when_all_frame<result_type>;
-        using no_addref = typename frame_type::base_type::init_no_addref;
 
-        auto frame = hpx::util::traverse_pack_async_allocator(
-            hpx::util::internal_allocator<>{},
-            hpx::util::async_traverse_in_place_tag<frame_type>{}, no_addref{},
-            hpx::traits::acquire_future_disp()(HPX_FORWARD(T, args))...);
+        if constexpr ((hpx::traits::is_future_v<
+                           hpx::traits::acquire_future_t<T>> &&
+                          ...))
+        {
+            using frame_type = when_all_frame<result_type>;
+
+            auto frame = allocate_frame<frame_type>(result_type(
+                hpx::traits::acquire_future_disp()(HPX_FORWARD(T, args))...));
+            frame->start();
 
-        return hpx::traits::future_access<typename frame_type::type>::create(
-            HPX_MOVE(frame));
+            return hpx::traits::future_access<typename frame_type::type>::
+                create(HPX_MOVE(frame));
+        }
+        else
+        {
+            using frame_type = async_when_all_frame<result_type>;
+            using no_addref = typename frame_type::base_type::init_no_addref;
+
+            auto frame = hpx::util::traverse_pack_async_allocator(
+                hpx::util::internal_allocator<>{},
+                hpx::util::async_traverse_in_place_tag<frame_type>{},
+                no_addref{},
+                hpx::traits::acquire_future_disp()(HPX_FORWARD(T, args))...);
+
+            return hpx::traits::future_access<typename frame_type::type>::
+                create(HPX_MOVE(frame));
+        }
     }
 }    // namespace hpx::lcos::detail
 
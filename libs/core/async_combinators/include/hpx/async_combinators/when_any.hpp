@@ -121,14 +121,14 @@ namespace hpx {
 #else    // DOXYGEN
 
 #include <hpx/config.hpp>
-#include <hpx/assert.hpp>
+#include <hpx/allocator_support/internal_allocator.hpp>
 #include <hpx/async_combinators/when_any.hpp>
 #include <hpx/datastructures/tuple.hpp>
-#include <hpx/execution_base/this_thread.hpp>
 #include <hpx/functional/deferred_call.hpp>
 #include <hpx/functional/tag_invoke.hpp>
+#include <hpx/futures/detail/future_data.hpp>
+#include <hpx/futures/detail/future_transforms.hpp>
 #include <hpx/futures/future.hpp>
-#include <hpx/futures/futures_factory.hpp>
 #include <hpx/futures/traits/acquire_future.hpp>
 #include <hpx/futures/traits/detail/future_traits.hpp>
 #include <hpx/futures/traits/future_access.hpp>
@@ -141,7 +141,6 @@ namespace hpx {
 #include <atomic>
 #include <cstddef>
 #include <iterator>
-#include <memory>
 #include <type_traits>
 #include <utility>
 #include <vector>
@@ -211,54 +210,27 @@ namespace hpx {
 namespace hpx::lcos::detail {
 
     ///////////////////////////////////////////////////////////////////////
-    template <typename Sequence>
-    struct when_any;
-
-    template <typename Sequence>
-    struct set_when_any_callback_impl
+    // Invokes the given function for all futures of the sequence (a future
+    // range or a tuple of futures and future ranges), passing along their
+    // position. The iteration stops once the function returns false.
+    template <typename F>
+    class for_each_when_any_future
     {
-        explicit set_when_any_callback_impl(when_any<Sequence>& when) noexcept
-          : when_(when)
+    public:
+        explicit for_each_when_any_future(F& f) noexcept
+          : f_(f)
           , idx_(0)
+          , done_(false)
         {
         }
 
         template <typename Future>
         std::enable_if_t<hpx::traits::is_future_v<Future>> operator()(
-            Future& future) const
+            Future& future)
         {
-            std::size_t index = when_.index_.load(std::memory_order_seq_cst);
-
-            if (index == when_any_result<Sequence>::index_error())
+            if (!done_)
             {
-                using shared_state_ptr =
-                    hpx::traits::detail::shared_state_ptr_for_t<Future>;
-                shared_state_ptr const& shared_state =
-                    traits::detail::get_shared_state(future);
-
-                if (shared_state && !shared_state->is_ready())
-                {
-                    // handle future only if not enough futures are ready
-                    // yet also, do not touch any futures which are already
-                    // ready
-                    shared_state->execute_deferred();
-
-                    // execute_deferred might have made the future ready
-                    if (!shared_state->is_ready())
-                    {
-                        shared_state->set_on_completed(util::deferred_call(
-                            &detail::when_any<Sequence>::on_future_ready,
-                            when_.shared_from_this(), idx_,
-                            hpx::execution_base::this_thread::agent()));
-                        ++idx_;
-                        return;
-                    }
-                }
-
-                if (when_.index_.compare_exchange_strong(index, idx_))
-                {
-                    when_.goal_reached_on_calling_thread_ = true;
-                }
+                done_ = !f_(future, idx_);
             }
             ++idx_;
         }
@@ -266,112 +238,165 @@ namespace hpx::lcos::detail {
         template <typename Sequence_>
         HPX_FORCEINLINE
             std::enable_if_t<hpx::traits::is_future_range_v<Sequence_>>
-            operator()(Sequence_& sequence) const
+            operator()(Sequence_& sequence)
         {
             apply(sequence);
         }
 
         template <typename Tuple, std::size_t... Is>
-        HPX_FORCEINLINE void apply(
-            Tuple& tuple, hpx::util::index_pack<Is...>) const
+        HPX_FORCEINLINE void apply(Tuple& tuple, hpx::util::index_pack<Is...>)
         {
-            int const _sequencer[] = {(((*this)(hpx::get<Is>(tuple))), 0)...};
-            (void) _sequencer;
+            ((*this)(hpx::get<Is>(tuple)), ...);
         }
 
         template <typename... Ts>
-        HPX_FORCEINLINE void apply(hpx::tuple<Ts...>& sequence) const
+        HPX_FORCEINLINE void apply(hpx::tuple<Ts...>& sequence)
         {
             apply(sequence, hpx::util::make_index_pack_t<sizeof...(Ts)>());
         }
 
         template <typename Sequence_>
-        HPX_FORCEINLINE void apply(Sequence_& sequence) const
+        HPX_FORCEINLINE void apply(Sequence_& sequence)
+        {
+            for (auto& future : sequence)
+            {
+                (*this)(future);
+            }
+        }
+
+        // the number of futures visited
+        std::size_t count() const noexcept
         {
-            std::for_each(sequence.begin(), sequence.end(), *this);
+            return idx_;
         }
 
-        detail::when_any<Sequence>& when_;
-        mutable std::size_t idx_;
+    private:
+        F& f_;
+        std::size_t idx_;
+        bool done_;
     };
 
-    template <typename Sequence>
-    HPX_FORCEINLINE void set_on_completed_callback(
-        detail::when_any<Sequence>& when)
-    {
-        set_when_any_callback_impl<Sequence> callback(when);
-        callback.apply(when.lazy_values_.futures);
-    }
-
     ///////////////////////////////////////////////////////////////////////
+    // The shared state of the future returned by when_any. The first input
+    // becoming ready sets the index, the result is set once all
+    // continuations were attached.
     template <typename Sequence>
-    struct when_any
-      : std::enable_shared_from_this<when_any<Sequence>>    //-V690
+    class when_any_frame
+      : public future_data_allocator<when_any_result<Sequence>,
+            hpx::util::internal_allocator<>, when_any_frame<Sequence>>
     {
+        using base_type = future_data_allocator<when_any_result<Sequence>,
+            hpx::util::internal_allocator<>, when_any_frame<Sequence>>;
+
     public:
-        void on_future_ready(
-            std::size_t idx, hpx::execution_base::agent_ref ctx)
+        using result_type = when_any_result<Sequence>;
+        using type = hpx::future<result_type>;
+        using init_no_addref = typename base_type::init_no_addref;
+        using other_allocator = typename base_type::other_allocator;
+
+        when_any_frame(init_no_addref no_addref, other_allocator const& alloc,
+            result_type&& lazy_values)
+          : base_type(no_addref, alloc)
+          , lazy_values_(HPX_MOVE(lazy_values))
+          , index_(result_type::index_error())
         {
-            std::size_t index_not_initialized =
-                when_any_result<Sequence>::index_error();
-            if (index_.compare_exchange_strong(index_not_initialized, idx))
-            {
-                // reactivate waiting thread only if it's not us
-                if (ctx != hpx::execution_base::this_thread::agent())
+            // released by the input which becomes ready first
+            arrivals_.add();
+        }
+
+        void start()
+        {
+            // attach the continuations until one of the futures is found to
+            // be ready
+            auto attach = [this](auto& future, std::size_t idx) -> bool {
+                if (index_.load(std::memory_order_acquire) !=
+                    result_type::index_error())
                 {
-                    ctx.resume();
+                    return false;
                 }
-                else
+
+                auto const& state = traits::detail::get_shared_state(future);
+                if (state && !state->is_ready())
                 {
-                    goal_reached_on_calling_thread_ = true;
+                    // execute_deferred might make the future ready
+                    state->execute_deferred();
+                    if (!state->is_ready())
+                    {
+                        state->set_on_completed(util::deferred_call(
+                            &when_any_frame::on_future_ready,
+                            hpx::intrusive_ptr<when_any_frame>(this), idx));
+                        return true;
+                    }
                 }
-            }
-        }
 
-    private:
-        when_any(when_any const&) = delete;
-        when_any(when_any&) = delete;
+                on_future_ready(idx);
+                return false;
+            };
 
-        when_any& operator=(when_any const&) = delete;
-        when_any& operator=(when_any&&) = delete;
+            for_each_when_any_future<decltype(attach)> callback(attach);
+            callback.apply(lazy_values_.futures);
 
-    public:
-        using argument_type = Sequence;
+            on_arrival();
+        }
 
-        when_any(argument_type&& lazy_values) noexcept
-          : lazy_values_(HPX_MOVE(lazy_values))
-          , index_(when_any_result<Sequence>::index_error())
-          , goal_reached_on_calling_thread_(false)
+        void on_future_ready(std::size_t idx)
         {
+            std::size_t index_not_initialized = result_type::index_error();
+            if (index_.compare_exchange_strong(index_not_initialized, idx))
+            {
+                on_arrival();
+            }
         }
 
-        when_any_result<Sequence> operator()()
+    private:
+        void on_arrival()
         {
-            // set callback functions to executed when future is ready
-            set_on_completed_callback(*this);
+            if (arrivals_.arrive())
+            {
+                lazy_values_.index = index_.load(std::memory_order_relaxed);
+                this->set_value(HPX_MOVE(lazy_values_));
+            }
+        }
+
+        result_type lazy_values_;
+        std::atomic<std::size_t> index_;
+        arrival_counter arrivals_;
+    };
 
-            // if one of the requested futures is already set, our
-            // callback above has already been called often enough, otherwise
-            // we suspend ourselves
-            if (!goal_reached_on_calling_thread_)
+    template <typename Sequence>
+    hpx::future<hpx::when_any_result<Sequence>> when_any_impl(
+        Sequence&& values)
+    {
+        using result_type = hpx::when_any_result<Sequence>;
+        result_type lazy_values(HPX_MOVE(values));
+
+        // no continuations are needed if one of the futures is ready already
+        auto is_ready = [&](auto& future, std::size_t idx) -> bool {
+            if (future.is_ready())
             {
-                // wait for any of the futures to return to become ready
-                hpx::execution_base::this_thread::suspend(
-                    "hpx::lcos::detail::when_any::operator()");
+                lazy_values.index = idx;
+                return false;
             }
+            return true;
+        };
 
-            // that should not happen
-            HPX_ASSERT(
-                index_.load() != when_any_result<Sequence>::index_error());
+        for_each_when_any_future<decltype(is_ready)> probe(is_ready);
+        probe.apply(lazy_values.futures);
 
-            lazy_values_.index = index_.load();
-            return HPX_MOVE(lazy_values_);
+        if (lazy_values.index != result_type::index_error() ||
+            probe.count() == 0)
+        {
+            return hpx::make_ready_future(HPX_MOVE(lazy_values));
         }
 
-        when_any_result<Sequence> lazy_values_;
-        std::atomic<std::size_t> index_;
-        bool goal_reached_on_calling_thread_;
-    };
+        using frame_type = when_any_frame<Sequence>;
+
+        auto frame = allocate_frame<frame_type>(HPX_MOVE(lazy_values));
+        frame->start();
+
+        return hpx::traits::future_access<typename frame_type::type>::create(
+            HPX_MOVE(frame));
+    }
 }    // namespace hpx::lcos::detail
 
 namespace hpx {
@@ -388,18 +413,8 @@ namespace hpx {
         {
             using result_type = std::decay_t<Range>;
 
-            auto f = std::make_shared<lcos::detail::when_any<result_type>>(
+            return lcos::detail::when_any_impl(
                 hpx::traits::acquire_future<result_type>()(values));
-
-            lcos::local::futures_factory<hpx::when_any_result<result_type>()> p(
-                [f = HPX_MOVE(f)]() -> hpx::when_any_result<result_type> {
-                    return (*f)();
-                });
-
-            auto result = p.get_future();
-            p.apply();
-
-            return result;
         }
 
         template <typename Iterator,
@@ -437,18 +452,7 @@ namespace hpx {
             result_type values(
                 func(HPX_FORWARD(T, t)), func(HPX_FORWARD(Ts, ts))...);
 
-            auto f = std::make_shared<lcos::detail::when_any<result_type>>(
-                HPX_MOVE(values));
-
-            lcos::local::futures_factory<hpx::when_any_result<result_type>()> p(
-                [f = HPX_MOVE(f)]() -> hpx::when_any_result<result_type> {
-                    return (*f)();
-                });
-
-            auto result = p.get_future();
-            p.apply();
-
-            return result;
+            return lcos::detail::when_any_impl(HPX_MOVE(values));
         }
     } when_any{};
 
@@ -12,6 +12,7 @@
 #include <hpx/modules/testing.hpp>
 
 #include <chrono>
+#include <cstddef>
 #include <deque>
 #include <list>
 #include <memory>
@@ -644,6 +645,38 @@ void test_wait_for_either_of_two_deferred_futures()
     HPX_TEST_EQ(hpx::get<0>(t).get(), 42);
 }
 
+void test_wait_for_either_of_ready_futures()
+{
+    hpx::future<int> f1 = hpx::async(&make_int_slowly);
+    hpx::future<int> f2 = hpx::make_ready_future(43);
+
+    // the result is available right away if one of the futures is ready
+    hpx::future<
+        hpx::when_any_result<hpx::tuple<hpx::future<int>, hpx::future<int>>>>
+        r = hpx::when_any(f1, f2);
+
+    HPX_TEST(r.is_ready());
+
+    hpx::when_any_result<hpx::tuple<hpx::future<int>, hpx::future<int>>>
+        result = r.get();
+
+    HPX_TEST_EQ(result.index, static_cast<std::size_t>(1));
+    HPX_TEST_EQ(hpx::get<1>(result.futures).get(), 43);
+    HPX_TEST_EQ(hpx::get<0>(result.futures).get(), 42);
+}
+
+void test_wait_for_any_of_no_futures()
+{
+    std::vector<hpx::future<int>> futures;
+
+    hpx::future<hpx::when_any_result<std::vector<hpx::future<int>>>> r =
+        hpx::when_any(futures);
+
+    HPX_TEST(r.is_ready());
+    HPX_TEST_EQ(r.get().index,
+        hpx::when_any_result<std::vector<hpx::future<int>>>::index_error());
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 using hpx::program_options::options_description;
 using hpx::program_options::variables_map;
@@ -675,6 +708,8 @@ int hpx_main(variables_map&)
         //         test_wait_for_any_from_range();
         test_wait_for_either_of_two_late_futures();
         test_wait_for_either_of_two_deferred_futures();
+        test_wait_for_either_of_ready_futures();
+        test_wait_for_any_of_no_futures();
     }
 
     hpx::local::finalize();
@@ -0,0 +1,48 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/async_cuda/cuda_exception.hpp>
+#include <hpx/async_cuda/custom_gpu_api.hpp>
+#include <hpx/async_cuda/target.hpp>
+
+namespace hpx::compute::traits {
+
+    // declared in hpx/compute_local/traits/access_target.hpp, this module
+    // doesn't depend on compute_local
+    template <typename Target, typename Enable>
+    struct access_target;
+
+    // Elements in device memory are accessed by copying them through the
+    // stream of the target, the calls return once the copy has completed.
+    template <>
+    struct access_target<hpx::cuda::experimental::target, void>
+    {
+        using target_type = hpx::cuda::experimental::target;
+
+        template <typename T>
+        static T read(target_type const& tgt, T const* t)
+        {
+            T value;
+            hpx::cuda::experimental::check_cuda_error(cudaMemcpyAsync(&value,
+                t, sizeof(T), cudaMemcpyDeviceToHost,
+                tgt.native_handle().get_stream()));
+            tgt.synchronize();
+            return value;
+        }
+
+        template <typename T>
+        static void write(target_type const& tgt, T* dst, T const* src)
+        {
+            hpx::cuda::experimental::check_cuda_error(cudaMemcpyAsync(dst, src,
+                sizeof(T), cudaMemcpyHostToDevice,
+                tgt.native_handle().get_stream()));
+            tgt.synchronize();
+        }
+    };
+}    // namespace hpx::compute::traits
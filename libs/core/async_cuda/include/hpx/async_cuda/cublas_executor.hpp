@@ -10,26 +10,38 @@
 #include <hpx/config.hpp>
 
 #if defined(HPX_HAVE_GPU_SUPPORT) && defined(HPX_HAVE_GPUBLAS)
+#include <hpx/async_base/launch_policy.hpp>
 #include <hpx/async_cuda/cuda_exception.hpp>
 #include <hpx/async_cuda/cuda_executor.hpp>
 #include <hpx/async_cuda/cuda_future.hpp>
+#include <hpx/async_cuda/cuda_statistics.hpp>
+#include <hpx/async_cuda/cuda_memory_pool.hpp>
 #include <hpx/async_cuda/target.hpp>
 #include <hpx/errors/try_catch_exception_ptr.hpp>
+#include <hpx/execution/detail/future_exec.hpp>
 #include <hpx/execution_base/execution.hpp>
 #include <hpx/execution_base/traits/is_executor.hpp>
 #include <hpx/futures/future.hpp>
+#include <hpx/futures/promise.hpp>
+#include <hpx/synchronization/spinlock.hpp>
+#include <hpx/type_support/unused.hpp>
 
 // CUDA runtime
 #include <hpx/async_cuda/custom_gpu_api.hpp>
 // CuBLAS
 #include <hpx/async_cuda/custom_blas_api.hpp>
 //
+#include <algorithm>
+#include <chrono>
 #include <cstddef>
+#include <cstdint>
 #include <exception>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 namespace hpx { namespace cuda { namespace experimental {
 
@@ -142,19 +154,503 @@ namespace hpx { namespace cuda { namespace experimental {
         };
     }    // namespace detail
 
+    // -------------------------------------------------------------------------
+    // The parameters of the aggregating mode of the cublas executor: calls to
+    // cublasSgemm and cublasDgemm of at most max_gemm_size multiply-adds with
+    // matching shape (operations, sizes, leading dimensions and scalars) are
+    // collected and launched as a single batched call. A batch is launched
+    // once it holds max_batch_size calls, when a call is submitted after the
+    // window has passed since the batch was opened or when the executor is
+    // flushed.
+    struct gemm_aggregation_parameters
+    {
+        std::size_t max_batch_size = 64;
+        std::chrono::steady_clock::duration window =
+            std::chrono::microseconds(100);
+        std::size_t max_gemm_size = 128 * 128 * 128;
+    };
+
+    namespace detail {
+#ifdef HPX_HAVE_HIP
+        using cublas_handle_ptr = std::shared_ptr<void>;
+#else
+        using cublas_handle_ptr = std::shared_ptr<struct cublasContext>;
+#endif
+
+        template <typename T>
+        using gemm_function_t = cublasStatus_t (*)(cublasHandle_t,
+            cublasOperation_t, cublasOperation_t, int, int, int, T const*,
+            T const*, int, T const*, int, T const*, T*, int);
+
+        template <typename T>
+        struct gemm_functions;
+
+        template <>
+        struct gemm_functions<float>
+        {
+            static gemm_function_t<float> gemm() noexcept
+            {
+                return &cublasSgemm;
+            }
+
+            template <typename... Ts>
+            static cublasStatus_t batched(Ts... ts)
+            {
+                return cublasSgemmBatched(ts...);
+            }
+
+            template <typename... Ts>
+            static cublasStatus_t strided_batched(Ts... ts)
+            {
+                return cublasSgemmStridedBatched(ts...);
+            }
+        };
+
+        template <>
+        struct gemm_functions<double>
+        {
+            static gemm_function_t<double> gemm() noexcept
+            {
+                return &cublasDgemm;
+            }
+
+            template <typename... Ts>
+            static cublasStatus_t batched(Ts... ts)
+            {
+                return cublasDgemmBatched(ts...);
+            }
+
+            template <typename... Ts>
+            static cublasStatus_t strided_batched(Ts... ts)
+            {
+                return cublasDgemmStridedBatched(ts...);
+            }
+        };
+
+        // the arguments a gemm has to share with the other calls of a batch
+        template <typename T>
+        struct gemm_shape
+        {
+            cublasOperation_t transa;
+            cublasOperation_t transb;
+            int m;
+            int n;
+            int k;
+            T alpha;
+            int lda;
+            int ldb;
+            T beta;
+            int ldc;
+
+            friend bool operator==(
+                gemm_shape const& lhs, gemm_shape const& rhs) noexcept
+            {
+                return lhs.transa == rhs.transa && lhs.transb == rhs.transb &&
+                    lhs.m == rhs.m && lhs.n == rhs.n && lhs.k == rhs.k &&
+                    lhs.alpha == rhs.alpha && lhs.lda == rhs.lda &&
+                    lhs.ldb == rhs.ldb && lhs.beta == rhs.beta &&
+                    lhs.ldc == rhs.ldc;
+            }
+        };
+
+        template <typename T>
+        struct gemm_batch
+        {
+            gemm_shape<T> shape;
+            std::chrono::steady_clock::time_point opened;
+            std::vector<T const*> a;
+            std::vector<T const*> b;
+            std::vector<T*> c;
+            std::vector<hpx::promise<void>> promises;
+        };
+
+        // returns whether the pointers are spaced evenly, the stride is
+        // given in elements
+        template <typename T>
+        bool get_stride(std::vector<T> const& pointers, long long& stride)
+        {
+            using element_type = std::remove_pointer_t<T>;
+
+            std::uintptr_t const first =
+                reinterpret_cast<std::uintptr_t>(pointers[0]);
+            std::uintptr_t const second =
+                reinterpret_cast<std::uintptr_t>(pointers[1]);
+            if (second < first || (second - first) % sizeof(element_type) != 0)
+            {
+                return false;
+            }
+
+            std::uintptr_t const distance = second - first;
+            for (std::size_t i = 2; i != pointers.size(); ++i)
+            {
+                if (reinterpret_cast<std::uintptr_t>(pointers[i]) -
+                        reinterpret_cast<std::uintptr_t>(pointers[i - 1]) !=
+                    distance)
+                {
+                    return false;
+                }
+            }
+
+            stride = static_cast<long long>(distance / sizeof(element_type));
+            return true;
+        }
+
+        // -------------------------------------------------------------------------
+        // Collects the gemms submitted to an aggregating cublas executor into
+        // batches and launches them on the stream of the executor, shared
+        // between the copies of the executor
+        class gemm_aggregator
+        {
+        public:
+            gemm_aggregator(gemm_aggregation_parameters const& params,
+                cublas_handle_ptr handle,
+                std::shared_ptr<hpx::cuda::experimental::target> target,
+                bool event_mode)
+              : params_(params)
+              , handle_(HPX_MOVE(handle))
+              , target_(HPX_MOVE(target))
+              , event_mode_(event_mode)
+            {
+                if (params_.max_batch_size == 0)
+                {
+                    params_.max_batch_size = 1;
+                }
+            }
+
+            gemm_aggregator(gemm_aggregator const&) = delete;
+            gemm_aggregator& operator=(gemm_aggregator const&) = delete;
+
+            // the pending batches are launched before the executor goes away
+            ~gemm_aggregator()
+            {
+                flush();
+
+                if (pointers_ != nullptr)
+                {
+                    // ignore error
+                    cudaError_t err = cudaFree(pointers_);
+                    HPX_UNUSED(err);
+                }
+            }
+
+            // returns whether this gemm can be added to a batch
+            bool aggregates(int m, int n, int k) const noexcept
+            {
+                return m > 0 && n > 0 && k > 0 &&
+                    std::size_t(m) * std::size_t(n) * std::size_t(k) <=
+                    params_.max_gemm_size;
+            }
+
+            // add the gemm to the batch of its shape, the returned future
+            // becomes ready once the batch has completed
+            template <typename T>
+            hpx::future<void> submit(cublasOperation_t transa,
+                cublasOperation_t transb, int m, int n, int k, T const* alpha,
+                T const* a, int lda, T const* b, int ldb, T const* beta, T* c,
+                int ldc)
+            {
+                gemm_shape<T> const shape{
+                    transa, transb, m, n, k, *alpha, lda, ldb, *beta, ldc};
+                auto const now = std::chrono::steady_clock::now();
+
+                std::lock_guard<mutex_type> l(mtx_);
+
+                // launch the batches whose window has passed
+                launch_expired(float_batches_, now);
+                launch_expired(double_batches_, now);
+
+                std::vector<gemm_batch<T>>& batches = get_batches<T>();
+                auto it = std::find_if(batches.begin(), batches.end(),
+                    [&](gemm_batch<T> const& batch) {
+                        return batch.shape == shape;
+                    });
+                if (it == batches.end())
+                {
+                    batches.push_back(gemm_batch<T>{shape, now});
+                    it = batches.end() - 1;
+                }
+
+                // a batch runs its gemms concurrently, a gemm updating the
+                // same matrix as an earlier one has to wait for that one
+                if (std::find(it->c.begin(), it->c.end(), c) != it->c.end())
+                {
+                    launch(*it);
+                    *it = gemm_batch<T>{shape, now};
+                }
+
+                it->a.push_back(a);
+                it->b.push_back(b);
+                it->c.push_back(c);
+                it->promises.emplace_back();
+                hpx::future<void> f = it->promises.back().get_future();
+
+                if (it->c.size() >= params_.max_batch_size)
+                {
+                    launch(*it);
+                    batches.erase(it);
+                }
+                return f;
+            }
+
+            // launch all pending batches
+            void flush() noexcept
+            {
+                std::lock_guard<mutex_type> l(mtx_);
+                launch_all(float_batches_);
+                launch_all(double_batches_);
+            }
+
+            // the number of gemms waiting in batches
+            std::size_t pending() const
+            {
+                std::lock_guard<mutex_type> l(mtx_);
+                std::size_t count = 0;
+                for (auto const& batch : float_batches_)
+                {
+                    count += batch.c.size();
+                }
+                for (auto const& batch : double_batches_)
+                {
+                    count += batch.c.size();
+                }
+                return count;
+            }
+
+        private:
+            template <typename T>
+            std::vector<gemm_batch<T>>& get_batches() noexcept
+            {
+                if constexpr (std::is_same_v<T, float>)
+                {
+                    return float_batches_;
+                }
+                else
+                {
+                    return double_batches_;
+                }
+            }
+
+            template <typename T>
+            void launch_expired(std::vector<gemm_batch<T>>& batches,
+                std::chrono::steady_clock::time_point now) noexcept
+            {
+                auto it = batches.begin();
+                while (it != batches.end())
+                {
+                    if (now - it->opened < params_.window)
+                    {
+                        ++it;
+                        continue;
+                    }
+                    launch(*it);
+                    it = batches.erase(it);
+                }
+            }
+
+            template <typename T>
+            void launch_all(std::vector<gemm_batch<T>>& batches) noexcept
+            {
+                for (auto& batch : batches)
+                {
+                    launch(batch);
+                }
+                batches.clear();
+            }
+
+            hpx::future<void> get_future() const
+            {
+                if (event_mode_)
+                {
+                    return target_->get_future_with_event();
+                }
+                return target_->get_future_with_callback();
+            }
+
+            // make sure the device buffer holding the pointer arrays of the
+            // batched calls is large enough, all batches are ordered on the
+            // stream and can share the buffer
+            void reserve_pointers(std::size_t bytes)
+            {
+                if (bytes <= pointers_size_)
+                {
+                    return;
+                }
+
+                if (pointers_ != nullptr)
+                {
+                    // cudaFree waits for the batches using the buffer
+                    check_cuda_error(cudaFree(pointers_));
+                    pointers_ = nullptr;
+                    pointers_size_ = 0;
+                }
+
+                check_cuda_error(cudaMalloc(&pointers_, bytes));
+                pointers_size_ = bytes;
+            }
+
+            template <typename T>
+            hpx::future<void> launch_batch(gemm_batch<T>& batch)
+            {
+                using functions = gemm_functions<T>;
+
+                cublasHandle_t handle = handle_.get();
+                cudaStream_t stream = target_->native_handle().get_stream();
+
+                // make sure we run on the correct device and stream
+                check_cuda_error(
+                    cudaSetDevice(target_->native_handle().get_device()));
+                check_cublas_error(cublasSetStream(handle, stream));
+                check_cublas_error(
+                    cublasSetPointerMode(handle, CUBLAS_POINTER_MODE_HOST));
+
+                // a batch is launched as a single kernel
+                detail::record_launch(
+                    target_->native_handle().get_device(), functions::gemm());
+
+                gemm_shape<T> const& s = batch.shape;
+                int const count = static_cast<int>(batch.c.size());
+                if (count == 1)
+                {
+                    check_cublas_error(functions::gemm()(handle, s.transa,
+                        s.transb, s.m, s.n, s.k, &s.alpha, batch.a[0], s.lda,
+                        batch.b[0], s.ldb, &s.beta, batch.c[0], s.ldc));
+                    return get_future();
+                }
+
+                // evenly spaced matrices don't need the pointer arrays
+                long long stride_a = 0, stride_b = 0, stride_c = 0;
+                if (get_stride(batch.a, stride_a) &&
+                    get_stride(batch.b, stride_b) &&
+                    get_stride(batch.c, stride_c))
+                {
+                    check_cublas_error(functions::strided_batched(handle,
+                        s.transa, s.transb, s.m, s.n, s.k, &s.alpha,
+                        batch.a[0], s.lda, stride_a, batch.b[0], s.ldb,
+                        stride_b, &s.beta, batch.c[0], s.ldc, stride_c,
+                        count));
+                    return get_future();
+                }
+
+                // copy the pointer arrays to the device through a staging
+                // buffer in page-locked memory
+                std::size_t const bytes = 3 * batch.c.size() * sizeof(void*);
+                reserve_pointers(bytes);
+
+                pinned_memory_pool& staging_pool =
+                    pinned_memory_pool::get_default_pool();
+                void** staging =
+                    static_cast<void**>(staging_pool.allocate(bytes));
+                for (std::size_t i = 0; i != batch.c.size(); ++i)
+                {
+                    staging[i] = const_cast<T*>(batch.a[i]);
+                    staging[count + i] = const_cast<T*>(batch.b[i]);
+                    staging[2 * count + i] = batch.c[i];
+                }
+
+                cudaError_t err = cudaMemcpyAsync(pointers_, staging, bytes,
+                    cudaMemcpyHostToDevice, stream);
+
+                cublasStatus_t status = CUBLAS_STATUS_SUCCESS;
+                if (err == cudaSuccess)
+                {
+                    void** pointers = static_cast<void**>(pointers_);
+                    status = functions::batched(handle, s.transa, s.transb,
+                        s.m, s.n, s.k, &s.alpha,
+                        reinterpret_cast<T const* const*>(pointers), s.lda,
+                        reinterpret_cast<T const* const*>(pointers + count),
+                        s.ldb, &s.beta,
+                        reinterpret_cast<T* const*>(pointers + 2 * count),
+                        s.ldc, count);
+                }
+
+                if (err != cudaSuccess || status != CUBLAS_STATUS_SUCCESS)
+                {
+                    // wait for the copy to release the staging buffer,
+                    // ignore error
+                    cudaError_t sync_err = cudaStreamSynchronize(stream);
+                    HPX_UNUSED(sync_err);
+
+                    staging_pool.deallocate(staging, bytes);
+                    check_cuda_error(err);
+                    check_cublas_error(status);
+                }
+
+                return get_future().then(hpx::launch::sync,
+                    [&staging_pool, staging, bytes](hpx::future<void>&& f) {
+                        staging_pool.deallocate(staging, bytes);
+                        f.get();
+                    });
+            }
+
+            // launch the batch and complete the futures of its gemms once it
+            // has finished, errors are reported through the futures
+            template <typename T>
+            void launch(gemm_batch<T>& batch) noexcept
+            {
+                std::vector<hpx::promise<void>> promises =
+                    HPX_MOVE(batch.promises);
+
+                hpx::future<void> f = hpx::detail::try_catch_exception_ptr(
+                    [&]() { return launch_batch(batch); },
+                    [&](std::exception_ptr&& ep) {
+                        return hpx::make_exceptional_future<void>(
+                            HPX_MOVE(ep));
+                    });
+
+                f.then(hpx::launch::sync,
+                    [promises = HPX_MOVE(promises)](
+                        hpx::future<void>&& f) mutable {
+                        if (f.has_exception())
+                        {
+                            std::exception_ptr ep = f.get_exception_ptr();
+                            for (auto& p : promises)
+                            {
+                                p.set_exception(ep);
+                            }
+                            return;
+                        }
+
+                        for (auto& p : promises)
+                        {
+                            p.set_value();
+                        }
+                    });
+            }
+
+            using mutex_type = hpx::spinlock;
+
+            gemm_aggregation_parameters params_;
+            cublas_handle_ptr handle_;
+            std::shared_ptr<hpx::cuda::experimental::target> target_;
+            bool event_mode_;
+
+            mutable mutex_type mtx_;
+            std::vector<gemm_batch<float>> float_batches_;
+            std::vector<gemm_batch<double>> double_batches_;
+
+            void* pointers_ = nullptr;
+            std::size_t pointers_size_ = 0;
+        };
+    }    // namespace detail
+
     // -------------------------------------------------------------------------
     // a simple cublas wrapper helper object that can be used to synchronize
     // cublas calls with an hpx future.
+    //
+    // In aggregating mode, small calls to cublasSgemm and cublasDgemm made
+    // through async are collected into batches (see
+    // gemm_aggregation_parameters) and each returned future becomes ready
+    // once its batch has completed. The gemms of a batch run concurrently
+    // and after the calls submitted before the batch is launched, so
+    // aggregated gemms must not depend on each other. Call flush to launch
+    // the pending batches before waiting for their futures or before
+    // submitting work that depends on them.
     // -------------------------------------------------------------------------
     struct cublas_executor : cuda_executor
     {
-#ifdef HPX_HAVE_HIP
-        // hipblas handle is type : void*
-        using handle_ptr = std::shared_ptr<void>;
-#else
-        // cublas handle is type : struct cublasContext *
-        using handle_ptr = std::shared_ptr<struct cublasContext>;
-#endif
+        // cublas handle is type : struct cublasContext *, hipblas handle is
+        // type : void*
+        using handle_ptr = detail::cublas_handle_ptr;
 
         // construct a cublas stream
         explicit cublas_executor(std::size_t device,
@@ -170,8 +666,39 @@ namespace hpx { namespace cuda { namespace experimental {
                 detail::cublas_handle::create(), detail::cublas_handle{});
         }
 
+        // construct a cublas stream in aggregating mode, the scalars of the
+        // gemms are read from host memory
+        cublas_executor(std::size_t device,
+            gemm_aggregation_parameters const& params, bool event_mode = false)
+          : cublas_executor(device, CUBLAS_POINTER_MODE_HOST, event_mode)
+        {
+            aggregator_ = std::make_shared<detail::gemm_aggregator>(
+                params, handle_, target_, event_mode);
+        }
+
         ~cublas_executor() {}
 
+        // returns whether small gemms are collected into batches
+        bool is_aggregating() const noexcept
+        {
+            return aggregator_ != nullptr;
+        }
+
+        // launch the batches of gemms collected so far
+        void flush() const noexcept
+        {
+            if (aggregator_)
+            {
+                aggregator_->flush();
+            }
+        }
+
+        // the number of gemms waiting to be launched in a batch
+        std::size_t pending() const
+        {
+            return aggregator_ ? aggregator_->pending() : 0;
+        }
+
         // -------------------------------------------------------------------------
         // OneWay Execution
         // -------------------------------------------------------------------------
@@ -209,6 +736,8 @@ namespace hpx { namespace cuda { namespace experimental {
             check_cublas_error(
                 cublasSetPointerMode(handle_.get(), pointer_mode_));
 
+            detail::record_launch(device_, cublas_function, args...);
+
             // insert the cublas handle in the arg list and call the cublas function
             detail::dispatch_helper<R, Params...> helper{};
             return helper(
@@ -236,17 +765,41 @@ namespace hpx { namespace cuda { namespace experimental {
         {
             return hpx::detail::try_catch_exception_ptr(
                 [&]() {
+                    // collect small gemms into batches in aggregating mode
+                    if constexpr (std::is_same_v<R (*)(Params...),
+                                      detail::gemm_function_t<float>>)
+                    {
+                        if (aggregates(cublas_function, args...))
+                        {
+                            return aggregator_->submit<float>(
+                                HPX_FORWARD(Args, args)...);
+                        }
+                    }
+                    else if constexpr (std::is_same_v<R (*)(Params...),
+                                           detail::gemm_function_t<double>>)
+                    {
+                        if (aggregates(cublas_function, args...))
+                        {
+                            return aggregator_->submit<double>(
+                                HPX_FORWARD(Args, args)...);
+                        }
+                    }
+
                     // make sure we run on the correct device
                     check_cuda_error(cudaSetDevice(device_));
 
                     // make sure this operation takes place on our stream
                     check_cublas_error(cublasSetStream(handle_.get(), stream_));
 
+                    detail::record_launch(device_, cublas_function, args...);
+                    detail::kernel_timer timer(device_, stream_, event_mode_);
+
                     // insert the cublas handle in the arg list and call the
                     // cublas function
                     detail::dispatch_helper<R, Params...> helper;
                     helper(cublas_function, handle_.get(),
                         HPX_FORWARD(Args, args)...);
+                    timer.stop();
                     return get_future();
                 },
                 [&](std::exception_ptr&& ep) {
@@ -270,9 +823,21 @@ namespace hpx { namespace cuda { namespace experimental {
             return handle_.get();
         }
 
+        // returns whether the gemm can be added to a batch
+        template <typename T, typename... Args>
+        bool aggregates(detail::gemm_function_t<T> gemm,
+            cublasOperation_t const&, cublasOperation_t const&, int m, int n,
+            int k, Args const&...) const noexcept
+        {
+            return aggregator_ &&
+                gemm == detail::gemm_functions<T>::gemm() &&
+                aggregator_->aggregates(m, n, k);
+        }
+
     protected:
         handle_ptr handle_;
         cublasPointerMode_t pointer_mode_;
+        std::shared_ptr<detail::gemm_aggregator> aggregator_;
     };
 
 }}}    // namespace hpx::cuda::experimental
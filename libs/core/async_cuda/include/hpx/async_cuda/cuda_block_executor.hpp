@@ -0,0 +1,397 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/async_base/launch_policy.hpp>
+#include <hpx/async_cuda/cuda_exception.hpp>
+#include <hpx/async_cuda/cuda_memory_pool.hpp>
+#include <hpx/async_cuda/cuda_statistics.hpp>
+#include <hpx/async_cuda/get_targets.hpp>
+#include <hpx/async_cuda/target.hpp>
+#include <hpx/errors/exception.hpp>
+#include <hpx/errors/exception_list.hpp>
+#include <hpx/execution/detail/future_exec.hpp>
+#include <hpx/execution/executors/execution.hpp>
+#include <hpx/execution/executors/static_chunk_size.hpp>
+#include <hpx/execution/traits/executor_traits.hpp>
+#include <hpx/execution_base/traits/is_executor.hpp>
+#include <hpx/functional/invoke.hpp>
+#include <hpx/futures/future.hpp>
+#include <hpx/iterator_support/range.hpp>
+#include <hpx/type_support/unused.hpp>
+
+// CUDA runtime
+#include <hpx/async_cuda/custom_gpu_api.hpp>
+//
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace cuda { namespace experimental {
+
+    namespace detail {
+#if defined(HPX_COMPUTE_CODE)
+        // -------------------------------------------------------------------------
+        // invoke the bulk function for each of the elements of a part of the
+        // shape, the elements have been copied to the device
+        template <typename F, typename T, typename... Ts>
+        __global__ void block_executor_kernel(
+            F f, T const* elements, std::size_t count, Ts... ts)
+        {
+            std::size_t const stride = std::size_t(blockDim.x) * gridDim.x;
+            for (std::size_t i =
+                     std::size_t(blockIdx.x) * blockDim.x + threadIdx.x;
+                 i < count; i += stride)
+            {
+                HPX_INVOKE(f, elements[i], ts...);
+            }
+        }
+#endif
+
+        // -------------------------------------------------------------------------
+        // The targets of a block executor, shared between the copies of the
+        // executor
+        struct cuda_block_executor_state
+        {
+            explicit cuda_block_executor_state(std::vector<target>&& targets)
+              : targets_(HPX_MOVE(targets))
+            {
+                if (targets_.empty())
+                {
+                    HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                        "cuda_block_executor::cuda_block_executor",
+                        "the executor needs at least one target");
+                }
+
+                // the pools refer to the targets, which must not be moved
+                // anymore
+                weights_.reserve(targets_.size());
+                pools_.reserve(targets_.size());
+                for (target const& tgt : targets_)
+                {
+                    std::size_t const pus =
+                        tgt.native_handle().processing_units();
+                    weights_.push_back(pus == 0 ? 1 : pus);
+                    total_weight_ += weights_.back();
+                    pools_.push_back(std::make_unique<device_memory_pool>(tgt));
+                }
+            }
+
+            cuda_block_executor_state(
+                cuda_block_executor_state const&) = delete;
+            cuda_block_executor_state& operator=(
+                cuda_block_executor_state const&) = delete;
+
+            std::vector<target> targets_;
+            std::vector<std::size_t> weights_;
+            std::size_t total_weight_ = 0;
+            std::vector<std::unique_ptr<device_memory_pool>> pools_;
+        };
+    }    // namespace detail
+
+    // -------------------------------------------------------------------------
+    // The cuda block executor distributes bulk work over several devices, it
+    // is the device analogue of hpx::compute::host::block_executor. The shape
+    // is split into contiguous parts, one per target, sized in proportion to
+    // the number of processing units of the devices. The elements of each
+    // part are copied to the device and the bulk function is invoked for
+    // each of them by a kernel launched on the stream of the target.
+    //
+    // The executor can be used with the parallel algorithms whose iteration
+    // functions are device callable (hpx::for_each, hpx::transform, ...),
+    // e.g. hpx::for_each(hpx::execution::par.on(exec), ...), the iterators
+    // have to refer to memory accessible from all targets. The bulk function,
+    // the elements of the shape and the additional arguments are copied to the
+    // device bitwise, like kernel parameters, so they must not own any
+    // resources. The bulk operations are only available in code compiled by
+    // the device compiler. The futures returned by bulk_async_execute require
+    // the cuda polling to be enabled.
+    //
+    // Copies of the executor share the targets and their streams.
+    // -------------------------------------------------------------------------
+    struct cuda_block_executor
+    {
+        using executor_parameters_type = hpx::execution::static_chunk_size;
+
+        // distribute the work over all the devices of this locality
+        cuda_block_executor()
+          : cuda_block_executor(get_local_targets())
+        {
+        }
+
+        // distribute the work over the given targets, throws bad_parameter if
+        // no target is given
+        explicit cuda_block_executor(std::vector<target> targets)
+          : state_(std::make_shared<detail::cuda_block_executor_state>(
+                HPX_MOVE(targets)))
+        {
+        }
+
+        /// \cond NOINTERNAL
+        bool operator==(cuda_block_executor const& rhs) const noexcept
+        {
+            return state_ == rhs.state_;
+        }
+
+        bool operator!=(cuda_block_executor const& rhs) const noexcept
+        {
+            return !(*this == rhs);
+        }
+
+        std::vector<target> const& context() const noexcept
+        {
+            return state_->targets_;
+        }
+        /// \endcond
+
+        std::vector<target> const& targets() const noexcept
+        {
+            return state_->targets_;
+        }
+
+        // the offsets of the parts of a shape of the given size, the part
+        // assigned to the i-th target is [offsets[i], offsets[i + 1])
+        std::vector<std::size_t> partition(std::size_t count) const
+        {
+            std::size_t const num_targets = state_->targets_.size();
+
+            std::vector<std::size_t> offsets;
+            offsets.reserve(num_targets + 1);
+            offsets.push_back(0);
+
+            std::size_t weight = 0;
+            for (std::size_t i = 0; i != num_targets; ++i)
+            {
+                weight += state_->weights_[i];
+                offsets.push_back(static_cast<std::size_t>(
+                    (static_cast<double>(count) * weight) /
+                    state_->total_weight_));
+            }
+
+            // make sure rounding doesn't lose any of the elements
+            offsets.back() = count;
+            return offsets;
+        }
+
+        // the chunk sizes are computed from the number of processing units of
+        // all targets
+        template <typename Parameters>
+        std::size_t processing_units_count(Parameters&&) const noexcept
+        {
+            return state_->total_weight_;
+        }
+
+    private:
+        friend std::size_t tag_invoke(
+            hpx::parallel::execution::processing_units_count_t,
+            cuda_block_executor const& exec) noexcept
+        {
+            return exec.state_->total_weight_;
+        }
+
+#if defined(HPX_COMPUTE_CODE)
+        // -------------------------------------------------------------------------
+        // copy count elements of the shape starting at it to the device of the
+        // i-th target and launch the kernel invoking f on them, returns a
+        // future that becomes ready when the kernel has completed.
+        // Throws cuda_exception if the copy or the launch fails.
+        template <typename F, typename Iter, typename... Ts>
+        hpx::future<void> launch(std::size_t i, F const& f, Iter it,
+            std::size_t count, Ts const&... ts) const
+        {
+            using value_type = std::decay_t<decltype(*it)>;
+            static_assert(std::is_trivially_destructible_v<value_type>,
+                "the elements of the shape are copied to the device "
+                "bitwise, they must be trivially destructible");
+
+            target const& tgt = state_->targets_[i];
+            int const device = tgt.native_handle().get_device();
+            check_cuda_error(cudaSetDevice(device));
+            cudaStream_t stream = tgt.native_handle().get_stream();
+
+            std::size_t const bytes = count * sizeof(value_type);
+
+            pinned_memory_pool& staging_pool =
+                pinned_memory_pool::get_default_pool();
+            void* staging = staging_pool.allocate(bytes);
+            value_type* staged = static_cast<value_type*>(staging);
+            for (std::size_t j = 0; j != count; ++j, ++it)
+            {
+                ::new (static_cast<void*>(staged + j)) value_type(*it);
+            }
+
+            device_memory_pool& pool = *state_->pools_[i];
+            void* elements = pool.allocate(bytes);
+
+            device_statistics* stats = device_statistics::find(device);
+            if (stats != nullptr)
+            {
+                stats->add_transfer(cudaMemcpyHostToDevice, bytes);
+            }
+
+            cudaError_t error = cudaMemcpyAsync(
+                elements, staging, bytes, cudaMemcpyHostToDevice, stream);
+            if (error == cudaSuccess)
+            {
+                if (stats != nullptr)
+                {
+                    stats->add_kernel();
+                }
+
+                constexpr unsigned int threads = 256;
+                unsigned int const blocks =
+                    static_cast<unsigned int>((count + threads - 1) / threads);
+
+                detail::block_executor_kernel<<<blocks, threads, 0, stream>>>(
+                    f, static_cast<value_type const*>(elements), count, ts...);
+                error = cudaGetLastError();
+            }
+
+            // the allocations of the pool are ordered on the stream, the
+            // block can be reused by the work launched after the kernel
+            pool.deallocate(elements, bytes);
+
+            if (error != cudaSuccess)
+            {
+                // wait for the copy to release the staging buffer, ignore
+                // error
+                cudaError_t sync_error = cudaStreamSynchronize(stream);
+                HPX_UNUSED(sync_error);
+
+                staging_pool.deallocate(staging, bytes);
+                check_cuda_error(error);
+            }
+
+            return tgt.get_future_with_event().then(hpx::launch::sync,
+                [&staging_pool, staging, bytes](hpx::future<void>&& f) {
+                    staging_pool.deallocate(staging, bytes);
+                    f.get();
+                });
+        }
+
+        template <typename F, typename Shape, typename... Ts>
+        std::vector<hpx::future<void>> bulk_async_execute_impl(
+            F&& f, Shape const& shape, Ts&&... ts) const
+        {
+            using result_type =
+                parallel::execution::detail::bulk_function_result_t<F, Shape,
+                    Ts...>;
+            static_assert(std::is_void_v<result_type>,
+                "the bulk function invoked by a kernel can't return a value");
+
+            std::vector<hpx::future<void>> results;
+            std::size_t const cnt = util::size(shape);
+            std::vector<std::size_t> const offsets = partition(cnt);
+
+            results.reserve(state_->targets_.size());
+
+            try
+            {
+                auto begin = util::begin(shape);
+                for (std::size_t i = 0; i != state_->targets_.size(); ++i)
+                {
+                    std::size_t const part_size = offsets[i + 1] - offsets[i];
+                    if (part_size == 0)
+                    {
+                        continue;
+                    }
+
+                    auto part_begin = begin;
+                    std::advance(part_begin, offsets[i]);
+                    results.push_back(
+                        launch(i, f, part_begin, part_size, ts...));
+                }
+            }
+            catch (std::bad_alloc const& ba)
+            {
+                throw ba;
+            }
+            catch (...)
+            {
+                results.clear();
+                results.push_back(hpx::make_exceptional_future<void>(
+                    std::current_exception()));
+            }
+            return results;
+        }
+
+        template <typename F, typename Shape, typename... Ts>
+        friend decltype(auto) tag_invoke(
+            hpx::parallel::execution::bulk_async_execute_t,
+            cuda_block_executor const& exec, F&& f, Shape const& shape,
+            Ts&&... ts)
+        {
+            return exec.bulk_async_execute_impl(
+                HPX_FORWARD(F, f), shape, HPX_FORWARD(Ts, ts)...);
+        }
+
+        template <typename F, typename Shape, typename... Ts>
+        friend void tag_invoke(hpx::parallel::execution::bulk_sync_execute_t,
+            cuda_block_executor const& exec, F&& f, Shape const& shape,
+            Ts&&... ts)
+        {
+            std::vector<hpx::future<void>> results =
+                exec.bulk_async_execute_impl(
+                    HPX_FORWARD(F, f), shape, HPX_FORWARD(Ts, ts)...);
+
+            // wait for all devices before reporting any of the errors
+            for (auto& result : results)
+            {
+                result.wait();
+            }
+
+            exception_list errors;
+            for (auto& result : results)
+            {
+                if (result.has_exception())
+                {
+                    errors.add(result.get_exception_ptr());
+                }
+            }
+
+            if (errors.size() != 0)
+            {
+                throw errors;
+            }
+        }
+#endif
+
+        std::shared_ptr<detail::cuda_block_executor_state> state_;
+    };
+}}}    // namespace hpx::cuda::experimental
+
+namespace hpx { namespace parallel { namespace execution {
+
+    /// \cond NOINTERNAL
+    template <>
+    struct executor_execution_category<
+        hpx::cuda::experimental::cuda_block_executor>
+    {
+        using type = hpx::execution::parallel_execution_tag;
+    };
+
+#if defined(HPX_COMPUTE_CODE)
+    template <>
+    struct is_bulk_one_way_executor<
+        hpx::cuda::experimental::cuda_block_executor> : std::true_type
+    {
+    };
+
+    template <>
+    struct is_bulk_two_way_executor<
+        hpx::cuda::experimental::cuda_block_executor> : std::true_type
+    {
+    };
+#endif
+    /// \endcond
+}}}    // namespace hpx::parallel::execution
@@ -28,9 +28,17 @@ namespace hpx { namespace cuda { namespace experimental {
             return event_pool_;
         }
 
+        // events with timing enabled, used to measure the time of kernels
+        static cuda_event_pool& get_timing_event_pool()
+        {
+            static cuda_event_pool timing_event_pool_(cudaEventDefault);
+            return timing_event_pool_;
+        }
+
         // create a bunch of events on initialization
-        cuda_event_pool()
-          : free_list_(initial_events_in_pool)
+        explicit cuda_event_pool(unsigned int flags = cudaEventDisableTiming)
+          : flags_(flags)
+          , free_list_(initial_events_in_pool)
         {
             for (int i = 0; i < initial_events_in_pool; ++i)
             {
@@ -71,14 +79,16 @@ namespace hpx { namespace cuda { namespace experimental {
         {
             cudaEvent_t event;
             // Create an cuda_event to query a CUDA/CUBLAS kernel for completion.
-            // Timing is disabled for performance. [1]
+            // Timing is disabled for performance unless this is the pool of
+            // timing events. [1]
             //
             // [1]: CUDA Runtime API, section 5.5 cuda_event Management
-            check_cuda_error(
-                cudaEventCreateWithFlags(&event, cudaEventDisableTiming));
+            check_cuda_error(cudaEventCreateWithFlags(&event, flags_));
             free_list_.push(event);
         }
 
+        unsigned int flags_;
+
         // pool is dynamically sized and can grow if needed
         boost::lockfree::stack<cudaEvent_t, boost::lockfree::fixed_sized<false>>
             free_list_;
@@ -10,6 +10,7 @@
 #include <hpx/config.hpp>
 #include <hpx/async_cuda/cuda_exception.hpp>
 #include <hpx/async_cuda/cuda_future.hpp>
+#include <hpx/async_cuda/cuda_statistics.hpp>
 #include <hpx/async_cuda/target.hpp>
 #include <hpx/errors/exception.hpp>
 #include <hpx/errors/try_catch_exception_ptr.hpp>
@@ -154,6 +155,8 @@ namespace hpx { namespace cuda { namespace experimental {
             // make sure we run on the correct device
             check_cuda_error(cudaSetDevice(device_));
 
+            detail::record_launch(device_, cuda_function, args...);
+
             // insert the stream handle in the arg list and call the cuda function
             detail::dispatch_helper<R, Params...> helper{};
             helper(cuda_function, HPX_FORWARD(Args, args)..., stream_);
@@ -173,9 +176,13 @@ namespace hpx { namespace cuda { namespace experimental {
                     // make sure we run on the correct device
                     check_cuda_error(cudaSetDevice(device_));
 
+                    detail::record_launch(device_, cuda_kernel, args...);
+                    detail::kernel_timer timer(device_, stream_, event_mode_);
+
                     // insert the stream handle in the arg list and call the cuda function
                     detail::dispatch_helper<R, Params...> helper{};
                     helper(cuda_kernel, HPX_FORWARD(Args, args)..., stream_);
+                    timer.stop();
                     return get_future();
                 },
                 [&](std::exception_ptr&& ep) {
@@ -31,16 +31,21 @@
 namespace hpx { namespace cuda { namespace experimental {
     using event_mode = std::true_type;
     using callback_mode = std::false_type;
+    struct host_func_mode
+    {
+    };
 
     ///////////////////////////////////////////////////////////////////////////
     namespace detail {
         // -------------------------------------------------------------
         // cuda future data implementation
-        // This version supports 2 modes of operation
+        // This version supports 3 modes of operation
         // 1) a callback based future that is made ready
         // by a cuda callback when the stream event occurs
         // 2) an event based callback that must be polled/queried by
         // the runtime to set the future ready state
+        // 3) a host function based future that is made ready by a function
+        // launched on the stream with cudaLaunchHostFunc, no polling is needed
         template <typename Allocator, typename Mode>
         struct future_data;
 
@@ -107,6 +112,38 @@ namespace hpx { namespace cuda { namespace experimental {
             }
         };
 
+        template <typename Allocator>
+        struct future_data<Allocator, host_func_mode>
+          : lcos::detail::future_data_allocator<void, Allocator>
+        {
+            HPX_NON_COPYABLE(future_data);
+
+            using init_no_addref =
+                typename lcos::detail::future_data_allocator<void,
+                    Allocator>::init_no_addref;
+
+            using other_allocator = typename std::allocator_traits<
+                Allocator>::template rebind_alloc<future_data>;
+
+            future_data() {}
+
+            // the function is called from a thread of the cuda runtime, errors
+            // of previous work on the stream are not reported through the
+            // future
+            future_data(init_no_addref no_addref, other_allocator const& alloc,
+                cudaStream_t stream)
+              : lcos::detail::future_data_allocator<void, Allocator>(
+                    no_addref, alloc)
+            {
+                add_host_func_callback(
+                    [fdp = hpx::intrusive_ptr<future_data>(this)](
+                        cudaError_t) { fdp->set_data(hpx::util::unused); },
+                    stream);
+                cud_debug.debug(
+                    debug::str<>("init_host_func"), "event", debug::ptr(this));
+            }
+        };
+
         template <typename Allocator>
         struct future_data<Allocator, callback_mode>
           : lcos::detail::future_data_allocator<void, Allocator>
@@ -221,6 +258,15 @@ namespace hpx { namespace cuda { namespace experimental {
             return get_future<Allocator, event_mode>(a, stream);
         }
 
+        // -------------------------------------------------------------
+        // main API call to get a future from a stream using allocator
+        template <typename Allocator>
+        hpx::future<void> get_future_with_host_func(
+            Allocator const& a, cudaStream_t stream)
+        {
+            return get_future<Allocator, host_func_mode>(a, stream);
+        }
+
         // -------------------------------------------------------------
         // non allocator version of : get future with a callback set
         HPX_CORE_EXPORT hpx::future<void> get_future_with_callback(
@@ -229,5 +275,10 @@ namespace hpx { namespace cuda { namespace experimental {
         // -------------------------------------------------------------
         // non allocator version of : get future with an event set
         HPX_CORE_EXPORT hpx::future<void> get_future_with_event(cudaStream_t);
+
+        // -------------------------------------------------------------
+        // non allocator version of : get future with a host function set
+        HPX_CORE_EXPORT hpx::future<void> get_future_with_host_func(
+            cudaStream_t);
     }    // namespace detail
 }}}      // namespace hpx::cuda::experimental
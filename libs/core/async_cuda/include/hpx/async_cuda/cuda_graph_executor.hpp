@@ -0,0 +1,310 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/async_cuda/cuda_exception.hpp>
+#include <hpx/async_cuda/cuda_executor.hpp>
+#include <hpx/async_cuda/cuda_future.hpp>
+#include <hpx/async_cuda/cuda_statistics.hpp>
+#include <hpx/errors/exception.hpp>
+#include <hpx/errors/try_catch_exception_ptr.hpp>
+#include <hpx/execution_base/execution.hpp>
+#include <hpx/execution_base/traits/is_executor.hpp>
+#include <hpx/functional/invoke.hpp>
+#include <hpx/futures/future.hpp>
+#include <hpx/type_support/unused.hpp>
+
+// CUDA runtime
+#include <hpx/async_cuda/custom_gpu_api.hpp>
+//
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace hpx { namespace cuda { namespace experimental {
+
+    namespace detail {
+        // -------------------------------------------------------------------------
+        // The executable graph of a graph executor, shared between the copies
+        // of the executor
+        struct cuda_graph_state
+        {
+            cuda_graph_state() = default;
+
+            cuda_graph_state(cuda_graph_state const&) = delete;
+            cuda_graph_state& operator=(cuda_graph_state const&) = delete;
+
+            ~cuda_graph_state()
+            {
+                if (exec_)
+                {
+                    // ignore error
+                    cudaError_t err = cudaGraphExecDestroy(exec_);
+                    HPX_UNUSED(err);
+                }
+            }
+
+            // update the executable graph with the parameters of the newly
+            // captured graph, the executable graph is instantiated again only
+            // if the topology of the graph has changed
+            void update(cudaGraph_t graph)
+            {
+                if (exec_)
+                {
+#if defined(HPX_HAVE_HIP) || CUDART_VERSION < 12000
+                    cudaGraphNode_t error_node = nullptr;
+                    cudaGraphExecUpdateResult result;
+                    cudaError_t err =
+                        cudaGraphExecUpdate(exec_, graph, &error_node, &result);
+#else
+                    cudaGraphExecUpdateResultInfo result;
+                    cudaError_t err =
+                        cudaGraphExecUpdate(exec_, graph, &result);
+#endif
+                    if (err == cudaSuccess)
+                    {
+                        // ignore error
+                        err = cudaGraphDestroy(graph);
+                        HPX_UNUSED(err);
+                        return;
+                    }
+
+                    // reset the error state, the graph has to be instantiated
+                    // again
+                    err = cudaGetLastError();
+                    HPX_UNUSED(err);
+
+                    err = cudaGraphExecDestroy(exec_);
+                    HPX_UNUSED(err);
+                    exec_ = nullptr;
+                }
+
+                cudaError_t err =
+                    cudaGraphInstantiateWithFlags(&exec_, graph, 0);
+
+                // the executable graph doesn't depend on the graph, ignore
+                // error
+                cudaError_t destroy_err = cudaGraphDestroy(graph);
+                HPX_UNUSED(destroy_err);
+
+                if (err != cudaSuccess)
+                {
+                    exec_ = nullptr;
+                    check_cuda_error(err);
+                }
+            }
+
+            cudaGraphExec_t exec_ = nullptr;
+            std::atomic<bool> capturing_{false};
+        };
+    }    // namespace detail
+
+    // -------------------------------------------------------------------------
+    // Allows you to capture the kernels and cuda functions launched on the
+    // stream of the executor into a cuda graph and to replay the graph with a
+    // single launch. While capturing, post and async_execute only record the
+    // work into the graph, the futures returned by async_execute are ready
+    // right away. Capturing again updates the parameters of the executable
+    // graph, which is instantiated again only if the sequence of calls has
+    // changed. Copies of the executor share the stream and the graph.
+    //
+    // Capturing is not thread safe, the executor must not be used by other
+    // tasks while capturing.
+    // -------------------------------------------------------------------------
+    struct cuda_graph_executor : cuda_executor_base
+    {
+        // -------------------------------------------------------------------------
+        // construct - create a cuda stream that all tasks invoked by
+        // this helper will use
+        explicit cuda_graph_executor(std::size_t device, bool event_mode = true)
+          : cuda_executor_base(device, event_mode)
+          , state_(std::make_shared<detail::cuda_graph_state>())
+        {
+        }
+
+        // -------------------------------------------------------------------------
+        // returns whether a graph has been captured
+        bool has_graph() const noexcept
+        {
+            return state_->exec_ != nullptr;
+        }
+
+        // returns whether calls are currently recorded into a graph
+        bool is_capturing() const noexcept
+        {
+            return state_->capturing_.load(std::memory_order_relaxed);
+        }
+
+        // -------------------------------------------------------------------------
+        // record the work submitted through the executor by f(exec) into a
+        // graph, replacing (or updating) the previously captured graph
+        // Throws cuda_exception if the graph can't be captured.
+        template <typename F>
+        void capture(F&& f)
+        {
+            check_cuda_error(cudaSetDevice(device_));
+            check_cuda_error(
+                cudaStreamBeginCapture(stream_, cudaStreamCaptureModeRelaxed));
+            state_->capturing_.store(true, std::memory_order_relaxed);
+
+            cudaGraph_t graph = nullptr;
+            hpx::detail::try_catch_exception_ptr(
+                [&]() { HPX_INVOKE(HPX_FORWARD(F, f), *this); },
+                [&](std::exception_ptr&& ep) {
+                    state_->capturing_.store(false, std::memory_order_relaxed);
+
+                    // discard the partially captured graph, ignore error
+                    cudaError_t err = cudaStreamEndCapture(stream_, &graph);
+                    if (err == cudaSuccess && graph != nullptr)
+                    {
+                        err = cudaGraphDestroy(graph);
+                    }
+                    HPX_UNUSED(err);
+                    std::rethrow_exception(HPX_MOVE(ep));
+                });
+
+            state_->capturing_.store(false, std::memory_order_relaxed);
+            check_cuda_error(cudaStreamEndCapture(stream_, &graph));
+
+            state_->update(graph);
+        }
+
+        // -------------------------------------------------------------------------
+        // launch the captured graph on the stream and return a future that
+        // will become ready when all the work of the graph has completed.
+        // Puts an exception in the future if no graph has been captured or if
+        // the launch fails.
+        hpx::future<void> launch() const
+        {
+            return hpx::detail::try_catch_exception_ptr(
+                [&]() {
+                    if (!has_graph())
+                    {
+                        HPX_THROW_EXCEPTION(hpx::invalid_status,
+                            "cuda_graph_executor::launch",
+                            "no graph has been captured");
+                    }
+
+                    // make sure we run on the correct device
+                    check_cuda_error(cudaSetDevice(device_));
+
+                    detail::record_launch(device_, &cudaGraphLaunch);
+                    detail::kernel_timer timer(device_, stream_, event_mode_);
+                    check_cuda_error(cudaGraphLaunch(state_->exec_, stream_));
+                    timer.stop();
+                    return get_future();
+                },
+                [&](std::exception_ptr&& ep) {
+                    return hpx::make_exceptional_future<void>(HPX_MOVE(ep));
+                });
+        }
+
+        // capture the work submitted by f(exec) if no graph has been captured
+        // yet and launch the graph
+        template <typename F>
+        hpx::future<void> launch(F&& f)
+        {
+            return hpx::detail::try_catch_exception_ptr(
+                [&]() {
+                    if (!has_graph())
+                    {
+                        capture(HPX_FORWARD(F, f));
+                    }
+                    return launch();
+                },
+                [&](std::exception_ptr&& ep) {
+                    return hpx::make_exceptional_future<void>(HPX_MOVE(ep));
+                });
+        }
+
+        // -------------------------------------------------------------------------
+        // OneWay Execution
+        template <typename F, typename... Ts>
+        friend decltype(auto) tag_invoke(hpx::parallel::execution::post_t,
+            cuda_graph_executor const& exec, F&& f, Ts&&... ts)
+        {
+            return exec.apply(HPX_FORWARD(F, f), HPX_FORWARD(Ts, ts)...);
+        }
+
+        // -------------------------------------------------------------------------
+        // TwoWay Execution
+        template <typename F, typename... Ts>
+        friend decltype(auto) tag_invoke(
+            hpx::parallel::execution::async_execute_t,
+            cuda_graph_executor const& exec, F&& f, Ts&&... ts)
+        {
+            return exec.async(HPX_FORWARD(F, f), HPX_FORWARD(Ts, ts)...);
+        }
+
+    private:
+        // -------------------------------------------------------------------------
+        // launch a kernel on our stream (or record it into the graph while
+        // capturing) and return without a future.
+        // Throws cuda_exception if the async launch fails.
+        template <typename R, typename... Params, typename... Args>
+        void apply(R (*cuda_function)(Params...), Args&&... args) const
+        {
+            // make sure we run on the correct device
+            check_cuda_error(cudaSetDevice(device_));
+
+            // insert the stream handle in the arg list and call the cuda
+            // function
+            detail::dispatch_helper<R, Params...> helper{};
+            helper(cuda_function, HPX_FORWARD(Args, args)..., stream_);
+        }
+
+        // -------------------------------------------------------------------------
+        // launch a kernel on our stream and return a future that will become
+        // ready when the task completes. While capturing, the kernel is only
+        // recorded into the graph and the returned future is ready.
+        // Puts a cuda_exception in the future if the async launch fails.
+        template <typename R, typename... Params, typename... Args>
+        hpx::future<void> async(
+            R (*cuda_kernel)(Params...), Args&&... args) const
+        {
+            return hpx::detail::try_catch_exception_ptr(
+                [&]() {
+                    apply(cuda_kernel, HPX_FORWARD(Args, args)...);
+
+                    // events recorded on a capturing stream can't be queried
+                    if (is_capturing())
+                    {
+                        return hpx::make_ready_future();
+                    }
+                    return get_future();
+                },
+                [&](std::exception_ptr&& ep) {
+                    return hpx::make_exceptional_future<void>(HPX_MOVE(ep));
+                });
+        }
+
+        std::shared_ptr<detail::cuda_graph_state> state_;
+    };
+}}}    // namespace hpx::cuda::experimental
+
+namespace hpx { namespace parallel { namespace execution {
+
+    /// \cond NOINTERNAL
+    template <>
+    struct is_one_way_executor<hpx::cuda::experimental::cuda_graph_executor>
+      : std::true_type
+    {
+        // we support fire and forget without returning a waitable/future
+    };
+
+    template <>
+    struct is_two_way_executor<hpx::cuda::experimental::cuda_graph_executor>
+      : std::true_type
+    {
+        // we support returning a waitable/future
+    };
+    /// \endcond
+}}}    // namespace hpx::parallel::execution
@@ -0,0 +1,295 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/async_cuda/access_target.hpp>
+#include <hpx/async_cuda/cuda_exception.hpp>
+#include <hpx/async_cuda/custom_gpu_api.hpp>
+#include <hpx/async_cuda/target.hpp>
+#include <hpx/synchronization/spinlock.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx { namespace cuda { namespace experimental {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The counters of a memory pool
+    struct memory_pool_statistics
+    {
+        // the number of allocations served from the blocks cached by the pool
+        std::size_t hits = 0;
+
+        // the number of allocations which had to allocate a new block
+        std::size_t misses = 0;
+
+        // the number of bytes requested by the allocations in use
+        std::size_t requested_bytes = 0;
+
+        // the number of bytes of the blocks in use
+        std::size_t used_bytes = 0;
+
+        // the number of bytes of the blocks cached for reuse
+        std::size_t cached_bytes = 0;
+
+        // the fraction of the memory held by the pool which is not used by
+        // any allocation, either because it is cached or because the blocks
+        // in use are larger than requested
+        double fragmentation() const noexcept
+        {
+            std::size_t const held = used_bytes + cached_bytes;
+            return held == 0 ? 0.0 :
+                               double(held - requested_bytes) / double(held);
+        }
+    };
+
+    namespace detail {
+        ///////////////////////////////////////////////////////////////////////
+        // A pool caching the blocks of memory returned to it. The blocks are
+        // organized in size classes of powers of two, an allocation is served
+        // by a cached block of the same size class if one is available.
+        class HPX_CORE_EXPORT caching_memory_pool
+        {
+        public:
+            caching_memory_pool() = default;
+
+            caching_memory_pool(caching_memory_pool const&) = delete;
+            caching_memory_pool& operator=(
+                caching_memory_pool const&) = delete;
+
+            // the cached blocks have to be freed by the derived pools
+            virtual ~caching_memory_pool();
+
+            void* allocate(std::size_t bytes);
+            void deallocate(void* p, std::size_t bytes) noexcept;
+
+            // free all blocks cached by the pool
+            void release() noexcept;
+
+            memory_pool_statistics statistics() const;
+
+        protected:
+            virtual void* allocate_block(std::size_t bytes) = 0;
+            virtual void free_block(void* p) noexcept = 0;
+
+        private:
+            using mutex_type = hpx::spinlock;
+
+            mutable mutex_type mtx_;
+            std::vector<std::vector<void*>> cached_blocks_;
+            memory_pool_statistics statistics_;
+        };
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    // A pool of page-locked host memory. Transfers from and to page-locked
+    // memory can overlap with computations on the device.
+    class HPX_CORE_EXPORT pinned_memory_pool
+      : public detail::caching_memory_pool
+    {
+    public:
+        pinned_memory_pool() = default;
+        ~pinned_memory_pool() override;
+
+        // the pool used by default constructed pinned_allocators
+        static pinned_memory_pool& get_default_pool();
+
+    protected:
+        void* allocate_block(std::size_t bytes) override;
+        void free_block(void* p) noexcept override;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // A pool of device memory with allocations ordered on the stream of a
+    // target: a block returned to the pool may be reused by work launched on
+    // the same stream right away. New blocks are allocated with
+    // cudaMallocAsync where available. The target has to outlive the pool.
+    class HPX_CORE_EXPORT device_memory_pool
+      : public detail::caching_memory_pool
+    {
+    public:
+        explicit device_memory_pool(target const& t);
+        ~device_memory_pool() override;
+
+        target const& get_target() const noexcept
+        {
+            return *target_;
+        }
+
+    protected:
+        void* allocate_block(std::size_t bytes) override;
+        void free_block(void* p) noexcept override;
+
+    private:
+        target const* target_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // An allocator for page-locked host memory. The memory is accessible from
+    // the host, the allocator can be used wherever a host allocator is
+    // expected.
+    template <typename T>
+    class pinned_allocator
+    {
+    public:
+        using value_type = T;
+
+        template <typename U>
+        struct rebind
+        {
+            using other = pinned_allocator<U>;
+        };
+
+        pinned_allocator() noexcept
+          : pool_(&pinned_memory_pool::get_default_pool())
+        {
+        }
+
+        explicit pinned_allocator(pinned_memory_pool& pool) noexcept
+          : pool_(&pool)
+        {
+        }
+
+        template <typename U>
+        pinned_allocator(pinned_allocator<U> const& rhs) noexcept
+          : pool_(&rhs.get_pool())
+        {
+        }
+
+        T* allocate(std::size_t n)
+        {
+            return static_cast<T*>(pool_->allocate(n * sizeof(T)));
+        }
+
+        void deallocate(T* p, std::size_t n) noexcept
+        {
+            pool_->deallocate(p, n * sizeof(T));
+        }
+
+        pinned_memory_pool& get_pool() const noexcept
+        {
+            return *pool_;
+        }
+
+        friend bool operator==(pinned_allocator const& lhs,
+            pinned_allocator const& rhs) noexcept
+        {
+            return lhs.pool_ == rhs.pool_;
+        }
+
+        friend bool operator!=(pinned_allocator const& lhs,
+            pinned_allocator const& rhs) noexcept
+        {
+            return lhs.pool_ != rhs.pool_;
+        }
+
+    private:
+        pinned_memory_pool* pool_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // An allocator for device memory taken from a device_memory_pool. The
+    // elements are not accessible from the host, they are initialized by
+    // copying them from page-locked host memory on the stream of the pool.
+    template <typename T>
+    class device_allocator
+    {
+        static_assert(std::is_trivially_copyable_v<T>,
+            "device_allocator can only be used with trivially copyable types");
+
+    public:
+        using value_type = T;
+        using target_type = hpx::cuda::experimental::target;
+
+        template <typename U>
+        struct rebind
+        {
+            using other = device_allocator<U>;
+        };
+
+        explicit device_allocator(device_memory_pool& pool) noexcept
+          : pool_(&pool)
+        {
+        }
+
+        template <typename U>
+        device_allocator(device_allocator<U> const& rhs) noexcept
+          : pool_(&rhs.get_pool())
+        {
+        }
+
+        T* allocate(std::size_t n)
+        {
+            return static_cast<T*>(pool_->allocate(n * sizeof(T)));
+        }
+
+        void deallocate(T* p, std::size_t n) noexcept
+        {
+            pool_->deallocate(p, n * sizeof(T));
+        }
+
+        target_type const& target() const noexcept
+        {
+            return pool_->get_target();
+        }
+
+        device_memory_pool& get_pool() const noexcept
+        {
+            return *pool_;
+        }
+
+        // the elements are left uninitialized
+        void bulk_construct(T*, std::size_t) noexcept {}
+
+        // the value is copied to the device through a staging buffer in
+        // page-locked memory, returns once the copy has completed
+        void bulk_construct(T* p, std::size_t count, T const& value)
+        {
+            if (count == 0)
+                return;
+
+            pinned_allocator<T> staging_alloc;
+            T* staging = staging_alloc.allocate(count);
+            std::uninitialized_fill_n(staging, count, value);
+
+            cudaStream_t stream = target().native_handle().get_stream();
+            cudaError_t error = cudaMemcpyAsync(p, staging, count * sizeof(T),
+                cudaMemcpyHostToDevice, stream);
+            if (error == cudaSuccess)
+            {
+                error = cudaStreamSynchronize(stream);
+            }
+            staging_alloc.deallocate(staging, count);
+            check_cuda_error(error);
+        }
+
+        // the elements are trivially destructible
+        void bulk_destroy(T*, std::size_t) noexcept {}
+
+        friend bool operator==(device_allocator const& lhs,
+            device_allocator const& rhs) noexcept
+        {
+            return lhs.pool_ == rhs.pool_;
+        }
+
+        friend bool operator!=(device_allocator const& lhs,
+            device_allocator const& rhs) noexcept
+        {
+            return lhs.pool_ != rhs.pool_;
+        }
+
+    private:
+        device_memory_pool* pool_;
+    };
+}}}    // namespace hpx::cuda::experimental
+
+#include <hpx/config/warnings_suffix.hpp>
@@ -27,7 +27,8 @@ namespace hpx { namespace cuda { namespace experimental {
             // install polling loop on requested thread pool
             if (pool_name_.empty())
             {
-                detail::register_polling(hpx::resource::get_thread_pool(0));
+                detail::register_polling(
+                    hpx::resource::get_polling_thread_pool());
             }
             else
             {
@@ -40,7 +41,8 @@ namespace hpx { namespace cuda { namespace experimental {
         {
             if (pool_name_.empty())
             {
-                detail::unregister_polling(hpx::resource::get_thread_pool(0));
+                detail::unregister_polling(
+                    hpx::resource::get_polling_thread_pool());
             }
             else
             {
@@ -0,0 +1,325 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/async_cuda/custom_gpu_api.hpp>
+#include <hpx/async_cuda/target.hpp>
+#include <hpx/async_cuda/transform_stream.hpp>
+#include <hpx/concepts/concepts.hpp>
+#include <hpx/execution/algorithms/detail/partial_algorithm.hpp>
+#include <hpx/execution/algorithms/schedule_from.hpp>
+#include <hpx/execution_base/completion_scheduler.hpp>
+#include <hpx/execution_base/completion_signatures.hpp>
+#include <hpx/execution_base/receiver.hpp>
+#include <hpx/execution_base/sender.hpp>
+#include <hpx/functional/detail/tag_fallback_invoke.hpp>
+#include <hpx/type_support/pack.hpp>
+
+#include <exception>
+#include <type_traits>
+#include <utility>
+
+namespace hpx { namespace cuda { namespace experimental {
+
+    // A scheduler representing a CUDA stream. Senders completing on a
+    // cuda_scheduler complete as soon as their work has been enqueued on the
+    // stream, not when the work has finished. Consecutive stages added with
+    // then_on_stream are enqueued on the same stream without synchronizing
+    // with the host in between. Only a receiver not running on the stream
+    // (e.g. sync_wait, or then after a transfer to a CPU scheduler) waits for
+    // an event recorded on the stream.
+    struct cuda_scheduler
+    {
+        constexpr cuda_scheduler() = default;
+
+        explicit constexpr cuda_scheduler(cudaStream_t stream) noexcept
+          : stream_(stream)
+        {
+        }
+
+        explicit cuda_scheduler(target const& t) noexcept
+          : stream_(t.native_handle().get_stream())
+        {
+        }
+
+        /// \cond NOINTERNAL
+        bool operator==(cuda_scheduler const& rhs) const noexcept
+        {
+            return stream_ == rhs.stream_;
+        }
+
+        bool operator!=(cuda_scheduler const& rhs) const noexcept
+        {
+            return !(*this == rhs);
+        }
+        /// \endcond
+
+        constexpr cudaStream_t get_stream() const noexcept
+        {
+            return stream_;
+        }
+
+    private:
+        /// \cond NOINTERNAL
+        template <typename Receiver>
+        struct operation_state
+        {
+            HPX_NO_UNIQUE_ADDRESS std::decay_t<Receiver> receiver;
+
+            friend void tag_invoke(hpx::execution::experimental::start_t,
+                operation_state& os) noexcept
+            {
+                // nothing has to be waited for before work is enqueued on
+                // the stream
+                hpx::execution::experimental::set_value(HPX_MOVE(os.receiver));
+            }
+        };
+
+        struct sender
+        {
+            cudaStream_t stream;
+
+            template <typename Env>
+            struct generate_completion_signatures
+            {
+                template <template <typename...> typename Tuple,
+                    template <typename...> typename Variant>
+                using value_types = Variant<Tuple<>>;
+
+                template <template <typename...> typename Variant>
+                using error_types = Variant<std::exception_ptr>;
+
+                static constexpr bool sends_stopped = false;
+            };
+
+            template <typename Env>
+            friend auto tag_invoke(
+                hpx::execution::experimental::get_completion_signatures_t,
+                sender const&, Env) noexcept
+                -> generate_completion_signatures<Env>;
+
+            template <typename Receiver>
+            friend operation_state<Receiver> tag_invoke(
+                hpx::execution::experimental::connect_t, sender&&,
+                Receiver&& receiver)
+            {
+                return {HPX_FORWARD(Receiver, receiver)};
+            }
+
+            template <typename Receiver>
+            friend operation_state<Receiver> tag_invoke(
+                hpx::execution::experimental::connect_t, sender&,
+                Receiver&& receiver)
+            {
+                return {HPX_FORWARD(Receiver, receiver)};
+            }
+
+            template <typename CPO,
+                HPX_CONCEPT_REQUIRES_(std::is_same_v<CPO,
+                    hpx::execution::experimental::set_value_t>)>
+            friend constexpr cuda_scheduler tag_invoke(
+                hpx::execution::experimental::get_completion_scheduler_t<CPO>,
+                sender const& s) noexcept
+            {
+                return cuda_scheduler(s.stream);
+            }
+        };
+
+        friend constexpr sender tag_invoke(
+            hpx::execution::experimental::schedule_t,
+            cuda_scheduler const& sched) noexcept
+        {
+            return {sched.stream_};
+        }
+        /// \endcond
+
+        cudaStream_t stream_{};
+    };
+
+    namespace detail {
+        // The receiver used when transferring to a cuda_scheduler. Values are
+        // forwarded right away. A predecessor running on the same stream
+        // doesn't have to wait for an event if the next receiver continues on
+        // the stream as well.
+        template <typename R>
+        struct transfer_stream_receiver
+        {
+            std::decay_t<R> r;
+            cudaStream_t stream;
+
+            template <typename E>
+            friend void tag_invoke(hpx::execution::experimental::set_error_t,
+                transfer_stream_receiver&& r, E&& e) noexcept
+            {
+                hpx::execution::experimental::set_error(
+                    HPX_MOVE(r.r), HPX_FORWARD(E, e));
+            }
+
+            friend void tag_invoke(hpx::execution::experimental::set_stopped_t,
+                transfer_stream_receiver&& r) noexcept
+            {
+                hpx::execution::experimental::set_stopped(HPX_MOVE(r.r));
+            }
+        };
+
+        // See the note on the set_value customization of
+        // transform_stream_receiver.
+        template <typename R, typename... Ts>
+        void tag_invoke(hpx::execution::experimental::set_value_t,
+            transfer_stream_receiver<R>&& r, Ts&&... ts) noexcept
+        {
+            hpx::execution::experimental::set_value(
+                HPX_MOVE(r.r), HPX_FORWARD(Ts, ts)...);
+        }
+
+        // The receiver continues on the stream only if the next receiver does
+        template <typename R>
+        struct is_transform_stream_receiver<transfer_stream_receiver<R>>
+          : is_transform_stream_receiver<std::decay_t<R>>
+        {
+        };
+
+        template <typename R>
+        bool is_on_stream(transfer_stream_receiver<R> const& r,
+            cudaStream_t stream) noexcept
+        {
+            return r.stream == stream && is_on_stream(r.r, stream);
+        }
+
+        template <typename S>
+        struct transfer_stream_sender
+        {
+            std::decay_t<S> s;
+            cudaStream_t stream;
+
+            template <typename Env>
+            struct generate_completion_signatures
+            {
+                template <template <typename...> class Tuple,
+                    template <typename...> class Variant>
+                using value_types =
+                    hpx::execution::experimental::value_types_of_t<S, Env,
+                        Tuple, Variant>;
+
+                template <template <typename...> class Variant>
+                using error_types =
+                    hpx::execution::experimental::error_types_of_t<S, Env,
+                        Variant>;
+
+                static constexpr bool sends_stopped =
+                    hpx::execution::experimental::sends_stopped_of_v<S, Env>;
+            };
+
+            template <typename Env>
+            friend auto tag_invoke(
+                hpx::execution::experimental::get_completion_signatures_t,
+                transfer_stream_sender const&, Env) noexcept
+                -> generate_completion_signatures<Env>;
+
+            template <typename R>
+            friend auto tag_invoke(hpx::execution::experimental::connect_t,
+                transfer_stream_sender&& s, R&& r)
+            {
+                return hpx::execution::experimental::connect(HPX_MOVE(s.s),
+                    transfer_stream_receiver<R>{HPX_FORWARD(R, r), s.stream});
+            }
+
+            template <typename CPO,
+                HPX_CONCEPT_REQUIRES_(std::is_same_v<CPO,
+                    hpx::execution::experimental::set_value_t>)>
+            friend constexpr cuda_scheduler tag_invoke(
+                hpx::execution::experimental::get_completion_scheduler_t<CPO>,
+                transfer_stream_sender const& s) noexcept
+            {
+                return cuda_scheduler(s.stream);
+            }
+        };
+
+        // A transform_stream_sender that completes on the cuda_scheduler of
+        // its stream, used by then_on_stream
+        template <typename S, typename F>
+        struct then_on_stream_sender : transform_stream_sender<S, F>
+        {
+            template <typename CPO,
+                HPX_CONCEPT_REQUIRES_(std::is_same_v<CPO,
+                    hpx::execution::experimental::set_value_t>)>
+            friend constexpr cuda_scheduler tag_invoke(
+                hpx::execution::experimental::get_completion_scheduler_t<CPO>,
+                then_on_stream_sender const& s) noexcept
+            {
+                return cuda_scheduler(s.stream);
+            }
+        };
+
+        template <typename S, typename Enable = void>
+        struct is_cuda_scheduler_sender : std::false_type
+        {
+        };
+
+        template <typename S>
+        struct is_cuda_scheduler_sender<S,
+            std::enable_if_t<std::is_same_v<
+                hpx::functional::tag_invoke_result_t<
+                    hpx::execution::experimental::get_completion_scheduler_t<
+                        hpx::execution::experimental::set_value_t>,
+                    std::decay_t<S> const&>,
+                cuda_scheduler>>> : std::true_type
+        {
+        };
+    }    // namespace detail
+
+    // transfer (schedule_from) to a cuda_scheduler does not wait for
+    // predecessors running on the same stream
+    template <typename S>
+    auto tag_invoke(hpx::execution::experimental::schedule_from_t,
+        cuda_scheduler const& sched, S&& s)
+    {
+        return detail::transfer_stream_sender<S>{
+            HPX_FORWARD(S, s), sched.get_stream()};
+    }
+
+    // then_on_stream adds a stage to a sender completing on a cuda_scheduler.
+    // Like transform_stream, the stream is passed as an additional argument
+    // to f, and the values of the predecessor are only kept alive until the
+    // work enqueued by f has completed. The returned sender completes on the
+    // same cuda_scheduler, such that further stages are enqueued on the same
+    // stream without waiting on the host.
+    inline constexpr struct then_on_stream_t final
+      : hpx::functional::detail::tag_fallback<then_on_stream_t>
+    {
+    private:
+        // clang-format off
+        template <typename S, typename F,
+            HPX_CONCEPT_REQUIRES_(
+                hpx::execution::experimental::is_sender_v<S>
+            )>
+        // clang-format on
+        friend constexpr HPX_FORCEINLINE auto tag_fallback_invoke(
+            then_on_stream_t, S&& s, F&& f)
+        {
+            static_assert(detail::is_cuda_scheduler_sender<S>::value,
+                "then_on_stream requires a sender completing on a "
+                "cuda_scheduler");
+
+            cudaStream_t stream =
+                hpx::execution::experimental::get_completion_scheduler<
+                    hpx::execution::experimental::set_value_t>(s)
+                    .get_stream();
+            return detail::then_on_stream_sender<S, F>{
+                {HPX_FORWARD(S, s), HPX_FORWARD(F, f), stream}};
+        }
+
+        template <typename F>
+        friend constexpr HPX_FORCEINLINE auto tag_fallback_invoke(
+            then_on_stream_t, F&& f)
+        {
+            return hpx::execution::experimental::detail::partial_algorithm<
+                then_on_stream_t, F>{HPX_FORWARD(F, f)};
+        }
+    } then_on_stream{};
+}}}    // namespace hpx::cuda::experimental
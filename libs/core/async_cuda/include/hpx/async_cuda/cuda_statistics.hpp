@@ -0,0 +1,179 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/async_cuda/custom_gpu_api.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx { namespace cuda { namespace experimental {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The statistics of the work submitted to one device through the cuda
+    // executors. They are exposed as the /cuda performance counters, the
+    // getters return the current value and reset it if requested.
+    class HPX_CORE_EXPORT device_statistics
+    {
+    public:
+        device_statistics() = default;
+
+        device_statistics(device_statistics const&) = delete;
+        device_statistics& operator=(device_statistics const&) = delete;
+
+        // the statistics of the given device, throws bad_parameter if there
+        // is no such device
+        static device_statistics& get(int device);
+
+        // returns nullptr if there is no such device
+        static device_statistics* find(int device) noexcept;
+
+        static std::size_t get_num_devices() noexcept;
+
+        // Measuring the kernel times costs two timing events per launch and
+        // the polling times two clock reads per poll, both are only measured
+        // once enabled (the counters enable them when they are created).
+        static void enable_kernel_timing(bool enable = true) noexcept;
+        static bool is_kernel_timing_enabled() noexcept;
+        static void enable_polling_timing(bool enable = true) noexcept;
+        static bool is_polling_timing_enabled() noexcept;
+
+        void add_kernel() noexcept
+        {
+            kernels_.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        void add_kernel_time(std::int64_t ns) noexcept
+        {
+            kernel_time_.fetch_add(ns, std::memory_order_relaxed);
+            timed_kernels_.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        // copies between host and device add to the transferred bytes, other
+        // copies are not counted
+        void add_transfer(cudaMemcpyKind kind, std::size_t bytes) noexcept
+        {
+            if (kind == cudaMemcpyHostToDevice)
+            {
+                host_to_device_.fetch_add(static_cast<std::int64_t>(bytes),
+                    std::memory_order_relaxed);
+            }
+            else if (kind == cudaMemcpyDeviceToHost)
+            {
+                device_to_host_.fetch_add(static_cast<std::int64_t>(bytes),
+                    std::memory_order_relaxed);
+            }
+        }
+
+        // the completions awaited on the streams of the device
+        void add_pending_event() noexcept
+        {
+            pending_events_.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        void remove_pending_event() noexcept
+        {
+            pending_events_.fetch_sub(1, std::memory_order_relaxed);
+        }
+
+        std::int64_t get_kernel_count(bool reset) noexcept;
+
+        // the average time of the timed kernels in nanoseconds
+        std::int64_t get_average_kernel_time(bool reset) noexcept;
+
+        // the accumulated time of the timed kernels in nanoseconds and their
+        // number
+        std::int64_t get_kernel_time(bool reset) noexcept;
+        std::int64_t get_timed_kernel_count(bool reset) noexcept;
+
+        std::int64_t get_host_to_device_bytes(bool reset) noexcept;
+        std::int64_t get_device_to_host_bytes(bool reset) noexcept;
+
+        // the number of pending completions, can't be reset
+        std::int64_t get_queue_depth(bool reset) noexcept;
+
+        // the time spent polling for completed events and the number of
+        // polls, the polling is shared by all devices
+        static void add_polling_time(std::int64_t ns) noexcept;
+        static std::int64_t get_polling_time(bool reset) noexcept;
+        static std::int64_t get_polling_count(bool reset) noexcept;
+
+    private:
+        std::atomic<std::int64_t> kernels_{0};
+        std::atomic<std::int64_t> kernel_time_{0};
+        std::atomic<std::int64_t> timed_kernels_{0};
+        std::atomic<std::int64_t> host_to_device_{0};
+        std::atomic<std::int64_t> device_to_host_{0};
+        std::atomic<std::int64_t> pending_events_{0};
+    };
+
+    namespace detail {
+        ///////////////////////////////////////////////////////////////////////
+        // Records a cuda function launched by an executor on the given device,
+        // copies count as transfers and everything else as kernels.
+        template <typename R, typename... Params, typename... Args>
+        void record_launch(
+            int device, R (*)(Params...), Args const&...) noexcept
+        {
+            if (device_statistics* stats = device_statistics::find(device))
+            {
+                stats->add_kernel();
+            }
+        }
+
+        template <typename Dst, typename Src, typename Count, typename Kind>
+        void record_launch(int device,
+            cudaError_t (*cuda_function)(
+                void*, void const*, std::size_t, cudaMemcpyKind, cudaStream_t),
+            Dst const&, Src const&, Count const& count,
+            Kind const& kind) noexcept
+        {
+            if (device_statistics* stats = device_statistics::find(device))
+            {
+                if (cuda_function == &cudaMemcpyAsync)
+                {
+                    stats->add_transfer(static_cast<cudaMemcpyKind>(kind),
+                        static_cast<std::size_t>(count));
+                }
+                else
+                {
+                    stats->add_kernel();
+                }
+            }
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // Measures the time of the work launched on a stream between the
+        // construction of the timer and the call to stop(). Does nothing
+        // unless kernel timing is enabled. The elapsed time is added to the
+        // statistics of the device once the work has completed, which is
+        // detected through the event polling.
+        class HPX_CORE_EXPORT kernel_timer
+        {
+        public:
+            kernel_timer(int device, cudaStream_t stream, bool event_mode);
+            ~kernel_timer();
+
+            kernel_timer(kernel_timer const&) = delete;
+            kernel_timer& operator=(kernel_timer const&) = delete;
+
+            void stop();
+
+        private:
+            int device_;
+            cudaStream_t stream_;
+            cudaEvent_t start_;
+            bool started_ = false;
+        };
+    }    // namespace detail
+}}}    // namespace hpx::cuda::experimental
+
+#include <hpx/config/warnings_suffix.hpp>
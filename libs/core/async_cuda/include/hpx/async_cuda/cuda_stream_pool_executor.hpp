@@ -0,0 +1,355 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/async_base/launch_policy.hpp>
+#include <hpx/async_base/scheduling_properties.hpp>
+#include <hpx/async_cuda/cuda_exception.hpp>
+#include <hpx/async_cuda/cuda_executor.hpp>
+#include <hpx/async_cuda/cuda_future.hpp>
+#include <hpx/async_cuda/cuda_statistics.hpp>
+#include <hpx/errors/try_catch_exception_ptr.hpp>
+#include <hpx/execution/detail/future_exec.hpp>
+#include <hpx/execution_base/execution.hpp>
+#include <hpx/execution_base/traits/is_executor.hpp>
+#include <hpx/futures/future.hpp>
+#include <hpx/modules/threading_base.hpp>
+#include <hpx/type_support/unused.hpp>
+
+// CUDA runtime
+#include <hpx/async_cuda/custom_gpu_api.hpp>
+//
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace hpx { namespace cuda { namespace experimental {
+
+    // -------------------------------------------------------------------------
+    // The strategies used to select the stream a task is launched on
+    enum class stream_selection
+    {
+        // use the streams of the pool one after the other
+        round_robin,
+        // use the stream with the smallest number of pending tasks
+        least_loaded
+    };
+
+    // -------------------------------------------------------------------------
+    // A pool of streams on a device. The pool holds the same number of streams
+    // with the lowest (normal) and with the greatest (high) stream priority
+    // supported by the device. Streams are created on construction and
+    // destroyed with the pool, the number of tasks pending on each of the
+    // streams is tracked by the executors using the pool.
+    // -------------------------------------------------------------------------
+    class cuda_stream_pool
+    {
+    public:
+        struct stream_data
+        {
+            cudaStream_t stream_ = nullptr;
+            std::atomic<std::size_t> pending_{0};
+        };
+
+        cuda_stream_pool(int device, std::size_t num_streams)
+          : device_(device)
+          , num_streams_(num_streams)
+          , streams_{std::make_unique<stream_data[]>(num_streams),
+                std::make_unique<stream_data[]>(num_streams)}
+        {
+            HPX_ASSERT(num_streams != 0);
+
+            check_cuda_error(cudaSetDevice(device_));
+
+            int least_priority = 0;
+            int greatest_priority = 0;
+            check_cuda_error(cudaDeviceGetStreamPriorityRange(
+                &least_priority, &greatest_priority));
+
+            int const priorities[] = {least_priority, greatest_priority};
+            for (int i = 0; i != 2; ++i)
+            {
+                for (std::size_t s = 0; s != num_streams_; ++s)
+                {
+                    check_cuda_error(cudaStreamCreateWithPriority(
+                        &streams_[i][s].stream_, cudaStreamNonBlocking,
+                        priorities[i]));
+                }
+            }
+        }
+
+        cuda_stream_pool(cuda_stream_pool const&) = delete;
+        cuda_stream_pool& operator=(cuda_stream_pool const&) = delete;
+
+        ~cuda_stream_pool()
+        {
+            for (auto& streams : streams_)
+            {
+                for (std::size_t s = 0; s != num_streams_; ++s)
+                {
+                    if (streams[s].stream_)
+                    {
+                        // ignore error
+                        cudaError_t err = cudaStreamDestroy(streams[s].stream_);
+                        HPX_UNUSED(err);
+                    }
+                }
+            }
+        }
+
+        int get_device() const noexcept
+        {
+            return device_;
+        }
+
+        // the number of streams for each of the priorities
+        std::size_t size() const noexcept
+        {
+            return num_streams_;
+        }
+
+        // the number of tasks pending on the given stream
+        std::size_t pending(std::size_t stream, bool high_priority) const
+        {
+            HPX_ASSERT(stream < num_streams_);
+            return streams_[high_priority][stream].pending_.load(
+                std::memory_order_relaxed);
+        }
+
+        // select the stream the next task is launched on
+        stream_data& select(stream_selection selection, bool high_priority)
+        {
+            stream_data* streams = streams_[high_priority].get();
+            if (selection == stream_selection::round_robin)
+            {
+                std::size_t const next = next_[high_priority].fetch_add(
+                    1, std::memory_order_relaxed);
+                return streams[next % num_streams_];
+            }
+
+            std::size_t selected = 0;
+            std::size_t min_pending = std::size_t(-1);
+            for (std::size_t s = 0; s != num_streams_; ++s)
+            {
+                std::size_t const pending =
+                    streams[s].pending_.load(std::memory_order_relaxed);
+                if (pending < min_pending)
+                {
+                    selected = s;
+                    min_pending = pending;
+                    if (pending == 0)
+                        break;
+                }
+            }
+            return streams[selected];
+        }
+
+    private:
+        int device_;
+        std::size_t num_streams_;
+
+        // the streams with normal and with high priority
+        std::unique_ptr<stream_data[]> streams_[2];
+        std::atomic<std::size_t> next_[2] = {{0}, {0}};
+    };
+
+    // -------------------------------------------------------------------------
+    // Allows you to launch kernels on the streams of a stream pool and get
+    // futures back when they are ready. Each task is launched on one of the
+    // streams selected round-robin or by the number of pending tasks, tasks
+    // launched with a high priority use the high priority streams of the
+    // pool. Copies of the executor share the same pool.
+    // -------------------------------------------------------------------------
+    struct cuda_stream_pool_executor
+    {
+        using future_type = hpx::future<void>;
+
+        // -------------------------------------------------------------------------
+        // construct - create a pool of num_streams streams (per priority) on
+        // the given device
+        explicit cuda_stream_pool_executor(std::size_t device,
+            std::size_t num_streams = 4,
+            stream_selection selection = stream_selection::round_robin,
+            bool event_mode = true)
+          : pool_(std::make_shared<cuda_stream_pool>(int(device), num_streams))
+          , selection_(selection)
+          , event_mode_(event_mode)
+        {
+        }
+
+        // -------------------------------------------------------------------------
+        // construct - use the streams of an existing pool
+        explicit cuda_stream_pool_executor(
+            std::shared_ptr<cuda_stream_pool> pool,
+            stream_selection selection = stream_selection::round_robin,
+            bool event_mode = true)
+          : pool_(HPX_MOVE(pool))
+          , selection_(selection)
+          , event_mode_(event_mode)
+        {
+            HPX_ASSERT(pool_);
+        }
+
+        std::shared_ptr<cuda_stream_pool> const& get_pool() const noexcept
+        {
+            return pool_;
+        }
+
+        stream_selection get_stream_selection() const noexcept
+        {
+            return selection_;
+        }
+
+        // -------------------------------------------------------------------------
+        // support with_priority property, high priority tasks are launched on
+        // the high priority streams
+        friend cuda_stream_pool_executor tag_invoke(
+            hpx::execution::experimental::with_priority_t,
+            cuda_stream_pool_executor const& exec,
+            hpx::threads::thread_priority priority)
+        {
+            auto exec_with_priority = exec;
+            exec_with_priority.priority_ = priority;
+            return exec_with_priority;
+        }
+
+        friend hpx::threads::thread_priority tag_invoke(
+            hpx::execution::experimental::get_priority_t,
+            cuda_stream_pool_executor const& exec)
+        {
+            return exec.priority_;
+        }
+
+        // -------------------------------------------------------------------------
+        // OneWay Execution
+        template <typename F, typename... Ts>
+        friend decltype(auto) tag_invoke(hpx::parallel::execution::post_t,
+            cuda_stream_pool_executor const& exec, F&& f, Ts&&... ts)
+        {
+            return exec.apply(HPX_FORWARD(F, f), HPX_FORWARD(Ts, ts)...);
+        }
+
+        // -------------------------------------------------------------------------
+        // TwoWay Execution
+        template <typename F, typename... Ts>
+        friend decltype(auto) tag_invoke(
+            hpx::parallel::execution::async_execute_t,
+            cuda_stream_pool_executor const& exec, F&& f, Ts&&... ts)
+        {
+            return exec.async(HPX_FORWARD(F, f), HPX_FORWARD(Ts, ts)...);
+        }
+
+    private:
+        using stream_data = cuda_stream_pool::stream_data;
+
+        bool is_high_priority() const noexcept
+        {
+            return priority_ == hpx::threads::thread_priority::high ||
+                priority_ == hpx::threads::thread_priority::high_recursive ||
+                priority_ == hpx::threads::thread_priority::boost;
+        }
+
+        future_type get_future(cudaStream_t stream) const
+        {
+            if (event_mode_)
+            {
+                return detail::get_future_with_event(stream);
+            }
+            return detail::get_future_with_callback(stream);
+        }
+
+        // -------------------------------------------------------------------------
+        // launch a kernel on the selected stream, the returned future becomes
+        // ready when the task has completed and the task is no longer
+        // counted as pending on the stream
+        template <typename R, typename... Params, typename... Args>
+        future_type launch(stream_data& data, R (*cuda_function)(Params...),
+            Args&&... args) const
+        {
+            // make sure we run on the correct device
+            int const device = pool_->get_device();
+            check_cuda_error(cudaSetDevice(device));
+
+            detail::record_launch(device, cuda_function, args...);
+            detail::kernel_timer timer(device, data.stream_, event_mode_);
+
+            // insert the stream handle in the arg list and call the cuda
+            // function
+            detail::dispatch_helper<R, Params...> helper{};
+            helper(cuda_function, HPX_FORWARD(Args, args)..., data.stream_);
+            timer.stop();
+
+            data.pending_.fetch_add(1, std::memory_order_relaxed);
+            return get_future(data.stream_).then(hpx::launch::sync,
+                [pool = pool_, &data](future_type&& f) {
+                    data.pending_.fetch_sub(1, std::memory_order_relaxed);
+                    return f.get();
+                });
+        }
+
+        // -------------------------------------------------------------------------
+        // launch a kernel on one of the streams and return without a future.
+        // Throws cuda_exception if the async launch fails.
+        template <typename R, typename... Params, typename... Args>
+        void apply(R (*cuda_function)(Params...), Args&&... args) const
+        {
+            stream_data& data = pool_->select(selection_, is_high_priority());
+            launch(data, cuda_function, HPX_FORWARD(Args, args)...);
+        }
+
+        // -------------------------------------------------------------------------
+        // launch a kernel on one of the streams and return a future that will
+        // become ready when the task completes.
+        // Puts a cuda_exception in the future if the async launch fails.
+        template <typename R, typename... Params, typename... Args>
+        future_type async(
+            R (*cuda_kernel)(Params...), Args&&... args) const
+        {
+            return hpx::detail::try_catch_exception_ptr(
+                [&]() {
+                    stream_data& data =
+                        pool_->select(selection_, is_high_priority());
+                    return launch(
+                        data, cuda_kernel, HPX_FORWARD(Args, args)...);
+                },
+                [&](std::exception_ptr&& ep) {
+                    return hpx::make_exceptional_future<void>(HPX_MOVE(ep));
+                });
+        }
+
+    private:
+        std::shared_ptr<cuda_stream_pool> pool_;
+        stream_selection selection_;
+        bool event_mode_;
+        hpx::threads::thread_priority priority_ =
+            hpx::threads::thread_priority::default_;
+    };
+}}}    // namespace hpx::cuda::experimental
+
+namespace hpx { namespace parallel { namespace execution {
+
+    /// \cond NOINTERNAL
+    template <>
+    struct is_one_way_executor<
+        hpx::cuda::experimental::cuda_stream_pool_executor> : std::true_type
+    {
+        // we support fire and forget without returning a waitable/future
+    };
+
+    template <>
+    struct is_two_way_executor<
+        hpx::cuda::experimental::cuda_stream_pool_executor> : std::true_type
+    {
+        // we support returning a waitable/future
+    };
+    /// \endcond
+}}}    // namespace hpx::parallel::execution
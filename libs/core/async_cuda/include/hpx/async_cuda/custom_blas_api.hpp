@@ -15,11 +15,17 @@
 
     #define cublasCreate hipblasCreate
     #define cublasDestroy hipblasDestroy
+    #define cublasDgemm hipblasDgemm
+    #define cublasDgemmBatched hipblasDgemmBatched
+    #define cublasDgemmStridedBatched hipblasDgemmStridedBatched
     #define cublasHandle_t hipblasHandle_t
+    #define cublasOperation_t hipblasOperation_t
     #define cublasPointerMode_t hipblasPointerMode_t
     #define cublasSetPointerMode hipblasSetPointerMode
     #define cublasSetStream hipblasSetStream
     #define cublasSgemm hipblasSgemm
+    #define cublasSgemmBatched hipblasSgemmBatched
+    #define cublasSgemmStridedBatched hipblasSgemmStridedBatched
     #define cublasStatus_t hipblasStatus_t
 
     #define CUBLAS_OP_N HIPBLAS_OP_N
@@ -31,40 +31,62 @@
         #define CUDART_CB
     #endif
 
+    #define cudaDeviceGetStreamPriorityRange hipDeviceGetStreamPriorityRange
     #define cudaDeviceProp hipDeviceProp_t
     #define cudaDeviceSynchronize hipDeviceSynchronize
     #define cudaError_t hipError_t
     #define cudaErrorNotReady hipErrorNotReady
     #define cudaEvent_t hipEvent_t
     #define cudaEventCreateWithFlags hipEventCreateWithFlags
+    #define cudaEventDefault hipEventDefault
     #define cudaEventDestroy hipEventDestroy
     #define cudaEventDisableTiming hipEventDisableTiming
+    #define cudaEventElapsedTime hipEventElapsedTime
     #define cudaEventQuery hipEventQuery
     #define cudaEventRecord hipEventRecord
     #define cudaFree hipFree
+    #define cudaFreeAsync hipFreeAsync
+    #define cudaFreeHost hipHostFree
     #define cudaGetDevice hipGetDevice
     #define cudaGetDeviceCount hipGetDeviceCount
     #define cudaGetDeviceProperties hipGetDeviceProperties
     #define cudaGetErrorString hipGetErrorString
     #define cudaGetLastError hipGetLastError
     #define cudaGetParameterBuffer hipGetParameterBuffer
+    #define cudaGraph_t hipGraph_t
+    #define cudaGraphDestroy hipGraphDestroy
+    #define cudaGraphExec_t hipGraphExec_t
+    #define cudaGraphExecDestroy hipGraphExecDestroy
+    #define cudaGraphExecUpdate hipGraphExecUpdate
+    #define cudaGraphExecUpdateResult hipGraphExecUpdateResult
+    #define cudaGraphInstantiateWithFlags hipGraphInstantiateWithFlags
+    #define cudaGraphLaunch hipGraphLaunch
+    #define cudaGraphNode_t hipGraphNode_t
     #define cudaLaunchDevice hipLaunchDevice
+    #define cudaLaunchHostFunc hipLaunchHostFunc
     #define cudaLaunchKernel hipLaunchKernel
     #define cudaMalloc hipMalloc
+    #define cudaMallocAsync hipMallocAsync
     #define cudaMallocHost hipHostMalloc
+    #define cudaMallocManaged hipMallocManaged
     #define cudaMemcpy hipMemcpy
     #define cudaMemcpyAsync hipMemcpyAsync
     #define cudaMemcpyDeviceToDevice hipMemcpyDeviceToDevice
     #define cudaMemcpyDeviceToHost hipMemcpyDeviceToHost
+    #define cudaMemcpyHostToHost hipMemcpyHostToHost
     #define cudaMemcpyHostToDevice hipMemcpyHostToDevice
     #define cudaMemGetInfo hipMemGetInfo
     #define cudaMemsetAsync hipMemsetAsync
     #define cudaSetDevice hipSetDevice
     #define cudaStream_t hipStream_t
     #define cudaStreamAddCallback hipStreamAddCallback
+    #define cudaStreamBeginCapture hipStreamBeginCapture
+    #define cudaStreamCaptureModeRelaxed hipStreamCaptureModeRelaxed
     #define cudaStreamCreate hipStreamCreate
     #define cudaStreamCreateWithFlags hipStreamCreateWithFlags
+    #define cudaStreamCreateWithPriority hipStreamCreateWithPriority
     #define cudaStreamDestroy hipStreamDestroy
+    #define cudaStreamEndCapture hipStreamEndCapture
     #define cudaStreamNonBlocking hipStreamNonBlocking
     #define cudaStreamSynchronize hipStreamSynchronize
     #define cudaSuccess hipSuccess
@@ -10,7 +10,10 @@
 // This file provides functionality similar to CUDA's built-in
 // cudaStreamAddCallback, with the difference that an event is recorded and an
 // HPX scheduler polls for the completion of the event. When the event is ready,
-// a callback is called.
+// a callback is called. Pending events are tracked per stream and only the
+// oldest event of each stream is queried, the callbacks of the events found
+// to be completed are called in batches. Alternatively, the callback can be
+// called through cudaLaunchHostFunc which does not require any polling.
 
 #pragma once
 
@@ -28,6 +31,12 @@ namespace hpx { namespace cuda { namespace experimental { namespace detail {
     HPX_CORE_EXPORT void add_event_callback(
         event_callback_function_type&& f, cudaStream_t stream);
 
+    // The callback is called on a thread of the CUDA runtime once all work
+    // previously submitted to the stream has completed. The callback is always
+    // called with cudaSuccess and must not call any CUDA functions.
+    HPX_CORE_EXPORT void add_host_func_callback(
+        event_callback_function_type&& f, cudaStream_t stream);
+
     HPX_CORE_EXPORT void register_polling(hpx::threads::thread_pool_base& pool);
     HPX_CORE_EXPORT void unregister_polling(
         hpx::threads::thread_pool_base& pool);
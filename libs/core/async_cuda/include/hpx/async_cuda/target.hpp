@@ -143,6 +143,7 @@ namespace hpx { namespace cuda { namespace experimental {
 
         hpx::future<void> get_future_with_event() const;
         hpx::future<void> get_future_with_callback() const;
+        hpx::future<void> get_future_with_host_func() const;
 
         template <typename Allocator>
         hpx::future<void> get_future_with_event(Allocator const& alloc) const
@@ -157,6 +158,14 @@ namespace hpx { namespace cuda { namespace experimental {
                 alloc, handle_.get_stream());
         }
 
+        template <typename Allocator>
+        hpx::future<void> get_future_with_host_func(
+            Allocator const& alloc) const
+        {
+            return detail::get_future_with_host_func(
+                alloc, handle_.get_stream());
+        }
+
         static std::vector<target> get_local_targets()
         {
             return cuda::experimental::get_local_targets();
@@ -129,6 +129,12 @@ namespace hpx { namespace cuda { namespace experimental {
         {
         };
 
+        // Returns whether the receiver continues on the given stream, in which
+        // case values can be passed on before the work on the stream is done
+        template <typename R, typename F>
+        bool is_on_stream(transform_stream_receiver<R, F> const& r,
+            cudaStream_t stream) noexcept;
+
         template <typename R, typename F>
         struct transform_stream_receiver
         {
@@ -174,7 +180,7 @@ namespace hpx { namespace cuda { namespace experimental {
                             if constexpr (is_transform_stream_receiver<
                                               std::decay_t<R>>::value)
                             {
-                                if (r.stream == stream)
+                                if (is_on_stream(r, stream))
                                 {
                                     // When the next receiver is also a
                                     // transform_stream_receiver, we can immediately
@@ -213,7 +219,7 @@ namespace hpx { namespace cuda { namespace experimental {
                             if constexpr (is_transform_stream_receiver<
                                               std::decay_t<R>>::value)
                             {
-                                if (r.stream == stream)
+                                if (is_on_stream(r, stream))
                                 {
                                     // When the next receiver is also a
                                     // transform_stream_receiver, we can immediately
@@ -253,6 +259,13 @@ namespace hpx { namespace cuda { namespace experimental {
             }
         };
 
+        template <typename R, typename F>
+        bool is_on_stream(transform_stream_receiver<R, F> const& r,
+            cudaStream_t stream) noexcept
+        {
+            return r.stream == stream;
+        }
+
         template <typename S, typename F>
         struct transform_stream_sender
         {
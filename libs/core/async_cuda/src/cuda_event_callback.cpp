@@ -10,6 +10,7 @@
 #include <hpx/config.hpp>
 #include <hpx/assert.hpp>
 #include <hpx/async_cuda/cuda_event.hpp>
+#include <hpx/async_cuda/cuda_statistics.hpp>
 #include <hpx/async_cuda/custom_gpu_api.hpp>
 #include <hpx/async_cuda/detail/cuda_debug.hpp>
 #include <hpx/async_cuda/detail/cuda_event_callback.hpp>
@@ -17,10 +18,15 @@
 #include <hpx/synchronization/spinlock.hpp>
 #include <hpx/threading_base/scheduler_base.hpp>
 #include <hpx/threading_base/thread_pool_base.hpp>
+#include <hpx/timing/high_resolution_clock.hpp>
 
 #include <algorithm>
 #include <atomic>
 #include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <iterator>
+#include <list>
 #include <memory>
 #include <string>
 #include <utility>
@@ -44,22 +50,71 @@ namespace hpx { namespace cuda { namespace experimental { namespace detail {
     }
 #endif
 
-    // Holds a CUDA event and a callback. The callback is intended to be called when
-    // the event is ready.
+    // Holds a CUDA event, the stream the event was recorded on, and a callback.
+    // The callback is intended to be called when the event is ready. The
+    // event is counted as pending on the device the stream belongs to.
     struct event_callback
     {
         cudaEvent_t event;
+        cudaStream_t stream;
         event_callback_function_type f;
+        device_statistics* stats;
+    };
+
+    // counts an event as pending on the current device and returns its
+    // statistics, the streams are used on the device they were created on
+    device_statistics* add_pending_event_on_current_device() noexcept
+    {
+        int device = 0;
+        if (cudaGetDevice(&device) != cudaSuccess)
+        {
+            return nullptr;
+        }
+
+        device_statistics* stats = device_statistics::find(device);
+        if (stats != nullptr)
+        {
+            stats->add_pending_event();
+        }
+        return stats;
+    }
+
+    // Events recorded on a stream complete in the order they were recorded.
+    // The pending events are held in one queue per stream such that only the
+    // oldest event of each stream has to be queried.
+    struct stream_events
+    {
+        cudaStream_t stream;
+        std::deque<event_callback> events;
     };
 
     using event_callback_queue_type =
         concurrency::ConcurrentQueue<event_callback>;
-    using event_callback_vector_type = std::vector<event_callback>;
+    using stream_events_list_type = std::list<stream_events>;
+
+    // A completed event, the status is passed to the callback
+    struct completed_event_callback
+    {
+        cudaError_t status;
+        event_callback continuation;
+    };
+
+    using event_callback_batch_type = std::vector<completed_event_callback>;
 
-    event_callback_vector_type& get_event_callback_vector()
+    // the maximum number of events moved from the queue in one go
+    constexpr std::size_t event_callback_dequeue_size = 32;
+
+    stream_events_list_type& get_stream_events_list()
     {
-        static event_callback_vector_type event_callback_vector;
-        return event_callback_vector;
+        static stream_events_list_type stream_events_list;
+        return stream_events_list;
+    }
+
+    // the completed events, only accessed while holding the vector mutex
+    event_callback_batch_type& get_event_callback_batch()
+    {
+        static event_callback_batch_type event_callback_batch;
+        return event_callback_batch;
     }
 
     event_callback_queue_type& get_event_callback_queue()
@@ -68,6 +123,13 @@ namespace hpx { namespace cuda { namespace experimental { namespace detail {
         return event_callback_queue;
     }
 
+    // only modified while holding the vector mutex
+    std::atomic<std::size_t>& get_active_events_count()
+    {
+        static std::atomic<std::size_t> active_events_count{0};
+        return active_events_count;
+    }
+
     std::size_t get_number_of_enqueued_events()
     {
         return get_event_callback_queue().size_approx();
@@ -75,7 +137,7 @@ namespace hpx { namespace cuda { namespace experimental { namespace detail {
 
     std::size_t get_number_of_active_events()
     {
-        return get_event_callback_vector().size();
+        return get_active_events_count().load(std::memory_order_relaxed);
     }
 
     void add_to_event_callback_queue(event_callback&& continuation)
@@ -92,13 +154,26 @@ namespace hpx { namespace cuda { namespace experimental { namespace detail {
             debug::dec<3>(get_number_of_active_events()));
     }
 
-    void add_to_event_callback_vector(event_callback&& continuation)
+    void add_to_stream_events(event_callback&& continuation)
     {
-        get_event_callback_vector().push_back(HPX_MOVE(continuation));
+        auto& stream_events_list = get_stream_events_list();
+        auto it = std::find_if(stream_events_list.begin(),
+            stream_events_list.end(), [&](stream_events const& s) {
+                return s.stream == continuation.stream;
+            });
+        if (it == stream_events_list.end())
+        {
+            stream_events_list.push_back(
+                stream_events{continuation.stream, {}});
+            it = std::prev(stream_events_list.end());
+        }
+
+        it->events.push_back(HPX_MOVE(continuation));
+        get_active_events_count().fetch_add(1, std::memory_order_relaxed);
 
         cud_debug.debug(
-            debug::str<>("event callback moved from queue to vector"), "event",
-            debug::hex<8>(continuation.event), "enqueued events",
+            debug::str<>("event callback moved from queue to stream"),
+            "event", debug::hex<8>(it->events.back().event), "enqueued events",
             debug::dec<3>(get_number_of_enqueued_events()), "active events",
             debug::dec<3>(get_number_of_active_events()));
     }
@@ -114,21 +189,107 @@ namespace hpx { namespace cuda { namespace experimental { namespace detail {
         }
         check_cuda_error(cudaEventRecord(event, stream));
 
-        detail::add_to_event_callback_queue(event_callback{event, HPX_MOVE(f)});
+        detail::add_to_event_callback_queue(event_callback{
+            event, stream, HPX_MOVE(f), add_pending_event_on_current_device()});
+    }
+
+    // The function launched through cudaLaunchHostFunc and the statistics of
+    // the device it is pending on
+    struct host_func
+    {
+        event_callback_function_type f;
+        device_statistics* stats;
+    };
+
+    // The callback is called from a thread of the CUDA runtime, the function
+    // is deleted once it has been called.
+    void CUDART_CB host_func_callback(void* user_data)
+    {
+        std::unique_ptr<host_func> p(static_cast<host_func*>(user_data));
+        if (p->stats != nullptr)
+        {
+            p->stats->remove_pending_event();
+        }
+        p->f(cudaSuccess);
+    }
+
+    void add_host_func_callback(
+        event_callback_function_type&& f, cudaStream_t stream)
+    {
+        auto p = std::make_unique<host_func>(
+            host_func{HPX_MOVE(f), add_pending_event_on_current_device()});
+        cudaError_t error =
+            cudaLaunchHostFunc(stream, &host_func_callback, p.get());
+        if (error != cudaSuccess && p->stats != nullptr)
+        {
+            p->stats->remove_pending_event();
+        }
+        check_cuda_error(error);
+
+        // the CUDA runtime owns the function from now on
+        p.release();
+    }
+
+    // Moves the completed events of a stream to the batch of completed events.
+    // Stops at the first event that is not ready as all events recorded after
+    // it on the same stream can't have completed either.
+    void collect_completed_events(
+        stream_events& s, event_callback_batch_type& batch)
+    {
+        while (!s.events.empty())
+        {
+            cudaError_t status = cudaEventQuery(s.events.front().event);
+            if (status == cudaErrorNotReady)
+            {
+                break;
+            }
+
+            if (s.events.front().stats != nullptr)
+            {
+                s.events.front().stats->remove_pending_event();
+            }
+
+            batch.push_back(completed_event_callback{
+                status, HPX_MOVE(s.events.front())});
+            s.events.pop_front();
+            get_active_events_count().fetch_sub(1, std::memory_order_relaxed);
+        }
     }
 
+    // Adds the time spent in a poll to the polling statistics if polling
+    // timing is enabled
+    struct polling_timer
+    {
+        polling_timer() noexcept
+          : start(device_statistics::is_polling_timing_enabled() ?
+                    hpx::chrono::high_resolution_clock::now() :
+                    0)
+        {
+        }
+
+        ~polling_timer()
+        {
+            if (start != 0)
+            {
+                device_statistics::add_polling_time(static_cast<std::int64_t>(
+                    hpx::chrono::high_resolution_clock::now() - start));
+            }
+        }
+
+        std::uint64_t start;
+    };
+
     // Background progress function for async CUDA operations. Checks for completed
-    // cudaEvent_t and calls the associated callback when ready. We first process
-    // events that have been added to the vector of events, which should be
-    // processed under a lock.  After that we process events that have been added to
-    // the lockfree queue. If an event from the queue is not ready it is added to
-    // the vector of events for later checking.
+    // cudaEvent_t and calls the associated callback when ready. The events are
+    // processed under a lock. We first move the events that have been added to
+    // the lockfree queue to the queue of the stream they have been recorded on.
+    // After that only the oldest events of each stream are queried until an
+    // event is found that is not ready. The callbacks of all completed events
+    // are then called in one batch.
     hpx::threads::policies::detail::polling_status poll()
     {
         using hpx::threads::policies::detail::polling_status;
 
-        auto& event_callback_vector = detail::get_event_callback_vector();
-
         // Don't poll if another thread is already polling
         std::unique_lock<hpx::cuda::experimental::detail::mutex_type> lk(
             detail::get_vector_mtx(), std::try_to_lock);
@@ -155,57 +316,57 @@ namespace hpx { namespace cuda { namespace experimental { namespace detail {
                 debug::dec<3>(get_number_of_active_events()));
         }
 
-        // Grab the handle to the event pool so we can return completed events
-        cuda_event_pool& pool =
-            hpx::cuda::experimental::cuda_event_pool::get_event_pool();
-
-        // Iterate over our list of events and see if any have completed
-        event_callback_vector.erase(
-            std::remove_if(event_callback_vector.begin(),
-                event_callback_vector.end(),
-                [&](event_callback& continuation) {
-                    cudaError_t status = cudaEventQuery(continuation.event);
-
-                    if (status == cudaErrorNotReady)
-                    {
-                        return false;
-                    }
-
-                    cud_debug.debug(debug::str<>("set ready vector"), "event",
-                        debug::hex<8>(continuation.event), "enqueued events",
-                        debug::dec<3>(get_number_of_enqueued_events()),
-                        "active events",
-                        debug::dec<3>(get_number_of_active_events()));
-                    continuation.f(status);
-                    pool.push(HPX_MOVE(continuation.event));
-                    return true;
-                }),
-            event_callback_vector.end());
-
-        detail::event_callback continuation;
-        while (detail::get_event_callback_queue().try_dequeue(continuation))
+        polling_timer timer;
+
+        // Move the new events to the queues of their streams, the events of a
+        // single producer are dequeued in the order they were enqueued
+        auto& queue = detail::get_event_callback_queue();
+        detail::event_callback continuations[event_callback_dequeue_size];
+        std::size_t count = 0;
+        while ((count = queue.try_dequeue_bulk(
+                    continuations, event_callback_dequeue_size)) != 0)
+        {
+            for (std::size_t i = 0; i != count; ++i)
+            {
+                add_to_stream_events(HPX_MOVE(continuations[i]));
+            }
+        }
+
+        // Query the oldest events of each of the streams
+        auto& stream_events_list = detail::get_stream_events_list();
+        auto& batch = detail::get_event_callback_batch();
+        for (stream_events& s : stream_events_list)
         {
-            cudaError_t status = cudaEventQuery(continuation.event);
+            collect_completed_events(s, batch);
+        }
 
-            if (status == cudaErrorNotReady)
+        stream_events_list.remove_if(
+            [](stream_events const& s) { return s.events.empty(); });
+
+        // Return the completed events to the event pool before calling the
+        // callbacks, the callbacks may record new events
+        if (!batch.empty())
+        {
+            cud_debug.debug(debug::str<>("set ready batch"), "events",
+                debug::dec<3>(batch.size()), "enqueued events",
+                debug::dec<3>(get_number_of_enqueued_events()),
+                "active events", debug::dec<3>(get_number_of_active_events()));
+
+            cuda_event_pool& pool =
+                hpx::cuda::experimental::cuda_event_pool::get_event_pool();
+            for (completed_event_callback& completed : batch)
             {
-                add_to_event_callback_vector(HPX_MOVE(continuation));
+                pool.push(HPX_MOVE(completed.continuation.event));
             }
-            else
+            for (completed_event_callback& completed : batch)
             {
-                cud_debug.debug(debug::str<>("set ready queue"), "event",
-                    debug::hex<8>(continuation.event), "enqueued events",
-                    debug::dec<3>(get_number_of_enqueued_events()),
-                    "active events",
-                    debug::dec<3>(get_number_of_active_events()));
-                continuation.f(status);
-                pool.push(HPX_MOVE(continuation.event));
+                completed.continuation.f(completed.status);
             }
+            batch.clear();
         }
 
-        using hpx::threads::policies::detail::polling_status;
-        return get_event_callback_vector().empty() ? polling_status::idle :
-                                                     polling_status::busy;
+        return stream_events_list.empty() ? polling_status::idle :
+                                              polling_status::busy;
     }
 
     std::size_t get_work_count()
@@ -245,7 +406,7 @@ namespace hpx { namespace cuda { namespace experimental { namespace detail {
                 detail::get_vector_mtx());
             bool event_queue_empty =
                 get_event_callback_queue().size_approx() == 0;
-            bool event_vector_empty = get_event_callback_vector().empty();
+            bool event_vector_empty = get_stream_events_list().empty();
             lk.unlock();
             HPX_ASSERT_MSG(event_queue_empty,
                 "CUDA event polling was disabled while there are unprocessed "
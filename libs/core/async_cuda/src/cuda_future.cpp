@@ -22,4 +22,10 @@ namespace hpx { namespace cuda { namespace experimental { namespace detail {
     {
         return get_future_with_event(hpx::util::internal_allocator<>{}, stream);
     }
+
+    hpx::future<void> get_future_with_host_func(cudaStream_t stream)
+    {
+        return get_future_with_host_func(
+            hpx::util::internal_allocator<>{}, stream);
+    }
 }}}}    // namespace hpx::cuda::experimental::detail
@@ -0,0 +1,198 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/async_cuda/cuda_exception.hpp>
+#include <hpx/async_cuda/cuda_memory_pool.hpp>
+#include <hpx/async_cuda/target.hpp>
+#include <hpx/type_support/unused.hpp>
+
+#include <cstddef>
+#include <mutex>
+#include <vector>
+
+#include <hpx/async_cuda/custom_gpu_api.hpp>
+
+// stream ordered allocations are available since CUDA 11.2
+#if !defined(HPX_HAVE_HIP) && CUDART_VERSION >= 11020
+#define HPX_ASYNC_CUDA_HAVE_MALLOC_ASYNC
+#endif
+
+namespace hpx { namespace cuda { namespace experimental {
+
+    namespace detail {
+        // the smallest size class holds blocks of 256 bytes, which is the
+        // alignment guaranteed by cudaMalloc
+        constexpr std::size_t min_size_class = 8;
+
+        static std::size_t get_size_class(std::size_t bytes) noexcept
+        {
+            std::size_t size_class = min_size_class;
+            while ((std::size_t(1) << size_class) < bytes)
+            {
+                ++size_class;
+            }
+            return size_class;
+        }
+
+        caching_memory_pool::~caching_memory_pool()
+        {
+            // the derived pools have released the cached blocks
+            HPX_ASSERT(statistics_.cached_bytes == 0);
+        }
+
+        void* caching_memory_pool::allocate(std::size_t bytes)
+        {
+            std::size_t const size_class = get_size_class(bytes);
+            std::size_t const block_size = std::size_t(1) << size_class;
+
+            {
+                std::lock_guard<mutex_type> l(mtx_);
+                if (size_class < cached_blocks_.size() &&
+                    !cached_blocks_[size_class].empty())
+                {
+                    void* p = cached_blocks_[size_class].back();
+                    cached_blocks_[size_class].pop_back();
+
+                    ++statistics_.hits;
+                    statistics_.requested_bytes += bytes;
+                    statistics_.used_bytes += block_size;
+                    statistics_.cached_bytes -= block_size;
+                    return p;
+                }
+            }
+
+            // allocate the new block without holding the lock
+            void* p = allocate_block(block_size);
+
+            std::lock_guard<mutex_type> l(mtx_);
+            ++statistics_.misses;
+            statistics_.requested_bytes += bytes;
+            statistics_.used_bytes += block_size;
+            return p;
+        }
+
+        void caching_memory_pool::deallocate(
+            void* p, std::size_t bytes) noexcept
+        {
+            if (p == nullptr)
+                return;
+
+            std::size_t const size_class = get_size_class(bytes);
+            std::size_t const block_size = std::size_t(1) << size_class;
+
+            std::lock_guard<mutex_type> l(mtx_);
+            HPX_ASSERT(statistics_.used_bytes >= block_size);
+
+            statistics_.requested_bytes -= bytes;
+            statistics_.used_bytes -= block_size;
+
+            try
+            {
+                if (cached_blocks_.size() <= size_class)
+                {
+                    cached_blocks_.resize(size_class + 1);
+                }
+                cached_blocks_[size_class].push_back(p);
+                statistics_.cached_bytes += block_size;
+            }
+            catch (...)
+            {
+                // the block can't be cached, return it right away
+                free_block(p);
+            }
+        }
+
+        void caching_memory_pool::release() noexcept
+        {
+            std::vector<std::vector<void*>> blocks;
+            {
+                std::lock_guard<mutex_type> l(mtx_);
+                blocks.swap(cached_blocks_);
+                statistics_.cached_bytes = 0;
+            }
+
+            for (auto& size_class_blocks : blocks)
+            {
+                for (void* p : size_class_blocks)
+                {
+                    free_block(p);
+                }
+            }
+        }
+
+        memory_pool_statistics caching_memory_pool::statistics() const
+        {
+            std::lock_guard<mutex_type> l(mtx_);
+            return statistics_;
+        }
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    pinned_memory_pool::~pinned_memory_pool()
+    {
+        release();
+    }
+
+    pinned_memory_pool& pinned_memory_pool::get_default_pool()
+    {
+        static pinned_memory_pool pool;
+        return pool;
+    }
+
+    void* pinned_memory_pool::allocate_block(std::size_t bytes)
+    {
+        void* p = nullptr;
+        check_cuda_error(cudaMallocHost(&p, bytes));
+        return p;
+    }
+
+    void pinned_memory_pool::free_block(void* p) noexcept
+    {
+        // ignore error
+        cudaError_t err = cudaFreeHost(p);
+        HPX_UNUSED(err);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    device_memory_pool::device_memory_pool(target const& t)
+      : target_(&t)
+    {
+    }
+
+    device_memory_pool::~device_memory_pool()
+    {
+        release();
+    }
+
+    void* device_memory_pool::allocate_block(std::size_t bytes)
+    {
+        auto const& handle = target_->native_handle();
+        check_cuda_error(cudaSetDevice(handle.get_device()));
+
+        void* p = nullptr;
+#if defined(HPX_ASYNC_CUDA_HAVE_MALLOC_ASYNC)
+        check_cuda_error(cudaMallocAsync(&p, bytes, handle.get_stream()));
+#else
+        check_cuda_error(cudaMalloc(&p, bytes));
+#endif
+        return p;
+    }
+
+    void device_memory_pool::free_block(void* p) noexcept
+    {
+        // ignore errors
+        auto const& handle = target_->native_handle();
+        cudaError_t err = cudaSetDevice(handle.get_device());
+#if defined(HPX_ASYNC_CUDA_HAVE_MALLOC_ASYNC)
+        err = cudaFreeAsync(p, handle.get_stream());
+#else
+        err = cudaFree(p);
+#endif
+        HPX_UNUSED(err);
+    }
+}}}    // namespace hpx::cuda::experimental
@@ -0,0 +1,235 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/async_cuda/cuda_event.hpp>
+#include <hpx/async_cuda/cuda_exception.hpp>
+#include <hpx/async_cuda/cuda_statistics.hpp>
+#include <hpx/async_cuda/custom_gpu_api.hpp>
+#include <hpx/async_cuda/detail/cuda_event_callback.hpp>
+#include <hpx/modules/errors.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace hpx { namespace cuda { namespace experimental {
+
+    namespace {
+        // the statistics of all devices, created on first use
+        struct statistics_registry
+        {
+            statistics_registry()
+            {
+                int count = 0;
+                if (cudaGetDeviceCount(&count) == cudaSuccess && count > 0)
+                {
+                    num_devices = static_cast<std::size_t>(count);
+                    devices = std::make_unique<device_statistics[]>(count);
+                }
+            }
+
+            std::size_t num_devices = 0;
+            std::unique_ptr<device_statistics[]> devices;
+
+            std::atomic<bool> kernel_timing{false};
+            std::atomic<bool> polling_timing{false};
+            std::atomic<std::int64_t> polling_time{0};
+            std::atomic<std::int64_t> polls{0};
+        };
+
+        statistics_registry& get_registry()
+        {
+            static statistics_registry registry;
+            return registry;
+        }
+
+        std::int64_t get_and_reset(std::atomic<std::int64_t>& value, bool reset)
+        {
+            return reset ? value.exchange(0, std::memory_order_relaxed) :
+                           value.load(std::memory_order_relaxed);
+        }
+    }    // namespace
+
+    ///////////////////////////////////////////////////////////////////////////
+    device_statistics& device_statistics::get(int device)
+    {
+        device_statistics* stats = find(device);
+        if (stats == nullptr)
+        {
+            HPX_THROW_EXCEPTION(bad_parameter, "device_statistics::get",
+                "there is no cuda device " + std::to_string(device));
+        }
+        return *stats;
+    }
+
+    device_statistics* device_statistics::find(int device) noexcept
+    {
+        statistics_registry& registry = get_registry();
+        if (device < 0 ||
+            static_cast<std::size_t>(device) >= registry.num_devices)
+        {
+            return nullptr;
+        }
+        return &registry.devices[device];
+    }
+
+    std::size_t device_statistics::get_num_devices() noexcept
+    {
+        return get_registry().num_devices;
+    }
+
+    void device_statistics::enable_kernel_timing(bool enable) noexcept
+    {
+        get_registry().kernel_timing.store(enable, std::memory_order_relaxed);
+    }
+
+    bool device_statistics::is_kernel_timing_enabled() noexcept
+    {
+        return get_registry().kernel_timing.load(std::memory_order_relaxed);
+    }
+
+    void device_statistics::enable_polling_timing(bool enable) noexcept
+    {
+        get_registry().polling_timing.store(enable, std::memory_order_relaxed);
+    }
+
+    bool device_statistics::is_polling_timing_enabled() noexcept
+    {
+        return get_registry().polling_timing.load(std::memory_order_relaxed);
+    }
+
+    std::int64_t device_statistics::get_kernel_count(bool reset) noexcept
+    {
+        return get_and_reset(kernels_, reset);
+    }
+
+    std::int64_t device_statistics::get_average_kernel_time(bool reset) noexcept
+    {
+        std::int64_t const count = get_and_reset(timed_kernels_, reset);
+        std::int64_t const time = get_and_reset(kernel_time_, reset);
+        return count == 0 ? 0 : time / count;
+    }
+
+    std::int64_t device_statistics::get_kernel_time(bool reset) noexcept
+    {
+        return get_and_reset(kernel_time_, reset);
+    }
+
+    std::int64_t device_statistics::get_timed_kernel_count(bool reset) noexcept
+    {
+        return get_and_reset(timed_kernels_, reset);
+    }
+
+    std::int64_t device_statistics::get_host_to_device_bytes(
+        bool reset) noexcept
+    {
+        return get_and_reset(host_to_device_, reset);
+    }
+
+    std::int64_t device_statistics::get_device_to_host_bytes(
+        bool reset) noexcept
+    {
+        return get_and_reset(device_to_host_, reset);
+    }
+
+    std::int64_t device_statistics::get_queue_depth(bool) noexcept
+    {
+        return pending_events_.load(std::memory_order_relaxed);
+    }
+
+    void device_statistics::add_polling_time(std::int64_t ns) noexcept
+    {
+        statistics_registry& registry = get_registry();
+        registry.polling_time.fetch_add(ns, std::memory_order_relaxed);
+        registry.polls.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    std::int64_t device_statistics::get_polling_time(bool reset) noexcept
+    {
+        return get_and_reset(get_registry().polling_time, reset);
+    }
+
+    std::int64_t device_statistics::get_polling_count(bool reset) noexcept
+    {
+        return get_and_reset(get_registry().polls, reset);
+    }
+
+    namespace detail {
+        ///////////////////////////////////////////////////////////////////////
+        kernel_timer::kernel_timer(
+            int device, cudaStream_t stream, bool event_mode)
+          : device_(device)
+          , stream_(stream)
+        {
+            // the elapsed time can only be queried from the event polling,
+            // calling into the runtime from a host function is not allowed
+            if (!event_mode || !device_statistics::is_kernel_timing_enabled() ||
+                device_statistics::find(device) == nullptr)
+            {
+                return;
+            }
+
+            cuda_event_pool::get_timing_event_pool().pop(start_);
+            if (cudaEventRecord(start_, stream_) != cudaSuccess)
+            {
+                cuda_event_pool::get_timing_event_pool().push(start_);
+                return;
+            }
+            started_ = true;
+        }
+
+        kernel_timer::~kernel_timer()
+        {
+            // the launch has failed if the timer hasn't been stopped
+            if (started_)
+            {
+                cuda_event_pool::get_timing_event_pool().push(start_);
+            }
+        }
+
+        void kernel_timer::stop()
+        {
+            if (!started_)
+            {
+                return;
+            }
+            started_ = false;
+
+            cuda_event_pool& pool = cuda_event_pool::get_timing_event_pool();
+
+            cudaEvent_t stop;
+            pool.pop(stop);
+            cudaError_t error = cudaEventRecord(stop, stream_);
+            if (error != cudaSuccess)
+            {
+                pool.push(start_);
+                pool.push(stop);
+                check_cuda_error(error);
+            }
+
+            add_event_callback(
+                [device = device_, start = start_, stop](cudaError_t status) {
+                    cuda_event_pool& pool =
+                        cuda_event_pool::get_timing_event_pool();
+
+                    float ms = 0.0f;
+                    if (status == cudaSuccess &&
+                        cudaEventElapsedTime(&ms, start, stop) == cudaSuccess)
+                    {
+                        device_statistics::get(device).add_kernel_time(
+                            static_cast<std::int64_t>(ms * 1e6));
+                    }
+
+                    pool.push(start);
+                    pool.push(stop);
+                },
+                stream_);
+        }
+    }    // namespace detail
+}}}    // namespace hpx::cuda::experimental
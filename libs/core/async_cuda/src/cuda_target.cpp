@@ -194,6 +194,11 @@ namespace hpx { namespace cuda { namespace experimental {
         return detail::get_future_with_callback(handle_.get_stream());
     }
 
+    hpx::future<void> target::get_future_with_host_func() const
+    {
+        return detail::get_future_with_host_func(handle_.get_stream());
+    }
+
     target& get_default_target()
     {
         static target target_;
@@ -0,0 +1,270 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/local/future.hpp>
+#include <hpx/local/init.hpp>
+#include <hpx/local/thread.hpp>
+#include <hpx/modules/async_cuda.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace cu = hpx::cuda::experimental;
+
+// -------------------------------------------------------------------------
+// count square matrices of size n x n in consecutive device memory
+template <typename T>
+struct device_matrices
+{
+    device_matrices(std::size_t count, int n)
+      : count(count)
+      , n(n)
+    {
+        cu::check_cuda_error(cudaMalloc(&data, bytes()));
+    }
+
+    ~device_matrices()
+    {
+        cu::check_cuda_error(cudaFree(data));
+    }
+
+    device_matrices(device_matrices const&) = delete;
+    device_matrices& operator=(device_matrices const&) = delete;
+
+    std::size_t bytes() const
+    {
+        return count * n * n * sizeof(T);
+    }
+
+    T* operator[](std::size_t i) const
+    {
+        return data + i * n * n;
+    }
+
+    void upload(std::vector<T> const& values)
+    {
+        cu::check_cuda_error(
+            cudaMemcpy(data, values.data(), bytes(), cudaMemcpyHostToDevice));
+    }
+
+    std::vector<T> download() const
+    {
+        std::vector<T> values(count * n * n);
+        cu::check_cuda_error(
+            cudaMemcpy(values.data(), data, bytes(), cudaMemcpyDeviceToHost));
+        return values;
+    }
+
+    T* data = nullptr;
+    std::size_t count;
+    int n;
+};
+
+// the i-th matrix is filled with i + 1, the product of two of them is
+// n * (i + 1) * (j + 1) everywhere
+template <typename T>
+std::vector<T> make_values(std::size_t count, int n)
+{
+    std::vector<T> values;
+    values.reserve(count * n * n);
+    for (std::size_t i = 0; i != count; ++i)
+    {
+        values.insert(values.end(), n * n, T(i + 1));
+    }
+    return values;
+}
+
+// -------------------------------------------------------------------------
+template <typename T, typename Gemm>
+void test_batches(cu::cublas_executor& exec, Gemm gemm, bool strided)
+{
+    std::size_t const count = 20;
+    int const n = 4;
+    T const alpha = 1;
+    T const beta = 0;
+
+    device_matrices<T> a(count, n), b(count, n);
+    a.upload(make_values<T>(count, n));
+    b.upload(make_values<T>(count, n));
+
+    // separate allocations are launched through the pointer arrays
+    std::vector<std::unique_ptr<device_matrices<T>>> scattered;
+    device_matrices<T> c(count, n);
+    for (std::size_t i = 0; i != count; ++i)
+    {
+        scattered.push_back(std::make_unique<device_matrices<T>>(1, n));
+    }
+
+    std::vector<hpx::future<void>> futures;
+    for (std::size_t i = 0; i != count; ++i)
+    {
+        T* result = strided ? c[i] : (*scattered[i])[0];
+        futures.push_back(hpx::async(exec, gemm, CUBLAS_OP_N, CUBLAS_OP_N, n,
+            n, n, &alpha, a[i], n, b[i], n, &beta, result, n));
+    }
+
+    // the batches hold 8 gemms, the last 4 gemms are still pending
+    HPX_TEST_EQ(exec.pending(), std::size_t(4));
+    exec.flush();
+    HPX_TEST_EQ(exec.pending(), std::size_t(0));
+
+    for (auto& f : futures)
+    {
+        f.get();
+    }
+
+    for (std::size_t i = 0; i != count; ++i)
+    {
+        std::vector<T> values =
+            strided ? c.download() : scattered[i]->download();
+        std::size_t const offset = strided ? i * n * n : 0;
+        for (int j = 0; j != n * n; ++j)
+        {
+            HPX_TEST_EQ(values[offset + j], T(n * (i + 1) * (i + 1)));
+        }
+    }
+}
+
+// gemms updating the same matrix are not batched together
+void test_same_result(cu::cublas_executor& exec)
+{
+    int const n = 4;
+    float const alpha = 1;
+    float const beta = 1;
+
+    device_matrices<float> a(1, n), c(1, n);
+    a.upload(make_values<float>(1, n));
+    c.upload(std::vector<float>(n * n, 0.0f));
+
+    hpx::future<void> f1 = hpx::async(exec, cublasSgemm, CUBLAS_OP_N,
+        CUBLAS_OP_N, n, n, n, &alpha, a[0], n, a[0], n, &beta, c[0], n);
+    hpx::future<void> f2 = hpx::async(exec, cublasSgemm, CUBLAS_OP_N,
+        CUBLAS_OP_N, n, n, n, &alpha, a[0], n, a[0], n, &beta, c[0], n);
+    HPX_TEST_EQ(exec.pending(), std::size_t(1));
+
+    exec.flush();
+    f1.get();
+    f2.get();
+
+    for (float value : c.download())
+    {
+        HPX_TEST_EQ(value, float(2 * n));
+    }
+}
+
+// gemms of different shapes go to different batches, large gemms aren't
+// batched at all
+void test_shapes(cu::cublas_executor& exec)
+{
+    int const n = 4;
+    float const alpha = 1;
+    float const beta = 0;
+    float const other_alpha = 2;
+
+    device_matrices<float> a(1, 256), c(4, 256);
+    a.upload(make_values<float>(1, 256));
+
+    hpx::future<void> f1 = hpx::async(exec, cublasSgemm, CUBLAS_OP_N,
+        CUBLAS_OP_N, n, n, n, &alpha, a[0], n, a[0], n, &beta, c[0], n);
+    hpx::future<void> f2 = hpx::async(exec, cublasSgemm, CUBLAS_OP_N,
+        CUBLAS_OP_N, n, n, n, &other_alpha, a[0], n, a[0], n, &beta, c[1], n);
+    hpx::future<void> f3 = hpx::async(exec, cublasSgemm, CUBLAS_OP_N,
+        CUBLAS_OP_N, 2 * n, 2 * n, 2 * n, &alpha, a[0], 2 * n, a[0], 2 * n,
+        &beta, c[2], 2 * n);
+    HPX_TEST_EQ(exec.pending(), std::size_t(3));
+
+    hpx::future<void> f4 = hpx::async(exec, cublasSgemm, CUBLAS_OP_N,
+        CUBLAS_OP_N, 256, 256, 256, &alpha, a[0], 256, a[0], 256, &beta, c[3],
+        256);
+    HPX_TEST_EQ(exec.pending(), std::size_t(3));
+    f4.get();
+
+    exec.flush();
+    hpx::wait_all(f1, f2, f3);
+    HPX_TEST(!f1.has_exception() && !f2.has_exception() && !f3.has_exception());
+}
+
+// the batches are launched once their window has passed
+void test_window(std::size_t device)
+{
+    cu::gemm_aggregation_parameters params;
+    params.window = std::chrono::milliseconds(1);
+    cu::cublas_executor exec(device, params);
+
+    int const n = 4;
+    float const alpha = 1;
+    float const beta = 0;
+
+    device_matrices<float> a(1, n), c(2, n);
+    a.upload(make_values<float>(1, n));
+
+    hpx::future<void> f1 = hpx::async(exec, cublasSgemm, CUBLAS_OP_N,
+        CUBLAS_OP_N, n, n, n, &alpha, a[0], n, a[0], n, &beta, c[0], n);
+    HPX_TEST_EQ(exec.pending(), std::size_t(1));
+
+    hpx::this_thread::sleep_for(std::chrono::milliseconds(10));
+
+    // the late gemm launches the expired batch and opens a new one
+    hpx::future<void> f2 = hpx::async(exec, cublasSgemm, CUBLAS_OP_N,
+        CUBLAS_OP_N, n, n, n, &alpha, a[0], n, a[0], n, &beta, c[1], n);
+    HPX_TEST_EQ(exec.pending(), std::size_t(1));
+    f1.get();
+
+    // the pending batches are launched when the last copy of the executor
+    // goes away
+    {
+        cu::cublas_executor exec_copy = exec;
+        exec = cu::cublas_executor(device, params);
+    }
+    f2.get();
+}
+
+// -------------------------------------------------------------------------
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    // install cuda future polling handler
+    cu::enable_user_polling poll("default");
+
+    std::size_t device = vm["device"].as<std::size_t>();
+
+    cu::gemm_aggregation_parameters params;
+    params.max_batch_size = 8;
+    params.window = std::chrono::hours(1);
+    params.max_gemm_size = 32 * 32 * 32;
+
+    cu::cublas_executor exec(device, params);
+    HPX_TEST(exec.is_aggregating());
+    HPX_TEST(!cu::cublas_executor(device).is_aggregating());
+
+    test_batches<float>(exec, cublasSgemm, true);
+    test_batches<float>(exec, cublasSgemm, false);
+    test_batches<double>(exec, cublasDgemm, true);
+    test_batches<double>(exec, cublasDgemm, false);
+    test_same_result(exec);
+    test_shapes(exec);
+    test_window(device);
+
+    return hpx::local::finalize();
+}
+
+// -------------------------------------------------------------------------
+int main(int argc, char** argv)
+{
+    using namespace hpx::program_options;
+    options_description cmdline("usage: " HPX_APPLICATION_STRING " [options]");
+    cmdline.add_options()("device",
+        hpx::program_options::value<std::size_t>()->default_value(0),
+        "Device to use");
+
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = cmdline;
+
+    auto result = hpx::local::init(hpx_main, argc, argv, init_args);
+    return result || hpx::util::report_errors();
+}
@@ -0,0 +1,198 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/local/algorithm.hpp>
+#include <hpx/local/execution.hpp>
+#include <hpx/local/init.hpp>
+#include <hpx/modules/async_cuda.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <numeric>
+#include <vector>
+
+namespace cu = hpx::cuda::experimental;
+
+// -------------------------------------------------------------------------
+// a buffer in managed memory, accessible from the host and all devices
+struct managed_buffer
+{
+    explicit managed_buffer(std::size_t n)
+      : size(n)
+    {
+        cu::check_cuda_error(cudaMallocManaged(&data, n * sizeof(int)));
+    }
+
+    ~managed_buffer()
+    {
+        cu::check_cuda_error(cudaFree(data));
+    }
+
+    managed_buffer(managed_buffer const&) = delete;
+    managed_buffer& operator=(managed_buffer const&) = delete;
+
+    int* begin() const
+    {
+        return data;
+    }
+
+    int* end() const
+    {
+        return data + size;
+    }
+
+    int* data = nullptr;
+    std::size_t size;
+};
+
+struct increment
+{
+    HPX_HOST_DEVICE void operator()(int& i) const
+    {
+        ++i;
+    }
+};
+
+struct square
+{
+    HPX_HOST_DEVICE int operator()(int i) const
+    {
+        return i * i;
+    }
+};
+
+// -------------------------------------------------------------------------
+void test_partition(cu::cuda_block_executor const& exec)
+{
+    std::size_t const num_targets = exec.targets().size();
+
+    for (std::size_t count : {std::size_t(0), std::size_t(1),
+             std::size_t(1000), std::size_t(1000007)})
+    {
+        std::vector<std::size_t> offsets = exec.partition(count);
+        HPX_TEST_EQ(offsets.size(), num_targets + 1);
+        HPX_TEST_EQ(offsets.front(), std::size_t(0));
+        HPX_TEST_EQ(offsets.back(), count);
+        HPX_TEST(std::is_sorted(offsets.begin(), offsets.end()));
+    }
+
+    // the parts are proportional to the processing units of the devices
+    std::size_t total_pus = 0;
+    for (cu::target const& t : exec.targets())
+    {
+        total_pus += t.native_handle().processing_units();
+    }
+
+    std::size_t const count = 1000000;
+    std::vector<std::size_t> offsets = exec.partition(count);
+    for (std::size_t i = 0; i != num_targets; ++i)
+    {
+        double const expected = double(count) *
+            double(exec.targets()[i].native_handle().processing_units()) /
+            double(total_pus);
+        double const actual = double(offsets[i + 1] - offsets[i]);
+        HPX_TEST(actual > expected - 2.0 && actual < expected + 2.0);
+    }
+}
+
+void test_for_each(cu::cuda_block_executor const& exec)
+{
+    std::size_t const n = 100007;
+    managed_buffer buffer(n);
+    std::iota(buffer.begin(), buffer.end(), 0);
+
+    hpx::for_each(hpx::execution::par.on(exec), buffer.begin(), buffer.end(),
+        increment{});
+
+    for (std::size_t i = 0; i != n; ++i)
+    {
+        HPX_TEST_EQ(buffer.data[i], int(i) + 1);
+    }
+
+    // the asynchronous version returns a future
+    hpx::future<void> f =
+        hpx::for_each(hpx::execution::par(hpx::execution::task).on(exec),
+            buffer.begin(), buffer.end(), increment{});
+    f.get();
+
+    for (std::size_t i = 0; i != n; ++i)
+    {
+        HPX_TEST_EQ(buffer.data[i], int(i) + 2);
+    }
+}
+
+void test_transform(cu::cuda_block_executor const& exec)
+{
+    std::size_t const n = 100007;
+    managed_buffer in(n), out(n);
+    std::iota(in.begin(), in.end(), 0);
+
+    // small chunks create more threads on the devices
+    auto policy = hpx::execution::par.on(exec).with(
+        hpx::execution::static_chunk_size(1));
+
+    int* result =
+        hpx::transform(policy, in.begin(), in.end(), out.begin(), square{});
+    HPX_TEST_EQ(result, out.end());
+
+    for (std::size_t i = 0; i != n; ++i)
+    {
+        HPX_TEST_EQ(out.data[i], int(i * i));
+    }
+}
+
+void test_no_targets()
+{
+    bool caught_exception = false;
+    try
+    {
+        cu::cuda_block_executor exec{std::vector<cu::target>()};
+    }
+    catch (hpx::exception const& e)
+    {
+        HPX_TEST_EQ(e.get_error(), hpx::bad_parameter);
+        caught_exception = true;
+    }
+    HPX_TEST(caught_exception);
+}
+
+// -------------------------------------------------------------------------
+int hpx_main()
+{
+    // install cuda future polling handler
+    cu::enable_user_polling poll("default");
+
+    // all devices of this locality
+    cu::cuda_block_executor exec;
+    HPX_TEST_EQ(exec.targets().size(), cu::get_local_targets().size());
+    HPX_TEST(exec == cu::cuda_block_executor(exec));
+
+    test_partition(exec);
+    test_for_each(exec);
+    test_transform(exec);
+
+    // several streams on the same device split the work as well
+    cu::cuda_block_executor streams_exec(
+        std::vector<cu::target>{cu::target(0), cu::target(0), cu::target(0)});
+    HPX_TEST_EQ(streams_exec.targets().size(), std::size_t(3));
+    HPX_TEST(streams_exec != exec);
+
+    test_partition(streams_exec);
+    test_for_each(streams_exec);
+    test_transform(streams_exec);
+
+    test_no_targets();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ(hpx::local::init(hpx_main, argc, argv), 0);
+    return hpx::util::report_errors();
+}
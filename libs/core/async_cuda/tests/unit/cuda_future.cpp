@@ -167,6 +167,32 @@ int hpx_main(hpx::program_options::variables_map& vm)
           std::cout << "copy continuation triggered\n";
       }).get();
 
+    // --------------------
+    // test many events in flight on the same stream, the completed events are
+    // processed in batches
+    std::cout << "events in flight : " << 1000 << std::endl;
+    std::vector<hpx::future<void>> events;
+    for (std::size_t i = 0; i != 1000; ++i)
+    {
+        events.push_back(i % 2 == 0 ? target.get_future_with_event() :
+                                      target.get_future_with_host_func());
+    }
+    hpx::wait_all(events);
+    for (auto& f : events)
+    {
+        HPX_TEST(!f.has_exception());
+    }
+
+    // --------------------
+    // test a continuation on a future made ready by a host function
+    std::cout << "host function continuation" << std::endl;
+    hpx::async(cudaexec, cuda_trivial_kernel<double>, testd2 + 2);
+    target.get_future_with_host_func()
+        .then([](hpx::future<void>&&) {
+            std::cout << "host function continuation triggered\n";
+        })
+        .get();
+
     // --------------------
     // test a full kernel example
     HPX_TEST(test_saxpy(cudaexec));
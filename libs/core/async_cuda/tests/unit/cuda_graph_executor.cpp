@@ -0,0 +1,177 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/local/execution.hpp>
+#include <hpx/local/future.hpp>
+#include <hpx/local/init.hpp>
+#include <hpx/modules/async_cuda.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <vector>
+
+namespace cu = hpx::cuda::experimental;
+
+// -------------------------------------------------------------------------
+// a buffer in pinned host memory, pageable memory can't be copied from
+// within a graph
+struct pinned_buffer
+{
+    explicit pinned_buffer(std::size_t n)
+      : size(n)
+    {
+        cu::check_cuda_error(cudaMallocHost(&data, n * sizeof(int)));
+    }
+
+    ~pinned_buffer()
+    {
+        cu::check_cuda_error(cudaFreeHost(data));
+    }
+
+    pinned_buffer(pinned_buffer const&) = delete;
+    pinned_buffer& operator=(pinned_buffer const&) = delete;
+
+    void fill(int offset)
+    {
+        for (std::size_t i = 0; i != size; ++i)
+            data[i] = offset + int(i);
+    }
+
+    bool equals(pinned_buffer const& rhs) const
+    {
+        for (std::size_t i = 0; i != size; ++i)
+        {
+            if (data[i] != rhs.data[i])
+                return false;
+        }
+        return true;
+    }
+
+    int* data = nullptr;
+    std::size_t size;
+};
+
+// copies from the host to the device and back
+struct round_trip
+{
+    int* in;
+    int* out;
+    int* device;
+    std::size_t size;
+
+    void operator()(cu::cuda_graph_executor& exec) const
+    {
+        hpx::apply(exec, cudaMemcpyAsync, device, in, size * sizeof(int),
+            cudaMemcpyHostToDevice);
+
+        // the futures returned while capturing are ready right away
+        hpx::future<void> f = hpx::async(exec, cudaMemcpyAsync, out, device,
+            size * sizeof(int), cudaMemcpyDeviceToHost);
+        HPX_TEST(f.is_ready());
+        HPX_TEST(exec.is_capturing());
+    }
+};
+
+// -------------------------------------------------------------------------
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    // install cuda future polling handler
+    cu::enable_user_polling poll("default");
+
+    std::size_t device = vm["device"].as<std::size_t>();
+    std::size_t const n = 1000;
+
+    pinned_buffer in1(n), in2(n), out(n);
+    int* d = nullptr;
+    cu::check_cuda_error(cudaMalloc(&d, n * sizeof(int)));
+
+    cu::cuda_graph_executor exec(device);
+    HPX_TEST(!exec.has_graph());
+    HPX_TEST(!exec.is_capturing());
+
+    // launching without a graph fails
+    HPX_TEST(exec.launch().has_exception());
+
+    // the graph is captured on the first launch and replayed afterwards
+    for (int i = 0; i != 10; ++i)
+    {
+        in1.fill(i);
+        exec.launch(round_trip{in1.data, out.data, d, n}).get();
+        HPX_TEST(exec.has_graph());
+        HPX_TEST(!exec.is_capturing());
+        HPX_TEST(out.equals(in1));
+    }
+
+    // a copy of the executor shares the graph
+    cu::cuda_graph_executor exec_copy = exec;
+    in1.fill(42);
+    exec_copy.launch().get();
+    HPX_TEST(out.equals(in1));
+
+    // capturing again updates the parameters of the graph
+    in2.fill(-100);
+    exec.capture(round_trip{in2.data, out.data, d, n});
+    exec.launch().get();
+    HPX_TEST(out.equals(in2));
+
+    // capturing a different sequence of calls replaces the graph
+    in1.fill(7);
+    exec.capture([&](cu::cuda_graph_executor& e) {
+        hpx::apply(e, cudaMemcpyAsync, out.data, in1.data, n * sizeof(int),
+            cudaMemcpyHostToHost);
+    });
+    exec.launch().get();
+    HPX_TEST(out.equals(in1));
+
+    // the executor can be used without a graph while not capturing
+    in2.fill(3);
+    hpx::apply(exec, cudaMemcpyAsync, d, in2.data, n * sizeof(int),
+        cudaMemcpyHostToDevice);
+    hpx::async(exec, cudaMemcpyAsync, out.data, d, n * sizeof(int),
+        cudaMemcpyDeviceToHost)
+        .get();
+    HPX_TEST(out.equals(in2));
+
+    // exceptions thrown while capturing discard the graph being captured
+    bool caught_exception = false;
+    try
+    {
+        exec.capture([](cu::cuda_graph_executor&) {
+            throw hpx::exception(hpx::bad_parameter, "capture");
+        });
+    }
+    catch (hpx::exception const&)
+    {
+        caught_exception = true;
+    }
+    HPX_TEST(caught_exception);
+    HPX_TEST(!exec.is_capturing());
+
+    // the previously captured graph remains valid
+    in1.fill(11);
+    exec.launch().get();
+    HPX_TEST(out.equals(in1));
+
+    cu::check_cuda_error(cudaFree(d));
+
+    return hpx::local::finalize();
+}
+
+// -------------------------------------------------------------------------
+int main(int argc, char** argv)
+{
+    using namespace hpx::program_options;
+    options_description cmdline("usage: " HPX_APPLICATION_STRING " [options]");
+    cmdline.add_options()("device",
+        hpx::program_options::value<std::size_t>()->default_value(0),
+        "Device to use");
+
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = cmdline;
+
+    auto result = hpx::local::init(hpx_main, argc, argv, init_args);
+    return result || hpx::util::report_errors();
+}
@@ -0,0 +1,158 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/local/init.hpp>
+#include <hpx/modules/async_cuda.hpp>
+#include <hpx/modules/compute_local.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <vector>
+
+namespace cu = hpx::cuda::experimental;
+
+// -------------------------------------------------------------------------
+void test_pinned_memory_pool()
+{
+    cu::pinned_memory_pool pool;
+
+    // the first allocation of a size class allocates a new block
+    void* p1 = pool.allocate(1000);
+    cu::memory_pool_statistics stats = pool.statistics();
+    HPX_TEST_EQ(stats.hits, std::size_t(0));
+    HPX_TEST_EQ(stats.misses, std::size_t(1));
+    HPX_TEST_EQ(stats.requested_bytes, std::size_t(1000));
+    HPX_TEST_EQ(stats.used_bytes, std::size_t(1024));
+    HPX_TEST_EQ(stats.cached_bytes, std::size_t(0));
+    HPX_TEST(stats.fragmentation() > 0.0);
+
+    // returned blocks are cached and reused by the same size class
+    pool.deallocate(p1, 1000);
+    stats = pool.statistics();
+    HPX_TEST_EQ(stats.used_bytes, std::size_t(0));
+    HPX_TEST_EQ(stats.cached_bytes, std::size_t(1024));
+    HPX_TEST_EQ(stats.fragmentation(), 1.0);
+
+    void* p2 = pool.allocate(1024);
+    HPX_TEST_EQ(p2, p1);
+    stats = pool.statistics();
+    HPX_TEST_EQ(stats.hits, std::size_t(1));
+    HPX_TEST_EQ(stats.misses, std::size_t(1));
+    HPX_TEST_EQ(stats.cached_bytes, std::size_t(0));
+    HPX_TEST_EQ(stats.fragmentation(), 0.0);
+
+    // a different size class needs a new block
+    void* p3 = pool.allocate(100);
+    stats = pool.statistics();
+    HPX_TEST_EQ(stats.misses, std::size_t(2));
+    HPX_TEST_EQ(stats.used_bytes, std::size_t(1024 + 256));
+
+    pool.deallocate(p2, 1024);
+    pool.deallocate(p3, 100);
+
+    // releasing frees all cached blocks
+    pool.release();
+    stats = pool.statistics();
+    HPX_TEST_EQ(stats.cached_bytes, std::size_t(0));
+    HPX_TEST_EQ(stats.used_bytes, std::size_t(0));
+    HPX_TEST_EQ(stats.fragmentation(), 0.0);
+}
+
+void test_pinned_allocator()
+{
+    cu::pinned_memory_pool pool;
+    cu::pinned_allocator<int> alloc(pool);
+
+    // the pinned allocator is a host allocator
+    for (int i = 0; i != 10; ++i)
+    {
+        std::vector<int, cu::pinned_allocator<int>> v(1000, i, alloc);
+        for (int value : v)
+        {
+            HPX_TEST_EQ(value, i);
+        }
+    }
+
+    cu::memory_pool_statistics stats = pool.statistics();
+    HPX_TEST_EQ(stats.misses, std::size_t(1));
+    HPX_TEST_EQ(stats.hits, std::size_t(9));
+
+    // rebound allocators share the pool
+    cu::pinned_allocator<double> rebound(alloc);
+    HPX_TEST_EQ(&rebound.get_pool(), &pool);
+    HPX_TEST(cu::pinned_allocator<int>(rebound) == alloc);
+    HPX_TEST(cu::pinned_allocator<int>() != alloc);
+}
+
+void test_device_allocator(std::size_t device)
+{
+    cu::target target(static_cast<int>(device));
+    cu::device_memory_pool pool(target);
+    cu::device_allocator<int> alloc(pool);
+
+    std::size_t const n = 1000;
+    std::vector<int> host(n);
+
+    using vector_type = hpx::compute::vector<int, cu::device_allocator<int>>;
+    using alloc_traits =
+        hpx::compute::traits::allocator_traits<cu::device_allocator<int>>;
+
+    for (int i = 0; i != 10; ++i)
+    {
+        // the elements are initialized on the device
+        vector_type v(n, i, alloc);
+        cu::check_cuda_error(cudaMemcpyAsync(host.data(), v.data(),
+            n * sizeof(int), cudaMemcpyDeviceToHost,
+            target.native_handle().get_stream()));
+        target.synchronize();
+
+        for (int value : host)
+        {
+            HPX_TEST_EQ(value, i);
+        }
+
+        // single elements are accessed through the target
+        HPX_TEST_EQ(alloc_traits::access_target::read(target, v.data() + 1), i);
+
+        int const value = 42;
+        alloc_traits::access_target::write(target, v.data() + 1, &value);
+        HPX_TEST_EQ(alloc_traits::access_target::read(target, v.data() + 1),
+            value);
+    }
+
+    cu::memory_pool_statistics stats = pool.statistics();
+    HPX_TEST_EQ(stats.misses, std::size_t(1));
+    HPX_TEST_EQ(stats.hits, std::size_t(9));
+    HPX_TEST_EQ(stats.used_bytes, std::size_t(0));
+}
+
+// -------------------------------------------------------------------------
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    std::size_t device = vm["device"].as<std::size_t>();
+
+    test_pinned_memory_pool();
+    test_pinned_allocator();
+    test_device_allocator(device);
+
+    return hpx::local::finalize();
+}
+
+// -------------------------------------------------------------------------
+int main(int argc, char** argv)
+{
+    using namespace hpx::program_options;
+    options_description cmdline("usage: " HPX_APPLICATION_STRING " [options]");
+    cmdline.add_options()("device",
+        hpx::program_options::value<std::size_t>()->default_value(0),
+        "Device to use");
+
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = cmdline;
+
+    auto result = hpx::local::init(hpx_main, argc, argv, init_args);
+    return result || hpx::util::report_errors();
+}
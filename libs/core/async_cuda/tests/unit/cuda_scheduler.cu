@@ -0,0 +1,196 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+// NVCC fails unceremoniously with this test at least until V11.5
+#if !defined(HPX_CUDA_VERSION) || (HPX_CUDA_VERSION > 1105)
+
+#include <hpx/local/init.hpp>
+#include <hpx/modules/async_cuda.hpp>
+#include <hpx/modules/execution.hpp>
+#include <hpx/modules/executors.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <utility>
+
+__global__ void increment_kernel(int* p)
+{
+    ++(*p);
+}
+
+struct increment
+{
+    static std::atomic<std::size_t> calls;
+
+    int* operator()(int* p, cudaStream_t stream) const
+    {
+        ++calls;
+        increment_kernel<<<1, 1, 0, stream>>>(p);
+        return p;
+    }
+};
+
+std::atomic<std::size_t> increment::calls{0};
+
+// stores the stream the stage has been enqueued on
+struct record_stream
+{
+    cudaStream_t* recorded;
+
+    int* operator()(int* p, cudaStream_t stream) const
+    {
+        *recorded = stream;
+        return p;
+    }
+};
+
+// copies the device value to the host
+struct copy_to_host
+{
+    int* p_h;
+    int* p_d;
+
+    cudaError_t operator()(cudaStream_t stream) const
+    {
+        return cudaMemcpyAsync(
+            p_h, p_d, sizeof(int), cudaMemcpyDeviceToHost, stream);
+    }
+};
+
+struct cuda_memcpy_async
+{
+    template <typename... Ts>
+    auto operator()(Ts&&... ts)
+    {
+        return cudaMemcpyAsync(std::forward<Ts>(ts)...);
+    }
+};
+
+int hpx_main()
+{
+    namespace cu = ::hpx::cuda::experimental;
+    namespace ex = ::hpx::execution::experimental;
+    namespace tt = hpx::this_thread::experimental;
+
+    cu::enable_user_polling p;
+
+    cudaStream_t stream;
+    cu::check_cuda_error(cudaStreamCreate(&stream));
+    cu::cuda_scheduler sched(stream);
+
+    static_assert(ex::is_scheduler_v<cu::cuda_scheduler>);
+    HPX_TEST(sched == cu::cuda_scheduler(stream));
+    HPX_TEST(sched != cu::cuda_scheduler());
+    HPX_TEST(sched.get_stream() == stream);
+    HPX_TEST(ex::get_completion_scheduler<ex::set_value_t>(
+                 ex::schedule(sched)) == sched);
+
+    int* p_d = nullptr;
+    cu::check_cuda_error(cudaMalloc((void**) &p_d, sizeof(int)));
+
+    // Consecutive stages are enqueued on the stream of the scheduler
+    {
+        increment::calls = 0;
+        int p_h = 0;
+        cudaStream_t recorded{};
+
+        auto s = ex::transfer_just(sched, p_d, &p_h, sizeof(int),
+                     cudaMemcpyHostToDevice) |
+            cu::then_on_stream(cuda_memcpy_async{}) |
+            ex::then([p_d](cudaError_t) { return p_d; }) |
+            ex::transfer(sched) | cu::then_on_stream(increment{}) |
+            cu::then_on_stream(increment{}) |
+            cu::then_on_stream(record_stream{&recorded}) |
+            cu::then_on_stream(increment{});
+
+        HPX_TEST(
+            ex::get_completion_scheduler<ex::set_value_t>(s) == sched);
+
+        int* result = hpx::get<0>(*tt::sync_wait(std::move(s)));
+        HPX_TEST_EQ(result, p_d);
+        HPX_TEST_EQ(increment::calls.load(), std::size_t(3));
+        HPX_TEST(recorded == stream);
+
+        // the final receiver waits for the work on the stream
+        tt::sync_wait(ex::schedule(sched) |
+            cu::then_on_stream(copy_to_host{&p_h, p_d}) |
+            ex::transfer(ex::thread_pool_scheduler{}));
+        HPX_TEST_EQ(p_h, 3);
+    }
+
+    // Stages added to separate senders on the same scheduler
+    {
+        increment::calls = 0;
+        int p_h = 0;
+
+        for (std::size_t i = 0; i != 10; ++i)
+        {
+            int* result = hpx::get<0>(*tt::sync_wait(
+                ex::transfer_just(sched, p_d) |
+                cu::then_on_stream(increment{}) |
+                ex::transfer(ex::thread_pool_scheduler{})));
+            HPX_TEST_EQ(result, p_d);
+        }
+        HPX_TEST_EQ(increment::calls.load(), std::size_t(10));
+
+        tt::sync_wait(ex::schedule(sched) |
+            cu::then_on_stream(copy_to_host{&p_h, p_d}) |
+            ex::transfer(ex::thread_pool_scheduler{}));
+        HPX_TEST_EQ(p_h, 13);
+    }
+
+    // Transferring between different streams waits for the first stream
+    {
+        cudaStream_t other_stream;
+        cu::check_cuda_error(cudaStreamCreate(&other_stream));
+        cu::cuda_scheduler other_sched(other_stream);
+
+        increment::calls = 0;
+        int p_h = 0;
+        cudaStream_t recorded{};
+
+        auto s = ex::transfer_just(sched, p_d, &p_h, sizeof(int),
+                     cudaMemcpyHostToDevice) |
+            cu::then_on_stream(cuda_memcpy_async{}) |
+            ex::then([p_d](cudaError_t) { return p_d; }) |
+            ex::transfer(sched) | cu::then_on_stream(increment{}) |
+            ex::transfer(other_sched) | cu::then_on_stream(increment{}) |
+            cu::then_on_stream(record_stream{&recorded});
+
+        HPX_TEST(ex::get_completion_scheduler<ex::set_value_t>(s) ==
+            other_sched);
+
+        tt::sync_wait(std::move(s) |
+            ex::then([](int*) {}) | ex::transfer(other_sched) |
+            cu::then_on_stream(copy_to_host{&p_h, p_d}) |
+            ex::transfer(ex::thread_pool_scheduler{}));
+        HPX_TEST_EQ(increment::calls.load(), std::size_t(2));
+        HPX_TEST(recorded == other_stream);
+        HPX_TEST_EQ(p_h, 2);
+
+        cu::check_cuda_error(cudaStreamDestroy(other_stream));
+    }
+
+    cu::check_cuda_error(cudaFree(p_d));
+    cu::check_cuda_error(cudaStreamDestroy(stream));
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ(hpx::local::init(hpx_main, argc, argv), 0);
+    return hpx::util::report_errors();
+}
+#else
+int main(int, char*[])
+{
+    return 0;
+}
+#endif
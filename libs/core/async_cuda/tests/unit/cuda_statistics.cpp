@@ -0,0 +1,164 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/local/future.hpp>
+#include <hpx/local/init.hpp>
+#include <hpx/modules/async_cuda.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace cu = hpx::cuda::experimental;
+
+// -------------------------------------------------------------------------
+void reset(cu::device_statistics& stats)
+{
+    stats.get_kernel_count(true);
+    stats.get_average_kernel_time(true);
+    stats.get_host_to_device_bytes(true);
+    stats.get_device_to_host_bytes(true);
+}
+
+void test_transfers(cu::cuda_executor const& exec, cu::device_statistics& stats)
+{
+    reset(stats);
+
+    std::size_t const n = 1000;
+    std::size_t const bytes = n * sizeof(int);
+    std::vector<int> host(n, 42);
+
+    int* device = nullptr;
+    cu::check_cuda_error(cudaMalloc(&device, bytes));
+
+    hpx::async(exec, cudaMemcpyAsync, device, host.data(), bytes,
+        cudaMemcpyHostToDevice)
+        .get();
+    hpx::async(exec, cudaMemcpyAsync, host.data(), device, bytes,
+        cudaMemcpyDeviceToHost)
+        .get();
+    hpx::async(exec, cudaMemcpyAsync, host.data(), device, bytes / 2,
+        cudaMemcpyDeviceToHost)
+        .get();
+
+    // copies within the device are not transfers
+    hpx::async(exec, cudaMemcpyAsync, device, device + n / 2, bytes / 2,
+        cudaMemcpyDeviceToDevice)
+        .get();
+
+    HPX_TEST_EQ(stats.get_host_to_device_bytes(false), std::int64_t(bytes));
+    HPX_TEST_EQ(
+        stats.get_device_to_host_bytes(true), std::int64_t(bytes + bytes / 2));
+    HPX_TEST_EQ(stats.get_device_to_host_bytes(false), std::int64_t(0));
+
+    // copies are not counted as kernels
+    HPX_TEST_EQ(stats.get_kernel_count(false), std::int64_t(0));
+
+    cu::check_cuda_error(cudaFree(device));
+}
+
+void test_kernels(cu::cuda_executor const& exec, cu::device_statistics& stats)
+{
+    reset(stats);
+
+    for (int i = 0; i != 10; ++i)
+    {
+        hpx::async(exec, cudaStreamSynchronize).get();
+    }
+    HPX_TEST_EQ(stats.get_kernel_count(true), std::int64_t(10));
+    HPX_TEST_EQ(stats.get_kernel_count(false), std::int64_t(0));
+
+    // the kernels are only timed once enabled, the time is known once the
+    // future has become ready
+    HPX_TEST_EQ(stats.get_timed_kernel_count(false), std::int64_t(0));
+
+    cu::device_statistics::enable_kernel_timing();
+    hpx::async(exec, cudaStreamSynchronize).get();
+    HPX_TEST_EQ(stats.get_timed_kernel_count(false), std::int64_t(1));
+    HPX_TEST(stats.get_average_kernel_time(true) >= 0);
+    HPX_TEST_EQ(stats.get_timed_kernel_count(false), std::int64_t(0));
+    cu::device_statistics::enable_kernel_timing(false);
+
+    // nothing is pending once the futures are ready
+    std::vector<hpx::future<void>> futures;
+    for (int i = 0; i != 10; ++i)
+    {
+        futures.push_back(hpx::async(exec, cudaStreamSynchronize));
+    }
+    hpx::wait_all(futures);
+    HPX_TEST_EQ(stats.get_queue_depth(false), std::int64_t(0));
+}
+
+void test_polling(cu::cuda_executor const& exec)
+{
+    cu::device_statistics::get_polling_count(true);
+    cu::device_statistics::get_polling_time(true);
+
+    cu::device_statistics::enable_polling_timing();
+    hpx::async(exec, cudaStreamSynchronize).get();
+    HPX_TEST(cu::device_statistics::get_polling_count(false) > 0);
+    HPX_TEST(cu::device_statistics::get_polling_time(false) >= 0);
+    cu::device_statistics::enable_polling_timing(false);
+}
+
+void test_invalid_device()
+{
+    HPX_TEST(cu::device_statistics::find(-1) == nullptr);
+    HPX_TEST(cu::device_statistics::find(static_cast<int>(
+                 cu::device_statistics::get_num_devices())) == nullptr);
+
+    bool caught_exception = false;
+    try
+    {
+        cu::device_statistics::get(-1);
+    }
+    catch (hpx::exception const& e)
+    {
+        HPX_TEST_EQ(e.get_error(), hpx::bad_parameter);
+        caught_exception = true;
+    }
+    HPX_TEST(caught_exception);
+}
+
+// -------------------------------------------------------------------------
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    // install cuda future polling handler
+    cu::enable_user_polling poll("default");
+
+    std::size_t device = vm["device"].as<std::size_t>();
+    cu::device_statistics& stats =
+        cu::device_statistics::get(static_cast<int>(device));
+
+    cu::cuda_executor exec(device, true);
+    test_transfers(exec, stats);
+    test_kernels(exec, stats);
+    test_polling(exec);
+    test_invalid_device();
+
+    // the statistics don't depend on how the completion is signaled
+    cu::cuda_executor callback_exec(device, false);
+    test_transfers(callback_exec, stats);
+
+    return hpx::local::finalize();
+}
+
+// -------------------------------------------------------------------------
+int main(int argc, char** argv)
+{
+    using namespace hpx::program_options;
+    options_description cmdline("usage: " HPX_APPLICATION_STRING " [options]");
+    cmdline.add_options()("device",
+        hpx::program_options::value<std::size_t>()->default_value(0),
+        "Device to use");
+
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = cmdline;
+
+    auto result = hpx::local::init(hpx_main, argc, argv, init_args);
+    return result || hpx::util::report_errors();
+}
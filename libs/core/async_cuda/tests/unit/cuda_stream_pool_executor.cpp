@@ -0,0 +1,137 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/local/execution.hpp>
+#include <hpx/local/future.hpp>
+#include <hpx/local/init.hpp>
+#include <hpx/modules/async_cuda.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace cu = hpx::cuda::experimental;
+
+// -------------------------------------------------------------------------
+// copy the data to the device and back using the streams of the executor
+void test_copies(cu::cuda_stream_pool_executor const& exec, std::size_t n)
+{
+    std::size_t const num_copies = 4 * exec.get_pool()->size();
+
+    std::vector<std::vector<int>> host(num_copies, std::vector<int>(n));
+    std::vector<std::vector<int>> result(num_copies, std::vector<int>(n, 0));
+    std::vector<int*> device(num_copies, nullptr);
+
+    for (std::size_t i = 0; i != num_copies; ++i)
+    {
+        for (std::size_t j = 0; j != n; ++j)
+            host[i][j] = int(i * n + j);
+        cu::check_cuda_error(cudaMalloc(&device[i], n * sizeof(int)));
+    }
+
+    // consecutive tasks may run on different streams, the copies back to the
+    // host have to wait for the copies to the device
+    std::vector<hpx::future<void>> copies;
+    for (std::size_t i = 0; i != num_copies; ++i)
+    {
+        copies.push_back(hpx::async(exec, cudaMemcpyAsync, device[i],
+            host[i].data(), n * sizeof(int), cudaMemcpyHostToDevice));
+    }
+    hpx::wait_all(copies);
+
+    copies.clear();
+    for (std::size_t i = 0; i != num_copies; ++i)
+    {
+        copies.push_back(hpx::async(exec, cudaMemcpyAsync, result[i].data(),
+            device[i], n * sizeof(int), cudaMemcpyDeviceToHost));
+    }
+    hpx::wait_all(copies);
+
+    for (std::size_t i = 0; i != num_copies; ++i)
+    {
+        HPX_TEST(result[i] == host[i]);
+        cu::check_cuda_error(cudaFree(device[i]));
+    }
+}
+
+// no tasks are pending once all futures have become ready
+void test_pending(cu::cuda_stream_pool_executor const& exec, bool high)
+{
+    std::shared_ptr<cu::cuda_stream_pool> const& pool = exec.get_pool();
+
+    std::vector<int> host(1024, 42);
+    int* device = nullptr;
+    cu::check_cuda_error(cudaMalloc(&device, host.size() * sizeof(int)));
+
+    std::vector<hpx::future<void>> copies;
+    for (std::size_t i = 0; i != 2 * pool->size(); ++i)
+    {
+        copies.push_back(hpx::async(exec, cudaMemcpyAsync, device, host.data(),
+            host.size() * sizeof(int), cudaMemcpyHostToDevice));
+    }
+    hpx::wait_all(copies);
+
+    for (std::size_t s = 0; s != pool->size(); ++s)
+    {
+        HPX_TEST_EQ(pool->pending(s, high), std::size_t(0));
+    }
+
+    cu::check_cuda_error(cudaFree(device));
+}
+
+// -------------------------------------------------------------------------
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    // install cuda future polling handler
+    cu::enable_user_polling poll("default");
+
+    std::size_t device = vm["device"].as<std::size_t>();
+
+    for (cu::stream_selection selection :
+        {cu::stream_selection::round_robin, cu::stream_selection::least_loaded})
+    {
+        cu::cuda_stream_pool_executor exec(device, 4, selection);
+        HPX_TEST(exec.get_stream_selection() == selection);
+        HPX_TEST_EQ(exec.get_pool()->size(), std::size_t(4));
+
+        test_copies(exec, 1000);
+        test_pending(exec, false);
+
+        // high priority tasks use the high priority streams of the pool
+        auto high_exec = hpx::execution::experimental::with_priority(
+            exec, hpx::threads::thread_priority::high);
+        HPX_TEST(hpx::execution::experimental::get_priority(high_exec) ==
+            hpx::threads::thread_priority::high);
+        HPX_TEST(high_exec.get_pool() == exec.get_pool());
+
+        test_copies(high_exec, 1000);
+        test_pending(high_exec, true);
+
+        // executors sharing a pool
+        cu::cuda_stream_pool_executor shared_exec(
+            exec.get_pool(), selection, false);
+        test_copies(shared_exec, 10);
+    }
+
+    return hpx::local::finalize();
+}
+
+// -------------------------------------------------------------------------
+int main(int argc, char** argv)
+{
+    using namespace hpx::program_options;
+    options_description cmdline("usage: " HPX_APPLICATION_STRING " [options]");
+    cmdline.add_options()("device",
+        hpx::program_options::value<std::size_t>()->default_value(0),
+        "Device to use");
+
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = cmdline;
+
+    auto result = hpx::local::init(hpx_main, argc, argv, init_args);
+    return result || hpx::util::report_errors();
+}
@@ -0,0 +1,270 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file hpx/async_io/block_range.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/async_io/file.hpp>
+#include <hpx/async_io/mapped_file.hpp>
+#include <hpx/iterator_support/iterator_facade.hpp>
+#include <hpx/iterator_support/iterator_range.hpp>
+#include <hpx/serialization/serialize_buffer.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <utility>
+
+namespace hpx { namespace io { namespace experimental {
+
+    namespace detail {
+
+        // The blocks of a mapped file, touching the pages of a block makes
+        // the kernel read the blocks ahead of it
+        template <typename T>
+        struct mapped_blocks
+        {
+            using block_type = hpx::util::iterator_range<T const*>;
+
+            mapped_blocks(mapped_file const& f, std::size_t block_size,
+                std::size_t prefetch_distance) noexcept
+              : file_(&f)
+              , block_size_(block_size)
+              , size_(f.size() / sizeof(T))
+              , prefetch_distance_(prefetch_distance)
+            {
+                HPX_ASSERT(block_size_ != 0);
+            }
+
+            std::size_t num_blocks() const noexcept
+            {
+                return (size_ + block_size_ - 1) / block_size_;
+            }
+
+            block_type get(std::size_t index) const noexcept
+            {
+                HPX_ASSERT(index < num_blocks());
+
+                std::size_t const bytes = block_size_ * sizeof(T);
+                if (prefetch_distance_ != 0)
+                {
+                    file_->prefetch(
+                        (index + prefetch_distance_) * bytes, bytes);
+                }
+
+                T const* data = reinterpret_cast<T const*>(file_->data());
+                std::size_t const first = index * block_size_;
+                return block_type(data + first,
+                    data + (std::min)(first + block_size_, size_));
+            }
+
+            mapped_file const* file_;
+            std::size_t block_size_;
+            std::size_t size_;
+            std::size_t prefetch_distance_;
+        };
+
+        // The blocks of a file read through the asynchronous I/O layer, the
+        // calling HPX thread is suspended while a block is being read
+        template <typename T>
+        struct streamed_blocks
+        {
+            using block_type = serialization::serialize_buffer<T>;
+
+            streamed_blocks(file const& f, std::size_t block_size,
+                std::size_t prefetch_distance)
+              : file_(&f)
+              , block_size_(block_size)
+              , size_(std::size_t(f.size() / sizeof(T)))
+              , prefetch_distance_(prefetch_distance)
+            {
+                HPX_ASSERT(block_size_ != 0);
+            }
+
+            std::size_t num_blocks() const noexcept
+            {
+                return (size_ + block_size_ - 1) / block_size_;
+            }
+
+            block_type get(std::size_t index) const
+            {
+                HPX_ASSERT(index < num_blocks());
+
+                std::uint64_t const bytes = block_size_ * sizeof(T);
+                if (prefetch_distance_ != 0)
+                {
+                    file_->prefetch(
+                        (index + prefetch_distance_) * bytes, bytes);
+                }
+
+                std::size_t const first = index * block_size_;
+                std::size_t const count =
+                    (std::min)(first + block_size_, size_) - first;
+
+                // the data is not copied, the buffer refers to the one the
+                // block was read into
+                file::buffer_type buffer =
+                    file_->read(count * sizeof(T), index * bytes).get();
+                T* data = reinterpret_cast<T*>(buffer.data());
+                std::size_t const size = buffer.size() / sizeof(T);
+                return block_type(data, size, block_type::reference,
+                    [buffer = HPX_MOVE(buffer)](T*) noexcept {});
+            }
+
+            file const* file_;
+            std::size_t block_size_;
+            std::size_t size_;
+            std::size_t prefetch_distance_;
+        };
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// A random access iterator over the blocks of a \a block_range,
+    /// dereferencing it returns the block by value.
+    template <typename Blocks>
+    class block_iterator
+      : public hpx::util::iterator_facade<block_iterator<Blocks>,
+            typename Blocks::block_type, std::random_access_iterator_tag,
+            typename Blocks::block_type>
+    {
+        using base_type = hpx::util::iterator_facade<block_iterator<Blocks>,
+            typename Blocks::block_type, std::random_access_iterator_tag,
+            typename Blocks::block_type>;
+
+    public:
+        block_iterator() noexcept
+          : blocks_(nullptr)
+          , index_(0)
+        {
+        }
+
+        block_iterator(Blocks const* blocks, std::size_t index) noexcept
+          : blocks_(blocks)
+          , index_(index)
+        {
+        }
+
+        std::size_t index() const noexcept
+        {
+            return index_;
+        }
+
+    private:
+        friend class hpx::util::iterator_core_access;
+
+        bool equal(block_iterator const& rhs) const noexcept
+        {
+            return index_ == rhs.index_;
+        }
+
+        void increment() noexcept
+        {
+            ++index_;
+        }
+
+        void decrement() noexcept
+        {
+            --index_;
+        }
+
+        void advance(typename base_type::difference_type n) noexcept
+        {
+            index_ += n;
+        }
+
+        typename base_type::difference_type distance_to(
+            block_iterator const& rhs) const noexcept
+        {
+            return static_cast<typename base_type::difference_type>(
+                       rhs.index_) -
+                static_cast<typename base_type::difference_type>(index_);
+        }
+
+        typename base_type::reference dereference() const
+        {
+            return blocks_->get(index_);
+        }
+
+        Blocks const* blocks_;
+        std::size_t index_;
+    };
+
+    /// A file split into blocks of a fixed number of objects of type T (the
+    /// last block may be shorter). Parallel algorithms partition the range
+    /// of blocks between their tasks, which read their blocks concurrently.
+    /// Whenever a block is accessed the kernel is asked to read the block
+    /// \a prefetch_distance blocks ahead of it in the background, so the
+    /// distance should be smaller than the number of blocks handled by
+    /// a single task (the chunk size of the algorithm).
+    ///
+    /// \note The range and the underlying file have to stay alive while the
+    ///       iterators of the range are in use.
+    template <typename Blocks>
+    class block_range
+    {
+    public:
+        using block_type = typename Blocks::block_type;
+        using iterator = block_iterator<Blocks>;
+        using const_iterator = iterator;
+
+        explicit block_range(Blocks blocks) noexcept
+          : blocks_(HPX_MOVE(blocks))
+        {
+        }
+
+        // the iterators refer to this object
+        block_range(block_range const&) = delete;
+        block_range& operator=(block_range const&) = delete;
+
+        iterator begin() const noexcept
+        {
+            return iterator(&blocks_, 0);
+        }
+
+        iterator end() const noexcept
+        {
+            return iterator(&blocks_, blocks_.num_blocks());
+        }
+
+        std::size_t size() const noexcept
+        {
+            return blocks_.num_blocks();
+        }
+
+        block_type operator[](std::size_t index) const
+        {
+            return blocks_.get(index);
+        }
+
+    private:
+        Blocks blocks_;
+    };
+
+    /// Split the mapped file into blocks of \a block_size objects of type T.
+    template <typename T = char>
+    block_range<detail::mapped_blocks<T>> make_block_range(
+        mapped_file const& f, std::size_t block_size,
+        std::size_t prefetch_distance = 1)
+    {
+        return block_range<detail::mapped_blocks<T>>(
+            detail::mapped_blocks<T>(f, block_size, prefetch_distance));
+    }
+
+    /// Split the file into blocks of \a block_size objects of type T, which
+    /// are read into buffers when they are accessed.
+    template <typename T = char>
+    block_range<detail::streamed_blocks<T>> make_block_range(
+        file const& f, std::size_t block_size,
+        std::size_t prefetch_distance = 1)
+    {
+        return block_range<detail::streamed_blocks<T>>(
+            detail::streamed_blocks<T>(f, block_size, prefetch_distance));
+    }
+}}}    // namespace hpx::io::experimental
@@ -0,0 +1,71 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/modules/threading_base.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace hpx { namespace io { namespace experimental { namespace detail {
+
+    enum class operation_kind
+    {
+        read,
+        write,
+        fsync
+    };
+
+    // Base class of the shared states of all file operations. A read or write
+    // is resubmitted until all of the requested bytes have been transferred,
+    // a read stops early at the end of the file only.
+    struct HPX_CORE_EXPORT operation
+    {
+        operation(operation_kind kind, int fd, char* data, std::size_t size,
+            std::uint64_t offset) noexcept
+          : kind_(kind)
+          , fd_(fd)
+          , data_(data)
+          , size_(size)
+          , offset_(offset)
+          , transferred_(0)
+        {
+        }
+
+        virtual ~operation() = default;
+
+        // Account for the result of a single read, write, or fsync system
+        // call (the number of bytes transferred or -errno). Returns whether
+        // the operation has to be submitted again, otherwise finish has been
+        // invoked and the object may have been destroyed already.
+        bool advance(std::int64_t res);
+
+        // Perform the remaining part of the operation using blocking system
+        // calls.
+        void run_blocking();
+
+        // Make the future of the operation ready, error is zero or an errno
+        // value.
+        virtual void finish(int error) = 0;
+
+        operation_kind kind_;
+        int fd_;
+        char* data_;
+        std::size_t size_;
+        std::uint64_t offset_;
+        std::size_t transferred_;
+    };
+
+    // Hand the operation to the kernel, through io_uring if it is available
+    // and polling is enabled on any thread pool, or run it on the I/O pool
+    // otherwise. The operation object has to stay alive until it finished.
+    HPX_CORE_EXPORT void submit(operation& op);
+
+    HPX_CORE_EXPORT void register_polling(hpx::threads::thread_pool_base&);
+    HPX_CORE_EXPORT void unregister_polling(hpx::threads::thread_pool_base&);
+}}}}    // namespace hpx::io::experimental::detail
@@ -0,0 +1,132 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file hpx/async_io/file.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/futures/future.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/serialization/serialize_buffer.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace hpx { namespace io { namespace experimental {
+
+    /// The ways a \a file can be opened, the values can be combined.
+    enum class open_mode : unsigned
+    {
+        read = 0x01,          ///< open for reading
+        write = 0x02,         ///< open for writing
+        read_write = 0x03,    ///< open for reading and writing
+        create = 0x04,        ///< create the file if it does not exist
+        truncate = 0x08       ///< truncate an existing file to zero length
+    };
+
+    constexpr open_mode operator|(open_mode lhs, open_mode rhs) noexcept
+    {
+        return static_cast<open_mode>(
+            static_cast<unsigned>(lhs) | static_cast<unsigned>(rhs));
+    }
+
+    constexpr bool operator&(open_mode lhs, open_mode rhs) noexcept
+    {
+        return (static_cast<unsigned>(lhs) & static_cast<unsigned>(rhs)) != 0;
+    }
+
+    /// A file supporting asynchronous reads and writes at given offsets
+    /// which don't block the calling HPX thread. The operations are
+    /// submitted through io_uring and completed from the scheduling loop of
+    /// the thread pool polling is enabled on (see \a enable_user_polling).
+    /// Without io_uring support, or if polling is not enabled on any pool,
+    /// they are executed on the I/O pool of the runtime instead.
+    ///
+    /// \note The file has to stay open and the buffers given to \a read and
+    ///       \a write have to stay alive until the returned futures become
+    ///       ready.
+    class HPX_CORE_EXPORT file
+    {
+    public:
+        using buffer_type = serialization::serialize_buffer<char>;
+
+        file() noexcept;
+
+        /// Open the file with the given path.
+        ///
+        /// \param path [in] The path of the file to open.
+        /// \param mode [in] How to open the file.
+        /// \param ec   [in,out] this represents the error status on exit, if
+        ///             this is pre-initialized to \a hpx#throws the function
+        ///             will throw on error instead.
+        explicit file(std::string const& path,
+            open_mode mode = open_mode::read, error_code& ec = throws);
+
+        /// Take ownership of the given file descriptor.
+        explicit file(int fd) noexcept;
+
+        file(file&& rhs) noexcept;
+        file& operator=(file&& rhs) noexcept;
+
+        file(file const&) = delete;
+        file& operator=(file const&) = delete;
+
+        ~file();
+
+        bool is_open() const noexcept
+        {
+            return fd_ != -1;
+        }
+
+        int native_handle() const noexcept
+        {
+            return fd_;
+        }
+
+        /// Close the file.
+        void close(error_code& ec = throws);
+
+        /// Return the current size of the file.
+        std::uint64_t size(error_code& ec = throws) const;
+
+        /// Read \a size bytes starting at \a offset into \a data. The future
+        /// returns the number of bytes read, which is smaller than \a size
+        /// only if the end of the file was reached.
+        hpx::future<std::size_t> read(
+            void* data, std::size_t size, std::uint64_t offset) const;
+
+        /// Read \a size bytes starting at \a offset into a newly allocated
+        /// buffer. The data is read into the buffer directly, which can then
+        /// be sent to other localities without being copied again. The
+        /// returned buffer is shorter than \a size if the end of the file was
+        /// reached.
+        hpx::future<buffer_type> read(
+            std::size_t size, std::uint64_t offset) const;
+
+        /// Write \a size bytes from \a data to the file starting at \a offset.
+        /// The future returns the number of bytes written.
+        hpx::future<std::size_t> write(
+            void const* data, std::size_t size, std::uint64_t offset) const;
+
+        /// Write the contents of the buffer to the file starting at
+        /// \a offset. The buffer is kept alive until the data was written.
+        hpx::future<std::size_t> write(
+            buffer_type const& data, std::uint64_t offset) const;
+
+        /// Flush the data and the metadata of the file to the storage
+        /// device.
+        hpx::future<void> fsync() const;
+
+        /// Ask the kernel to start reading the given part of the file into
+        /// the page cache in the background (POSIX_FADV_WILLNEED).
+        void prefetch(std::uint64_t offset, std::size_t size) const noexcept;
+
+    private:
+        int fd_;
+    };
+}}}    // namespace hpx::io::experimental
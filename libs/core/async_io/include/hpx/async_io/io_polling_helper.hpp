@@ -0,0 +1,63 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/async_io/detail/operation.hpp>
+#include <hpx/runtime_local/thread_pool_helpers.hpp>
+#include <hpx/threading_base/scheduler_base.hpp>
+#include <hpx/threading_base/thread_pool_base.hpp>
+
+#include <string>
+
+namespace hpx { namespace io { namespace experimental {
+    // -----------------------------------------------------------------
+    // Submit the prepared io_uring entries and process the completed ones,
+    // this is installed as a polling function of the scheduling loop
+    HPX_CORE_EXPORT hpx::threads::policies::detail::polling_status poll();
+
+    // -----------------------------------------------------------------
+    // This RAII helper class enables polling for a scoped block. While
+    // polling is enabled on any pool the file operations are submitted
+    // through io_uring (if available) and completed from the scheduling
+    // loop of the given pool, otherwise they run on the I/O pool.
+    struct [[nodiscard]] enable_user_polling
+    {
+        enable_user_polling(std::string const& pool_name = "")
+          : pool_name_(pool_name)
+        {
+            // install polling loop on requested thread pool
+            if (pool_name_.empty())
+            {
+                detail::register_polling(
+                    hpx::resource::get_polling_thread_pool());
+            }
+            else
+            {
+                detail::register_polling(
+                    hpx::resource::get_thread_pool(pool_name_));
+            }
+        }
+
+        ~enable_user_polling()
+        {
+            if (pool_name_.empty())
+            {
+                detail::unregister_polling(
+                    hpx::resource::get_polling_thread_pool());
+            }
+            else
+            {
+                detail::unregister_polling(
+                    hpx::resource::get_thread_pool(pool_name_));
+            }
+        }
+
+    private:
+        std::string pool_name_;
+    };
+}}}    // namespace hpx::io::experimental
@@ -0,0 +1,106 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file hpx/async_io/mapped_file.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/iterator_support/iterator_range.hpp>
+#include <hpx/modules/errors.hpp>
+
+#include <cstddef>
+#include <string>
+
+namespace hpx { namespace io { namespace experimental {
+
+    /// Hints given to the kernel about how a \a mapped_file will be
+    /// accessed, the values can be combined.
+    enum class map_hints : unsigned
+    {
+        none = 0x00,
+        sequential = 0x01,    ///< read ahead aggressively (MADV_SEQUENTIAL)
+        random = 0x02,        ///< don't read ahead (MADV_RANDOM)
+        huge_pages = 0x04,    ///< back the mapping by huge pages if possible
+        populate = 0x08       ///< read the whole file while mapping it
+    };
+
+    constexpr map_hints operator|(map_hints lhs, map_hints rhs) noexcept
+    {
+        return static_cast<map_hints>(
+            static_cast<unsigned>(lhs) | static_cast<unsigned>(rhs));
+    }
+
+    constexpr bool operator&(map_hints lhs, map_hints rhs) noexcept
+    {
+        return (static_cast<unsigned>(lhs) & static_cast<unsigned>(rhs)) != 0;
+    }
+
+    /// A file mapped read-only into the address space of the process. The
+    /// pages are read from the file when they are touched first, which
+    /// happens in parallel if the mapping is processed by a parallel
+    /// algorithm.
+    class HPX_CORE_EXPORT mapped_file
+    {
+    public:
+        mapped_file() noexcept;
+
+        /// Map the file with the given path.
+        ///
+        /// \param path  [in] The path of the file to map.
+        /// \param hints [in] How the mapping will be accessed.
+        /// \param ec    [in,out] this represents the error status on exit, if
+        ///              this is pre-initialized to \a hpx#throws the function
+        ///              will throw on error instead.
+        explicit mapped_file(std::string const& path,
+            map_hints hints = map_hints::sequential, error_code& ec = throws);
+
+        mapped_file(mapped_file&& rhs) noexcept;
+        mapped_file& operator=(mapped_file&& rhs) noexcept;
+
+        mapped_file(mapped_file const&) = delete;
+        mapped_file& operator=(mapped_file const&) = delete;
+
+        ~mapped_file();
+
+        bool is_open() const noexcept
+        {
+            return is_open_;
+        }
+
+        char const* data() const noexcept
+        {
+            return data_;
+        }
+
+        std::size_t size() const noexcept
+        {
+            return size_;
+        }
+
+        /// Return the contents of the file as a range of objects of type T,
+        /// trailing bytes not making up a whole object are not part of it.
+        template <typename T>
+        hpx::util::iterator_range<T const*> as_range() const noexcept
+        {
+            T const* first = reinterpret_cast<T const*>(data_);
+            return hpx::util::iterator_range<T const*>(
+                first, first + size_ / sizeof(T));
+        }
+
+        /// Ask the kernel to start reading the given part of the file in the
+        /// background (MADV_WILLNEED).
+        void prefetch(std::size_t offset, std::size_t size) const noexcept;
+
+        /// Remove the mapping.
+        void unmap() noexcept;
+
+    private:
+        char* data_;
+        std::size_t size_;
+        bool is_open_;
+    };
+}}}    // namespace hpx::io::experimental
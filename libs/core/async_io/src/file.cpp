@@ -0,0 +1,390 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/async_io/detail/operation.hpp>
+#include <hpx/async_io/file.hpp>
+#include <hpx/futures/future.hpp>
+#include <hpx/futures/traits/future_access.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/modules/memory.hpp>
+#include <hpx/serialization/serialize_buffer.hpp>
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <exception>
+#include <string>
+#include <utility>
+
+namespace hpx { namespace io { namespace experimental {
+
+    namespace detail {
+
+        std::exception_ptr make_io_exception(char const* func, int error)
+        {
+            return HPX_GET_EXCEPTION(
+                hpx::filesystem_error, func, std::strerror(error));
+        }
+
+        // -----------------------------------------------------------------
+        // The shared state of a file operation. The operation holds a
+        // reference to itself while it is in flight.
+        template <typename T>
+        struct operation_data
+          : hpx::lcos::detail::future_data<T>
+          , operation
+        {
+            HPX_NON_COPYABLE(operation_data);
+
+            using init_no_addref =
+                typename hpx::lcos::detail::future_data<T>::init_no_addref;
+
+            operation_data(operation_kind kind, int fd, char* data,
+                std::size_t size, std::uint64_t offset, char const* func)
+              : hpx::lcos::detail::future_data<T>(init_no_addref{})
+              , operation(kind, fd, data, size, offset)
+              , func_(func)
+            {
+            }
+
+            // hand the operation to the kernel and return the future of it
+            hpx::future<T> start()
+            {
+                // the reference taken on construction is owned by the
+                // operation until it finished
+                hpx::intrusive_ptr<operation_data> self(this);
+                keep_alive_ = hpx::intrusive_ptr<operation_data>(this, false);
+                submit(*this);
+
+                using traits::future_access;
+                return future_access<hpx::future<T>>::create(HPX_MOVE(self));
+            }
+
+            void finish(int error) override
+            {
+                hpx::intrusive_ptr<operation_data> self = HPX_MOVE(keep_alive_);
+                if (error != 0)
+                {
+                    this->set_exception(make_io_exception(func_, error));
+                }
+                else
+                {
+                    set_result();
+                }
+            }
+
+            virtual void set_result() = 0;
+
+            char const* func_;
+            hpx::intrusive_ptr<operation_data> keep_alive_;
+        };
+
+        struct transfer_data : operation_data<std::size_t>
+        {
+            using operation_data<std::size_t>::operation_data;
+
+            void set_result() override
+            {
+                this->set_data(transferred_);
+            }
+        };
+
+        // the buffer the data is written from is kept alive by the operation
+        struct write_buffer_data : transfer_data
+        {
+            write_buffer_data(file::buffer_type const& buffer, int fd,
+                std::uint64_t offset)
+              : transfer_data(operation_kind::write, fd,
+                    const_cast<char*>(buffer.data()), buffer.size(), offset,
+                    "hpx::io::file::write")
+              , buffer_(buffer)
+            {
+            }
+
+            file::buffer_type buffer_;
+        };
+
+        // the data is read into a newly allocated buffer, which is truncated
+        // without copying the data if the end of the file is reached
+        struct read_buffer_data : operation_data<file::buffer_type>
+        {
+            read_buffer_data(std::size_t size, int fd, std::uint64_t offset)
+              : read_buffer_data(file::buffer_type(size), fd, offset)
+            {
+            }
+
+            void set_result() override
+            {
+                if (transferred_ != buffer_.size())
+                {
+                    file::buffer_type const buffer = HPX_MOVE(buffer_);
+                    buffer_ = file::buffer_type(
+                        const_cast<char*>(buffer.data()), transferred_,
+                        file::buffer_type::reference,
+                        [buffer](char*) noexcept {});
+                }
+                this->set_data(HPX_MOVE(buffer_));
+            }
+
+            file::buffer_type buffer_;
+
+        private:
+            read_buffer_data(
+                file::buffer_type&& buffer, int fd, std::uint64_t offset)
+              : operation_data<file::buffer_type>(operation_kind::read, fd,
+                    buffer.data(), buffer.size(), offset,
+                    "hpx::io::file::read")
+              , buffer_(HPX_MOVE(buffer))
+            {
+            }
+        };
+
+        struct fsync_data : operation_data<void>
+        {
+            explicit fsync_data(int fd)
+              : operation_data<void>(operation_kind::fsync, fd, nullptr, 0, 0,
+                    "hpx::io::file::fsync")
+            {
+            }
+
+            void set_result() override
+            {
+                this->set_data(hpx::util::unused);
+            }
+        };
+
+        // -----------------------------------------------------------------
+        bool operation::advance(std::int64_t res)
+        {
+            if (res == -EINTR || res == -EAGAIN)
+            {
+                return true;
+            }
+
+            if (res < 0)
+            {
+                finish(int(-res));
+                return false;
+            }
+
+            // a read returning no data has reached the end of the file
+            transferred_ += std::size_t(res);
+            if (kind_ == operation_kind::fsync || res == 0 ||
+                transferred_ == size_)
+            {
+                if (kind_ == operation_kind::write && transferred_ != size_)
+                {
+                    finish(EIO);
+                }
+                else
+                {
+                    finish(0);
+                }
+                return false;
+            }
+            return true;
+        }
+
+        void operation::run_blocking()
+        {
+            for (;;)
+            {
+                std::int64_t res = 0;
+                switch (kind_)
+                {
+                case operation_kind::read:
+                    res = ::pread(fd_, data_ + transferred_,
+                        size_ - transferred_, off_t(offset_ + transferred_));
+                    break;
+
+                case operation_kind::write:
+                    res = ::pwrite(fd_, data_ + transferred_,
+                        size_ - transferred_, off_t(offset_ + transferred_));
+                    break;
+
+                case operation_kind::fsync:
+                    res = ::fsync(fd_);
+                    break;
+                }
+
+                if (!advance(res < 0 ? -std::int64_t(errno) : res))
+                {
+                    return;
+                }
+            }
+        }
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    file::file() noexcept
+      : fd_(-1)
+    {
+    }
+
+    file::file(std::string const& path, open_mode mode, error_code& ec)
+      : fd_(-1)
+    {
+        int flags = O_CLOEXEC;
+        if ((mode & open_mode::read) && (mode & open_mode::write))
+        {
+            flags |= O_RDWR;
+        }
+        else if (mode & open_mode::write)
+        {
+            flags |= O_WRONLY;
+        }
+        else
+        {
+            flags |= O_RDONLY;
+        }
+
+        if (mode & open_mode::create)
+        {
+            flags |= O_CREAT;
+        }
+        if (mode & open_mode::truncate)
+        {
+            flags |= O_TRUNC;
+        }
+
+        do
+        {
+            fd_ = ::open(path.c_str(), flags, 0666);
+        } while (fd_ == -1 && errno == EINTR);
+
+        if (fd_ == -1)
+        {
+            HPX_THROWS_IF(ec, hpx::filesystem_error, "hpx::io::file::file",
+                "could not open {}: {}", path, std::strerror(errno));
+            return;
+        }
+
+        if (&ec != &throws)
+        {
+            ec = make_success_code();
+        }
+    }
+
+    file::file(int fd) noexcept
+      : fd_(fd)
+    {
+    }
+
+    file::file(file&& rhs) noexcept
+      : fd_(rhs.fd_)
+    {
+        rhs.fd_ = -1;
+    }
+
+    file& file::operator=(file&& rhs) noexcept
+    {
+        if (this != &rhs)
+        {
+            error_code ec(throwmode::lightweight);
+            close(ec);
+            fd_ = rhs.fd_;
+            rhs.fd_ = -1;
+        }
+        return *this;
+    }
+
+    file::~file()
+    {
+        error_code ec(throwmode::lightweight);
+        close(ec);
+    }
+
+    void file::close(error_code& ec)
+    {
+        if (fd_ != -1)
+        {
+            int const fd = fd_;
+            fd_ = -1;
+            if (::close(fd) != 0 && errno != EINTR)
+            {
+                HPX_THROWS_IF(ec, hpx::filesystem_error,
+                    "hpx::io::file::close", "could not close file: {}",
+                    std::strerror(errno));
+                return;
+            }
+        }
+
+        if (&ec != &throws)
+        {
+            ec = make_success_code();
+        }
+    }
+
+    std::uint64_t file::size(error_code& ec) const
+    {
+        struct stat st;
+        if (::fstat(fd_, &st) != 0)
+        {
+            HPX_THROWS_IF(ec, hpx::filesystem_error, "hpx::io::file::size",
+                "could not determine the file size: {}", std::strerror(errno));
+            return 0;
+        }
+
+        if (&ec != &throws)
+        {
+            ec = make_success_code();
+        }
+        return std::uint64_t(st.st_size);
+    }
+
+    hpx::future<std::size_t> file::read(
+        void* data, std::size_t size, std::uint64_t offset) const
+    {
+        return (new detail::transfer_data(detail::operation_kind::read, fd_,
+                    static_cast<char*>(data), size, offset,
+                    "hpx::io::file::read"))
+            ->start();
+    }
+
+    hpx::future<file::buffer_type> file::read(
+        std::size_t size, std::uint64_t offset) const
+    {
+        return (new detail::read_buffer_data(size, fd_, offset))->start();
+    }
+
+    hpx::future<std::size_t> file::write(
+        void const* data, std::size_t size, std::uint64_t offset) const
+    {
+        return (new detail::transfer_data(detail::operation_kind::write, fd_,
+                    static_cast<char*>(const_cast<void*>(data)), size, offset,
+                    "hpx::io::file::write"))
+            ->start();
+    }
+
+    hpx::future<std::size_t> file::write(
+        buffer_type const& data, std::uint64_t offset) const
+    {
+        return (new detail::write_buffer_data(data, fd_, offset))->start();
+    }
+
+    hpx::future<void> file::fsync() const
+    {
+        return (new detail::fsync_data(fd_))->start();
+    }
+
+    void file::prefetch(std::uint64_t offset, std::size_t size) const noexcept
+    {
+#if defined(POSIX_FADV_WILLNEED)
+        // this is a hint only, errors are ignored
+        ::posix_fadvise(fd_, off_t(offset), off_t(size), POSIX_FADV_WILLNEED);
+#else
+        HPX_UNUSED(offset);
+        HPX_UNUSED(size);
+#endif
+    }
+}}}    // namespace hpx::io::experimental
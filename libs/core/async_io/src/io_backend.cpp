@@ -0,0 +1,289 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/async_io/detail/operation.hpp>
+#include <hpx/async_io/io_polling_helper.hpp>
+#include <hpx/modules/execution.hpp>
+#include <hpx/modules/threading_base.hpp>
+#include <hpx/runtime_local/service_executors.hpp>
+
+#if defined(HPX_HAVE_ASYNC_IO_URING)
+#include <hpx/modules/synchronization.hpp>
+#include <hpx/runtime_local/config_entry.hpp>
+#include <hpx/util/from_string.hpp>
+
+#include <liburing.h>
+
+#include <algorithm>
+#include <mutex>
+#include <string>
+#endif
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace hpx { namespace io { namespace experimental {
+
+    namespace detail {
+
+        // the number of thread pools polling for completions
+        std::atomic<std::size_t>& get_register_polling_count()
+        {
+            static std::atomic<std::size_t> register_polling_count{0};
+            return register_polling_count;
+        }
+
+        // the number of operations submitted through io_uring which have not
+        // completed yet
+        std::atomic<std::size_t>& get_outstanding_count()
+        {
+            static std::atomic<std::size_t> outstanding_count{0};
+            return outstanding_count;
+        }
+
+#if defined(HPX_HAVE_ASYNC_IO_URING)
+        // maximal number of bytes transferred by a single operation, larger
+        // transfers are split
+        constexpr std::size_t max_transfer_size = std::size_t(1) << 30;
+
+        // maximal number of completion queue entries handled at once
+        constexpr unsigned max_completion_batch = 64;
+
+        // -----------------------------------------------------------------
+        // The io_uring instance shared by all files. Operations are prepared
+        // by the submitting threads, handed to the kernel in one batch by
+        // the next invocation of the polling function, and completed from
+        // there.
+        class ring
+        {
+        public:
+            explicit ring(unsigned entries)
+              : num_prepared_(0)
+              , valid_(io_uring_queue_init(entries, &ring_, 0) == 0)
+            {
+            }
+
+            ~ring()
+            {
+                if (valid_)
+                {
+                    io_uring_queue_exit(&ring_);
+                }
+            }
+
+            ring(ring const&) = delete;
+            ring& operator=(ring const&) = delete;
+
+            // io_uring may not be supported by the kernel or be blocked by a
+            // seccomp filter
+            bool valid() const noexcept
+            {
+                return valid_;
+            }
+
+            // returns false if the submission queue is full
+            bool prepare(operation& op)
+            {
+                std::lock_guard<hpx::spinlock> l(submission_mtx_);
+
+                io_uring_sqe* sqe = io_uring_get_sqe(&ring_);
+                if (sqe == nullptr)
+                {
+                    // make room by handing the prepared entries to the kernel
+                    io_uring_submit(&ring_);
+                    num_prepared_ = 0;
+
+                    sqe = io_uring_get_sqe(&ring_);
+                    if (sqe == nullptr)
+                    {
+                        return false;
+                    }
+                }
+
+                unsigned const size = unsigned((std::min)(
+                    op.size_ - op.transferred_, max_transfer_size));
+                switch (op.kind_)
+                {
+                case operation_kind::read:
+                    io_uring_prep_read(sqe, op.fd_, op.data_ + op.transferred_,
+                        size, op.offset_ + op.transferred_);
+                    break;
+
+                case operation_kind::write:
+                    io_uring_prep_write(sqe, op.fd_,
+                        op.data_ + op.transferred_, size,
+                        op.offset_ + op.transferred_);
+                    break;
+
+                case operation_kind::fsync:
+                    io_uring_prep_fsync(sqe, op.fd_, 0);
+                    break;
+                }
+                io_uring_sqe_set_data(sqe, &op);
+
+                ++num_prepared_;
+                ++get_outstanding_count();
+                return true;
+            }
+
+            void submit()
+            {
+                std::unique_lock<hpx::spinlock> l(
+                    submission_mtx_, std::try_to_lock);
+                if (l.owns_lock() && num_prepared_ != 0)
+                {
+                    num_prepared_ = 0;
+                    io_uring_submit(&ring_);
+                }
+            }
+
+            void poll()
+            {
+                // the completion queue is consumed by one thread at a time
+                std::unique_lock<hpx::spinlock> l(
+                    completion_mtx_, std::try_to_lock);
+                if (!l.owns_lock())
+                {
+                    return;
+                }
+
+                io_uring_cqe* cqes[max_completion_batch];
+                while (unsigned const count = io_uring_peek_batch_cqe(
+                           &ring_, cqes, max_completion_batch))
+                {
+                    for (unsigned i = 0; i != count; ++i)
+                    {
+                        auto* op = static_cast<operation*>(
+                            io_uring_cqe_get_data(cqes[i]));
+                        std::int32_t const res = cqes[i]->res;
+
+                        --get_outstanding_count();
+
+                        // this may destroy the operation object
+                        if (op->advance(res))
+                        {
+                            detail::submit(*op);
+                        }
+                    }
+                    io_uring_cq_advance(&ring_, count);
+                }
+            }
+
+        private:
+            ::io_uring ring_;
+
+            hpx::spinlock submission_mtx_;
+            std::size_t num_prepared_;
+
+            hpx::spinlock completion_mtx_;
+
+            bool valid_;
+        };
+
+        ring* create_ring()
+        {
+            if (hpx::get_config_entry("hpx.io.io_uring", "1") == "0")
+            {
+                return nullptr;
+            }
+
+            static ring r(hpx::util::from_string<unsigned>(
+                hpx::get_config_entry("hpx.io.entries", "256"), 256));
+            return r.valid() ? &r : nullptr;
+        }
+
+        ring* get_ring()
+        {
+            static ring* r = create_ring();
+            return r;
+        }
+#endif
+
+        // -----------------------------------------------------------------
+        void submit(operation& op)
+        {
+#if defined(HPX_HAVE_ASYNC_IO_URING)
+            // the completions are processed by the polling function only
+            if (get_register_polling_count() != 0)
+            {
+                ring* r = get_ring();
+                if (r != nullptr && r->prepare(op))
+                {
+                    return;
+                }
+            }
+#endif
+
+#if defined(HPX_HAVE_IO_POOL)
+            // run the blocking system calls on the I/O pool
+            hpx::parallel::execution::io_pool_executor exec;
+            hpx::parallel::execution::post(
+                exec, [&op]() { op.run_blocking(); });
+#else
+            op.run_blocking();
+#endif
+        }
+
+        std::size_t get_work_count()
+        {
+            return get_outstanding_count().load(std::memory_order_relaxed);
+        }
+
+        // -----------------------------------------------------------------
+        void register_polling(hpx::threads::thread_pool_base& pool)
+        {
+            ++get_register_polling_count();
+
+            auto* sched = pool.get_scheduler();
+            sched->set_io_polling_functions(
+                &hpx::io::experimental::poll, &get_work_count);
+        }
+
+        void unregister_polling(hpx::threads::thread_pool_base& pool)
+        {
+            HPX_ASSERT_MSG(get_register_polling_count() != 1 ||
+                    get_outstanding_count() == 0,
+                "file I/O polling was disabled while there are outstanding "
+                "file operations. Make sure file I/O polling is not disabled "
+                "too early.");
+
+            --get_register_polling_count();
+
+            auto* sched = pool.get_scheduler();
+            sched->clear_io_polling_function();
+        }
+    }    // namespace detail
+
+    // -----------------------------------------------------------------
+    hpx::threads::policies::detail::polling_status poll()
+    {
+        using hpx::threads::policies::detail::polling_status;
+
+#if defined(HPX_HAVE_ASYNC_IO_URING)
+        if (detail::get_outstanding_count().load(std::memory_order_relaxed) ==
+            0)
+        {
+            return polling_status::idle;
+        }
+
+        detail::ring* r = detail::get_ring();
+        HPX_ASSERT(r != nullptr);
+
+        r->submit();
+        r->poll();
+
+        return detail::get_outstanding_count().load(
+                   std::memory_order_relaxed) == 0 ?
+            polling_status::idle :
+            polling_status::busy;
+#else
+        return polling_status::idle;
+#endif
+    }
+}}}    // namespace hpx::io::experimental
@@ -0,0 +1,172 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/async_io/mapped_file.hpp>
+#include <hpx/modules/errors.hpp>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+namespace hpx { namespace io { namespace experimental {
+
+    mapped_file::mapped_file() noexcept
+      : data_(nullptr)
+      , size_(0)
+      , is_open_(false)
+    {
+    }
+
+    mapped_file::mapped_file(
+        std::string const& path, map_hints hints, error_code& ec)
+      : data_(nullptr)
+      , size_(0)
+      , is_open_(false)
+    {
+        int fd = -1;
+        do
+        {
+            fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        } while (fd == -1 && errno == EINTR);
+
+        if (fd == -1)
+        {
+            HPX_THROWS_IF(ec, hpx::filesystem_error,
+                "hpx::io::mapped_file::mapped_file", "could not open {}: {}",
+                path, std::strerror(errno));
+            return;
+        }
+
+        struct stat st;
+        if (::fstat(fd, &st) != 0)
+        {
+            int const error = errno;
+            ::close(fd);
+            HPX_THROWS_IF(ec, hpx::filesystem_error,
+                "hpx::io::mapped_file::mapped_file",
+                "could not determine the size of {}: {}", path,
+                std::strerror(error));
+            return;
+        }
+
+        // empty files can't be mapped
+        size_ = std::size_t(st.st_size);
+        if (size_ != 0)
+        {
+            int flags = MAP_PRIVATE;
+#if defined(MAP_POPULATE)
+            if (hints & map_hints::populate)
+            {
+                flags |= MAP_POPULATE;
+            }
+#endif
+            void* p = ::mmap(nullptr, size_, PROT_READ, flags, fd, 0);
+            if (p == MAP_FAILED)
+            {
+                int const error = errno;
+                ::close(fd);
+                size_ = 0;
+                HPX_THROWS_IF(ec, hpx::filesystem_error,
+                    "hpx::io::mapped_file::mapped_file",
+                    "could not map {}: {}", path, std::strerror(error));
+                return;
+            }
+            data_ = static_cast<char*>(p);
+
+            // the hints are advisory only, errors are ignored
+            if (hints & map_hints::sequential)
+            {
+                ::madvise(data_, size_, MADV_SEQUENTIAL);
+            }
+            else if (hints & map_hints::random)
+            {
+                ::madvise(data_, size_, MADV_RANDOM);
+            }
+#if defined(MADV_HUGEPAGE)
+            if (hints & map_hints::huge_pages)
+            {
+                ::madvise(data_, size_, MADV_HUGEPAGE);
+            }
+#endif
+        }
+
+        // the mapping stays valid after the file has been closed
+        ::close(fd);
+        is_open_ = true;
+
+        if (&ec != &throws)
+        {
+            ec = make_success_code();
+        }
+    }
+
+    mapped_file::mapped_file(mapped_file&& rhs) noexcept
+      : data_(rhs.data_)
+      , size_(rhs.size_)
+      , is_open_(rhs.is_open_)
+    {
+        rhs.data_ = nullptr;
+        rhs.size_ = 0;
+        rhs.is_open_ = false;
+    }
+
+    mapped_file& mapped_file::operator=(mapped_file&& rhs) noexcept
+    {
+        if (this != &rhs)
+        {
+            unmap();
+            data_ = rhs.data_;
+            size_ = rhs.size_;
+            is_open_ = rhs.is_open_;
+            rhs.data_ = nullptr;
+            rhs.size_ = 0;
+            rhs.is_open_ = false;
+        }
+        return *this;
+    }
+
+    mapped_file::~mapped_file()
+    {
+        unmap();
+    }
+
+    void mapped_file::prefetch(std::size_t offset, std::size_t size) const
+        noexcept
+    {
+        if (offset >= size_ || size == 0)
+        {
+            return;
+        }
+
+        // madvise requires the address to be aligned to a page boundary
+        static std::size_t const page_size =
+            std::size_t(::sysconf(_SC_PAGESIZE));
+        std::size_t const first = offset - offset % page_size;
+        std::size_t const last = (std::min)(offset + size, size_);
+
+        ::madvise(data_ + first, last - first, MADV_WILLNEED);
+    }
+
+    void mapped_file::unmap() noexcept
+    {
+        if (data_ != nullptr)
+        {
+            ::munmap(data_, size_);
+        }
+        data_ = nullptr;
+        size_ = 0;
+        is_open_ = false;
+    }
+}}}    // namespace hpx::io::experimental
@@ -0,0 +1,116 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify that parallel algorithms process all elements of a file split into
+// blocks, both for mapped and for streamed files.
+
+#include <hpx/local/execution.hpp>
+#include <hpx/local/init.hpp>
+#include <hpx/local/numeric.hpp>
+#include <hpx/modules/async_io.hpp>
+#include <hpx/modules/filesystem.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <numeric>
+#include <string>
+#include <vector>
+
+namespace io = hpx::io::experimental;
+
+// the last block is shorter than the others
+std::size_t const num_elements = 1000003;
+std::size_t const block_size = 4096;
+
+///////////////////////////////////////////////////////////////////////////////
+void write_file(std::string const& path)
+{
+    std::vector<std::uint64_t> data(num_elements);
+    std::iota(data.begin(), data.end(), std::uint64_t(0));
+
+    io::file f(path,
+        io::open_mode::write | io::open_mode::create | io::open_mode::truncate);
+    HPX_TEST_EQ(
+        f.write(data.data(), data.size() * sizeof(std::uint64_t), 0).get(),
+        data.size() * sizeof(std::uint64_t));
+}
+
+template <typename Range>
+void test_transform_reduce(Range const& blocks)
+{
+    using block_type = typename Range::block_type;
+
+    HPX_TEST_EQ(blocks.size(), (num_elements + block_size - 1) / block_size);
+
+    std::uint64_t const sum = hpx::transform_reduce(hpx::execution::par,
+        blocks.begin(), blocks.end(), std::uint64_t(0), std::plus<>(),
+        [](block_type block) {
+            return std::accumulate(
+                block.begin(), block.end(), std::uint64_t(0));
+        });
+    HPX_TEST_EQ(sum, std::uint64_t(num_elements) * (num_elements - 1) / 2);
+
+    // random access to the blocks
+    block_type last = blocks[blocks.size() - 1];
+    HPX_TEST_EQ(std::size_t(last.end() - last.begin()),
+        num_elements % block_size);
+    HPX_TEST_EQ(*last.begin(),
+        std::uint64_t(num_elements - num_elements % block_size));
+
+    auto it = blocks.begin() + 7;
+    HPX_TEST_EQ(it - blocks.begin(), 7);
+    HPX_TEST_EQ(*(*it).begin(), std::uint64_t(7 * block_size));
+}
+
+void test_mapped_file(std::string const& path)
+{
+    io::mapped_file f(path, io::map_hints::sequential);
+    HPX_TEST(f.is_open());
+    HPX_TEST_EQ(f.size(), num_elements * sizeof(std::uint64_t));
+
+    auto const elements = f.as_range<std::uint64_t>();
+    HPX_TEST_EQ(std::size_t(elements.end() - elements.begin()), num_elements);
+
+    test_transform_reduce(io::make_block_range<std::uint64_t>(f, block_size));
+    test_transform_reduce(
+        io::make_block_range<std::uint64_t>(f, block_size, 0));
+}
+
+void test_streamed_file(std::string const& path)
+{
+    io::file f(path);
+    test_transform_reduce(
+        io::make_block_range<std::uint64_t>(f, block_size, 2));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    hpx::filesystem::path const path =
+        hpx::filesystem::temp_directory_path() / "hpx_async_io_block_range.dat";
+
+    write_file(path.string());
+
+    test_mapped_file(path.string());
+
+    test_streamed_file(path.string());
+    {
+        io::enable_user_polling poll;
+        test_streamed_file(path.string());
+    }
+
+    hpx::filesystem::remove(path);
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ(hpx::local::init(hpx_main, argc, argv), 0);
+    return hpx::util::report_errors();
+}
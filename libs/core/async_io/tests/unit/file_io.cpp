@@ -0,0 +1,129 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify that the asynchronous file operations read back the data written
+// before, both with and without polling enabled.
+
+#include <hpx/local/future.hpp>
+#include <hpx/local/init.hpp>
+#include <hpx/modules/async_io.hpp>
+#include <hpx/modules/filesystem.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace io = hpx::io::experimental;
+
+std::size_t const chunk_size = 65536;
+std::size_t const num_chunks = 16;
+
+///////////////////////////////////////////////////////////////////////////////
+void test_file_io(std::string const& path)
+{
+    {
+        io::file f(path,
+            io::open_mode::read_write | io::open_mode::create |
+                io::open_mode::truncate);
+        HPX_TEST(f.is_open());
+
+        // write all chunks concurrently
+        std::vector<std::vector<char>> chunks(num_chunks);
+        std::vector<hpx::future<std::size_t>> writes;
+        for (std::size_t i = 0; i != num_chunks; ++i)
+        {
+            chunks[i].assign(chunk_size, char('a' + i));
+            writes.push_back(f.write(
+                chunks[i].data(), chunk_size, std::uint64_t(i * chunk_size)));
+        }
+        for (auto& w : writes)
+        {
+            HPX_TEST_EQ(w.get(), chunk_size);
+        }
+
+        f.fsync().get();
+        HPX_TEST_EQ(f.size(), std::uint64_t(num_chunks * chunk_size));
+
+        // read back into a user supplied buffer
+        std::vector<char> data(chunk_size);
+        HPX_TEST_EQ(f.read(data.data(), chunk_size, 3 * chunk_size).get(),
+            chunk_size);
+        HPX_TEST(data == chunks[3]);
+
+        // overwrite a chunk from a serialize_buffer
+        io::file::buffer_type buffer(chunk_size);
+        std::fill(buffer.data(), buffer.data() + chunk_size, 'z');
+        HPX_TEST_EQ(f.write(buffer, 5 * chunk_size).get(), chunk_size);
+    }
+
+    {
+        io::file f(path);
+
+        // reads stop at the end of the file
+        std::size_t const offset = (num_chunks - 1) * chunk_size;
+        io::file::buffer_type buffer = f.read(2 * chunk_size, offset).get();
+        HPX_TEST_EQ(buffer.size(), chunk_size);
+        for (std::size_t i = 0; i != buffer.size(); ++i)
+        {
+            HPX_TEST_EQ(buffer[i], char('a' + num_chunks - 1));
+        }
+
+        buffer = f.read(chunk_size, 5 * chunk_size).get();
+        HPX_TEST_EQ(buffer.size(), chunk_size);
+        HPX_TEST_EQ(buffer[0], 'z');
+        HPX_TEST_EQ(buffer[chunk_size - 1], 'z');
+
+        buffer = f.read(chunk_size, 2 * num_chunks * chunk_size).get();
+        HPX_TEST_EQ(buffer.size(), std::size_t(0));
+
+        // writing to a file opened for reading only fails
+        std::vector<char> data(16, 'x');
+        bool caught_exception = false;
+        try
+        {
+            f.write(data.data(), data.size(), 0).get();
+        }
+        catch (hpx::exception const& e)
+        {
+            HPX_TEST_EQ(e.get_error(), hpx::filesystem_error);
+            caught_exception = true;
+        }
+        HPX_TEST(caught_exception);
+    }
+
+    hpx::error_code ec(hpx::throwmode::lightweight);
+    io::file f(path + ".does-not-exist", io::open_mode::read, ec);
+    HPX_TEST(ec);
+    HPX_TEST(!f.is_open());
+
+    hpx::filesystem::remove(path);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    hpx::filesystem::path const path =
+        hpx::filesystem::temp_directory_path() / "hpx_async_io_file_io.dat";
+
+    // without polling all operations run on the I/O pool
+    test_file_io(path.string());
+
+    {
+        io::enable_user_polling poll;
+        test_file_io(path.string());
+    }
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ(hpx::local::init(hpx_main, argc, argv), 0);
+    return hpx::util::report_errors();
+}
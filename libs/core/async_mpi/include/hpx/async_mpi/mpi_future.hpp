@@ -15,6 +15,7 @@
 #include <hpx/modules/memory.hpp>
 #include <hpx/modules/threading_base.hpp>
 #include <hpx/mpi_base/mpi.hpp>
+#include <hpx/mpi_base/mpi_request_poller.hpp>
 #include <hpx/runtime_local/thread_pool_helpers.hpp>
 
 #include <atomic>
@@ -138,19 +139,9 @@ namespace hpx { namespace mpi { namespace experimental {
         HPX_CORE_EXPORT void hpx_MPI_Handler(MPI_Comm*, int* errorcode, ...);
 
         // -----------------------------------------------------------------
-        // we track requests and callbacks in two vectors even though
-        // we have the request stored in the request_callback vector already
-        // the reason for this is because we can use MPI_Testany
-        // with a vector of requests to save overheads compared
-        // to testing one by one every item (using a list)
-        HPX_CORE_EXPORT std::vector<MPI_Request>& get_requests_vector();
-
-        // -----------------------------------------------------------------
-        // define a lockfree queue type to place requests in prior to handling
-        // this is done only to avoid taking a lock every time a request is
-        // returned from MPI. Instead the requests are placed into a queue
-        // and the polling code pops them prior to calling Testany
-        using queue_type = concurrency::ConcurrentQueue<future_data_ptr>;
+        // the requests and their callbacks are tracked by a request poller
+        // which tests all of them using a single call to MPI_Testsome
+        HPX_CORE_EXPORT hpx::util::mpi_request_poller& get_request_poller();
 
         // -----------------------------------------------------------------
         // used internally to query how many requests are 'in flight'
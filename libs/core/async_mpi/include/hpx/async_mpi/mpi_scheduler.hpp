@@ -0,0 +1,286 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file hpx/async_mpi/mpi_scheduler.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/async_mpi/mpi_exception.hpp>
+#include <hpx/async_mpi/mpi_future.hpp>
+#include <hpx/concepts/concepts.hpp>
+#include <hpx/datastructures/tuple.hpp>
+#include <hpx/errors/try_catch_exception_ptr.hpp>
+#include <hpx/execution_base/completion_scheduler.hpp>
+#include <hpx/execution_base/completion_signatures.hpp>
+#include <hpx/execution_base/operation_state.hpp>
+#include <hpx/execution_base/receiver.hpp>
+#include <hpx/execution_base/sender.hpp>
+#include <hpx/functional/detail/tag_fallback_invoke.hpp>
+#include <hpx/functional/invoke.hpp>
+#include <hpx/functional/traits/is_invocable.hpp>
+#include <hpx/mpi_base/mpi.hpp>
+#include <hpx/type_support/pack.hpp>
+
+#include <exception>
+#include <type_traits>
+#include <utility>
+
+namespace hpx { namespace mpi { namespace experimental {
+
+    // A scheduler representing the MPI request polling of the thread pools
+    // which have MPI polling enabled (see enable_user_polling). Senders
+    // completing on an mpi_scheduler complete on the thread running the
+    // polling, right after MPI_Testsome has found their request completed.
+    // Continuations attached to them should be short or transfer to another
+    // scheduler, they delay the progress of all other requests.
+    struct mpi_scheduler
+    {
+        constexpr mpi_scheduler() = default;
+
+        /// \cond NOINTERNAL
+        constexpr bool operator==(mpi_scheduler const&) const noexcept
+        {
+            return true;
+        }
+
+        constexpr bool operator!=(mpi_scheduler const&) const noexcept
+        {
+            return false;
+        }
+        /// \endcond
+
+    private:
+        /// \cond NOINTERNAL
+        template <typename Receiver>
+        struct operation_state
+        {
+            HPX_NO_UNIQUE_ADDRESS std::decay_t<Receiver> receiver;
+
+            friend void tag_invoke(hpx::execution::experimental::start_t,
+                operation_state& os) noexcept
+            {
+                // nothing has to be waited for before a request is started
+                hpx::execution::experimental::set_value(HPX_MOVE(os.receiver));
+            }
+        };
+
+        struct sender
+        {
+            template <typename Env>
+            struct generate_completion_signatures
+            {
+                template <template <typename...> typename Tuple,
+                    template <typename...> typename Variant>
+                using value_types = Variant<Tuple<>>;
+
+                template <template <typename...> typename Variant>
+                using error_types = Variant<std::exception_ptr>;
+
+                static constexpr bool sends_stopped = false;
+            };
+
+            template <typename Env>
+            friend auto tag_invoke(
+                hpx::execution::experimental::get_completion_signatures_t,
+                sender const&, Env) noexcept
+                -> generate_completion_signatures<Env>;
+
+            template <typename Receiver>
+            friend operation_state<Receiver> tag_invoke(
+                hpx::execution::experimental::connect_t, sender const&,
+                Receiver&& receiver)
+            {
+                return {HPX_FORWARD(Receiver, receiver)};
+            }
+
+            template <typename CPO,
+                HPX_CONCEPT_REQUIRES_(std::is_same_v<CPO,
+                    hpx::execution::experimental::set_value_t>)>
+            friend constexpr mpi_scheduler tag_invoke(
+                hpx::execution::experimental::get_completion_scheduler_t<CPO>,
+                sender const&) noexcept
+            {
+                return {};
+            }
+        };
+
+        friend constexpr sender tag_invoke(
+            hpx::execution::experimental::schedule_t,
+            mpi_scheduler const&) noexcept
+        {
+            return {};
+        }
+        /// \endcond
+    };
+
+    namespace detail {
+        ///////////////////////////////////////////////////////////////////////
+        // The operation state of a request started by start_mpi. The request
+        // is started when the operation state is started, the receiver is
+        // completed by the request poller. The callback registered with the
+        // poller only holds a pointer to the operation state, no shared state
+        // is allocated. The arguments are kept alive by the operation state
+        // until the request has completed.
+        template <typename Receiver, typename F, typename... Ts>
+        struct start_mpi_operation_state
+        {
+            HPX_NO_UNIQUE_ADDRESS std::decay_t<Receiver> receiver;
+            HPX_NO_UNIQUE_ADDRESS std::decay_t<F> f;
+            hpx::tuple<Ts...> ts;
+            MPI_Request request = MPI_REQUEST_NULL;
+
+            template <typename Receiver_, typename F_, typename Tuple>
+            start_mpi_operation_state(Receiver_&& receiver, F_&& f, Tuple&& ts)
+              : receiver(HPX_FORWARD(Receiver_, receiver))
+              , f(HPX_FORWARD(F_, f))
+              , ts(HPX_FORWARD(Tuple, ts))
+            {
+            }
+
+            // the address of the operation state is registered with the
+            // request poller
+            start_mpi_operation_state(start_mpi_operation_state&&) = delete;
+            start_mpi_operation_state& operator=(
+                start_mpi_operation_state&&) = delete;
+            start_mpi_operation_state(
+                start_mpi_operation_state const&) = delete;
+            start_mpi_operation_state& operator=(
+                start_mpi_operation_state const&) = delete;
+
+            void set_status(int status) noexcept
+            {
+                if (status == MPI_SUCCESS)
+                {
+                    hpx::execution::experimental::set_value(
+                        HPX_MOVE(receiver));
+                }
+                else
+                {
+                    hpx::execution::experimental::set_error(HPX_MOVE(receiver),
+                        std::make_exception_ptr(mpi_exception(status)));
+                }
+            }
+
+            template <std::size_t... Is>
+            int invoke(hpx::util::index_pack<Is...>)
+            {
+                if constexpr (std::is_void_v<hpx::util::invoke_result_t<F&,
+                                  Ts&..., MPI_Request*>>)
+                {
+                    HPX_INVOKE(f, hpx::get<Is>(ts)..., &request);
+                    return MPI_SUCCESS;
+                }
+                else
+                {
+                    return static_cast<int>(
+                        HPX_INVOKE(f, hpx::get<Is>(ts)..., &request));
+                }
+            }
+
+            friend void tag_invoke(hpx::execution::experimental::start_t,
+                start_mpi_operation_state& os) noexcept
+            {
+                hpx::detail::try_catch_exception_ptr(
+                    [&]() {
+                        int const status = os.invoke(
+                            hpx::util::make_index_pack_t<sizeof...(Ts)>{});
+                        if (status != MPI_SUCCESS)
+                        {
+                            os.set_status(status);
+                            return;
+                        }
+
+                        detail::add_request_callback(
+                            [p = &os](int status) { p->set_status(status); },
+                            os.request);
+                    },
+                    [&](std::exception_ptr ep) {
+                        hpx::execution::experimental::set_error(
+                            HPX_MOVE(os.receiver), HPX_MOVE(ep));
+                    });
+            }
+        };
+
+        template <typename F, typename... Ts>
+        struct start_mpi_sender
+        {
+            HPX_NO_UNIQUE_ADDRESS std::decay_t<F> f;
+            hpx::tuple<std::decay_t<Ts>...> ts;
+
+            template <typename Env>
+            struct generate_completion_signatures
+            {
+                template <template <typename...> typename Tuple,
+                    template <typename...> typename Variant>
+                using value_types = Variant<Tuple<>>;
+
+                template <template <typename...> typename Variant>
+                using error_types = Variant<std::exception_ptr>;
+
+                static constexpr bool sends_stopped = false;
+            };
+
+            template <typename Env>
+            friend auto tag_invoke(
+                hpx::execution::experimental::get_completion_signatures_t,
+                start_mpi_sender const&, Env) noexcept
+                -> generate_completion_signatures<Env>;
+
+            template <typename Receiver>
+            friend auto tag_invoke(hpx::execution::experimental::connect_t,
+                start_mpi_sender&& s, Receiver&& receiver)
+            {
+                return start_mpi_operation_state<Receiver, F,
+                    std::decay_t<Ts>...>(HPX_FORWARD(Receiver, receiver),
+                    HPX_MOVE(s.f), HPX_MOVE(s.ts));
+            }
+
+            template <typename Receiver>
+            friend auto tag_invoke(hpx::execution::experimental::connect_t,
+                start_mpi_sender& s, Receiver&& receiver)
+            {
+                return start_mpi_operation_state<Receiver, F,
+                    std::decay_t<Ts>...>(
+                    HPX_FORWARD(Receiver, receiver), s.f, s.ts);
+            }
+
+            template <typename CPO,
+                HPX_CONCEPT_REQUIRES_(std::is_same_v<CPO,
+                    hpx::execution::experimental::set_value_t>)>
+            friend constexpr mpi_scheduler tag_invoke(
+                hpx::execution::experimental::get_completion_scheduler_t<CPO>,
+                start_mpi_sender const&) noexcept
+            {
+                return {};
+            }
+        };
+    }    // namespace detail
+
+    // start_mpi returns a sender calling f(ts..., &request) once it is
+    // started, f is typically the pointer to a non-blocking MPI function
+    // like MPI_Isend, MPI_Irecv or MPI_Iallreduce. The sender completes on
+    // the mpi_scheduler once the request has completed, with set_error if
+    // either f or the request has failed. Unlike transform_mpi, no future is
+    // created for the request.
+    inline constexpr struct start_mpi_t final
+      : hpx::functional::detail::tag_fallback<start_mpi_t>
+    {
+    private:
+        // clang-format off
+        template <typename F, typename... Ts,
+            HPX_CONCEPT_REQUIRES_(
+                hpx::is_invocable_v<F&, std::decay_t<Ts>&..., MPI_Request*>
+            )>
+        // clang-format on
+        friend constexpr HPX_FORCEINLINE auto tag_fallback_invoke(
+            start_mpi_t, F&& f, Ts&&... ts)
+        {
+            return detail::start_mpi_sender<F, Ts...>{HPX_FORWARD(F, f),
+                hpx::tuple<std::decay_t<Ts>...>(HPX_FORWARD(Ts, ts)...)};
+        }
+    } start_mpi{};
+}}}    // namespace hpx::mpi::experimental
@@ -11,6 +11,7 @@
 #include <hpx/modules/errors.hpp>
 #include <hpx/modules/threading_base.hpp>
 #include <hpx/mpi_base/mpi_environment.hpp>
+#include <hpx/mpi_base/mpi_request_poller.hpp>
 #include <hpx/synchronization/mutex.hpp>
 
 #include <atomic>
@@ -28,82 +29,27 @@ namespace hpx { namespace mpi { namespace experimental {
 
     namespace detail {
 
-        // Holds an MPI_Request and a callback. The callback is intended to be
-        // called when the operation tight to the request handle is finished.
-        struct request_callback
+        // the requests and their callbacks, the poller is shared by all
+        // thread pools MPI polling is enabled on
+        hpx::util::mpi_request_poller& get_request_poller()
         {
-            MPI_Request request;
-            request_callback_function_type callback_function;
-        };
-
-        using request_callback_queue_type =
-            concurrency::ConcurrentQueue<request_callback>;
-
-        request_callback_queue_type& get_request_callback_queue()
-        {
-            static request_callback_queue_type request_callback_queue;
-            return request_callback_queue;
+            static hpx::util::mpi_request_poller request_poller;
+            return request_poller;
         }
 
-        using request_callback_vector_type = std::vector<request_callback>;
-
-        request_callback_vector_type& get_request_callback_vector()
-        {
-            static request_callback_vector_type request_callback_vector;
-            return request_callback_vector;
-        }
-
-        std::size_t get_num_active_requests_in_vector()
-        {
-            return std::count_if(detail::get_requests_vector().begin(),
-                detail::get_requests_vector().end(),
-                [](MPI_Request r) { return r != MPI_REQUEST_NULL; });
-        }
-
-        // used internally to add an MPI_Request to the lockfree queue
-        // that will be used by the polling routines to check when requests
-        // have completed
-        void add_to_request_callback_queue(request_callback&& req_callback)
+        void add_request_callback(
+            request_callback_function_type&& callback, MPI_Request request)
         {
-            get_request_callback_queue().enqueue(std::move(req_callback));
+            get_request_poller().add(request, HPX_MOVE(callback));
             ++(get_mpi_info().requests_queue_size_);
 
             if constexpr (mpi_debug.is_enabled())
             {
                 mpi_debug.debug(debug::str<>("request callback queued"),
-                    get_mpi_info(), "request",
-                    debug::hex<8>(req_callback.request));
+                    get_mpi_info(), "request", debug::hex<8>(request));
             }
         }
 
-        // used internally to add a request to the main polling vector
-        // that is passed to MPI_Testany
-        void add_to_request_callback_vector(request_callback&& req_callback)
-        {
-            get_requests_vector().push_back(req_callback.request);
-            get_request_callback_vector().push_back(std::move(req_callback));
-            get_mpi_info().requests_vector_size_ =
-                static_cast<std::uint32_t>(get_requests_vector().size());
-
-            if constexpr (mpi_debug.is_enabled())
-            {
-                mpi_debug.debug(
-                    debug::str<>("request callback moved from queue to vector"),
-                    get_mpi_info(), "request",
-                    debug::hex<8>(req_callback.request), "callbacks in vector",
-                    debug::dec<3>(get_request_callback_vector().size()),
-                    "non null",
-                    debug::dec<3>(get_num_active_requests_in_vector()));
-            }
-        }
-
-        void add_request_callback(
-            request_callback_function_type&& callback, MPI_Request request)
-        {
-            detail::add_to_request_callback_queue(
-                request_callback{request, std::move(callback)});
-        }
-
         // mutex needed to protect mpi request vector, note that the
         // mpi poll function takes place inside the main scheduling loop
         // of hpx and not on an hpx worker thread, so we must use std:mutex
@@ -144,12 +90,6 @@ namespace hpx { namespace mpi { namespace experimental {
                 detail::error_message(*errorcode));
         }
 
-        std::vector<MPI_Request>& get_requests_vector()
-        {
-            static std::vector<MPI_Request> requests_vector;
-            return requests_vector;
-        }
-
 #if defined(HPX_DEBUG)
         std::atomic<std::size_t>& get_register_polling_count()
         {
@@ -198,8 +138,7 @@ namespace hpx { namespace mpi { namespace experimental {
     {
         using hpx::threads::policies::detail::polling_status;
 
-        auto& request_callback_vector = detail::get_request_callback_vector();
-        auto& requests_vector = detail::get_requests_vector();
+        auto& poller = detail::get_request_poller();
 
         std::unique_lock<detail::mutex_type> lk(
             detail::get_vector_mtx(), std::try_to_lock);
@@ -225,153 +164,32 @@ namespace hpx { namespace mpi { namespace experimental {
             mpi_debug.timed(poll_deb, detail::get_mpi_info());
         }
 
-        {
-            // have any requests been made that need to be handled?
-            detail::request_callback req_callback;
-            while (
-                detail::get_request_callback_queue().try_dequeue(req_callback))
-            {
-                --(detail::get_mpi_info().requests_queue_size_);
-                add_to_request_callback_vector(HPX_MOVE(req_callback));
-            }
-        }
-
-        bool keep_trying = !requests_vector.empty();
-        while (keep_trying)
-        {
-            int index = 0;
-            int flag = false;
-            MPI_Status status;
-
-            int result = MPI_Testany(static_cast<int>(requests_vector.size()),
-                requests_vector.data(), &index, &flag, &status);
-
-            if constexpr (mpi_debug.is_enabled())
-            {
-                if (result == MPI_SUCCESS)
-                {
-                    static auto poll_deb =
-                        mpi_debug.make_timer(1, debug::str<>("Poll - success"));
-
-                    mpi_debug.timed(poll_deb, detail::get_mpi_info(),
-                        debug::str<>("Success"), "index",
-                        debug::dec<>(index == MPI_UNDEFINED ? -1 : index),
-                        "flag", debug::dec<>(flag), "status",
-                        debug::hex(status.MPI_ERROR));
-                }
-                else
-                {
-                    auto poll_deb =
-                        mpi_debug.make_timer(1, debug::str<>("Poll - <ERR>"));
-
-                    mpi_debug.error(poll_deb, detail::get_mpi_info(),
-                        debug::str<>("Poll <ERR>"), "MPI_ERROR",
-                        detail::error_message(status.MPI_ERROR), "status",
-                        debug::dec<>(status.MPI_ERROR), "index",
-                        debug::dec<>(index), "flag", debug::dec<>(flag));
-                }
-            }
+        // Test all outstanding requests at once using MPI_Testsome, this
+        // invokes the callbacks of all completed requests
+        [[maybe_unused]] std::size_t const completed = poller.poll();
 
-            // No operation completed
-            if (index == MPI_UNDEFINED)
-                break;
+        detail::get_mpi_info().requests_vector_size_ =
+            static_cast<std::uint32_t>(poller.num_active());
+        detail::get_mpi_info().requests_queue_size_ =
+            static_cast<std::uint32_t>(poller.num_pending());
 
-            keep_trying = flag;
-            if constexpr (mpi_debug.is_enabled())
-            {
-                // One operation completed
-                if (keep_trying)
-                {
-                    mpi_debug.debug(debug::str<>("MPI_Testany(set)"),
-                        detail::get_mpi_info(), "request",
-                        debug::hex<8>(requests_vector[std::size_t(index)]),
-                        "vector size", debug::dec<3>(requests_vector.size()),
-                        "non null",
-                        debug::dec<3>(
-                            detail::get_num_active_requests_in_vector()));
-                }
-            }
-            if (result != MPI_SUCCESS)    // Error and operation not completed
-                keep_trying = false;
-            if (keep_trying || result != MPI_SUCCESS)
-            {
-                // Invoke the callback with the status of the completed
-                // operation (status of the request is forwarded to MPI_Testany)
-                request_callback_vector[std::size_t(index)].callback_function(
-                    result);
-
-                // Remove the request from our vector to prevent retesting
-                requests_vector[std::size_t(index)] = MPI_REQUEST_NULL;
-
-                // Could store only the callbacks, right now the request
-                // is only used for an assert
-                request_callback_vector[std::size_t(index)].request =
-                    MPI_REQUEST_NULL;
-            }
-        }
-
-        // if there are more than 25% NULL request handles in our vector,
-        // compact them
-        if (!requests_vector.empty())
+        if constexpr (mpi_debug.is_enabled())
         {
-            std::size_t nulls = std::count(requests_vector.begin(),
-                requests_vector.end(), MPI_REQUEST_NULL);
-
-            if (nulls > requests_vector.size() / 4)
+            if (completed != 0)
             {
-                // compact away any requests that have been replaced by
-                // MPI_REQUEST_NULL
-                auto end1 = std::remove(requests_vector.begin(),
-                    requests_vector.end(), MPI_REQUEST_NULL);
-                requests_vector.resize(
-                    std::distance(requests_vector.begin(), end1));
-
-                auto end2 = std::remove_if(request_callback_vector.begin(),
-                    request_callback_vector.end(),
-                    [](detail::request_callback& req_callback) {
-                        return req_callback.request == MPI_REQUEST_NULL;
-                    });
-                request_callback_vector.resize(
-                    std::distance(request_callback_vector.begin(), end2));
-
-                if (requests_vector.size() != request_callback_vector.size())
-                {
-                    HPX_THROW_EXCEPTION(invalid_status,
-                        "hpx::mpi::experimental::poll",
-                        "Fatal Error: Mismatch in vectors");
-                }
-
-                detail::get_mpi_info().requests_vector_size_ =
-                    static_cast<std::uint32_t>(requests_vector.size());
-
-                if constexpr (mpi_debug.is_enabled())
-                {
-                    mpi_debug.debug(debug::str<>("MPI_REQUEST_NULL"),
-                        detail::get_mpi_info(), "nulls ", debug::dec<>(nulls));
-                }
+                mpi_debug.debug(debug::str<>("MPI_Testsome"),
+                    detail::get_mpi_info(), "completed",
+                    debug::dec<3>(completed));
             }
         }
 
-        return requests_vector.empty() ? polling_status::idle :
-                                         polling_status::busy;
+        return poller.empty() ? polling_status::idle : polling_status::busy;
     }
 
     namespace detail {
         std::size_t get_work_count()
         {
-            std::size_t work_count = 0;
-            {
-                std::unique_lock<detail::mutex_type> lk(
-                    detail::get_vector_mtx(), std::try_to_lock);
-                if (lk.owns_lock())
-                {
-                    work_count += get_num_active_requests_in_vector();
-                }
-            }
-
-            work_count += get_mpi_info().requests_queue_size_;
-
-            return work_count;
+            return get_request_poller().size();
         }
 
         // -------------------------------------------------------------
@@ -391,13 +209,9 @@ namespace hpx { namespace mpi { namespace experimental {
         {
 #if defined(HPX_DEBUG)
             {
-                std::unique_lock<hpx::mpi::experimental::detail::mutex_type> lk(
-                    detail::get_vector_mtx());
-                bool requests_queue_empty =
-                    get_request_callback_queue().size_approx() == 0;
-                bool requests_vector_empty =
-                    get_num_active_requests_in_vector() == 0;
-                lk.unlock();
+                auto const& poller = get_request_poller();
+                bool requests_queue_empty = poller.num_pending() == 0;
+                bool requests_vector_empty = poller.num_active() == 0;
                 HPX_ASSERT_MSG(requests_queue_empty,
                     "MPI request polling was disabled while there are "
                     "unprocessed MPI requests. Make sure MPI request polling "
@@ -467,7 +281,7 @@ namespace hpx { namespace mpi { namespace experimental {
         // install polling loop on requested thread pool
         if (pool_name.empty())
         {
-            detail::register_polling(hpx::resource::get_thread_pool(0));
+            detail::register_polling(hpx::resource::get_polling_thread_pool());
         }
         else
         {
@@ -495,7 +309,8 @@ namespace hpx { namespace mpi { namespace experimental {
 
         if (pool_name.empty())
         {
-            detail::unregister_polling(hpx::resource::get_thread_pool(0));
+            detail::unregister_polling(
+                hpx::resource::get_polling_thread_pool());
         }
         else
         {
@@ -0,0 +1,194 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/local/init.hpp>
+#include <hpx/modules/async_mpi.hpp>
+#include <hpx/modules/execution.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <mpi.h>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace ex = hpx::execution::experimental;
+namespace mpi = hpx::mpi::experimental;
+namespace tt = hpx::this_thread::experimental;
+
+int hpx_main()
+{
+    int size, rank;
+    MPI_Comm comm = MPI_COMM_WORLD;
+    MPI_Comm_size(comm, &size);
+    MPI_Comm_rank(comm, &rank);
+
+    HPX_TEST_MSG(size > 1, "This test requires N>1 mpi ranks");
+
+    {
+        // the requests are completed by the polling, the custom error
+        // handler turns failures into exceptions
+        mpi::enable_user_polling enable_polling("", true);
+
+        static_assert(ex::is_scheduler_v<mpi::mpi_scheduler>);
+        HPX_TEST(mpi::mpi_scheduler{} == mpi::mpi_scheduler{});
+
+        {
+            // schedule completes immediately
+            bool called = false;
+            tt::sync_wait(ex::schedule(mpi::mpi_scheduler{}) |
+                ex::then([&]() { called = true; }));
+            HPX_TEST(called);
+        }
+
+        {
+            // MPI function pointer, the sender completes on the mpi_scheduler
+            int data = rank == 0 ? 42 : 0;
+            auto s = mpi::start_mpi(MPI_Ibcast, &data, 1, MPI_INT, 0, comm);
+
+            auto sched = ex::get_completion_scheduler<ex::set_value_t>(s);
+            static_assert(
+                std::is_same_v<std::decay_t<decltype(sched)>,
+                    mpi::mpi_scheduler>);
+
+            tt::sync_wait(HPX_MOVE(s));
+            HPX_TEST_EQ(data, 42);
+        }
+
+        {
+            // lambda returning void, lvalue senders can be started repeatedly
+            int data = 0;
+            auto s = mpi::start_mpi(
+                [&](int root, MPI_Request* request) {
+                    if (rank == root)
+                    {
+                        data = root + 1;
+                    }
+                    MPI_Ibcast(&data, 1, MPI_INT, root, comm, request);
+                },
+                0);
+
+            for (int i = 0; i != 3; ++i)
+            {
+                data = 0;
+                tt::sync_wait(s);
+                HPX_TEST_EQ(data, 1);
+            }
+        }
+
+        {
+            // point to point requests, chained with continuations
+            int const next = (rank + 1) % size;
+            int const prev = (rank + size - 1) % size;
+
+            int sent = rank;
+            int received = -1;
+            tt::sync_wait(ex::when_all(
+                mpi::start_mpi(MPI_Irecv, &received, 1, MPI_INT, prev, 0, comm),
+                mpi::start_mpi(MPI_Isend, &sent, 1, MPI_INT, next, 0, comm)));
+            HPX_TEST_EQ(received, prev);
+
+            int sum = 0;
+            auto result = tt::sync_wait(
+                mpi::start_mpi(MPI_Iallreduce, &sent, &sum, 1, MPI_INT,
+                    MPI_SUM, comm) |
+                ex::then([&]() { return sum; }));
+            HPX_TEST_EQ(hpx::get<0>(*result), size * (size - 1) / 2);
+        }
+
+        {
+            // many requests in flight are progressed together
+            std::vector<int> data(16, rank == 0 ? 1 : 0);
+            std::vector<decltype(mpi::start_mpi(
+                MPI_Ibcast, data.data(), 1, MPI_INT, 0, comm))>
+                senders;
+            for (int& d : data)
+            {
+                senders.push_back(
+                    mpi::start_mpi(MPI_Ibcast, &d, 1, MPI_INT, 0, comm));
+            }
+            for (auto& s : senders)
+            {
+                tt::sync_wait(s);
+            }
+            for (int d : data)
+            {
+                HPX_TEST_EQ(d, 1);
+            }
+        }
+
+        // failure path
+        {
+            // exception thrown by the function
+            bool exception_thrown = false;
+            try
+            {
+                tt::sync_wait(mpi::start_mpi([](MPI_Request*) -> int {
+                    throw std::runtime_error("error in lambda");
+                }));
+                HPX_TEST(false);
+            }
+            catch (std::runtime_error const& e)
+            {
+                HPX_TEST_EQ(
+                    std::string(e.what()), std::string("error in lambda"));
+                exception_thrown = true;
+            }
+            HPX_TEST(exception_thrown);
+        }
+
+        {
+            // error code returned by the function
+            bool exception_thrown = false;
+            try
+            {
+                tt::sync_wait(mpi::start_mpi(
+                    [](MPI_Request*) { return MPI_ERR_OTHER; }));
+                HPX_TEST(false);
+            }
+            catch (mpi::mpi_exception& e)
+            {
+                HPX_TEST_EQ(e.get_mpi_errorcode(), MPI_ERR_OTHER);
+                exception_thrown = true;
+            }
+            HPX_TEST(exception_thrown);
+        }
+
+        {
+            // exception thrown through the HPX error handler
+            int* data = nullptr;
+            bool exception_thrown = false;
+            try
+            {
+                tt::sync_wait(
+                    mpi::start_mpi(MPI_Ibcast, data, 0, MPI_INT, -1, comm));
+                HPX_TEST(false);
+            }
+            catch (std::runtime_error const& e)
+            {
+                HPX_TEST(std::string(e.what()).find(std::string(
+                             "invalid root")) != std::string::npos);
+                exception_thrown = true;
+            }
+            HPX_TEST(exception_thrown);
+        }
+        // let the user polling go out of scope
+    }
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    MPI_Init(&argc, &argv);
+
+    auto result = hpx::local::init(hpx_main, argc, argv);
+
+    MPI_Finalize();
+
+    return result || hpx::util::report_errors();
+}
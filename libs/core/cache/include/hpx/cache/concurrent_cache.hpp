@@ -0,0 +1,606 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/cache/statistics/no_statistics.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
+#include <hpx/concurrency/spinlock.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx::util::cache {
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \class concurrent_cache concurrent_cache.hpp
+    ///
+    /// \brief The \a concurrent_cache implements a local (non-distributed)
+    ///        cache which can be accessed concurrently from any number of
+    ///        threads.
+    ///
+    /// The entries are distributed over a number of shards, based on the
+    /// hash of their keys. Every shard is protected by its own lock and
+    /// manages its share of the capacity independently, so that threads
+    /// accessing different shards don't contend with each other.
+    ///
+    /// The entries of a shard are evicted using the CLOCK (second chance)
+    /// algorithm: a hit only marks the entry as referenced, without
+    /// reordering any of the shard's data structures. When space is
+    /// needed the clock hand passes over the entries, giving referenced
+    /// entries a second chance and evicting the first unreferenced entry
+    /// which agrees to be removed (see \a entry#remove).
+    ///
+    /// \tparam Key           The type of the keys to use to identify the
+    ///                       entries stored in the cache
+    /// \tparam Entry         The type of the items to be held in the cache,
+    ///                       must model the CacheEntry concept
+    /// \tparam Statistics    A (optional) type allowing to collect some basic
+    ///                       statistics about the operation of the cache
+    ///                       instance. The type must conform to the
+    ///                       CacheStatistics concept. Every shard holds its
+    ///                       own instance, \a get_statistics combines them.
+    ///                       The default value is the type
+    ///                       \a statistics#no_statistics.
+    /// \tparam Hash          A (optional) hash function for the keys, the
+    ///                       default is std::hash<Key>.
+    /// \tparam KeyEqual      A (optional) function object comparing two keys
+    ///                       for equality, the default is std::equal_to<Key>.
+    /// \tparam Mutex         A (optional) lockable type protecting a shard,
+    ///                       the default is hpx::util::spinlock.
+    template <typename Key, typename Entry,
+        typename Statistics = statistics::no_statistics,
+        typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>,
+        typename Mutex = hpx::util::spinlock>
+    class concurrent_cache
+    {
+    public:
+        using key_type = Key;
+        using entry_type = Entry;
+        using statistics_type = Statistics;
+        using hasher = Hash;
+        using key_equal = KeyEqual;
+        using mutex_type = Mutex;
+
+        using value_type = typename entry_type::value_type;
+        using size_type = std::size_t;
+
+        // the number of shards used by default
+        static constexpr std::size_t default_num_shards = 16;
+
+    private:
+        using update_on_exit = typename statistics_type::update_on_exit;
+
+        struct clock_slot
+        {
+            template <typename Entry_>
+            clock_slot(key_type const& k, Entry_&& e)
+              : key(k)
+              , entry(HPX_FORWARD(Entry_, e))
+            {
+            }
+
+            key_type key;
+            entry_type entry;
+            bool referenced = false;
+        };
+
+        using clock_type = std::list<clock_slot>;
+        using clock_iterator = typename clock_type::iterator;
+        using index_type = std::unordered_map<key_type, clock_iterator,
+            hasher, key_equal>;
+
+        struct shard
+        {
+            // Free space in the shard, advancing the clock hand. The hand is
+            // the front of the list, the entries passed by the hand are
+            // moved to the back. Every entry is looked at (at most) twice.
+            bool free_space(size_type num_free)
+            {
+                std::size_t steps = 2 * clock_.size();
+                while (num_free != 0 && steps-- != 0)
+                {
+                    clock_iterator it = clock_.begin();
+                    if (it->referenced || !it->entry.remove())
+                    {
+                        // second chance
+                        it->referenced = false;
+                        clock_.splice(clock_.end(), clock_, it);
+                        continue;
+                    }
+
+                    size_type const entry_size = it->entry.get_size();
+                    num_free -= (std::min)(num_free, entry_size);
+                    current_size_ -= entry_size;
+
+                    index_.erase(it->key);
+                    clock_.erase(it);
+
+                    statistics_.got_eviction();
+                }
+                return num_free == 0;
+            }
+
+            mutable mutex_type mtx_;
+            size_type max_size_ = 0;
+            size_type current_size_ = 0;
+            index_type index_;
+            clock_type clock_;
+            statistics_type statistics_;
+        };
+
+        using shard_type = hpx::util::cache_aligned_data_derived<shard>;
+
+    public:
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Construct an instance of a concurrent_cache.
+        ///
+        /// \param max_size   [in] The maximal size this cache is allowed to
+        ///                   reach any time. The default is zero (no size
+        ///                   limitation). The unit of this value is usually
+        ///                   determined by the unit of the values returned by
+        ///                   the entry's \a get_size function. Every shard
+        ///                   may hold an equal share of this size.
+        /// \param num_shards [in] The number of shards to use, it will be
+        ///                   rounded up to the next power of two.
+        ///
+        explicit concurrent_cache(size_type max_size = 0,
+            std::size_t num_shards = default_num_shards)
+          : num_shards_(1)
+          , max_size_(max_size)
+        {
+            while (num_shards_ < num_shards)
+            {
+                num_shards_ *= 2;
+                ++shard_bits_;
+            }
+
+            shards_.reset(new shard_type[num_shards_]);
+            for (std::size_t i = 0; i != num_shards_; ++i)
+            {
+                shards_[i].max_size_ = shard_capacity(max_size);
+            }
+        }
+
+        concurrent_cache(concurrent_cache const&) = delete;
+        concurrent_cache& operator=(concurrent_cache const&) = delete;
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Return the number of shards used by the cache.
+        constexpr std::size_t num_shards() const noexcept
+        {
+            return num_shards_;
+        }
+
+        /// \brief Return current size of the cache.
+        ///
+        /// \returns The current size of this cache instance. The size is
+        ///          collected from all shards while the cache may be
+        ///          modified concurrently.
+        size_type size() const
+        {
+            size_type result = 0;
+            for (std::size_t i = 0; i != num_shards_; ++i)
+            {
+                std::lock_guard<mutex_type> l(shards_[i].mtx_);
+                result += shards_[i].current_size_;
+            }
+            return result;
+        }
+
+        /// \brief Access the maximum size the cache is allowed to grow to.
+        ///
+        /// \returns    The maximum size this cache instance is allowed to
+        ///             reach. If this number is zero the cache has no
+        ///             limitation with regard to a maximum size.
+        constexpr size_type capacity() const noexcept
+        {
+            return max_size_;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Check whether the cache currently holds an entry identified
+        ///        by the given key
+        ///
+        /// \param k      [in] The key for the entry which should be looked up
+        ///               in the cache.
+        ///
+        /// \note         This function does not mark the entry as
+        ///               referenced and does not call the entry's function
+        ///               \a entry#touch.
+        ///
+        /// \returns      This function returns \a true if the cache holds the
+        ///               referenced entry, otherwise it returns \a false.
+        bool holds_key(key_type const& k) const
+        {
+            shard_type const& s = get_shard(k);
+
+            std::lock_guard<mutex_type> l(s.mtx_);
+            return s.index_.find(k) != s.index_.end();
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Get a specific entry identified by the given key.
+        ///
+        /// \param k      [in] The key for the entry which should be retrieved
+        ///               from the cache.
+        /// \param val    [out] If the entry indexed by the key is found in the
+        ///               cache this value on successful return will be a copy
+        ///               of the corresponding entry.
+        ///
+        /// \note         The function will call the entry's \a entry#touch
+        ///               function if the value corresponding to the provided
+        ///               key is found in the cache.
+        ///
+        /// \returns      This function returns \a true if the cache holds the
+        ///               referenced entry, otherwise it returns \a false.
+        bool get_entry(key_type const& k, entry_type& val)
+        {
+            return get(k, [&](entry_type const& e) { val = e; });
+        }
+
+        /// \brief Get a specific entry identified by the given key.
+        ///
+        /// \param k      [in] The key for the entry which should be retrieved
+        ///               from the cache
+        /// \param val    [out] If the entry indexed by the key is found in the
+        ///               cache this value on successful return will be a copy
+        ///               of the corresponding value.
+        ///
+        /// \note         The function will call the entry's \a entry#touch
+        ///               function if the value corresponding to the provided
+        ///               is found in the cache.
+        ///
+        /// \returns      This function returns \a true if the cache holds the
+        ///               referenced entry, otherwise it returns \a false.
+        bool get_entry(key_type const& k, value_type& val)
+        {
+            return get(k, [&](entry_type const& e) { val = e.get(); });
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Insert a new element into this cache
+        ///
+        /// \param k      [in] The key for the entry which should be added to
+        ///               the cache.
+        /// \param value  [in] The value which should be added to the cache.
+        ///
+        /// \note         This function invokes the function \a entry#insert
+        ///               of the newly constructed entry instance. If it
+        ///               returns false the key/value pair doesn't get inserted
+        ///               into the cache and the \a insert function will return
+        ///               \a false. Other reasons for this function to fail
+        ///               (return \a false) are a) the key/value pair is
+        ///               already held in the cache or b) inserting the new
+        ///               value into the cache maxed out the capacity of its
+        ///               shard and it was not possible to free any of the
+        ///               existing entries.
+        ///
+        /// \returns      This function returns \a true if the entry has been
+        ///               successfully added to the cache, otherwise it returns
+        ///               \a false.
+        bool insert(key_type const& k, value_type const& val)
+        {
+            return insert(k, entry_type(val));
+        }
+
+        bool insert(key_type const& k, value_type&& val)
+        {
+            return insert(k, entry_type(HPX_MOVE(val)));
+        }
+
+        /// \brief Insert a new entry into this cache
+        ///
+        /// \param k      [in] The key for the entry which should be added to
+        ///               the cache.
+        /// \param value  [in] The entry which should be added to the cache.
+        ///
+        /// \returns      This function returns \a true if the entry has been
+        ///               successfully added to the cache, otherwise it returns
+        ///               \a false.
+        template <typename Entry_,
+            std::enable_if_t<
+                std::is_convertible_v<std::decay_t<Entry_>, entry_type>, int> =
+                0>
+        bool insert(key_type const& k, Entry_&& e)
+        {
+            shard_type& s = get_shard(k);
+
+            std::lock_guard<mutex_type> l(s.mtx_);
+            update_on_exit update(
+                s.statistics_, statistics::method::insert_entry);
+
+            return insert_locked(s, k, HPX_FORWARD(Entry_, e));
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Update an existing element in this cache
+        ///
+        /// \param k      [in] The key for the value which should be updated in
+        ///               the cache.
+        /// \param value  [in] The value which should be used as a replacement
+        ///               for the existing value in the cache. Any existing
+        ///               cache entry is not changed except for its value.
+        ///
+        /// \returns      This function returns \a true if the entry has been
+        ///               successfully updated, otherwise it returns \a false.
+        ///               If the entry currently is not held by the cache it is
+        ///               added and the return value reflects the outcome of
+        ///               the corresponding insert operation.
+        template <typename Value,
+            std::enable_if_t<
+                std::is_convertible_v<std::decay_t<Value>, value_type>, int> =
+                0>
+        bool update(key_type const& k, Value&& val)
+        {
+            shard_type& s = get_shard(k);
+
+            std::lock_guard<mutex_type> l(s.mtx_);
+            update_on_exit update(
+                s.statistics_, statistics::method::update_entry);
+
+            auto it = s.index_.find(k);
+            if (it == s.index_.end())
+            {
+                // doesn't exist in this cache
+                s.statistics_.got_miss();
+                return insert_locked(
+                    s, k, entry_type(value_type(HPX_FORWARD(Value, val))));
+            }
+
+            clock_slot& slot = *it->second;
+            slot.entry.get() = HPX_FORWARD(Value, val);
+            slot.entry.touch();
+            slot.referenced = true;
+
+            s.statistics_.got_hit();
+            return true;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Remove the entry identified by the given key from the cache
+        ///
+        /// \returns      This function returns \a true if the entry was
+        ///               held by the cache and agreed to be removed (see
+        ///               \a entry#remove).
+        bool erase(key_type const& k)
+        {
+            shard_type& s = get_shard(k);
+
+            std::lock_guard<mutex_type> l(s.mtx_);
+            update_on_exit update(
+                s.statistics_, statistics::method::erase_entry);
+
+            auto it = s.index_.find(k);
+            if (it == s.index_.end() || !it->second->entry.remove())
+            {
+                return false;
+            }
+
+            s.current_size_ -= it->second->entry.get_size();
+            s.clock_.erase(it->second);
+            s.index_.erase(it);
+
+            s.statistics_.got_eviction();
+            return true;
+        }
+
+        /// \brief Remove stored entries from the cache for which the supplied
+        ///        function object returns true.
+        ///
+        /// \param ep     [in] This parameter has to be a (binary) function
+        ///               object. It is invoked with the key and the entry of
+        ///               each of the entries currently held in the cache,
+        ///               holding the lock of the entry's shard. An entry is
+        ///               removed if this invocation returns \a true and its
+        ///               \a entry#remove function agrees.
+        ///
+        /// \returns      This function returns the overall size of the removed
+        ///               entries.
+        template <typename Func>
+        size_type erase_if(Func&& ep)
+        {
+            size_type erased = 0;
+            for (std::size_t i = 0; i != num_shards_; ++i)
+            {
+                shard_type& s = shards_[i];
+
+                std::lock_guard<mutex_type> l(s.mtx_);
+                update_on_exit update(
+                    s.statistics_, statistics::method::erase_entry);
+
+                for (auto it = s.clock_.begin(); it != s.clock_.end(); /**/)
+                {
+                    if (!ep(std::as_const(it->key), std::as_const(it->entry)) ||
+                        !it->entry.remove())
+                    {
+                        ++it;
+                        continue;
+                    }
+
+                    size_type const entry_size = it->entry.get_size();
+                    s.current_size_ -= entry_size;
+                    erased += entry_size;
+
+                    s.index_.erase(it->key);
+                    it = s.clock_.erase(it);
+
+                    s.statistics_.got_eviction();
+                }
+            }
+            return erased;
+        }
+
+        /// \brief Remove all stored entries from the cache which agree to be
+        ///        removed (see \a entry#remove).
+        ///
+        /// \returns      This function returns the overall size of the removed
+        ///               entries.
+        size_type erase()
+        {
+            return erase_if(
+                [](key_type const&, entry_type const&) { return true; });
+        }
+
+        /// \brief Clear the cache
+        ///
+        /// Unconditionally removes all stored entries from the cache and
+        /// resets the statistics.
+        void clear()
+        {
+            for (std::size_t i = 0; i != num_shards_; ++i)
+            {
+                shard_type& s = shards_[i];
+
+                std::lock_guard<mutex_type> l(s.mtx_);
+                s.index_.clear();
+                s.clock_.clear();
+                s.statistics_.clear();
+                s.current_size_ = 0;
+            }
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Return the statistics instance of the given shard
+        ///
+        /// \note   The statistics are updated by the threads accessing the
+        ///         shard, they can be read consistently only while the cache
+        ///         is not being modified.
+        statistics_type const& get_statistics(std::size_t shard) const noexcept
+        {
+            HPX_ASSERT(shard < num_shards_);
+            return shards_[shard].statistics_;
+        }
+
+        /// \brief Return the statistics of all shards combined, the
+        ///        statistics type has to support operator+=.
+        statistics_type get_statistics() const
+        {
+            statistics_type result;
+            for (std::size_t i = 0; i != num_shards_; ++i)
+            {
+                std::lock_guard<mutex_type> l(shards_[i].mtx_);
+                result += shards_[i].statistics_;
+            }
+            return result;
+        }
+
+    private:
+        size_type shard_capacity(size_type max_size) const noexcept
+        {
+            return (max_size + num_shards_ - 1) / num_shards_;
+        }
+
+        std::size_t shard_index(key_type const& k) const
+        {
+            if (shard_bits_ == 0)
+            {
+                return 0;
+            }
+
+            // Fibonacci hashing, using the upper bits of the product as the
+            // lower bits of the key's hash are also used to select the
+            // bucket inside the shard
+            std::uint64_t const h =
+                static_cast<std::uint64_t>(hasher()(k)) * 0x9e3779b97f4a7c15ull;
+            return static_cast<std::size_t>(h >> (64 - shard_bits_));
+        }
+
+        shard_type& get_shard(key_type const& k)
+        {
+            return shards_[shard_index(k)];
+        }
+
+        shard_type const& get_shard(key_type const& k) const
+        {
+            return shards_[shard_index(k)];
+        }
+
+        template <typename F>
+        bool get(key_type const& k, F&& f)
+        {
+            shard_type& s = get_shard(k);
+
+            std::lock_guard<mutex_type> l(s.mtx_);
+            update_on_exit update(s.statistics_, statistics::method::get_entry);
+
+            auto it = s.index_.find(k);
+            if (it == s.index_.end())
+            {
+                s.statistics_.got_miss();
+                return false;
+            }
+
+            // a hit only marks the entry, it is not moved
+            clock_slot& slot = *it->second;
+            slot.entry.touch();
+            slot.referenced = true;
+
+            s.statistics_.got_hit();
+
+            f(std::as_const(slot.entry));
+            return true;
+        }
+
+        template <typename Entry_>
+        bool insert_locked(shard_type& s, key_type const& k, Entry_&& e)
+        {
+            // ask entry if it really wants to be inserted
+            if (!e.insert())
+            {
+                return false;
+            }
+
+            if (s.index_.find(k) != s.index_.end())
+            {
+                return false;
+            }
+
+            // make sure the shard doesn't get too large
+            size_type const entry_size = e.get_size();
+            if (s.max_size_ != 0 &&
+                (entry_size > s.max_size_ ||
+                    (s.current_size_ + entry_size > s.max_size_ &&
+                        !s.free_space(
+                            s.current_size_ + entry_size - s.max_size_))))
+            {
+                return false;
+            }
+
+            clock_iterator it = s.clock_.emplace(
+                s.clock_.end(), k, HPX_FORWARD(Entry_, e));
+            try
+            {
+                s.index_.emplace(k, it);
+            }
+            catch (...)
+            {
+                s.clock_.erase(it);
+                throw;
+            }
+
+            s.current_size_ += entry_size;
+            s.statistics_.got_insertion();
+            return true;
+        }
+
+        std::size_t num_shards_;
+        std::size_t shard_bits_ = 0;
+        size_type max_size_;
+        std::unique_ptr<shard_type[]> shards_;
+    };
+}    // namespace hpx::util::cache
@@ -36,6 +36,13 @@ namespace hpx::util::cache::statistics {
         {
             api_counter_data() = default;
 
+            api_counter_data& operator+=(api_counter_data const& rhs) noexcept
+            {
+                count_ += rhs.count_;
+                time_ += rhs.time_;
+                return *this;
+            }
+
             std::int64_t count_ = 0;
             std::int64_t time_ = 0;
         };
@@ -151,6 +158,19 @@ namespace hpx::util::cache::statistics {
             return get_and_reset_value(erase_entry_.time_, reset);
         }
 
+        /// \brief Add the statistics of another instance, used to combine
+        ///        the statistics of the shards of a concurrent_cache
+        local_full_statistics& operator+=(
+            local_full_statistics const& rhs) noexcept
+        {
+            local_statistics::operator+=(rhs);
+            get_entry_ += rhs.get_entry_;
+            insert_entry_ += rhs.insert_entry_;
+            update_entry_ += rhs.update_entry_;
+            erase_entry_ += rhs.erase_entry_;
+            return *this;
+        }
+
     private:
         friend struct update_on_exit;
 
@@ -62,6 +62,13 @@ namespace hpx::util::cache::statistics {
         /// \brief Reset all statistics
         constexpr void clear() const noexcept {}
 
+        /// \brief Add the statistics of another instance, used to combine
+        ///        the statistics of the shards of a concurrent_cache
+        constexpr no_statistics& operator+=(no_statistics const&) noexcept
+        {
+            return *this;
+        }
+
         /// Helper class to update timings and counts on function exit
         struct update_on_exit
         {
@@ -0,0 +1,181 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/cache/concurrent_cache.hpp>
+#include <hpx/cache/entries/entry.hpp>
+#include <hpx/cache/entries/size_entry.hpp>
+#include <hpx/cache/statistics/local_statistics.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <string>
+#include <thread>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+void test_insert_get()
+{
+    using entry_type = hpx::util::cache::entries::entry<std::string>;
+    using cache_type = hpx::util::cache::concurrent_cache<int, entry_type,
+        hpx::util::cache::statistics::local_statistics>;
+
+    cache_type c;
+    HPX_TEST_EQ(c.num_shards(), cache_type::default_num_shards);
+
+    for (int i = 0; i != 100; ++i)
+    {
+        HPX_TEST(c.insert(i, std::to_string(i)));
+    }
+
+    // duplicate keys are rejected
+    HPX_TEST(!c.insert(42, std::string("42")));
+    HPX_TEST_EQ(c.size(), static_cast<std::size_t>(100));
+
+    for (int i = 0; i != 100; ++i)
+    {
+        std::string value;
+        HPX_TEST(c.get_entry(i, value));
+        HPX_TEST_EQ(value, std::to_string(i));
+    }
+
+    std::string value;
+    HPX_TEST(!c.get_entry(100, value));
+
+    HPX_TEST(c.update(42, std::string("forty-two")));
+    HPX_TEST(c.get_entry(42, value));
+    HPX_TEST_EQ(value, std::string("forty-two"));
+
+    HPX_TEST(c.erase(42));
+    HPX_TEST(!c.holds_key(42));
+    HPX_TEST(!c.erase(42));
+
+    // the statistics of all shards are combined
+    auto const stats = c.get_statistics();
+    HPX_TEST_EQ(stats.insertions(), static_cast<std::size_t>(100));
+    HPX_TEST_EQ(stats.hits(), static_cast<std::size_t>(102));
+    HPX_TEST_EQ(stats.misses(), static_cast<std::size_t>(1));
+    HPX_TEST_EQ(stats.evictions(), static_cast<std::size_t>(1));
+
+    // erase all odd keys
+    c.erase_if([](int k, entry_type const&) { return k % 2 != 0; });
+    HPX_TEST_EQ(c.size(), static_cast<std::size_t>(49));
+    HPX_TEST(c.holds_key(0));
+    HPX_TEST(!c.holds_key(1));
+
+    c.clear();
+    HPX_TEST_EQ(c.size(), static_cast<std::size_t>(0));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_clock_eviction()
+{
+    using entry_type = hpx::util::cache::entries::entry<int>;
+    using cache_type = hpx::util::cache::concurrent_cache<int, entry_type>;
+
+    // a single shard makes the order of the evictions predictable
+    cache_type c(3, 1);
+    HPX_TEST_EQ(c.num_shards(), static_cast<std::size_t>(1));
+
+    HPX_TEST(c.insert(1, 1));
+    HPX_TEST(c.insert(2, 2));
+    HPX_TEST(c.insert(3, 3));
+
+    // the referenced entry gets a second chance
+    int value = 0;
+    HPX_TEST(c.get_entry(1, value));
+
+    HPX_TEST(c.insert(4, 4));
+    HPX_TEST_EQ(c.size(), static_cast<std::size_t>(3));
+    HPX_TEST(c.holds_key(1));
+    HPX_TEST(!c.holds_key(2));
+    HPX_TEST(c.holds_key(3));
+    HPX_TEST(c.holds_key(4));
+
+    HPX_TEST(c.insert(5, 5));
+    HPX_TEST(!c.holds_key(3));
+    HPX_TEST(c.holds_key(1));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_size_eviction()
+{
+    using entry_type = hpx::util::cache::entries::size_entry<int>;
+    using cache_type = hpx::util::cache::concurrent_cache<int, entry_type>;
+
+    cache_type c(100, 1);
+
+    HPX_TEST(c.insert(1, entry_type(1, 40)));
+    HPX_TEST(c.insert(2, entry_type(2, 40)));
+    HPX_TEST_EQ(c.size(), static_cast<std::size_t>(80));
+
+    // entries larger than the capacity are rejected
+    HPX_TEST(!c.insert(3, entry_type(3, 101)));
+
+    // makes room by evicting the oldest entry
+    HPX_TEST(c.insert(3, entry_type(3, 50)));
+    HPX_TEST_EQ(c.size(), static_cast<std::size_t>(90));
+    HPX_TEST(!c.holds_key(1));
+    HPX_TEST(c.holds_key(2));
+    HPX_TEST(c.holds_key(3));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_concurrent_access()
+{
+    using entry_type = hpx::util::cache::entries::entry<int>;
+    using cache_type = hpx::util::cache::concurrent_cache<int, entry_type,
+        hpx::util::cache::statistics::local_statistics>;
+
+    constexpr int num_threads = 4;
+    constexpr int num_keys = 1000;
+    constexpr std::size_t capacity = 512;
+
+    cache_type c(capacity);
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t != num_threads; ++t)
+    {
+        threads.emplace_back([&c, t]() {
+            for (int i = 0; i != 10 * num_keys; ++i)
+            {
+                int const k = (i * (t + 1)) % num_keys;
+
+                int value = 0;
+                if (c.get_entry(k, value))
+                {
+                    HPX_TEST_EQ(value, k);
+                }
+                else
+                {
+                    c.insert(k, k);
+                }
+            }
+        });
+    }
+
+    for (auto& t : threads)
+    {
+        t.join();
+    }
+
+    HPX_TEST_LTE(c.size(), capacity);
+
+    auto const stats = c.get_statistics();
+    HPX_TEST_EQ(stats.hits() + stats.misses(),
+        static_cast<std::size_t>(num_threads * 10 * num_keys));
+    HPX_TEST_EQ(stats.insertions() - stats.evictions(), c.size());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    test_insert_get();
+    test_clock_eviction();
+    test_size_eviction();
+    test_concurrent_access();
+
+    return hpx::util::report_errors();
+}
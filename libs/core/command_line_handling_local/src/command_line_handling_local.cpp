@@ -585,6 +585,23 @@ namespace hpx { namespace local { namespace detail {
                 std::to_string(num_high_priority_queues));
         }
 
+        if (vm_.count("hpx:print-startup-timings"))
+        {
+            ini_config.emplace_back("hpx.print_startup_timings!=1");
+        }
+
+        if (vm_.count("hpx:polling-threads"))
+        {
+            ini_config.emplace_back("hpx.threadpools.polling_pool_size!=" +
+                std::to_string(vm_["hpx:polling-threads"].as<std::size_t>()));
+        }
+
+        if (vm_.count("hpx:sampling-profiler"))
+        {
+            ini_config.emplace_back("hpx.sampling_profiler.file!=" +
+                vm_["hpx:sampling-profiler"].as<std::string>());
+        }
+
         enable_logging_settings(vm, ini_config);
 
         if (debug_clp)
@@ -352,6 +352,14 @@ namespace hpx { namespace local { namespace detail {
                 ("hpx:print-bind",
                   "print to the console the bit masks calculated from the "
                   "arguments specified to all --hpx:bind options.")
+                ("hpx:print-startup-timings",
+                  "print to the console the time taken by the phases of the "
+                  "runtime startup before hpx_main is invoked")
+                ("hpx:polling-threads", value<std::size_t>(),
+                  "the number of processing units to set aside for a "
+                  "dedicated thread pool 'polling', running the network "
+                  "background work and the MPI and CUDA polling "
+                  "(default: 0, i.e. no dedicated pool)")
                 ("hpx:threads", value<std::string>(),
                  "the number of operating system threads to spawn for this HPX "
                  "locality (default: 1, using 'all' will spawn one thread for "
@@ -363,8 +371,9 @@ namespace hpx { namespace local { namespace detail {
                 ("hpx:queuing", value<std::string>(),
                   "the queue scheduling policy to use, options are "
                   "'local', 'local-priority-fifo','local-priority-lifo', "
-                  "'abp-priority-fifo', 'abp-priority-lifo', 'static', and "
-                  "'static-priority' (default: 'local-priority'; "
+                  "'abp-priority-fifo', 'abp-priority-lifo', "
+                  "'local-workrequesting-fifo', 'local-workrequesting-lifo', "
+                  "'static', and 'static-priority' (default: 'local-priority'; "
                   "all option values can be abbreviated)")
                 ("hpx:high-priority-threads", value<std::size_t>(),
                   "the number of operating system threads maintaining a high "
@@ -411,6 +420,11 @@ namespace hpx { namespace local { namespace detail {
                   "wait for a debugger to be attached, possible values: "
                   "off, startup, exception or test-failure (default: startup)")
 #endif
+                ("hpx:sampling-profiler",
+                  value<std::string>()->implicit_value(
+                      "sampling_profile.folded"),
+                  "sample the HPX threads and write their folded stacks to the "
+                  "given file at shutdown (default: sampling_profile.folded)")
             ;
 
             hidden_options.add_options()
@@ -11,6 +11,8 @@
 #include <hpx/compute_local/host/block_allocator.hpp>
 #include <hpx/compute_local/host/block_executor.hpp>
 #include <hpx/compute_local/host/get_targets.hpp>
+#include <hpx/compute_local/host/huge_pages.hpp>
+#include <hpx/compute_local/host/locality_aware_allocator.hpp>
 #include <hpx/compute_local/host/numa_domains.hpp>
 #include <hpx/compute_local/host/target.hpp>
 #include <hpx/compute_local/host/traits/access_target.hpp>
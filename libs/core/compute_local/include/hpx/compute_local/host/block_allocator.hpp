@@ -14,6 +14,7 @@
 
 #include <hpx/allocator_support/detail/new.hpp>
 #include <hpx/compute_local/host/block_executor.hpp>
+#include <hpx/compute_local/host/huge_pages.hpp>
 #include <hpx/compute_local/host/target.hpp>
 #include <hpx/datastructures/tuple.hpp>
 #include <hpx/execution/executors/static_chunk_size.hpp>
@@ -36,7 +37,9 @@
 namespace hpx { namespace compute { namespace host {
     namespace detail {
         /// The policy_allocator allocates blocks of memory touched according to
-        /// the distribution policy of the given executor.
+        /// the distribution policy of the given executor. The memory is backed
+        /// by the given kind of (huge) pages, falling back to ordinary pages if
+        /// those are not available.
         template <typename T, typename Policy,
             typename Enable = typename std::enable_if<
                 hpx::is_execution_policy<Policy>::value>::type>
@@ -60,13 +63,17 @@ namespace hpx { namespace compute { namespace host {
                 using other = policy_allocator<U, policy_type>;
             };
 
-            policy_allocator(Policy&& policy)
+            policy_allocator(Policy&& policy,
+                host::huge_pages pages = host::huge_pages::none)
               : policy_(HPX_MOVE(policy))
+              , huge_pages_(pages)
             {
             }
 
-            policy_allocator(Policy const& policy)
+            policy_allocator(Policy const& policy,
+                host::huge_pages pages = host::huge_pages::none)
               : policy_(policy)
+              , huge_pages_(pages)
             {
             }
 
@@ -75,6 +82,12 @@ namespace hpx { namespace compute { namespace host {
                 return policy_;
             }
 
+            // The kind of pages requested for the allocated memory
+            host::huge_pages huge_pages() const noexcept
+            {
+                return huge_pages_;
+            }
+
             // Returns the actual address of x even in presence of overloaded
             // operator&
             pointer address(reference x) const noexcept
@@ -87,14 +100,15 @@ namespace hpx { namespace compute { namespace host {
                 return &x;
             }
 
-            // Allocates n * sizeof(T) bytes of uninitialized storage by calling
-            // topo.allocate(). The pointer hint may be used to provide locality of
-            // reference: the allocator, if supported by the implementation, will
-            // attempt to allocate the new memory block as close as possible to hint.
+            // Allocates n * sizeof(T) bytes of uninitialized storage backed by
+            // the requested kind of pages. The pointer hint may be used to
+            // provide locality of reference: the allocator, if supported by the
+            // implementation, will attempt to allocate the new memory block as
+            // close as possible to hint.
             pointer allocate(size_type n, const void* /* hint */ = nullptr)
             {
                 return reinterpret_cast<pointer>(
-                    hpx::threads::create_topology().allocate(n * sizeof(T)));
+                    allocate_pages(n * sizeof(T), huge_pages_));
             }
 
             // Deallocates the storage referenced by the pointer p, which must be a
@@ -103,14 +117,7 @@ namespace hpx { namespace compute { namespace host {
             // originally produced p; otherwise, the behavior is undefined.
             void deallocate(pointer p, size_type n) noexcept
             {
-                try
-                {
-                    hpx::threads::create_topology().deallocate(p, n);
-                }
-                catch (...)
-                {
-                    ;    // just ignore errors from create_topology
-                }
+                deallocate_pages(p, n * sizeof(T));
             }
 
             // Returns the maximum theoretically possible value of n, for which the
@@ -227,6 +234,7 @@ namespace hpx { namespace compute { namespace host {
         private:
             target_type target_;
             policy_type policy_;
+            host::huge_pages huge_pages_;
         };
     }    // namespace detail
 
@@ -243,6 +251,12 @@ namespace hpx { namespace compute { namespace host {
     /// std::size_t N = 2048;
     /// vector_type v(N, allocator_type(numa_nodes));
     ///
+    /// Large data sets should be backed by huge pages to reduce the number of
+    /// TLB misses:
+    ///
+    /// using hpx::compute::host::huge_pages;
+    /// vector_type v(N, allocator_type(numa_nodes, huge_pages::huge_2mb));
+    ///
     template <typename T,
         typename Executor =
             hpx::parallel::execution::restricted_thread_pool_executor>
@@ -267,15 +281,19 @@ namespace hpx { namespace compute { namespace host {
         {
         }
 
-        block_allocator(target_type const& targets)
+        block_allocator(target_type const& targets,
+            host::huge_pages pages = host::huge_pages::none)
           : base_type(
-                policy_type(executor_type(targets), executor_parameters_type()))
+                policy_type(executor_type(targets), executor_parameters_type()),
+                pages)
         {
         }
 
-        block_allocator(target_type&& targets)
-          : base_type(policy_type(
-                executor_type(HPX_MOVE(targets)), executor_parameters_type()))
+        block_allocator(target_type&& targets,
+            host::huge_pages pages = host::huge_pages::none)
+          : base_type(policy_type(executor_type(HPX_MOVE(targets)),
+                          executor_parameters_type()),
+                pages)
         {
         }
 
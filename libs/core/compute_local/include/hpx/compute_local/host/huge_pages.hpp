@@ -0,0 +1,48 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace hpx { namespace compute { namespace host {
+
+    /// The kind of pages the host allocators back their memory with. Large
+    /// working sets suffer from TLB misses when using ordinary pages, huge
+    /// pages cover more memory per TLB entry.
+    enum class huge_pages : std::uint8_t
+    {
+        /// ordinary pages allocated from the OS
+        none = 0,
+        /// ordinary pages advised to be merged into transparent huge pages
+        /// (Linux only, depends on /sys/kernel/mm/transparent_hugepage)
+        transparent = 1,
+        /// explicit 2MB pages from the hugetlbfs pool (Linux only)
+        huge_2mb = 2,
+        /// explicit 1GB pages from the hugetlbfs pool (Linux only)
+        huge_1gb = 3
+    };
+
+    /// Return the kind of pages the memory pointed to by p, which must have
+    /// been allocated by one of the host allocators, is backed with. This may
+    /// differ from the requested kind if it wasn't available.
+    HPX_CORE_EXPORT huge_pages get_huge_pages(void const* p) noexcept;
+
+    namespace detail {
+        // Allocate page aligned memory backed by the given kind of pages.
+        // Falls back to transparent huge pages if no explicit huge pages
+        // are available and to ordinary pages if those aren't supported
+        // either.
+        HPX_CORE_EXPORT void* allocate_pages(std::size_t len, huge_pages mode);
+
+        // Free memory allocated with allocate_pages
+        HPX_CORE_EXPORT void deallocate_pages(
+            void* p, std::size_t len) noexcept;
+    }    // namespace detail
+}}}    // namespace hpx::compute::host
@@ -0,0 +1,195 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/compute_local/host/block_allocator.hpp>
+#include <hpx/executors/execution_policy.hpp>
+#include <hpx/iterator_support/counting_shape.hpp>
+#include <hpx/iterator_support/range.hpp>
+#include <hpx/pack_traversal/unwrap.hpp>
+#include <hpx/parallel/util/partitioner.hpp>
+#include <hpx/topology/topology.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace compute { namespace host {
+    namespace detail {
+        // Return the NUMA domain of the worker thread executing the calling
+        // HPX thread (zero if called outside of a worker thread).
+        HPX_CORE_EXPORT std::size_t get_numa_domain_of_current_worker();
+
+        // Move the pages of the given (page aligned) memory area to the
+        // given NUMA domain. Returns the number of pages located on that
+        // domain afterwards.
+        HPX_CORE_EXPORT std::size_t move_pages(
+            void* addr, std::size_t len, std::size_t numa_domain);
+    }    // namespace detail
+
+    /// Return the NUMA domain of each page of the given (page aligned) memory
+    /// area, -1 for pages which were not touched yet.
+    HPX_CORE_EXPORT std::vector<int> get_page_numa_domains(
+        void const* addr, std::size_t len);
+
+    /// The locality_aware_allocator places the pages of the memory it
+    /// allocates according to the execution policy the data will be processed
+    /// with. The allocated elements are split into the same chunks any
+    /// algorithm invoked with this policy on the same number of elements
+    /// uses, and each page is touched first by the worker running the chunk
+    /// the page starts in. If the data is processed differently later on,
+    /// migrate() moves the pages to the domains matching the new chunking.
+    ///
+    /// using allocator_type =
+    ///     hpx::compute::host::locality_aware_allocator<double>;
+    /// using vector_type = hpx::compute::vector<double, allocator_type>;
+    ///
+    /// vector_type v(N, 0.0, allocator_type(hpx::execution::par));
+    /// hpx::for_each(hpx::execution::par, v.begin(), v.end(), ...);
+    ///
+    /// auto policy = hpx::execution::par.with(
+    ///     hpx::execution::static_chunk_size(1024));
+    /// v.get_allocator().migrate(v.data(), v.capacity(), policy);
+    ///
+    template <typename T, typename Policy = hpx::execution::parallel_policy>
+    struct locality_aware_allocator : public detail::policy_allocator<T, Policy>
+    {
+        static_assert(!hpx::is_async_execution_policy_v<Policy>,
+            "the locality_aware_allocator requires a synchronous execution "
+            "policy");
+
+        using policy_type = Policy;
+        using base_type = detail::policy_allocator<T, Policy>;
+
+        using value_type = T;
+        using pointer = T*;
+        using size_type = std::size_t;
+
+        template <typename U>
+        struct rebind
+        {
+            using other = locality_aware_allocator<U, policy_type>;
+        };
+
+        locality_aware_allocator()
+          : base_type(policy_type())
+        {
+        }
+
+        locality_aware_allocator(
+            Policy&& policy, host::huge_pages pages = host::huge_pages::none)
+          : base_type(HPX_MOVE(policy), pages)
+        {
+        }
+
+        locality_aware_allocator(Policy const& policy,
+            host::huge_pages pages = host::huge_pages::none)
+          : base_type(policy, pages)
+        {
+        }
+
+        // Allocates n * sizeof(T) bytes of uninitialized storage and touches
+        // its pages using the workers of the underlying policy.
+        pointer allocate(size_type n, const void* hint = nullptr)
+        {
+            pointer p = base_type::allocate(n, hint);
+            if (p != nullptr)
+            {
+                place_pages(this->policy(), p, n, false);
+            }
+            return p;
+        }
+
+        // Moves the pages of the n elements pointed to by p, which must have
+        // been allocated by this allocator, to the NUMA domains of the
+        // workers running the chunks the given policy splits the elements
+        // into. Returns the number of pages located on the domain of the
+        // worker processing them afterwards.
+        template <typename OtherPolicy>
+        size_type migrate(pointer p, size_type n, OtherPolicy&& policy) const
+        {
+            static_assert(hpx::is_execution_policy_v<std::decay_t<OtherPolicy>>,
+                "migrate requires an execution policy");
+            static_assert(
+                !hpx::is_async_execution_policy_v<std::decay_t<OtherPolicy>>,
+                "migrate requires a synchronous execution policy");
+
+            return place_pages(HPX_FORWARD(OtherPolicy, policy), p, n, true);
+        }
+
+        // Moves the pages according to the policy of this allocator, e.g.
+        // after its executor was bound to different processing units.
+        size_type migrate(pointer p, size_type n) const
+        {
+            return place_pages(this->policy(), p, n, true);
+        }
+
+    private:
+        template <typename ExPolicy>
+        static size_type place_pages(
+            ExPolicy&& policy, pointer p, size_type n, bool move)
+        {
+            if (n == size_type(0))
+            {
+                return 0;
+            }
+
+            size_type const page_size = hpx::threads::get_memory_page_size();
+            HPX_ASSERT((std::size_t(p) & (page_size - 1)) == 0);
+
+            auto irange = hpx::util::detail::make_counting_shape(n);
+
+            using iterator_type = hpx::util::counting_iterator<std::size_t>;
+            using partitioner =
+                parallel::util::partitioner<std::decay_t<ExPolicy>, size_type>;
+
+            char* base = reinterpret_cast<char*>(p);
+            return partitioner::call(
+                HPX_FORWARD(ExPolicy, policy), util::begin(irange), n,
+                [base, page_size, move](
+                    iterator_type it, std::size_t part_size) -> size_type {
+                    // the pages starting in this chunk belong to it
+                    size_type const first =
+                        (*it * sizeof(T) + page_size - 1) / page_size;
+                    size_type const last =
+                        ((*it + part_size) * sizeof(T) + page_size - 1) /
+                        page_size;
+                    if (first >= last)
+                    {
+                        return 0;
+                    }
+
+                    if (move)
+                    {
+                        return detail::move_pages(base + first * page_size,
+                            (last - first) * page_size,
+                            detail::get_numa_domain_of_current_worker());
+                    }
+
+                    // the memory is uninitialized, writing to it is fine
+                    for (size_type page = first; page != last; ++page)
+                    {
+                        *reinterpret_cast<char volatile*>(
+                            base + page * page_size) = 0;
+                    }
+                    return last - first;
+                },
+                hpx::unwrapping([](auto&& results) {
+                    size_type pages = 0;
+                    for (size_type r : results)
+                    {
+                        pages += r;
+                    }
+                    return pages;
+                }));
+        }
+    };
+}}}    // namespace hpx::compute::host
@@ -9,6 +9,7 @@
 
 #include <hpx/config.hpp>
 #include <hpx/assert.hpp>
+#include <hpx/compute_local/host/huge_pages.hpp>
 #include <hpx/async_combinators/wait_all.hpp>
 #include <hpx/execution/executors/execution_information.hpp>
 #include <hpx/execution/executors/static_chunk_size.hpp>
@@ -54,15 +55,20 @@ namespace hpx { namespace parallel { namespace util {
         };
 
     public:
-        numa_allocator(Executors const& executors, hpx::threads::topology& topo)
+        // The memory is backed by the given kind of pages, falling back to
+        // ordinary pages if those are not available
+        numa_allocator(Executors const& executors, hpx::threads::topology& topo,
+            compute::host::huge_pages pages = compute::host::huge_pages::none)
           : executors_(executors)
           , topo_(topo)
+          , huge_pages_(pages)
         {
         }
 
         numa_allocator(numa_allocator const& rhs)
           : executors_(rhs.executors_)
           , topo_(rhs.topo_)
+          , huge_pages_(rhs.huge_pages_)
         {
         }
 
@@ -70,6 +76,7 @@ namespace hpx { namespace parallel { namespace util {
         numa_allocator(numa_allocator<U, Executors> const& rhs)
           : executors_(rhs.executors_)
           , topo_(rhs.topo_)
+          , huge_pages_(rhs.huge_pages_)
         {
         }
 
@@ -87,8 +94,9 @@ namespace hpx { namespace parallel { namespace util {
         pointer allocate(size_type cnt, const void* = nullptr)
         {
             // allocate memory
-            pointer p =
-                reinterpret_cast<pointer>(topo_.allocate(cnt * sizeof(T)));
+            pointer p = reinterpret_cast<pointer>(
+                compute::host::detail::allocate_pages(
+                    cnt * sizeof(T), huge_pages_));
 
             // first touch policy, distribute evenly onto executors
             std::size_t part_size = cnt / executors_.size();
@@ -145,7 +153,7 @@ namespace hpx { namespace parallel { namespace util {
 
         void deallocate(pointer p, size_type cnt) noexcept
         {
-            topo_.deallocate(p, cnt * sizeof(T));
+            compute::host::detail::deallocate_pages(p, cnt * sizeof(T));
         }
 
         // size
@@ -180,5 +188,6 @@ namespace hpx { namespace parallel { namespace util {
 
         Executors const& executors_;
         hpx::threads::topology& topo_;
+        compute::host::huge_pages huge_pages_;
     };
 }}}    // namespace hpx::parallel::util
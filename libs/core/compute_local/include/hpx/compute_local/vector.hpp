@@ -293,9 +293,9 @@ namespace hpx::compute {
         /// Remarks: If an exception is thrown other than by the move constructor
         /// of a non-CopyInsertable T there are no effects.
         ///
-        void resize(size_type /* size */)
+        void resize(size_type size)
         {
-            // TODO: implement this
+            resize_impl(size);
         }
 
         /// Effects: If size <= size(), equivalent to calling pop_back()
@@ -306,9 +306,9 @@ namespace hpx::compute {
         ///
         /// Remarks: If an exception is thrown there are no effects.
         ///
-        void resize(size_type /* size */, T const& /* val */)
+        void resize(size_type size, T const& val)
         {
-            // TODO: implement this
+            resize_impl(size, val);
         }
 
         ///////////////////////////////////////////////////////////////////////
@@ -372,6 +372,56 @@ namespace hpx::compute {
             size_ = 0;
         }
 
+    private:
+        // All new elements are constructed through the allocator, which for
+        // the host block allocators touches the memory on the targets the
+        // allocator is bound to.
+        template <typename... Ts>
+        void resize_impl(size_type size, Ts const&... vs)
+        {
+            if (size <= size_)
+            {
+                alloc_traits::bulk_destroy(alloc_, data_ + size, size_ - size);
+                size_ = size;
+                return;
+            }
+
+            if (size <= capacity_)
+            {
+                alloc_traits::bulk_construct(
+                    alloc_, data_ + size_, size - size_, vs...);
+                size_ = size;
+                return;
+            }
+
+            pointer data = alloc_traits::allocate(alloc_, size);
+#if !defined(__CUDA_ARCH__)
+            try
+#endif
+            {
+                alloc_traits::bulk_construct(alloc_, data, size, vs...);
+            }
+#if !defined(__CUDA_ARCH__)
+            catch (...)
+            {
+                alloc_traits::deallocate(alloc_, data, size);
+                throw;
+            }
+#endif
+            hpx::parallel::util::copy(begin(), end(),
+                iterator(data, 0, alloc_traits::target(alloc_)));
+
+            if (data_ != nullptr)
+            {
+                alloc_traits::bulk_destroy(alloc_, data_, size_);
+                alloc_traits::deallocate(alloc_, data_, capacity_);
+            }
+
+            size_ = size;
+            capacity_ = size;
+            data_ = HPX_MOVE(data);
+        }
+
     private:
         size_type size_;
         size_type capacity_;
@@ -0,0 +1,222 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/compute_local/host/huge_pages.hpp>
+#include <hpx/topology/topology.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <utility>
+
+#if defined(__linux) || defined(linux) || defined(__linux__)
+#include <sys/mman.h>
+#define HPX_COMPUTE_HOST_HAVE_MMAP
+#if !defined(MAP_HUGE_SHIFT)
+#define MAP_HUGE_SHIFT 26
+#endif
+#endif
+
+namespace hpx::compute::host {
+
+    namespace {
+
+        struct mapping
+        {
+            std::size_t length;
+            huge_pages mode;
+        };
+
+        // the memory which is not backed by ordinary pages is mapped by us,
+        // we need to remember the length of the mapping to release it
+        struct mappings
+        {
+            std::mutex mtx;
+            std::map<void const*, mapping> map;
+        };
+
+        mappings& get_mappings()
+        {
+            static mappings m;
+            return m;
+        }
+
+#if defined(HPX_COMPUTE_HOST_HAVE_MMAP)
+        void add_mapping(void const* p, std::size_t length, huge_pages mode)
+        {
+            mappings& m = get_mappings();
+            std::lock_guard<std::mutex> l(m.mtx);
+            m.map.emplace(p, mapping{length, mode});
+        }
+
+        constexpr std::size_t huge_page_size_2mb = std::size_t(1) << 21;
+        constexpr std::size_t huge_page_size_1gb = std::size_t(1) << 30;
+
+        constexpr std::size_t round_up(std::size_t len, std::size_t size)
+        {
+            return (len + size - 1) & ~(size - 1);
+        }
+
+        void* map_hugetlb(std::size_t len, huge_pages mode)
+        {
+#if defined(MAP_HUGETLB)
+            std::size_t const page_size = mode == huge_pages::huge_1gb ?
+                huge_page_size_1gb :
+                huge_page_size_2mb;
+            int const page_shift = mode == huge_pages::huge_1gb ? 30 : 21;
+
+            std::size_t const length = round_up(len, page_size);
+            void* p = mmap(nullptr, length, PROT_READ | PROT_WRITE,
+                MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB |
+                    (page_shift << MAP_HUGE_SHIFT),
+                -1, 0);
+            if (p == MAP_FAILED)
+            {
+                return nullptr;
+            }
+
+            add_mapping(p, length, mode);
+            return p;
+#else
+            (void) len;
+            (void) mode;
+            return nullptr;
+#endif
+        }
+
+        void* map_transparent(std::size_t len)
+        {
+            // the kernel backs a range with transparent huge pages only
+            // where it is aligned to the huge page size
+            std::size_t const length = round_up(len, huge_page_size_2mb);
+            std::size_t const mapped_length = length + huge_page_size_2mb;
+
+            void* mapped = mmap(nullptr, mapped_length, PROT_READ | PROT_WRITE,
+                MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            if (mapped == MAP_FAILED)
+            {
+                return nullptr;
+            }
+
+            char* begin = static_cast<char*>(mapped);
+            char* p = reinterpret_cast<char*>(round_up(
+                reinterpret_cast<std::uintptr_t>(begin), huge_page_size_2mb));
+            char* end = begin + mapped_length;
+
+            // release the parts of the mapping we don't need
+            if (p != begin)
+            {
+                munmap(begin, p - begin);
+            }
+            if (p + length != end)
+            {
+                munmap(p + length, end - (p + length));
+            }
+
+            // if transparent huge pages are disabled this fails, in which
+            // case the memory is backed by ordinary pages
+#if defined(MADV_HUGEPAGE)
+            huge_pages mode = madvise(p, length, MADV_HUGEPAGE) == 0 ?
+                huge_pages::transparent :
+                huge_pages::none;
+#else
+            huge_pages mode = huge_pages::none;
+#endif
+            add_mapping(p, length, mode);
+            return p;
+        }
+#endif
+    }    // namespace
+
+    huge_pages get_huge_pages(void const* p) noexcept
+    {
+        mappings& m = get_mappings();
+        std::lock_guard<std::mutex> l(m.mtx);
+
+        auto it = m.map.find(p);
+        return it != m.map.end() ? it->second.mode : huge_pages::none;
+    }
+
+    namespace detail {
+
+        void* allocate_pages(std::size_t len, huge_pages mode)
+        {
+#if defined(HPX_COMPUTE_HOST_HAVE_MMAP)
+            if (len == 0)
+            {
+                return threads::create_topology().allocate(len);
+            }
+
+            void* p = nullptr;
+            switch (mode)
+            {
+            case huge_pages::huge_1gb:
+                p = map_hugetlb(len, huge_pages::huge_1gb);
+                if (p != nullptr)
+                {
+                    return p;
+                }
+                [[fallthrough]];
+
+            case huge_pages::huge_2mb:
+                p = map_hugetlb(len, huge_pages::huge_2mb);
+                if (p != nullptr)
+                {
+                    return p;
+                }
+                [[fallthrough]];
+
+            case huge_pages::transparent:
+                p = map_transparent(len);
+                if (p != nullptr)
+                {
+                    return p;
+                }
+                break;
+
+            case huge_pages::none:
+                [[fallthrough]];
+            default:
+                break;
+            }
+#else
+            (void) mode;
+#endif
+            return threads::create_topology().allocate(len);
+        }
+
+        void deallocate_pages(void* p, std::size_t len) noexcept
+        {
+#if defined(HPX_COMPUTE_HOST_HAVE_MMAP)
+            {
+                mappings& m = get_mappings();
+                std::unique_lock<std::mutex> l(m.mtx);
+
+                auto it = m.map.find(p);
+                if (it != m.map.end())
+                {
+                    std::size_t const length = it->second.length;
+                    m.map.erase(it);
+                    l.unlock();
+
+                    munmap(p, length);
+                    return;
+                }
+            }
+#endif
+            try
+            {
+                threads::create_topology().deallocate(p, len);
+            }
+            catch (...)
+            {
+                ;    // just ignore errors from create_topology
+            }
+        }
+    }    // namespace detail
+}    // namespace hpx::compute::host
@@ -0,0 +1,156 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/compute_local/host/locality_aware_allocator.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/threading_base/thread_helpers.hpp>
+#include <hpx/threading_base/thread_num_tss.hpp>
+#include <hpx/threading_base/thread_pool_base.hpp>
+#include <hpx/topology/topology.hpp>
+#include <hpx/type_support/unused.hpp>
+
+#include <cerrno>
+#include <cstddef>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#if defined(__linux) || defined(linux) || defined(__linux__)
+#include <linux/mempolicy.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#define HPX_COMPUTE_HOST_HAVE_MOVE_PAGES
+#endif
+
+namespace hpx::compute::host {
+
+    namespace detail {
+
+        std::size_t get_numa_domain_of_current_worker()
+        {
+            error_code ec(throwmode::lightweight);
+            threads::thread_pool_base* pool = this_thread::get_pool(ec);
+            std::size_t const num_thread = get_local_worker_thread_num();
+            if (ec || pool == nullptr || num_thread == std::size_t(-1))
+            {
+                return 0;
+            }
+            return pool->get_numa_domain(num_thread);
+        }
+
+        std::size_t move_pages(
+            void* addr, std::size_t len, std::size_t numa_domain)
+        {
+            std::size_t const page_size = threads::get_memory_page_size();
+            HPX_ASSERT((std::size_t(addr) & (page_size - 1)) == 0);
+
+            std::size_t const count = (len + page_size - 1) / page_size;
+            if (count == 0)
+            {
+                return 0;
+            }
+
+#if defined(HPX_COMPUTE_HOST_HAVE_MOVE_PAGES)
+            std::vector<void*> pages(count);
+            std::vector<int> nodes(count, static_cast<int>(numa_domain));
+            std::vector<int> status(count, -1);
+            for (std::size_t i = 0; i != count; ++i)
+            {
+                pages[i] = static_cast<char*>(addr) + i * page_size;
+            }
+
+            if (syscall(__NR_move_pages, 0, count, pages.data(), nodes.data(),
+                    status.data(), MPOL_MF_MOVE) < 0)
+            {
+                // the kernel was built without NUMA support, there is nothing
+                // the pages could be moved to
+                if (errno == ENOSYS)
+                {
+                    return count;
+                }
+
+                std::string msg(std::strerror(errno));
+                HPX_THROW_EXCEPTION(kernel_error,
+                    "hpx::compute::host::detail::move_pages",
+                    "move_pages failed: {}", msg);
+            }
+
+            std::size_t moved = 0;
+            for (int s : status)
+            {
+                if (s == static_cast<int>(numa_domain))
+                {
+                    ++moved;
+                }
+            }
+            return moved;
+#else
+            // pages can't be migrated on this platform, they stay where they
+            // were touched first
+            HPX_UNUSED(numa_domain);
+            return 0;
+#endif
+        }
+    }    // namespace detail
+
+    std::vector<int> get_page_numa_domains(void const* addr, std::size_t len)
+    {
+        std::size_t const page_size = threads::get_memory_page_size();
+        HPX_ASSERT((std::size_t(addr) & (page_size - 1)) == 0);
+
+        std::size_t const count = (len + page_size - 1) / page_size;
+        std::vector<int> status(count, -1);
+        if (count == 0)
+        {
+            return status;
+        }
+
+#if defined(HPX_COMPUTE_HOST_HAVE_MOVE_PAGES)
+        // passing no target nodes makes move_pages report the domain of each
+        // page instead of moving it, this is faster than asking hwloc for
+        // every single page
+        std::vector<void*> pages(count);
+        for (std::size_t i = 0; i != count; ++i)
+        {
+            pages[i] = const_cast<char*>(static_cast<char const*>(addr)) +
+                i * page_size;
+        }
+
+        if (syscall(__NR_move_pages, 0, count, pages.data(), nullptr,
+                status.data(), 0) == 0)
+        {
+            // negative values are errors, e.g. -ENOENT for pages which were
+            // not touched yet
+            for (int& s : status)
+            {
+                if (s < 0)
+                {
+                    s = -1;
+                }
+            }
+            return status;
+        }
+
+        if (errno != ENOSYS)
+        {
+            std::string msg(std::strerror(errno));
+            HPX_THROW_EXCEPTION(kernel_error,
+                "hpx::compute::host::get_page_numa_domains",
+                "move_pages failed: {}", msg);
+        }
+#endif
+
+        auto const& topo = threads::create_topology();
+        for (std::size_t i = 0; i != count; ++i)
+        {
+            status[i] = topo.get_numa_domain(
+                static_cast<char const*>(addr) + i * page_size);
+        }
+        return status;
+    }
+}    // namespace hpx::compute::host
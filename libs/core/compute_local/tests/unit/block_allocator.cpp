@@ -55,6 +55,72 @@ void test_bulk_allocator(std::size_t count)
     test_block_deallocation(alloc, p, count);
 }
 
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+void test_vector_resize(std::size_t count)
+{
+    using allocator_type = hpx::compute::host::block_allocator<T>;
+    using vector_type = hpx::compute::vector<T, allocator_type>;
+
+    vector_type v(
+        count, T(1), allocator_type(hpx::compute::host::get_local_targets()));
+
+    v.resize(count / 2);
+    HPX_TEST_EQ(v.size(), count / 2);
+    HPX_TEST_EQ(v.capacity(), count);
+
+    // grow within the current capacity
+    v.resize(count, T(2));
+    HPX_TEST_EQ(v.size(), count);
+    HPX_TEST_EQ(v.capacity(), count);
+
+    // grow beyond the current capacity
+    v.resize(2 * count, T(3));
+    HPX_TEST_EQ(v.size(), 2 * count);
+    HPX_TEST(v.capacity() >= 2 * count);
+
+    for (std::size_t i = 0; i != v.size(); ++i)
+    {
+        T const expected = i < count / 2 ? T(1) : (i < count ? T(2) : T(3));
+        HPX_TEST_EQ(v[i], expected);
+    }
+
+    v.resize(0);
+    HPX_TEST(v.empty());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+void test_huge_pages(hpx::compute::host::huge_pages pages, std::size_t count)
+{
+    using allocator_type = hpx::compute::host::block_allocator<T>;
+    using vector_type = hpx::compute::vector<T, allocator_type>;
+
+    allocator_type alloc(hpx::compute::host::get_local_targets(), pages);
+    HPX_TEST(alloc.huge_pages() == pages);
+
+    T* p = alloc.allocate(count);
+
+    // the allocation falls back to smaller pages if the requested ones are
+    // not available
+    HPX_TEST(hpx::compute::host::get_huge_pages(p) <= pages);
+
+    alloc.bulk_construct(p, count, T(1));
+    for (std::size_t i = 0; i != count; ++i)
+    {
+        HPX_TEST_EQ(p[i], T(1));
+    }
+    alloc.bulk_destroy(p, count);
+    alloc.deallocate(p, count);
+
+    vector_type v(count, T(2), alloc);
+    HPX_TEST(hpx::compute::host::get_huge_pages(v.data()) <= pages);
+    for (std::size_t i = 0; i != v.size(); ++i)
+    {
+        HPX_TEST_EQ(v[i], T(2));
+    }
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 std::atomic<std::size_t> construction_count(0);
 std::atomic<std::size_t> destruction_count(0);
@@ -96,6 +162,24 @@ int hpx_main(hpx::program_options::variables_map& vm)
 
     test_bulk_allocator<int>(0);
 
+    {
+        std::size_t count = dis(gen);
+        test_vector_resize<int>(count);
+        test_vector_resize<double>(count);
+    }
+
+    {
+        using hpx::compute::host::huge_pages;
+
+        std::size_t count = dis(gen) * 1024;
+        for (huge_pages pages : {huge_pages::none, huge_pages::transparent,
+                 huge_pages::huge_2mb, huge_pages::huge_1gb})
+        {
+            test_huge_pages<int>(pages, count);
+            test_huge_pages<double>(pages, count);
+        }
+    }
+
     return hpx::finalize();
 }
 
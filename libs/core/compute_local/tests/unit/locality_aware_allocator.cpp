@@ -0,0 +1,153 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/modules/compute_local.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iostream>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+std::size_t count_pages(std::size_t bytes)
+{
+    std::size_t const page_size = hpx::threads::get_memory_page_size();
+    return (bytes + page_size - 1) / page_size;
+}
+
+void test_pages_touched(void const* p, std::size_t bytes)
+{
+    std::vector<int> domains =
+        hpx::compute::host::get_page_numa_domains(p, bytes);
+    HPX_TEST_EQ(domains.size(), count_pages(bytes));
+
+    for (int domain : domains)
+    {
+        HPX_TEST_LTE(0, domain);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename Policy>
+void test_allocator(Policy const& policy, std::size_t count)
+{
+    using allocator_type =
+        hpx::compute::host::locality_aware_allocator<T, Policy>;
+
+    allocator_type alloc(policy);
+    T* p = alloc.allocate(count);
+
+    // all pages are touched by the workers of the policy when allocating
+    test_pages_touched(p, count * sizeof(T));
+
+    alloc.bulk_construct(p, count, T(42));
+    for (std::size_t i = 0; i != count; ++i)
+    {
+        HPX_TEST_EQ(p[i], T(42));
+    }
+
+    alloc.bulk_destroy(p, count);
+    alloc.deallocate(p, count);
+}
+
+template <typename T, typename Policy>
+void test_vector_migrate(Policy const& policy, std::size_t count)
+{
+    using allocator_type =
+        hpx::compute::host::locality_aware_allocator<T, Policy>;
+    using vector_type = hpx::compute::vector<T, allocator_type>;
+
+    vector_type v(count, T(1), allocator_type(policy));
+    std::size_t const pages = count_pages(v.capacity() * sizeof(T));
+
+    // move the pages to match a chunking different from the one used
+    // for the allocation
+    std::size_t const page_elements =
+        (std::max)(hpx::threads::get_memory_page_size() / sizeof(T),
+            std::size_t(1));
+    std::size_t moved = v.get_allocator().migrate(v.data(), v.capacity(),
+        hpx::execution::par.with(
+            hpx::execution::static_chunk_size(page_elements)));
+    HPX_TEST_LTE(moved, pages);
+    test_pages_touched(v.data(), v.capacity() * sizeof(T));
+
+    // and back to the chunking of the allocator
+    moved = v.get_allocator().migrate(v.data(), v.capacity());
+    HPX_TEST_LTE(moved, pages);
+    test_pages_touched(v.data(), v.capacity() * sizeof(T));
+
+    // migrating the pages does not change the data
+    for (std::size_t i = 0; i != v.size(); ++i)
+    {
+        HPX_TEST_EQ(v[i], T(1));
+    }
+}
+
+template <typename Policy>
+void test_policy(Policy const& policy, std::size_t count)
+{
+    test_allocator<int>(policy, count);
+    test_allocator<double>(policy, count);
+    test_allocator<int>(policy, 0);
+
+    test_vector_migrate<int>(policy, count);
+    test_vector_migrate<double>(policy, count);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    unsigned int seed = (unsigned int) std::random_device{}();
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    std::mt19937 gen(seed);
+    std::uniform_int_distribution<> dis(1, 512);
+
+    // spread the elements over a couple of pages
+    std::size_t count = dis(gen) * 1024;
+
+    test_policy(hpx::execution::par, count);
+    test_policy(
+        hpx::execution::par.with(hpx::execution::static_chunk_size(4096)),
+        count);
+
+    hpx::compute::host::block_executor<> exec(
+        hpx::compute::host::numa_domains());
+    test_policy(hpx::execution::par.on(exec), count);
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    hpx::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::init(argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
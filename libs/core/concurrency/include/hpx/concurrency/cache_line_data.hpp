@@ -139,6 +139,12 @@ namespace hpx {
             {
             }
 
+            template <typename... Ts>
+            explicit cache_aligned_data_derived(std::in_place_t, Ts&&... ts)
+              : Data(HPX_FORWARD(Ts, ts)...)
+            {
+            }
+
             //  cppcheck-suppress unusedVariable
             char cacheline_pad[detail::get_cache_line_padding_size(
                 // NOLINTNEXTLINE(bugprone-sizeof-expression)
@@ -160,6 +166,12 @@ namespace hpx {
             {
             }
 
+            template <typename... Ts>
+            explicit cache_aligned_data_derived(std::in_place_t, Ts&&... ts)
+              : Data(HPX_FORWARD(Ts, ts)...)
+            {
+            }
+
             // no need to pad to cache line size
         };
 
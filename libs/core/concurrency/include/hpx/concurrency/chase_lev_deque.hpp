@@ -0,0 +1,210 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This is an implementation of the dynamic circular work-stealing deque
+// described in:
+//
+//   D. Chase and Y. Lev, "Dynamic Circular Work-Stealing Deque", SPAA 2005
+//
+// using the memory orderings derived in:
+//
+//   N. M. Le, A. Pop, A. Cohen, and F. Zappa Nardelli, "Correct and Efficient
+//   Work-Stealing for Weak Memory Models", PPoPP 2013
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace concurrency {
+
+    /// A single-owner, multiple-thief work-stealing deque.
+    ///
+    /// Only one thread (the owner) may call \a push_bottom and
+    /// \a pop_bottom, any thread may call \a steal. The owner operations do
+    /// not perform any atomic read-modify-write operations unless the deque
+    /// holds a single element only. Thieves compete for the top element using
+    /// a compare-and-swap. The underlying buffer grows as needed. Retired
+    /// buffers are kept alive until the deque is destroyed as concurrent
+    /// thieves may still read from them.
+    template <typename T>
+    class chase_lev_deque
+    {
+        static_assert(std::is_trivially_copyable<T>::value,
+            "chase_lev_deque requires trivially copyable elements");
+
+        struct buffer
+        {
+            explicit buffer(std::int64_t capacity)
+              : mask_(capacity - 1)
+              , data_(new std::atomic<T>[std::size_t(capacity)])
+            {
+                HPX_ASSERT(capacity > 0 && (capacity & mask_) == 0);
+            }
+
+            std::int64_t capacity() const noexcept
+            {
+                return mask_ + 1;
+            }
+
+            T load(std::int64_t i) const noexcept
+            {
+                return data_[i & mask_].load(std::memory_order_relaxed);
+            }
+
+            void store(std::int64_t i, T val) noexcept
+            {
+                data_[i & mask_].store(val, std::memory_order_relaxed);
+            }
+
+            // create a buffer of twice the size holding the elements in
+            // [top, bottom)
+            buffer* grow(std::int64_t bottom, std::int64_t top) const
+            {
+                buffer* b = new buffer(2 * capacity());
+                for (std::int64_t i = top; i != bottom; ++i)
+                {
+                    b->store(i, load(i));
+                }
+                return b;
+            }
+
+            std::int64_t mask_;
+            std::unique_ptr<std::atomic<T>[]> data_;
+        };
+
+    public:
+        using value_type = T;
+        using size_type = std::size_t;
+
+        explicit chase_lev_deque(size_type initial_capacity = 64)
+        {
+            // the capacity has to be a power of two
+            std::int64_t capacity = 1;
+            while (capacity < std::int64_t(initial_capacity))
+            {
+                capacity <<= 1;
+            }
+
+            top_.data_.store(0, std::memory_order_relaxed);
+            bottom_.data_.store(0, std::memory_order_relaxed);
+
+            retired_.emplace_back(new buffer(capacity));
+            buffer_.store(retired_.back().get(), std::memory_order_relaxed);
+        }
+
+        chase_lev_deque(chase_lev_deque const&) = delete;
+        chase_lev_deque& operator=(chase_lev_deque const&) = delete;
+
+        /// Add an element at the bottom of the deque (owner only).
+        void push_bottom(T val)
+        {
+            std::int64_t b = bottom_.data_.load(std::memory_order_relaxed);
+            std::int64_t t = top_.data_.load(std::memory_order_acquire);
+            buffer* a = buffer_.load(std::memory_order_relaxed);
+
+            if (b - t > a->capacity() - 1)
+            {
+                // the buffer is full, replace it by a larger one
+                retired_.emplace_back(a->grow(b, t));
+                a = retired_.back().get();
+                buffer_.store(a, std::memory_order_release);
+            }
+
+            a->store(b, val);
+            std::atomic_thread_fence(std::memory_order_release);
+            bottom_.data_.store(b + 1, std::memory_order_relaxed);
+        }
+
+        /// Remove the element at the bottom of the deque (owner only).
+        bool pop_bottom(T& val)
+        {
+            std::int64_t b = bottom_.data_.load(std::memory_order_relaxed) - 1;
+            buffer* a = buffer_.load(std::memory_order_relaxed);
+            bottom_.data_.store(b, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            std::int64_t t = top_.data_.load(std::memory_order_relaxed);
+
+            if (t > b)
+            {
+                // the deque is empty
+                bottom_.data_.store(b + 1, std::memory_order_relaxed);
+                return false;
+            }
+
+            val = a->load(b);
+            if (t != b)
+            {
+                // more than one element was left, no thief can interfere
+                return true;
+            }
+
+            // this is the last element, compete with the thieves for it
+            bool result = top_.data_.compare_exchange_strong(
+                t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+            bottom_.data_.store(b + 1, std::memory_order_relaxed);
+            return result;
+        }
+
+        /// Remove the element at the top of the deque (any thread). This
+        /// may fail spuriously if another thread removes the same element
+        /// concurrently.
+        bool steal(T& val)
+        {
+            std::int64_t t = top_.data_.load(std::memory_order_acquire);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            std::int64_t b = bottom_.data_.load(std::memory_order_acquire);
+
+            if (t >= b)
+            {
+                return false;
+            }
+
+            buffer* a = buffer_.load(std::memory_order_acquire);
+            T x = a->load(t);
+            if (!top_.data_.compare_exchange_strong(t, t + 1,
+                    std::memory_order_seq_cst, std::memory_order_relaxed))
+            {
+                return false;
+            }
+
+            val = x;
+            return true;
+        }
+
+        bool empty() const noexcept
+        {
+            std::int64_t b = bottom_.data_.load(std::memory_order_relaxed);
+            std::int64_t t = top_.data_.load(std::memory_order_relaxed);
+            return b <= t;
+        }
+
+        size_type size() const noexcept
+        {
+            std::int64_t b = bottom_.data_.load(std::memory_order_relaxed);
+            std::int64_t t = top_.data_.load(std::memory_order_relaxed);
+            return b > t ? size_type(b - t) : 0;
+        }
+
+    private:
+        // top_ is written by thieves, bottom_ by the owner only
+        util::cache_aligned_data<std::atomic<std::int64_t>> top_;
+        util::cache_aligned_data<std::atomic<std::int64_t>> bottom_;
+        std::atomic<buffer*> buffer_;
+
+        // all buffers ever used, accessed by the owner only
+        std::vector<std::unique_ptr<buffer>> retired_;
+    };
+}}    // namespace hpx::concurrency
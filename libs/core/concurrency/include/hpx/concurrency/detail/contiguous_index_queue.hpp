@@ -13,6 +13,7 @@
 #include <atomic>
 #include <cstdint>
 #include <type_traits>
+#include <utility>
 
 namespace hpx { namespace concurrency { namespace detail {
 
@@ -177,6 +178,51 @@ namespace hpx { namespace concurrency { namespace detail {
             return hpx::optional<T>(HPX_MOVE(index));
         }
 
+        /// \brief Attempt to pop the right half of the remaining items.
+        ///
+        /// Attempt to pop the right (end) half of the items left in the queue,
+        /// rounded up. If no items are left hpx::nullopt is returned,
+        /// otherwise the half-open range of popped items is returned.
+        constexpr hpx::optional<std::pair<T, T>> pop_right_half() noexcept
+        {
+            range desired_range{0, 0};
+            T middle = 0;
+
+            range expected_range =
+                current_range.data_.load(std::memory_order_relaxed);
+
+            do
+            {
+                if (expected_range.empty())
+                {
+                    return hpx::nullopt;
+                }
+
+                middle = expected_range.first +
+                    (expected_range.last - expected_range.first) / 2;
+                desired_range = range{expected_range.first, middle};
+            } while (!current_range.data_.compare_exchange_weak(
+                expected_range, desired_range));
+
+            return hpx::optional<std::pair<T, T>>(
+                std::make_pair(middle, expected_range.last));
+        }
+
+        /// \brief Refill an empty queue with the given range.
+        ///
+        /// Contrary to reset, this may be called while other threads are
+        /// popping items from the queue. The queue must be empty, i.e. the
+        /// other threads either observe the empty queue or the new range.
+        ///
+        /// \param first Beginning of the new range.
+        /// \param last End of the new range.
+        constexpr void refill(T first, T last) noexcept
+        {
+            HPX_ASSERT(empty());
+            HPX_ASSERT(first <= last);
+            current_range.data_.store(range{first, last});
+        }
+
         constexpr bool empty() const noexcept
         {
             return current_range.data_.load(std::memory_order_relaxed).empty();
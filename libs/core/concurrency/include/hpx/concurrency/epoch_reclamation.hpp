@@ -0,0 +1,87 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace hpx { namespace util {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Epoch based memory reclamation for lock-free data structures.
+    //
+    // A node which was unlinked from a lock-free data structure is handed to
+    // epoch_retire instead of being deleted right away. It is deleted once
+    // all threads which might still hold a reference to it have passed a
+    // quiescent state, i.e. a point in their execution where they don't
+    // hold any references into the lock-free data structures.
+    //
+    // The worker threads of the HPX thread pools pass a quiescent state
+    // whenever their scheduling loop switches between HPX threads, and they
+    // go offline (don't hold back the reclamation) while they are idle.
+    // Reading a data structure does not require any synchronization beyond
+    // its own, but an HPX thread must not suspend between loading a pointer
+    // to a node and the last access to that node.
+    //
+    // Other threads (which are not running a scheduling loop) are offline
+    // by default. They have to use an epoch_online_guard while accessing
+    // the data structures and have to call epoch_quiescent_state
+    // periodically if they stay online for a long time.
+
+    // Delete the object as soon as no thread can hold a reference to it
+    // anymore.
+    HPX_CORE_EXPORT void epoch_retire(void* p, void (*deleter)(void*));
+
+    template <typename T>
+    void epoch_retire(T* p)
+    {
+        epoch_retire(static_cast<void*>(p),
+            [](void* p) { delete static_cast<T*>(p); });
+    }
+
+    // Announce that the calling thread doesn't hold any references to
+    // retired objects. This brings the calling thread online if it was
+    // offline.
+    HPX_CORE_EXPORT void epoch_quiescent_state() noexcept;
+
+    // The calling thread won't access any of the data structures until it
+    // calls epoch_quiescent_state (or epoch_thread_online) again.
+    HPX_CORE_EXPORT void epoch_thread_offline() noexcept;
+
+    // The calling thread may access the data structures.
+    HPX_CORE_EXPORT void epoch_thread_online() noexcept;
+
+    // Try to advance the global epoch and to delete the objects retired by
+    // the calling thread or by exited threads. Returns the number of
+    // objects which are still waiting to be deleted.
+    HPX_CORE_EXPORT std::size_t epoch_try_reclaim();
+
+    // the current global epoch, for testing purposes
+    HPX_CORE_EXPORT std::uint64_t epoch_current() noexcept;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Brings the calling thread online for the lifetime of the guard. This
+    // is needed only on threads which are not HPX worker threads.
+    class epoch_online_guard
+    {
+    public:
+        epoch_online_guard() noexcept
+        {
+            epoch_thread_online();
+        }
+
+        ~epoch_online_guard()
+        {
+            epoch_thread_offline();
+        }
+
+        epoch_online_guard(epoch_online_guard const&) = delete;
+        epoch_online_guard& operator=(epoch_online_guard const&) = delete;
+    };
+}}    // namespace hpx::util
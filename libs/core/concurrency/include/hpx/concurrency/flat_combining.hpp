@@ -0,0 +1,183 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
+#include <hpx/execution_base/this_thread.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <utility>
+
+namespace hpx { namespace util {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Flat combining for data structures which are protected by a single
+    // lock and which receive many short updates from concurrent threads.
+    //
+    // A thread which finds the lock taken publishes its operation in one of
+    // the slots instead of waiting for the lock. Whichever thread acquires
+    // the lock next (the combiner) applies all published operations in one
+    // go, which keeps the data structure in its cache and hands the lock
+    // over far less often.
+    //
+    // The lock itself is not owned by the flat_combining object, other code
+    // may still acquire it directly (e.g. for operations which have to
+    // return results or which are too expensive to be combined). Operations
+    // are invoked by the combining thread, they must not rely on running on
+    // the publishing thread and must not acquire the lock themselves.
+    template <typename Mutex, std::size_t NumSlots = 32>
+    class flat_combining
+    {
+        static_assert(NumSlots != 0, "flat_combining needs at least one slot");
+
+        enum class slot_state : std::uint8_t
+        {
+            free,
+            claimed,
+            published,
+            done
+        };
+
+        struct slot
+        {
+            std::atomic<slot_state> state{slot_state::free};
+            void (*invoke)(void*) = nullptr;
+            void* f = nullptr;
+            std::exception_ptr exception;
+        };
+
+    public:
+        explicit flat_combining(Mutex& mtx) noexcept
+          : mtx_(mtx)
+        {
+        }
+
+        flat_combining(flat_combining const&) = delete;
+        flat_combining& operator=(flat_combining const&) = delete;
+
+        // Apply f while holding the lock, either on the calling thread or on
+        // the thread which holds the lock at the time. Returns once f has
+        // been applied, exceptions thrown by f are rethrown on the calling
+        // thread.
+        template <typename F>
+        void apply(F&& f)
+        {
+            using function_type = std::remove_reference_t<F>;
+
+            // uncontended case, apply the operation right away
+            if (mtx_.try_lock())
+            {
+                std::unique_lock<Mutex> l(mtx_, std::adopt_lock);
+                f();
+                combine();
+                return;
+            }
+
+            slot* s = claim_slot();
+            if (s == nullptr)
+            {
+                // all slots are in use, wait for the lock instead
+                std::unique_lock<Mutex> l(mtx_);
+                f();
+                combine();
+                return;
+            }
+
+            s->invoke = [](void* p) { (*static_cast<function_type*>(p))(); };
+            s->f = const_cast<void*>(
+                static_cast<void const volatile*>(std::addressof(f)));
+            s->state.store(slot_state::published, std::memory_order_release);
+
+            for (std::size_t k = 0;
+                 s->state.load(std::memory_order_acquire) != slot_state::done;
+                 ++k)
+            {
+                if (mtx_.try_lock())
+                {
+                    // become the combiner, this applies our own operation
+                    // as well
+                    std::unique_lock<Mutex> l(mtx_, std::adopt_lock);
+                    combine();
+                }
+                else
+                {
+                    hpx::execution_base::this_thread::yield_k(
+                        k, "hpx::util::flat_combining::apply");
+                }
+            }
+
+            std::exception_ptr e = HPX_MOVE(s->exception);
+            s->exception = nullptr;
+            s->state.store(slot_state::free, std::memory_order_release);
+
+            if (e)
+            {
+                std::rethrow_exception(HPX_MOVE(e));
+            }
+        }
+
+    private:
+        static std::size_t slot_hint() noexcept
+        {
+            static std::atomic<std::size_t> next_hint(0);
+            static thread_local std::size_t const hint =
+                next_hint.fetch_add(1, std::memory_order_relaxed);
+            return hint;
+        }
+
+        slot* claim_slot() noexcept
+        {
+            std::size_t const hint = slot_hint();
+            for (std::size_t i = 0; i != NumSlots; ++i)
+            {
+                slot& s = slots_[(hint + i) % NumSlots];
+
+                slot_state expected = slot_state::free;
+                if (s.state.load(std::memory_order_relaxed) == expected &&
+                    s.state.compare_exchange_strong(expected,
+                        slot_state::claimed, std::memory_order_acquire))
+                {
+                    return &s;
+                }
+            }
+            return nullptr;
+        }
+
+        // apply all published operations, the lock is held
+        void combine() noexcept
+        {
+            for (slot& s : slots_)
+            {
+                if (s.state.load(std::memory_order_acquire) !=
+                    slot_state::published)
+                {
+                    continue;
+                }
+
+                try
+                {
+                    s.invoke(s.f);
+                }
+                catch (...)
+                {
+                    s.exception = std::current_exception();
+                }
+                s.state.store(slot_state::done, std::memory_order_release);
+            }
+        }
+
+        Mutex& mtx_;
+        util::cache_aligned_data_derived<slot> slots_[NumSlots];
+    };
+}}    // namespace hpx::util
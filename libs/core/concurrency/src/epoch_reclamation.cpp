@@ -0,0 +1,359 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/concurrency/epoch_reclamation.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace util {
+
+    namespace {
+
+        ///////////////////////////////////////////////////////////////////////
+        // An object retired in a given epoch may still be referenced by
+        // threads which announced this or the previous epoch. It can be
+        // deleted once the global epoch is two epochs ahead, as advancing the
+        // epoch requires all online threads to announce the current epoch.
+        //
+        // Every thread keeps three lists of retired objects (for the current
+        // epoch and the two preceding ones), a list is reused (after
+        // deleting its objects) once the epoch has advanced by three.
+        constexpr std::size_t num_limbo_lists = 3;
+
+        // the number of retired objects after which a thread tries to
+        // advance the global epoch, and the number of quiescent states
+        // after which a thread with pending objects tries again
+        constexpr std::size_t retire_threshold = 64;
+        constexpr std::size_t quiescent_threshold = 64;
+
+        // an epoch of zero marks a thread as being offline
+        constexpr std::uint64_t offline = 0;
+
+        struct retired_object
+        {
+            void* p;
+            void (*deleter)(void*);
+        };
+
+        struct limbo_list
+        {
+            std::uint64_t epoch = 0;
+            std::vector<retired_object> objects;
+
+            void reclaim() noexcept
+            {
+                for (retired_object const& r : objects)
+                {
+                    r.deleter(r.p);
+                }
+                objects.clear();
+            }
+        };
+
+        struct epoch_record
+        {
+            // the epoch announced by the owning thread
+            std::atomic<std::uint64_t> epoch{offline};
+            std::atomic<bool> in_use{true};
+            epoch_record* next = nullptr;
+
+            // accessed by the owning thread only
+            limbo_list limbo[num_limbo_lists];
+            std::size_t pending = 0;
+            std::size_t retired_since_advance = 0;
+            std::size_t quiescent_since_advance = 0;
+        };
+
+        // the objects retired by exited threads, tagged with their epoch
+        struct orphans
+        {
+            std::mutex mtx;
+            std::vector<std::pair<std::uint64_t, retired_object>> objects;
+        };
+
+        // the global epoch starts at one, zero marks offline threads
+        std::atomic<std::uint64_t> global_epoch{1};
+
+        // all records ever created, records are never removed but reused
+        std::atomic<epoch_record*> records{nullptr};
+
+        orphans& get_orphans()
+        {
+            // leaked, threads may exit after the static objects have been
+            // destroyed
+            static orphans* o = new orphans;
+            return *o;
+        }
+
+        epoch_record* acquire_record()
+        {
+            // reuse the record of an exited thread
+            for (epoch_record* r = records.load(std::memory_order_acquire);
+                 r != nullptr; r = r->next)
+            {
+                bool expected = false;
+                if (!r->in_use.load(std::memory_order_relaxed) &&
+                    r->in_use.compare_exchange_strong(
+                        expected, true, std::memory_order_acquire))
+                {
+                    return r;
+                }
+            }
+
+            epoch_record* r = new epoch_record;
+            epoch_record* head = records.load(std::memory_order_relaxed);
+            do
+            {
+                r->next = head;
+            } while (!records.compare_exchange_weak(head, r,
+                std::memory_order_release, std::memory_order_relaxed));
+            return r;
+        }
+
+        void release_record(epoch_record* r) noexcept
+        {
+            r->epoch.store(offline, std::memory_order_seq_cst);
+
+            if (r->pending != 0)
+            {
+                orphans& o = get_orphans();
+                std::lock_guard<std::mutex> l(o.mtx);
+                for (limbo_list& list : r->limbo)
+                {
+                    for (retired_object const& obj : list.objects)
+                    {
+                        o.objects.emplace_back(list.epoch, obj);
+                    }
+                    list.objects.clear();
+                }
+                r->pending = 0;
+            }
+
+            r->in_use.store(false, std::memory_order_release);
+        }
+
+        struct epoch_record_releaser
+        {
+            explicit epoch_record_releaser(epoch_record*& r) noexcept
+              : record(r)
+            {
+            }
+
+            epoch_record_releaser(epoch_record_releaser const&) = delete;
+            epoch_record_releaser& operator=(
+                epoch_record_releaser const&) = delete;
+
+            ~epoch_record_releaser()
+            {
+                release_record(record);
+                record = nullptr;
+            }
+
+            epoch_record*& record;
+        };
+
+        epoch_record* get_record()
+        {
+            static thread_local epoch_record* record = nullptr;
+            if (HPX_UNLIKELY(record == nullptr))
+            {
+                record = acquire_record();
+
+                // a record acquired again after the releaser was destroyed
+                // is not released anymore
+                static thread_local epoch_record_releaser releaser(record);
+            }
+            return record;
+        }
+
+        // advance the global epoch if all online threads have announced it
+        std::uint64_t try_advance() noexcept
+        {
+            std::uint64_t current =
+                global_epoch.load(std::memory_order_seq_cst);
+            for (epoch_record* r = records.load(std::memory_order_acquire);
+                 r != nullptr; r = r->next)
+            {
+                std::uint64_t const e =
+                    r->epoch.load(std::memory_order_seq_cst);
+                if (e != offline && e != current)
+                {
+                    return current;
+                }
+            }
+
+            if (global_epoch.compare_exchange_strong(
+                    current, current + 1, std::memory_order_seq_cst))
+            {
+                return current + 1;
+            }
+            return current;
+        }
+
+        // delete the objects of the calling thread which are safe to delete
+        void reclaim(epoch_record* r, std::uint64_t current) noexcept
+        {
+            for (limbo_list& list : r->limbo)
+            {
+                if (!list.objects.empty() && list.epoch + 2 <= current)
+                {
+                    r->pending -= list.objects.size();
+                    list.reclaim();
+                }
+            }
+        }
+
+        std::size_t reclaim_orphans(std::uint64_t current)
+        {
+            orphans& o = get_orphans();
+
+            std::vector<retired_object> ready;
+            {
+                std::unique_lock<std::mutex> l(o.mtx, std::try_to_lock);
+                if (!l.owns_lock() || o.objects.empty())
+                {
+                    return 0;
+                }
+
+                auto it = o.objects.begin();
+                while (it != o.objects.end())
+                {
+                    if (it->first + 2 <= current)
+                    {
+                        ready.push_back(it->second);
+                        *it = o.objects.back();
+                        o.objects.pop_back();
+                    }
+                    else
+                    {
+                        ++it;
+                    }
+                }
+            }
+
+            for (retired_object const& obj : ready)
+            {
+                obj.deleter(obj.p);
+            }
+            return ready.size();
+        }
+
+        void announce(epoch_record* r, std::uint64_t current) noexcept
+        {
+            r->epoch.store(current, std::memory_order_seq_cst);
+
+            // the accesses following the quiescent state must not be
+            // reordered with the announcement
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+        }
+    }    // namespace
+
+    ///////////////////////////////////////////////////////////////////////////
+    void epoch_retire(void* p, void (*deleter)(void*))
+    {
+        HPX_ASSERT(p != nullptr && deleter != nullptr);
+
+        epoch_record* r = get_record();
+
+        // the object has to be unlinked before its epoch is determined
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        std::uint64_t const current =
+            global_epoch.load(std::memory_order_seq_cst);
+
+        limbo_list& list = r->limbo[current % num_limbo_lists];
+        if (list.epoch != current)
+        {
+            // the list holds objects retired at least three epochs ago
+            HPX_ASSERT(list.objects.empty() || list.epoch + 2 <= current);
+            r->pending -= list.objects.size();
+            list.reclaim();
+            list.epoch = current;
+        }
+
+        list.objects.push_back(retired_object{p, deleter});
+        ++r->pending;
+
+        if (++r->retired_since_advance >= retire_threshold)
+        {
+            // the calling thread may still hold references, it is not in a
+            // quiescent state and can't announce the new epoch
+            r->retired_since_advance = 0;
+
+            std::uint64_t const advanced = try_advance();
+            reclaim(r, advanced);
+            reclaim_orphans(advanced);
+        }
+    }
+
+    void epoch_quiescent_state() noexcept
+    {
+        epoch_record* r = get_record();
+
+        std::uint64_t current = global_epoch.load(std::memory_order_acquire);
+        if (r->epoch.load(std::memory_order_relaxed) != current)
+        {
+            announce(r, current);
+            reclaim(r, current);
+        }
+
+        // threads with pending objects try to advance the epoch from time
+        // to time, the other threads only announce the epoch
+        if (r->pending != 0 &&
+            ++r->quiescent_since_advance >= quiescent_threshold)
+        {
+            r->quiescent_since_advance = 0;
+
+            current = try_advance();
+            if (r->epoch.load(std::memory_order_relaxed) != current)
+            {
+                announce(r, current);
+            }
+            reclaim(r, current);
+        }
+    }
+
+    void epoch_thread_offline() noexcept
+    {
+        get_record()->epoch.store(offline, std::memory_order_seq_cst);
+    }
+
+    void epoch_thread_online() noexcept
+    {
+        announce(get_record(), global_epoch.load(std::memory_order_seq_cst));
+    }
+
+    std::size_t epoch_try_reclaim()
+    {
+        epoch_record* r = get_record();
+
+        std::uint64_t const current = try_advance();
+
+        // an online thread moves on to the new epoch, it doesn't hold any
+        // references while calling this function
+        if (r->epoch.load(std::memory_order_relaxed) != offline &&
+            r->epoch.load(std::memory_order_relaxed) != current)
+        {
+            announce(r, current);
+        }
+
+        reclaim(r, current);
+        reclaim_orphans(current);
+
+        return r->pending;
+    }
+
+    std::uint64_t epoch_current() noexcept
+    {
+        return global_epoch.load(std::memory_order_acquire);
+    }
+}}    // namespace hpx::util
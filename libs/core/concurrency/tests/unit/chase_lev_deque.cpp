@@ -0,0 +1,167 @@
+////////////////////////////////////////////////////////////////////////////////
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#include <hpx/config.hpp>
+#include <hpx/concurrency/chase_lev_deque.hpp>
+#include <hpx/functional/bind.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <hpx/modules/program_options.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+using deque = hpx::concurrency::chase_lev_deque<std::uint64_t>;
+
+std::uint64_t threads = 4;
+std::uint64_t items = 100000;
+
+std::atomic<std::uint64_t> consumed(0);
+std::vector<std::atomic<std::uint64_t>*> seen;
+
+void consume(std::uint64_t val)
+{
+    HPX_TEST_LT(val, items);
+    seen[val]->fetch_add(1, std::memory_order_relaxed);
+    consumed.fetch_add(1, std::memory_order_relaxed);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_owner_only()
+{
+    // start with a small buffer to exercise growing the deque
+    deque d(2);
+    HPX_TEST(d.empty());
+
+    for (std::uint64_t i = 0; i != 100; ++i)
+        d.push_bottom(i);
+
+    HPX_TEST_EQ(d.size(), std::size_t(100));
+
+    // the owner pops in LIFO order, thieves steal in FIFO order
+    std::uint64_t val = 0;
+    HPX_TEST(d.pop_bottom(val));
+    HPX_TEST_EQ(val, std::uint64_t(99));
+    HPX_TEST(d.steal(val));
+    HPX_TEST_EQ(val, std::uint64_t(0));
+
+    for (std::uint64_t i = 98; i != 0; --i)
+    {
+        HPX_TEST(d.pop_bottom(val));
+        HPX_TEST_EQ(val, i);
+    }
+
+    HPX_TEST(d.empty());
+    HPX_TEST(!d.pop_bottom(val));
+    HPX_TEST(!d.steal(val));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void thief(deque& d, std::atomic<bool>& done)
+{
+    std::uint64_t val = 0;
+    while (!done.load(std::memory_order_acquire) || !d.empty())
+    {
+        if (d.steal(val))
+            consume(val);
+    }
+}
+
+void test_concurrent_steal()
+{
+    deque d;
+    std::atomic<bool> done(false);
+
+    std::vector<std::thread> tg;
+    for (std::uint64_t i = 1; i < threads; ++i)
+    {
+        tg.push_back(
+            std::thread(hpx::bind(&thief, std::ref(d), std::ref(done))));
+    }
+
+    // the owner interleaves pushing and popping while thieves are active
+    std::uint64_t val = 0;
+    for (std::uint64_t i = 0; i != items; ++i)
+    {
+        d.push_bottom(i);
+        if (i % 3 == 0 && d.pop_bottom(val))
+            consume(val);
+    }
+
+    while (d.pop_bottom(val))
+        consume(val);
+
+    done.store(true, std::memory_order_release);
+
+    for (std::thread& t : tg)
+    {
+        if (t.joinable())
+            t.join();
+    }
+
+    // every item has to be consumed exactly once
+    HPX_TEST_EQ(consumed.load(), items);
+    for (std::uint64_t i = 0; i != items; ++i)
+        HPX_TEST_EQ(seen[i]->load(), std::uint64_t(1));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main(int argc, char** argv)
+{
+    using hpx::program_options::command_line_parser;
+    using hpx::program_options::notify;
+    using hpx::program_options::options_description;
+    using hpx::program_options::store;
+    using hpx::program_options::value;
+    using hpx::program_options::variables_map;
+
+    variables_map vm;
+
+    options_description desc_cmdline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    desc_cmdline.add_options()
+        ("help,h", "print out program usage (this message)")
+        ("threads,t", value<std::uint64_t>(&threads)->default_value(4),
+         "the number of threads accessing the deque")
+        ("items,i", value<std::uint64_t>(&items)->default_value(100000),
+         "the number of items to push onto the deque")
+    ;
+    // clang-format on
+
+    store(command_line_parser(argc, argv)
+              .options(desc_cmdline)
+              .allow_unregistered()
+              .run(),
+        vm);
+
+    notify(vm);
+
+    // print help screen
+    if (vm.count("help"))
+    {
+        std::cout << desc_cmdline;
+        return hpx::util::report_errors();
+    }
+
+    for (std::uint64_t i = 0; i != items; ++i)
+        seen.push_back(new std::atomic<std::uint64_t>(0));
+
+    test_owner_only();
+    test_concurrent_steal();
+
+    for (std::atomic<std::uint64_t>* p : seen)
+        delete p;
+
+    return hpx::util::report_errors();
+}
@@ -90,6 +90,43 @@ void test_basic()
         HPX_TEST(!q.pop_left());
         HPX_TEST(!q.pop_right());
     }
+
+    {
+        // Popping the right half should leave the left half in the queue.
+        std::uint32_t first = 3;
+        std::uint32_t last = 8;
+        hpx::concurrency::detail::contiguous_index_queue<> q{first, last};
+
+        auto half = q.pop_right_half();
+        HPX_TEST(half);
+        HPX_TEST_EQ(half->first, std::uint32_t(5));
+        HPX_TEST_EQ(half->second, last);
+
+        half = q.pop_right_half();
+        HPX_TEST(half);
+        HPX_TEST_EQ(half->first, std::uint32_t(4));
+        HPX_TEST_EQ(half->second, std::uint32_t(5));
+
+        // The last item is popped as a range of size one.
+        half = q.pop_right_half();
+        HPX_TEST(half);
+        HPX_TEST_EQ(half->first, first);
+        HPX_TEST_EQ(half->second, std::uint32_t(4));
+
+        HPX_TEST(q.empty());
+        HPX_TEST(!q.pop_right_half());
+
+        // An empty queue can be refilled with a stolen range.
+        q.refill(5, 8);
+        for (std::uint32_t curr_expected = 5; curr_expected < 8;
+             ++curr_expected)
+        {
+            hpx::optional<std::uint32_t> curr = q.pop_left();
+            HPX_TEST(curr);
+            HPX_TEST_EQ(curr.value(), curr_expected);
+        }
+        HPX_TEST(q.empty());
+    }
 }
 
 enum class pop_mode
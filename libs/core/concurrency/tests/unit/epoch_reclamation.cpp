@@ -0,0 +1,180 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/concurrency/epoch_reclamation.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+std::atomic<std::size_t> deleted(0);
+
+struct node
+{
+    explicit node(std::uint64_t v) noexcept
+      : value(v)
+    {
+    }
+
+    ~node()
+    {
+        // make use after free visible
+        value = 0;
+        ++deleted;
+    }
+
+    std::uint64_t value;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+void test_reclaim()
+{
+    std::size_t const deleted_before = deleted;
+    {
+        hpx::util::epoch_online_guard g;
+
+        for (std::uint64_t i = 1; i <= 10; ++i)
+        {
+            hpx::util::epoch_retire(new node(i));
+        }
+
+        std::uint64_t const epoch = hpx::util::epoch_current();
+
+        // nothing can be deleted before the epoch has advanced twice
+        HPX_TEST_EQ(deleted.load(), deleted_before);
+
+        for (int i = 0; i != 10 && hpx::util::epoch_try_reclaim() != 0; ++i)
+        {
+        }
+
+        HPX_TEST_LTE(epoch + 2, hpx::util::epoch_current());
+    }
+    HPX_TEST_EQ(deleted.load(), deleted_before + 10);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_online_thread_blocks_reclamation()
+{
+    std::size_t const deleted_before = deleted;
+
+    std::atomic<bool> online(false);
+    std::atomic<bool> stop(false);
+
+    // an online thread which never passes a quiescent state
+    std::thread t([&]() {
+        hpx::util::epoch_online_guard g;
+        online = true;
+        while (!stop)
+        {
+            std::this_thread::yield();
+        }
+    });
+
+    while (!online)
+    {
+        std::this_thread::yield();
+    }
+
+    hpx::util::epoch_retire(new node(1));
+    for (int i = 0; i != 10; ++i)
+    {
+        hpx::util::epoch_try_reclaim();
+    }
+    HPX_TEST_EQ(deleted.load(), deleted_before);
+
+    // the thread goes offline
+    stop = true;
+    t.join();
+
+    for (int i = 0; i != 10 && hpx::util::epoch_try_reclaim() != 0; ++i)
+    {
+    }
+    HPX_TEST_EQ(deleted.load(), deleted_before + 1);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_concurrent_readers()
+{
+    constexpr std::size_t num_slots = 16;
+    constexpr int num_readers = 3;
+    constexpr std::uint64_t num_updates = 100000;
+
+    std::atomic<node*> slots[num_slots];
+    for (std::size_t i = 0; i != num_slots; ++i)
+    {
+        slots[i].store(new node(i + 1));
+    }
+
+    std::atomic<bool> stop(false);
+    std::atomic<std::size_t> errors(0);
+
+    std::vector<std::thread> readers;
+    for (int r = 0; r != num_readers; ++r)
+    {
+        readers.emplace_back([&]() {
+            hpx::util::epoch_online_guard g;
+
+            std::size_t i = 0;
+            while (!stop.load(std::memory_order_relaxed))
+            {
+                node* n = slots[i % num_slots].load(std::memory_order_acquire);
+                if (n->value == 0)
+                {
+                    ++errors;
+                }
+
+                if (++i % 32 == 0)
+                {
+                    hpx::util::epoch_quiescent_state();
+                }
+            }
+        });
+    }
+
+    // the writer replaces the nodes while the readers access them
+    {
+        hpx::util::epoch_online_guard g;
+        for (std::uint64_t i = 0; i != num_updates; ++i)
+        {
+            node* old = slots[i % num_slots].exchange(
+                new node(i + 1), std::memory_order_acq_rel);
+            hpx::util::epoch_retire(old);
+
+            if (i % 32 == 0)
+            {
+                hpx::util::epoch_quiescent_state();
+            }
+        }
+    }
+
+    stop = true;
+    for (auto& t : readers)
+    {
+        t.join();
+    }
+
+    HPX_TEST_EQ(errors.load(), static_cast<std::size_t>(0));
+
+    for (std::size_t i = 0; i != num_slots; ++i)
+    {
+        delete slots[i].load();
+    }
+    hpx::util::epoch_try_reclaim();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    test_reclaim();
+    test_online_thread_blocks_reclamation();
+    test_concurrent_readers();
+
+    return hpx::util::report_errors();
+}
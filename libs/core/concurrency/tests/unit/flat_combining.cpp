@@ -0,0 +1,139 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/concurrency/flat_combining.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+void test_apply()
+{
+    std::mutex mtx;
+    hpx::util::flat_combining<std::mutex> combiner(mtx);
+
+    int value = 0;
+    combiner.apply([&]() { ++value; });
+    HPX_TEST_EQ(value, 1);
+
+    // the lock is free again
+    HPX_TEST(mtx.try_lock());
+    mtx.unlock();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_exception()
+{
+    std::mutex mtx;
+    hpx::util::flat_combining<std::mutex> combiner(mtx);
+
+    bool caught = false;
+    try
+    {
+        combiner.apply([]() { throw std::runtime_error("test"); });
+    }
+    catch (std::runtime_error const&)
+    {
+        caught = true;
+    }
+    HPX_TEST(caught);
+
+    // the exception of a combined operation is rethrown on its thread
+    caught = false;
+    std::thread t;
+    {
+        std::unique_lock<std::mutex> l(mtx);
+        t = std::thread([&]() {
+            try
+            {
+                combiner.apply([]() { throw std::runtime_error("test"); });
+            }
+            catch (std::runtime_error const&)
+            {
+                caught = true;
+            }
+        });
+
+        // give the thread a chance to publish its operation
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    t.join();
+    HPX_TEST(caught);
+
+    HPX_TEST(mtx.try_lock());
+    mtx.unlock();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_concurrent_updates()
+{
+    constexpr int num_threads = 8;
+    constexpr std::uint64_t num_updates = 20000;
+    constexpr std::uint64_t num_keys = 16;
+
+    std::mutex mtx;
+    hpx::util::flat_combining<std::mutex, 4> combiner(mtx);
+
+    // the map is also accessed directly while holding the lock
+    std::map<std::uint64_t, std::uint64_t> counts;
+    std::uint64_t total = 0;
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t != num_threads; ++t)
+    {
+        threads.emplace_back([&, t]() {
+            for (std::uint64_t i = 0; i != num_updates; ++i)
+            {
+                std::uint64_t const key = (i + t) % num_keys;
+                if (i % 100 == 0)
+                {
+                    std::lock_guard<std::mutex> l(mtx);
+                    ++counts[key];
+                    ++total;
+                }
+                else
+                {
+                    combiner.apply([&]() {
+                        ++counts[key];
+                        ++total;
+                    });
+                }
+            }
+        });
+    }
+
+    for (auto& t : threads)
+    {
+        t.join();
+    }
+
+    HPX_TEST_EQ(total, num_threads * num_updates);
+
+    std::uint64_t sum = 0;
+    for (auto const& p : counts)
+    {
+        sum += p.second;
+    }
+    HPX_TEST_EQ(sum, num_threads * num_updates);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    test_apply();
+    test_exception();
+    test_concurrent_updates();
+
+    return hpx::util::report_errors();
+}
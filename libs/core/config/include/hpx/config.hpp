@@ -201,6 +201,13 @@
 #  define HPX_GLOBALCREDIT_INITIAL 0x80000000ll     // 2 ^ 31, i.e. 2 ^ 0b11111
 #endif
 
+/// This defines the credit (as a power of two) at which the credit of an
+/// id_type which is being split is replenished asynchronously, before it is
+/// exhausted.
+#if !defined(HPX_GLOBALCREDIT_REPLENISH_LOG2)
+#  define HPX_GLOBALCREDIT_REPLENISH_LOG2 16
+#endif
+
 ///////////////////////////////////////////////////////////////////////////////
 /// This defines the default number of OS-threads created for the different
 /// internal thread pools
@@ -372,6 +379,13 @@
 #  define HPX_THREAD_QUEUE_MIN_TASKS_TO_STEAL_STAGED 0
 #endif
 
+///////////////////////////////////////////////////////////////////////////////
+// Maximum number of pending tasks taken from a victim in one steal operation
+// (0 means half of the victim's pending tasks).
+#if !defined(HPX_THREAD_QUEUE_STEAL_BATCH_SIZE)
+#  define HPX_THREAD_QUEUE_STEAL_BATCH_SIZE 1
+#endif
+
 ///////////////////////////////////////////////////////////////////////////////
 // Minimum number of staged tasks to add to work items queue.
 #if !defined(HPX_THREAD_QUEUE_MIN_ADD_NEW_COUNT)
@@ -409,6 +423,20 @@
 #  define HPX_THREAD_QUEUE_INIT_THREADS_COUNT 10
 #endif
 
+///////////////////////////////////////////////////////////////////////////////
+// Maximum number of recycled threads (per stack size) a thread queue keeps in
+// its lock-free free list.
+#if !defined(HPX_THREAD_QUEUE_MAX_FREE_THREADS)
+#  define HPX_THREAD_QUEUE_MAX_FREE_THREADS 128
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+// Whether threads of the default (small) stack size are run to completion on
+// the stack of the worker thread instead of on their own coroutine stack.
+#if !defined(HPX_THREAD_QUEUE_RUN_TO_COMPLETION)
+#  define HPX_THREAD_QUEUE_RUN_TO_COMPLETION 0
+#endif
+
 ///////////////////////////////////////////////////////////////////////////////
 // Maximum sleep time for idle backoff in milliseconds (used only if
 // HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF is defined).
@@ -17,6 +17,7 @@
 #include <hpx/config.hpp>
 #include <hpx/assert.hpp>
 #include <hpx/coroutines/detail/get_stack_pointer.hpp>
+#include <hpx/coroutines/detail/posix_stack_pool.hpp>
 #include <hpx/coroutines/detail/posix_utility.hpp>
 #include <hpx/coroutines/detail/swap_context.hpp>
 #include <hpx/coroutines/signal_handler_debugging.hpp>
@@ -78,7 +79,7 @@
 // at the cost of a slightly higher instruction cache use and is thus enabled by
 // default.
 
-#if defined(__x86_64__)
+#if defined(__x86_64__) || defined(__aarch64__)
 extern "C" void swapcontext_stack(void***, void**) noexcept;
 extern "C" void swapcontext_stack2(void***, void**) noexcept;
 #else
@@ -203,7 +204,7 @@ namespace hpx::threads::coroutines::detail::lx {
 
         void prefetch() const
         {
-#if defined(__x86_64__)
+#if defined(__x86_64__) || defined(__aarch64__)
             HPX_ASSERT(sizeof(void*) == 8);
 #else
             HPX_ASSERT(sizeof(void*) == 4);
@@ -215,7 +216,13 @@ namespace hpx::threads::coroutines::detail::lx {
                 static_cast<void**>(m_sp) + 64 / sizeof(void*), 1, 3);
             __builtin_prefetch(
                 static_cast<void**>(m_sp) + 64 / sizeof(void*), 0, 3);
-#if !defined(__x86_64__)
+#if defined(__aarch64__)
+            // the saved registers span three cache lines
+            __builtin_prefetch(
+                static_cast<void**>(m_sp) + 128 / sizeof(void*), 1, 3);
+            __builtin_prefetch(
+                static_cast<void**>(m_sp) + 128 / sizeof(void*), 0, 3);
+#elif !defined(__x86_64__)
             __builtin_prefetch(
                 static_cast<void**>(m_sp) + 32 / sizeof(void*), 1, 3);
             __builtin_prefetch(
@@ -316,8 +323,8 @@ namespace hpx::threads::coroutines::detail::lx {
                     "stack size of {1} is invalid", m_stack_size));
             }
 
-            m_stack =
-                posix::alloc_stack(static_cast<std::size_t>(m_stack_size));
+            m_stack = posix::alloc_pooled_stack(
+                static_cast<std::size_t>(m_stack_size));
             if (m_stack == nullptr)
             {
                 throw std::runtime_error("could not allocate memory for stack");
@@ -359,7 +366,7 @@ namespace hpx::threads::coroutines::detail::lx {
                 VALGRIND_STACK_DEREGISTER(
                     reinterpret_cast<std::size_t>(m_sp[valgrind_id_idx]));
 #endif
-                posix::free_stack(
+                posix::free_pooled_stack(
                     m_stack, static_cast<std::size_t>(m_stack_size));
             }
         }
@@ -482,25 +489,38 @@ namespace hpx::threads::coroutines::detail::lx {
 
 #if defined(__x86_64__)
         // structure of context_data:
-        // 11: additional alignment (or valgrind_id if enabled)
-        // 10: parm 0 of trampoline
-        // 9:  dummy return address for trampoline
-        // 8:  return addr (here: start addr)
-        // 7:  rbp
-        // 6:  rbx
-        // 5:  rsi
-        // 4:  rdi
+        // 9:  additional alignment (or valgrind_id if enabled)
+        // 8:  parm 0 of trampoline
+        // 7:  dummy return address for trampoline
+        // 6:  return addr (here: start addr)
+        // 5:  rbp
+        // 4:  rbx
         // 3:  r12
         // 2:  r13
         // 1:  r14
         // 0:  r15
 #if defined(HPX_HAVE_VALGRIND) && !defined(NVALGRIND)
-        static const std::size_t valgrind_id_idx = 11;
+        static const std::size_t valgrind_id_idx = 9;
+#endif
+
+        static const std::size_t context_size = 10;
+        static const std::size_t cb_idx = 8;
+        static const std::size_t funp_idx = 6;
+#elif defined(__aarch64__)
+        // structure of context_data:
+        // 21:     additional alignment (or valgrind_id if enabled)
+        // 20:     parm 0 of trampoline
+        // 19:     x30 (here: start addr)
+        // 18:     x29
+        // 8-17:   x19-x28
+        // 0-7:    d8-d15
+#if defined(HPX_HAVE_VALGRIND) && !defined(NVALGRIND)
+        static const std::size_t valgrind_id_idx = 21;
 #endif
 
-        static const std::size_t context_size = 12;
-        static const std::size_t cb_idx = 10;
-        static const std::size_t funp_idx = 8;
+        static const std::size_t context_size = 22;
+        static const std::size_t cb_idx = 20;
+        static const std::size_t funp_idx = 19;
 #else
         // structure of context_data:
         // 7: valgrind_id (if enabled)
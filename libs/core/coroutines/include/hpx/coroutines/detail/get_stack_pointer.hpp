@@ -18,7 +18,7 @@
 #else
 #if defined(__x86_64__) || defined(__amd64) || defined(__i386__) ||            \
     defined(__i486__) || defined(__i586__) || defined(__i686__) ||             \
-    defined(__powerpc__) || defined(__arm__)
+    defined(__powerpc__) || defined(__arm__) || defined(__aarch64__)
 #define HPX_HAVE_THREADS_GET_STACK_POINTER
 #endif
 #endif
@@ -42,7 +42,7 @@ namespace hpx { namespace threads { namespace coroutines { namespace detail {
 #elif defined(__powerpc__)
         void* stack_ptr_p = &stack_ptr;
         asm("stw %%r1, 0(%0)" : "=&r"(stack_ptr_p));
-#elif defined(__arm__)
+#elif defined(__arm__) || defined(__aarch64__)
         asm("mov %0, sp" : "=r"(stack_ptr));
 #elif defined(__riscv)
         __asm__ __volatile__("add %0, x0, sp" : "=r"(stack_ptr));
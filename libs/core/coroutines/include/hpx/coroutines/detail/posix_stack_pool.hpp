@@ -0,0 +1,40 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/coroutines/detail/posix_utility.hpp>
+
+#include <cstddef>
+
+/**
+ * Pooling of coroutine stacks
+ */
+namespace hpx { namespace threads { namespace coroutines { namespace detail {
+    namespace posix {
+        // The maximal number of released stacks of any given size which are
+        // kept for reuse (hpx.stacks.pool_size).
+        HPX_CORE_EXPORT extern std::size_t stack_pool_size;
+
+        // The number of pooled stacks of any given size which keep their
+        // memory, the pages of any additional released stacks are given back
+        // to the system lazily (hpx.stacks.pool_high_water_mark).
+        HPX_CORE_EXPORT extern std::size_t stack_pool_high_water_mark;
+
+        // Whether stacks which are a multiple of the huge page size are
+        // allocated aligned to huge pages and backed by transparent huge
+        // pages (hpx.stacks.use_huge_pages).
+        HPX_CORE_EXPORT extern bool use_huge_page_stacks;
+
+        // Allocate a stack of the given size, reusing a previously released
+        // stack of the same size, if possible.
+        HPX_CORE_EXPORT void* alloc_pooled_stack(std::size_t size);
+
+        // Release a stack allocated using alloc_pooled_stack, the stack is
+        // kept for reuse if the pool for its size is not full.
+        HPX_CORE_EXPORT void free_pooled_stack(void* stack, std::size_t size);
+}}}}}    // namespace hpx::threads::coroutines::detail::posix
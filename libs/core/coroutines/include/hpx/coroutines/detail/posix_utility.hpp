@@ -135,6 +135,21 @@ namespace hpx { namespace threads { namespace coroutines { namespace detail {
             *watermark = reinterpret_cast<void*>(0xDEADBEEFDEADBEEFull);
         }
 
+        // Give the memory backing the given pages back to the system. Where
+        // available, MADV_FREE is used which frees the pages lazily (only
+        // under memory pressure), this avoids page faults if the pages are
+        // used again soon.
+        inline void discard_stack_pages(void* stack, std::size_t size)
+        {
+#if defined(MADV_FREE)
+            if (::madvise(stack, size, MADV_FREE) == 0)
+            {
+                return;
+            }
+#endif
+            ::madvise(stack, size, MADV_DONTNEED);
+        }
+
         inline bool reset_stack(void* stack, std::size_t size)
         {
             void** watermark = static_cast<void**>(stack) +
@@ -146,7 +161,11 @@ namespace hpx { namespace threads { namespace coroutines { namespace detail {
             {
                 // We never free up the first page, as it's initialized only when the
                 // stack is created.
-                ::madvise(stack, size - EXEC_PAGESIZE, MADV_DONTNEED);
+                discard_stack_pages(stack, size - EXEC_PAGESIZE);
+
+                // re-arm the watermark to detect the next time the stack
+                // grows beyond its first page
+                watermark_stack(stack, size);
                 return true;
             }
 
@@ -200,6 +219,9 @@ namespace hpx { namespace threads { namespace coroutines { namespace detail {
         inline void watermark_stack(void* stack, std::size_t size) {
         }    // no-op
 
+        inline void discard_stack_pages(void* stack, std::size_t size) {
+        }    // no-op
+
         inline bool reset_stack(void* stack, std::size_t size)
         {
             return false;
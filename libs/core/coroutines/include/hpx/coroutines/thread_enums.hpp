@@ -211,7 +211,8 @@ namespace hpx { namespace threads {
         /// zero. It is up to the scheduler to decide how to interpret NUMA
         /// domain indices that are larger than the number of available NUMA
         /// domains to the scheduler. Typically indices will wrap around when
-        /// too large.
+        /// too large. The task keeps its affinity to the domain, schedulers may
+        /// prevent workers of other domains from stealing it.
         numa = 2,
     };
 
@@ -0,0 +1,224 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#if defined(__linux) || defined(linux) || defined(__linux__) ||                \
+    defined(__FreeBSD__) || defined(__APPLE__)
+#include <hpx/coroutines/detail/posix_stack_pool.hpp>
+#include <hpx/coroutines/detail/posix_utility.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace hpx { namespace threads { namespace coroutines { namespace detail {
+    namespace posix {
+        ///////////////////////////////////////////////////////////////////////
+        // these global variables are used to control the stack pool, they are
+        // set from the [hpx.stacks] configuration section
+        HPX_CORE_EXPORT std::size_t stack_pool_size = 64;
+        HPX_CORE_EXPORT std::size_t stack_pool_high_water_mark = 8;
+        HPX_CORE_EXPORT bool use_huge_page_stacks = false;
+
+#if defined(HPX_HAVE_THREAD_STACK_MMAP) && defined(_POSIX_MAPPED_FILES) &&     \
+    _POSIX_MAPPED_FILES > 0 && !defined(HPX_HAVE_ADDRESS_SANITIZER)
+
+        namespace {
+
+            ///////////////////////////////////////////////////////////////////
+            // All released stacks of one size.
+            struct stack_size_class
+            {
+                std::atomic<std::size_t> size_{0};
+                std::mutex mtx_;
+                std::vector<void*> stacks_;
+            };
+
+            // There are only very few distinct stack sizes in use (one for
+            // each of the thread_stacksize enumerators).
+            constexpr std::size_t max_stack_size_classes = 8;
+
+            struct stack_pool
+            {
+                stack_size_class classes_[max_stack_size_classes];
+            };
+
+            stack_pool& get_stack_pool()
+            {
+                // The pool is never destroyed as stacks may be released
+                // during static destruction. The pooled stacks are given back
+                // to the system when the process exits.
+                static stack_pool* pool = new stack_pool;
+                return *pool;
+            }
+
+            // Return the size class for the given stack size, or nullptr if
+            // all size classes are in use by other sizes.
+            stack_size_class* get_size_class(std::size_t size)
+            {
+                stack_pool& pool = get_stack_pool();
+                for (stack_size_class& c : pool.classes_)
+                {
+                    std::size_t const class_size =
+                        c.size_.load(std::memory_order_acquire);
+                    if (class_size == size)
+                    {
+                        return &c;
+                    }
+
+                    if (class_size == 0)
+                    {
+                        // claim the first unused size class
+                        std::size_t expected = 0;
+                        if (c.size_.compare_exchange_strong(expected, size,
+                                std::memory_order_acq_rel) ||
+                            expected == size)
+                        {
+                            return &c;
+                        }
+                    }
+                }
+                return nullptr;
+            }
+
+#if defined(__linux) || defined(linux) || defined(__linux__)
+#if defined(MADV_HUGEPAGE)
+            constexpr std::size_t huge_page_size = 2 * 1024 * 1024;
+
+            // Allocate a stack which starts at a huge page boundary and is
+            // backed by transparent huge pages. The mapping is trimmed to the
+            // same layout as created by alloc_stack (including the guard
+            // page in front of the stack), which allows to release it using
+            // free_stack.
+            void* alloc_huge_page_stack(std::size_t size)
+            {
+                std::size_t guard_size = 0;
+#if defined(HPX_HAVE_THREAD_GUARD_PAGE)
+                if (use_guard_pages)
+                {
+                    guard_size = EXEC_PAGESIZE;
+                }
+#endif
+                std::size_t const total_size =
+                    size + guard_size + huge_page_size;
+                void* real_stack = ::mmap(nullptr, total_size,
+                    PROT_EXEC | PROT_READ | PROT_WRITE,
+                    MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+                if (real_stack == MAP_FAILED)
+                {
+                    return nullptr;
+                }
+
+                char* const real_begin = static_cast<char*>(real_stack);
+                char* const real_end = real_begin + total_size;
+
+                char* const stack = reinterpret_cast<char*>(
+                    (reinterpret_cast<std::uintptr_t>(real_begin) +
+                        guard_size + huge_page_size - 1) &
+                    ~static_cast<std::uintptr_t>(huge_page_size - 1));
+                char* const begin = stack - guard_size;
+                char* const end = stack + size;
+
+                // release the parts which were needed for the alignment only
+                if (begin != real_begin)
+                {
+                    ::munmap(real_begin, std::size_t(begin - real_begin));
+                }
+                if (end != real_end)
+                {
+                    ::munmap(end, std::size_t(real_end - end));
+                }
+
+                if (guard_size != 0)
+                {
+                    ::mprotect(begin, guard_size, PROT_NONE);
+                }
+
+                // this is a hint only, ignore errors
+                ::madvise(stack, size, MADV_HUGEPAGE);
+                return stack;
+            }
+#endif
+#endif
+
+            void* alloc_new_stack(std::size_t size)
+            {
+#if defined(__linux) || defined(linux) || defined(__linux__)
+#if defined(MADV_HUGEPAGE)
+                if (use_huge_page_stacks && size % huge_page_size == 0)
+                {
+                    if (void* stack = alloc_huge_page_stack(size))
+                    {
+                        return stack;
+                    }
+                }
+#endif
+#endif
+                return alloc_stack(size);
+            }
+        }    // namespace
+
+        ///////////////////////////////////////////////////////////////////////
+        void* alloc_pooled_stack(std::size_t size)
+        {
+            if (stack_pool_size != 0)
+            {
+                if (stack_size_class* c = get_size_class(size))
+                {
+                    std::lock_guard<std::mutex> l(c->mtx_);
+                    if (!c->stacks_.empty())
+                    {
+                        void* stack = c->stacks_.back();
+                        c->stacks_.pop_back();
+                        return stack;
+                    }
+                }
+            }
+            return alloc_new_stack(size);
+        }
+
+        void free_pooled_stack(void* stack, std::size_t size)
+        {
+            if (stack_pool_size != 0)
+            {
+                if (stack_size_class* c = get_size_class(size))
+                {
+                    std::lock_guard<std::mutex> l(c->mtx_);
+                    std::size_t const pooled = c->stacks_.size();
+                    if (pooled < stack_pool_size)
+                    {
+                        // The pages of stacks beyond the high-water mark are
+                        // not expected to be needed soon. The first page is
+                        // kept as it is touched right away when the stack is
+                        // reused.
+                        if (pooled >= stack_pool_high_water_mark)
+                        {
+                            discard_stack_pages(stack, size - EXEC_PAGESIZE);
+                        }
+                        c->stacks_.push_back(stack);
+                        return;
+                    }
+                }
+            }
+            free_stack(stack, size);
+        }
+
+#else    // no pooling for non-mmap() stacks and if ASAN is enabled
+
+        void* alloc_pooled_stack(std::size_t size)
+        {
+            return alloc_stack(size);
+        }
+
+        void free_pooled_stack(void* stack, std::size_t size)
+        {
+            free_stack(stack, size);
+        }
+#endif
+}}}}}    // namespace hpx::threads::coroutines::detail::posix
+#endif
@@ -17,6 +17,8 @@
 #elif defined(__i386__) || defined(__i486__) || defined(__i586__) ||           \
     defined(__i686__)
 #include "swapcontext32.ipp"
+#elif defined(__aarch64__)
+#include "swapcontext_aarch64.ipp"
 #else
 #error You are trying to use x86 context switching on a non-x86 platform. Your \
     platform may be supported with the CMake option \
@@ -42,6 +42,10 @@
 //
 //     NOTE: popl is slightly better than mov+add to pop registers
 //           so is pushl rather than mov+sub.
+//
+//     Only the callee-saved registers are saved. The MXCSR and the x87
+//     control word are not, the threads are expected to leave the floating
+//     point control state unchanged.
 
 #if defined(__APPLE__)
 #define HPX_COROUTINE_TYPE_DIRECTIVE(name)
@@ -58,11 +62,9 @@
         ".globl " #name "\n\t"                                                \
         HPX_COROUTINE_TYPE_DIRECTIVE(name)                                    \
     #name ":\n\t"                                                             \
-        "movq  64(%rsi), %rcx\n\t"                                            \
+        "movq  48(%rsi), %rcx\n\t"                                            \
         "pushq %rbp\n\t"                                                      \
         "pushq %rbx\n\t"                                                      \
-        "pushq %rax\n\t"                                                      \
-        "pushq %rdx\n\t"                                                      \
         "pushq %r12\n\t"                                                      \
         "pushq %r13\n\t"                                                      \
         "pushq %r14\n\t"                                                      \
@@ -73,11 +75,9 @@
         "popq  %r14\n\t"                                                      \
         "popq  %r13\n\t"                                                      \
         "popq  %r12\n\t"                                                      \
-        "popq  %rdx\n\t"                                                      \
-        "popq  %rax\n\t"                                                      \
         "popq  %rbx\n\t"                                                      \
         "popq  %rbp\n\t"                                                      \
-        "movq 80(%rsi), %rdi\n\t"                                             \
+        "movq 64(%rsi), %rdi\n\t"                                             \
         "add   $8, %rsp\n\t"                                                  \
         "jmp   *%rcx\n\t"                                                     \
         "ud2\n\t"                                                             \
@@ -0,0 +1,82 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#if !defined(__aarch64__)
+#error This file is for AArch64 CPUs only.
+#endif
+
+#if !defined(__GNUC__)
+#error This file requires compilation with gcc.
+#endif
+
+//     X0 is &from.sp
+//     X1 is to.sp
+//
+//     This is the same scheme as the x86-64 version: the callee-saved
+//     registers (x19-x30 and the lower halves of v8-v15) are stored on the
+//     old stack, the old stack pointer is saved, the new one is loaded and
+//     the registers are restored from the new stack.
+//
+//     X0 is set to be the parameter for the function to be called.
+//     The first time X0 is the first parameter of the trampoline.
+//     Otherwise it is simply discarded.
+//
+//     The FPCR is not saved, as on x86-64 the floating point control state
+//     is expected to stay unchanged by the threads.
+//
+//     The target address is loaded first to make it available as soon as
+//     possible. Returning to it with 'ret' (instead of 'br') pairs with the
+//     'bl' which entered this function and keeps the return address stack
+//     of the CPU balanced.
+
+// Note: .p2align 4 below means alignment at 2^4 boundary (16 bytes)
+
+#define HPX_COROUTINE_SWAPCONTEXT(name)                                       \
+    asm (                                                                     \
+        ".text\n\t"                                                           \
+        ".p2align 4\n"                                                        \
+        ".globl " #name "\n\t"                                                \
+        ".type " #name ", %function\n\t"                                      \
+    #name ":\n\t"                                                             \
+        "ldr   x9, [x1, #152]\n\t"                                            \
+        "sub   sp, sp, #176\n\t"                                              \
+        "stp   d8, d9, [sp, #0]\n\t"                                          \
+        "stp   d10, d11, [sp, #16]\n\t"                                       \
+        "stp   d12, d13, [sp, #32]\n\t"                                       \
+        "stp   d14, d15, [sp, #48]\n\t"                                       \
+        "stp   x19, x20, [sp, #64]\n\t"                                       \
+        "stp   x21, x22, [sp, #80]\n\t"                                       \
+        "stp   x23, x24, [sp, #96]\n\t"                                       \
+        "stp   x25, x26, [sp, #112]\n\t"                                      \
+        "stp   x27, x28, [sp, #128]\n\t"                                      \
+        "stp   x29, x30, [sp, #144]\n\t"                                      \
+        "mov   x10, sp\n\t"                                                   \
+        "str   x10, [x0]\n\t"                                                 \
+        "mov   sp, x1\n\t"                                                    \
+        "ldp   d8, d9, [sp, #0]\n\t"                                          \
+        "ldp   d10, d11, [sp, #16]\n\t"                                       \
+        "ldp   d12, d13, [sp, #32]\n\t"                                       \
+        "ldp   d14, d15, [sp, #48]\n\t"                                       \
+        "ldp   x19, x20, [sp, #64]\n\t"                                       \
+        "ldp   x21, x22, [sp, #80]\n\t"                                       \
+        "ldp   x23, x24, [sp, #96]\n\t"                                       \
+        "ldp   x25, x26, [sp, #112]\n\t"                                      \
+        "ldp   x27, x28, [sp, #128]\n\t"                                      \
+        "ldp   x29, x30, [sp, #144]\n\t"                                      \
+        "ldr   x0, [sp, #160]\n\t"                                            \
+        "add   sp, sp, #176\n\t"                                              \
+        "ret   x9\n\t"                                                        \
+        ".size " #name ", .-" #name "\n\t"                                    \
+    )                                                                         \
+/**/
+
+HPX_COROUTINE_SWAPCONTEXT(swapcontext_stack);
+HPX_COROUTINE_SWAPCONTEXT(swapcontext_stack2);
+
+#undef HPX_COROUTINE_SWAPCONTEXT
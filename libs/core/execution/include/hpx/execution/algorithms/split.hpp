@@ -13,7 +13,6 @@
 #include <hpx/allocator_support/traits/is_allocator.hpp>
 #include <hpx/assert.hpp>
 #include <hpx/concepts/concepts.hpp>
-#include <hpx/datastructures/detail/small_vector.hpp>
 #include <hpx/datastructures/tuple.hpp>
 #include <hpx/datastructures/variant.hpp>
 #include <hpx/errors/try_catch_exception_ptr.hpp>
@@ -27,9 +26,7 @@
 #include <hpx/functional/bind_front.hpp>
 #include <hpx/functional/detail/tag_priority_invoke.hpp>
 #include <hpx/functional/invoke_fused.hpp>
-#include <hpx/functional/move_only_function.hpp>
 #include <hpx/modules/memory.hpp>
-#include <hpx/synchronization/spinlock.hpp>
 #include <hpx/thread_support/atomic_count.hpp>
 #include <hpx/type_support/meta.hpp>
 #include <hpx/type_support/pack.hpp>
@@ -38,7 +35,6 @@
 #include <cstddef>
 #include <exception>
 #include <memory>
-#include <mutex>
 #include <type_traits>
 #include <utility>
 
@@ -52,6 +48,17 @@ namespace hpx::execution::experimental {
             lazy
         };
 
+        // Operation states waiting for the completion of the predecessor of
+        // a split or ensure_started sender are linked into an intrusive list.
+        struct split_continuation_base
+        {
+            using complete_function_type =
+                void (*)(split_continuation_base*) noexcept;
+
+            split_continuation_base* next = nullptr;
+            complete_function_type complete = nullptr;
+        };
+
         template <typename Receiver>
         struct error_visitor
         {
@@ -125,10 +132,13 @@ namespace hpx::execution::experimental {
                     Allocator>::template rebind_alloc<shared_state>;
                 HPX_NO_UNIQUE_ADDRESS allocator_type alloc;
 
-                hpx::spinlock mtx;
                 hpx::util::atomic_count reference_count{0};
                 std::atomic<bool> start_called{false};
-                std::atomic<bool> predecessor_done{false};
+
+                // The head of the list of waiting operation states. Once the
+                // predecessor has completed this is set to the address of
+                // the shared state itself, which serves as the ready flag.
+                std::atomic<void*> continuations{nullptr};
 
                 using operation_state_type =
                     std::decay_t<connect_result_t<Sender, split_receiver>>;
@@ -148,9 +158,6 @@ namespace hpx::execution::experimental {
                     value_type>
                     v;
 
-                using continuation_type = hpx::move_only_function<void()>;
-                hpx::detail::small_vector<continuation_type, 1> continuations;
-
                 struct split_receiver
                 {
                     hpx::intrusive_ptr<shared_state> state;
@@ -276,115 +283,78 @@ namespace hpx::execution::experimental {
                     }
                 };
 
-                void set_predecessor_done()
+                bool is_predecessor_done() const noexcept
                 {
-                    predecessor_done = true;
+                    return continuations.load(std::memory_order_acquire) ==
+                        static_cast<void const*>(this);
+                }
 
+                void set_predecessor_done() noexcept
+                {
+                    // Mark the shared state as ready and take ownership of all
+                    // operation states which were added so far. The release
+                    // makes the stored values/errors visible to the operation
+                    // states added later, the acquire makes the operation
+                    // states added so far visible to this thread.
+                    void* head = continuations.exchange(
+                        static_cast<void*>(this), std::memory_order_acq_rel);
+                    HPX_ASSERT(head != static_cast<void*>(this));
+
+                    // The list was built in LIFO order, reverse it to trigger
+                    // the continuations in the order they were added.
+                    split_continuation_base* reversed = nullptr;
+                    auto* current = static_cast<split_continuation_base*>(head);
+                    while (current != nullptr)
                     {
-                        // We require taking the lock here to synchronize with
-                        // threads attempting to add continuations to the vector
-                        // of continuations. However, it is enough to take it
-                        // once and release it immediately.
-                        //
-                        // Without the lock we may not see writes to the vector.
-                        // With the lock threads attempting to add continuations
-                        // will either:
-                        // - See predecessor_done = true in which case they will
-                        //   call the continuation directly without adding it to
-                        //   the vector of continuations. Accessing the vector
-                        //   below without the lock is safe in this case because
-                        //   the vector is not modified.
-                        // - See predecessor_done = false and proceed to take
-                        //   the lock. If they see predecessor_done after taking
-                        //   the lock they can again release the lock and call
-                        //   the continuation directly. Accessing the vector
-                        //   without the lock is again safe because the vector
-                        //   is not modified.
-                        // - See predecessor_done = false and proceed to take
-                        //   the lock. If they see predecessor_done is still
-                        //   false after taking the lock, they will proceed to
-                        //   add a continuation to the vector. Since they keep
-                        //   the lock they can safely write to the vector. This
-                        //   thread will not proceed past the lock until they
-                        //   have finished writing to the vector.
-                        //
-                        // Importantly, once this thread has taken and released
-                        // this lock, threads attempting to add continuations to
-                        // the vector must see predecessor_done = true after
-                        // taking the lock in their threads and will not add
-                        // continuations to the vector.
-                        std::unique_lock l{mtx};
+                        auto* next = current->next;
+                        current->next = reversed;
+                        reversed = current;
+                        current = next;
                     }
 
-                    if (!continuations.empty())
+                    while (reversed != nullptr)
                     {
-                        for (auto const& continuation : continuations)
-                        {
-                            continuation();
-                        }
-
-                        continuations.clear();
+                        // The operation state may be destroyed by complete.
+                        auto* next = reversed->next;
+                        reversed->complete(reversed);
+                        reversed = next;
                     }
                 }
 
                 template <typename Receiver>
-                void add_continuation(Receiver& receiver) = delete;
+                void complete(Receiver&& receiver) noexcept
+                {
+                    HPX_ASSERT(is_predecessor_done());
 
-                template <typename Receiver>
-                void add_continuation(Receiver&& receiver)
+                    // TODO: Should this preserve the scheduler? It does not
+                    // if we call set_* inline.
+                    hpx::visit(done_error_value_visitor<Receiver>{
+                                   HPX_FORWARD(Receiver, receiver)},
+                        v);
+                }
+
+                // Add the given operation state to the list of waiting
+                // operation states. Returns false if the predecessor has
+                // already completed, in which case the operation state has not
+                // been added and has to be completed by the caller.
+                bool add_continuation(
+                    split_continuation_base* continuation) noexcept
                 {
-                    if (predecessor_done)
-                    {
-                        // If we read predecessor_done here it means that one of
-                        // set_error/set_stopped/set_value has been called and
-                        // values/errors have been stored into the shared state.
-                        // We can trigger the continuation directly.
-                        // TODO: Should this preserve the scheduler? It does not
-                        // if we call set_* inline.
-                        hpx::visit(
-                            done_error_value_visitor<Receiver>{
-                                HPX_FORWARD(Receiver, receiver)},
-                            v);
-                    }
-                    else
+                    void* const ready = static_cast<void*>(this);
+                    void* head = continuations.load(std::memory_order_acquire);
+                    do
                     {
-                        // If predecessor_done is false, we have to take the
-                        // lock to potentially add the continuation to the
-                        // vector of continuations.
-                        std::unique_lock l{mtx};
-
-                        if (predecessor_done)
+                        if (head == ready)
                         {
-                            // By the time the lock has been taken,
-                            // predecessor_done might already be true and we can
-                            // release the lock early and call the continuation
-                            // directly again.
-                            l.unlock();
-                            hpx::visit(
-                                done_error_value_visitor<Receiver>{
-                                    HPX_FORWARD(Receiver, receiver)},
-                                v);
+                            return false;
                         }
-                        else
-                        {
-                            // If predecessor_done is still false, we add the
-                            // continuation to the vector of continuations. This
-                            // has to be done while holding the lock, since
-                            // other threads may also try to add continuations
-                            // to the vector and the vector is not threadsafe in
-                            // itself. The continuation will be called later
-                            // when set_error/set_stopped/set_value is called.
-                            continuations.emplace_back(
-                                [this,
-                                    receiver = HPX_FORWARD(
-                                        Receiver, receiver)]() mutable {
-                                    hpx::visit(
-                                        done_error_value_visitor<Receiver>{
-                                            HPX_MOVE(receiver)},
-                                        v);
-                                });
-                        }
-                    }
+                        continuation->next =
+                            static_cast<split_continuation_base*>(head);
+                    } while (!continuations.compare_exchange_weak(head,
+                        static_cast<void*>(continuation),
+                        std::memory_order_release, std::memory_order_acquire));
+
+                    return true;
                 }
 
                 void start() & noexcept
@@ -448,7 +418,7 @@ namespace hpx::execution::experimental {
             split_sender& operator=(split_sender&&) = default;
 
             template <typename Receiver>
-            struct operation_state
+            struct operation_state : split_continuation_base
             {
                 HPX_NO_UNIQUE_ADDRESS std::decay_t<Receiver> receiver;
                 hpx::intrusive_ptr<shared_state> state;
@@ -459,6 +429,16 @@ namespace hpx::execution::experimental {
                   : receiver(HPX_FORWARD(Receiver_, receiver))
                   , state(HPX_MOVE(state))
                 {
+                    this->complete = &complete_continuation;
+                }
+
+                static void complete_continuation(
+                    split_continuation_base* continuation) noexcept
+                {
+                    // The shared state is kept alive by the split_receiver
+                    // calling set_predecessor_done.
+                    auto& os = *static_cast<operation_state*>(continuation);
+                    os.state->complete(HPX_MOVE(os.receiver));
                 }
 
                 operation_state(operation_state&&) = delete;
@@ -476,7 +456,16 @@ namespace hpx::execution::experimental {
                         os.state->start();
                     }
 
-                    os.state->add_continuation(HPX_MOVE(os.receiver));
+                    // If the predecessor has already completed the values
+                    // can be sent directly, otherwise the operation state is
+                    // completed by set_predecessor_done.
+                    if (!os.state->add_continuation(&os))
+                    {
+                        // keep the shared state alive, the operation state may
+                        // be destroyed by the receiver
+                        hpx::intrusive_ptr<shared_state> state = os.state;
+                        state->complete(HPX_MOVE(os.receiver));
+                    }
                 }
             };
 
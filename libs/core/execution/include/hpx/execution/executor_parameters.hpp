@@ -11,5 +11,7 @@
 #include <hpx/execution/executors/auto_chunk_size.hpp>
 #include <hpx/execution/executors/dynamic_chunk_size.hpp>
 #include <hpx/execution/executors/guided_chunk_size.hpp>
+#include <hpx/execution/executors/learning_chunk_size.hpp>
 #include <hpx/execution/executors/persistent_auto_chunk_size.hpp>
+#include <hpx/execution/executors/prefetch_distance.hpp>
 #include <hpx/execution/executors/static_chunk_size.hpp>
@@ -11,6 +11,7 @@
 #include <hpx/async_base/scheduling_properties.hpp>
 #include <hpx/async_base/traits/is_launch_policy.hpp>
 #include <hpx/concepts/has_member_xxx.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
 #include <hpx/execution/detail/execution_parameter_callbacks.hpp>
 #include <hpx/execution_base/traits/is_executor.hpp>
 #include <hpx/execution_base/traits/is_executor_parameters.hpp>
@@ -497,6 +498,64 @@ namespace hpx { namespace parallel { namespace execution {
                     HPX_FORWARD(Executor, exec));
             }
         };
+
+        ///////////////////////////////////////////////////////////////////////
+        // define member traits
+        HPX_HAS_MEMBER_XXX_TRAIT_DEF(get_prefetch_distance)
+
+        ///////////////////////////////////////////////////////////////////////
+        // default property implementation allowing to handle
+        // get_prefetch_distance
+        struct get_prefetch_distance_property
+        {
+            // default implementation: prefetch two cache lines ahead
+            template <typename Target>
+            HPX_FORCEINLINE static constexpr std::size_t get_prefetch_distance(
+                Target, std::size_t element_size) noexcept
+            {
+                std::size_t const distance =
+                    2 * hpx::threads::get_cache_line_size() /
+                    (element_size == 0 ? 1 : element_size);
+                return distance == 0 ? 1 : distance;
+            }
+        };
+
+        //////////////////////////////////////////////////////////////////////
+        // Generate a type that is guaranteed to support get_prefetch_distance
+        using get_prefetch_distance_target_t =
+            get_parameters_property_t<get_prefetch_distance_property,
+                has_get_prefetch_distance_t>;
+
+        inline constexpr get_prefetch_distance_target_t
+            get_prefetch_distance_target{};
+
+        ///////////////////////////////////////////////////////////////////////
+        // customization point for interface get_prefetch_distance()
+        template <typename Parameters, typename Executor_>
+        struct get_prefetch_distance_fn_helper<Parameters, Executor_,
+            std::enable_if_t<hpx::traits::is_executor_any_v<Executor_>>>
+        {
+            template <typename Executor>
+            HPX_FORCEINLINE static constexpr std::size_t call(
+                Parameters& params, Executor&& exec, std::size_t element_size)
+            {
+                auto getprop = get_prefetch_distance_target(
+                    HPX_FORWARD(Executor, exec), params,
+                    get_prefetch_distance_property{});
+
+                return getprop.first.get_prefetch_distance(
+                    HPX_FORWARD(decltype(getprop.second), getprop.second),
+                    element_size);
+            }
+
+            template <typename AnyParameters, typename Executor>
+            HPX_FORCEINLINE static constexpr std::size_t call(
+                AnyParameters params, Executor&& exec, std::size_t element_size)
+            {
+                return call(static_cast<Parameters&>(params),
+                    HPX_FORWARD(Executor, exec), element_size);
+            }
+        };
         /// \endcond
     }    // namespace detail
 
@@ -682,6 +741,27 @@ namespace hpx { namespace parallel { namespace execution {
             }
         };
 
+        ///////////////////////////////////////////////////////////////////////
+        template <typename T, typename Wrapper, typename Enable = void>
+        struct get_prefetch_distance_call_helper
+        {
+        };
+
+        template <typename T, typename Wrapper>
+        struct get_prefetch_distance_call_helper<T, Wrapper,
+            std::enable_if_t<has_get_prefetch_distance<T>::value>>
+        {
+            template <typename Executor>
+            HPX_FORCEINLINE std::size_t get_prefetch_distance(
+                Executor&& exec, std::size_t element_size) const
+            {
+                auto& wrapped =
+                    static_cast<unwrapper<Wrapper> const*>(this)->member_.get();
+                return wrapped.get_prefetch_distance(
+                    HPX_FORWARD(Executor, exec), element_size);
+            }
+        };
+
         ///////////////////////////////////////////////////////////////////////
         template <typename T>
         struct base_member_helper
@@ -705,6 +785,7 @@ namespace hpx { namespace parallel { namespace execution {
           , mark_end_execution_call_helper<T, std::reference_wrapper<T>>
           , processing_units_count_call_helper<T, std::reference_wrapper<T>>
           , reset_thread_distribution_call_helper<T, std::reference_wrapper<T>>
+          , get_prefetch_distance_call_helper<T, std::reference_wrapper<T>>
         {
             using wrapper_type = std::reference_wrapper<T>;
 
@@ -744,6 +825,7 @@ namespace hpx { namespace parallel { namespace execution {
             HPX_STATIC_ASSERT_ON_PARAMETERS_AMBIGUITY(maximal_number_of_chunks);
             HPX_STATIC_ASSERT_ON_PARAMETERS_AMBIGUITY(
                 reset_thread_distribution);
+            HPX_STATIC_ASSERT_ON_PARAMETERS_AMBIGUITY(get_prefetch_distance);
 
             template <typename Dependent = void,
                 typename Enable = std::enable_if_t<
@@ -52,6 +52,10 @@ namespace hpx { namespace parallel { namespace execution {
         template <typename Parameters, typename Executor,
             typename Enable = void>
         struct mark_end_execution_fn_helper;
+
+        template <typename Parameters, typename Executor,
+            typename Enable = void>
+        struct get_prefetch_distance_fn_helper;
         /// \endcond
     }    // namespace detail
 
@@ -291,4 +295,40 @@ namespace hpx { namespace parallel { namespace execution {
                 HPX_FORWARD(Executor, exec));
         }
     } mark_end_execution{};
+
+    /// Return the number of elements in front of the current one which should
+    /// be prefetched by algorithms supporting software prefetching.
+    ///
+    /// \param params   [in] The executor parameters object to use for
+    ///                 determining the prefetch distance.
+    /// \param exec     [in] The executor object which will be used
+    ///                 for scheduling of the loop iterations.
+    /// \param element_size [in] The size (in bytes) of the elements the
+    ///                 prefetch distance should be determined for.
+    ///
+    /// \note This calls params.get_prefetch_distance(exec, element_size) if
+    ///       it exists; otherwise it returns the number of elements fitting
+    ///       into two cache lines.
+    ///
+    inline constexpr struct get_prefetch_distance_t final
+      : hpx::functional::detail::tag_fallback<get_prefetch_distance_t>
+    {
+    private:
+        // clang-format off
+        template <typename Parameters, typename Executor,
+            HPX_CONCEPT_REQUIRES_(
+                hpx::traits::is_executor_parameters<Parameters>::value &&
+                hpx::traits::is_executor_any<Executor>::value
+            )>
+        // clang-format on
+        friend HPX_FORCEINLINE decltype(auto) tag_fallback_invoke(
+            get_prefetch_distance_t, Parameters&& params, Executor&& exec,
+            std::size_t element_size)
+        {
+            return detail::get_prefetch_distance_fn_helper<
+                hpx::util::decay_unwrap_t<Parameters>,
+                std::decay_t<Executor>>::call(HPX_FORWARD(Parameters, params),
+                HPX_FORWARD(Executor, exec), element_size);
+        }
+    } get_prefetch_distance{};
 }}}    // namespace hpx::parallel::execution
@@ -0,0 +1,319 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/executors/learning_chunk_size.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/async_base/scheduling_properties.hpp>
+#include <hpx/execution/detail/execution_parameter_callbacks.hpp>
+#include <hpx/execution_base/traits/is_executor_parameters.hpp>
+#include <hpx/functional/tag_invoke.hpp>
+#include <hpx/modules/timing.hpp>
+#include <hpx/synchronization/spinlock.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+namespace hpx { namespace execution { namespace experimental {
+
+    /// \cond NOINTERNAL
+    namespace detail {
+
+        // The measurements collected for one call site, they are shared by
+        // all executor parameter objects using the same key.
+        struct learning_chunk_size_state
+        {
+            hpx::spinlock mtx_;
+
+            // number of invocations measured so far
+            std::size_t num_invocations_ = 0;
+
+            // exponential moving averages of the time per loop iteration
+            // (nanoseconds), the number of loop iterations, and the number
+            // of cores the loop was run on
+            double iteration_time_ = 0.0;
+            double count_ = 0.0;
+            double cores_ = 0.0;
+        };
+
+        // Return the state for the given call site, the state is created if
+        // the key was not used before.
+        HPX_CORE_EXPORT std::shared_ptr<learning_chunk_size_state>
+        get_learning_chunk_size_state(std::string const& key);
+    }    // namespace detail
+    /// \endcond
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Loop iterations are divided into pieces and then assigned to threads.
+    /// The number of loop iterations combined is determined from the time per
+    /// loop iteration, which is measured for each invocation of an algorithm
+    /// and refined across invocations using an exponential moving average.
+    ///
+    /// Measurements are kept per call site. A call site is identified by the
+    /// tag given on construction or, if no tag is given, by the annotation of
+    /// the executor the algorithm is executed on (see
+    /// hpx::execution::experimental::with_annotation). If neither is
+    /// available, the measurements are shared between the copies of the
+    /// executor parameters object only.
+    ///
+    /// This executor parameters type makes sure that as many loop iterations
+    /// are combined as necessary to run for the amount of time specified,
+    /// which also limits the number of cores used for loops with little
+    /// overall work.
+    ///
+    struct learning_chunk_size
+    {
+    public:
+        /// Construct a \a learning_chunk_size executor parameters object
+        ///
+        /// \param tag          [in] The (optional) name of the call site, the
+        ///                     string has to outlive all uses of the object.
+        /// \param smoothing    [in] The weight of a new measurement in the
+        ///                     moving averages, in (0, 1].
+        ///
+        /// \note Default constructed \a learning_chunk_size executor parameter
+        ///       types will use 200 microseconds as the execution time for
+        ///       each chunk.
+        ///
+        explicit learning_chunk_size(
+            char const* tag = nullptr, double smoothing = 0.25)
+          : data_(std::make_shared<data>(tag, 200000, smoothing))
+        {
+        }
+
+        /// Construct a \a learning_chunk_size executor parameters object
+        ///
+        /// \param tag          [in] The name of the call site, the string has
+        ///                     to outlive all uses of the object.
+        /// \param time_cs      [in] The execution time for each chunk.
+        /// \param smoothing    [in] The weight of a new measurement in the
+        ///                     moving averages, in (0, 1].
+        ///
+        learning_chunk_size(char const* tag,
+            hpx::chrono::steady_duration const& time_cs,
+            double smoothing = 0.25)
+          : data_(std::make_shared<data>(
+                tag, time_cs.value().count(), smoothing))
+        {
+        }
+
+        /// \cond NOINTERNAL
+        // This executor parameters type synchronously invokes the provided
+        // testing function in order to approximate the chunk-size for the
+        // first invocation of a call site.
+        using invokes_testing_function = std::true_type;
+
+        // Use the number of cores learned in previous invocations (only
+        // applies for executors which don't expose the number of cores).
+        template <typename Executor>
+        std::size_t processing_units_count(Executor&& exec) const
+        {
+            std::size_t const available =
+                hpx::parallel::execution::detail::get_os_thread_count();
+
+            auto& state = get_state(exec);
+            std::lock_guard<hpx::spinlock> l(state.mtx_);
+            if (state.num_invocations_ == 0)
+            {
+                return available;
+            }
+            return (std::min)(available,
+                (std::max)(std::size_t(1),
+                    static_cast<std::size_t>(std::lround(state.cores_))));
+        }
+
+        template <typename Executor>
+        void mark_begin_execution(Executor&& exec) const
+        {
+            get_state(exec);
+
+            data_->count_ = 0;
+            data_->start_ = hpx::chrono::high_resolution_clock::now();
+        }
+
+        template <typename Executor, typename F>
+        std::size_t get_chunk_size(
+            Executor&& exec, F&& f, std::size_t cores, std::size_t count)
+        {
+            if (cores == 0)
+            {
+                cores = 1;
+            }
+            if (count == 0)
+            {
+                return 0;
+            }
+
+            auto& state = get_state(exec);
+
+            double iteration_time = 0.0;
+            {
+                std::lock_guard<hpx::spinlock> l(state.mtx_);
+                iteration_time = state.iteration_time_;
+            }
+
+            data_->count_ = count;
+            if (iteration_time == 0.0)
+            {
+                // this call site was not measured before, run 1% of the
+                // iterations to get a first estimate
+                std::size_t const num_iters_for_timing =
+                    (std::max)(std::size_t(1), count / 100);
+
+                std::uint64_t t = hpx::chrono::high_resolution_clock::now();
+                std::size_t const test_chunk_size = f(num_iters_for_timing);
+                if (test_chunk_size != 0)
+                {
+                    t = hpx::chrono::high_resolution_clock::now() - t;
+                    iteration_time = double(t) / double(test_chunk_size);
+                    count -= test_chunk_size;
+                    if (count == 0)
+                    {
+                        data_->cores_ = 1;
+                        return 0;
+                    }
+                }
+            }
+
+            std::size_t chunk_size = (count + cores - 1) / cores;
+            if (iteration_time > 0.0)
+            {
+                // combine as many iterations as needed to run for the
+                // required amount of time, but create at least one chunk
+                // per core
+                double const iters =
+                    double(data_->chunk_size_time_) / iteration_time;
+                if (iters < double(chunk_size))
+                {
+                    chunk_size = (std::max)(
+                        std::size_t(1), static_cast<std::size_t>(iters));
+                }
+            }
+
+            data_->cores_ =
+                (std::min)(cores, (count + chunk_size - 1) / chunk_size);
+            return chunk_size;
+        }
+
+        template <typename Executor>
+        void mark_end_execution(Executor&& exec) const
+        {
+            std::size_t const count = data_->count_;
+            if (count == 0)
+            {
+                return;
+            }
+
+            std::uint64_t const elapsed =
+                hpx::chrono::high_resolution_clock::now() - data_->start_;
+
+            // the (sequential) time per iteration, assuming the work was
+            // evenly distributed over the cores used
+            std::size_t const cores = (std::max)(std::size_t(1), data_->cores_);
+            double const iteration_time =
+                double(elapsed) * double(cores) / double(count);
+
+            auto& state = get_state(exec);
+            double const alpha = data_->smoothing_;
+
+            std::lock_guard<hpx::spinlock> l(state.mtx_);
+            if (state.num_invocations_++ == 0)
+            {
+                state.iteration_time_ = iteration_time;
+                state.count_ = double(count);
+                state.cores_ = double(cores);
+            }
+            else
+            {
+                state.iteration_time_ +=
+                    alpha * (iteration_time - state.iteration_time_);
+                state.count_ += alpha * (double(count) - state.count_);
+                state.cores_ += alpha * (double(cores) - state.cores_);
+            }
+
+            data_->count_ = 0;
+        }
+        /// \endcond
+
+    private:
+        /// \cond NOINTERNAL
+        struct data
+        {
+            data(char const* tag, std::uint64_t chunk_size_time,
+                double smoothing)
+              : chunk_size_time_(chunk_size_time)
+              , smoothing_(smoothing <= 0.0 || smoothing > 1.0 ? 1.0 :
+                                                                 smoothing)
+            {
+                if (tag != nullptr)
+                {
+                    state_ = detail::get_learning_chunk_size_state(tag);
+                }
+            }
+
+            std::shared_ptr<detail::learning_chunk_size_state> state_;
+            std::uint64_t chunk_size_time_;    // nanoseconds
+            double smoothing_;
+
+            // data of the current invocation
+            std::uint64_t start_ = 0;
+            std::size_t count_ = 0;
+            std::size_t cores_ = 0;
+        };
+
+        // Bind the object to the measurements of its call site on first use.
+        template <typename Executor>
+        detail::learning_chunk_size_state& get_state(
+            Executor const& exec) const
+        {
+            if (!data_->state_)
+            {
+#if defined(HPX_HAVE_THREAD_DESCRIPTION)
+                using hpx::execution::experimental::get_annotation_t;
+                if constexpr (hpx::functional::is_tag_invocable_v<
+                                  get_annotation_t, Executor const&>)
+                {
+                    char const* annotation =
+                        hpx::execution::experimental::get_annotation(exec);
+                    if (annotation != nullptr)
+                    {
+                        data_->state_ =
+                            detail::get_learning_chunk_size_state(annotation);
+                        return *data_->state_;
+                    }
+                }
+#else
+                HPX_UNUSED(exec);
+#endif
+                data_->state_ =
+                    std::make_shared<detail::learning_chunk_size_state>();
+            }
+            return *data_->state_;
+        }
+
+        std::shared_ptr<data> data_;
+        /// \endcond
+    };
+}}}    // namespace hpx::execution::experimental
+
+namespace hpx { namespace parallel { namespace execution {
+    /// \cond NOINTERNAL
+    template <>
+    struct is_executor_parameters<
+        hpx::execution::experimental::learning_chunk_size> : std::true_type
+    {
+    };
+    /// \endcond
+}}}    // namespace hpx::parallel::execution
@@ -0,0 +1,230 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/executors/prefetch_distance.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
+#include <hpx/execution_base/traits/is_executor_parameters.hpp>
+#include <hpx/modules/timing.hpp>
+#include <hpx/serialization/serialize.hpp>
+#include <hpx/synchronization/spinlock.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+
+namespace hpx { namespace execution { namespace experimental {
+
+    /// \cond NOINTERNAL
+    namespace detail {
+
+        // Convert a distance given in cache lines into a number of elements
+        // of the given size, at least one element is prefetched.
+        constexpr std::size_t prefetch_distance_elements(
+            std::size_t cache_lines, std::size_t element_size) noexcept
+        {
+            std::size_t const distance =
+                cache_lines * hpx::threads::get_cache_line_size() /
+                (element_size == 0 ? 1 : element_size);
+            return distance == 0 ? 1 : distance;
+        }
+    }    // namespace detail
+    /// \endcond
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Algorithms supporting software prefetching (see
+    /// hpx::parallel::util::make_prefetcher_context) prefetch the given
+    /// number of cache lines in front of the element currently being
+    /// processed.
+    ///
+    struct prefetch_distance
+    {
+        /// Construct a \a prefetch_distance executor parameters object
+        ///
+        /// \param cache_lines  [in] The number of cache lines to prefetch
+        ///                     ahead of the current element.
+        ///
+        constexpr explicit prefetch_distance(
+            std::size_t cache_lines = 2) noexcept
+          : cache_lines_(cache_lines == 0 ? 1 : cache_lines)
+        {
+        }
+
+        /// \cond NOINTERNAL
+        template <typename Executor>
+        constexpr std::size_t get_prefetch_distance(
+            Executor&&, std::size_t element_size) const noexcept
+        {
+            return detail::prefetch_distance_elements(
+                cache_lines_, element_size);
+        }
+        /// \endcond
+
+    private:
+        /// \cond NOINTERNAL
+        friend class hpx::serialization::access;
+
+        template <typename Archive>
+        void serialize(Archive& ar, const unsigned int /* version */)
+        {
+            // clang-format off
+            ar & cache_lines_;
+            // clang-format on
+        }
+
+        std::size_t cache_lines_;
+        /// \endcond
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Algorithms supporting software prefetching (see
+    /// hpx::parallel::util::make_prefetcher_context) prefetch a number of
+    /// cache lines in front of the element currently being processed which
+    /// is tuned automatically.
+    ///
+    /// The execution time of every algorithm invocation using this object
+    /// (or a copy of it) is measured. Starting with a distance of one cache
+    /// line, the distance is doubled for each invocation as long as the
+    /// execution time decreases. The fastest distance found is used for the
+    /// following invocations, and the search is repeated after the given
+    /// number of invocations to adapt to changing conditions.
+    ///
+    /// \note The measurements are only meaningful if the algorithms using
+    ///       this object perform similar amounts of work in each invocation,
+    ///       as for instance the kernels of an iterative solver.
+    ///
+    struct auto_prefetch_distance
+    {
+        /// Construct an \a auto_prefetch_distance executor parameters object
+        ///
+        /// \param max_cache_lines [in] The largest number of cache lines
+        ///                     which will be prefetched.
+        /// \param retune_interval [in] The number of invocations after which
+        ///                     the distance is tuned again (zero disables
+        ///                     tuning again).
+        ///
+        explicit auto_prefetch_distance(std::size_t max_cache_lines = 64,
+            std::size_t retune_interval = 1024)
+          : data_(std::make_shared<data>(
+                max_cache_lines == 0 ? 1 : max_cache_lines, retune_interval))
+        {
+        }
+
+        /// \cond NOINTERNAL
+        template <typename Executor>
+        void mark_begin_execution(Executor&&) const
+        {
+            data_->start_ = hpx::chrono::high_resolution_clock::now();
+        }
+
+        template <typename Executor>
+        std::size_t get_prefetch_distance(
+            Executor&&, std::size_t element_size) const
+        {
+            std::lock_guard<hpx::spinlock> l(data_->mtx_);
+            return detail::prefetch_distance_elements(
+                data_->current_, element_size);
+        }
+
+        template <typename Executor>
+        void mark_end_execution(Executor&&) const
+        {
+            std::uint64_t const elapsed =
+                hpx::chrono::high_resolution_clock::now() - data_->start_;
+
+            std::lock_guard<hpx::spinlock> l(data_->mtx_);
+            data_->update(elapsed);
+        }
+        /// \endcond
+
+    private:
+        /// \cond NOINTERNAL
+        struct data
+        {
+            data(std::size_t max_cache_lines, std::size_t retune_interval)
+              : max_cache_lines_(max_cache_lines)
+              , retune_interval_(retune_interval)
+            {
+            }
+
+            // Account for the execution time of an invocation which used the
+            // current distance and select the distance for the next one.
+            void update(std::uint64_t elapsed)
+            {
+                if (!tuning_)
+                {
+                    if (retune_interval_ != 0 &&
+                        ++num_invocations_ >= retune_interval_)
+                    {
+                        // start over with the smallest distance
+                        tuning_ = true;
+                        best_time_ = 0;
+                        current_ = 1;
+                    }
+                    return;
+                }
+
+                if (best_time_ == 0 || elapsed < best_time_)
+                {
+                    best_time_ = elapsed;
+                    best_ = current_;
+
+                    if (current_ * 2 <= max_cache_lines_)
+                    {
+                        current_ *= 2;
+                        return;
+                    }
+                }
+
+                // the execution time did not improve any more
+                tuning_ = false;
+                num_invocations_ = 0;
+                current_ = best_;
+            }
+
+            hpx::spinlock mtx_;
+
+            std::size_t max_cache_lines_;
+            std::size_t retune_interval_;
+
+            // distance (in cache lines) used for the next invocation and the
+            // fastest distance found so far
+            std::size_t current_ = 1;
+            std::size_t best_ = 1;
+            std::uint64_t best_time_ = 0;    // nanoseconds
+
+            bool tuning_ = true;
+            std::size_t num_invocations_ = 0;
+
+            // start of the current invocation
+            std::uint64_t start_ = 0;
+        };
+
+        std::shared_ptr<data> data_;
+        /// \endcond
+    };
+}}}    // namespace hpx::execution::experimental
+
+namespace hpx { namespace parallel { namespace execution {
+    /// \cond NOINTERNAL
+    template <>
+    struct is_executor_parameters<
+        hpx::execution::experimental::prefetch_distance> : std::true_type
+    {
+    };
+
+    template <>
+    struct is_executor_parameters<
+        hpx::execution::experimental::auto_prefetch_distance> : std::true_type
+    {
+    };
+    /// \endcond
+}}}    // namespace hpx::parallel::execution
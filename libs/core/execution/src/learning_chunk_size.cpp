@@ -0,0 +1,47 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/execution/executors/learning_chunk_size.hpp>
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace hpx::execution::experimental::detail {
+
+    namespace {
+
+        struct learning_chunk_size_states
+        {
+            std::mutex mtx_;
+            std::unordered_map<std::string,
+                std::shared_ptr<learning_chunk_size_state>>
+                states_;
+        };
+
+        learning_chunk_size_states& get_learning_chunk_size_states()
+        {
+            static learning_chunk_size_states states;
+            return states;
+        }
+    }    // namespace
+
+    std::shared_ptr<learning_chunk_size_state> get_learning_chunk_size_state(
+        std::string const& key)
+    {
+        auto& states = get_learning_chunk_size_states();
+
+        std::lock_guard<std::mutex> l(states.mtx_);
+        auto& state = states.states_[key];
+        if (!state)
+        {
+            state = std::make_shared<learning_chunk_size_state>();
+        }
+        return state;
+    }
+}    // namespace hpx::execution::experimental::detail
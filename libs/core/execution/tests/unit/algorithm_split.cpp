@@ -12,10 +12,12 @@
 
 #include <atomic>
 #include <exception>
+#include <functional>
 #include <stdexcept>
 #include <string>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 namespace ex = hpx::execution::experimental;
 
@@ -29,8 +31,84 @@ auto tag_invoke(
     return void_sender{};
 }
 
+// A sender which completes with the given value only once the function
+// stored in trigger is invoked.
+struct deferred_sender
+{
+    int value;
+    std::function<void()>& trigger;
+
+    template <typename R>
+    struct operation_state
+    {
+        int value;
+        std::function<void()>& trigger;
+        std::decay_t<R> r;
+
+        friend void tag_invoke(ex::start_t, operation_state& os) noexcept
+        {
+            os.trigger = [&os]() { ex::set_value(std::move(os.r), os.value); };
+        }
+    };
+
+    template <typename R>
+    friend operation_state<R> tag_invoke(
+        ex::connect_t, deferred_sender s, R&& r)
+    {
+        return {s.value, s.trigger, std::forward<R>(r)};
+    }
+
+    template <typename Env>
+    friend auto tag_invoke(
+        ex::get_completion_signatures_t, deferred_sender const&, Env)
+        -> ex::completion_signatures<ex::set_value_t(int)>;
+};
+
 int main()
 {
+    // Receivers connected before the predecessor completes are completed in
+    // the order they were started
+    {
+        std::function<void()> trigger;
+        auto s = deferred_sender{42, trigger} | ex::split();
+
+        std::vector<int> order;
+        std::atomic<bool> set_value_called[3] = {false, false, false};
+        auto make_receiver = [&](int i) {
+            auto f = [&order, i](int x) {
+                HPX_TEST_EQ(x, 42);
+                order.push_back(i);
+            };
+            return callback_receiver<decltype(f)>{f, set_value_called[i]};
+        };
+
+        auto os0 = ex::connect(s, make_receiver(0));
+        auto os1 = ex::connect(s, make_receiver(1));
+        auto os2 = ex::connect(s, make_receiver(2));
+        ex::start(os0);
+        ex::start(os1);
+        ex::start(os2);
+
+        HPX_TEST(order.empty());
+        HPX_TEST(trigger);
+        trigger();
+
+        HPX_TEST(order == std::vector<int>({0, 1, 2}));
+        for (auto& called : set_value_called)
+        {
+            HPX_TEST(called);
+        }
+
+        // receivers started after the predecessor completed are completed
+        // inline
+        std::atomic<bool> late_set_value_called{false};
+        auto f = [](int x) { HPX_TEST_EQ(x, 42); };
+        auto r = callback_receiver<decltype(f)>{f, late_set_value_called};
+        auto late_os = ex::connect(s, std::move(r));
+        ex::start(late_os);
+        HPX_TEST(late_set_value_called);
+    }
+
     // Success path
     {
         std::atomic<bool> set_value_called{false};
@@ -86,6 +86,48 @@ void test_persistent_executitor_parameters_ref()
     }
 }
 
+void test_learning_executor_parameters()
+{
+    typedef std::random_access_iterator_tag iterator_tag;
+
+    // repeated invocations refine the measurements of the same call site
+    for (int i = 0; i != 3; ++i)
+    {
+        hpx::execution::experimental::learning_chunk_size p(
+            "test_learning_executor_parameters");
+        test_for_each(hpx::execution::par.with(p), iterator_tag());
+    }
+
+    for (int i = 0; i != 3; ++i)
+    {
+        hpx::execution::experimental::learning_chunk_size p(
+            "test_learning_executor_parameters_async");
+        auto policy = hpx::execution::par(hpx::execution::task).with(p);
+        test_for_each_async(policy, iterator_tag());
+    }
+
+    hpx::execution::parallel_executor par_exec;
+
+#if defined(HPX_HAVE_THREAD_DESCRIPTION)
+    // the call site is identified by the annotation of the executor
+    auto annotated_exec = hpx::execution::experimental::with_annotation(
+        par_exec, "test_learning_executor_parameters_annotated");
+
+    for (int i = 0; i != 3; ++i)
+    {
+        hpx::execution::experimental::learning_chunk_size p;
+        test_for_each(
+            hpx::execution::par.on(annotated_exec).with(p), iterator_tag());
+    }
+#endif
+
+    {
+        hpx::execution::experimental::learning_chunk_size p;
+        test_for_each(
+            hpx::execution::par.on(par_exec).with(std::ref(p)), iterator_tag());
+    }
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 int hpx_main(hpx::program_options::variables_map& vm)
 {
@@ -98,6 +140,7 @@ int hpx_main(hpx::program_options::variables_map& vm)
 
     test_persistent_executitor_parameters();
     test_persistent_executitor_parameters_ref();
+    test_learning_executor_parameters();
 
     return hpx::local::finalize();
 }
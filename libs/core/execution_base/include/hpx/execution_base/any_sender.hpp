@@ -316,6 +316,14 @@ namespace hpx::detail {
 }    // namespace hpx::detail
 
 namespace hpx::execution::experimental::detail {
+    // The default sizes of the embedded storage of any_sender,
+    // unique_any_sender, and of their operation states. Senders and operation
+    // states which are larger than that are allocated on the heap.
+    inline constexpr std::size_t default_any_sender_storage_size =
+        4 * sizeof(void*);
+    inline constexpr std::size_t default_any_operation_state_storage_size =
+        8 * sizeof(void*);
+
     template <typename Sender, typename Receiver>
     struct any_operation_state_impl final : any_operation_state_base
     {
@@ -336,35 +344,45 @@ namespace hpx::execution::experimental::detail {
         }
     };
 
-    class HPX_CORE_EXPORT any_operation_state
+    // The operation state is stored in the embedded storage of the given
+    // size, if possible.
+    template <std::size_t EmbeddedStorageSize>
+    class basic_any_operation_state
     {
         using base_type = detail::any_operation_state_base;
         template <typename Sender, typename Receiver>
         using impl_type = detail::any_operation_state_impl<Sender, Receiver>;
         using storage_type =
-            hpx::detail::movable_sbo_storage<base_type, 8 * sizeof(void*)>;
+            hpx::detail::movable_sbo_storage<base_type, EmbeddedStorageSize>;
 
         storage_type storage{};
 
     public:
         template <typename Sender, typename Receiver>
-        any_operation_state(Sender&& sender, Receiver&& receiver)
+        basic_any_operation_state(Sender&& sender, Receiver&& receiver)
         {
             storage.template store<impl_type<Sender, Receiver>>(
                 HPX_FORWARD(Sender, sender), HPX_FORWARD(Receiver, receiver));
         }
 
-        ~any_operation_state() = default;
-        any_operation_state(any_operation_state&&) = delete;
-        any_operation_state(any_operation_state const&) = delete;
-        any_operation_state& operator=(any_operation_state&&) = delete;
-        any_operation_state& operator=(any_operation_state const&) = delete;
+        ~basic_any_operation_state() = default;
+        basic_any_operation_state(basic_any_operation_state&&) = delete;
+        basic_any_operation_state(basic_any_operation_state const&) = delete;
+        basic_any_operation_state& operator=(
+            basic_any_operation_state&&) = delete;
+        basic_any_operation_state& operator=(
+            basic_any_operation_state const&) = delete;
 
-        HPX_CORE_EXPORT friend void tag_invoke(
-            hpx::execution::experimental::start_t,
-            any_operation_state& os) noexcept;
+        friend void tag_invoke(hpx::execution::experimental::start_t,
+            basic_any_operation_state& os) noexcept
+        {
+            os.storage.get().start();
+        }
     };
 
+    using any_operation_state =
+        basic_any_operation_state<default_any_operation_state_storage_size>;
+
     template <typename... Ts>
     struct any_receiver_base
     {
@@ -530,12 +548,15 @@ namespace hpx::execution::experimental::detail {
         }
     };
 
-    template <typename... Ts>
+    template <std::size_t OperationStateStorageSize, typename... Ts>
     struct unique_any_sender_base
     {
+        using operation_state_type =
+            basic_any_operation_state<OperationStateStorageSize>;
+
         virtual ~unique_any_sender_base() = default;
         virtual void move_into(void* p) = 0;
-        virtual any_operation_state connect(
+        virtual operation_state_type connect(
             any_receiver<Ts...>&& receiver) && = 0;
         virtual bool empty() const noexcept
         {
@@ -543,19 +564,28 @@ namespace hpx::execution::experimental::detail {
         }
     };
 
-    template <typename... Ts>
-    struct any_sender_base : public unique_any_sender_base<Ts...>
+    template <std::size_t OperationStateStorageSize, typename... Ts>
+    struct any_sender_base
+      : public unique_any_sender_base<OperationStateStorageSize, Ts...>
     {
+        using base_type =
+            unique_any_sender_base<OperationStateStorageSize, Ts...>;
+        using typename base_type::operation_state_type;
+
         virtual any_sender_base* clone() const = 0;
         virtual void clone_into(void* p) const = 0;
-        using unique_any_sender_base<Ts...>::connect;
-        virtual any_operation_state connect(
+        using base_type::connect;
+        virtual operation_state_type connect(
             any_receiver<Ts...>&& receiver) & = 0;
     };
 
-    template <typename... Ts>
-    struct empty_unique_any_sender final : unique_any_sender_base<Ts...>
+    template <std::size_t OperationStateStorageSize, typename... Ts>
+    struct empty_unique_any_sender final
+      : unique_any_sender_base<OperationStateStorageSize, Ts...>
     {
+        using typename unique_any_sender_base<OperationStateStorageSize,
+            Ts...>::operation_state_type;
+
         void move_into(void*) override
         {
             HPX_UNREACHABLE;
@@ -566,22 +596,27 @@ namespace hpx::execution::experimental::detail {
             return true;
         }
 
-        [[noreturn]] any_operation_state connect(any_receiver<Ts...>&&) &&
+        [[noreturn]] operation_state_type connect(any_receiver<Ts...>&&) &&
             override
         {
             throw_bad_any_call("unique_any_sender", "connect");
         }
     };
 
-    template <typename... Ts>
-    struct empty_any_sender final : any_sender_base<Ts...>
+    template <std::size_t OperationStateStorageSize, typename... Ts>
+    struct empty_any_sender final
+      : any_sender_base<OperationStateStorageSize, Ts...>
     {
+        using typename any_sender_base<OperationStateStorageSize,
+            Ts...>::operation_state_type;
+
         void move_into(void*) override
         {
             HPX_UNREACHABLE;
         }
 
-        any_sender_base<Ts...>* clone() const override
+        any_sender_base<OperationStateStorageSize, Ts...>* clone()
+            const override
         {
             HPX_UNREACHABLE;
         }
@@ -596,22 +631,27 @@ namespace hpx::execution::experimental::detail {
             return true;
         }
 
-        [[noreturn]] any_operation_state connect(any_receiver<Ts...>&&) &
+        [[noreturn]] operation_state_type connect(any_receiver<Ts...>&&) &
             override
         {
             throw_bad_any_call("any_sender", "connect");
         }
 
-        [[noreturn]] any_operation_state connect(any_receiver<Ts...>&&) &&
+        [[noreturn]] operation_state_type connect(any_receiver<Ts...>&&) &&
             override
         {
             throw_bad_any_call("any_sender", "connect");
         }
     };
 
-    template <typename Sender, typename... Ts>
-    struct unique_any_sender_impl final : unique_any_sender_base<Ts...>
+    template <typename Sender, std::size_t OperationStateStorageSize,
+        typename... Ts>
+    struct unique_any_sender_impl final
+      : unique_any_sender_base<OperationStateStorageSize, Ts...>
     {
+        using typename unique_any_sender_base<OperationStateStorageSize,
+            Ts...>::operation_state_type;
+
         std::decay_t<Sender> sender;
 
         template <typename Sender_,
@@ -627,15 +667,21 @@ namespace hpx::execution::experimental::detail {
             new (p) unique_any_sender_impl(HPX_MOVE(sender));
         }
 
-        any_operation_state connect(any_receiver<Ts...>&& receiver) && override
+        operation_state_type connect(
+            any_receiver<Ts...>&& receiver) && override
         {
-            return any_operation_state{HPX_MOVE(sender), HPX_MOVE(receiver)};
+            return operation_state_type{HPX_MOVE(sender), HPX_MOVE(receiver)};
         }
     };
 
-    template <typename Sender, typename... Ts>
-    struct any_sender_impl final : any_sender_base<Ts...>
+    template <typename Sender, std::size_t OperationStateStorageSize,
+        typename... Ts>
+    struct any_sender_impl final
+      : any_sender_base<OperationStateStorageSize, Ts...>
     {
+        using typename any_sender_base<OperationStateStorageSize,
+            Ts...>::operation_state_type;
+
         std::decay_t<Sender> sender;
 
         template <typename Sender_,
@@ -651,7 +697,8 @@ namespace hpx::execution::experimental::detail {
             new (p) any_sender_impl(HPX_MOVE(sender));
         }
 
-        any_sender_base<Ts...>* clone() const override
+        any_sender_base<OperationStateStorageSize, Ts...>* clone()
+            const override
         {
             return new any_sender_impl(sender);
         }
@@ -661,14 +708,16 @@ namespace hpx::execution::experimental::detail {
             new (p) any_sender_impl(sender);
         }
 
-        any_operation_state connect(any_receiver<Ts...>&& receiver) & override
+        operation_state_type connect(
+            any_receiver<Ts...>&& receiver) & override
         {
-            return any_operation_state{sender, HPX_MOVE(receiver)};
+            return operation_state_type{sender, HPX_MOVE(receiver)};
         }
 
-        any_operation_state connect(any_receiver<Ts...>&& receiver) && override
+        operation_state_type connect(
+            any_receiver<Ts...>&& receiver) && override
         {
-            return any_operation_state{HPX_MOVE(sender), HPX_MOVE(receiver)};
+            return operation_state_type{HPX_MOVE(sender), HPX_MOVE(receiver)};
         }
     };
 }    // namespace hpx::execution::experimental::detail
@@ -700,27 +749,38 @@ namespace hpx::execution::experimental {
     }    // namespace detail
 #endif
 
-    template <typename... Ts>
-    class unique_any_sender
+    /// A type-erased sender which sends values of the types Ts... The erased
+    /// sender is kept in an embedded storage of SenderStorageSize bytes, and
+    /// the operation state created by connect in an embedded storage of
+    /// OperationStateStorageSize bytes. Senders and operation states which
+    /// don't fit are allocated on the heap.
+    template <std::size_t SenderStorageSize,
+        std::size_t OperationStateStorageSize, typename... Ts>
+    class basic_unique_any_sender
 #if !defined(HPX_HAVE_CXX20_TRIVIAL_VIRTUAL_DESTRUCTOR)
       : private detail::any_sender_static_empty_vtable_helper<Ts...>
 #endif
     {
-        using base_type = detail::unique_any_sender_base<Ts...>;
+        using base_type =
+            detail::unique_any_sender_base<OperationStateStorageSize, Ts...>;
         template <typename Sender>
-        using impl_type = detail::unique_any_sender_impl<Sender, Ts...>;
+        using impl_type = detail::unique_any_sender_impl<Sender,
+            OperationStateStorageSize, Ts...>;
         using storage_type =
-            hpx::detail::movable_sbo_storage<base_type, 4 * sizeof(void*)>;
+            hpx::detail::movable_sbo_storage<base_type, SenderStorageSize>;
+        using operation_state_type =
+            detail::basic_any_operation_state<OperationStateStorageSize>;
 
         storage_type storage{};
 
     public:
-        unique_any_sender() = default;
+        basic_unique_any_sender() = default;
 
         template <typename Sender,
             typename = std::enable_if_t<
-                !std::is_same_v<std::decay_t<Sender>, unique_any_sender>>>
-        unique_any_sender(Sender&& sender)
+                !std::is_same_v<std::decay_t<Sender>,
+                    basic_unique_any_sender>>>
+        basic_unique_any_sender(Sender&& sender)
         {
             storage.template store<impl_type<Sender>>(
                 HPX_FORWARD(Sender, sender));
@@ -728,30 +788,33 @@ namespace hpx::execution::experimental {
 
         template <typename Sender,
             typename = std::enable_if_t<
-                !std::is_same_v<std::decay_t<Sender>, unique_any_sender>>>
-        unique_any_sender& operator=(Sender&& sender)
+                !std::is_same_v<std::decay_t<Sender>,
+                    basic_unique_any_sender>>>
+        basic_unique_any_sender& operator=(Sender&& sender)
         {
             storage.template store<impl_type<Sender>>(
                 HPX_FORWARD(Sender, sender));
             return *this;
         }
 
-        ~unique_any_sender() = default;
-        unique_any_sender(unique_any_sender&&) = default;
-        unique_any_sender(unique_any_sender const&) = delete;
-        unique_any_sender& operator=(unique_any_sender&&) = default;
-        unique_any_sender& operator=(unique_any_sender const&) = delete;
+        ~basic_unique_any_sender() = default;
+        basic_unique_any_sender(basic_unique_any_sender&&) = default;
+        basic_unique_any_sender(basic_unique_any_sender const&) = delete;
+        basic_unique_any_sender& operator=(
+            basic_unique_any_sender&&) = default;
+        basic_unique_any_sender& operator=(
+            basic_unique_any_sender const&) = delete;
 
         template <typename Env>
-        friend auto tag_invoke(
-            get_completion_signatures_t, unique_any_sender const&, Env) noexcept
+        friend auto tag_invoke(get_completion_signatures_t,
+            basic_unique_any_sender const&, Env) noexcept
             -> completion_signatures<set_value_t(Ts...),
                 set_error_t(std::exception_ptr)>;
 
         template <typename R>
-        friend detail::any_operation_state tag_invoke(
-            hpx::execution::experimental::connect_t, unique_any_sender&& s,
-            R&& r)
+        friend operation_state_type tag_invoke(
+            hpx::execution::experimental::connect_t,
+            basic_unique_any_sender&& s, R&& r)
         {
             // We first move the storage to a temporary variable so that this
             // any_sender is empty after this connect. Doing
@@ -764,26 +827,41 @@ namespace hpx::execution::experimental {
     };
 
     template <typename... Ts>
-    class any_sender
+    using unique_any_sender =
+        basic_unique_any_sender<detail::default_any_sender_storage_size,
+            detail::default_any_operation_state_storage_size, Ts...>;
+
+    /// A copyable type-erased sender which sends values of the types Ts...
+    /// The erased sender is kept in an embedded storage of SenderStorageSize
+    /// bytes, and the operation state created by connect in an embedded
+    /// storage of OperationStateStorageSize bytes. Senders and operation
+    /// states which don't fit are allocated on the heap.
+    template <std::size_t SenderStorageSize,
+        std::size_t OperationStateStorageSize, typename... Ts>
+    class basic_any_sender
 #if !defined(HPX_HAVE_CXX20_TRIVIAL_VIRTUAL_DESTRUCTOR)
       : private detail::any_sender_static_empty_vtable_helper<Ts...>
 #endif
     {
-        using base_type = detail::any_sender_base<Ts...>;
+        using base_type =
+            detail::any_sender_base<OperationStateStorageSize, Ts...>;
         template <typename Sender>
-        using impl_type = detail::any_sender_impl<Sender, Ts...>;
+        using impl_type =
+            detail::any_sender_impl<Sender, OperationStateStorageSize, Ts...>;
         using storage_type =
-            hpx::detail::copyable_sbo_storage<base_type, 4 * sizeof(void*)>;
+            hpx::detail::copyable_sbo_storage<base_type, SenderStorageSize>;
+        using operation_state_type =
+            detail::basic_any_operation_state<OperationStateStorageSize>;
 
         storage_type storage{};
 
     public:
-        any_sender() = default;
+        basic_any_sender() = default;
 
         template <typename Sender,
             typename = std::enable_if_t<
-                !std::is_same_v<std::decay_t<Sender>, any_sender>>>
-        any_sender(Sender&& sender)
+                !std::is_same_v<std::decay_t<Sender>, basic_any_sender>>>
+        basic_any_sender(Sender&& sender)
         {
             static_assert(std::is_copy_constructible_v<std::decay_t<Sender>>,
                 "any_sender requires the given sender to be copy "
@@ -796,8 +874,8 @@ namespace hpx::execution::experimental {
 
         template <typename Sender,
             typename = std::enable_if_t<
-                !std::is_same_v<std::decay_t<Sender>, any_sender>>>
-        any_sender& operator=(Sender&& sender)
+                !std::is_same_v<std::decay_t<Sender>, basic_any_sender>>>
+        basic_any_sender& operator=(Sender&& sender)
         {
             static_assert(std::is_copy_constructible_v<std::decay_t<Sender>>,
                 "any_sender requires the given sender to be copy "
@@ -809,28 +887,31 @@ namespace hpx::execution::experimental {
             return *this;
         }
 
-        ~any_sender() = default;
-        any_sender(any_sender&&) = default;
-        any_sender(any_sender const&) = default;
-        any_sender& operator=(any_sender&&) = default;
-        any_sender& operator=(any_sender const&) = default;
+        ~basic_any_sender() = default;
+        basic_any_sender(basic_any_sender&&) = default;
+        basic_any_sender(basic_any_sender const&) = default;
+        basic_any_sender& operator=(basic_any_sender&&) = default;
+        basic_any_sender& operator=(basic_any_sender const&) = default;
 
         template <typename Env>
-        friend auto tag_invoke(get_completion_signatures_t, any_sender const&,
-            Env) noexcept -> completion_signatures<set_value_t(Ts...),
-            set_error_t(std::exception_ptr)>;
+        friend auto tag_invoke(get_completion_signatures_t,
+            basic_any_sender const&, Env) noexcept
+            -> completion_signatures<set_value_t(Ts...),
+                set_error_t(std::exception_ptr)>;
 
         template <typename R>
-        friend detail::any_operation_state tag_invoke(
-            hpx::execution::experimental::connect_t, any_sender& s, R&& r)
+        friend operation_state_type tag_invoke(
+            hpx::execution::experimental::connect_t, basic_any_sender& s,
+            R&& r)
         {
             return s.storage.get().connect(
                 detail::any_receiver<Ts...>{HPX_FORWARD(R, r)});
         }
 
         template <typename R>
-        friend detail::any_operation_state tag_invoke(
-            hpx::execution::experimental::connect_t, any_sender&& s, R&& r)
+        friend operation_state_type tag_invoke(
+            hpx::execution::experimental::connect_t, basic_any_sender&& s,
+            R&& r)
         {
             // We first move the storage to a temporary variable so that this
             // any_sender is empty after this connect. Doing
@@ -841,24 +922,31 @@ namespace hpx::execution::experimental {
                 .connect(detail::any_receiver<Ts...>{HPX_FORWARD(R, r)});
         }
     };
+
+    template <typename... Ts>
+    using any_sender =
+        basic_any_sender<detail::default_any_sender_storage_size,
+            detail::default_any_operation_state_storage_size, Ts...>;
 }    // namespace hpx::execution::experimental
 
 namespace hpx::detail {
-    template <typename... Ts>
+    template <std::size_t OperationStateStorageSize, typename... Ts>
     struct empty_vtable_type<
-        hpx::execution::experimental::detail::unique_any_sender_base<Ts...>>
+        hpx::execution::experimental::detail::unique_any_sender_base<
+            OperationStateStorageSize, Ts...>>
     {
         using type =
             hpx::execution::experimental::detail::empty_unique_any_sender<
-                Ts...>;
+                OperationStateStorageSize, Ts...>;
     };
 
-    template <typename... Ts>
+    template <std::size_t OperationStateStorageSize, typename... Ts>
     struct empty_vtable_type<
-        hpx::execution::experimental::detail::any_sender_base<Ts...>>
+        hpx::execution::experimental::detail::any_sender_base<
+            OperationStateStorageSize, Ts...>>
     {
-        using type =
-            hpx::execution::experimental::detail::empty_any_sender<Ts...>;
+        using type = hpx::execution::experimental::detail::empty_any_sender<
+            OperationStateStorageSize, Ts...>;
     };
 }    // namespace hpx::detail
 
@@ -27,12 +27,6 @@ namespace hpx::execution::experimental::detail {
         return true;
     }
 
-    void tag_invoke(
-        hpx::execution::experimental::start_t, any_operation_state& os) noexcept
-    {
-        os.storage.get().start();
-    }
-
     void throw_bad_any_call(char const* class_name, char const* function_name)
     {
         HPX_THROW_EXCEPTION(hpx::bad_function_call,
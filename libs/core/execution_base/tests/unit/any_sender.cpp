@@ -15,6 +15,7 @@
 #include "algorithm_test_utils.hpp"
 
 #include <atomic>
+#include <cstddef>
 #include <exception>
 #include <string>
 #include <utility>
@@ -397,6 +398,57 @@ void test_unique_any_sender(F&& f, Ts&&... ts)
     }
 }
 
+// The sizes of the embedded storage can be chosen such that large senders and
+// their operation states are stored without allocating memory.
+void test_basic_any_sender_storage_size()
+{
+    constexpr std::size_t sender_storage_size = 256;
+    constexpr std::size_t operation_state_storage_size = 512;
+
+    {
+        using sender_type = ex::basic_any_sender<sender_storage_size,
+            operation_state_storage_size, int>;
+
+        static_assert(sizeof(sender_type) > sender_storage_size);
+
+        auto f = [](int x) { HPX_TEST_EQ(x, 42); };
+        sender_type as1{large_sender<int>{42}};
+        sender_type as2 = as1;
+
+        {
+            std::atomic<bool> set_value_called{false};
+            auto os = ex::connect(
+                as1, callback_receiver<decltype(f)>{f, set_value_called});
+            static_assert(sizeof(os) > operation_state_storage_size);
+            ex::start(os);
+            HPX_TEST(set_value_called);
+        }
+
+        {
+            std::atomic<bool> set_value_called{false};
+            auto os = ex::connect(std::move(as2),
+                callback_receiver<decltype(f)>{f, set_value_called});
+            ex::start(os);
+            HPX_TEST(set_value_called);
+        }
+    }
+
+    {
+        using sender_type = ex::basic_unique_any_sender<sender_storage_size,
+            operation_state_storage_size, int>;
+
+        auto f = [](int x) { HPX_TEST_EQ(x, 42); };
+        sender_type as1{large_non_copyable_sender<int>{42}};
+        sender_type as2 = std::move(as1);
+
+        std::atomic<bool> set_value_called{false};
+        auto os = ex::connect(std::move(as2),
+            callback_receiver<decltype(f)>{f, set_value_called});
+        ex::start(os);
+        HPX_TEST(set_value_called);
+    }
+}
+
 void test_any_sender_set_error()
 {
     error_sender<> s;
@@ -611,6 +663,9 @@ int main()
         },
         42, 3.14, custom_type_non_copyable(43));
 
+    // Senders and operation states in custom sized embedded storage
+    test_basic_any_sender_storage_size();
+
     // Failure paths
     test_any_sender_set_error();
     test_unique_any_sender_set_error();
@@ -0,0 +1,581 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_CXX20_COROUTINES)
+
+#include <hpx/allocator_support/internal_allocator.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/async_base/scheduling_properties.hpp>
+#include <hpx/config/coroutines_support.hpp>
+#include <hpx/coroutines/thread_enums.hpp>
+#include <hpx/datastructures/variant.hpp>
+#include <hpx/errors/throw_exception.hpp>
+#include <hpx/errors/try_catch_exception_ptr.hpp>
+#include <hpx/execution/algorithms/detail/single_result.hpp>
+#include <hpx/execution_base/completion_signatures.hpp>
+#include <hpx/execution_base/get_env.hpp>
+#include <hpx/execution_base/operation_state.hpp>
+#include <hpx/execution_base/receiver.hpp>
+#include <hpx/execution_base/sender.hpp>
+#include <hpx/executors/thread_pool_scheduler.hpp>
+#include <hpx/type_support/meta.hpp>
+#include <hpx/type_support/pack.hpp>
+#include <hpx/type_support/unused.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <type_traits>
+#include <utility>
+
+namespace hpx::execution::experimental {
+
+    template <typename T = void>
+    class task;
+
+    /// \cond NOINTERNAL
+    namespace detail {
+
+        template <typename T>
+        inline constexpr bool is_task_v = false;
+
+        template <typename T>
+        inline constexpr bool is_task_v<task<T>> = true;
+
+        ///////////////////////////////////////////////////////////////////////
+        // Awaiting a thread_pool_scheduler resumes the coroutine on a new
+        // stackless HPX thread.
+        struct task_schedule_awaiter
+        {
+            thread_pool_scheduler scheduler;
+
+            constexpr bool await_ready() const noexcept
+            {
+                return false;
+            }
+
+            void await_suspend(hpx::coro::coroutine_handle<> h) const
+            {
+                hpx::execution::experimental::with_stacksize(
+                    scheduler, hpx::threads::thread_stacksize::nostack)
+                    .execute([h]() { h.resume(); });
+            }
+
+            constexpr void await_resume() const noexcept {}
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        // Awaiting a sender connects it to a receiver which stores the result
+        // in the awaiter itself (which lives in the coroutine frame), no
+        // additional allocation is performed.
+        template <typename Sender>
+        using task_sender_result_t = std::decay_t<single_result_t<
+            value_types_of_t<Sender, empty_env, meta::pack, meta::pack>>>;
+
+        template <typename Sender>
+        struct task_sender_awaiter
+        {
+            using result_type = task_sender_result_t<Sender>;
+            using value_type = std::conditional_t<std::is_void_v<result_type>,
+                hpx::util::unused_type, result_type>;
+
+            struct receiver
+            {
+                task_sender_awaiter* awaiter;
+
+                template <typename... Ts>
+                friend void tag_invoke(
+                    set_value_t, receiver&& r, Ts&&... ts) noexcept
+                {
+                    hpx::detail::try_catch_exception_ptr(
+                        [&]() {
+                            r.awaiter->result.template emplace<1>(
+                                HPX_FORWARD(Ts, ts)...);
+                        },
+                        [&](std::exception_ptr ep) {
+                            r.awaiter->result.template emplace<2>(
+                                HPX_MOVE(ep));
+                        });
+                    r.awaiter->complete();
+                }
+
+                template <typename Error>
+                friend void tag_invoke(
+                    set_error_t, receiver&& r, Error&& error) noexcept
+                {
+                    if constexpr (std::is_same_v<std::decay_t<Error>,
+                                      std::exception_ptr>)
+                    {
+                        r.awaiter->result.template emplace<2>(
+                            HPX_FORWARD(Error, error));
+                    }
+                    else
+                    {
+                        r.awaiter->result.template emplace<2>(
+                            std::make_exception_ptr(HPX_FORWARD(Error, error)));
+                    }
+                    r.awaiter->complete();
+                }
+
+                friend void tag_invoke(set_stopped_t, receiver&& r) noexcept
+                {
+                    r.awaiter->complete();
+                }
+            };
+
+            explicit task_sender_awaiter(Sender&& sender)
+              : op_state(hpx::execution::experimental::connect(
+                    HPX_MOVE(sender), receiver{this}))
+            {
+            }
+
+            task_sender_awaiter(task_sender_awaiter&&) = delete;
+            task_sender_awaiter(task_sender_awaiter const&) = delete;
+            task_sender_awaiter& operator=(task_sender_awaiter&&) = delete;
+            task_sender_awaiter& operator=(
+                task_sender_awaiter const&) = delete;
+
+            constexpr bool await_ready() const noexcept
+            {
+                return false;
+            }
+
+            bool await_suspend(hpx::coro::coroutine_handle<> h) noexcept
+            {
+                continuation = h;
+                hpx::execution::experimental::start(op_state);
+
+                // don't suspend if the sender has completed synchronously
+                return !ready.exchange(true, std::memory_order_acq_rel);
+            }
+
+            result_type await_resume()
+            {
+                if (result.index() == 2)
+                {
+                    std::rethrow_exception(hpx::get<2>(HPX_MOVE(result)));
+                }
+                if (result.index() == 0)
+                {
+                    HPX_THROW_EXCEPTION(hpx::thread_cancelled,
+                        "task_sender_awaiter::await_resume",
+                        "the awaited sender completed with set_stopped");
+                }
+                if constexpr (!std::is_void_v<result_type>)
+                {
+                    return hpx::get<1>(HPX_MOVE(result));
+                }
+            }
+
+            // The coroutine is resumed by whoever arrives last, either the
+            // receiver (if the sender completes asynchronously) or
+            // await_suspend.
+            void complete() noexcept
+            {
+                if (ready.exchange(true, std::memory_order_acq_rel))
+                {
+                    continuation.resume();
+                }
+            }
+
+            hpx::variant<hpx::monostate, value_type, std::exception_ptr>
+                result;
+            std::atomic<bool> ready{false};
+            hpx::coro::coroutine_handle<> continuation;
+            connect_result_t<Sender, receiver> op_state;
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        struct task_promise_base
+        {
+            struct final_awaiter
+            {
+                constexpr bool await_ready() const noexcept
+                {
+                    return false;
+                }
+
+                template <typename Promise>
+                hpx::coro::coroutine_handle<> await_suspend(
+                    hpx::coro::coroutine_handle<Promise> h) noexcept
+                {
+                    task_promise_base& promise = h.promise();
+
+                    // symmetric transfer to the awaiting coroutine
+                    if (promise.continuation)
+                    {
+                        return promise.continuation;
+                    }
+
+                    // the task was started as a sender, this may destroy the
+                    // coroutine frame
+                    if (promise.on_completed != nullptr)
+                    {
+                        promise.on_completed(promise.on_completed_data);
+                    }
+                    return hpx::coro::noop_coroutine();
+                }
+
+                constexpr void await_resume() const noexcept {}
+            };
+
+            constexpr hpx::coro::suspend_always initial_suspend() const noexcept
+            {
+                return {};
+            }
+
+            constexpr final_awaiter final_suspend() const noexcept
+            {
+                return {};
+            }
+
+            // Awaiting an hpx::future reports exceptions through the promise
+            // before resuming the coroutine. The exception is rethrown by
+            // await_resume of the future, nothing needs to be done here.
+            void set_exception(std::exception_ptr) const noexcept {}
+
+            template <typename Awaitable>
+            decltype(auto) await_transform(Awaitable&& awaitable)
+            {
+                using awaitable_type = std::decay_t<Awaitable>;
+                if constexpr (is_task_v<awaitable_type>)
+                {
+                    return HPX_FORWARD(Awaitable, awaitable);
+                }
+                else if constexpr (std::is_same_v<awaitable_type,
+                                       thread_pool_scheduler>)
+                {
+                    return task_schedule_awaiter{
+                        HPX_FORWARD(Awaitable, awaitable)};
+                }
+                else if constexpr (is_scheduler_v<awaitable_type>)
+                {
+                    using sender_type = std::decay_t<decltype(
+                        hpx::execution::experimental::schedule(awaitable))>;
+                    return task_sender_awaiter<sender_type>(
+                        hpx::execution::experimental::schedule(awaitable));
+                }
+                else if constexpr (is_sender_v<awaitable_type, empty_env>)
+                {
+                    return task_sender_awaiter<awaitable_type>(
+                        awaitable_type(HPX_FORWARD(Awaitable, awaitable)));
+                }
+                else
+                {
+                    return HPX_FORWARD(Awaitable, awaitable);
+                }
+            }
+
+            // the coroutine frames are allocated using the internal allocator
+            [[nodiscard]] static void* operator new(std::size_t size)
+            {
+                hpx::util::internal_allocator<char> alloc{};
+                return alloc.allocate(size);
+            }
+
+            static void operator delete(void* p, std::size_t size) noexcept
+            {
+                hpx::util::internal_allocator<char> alloc{};
+                alloc.deallocate(static_cast<char*>(p), size);
+            }
+
+            hpx::coro::coroutine_handle<> continuation;
+            void (*on_completed)(void*) noexcept = nullptr;
+            void* on_completed_data = nullptr;
+        };
+
+        template <typename T>
+        struct task_promise : task_promise_base
+        {
+            task<T> get_return_object() noexcept;
+
+            void unhandled_exception() noexcept
+            {
+                result.template emplace<2>(std::current_exception());
+            }
+
+            template <typename U>
+            void return_value(U&& value)
+            {
+                result.template emplace<1>(HPX_FORWARD(U, value));
+            }
+
+            T get()
+            {
+                if (result.index() == 2)
+                {
+                    std::rethrow_exception(hpx::get<2>(HPX_MOVE(result)));
+                }
+                HPX_ASSERT(result.index() == 1);
+                return hpx::get<1>(HPX_MOVE(result));
+            }
+
+            template <typename Receiver>
+            void complete(Receiver&& receiver) noexcept
+            {
+                if (result.index() == 2)
+                {
+                    hpx::execution::experimental::set_error(
+                        HPX_FORWARD(Receiver, receiver),
+                        hpx::get<2>(HPX_MOVE(result)));
+                }
+                else
+                {
+                    HPX_ASSERT(result.index() == 1);
+                    hpx::execution::experimental::set_value(
+                        HPX_FORWARD(Receiver, receiver),
+                        hpx::get<1>(HPX_MOVE(result)));
+                }
+            }
+
+            hpx::variant<hpx::monostate, T, std::exception_ptr> result;
+        };
+
+        template <>
+        struct task_promise<void> : task_promise_base
+        {
+            task<void> get_return_object() noexcept;
+
+            void unhandled_exception() noexcept
+            {
+                exception = std::current_exception();
+            }
+
+            constexpr void return_void() const noexcept {}
+
+            void get()
+            {
+                if (exception)
+                {
+                    std::rethrow_exception(HPX_MOVE(exception));
+                }
+            }
+
+            template <typename Receiver>
+            void complete(Receiver&& receiver) noexcept
+            {
+                if (exception)
+                {
+                    hpx::execution::experimental::set_error(
+                        HPX_FORWARD(Receiver, receiver), HPX_MOVE(exception));
+                }
+                else
+                {
+                    hpx::execution::experimental::set_value(
+                        HPX_FORWARD(Receiver, receiver));
+                }
+            }
+
+            std::exception_ptr exception;
+        };
+
+        template <typename T, template <typename...> typename Tuple>
+        struct task_value_types
+        {
+            using type = Tuple<T>;
+        };
+
+        template <template <typename...> typename Tuple>
+        struct task_value_types<void, Tuple>
+        {
+            using type = Tuple<>;
+        };
+    }    // namespace detail
+    /// \endcond
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// A lazily started coroutine producing a value of type T.
+    ///
+    /// Unlike coroutines returning an hpx::future, a task does not allocate a
+    /// shared state, its result is stored in the coroutine frame itself. A
+    /// task starts executing when it is awaited by another coroutine or when
+    /// it is started as a sender. Awaiting a task transfers control to it
+    /// directly and the awaiting coroutine is resumed (symmetrically) as soon
+    /// as the task has finished.
+    ///
+    /// Inside a task the following expressions can be awaited:
+    ///   - another task (co_await some_task())
+    ///   - a thread_pool_scheduler, which resumes the coroutine on a new
+    ///     stackless HPX thread. The code following the co_await must not
+    ///     suspend the HPX thread (e.g. by blocking on a mutex or calling
+    ///     future::get), it may only await other awaitables.
+    ///   - any other scheduler, which is equivalent to awaiting the sender
+    ///     returned by schedule
+    ///   - any sender sending at most one value, the result of the co_await
+    ///     expression is this value. Errors are rethrown, stopped senders
+    ///     throw an hpx::exception.
+    ///   - any other awaitable (e.g. an hpx::future).
+    template <typename T>
+    class task
+    {
+    public:
+        using promise_type = detail::task_promise<T>;
+        using handle_type = hpx::coro::coroutine_handle<promise_type>;
+
+        task(task&& rhs) noexcept
+          : handle_(std::exchange(rhs.handle_, {}))
+        {
+        }
+
+        task& operator=(task&& rhs) noexcept
+        {
+            if (this != &rhs)
+            {
+                if (handle_)
+                {
+                    handle_.destroy();
+                }
+                handle_ = std::exchange(rhs.handle_, {});
+            }
+            return *this;
+        }
+
+        task(task const&) = delete;
+        task& operator=(task const&) = delete;
+
+        ~task()
+        {
+            if (handle_)
+            {
+                handle_.destroy();
+            }
+        }
+
+        /// \cond NOINTERNAL
+        struct awaiter
+        {
+            handle_type handle;
+
+            constexpr bool await_ready() const noexcept
+            {
+                return false;
+            }
+
+            hpx::coro::coroutine_handle<> await_suspend(
+                hpx::coro::coroutine_handle<> h) noexcept
+            {
+                handle.promise().continuation = h;
+                return handle;
+            }
+
+            T await_resume()
+            {
+                return handle.promise().get();
+            }
+        };
+
+        awaiter operator co_await() && noexcept
+        {
+            HPX_ASSERT(handle_);
+            return awaiter{handle_};
+        }
+
+        template <typename Env>
+        struct generate_completion_signatures
+        {
+            template <template <typename...> typename Tuple,
+                template <typename...> typename Variant>
+            using value_types =
+                Variant<typename detail::task_value_types<T, Tuple>::type>;
+
+            template <template <typename...> typename Variant>
+            using error_types = Variant<std::exception_ptr>;
+
+            static constexpr bool sends_stopped = false;
+        };
+
+        template <typename Env>
+        friend auto tag_invoke(get_completion_signatures_t, task const&,
+            Env) noexcept -> generate_completion_signatures<Env>;
+
+        template <typename Receiver>
+        struct operation_state
+        {
+            handle_type handle;
+            HPX_NO_UNIQUE_ADDRESS std::decay_t<Receiver> receiver;
+
+            template <typename Receiver_>
+            operation_state(handle_type handle, Receiver_&& receiver)
+              : handle(handle)
+              , receiver(HPX_FORWARD(Receiver_, receiver))
+            {
+            }
+
+            operation_state(operation_state&&) = delete;
+            operation_state(operation_state const&) = delete;
+            operation_state& operator=(operation_state&&) = delete;
+            operation_state& operator=(operation_state const&) = delete;
+
+            ~operation_state()
+            {
+                if (handle)
+                {
+                    handle.destroy();
+                }
+            }
+
+            static void on_completed(void* data) noexcept
+            {
+                auto& os = *static_cast<operation_state*>(data);
+                os.handle.promise().complete(HPX_MOVE(os.receiver));
+            }
+
+            friend void tag_invoke(start_t, operation_state& os) noexcept
+            {
+                HPX_ASSERT(os.handle);
+
+                auto& promise = os.handle.promise();
+                promise.on_completed = &on_completed;
+                promise.on_completed_data = &os;
+                os.handle.resume();
+            }
+        };
+
+        template <typename Receiver>
+        friend operation_state<Receiver> tag_invoke(
+            connect_t, task&& t, Receiver&& receiver)
+        {
+            HPX_ASSERT(t.handle_);
+            return {std::exchange(t.handle_, {}),
+                HPX_FORWARD(Receiver, receiver)};
+        }
+        /// \endcond
+
+    private:
+        friend promise_type;
+
+        explicit task(handle_type handle) noexcept
+          : handle_(handle)
+        {
+        }
+
+        handle_type handle_;
+    };
+
+    /// \cond NOINTERNAL
+    namespace detail {
+
+        template <typename T>
+        task<T> task_promise<T>::get_return_object() noexcept
+        {
+            return task<T>(
+                hpx::coro::coroutine_handle<task_promise>::from_promise(*this));
+        }
+
+        inline task<void> task_promise<void>::get_return_object() noexcept
+        {
+            return task<void>(
+                hpx::coro::coroutine_handle<task_promise>::from_promise(*this));
+        }
+    }    // namespace detail
+    /// \endcond
+}    // namespace hpx::execution::experimental
+
+#endif    // HPX_HAVE_CXX20_COROUTINES
@@ -7,11 +7,11 @@
 #pragma once
 
 #include <hpx/config.hpp>
+#include <hpx/allocator_support/allocator_deleter.hpp>
 #include <hpx/allocator_support/internal_allocator.hpp>
 #include <hpx/async_base/dataflow.hpp>
 #include <hpx/async_base/launch_policy.hpp>
 #include <hpx/async_base/traits/is_launch_policy.hpp>
-#include <hpx/coroutines/detail/get_stack_pointer.hpp>
 #include <hpx/datastructures/tuple.hpp>
 #include <hpx/errors/try_catch_exception_ptr.hpp>
 #include <hpx/execution/executors/execution.hpp>
@@ -29,6 +29,7 @@
 #include <hpx/modules/memory.hpp>
 #include <hpx/pack_traversal/pack_traversal_async.hpp>
 #include <hpx/threading_base/annotated_function.hpp>
+#include <hpx/threading_base/thread_helpers.hpp>
 #include <hpx/threading_base/thread_num_tss.hpp>
 #include <hpx/type_support/always_void.hpp>
 
@@ -277,30 +278,10 @@ namespace hpx { namespace lcos { namespace detail {
             hpx::detail::sync_policy, Futures_&& futures)
         {
             // We need to run the completion on a new thread if we are on a
-            // non HPX thread.
-            bool recurse_asynchronously =
-                hpx::threads::get_self_ptr() == nullptr;
-#if defined(HPX_HAVE_THREADS_GET_STACK_POINTER)
-            recurse_asynchronously = !this_thread::has_sufficient_stack_space();
-#else
-            struct handle_continuation_recursion_count
-            {
-                handle_continuation_recursion_count()
-                  : count_(threads::get_continuation_recursion_count())
-                {
-                    ++count_;
-                }
-                ~handle_continuation_recursion_count()
-                {
-                    --count_;
-                }
-
-                std::size_t& count_;
-            } cnt;
-            recurse_asynchronously = recurse_asynchronously ||
-                cnt.count_ > HPX_CONTINUATION_MAX_RECURSION_DEPTH;
-#endif
-            if (!recurse_asynchronously)
+            // non HPX thread, or if the continuations already run inline on
+            // this thread are nested too deeply.
+            threads::detail::continuation_recursion_scope cnt;
+            if (cnt.can_run_inline())
             {
                 hpx::scoped_annotation annotate(func_);
                 execute(is_void{}, HPX_FORWARD(Futures_, futures));
@@ -394,6 +375,56 @@ namespace hpx { namespace lcos { namespace detail {
         Func func_;
     };
 
+    ///////////////////////////////////////////////////////////////////////////
+    // A dataflow_frame which stores the arguments itself. As none of them
+    // has to be traversed, a continuation is attached to all futures at once
+    // and the function is invoked once all of them have arrived.
+    template <typename Allocator, typename Policy, typename Func,
+        typename Futures>
+    struct dataflow_counted_frame : dataflow_frame<Policy, Func, Futures>
+    {
+        using base_type = dataflow_frame<Policy, Func, Futures>;
+        using other_allocator = typename std::allocator_traits<
+            Allocator>::template rebind_alloc<dataflow_counted_frame>;
+
+        dataflow_counted_frame(other_allocator const& alloc,
+            typename base_type::construction_data data, Futures&& futures)
+          : base_type(HPX_MOVE(data))
+          , futures_(HPX_MOVE(futures))
+          , alloc_(alloc)
+        {
+        }
+
+        void start()
+        {
+            attach_arrival_callbacks(this, arrivals_, futures_);
+            on_arrival();
+        }
+
+        void on_arrival()
+        {
+            if (arrivals_.arrive())
+            {
+                (*this)(
+                    util::async_traverse_complete_tag{}, HPX_MOVE(futures_));
+            }
+        }
+
+    private:
+        void destroy() noexcept override
+        {
+            using traits = std::allocator_traits<other_allocator>;
+
+            other_allocator alloc(alloc_);
+            traits::destroy(alloc, this);
+            traits::deallocate(alloc, this, 1);
+        }
+
+        Futures futures_;
+        arrival_counter arrivals_;
+        other_allocator alloc_;
+    };
+
     ///////////////////////////////////////////////////////////////////////////
     template <typename Policy, typename Func, typename... Ts,
         typename Frame = dataflow_frame<typename std::decay<Policy>::type,
@@ -429,14 +460,43 @@ namespace hpx { namespace lcos { namespace detail {
         auto data = Frame::construct_from(
             HPX_FORWARD(Policy, policy), HPX_FORWARD(Func, func));
 
-        // Construct the dataflow_frame and traverse
-        // the arguments asynchronously
-        hpx::intrusive_ptr<Frame> p = util::traverse_pack_async_allocator(alloc,
-            util::async_traverse_in_place_tag<Frame>{}, HPX_MOVE(data),
-            HPX_FORWARD(Ts, ts)...);
-
         using traits::future_access;
-        return future_access<typename Frame::type>::create(HPX_MOVE(p));
+        if constexpr ((is_arrival_countable_v<std::decay_t<Ts>> && ...))
+        {
+            using futures_type = hpx::tuple<std::decay_t<Ts>...>;
+            using counted_frame = dataflow_counted_frame<Allocator,
+                std::decay_t<Policy>, std::decay_t<Func>, futures_type>;
+
+            using other_allocator = typename counted_frame::other_allocator;
+            using alloc_traits = std::allocator_traits<other_allocator>;
+            using unique_ptr = std::unique_ptr<counted_frame,
+                util::allocator_deleter<other_allocator>>;
+
+            // Construct the frame holding the arguments, it is the only
+            // allocation needed on this path
+            other_allocator frame_alloc(alloc);
+            unique_ptr p(alloc_traits::allocate(frame_alloc, 1),
+                util::allocator_deleter<other_allocator>{frame_alloc});
+            alloc_traits::construct(frame_alloc, p.get(), frame_alloc,
+                HPX_MOVE(data), futures_type(HPX_FORWARD(Ts, ts)...));
+
+            hpx::intrusive_ptr<counted_frame> frame(p.release(), false);
+            frame->start();
+
+            return future_access<typename Frame::type>::create(
+                HPX_MOVE(frame));
+        }
+        else
+        {
+            // Construct the dataflow_frame and traverse
+            // the arguments asynchronously
+            hpx::intrusive_ptr<Frame> p =
+                util::traverse_pack_async_allocator(alloc,
+                    util::async_traverse_in_place_tag<Frame>{}, HPX_MOVE(data),
+                    HPX_FORWARD(Ts, ts)...);
+
+            return future_access<typename Frame::type>::create(HPX_MOVE(p));
+        }
     }
 
     ///////////////////////////////////////////////////////////////////////////
@@ -19,12 +19,14 @@
 #include <hpx/execution/detail/post_policy_dispatch.hpp>
 #include <hpx/execution/executors/execution.hpp>
 #include <hpx/execution/executors/fused_bulk_execute.hpp>
+#include <hpx/functional/deferred_call.hpp>
 #include <hpx/functional/invoke.hpp>
 #include <hpx/futures/future.hpp>
 #include <hpx/futures/traits/future_traits.hpp>
 #include <hpx/iterator_support/range.hpp>
 #include <hpx/pack_traversal/unwrap.hpp>
 #include <hpx/synchronization/latch.hpp>
+#include <hpx/threading_base/register_thread.hpp>
 #include <hpx/threading_base/scheduler_base.hpp>
 #include <hpx/threading_base/thread_data.hpp>
 #include <hpx/threading_base/thread_helpers.hpp>
@@ -34,12 +36,118 @@
 #include <cstddef>
 #include <cstdint>
 #include <exception>
+#include <iterator>
 #include <type_traits>
 #include <utility>
 #include <vector>
 
 namespace hpx { namespace parallel { namespace execution { namespace detail {
 
+    ////////////////////////////////////////////////////////////////////////////
+    // Return the boundaries of the groups of consecutive worker threads out of
+    // [first_thread, first_thread + num_threads) which share a NUMA domain,
+    // relative to first_thread (the first element is zero and the last element
+    // is num_threads). The result is empty if all of the threads belong to
+    // the same NUMA domain.
+    HPX_CORE_EXPORT std::vector<std::size_t> get_numa_domain_boundaries(
+        threads::thread_pool_base* pool, std::size_t first_thread,
+        std::size_t num_threads);
+
+    // Invoke spawn(t_first, t_last) for all NUMA domains covering the worker
+    // threads [0, num_threads), relative to first_thread. The spawning for
+    // all but the last NUMA domain is done by a task that runs on the first
+    // worker thread of that domain, the last domain is handled by the calling
+    // thread.
+    template <typename Launch, typename Spawn>
+    void hierarchical_spawn_numa_domains(
+        hpx::util::thread_description const& desc,
+        threads::thread_pool_base* pool, std::size_t first_thread,
+        std::size_t num_threads, Launch const& post_policy,
+        Spawn const& spawn)
+    {
+        std::vector<std::size_t> const domains =
+            get_numa_domain_boundaries(pool, first_thread, num_threads);
+        if (domains.empty())
+        {
+            spawn(0, num_threads);
+            return;
+        }
+
+        std::size_t const num_domains = domains.size() - 1;
+        for (std::size_t d = 0; d != num_domains - 1; ++d)
+        {
+            std::size_t const t_first = domains[d];
+            std::size_t const t_last = domains[d + 1];
+
+            auto domain_post_policy =
+                hpx::execution::experimental::with_hint(post_policy,
+                    threads::thread_schedule_hint{
+                        static_cast<std::int16_t>(first_thread + t_first)});
+
+            hpx::detail::post_policy_dispatch<Launch>::call(domain_post_policy,
+                desc, pool,
+                [spawn, t_first, t_last]() { spawn(t_first, t_last); });
+        }
+
+        spawn(domains[num_domains - 1], num_threads);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Return whether posting work using the given policy creates a new thread
+    template <typename Launch>
+    constexpr bool posts_new_threads(Launch const& policy) noexcept
+    {
+        if constexpr (std::is_same_v<Launch, launch::async_policy>)
+        {
+            return true;
+        }
+        else if constexpr (std::is_same_v<Launch, launch::sync_policy> ||
+            std::is_same_v<Launch, launch::deferred_policy> ||
+            std::is_same_v<Launch, launch::fork_policy>)
+        {
+            return false;
+        }
+        else
+        {
+            return !(policy == launch::sync || policy == launch::deferred ||
+                policy == launch::fork);
+        }
+    }
+
+    // Post f(*it, ts...) for count consecutive elements starting at it and
+    // return the iterator to the element following the last posted one. If
+    // the policy creates new threads, all of them are handed to the thread
+    // pool at once.
+    template <typename Launch, typename F, typename Iter, typename... Ts>
+    Iter hierarchical_post_n(Launch const& policy,
+        hpx::util::thread_description const& desc,
+        threads::thread_pool_base* pool, F&& f, Iter it, std::size_t count,
+        Ts const&... ts)
+    {
+        if (!posts_new_threads(policy))
+        {
+            for (std::size_t i = 0; i != count; (void) ++it, ++i)
+            {
+                hpx::detail::post_policy_dispatch<Launch>::call(
+                    policy, desc, pool, f, *it, ts...);
+            }
+            return it;
+        }
+
+        std::vector<threads::thread_init_data> tasks;
+        tasks.reserve(count);
+        for (std::size_t i = 0; i != count; (void) ++it, ++i)
+        {
+            tasks.emplace_back(threads::make_thread_function_nullary(
+                                   hpx::util::deferred_call(f, *it, ts...)),
+                desc, policy.priority(), policy.hint(), policy.stacksize(),
+                threads::thread_schedule_state::pending);
+        }
+        threads::register_work_n(tasks.data(), tasks.size(), pool);
+
+        return it;
+    }
+
     ////////////////////////////////////////////////////////////////////////////
     template <typename Launch, typename F, typename S, typename... Ts>
     std::vector<hpx::future<detail::bulk_function_result_t<F, S, Ts...>>>
@@ -62,52 +170,79 @@ namespace hpx { namespace parallel { namespace execution { namespace detail {
             policy, threads::thread_stacksize::small_);
 
         hpx::latch l(size);
-        std::size_t part_begin = 0;
-        auto it = std::begin(shape);
-        for (std::size_t t = 0; t != num_threads; ++t)
-        {
-            std::size_t const part_end = ((t + 1) * size) / num_threads;
-            std::size_t const part_size = part_end - part_begin;
-
-            auto async_policy = hpx::execution::experimental::with_hint(policy,
-                threads::thread_schedule_hint{
-                    static_cast<std::int16_t>(first_thread + t)});
 
-            if (part_size > hierarchical_threshold)
+        // Spawn the tasks for the worker threads [t_first, t_last). Only
+        // values are accessed after the last count_down for the latch.
+        auto spawn = [&results, &l, &desc, &shape, &ts..., pool, first_thread,
+                         num_threads, hierarchical_threshold, size, policy,
+                         post_policy, f](std::size_t t_first,
+                         std::size_t t_last) {
+            // the function may not be invocable through a const reference,
+            // every spawning task refers to its own copy
+            std::decay_t<F> spawn_f = f;
+            for (std::size_t t = t_first; t != t_last; ++t)
             {
-                hpx::detail::post_policy_dispatch<Launch>::call(post_policy,
-                    desc, pool,
-                    [&, part_begin, part_end, part_size, f, it]() mutable {
-                        for (std::size_t part_i = part_begin;
-                             part_i != part_end; ++part_i)
-                        {
-                            results[part_i] =
-                                hpx::detail::async_launch_policy_dispatch<
-                                    Launch>::call(async_policy, desc, pool, f,
-                                    *it, ts...);
-                            ++it;
-                        }
-                        l.count_down(part_size);
-                    });
+                std::size_t const part_begin = (t * size) / num_threads;
+                std::size_t const part_end = ((t + 1) * size) / num_threads;
+                std::size_t const part_size = part_end - part_begin;
+                if (part_size == 0)
+                {
+                    continue;
+                }
 
-                std::advance(it, part_size);
-            }
-            else
-            {
-                for (std::size_t part_i = part_begin; part_i != part_end;
-                     ++part_i)
+                threads::thread_schedule_hint const hint(
+                    static_cast<std::int16_t>(first_thread + t));
+                auto async_policy =
+                    hpx::execution::experimental::with_hint(policy, hint);
+                auto it = std::next(hpx::util::begin(shape), part_begin);
+
+                if (part_size > hierarchical_threshold)
                 {
-                    results[part_i] =
-                        hpx::detail::async_launch_policy_dispatch<Launch>::call(
-                            async_policy, desc, pool, f, *it, ts...);
-                    ++it;
+                    // spawn the tasks from the targeted worker thread
+                    hpx::detail::post_policy_dispatch<Launch>::call(
+                        hpx::execution::experimental::with_hint(
+                            post_policy, hint),
+                        desc, pool,
+                        [&results, &l, &desc, &ts..., pool, async_policy,
+                            part_begin, part_end, part_size, f,
+                            it]() mutable {
+                            for (std::size_t part_i = part_begin;
+                                 part_i != part_end; ++part_i)
+                            {
+                                results[part_i] =
+                                    hpx::detail::async_launch_policy_dispatch<
+                                        Launch>::call(async_policy, desc, pool,
+                                        f, *it, ts...);
+                                ++it;
+                            }
+                            l.count_down(part_size);
+                        });
+                }
+                else
+                {
+                    for (std::size_t part_i = part_begin; part_i != part_end;
+                         ++part_i)
+                    {
+                        results[part_i] = hpx::detail::
+                            async_launch_policy_dispatch<Launch>::call(
+                                async_policy, desc, pool, spawn_f, *it, ts...);
+                        ++it;
+                    }
+                    l.count_down(part_size);
                 }
-                l.count_down(part_size);
             }
+        };
 
-            part_begin = part_end;
+        if (size > hierarchical_threshold)
+        {
+            // fan out one spawning task per NUMA domain first
+            hierarchical_spawn_numa_domains(
+                desc, pool, first_thread, num_threads, post_policy, spawn);
+        }
+        else
+        {
+            spawn(0, num_threads);
         }
-        HPX_ASSERT(it == hpx::util::end(shape));
 
         l.wait();
 
@@ -156,55 +291,75 @@ namespace hpx { namespace parallel { namespace execution { namespace detail {
                     l.count_down(1);
                 };
 
-                std::size_t begin = 0;
-                auto it = std::begin(shape);
-                for (std::size_t t = 0; t != num_threads; ++t)
-                {
-                    auto inner_post_policy =
-                        hpx::execution::experimental::with_hint(policy,
-                            threads::thread_schedule_hint{
-                                static_cast<std::int16_t>(first_thread + t)});
-
-                    std::size_t const end = ((t + 1) * size) / num_threads;
-                    std::size_t const part_size = end - begin;
-
-                    auto&& launcher = [&, wrapped, begin, end, it](
-                                          bool direct) mutable {
-                        // launch N-1 tasks
-                        auto iter = it;
-                        for (std::size_t i = begin + direct; i != end;
-                             (void) ++iter, ++i)
+                // Spawn the tasks for the worker threads [t_first, t_last),
+                // the calling thread executes the last task of the last
+                // worker thread directly. Only values are accessed after the
+                // last task was spawned.
+                auto spawn = [&desc, &shape, &ts..., pool, first_thread,
+                                 num_threads, hierarchical_threshold, size,
+                                 policy, post_policy,
+                                 wrapped](std::size_t t_first,
+                                 std::size_t t_last) {
+                    for (std::size_t t = t_first; t != t_last; ++t)
+                    {
+                        std::size_t const begin = (t * size) / num_threads;
+                        std::size_t const end = ((t + 1) * size) / num_threads;
+                        std::size_t const part_size = end - begin;
+                        if (part_size == 0)
                         {
-                            hpx::detail::post_policy_dispatch<Launch>::call(
-                                inner_post_policy, desc, pool, wrapped, *iter,
-                                ts...);
+                            continue;
                         }
 
-                        // execute last task directly, if needed
-                        if (direct)
+                        threads::thread_schedule_hint const hint(
+                            static_cast<std::int16_t>(first_thread + t));
+                        auto inner_post_policy =
+                            hpx::execution::experimental::with_hint(
+                                policy, hint);
+                        auto it = std::next(hpx::util::begin(shape), begin);
+
+                        auto launcher = [&desc, &ts..., pool, inner_post_policy,
+                                            wrapped, begin, end,
+                                            it](bool direct) mutable {
+                            // launch N-1 tasks
+                            auto iter = hierarchical_post_n(inner_post_policy,
+                                desc, pool, wrapped, it, end - begin - direct,
+                                ts...);
+
+                            // execute last task directly, if needed
+                            if (direct)
+                            {
+                                HPX_INVOKE(wrapped, *iter, ts...);
+                            }
+                        };
+
+                        // launch a special thread on the targeted worker
+                        // thread to schedule its work, except for the last
+                        // one
+                        bool const last = t == num_threads - 1;
+                        if (!last && part_size > hierarchical_threshold)
                         {
-                            HPX_INVOKE(wrapped, *iter, ts...);
+                            hpx::detail::post_policy_dispatch<Launch>::call(
+                                hpx::execution::experimental::with_hint(
+                                    post_policy, hint),
+                                desc, pool, HPX_MOVE(launcher), true);
+                        }
+                        else
+                        {
+                            launcher(last);
                         }
-                    };
-
-                    // launch a special thread to schedule work for each core,
-                    // except the last one
-                    if (t != num_threads - 1 &&
-                        part_size > hierarchical_threshold)
-                    {
-                        hpx::detail::post_policy_dispatch<Launch>::call(
-                            post_policy, desc, pool, HPX_MOVE(launcher), true);
-                        std::advance(it, part_size);
-                    }
-                    else if (part_size != 0)
-                    {
-                        launcher(t == num_threads - 1);
-                        std::advance(it, part_size);
                     }
+                };
 
-                    begin = end;
+                if (size > hierarchical_threshold)
+                {
+                    // fan out one spawning task per NUMA domain first
+                    hierarchical_spawn_numa_domains(desc, pool, first_thread,
+                        num_threads, post_policy, spawn);
+                }
+                else
+                {
+                    spawn(0, num_threads);
                 }
-                HPX_ASSERT(it == hpx::util::end(shape));
 
                 l.wait();
 
@@ -0,0 +1,377 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/async_base/scheduling_properties.hpp>
+#include <hpx/coroutines/thread_enums.hpp>
+#include <hpx/errors/try_catch_exception_ptr.hpp>
+#include <hpx/execution_base/completion_scheduler.hpp>
+#include <hpx/execution_base/completion_signatures.hpp>
+#include <hpx/execution_base/receiver.hpp>
+#include <hpx/execution_base/sender.hpp>
+#include <hpx/executors/thread_pool_scheduler.hpp>
+#include <hpx/synchronization/spinlock.hpp>
+#include <hpx/timing/steady_clock.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <exception>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx::execution::experimental {
+
+    inline constexpr struct with_deadline_t final
+      : detail::property_base<with_deadline_t>
+    {
+    } with_deadline{};
+
+    inline constexpr struct get_deadline_t final
+      : detail::property_base<get_deadline_t>
+    {
+    } get_deadline{};
+
+    /// \cond NOINTERNAL
+    namespace detail {
+
+        // Work scheduled on an edf_scheduler. The work items are owned by the
+        // operation states of the senders, the queue holds pointers only.
+        struct edf_work_item
+        {
+            using execute_function_type = void (*)(edf_work_item*) noexcept;
+
+            hpx::chrono::steady_clock::time_point deadline;
+            execute_function_type execute = nullptr;
+        };
+
+        // The queue shared by all copies of an edf_scheduler. Work items are
+        // executed in the order of their deadlines, work items with the same
+        // deadline are executed in the order they were added.
+        class HPX_CORE_EXPORT edf_queue
+        {
+        public:
+            edf_queue() = default;
+
+            edf_queue(edf_queue const&) = delete;
+            edf_queue(edf_queue&&) = delete;
+            edf_queue& operator=(edf_queue const&) = delete;
+            edf_queue& operator=(edf_queue&&) = delete;
+
+            void push(edf_work_item* item);
+
+            // Remove the given item, returns false if it is not in the queue
+            // (anymore).
+            bool erase(edf_work_item* item) noexcept;
+
+            // Execute the work item with the earliest deadline, if any.
+            void execute_one() noexcept;
+
+            std::int64_t get_deadline_misses(bool reset) noexcept;
+            std::int64_t get_num_executed(bool reset) noexcept;
+
+        private:
+            struct entry
+            {
+                hpx::chrono::steady_clock::time_point deadline;
+                std::uint64_t sequence;
+                edf_work_item* item;
+
+                // std::push_heap creates a max heap
+                friend bool operator<(entry const& lhs, entry const& rhs)
+                {
+                    return lhs.deadline > rhs.deadline ||
+                        (lhs.deadline == rhs.deadline &&
+                            lhs.sequence > rhs.sequence);
+                }
+            };
+
+            hpx::spinlock mtx_;
+            std::vector<entry> heap_;
+            std::uint64_t sequence_ = 0;
+
+            // the number of work items (with a deadline) started after their
+            // deadline and the overall number of work items with a deadline
+            std::atomic<std::int64_t> deadline_misses_{0};
+            std::atomic<std::int64_t> num_executed_{0};
+        };
+
+        // The number of deadline misses and executed work items with a
+        // deadline accumulated over all edf_schedulers.
+        HPX_CORE_EXPORT std::int64_t get_edf_deadline_misses(bool reset);
+        HPX_CORE_EXPORT std::int64_t get_edf_num_executed(bool reset);
+    }    // namespace detail
+    /// \endcond
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// A scheduler which runs work on a thread pool in the order of the
+    /// deadlines (earliest deadline first) of the senders created by it.
+    ///
+    /// The deadline of the senders returned by schedule is set using the
+    /// with_deadline property (an absolute point in time or a duration
+    /// relative to the call of with_deadline). Work without a deadline is
+    /// executed after all work with a deadline. All copies of a scheduler
+    /// share the same queue. For each work item that is started after its
+    /// deadline a deadline miss is counted, the counts are available from
+    /// the scheduler and (accumulated over all schedulers) from the
+    /// performance counter /scheduler/count/deadline-misses.
+    struct edf_scheduler
+    {
+        edf_scheduler()
+          : queue_(std::make_shared<detail::edf_queue>())
+        {
+        }
+
+        explicit edf_scheduler(hpx::threads::thread_pool_base* pool)
+          : scheduler_(pool)
+          , queue_(std::make_shared<detail::edf_queue>())
+        {
+        }
+
+        explicit edf_scheduler(thread_pool_scheduler scheduler)
+          : scheduler_(HPX_MOVE(scheduler))
+          , queue_(std::make_shared<detail::edf_queue>())
+        {
+        }
+
+        /// \cond NOINTERNAL
+        bool operator==(edf_scheduler const& rhs) const noexcept
+        {
+            return queue_ == rhs.queue_ && scheduler_ == rhs.scheduler_ &&
+                deadline_ == rhs.deadline_;
+        }
+
+        bool operator!=(edf_scheduler const& rhs) const noexcept
+        {
+            return !(*this == rhs);
+        }
+
+        hpx::threads::thread_pool_base* get_thread_pool()
+        {
+            return scheduler_.get_thread_pool();
+        }
+        /// \endcond
+
+        /// Return the number of work items of this scheduler (and its copies)
+        /// that were started after their deadline.
+        std::int64_t get_deadline_misses(bool reset = false) const noexcept
+        {
+            return queue_->get_deadline_misses(reset);
+        }
+
+        /// Return the number of work items with a deadline of this scheduler
+        /// (and its copies) that were executed.
+        std::int64_t get_num_executed(bool reset = false) const noexcept
+        {
+            return queue_->get_num_executed(reset);
+        }
+
+        /// \cond NOINTERNAL
+        // support with_deadline property
+        friend edf_scheduler tag_invoke(
+            hpx::execution::experimental::with_deadline_t,
+            edf_scheduler const& scheduler,
+            hpx::chrono::steady_time_point const& deadline)
+        {
+            auto sched_with_deadline = scheduler;
+            sched_with_deadline.deadline_ = deadline.value();
+            return sched_with_deadline;
+        }
+
+        friend edf_scheduler tag_invoke(
+            hpx::execution::experimental::with_deadline_t,
+            edf_scheduler const& scheduler,
+            hpx::chrono::steady_duration const& rel_deadline)
+        {
+            auto sched_with_deadline = scheduler;
+            sched_with_deadline.deadline_ = rel_deadline.from_now();
+            return sched_with_deadline;
+        }
+
+        friend hpx::chrono::steady_clock::time_point tag_invoke(
+            hpx::execution::experimental::get_deadline_t,
+            edf_scheduler const& scheduler)
+        {
+            return scheduler.deadline_;
+        }
+
+        // all other properties are forwarded to the underlying scheduler
+        template <typename Tag, typename Property,
+            HPX_CONCEPT_REQUIRES_(
+                std::is_same_v<Tag, with_priority_t> ||
+                std::is_same_v<Tag, with_stacksize_t> ||
+                std::is_same_v<Tag, with_hint_t> ||
+                std::is_same_v<Tag, with_annotation_t>)>
+        friend edf_scheduler tag_invoke(
+            Tag tag, edf_scheduler const& scheduler, Property&& property)
+        {
+            auto sched_with_property = scheduler;
+            sched_with_property.scheduler_ = hpx::functional::tag_invoke(
+                tag, scheduler.scheduler_, HPX_FORWARD(Property, property));
+            return sched_with_property;
+        }
+
+        template <typename Tag,
+            HPX_CONCEPT_REQUIRES_(
+                std::is_same_v<Tag, get_priority_t> ||
+                std::is_same_v<Tag, get_stacksize_t> ||
+                std::is_same_v<Tag, get_hint_t> ||
+                std::is_same_v<Tag, get_annotation_t>)>
+        friend decltype(auto) tag_invoke(
+            Tag tag, edf_scheduler const& scheduler)
+        {
+            return hpx::functional::tag_invoke(tag, scheduler.scheduler_);
+        }
+
+        template <typename Receiver>
+        struct operation_state;
+
+        struct sender;
+
+        friend sender tag_invoke(schedule_t, edf_scheduler const& sched);
+        /// \endcond
+
+    private:
+        /// \cond NOINTERNAL
+        thread_pool_scheduler scheduler_;
+        std::shared_ptr<detail::edf_queue> queue_;
+        hpx::chrono::steady_clock::time_point deadline_ =
+            (hpx::chrono::steady_clock::time_point::max)();
+        /// \endcond
+    };
+
+    /// \cond NOINTERNAL
+    template <typename Receiver>
+    struct edf_scheduler::operation_state : detail::edf_work_item
+    {
+        std::shared_ptr<detail::edf_queue> queue;
+        thread_pool_scheduler scheduler;
+        HPX_NO_UNIQUE_ADDRESS std::decay_t<Receiver> receiver;
+
+        template <typename Receiver_>
+        operation_state(edf_scheduler const& scheduler, Receiver_&& receiver)
+          : queue(scheduler.queue_)
+          , scheduler(scheduler.scheduler_)
+          , receiver(HPX_FORWARD(Receiver_, receiver))
+        {
+            this->deadline = scheduler.deadline_;
+            this->execute = &execute_item;
+        }
+
+        operation_state(operation_state&&) = delete;
+        operation_state(operation_state const&) = delete;
+        operation_state& operator=(operation_state&&) = delete;
+        operation_state& operator=(operation_state const&) = delete;
+
+        static void execute_item(detail::edf_work_item* item) noexcept
+        {
+            auto& os = *static_cast<operation_state*>(item);
+            hpx::detail::try_catch_exception_ptr(
+                [&]() {
+                    hpx::execution::experimental::set_value(
+                        HPX_MOVE(os.receiver));
+                },
+                [&](std::exception_ptr ep) {
+                    hpx::execution::experimental::set_error(
+                        HPX_MOVE(os.receiver), HPX_MOVE(ep));
+                });
+        }
+
+        friend void tag_invoke(start_t, operation_state& os) noexcept
+        {
+            // The operation state may be destroyed as soon as it was
+            // added to the queue.
+            auto queue = os.queue;
+            auto scheduler = os.scheduler;
+
+            bool pushed = false;
+            hpx::detail::try_catch_exception_ptr(
+                [&]() {
+                    queue->push(&os);
+                    pushed = true;
+                },
+                [&](std::exception_ptr ep) {
+                    hpx::execution::experimental::set_error(
+                        HPX_MOVE(os.receiver), HPX_MOVE(ep));
+                });
+            if (!pushed)
+            {
+                return;
+            }
+
+            // Every work item is accompanied by a task which executes
+            // the work item with the earliest deadline at the time the
+            // task runs.
+            hpx::detail::try_catch_exception_ptr(
+                [&]() {
+                    scheduler.execute([queue]() { queue->execute_one(); });
+                },
+                [&](std::exception_ptr ep) {
+                    if (queue->erase(&os))
+                    {
+                        hpx::execution::experimental::set_error(
+                            HPX_MOVE(os.receiver), HPX_MOVE(ep));
+                    }
+                    else
+                    {
+                        // the item was executed by the task of another
+                        // item, execute the remaining one instead
+                        queue->execute_one();
+                    }
+                });
+        }
+    };
+
+    struct edf_scheduler::sender
+    {
+        edf_scheduler scheduler;
+
+        template <typename Env>
+        struct generate_completion_signatures
+        {
+            template <template <typename...> typename Tuple,
+                template <typename...> typename Variant>
+            using value_types = Variant<Tuple<>>;
+
+            template <template <typename...> typename Variant>
+            using error_types = Variant<std::exception_ptr>;
+
+            static constexpr bool sends_stopped = false;
+        };
+
+        template <typename Env>
+        friend auto tag_invoke(get_completion_signatures_t, sender const&,
+            Env) noexcept -> generate_completion_signatures<Env>;
+
+        template <typename Receiver>
+        friend operation_state<Receiver> tag_invoke(
+            connect_t, sender const& s, Receiver&& receiver)
+        {
+            return {s.scheduler, HPX_FORWARD(Receiver, receiver)};
+        }
+
+        template <typename CPO,
+            HPX_CONCEPT_REQUIRES_(std::is_same_v<CPO,
+                hpx::execution::experimental::set_value_t>)>
+        friend edf_scheduler tag_invoke(
+            hpx::execution::experimental::get_completion_scheduler_t<CPO>,
+            sender const& s)
+        {
+            return s.scheduler;
+        }
+    };
+
+    inline edf_scheduler::sender tag_invoke(
+        schedule_t, edf_scheduler const& sched)
+    {
+        return {sched};
+    }
+    /// \endcond
+}    // namespace hpx::execution::experimental
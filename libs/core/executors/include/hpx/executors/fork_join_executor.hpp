@@ -30,6 +30,7 @@
 #include <cstdint>
 #include <exception>
 #include <iosfwd>
+#include <iterator>
 #include <memory>
 #include <type_traits>
 #include <utility>
@@ -51,18 +52,125 @@ namespace hpx { namespace execution { namespace experimental {
     /// which it will yield to other work.  Since starting and resuming the
     /// worker threads is a slow operation the executor should be reused
     /// whenever possible for multiple adjacent parallel algorithms or
-    /// invocations of bulk_(a)sync_execute.
+    /// invocations of bulk_(a)sync_execute. Alternatively, execute_region can
+    /// be used to run a sequence of loops during a single activation of the
+    /// worker threads.
+    ///
+    /// Parallel algorithms and invocations of bulk_(a)sync_execute or
+    /// execute_region issued from inside a parallel region of the same
+    /// executor are executed on the calling thread only (the other worker
+    /// threads are busy with the enclosing region). Use team::split to divide
+    /// the work of nested loops between the worker threads instead.
     class fork_join_executor
     {
     public:
         /// Type of loop schedule for use with the fork_join_executor.
         /// loop_schedule::static_ implies no work-stealing;
         /// loop_schedule::dynamic allows stealing when a worker has finished
-        /// its local work.
+        /// its local work; loop_schedule::stealing is like
+        /// loop_schedule::dynamic, except that a worker which has finished
+        /// its local work steals the back half of the remaining work of a
+        /// neighbor at once (and makes it available for stealing by others).
         enum class loop_schedule
         {
             static_,
             dynamic,
+            stealing,
+        };
+
+    private:
+        class shared_data;
+
+    public:
+        /// A team of worker threads executing a parallel region started by
+        /// execute_region. Each worker thread of the region is given its own
+        /// team object which identifies the thread in the team.
+        class team
+        {
+        public:
+            /// Return the index of the calling worker thread in the team.
+            std::size_t thread_index() const noexcept
+            {
+                return rank_;
+            }
+
+            /// Return the number of worker threads in the team.
+            std::size_t num_threads() const noexcept
+            {
+                return size_;
+            }
+
+            /// Wait for all worker threads of the team to reach the barrier.
+            /// All worker threads of a team have to call barrier the same
+            /// number of times.
+            void barrier() const
+            {
+                data_->team_barrier(level_, first_, size_);
+            }
+
+            /// Divide the team into (at most) \a num_groups sub-teams of
+            /// contiguous worker threads and return the sub-team of the
+            /// calling worker thread. All worker threads of the team have to
+            /// call split with the same \a num_groups.
+            team split(std::size_t num_groups) const noexcept
+            {
+                if (num_groups > size_)
+                {
+                    num_groups = size_;
+                }
+                if (num_groups <= 1)
+                {
+                    return *this;
+                }
+
+                std::size_t const group = (rank_ * num_groups) / size_;
+                std::size_t const group_begin =
+                    (group * size_ + num_groups - 1) / num_groups;
+                std::size_t const group_end =
+                    ((group + 1) * size_ + num_groups - 1) / num_groups;
+
+                return team(data_, level_ + 1, first_ + group_begin,
+                    group_end - group_begin, rank_ - group_begin);
+            }
+
+            /// Invoke \a f for each element of \a shape, where the elements
+            /// are statically divided between the worker threads of the team.
+            /// Waits for all worker threads of the team to finish their part
+            /// before returning.
+            template <typename F, typename S, typename... Ts>
+            void for_each(F&& f, S const& shape, Ts&&... ts) const
+            {
+                std::size_t const size = hpx::util::size(shape);
+                std::size_t const part_begin = (rank_ * size) / size_;
+                std::size_t const part_end = ((rank_ + 1) * size) / size_;
+
+                auto it = std::next(hpx::util::begin(shape), part_begin);
+                for (std::size_t i = part_begin; i != part_end; ++i, ++it)
+                {
+                    HPX_INVOKE(f, *it, ts...);
+                }
+
+                barrier();
+            }
+
+        private:
+            friend class shared_data;
+
+            team(shared_data* data, std::size_t level, std::size_t first,
+                std::size_t size, std::size_t rank) noexcept
+              : data_(data)
+              , level_(level)
+              , first_(first)
+              , size_(size)
+              , rank_(rank)
+            {
+            }
+
+            shared_data* data_;
+            std::size_t level_;
+            std::size_t first_;
+            std::size_t size_;
+            std::size_t rank_;
         };
 
         /// \cond nointernal
@@ -109,6 +217,9 @@ namespace hpx { namespace execution { namespace experimental {
                 void* element_function_;
                 void const* shape_;
                 void* argument_pack_;
+
+                // The executor data, used by parallel regions.
+                shared_data* shared_data_;
             };
 
             // Can't apply 'using' here as the type needs to be forward
@@ -142,6 +253,43 @@ namespace hpx { namespace execution { namespace experimental {
             // The current queues for each worker HPX thread.
             queues_type queues_;
 
+            // Data of a barrier used by a team of a parallel region.
+            struct barrier_data
+            {
+                std::atomic<std::size_t> arrived_{0};
+                std::atomic<std::size_t> generation_{0};
+            };
+
+            // Thrown by team barriers if a worker thread of the parallel
+            // region has exited with an exception.
+            struct region_aborted
+            {
+            };
+
+            // The barriers for all (nested) teams, there is one barrier for
+            // each nesting level and each worker thread (the first worker
+            // thread of a team identifies it on a given level).
+            std::vector<hpx::util::cache_aligned_data<barrier_data>> barriers_;
+
+            // Whether a parallel region is being executed. Nested loops are
+            // executed on the calling thread.
+            bool in_region_ = false;
+            std::atomic<bool> region_aborted_{false};
+
+            static constexpr std::size_t num_team_levels(
+                std::size_t num_threads) noexcept
+            {
+                // Each split of a team results in sub-teams of at most half
+                // the size (rounded up).
+                std::size_t levels = 1;
+                for (std::size_t size = num_threads; size > 1;
+                     size = (size + 1) / 2)
+                {
+                    ++levels;
+                }
+                return levels;
+            }
+
             template <typename Op>
             static thread_state wait_state_this_thread_while(
                 std::atomic<thread_state> const& tstate, thread_state state,
@@ -322,6 +470,7 @@ namespace hpx { namespace execution { namespace experimental {
               , exception_mutex_()
               , exception_()
               , region_data_(num_threads_)
+              , barriers_(num_threads_ * num_team_levels(num_threads_))
             {
                 HPX_ASSERT(pool_);
                 init_threads();
@@ -348,6 +497,57 @@ namespace hpx { namespace execution { namespace experimental {
                 return !(*this == rhs);
             }
 
+            void team_barrier(
+                std::size_t level, std::size_t first, std::size_t size)
+            {
+                if (size <= 1)
+                {
+                    return;
+                }
+
+                HPX_ASSERT(level < num_team_levels(num_threads_));
+                barrier_data& b = barriers_[level * num_threads_ + first].data_;
+
+                std::size_t const generation =
+                    b.generation_.load(std::memory_order_acquire);
+                if (b.arrived_.fetch_add(1, std::memory_order_acq_rel) + 1 ==
+                    size)
+                {
+                    // the last thread to arrive releases the others
+                    b.arrived_.store(0, std::memory_order_relaxed);
+                    b.generation_.store(
+                        generation + 1, std::memory_order_release);
+                    return;
+                }
+
+                std::uint64_t base_time = util::hardware::timestamp();
+                while (b.generation_.load(std::memory_order_acquire) ==
+                    generation)
+                {
+                    for (int i = 0; i < 128; ++i)
+                    {
+                        HPX_SMT_PAUSE;
+
+                        if (b.generation_.load(std::memory_order_acquire) !=
+                            generation)
+                        {
+                            return;
+                        }
+                    }
+
+                    if (region_aborted_.load(std::memory_order_acquire))
+                    {
+                        throw region_aborted{};
+                    }
+
+                    if ((util::hardware::timestamp() - base_time) >
+                        yield_delay_)
+                    {
+                        hpx::this_thread::yield();
+                    }
+                }
+            }
+
         private:
             /// This struct implements the main work loop for a single parallel
             /// for loop. The indirection through this struct is done to allow
@@ -500,8 +700,172 @@ namespace hpx { namespace execution { namespace experimental {
 
                     set_state(data.state_, thread_state::idle);
                 }
+
+                /// Main entry point for a single parallel region (stealing
+                /// scheduling).
+                static void call_stealing(region_data_type& rdata,
+                    std::size_t thread_index, std::size_t num_threads,
+                    queues_type& queues, hpx::spinlock& exception_mutex,
+                    std::exception_ptr& exception) noexcept
+                {
+                    region_data& data = rdata[thread_index].data_;
+                    try
+                    {
+                        // Cast void pointers back to the actual types given to
+                        // bulk_sync_execute.
+                        auto& element_function =
+                            *static_cast<F*>(data.element_function_);
+                        auto& shape = *static_cast<S const*>(data.shape_);
+                        auto& argument_pack =
+                            *static_cast<Tuple*>(data.argument_pack_);
+
+                        // Set up the local queues and state.
+                        queue_type& local_queue = queues[thread_index].data_;
+                        std::size_t size = hpx::util::size(shape);
+                        init_local_work_queue(
+                            local_queue, thread_index, num_threads, size);
+
+                        set_state(data.state_, thread_state::active);
+
+                        bool stolen = true;
+                        while (stolen)
+                        {
+                            // Process local items first.
+                            hpx::optional<std::uint32_t> index;
+                            while ((index = local_queue.pop_left()))
+                            {
+                                auto it = std::next(
+                                    hpx::util::begin(shape), index.value());
+                                invoke_helper(index_pack_type{},
+                                    element_function, *it, argument_pack);
+                            }
+
+                            // Steal the back half of the remaining items of
+                            // the first neighboring thread that has items
+                            // left. The stolen items are moved to the local
+                            // queue, where they can be stolen by others.
+                            stolen = false;
+                            for (std::size_t offset = 1; offset < num_threads;
+                                 ++offset)
+                            {
+                                std::size_t neighbor_index =
+                                    (thread_index + offset) % num_threads;
+
+                                if (rdata[neighbor_index].data_.state_.load(
+                                        std::memory_order_acquire) !=
+                                    thread_state::active)
+                                {
+                                    continue;
+                                }
+
+                                queue_type& neighbor_queue =
+                                    queues[neighbor_index].data_;
+
+                                if (auto range =
+                                        neighbor_queue.pop_right_half())
+                                {
+                                    local_queue.refill(
+                                        range->first, range->second);
+                                    stolen = true;
+                                    break;
+                                }
+                            }
+                        }
+                    }
+                    catch (...)
+                    {
+                        std::lock_guard l(exception_mutex);
+                        if (!exception)
+                        {
+                            exception = std::current_exception();
+                        }
+                    }
+
+                    set_state(data.state_, thread_state::idle);
+                }
+            };
+
+            /// This struct implements the entry point of the worker threads
+            /// for a parallel region.
+            template <typename F, typename Tuple>
+            struct region_function_helper
+            {
+                using index_pack_type =
+                    typename hpx::util::detail::fused_index_pack<Tuple>::type;
+
+                template <std::size_t... Is_, typename Tuple_>
+                static constexpr void invoke_helper(
+                    hpx::util::index_pack<Is_...>, F& f, team& t, Tuple_&& tup)
+                {
+                    HPX_INVOKE(
+                        f, t, hpx::get<Is_>(HPX_FORWARD(Tuple_, tup))...);
+                }
+
+                static void call(region_data_type& rdata,
+                    std::size_t thread_index, std::size_t num_threads,
+                    queues_type&, hpx::spinlock& exception_mutex,
+                    std::exception_ptr& exception) noexcept
+                {
+                    region_data& data = rdata[thread_index].data_;
+                    data.state_.store(
+                        thread_state::active, std::memory_order_release);
+
+                    try
+                    {
+                        auto& f = *static_cast<F*>(data.element_function_);
+                        auto& argument_pack =
+                            *static_cast<Tuple*>(data.argument_pack_);
+
+                        team t(data.shared_data_, 0, 0, num_threads,
+                            thread_index);
+                        invoke_helper(index_pack_type{}, f, t, argument_pack);
+                    }
+                    catch (region_aborted const&)
+                    {
+                        // another worker thread has exited with an exception
+                    }
+                    catch (...)
+                    {
+                        {
+                            std::lock_guard l(exception_mutex);
+                            if (!exception)
+                            {
+                                exception = std::current_exception();
+                            }
+                        }
+
+                        // release the threads waiting in team barriers
+                        data.shared_data_->region_aborted_.store(
+                            true, std::memory_order_release);
+                    }
+
+                    data.state_.store(
+                        thread_state::idle, std::memory_order_release);
+                }
             };
 
+            template <typename F, typename Args>
+            thread_function_helper_type* set_all_states_and_region_function(
+                thread_state state, F& f, Args& argument_pack) noexcept
+            {
+                thread_function_helper_type* func =
+                    &region_function_helper<F, Args>::call;
+
+                for (std::size_t t = 0; t < num_threads_; ++t)
+                {
+                    region_data& data = region_data_[t].data_;
+
+                    data.element_function_ = &f;
+                    data.shape_ = nullptr;
+                    data.argument_pack_ = &argument_pack;
+                    data.shared_data_ = this;
+                    data.thread_function_helper_ = func;
+
+                    data.state_.store(state, std::memory_order_release);
+                }
+                return func;
+            }
+
             template <typename F, typename S, typename Args>
             thread_function_helper_type* set_all_states_and_region_data(
                 thread_state state, F& f, S const& shape,
@@ -512,10 +876,14 @@ namespace hpx { namespace execution { namespace experimental {
                 {
                     func = &thread_function_helper<F, S, Args>::call_static;
                 }
-                else
+                else if (schedule_ == loop_schedule::dynamic)
                 {
                     func = &thread_function_helper<F, S, Args>::call_dynamic;
                 }
+                else
+                {
+                    func = &thread_function_helper<F, S, Args>::call_stealing;
+                }
 
                 for (std::size_t t = 0; t < num_threads_; ++t)
                 {
@@ -524,6 +892,7 @@ namespace hpx { namespace execution { namespace experimental {
                     data.element_function_ = &f;
                     data.shape_ = &shape;
                     data.argument_pack_ = &argument_pack;
+                    data.shared_data_ = this;
                     data.thread_function_helper_ = func;
 
                     data.state_.store(state, std::memory_order_release);
@@ -542,10 +911,25 @@ namespace hpx { namespace execution { namespace experimental {
                 hpx::util::itt::mark_event e(notify_event);
 #endif
 
+                if (in_region_)
+                {
+                    // All worker threads are busy with the enclosing parallel
+                    // region, run the nested loop on the calling thread.
+                    std::size_t const size = hpx::util::size(shape);
+                    auto it = hpx::util::begin(shape);
+                    for (std::size_t i = 0; i != size; ++i, ++it)
+                    {
+                        HPX_INVOKE(f, *it, ts...);
+                    }
+                    return;
+                }
+
                 // Set the data for this parallel region
                 auto argument_pack =
                     hpx::forward_as_tuple(HPX_FORWARD(Ts, ts)...);
 
+                in_region_ = true;
+
                 // Signal all worker threads to start partitioning work for
                 // themselves, and then starting the actual work.
                 thread_function_helper_type* func =
@@ -561,6 +945,8 @@ namespace hpx { namespace execution { namespace experimental {
                 // them in this parallel region.
                 wait_state_all(thread_state::idle);
 
+                in_region_ = false;
+
                 std::lock_guard l(exception_mutex_);
                 if (exception_)
                 {
@@ -589,6 +975,62 @@ namespace hpx { namespace execution { namespace experimental {
                 }
                 return hpx::make_ready_future();
             }
+
+            template <typename F, typename... Ts>
+            void execute_region(F&& f, Ts&&... ts)
+            {
+#if HPX_HAVE_ITTNOTIFY != 0 && !defined(HPX_HAVE_APEX)
+                static hpx::util::itt::event notify_event(
+                    "fork_join_executor::execute_region");
+
+                hpx::util::itt::mark_event e(notify_event);
+#endif
+
+                if (in_region_)
+                {
+                    // All worker threads are busy with the enclosing parallel
+                    // region, run the nested region on the calling thread.
+                    team t(this, 0, 0, 1, 0);
+                    HPX_INVOKE(f, t, ts...);
+                    return;
+                }
+
+                // Set the data for this parallel region
+                auto argument_pack =
+                    hpx::forward_as_tuple(HPX_FORWARD(Ts, ts)...);
+
+                in_region_ = true;
+                region_aborted_.store(false, std::memory_order_relaxed);
+
+                // Signal all worker threads to start the region.
+                thread_function_helper_type* func =
+                    set_all_states_and_region_function(
+                        thread_state::partitioning_work, f, argument_pack);
+
+                // Start the region on the main thread.
+                func(region_data_, main_thread_, num_threads_, queues_,
+                    exception_mutex_, exception_);
+
+                // Wait for all threads to leave the region.
+                wait_state_all(thread_state::idle);
+
+                in_region_ = false;
+
+                if (region_aborted_.load(std::memory_order_relaxed))
+                {
+                    // the barriers may have been left in an arbitrary state
+                    for (auto& b : barriers_)
+                    {
+                        b.data_.arrived_.store(0, std::memory_order_relaxed);
+                    }
+                }
+
+                std::lock_guard l(exception_mutex_);
+                if (exception_)
+                {
+                    std::rethrow_exception(HPX_MOVE(exception_));
+                }
+            }
         };
 
     private:
@@ -640,6 +1082,27 @@ namespace hpx { namespace execution { namespace experimental {
         }
         /// \endcond
 
+        /// \brief Execute a parallel region.
+        ///
+        /// Invokes \a f with a \a team object and the given arguments on
+        /// each of the worker threads of the executor and waits for all
+        /// invocations to return. Contrary to invoking bulk_sync_execute
+        /// repeatedly, the worker threads stay in the region for the duration
+        /// of \a f, which allows to run several loops (see team::for_each)
+        /// separated only by lightweight team barriers. The first exception
+        /// thrown by any invocation of \a f is rethrown once all worker
+        /// threads have left the region.
+        ///
+        /// \param f The function to invoke on each worker thread. It is
+        ///           called as f(team&, ts...).
+        /// \param ts Additional arguments passed to \a f.
+        template <typename F, typename... Ts>
+        void execute_region(F&& f, Ts&&... ts) const
+        {
+            shared_data_->execute_region(
+                HPX_FORWARD(F, f), HPX_FORWARD(Ts, ts)...);
+        }
+
         /// \brief Construct a fork_join_executor.
         ///
         /// \param priority The priority of the worker threads.
@@ -237,7 +237,10 @@ namespace hpx { namespace parallel { namespace execution {
     }    // namespace detail
 
     // --------------------------------------------------------------------
-    // Template type for a numa domain scheduling hint
+    // Template type for a numa domain scheduling hint. Tasks keep their
+    // affinity to the domain returned by the hint: the shared-priority
+    // scheduler lets workers of other domains steal them only when starving
+    // (see hpx.thread_queue.steal_numa_affinity_starvation)
     template <typename... Args>
     struct pool_numa_hint
     {
@@ -20,15 +20,18 @@
 #include <hpx/execution_base/completion_signatures.hpp>
 #include <hpx/execution_base/receiver.hpp>
 #include <hpx/execution_base/sender.hpp>
+#include <hpx/execution_base/this_thread.hpp>
 #include <hpx/executors/thread_pool_scheduler.hpp>
 #include <hpx/functional/bind_front.hpp>
 #include <hpx/functional/tag_invoke.hpp>
 #include <hpx/iterator_support/counting_iterator.hpp>
+#include <hpx/iterator_support/counting_shape.hpp>
 #include <hpx/iterator_support/traits/is_iterator.hpp>
 #include <hpx/iterator_support/traits/is_range.hpp>
 #include <hpx/threading_base/annotated_function.hpp>
 #include <hpx/threading_base/register_thread.hpp>
 
+#include <array>
 #include <atomic>
 #include <cstddef>
 #include <cstdint>
@@ -56,25 +59,39 @@ namespace hpx::execution::experimental {
         /// thread (the completion scheduler is a thread_pool_scheduler;
         /// otherwise the customization defined in this file is not chosen) it
         /// will be reused as one of the worker threads.
-        template <typename Sender, typename Shape, typename F>
+        ///
+        /// Consecutive bulk operations on the same scheduler and with the
+        /// same shape type are fused into one sender (one phase for each of
+        /// the functions F, Fs...). All phases are executed by the same HPX
+        /// threads, a phase is started only after all threads have finished
+        /// the previous one. This avoids having to join the HPX threads and
+        /// to spawn new ones between the phases.
+        template <typename Sender, typename Shape, typename F, typename... Fs>
         class thread_pool_bulk_sender
         {
+        public:
+            static constexpr std::size_t num_phases = sizeof...(Fs) + 1;
+
+            using shapes_type = std::array<std::decay_t<Shape>, num_phases>;
+            using functions_type =
+                hpx::tuple<std::decay_t<F>, std::decay_t<Fs>...>;
+
         private:
             thread_pool_scheduler scheduler;
             HPX_NO_UNIQUE_ADDRESS std::decay_t<Sender> sender;
-            HPX_NO_UNIQUE_ADDRESS std::decay_t<Shape> shape;
-            HPX_NO_UNIQUE_ADDRESS std::decay_t<F> f;
+            shapes_type shapes;
+            HPX_NO_UNIQUE_ADDRESS functions_type fs;
 
-            using size_type = decltype(hpx::util::size(shape));
+            using size_type = decltype(hpx::util::size(shapes[0]));
 
         public:
-            template <typename Sender_, typename Shape_, typename F_>
+            template <typename Sender_>
             thread_pool_bulk_sender(thread_pool_scheduler&& scheduler,
-                Sender_&& sender, Shape_&& shape, F_&& f)
+                Sender_&& sender, shapes_type&& shapes, functions_type&& fs)
               : scheduler(HPX_MOVE(scheduler))
               , sender(HPX_FORWARD(Sender_, sender))
-              , shape(HPX_FORWARD(Shape_, shape))
-              , f(HPX_FORWARD(F_, f))
+              , shapes(HPX_MOVE(shapes))
+              , fs(HPX_MOVE(fs))
             {
             }
 
@@ -85,6 +102,15 @@ namespace hpx::execution::experimental {
             thread_pool_bulk_sender& operator=(
                 thread_pool_bulk_sender const&) = default;
 
+            // Return a sender which runs the given bulk operation as an
+            // additional phase after the phases of this sender.
+            template <typename F_>
+            auto fuse(std::decay_t<Shape>&& shape, F_&& f) &&
+            {
+                return fuse_helper(HPX_MOVE(shape), HPX_FORWARD(F_, f),
+                    std::make_index_sequence<num_phases>());
+            }
+
             template <typename Env>
             struct generate_completion_signatures
             {
@@ -136,6 +162,20 @@ namespace hpx::execution::experimental {
             }
 
         private:
+            template <typename F_, std::size_t... Is>
+            auto fuse_helper(std::decay_t<Shape>&& shape, F_&& f,
+                std::index_sequence<Is...>)
+            {
+                using fused_sender_type = thread_pool_bulk_sender<Sender,
+                    Shape, F, Fs..., std::decay_t<F_>>;
+
+                return fused_sender_type{HPX_MOVE(scheduler), HPX_MOVE(sender),
+                    typename fused_sender_type::shapes_type{
+                        {HPX_MOVE(shapes[Is])..., HPX_MOVE(shape)}},
+                    typename fused_sender_type::functions_type{
+                        HPX_MOVE(hpx::get<Is>(fs))..., HPX_FORWARD(F_, f)}};
+            }
+
             template <typename Receiver>
             struct operation_state
             {
@@ -160,6 +200,7 @@ namespace hpx::execution::experimental {
 
                     struct task_function;
 
+                    template <std::size_t Phase>
                     struct set_value_loop_visitor
                     {
                         operation_state* const op_state;
@@ -177,18 +218,21 @@ namespace hpx::execution::experimental {
                         void do_work_chunk(
                             Ts& ts, std::uint32_t const index) const
                         {
-                            auto const i_begin = static_cast<size_type>(index) *
-                                task_f->chunk_size;
-                            auto const i_end =
-                                (std::min)(static_cast<size_type>(index + 1) *
-                                        task_f->chunk_size,
-                                    task_f->n);
-                            auto it = hpx::util::begin(op_state->shape);
+                            auto const chunk_size =
+                                op_state->chunk_sizes[Phase];
+                            auto const i_begin =
+                                static_cast<size_type>(index) * chunk_size;
+                            auto const i_end = (std::min)(
+                                static_cast<size_type>(index + 1) * chunk_size,
+                                op_state->sizes[Phase]);
+                            auto it = hpx::util::begin(op_state->shapes[Phase]);
                             std::advance(it, i_begin);
                             for (std::uint32_t i = i_begin; i < i_end; ++i)
                             {
                                 hpx::util::invoke_fused(
-                                    hpx::bind_front(op_state->f, *it), ts);
+                                    hpx::bind_front(
+                                        hpx::get<Phase>(op_state->fs), *it),
+                                    ts);
                                 ++it;
                             }
                         }
@@ -202,8 +246,8 @@ namespace hpx::execution::experimental {
                                 std::decay_t<Ts>, hpx::monostate>>>
                         void operator()(Ts& ts) const
                         {
-                            auto& local_queue =
-                                op_state->queues[task_f->worker_thread].data_;
+                            auto& local_queue = op_state->get_queue(
+                                Phase, task_f->worker_thread);
 
                             // Handle local queue first
                             hpx::optional<std::uint32_t> index;
@@ -220,9 +264,8 @@ namespace hpx::execution::experimental {
                                 std::size_t neighbor_worker_thread =
                                     (task_f->worker_thread + offset) %
                                     op_state->num_worker_threads;
-                                auto& neighbor_queue =
-                                    op_state->queues[neighbor_worker_thread]
-                                        .data_;
+                                auto& neighbor_queue = op_state->get_queue(
+                                    Phase, neighbor_worker_thread);
 
                                 while ((index = neighbor_queue.pop_right()))
                                 {
@@ -262,14 +305,14 @@ namespace hpx::execution::experimental {
                     struct task_function
                     {
                         operation_state* const op_state;
-                        size_type const n;
-                        std::uint32_t const chunk_size;
                         std::uint32_t const worker_thread;
 
                         // Visit the values sent by the predecessor sender.
+                        template <std::size_t Phase>
                         void do_work() const
                         {
-                            hpx::visit(set_value_loop_visitor{op_state, this},
+                            hpx::visit(
+                                set_value_loop_visitor<Phase>{op_state, this},
                                 op_state->ts);
                         }
 
@@ -285,6 +328,51 @@ namespace hpx::execution::experimental {
                             }
                         }
 
+                        // Wait for all worker threads to finish the given
+                        // phase.
+                        void wait_for_phase(std::size_t const phase) const
+                        {
+                            auto& finished = op_state->phases_finished[phase];
+                            ++finished;
+                            hpx::util::yield_while([&]() {
+                                return finished.load(
+                                           std::memory_order_acquire) <
+                                    op_state->num_participants;
+                            });
+                        }
+
+                        // Do the work of one phase. The work of all phases
+                        // following a phase in which an exception was thrown
+                        // is skipped.
+                        template <std::size_t Phase>
+                        void do_phase() const
+                        {
+                            if constexpr (Phase != 0)
+                            {
+                                wait_for_phase(Phase - 1);
+                            }
+
+                            if (op_state->exception_thrown)
+                            {
+                                return;
+                            }
+
+                            try
+                            {
+                                do_work<Phase>();
+                            }
+                            catch (...)
+                            {
+                                store_exception();
+                            }
+                        }
+
+                        template <std::size_t... Is>
+                        void do_phases(std::index_sequence<Is...>) const
+                        {
+                            (do_phase<Is>(), ...);
+                        }
+
                         // Finish the work for one worker thread. If this is not
                         // the last worker thread to finish, it will only
                         // decrement the counter. If it is the last thread it
@@ -312,20 +400,12 @@ namespace hpx::execution::experimental {
                         }
 
                         // Entry point for the worker thread. It will attempt to
-                        // do its local work, catch any exceptions, and then
-                        // call set_value or set_error on the connected
-                        // receiver.
+                        // do its local work for all phases, catch any
+                        // exceptions, and then call set_value or set_error on
+                        // the connected receiver.
                         void operator()()
                         {
-                            try
-                            {
-                                do_work();
-                            }
-                            catch (...)
-                            {
-                                store_exception();
-                            }
-
+                            do_phases(std::make_index_sequence<num_phases>());
                             finish();
                         };
                     };
@@ -346,10 +426,11 @@ namespace hpx::execution::experimental {
                     }
 
                     // Initialize a queue for a worker thread.
-                    void init_queue(std::uint32_t const worker_thread,
+                    void init_queue(std::size_t const phase,
+                        std::uint32_t const worker_thread,
                         std::uint32_t const num_chunks)
                     {
-                        auto& queue = op_state->queues[worker_thread].data_;
+                        auto& queue = op_state->get_queue(phase, worker_thread);
                         auto const part_begin = static_cast<std::uint32_t>(
                             (worker_thread * num_chunks) /
                             op_state->num_worker_threads);
@@ -359,19 +440,32 @@ namespace hpx::execution::experimental {
                         queue.reset(part_begin, part_end);
                     }
 
+                    // Return whether the queues of the worker thread are
+                    // empty for all phases.
+                    bool has_work(std::uint32_t const worker_thread) const
+                    {
+                        for (std::size_t phase = 0; phase != num_phases;
+                             ++phase)
+                        {
+                            if (!op_state->get_queue(phase, worker_thread)
+                                     .empty())
+                            {
+                                return true;
+                            }
+                        }
+                        return false;
+                    }
+
                     // Spawn a task which will process a number of chunks. If
-                    // the queue contains no chunks no task will be spawned.
-                    void do_work_task(size_type const n,
-                        std::uint32_t const chunk_size,
-                        std::uint32_t const worker_thread) const
+                    // the queues contain no chunks no task will be spawned.
+                    void do_work_task(std::uint32_t const worker_thread,
+                        std::vector<threads::thread_init_data>& tasks) const
                     {
-                        task_function task_f{
-                            this->op_state, n, chunk_size, worker_thread};
+                        task_function task_f{this->op_state, worker_thread};
 
-                        auto& queue = op_state->queues[worker_thread].data_;
-                        if (queue.empty())
+                        if (!has_work(worker_thread))
                         {
-                            // If the queue is empty we don't spawn a task. We
+                            // If the queues are empty we don't spawn a task. We
                             // only signal that this "task" is ready.
                             task_f.finish();
                             return;
@@ -391,39 +485,35 @@ namespace hpx::execution::experimental {
                             get_annotation(op_state->scheduler);
                         char const* annotation =
                             scheduler_annotation == nullptr ?
-                            traits::get_function_annotation<
-                                std::decay_t<F>>::call(op_state->f) :
+                            traits::get_function_annotation<std::decay_t<F>>::
+                                call(hpx::get<0>(op_state->fs)) :
                             scheduler_annotation;
 
-                        threads::thread_init_data data(
+                        tasks.emplace_back(
                             threads::make_thread_function_nullary(
                                 HPX_MOVE(task_f)),
                             annotation, get_priority(op_state->scheduler), hint,
                             get_stacksize(op_state->scheduler));
-                        threads::register_work(
-                            data, op_state->scheduler.get_thread_pool());
                     }
 
                     // Do the work on the worker thread that called set_value
                     // from the predecessor sender. This thread participates in
                     // the work and does not need a new task since it already
                     // runs on a task.
-                    void do_work_local(size_type n, std::uint32_t chunk_size,
-                        std::uint32_t worker_thread) const
+                    void do_work_local(std::uint32_t worker_thread) const
                     {
                         char const* scheduler_annotation =
                             get_annotation(op_state->scheduler);
                         if (scheduler_annotation)
                         {
                             hpx::scoped_annotation ann(scheduler_annotation);
-                            task_function{
-                                this->op_state, n, chunk_size, worker_thread}();
+                            task_function{this->op_state, worker_thread}();
                         }
                         else
                         {
-                            hpx::scoped_annotation ann(op_state->f);
-                            task_function{
-                                this->op_state, n, chunk_size, worker_thread}();
+                            hpx::scoped_annotation ann(
+                                hpx::get<0>(op_state->fs));
+                            task_function{this->op_state, worker_thread}();
                         }
                     }
 
@@ -433,53 +523,95 @@ namespace hpx::execution::experimental {
                     template <typename... Ts,
                         typename = std::enable_if_t<
                             hpx::is_invocable_v<F, range_value_type,
-                                std::add_lvalue_reference_t<Ts>...>>>
+                                std::add_lvalue_reference_t<Ts>...> &&
+                            (hpx::is_invocable_v<Fs, range_value_type,
+                                 std::add_lvalue_reference_t<Ts>...> &&
+                                ...)>>
                     friend void tag_invoke(
                         set_value_t, bulk_receiver&& r, Ts&&... ts) noexcept
                     {
                         hpx::detail::try_catch_exception_ptr(
                             [&]() {
+                                auto& os = *r.op_state;
+
                                 // Don't spawn tasks if there is no work to be
                                 // done
-                                auto const n =
-                                    hpx::util::size(r.op_state->shape);
-                                if (n == 0)
+                                size_type total_n = 0;
+                                for (std::size_t phase = 0;
+                                     phase != num_phases; ++phase)
+                                {
+                                    os.sizes[phase] =
+                                        hpx::util::size(os.shapes[phase]);
+                                    total_n += os.sizes[phase];
+                                }
+                                if (total_n == 0)
                                 {
                                     hpx::execution::experimental::set_value(
-                                        HPX_MOVE(r.op_state->receiver),
+                                        HPX_MOVE(os.receiver),
                                         HPX_FORWARD(Ts, ts)...);
                                     return;
                                 }
 
-                                // Calculate chunk size and number of chunks
-                                auto const chunk_size = get_chunk_size(
-                                    r.op_state->num_worker_threads, n);
-                                auto const num_chunks =
-                                    (n + chunk_size - 1) / chunk_size;
-
                                 // Store sent values in the operation state
-                                r.op_state->ts
-                                    .template emplace<hpx::tuple<Ts...>>(
-                                        HPX_FORWARD(Ts, ts)...);
+                                os.ts.template emplace<hpx::tuple<Ts...>>(
+                                    HPX_FORWARD(Ts, ts)...);
 
-                                // Initialize the queues for all worker threads
-                                // so that worker threads can start stealing
-                                // immediately when they start.
-                                for (std::size_t worker_thread = 0;
-                                     worker_thread <
-                                     r.op_state->num_worker_threads;
-                                     ++worker_thread)
+                                // Calculate chunk size and number of chunks
+                                // and initialize the queues for all worker
+                                // threads so that worker threads can start
+                                // stealing immediately when they start.
+                                for (std::size_t phase = 0;
+                                     phase != num_phases; ++phase)
                                 {
-                                    r.init_queue(worker_thread, num_chunks);
+                                    auto const n = os.sizes[phase];
+                                    auto const chunk_size = get_chunk_size(
+                                        os.num_worker_threads, n);
+                                    auto const num_chunks =
+                                        (n + chunk_size - 1) / chunk_size;
+
+                                    os.chunk_sizes[phase] = chunk_size;
+                                    for (std::size_t worker_thread = 0;
+                                         worker_thread < os.num_worker_threads;
+                                         ++worker_thread)
+                                    {
+                                        r.init_queue(
+                                            phase, worker_thread, num_chunks);
+                                    }
                                 }
 
-                                // Spawn the worker threads for all except the
-                                // local queue.
+                                // All threads for which a task is spawned
+                                // and the local thread take part in the
+                                // synchronization between the phases.
                                 auto const local_worker_thread =
                                     hpx::get_local_worker_thread_num();
+                                if constexpr (num_phases != 1)
+                                {
+                                    os.num_participants = 1;
+                                    for (std::size_t worker_thread = 0;
+                                         worker_thread < os.num_worker_threads;
+                                         ++worker_thread)
+                                    {
+                                        if (worker_thread !=
+                                                local_worker_thread &&
+                                            r.has_work(worker_thread))
+                                        {
+                                            ++os.num_participants;
+                                        }
+                                    }
+                                    for (auto& finished : os.phases_finished)
+                                    {
+                                        finished.store(
+                                            0, std::memory_order_relaxed);
+                                    }
+                                }
+
+                                // Spawn the worker threads for all except the
+                                // local queue, all tasks are handed to the
+                                // thread pool at once.
+                                std::vector<threads::thread_init_data> tasks;
+                                tasks.reserve(os.num_worker_threads);
                                 for (std::size_t worker_thread = 0;
-                                     worker_thread <
-                                     r.op_state->num_worker_threads;
+                                     worker_thread < os.num_worker_threads;
                                      ++worker_thread)
                                 {
                                     // The queue for the local thread is handled
@@ -489,13 +621,14 @@ namespace hpx::execution::experimental {
                                         continue;
                                     }
 
-                                    r.do_work_task(
-                                        n, chunk_size, worker_thread);
+                                    r.do_work_task(worker_thread, tasks);
                                 }
+                                threads::register_work_n(tasks.data(),
+                                    tasks.size(),
+                                    os.scheduler.get_thread_pool());
 
                                 // Handle the queue for the local thread.
-                                r.do_work_local(
-                                    n, chunk_size, local_worker_thread);
+                                r.do_work_local(local_worker_thread);
                             },
                             [&](std::exception_ptr ep) {
                                 hpx::execution::experimental::set_error(
@@ -515,12 +648,22 @@ namespace hpx::execution::experimental {
                     scheduler.get_thread_pool()->get_os_thread_count();
                 std::vector<hpx::util::cache_aligned_data<
                     hpx::concurrency::detail::contiguous_index_queue<>>>
-                    queues{num_worker_threads};
-                HPX_NO_UNIQUE_ADDRESS std::decay_t<Shape> shape;
-                HPX_NO_UNIQUE_ADDRESS std::decay_t<F> f;
+                    queues{num_phases * num_worker_threads};
+                shapes_type shapes;
+                HPX_NO_UNIQUE_ADDRESS functions_type fs;
                 HPX_NO_UNIQUE_ADDRESS std::decay_t<Receiver> receiver;
-                std::atomic<decltype(hpx::util::size(shape))> tasks_remaining{
-                    num_worker_threads};
+                std::atomic<decltype(hpx::util::size(shapes[0]))>
+                    tasks_remaining{num_worker_threads};
+
+                // the number of elements and the chunk size of each phase
+                std::array<size_type, num_phases> sizes;
+                std::array<std::uint32_t, num_phases> chunk_sizes;
+
+                // the number of threads which have finished a phase (not used
+                // for the last phase)
+                std::size_t num_participants = 0;
+                std::array<std::atomic<std::size_t>, num_phases - 1>
+                    phases_finished;
 
                 hpx::util::detail::prepend_t<value_types_of_t<Sender, empty_env,
                                                  decayed_tuple, hpx::variant>,
@@ -529,20 +672,26 @@ namespace hpx::execution::experimental {
                 std::atomic<bool> exception_thrown{false};
                 std::optional<std::exception_ptr> exception;
 
-                template <typename Sender_, typename Shape_, typename F_,
-                    typename Receiver_>
+                template <typename Sender_, typename Receiver_>
                 operation_state(thread_pool_scheduler&& scheduler,
-                    Sender_&& sender, Shape_&& shape, F_&& f,
+                    Sender_&& sender, shapes_type&& shapes, functions_type&& fs,
                     Receiver_&& receiver)
                   : scheduler(HPX_MOVE(scheduler))
                   , op_state(hpx::execution::experimental::connect(
                         HPX_FORWARD(Sender_, sender), bulk_receiver{this}))
-                  , shape(HPX_FORWARD(Shape_, shape))
-                  , f(HPX_FORWARD(F_, f))
+                  , shapes(HPX_MOVE(shapes))
+                  , fs(HPX_MOVE(fs))
                   , receiver(HPX_FORWARD(Receiver_, receiver))
                 {
                 }
 
+                hpx::concurrency::detail::contiguous_index_queue<>& get_queue(
+                    std::size_t const phase, std::size_t const worker_thread)
+                {
+                    return queues[phase * num_worker_threads + worker_thread]
+                        .data_;
+                }
+
                 friend void tag_invoke(start_t, operation_state& os) noexcept
                 {
                     hpx::execution::experimental::start(os.op_state);
@@ -556,7 +705,7 @@ namespace hpx::execution::experimental {
             {
                 return operation_state<std::decay_t<Receiver>>{
                     HPX_MOVE(s.scheduler), HPX_MOVE(s.sender),
-                    HPX_MOVE(s.shape), HPX_MOVE(s.f),
+                    HPX_MOVE(s.shapes), HPX_MOVE(s.fs),
                     HPX_FORWARD(Receiver, receiver)};
             }
 
@@ -565,38 +714,101 @@ namespace hpx::execution::experimental {
                 connect_t, thread_pool_bulk_sender& s, Receiver&& receiver)
             {
                 return operation_state<std::decay_t<Receiver>>{s.scheduler,
-                    s.sender, s.shape, s.f, HPX_FORWARD(Receiver, receiver)};
+                    s.sender, shapes_type(s.shapes), functions_type(s.fs),
+                    HPX_FORWARD(Receiver, receiver)};
+            }
+        };
+
+        // The shape type used by the bulk sender for a given shape.
+        template <typename Shape, typename Enable = void>
+        struct thread_pool_bulk_shape
+        {
+            using type = std::decay_t<Shape>;
+        };
+
+        template <typename Shape>
+        struct thread_pool_bulk_shape<Shape,
+            std::enable_if_t<std::is_integral_v<std::decay_t<Shape>>>>
+        {
+            using type =
+                hpx::util::detail::counting_shape_type<std::decay_t<Shape>>;
+        };
+
+        template <typename Shape>
+        using thread_pool_bulk_shape_t =
+            typename thread_pool_bulk_shape<Shape>::type;
+
+        template <typename Shape>
+        decltype(auto) make_thread_pool_bulk_shape(Shape&& shape)
+        {
+            if constexpr (std::is_integral_v<std::decay_t<Shape>>)
+            {
+                return hpx::util::detail::make_counting_shape(shape);
+            }
+            else
+            {
+                return HPX_FORWARD(Shape, shape);
             }
+        }
+
+        // A bulk operation can be fused with the preceding bulk sender if both
+        // use the same shape type.
+        template <typename Sender, typename Shape>
+        struct is_fusable_thread_pool_bulk_sender : std::false_type
+        {
+        };
+
+        template <typename Sender, typename Shape, typename F, typename... Fs>
+        struct is_fusable_thread_pool_bulk_sender<
+            thread_pool_bulk_sender<Sender, Shape, F, Fs...>, Shape>
+          : std::true_type
+        {
         };
+
+        template <typename Sender, typename Shape>
+        inline constexpr bool is_fusable_thread_pool_bulk_sender_v =
+            is_fusable_thread_pool_bulk_sender<std::decay_t<Sender>,
+                thread_pool_bulk_shape_t<Shape>>::value;
     }    // namespace detail
 
     // clang-format off
     template <typename Sender, typename Shape, typename F,
         HPX_CONCEPT_REQUIRES_(
-            std::is_integral_v<std::decay_t<Shape>>
+            !detail::is_fusable_thread_pool_bulk_sender_v<Sender, Shape>
         )>
     // clang-format on
     constexpr auto tag_invoke(bulk_t, thread_pool_scheduler scheduler,
         Sender&& sender, Shape&& shape, F&& f)
     {
-        return detail::thread_pool_bulk_sender<std::decay_t<Sender>,
-            hpx::util::detail::counting_shape_type<std::decay_t<Shape>>,
-            std::decay_t<F>>{HPX_MOVE(scheduler), HPX_FORWARD(Sender, sender),
-            hpx::util::detail::make_counting_shape(shape), HPX_FORWARD(F, f)};
+        using sender_type =
+            detail::thread_pool_bulk_sender<std::decay_t<Sender>,
+                detail::thread_pool_bulk_shape_t<Shape>, std::decay_t<F>>;
+
+        using shapes_type = typename sender_type::shapes_type;
+        using functions_type = typename sender_type::functions_type;
+
+        return sender_type{HPX_MOVE(scheduler), HPX_FORWARD(Sender, sender),
+            shapes_type{{detail::make_thread_pool_bulk_shape(
+                HPX_FORWARD(Shape, shape))}},
+            functions_type{HPX_FORWARD(F, f)}};
     }
 
+    // The predecessor sender is a bulk sender completing on the same
+    // scheduler (bulk dispatches on the completion scheduler of its
+    // predecessor), both bulk operations are executed by the same tasks.
     // clang-format off
     template <typename Sender, typename Shape, typename F,
         HPX_CONCEPT_REQUIRES_(
-            !std::is_integral_v<std::decay_t<Shape>>
+            detail::is_fusable_thread_pool_bulk_sender_v<Sender, Shape>
         )>
     // clang-format on
-    constexpr auto tag_invoke(bulk_t, thread_pool_scheduler scheduler,
+    constexpr auto tag_invoke(bulk_t, thread_pool_scheduler,
         Sender&& sender, Shape&& shape, F&& f)
     {
-        return detail::thread_pool_bulk_sender<std::decay_t<Sender>,
-            std::decay_t<Shape>, std::decay_t<F>>{HPX_MOVE(scheduler),
-            HPX_FORWARD(Sender, sender), HPX_FORWARD(Shape, shape),
-            HPX_FORWARD(F, f)};
+        return std::decay_t<Sender>(HPX_FORWARD(Sender, sender))
+            .fuse(detail::thread_pool_bulk_shape_t<Shape>(
+                      detail::make_thread_pool_bulk_shape(
+                          HPX_FORWARD(Shape, shape))),
+                HPX_FORWARD(F, f));
     }
 }    // namespace hpx::execution::experimental
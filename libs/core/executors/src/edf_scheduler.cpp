@@ -0,0 +1,107 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/executors/edf_scheduler.hpp>
+#include <hpx/synchronization/spinlock.hpp>
+#include <hpx/timing/steady_clock.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+
+namespace hpx::execution::experimental::detail {
+
+    namespace {
+
+        std::atomic<std::int64_t> edf_deadline_misses{0};
+        std::atomic<std::int64_t> edf_num_executed{0};
+
+        std::int64_t get_and_reset(
+            std::atomic<std::int64_t>& value, bool reset) noexcept
+        {
+            return reset ? value.exchange(0, std::memory_order_relaxed) :
+                           value.load(std::memory_order_relaxed);
+        }
+    }    // namespace
+
+    void edf_queue::push(edf_work_item* item)
+    {
+        HPX_ASSERT(item != nullptr && item->execute != nullptr);
+
+        std::lock_guard<hpx::spinlock> l(mtx_);
+        heap_.push_back(entry{item->deadline, sequence_++, item});
+        std::push_heap(heap_.begin(), heap_.end());
+    }
+
+    bool edf_queue::erase(edf_work_item* item) noexcept
+    {
+        std::lock_guard<hpx::spinlock> l(mtx_);
+        auto it = std::find_if(heap_.begin(), heap_.end(),
+            [item](entry const& e) { return e.item == item; });
+        if (it == heap_.end())
+        {
+            return false;
+        }
+
+        heap_.erase(it);
+        std::make_heap(heap_.begin(), heap_.end());
+        return true;
+    }
+
+    void edf_queue::execute_one() noexcept
+    {
+        edf_work_item* item = nullptr;
+        {
+            std::lock_guard<hpx::spinlock> l(mtx_);
+            if (heap_.empty())
+            {
+                return;
+            }
+
+            std::pop_heap(heap_.begin(), heap_.end());
+            item = heap_.back().item;
+            heap_.pop_back();
+        }
+
+        auto const deadline = item->deadline;
+        if (deadline != (hpx::chrono::steady_clock::time_point::max)())
+        {
+            ++num_executed_;
+            ++edf_num_executed;
+            if (hpx::chrono::steady_clock::now() > deadline)
+            {
+                ++deadline_misses_;
+                ++edf_deadline_misses;
+            }
+        }
+
+        // the item may be destroyed by this call
+        item->execute(item);
+    }
+
+    std::int64_t edf_queue::get_deadline_misses(bool reset) noexcept
+    {
+        return get_and_reset(deadline_misses_, reset);
+    }
+
+    std::int64_t edf_queue::get_num_executed(bool reset) noexcept
+    {
+        return get_and_reset(num_executed_, reset);
+    }
+
+    std::int64_t get_edf_deadline_misses(bool reset)
+    {
+        return get_and_reset(edf_deadline_misses, reset);
+    }
+
+    std::int64_t get_edf_num_executed(bool reset)
+    {
+        return get_and_reset(edf_num_executed, reset);
+    }
+}    // namespace hpx::execution::experimental::detail
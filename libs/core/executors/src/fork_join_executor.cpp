@@ -20,6 +20,9 @@ namespace hpx::execution::experimental {
         case fork_join_executor::loop_schedule::dynamic:
             os << "dynamic";
             break;
+        case fork_join_executor::loop_schedule::stealing:
+            os << "stealing";
+            break;
         default:
             os << "<unknown>";
             break;
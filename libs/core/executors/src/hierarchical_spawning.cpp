@@ -0,0 +1,53 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/executors/detail/hierarchical_spawning.hpp>
+#include <hpx/threading_base/thread_pool_base.hpp>
+#include <hpx/topology/topology.hpp>
+
+#include <cstddef>
+#include <vector>
+
+namespace hpx::parallel::execution::detail {
+
+    std::vector<std::size_t> get_numa_domain_boundaries(
+        threads::thread_pool_base* pool, std::size_t first_thread,
+        std::size_t num_threads)
+    {
+        HPX_ASSERT(pool);
+
+        std::vector<std::size_t> boundaries;
+        if (num_threads < 2 ||
+            threads::create_topology().get_number_of_numa_nodes() < 2)
+        {
+            return boundaries;
+        }
+
+        std::size_t domain = pool->get_numa_domain(first_thread);
+        for (std::size_t t = 1; t != num_threads; ++t)
+        {
+            std::size_t const next_domain =
+                pool->get_numa_domain(first_thread + t);
+            if (next_domain != domain)
+            {
+                if (boundaries.empty())
+                {
+                    boundaries.push_back(0);
+                }
+                boundaries.push_back(t);
+                domain = next_domain;
+            }
+        }
+
+        if (!boundaries.empty())
+        {
+            boundaries.push_back(num_threads);
+        }
+        return boundaries;
+    }
+}    // namespace hpx::parallel::execution::detail
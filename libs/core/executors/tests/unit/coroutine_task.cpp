@@ -0,0 +1,210 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if !defined(HPX_HAVE_CXX20_COROUTINES)
+#error "This test requires compiler support for C++20 coroutines"
+#endif
+
+#include <hpx/executors/coroutine_task.hpp>
+#include <hpx/local/execution.hpp>
+#include <hpx/local/future.hpp>
+#include <hpx/local/init.hpp>
+#include <hpx/local/thread.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/modules/threading_base.hpp>
+
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+namespace ex = hpx::execution::experimental;
+namespace tt = hpx::this_thread::experimental;
+
+///////////////////////////////////////////////////////////////////////////////
+ex::task<int> return_value(int value)
+{
+    co_return value;
+}
+
+ex::task<> return_void(int& count)
+{
+    ++count;
+    co_return;
+}
+
+ex::task<int> throw_exception()
+{
+    throw std::runtime_error("error");
+    co_return 0;
+}
+
+void test_sender()
+{
+    static_assert(ex::is_sender_v<ex::task<int>>);
+    static_assert(ex::is_sender_v<ex::task<>>);
+
+    HPX_TEST_EQ(hpx::get<0>(*tt::sync_wait(return_value(42))), 42);
+
+    int count = 0;
+    tt::sync_wait(return_void(count));
+    HPX_TEST_EQ(count, 1);
+
+    bool caught = false;
+    try
+    {
+        tt::sync_wait(throw_exception());
+    }
+    catch (std::runtime_error const&)
+    {
+        caught = true;
+    }
+    HPX_TEST(caught);
+
+    auto result = hpx::get<0>(*tt::sync_wait(return_value(3) |
+        ex::then([](int x) { return std::to_string(x); })));
+    HPX_TEST_EQ(result, std::string("3"));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+ex::task<int> await_tasks()
+{
+    int count = 0;
+    co_await return_void(count);
+    int result = co_await return_value(count);
+
+    try
+    {
+        co_await throw_exception();
+        HPX_TEST(false);
+    }
+    catch (std::runtime_error const&)
+    {
+        ++result;
+    }
+
+    co_return result;
+}
+
+// Awaiting tasks which complete synchronously uses symmetric transfer and
+// does not grow the stack.
+ex::task<std::size_t> await_many_tasks(std::size_t num_tasks)
+{
+    std::size_t result = 0;
+    for (std::size_t i = 0; i != num_tasks; ++i)
+    {
+        result += static_cast<std::size_t>(co_await return_value(1));
+    }
+    co_return result;
+}
+
+void test_await_task()
+{
+    HPX_TEST_EQ(hpx::get<0>(*tt::sync_wait(await_tasks())), 2);
+
+    std::size_t const num_tasks = 100000;
+    HPX_TEST_EQ(
+        hpx::get<0>(*tt::sync_wait(await_many_tasks(num_tasks))), num_tasks);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+ex::task<int> await_senders(ex::thread_pool_scheduler sched)
+{
+    int result = co_await ex::just(1);
+    co_await ex::just();
+    result += co_await (ex::schedule(sched) | ex::then([]() { return 2; }));
+    result += co_await ex::transfer_just(sched, 3);
+
+    try
+    {
+        co_await ex::just_error(std::make_exception_ptr(
+            std::runtime_error("error")));
+        HPX_TEST(false);
+    }
+    catch (std::runtime_error const&)
+    {
+        ++result;
+    }
+
+    bool caught = false;
+    try
+    {
+        co_await ex::just_stopped();
+    }
+    catch (hpx::exception const&)
+    {
+        caught = true;
+    }
+    HPX_TEST(caught);
+
+    co_return result;
+}
+
+void test_await_sender()
+{
+    ex::thread_pool_scheduler sched{};
+    HPX_TEST_EQ(hpx::get<0>(*tt::sync_wait(await_senders(sched))), 7);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+ex::task<hpx::thread::id> await_scheduler(ex::thread_pool_scheduler sched)
+{
+    co_await sched;
+
+    // the coroutine is resumed on a stackless HPX thread
+    HPX_TEST(hpx::threads::get_self_ptr() != nullptr);
+    HPX_TEST_EQ(hpx::threads::get_self_id_data()->get_stack_size_enum(),
+        hpx::threads::thread_stacksize::nostack);
+
+    int result = co_await return_value(42);
+    HPX_TEST_EQ(result, 42);
+
+    co_return hpx::this_thread::get_id();
+}
+
+void test_await_scheduler()
+{
+    ex::thread_pool_scheduler sched{};
+
+    hpx::thread::id parent_id = hpx::this_thread::get_id();
+    hpx::thread::id id = hpx::get<0>(*tt::sync_wait(await_scheduler(sched)));
+    HPX_TEST_NEQ(parent_id, id);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+ex::task<int> await_future()
+{
+    int result = co_await hpx::make_ready_future(1);
+    result += co_await hpx::async([]() { return 2; });
+    co_return result;
+}
+
+void test_await_future()
+{
+    HPX_TEST_EQ(hpx::get<0>(*tt::sync_wait(await_future())), 3);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    test_sender();
+    test_await_task();
+    test_await_sender();
+    test_await_scheduler();
+    test_await_future();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,176 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/executors/edf_scheduler.hpp>
+#include <hpx/local/execution.hpp>
+#include <hpx/local/init.hpp>
+#include <hpx/local/thread.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace ex = hpx::execution::experimental;
+namespace tt = hpx::this_thread::experimental;
+
+///////////////////////////////////////////////////////////////////////////////
+void test_concepts()
+{
+    ex::edf_scheduler sched{};
+
+    static_assert(ex::is_scheduler_v<ex::edf_scheduler>);
+    static_assert(ex::is_sender_v<decltype(ex::schedule(sched))>);
+
+    HPX_TEST(sched == sched);
+    HPX_TEST(sched != ex::edf_scheduler{});
+    HPX_TEST(sched ==
+        ex::get_completion_scheduler<ex::set_value_t>(ex::schedule(sched)));
+
+    auto const deadline = std::chrono::steady_clock::now();
+    auto sched_with_deadline = ex::with_deadline(sched, deadline);
+    HPX_TEST(ex::get_deadline(sched_with_deadline) == deadline);
+    HPX_TEST(sched_with_deadline != sched);
+
+    auto sched_with_priority =
+        ex::with_priority(sched, hpx::threads::thread_priority::high);
+    HPX_TEST_EQ(ex::get_priority(sched_with_priority),
+        hpx::threads::thread_priority::high);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_senders()
+{
+    ex::edf_scheduler sched{};
+    auto sched_with_deadline =
+        ex::with_deadline(sched, std::chrono::seconds(10));
+
+    hpx::thread::id parent_id = hpx::this_thread::get_id();
+
+    {
+        auto result = hpx::get<0>(*tt::sync_wait(
+            ex::schedule(sched_with_deadline) | ex::then([&]() {
+                HPX_TEST_NEQ(parent_id, hpx::this_thread::get_id());
+                return 42;
+            })));
+        HPX_TEST_EQ(result, 42);
+    }
+
+    {
+        auto result =
+            hpx::get<0>(*tt::sync_wait(ex::transfer_just(sched, 3) |
+                ex::transfer(sched_with_deadline) |
+                ex::then([](int x) { return std::to_string(x); })));
+        HPX_TEST_EQ(result, std::string("3"));
+    }
+
+    {
+        auto result = tt::sync_wait(
+            ex::when_all(ex::transfer_just(sched_with_deadline, 1),
+                ex::transfer_just(sched, 2.0)));
+        HPX_TEST_EQ(hpx::get<0>(*result), 1);
+        HPX_TEST_EQ(hpx::get<1>(*result), 2.0);
+    }
+
+    HPX_TEST_EQ(sched.get_num_executed(), std::int64_t(3));
+    HPX_TEST_EQ(sched.get_deadline_misses(), std::int64_t(0));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_deadline_misses()
+{
+    ex::edf_scheduler sched{};
+
+    std::int64_t const misses = ex::detail::get_edf_deadline_misses(false);
+
+    auto past = std::chrono::steady_clock::now() - std::chrono::seconds(1);
+    tt::sync_wait(ex::schedule(ex::with_deadline(sched, past)));
+    tt::sync_wait(ex::schedule(ex::with_deadline(sched, past)));
+
+    // work without a deadline is not accounted for
+    tt::sync_wait(ex::schedule(sched));
+
+    HPX_TEST_EQ(sched.get_num_executed(), std::int64_t(2));
+    HPX_TEST_EQ(sched.get_deadline_misses(true), std::int64_t(2));
+    HPX_TEST_EQ(sched.get_deadline_misses(), std::int64_t(0));
+    HPX_TEST_LTE(misses + 2, ex::detail::get_edf_deadline_misses(false));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+struct test_work_item : ex::detail::edf_work_item
+{
+    test_work_item(std::vector<int>& order, int id,
+        std::chrono::steady_clock::time_point deadline)
+      : order(order)
+      , id(id)
+    {
+        this->deadline = deadline;
+        this->execute = [](ex::detail::edf_work_item* item) noexcept {
+            auto* self = static_cast<test_work_item*>(item);
+            self->order.push_back(self->id);
+        };
+    }
+
+    std::vector<int>& order;
+    int id;
+};
+
+void test_queue_order()
+{
+    auto const now = std::chrono::steady_clock::now();
+    auto const none = (std::chrono::steady_clock::time_point::max)();
+
+    std::vector<int> order;
+    std::vector<test_work_item> items = {
+        {order, 0, now + std::chrono::seconds(3)},
+        {order, 1, none},
+        {order, 2, now + std::chrono::seconds(1)},
+        {order, 3, now + std::chrono::seconds(3)},
+        {order, 4, none},
+        {order, 5, now + std::chrono::seconds(2)},
+    };
+
+    ex::detail::edf_queue queue;
+    for (auto& item : items)
+    {
+        queue.push(&item);
+    }
+
+    HPX_TEST(queue.erase(&items[3]));
+    HPX_TEST(!queue.erase(&items[3]));
+
+    for (std::size_t i = 0; i != items.size(); ++i)
+    {
+        queue.execute_one();
+    }
+
+    std::vector<int> const expected = {2, 5, 0, 1, 4};
+    HPX_TEST(order == expected);
+    HPX_TEST_EQ(queue.get_num_executed(false), std::int64_t(3));
+    HPX_TEST_EQ(queue.get_deadline_misses(false), std::int64_t(0));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    test_concepts();
+    test_senders();
+    test_deadline_misses();
+    test_queue_order();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -9,6 +9,7 @@
 #include <hpx/local/execution.hpp>
 #include <hpx/local/future.hpp>
 #include <hpx/local/init.hpp>
+#include <hpx/iterator_support/counting_shape.hpp>
 #include <hpx/local/thread.hpp>
 #include <hpx/modules/testing.hpp>
 
@@ -151,6 +152,119 @@ void test_bulk_async_exception(ExecutorArgs&&... args)
     HPX_TEST(caught_exception);
 }
 
+///////////////////////////////////////////////////////////////////////////////
+template <typename... ExecutorArgs>
+void test_execute_region(ExecutorArgs&&... args)
+{
+    std::cerr << "test_execute_region\n";
+
+    std::size_t const n = 107;
+    std::vector<std::size_t> v(n, 0);
+    std::vector<std::size_t> w(n, 0);
+
+    fork_join_executor exec{std::forward<ExecutorArgs>(args)...};
+
+    std::atomic<std::size_t> num_threads{0};
+    exec.execute_region(
+        [&](fork_join_executor::team& t, int passed_through) {
+            HPX_TEST_EQ(passed_through, 42);
+            HPX_TEST_LT(t.thread_index(), t.num_threads());
+            ++num_threads;
+
+            // the second loop reads the results of the first loop written by
+            // other worker threads
+            auto const shape = hpx::util::detail::make_counting_shape(n);
+            t.for_each([&](std::size_t i) { v[i] = 1; }, shape);
+            t.for_each(
+                [&](std::size_t i) {
+                    w[i] = std::accumulate(v.begin(), v.end(), std::size_t(0));
+                },
+                shape);
+        },
+        42);
+
+    HPX_TEST_EQ(num_threads.load(), hpx::get_num_worker_threads());
+    for (std::size_t i = 0; i != n; ++i)
+    {
+        HPX_TEST_EQ(w[i], n);
+    }
+}
+
+template <typename... ExecutorArgs>
+void test_execute_region_nested(ExecutorArgs&&... args)
+{
+    std::cerr << "test_execute_region_nested\n";
+
+    count = 0;
+    std::size_t const n = 107;
+    std::vector<int> v(n);
+    std::iota(std::begin(v), std::end(v), std::rand());
+
+    fork_join_executor exec{std::forward<ExecutorArgs>(args)...};
+
+    // split the team into two sub-teams working on separate loops
+    std::atomic<std::size_t> count_sub{0};
+    exec.execute_region([&](fork_join_executor::team& t) {
+        fork_join_executor::team sub = t.split(2);
+        HPX_TEST_LTE(sub.num_threads(), (t.num_threads() + 1) / 2);
+        HPX_TEST_LT(sub.thread_index(), sub.num_threads());
+
+        sub.for_each([&](int) { ++count_sub; }, v);
+        sub.barrier();
+        t.barrier();
+    });
+    HPX_TEST_EQ(count_sub.load(),
+        (std::min)(std::size_t(2), hpx::get_num_worker_threads()) * n);
+
+    // nested loops issued from inside a parallel region run sequentially
+    exec.execute_region([&](fork_join_executor::team&) {
+        hpx::parallel::execution::bulk_sync_execute(exec, &bulk_test, v, 42);
+    });
+    HPX_TEST_EQ(count.load(), hpx::get_num_worker_threads() * n);
+}
+
+template <typename... ExecutorArgs>
+void test_execute_region_exception(ExecutorArgs&&... args)
+{
+    std::cerr << "test_execute_region_exception\n";
+
+    fork_join_executor exec{std::forward<ExecutorArgs>(args)...};
+    bool caught_exception = false;
+    try
+    {
+        exec.execute_region([](fork_join_executor::team& t) {
+            if (t.thread_index() == 0)
+            {
+                throw std::runtime_error("test");
+            }
+
+            // the other threads are released from the barrier
+            t.barrier();
+            HPX_TEST(false);
+        });
+
+        HPX_TEST(false);
+    }
+    catch (std::runtime_error const& /*e*/)
+    {
+        caught_exception = true;
+    }
+    catch (...)
+    {
+        HPX_TEST(false);
+    }
+
+    HPX_TEST(caught_exception);
+
+    // the executor can be used after an exception
+    std::atomic<std::size_t> num_threads{0};
+    exec.execute_region([&](fork_join_executor::team& t) {
+        t.barrier();
+        ++num_threads;
+    });
+    HPX_TEST_EQ(num_threads.load(), hpx::get_num_worker_threads());
+}
+
 void static_check_executor()
 {
     using namespace hpx::traits;
@@ -173,6 +287,9 @@ void test_executor(hpx::threads::thread_priority priority,
     test_bulk_async(priority, stacksize, schedule);
     test_bulk_sync_exception(priority, stacksize, schedule);
     test_bulk_async_exception(priority, stacksize, schedule);
+    test_execute_region(priority, stacksize, schedule);
+    test_execute_region_nested(priority, stacksize, schedule);
+    test_execute_region_exception(priority, stacksize, schedule);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -197,6 +314,7 @@ int hpx_main()
             for (auto const schedule : {
                      fork_join_executor::loop_schedule::static_,
                      fork_join_executor::loop_schedule::dynamic,
+                     fork_join_executor::loop_schedule::stealing,
                  })
             {
                 {
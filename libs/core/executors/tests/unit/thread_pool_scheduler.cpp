@@ -1712,6 +1712,88 @@ void test_bulk()
     }
 }
 
+void test_bulk_fused()
+{
+    std::vector<int> const ns = {0, 1, 10, 43, 1000};
+
+    for (int n : ns)
+    {
+        // each phase reads results of the previous phase written by other
+        // elements, which requires all work of a phase to be finished before
+        // the next phase is started
+        std::vector<int> v1(n, 0);
+        std::vector<int> v2(n, 0);
+        std::vector<int> v3(n, 0);
+
+        auto sender = ex::schedule(ex::thread_pool_scheduler{}) |
+            ex::bulk(n, [&](int i) { v1[i] = i; }) |
+            ex::bulk(n, [&](int i) { v2[i] = v1[(i + 1) % n] + 1; }) |
+            ex::bulk(n, [&](int i) { v3[i] = v2[n - i - 1] + 1; });
+
+        static_assert(std::decay_t<decltype(sender)>::num_phases == 3,
+            "consecutive bulk operations should be fused");
+
+        tt::sync_wait(std::move(sender));
+
+        for (int i = 0; i < n; ++i)
+        {
+            HPX_TEST_EQ(v1[i], i);
+            HPX_TEST_EQ(v2[i], (i + 1) % n + 1);
+            HPX_TEST_EQ(v3[i], (n - i) % n + 2);
+        }
+    }
+
+    // phases with different sizes and values sent by the predecessor
+    for (int n : ns)
+    {
+        auto v_out = hpx::get<0>(
+            *(ex::transfer_just(
+                  ex::thread_pool_scheduler{}, std::vector<int>(2 * n, 0)) |
+                ex::bulk(n, [](int i, std::vector<int>& v) { v[i] = i; }) |
+                ex::bulk(2 * n,
+                    [n](int i, std::vector<int>& v) {
+                        if (i >= n)
+                        {
+                            v[i] = v[i - n] + n;
+                        }
+                    }) |
+                tt::sync_wait()));
+
+        HPX_TEST_EQ(v_out.size(), std::size_t(2 * n));
+        for (int i = 0; i < 2 * n; ++i)
+        {
+            HPX_TEST_EQ(v_out[i], i);
+        }
+    }
+
+    // an exception in one phase skips all following phases
+    {
+        int const n = 100;
+        std::atomic<int> count{0};
+
+        try
+        {
+            ex::schedule(ex::thread_pool_scheduler{}) |
+                ex::bulk(n,
+                    [](int i) {
+                        if (i == 3)
+                        {
+                            throw std::runtime_error("error");
+                        }
+                    }) |
+                ex::bulk(n, [&](int) { ++count; }) | tt::sync_wait();
+
+            HPX_TEST(false);
+        }
+        catch (std::runtime_error const& e)
+        {
+            HPX_TEST_EQ(std::string(e.what()), std::string("error"));
+        }
+
+        HPX_TEST_EQ(count.load(), 0);
+    }
+}
+
 void test_completion_scheduler()
 {
     {
@@ -1813,6 +1895,7 @@ int hpx_main()
     test_let_error();
     test_detach();
     test_bulk();
+    test_bulk_fused();
     test_completion_scheduler();
 
     return hpx::local::finalize();
@@ -19,19 +19,43 @@
 #include <hpx/functional/traits/is_invocable.hpp>
 
 #include <cstddef>
+#include <cstdint>
 #include <cstring>
 #include <new>
 #include <string>
 #include <type_traits>
 #include <utility>
 
+#if !defined(HPX_HAVE_THREAD_FUNCTION_STORAGE_SIZE)
+#define HPX_HAVE_THREAD_FUNCTION_STORAGE_SIZE (8 * sizeof(void*))
+#endif
+
 namespace hpx { namespace util { namespace detail {
+    // the size of the embedded storage of hpx::function and
+    // hpx::move_only_function, larger objects are allocated on the heap
     static const std::size_t function_storage_size = 3 * sizeof(void*);
 
+    // the size of the embedded storage of the thread functions, the
+    // functions created for new HPX threads usually bind a couple of
+    // arguments and would not fit the default size
+    static const std::size_t thread_function_storage_size =
+        HPX_HAVE_THREAD_FUNCTION_STORAGE_SIZE;
+
+    static_assert(thread_function_storage_size > function_storage_size,
+        "HPX_WITH_THREAD_FUNCTION_STORAGE_SIZE shall be larger than the "
+        "default storage size of hpx::function");
+
+#if defined(HPX_HAVE_FUNCTION_ALLOCATION_COUNTER)
+    // the number of function objects which did not fit the embedded storage
+    // of the function they were assigned to
+    HPX_CORE_EXPORT std::uint64_t get_function_allocation_count() noexcept;
+#endif
+
     ///////////////////////////////////////////////////////////////////////////
+    template <std::size_t StorageSize>
     class HPX_CORE_EXPORT function_base
     {
-        using vtable = function_base_vtable;
+            using vtable = function_base_vtable;
 
     public:
         constexpr explicit function_base(
@@ -74,10 +98,153 @@ namespace hpx { namespace util { namespace detail {
         union
         {
             char storage_init;
-            mutable unsigned char storage[function_storage_size];
+            mutable unsigned char storage[StorageSize];
         };
     };
 
+    ///////////////////////////////////////////////////////////////////////////
+    template <std::size_t StorageSize>
+    function_base<StorageSize>::function_base(
+        function_base const& other, vtable const* /* empty_vtable */)
+      : vptr(other.vptr)
+      , object(other.object)
+    {
+        if (other.object != nullptr)
+        {
+            object = vptr->copy(
+                storage, StorageSize, other.object, /*destroy*/ false);
+        }
+    }
+
+    template <std::size_t StorageSize>
+    function_base<StorageSize>::function_base(
+        function_base&& other, vtable const* empty_vptr) noexcept
+      : vptr(other.vptr)
+      , object(other.object)
+    {
+        if (object == &other.storage)
+        {
+            std::memcpy(storage, other.storage, StorageSize);
+            object = &storage;
+        }
+        other.vptr = empty_vptr;
+        other.object = nullptr;
+    }
+
+    template <std::size_t StorageSize>
+    function_base<StorageSize>::~function_base()
+    {
+        destroy();
+    }
+
+    template <std::size_t StorageSize>
+    void function_base<StorageSize>::op_assign(
+        function_base const& other, vtable const* /* empty_vtable */)
+    {
+        if (vptr == other.vptr)
+        {
+            if (this != &other && object)
+            {
+                HPX_ASSERT(other.object != nullptr);
+                // reuse object storage
+                object = vptr->copy(
+                    object, std::size_t(-1), other.object, /*destroy*/ true);
+            }
+        }
+        else
+        {
+            destroy();
+            vptr = other.vptr;
+            if (other.object != nullptr)
+            {
+                object = vptr->copy(
+                    storage, StorageSize, other.object, /*destroy*/ false);
+            }
+            else
+            {
+                object = nullptr;
+            }
+        }
+    }
+
+    template <std::size_t StorageSize>
+    void function_base<StorageSize>::op_assign(
+        function_base&& other, vtable const* empty_vtable) noexcept
+    {
+        if (this != &other)
+        {
+            swap(other);
+            other.reset(empty_vtable);
+        }
+    }
+
+    template <std::size_t StorageSize>
+    void function_base<StorageSize>::destroy() noexcept
+    {
+        if (object != nullptr)
+        {
+            vptr->deallocate(object, StorageSize, /*destroy*/ true);
+        }
+    }
+
+    template <std::size_t StorageSize>
+    void function_base<StorageSize>::reset(vtable const* empty_vptr) noexcept
+    {
+        destroy();
+        vptr = empty_vptr;
+        object = nullptr;
+    }
+
+    template <std::size_t StorageSize>
+    void function_base<StorageSize>::swap(function_base& f) noexcept
+    {
+        std::swap(vptr, f.vptr);
+        std::swap(object, f.object);
+        std::swap(storage, f.storage);
+        if (object == &f.storage)
+            object = &storage;
+        if (f.object == &storage)
+            f.object = &f.storage;
+    }
+
+    template <std::size_t StorageSize>
+    std::size_t function_base<StorageSize>::get_function_address() const
+    {
+#if defined(HPX_HAVE_THREAD_DESCRIPTION)
+        return vptr->get_function_address(object);
+#else
+        return 0;
+#endif
+    }
+
+    template <std::size_t StorageSize>
+    char const* function_base<StorageSize>::get_function_annotation() const
+    {
+#if defined(HPX_HAVE_THREAD_DESCRIPTION)
+        return vptr->get_function_annotation(object);
+#else
+        return nullptr;
+#endif
+    }
+
+    template <std::size_t StorageSize>
+    util::itt::string_handle
+    function_base<StorageSize>::get_function_annotation_itt() const
+    {
+#if HPX_HAVE_ITTNOTIFY != 0 && !defined(HPX_HAVE_APEX)
+        return vptr->get_function_annotation_itt(object);
+#else
+        return util::itt::string_handle{};
+#endif
+    }
+
+    // the function_base of the default and of the thread functions are
+    // instantiated in the core library
+    extern template class HPX_CORE_EXPORT
+        function_base<function_storage_size>;
+    extern template class HPX_CORE_EXPORT
+        function_base<thread_function_storage_size>;
+
     ///////////////////////////////////////////////////////////////////////////
     template <typename F>
     constexpr bool is_empty_function(F* fp) noexcept
@@ -91,7 +258,8 @@ namespace hpx { namespace util { namespace detail {
         return mp == nullptr;
     }
 
-    inline bool is_empty_function_impl(function_base const* f) noexcept
+    template <std::size_t StorageSize>
+    bool is_empty_function_impl(function_base<StorageSize> const* f) noexcept
     {
         return f->empty();
     }
@@ -108,14 +276,16 @@ namespace hpx { namespace util { namespace detail {
     }
 
     ///////////////////////////////////////////////////////////////////////////
-    template <typename Sig, bool Copyable, bool Serializable>
+    template <typename Sig, bool Copyable, bool Serializable,
+        std::size_t StorageSize = function_storage_size>
     class basic_function;
 
-    template <bool Copyable, typename R, typename... Ts>
-    class basic_function<R(Ts...), Copyable, /*Serializable*/ false>
-      : public function_base
+    template <bool Copyable, typename R, typename... Ts,
+        std::size_t StorageSize>
+    class basic_function<R(Ts...), Copyable, /*Serializable*/ false,
+        StorageSize> : public function_base<StorageSize>
     {
-        using base_type = function_base;
+        using base_type = function_base<StorageSize>;
         using vtable = function_vtable<R(Ts...), Copyable>;
 
     public:
@@ -172,10 +342,10 @@ namespace hpx { namespace util { namespace detail {
                 }
                 else
                 {
-                    destroy();
+                    base_type::destroy();
                     vptr = f_vptr;
-                    buffer = vtable::template allocate<T>(
-                        storage, function_storage_size);
+                    buffer =
+                        vtable::template allocate<T>(storage, StorageSize);
                 }
                 object = ::new (buffer) T(HPX_FORWARD(F, f));
             }
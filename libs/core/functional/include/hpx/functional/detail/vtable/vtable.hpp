@@ -9,11 +9,16 @@
 #pragma once
 
 #include <hpx/config.hpp>
+#include <hpx/allocator_support/internal_allocator.hpp>
 
 #include <cstddef>
 #include <type_traits>
 
 namespace hpx { namespace util { namespace detail {
+#if defined(HPX_HAVE_FUNCTION_ALLOCATION_COUNTER)
+    HPX_CORE_EXPORT void increment_function_allocation_count() noexcept;
+#endif
+
     ///////////////////////////////////////////////////////////////////////////
     template <typename T>
     struct construct_vtable
@@ -61,7 +66,13 @@ namespace hpx { namespace util { namespace detail {
 
             if (sizeof(T) > storage_size)
             {
-                return new storage_t;
+                // the objects which don't fit the embedded storage are
+                // allocated through the internal allocator
+#if defined(HPX_HAVE_FUNCTION_ALLOCATION_COUNTER)
+                increment_function_allocation_count();
+#endif
+                hpx::util::internal_allocator<storage_t> alloc;
+                return alloc.allocate(1);
             }
             return storage;
         }
@@ -80,7 +91,8 @@ namespace hpx { namespace util { namespace detail {
 
             if (sizeof(T) > storage_size)
             {
-                delete static_cast<storage_t*>(obj);
+                hpx::util::internal_allocator<storage_t> alloc;
+                alloc.deallocate(static_cast<storage_t*>(obj), 1);
             }
         }
         void (*deallocate)(void*, std::size_t storage_size, bool) noexcept;
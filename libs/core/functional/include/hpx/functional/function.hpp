@@ -22,15 +22,18 @@
 namespace hpx {
 
     ///////////////////////////////////////////////////////////////////////////
-    template <typename Sig, bool Serializable = false>
+    template <typename Sig, bool Serializable = false,
+        std::size_t StorageSize = util::detail::function_storage_size>
     class function;
 
-    template <typename R, typename... Ts, bool Serializable>
-    class function<R(Ts...), Serializable>
-      : public util::detail::basic_function<R(Ts...), true, Serializable>
+    template <typename R, typename... Ts, bool Serializable,
+        std::size_t StorageSize>
+    class function<R(Ts...), Serializable, StorageSize>
+      : public util::detail::basic_function<R(Ts...), true, Serializable,
+            StorageSize>
     {
-        using base_type =
-            util::detail::basic_function<R(Ts...), true, Serializable>;
+        using base_type = util::detail::basic_function<R(Ts...), true,
+            Serializable, StorageSize>;
 
     public:
         using result_type = R;
@@ -95,32 +98,35 @@ namespace hpx::util {
 ///////////////////////////////////////////////////////////////////////////////
 namespace hpx { namespace traits {
 
-    template <typename Sig, bool Serializable>
-    struct get_function_address<hpx::function<Sig, Serializable>>
+    template <typename Sig, bool Serializable, std::size_t StorageSize>
+    struct get_function_address<
+        hpx::function<Sig, Serializable, StorageSize>>
     {
         static constexpr std::size_t call(
-            hpx::function<Sig, Serializable> const& f) noexcept
+            hpx::function<Sig, Serializable, StorageSize> const& f) noexcept
         {
             return f.get_function_address();
         }
     };
 
-    template <typename Sig, bool Serializable>
-    struct get_function_annotation<hpx::function<Sig, Serializable>>
+    template <typename Sig, bool Serializable, std::size_t StorageSize>
+    struct get_function_annotation<
+        hpx::function<Sig, Serializable, StorageSize>>
     {
         static constexpr char const* call(
-            hpx::function<Sig, Serializable> const& f) noexcept
+            hpx::function<Sig, Serializable, StorageSize> const& f) noexcept
         {
             return f.get_function_annotation();
         }
     };
 
 #if HPX_HAVE_ITTNOTIFY != 0 && !defined(HPX_HAVE_APEX)
-    template <typename Sig, bool Serializable>
-    struct get_function_annotation_itt<hpx::function<Sig, Serializable>>
+    template <typename Sig, bool Serializable, std::size_t StorageSize>
+    struct get_function_annotation_itt<
+        hpx::function<Sig, Serializable, StorageSize>>
     {
         static util::itt::string_handle call(
-            hpx::function<Sig, Serializable> const& f) noexcept
+            hpx::function<Sig, Serializable, StorageSize> const& f) noexcept
         {
             return f.get_function_annotation_itt();
         }
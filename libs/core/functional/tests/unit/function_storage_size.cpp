@@ -0,0 +1,115 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/functional/function.hpp>
+#include <hpx/functional/move_only_function.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+constexpr std::size_t storage_size = 8 * sizeof(void*);
+
+// doesn't fit the default storage but fits the larger one
+struct medium_object
+{
+    std::uint64_t values[5];
+
+    std::uint64_t operator()(std::uint64_t z) const
+    {
+        std::uint64_t result = z;
+        for (std::uint64_t v : values)
+        {
+            result += v;
+        }
+        return result;
+    }
+};
+
+static_assert(sizeof(medium_object) > hpx::util::detail::function_storage_size);
+static_assert(sizeof(medium_object) <= storage_size);
+
+#if defined(HPX_HAVE_FUNCTION_ALLOCATION_COUNTER)
+using hpx::util::detail::get_function_allocation_count;
+#endif
+
+template <typename F>
+void test_function()
+{
+#if defined(HPX_HAVE_FUNCTION_ALLOCATION_COUNTER)
+    std::uint64_t const count = get_function_allocation_count();
+#endif
+
+    F f0 = medium_object{{1, 2, 3, 4, 5}};
+    HPX_TEST(!f0.empty());
+    HPX_TEST_EQ(f0(0), std::uint64_t(15));
+
+    // moving a function which uses the embedded storage
+    F f1 = std::move(f0);
+    HPX_TEST(f0.empty());
+    HPX_TEST_EQ(f1(1), std::uint64_t(16));
+    HPX_TEST(f1.template target<medium_object>() != nullptr);
+
+    F f2 = medium_object{{10, 20, 30, 40, 50}};
+    f1.swap(f2);
+    HPX_TEST_EQ(f1(0), std::uint64_t(150));
+    HPX_TEST_EQ(f2(0), std::uint64_t(15));
+
+    f2 = std::move(f1);
+    HPX_TEST(f1.empty());
+    HPX_TEST_EQ(f2(0), std::uint64_t(150));
+
+    f2.reset();
+    HPX_TEST(f2.empty());
+
+#if defined(HPX_HAVE_FUNCTION_ALLOCATION_COUNTER)
+    HPX_TEST_EQ(get_function_allocation_count(), count);
+#endif
+}
+
+void test_copyable_function()
+{
+    using function_type =
+        hpx::function<std::uint64_t(std::uint64_t), false, storage_size>;
+
+    test_function<function_type>();
+
+    function_type f0 = medium_object{{1, 2, 3, 4, 5}};
+    function_type f1(f0);
+    function_type f2;
+    f2 = f1;
+
+    HPX_TEST_EQ(f0(0), std::uint64_t(15));
+    HPX_TEST_EQ(f1(1), std::uint64_t(16));
+    HPX_TEST_EQ(f2(2), std::uint64_t(17));
+}
+
+void test_default_storage()
+{
+#if defined(HPX_HAVE_FUNCTION_ALLOCATION_COUNTER)
+    std::uint64_t const count = get_function_allocation_count();
+#endif
+
+    hpx::move_only_function<std::uint64_t(std::uint64_t)> f =
+        medium_object{{1, 2, 3, 4, 5}};
+    HPX_TEST_EQ(f(0), std::uint64_t(15));
+
+#if defined(HPX_HAVE_FUNCTION_ALLOCATION_COUNTER)
+    HPX_TEST_EQ(get_function_allocation_count(), count + 1);
+#endif
+}
+
+int main()
+{
+    test_function<
+        hpx::move_only_function<std::uint64_t(std::uint64_t), false,
+            storage_size>>();
+    test_copyable_function();
+    test_default_storage();
+
+    return hpx::util::report_errors();
+}
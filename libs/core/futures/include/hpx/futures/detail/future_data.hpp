@@ -23,6 +23,7 @@
 #include <hpx/thread_support/assert_owns_lock.hpp>
 #include <hpx/thread_support/atomic_count.hpp>
 #include <hpx/threading_base/annotated_function.hpp>
+#include <hpx/threading_base/set_thread_state_timed.hpp>
 #include <hpx/threading_base/thread_helpers.hpp>
 #include <hpx/type_support/unused.hpp>
 
@@ -682,6 +683,13 @@ namespace hpx { namespace lcos { namespace detail {
         ~future_data() noexcept override = default;
     };
 
+    ///////////////////////////////////////////////////////////////////////////
+    // Return a ready shared state holding no value. It is shared by all
+    // futures created by make_ready_future() on the calling (OS-)thread, which
+    // avoids allocating a separate shared state for each of those.
+    HPX_CORE_EXPORT hpx::intrusive_ptr<future_data<void>>
+    get_ready_shared_state();
+
     ///////////////////////////////////////////////////////////////////////////
     template <typename Result, typename Allocator, typename Derived = void>
     struct future_data_allocator : future_data<Result>
@@ -781,10 +789,11 @@ namespace hpx { namespace lcos { namespace detail {
             }
 
             // start new thread at given point in time
-            threads::set_thread_state(id.noref(), abs_time,
-                threads::thread_schedule_state::pending,
+            threads::detail::set_thread_state_at(
+                threads::get_thread_id_data(id)->get_scheduler_base(), abs_time,
+                id.noref(), threads::thread_schedule_state::pending,
                 threads::thread_restart_state::timeout,
-                threads::thread_priority::boost, true, ec);
+                threads::thread_priority::boost, ec);
             if (ec)
             {
                 // thread scheduling failed, report error to the new future
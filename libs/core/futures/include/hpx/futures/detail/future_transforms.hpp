@@ -6,16 +6,23 @@
 
 #pragma once
 
+#include <hpx/allocator_support/allocator_deleter.hpp>
+#include <hpx/allocator_support/internal_allocator.hpp>
+#include <hpx/datastructures/tuple.hpp>
 #include <hpx/functional/deferred_call.hpp>
 #include <hpx/futures/traits/acquire_future.hpp>
 #include <hpx/futures/traits/acquire_shared_state.hpp>
 #include <hpx/futures/traits/detail/future_traits.hpp>
 #include <hpx/futures/traits/is_future.hpp>
+#include <hpx/modules/memory.hpp>
+#include <hpx/type_support/pack.hpp>
 #include <hpx/util/detail/reserve.hpp>
 
 #include <algorithm>
+#include <atomic>
 #include <cstddef>
 #include <iterator>
+#include <memory>
 #include <type_traits>
 #include <utility>
 #include <vector>
@@ -63,6 +70,99 @@ namespace hpx { namespace lcos { namespace detail {
         state->set_on_completed(util::deferred_call(HPX_FORWARD(N, next)));
     }
 
+    ///////////////////////////////////////////////////////////////////////////
+    // Counts the inputs of a combinator which didn't become ready yet. The
+    // count starts at one, held by the thread attaching the continuations,
+    // which makes sure the combinator is not completed before all of them
+    // were attached.
+    class arrival_counter
+    {
+    public:
+        constexpr arrival_counter() noexcept
+          : count_(1)
+        {
+        }
+
+        void add() noexcept
+        {
+            count_.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        // Returns true for the last arrival
+        bool arrive() noexcept
+        {
+            return count_.fetch_sub(1, std::memory_order_acq_rel) == 1;
+        }
+
+    private:
+        std::atomic<std::size_t> count_;
+    };
+
+    // Arguments which can be handled by counting the arrivals of the
+    // futures: futures and values which are not traversed any further.
+    template <typename T>
+    inline constexpr bool is_arrival_countable_v =
+        traits::is_future_v<T> || std::is_scalar_v<T>;
+
+    // Make the frame's on_arrival() being invoked once the given future
+    // becomes ready, if it isn't ready already.
+    template <typename Frame, typename T>
+    void attach_arrival_callback(
+        Frame* frame, arrival_counter& arrivals, T& current)
+    {
+        if constexpr (traits::is_future_v<T>)
+        {
+            if (!async_visit_future(current))
+            {
+                arrivals.add();
+                async_detach_future(current,
+                    [this_ = hpx::intrusive_ptr<Frame>(frame)]() {
+                        this_->on_arrival();
+                    });
+            }
+        }
+    }
+
+    // Attach the continuations to the futures of the given tuple, the
+    // frame's on_arrival() has to be invoked once more afterwards to release
+    // the count held while attaching.
+    template <typename Frame, typename... Ts, std::size_t... Is>
+    void attach_arrival_callbacks(Frame* frame, arrival_counter& arrivals,
+        hpx::tuple<Ts...>& futures, hpx::util::index_pack<Is...>)
+    {
+        (attach_arrival_callback(frame, arrivals, hpx::get<Is>(futures)), ...);
+    }
+
+    template <typename Frame, typename... Ts>
+    void attach_arrival_callbacks(
+        Frame* frame, arrival_counter& arrivals, hpx::tuple<Ts...>& futures)
+    {
+        attach_arrival_callbacks(frame, arrivals, futures,
+            hpx::util::make_index_pack_t<sizeof...(Ts)>());
+    }
+
+    // Allocate a shared state derived from future_data_allocator using the
+    // internal allocator, the reference count is 'one' already.
+    template <typename Frame, typename... Ts>
+    hpx::intrusive_ptr<Frame> allocate_frame(Ts&&... ts)
+    {
+        using other_allocator = typename Frame::other_allocator;
+        using traits = std::allocator_traits<other_allocator>;
+        using init_no_addref = typename Frame::init_no_addref;
+
+        using unique_ptr = std::unique_ptr<Frame,
+            util::allocator_deleter<other_allocator>>;
+
+        other_allocator alloc(hpx::util::internal_allocator<>{});
+        unique_ptr p(traits::allocate(alloc, 1),
+            util::allocator_deleter<other_allocator>{alloc});
+        traits::construct(
+            alloc, p.get(), init_no_addref{}, alloc, HPX_FORWARD(Ts, ts)...);
+
+        return hpx::intrusive_ptr<Frame>(p.release(), false);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
     // Acquire a future range from the given begin and end iterator
     template <typename Iterator,
         typename Container = std::vector<future_iterator_traits_t<Iterator>>>
@@ -9,7 +9,7 @@
 
 #include <hpx/config.hpp>
 #include <hpx/allocator_support/allocator_deleter.hpp>
-#include <hpx/allocator_support/internal_allocator.hpp>
+#include <hpx/allocator_support/thread_local_caching_allocator.hpp>
 #include <hpx/assert.hpp>
 #include <hpx/async_base/launch_policy.hpp>
 #include <hpx/concepts/concepts.hpp>
@@ -1494,7 +1494,8 @@ namespace hpx {
     make_ready_future(Ts&&... ts)
     {
         return make_ready_future_alloc<T>(
-            hpx::util::internal_allocator<>{}, HPX_FORWARD(Ts, ts)...);
+            hpx::util::thread_local_caching_allocator<>{},
+            HPX_FORWARD(Ts, ts)...);
     }
     ///////////////////////////////////////////////////////////////////////////
     // extension: create a pre-initialized future object, with allocator
@@ -1512,7 +1513,8 @@ namespace hpx {
         T&& init)
     {
         return hpx::make_ready_future_alloc<hpx::util::decay_unwrap_t<T>>(
-            hpx::util::internal_allocator<>{}, HPX_FORWARD(T, init));
+            hpx::util::thread_local_caching_allocator<>{},
+            HPX_FORWARD(T, init));
     }
 
     ///////////////////////////////////////////////////////////////////////////
@@ -1581,8 +1583,9 @@ namespace hpx {
     // extension: create a pre-initialized future object
     HPX_FORCEINLINE future<void> make_ready_future()
     {
-        return make_ready_future_alloc<void>(
-            hpx::util::internal_allocator<>{}, util::unused);
+        // all ready futures without a value can refer to the same shared state
+        return hpx::traits::future_access<future<void>>::create(
+            lcos::detail::get_ready_shared_state());
     }
 
     // Extension (see wg21.link/P0319)
@@ -1697,7 +1700,8 @@ namespace hpx { namespace lcos {
         hpx::future<T>> make_ready_future(Ts&&... ts)
     {
         return hpx::make_ready_future_alloc<T>(
-            hpx::util::internal_allocator<>{}, HPX_FORWARD(Ts, ts)...);
+            hpx::util::thread_local_caching_allocator<>{},
+            HPX_FORWARD(Ts, ts)...);
     }
 
     template <int DeductionGuard = 0, typename Allocator, typename T>
@@ -1718,7 +1722,8 @@ namespace hpx { namespace lcos {
     hpx::future<hpx::util::decay_unwrap_t<T>> make_ready_future(T&& init)
     {
         return hpx::make_ready_future_alloc<hpx::util::decay_unwrap_t<T>>(
-            hpx::util::internal_allocator<>{}, HPX_FORWARD(T, init));
+            hpx::util::thread_local_caching_allocator<>{},
+            HPX_FORWARD(T, init));
     }
 
     template <typename T>
@@ -1774,8 +1779,7 @@ namespace hpx { namespace lcos {
         "hpx::make_ready_future instead.")
     inline hpx::future<void> make_ready_future()
     {
-        return hpx::make_ready_future_alloc<void>(
-            hpx::util::internal_allocator<>{}, util::unused);
+        return hpx::make_ready_future();
     }
 
     template <typename T>
@@ -9,7 +9,7 @@
 
 #include <hpx/config.hpp>
 #include <hpx/allocator_support/allocator_deleter.hpp>
-#include <hpx/allocator_support/internal_allocator.hpp>
+#include <hpx/allocator_support/thread_local_caching_allocator.hpp>
 #include <hpx/async_base/launch_policy.hpp>
 #include <hpx/errors/try_catch_exception_ptr.hpp>
 #include <hpx/futures/detail/future_data.hpp>
@@ -762,7 +762,8 @@ namespace hpx { namespace lcos { namespace detail {
     unwrap_impl(Future&& future, error_code& ec)
     {
         return unwrap_impl_alloc(
-            util::internal_allocator<>{}, HPX_FORWARD(Future, future), ec);
+            util::thread_local_caching_allocator<>{},
+            HPX_FORWARD(Future, future), ec);
     }
 
     template <typename Allocator, typename Future>
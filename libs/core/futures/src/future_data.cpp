@@ -36,22 +36,6 @@ namespace hpx { namespace lcos { namespace detail {
 
     future_data_refcnt_base::~future_data_refcnt_base() = default;
 
-    ///////////////////////////////////////////////////////////////////////////
-    struct handle_continuation_recursion_count
-    {
-        handle_continuation_recursion_count() noexcept
-          : count_(threads::get_continuation_recursion_count())
-        {
-            ++count_;
-        }
-        ~handle_continuation_recursion_count()
-        {
-            --count_;
-        }
-
-        std::size_t& count_;
-    };
-
     ///////////////////////////////////////////////////////////////////////////
     template <typename Callback>
     static void run_on_completed_on_new_thread(Callback&& f)
@@ -193,17 +177,10 @@ namespace hpx { namespace lcos { namespace detail {
         Callback&& on_completed)
     {
         // We need to run the completion on a new thread if we are on a
-        // non HPX thread.
-#if defined(HPX_HAVE_THREADS_GET_STACK_POINTER)
-        bool recurse_asynchronously =
-            !this_thread::has_sufficient_stack_space();
-#else
-        handle_continuation_recursion_count cnt;
-        bool recurse_asynchronously =
-            cnt.count_ > HPX_CONTINUATION_MAX_RECURSION_DEPTH ||
-            (hpx::threads::get_self_ptr() == nullptr);
-#endif
-        if (!recurse_asynchronously)
+        // non HPX thread, or if the continuations already run inline on this
+        // thread are nested too deeply.
+        threads::detail::continuation_recursion_scope cnt;
+        if (cnt.can_run_inline())
         {
             // directly execute continuation on this thread
             run_on_completed(HPX_FORWARD(Callback, on_completed));
@@ -335,4 +312,30 @@ namespace hpx { namespace lcos { namespace detail {
         }
         return hpx::future_status::ready;    //-V110
     }
+
+    ///////////////////////////////////////////////////////////////////////////
+    namespace {
+
+        struct ready_shared_state
+        {
+            // the initial reference is owned by this object, the shared state
+            // is released once the thread has exited and all futures
+            // referring to it have gone out of scope
+            ready_shared_state()
+              : state_(new future_data<void>(
+                           future_data<void>::init_no_addref{}, in_place{},
+                           util::unused),
+                    false)
+            {
+            }
+
+            hpx::intrusive_ptr<future_data<void>> state_;
+        };
+    }    // namespace
+
+    hpx::intrusive_ptr<future_data<void>> get_ready_shared_state()
+    {
+        thread_local ready_shared_state ready_state;
+        return ready_state.state_;
+    }
 }}}    // namespace hpx::lcos::detail
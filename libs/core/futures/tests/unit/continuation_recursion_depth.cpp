@@ -0,0 +1,60 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This test verifies that continuations are run inline only up to the
+// configured nesting depth (hpx.continuation_max_recursion_depth), any deeper
+// continuation is run on a new thread.
+
+#include <hpx/local/future.hpp>
+#include <hpx/local/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/modules/threading_base.hpp>
+
+#include <cstddef>
+#include <string>
+#include <utility>
+
+std::size_t const max_recursion_depth = 4;
+std::size_t const num_continuations = 100;
+std::size_t max_observed_depth = 0;
+
+int hpx_main()
+{
+    hpx::promise<std::size_t> p;
+    hpx::future<std::size_t> f = p.get_future();
+
+    // all continuations are attached before the chain is started
+    for (std::size_t i = 0; i != num_continuations; ++i)
+    {
+        f = f.then(hpx::launch::sync, [](hpx::future<std::size_t>&& fut) {
+            std::size_t const depth =
+                hpx::threads::get_continuation_recursion_count();
+            if (depth > max_observed_depth)
+            {
+                max_observed_depth = depth;
+            }
+            return fut.get() + 1;
+        });
+    }
+
+    p.set_value(0);
+
+    HPX_TEST_EQ(f.get(), num_continuations);
+    HPX_TEST_LTE(max_observed_depth, max_recursion_depth);
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    hpx::local::init_params init_args;
+    init_args.cfg = {"hpx.continuation_max_recursion_depth=" +
+        std::to_string(max_recursion_depth)};
+
+    HPX_TEST_EQ(hpx::local::init(hpx_main, argc, argv, init_args), 0);
+
+    return hpx::util::report_errors();
+}
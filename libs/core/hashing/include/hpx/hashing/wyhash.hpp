@@ -0,0 +1,263 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// This code is based on wyhash (final version 4) by Wang Yi, released into
+// the public domain: https://github.com/wangyi-fudan/wyhash
+
+/// \file wyhash.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/config/endian.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+#include <type_traits>
+
+#if defined(_MSC_VER) && defined(_M_X64) && !defined(__clang__)
+#include <intrin.h>
+#pragma intrinsic(_umul128)
+#endif
+
+namespace hpx { namespace util {
+
+    namespace detail {
+
+        // the default secret of wyhash
+        inline constexpr std::uint64_t wyhash_secret[4] = {
+            0x2d358dccaa6c78a5ull, 0x8bb84b93962eacc9ull,
+            0x4b33a62ed433d4a3ull, 0x4d5a2da51de1aa47ull};
+
+        // multiply a and b, return the low 64 bits of the product in a and
+        // the high 64 bits in b
+        HPX_FORCEINLINE constexpr void wymum(
+            std::uint64_t& a, std::uint64_t& b) noexcept
+        {
+#if defined(__SIZEOF_INT128__)
+            unsigned __int128 r = a;
+            r *= b;
+            a = static_cast<std::uint64_t>(r);
+            b = static_cast<std::uint64_t>(r >> 64);
+#elif defined(_MSC_VER) && defined(_M_X64) && !defined(__clang__)
+            a = _umul128(a, b, &b);
+#else
+            std::uint64_t const ha = a >> 32, hb = b >> 32;
+            std::uint64_t const la = static_cast<std::uint32_t>(a);
+            std::uint64_t const lb = static_cast<std::uint32_t>(b);
+            std::uint64_t const rh = ha * hb, rm0 = ha * lb, rm1 = hb * la,
+                                rl = la * lb;
+            std::uint64_t const t = rl + (rm0 << 32);
+            std::uint64_t const lo = t + (rm1 << 32);
+            std::uint64_t const c = (t < rl) + (lo < t);
+            b = rh + (rm0 >> 32) + (rm1 >> 32) + c;
+            a = lo;
+#endif
+        }
+
+        HPX_FORCEINLINE constexpr std::uint64_t wymix(
+            std::uint64_t a, std::uint64_t b) noexcept
+        {
+            wymum(a, b);
+            return a ^ b;
+        }
+
+        // read unaligned little endian values, the result of the hash must
+        // not depend on the platform
+        HPX_FORCEINLINE std::uint64_t wyr8(unsigned char const* p) noexcept
+        {
+            std::uint64_t v;
+            std::memcpy(&v, p, sizeof(v));
+            if constexpr (hpx::endian::native == hpx::endian::big)
+            {
+                v = ((v >> 56) & 0xffull) | ((v >> 40) & 0xff00ull) |
+                    ((v >> 24) & 0xff0000ull) | ((v >> 8) & 0xff000000ull) |
+                    ((v << 8) & 0xff00000000ull) |
+                    ((v << 24) & 0xff0000000000ull) |
+                    ((v << 40) & 0xff000000000000ull) | (v << 56);
+            }
+            return v;
+        }
+
+        HPX_FORCEINLINE std::uint64_t wyr4(unsigned char const* p) noexcept
+        {
+            std::uint32_t v;
+            std::memcpy(&v, p, sizeof(v));
+            if constexpr (hpx::endian::native == hpx::endian::big)
+            {
+                v = (v >> 24) | ((v >> 8) & 0xff00u) | ((v << 8) & 0xff0000u) |
+                    (v << 24);
+            }
+            return v;
+        }
+
+        // read 1 to 3 bytes
+        HPX_FORCEINLINE std::uint64_t wyr3(
+            unsigned char const* p, std::size_t k) noexcept
+        {
+            return (static_cast<std::uint64_t>(p[0]) << 16) |
+                (static_cast<std::uint64_t>(p[k >> 1]) << 8) | p[k - 1];
+        }
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Calculate a 64 bit hash of \a size bytes starting at \a data.
+    ///
+    /// The hash passes the SMHasher test suite and is considerably faster
+    /// than \a jenkins_hash, long inputs are processed in three independent
+    /// lanes of 16 bytes each. Its value depends only on the bytes and the
+    /// seed, not on the platform (endianness, word size, or compiler), so it
+    /// can be used for values exchanged between localities or stored (e.g.
+    /// for partitioning or content hashing). It is not a cryptographic hash.
+    ///
+    /// \param data     The bytes to hash.
+    /// \param size     The number of bytes to hash.
+    /// \param seed     Different seeds give independent hash functions.
+    inline std::uint64_t wyhash(
+        void const* data, std::size_t size, std::uint64_t seed = 0) noexcept
+    {
+        using detail::wyhash_secret;
+        using detail::wymix;
+        using detail::wyr3;
+        using detail::wyr4;
+        using detail::wyr8;
+
+        unsigned char const* p = static_cast<unsigned char const*>(data);
+        seed ^= wymix(seed ^ wyhash_secret[0], wyhash_secret[1]);
+
+        std::uint64_t a, b;
+        if (HPX_LIKELY(size <= 16))
+        {
+            if (HPX_LIKELY(size >= 4))
+            {
+                std::size_t const offset = (size >> 3) << 2;
+                a = (wyr4(p) << 32) | wyr4(p + offset);
+                b = (wyr4(p + size - 4) << 32) | wyr4(p + size - 4 - offset);
+            }
+            else if (HPX_LIKELY(size > 0))
+            {
+                a = wyr3(p, size);
+                b = 0;
+            }
+            else
+            {
+                a = b = 0;
+            }
+        }
+        else
+        {
+            std::size_t i = size;
+            if (HPX_UNLIKELY(i >= 48))
+            {
+                std::uint64_t see1 = seed, see2 = seed;
+                do
+                {
+                    seed =
+                        wymix(wyr8(p) ^ wyhash_secret[1], wyr8(p + 8) ^ seed);
+                    see1 = wymix(
+                        wyr8(p + 16) ^ wyhash_secret[2], wyr8(p + 24) ^ see1);
+                    see2 = wymix(
+                        wyr8(p + 32) ^ wyhash_secret[3], wyr8(p + 40) ^ see2);
+                    p += 48;
+                    i -= 48;
+                } while (HPX_LIKELY(i >= 48));
+                seed ^= see1 ^ see2;
+            }
+            while (HPX_UNLIKELY(i > 16))
+            {
+                seed = wymix(wyr8(p) ^ wyhash_secret[1], wyr8(p + 8) ^ seed);
+                i -= 16;
+                p += 16;
+            }
+            a = wyr8(p + i - 16);
+            b = wyr8(p + i - 8);
+        }
+
+        a ^= wyhash_secret[1];
+        b ^= seed;
+        detail::wymum(a, b);
+        return wymix(a ^ wyhash_secret[0] ^ size, b ^ wyhash_secret[1]);
+    }
+
+    /// Calculate a 64 bit hash of the given integer. This is considerably
+    /// cheaper than hashing its bytes using \a wyhash, the result differs
+    /// from the result of hashing the bytes.
+    ///
+    /// \param value    The value to hash.
+    /// \param seed     Different seeds give independent hash functions.
+    constexpr std::uint64_t wyhash64(
+        std::uint64_t value, std::uint64_t seed = 0) noexcept
+    {
+        using detail::wyhash_secret;
+
+        std::uint64_t a = value ^ wyhash_secret[0];
+        std::uint64_t b = seed ^ wyhash_secret[1];
+        detail::wymum(a, b);
+        return detail::wymix(a ^ wyhash_secret[0], b ^ wyhash_secret[1]);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// A seedable replacement for std::hash<Key> based on \a wyhash for use
+    /// with hash tables. Integral values, enumerations, and pointers are
+    /// hashed using \a wyhash64, strings and other types which are uniquely
+    /// represented by their bytes are hashed using \a wyhash.
+    ///
+    /// Note that pointers and the values of types which have the same bytes
+    /// on all platforms hash to the same value everywhere.
+    template <typename Key>
+    struct seeded_hash
+    {
+        constexpr seeded_hash() noexcept = default;
+
+        constexpr explicit seeded_hash(std::uint64_t seed) noexcept
+          : seed_(seed)
+        {
+        }
+
+        std::size_t operator()(Key const& key) const noexcept
+        {
+            if constexpr (std::is_integral_v<Key> || std::is_enum_v<Key> ||
+                std::is_pointer_v<Key>)
+            {
+                std::uint64_t value = 0;
+                if constexpr (std::is_pointer_v<Key>)
+                {
+                    value = reinterpret_cast<std::uintptr_t>(key);
+                }
+                else
+                {
+                    value = static_cast<std::uint64_t>(key);
+                }
+                return static_cast<std::size_t>(wyhash64(value, seed_));
+            }
+            else if constexpr (std::is_convertible_v<Key const&,
+                                   std::string_view>)
+            {
+                std::string_view const s = key;
+                return static_cast<std::size_t>(
+                    wyhash(s.data(), s.size(), seed_));
+            }
+            else
+            {
+                static_assert(std::has_unique_object_representations_v<Key>,
+                    "seeded_hash can't hash the bytes of types with padding, "
+                    "use a custom hash function instead");
+                return static_cast<std::size_t>(
+                    wyhash(&key, sizeof(Key), seed_));
+            }
+        }
+
+        constexpr std::uint64_t seed() const noexcept
+        {
+            return seed_;
+        }
+
+    private:
+        std::uint64_t seed_ = 0;
+    };
+}}    // namespace hpx::util
@@ -0,0 +1,154 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/hashing/wyhash.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// The values of the hash must be the same everywhere, they are compared to
+// the test vectors of the reference implementation (which uses the index of
+// the message as the seed).
+void test_reference_values()
+{
+    using hpx::util::wyhash;
+
+    char const* const messages[] = {"", "a", "abc", "message digest",
+        "abcdefghijklmnopqrstuvwxyz",
+        "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789",
+        "123456789012345678901234567890123456789012345678901234567890123456789"
+        "01234567890"};
+    std::uint64_t const expected[] = {0x93228a4de0eec5a2ull,
+        0xc5bac3db178713c4ull, 0xa97f2f7b1d9b3314ull, 0x786d1f1df3801df4ull,
+        0xdca5a8138ad37c87ull, 0xb9e734f117cfaf70ull, 0x6cc5eab49a92d617ull};
+
+    for (std::size_t i = 0; i != std::size(messages); ++i)
+    {
+        HPX_TEST_EQ(wyhash(messages[i], std::strlen(messages[i]), i),
+            expected[i]);
+    }
+}
+
+void test_wyhash64()
+{
+    using hpx::util::wyhash64;
+
+    HPX_TEST_EQ(wyhash64(0), 0xfa303abc2b1d7630ull);
+    HPX_TEST_EQ(wyhash64(0xdeadbeef, 7), 0x2f0fdbe0fa8eafb8ull);
+    HPX_TEST_NEQ(wyhash64(1), wyhash64(2));
+    HPX_TEST_NEQ(wyhash64(1, 0), wyhash64(1, 1));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// All lengths (covering all code paths) hash independently of the alignment
+// of the data, and each byte and the seed affect the result.
+void test_lengths()
+{
+    using hpx::util::wyhash;
+
+    constexpr std::size_t max_size = 200;
+
+    std::vector<unsigned char> data(max_size + 8);
+    for (std::size_t i = 0; i != data.size(); ++i)
+    {
+        data[i] = static_cast<unsigned char>(i * 7 + 1);
+    }
+
+    std::unordered_set<std::uint64_t> hashes;
+    for (std::size_t size = 0; size <= max_size; ++size)
+    {
+        std::uint64_t const h = wyhash(data.data(), size);
+        hashes.insert(h);
+
+        for (std::size_t offset = 1; offset != 8; ++offset)
+        {
+            std::vector<unsigned char> copy(size + offset);
+            std::memcpy(copy.data() + offset, data.data(), size);
+            HPX_TEST_EQ(wyhash(copy.data() + offset, size), h);
+        }
+
+        if (size != 0)
+        {
+            HPX_TEST_NEQ(wyhash(data.data(), size, 1), h);
+
+            for (std::size_t i = 0; i != size; ++i)
+            {
+                data[i] ^= 0x10;
+                HPX_TEST_NEQ(wyhash(data.data(), size), h);
+                data[i] ^= 0x10;
+            }
+        }
+    }
+
+    // no collisions between the different lengths
+    HPX_TEST_EQ(hashes.size(), max_size + 1);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+enum class color
+{
+    red,
+    green
+};
+
+struct point
+{
+    std::int32_t x;
+    std::int32_t y;
+};
+
+void test_seeded_hash()
+{
+    using hpx::util::seeded_hash;
+    using hpx::util::wyhash;
+    using hpx::util::wyhash64;
+
+    HPX_TEST_EQ(seeded_hash<int>()(42), std::size_t(wyhash64(42)));
+    HPX_TEST_EQ(seeded_hash<int>(3)(42), std::size_t(wyhash64(42, 3)));
+    HPX_TEST_EQ(seeded_hash<int>(3).seed(), std::uint64_t(3));
+    HPX_TEST_EQ(seeded_hash<color>()(color::green), std::size_t(wyhash64(1)));
+
+    std::string const s("message digest");
+    std::size_t const expected = std::size_t(0x786d1f1df3801df4ull);
+    HPX_TEST_EQ(seeded_hash<std::string>(3)(s), expected);
+    HPX_TEST_EQ(seeded_hash<std::string_view>(3)(s), expected);
+
+    point const p = {1, 2};
+    HPX_TEST_EQ(seeded_hash<point>()(p), std::size_t(wyhash(&p, sizeof(p))));
+
+    // use in a hash table
+    std::unordered_map<std::string, int, seeded_hash<std::string>> m(
+        16, seeded_hash<std::string>(42));
+    for (int i = 0; i != 1000; ++i)
+    {
+        m[std::to_string(i)] = i;
+    }
+    HPX_TEST_EQ(m.size(), std::size_t(1000));
+    for (int i = 0; i != 1000; ++i)
+    {
+        HPX_TEST_EQ(m[std::to_string(i)], i);
+    }
+}
+
+int main()
+{
+    test_reference_values();
+    test_wyhash64();
+    test_lengths();
+    test_seeded_hash();
+
+    return hpx::util::report_errors();
+}
@@ -13,6 +13,7 @@
 #include <hpx/runtime_local/get_locality_id.hpp>
 #include <hpx/runtime_local/get_worker_thread_num.hpp>
 #include <hpx/threading_base/thread_data.hpp>
+#include <hpx/util/from_string.hpp>
 
 #include <cstddef>
 #include <cstdint>
@@ -914,6 +915,57 @@ namespace hpx { namespace util {
                 lvl, HPX_MOVE(settings.dest_), HPX_MOVE(settings.format_));
         }
 
+        ///////////////////////////////////////////////////////////////////////
+        // enable asynchronous writing and rate limiting, the values given in
+        // [hpx.logging] apply to all sections not overriding them
+        void init_log_throttling(util::section const& ini, char const* sec,
+            logging::logger* logger)
+        {
+            std::string async = ini.get_entry("hpx.logging.async", "0");
+            std::string rate_limit =
+                ini.get_entry("hpx.logging.rate_limit", "0");
+
+            if (ini.has_section(sec))
+            {
+                util::section const* logini = ini.get_section(sec);
+                HPX_ASSERT(nullptr != logini);
+
+                async = logini->get_entry("async", async);
+                rate_limit = logini->get_entry("rate_limit", rate_limit);
+            }
+
+            logger->set_rate_limit(
+                hpx::util::from_string<std::size_t>(rate_limit, 0));
+            logger->set_async(hpx::util::from_string<int>(async, 0) != 0);
+        }
+
+        void init_log_throttling(util::section const& ini)
+        {
+            init_log_throttling(ini, "hpx.logging.agas", agas_logger());
+            init_log_throttling(ini, "hpx.logging.parcel", parcel_logger());
+            init_log_throttling(ini, "hpx.logging.timing", timing_logger());
+            init_log_throttling(ini, "hpx.logging", hpx_logger());
+            init_log_throttling(
+                ini, "hpx.logging.application", app_logger());
+            init_log_throttling(ini, "hpx.logging.debuglog", debuglog_logger());
+
+            init_log_throttling(
+                ini, "hpx.logging.console.agas", agas_console_logger());
+            init_log_throttling(
+                ini, "hpx.logging.console.parcel", parcel_console_logger());
+            init_log_throttling(
+                ini, "hpx.logging.console.timing", timing_console_logger());
+            init_log_throttling(
+                ini, "hpx.logging.console", hpx_console_logger());
+            init_log_throttling(ini, "hpx.logging.console.application",
+                app_console_logger());
+            init_log_throttling(ini, "hpx.logging.console.debuglog",
+                debuglog_console_logger());
+
+            // the error logs are written synchronously, their messages must
+            // not get lost if the application terminates
+        }
+
         ///////////////////////////////////////////////////////////////////////
         static void (*default_set_console_dest)(logger_writer_type&,
             char const*, logging::level,
@@ -951,6 +1003,8 @@ namespace hpx { namespace util {
             init_hpx_console_log(ini);
             init_app_console_log(ini);
             init_debuglog_console_log(ini);
+
+            init_log_throttling(ini);
         }
 
         void init_logging_local(runtime_configuration& ini)
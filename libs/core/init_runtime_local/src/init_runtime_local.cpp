@@ -10,6 +10,10 @@
 #include <hpx/assert.hpp>
 #include <hpx/command_line_handling_local/command_line_handling_local.hpp>
 #include <hpx/coroutines/detail/context_impl.hpp>
+#if defined(__linux) || defined(linux) || defined(__linux__) ||                \
+    defined(__FreeBSD__)
+#include <hpx/coroutines/detail/posix_stack_pool.hpp>
+#endif
 #include <hpx/execution/detail/execution_parameter_callbacks.hpp>
 #include <hpx/executors/exception_list.hpp>
 #include <hpx/functional/bind_front.hpp>
@@ -25,10 +29,12 @@
 #include <hpx/modules/schedulers.hpp>
 #include <hpx/modules/testing.hpp>
 #include <hpx/modules/timing.hpp>
+#include <hpx/parallel/algorithms/for_loop.hpp>
 #include <hpx/parallel/util/detail/handle_exception_termination_handler.hpp>
 #include <hpx/program_options/parsers.hpp>
 #include <hpx/program_options/variables_map.hpp>
 #include <hpx/resource_partitioner/partitioner.hpp>
+#include <hpx/runtime_configuration/startup_timings.hpp>
 #include <hpx/runtime_local/config_entry.hpp>
 #include <hpx/runtime_local/custom_exception_info.hpp>
 #include <hpx/runtime_local/debugging.hpp>
@@ -38,10 +44,12 @@
 #include <hpx/runtime_local/runtime_local.hpp>
 #include <hpx/runtime_local/shutdown_function.hpp>
 #include <hpx/runtime_local/startup_function.hpp>
+#include <hpx/serialization/detail/parallel_serialization.hpp>
 #include <hpx/string_util/classification.hpp>
 #include <hpx/string_util/split.hpp>
 #include <hpx/threading/thread.hpp>
 #include <hpx/threading_base/detail/get_default_timer_service.hpp>
+#include <hpx/threading_base/thread_helpers.hpp>
 #include <hpx/type_support/pack.hpp>
 #include <hpx/type_support/unused.hpp>
 #include <hpx/util/from_string.hpp>
@@ -50,6 +58,7 @@
 #include <cstdlib>
 #endif
 
+#include <chrono>
 #include <cmath>
 #include <cstddef>
 #include <exception>
@@ -236,6 +245,12 @@ namespace hpx {
     defined(__FreeBSD__)
                 threads::coroutines::detail::posix::use_guard_pages =
                     cmdline.rtcfg_.use_stack_guard_pages();
+                threads::coroutines::detail::posix::stack_pool_size =
+                    cmdline.rtcfg_.get_stack_pool_size();
+                threads::coroutines::detail::posix::stack_pool_high_water_mark =
+                    cmdline.rtcfg_.get_stack_pool_high_water_mark();
+                threads::coroutines::detail::posix::use_huge_page_stacks =
+                    cmdline.rtcfg_.use_huge_page_stacks();
 #endif
 #ifdef HPX_HAVE_VERIFY_LOCKS
                 if (cmdline.rtcfg_.enable_lock_detection())
@@ -259,6 +274,9 @@ namespace hpx {
                 util::detail::set_spinlock_deadlock_detection_limit(
                     cmdline.rtcfg_.get_spinlock_deadlock_detection_limit());
 #endif
+                threads::set_continuation_limits(
+                    cmdline.rtcfg_.get_continuation_max_recursion_depth(),
+                    cmdline.rtcfg_.get_continuation_stack_budget());
 #if defined(HPX_HAVE_LOGGING)
                 util::detail::init_logging_local(cmdline.rtcfg_);
 #else
@@ -400,6 +418,21 @@ namespace hpx {
                 hpx::parallel::execution::detail::set_get_os_thread_count(
                     []() { return hpx::get_os_thread_count(); });
 
+                hpx::serialization::detail::set_parallel_for_handler(
+                    [](std::size_t count,
+                        std::function<void(std::size_t)> const& f) {
+                        if (hpx::threads::get_self_ptr() == nullptr)
+                        {
+                            for (std::size_t i = 0; i != count; ++i)
+                            {
+                                f(i);
+                            }
+                            return;
+                        }
+                        hpx::experimental::for_loop(
+                            hpx::execution::par, std::size_t(0), count, f);
+                    });
+
 #if defined(HPX_NATIVE_MIC) || defined(__bgq__) || defined(__bgqion__)
                 unsetenv("LANG");
                 unsetenv("LC_CTYPE");
@@ -447,17 +480,28 @@ namespace hpx {
                         return result;
                     }
 
+                    hpx::util::reset_startup_timings();
+                    auto start_time = std::chrono::steady_clock::now();
+
                     hpx::local::detail::command_line_handling cmdline{
                         hpx::util::runtime_configuration(
                             argv[0], hpx::runtime_mode::local),
                         params.cfg, f};
 
+                    hpx::util::record_startup_timing("runtime configuration",
+                        std::chrono::steady_clock::now() - start_time);
+
                     // scope exception handling to resource partitioner initialization
                     // any exception thrown during run_or_start below are handled
                     // separately
                     try
                     {
+                        start_time = std::chrono::steady_clock::now();
                         result = cmdline.call(params.desc_cmdline, argc, argv);
+                        hpx::util::record_startup_timing(
+                            "command line handling",
+                            std::chrono::steady_clock::now() - start_time);
+                        start_time = std::chrono::steady_clock::now();
 
                         hpx::threads::policies::detail::affinity_data
                             affinity_data{};
@@ -499,6 +543,9 @@ namespace hpx {
 
                         // Setup all internal parameters of the resource_partitioner
                         rp.configure_pools();
+                        hpx::util::record_startup_timing(
+                            "resource partitioner",
+                            std::chrono::steady_clock::now() - start_time);
                     }
                     catch (hpx::exception const& e)
                     {
@@ -515,7 +562,10 @@ namespace hpx {
 
                     // Command line handling should have updated this by now.
                     LPROGRESS_ << "creating local runtime";
+                    start_time = std::chrono::steady_clock::now();
                     rt.reset(new hpx::runtime(cmdline.rtcfg_, true));
+                    hpx::util::record_startup_timing("runtime construction",
+                        std::chrono::steady_clock::now() - start_time);
 
                     result = run_or_start(blocking, HPX_MOVE(rt), cmdline,
                         HPX_MOVE(params.startup), HPX_MOVE(params.shutdown));
@@ -16,9 +16,11 @@
 #include <hpx/synchronization/spinlock.hpp>
 
 #include <atomic>
+#include <cstddef>
 #include <cstdlib>
 #include <string>
 #include <thread>
+#include <vector>
 
 #include <hpx/config/warnings_prefix.hpp>
 
@@ -27,11 +29,31 @@ namespace hpx { namespace util {
     {
         static bool check_lci_environment(runtime_configuration const& cfg);
 
-        static LCI_error_t init_lci();
+        // The endpoints and completion queues used for the messages sent
+        // through one LCI device. The devices of all localities are created
+        // in the same order, messages sent through the n-th device of one
+        // locality arrive at the n-th device of the other.
+        struct device
+        {
+            LCI_device_t device;
+
+            // point to point messages
+            LCI_endpoint_t endpoint;
+
+            // release tag messages
+            LCI_endpoint_t rt_endpoint;
+            LCI_comp_t rt_queue;
+
+            // header messages
+            LCI_endpoint_t h_endpoint;
+            LCI_comp_t h_queue;
+        };
+
+        static LCI_error_t init_lci(std::size_t num_devices = 1);
         static void init(int* argc, char*** argv, runtime_configuration& cfg);
         static void finalize();
 
-        static void progress_fn();
+        static void progress_fn(std::size_t device_index);
 
         static bool enabled();
 
@@ -48,6 +70,10 @@ namespace hpx { namespace util {
 
         static LCI_comp_t& h_queue();
 
+        // hpx.parcel.lci.num_devices, the first device is LCI_UR_DEVICE
+        static std::size_t num_devices();
+        static device& get_device(std::size_t device_index);
+
         static std::string get_processor_name();
 
         struct HPX_EXPORT scoped_lock
@@ -74,12 +100,10 @@ namespace hpx { namespace util {
     private:
         static mutex_type mtx_;
         static bool enabled_;
-        static LCI_endpoint_t ep_;
-        static LCI_endpoint_t rt_ep_;
-        static LCI_endpoint_t h_ep_;
-        static LCI_comp_t rt_cq_r_;
-        static LCI_comp_t h_cq_r_;
-        static std::thread* prg_thread_p;
+        static std::vector<device> devices_;
+
+        // every device is progressed by its own thread
+        static std::vector<std::thread> prg_threads_;
         static std::atomic<bool> prg_thread_flag;
     };
 }}    // namespace hpx::util
@@ -19,6 +19,8 @@
 #include <cstddef>
 #include <cstdlib>
 #include <string>
+#include <thread>
+#include <vector>
 
 ///////////////////////////////////////////////////////////////////////////////
 namespace hpx { namespace util {
@@ -99,16 +101,32 @@ namespace hpx { namespace util {
 
     lci_environment::mutex_type lci_environment::mtx_;
     bool lci_environment::enabled_ = false;
-    LCI_endpoint_t lci_environment::ep_;
-    LCI_endpoint_t lci_environment::rt_ep_;
-    LCI_comp_t lci_environment::rt_cq_r_;
-    LCI_endpoint_t lci_environment::h_ep_;
-    LCI_comp_t lci_environment::h_cq_r_;
-    std::thread* lci_environment::prg_thread_p = nullptr;
+    std::vector<lci_environment::device> lci_environment::devices_;
+    std::vector<std::thread> lci_environment::prg_threads_;
     std::atomic<bool> lci_environment::prg_thread_flag = false;
 
+    namespace detail {
+
+        // creates an endpoint whose messages are completed in the given
+        // queue
+        void init_queue_endpoint(
+            LCI_endpoint_t& ep, LCI_comp_t& cq, LCI_device_t device)
+        {
+            LCI_plist_t plist_;
+            LCI_plist_create(&plist_);
+            LCI_queue_create(device, &cq);
+            LCI_plist_set_comp_type(
+                plist_, LCI_PORT_MESSAGE, LCI_COMPLETION_QUEUE);
+            LCI_plist_set_comp_type(
+                plist_, LCI_PORT_COMMAND, LCI_COMPLETION_QUEUE);
+            LCI_plist_set_default_comp(plist_, cq);
+            LCI_endpoint_init(&ep, device, plist_);
+            LCI_plist_free(&plist_);
+        }
+    }    // namespace detail
+
     ///////////////////////////////////////////////////////////////////////////
-    LCI_error_t lci_environment::init_lci()
+    LCI_error_t lci_environment::init_lci(std::size_t num_devices)
     {
         // Check if MPI_Init has been called previously
         int is_mpi_initialized = 0;
@@ -137,35 +155,59 @@ namespace hpx { namespace util {
                 return lci_retval;
         }
 
-        // create main endpoint for pt2pt msgs
-        LCI_plist_t plist_;
-        LCI_plist_create(&plist_);
-        LCI_plist_set_comp_type(plist_, LCI_PORT_COMMAND, LCI_COMPLETION_SYNC);
-        LCI_plist_set_comp_type(plist_, LCI_PORT_MESSAGE, LCI_COMPLETION_SYNC);
-        LCI_endpoint_init(&ep_, LCI_UR_DEVICE, plist_);
-        LCI_plist_free(&plist_);
-
-        // set endpoint for release tag msgs
-        rt_ep_ = LCI_UR_ENDPOINT;
-        rt_cq_r_ = LCI_UR_CQ;
-
-        // create endpoint for header msgs
-        LCI_plist_t h_plist_;
-        LCI_plist_create(&h_plist_);
-        LCI_queue_create(LCI_UR_DEVICE, &h_cq_r_);
-        LCI_plist_set_comp_type(
-            h_plist_, LCI_PORT_MESSAGE, LCI_COMPLETION_QUEUE);
-        LCI_plist_set_comp_type(
-            h_plist_, LCI_PORT_COMMAND, LCI_COMPLETION_QUEUE);
-        LCI_plist_set_default_comp(h_plist_, h_cq_r_);
-        LCI_endpoint_init(&h_ep_, LCI_UR_DEVICE, h_plist_);
-        LCI_plist_free(&h_plist_);
+        HPX_ASSERT(devices_.empty());
+        devices_.resize(num_devices == 0 ? 1 : num_devices);
+        for (std::size_t i = 0; i != devices_.size(); ++i)
+        {
+            device& d = devices_[i];
+            if (i == 0)
+            {
+                d.device = LCI_UR_DEVICE;
+            }
+            else
+            {
+                LCI_error_t lci_retval = LCI_device_init(&d.device);
+                if (lci_retval != LCI_OK)
+                {
+                    devices_.resize(i);
+                    return lci_retval;
+                }
+            }
+
+            // create main endpoint for pt2pt msgs
+            LCI_plist_t plist_;
+            LCI_plist_create(&plist_);
+            LCI_plist_set_comp_type(
+                plist_, LCI_PORT_COMMAND, LCI_COMPLETION_SYNC);
+            LCI_plist_set_comp_type(
+                plist_, LCI_PORT_MESSAGE, LCI_COMPLETION_SYNC);
+            LCI_endpoint_init(&d.endpoint, d.device, plist_);
+            LCI_plist_free(&plist_);
+
+            // set endpoint for release tag msgs
+            if (i == 0)
+            {
+                d.rt_endpoint = LCI_UR_ENDPOINT;
+                d.rt_queue = LCI_UR_CQ;
+            }
+            else
+            {
+                detail::init_queue_endpoint(
+                    d.rt_endpoint, d.rt_queue, d.device);
+            }
+
+            // create endpoint for header msgs
+            detail::init_queue_endpoint(d.h_endpoint, d.h_queue, d.device);
+        }
         // DEBUG("Rank %d: Init lci env", LCI_RANK);
 
         HPX_ASSERT(prg_thread_flag == false);
-        HPX_ASSERT(prg_thread_p == nullptr);
+        HPX_ASSERT(prg_threads_.empty());
         prg_thread_flag = true;
-        prg_thread_p = new std::thread(progress_fn);
+        for (std::size_t i = 0; i != devices_.size(); ++i)
+        {
+            prg_threads_.emplace_back(progress_fn, i);
+        }
 
         return LCI_OK;
     }
@@ -189,7 +231,8 @@ namespace hpx { namespace util {
 
         rtcfg.add_entry("hpx.parcel.bootstrap", "lci");
 
-        LCI_error_t retval = init_lci();
+        LCI_error_t retval = init_lci(
+            get_entry_as<std::size_t>(rtcfg, "hpx.parcel.lci.num_devices", 1));
         if (LCI_OK != retval)
         {
             // explicitly disable lci if not run by mpirun
@@ -238,10 +281,26 @@ namespace hpx { namespace util {
             if (lci_init)
             {
                 HPX_ASSERT(prg_thread_flag.load() == true);
-                HPX_ASSERT(prg_thread_p != nullptr);
+                HPX_ASSERT(!prg_threads_.empty());
                 prg_thread_flag = false;
-                prg_thread_p->join();
-                delete prg_thread_p;
+                for (std::thread& t : prg_threads_)
+                {
+                    t.join();
+                }
+                prg_threads_.clear();
+
+                // LCI_finalize takes care of the default device
+                for (std::size_t i = 1; i < devices_.size(); ++i)
+                {
+                    device& d = devices_[i];
+                    LCI_endpoint_free(&d.endpoint);
+                    LCI_endpoint_free(&d.rt_endpoint);
+                    LCI_queue_free(&d.rt_queue);
+                    LCI_endpoint_free(&d.h_endpoint);
+                    LCI_queue_free(&d.h_queue);
+                    LCI_device_free(&d.device);
+                }
+                devices_.clear();
 
                 LCI_finalize();
             }
@@ -254,11 +313,12 @@ namespace hpx { namespace util {
         }
     }
 
-    void lci_environment::progress_fn()
+    void lci_environment::progress_fn(std::size_t device_index)
     {
+        LCI_device_t device = devices_[device_index].device;
         while (prg_thread_flag)
         {
-            LCI_progress(LCI_UR_DEVICE);
+            LCI_progress(device);
         }
     }
 
@@ -285,27 +345,39 @@ namespace hpx { namespace util {
 
     LCI_endpoint_t& lci_environment::lci_endpoint()
     {
-        return ep_;
+        return get_device(0).endpoint;
     }
 
     LCI_endpoint_t& lci_environment::rt_endpoint()
     {
-        return rt_ep_;
+        return get_device(0).rt_endpoint;
     }
 
     LCI_comp_t& lci_environment::rt_queue()
     {
-        return rt_cq_r_;
+        return get_device(0).rt_queue;
     }
 
     LCI_endpoint_t& lci_environment::h_endpoint()
     {
-        return h_ep_;
+        return get_device(0).h_endpoint;
     }
 
     LCI_comp_t& lci_environment::h_queue()
     {
-        return h_cq_r_;
+        return get_device(0).h_queue;
+    }
+
+    std::size_t lci_environment::num_devices()
+    {
+        return devices_.size();
+    }
+
+    lci_environment::device& lci_environment::get_device(
+        std::size_t device_index)
+    {
+        HPX_ASSERT(device_index < devices_.size());
+        return devices_[device_index];
     }
 
     lci_environment::scoped_lock::scoped_lock()
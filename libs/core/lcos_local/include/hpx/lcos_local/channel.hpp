@@ -9,8 +9,10 @@
 #include <hpx/config.hpp>
 #include <hpx/assert.hpp>
 #include <hpx/async_base/launch_policy.hpp>
+#include <hpx/datastructures/optional.hpp>
 #include <hpx/futures/future.hpp>
 #include <hpx/futures/packaged_task.hpp>
+#include <hpx/futures/promise.hpp>
 #include <hpx/iterator_support/iterator_facade.hpp>
 #include <hpx/lcos_local/receive_buffer.hpp>
 #include <hpx/lock_registration/detail/register_locks.hpp>
@@ -23,12 +25,16 @@
 #include <hpx/thread_support/unlock_guard.hpp>
 #include <hpx/type_support/unused.hpp>
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdlib>
+#include <deque>
 #include <exception>
 #include <iterator>
 #include <mutex>
+#include <type_traits>
 #include <utility>
+#include <vector>
 
 namespace hpx { namespace lcos { namespace local {
     ///////////////////////////////////////////////////////////////////////////
@@ -535,6 +541,273 @@ namespace hpx { namespace lcos { namespace local {
             bool closed_;
         };
 
+        ///////////////////////////////////////////////////////////////////////
+        // FIFO channel holding at most capacity elements. Once the buffer is
+        // full the futures returned by set become ready only when a receiver
+        // has made room for the element.
+        template <typename T>
+        class limited_channel : public channel_impl_base<T>
+        {
+            using mutex_type = hpx::spinlock;
+
+        public:
+            HPX_NON_COPYABLE(limited_channel);
+
+        public:
+            explicit limited_channel(std::size_t capacity)
+              : capacity_(capacity)
+              , closed_(false)
+            {
+                HPX_ASSERT(capacity != 0);
+            }
+
+        private:
+            // moves the oldest element held back by a sender into the buffer,
+            // returns the promise of the sender
+            hpx::optional<hpx::promise<void>> refill(
+                std::unique_lock<mutex_type>& l)
+            {
+                HPX_ASSERT_OWNS_LOCK(l);
+                HPX_UNUSED(l);
+
+                hpx::optional<hpx::promise<void>> p;
+                if (!pending_sets_.empty() && buffer_.size() < capacity_)
+                {
+                    buffer_.push_back(HPX_MOVE(pending_sets_.front().first));
+                    p.emplace(HPX_MOVE(pending_sets_.front().second));
+                    pending_sets_.pop_front();
+                }
+                return p;
+            }
+
+            // the receivers of a channel which is empty and closed (or not
+            // accessible by any other thread) would wait forever
+            template <typename R>
+            bool check_empty(std::unique_lock<mutex_type>& l, bool blocking,
+                hpx::future<R>& f)
+            {
+                HPX_ASSERT_OWNS_LOCK(l);
+                if (closed_)
+                {
+                    l.unlock();
+                    f = hpx::make_exceptional_future<R>(HPX_GET_EXCEPTION(
+                        hpx::invalid_status, "hpx::lcos::local::channel::get",
+                        "this channel is empty and was closed"));
+                    return false;
+                }
+
+                if (blocking && this->use_count() == 1)
+                {
+                    l.unlock();
+                    f = hpx::make_exceptional_future<R>(HPX_GET_EXCEPTION(
+                        hpx::invalid_status, "hpx::lcos::local::channel::get",
+                        "this channel is empty and is not accessible by any "
+                        "other thread causing a deadlock"));
+                    return false;
+                }
+                return true;
+            }
+
+        protected:
+            hpx::future<T> get(std::size_t, bool blocking)
+            {
+                std::unique_lock<mutex_type> l(mtx_);
+
+                hpx::future<T> f;
+                if (buffer_.empty())
+                {
+                    if (check_empty(l, blocking, f))
+                    {
+                        pending_gets_.emplace_back();
+                        f = pending_gets_.back().get_future();
+                    }
+                    return f;
+                }
+
+                T val = HPX_MOVE(buffer_.front());
+                buffer_.pop_front();
+
+                hpx::optional<hpx::promise<void>> p = refill(l);
+                l.unlock();
+
+                if (p)
+                {
+                    p->set_value();    // let the waiting sender continue
+                }
+                return hpx::make_ready_future(HPX_MOVE(val));
+            }
+
+            bool try_get(std::size_t generation, hpx::future<T>* f = nullptr)
+            {
+                {
+                    std::lock_guard<mutex_type> l(mtx_);
+                    if (buffer_.empty() && closed_)
+                    {
+                        return false;
+                    }
+                }
+
+                if (f != nullptr)
+                {
+                    *f = get(generation, false);
+                }
+                return true;
+            }
+
+            hpx::future<void> set(std::size_t, T&& t)
+            {
+                std::unique_lock<mutex_type> l(mtx_);
+                if (closed_)
+                {
+                    l.unlock();
+                    return hpx::make_exceptional_future<void>(HPX_GET_EXCEPTION(
+                        hpx::invalid_status, "hpx::lcos::local::channel::set",
+                        "attempting to write to a closed channel"));
+                }
+
+                if (!pending_gets_.empty())
+                {
+                    // hand the element to the oldest waiting receiver
+                    hpx::promise<T> p = HPX_MOVE(pending_gets_.front());
+                    pending_gets_.pop_front();
+                    l.unlock();
+
+                    p.set_value(HPX_MOVE(t));
+                    return hpx::make_ready_future();
+                }
+
+                if (!pending_batch_gets_.empty())
+                {
+                    hpx::promise<std::vector<T>> p =
+                        HPX_MOVE(pending_batch_gets_.front());
+                    pending_batch_gets_.pop_front();
+                    l.unlock();
+
+                    std::vector<T> values;
+                    values.push_back(HPX_MOVE(t));
+                    p.set_value(HPX_MOVE(values));
+                    return hpx::make_ready_future();
+                }
+
+                if (buffer_.size() < capacity_)
+                {
+                    buffer_.push_back(HPX_MOVE(t));
+                    return hpx::make_ready_future();
+                }
+
+                // the buffer is full, hold the sender back
+                pending_sets_.emplace_back(HPX_MOVE(t), hpx::promise<void>());
+                return pending_sets_.back().second.get_future();
+            }
+
+            std::size_t close(bool /*force_delete_entries*/ = false)
+            {
+                std::unique_lock<mutex_type> l(mtx_);
+                if (closed_)
+                {
+                    l.unlock();
+                    HPX_THROW_EXCEPTION(hpx::invalid_status,
+                        "hpx::lcos::local::channel::close",
+                        "attempting to close an already closed channel");
+                    return 0;
+                }
+
+                closed_ = true;
+
+                // the senders which are held back and the waiting receivers
+                // are canceled, the buffered elements can still be received
+                std::deque<std::pair<T, hpx::promise<void>>> sets =
+                    HPX_MOVE(pending_sets_);
+                std::deque<hpx::promise<T>> gets = HPX_MOVE(pending_gets_);
+                std::deque<hpx::promise<std::vector<T>>> batch_gets =
+                    HPX_MOVE(pending_batch_gets_);
+                l.unlock();
+
+                std::size_t const count =
+                    sets.size() + gets.size() + batch_gets.size();
+                if (count == 0)
+                {
+                    return 0;
+                }
+
+                std::exception_ptr e = HPX_GET_EXCEPTION(hpx::future_cancelled,
+                    hpx::throwmode::lightweight, "hpx::lcos::local::close",
+                    "canceled waiting on this entry");
+
+                for (auto& set : sets)
+                {
+                    set.second.set_exception(e);
+                }
+                for (auto& p : gets)
+                {
+                    p.set_exception(e);
+                }
+                for (auto& p : batch_gets)
+                {
+                    p.set_exception(e);
+                }
+                return count;
+            }
+
+        public:
+            // Receives up to count elements at once. The future is ready
+            // right away if elements are buffered, otherwise it becomes ready
+            // with the next element sent.
+            hpx::future<std::vector<T>> get_n(std::size_t count, bool blocking)
+            {
+                HPX_ASSERT(count != 0);
+
+                std::unique_lock<mutex_type> l(mtx_);
+
+                hpx::future<std::vector<T>> f;
+                if (buffer_.empty())
+                {
+                    if (check_empty(l, blocking, f))
+                    {
+                        pending_batch_gets_.emplace_back();
+                        f = pending_batch_gets_.back().get_future();
+                    }
+                    return f;
+                }
+
+                std::vector<T> values;
+                values.reserve((std::min)(count, buffer_.size()));
+                std::vector<hpx::promise<void>> senders;
+                while (values.size() != count && !buffer_.empty())
+                {
+                    values.push_back(HPX_MOVE(buffer_.front()));
+                    buffer_.pop_front();
+
+                    hpx::optional<hpx::promise<void>> p = refill(l);
+                    if (p)
+                    {
+                        senders.push_back(HPX_MOVE(*p));
+                    }
+                }
+                l.unlock();
+
+                for (auto& p : senders)
+                {
+                    p.set_value();
+                }
+                return hpx::make_ready_future(HPX_MOVE(values));
+            }
+
+            std::size_t capacity() const noexcept
+            {
+                return capacity_;
+            }
+
+        private:
+            mutable mutex_type mtx_;
+            std::deque<T> buffer_;
+            std::deque<std::pair<T, hpx::promise<void>>> pending_sets_;
+            std::deque<hpx::promise<T>> pending_gets_;
+            std::deque<hpx::promise<std::vector<T>>> pending_batch_gets_;
+            std::size_t capacity_;
+            bool closed_;
+        };
+
         ///////////////////////////////////////////////////////////////////////
         template <typename T>
         class channel_base;
@@ -545,6 +818,8 @@ namespace hpx { namespace lcos { namespace local {
     class channel;
     template <typename T = void>
     class one_element_channel;
+    template <typename T>
+    class limited_channel;
     template <typename T = void>
     class receive_channel;
     template <typename T = void>
@@ -831,6 +1106,67 @@ namespace hpx { namespace lcos { namespace local {
         using base_type::set;
     };
 
+    // channel with a buffer of limited size, senders are held back while the
+    // buffer is full: the futures returned by set(launch::async, ...) become
+    // ready once the element was accepted and set blocks until then
+    template <typename T>
+    class limited_channel : protected detail::channel_base<T>
+    {
+        static_assert(!std::is_void_v<T>,
+            "limited_channel does not support void elements");
+
+        using base_type = detail::channel_base<T>;
+        using impl_type = detail::limited_channel<T>;
+
+    private:
+        friend class channel_iterator<T>;
+        friend class receive_channel<T>;
+        friend class send_channel<T>;
+
+    public:
+        using value_type = T;
+
+        explicit limited_channel(std::size_t capacity)
+          : base_type(new impl_type(capacity))
+        {
+        }
+
+        using base_type::begin;
+        using base_type::close;
+        using base_type::end;
+        using base_type::get;
+        using base_type::range;
+        using base_type::set;
+
+        // Receives up to count elements at once, the returned future becomes
+        // ready with at least one element.
+        hpx::future<std::vector<T>> get_n(
+            launch::async_policy, std::size_t count) const
+        {
+            return get_impl()->get_n(count, false);
+        }
+        hpx::future<std::vector<T>> get_n(std::size_t count) const
+        {
+            return get_n(launch::async, count);
+        }
+        std::vector<T> get_n(launch::sync_policy, std::size_t count,
+            error_code& ec = throws) const
+        {
+            return get_impl()->get_n(count, true).get(ec);
+        }
+
+        std::size_t capacity() const noexcept
+        {
+            return get_impl()->capacity();
+        }
+
+    private:
+        impl_type* get_impl() const noexcept
+        {
+            return static_cast<impl_type*>(this->get_channel_impl());
+        }
+    };
+
     ///////////////////////////////////////////////////////////////////////////
     template <typename T>
     class receive_channel : protected detail::channel_base<T>
@@ -850,6 +1186,10 @@ namespace hpx { namespace lcos { namespace local {
           : base_type(c.get_channel_impl())
         {
         }
+        receive_channel(limited_channel<T> const& c)
+          : base_type(c.get_channel_impl())
+        {
+        }
 
         using base_type::begin;
         using base_type::end;
@@ -872,6 +1212,10 @@ namespace hpx { namespace lcos { namespace local {
           : base_type(c.get_channel_impl())
         {
         }
+        send_channel(limited_channel<T> const& c)
+          : base_type(c.get_channel_impl())
+        {
+        }
 
         using base_type::close;
         using base_type::set;
@@ -9,6 +9,7 @@
 #include <hpx/modules/testing.hpp>
 
 #include <atomic>
+#include <cstddef>
 #include <numeric>
 #include <string>
 #include <vector>
@@ -334,6 +335,98 @@ void closed_channel_set1()
     HPX_TEST(caught_exception);
 }
 
+///////////////////////////////////////////////////////////////////////////////
+void limited_channel_backpressure()
+{
+    hpx::lcos::local::limited_channel<int> c(2);
+    HPX_TEST_EQ(c.capacity(), std::size_t(2));
+
+    hpx::future<void> f1 = c.set(hpx::launch::async, 1);
+    hpx::future<void> f2 = c.set(hpx::launch::async, 2);
+    hpx::future<void> f3 = c.set(hpx::launch::async, 3);
+    HPX_TEST(f1.is_ready());
+    HPX_TEST(f2.is_ready());
+    HPX_TEST(!f3.is_ready());    // the buffer is full
+
+    hpx::future<int> f = c.get();
+    HPX_TEST(f.is_ready());
+    HPX_TEST_EQ(f.get(), 1);
+    HPX_TEST(f3.is_ready());    // the third element was accepted now
+
+    std::vector<int> values = c.get_n(hpx::launch::sync, 10);
+    HPX_TEST_EQ(values.size(), std::size_t(2));
+    HPX_TEST_EQ(values[0], 2);
+    HPX_TEST_EQ(values[1], 3);
+
+    // a batch receive on an empty channel waits for the next element
+    hpx::future<std::vector<int>> fv = c.get_n(10);
+    HPX_TEST(!fv.is_ready());
+    c.set(42);
+    values = fv.get();
+    HPX_TEST_EQ(values.size(), std::size_t(1));
+    HPX_TEST_EQ(values[0], 42);
+}
+
+void limited_channel_close()
+{
+    hpx::lcos::local::limited_channel<int> c(1);
+
+    hpx::future<int> f = c.get();
+    c.set(1);
+    HPX_TEST_EQ(f.get(), 1);
+
+    c.set(2);
+    hpx::future<void> fs = c.set(hpx::launch::async, 3);
+    HPX_TEST(!fs.is_ready());
+
+    // the held back sender is canceled, the buffered element is kept
+    HPX_TEST_EQ(c.close(), std::size_t(1));
+    HPX_TEST(fs.has_exception());
+    HPX_TEST_EQ(c.get(hpx::launch::sync), 2);
+
+    bool caught_exception = false;
+    try
+    {
+        c.get(hpx::launch::sync);
+        HPX_TEST(false);
+    }
+    catch (hpx::exception const&)
+    {
+        caught_exception = true;
+    }
+    HPX_TEST(caught_exception);
+}
+
+void limited_channel_producer_consumer()
+{
+    std::size_t const num_items = 1000;
+    hpx::lcos::local::limited_channel<std::size_t> c(16);
+
+    hpx::future<void> producer = hpx::async([c]() mutable {
+        for (std::size_t i = 0; i != num_items; ++i)
+        {
+            c.set(i);    // blocks while the consumer falls behind
+        }
+    });
+
+    std::size_t received = 0;
+    std::size_t sum = 0;
+    while (received != num_items)
+    {
+        std::vector<std::size_t> values = c.get_n(hpx::launch::sync, 8);
+        HPX_TEST_LT(std::size_t(0), values.size());
+        HPX_TEST_LTE(values.size(), std::size_t(8));
+        for (std::size_t value : values)
+        {
+            HPX_TEST_EQ(value, received++);    // in order
+            sum += value;
+        }
+    }
+    producer.get();
+
+    HPX_TEST_EQ(sum, num_items * (num_items - 1) / 2);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 int hpx_main()
 {
@@ -355,6 +448,10 @@ int hpx_main()
     closed_channel_get1();
     closed_channel_set1();
 
+    limited_channel_backpressure();
+    limited_channel_close();
+    limited_channel_producer_consumer();
+
     return hpx::local::finalize();
 }
 
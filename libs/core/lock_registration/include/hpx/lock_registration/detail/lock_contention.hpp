@@ -0,0 +1,136 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#include <cstdint>
+#if defined(HPX_HAVE_LOCK_CONTENTION_PROFILING)
+#include <chrono>
+#include <cstddef>
+#include <iosfwd>
+#include <string>
+#include <vector>
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx { namespace util {
+
+#if defined(HPX_HAVE_LOCK_CONTENTION_PROFILING)
+
+    // The lock contention profiler records the acquisitions of the HPX locks
+    // (hpx::spinlock, hpx::mutex, hpx::shared_mutex, the spinlock_pool and
+    // the condition variables) per lock site. A lock site is identified by
+    // the description the lock was constructed with, locks without a
+    // description are attributed to their type.
+
+    /// The acquisitions of the locks of one site
+    struct lock_contention_site
+    {
+        std::string description;
+        std::uint64_t acquisitions = 0;
+        std::uint64_t contentions = 0;    // acquisitions that had to wait
+        std::uint64_t wait_time = 0;      // nanoseconds
+    };
+
+    /// Returns the \a count sites with the highest wait times, sorted by
+    /// decreasing wait time
+    HPX_CORE_EXPORT std::vector<lock_contention_site> get_lock_contention_sites(
+        std::size_t count = std::size_t(-1), bool reset = false);
+
+    /// Returns the acquisitions of the locks with the given description (of
+    /// all locks if \a description is empty)
+    HPX_CORE_EXPORT lock_contention_site get_lock_contention_site(
+        std::string const& description, bool reset = false);
+
+    /// Writes the \a count sites with the highest wait times, one line per
+    /// site: description, acquisitions, contentions, wait time
+    HPX_CORE_EXPORT void write_lock_contention_sites(std::ostream& os,
+        std::size_t count = std::size_t(-1), bool reset = false);
+
+    namespace detail {
+
+        HPX_CORE_EXPORT void record_lock_acquisition(
+            char const* site, std::uint64_t wait_time, bool contended) noexcept;
+
+        // Records one acquisition of a lock of the given site, the wait time
+        // is measured from the call to contended() until the destruction.
+        class lock_contention_timer
+        {
+        public:
+            explicit lock_contention_timer(char const* site) noexcept
+              : site_(site)
+            {
+            }
+
+            lock_contention_timer(lock_contention_timer const&) = delete;
+            lock_contention_timer& operator=(
+                lock_contention_timer const&) = delete;
+
+            ~lock_contention_timer()
+            {
+                if (site_ == nullptr)
+                {
+                    return;
+                }
+                if (!contended_)
+                {
+                    record_lock_acquisition(site_, 0, false);
+                    return;
+                }
+
+                auto const wait_time = std::chrono::duration_cast<
+                    std::chrono::nanoseconds>(
+                    std::chrono::steady_clock::now() - start_)
+                                           .count();
+                record_lock_acquisition(
+                    site_, static_cast<std::uint64_t>(wait_time), true);
+            }
+
+            void contended() noexcept
+            {
+                if (!contended_)
+                {
+                    contended_ = true;
+                    start_ = std::chrono::steady_clock::now();
+                }
+            }
+
+            // the lock wasn't acquired after all
+            void cancel() noexcept
+            {
+                site_ = nullptr;
+                contended_ = false;
+            }
+
+        private:
+            char const* site_;
+            bool contended_ = false;
+            std::chrono::steady_clock::time_point start_;
+        };
+    }    // namespace detail
+
+#else
+
+    namespace detail {
+
+        constexpr inline void record_lock_acquisition(
+            char const*, std::uint64_t, bool) noexcept
+        {
+        }
+
+        class lock_contention_timer
+        {
+        public:
+            explicit constexpr lock_contention_timer(char const*) noexcept {}
+
+            constexpr void contended() noexcept {}
+            constexpr void cancel() noexcept {}
+        };
+    }    // namespace detail
+#endif
+}}    // namespace hpx::util
@@ -0,0 +1,190 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_LOCK_CONTENTION_PROFILING)
+#include <hpx/lock_registration/detail/lock_contention.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx { namespace util {
+
+    namespace {
+
+        struct site_counts
+        {
+            std::uint64_t acquisitions = 0;
+            std::uint64_t contentions = 0;
+            std::uint64_t wait_time = 0;
+        };
+
+        // The acquisitions made by one OS thread, the lock is contended only
+        // while the sites are collected.
+        struct thread_sites
+        {
+            std::mutex mtx;
+            std::unordered_map<char const*, site_counts> sites;
+        };
+
+        struct contention_registry
+        {
+            std::mutex mtx;
+            std::vector<std::unique_ptr<thread_sites>> threads;
+        };
+
+        // never destroyed, locks are acquired during static destruction
+        contention_registry& get_registry()
+        {
+            static contention_registry* registry = new contention_registry;
+            return *registry;
+        }
+
+        // the tables of exited OS threads are kept, their counts are still
+        // reported
+        thread_sites* get_thread_sites()
+        {
+            static thread_local thread_sites* sites = nullptr;
+            if (HPX_UNLIKELY(sites == nullptr))
+            {
+                auto table = std::make_unique<thread_sites>();
+
+                contention_registry& registry = get_registry();
+                std::lock_guard<std::mutex> l(registry.mtx);
+                registry.threads.push_back(HPX_MOVE(table));
+                sites = registry.threads.back().get();
+            }
+            return sites;
+        }
+
+        // the counts of all sites, merged by description
+        std::map<std::string, site_counts> collect_sites(bool reset)
+        {
+            std::map<std::string, site_counts> result;
+
+            contention_registry& registry = get_registry();
+            std::lock_guard<std::mutex> l(registry.mtx);
+            for (auto& table : registry.threads)
+            {
+                std::lock_guard<std::mutex> tl(table->mtx);
+                for (auto const& site : table->sites)
+                {
+                    site_counts& counts = result[site.first];
+                    counts.acquisitions += site.second.acquisitions;
+                    counts.contentions += site.second.contentions;
+                    counts.wait_time += site.second.wait_time;
+                }
+                if (reset)
+                {
+                    table->sites.clear();
+                }
+            }
+            return result;
+        }
+    }    // namespace
+
+    ///////////////////////////////////////////////////////////////////////////
+    std::vector<lock_contention_site> get_lock_contention_sites(
+        std::size_t count, bool reset)
+    {
+        std::vector<lock_contention_site> sites;
+        for (auto const& site : collect_sites(reset))
+        {
+            sites.push_back(lock_contention_site{site.first,
+                site.second.acquisitions, site.second.contentions,
+                site.second.wait_time});
+        }
+
+        std::stable_sort(sites.begin(), sites.end(),
+            [](lock_contention_site const& lhs,
+                lock_contention_site const& rhs) {
+                return lhs.wait_time > rhs.wait_time;
+            });
+
+        if (sites.size() > count)
+        {
+            sites.resize(count);
+        }
+        return sites;
+    }
+
+    lock_contention_site get_lock_contention_site(
+        std::string const& description, bool reset)
+    {
+        lock_contention_site result{description, 0, 0, 0};
+
+        contention_registry& registry = get_registry();
+        std::lock_guard<std::mutex> l(registry.mtx);
+        for (auto& table : registry.threads)
+        {
+            std::lock_guard<std::mutex> tl(table->mtx);
+            for (auto& site : table->sites)
+            {
+                if (description.empty() || description == site.first)
+                {
+                    result.acquisitions += site.second.acquisitions;
+                    result.contentions += site.second.contentions;
+                    result.wait_time += site.second.wait_time;
+                    if (reset)
+                    {
+                        site.second = site_counts();
+                    }
+                }
+            }
+        }
+        return result;
+    }
+
+    void write_lock_contention_sites(
+        std::ostream& os, std::size_t count, bool reset)
+    {
+        for (lock_contention_site const& site :
+            get_lock_contention_sites(count, reset))
+        {
+            os << site.description << ',' << site.acquisitions << ','
+               << site.contentions << ',' << site.wait_time << '\n';
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    namespace detail {
+
+        void record_lock_acquisition(
+            char const* site, std::uint64_t wait_time, bool contended) noexcept
+        {
+            try
+            {
+                thread_sites* table = get_thread_sites();
+
+                std::lock_guard<std::mutex> l(table->mtx);
+                site_counts& counts = table->sites[site];
+                ++counts.acquisitions;
+                if (contended)
+                {
+                    ++counts.contentions;
+                    counts.wait_time += wait_time;
+                }
+            }
+            catch (...)
+            {
+                // the acquisition is dropped if the memory can't be allocated
+            }
+        }
+    }    // namespace detail
+}}    // namespace hpx::util
+
+#endif
@@ -0,0 +1,33 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/logging/message.hpp>
+
+#include <string>
+
+namespace hpx { namespace util { namespace logging {
+
+    class logger;
+
+    namespace detail {
+
+        // Starts the background thread writing the messages of asynchronous
+        // loggers (if it's not running yet).
+        HPX_CORE_EXPORT void start_async_writer();
+
+        // Queues the formatted message for being written by the background
+        // thread to the destinations of the given logger. Returns false if
+        // the queue of the calling thread is full (the message is dropped).
+        HPX_CORE_EXPORT bool async_write(
+            logger const& source, std::string formatted);
+
+        // Waits until all messages queued so far have been written.
+        HPX_CORE_EXPORT void async_flush();
+    }    // namespace detail
+}}}    // namespace hpx::util::logging
@@ -21,6 +21,9 @@
 #include <hpx/logging/level.hpp>
 #include <hpx/modules/format.hpp>
 
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
 #include <utility>
 #include <vector>
 
@@ -115,6 +118,9 @@ namespace hpx { namespace util { namespace logging {
             // force writing all messages from cache,
             // if cache hasn't been turned off yet
             turn_cache_off();
+
+            // write all messages which are still queued
+            set_async(false);
         }
 
         /**
@@ -125,8 +131,12 @@ namespace hpx { namespace util { namespace logging {
             return {*this};
         }
 
-        writer::named_write& writer() noexcept
+        // the writer must not be modified while queued messages are written,
+        // this waits for them if the logger is asynchronous
+        writer::named_write& writer()
         {
+            if (is_async())
+                flush();
             return m_writer;
         }
         writer::named_write const& writer() const noexcept
@@ -165,22 +175,69 @@ namespace hpx { namespace util { namespace logging {
             turn_cache_off();
         }
 
+        /** @brief Makes this logger asynchronous
+
+        An asynchronous logger formats messages on the calling thread and
+        hands them to a queue of that thread. A background thread takes them
+        from the queues of all threads and writes them to the destinations.
+        Messages are dropped (and counted) if the queue of the calling thread
+        is full.
+        */
+        HPX_CORE_EXPORT void set_async(bool async);
+
+        bool is_async() const noexcept
+        {
+            return m_async.load(std::memory_order_relaxed);
+        }
+
+        /** @brief Limits the number of messages written per second
+
+        Messages beyond the limit are dropped, the number of dropped messages
+        is written with the next message which passes the limit. A limit of
+        zero (the default) disables rate limiting.
+        */
+        void set_rate_limit(std::size_t messages_per_second) noexcept
+        {
+            m_rate_limit.store(messages_per_second, std::memory_order_relaxed);
+        }
+
+        std::size_t get_rate_limit() const noexcept
+        {
+            return m_rate_limit.load(std::memory_order_relaxed);
+        }
+
+        /// return the number of messages dropped so far
+        std::size_t dropped_messages() const noexcept
+        {
+            return m_dropped.load(std::memory_order_relaxed);
+        }
+
+        /// wait until all messages queued so far have been written
+        HPX_CORE_EXPORT void flush();
+
     public:
         HPX_CORE_EXPORT void turn_cache_off();
 
         // called after all data has been gathered
-        void write(message msg)
-        {
-            if (m_is_caching_off)
-                m_writer(msg);
-            else
-                m_cache.push_back(HPX_MOVE(msg));
-        }
+        HPX_CORE_EXPORT void write(message msg);
+
+    private:
+        bool accept_message() noexcept;
+        void report_dropped_messages();
+        void write_message(message msg);
 
     private:
         mutable std::vector<message> m_cache;
-        mutable bool m_is_caching_off;
+        mutable bool m_is_caching_off = false;
         writer::named_write m_writer;
         level m_level;
+
+        std::atomic<bool> m_async = false;
+        std::atomic<std::size_t> m_rate_limit = 0;
+        // messages accepted during the current second
+        std::atomic<std::uint64_t> m_window = 0;
+        std::atomic<std::size_t> m_window_count = 0;
+        std::atomic<std::size_t> m_dropped = 0;
+        std::atomic<std::size_t> m_reported = 0;
     };
 }}}    // namespace hpx::util::logging
@@ -19,6 +19,8 @@
 #include <hpx/config.hpp>
 #include <hpx/logging/format/destinations.hpp>
 #include <hpx/logging/format/formatters.hpp>
+#include <hpx/logging/message.hpp>
+#include <hpx/type_support/unused.hpp>
 
 #include <cstddef>
 #include <memory>
@@ -393,14 +395,29 @@ This will just configure "file" twice, ending up with writing only to "two.txt"
             destination(destination_str);
         }
 
-        void operator()(message const& msg) const
+        /** @brief Applies the formatters to the given message
+    */
+        message format_message(message const& msg) const
         {
             std::stringstream out;
             m_format(out, msg);
+            return message(HPX_MOVE(out));
+        }
 
-#if defined(HPX_COMPUTE_HOST_CODE)
-            message formatted(HPX_MOVE(out));
+        /** @brief Writes a message returned by format_message to the
+         * destinations
+    */
+        void write_formatted(message const& formatted) const
+        {
             m_destination(formatted);
+        }
+
+        void operator()(message const& msg) const
+        {
+#if defined(HPX_COMPUTE_HOST_CODE)
+            write_formatted(format_message(msg));
+#else
+            HPX_UNUSED(msg);
 #endif
         }
 
@@ -0,0 +1,294 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_LOGGING)
+#include <hpx/logging/detail/async_writer.hpp>
+#include <hpx/logging/detail/logger.hpp>
+#include <hpx/logging/message.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace util { namespace logging { namespace detail {
+
+    namespace {
+
+        ///////////////////////////////////////////////////////////////////////
+        // Single producer (the owning thread), single consumer (the writer
+        // thread) ring of formatted messages.
+        struct async_buffer
+        {
+            static constexpr std::size_t capacity = 1024;
+
+            struct entry
+            {
+                logger const* source = nullptr;
+                std::string msg;
+            };
+
+            bool push(logger const& source, std::string&& msg) noexcept
+            {
+                std::size_t const t = tail.load(std::memory_order_relaxed);
+                if (t - head.load(std::memory_order_acquire) == capacity)
+                    return false;
+
+                entry& e = entries[t % capacity];
+                e.source = &source;
+                e.msg = HPX_MOVE(msg);
+
+                // seq_cst pairs with the writer thread announcing it's
+                // about to go to sleep
+                tail.store(t + 1, std::memory_order_seq_cst);
+                return true;
+            }
+
+            bool empty() const noexcept
+            {
+                return head.load(std::memory_order_acquire) ==
+                    tail.load(std::memory_order_seq_cst);
+            }
+
+            // called by the writer thread only, returns whether anything was
+            // written
+            bool drain()
+            {
+                std::size_t h = head.load(std::memory_order_relaxed);
+                std::size_t const t = tail.load(std::memory_order_acquire);
+                if (h == t)
+                    return false;
+
+                for (/**/; h != t; ++h)
+                {
+                    entry& e = entries[h % capacity];
+                    try
+                    {
+                        message m;
+                        m << e.msg;
+                        e.source->writer().write_formatted(m);
+                    }
+                    catch (...)
+                    {
+                        // there is nobody to report the error to
+                    }
+                    e.msg.clear();
+                    head.store(h + 1, std::memory_order_release);
+                }
+                return true;
+            }
+
+            alignas(64) std::atomic<std::size_t> head = 0;
+            alignas(64) std::atomic<std::size_t> tail = 0;
+            entry entries[capacity];
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        class async_writer
+        {
+        public:
+            async_writer()
+              : stop_(false)
+              , sleeping_(false)
+              , thread_([this]() { run(); })
+            {
+                alive().store(true, std::memory_order_release);
+            }
+
+            ~async_writer()
+            {
+                alive().store(false, std::memory_order_release);
+                {
+                    std::lock_guard<std::mutex> l(mtx_);
+                    stop_ = true;
+                }
+                cond_.notify_one();
+                thread_.join();
+
+                // write whatever is left
+                for (auto& buffer : buffers_)
+                    buffer->drain();
+            }
+
+            // is the writer (still) available, it is destroyed during static
+            // destruction
+            static std::atomic<bool>& alive() noexcept
+            {
+                static std::atomic<bool> alive_(false);
+                return alive_;
+            }
+
+            static async_writer& get()
+            {
+                static async_writer writer;
+                return writer;
+            }
+
+            bool write(logger const& source, std::string&& msg)
+            {
+                if (!get_buffer().push(source, HPX_MOVE(msg)))
+                    return false;
+
+                if (sleeping_.load(std::memory_order_seq_cst))
+                {
+                    std::lock_guard<std::mutex> l(mtx_);
+                    cond_.notify_one();
+                }
+                return true;
+            }
+
+            void flush()
+            {
+                if (std::this_thread::get_id() == thread_.get_id())
+                    return;    // a destination logs, don't wait for ourselves
+
+                std::vector<std::pair<std::shared_ptr<async_buffer>,
+                    std::size_t>>
+                    pending;
+                {
+                    std::lock_guard<std::mutex> l(mtx_);
+                    pending.reserve(buffers_.size());
+                    for (auto const& buffer : buffers_)
+                    {
+                        std::size_t const t =
+                            buffer->tail.load(std::memory_order_acquire);
+                        if (buffer->head.load(std::memory_order_acquire) != t)
+                            pending.emplace_back(buffer, t);
+                    }
+                    if (pending.empty())
+                        return;
+                }
+                cond_.notify_one();
+
+                for (auto const& p : pending)
+                {
+                    while (p.first->head.load(std::memory_order_acquire) <
+                        p.second)
+                    {
+                        std::this_thread::yield();
+                    }
+                }
+            }
+
+        private:
+            async_buffer& get_buffer()
+            {
+                // the buffer is released by the writer thread once the
+                // owning thread has exited and all messages were written
+                thread_local std::shared_ptr<async_buffer> buffer;
+                if (!buffer)
+                {
+                    buffer = std::make_shared<async_buffer>();
+
+                    std::lock_guard<std::mutex> l(mtx_);
+                    buffers_.push_back(buffer);
+                }
+                return *buffer;
+            }
+
+            bool drain_all()
+            {
+                std::vector<std::shared_ptr<async_buffer>> buffers;
+                {
+                    std::lock_guard<std::mutex> l(mtx_);
+
+                    // remove the buffers of exited threads
+                    for (auto it = buffers_.begin(); it != buffers_.end();
+                         /**/)
+                    {
+                        if (it->use_count() == 1 && (*it)->empty())
+                            it = buffers_.erase(it);
+                        else
+                            ++it;
+                    }
+                    buffers = buffers_;
+                }
+
+                bool did_work = false;
+                for (auto& buffer : buffers)
+                {
+                    if (buffer->drain())
+                        did_work = true;
+                }
+                return did_work;
+            }
+
+            bool has_pending() const noexcept
+            {
+                for (auto const& buffer : buffers_)
+                {
+                    if (!buffer->empty())
+                        return true;
+                }
+                return false;
+            }
+
+            void run()
+            {
+                while (true)
+                {
+                    if (drain_all())
+                        continue;
+
+                    std::unique_lock<std::mutex> l(mtx_);
+                    if (stop_)
+                        break;
+
+                    // producers notify only if this flag is set, check for
+                    // messages queued before they could see it
+                    sleeping_.store(true, std::memory_order_seq_cst);
+                    if (!has_pending())
+                    {
+                        cond_.wait_for(l, std::chrono::milliseconds(100));
+                    }
+                    sleeping_.store(false, std::memory_order_relaxed);
+                }
+            }
+
+            std::mutex mtx_;
+            std::condition_variable cond_;
+            std::vector<std::shared_ptr<async_buffer>> buffers_;
+            bool stop_;
+            std::atomic<bool> sleeping_;
+            std::thread thread_;
+        };
+    }    // namespace
+
+    ///////////////////////////////////////////////////////////////////////////
+    void start_async_writer()
+    {
+        async_writer::get();
+    }
+
+    bool async_write(logger const& source, std::string formatted)
+    {
+        if (!async_writer::alive().load(std::memory_order_acquire))
+        {
+            // the writer is gone (static destruction), write directly
+            message m;
+            m << formatted;
+            source.writer().write_formatted(m);
+            return true;
+        }
+        return async_writer::get().write(source, HPX_MOVE(formatted));
+    }
+
+    void async_flush()
+    {
+        if (async_writer::alive().load(std::memory_order_acquire))
+            async_writer::get().flush();
+    }
+}}}}    // namespace hpx::util::logging::detail
+
+#endif    // HPX_HAVE_LOGGING
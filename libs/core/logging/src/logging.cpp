@@ -8,10 +8,13 @@
 #include <hpx/config.hpp>
 
 #if defined(HPX_HAVE_LOGGING)
+#include <hpx/logging/detail/async_writer.hpp>
 #include <hpx/modules/filesystem.hpp>
 #include <hpx/modules/logging.hpp>
 #include <hpx/util/from_string.hpp>
 
+#include <atomic>
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
 #include <cstdlib>
@@ -94,6 +97,98 @@ namespace hpx { namespace util { namespace logging {
             m_writer(msg);
     }
 
+    void logger::set_async(bool async)
+    {
+        if (async)
+        {
+            detail::start_async_writer();
+            m_async.store(true, std::memory_order_relaxed);
+        }
+        else if (m_async.exchange(false, std::memory_order_relaxed))
+        {
+            flush();
+        }
+    }
+
+    void logger::flush()
+    {
+        detail::async_flush();
+    }
+
+    void logger::write(message msg)
+    {
+        if (!m_is_caching_off)
+        {
+            m_cache.push_back(HPX_MOVE(msg));
+            return;
+        }
+
+        if (!accept_message())
+        {
+            m_dropped.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+
+        report_dropped_messages();
+        write_message(HPX_MOVE(msg));
+    }
+
+    // The rate limit is applied to windows of one second, the first message
+    // of a new window resets the count.
+    bool logger::accept_message() noexcept
+    {
+        std::size_t const limit = m_rate_limit.load(std::memory_order_relaxed);
+        if (limit == 0)
+            return true;
+
+        std::uint64_t const now =
+            std::chrono::duration_cast<std::chrono::seconds>(
+                std::chrono::steady_clock::now().time_since_epoch())
+                .count();
+
+        std::uint64_t window = m_window.load(std::memory_order_relaxed);
+        if (window != now &&
+            m_window.compare_exchange_strong(
+                window, now, std::memory_order_relaxed))
+        {
+            m_window_count.store(0, std::memory_order_relaxed);
+        }
+
+        return m_window_count.fetch_add(1, std::memory_order_relaxed) < limit;
+    }
+
+    void logger::report_dropped_messages()
+    {
+        std::size_t const dropped = m_dropped.load(std::memory_order_relaxed);
+        std::size_t reported = m_reported.load(std::memory_order_relaxed);
+        if (dropped == reported ||
+            !m_reported.compare_exchange_strong(
+                reported, dropped, std::memory_order_relaxed))
+        {
+            return;
+        }
+
+        message msg;
+        msg << "[logging] " << (dropped - reported)
+            << " message(s) dropped (rate limit or full queue)";
+        write_message(HPX_MOVE(msg));
+    }
+
+    void logger::write_message(message msg)
+    {
+        if (!is_async())
+        {
+            m_writer(msg);
+            return;
+        }
+
+        // the formatters use the context of the calling thread (thread ids,
+        // locality, etc.), only the destinations are invoked asynchronously
+        message formatted = m_writer.format_message(msg);
+        if (!detail::async_write(*this, formatted.full_string()))
+            m_dropped.fetch_add(1, std::memory_order_relaxed);
+    }
+
 }}}    // namespace hpx::util::logging
 
 #endif    // HPX_HAVE_LOGGING
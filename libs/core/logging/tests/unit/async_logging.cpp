@@ -0,0 +1,133 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/modules/logging.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <string>
+#include <thread>
+#include <vector>
+
+using hpx::util::logging::logger;
+using hpx::util::logging::message;
+
+///////////////////////////////////////////////////////////////////////////////
+// collects the messages, it's invoked by one thread at a time only
+struct collect : hpx::util::logging::destination::manipulator
+{
+    explicit collect(std::vector<std::string>* messages)
+      : messages(messages)
+    {
+    }
+
+    void operator()(message const& msg) override
+    {
+        messages->push_back(msg.full_string());
+    }
+
+    std::vector<std::string>* messages;
+};
+
+void init_logger(logger& l, std::vector<std::string>& messages)
+{
+    l.writer().set_destination("collect", collect(&messages));
+    l.writer().write("|", "collect");
+    l.mark_as_initialized();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::vector<std::string> async_messages;
+logger async_log;
+
+void test_async()
+{
+    constexpr std::size_t num_threads = 4;
+    constexpr std::size_t num_messages = 500;    // fits into the queues
+
+    init_logger(async_log, async_messages);
+    async_log.set_async(true);
+    HPX_TEST(async_log.is_async());
+
+    std::vector<std::thread> threads;
+    for (std::size_t t = 0; t != num_threads; ++t)
+    {
+        threads.emplace_back([t]() {
+            for (std::size_t i = 0; i != num_messages; ++i)
+                async_log.gather() << t << "/" << i;
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+
+    async_log.flush();
+
+    HPX_TEST_EQ(async_messages.size(), num_threads * num_messages);
+    HPX_TEST_EQ(async_log.dropped_messages(), std::size_t(0));
+
+    // the messages of each of the threads are written in order
+    std::vector<std::size_t> next(num_threads, 0);
+    for (std::string const& msg : async_messages)
+    {
+        std::size_t const pos = msg.find('/');
+        HPX_TEST_NEQ(pos, std::string::npos);
+
+        std::size_t const t = std::stoul(msg.substr(0, pos));
+        HPX_TEST_LT(t, num_threads);
+        HPX_TEST_EQ(std::stoul(msg.substr(pos + 1)), next[t]++);
+    }
+
+    // turning asynchronous logging off writes everything queued
+    async_log.gather() << "last";
+    async_log.set_async(false);
+    HPX_TEST(!async_log.is_async());
+    HPX_TEST_EQ(async_messages.back(), std::string("last"));
+
+    async_log.gather() << "sync";
+    HPX_TEST_EQ(async_messages.back(), std::string("sync"));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::vector<std::string> limited_messages;
+logger limited_log;
+
+void test_rate_limit()
+{
+    constexpr std::size_t limit = 10;
+    constexpr std::size_t num_messages = 100;
+
+    init_logger(limited_log, limited_messages);
+    limited_log.set_rate_limit(limit);
+    HPX_TEST_EQ(limited_log.get_rate_limit(), limit);
+
+    for (std::size_t i = 0; i != num_messages; ++i)
+        limited_log.gather() << "message " << i;
+
+    // the loop may have crossed into the next second
+    std::size_t const written = limited_messages.size();
+    HPX_TEST_LTE(limit, written);
+    HPX_TEST_LTE(written, 2 * limit + 1);
+    HPX_TEST_LTE(num_messages - written, limited_log.dropped_messages());
+
+    // the number of dropped messages is reported with the next message
+    limited_log.set_rate_limit(0);
+    limited_log.gather() << "final";
+
+    HPX_TEST_LTE(written + 2, limited_messages.size());
+    HPX_TEST_EQ(limited_messages.back(), std::string("final"));
+    HPX_TEST_NEQ(limited_messages[limited_messages.size() - 2].find(
+                     "message(s) dropped"),
+        std::string::npos);
+}
+
+int main()
+{
+    test_async();
+    test_rate_limit();
+
+    return hpx::util::report_errors();
+}
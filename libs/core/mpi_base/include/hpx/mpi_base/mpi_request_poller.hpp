@@ -0,0 +1,112 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if (defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_MPI)) ||      \
+    defined(HPX_HAVE_MODULE_MPI_BASE)
+
+#include <hpx/functional/move_only_function.hpp>
+#include <hpx/mpi_base/mpi.hpp>
+#include <hpx/synchronization/spinlock.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx { namespace util {
+
+    // Keeps track of outstanding MPI requests and invokes a continuation for
+    // each of them once it has completed. The requests are kept in a
+    // contiguous array which is tested using a single call to MPI_Testsome,
+    // which finds all completed requests at once instead of testing the
+    // requests one by one.
+    //
+    // This class does not acquire the lock of the mpi_environment, poll()
+    // has to be called while holding it if MPI is not multi-threaded.
+    class HPX_CORE_EXPORT mpi_request_poller
+    {
+    public:
+        // The continuation receives MPI_SUCCESS or the error code of the
+        // completed request
+        using callback_type = hpx::move_only_function<void(int)>;
+
+        mpi_request_poller() = default;
+
+        mpi_request_poller(mpi_request_poller const&) = delete;
+        mpi_request_poller(mpi_request_poller&&) = delete;
+        mpi_request_poller& operator=(mpi_request_poller const&) = delete;
+        mpi_request_poller& operator=(mpi_request_poller&&) = delete;
+
+        ~mpi_request_poller();
+
+        // Register a request together with the continuation to invoke once
+        // it has completed. This can be called concurrently from any thread,
+        // including from continuations. The request is tested starting with
+        // the next call to poll().
+        void add(MPI_Request request, callback_type&& f);
+
+        // Test all registered requests and invoke the continuations of the
+        // completed ones. Only one thread polls at a time, concurrent calls
+        // return right away. Returns the number of completed requests.
+        std::size_t poll();
+
+        // The number of requests which have not completed yet
+        std::size_t size() const noexcept
+        {
+            return num_pending_.load(std::memory_order_relaxed) +
+                num_active_.load(std::memory_order_relaxed);
+        }
+
+        bool empty() const noexcept
+        {
+            return size() == 0;
+        }
+
+        // The number of requests added since the last call to poll()
+        std::size_t num_pending() const noexcept
+        {
+            return num_pending_.load(std::memory_order_relaxed);
+        }
+
+        // The number of requests which were tested by the last call to poll()
+        // and have not completed yet
+        std::size_t num_active() const noexcept
+        {
+            return num_active_.load(std::memory_order_relaxed);
+        }
+
+    private:
+        using mutex_type = hpx::spinlock;
+
+        // requests added since the last call to poll()
+        mutex_type pending_mtx_;
+        std::vector<MPI_Request> pending_requests_;
+        std::vector<callback_type> pending_callbacks_;
+        std::atomic<std::size_t> num_pending_{0};
+
+        // requests tested by poll(), the continuation for requests_[i] is
+        // callbacks_[i]
+        mutex_type poll_mtx_;
+        std::vector<MPI_Request> requests_;
+        std::vector<callback_type> callbacks_;
+        std::atomic<std::size_t> num_active_{0};
+
+        // buffers passed to MPI_Testsome
+        std::vector<int> indices_;
+        std::vector<MPI_Status> statuses_;
+        std::vector<std::pair<int, int>> completed_;
+    };
+}}    // namespace hpx::util
+
+#include <hpx/config/warnings_suffix.hpp>
+
+#endif
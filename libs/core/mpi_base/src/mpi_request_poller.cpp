@@ -0,0 +1,133 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if (defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_MPI)) ||      \
+    defined(HPX_HAVE_MODULE_MPI_BASE)
+
+#include <hpx/assert.hpp>
+#include <hpx/mpi_base/mpi.hpp>
+#include <hpx/mpi_base/mpi_request_poller.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace util {
+
+    mpi_request_poller::~mpi_request_poller()
+    {
+        HPX_ASSERT_MSG(empty(),
+            "the MPI request poller was destroyed while there are "
+            "outstanding requests");
+    }
+
+    void mpi_request_poller::add(MPI_Request request, callback_type&& f)
+    {
+        std::lock_guard<mutex_type> l(pending_mtx_);
+        pending_requests_.push_back(request);
+        pending_callbacks_.push_back(HPX_MOVE(f));
+        ++num_pending_;
+    }
+
+    std::size_t mpi_request_poller::poll()
+    {
+        std::unique_lock<mutex_type> l(poll_mtx_, std::try_to_lock);
+        if (!l.owns_lock())
+        {
+            return 0;
+        }
+
+        // move the requests added since the last call to the tested ones
+        if (num_pending_.load(std::memory_order_relaxed) != 0)
+        {
+            std::lock_guard<mutex_type> pl(pending_mtx_);
+
+            requests_.insert(requests_.end(), pending_requests_.begin(),
+                pending_requests_.end());
+            std::move(pending_callbacks_.begin(), pending_callbacks_.end(),
+                std::back_inserter(callbacks_));
+
+            num_active_ += pending_requests_.size();
+            num_pending_ -= pending_requests_.size();
+
+            pending_requests_.clear();
+            pending_callbacks_.clear();
+        }
+
+        if (requests_.empty())
+        {
+            return 0;
+        }
+
+        std::size_t const count = requests_.size();
+        indices_.resize(count);
+        statuses_.resize(count);
+
+        int outcount = 0;
+        int const result = MPI_Testsome(static_cast<int>(count),
+            requests_.data(), &outcount, indices_.data(), statuses_.data());
+
+        // MPI_UNDEFINED is returned if all requests are inactive
+        if (outcount == MPI_UNDEFINED || outcount == 0)
+        {
+            return 0;
+        }
+
+        // If some requests failed, their error codes are reported in the
+        // statuses only.
+        completed_.clear();
+        for (int i = 0; i != outcount; ++i)
+        {
+            completed_.emplace_back(indices_[std::size_t(i)],
+                result == MPI_ERR_IN_STATUS ?
+                    statuses_[std::size_t(i)].MPI_ERROR :
+                    result);
+        }
+
+        // Remove the completed requests starting with the largest index. This
+        // keeps the arrays contiguous as each removed entry is replaced by
+        // the last one, which has not completed.
+        std::sort(completed_.begin(), completed_.end(),
+            std::greater<std::pair<int, int>>());
+
+        std::vector<std::pair<callback_type, int>> ready;
+        ready.reserve(completed_.size());
+        for (auto const& c : completed_)
+        {
+            std::size_t const index = std::size_t(c.first);
+            HPX_ASSERT(index < requests_.size());
+
+            ready.emplace_back(HPX_MOVE(callbacks_[index]), c.second);
+
+            if (index != requests_.size() - 1)
+            {
+                requests_[index] = requests_.back();
+                callbacks_[index] = HPX_MOVE(callbacks_.back());
+            }
+            requests_.pop_back();
+            callbacks_.pop_back();
+        }
+        num_active_ = requests_.size();
+
+        // the continuations are invoked without holding the lock, they may
+        // add new requests or poll themselves
+        l.unlock();
+
+        for (auto& r : ready)
+        {
+            r.first(r.second);
+        }
+        return ready.size();
+    }
+}}    // namespace hpx::util
+
+#endif
@@ -16,11 +16,17 @@
 
 #include <hpx/functional/detail/invoke.hpp>
 #include <hpx/futures/future.hpp>
+#include <hpx/futures/promise.hpp>
 #include <hpx/modules/async_local.hpp>
+#include <hpx/synchronization/spinlock.hpp>
+#include <hpx/synchronization/stop_token.hpp>
 
 #include <cstddef>
 #include <exception>
+#include <memory>
+#include <mutex>
 #include <stdexcept>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -94,6 +100,222 @@ namespace hpx { namespace resiliency { namespace experimental {
                 },
                 HPX_MOVE(results));
         }
+
+        ///////////////////////////////////////////////////////////////////////
+        // The replicas may accept a stop_token as their first argument, which
+        // is signaled once the result has been determined.
+        template <typename F, typename... Ts>
+        struct replica_result
+          : std::conditional_t<
+                hpx::is_invocable_v<hpx::util::decay_unwrap_t<F>&,
+                    hpx::stop_token, hpx::util::decay_unwrap_t<Ts>&...>,
+                hpx::util::detail::invoke_deferred_result<F, hpx::stop_token,
+                    Ts...>,
+                hpx::util::detail::invoke_deferred_result<F, Ts...>>
+        {
+        };
+
+        template <typename F, typename... Ts>
+        decltype(auto) invoke_replica(
+            hpx::stop_token const& token, F& f, Ts&... ts)
+        {
+            if constexpr (hpx::is_invocable_v<F&, hpx::stop_token, Ts&...>)
+            {
+                return HPX_INVOKE(f, token, ts...);
+            }
+            else
+            {
+                return HPX_INVOKE(f, ts...);
+            }
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // Collects the results of the replicas until either quorum valid
+        // results are available or all replicas have finished.
+        template <typename Result, typename Vote, typename Pred>
+        class replicate_quorum_state
+        {
+            using mutex_type = hpx::spinlock;
+
+        public:
+            template <typename Vote_, typename Pred_>
+            replicate_quorum_state(
+                std::size_t n, std::size_t quorum, Vote_&& vote, Pred_&& pred)
+              : n_(n)
+              , quorum_(quorum)
+              , vote_(HPX_FORWARD(Vote_, vote))
+              , pred_(HPX_FORWARD(Pred_, pred))
+            {
+                valid_results_.reserve(quorum);
+            }
+
+            hpx::stop_token get_stop_token() const noexcept
+            {
+                return stop_.get_token();
+            }
+
+            hpx::future<Result> get_future()
+            {
+                return promise_.get_future();
+            }
+
+            void set_value(Result&& result)
+            {
+                std::unique_lock<mutex_type> l(mtx_);
+                if (done_)
+                {
+                    return;
+                }
+
+                ++completed_;
+                try
+                {
+                    if (HPX_INVOKE(pred_, result))
+                    {
+                        valid_results_.emplace_back(HPX_MOVE(result));
+                    }
+                }
+                catch (...)
+                {
+                    if (!ex_)
+                    {
+                        ex_ = std::current_exception();
+                    }
+                }
+
+                if (valid_results_.size() == quorum_ || completed_ == n_)
+                {
+                    finish(l);
+                }
+            }
+
+            void set_exception(std::exception_ptr ex, bool abort)
+            {
+                std::unique_lock<mutex_type> l(mtx_);
+                if (done_)
+                {
+                    return;
+                }
+
+                ++completed_;
+                if (abort)
+                {
+                    // abort_replicate_exception ends the replication
+                    valid_results_.clear();
+                    ex_ = HPX_MOVE(ex);
+                    finish(l);
+                    return;
+                }
+
+                if (!ex_)
+                {
+                    ex_ = HPX_MOVE(ex);
+                }
+                if (completed_ == n_)
+                {
+                    finish(l);
+                }
+            }
+
+        private:
+            void finish(std::unique_lock<mutex_type>& l)
+            {
+                done_ = true;
+                std::vector<Result> valid_results = HPX_MOVE(valid_results_);
+                std::exception_ptr ex = HPX_MOVE(ex_);
+                l.unlock();
+
+                // the remaining replicas are not needed anymore
+                stop_.request_stop();
+
+                try
+                {
+                    if (!valid_results.empty())
+                    {
+                        promise_.set_value(
+                            HPX_INVOKE(vote_, HPX_MOVE(valid_results)));
+                    }
+                    else if (ex)
+                    {
+                        promise_.set_exception(HPX_MOVE(ex));
+                    }
+                    else
+                    {
+                        // throw aborting exception no correct results were
+                        // produced
+                        throw abort_replicate_exception{};
+                    }
+                }
+                catch (...)
+                {
+                    promise_.set_exception(std::current_exception());
+                }
+            }
+
+            std::size_t const n_;
+            std::size_t const quorum_;
+            std::decay_t<Vote> vote_;
+            std::decay_t<Pred> pred_;
+
+            mutex_type mtx_;
+            std::size_t completed_ = 0;
+            bool done_ = false;
+            std::vector<Result> valid_results_;
+            std::exception_ptr ex_;
+
+            hpx::stop_source stop_;
+            hpx::promise<Result> promise_;
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        template <typename Vote, typename Pred, typename F, typename... Ts>
+        hpx::future<typename replica_result<F, Ts...>::type>
+        async_replicate_vote_validate_quorum(std::size_t n, std::size_t quorum,
+            Vote&& vote, Pred&& pred, F&& f, Ts&&... ts)
+        {
+            using result_type = typename replica_result<F, Ts...>::type;
+            using state_type =
+                replicate_quorum_state<result_type, Vote, Pred>;
+
+            if (quorum == 0 || quorum > n)
+            {
+                quorum = n;
+            }
+
+            auto state = std::make_shared<state_type>(n, quorum,
+                HPX_FORWARD(Vote, vote), HPX_FORWARD(Pred, pred));
+            hpx::future<result_type> result = state->get_future();
+
+            // launch given function n times, every replica gets its own copy
+            // of the function and the arguments
+            for (std::size_t i = 0; i != n; ++i)
+            {
+                hpx::async([state, f, ts...]() mutable {
+                    hpx::stop_token token = state->get_stop_token();
+
+                    // the result is known already, skip this replica
+                    if (token.stop_requested())
+                    {
+                        return;
+                    }
+
+                    try
+                    {
+                        state->set_value(invoke_replica(token, f, ts...));
+                    }
+                    catch (abort_replicate_exception const&)
+                    {
+                        state->set_exception(std::current_exception(), true);
+                    }
+                    catch (...)
+                    {
+                        state->set_exception(std::current_exception(), false);
+                    }
+                });
+            }
+
+            return result;
+        }
     }    // namespace detail
 
     ///////////////////////////////////////////////////////////////////////////
@@ -155,4 +377,49 @@ namespace hpx { namespace resiliency { namespace experimental {
             detail::replicate_voter{}, detail::replicate_validator{},
             HPX_FORWARD(F, f), HPX_FORWARD(Ts, ts)...);
     }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Asynchronously launch given function \a f exactly \a n times. Verify
+    // the result of those invocations using the given predicate \a pred.
+    // Run the first \a quorum valid results against a user provided voting
+    // function as soon as they are available and cancel the remaining
+    // replicas: replicas which have not started yet return right away,
+    // running replicas which accept a stop_token as their first argument are
+    // signaled through it. Return the valid output.
+    template <typename Vote, typename Pred, typename F, typename... Ts>
+    hpx::future<typename detail::replica_result<F, Ts...>::type> tag_invoke(
+        async_replicate_vote_validate_quorum_t, std::size_t n,
+        std::size_t quorum, Vote&& vote, Pred&& pred, F&& f, Ts&&... ts)
+    {
+        return detail::async_replicate_vote_validate_quorum(n, quorum,
+            HPX_FORWARD(Vote, vote), HPX_FORWARD(Pred, pred),
+            HPX_FORWARD(F, f), HPX_FORWARD(Ts, ts)...);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Asynchronously launch given function \a f exactly \a n times. Verify
+    // the result of those invocations using the given predicate \a pred.
+    // Return the first valid result and cancel the remaining replicas.
+    template <typename Pred, typename F, typename... Ts>
+    hpx::future<typename detail::replica_result<F, Ts...>::type> tag_invoke(
+        async_replicate_validate_first_t, std::size_t n, Pred&& pred, F&& f,
+        Ts&&... ts)
+    {
+        return detail::async_replicate_vote_validate_quorum(n, 1,
+            detail::replicate_voter{}, HPX_FORWARD(Pred, pred),
+            HPX_FORWARD(F, f), HPX_FORWARD(Ts, ts)...);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Asynchronously launch given function \a f exactly \a n times. Verify
+    // the result of those invocations by checking for exception.
+    // Return the first valid result and cancel the remaining replicas.
+    template <typename F, typename... Ts>
+    hpx::future<typename detail::replica_result<F, Ts...>::type> tag_invoke(
+        async_replicate_first_t, std::size_t n, F&& f, Ts&&... ts)
+    {
+        return detail::async_replicate_vote_validate_quorum(n, 1,
+            detail::replicate_voter{}, detail::replicate_validator{},
+            HPX_FORWARD(F, f), HPX_FORWARD(Ts, ts)...);
+    }
 }}}    // namespace hpx::resiliency::experimental
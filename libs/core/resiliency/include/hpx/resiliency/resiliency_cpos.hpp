@@ -117,6 +117,38 @@ namespace hpx { namespace resiliency { namespace experimental {
     {
     } async_replicate{};
 
+    ///////////////////////////////////////////////////////////////////////////
+    /// Customization point for asynchronously launching the given function \a f
+    /// exactly \a n times concurrently. Verify the result of those invocations
+    /// using the given predicate \a pred. As soon as \a quorum valid results
+    /// are available, run them against a user provided voting function and
+    /// cancel the remaining replicas.
+    /// Return the valid output.
+    inline constexpr struct async_replicate_vote_validate_quorum_t final
+      : hpx::functional::tag<async_replicate_vote_validate_quorum_t>
+    {
+    } async_replicate_vote_validate_quorum{};
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Customization point for asynchronously launching the given function \a f
+    /// exactly \a n times concurrently. Verify the result of those invocations
+    /// using the given predicate \a pred.
+    /// Return the first valid result and cancel the remaining replicas.
+    inline constexpr struct async_replicate_validate_first_t final
+      : hpx::functional::tag<async_replicate_validate_first_t>
+    {
+    } async_replicate_validate_first{};
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Customization point for asynchronously launching the given function \a f
+    /// exactly \a n times concurrently. Verify the result of those invocations
+    /// by checking for exception.
+    /// Return the first valid result and cancel the remaining replicas.
+    inline constexpr struct async_replicate_first_t final
+      : hpx::functional::tag<async_replicate_first_t>
+    {
+    } async_replicate_first{};
+
     /// Customization point for asynchronously launching the given function \a f
     /// exactly \a n times concurrently. Run all the valid results against a
     /// user provided voting function.
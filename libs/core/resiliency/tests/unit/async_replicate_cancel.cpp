@@ -0,0 +1,177 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// This test verifies that async_replicate_first and friends return as soon as
+// enough valid results are available and cancel the remaining replicas.
+
+#include <hpx/local/init.hpp>
+#include <hpx/modules/futures.hpp>
+#include <hpx/modules/resiliency.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/resiliency/async_replicate.hpp>
+#include <hpx/synchronization/stop_token.hpp>
+#include <hpx/thread.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+
+std::atomic<int> answer(35);
+
+struct vogon_exception : std::exception
+{
+};
+
+int universal_answer()
+{
+    return ++answer;
+}
+
+bool validate(int result)
+{
+    return result == 42;
+}
+
+int no_answer()
+{
+    throw hpx::resiliency::experimental::abort_replicate_exception();
+}
+
+int always_fails()
+{
+    throw vogon_exception();
+}
+
+// the first replica produces the result, the others run for a long time
+// unless they are stopped
+std::atomic<int> replica_id(0);
+std::atomic<int> running(0);
+
+int cancellable_answer(hpx::stop_token token)
+{
+    if (replica_id++ == 0)
+    {
+        // give the other replicas a chance to start
+        hpx::this_thread::sleep_for(std::chrono::milliseconds(100));
+        return 42;
+    }
+
+    ++running;
+    auto const until =
+        std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (!token.stop_requested() && std::chrono::steady_clock::now() < until)
+    {
+        hpx::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    --running;
+    return 41;
+}
+
+int vote_max(std::vector<int>&& results)
+{
+    int result = results.front();
+    for (int r : results)
+    {
+        result = (std::max)(result, r);
+    }
+    return result;
+}
+
+int hpx_main()
+{
+    namespace exp = hpx::resiliency::experimental;
+
+    {
+        // successful replicate_first
+        hpx::future<int> f = exp::async_replicate_first(10, &universal_answer);
+        HPX_TEST(f.get() > 35);
+
+        // successful replicate_validate_first
+        answer = 35;
+        f = exp::async_replicate_validate_first(
+            10, &validate, &universal_answer);
+        HPX_TEST_EQ(f.get(), 42);
+
+        // the quorum is voted upon
+        answer = 35;
+        f = exp::async_replicate_vote_validate_quorum(
+            10, 3, &vote_max, [](int) { return true; }, &universal_answer);
+        HPX_TEST(f.get() > 37);
+    }
+
+    {
+        // the first valid result cancels the long running replicas
+        auto const start = std::chrono::steady_clock::now();
+
+        hpx::future<int> f = exp::async_replicate_validate_first(
+            4, &validate, &cancellable_answer);
+        HPX_TEST_EQ(f.get(), 42);
+
+        // all losing replicas have either been skipped or were stopped
+        while (running.load() != 0 &&
+            std::chrono::steady_clock::now() - start < std::chrono::seconds(5))
+        {
+            hpx::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        HPX_TEST_EQ(running.load(), 0);
+        HPX_TEST(std::chrono::steady_clock::now() - start <
+            std::chrono::seconds(10));
+    }
+
+    {
+        // unsuccessful replicate_first reports the exception
+        hpx::future<int> f = exp::async_replicate_first(6, &always_fails);
+
+        bool exception_caught = false;
+        try
+        {
+            f.get();
+        }
+        catch (vogon_exception const&)
+        {
+            exception_caught = true;
+        }
+        catch (...)
+        {
+            HPX_TEST(false);
+        }
+        HPX_TEST(exception_caught);
+    }
+
+    {
+        // aborted replicate_first
+        hpx::future<int> f = exp::async_replicate_first(1, &no_answer);
+
+        bool exception_caught = false;
+        try
+        {
+            f.get();
+        }
+        catch (exp::abort_replicate_exception const&)
+        {
+            exception_caught = true;
+        }
+        catch (...)
+        {
+            HPX_TEST(false);
+        }
+        HPX_TEST(exception_caught);
+    }
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // Initialize and run HPX
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
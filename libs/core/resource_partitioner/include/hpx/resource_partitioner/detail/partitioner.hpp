@@ -70,6 +70,9 @@ namespace hpx { namespace resource { namespace detail {
         std::size_t num_threads_;
         hpx::threads::policies::scheduler_mode mode_;
         scheduler_function create_function_;
+
+        // the pool the idle worker threads of this pool execute work of
+        std::string lend_workers_to_;
     };
 
     ///////////////////////////////////////////////////////////////////////
@@ -148,6 +151,11 @@ namespace hpx { namespace resource { namespace detail {
         hpx::threads::policies::scheduler_mode get_scheduler_mode(
             std::size_t pool_index) const;
 
+        // let the idle worker threads of one pool execute the work of another
+        void lend_workers(
+            std::string const& pool_name, std::string const& target_pool_name);
+        std::string get_lending_target(std::size_t pool_index) const;
+
         std::string const& get_pool_name(std::size_t index) const;
         std::size_t get_pool_index(std::string const& pool_name) const;
 
@@ -194,6 +202,7 @@ namespace hpx { namespace resource { namespace detail {
         ////////////////////////////////////////////////////////////////////////
         // called in hpx_init run_or_start
         void setup_pools();
+        void setup_polling_pool(std::size_t num_threads);
         void setup_schedulers();
         void reconfigure_affinities();
         void reconfigure_affinities_locked();
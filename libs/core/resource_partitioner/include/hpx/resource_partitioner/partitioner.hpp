@@ -161,6 +161,12 @@ namespace hpx { namespace resource {
 
         HPX_CORE_EXPORT const std::string& get_default_pool_name() const;
 
+        // Let the idle worker threads of the pool 'pool_name' execute work of
+        // the pool 'target_pool_name'. Work of their own pool always takes
+        // precedence, pools without this setting never run foreign work.
+        HPX_CORE_EXPORT void lend_workers(
+            std::string const& pool_name, std::string const& target_pool_name);
+
         ///////////////////////////////////////////////////////////////////////
         // Functions to add processing units to thread pools via
         // the pu/core/numa_domain API
@@ -149,6 +149,12 @@ namespace hpx { namespace resource { namespace detail {
         case resource::shared_priority:
             sched = "shared_priority";
             break;
+        case resource::local_workrequesting_fifo:
+            sched = "local_workrequesting_fifo";
+            break;
+        case resource::local_workrequesting_lifo:
+            sched = "local_workrequesting_lifo";
+            break;
         }
 
         os << "\"" << sched << "\" is running on PUs : \n";
@@ -379,6 +385,14 @@ namespace hpx { namespace resource { namespace detail {
     // -2 checks whether there are empty pools
     void partitioner::setup_pools()
     {
+        // Dedicate some of the free resources to running the background work
+        std::size_t const polling_threads = util::get_entry_as<std::size_t>(
+            rtcfg_, "hpx.threadpools.polling_pool_size", 0);
+        if (polling_threads != 0)
+        {
+            setup_polling_pool(polling_threads);
+        }
+
         // Assign all free resources to the default pool
         bool first = true;
         for (hpx::resource::numa_domain& d : numa_domains_)
@@ -426,6 +440,57 @@ namespace hpx { namespace resource { namespace detail {
         //! FIXME add allow-empty-pools policy. Wait, does this even make sense??
     }
 
+    // Create the pool 'polling' running the network background work and the
+    // registered (MPI, CUDA) polling functions on the last free processing
+    // units in a tight loop, the other pools don't run any background work.
+    void partitioner::setup_polling_pool(std::size_t num_threads)
+    {
+        std::vector<pu const*> free_pus;
+        for (hpx::resource::numa_domain const& d : numa_domains_)
+        {
+            for (hpx::resource::core const& c : d.cores_)
+            {
+                for (hpx::resource::pu const& p : c.pus_)
+                {
+                    if (p.thread_occupancy_count_ == 0)
+                    {
+                        free_pus.push_back(&p);
+                    }
+                }
+            }
+        }
+
+        // leave at least one processing unit to the default pool
+        if (free_pus.size() <= num_threads)
+        {
+            throw_runtime_error("partitioner::setup_polling_pool",
+                hpx::util::format("{} polling threads were requested, but "
+                                  "only {} processing units are left for "
+                                  "the default pool and the polling pool",
+                    num_threads, free_pus.size()));
+        }
+
+        create_thread_pool("polling", scheduling_policy::local_priority_fifo,
+            threads::policies::scheduler_mode::do_background_work |
+                threads::policies::scheduler_mode::delay_exit);
+
+        for (std::size_t i = free_pus.size() - num_threads;
+             i != free_pus.size(); ++i)
+        {
+            add_resource(*free_pus[i], "polling");
+        }
+
+        std::lock_guard<mutex_type> l(mtx_);
+        for (detail::init_pool_data& pool : initial_thread_pools_)
+        {
+            if (pool.pool_name_ != "polling")
+            {
+                pool.mode_ = threads::policies::scheduler_mode(pool.mode_ &
+                    ~threads::policies::scheduler_mode::do_background_work);
+            }
+        }
+    }
+
     // This function is called in hpx_init, before the instantiation of the runtime
     // It takes care of configuring some internal parameters of the resource partitioner
     // related to the pools' schedulers
@@ -475,6 +540,18 @@ namespace hpx { namespace resource { namespace detail {
         {
             default_scheduler = scheduling_policy::shared_priority;
         }
+        else if (0 ==
+            std::string("local-workrequesting-fifo")
+                .find(default_scheduler_str))
+        {
+            default_scheduler = scheduling_policy::local_workrequesting_fifo;
+        }
+        else if (0 ==
+            std::string("local-workrequesting-lifo")
+                .find(default_scheduler_str))
+        {
+            default_scheduler = scheduling_policy::local_workrequesting_lifo;
+        }
         else
         {
             throw hpx::detail::command_line_error(
@@ -830,6 +907,30 @@ namespace hpx { namespace resource { namespace detail {
         return get_pool_data(l, pool_index).mode_;
     }
 
+    void partitioner::lend_workers(
+        std::string const& pool_name, std::string const& target_pool_name)
+    {
+        if (pool_name == target_pool_name ||
+            (target_pool_name == "default" &&
+                pool_name == get_default_pool_name()))
+        {
+            throw_invalid_argument("partitioner::lend_workers",
+                "a thread pool can't lend its worker threads to itself ('" +
+                    pool_name + "')");
+        }
+
+        std::size_t const index = get_pool_index(pool_name);
+
+        std::lock_guard<mutex_type> l(mtx_);
+        initial_thread_pools_[index].lend_workers_to_ = target_pool_name;
+    }
+
+    std::string partitioner::get_lending_target(std::size_t pool_index) const
+    {
+        std::unique_lock<mutex_type> l(mtx_);
+        return get_pool_data(l, pool_index).lend_workers_to_;
+    }
+
     detail::init_pool_data const& partitioner::get_pool_data(
         std::unique_lock<mutex_type>& l, std::size_t pool_index) const
     {
@@ -161,6 +161,12 @@ namespace hpx { namespace resource {
         return partitioner_.get_default_pool_name();
     }
 
+    void partitioner::lend_workers(
+        std::string const& pool_name, std::string const& target_pool_name)
+    {
+        partitioner_.lend_workers(pool_name, target_pool_name);
+    }
+
     void partitioner::add_resource(pu const& p, std::string const& pool_name,
         bool exclusive, std::size_t num_threads /*= 1*/)
     {
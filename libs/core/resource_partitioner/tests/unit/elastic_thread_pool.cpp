@@ -0,0 +1,202 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify that an elastic_thread_pool suspends the processing units of an idle
+// pool and resumes them when work is queued.
+
+#include <hpx/assert.hpp>
+#include <hpx/local/chrono.hpp>
+#include <hpx/local/execution.hpp>
+#include <hpx/local/future.hpp>
+#include <hpx/local/init.hpp>
+#include <hpx/local/thread.hpp>
+#include <hpx/modules/resource_partitioner.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/thread_pool_util/thread_pool_elasticity.hpp>
+#include <hpx/threading_base/scheduler_mode.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+std::size_t const max_threads = (std::min)(
+    std::size_t(4), std::size_t(hpx::threads::hardware_concurrency()));
+
+///////////////////////////////////////////////////////////////////////////////
+void test_adjust(hpx::threads::thread_pool_base& tp)
+{
+    std::size_t const num_threads = tp.get_os_thread_count();
+
+    hpx::threads::elasticity_parameters params;
+    params.interval = std::chrono::steady_clock::duration::zero();
+    params.shrink_delay = 1;
+
+    hpx::threads::elastic_thread_pool elastic(tp, params);
+    HPX_TEST_EQ(elastic.get_active_processing_units(), num_threads);
+
+    // the idle pool shrinks down to a single processing unit
+    hpx::chrono::high_resolution_timer t;
+    while (elastic.get_active_processing_units() != 1 && t.elapsed() < 10.0)
+    {
+        elastic.adjust();
+        hpx::this_thread::yield();
+    }
+    HPX_TEST_EQ(elastic.get_active_processing_units(), std::size_t(1));
+    HPX_TEST_EQ(tp.get_active_os_thread_count(), std::size_t(1));
+
+    // queued work makes it grow up to all processing units
+    std::atomic<bool> release(false);
+    hpx::execution::parallel_executor exec(&tp);
+
+    std::vector<hpx::future<void>> tasks;
+    for (std::size_t i = 0; i != 100; ++i)
+    {
+        tasks.push_back(hpx::async(exec, [&release]() {
+            while (!release.load())
+            {
+                // keep the processing unit busy
+            }
+        }));
+    }
+
+    t.restart();
+    while (elastic.get_active_processing_units() != num_threads &&
+        t.elapsed() < 10.0)
+    {
+        elastic.adjust();
+        hpx::this_thread::yield();
+    }
+    HPX_TEST_EQ(elastic.get_active_processing_units(), num_threads);
+    HPX_TEST_EQ(tp.get_active_os_thread_count(), num_threads);
+
+    release = true;
+    hpx::wait_all(tasks);
+}
+
+void test_periodic(hpx::threads::thread_pool_base& tp)
+{
+    std::size_t const num_threads = tp.get_os_thread_count();
+    std::size_t const min_threads = (std::min)(std::size_t(2), num_threads);
+
+    {
+        hpx::threads::elasticity_parameters params;
+        params.interval = std::chrono::milliseconds(1);
+        params.min_processing_units = min_threads;
+
+        hpx::threads::elastic_thread_pool elastic(tp, params);
+
+        hpx::chrono::high_resolution_timer t;
+        while (elastic.get_active_processing_units() != min_threads &&
+            t.elapsed() < 10.0)
+        {
+            hpx::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        HPX_TEST_EQ(elastic.get_active_processing_units(), min_threads);
+
+        // work still runs on the remaining processing units
+        std::vector<hpx::future<void>> tasks;
+        hpx::execution::parallel_executor exec(&tp);
+        for (std::size_t i = 0; i != 1000; ++i)
+        {
+            tasks.push_back(hpx::async(exec, []() {}));
+        }
+        hpx::wait_all(tasks);
+    }
+
+    // all processing units are resumed on destruction
+    HPX_TEST_EQ(tp.get_active_os_thread_count(), num_threads);
+}
+
+void test_max_processing_units(hpx::threads::thread_pool_base& tp)
+{
+    std::size_t const num_threads = tp.get_os_thread_count();
+
+    {
+        hpx::threads::elasticity_parameters params;
+        params.interval = std::chrono::steady_clock::duration::zero();
+        params.max_processing_units = 1;
+
+        hpx::threads::elastic_thread_pool elastic(tp, params);
+        HPX_TEST_EQ(elastic.get_active_processing_units(), std::size_t(1));
+        HPX_TEST_EQ(tp.get_active_os_thread_count(), std::size_t(1));
+
+        elastic.stop();
+        HPX_TEST_EQ(elastic.get_active_processing_units(), num_threads);
+    }
+
+    HPX_TEST_EQ(tp.get_active_os_thread_count(), num_threads);
+}
+
+void test_elasticity_disabled()
+{
+    hpx::threads::thread_pool_base& tp =
+        hpx::resource::get_thread_pool("default");
+    if (tp.get_scheduler()->has_scheduler_mode(
+            hpx::threads::policies::scheduler_mode::enable_elasticity))
+    {
+        return;
+    }
+
+    hpx::error_code ec(hpx::throwmode::lightweight);
+    hpx::threads::elastic_thread_pool elastic(
+        tp, hpx::threads::elasticity_parameters(), ec);
+    HPX_TEST(ec);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    hpx::threads::thread_pool_base& tp =
+        hpx::resource::get_thread_pool("worker");
+
+    test_adjust(tp);
+    test_periodic(tp);
+    test_max_processing_units(tp);
+    test_elasticity_disabled();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_ASSERT(max_threads >= 2);
+
+    hpx::local::init_params init_args;
+
+    init_args.cfg = {"hpx.os_threads=" + std::to_string(max_threads)};
+    init_args.rp_callback = [](auto& rp,
+                                hpx::program_options::variables_map const&) {
+        rp.create_thread_pool("worker",
+            hpx::resource::scheduling_policy::local_priority_fifo,
+            hpx::threads::policies::scheduler_mode::default_ |
+                hpx::threads::policies::scheduler_mode::enable_elasticity);
+
+        std::size_t const worker_pool_threads = max_threads - 1;
+        std::size_t worker_pool_threads_added = 0;
+
+        for (hpx::resource::numa_domain const& d : rp.numa_domains())
+        {
+            for (hpx::resource::core const& c : d.cores())
+            {
+                for (hpx::resource::pu const& p : c.pus())
+                {
+                    if (worker_pool_threads_added < worker_pool_threads)
+                    {
+                        rp.add_resource(p, "worker");
+                        ++worker_pool_threads_added;
+                    }
+                }
+            }
+        }
+    };
+
+    HPX_TEST_EQ(hpx::local::init(hpx_main, argc, argv, init_args), 0);
+
+    return hpx::util::report_errors();
+}
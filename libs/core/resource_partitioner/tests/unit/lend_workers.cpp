@@ -0,0 +1,126 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify that the idle worker threads of the default pool execute the work of
+// a pool they are lent to, while the worker threads of that pool never run
+// work of the default pool.
+
+#include <hpx/assert.hpp>
+#include <hpx/local/chrono.hpp>
+#include <hpx/local/execution.hpp>
+#include <hpx/local/future.hpp>
+#include <hpx/local/init.hpp>
+#include <hpx/local/thread.hpp>
+#include <hpx/modules/resource_partitioner.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <string>
+#include <thread>
+#include <vector>
+
+std::size_t const max_threads = (std::min)(
+    std::size_t(4), std::size_t(hpx::threads::hardware_concurrency()));
+
+///////////////////////////////////////////////////////////////////////////////
+// The tasks can only all run at the same time if the default pool lends its
+// worker threads to the single threaded worker pool.
+void test_lending(hpx::threads::thread_pool_base& tp, std::thread::id worker)
+{
+    std::size_t const num_tasks = max_threads;
+
+    std::atomic<std::size_t> arrived(0);
+    std::atomic<std::size_t> lent(0);
+    hpx::execution::parallel_executor exec(&tp);
+
+    std::vector<hpx::future<void>> tasks;
+    for (std::size_t i = 0; i != num_tasks; ++i)
+    {
+        tasks.push_back(hpx::async(exec, [&]() {
+            if (std::this_thread::get_id() != worker)
+            {
+                ++lent;
+            }
+
+            ++arrived;
+            hpx::chrono::high_resolution_timer t;
+            while (arrived.load() != num_tasks && t.elapsed() < 10.0)
+            {
+                // block the worker thread
+            }
+        }));
+    }
+    hpx::wait_all(tasks);
+
+    HPX_TEST_EQ(arrived.load(), num_tasks);
+    HPX_TEST_EQ(lent.load(), num_tasks - 1);
+}
+
+// The worker pool does not lend its worker thread to the default pool.
+void test_isolation(std::thread::id worker)
+{
+    std::atomic<std::size_t> foreign(0);
+
+    std::vector<hpx::future<void>> tasks;
+    for (std::size_t i = 0; i != 1000; ++i)
+    {
+        tasks.push_back(hpx::async([&]() {
+            if (std::this_thread::get_id() == worker)
+            {
+                ++foreign;
+            }
+            hpx::chrono::high_resolution_timer t;
+            while (t.elapsed() < 0.0001)
+            {
+                // keep the worker thread busy for a while
+            }
+        }));
+    }
+    hpx::wait_all(tasks);
+
+    HPX_TEST_EQ(foreign.load(), std::size_t(0));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    hpx::threads::thread_pool_base& tp =
+        hpx::resource::get_thread_pool("worker");
+    HPX_TEST_EQ(tp.get_os_thread_count(), std::size_t(1));
+
+    std::thread::id const worker = tp.get_os_thread_handle(0).get_id();
+
+    for (int i = 0; i != 10; ++i)
+    {
+        test_lending(tp, worker);
+        test_isolation(worker);
+    }
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_ASSERT(max_threads >= 2);
+
+    hpx::local::init_params init_args;
+
+    init_args.cfg = {"hpx.os_threads=" + std::to_string(max_threads)};
+    init_args.rp_callback = [](auto& rp,
+                                hpx::program_options::variables_map const&) {
+        rp.create_thread_pool("worker",
+            hpx::resource::scheduling_policy::local_priority_fifo);
+        rp.add_resource(rp.numa_domains()[0].cores()[0].pus()[0], "worker");
+
+        rp.lend_workers("default", "worker");
+    };
+
+    HPX_TEST_EQ(hpx::local::init(hpx_main, argc, argv, init_args), 0);
+
+    return hpx::util::report_errors();
+}
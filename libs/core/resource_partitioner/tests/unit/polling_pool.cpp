@@ -0,0 +1,71 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify that hpx.threadpools.polling_pool_size creates a dedicated pool
+// running the background work, and that the other pools don't run it.
+
+#include <hpx/assert.hpp>
+#include <hpx/local/execution.hpp>
+#include <hpx/local/future.hpp>
+#include <hpx/local/init.hpp>
+#include <hpx/modules/resource_partitioner.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/threading_base/scheduler_base.hpp>
+#include <hpx/threading_base/scheduler_mode.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+std::size_t const max_threads = (std::min)(
+    std::size_t(4), std::size_t(hpx::threads::hardware_concurrency()));
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    using hpx::threads::policies::scheduler_mode;
+
+    HPX_TEST(hpx::resource::pool_exists("polling"));
+
+    hpx::threads::thread_pool_base& polling =
+        hpx::resource::get_thread_pool("polling");
+    HPX_TEST_EQ(&hpx::resource::get_polling_thread_pool(), &polling);
+    HPX_TEST_EQ(polling.get_os_thread_count(), std::size_t(1));
+    HPX_TEST(polling.get_scheduler()->has_scheduler_mode(
+        scheduler_mode::do_background_work));
+
+    hpx::threads::thread_pool_base& def =
+        hpx::resource::get_thread_pool("default");
+    HPX_TEST_EQ(def.get_os_thread_count(), max_threads - 1);
+    HPX_TEST(!def.get_scheduler()->has_scheduler_mode(
+        scheduler_mode::do_background_work));
+
+    // both pools still run work
+    std::vector<hpx::future<void>> tasks;
+    hpx::execution::parallel_executor exec(&polling);
+    for (std::size_t i = 0; i != 100; ++i)
+    {
+        tasks.push_back(hpx::async(exec, []() {}));
+        tasks.push_back(hpx::async([]() {}));
+    }
+    hpx::wait_all(tasks);
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_ASSERT(max_threads >= 2);
+
+    hpx::local::init_params init_args;
+    init_args.cfg = {"hpx.os_threads=" + std::to_string(max_threads),
+        "hpx.threadpools.polling_pool_size=1"};
+
+    HPX_TEST_EQ(hpx::local::init(hpx_main, argc, argv, init_args), 0);
+
+    return hpx::util::report_errors();
+}
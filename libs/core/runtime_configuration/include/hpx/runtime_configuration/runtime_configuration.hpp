@@ -109,9 +109,20 @@ namespace hpx { namespace util {
         bool enable_spinlock_deadlock_detection() const;
         std::size_t get_spinlock_deadlock_detection_limit() const;
 
+        // limits for running future continuations inline
+        std::size_t get_continuation_max_recursion_depth() const;
+        std::size_t get_continuation_stack_budget() const;
+
 #if defined(__linux) || defined(linux) || defined(__linux__) ||                \
     defined(__FreeBSD__)
         bool use_stack_guard_pages() const;
+
+        // maximal number of released stacks of each size kept for reuse and
+        // the number of those keeping their memory
+        std::size_t get_stack_pool_size() const;
+        std::size_t get_stack_pool_high_water_mark() const;
+
+        bool use_huge_page_stacks() const;
 #endif
 
         // return trace_depth for stack-backtraces
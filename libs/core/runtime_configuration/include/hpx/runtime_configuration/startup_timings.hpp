@@ -0,0 +1,55 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#include <chrono>
+#include <iosfwd>
+
+namespace hpx { namespace util {
+    ///////////////////////////////////////////////////////////////////////////
+    // Record the time a phase of the startup of the runtime took. The phases
+    // are printed in the order they are recorded, phase names are expected to
+    // be string literals.
+    HPX_CORE_EXPORT void record_startup_timing(
+        char const* phase, std::chrono::steady_clock::duration duration);
+
+    // Forget all recorded startup timings, this is done whenever a runtime
+    // is initialized.
+    HPX_CORE_EXPORT void reset_startup_timings();
+
+    // Print all recorded startup timings to the given stream (see
+    // --hpx:print-startup-timings).
+    HPX_CORE_EXPORT void print_startup_timings(std::ostream& os);
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Record the time between the construction and destruction of this object
+    // as the given startup phase.
+    class startup_timer
+    {
+    public:
+        explicit startup_timer(char const* phase) noexcept
+          : phase_(phase)
+          , start_(std::chrono::steady_clock::now())
+        {
+        }
+
+        ~startup_timer()
+        {
+            record_startup_timing(
+                phase_, std::chrono::steady_clock::now() - start_);
+        }
+
+        startup_timer(startup_timer const&) = delete;
+        startup_timer& operator=(startup_timer const&) = delete;
+
+    private:
+        char const* phase_;
+        std::chrono::steady_clock::time_point start_;
+    };
+}}    // namespace hpx::util
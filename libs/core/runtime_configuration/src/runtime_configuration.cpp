@@ -18,6 +18,7 @@
 #include <hpx/runtime_configuration/plugin_registry_base.hpp>
 #include <hpx/runtime_configuration/runtime_configuration.hpp>
 #include <hpx/runtime_configuration/runtime_mode.hpp>
+#include <hpx/runtime_configuration/startup_timings.hpp>
 #include <hpx/util/from_string.hpp>
 #include <hpx/util/get_entry_as.hpp>
 #include <hpx/version.hpp>
@@ -149,6 +150,9 @@ namespace hpx { namespace util {
 #endif
             "expect_connecting_localities = "
             "${HPX_EXPECT_CONNECTING_LOCALITIES:0}",
+            "continuation_max_recursion_depth = "
+            "${HPX_CONTINUATION_MAX_RECURSION_DEPTH:" HPX_PP_STRINGIZE(
+                HPX_PP_EXPAND(HPX_CONTINUATION_MAX_RECURSION_DEPTH)) "}",
 
             // add placeholders for keys to be added by command line handling
             "os_threads = cores",
@@ -212,8 +216,21 @@ namespace hpx { namespace util {
 #if defined(__linux) || defined(linux) || defined(__linux__) ||                \
     defined(__FreeBSD__)
             "use_guard_pages = ${HPX_USE_GUARD_PAGES:1}",
+            "pool_size = ${HPX_STACK_POOL_SIZE:64}",
+            "pool_high_water_mark = ${HPX_STACK_POOL_HIGH_WATER_MARK:8}",
+            "use_huge_pages = ${HPX_USE_HUGE_PAGE_STACKS:0}",
 #endif
 
+            // the task trace is recorded if a file is given
+            "[hpx.task_trace]",
+            "file = ${HPX_TASK_TRACE_FILE:}",
+            "buffer_size = ${HPX_TASK_TRACE_BUFFER_SIZE:8192}",
+
+            "[hpx.sampling_profiler]",
+            "file = ${HPX_SAMPLING_PROFILER_FILE:}",
+            "interval = ${HPX_SAMPLING_PROFILER_INTERVAL:1000}",
+            "stacks = ${HPX_SAMPLING_PROFILER_STACKS:0}",
+
             "[hpx.threadpools]",
 #if defined(HPX_HAVE_IO_POOL)
             "io_pool_size = ${HPX_NUM_IO_POOL_SIZE:" HPX_PP_STRINGIZE(
@@ -227,6 +244,22 @@ namespace hpx { namespace util {
             "timer_pool_size = ${HPX_NUM_TIMER_POOL_SIZE:" HPX_PP_STRINGIZE(
                 HPX_PP_EXPAND(HPX_NUM_TIMER_POOL_SIZE)) "}",
 #endif
+            "polling_pool_size = ${HPX_NUM_POLLING_POOL_SIZE:0}",
+
+#if defined(HPX_HAVE_ASYNC_IO_URING)
+            "[hpx.io]",
+            "io_uring = ${HPX_IO_URING:1}",
+            "entries = ${HPX_IO_URING_ENTRIES:256}",
+#endif
+
+#if defined(HPX_HAVE_DISTRIBUTED_RUNTIME)
+            // the output written to hpx::cout and friends is sent to the
+            // console in batches of at least flush_size bytes, or after
+            // flush_interval microseconds
+            "[hpx.iostreams]",
+            "flush_size = ${HPX_IOSTREAMS_FLUSH_SIZE:4096}",
+            "flush_interval = ${HPX_IOSTREAMS_FLUSH_INTERVAL:1000}",
+#endif
 
             "[hpx.thread_queue]",
             "max_thread_count = ${HPX_THREAD_QUEUE_MAX_THREAD_COUNT:" HPX_PP_STRINGIZE(
@@ -237,6 +270,9 @@ namespace hpx { namespace util {
             "min_tasks_to_steal_staged = "
             "${HPX_THREAD_QUEUE_MIN_TASKS_TO_STEAL_STAGED:" HPX_PP_STRINGIZE(
                 HPX_PP_EXPAND(HPX_THREAD_QUEUE_MIN_TASKS_TO_STEAL_STAGED)) "}",
+            "steal_batch_size = "
+            "${HPX_THREAD_QUEUE_STEAL_BATCH_SIZE:" HPX_PP_STRINGIZE(
+                HPX_PP_EXPAND(HPX_THREAD_QUEUE_STEAL_BATCH_SIZE)) "}",
             "min_add_new_count = "
             "${HPX_THREAD_QUEUE_MIN_ADD_NEW_COUNT:" HPX_PP_STRINGIZE(
                 HPX_PP_EXPAND(HPX_THREAD_QUEUE_MIN_ADD_NEW_COUNT)) "}",
@@ -255,6 +291,26 @@ namespace hpx { namespace util {
             "init_threads_count = "
             "${HPX_THREAD_QUEUE_INIT_THREADS_COUNT:" HPX_PP_STRINGIZE(
                 HPX_PP_EXPAND(HPX_THREAD_QUEUE_INIT_THREADS_COUNT)) "}",
+            "max_free_threads = "
+            "${HPX_THREAD_QUEUE_MAX_FREE_THREADS:" HPX_PP_STRINGIZE(
+                HPX_PP_EXPAND(HPX_THREAD_QUEUE_MAX_FREE_THREADS)) "}",
+            "run_to_completion = "
+            "${HPX_THREAD_QUEUE_RUN_TO_COMPLETION:" HPX_PP_STRINGIZE(
+                HPX_PP_EXPAND(HPX_THREAD_QUEUE_RUN_TO_COMPLETION)) "}",
+            "steal_core_backoff = ${HPX_THREAD_QUEUE_STEAL_CORE_BACKOFF:1}",
+            "steal_core_batch_size = "
+            "${HPX_THREAD_QUEUE_STEAL_CORE_BATCH_SIZE:64}",
+            "steal_cache_backoff = ${HPX_THREAD_QUEUE_STEAL_CACHE_BACKOFF:1}",
+            "steal_cache_batch_size = "
+            "${HPX_THREAD_QUEUE_STEAL_CACHE_BATCH_SIZE:64}",
+            "steal_numa_backoff = ${HPX_THREAD_QUEUE_STEAL_NUMA_BACKOFF:1}",
+            "steal_numa_batch_size = "
+            "${HPX_THREAD_QUEUE_STEAL_NUMA_BATCH_SIZE:64}",
+            "steal_remote_backoff = ${HPX_THREAD_QUEUE_STEAL_REMOTE_BACKOFF:1}",
+            "steal_remote_batch_size = "
+            "${HPX_THREAD_QUEUE_STEAL_REMOTE_BATCH_SIZE:64}",
+            "steal_numa_affinity_starvation = "
+            "${HPX_THREAD_QUEUE_STEAL_NUMA_AFFINITY_STARVATION:16}",
 
             "[hpx.commandline]",
             // enable aliasing
@@ -307,6 +363,7 @@ namespace hpx { namespace util {
                 HPX_PP_EXPAND(HPX_AGAS_LOCAL_CACHE_SIZE)) "}",
             "use_range_caching = ${HPX_AGAS_USE_RANGE_CACHING:1}",
             "use_caching = ${HPX_AGAS_USE_CACHING:1}",
+            "bootstrap_fanout = ${HPX_AGAS_BOOTSTRAP_FANOUT:8}",
 
             "[hpx.components]",
             "load_external = ${HPX_LOAD_EXTERNAL_COMPONENTS:1}",
@@ -378,6 +435,8 @@ namespace hpx { namespace util {
             "format = ${HPX_LOGFORMAT:" HPX_LOGFORMAT
                 "P%parentloc%/%hpxparent%.%hpxparentphase% %time%("
                 HPX_TIMEFORMAT ") [%idx%]|\\n}",
+            "async = ${HPX_LOGASYNC:0}",
+            "rate_limit = ${HPX_LOGRATELIMIT:0}",
 
             // general console logging
             "[hpx.logging.console]",
@@ -650,14 +709,18 @@ namespace hpx { namespace util {
         std::string component_path_suffixes(
             get_entry("hpx.component_path_suffixes", "/lib/hpx"));
 
-        load_component_paths(plugin_registries, component_registries,
-            component_base_paths, component_path_suffixes, component_paths,
-            basenames);
+        {
+            util::startup_timer t("plugin discovery");
+
+            load_component_paths(plugin_registries, component_registries,
+                component_base_paths, component_path_suffixes, component_paths,
+                basenames);
 
-        // load additional explicit plugin paths from plugin_paths key
-        std::string plugin_paths(get_entry("hpx.component_paths", ""));
-        load_component_paths(plugin_registries, component_registries,
-            plugin_paths, "", component_paths, basenames);
+            // load additional explicit plugin paths from plugin_paths key
+            std::string plugin_paths(get_entry("hpx.component_paths", ""));
+            load_component_paths(plugin_registries, component_registries,
+                plugin_paths, "", component_paths, basenames);
+        }
 
         // read system and user ini files _again_, to allow the user to
         // overwrite the settings from the default component ini's.
@@ -1009,6 +1072,28 @@ namespace hpx { namespace util {
 #endif
     }
 
+    std::size_t runtime_configuration::get_continuation_max_recursion_depth()
+        const
+    {
+        if (util::section const* sec = get_section("hpx"); nullptr != sec)
+        {
+            return hpx::util::get_entry_as<std::size_t>(*sec,
+                "continuation_max_recursion_depth",
+                HPX_CONTINUATION_MAX_RECURSION_DEPTH);
+        }
+        return HPX_CONTINUATION_MAX_RECURSION_DEPTH;
+    }
+
+    std::size_t runtime_configuration::get_continuation_stack_budget() const
+    {
+        if (util::section const* sec = get_section("hpx"); nullptr != sec)
+        {
+            return hpx::util::get_entry_as<std::size_t>(*sec,
+                "continuation_stack_budget", 8 * HPX_THREADS_STACK_OVERHEAD);
+        }
+        return 8 * HPX_THREADS_STACK_OVERHEAD;
+    }
+
     std::size_t runtime_configuration::trace_depth() const
     {
         if (util::section const* sec = get_section("hpx"); nullptr != sec)
@@ -1095,6 +1180,38 @@ namespace hpx { namespace util {
         }
         return true;    // default is true
     }
+
+    std::size_t runtime_configuration::get_stack_pool_size() const
+    {
+        if (util::section const* sec = get_section("hpx.stacks");
+            nullptr != sec)
+        {
+            return hpx::util::get_entry_as<std::size_t>(*sec, "pool_size", 64);
+        }
+        return 64;
+    }
+
+    std::size_t runtime_configuration::get_stack_pool_high_water_mark() const
+    {
+        if (util::section const* sec = get_section("hpx.stacks");
+            nullptr != sec)
+        {
+            return hpx::util::get_entry_as<std::size_t>(
+                *sec, "pool_high_water_mark", 8);
+        }
+        return 8;
+    }
+
+    bool runtime_configuration::use_huge_page_stacks() const
+    {
+        if (util::section const* sec = get_section("hpx.stacks");
+            nullptr != sec)
+        {
+            return hpx::util::get_entry_as<int>(*sec, "use_huge_pages", 0) !=
+                0;
+        }
+        return false;    // default is false
+    }
 #endif
 
     std::ptrdiff_t runtime_configuration::init_small_stack_size() const
@@ -0,0 +1,73 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/runtime_configuration/startup_timings.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <iomanip>
+#include <mutex>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace util {
+    namespace {
+        using startup_timing =
+            std::pair<char const*, std::chrono::steady_clock::duration>;
+
+        std::mutex& startup_timings_mutex()
+        {
+            static std::mutex mtx;
+            return mtx;
+        }
+
+        std::vector<startup_timing>& startup_timings()
+        {
+            static std::vector<startup_timing> timings;
+            return timings;
+        }
+    }    // namespace
+
+    void record_startup_timing(
+        char const* phase, std::chrono::steady_clock::duration duration)
+    {
+        std::lock_guard<std::mutex> l(startup_timings_mutex());
+        startup_timings().emplace_back(phase, duration);
+    }
+
+    void reset_startup_timings()
+    {
+        std::lock_guard<std::mutex> l(startup_timings_mutex());
+        startup_timings().clear();
+    }
+
+    void print_startup_timings(std::ostream& os)
+    {
+        // make sure all output is kept together
+        std::ostringstream strm;
+        strm << std::string(79, '*') << '\n';
+        strm << "startup timings [ms]:\n";
+
+        {
+            std::lock_guard<std::mutex> l(startup_timings_mutex());
+            for (startup_timing const& t : startup_timings())
+            {
+                strm << "  " << std::left << std::setw(40) << t.first
+                     << std::right << std::fixed << std::setprecision(3)
+                     << std::setw(12)
+                     << std::chrono::duration<double, std::milli>(t.second)
+                            .count()
+                     << '\n';
+            }
+        }
+
+        os << strm.str();
+    }
+}}    // namespace hpx::util
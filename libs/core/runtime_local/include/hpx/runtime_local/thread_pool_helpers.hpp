@@ -48,6 +48,11 @@ namespace hpx { namespace resource {
     HPX_CORE_EXPORT threads::thread_pool_base& get_thread_pool(
         std::size_t pool_index);
 
+    /// Return the thread pool running the background work and the polling
+    /// functions by default: the pool 'polling' created by
+    /// --hpx:polling-threads if it exists, the default pool otherwise
+    HPX_CORE_EXPORT threads::thread_pool_base& get_polling_thread_pool();
+
     /// Return true if the pool with the given name exists
     HPX_CORE_EXPORT bool pool_exists(std::string const& pool_name);
 
@@ -19,6 +19,7 @@
 #include <hpx/modules/errors.hpp>
 #include <hpx/modules/logging.hpp>
 #include <hpx/modules/threadmanager.hpp>
+#include <hpx/runtime_configuration/startup_timings.hpp>
 #include <hpx/runtime_local/config_entry.hpp>
 #include <hpx/runtime_local/custom_exception_info.hpp>
 #include <hpx/runtime_local/debugging.hpp>
@@ -1328,13 +1329,25 @@ namespace hpx {
 
             if (call_startup)
             {
-                call_startup_functions(true);
+                {
+                    util::startup_timer t("pre-startup functions");
+                    call_startup_functions(true);
+                }
                 lbt_ << "(3rd stage) run_helper: ran pre-startup functions";
 
-                call_startup_functions(false);
+                {
+                    util::startup_timer t("startup functions");
+                    call_startup_functions(false);
+                }
                 lbt_ << "(4th stage) run_helper: ran startup functions";
             }
 
+            if (get_config().get_entry("hpx.print_startup_timings", "0") ==
+                "1")
+            {
+                util::print_startup_timings(std::cout);
+            }
+
             lbt_ << "(4th stage) runtime::run_helper: bootstrap complete";
             set_state(hpx::state::running);
 
@@ -1409,7 +1422,10 @@ namespace hpx {
                 "I/O service pool";
 #endif
         // start the thread manager
-        thread_manager_->run();
+        {
+            util::startup_timer t("thread manager startup");
+            thread_manager_->run();
+        }
         lbt_ << "(1st stage) runtime::start: started threadmanager";
         // }}}
 
@@ -61,6 +61,15 @@ namespace hpx { namespace resource {
         return get_thread_pool(get_pool_name(pool_index));
     }
 
+    threads::thread_pool_base& get_polling_thread_pool()
+    {
+        if (pool_exists("polling"))
+        {
+            return get_thread_pool("polling");
+        }
+        return get_thread_pool(0);
+    }
+
     bool pool_exists(std::string const& pool_name)
     {
         return get_runtime().get_thread_manager().pool_exists(pool_name);
@@ -446,6 +446,30 @@ namespace hpx { namespace threads { namespace policies {
             }
             return num_stolen_threads;
         }
+
+        std::int64_t get_average_steal_batch_size(
+            std::size_t num_thread, bool reset) override
+        {
+            std::int64_t num_batches = 0;
+            std::int64_t num_stolen_threads = 0;
+            for (std::size_t i = 0; i != num_queues_; ++i)
+            {
+                if (num_thread != std::size_t(-1) && num_thread != i)
+                    continue;
+
+                if (i < num_high_priority_queues_)
+                {
+                    thread_queue_type* q = high_priority_queues_[i].data_;
+                    num_batches += q->get_num_steal_batches(reset);
+                    num_stolen_threads += q->get_num_stolen_in_batches(reset);
+                }
+
+                thread_queue_type* q = queues_[i].data_;
+                num_batches += q->get_num_steal_batches(reset);
+                num_stolen_threads += q->get_num_stolen_in_batches(reset);
+            }
+            return num_batches == 0 ? 0 : num_stolen_threads / num_batches;
+        }
 #endif
 
         ///////////////////////////////////////////////////////////////////////
@@ -592,6 +616,90 @@ namespace hpx { namespace threads { namespace policies {
                 ;
         }
 
+        // Create the given threads, adding all normal priority threads
+        // targeting the same queue in one go
+        void create_thread_n(thread_init_data* data, std::size_t count,
+            error_code& ec) override
+        {
+            // Processing units may be suspended concurrently if elasticity is
+            // enabled, create_thread takes care of that.
+            if (count <= 1 ||
+                this->has_scheduler_mode(
+                    policies::scheduler_mode::enable_elasticity))
+            {
+                scheduler_base::create_thread_n(data, count, ec);
+                return;
+            }
+
+            // Determine the target queue of all threads, threads which are
+            // not normal priority threads are created one at a time.
+            std::size_t const no_queue = num_queues_;
+            std::vector<std::size_t> targets(count);
+            std::vector<std::size_t> offsets(num_queues_ + 2, 0);
+
+            // NOTE: This scheduler ignores NUMA hints.
+            std::size_t next_queue = curr_queue_.fetch_add(count);
+            for (std::size_t i = 0; i != count; ++i)
+            {
+                thread_init_data& d = data[i];
+
+                std::size_t target = no_queue;
+                if (!d.run_now && d.priority != thread_priority::low)
+                {
+                    target = d.schedulehint.mode ==
+                            thread_schedule_hint_mode::thread ?
+                        std::size_t(d.schedulehint.hint) :
+                        std::size_t(-1);
+                    if (target == std::size_t(-1))
+                    {
+                        target = next_queue++;
+                    }
+                    target %= num_queues_;
+
+                    d.schedulehint.mode = thread_schedule_hint_mode::thread;
+                    d.schedulehint.hint = static_cast<std::int16_t>(target);
+                }
+
+                targets[i] = target;
+                ++offsets[target + 2];
+            }
+
+            // Group the threads by target queue (counting sort)
+            for (std::size_t q = 2; q != offsets.size(); ++q)
+            {
+                offsets[q] += offsets[q - 1];
+            }
+
+            std::vector<thread_init_data*> sorted(count);
+            for (std::size_t i = 0; i != count; ++i)
+            {
+                sorted[offsets[targets[i] + 1]++] = &data[i];
+            }
+
+            for (std::size_t q = 0; q != num_queues_; ++q)
+            {
+                std::size_t const first = offsets[q];
+                std::size_t const n = offsets[q + 1] - first;
+                if (n != 0)
+                {
+                    queues_[q].data_->create_thread_n(&sorted[first], n, ec);
+                    if (ec)
+                    {
+                        return;
+                    }
+                }
+            }
+
+            for (std::size_t i = offsets[num_queues_]; i != count; ++i)
+            {
+                create_thread(*sorted[i], nullptr, ec);
+                if (ec)
+                {
+                    return;
+                }
+            }
+        }
+
         // Return the next thread to be executed, return false if none is
         // available
         bool get_next_thread(std::size_t num_thread, bool running,
@@ -656,22 +764,27 @@ namespace hpx { namespace threads { namespace policies {
                         num_thread < num_high_priority_queues_)
                     {
                         thread_queue_type* q = high_priority_queues_[idx].data_;
-                        if (q->get_next_thread(thrd, true, true))
+                        std::size_t stolen =
+                            this_high_priority_queue->steal_next_thread(
+                                q, thrd);
+                        if (stolen != 0)
                         {
 #ifdef HPX_HAVE_THREAD_STEALING_COUNTS
-                            q->increment_num_stolen_from_pending();
+                            q->increment_num_stolen_from_pending(stolen);
                             this_high_priority_queue
-                                ->increment_num_stolen_to_pending();
+                                ->increment_num_stolen_to_pending(stolen);
 #endif
                             return true;
                         }
                     }
 
-                    if (queues_[idx].data_->get_next_thread(thrd, true, true))
+                    thread_queue_type* q = queues_[idx].data_;
+                    std::size_t stolen = this_queue->steal_next_thread(q, thrd);
+                    if (stolen != 0)
                     {
 #ifdef HPX_HAVE_THREAD_STEALING_COUNTS
-                        queues_[idx].data_->increment_num_stolen_from_pending();
-                        this_queue->increment_num_stolen_to_pending();
+                        q->increment_num_stolen_from_pending(stolen);
+                        this_queue->increment_num_stolen_to_pending(stolen);
 #endif
                         return true;
                     }
@@ -758,6 +871,84 @@ namespace hpx { namespace threads { namespace policies {
             }
         }
 
+        // Schedule the given threads, adding all normal priority threads
+        // targeting the same queue in one go
+        void schedule_thread_n(
+            threads::thread_id_ref_type* thrds, std::size_t count) override
+        {
+            // Processing units may be suspended concurrently if elasticity is
+            // enabled, schedule_thread takes care of that.
+            if (count <= 1 ||
+                this->has_scheduler_mode(
+                    policies::scheduler_mode::enable_elasticity))
+            {
+                scheduler_base::schedule_thread_n(thrds, count);
+                return;
+            }
+
+            // Distribute the normal priority threads round robin, the
+            // remaining threads are scheduled one at a time.
+            std::size_t const no_queue = num_queues_;
+            std::vector<std::size_t> targets(count);
+            std::vector<std::size_t> offsets(num_queues_ + 2, 0);
+
+            std::size_t next_queue = curr_queue_.fetch_add(count);
+            for (std::size_t i = 0; i != count; ++i)
+            {
+                thread_priority const priority =
+                    get_thread_id_data(thrds[i])->get_priority();
+
+                std::size_t target = no_queue;
+                if (priority != thread_priority::high_recursive &&
+                    priority != thread_priority::high &&
+                    priority != thread_priority::boost &&
+                    priority != thread_priority::low)
+                {
+                    target = next_queue++ % num_queues_;
+                }
+
+                targets[i] = target;
+                ++offsets[target + 2];
+            }
+
+            // Group the threads by target queue (counting sort)
+            for (std::size_t q = 2; q != offsets.size(); ++q)
+            {
+                offsets[q] += offsets[q - 1];
+            }
+
+            std::vector<threads::thread_id_ref_type> sorted(count);
+            for (std::size_t i = 0; i != count; ++i)
+            {
+                sorted[offsets[targets[i] + 1]++] = HPX_MOVE(thrds[i]);
+            }
+
+            for (std::size_t q = 0; q != num_queues_; ++q)
+            {
+                std::size_t const first = offsets[q];
+                std::size_t const n = offsets[q + 1] - first;
+                if (n != 0)
+                {
+                    LTM_(debug).format(
+                        "local_priority_queue_scheduler::schedule_thread_n, "
+                        "normal priority queue: "
+                        "pool({}), scheduler({}), worker_thread({}), "
+                        "threads({})",
+                        *this->get_parent_pool(), *this, q, n);
+
+                    queues_[q].data_->schedule_thread_n(&sorted[first], n);
+                }
+            }
+
+            for (std::size_t i = offsets[num_queues_]; i != count; ++i)
+            {
+                thread_priority const priority =
+                    get_thread_id_data(sorted[i])->get_priority();
+                schedule_thread(HPX_MOVE(sorted[i]), thread_schedule_hint(),
+                    false, priority);
+            }
+        }
+
         void schedule_thread_last(threads::thread_id_ref_type thrd,
             threads::thread_schedule_hint schedulehint,
             bool allow_fallback = false,
@@ -812,6 +1003,48 @@ namespace hpx { namespace threads { namespace policies {
             thrd->get_queue<thread_queue_type>().destroy_thread(thrd);
         }
 
+        // Take a pending thread for a worker thread of another pool. This
+        // steals from our queues, starting with the high priority ones, and
+        // creates the staged threads of a queue if it has nothing else.
+        bool lend_thread(threads::thread_id_ref_type& thrd) override
+        {
+            auto lend_from = [&thrd](thread_queue_type* q) {
+                if (q->get_next_thread(thrd, true, true))
+                {
+                    return true;
+                }
+                if (q->get_staged_queue_length(std::memory_order_relaxed) == 0)
+                {
+                    return false;
+                }
+                std::size_t added = 0;
+                q->wait_or_add_new(true, added, true);
+                return added != 0 && q->get_next_thread(thrd, true, true);
+            };
+
+            std::size_t const start =
+                curr_queue_.load(std::memory_order_relaxed);
+
+            for (std::size_t i = 0; i != num_high_priority_queues_; ++i)
+            {
+                std::size_t const idx = (start + i) % num_high_priority_queues_;
+                if (lend_from(high_priority_queues_[idx].data_))
+                {
+                    return true;
+                }
+            }
+
+            for (std::size_t i = 0; i != num_queues_; ++i)
+            {
+                if (lend_from(queues_[(start + i) % num_queues_].data_))
+                {
+                    return true;
+                }
+            }
+
+            return lend_from(&low_priority_queue_);
+        }
+
         ///////////////////////////////////////////////////////////////////////
         // This returns the current length of the queues (work items and new items)
         std::int64_t get_queue_length(
@@ -847,6 +1080,57 @@ namespace hpx { namespace threads { namespace policies {
             return count;
         }
 
+        std::vector<std::uint64_t> get_queue_latency_counts(
+            thread_priority priority, bool stolen, bool reset) const override
+        {
+            std::vector<std::uint64_t> counts;
+            switch (priority)
+            {
+            case thread_priority::default_:
+                for (std::size_t i = 0; i != num_high_priority_queues_; ++i)
+                {
+                    high_priority_queues_[i].data_->get_queue_latency_counts(
+                        counts, stolen, reset);
+                }
+                low_priority_queue_.get_queue_latency_counts(
+                    counts, stolen, reset);
+                for (std::size_t i = 0; i != num_queues_; ++i)
+                {
+                    queues_[i].data_->get_queue_latency_counts(
+                        counts, stolen, reset);
+                }
+                break;
+
+            case thread_priority::low:
+                low_priority_queue_.get_queue_latency_counts(
+                    counts, stolen, reset);
+                break;
+
+            case thread_priority::normal:
+                for (std::size_t i = 0; i != num_queues_; ++i)
+                {
+                    queues_[i].data_->get_queue_latency_counts(
+                        counts, stolen, reset);
+                }
+                break;
+
+            case thread_priority::boost:
+            case thread_priority::high:
+            case thread_priority::high_recursive:
+            case thread_priority::bound:
+                for (std::size_t i = 0; i != num_high_priority_queues_; ++i)
+                {
+                    high_priority_queues_[i].data_->get_queue_latency_counts(
+                        counts, stolen, reset);
+                }
+                break;
+
+            default:
+                break;
+            }
+            return counts;
+        }
+
         ///////////////////////////////////////////////////////////////////////
         // Queries the current thread count of the queues.
         std::int64_t get_thread_count(
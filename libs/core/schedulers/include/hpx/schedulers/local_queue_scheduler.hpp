@@ -541,6 +541,34 @@ namespace hpx { namespace threads { namespace policies {
             thrd->get_queue<thread_queue_type>().destroy_thread(thrd);
         }
 
+        // Take a pending thread for a worker thread of another pool. This
+        // steals from our queues and creates the staged threads of a queue if
+        // it has nothing else.
+        bool lend_thread(threads::thread_id_ref_type& thrd) override
+        {
+            std::size_t const start =
+                curr_queue_.load(std::memory_order_relaxed);
+
+            for (std::size_t i = 0; i != queues_.size(); ++i)
+            {
+                thread_queue_type* q = queues_[(start + i) % queues_.size()];
+                if (q->get_next_thread(thrd, true, true))
+                {
+                    return true;
+                }
+                if (q->get_staged_queue_length(std::memory_order_relaxed) != 0)
+                {
+                    std::size_t added = 0;
+                    q->wait_or_add_new(true, added, true);
+                    if (added != 0 && q->get_next_thread(thrd, true, true))
+                    {
+                        return true;
+                    }
+                }
+            }
+            return false;
+        }
+
         ///////////////////////////////////////////////////////////////////////
         // This returns the current length of the queues (work items and new items)
         std::int64_t get_queue_length(
@@ -561,6 +589,20 @@ namespace hpx { namespace threads { namespace policies {
             return count;
         }
 
+        std::vector<std::uint64_t> get_queue_latency_counts(
+            thread_priority /* priority */, bool stolen,
+            bool reset) const override
+        {
+            // all threads are kept in the same queues, regardless of their
+            // priority
+            std::vector<std::uint64_t> counts;
+            for (std::size_t i = 0; i != queues_.size(); ++i)
+            {
+                queues_[i]->get_queue_latency_counts(counts, stolen, reset);
+            }
+            return counts;
+        }
+
         ///////////////////////////////////////////////////////////////////////
         // Queries the current thread count of the queues.
         std::int64_t get_thread_count(
@@ -0,0 +1,333 @@
+//  Copyright (c) 2007-2022 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
+#include <hpx/concurrency/spinlock.hpp>
+#include <hpx/modules/logging.hpp>
+#include <hpx/schedulers/local_priority_queue_scheduler.hpp>
+#include <hpx/schedulers/lockfree_queue_backends.hpp>
+#include <hpx/synchronization/channel_mpsc.hpp>
+#include <hpx/threading_base/scheduler_base.hpp>
+#include <hpx/threading_base/scheduler_state.hpp>
+#include <hpx/threading_base/thread_data.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx { namespace threads { namespace policies {
+    ///////////////////////////////////////////////////////////////////////////
+#if defined(HPX_HAVE_CXX11_STD_ATOMIC_128BIT)
+    using default_local_workrequesting_scheduler_terminated_queue =
+        lockfree_lifo;
+#else
+    using default_local_workrequesting_scheduler_terminated_queue =
+        lockfree_fifo;
+#endif
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// The local_workrequesting_scheduler maintains exactly one queue of work
+    /// items (threads) per OS thread, where this OS thread pulls its next work
+    /// from. Additionally it maintains separate queues: several for high
+    /// priority threads and one for low priority threads (same as the
+    /// local_priority_queue_scheduler).
+    ///
+    /// In contrast to the local_priority_queue_scheduler, idle OS threads do
+    /// not steal work from other queues directly. Instead, an idle thread
+    /// posts a steal request to the mailbox of one of its victims. The victim
+    /// answers all pending requests at its next scheduling point by handing
+    /// over a batch of (up to half of) its queued work to the requesting
+    /// thread. This way the queue of each OS thread is only ever popped from
+    /// by the OS thread owning it.
+    template <typename Mutex = std::mutex,
+        typename PendingQueuing = lockfree_fifo,
+        typename StagedQueuing = lockfree_fifo,
+        typename TerminatedQueuing =
+            default_local_workrequesting_scheduler_terminated_queue>
+    class HPX_CORE_EXPORT local_workrequesting_scheduler
+      : public local_priority_queue_scheduler<Mutex, PendingQueuing,
+            StagedQueuing, TerminatedQueuing>
+    {
+    public:
+        using base_type = local_priority_queue_scheduler<Mutex, PendingQueuing,
+            StagedQueuing, TerminatedQueuing>;
+
+        using thread_queue_type = typename base_type::thread_queue_type;
+        using init_parameter_type = typename base_type::init_parameter_type;
+
+    private:
+        // A steal request identifies the OS thread which is asking for work.
+        struct steal_request
+        {
+            std::size_t num_thread_ = std::size_t(-1);
+        };
+
+        // Per OS-thread data used for handling steal requests. The mailbox
+        // is written to by any thief but is read only by the owning thread.
+        struct scheduler_data
+        {
+            explicit scheduler_data(std::size_t num_queues)
+              : requests_(num_queues)
+              , victim_(std::size_t(-1))
+              , next_victim_(0)
+            {
+                request_pending_.data_.store(false, std::memory_order_relaxed);
+            }
+
+            // incoming steal requests
+            lcos::local::base_channel_mpsc<steal_request, util::spinlock>
+                requests_;
+
+            // true while our own steal request is waiting for an answer,
+            // reset by the victim after it has handled the request
+            util::cache_aligned_data<std::atomic<bool>> request_pending_;
+
+            // the thread our outstanding request was sent to, and the index
+            // into our victim list to use for the next request (both are
+            // accessed by the owning thread only)
+            std::size_t victim_;
+            std::size_t next_victim_;
+        };
+
+    public:
+        local_workrequesting_scheduler(init_parameter_type const& init,
+            bool deferred_initialization = true)
+          : base_type(init, deferred_initialization)
+          , data_(init.num_queues_)
+        {
+            // the mailboxes have to be available before any of the OS threads
+            // start running as they may be targeted by any other thread
+            for (std::size_t i = 0; i != this->num_queues_; ++i)
+            {
+                data_[i].data_ = new scheduler_data(this->num_queues_);
+            }
+        }
+
+        ~local_workrequesting_scheduler() override
+        {
+            for (std::size_t i = 0; i != this->num_queues_; ++i)
+            {
+                delete data_[i].data_;
+            }
+        }
+
+        static std::string get_scheduler_name()
+        {
+            return "local_workrequesting_scheduler";
+        }
+
+        // Return the next thread to be executed, return false if none is
+        // available
+        bool get_next_thread(std::size_t num_thread, bool running,
+            threads::thread_id_ref_type& thrd, bool enable_stealing) override
+        {
+            HPX_ASSERT(num_thread < this->num_queues_);
+
+            // this is a scheduling point, answer all pending requests first
+            handle_steal_requests(num_thread);
+
+            if (base_type::get_next_thread(num_thread, running, thrd, false))
+            {
+                return true;
+            }
+
+            if (running && enable_stealing)
+            {
+                request_work(num_thread);
+            }
+            return false;
+        }
+
+        /// This is a function which gets called periodically by the thread
+        /// manager to allow for maintenance tasks to be executed in the
+        /// scheduler. Returns true if the OS thread calling this function
+        /// has to be terminated (i.e. no more work has to be done).
+        bool wait_or_add_new(std::size_t num_thread, bool running,
+            std::int64_t& idle_loop_count, bool /* enable_stealing */,
+            std::size_t& added) override
+        {
+            handle_steal_requests(num_thread);
+
+            // staged work of other threads is handed over as a response to
+            // our requests only, never steal it directly
+            return base_type::wait_or_add_new(
+                num_thread, running, idle_loop_count, false, added);
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        void on_stop_thread(std::size_t num_thread) override
+        {
+            // make sure no thief keeps waiting for us
+            decline_steal_requests(num_thread);
+            base_type::on_stop_thread(num_thread);
+        }
+
+        void on_error(
+            std::size_t num_thread, std::exception_ptr const& e) override
+        {
+            decline_steal_requests(num_thread);
+            base_type::on_error(num_thread, e);
+        }
+
+    private:
+        // Post a steal request to the next victim, if we do not have a
+        // request outstanding already.
+        void request_work(std::size_t num_thread)
+        {
+            // staged work will be converted by wait_or_add_new soon
+            if (this->queues_[num_thread].data_->get_staged_queue_length(
+                    std::memory_order_relaxed) != 0)
+            {
+                return;
+            }
+
+            scheduler_data& d = *data_[num_thread].data_;
+            if (d.request_pending_.data_.load(std::memory_order_acquire))
+            {
+                // the victim may have stopped running without ever answering
+                // our request, try another one in this case
+                if (this->get_state(d.victim_).load(
+                        std::memory_order_relaxed) <= hpx::state::running)
+                {
+                    return;
+                }
+                d.request_pending_.data_.store(
+                    false, std::memory_order_relaxed);
+            }
+
+            std::vector<std::size_t> const& victims =
+                this->victim_threads_[num_thread].data_;
+            if (victims.empty())
+            {
+                return;
+            }
+
+            for (std::size_t i = 0; i != victims.size(); ++i)
+            {
+                std::size_t victim = victims[d.next_victim_];
+                if (++d.next_victim_ == victims.size())
+                {
+                    d.next_victim_ = 0;
+                }
+
+                if (this->get_state(victim).load(std::memory_order_relaxed) !=
+                    hpx::state::running)
+                {
+                    continue;
+                }
+
+                // the flag has to be set before the request becomes visible
+                // to the victim
+                d.victim_ = victim;
+                d.request_pending_.data_.store(true);
+
+                if (data_[victim].data_->requests_.set(
+                        steal_request{num_thread}))
+                {
+                    return;
+                }
+
+                // the mailbox of this victim is full (or closed)
+                d.request_pending_.data_.store(
+                    false, std::memory_order_relaxed);
+            }
+        }
+
+        // Answer all steal requests which were sent to this thread by handing
+        // over up to half of the locally queued work items.
+        void handle_steal_requests(std::size_t num_thread)
+        {
+            scheduler_data& d = *data_[num_thread].data_;
+
+            steal_request req;
+            while (d.requests_.get(&req))
+            {
+                HPX_ASSERT(req.num_thread_ < this->num_queues_);
+                HPX_ASSERT(req.num_thread_ != num_thread);
+
+                thread_queue_type* this_queue = this->queues_[num_thread].data_;
+                thread_queue_type* thief_queue =
+                    this->queues_[req.num_thread_].data_;
+
+                if (thief_queue != nullptr)
+                {
+                    // keep at least one work item for ourselves
+                    std::int64_t pending =
+                        this_queue->get_pending_queue_length(
+                            std::memory_order_relaxed);
+                    if (pending > 1)
+                    {
+                        std::int64_t count = pending / 2;
+                        thief_queue->move_work_items_from(this_queue,
+                            thief_queue->get_pending_queue_length(
+                                std::memory_order_relaxed) +
+                                count);
+
+#ifdef HPX_HAVE_THREAD_STEALING_COUNTS
+                        this_queue->increment_num_stolen_from_pending(
+                            static_cast<std::size_t>(count));
+                        thief_queue->increment_num_stolen_to_pending(
+                            static_cast<std::size_t>(count));
+#endif
+                    }
+                    else
+                    {
+                        std::int64_t staged =
+                            this_queue->get_staged_queue_length(
+                                std::memory_order_relaxed);
+                        if (staged > 1)
+                        {
+                            std::int64_t count = staged / 2;
+                            thief_queue->move_task_items_from(this_queue,
+                                thief_queue->get_staged_queue_length(
+                                    std::memory_order_relaxed) +
+                                    count);
+
+#ifdef HPX_HAVE_THREAD_STEALING_COUNTS
+                            this_queue->increment_num_stolen_from_staged(
+                                static_cast<std::size_t>(count));
+                            thief_queue->increment_num_stolen_to_staged(
+                                static_cast<std::size_t>(count));
+#endif
+                        }
+                    }
+                }
+
+                // the work (if any) is visible in the thief's queue, allow it
+                // to send its next request
+                data_[req.num_thread_].data_->request_pending_.data_.store(
+                    false, std::memory_order_release);
+            }
+        }
+
+        // Answer all outstanding steal requests without handing over any work.
+        void decline_steal_requests(std::size_t num_thread)
+        {
+            steal_request req;
+            while (data_[num_thread].data_->requests_.get(&req))
+            {
+                HPX_ASSERT(req.num_thread_ < this->num_queues_);
+                data_[req.num_thread_].data_->request_pending_.data_.store(
+                    false, std::memory_order_release);
+            }
+        }
+
+        std::vector<util::cache_line_data<scheduler_data*>> data_;
+    };
+}}}    // namespace hpx::threads::policies
+
+#include <hpx/config/warnings_suffix.hpp>
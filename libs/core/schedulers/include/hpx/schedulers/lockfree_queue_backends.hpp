@@ -20,10 +20,13 @@
 #include <hpx/allocator_support/aligned_allocator.hpp>
 
 // Does not rely on CXX11_STD_ATOMIC_128BIT
+#include <hpx/concurrency/chase_lev_deque.hpp>
 #include <hpx/concurrency/concurrentqueue.hpp>
 
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
+#include <thread>
 #include <utility>
 
 namespace hpx { namespace threads { namespace policies {
@@ -101,6 +104,97 @@ namespace hpx { namespace threads { namespace policies {
         };
     };
 
+    ////////////////////////////////////////////////////////////////////////////
+    // LIFO + stealing at opposite end based on a Chase-Lev work-stealing deque
+    //
+    // The deque may be accessed at its bottom by a single thread only. The
+    // first thread popping from the local end becomes the owner of the
+    // queue. All items pushed by other threads (or pushed to the other end)
+    // go to a separate FIFO which is drained after the deque has run empty.
+    // Local pops by threads other than the owner are handled as steals.
+    template <typename T>
+    struct chase_lev_lifo_backend
+    {
+        using container_type = hpx::concurrency::chase_lev_deque<T>;
+        using overflow_type = lockfree_fifo_backend<T>;
+
+        using value_type = T;
+        using reference = T&;
+        using const_reference = T const&;
+        using rvalue_reference = T&&;
+        using size_type = std::uint64_t;
+
+        chase_lev_lifo_backend(size_type initial_size = 0,
+            size_type /* num_thread */ = size_type(-1))
+          : queue_(initial_size != 0 ? std::size_t(initial_size) : 64)
+          , overflow_(initial_size)
+          , owner_(std::thread::id())
+        {
+        }
+
+        bool push(const_reference val, bool other_end = false)
+        {
+            if (!other_end &&
+                owner_.load(std::memory_order_relaxed) ==
+                    std::this_thread::get_id())
+            {
+                queue_.push_bottom(val);
+                return true;
+            }
+            return overflow_.push(val);
+        }
+
+        bool push(rvalue_reference val, bool other_end = false)
+        {
+            return push(static_cast<const_reference>(val), other_end);
+        }
+
+        bool pop(reference val, bool steal = true)
+        {
+            if (!steal && claim_ownership())
+            {
+                if (queue_.pop_bottom(val))
+                    return true;
+            }
+            else if (queue_.steal(val))
+            {
+                return true;
+            }
+            return overflow_.pop(val);
+        }
+
+        bool empty()
+        {
+            return queue_.empty() && overflow_.empty();
+        }
+
+    private:
+        bool claim_ownership() noexcept
+        {
+            std::thread::id const self = std::this_thread::get_id();
+            std::thread::id owner = owner_.load(std::memory_order_relaxed);
+            if (owner == self)
+                return true;
+
+            return owner == std::thread::id() &&
+                owner_.compare_exchange_strong(owner, self,
+                    std::memory_order_acquire, std::memory_order_relaxed);
+        }
+
+        container_type queue_;
+        overflow_type overflow_;
+        std::atomic<std::thread::id> owner_;
+    };
+
+    struct chase_lev_lifo
+    {
+        template <typename T>
+        struct apply
+        {
+            using type = chase_lev_lifo_backend<T>;
+        };
+    };
+
     ////////////////////////////////////////////////////////////////////////////
     // MoodyCamel FIFO
     template <typename T>
@@ -156,15 +156,16 @@ namespace hpx { namespace threads { namespace policies {
 
         // ----------------------------------------------------------------
         bool add_new_HP(ThreadQueue* receiver, std::size_t qidx,
-            std::size_t& added, bool stealing, bool allow_stealing)
+            std::size_t& added, bool stealing, bool allow_stealing,
+            std::size_t count = 64, bool skip_numa_affine = false)
         {
             // loop over queues and take one task,
             std::size_t q = qidx;
             for (std::size_t i = 0; i < num_queues_;
                  ++i, q = fast_mod((qidx + i), num_queues_))
             {
-                added =
-                    receiver->add_new_HP(64, queues_[q], (stealing || (i > 0)));
+                added = receiver->add_new_HP(count, queues_[q],
+                    (stealing || (i > 0)), skip_numa_affine);
                 if (added > 0)
                 {
                     // clang-format off
@@ -187,15 +188,16 @@ namespace hpx { namespace threads { namespace policies {
 
         // ----------------------------------------------------------------
         bool add_new(ThreadQueue* receiver, std::size_t qidx,
-            std::size_t& added, bool stealing, bool allow_stealing)
+            std::size_t& added, bool stealing, bool allow_stealing,
+            std::size_t count = 64, bool skip_numa_affine = false)
         {
             // loop over queues and take one task,
             std::size_t q = qidx;
             for (std::size_t i = 0; i < num_queues_;
                  ++i, q = fast_mod((qidx + i), num_queues_))
             {
-                added =
-                    receiver->add_new(64, queues_[q], (stealing || (i > 0)));
+                added = receiver->add_new(count, queues_[q],
+                    (stealing || (i > 0)), skip_numa_affine);
                 if (added > 0)
                 {
                     // clang-format off
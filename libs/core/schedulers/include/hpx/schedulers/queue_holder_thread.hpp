@@ -690,8 +690,9 @@ namespace hpx { namespace threads { namespace policies {
         }
 
         // ----------------------------------------------------------------
-        std::size_t add_new_HP(
-            std::int64_t add_count, thread_holder_type* addfrom, bool stealing)
+        std::size_t add_new_HP(std::int64_t add_count,
+            thread_holder_type* addfrom, bool stealing,
+            bool skip_numa_affine = false)
         {
             std::size_t added;
             if (owns_bp_queue() && !stealing)
@@ -704,8 +705,8 @@ namespace hpx { namespace threads { namespace policies {
 
             if (owns_hp_queue())
             {
-                added =
-                    hp_queue_->add_new(add_count, addfrom->hp_queue_, stealing);
+                added = hp_queue_->add_new(add_count, addfrom->hp_queue_,
+                    stealing, skip_numa_affine);
                 if (added > 0)
                     return added;
             }
@@ -713,22 +714,23 @@ namespace hpx { namespace threads { namespace policies {
         }
 
         // ----------------------------------------------------------------
-        std::size_t add_new(
-            std::int64_t add_count, thread_holder_type* addfrom, bool stealing)
+        std::size_t add_new(std::int64_t add_count,
+            thread_holder_type* addfrom, bool stealing,
+            bool skip_numa_affine = false)
         {
             std::size_t added;
             if (owns_np_queue())
             {
-                added =
-                    np_queue_->add_new(add_count, addfrom->np_queue_, stealing);
+                added = np_queue_->add_new(add_count, addfrom->np_queue_,
+                    stealing, skip_numa_affine);
                 if (added > 0)
                     return added;
             }
 
             if (owns_lp_queue())
             {
-                added =
-                    lp_queue_->add_new(add_count, addfrom->lp_queue_, stealing);
+                added = lp_queue_->add_new(add_count, addfrom->lp_queue_,
+                    stealing, skip_numa_affine);
                 if (added > 0)
                     return added;
             }
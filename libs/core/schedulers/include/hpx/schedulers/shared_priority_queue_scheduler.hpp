@@ -12,6 +12,7 @@
 
 #include <hpx/config.hpp>
 #include <hpx/assert.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
 #include <hpx/debugging/print.hpp>
 #include <hpx/execution_base/this_thread.hpp>
 #include <hpx/functional/function.hpp>
@@ -96,6 +97,42 @@ namespace hpx { namespace threads { namespace policies {
         std::size_t low_priority;
     };
 
+    // Holds the parameters used for one level of the steal hierarchy.
+    struct steal_level_parameters
+    {
+        // the level is tried only on every backoff-th consecutive failed
+        // steal attempt of a worker, a value of zero disables the level
+        std::size_t backoff = 1;
+        // maximal number of tasks converted from a victim's staged queue
+        static constexpr std::size_t default_batch_size = 64;
+        std::size_t batch_size = default_batch_size;
+    };
+
+    // Holds the parameters of all levels of the steal hierarchy used by idle
+    // worker threads. The levels are ordered by increasing distance between
+    // thief and victim: workers sharing the L2 cache (core pair), workers
+    // sharing the L3 cache (CCX), other workers on the same NUMA domain, and
+    // workers on remote NUMA domains.
+    struct steal_hierarchy_parameters
+    {
+        enum level : std::size_t
+        {
+            core = 0,
+            cache = 1,
+            numa = 2,
+            remote = 3,
+            num_levels = 4
+        };
+
+        std::array<steal_level_parameters, num_levels> levels_;
+
+        // threads tied to a NUMA domain (created with a NUMA hint) are stolen
+        // by workers of other domains only after this many consecutive failed
+        // steal attempts of the thief
+        static constexpr std::size_t default_numa_affinity_starvation = 16;
+        std::size_t numa_affinity_starvation = default_numa_affinity_starvation;
+    };
+
     ///////////////////////////////////////////////////////////////////////////
     /// The shared_priority_queue_scheduler maintains a set of high, normal, and
     /// low priority queues. For each priority level there is a core/queue ratio
@@ -125,12 +162,14 @@ namespace hpx { namespace threads { namespace policies {
                 const core_ratios& cores_per_queue,
                 detail::affinity_data const& affinity_data,
                 const thread_queue_init_parameters& thread_queue_init,
-                char const* description = "shared_priority_queue_scheduler")
+                char const* description = "shared_priority_queue_scheduler",
+                steal_hierarchy_parameters const& steal_hierarchy = {})
               : num_worker_threads_(num_worker_threads)
               , cores_per_queue_(cores_per_queue)
               , thread_queue_init_(thread_queue_init)
               , affinity_data_(affinity_data)
               , description_(description)
+              , steal_hierarchy_(steal_hierarchy)
             {
             }
 
@@ -151,6 +190,7 @@ namespace hpx { namespace threads { namespace policies {
             thread_queue_init_parameters thread_queue_init_;
             detail::affinity_data const& affinity_data_;
             char const* description_;
+            steal_hierarchy_parameters steal_hierarchy_;
         };
         typedef init_parameter init_parameter_type;
 
@@ -169,6 +209,8 @@ namespace hpx { namespace threads { namespace policies {
           , num_domains_(1)
           , affinity_data_(init.affinity_data_)
           , queue_parameters_(init.thread_queue_init_)
+          , steal_hierarchy_(init.steal_hierarchy_)
+          , steal_state_(init.num_worker_threads_)
           , initialized_(false)
           , debug_init_(false)
           , thread_init_counter_(0)
@@ -490,6 +532,8 @@ namespace hpx { namespace threads { namespace policies {
                         operation_HP(dom, q_index, origin, var, (d > 0), true);
                     if (result)
                     {
+                        steal_state_[local_thread_number()]
+                            .data_.failed_attempts_ = 0;
                         spq_deb.debug(debug::str<>(prefix),
                             "steal_high_priority_first BP/HP",
                             (d == 0 ? "taken" : "stolen"), "D",
@@ -508,6 +552,8 @@ namespace hpx { namespace threads { namespace policies {
                         operation(dom, q_index, origin, var, (d > 0), true);
                     if (result)
                     {
+                        steal_state_[local_thread_number()]
+                            .data_.failed_attempts_ = 0;
                         spq_deb.debug(debug::str<>(prefix),
                             "steal_high_priority_first NP/LP",
                             (d == 0 ? "taken" : "stolen"), "D",
@@ -518,6 +564,7 @@ namespace hpx { namespace threads { namespace policies {
                     if (!steal_numa)
                         break;
                 }
+                ++steal_state_[local_thread_number()].data_.failed_attempts_;
             }
             else /*steal_after_local*/
             {
@@ -536,64 +583,116 @@ namespace hpx { namespace threads { namespace policies {
 
                 if (steal_core)
                 {
-                    if (q_counts_[domain] > 1)
-                    {
-                        // steal from other cores on this numa domain?
-                        // use q+1 to avoid testing the same local queue again
-                        q_index = fast_mod((q_index + 1), q_counts_[domain]);
-                        result = operation_HP(
-                            domain, q_index, origin, var, true, true);
-                        result = result ||
-                            operation(domain, q_index, origin, var, true, true);
-                        if (result)
-                        {
-                            spq_deb.debug(debug::str<>(prefix),
-                                "steal_after_local this numa", "stolen", "D",
-                                debug::dec<2>(domain), "Q",
-                                debug::dec<3>(q_index));
-                            return result;
-                        }
-                    }
+                    // walk the steal hierarchy of this thread, starting with
+                    // the closest victims
+                    return steal_hierarchical<T>(origin, var, prefix,
+                        steal_numa, operation_HP, operation);
+                }
+            }
+            return false;
+        }
+
+        // Try the victims of the calling worker level by level, beginning
+        // with the workers sharing a cache with it and ending with the ones
+        // on remote NUMA domains. A level is skipped if its backoff does not
+        // permit trying it during the current attempt.
+        template <typename T>
+        bool steal_hierarchical(thread_holder_type* origin, T& var,
+            const char* prefix, bool steal_numa,
+            hpx::function<bool(std::size_t, std::size_t, thread_holder_type*,
+                T&, bool, bool)> const& operation_HP,
+            hpx::function<bool(std::size_t, std::size_t, thread_holder_type*,
+                T&, bool, bool)> const& operation)
+        {
+            std::size_t this_thread = local_thread_number();
+            HPX_ASSERT(this_thread < num_workers_);
+
+            steal_state& state = steal_state_[this_thread].data_;
+            for (std::size_t l = 0; l != steal_hierarchy_parameters::num_levels;
+                 ++l)
+            {
+                // if no numa stealing, skip other domains
+                if (l == steal_hierarchy_parameters::remote && !steal_numa)
+                    break;
+
+                steal_level_parameters const& params =
+                    steal_hierarchy_.levels_[l];
+                std::vector<std::size_t> const& victims = state.victims_[l];
+                if (victims.empty() || params.backoff == 0 ||
+                    (state.failed_attempts_ % params.backoff) != 0)
+                {
+                    continue;
                 }
 
-                if (steal_numa)
+                state.batch_size_ = params.batch_size;
+
+                // try BP/HP queues of all victims on this level first
+                for (int hp = 1; hp >= 0; --hp)
                 {
-                    // try other numa domains BP/HP
-                    for (std::size_t d = 1; d < num_domains_; ++d)
+                    for (std::size_t victim : victims)
                     {
-                        std::size_t dom = fast_mod(domain + d, num_domains_);
-                        q_index = fast_mod(q_index, q_counts_[dom]);
-                        result =
-                            operation_HP(dom, q_index, origin, var, true, true);
+                        std::size_t dom = d_lookup_[victim];
+                        std::size_t q = victim - q_offset_[dom];
+                        bool result = hp ?
+                            operation_HP(dom, q, origin, var, true, false) :
+                            operation(dom, q, origin, var, true, false);
                         if (result)
                         {
                             spq_deb.debug(debug::str<>(prefix),
-                                "steal_after_local other numa BP/HP",
-                                (d == 0 ? "taken" : "stolen"), "D",
-                                debug::dec<2>(domain), "Q",
-                                debug::dec<3>(q_index));
-                            return result;
-                        }
-                    }
-                    // try other numa domains NP/LP
-                    for (std::size_t d = 1; d < num_domains_; ++d)
-                    {
-                        std::size_t dom = fast_mod(domain + d, num_domains_);
-                        q_index = fast_mod(q_index, q_counts_[dom]);
-                        result =
-                            operation(dom, q_index, origin, var, true, true);
-                        if (result)
-                        {
-                            spq_deb.debug(debug::str<>(prefix),
-                                "steal_after_local other numa NP/LP",
-                                (d == 0 ? "taken" : "stolen"), "D",
-                                debug::dec<2>(domain), "Q",
-                                debug::dec<3>(q_index));
-                            return result;
+                                "steal_after_local level", debug::dec<1>(l),
+                                (hp ? "BP/HP" : "NP/LP"), "stolen", "D",
+                                debug::dec<2>(dom), "Q", debug::dec<3>(q));
+
+                            state.failed_attempts_ = 0;
+                            state.batch_size_ =
+                                steal_level_parameters::default_batch_size;
+                            return true;
                         }
                     }
                 }
             }
+
+            ++state.failed_attempts_;
+            state.batch_size_ = steal_level_parameters::default_batch_size;
+            return false;
+        }
+
+        // Whether the calling worker may take threads and tasks tied to
+        // another NUMA domain, that is, whether it is starving
+        bool may_steal_numa_affine(std::size_t this_thread) const
+        {
+            return steal_state_[this_thread].data_.failed_attempts_ >=
+                steal_hierarchy_.numa_affinity_starvation;
+        }
+
+        // Check a thread the calling worker took from the queues of another
+        // NUMA domain. A thread tied to a different domain than the one of
+        // the worker is moved back into a queue of its domain, unless the
+        // worker is starving.
+        bool accept_stolen_thread(std::size_t this_thread,
+            std::size_t q_index, threads::thread_id_ref_type& thrd)
+        {
+            thread_data* data = get_thread_id_data(thrd);
+            std::int16_t const affinity = data->get_numa_affinity();
+            if (affinity < 0)
+                return true;
+
+            std::size_t const home =
+                fast_mod(static_cast<std::size_t>(affinity), num_domains_);
+            if (home == d_lookup_[this_thread] ||
+                may_steal_numa_affine(this_thread))
+            {
+                return true;
+            }
+
+            spq_deb.debug(debug::str<>("numa affinity"), "keep", "D",
+                debug::dec<2>(home),
+                debug::threadinfo<threads::thread_id_ref_type*>(&thrd));
+
+            thread_priority const priority = data->get_priority();
+            numa_holder_[home]
+                .thread_queue(fast_mod(q_index, q_counts_[home]))
+                ->schedule_thread(HPX_MOVE(thrd), priority, false);
             return false;
         }
 
@@ -616,7 +715,9 @@ namespace hpx { namespace threads { namespace policies {
                     threads::thread_id_ref_type& thrd, bool stealing,
                     bool allow_stealing) {
                     return numa_holder_[domain].get_next_thread_HP(
-                        q_index, thrd, stealing, allow_stealing);
+                               q_index, thrd, stealing, allow_stealing) &&
+                        (domain == d_lookup_[this_thread] ||
+                            accept_stolen_thread(this_thread, q_index, thrd));
                 };
 
             auto get_next_thread_function =
@@ -625,7 +726,9 @@ namespace hpx { namespace threads { namespace policies {
                     threads::thread_id_ref_type& thrd, bool stealing,
                     bool allow_stealing) {
                     return numa_holder_[domain].get_next_thread(
-                        q_index, thrd, stealing, allow_stealing);
+                               q_index, thrd, stealing, allow_stealing) &&
+                        (domain == d_lookup_[this_thread] ||
+                            accept_stolen_thread(this_thread, q_index, thrd));
                 };
 
             std::size_t domain = d_lookup_[this_thread];
@@ -671,16 +774,22 @@ namespace hpx { namespace threads { namespace policies {
                 [&](std::size_t domain, std::size_t q_index,
                     thread_holder_type* receiver, std::size_t& added,
                     bool stealing, bool allow_stealing) {
-                    return numa_holder_[domain].add_new_HP(
-                        receiver, q_index, added, stealing, allow_stealing);
+                    return numa_holder_[domain].add_new_HP(receiver, q_index,
+                        added, stealing, allow_stealing,
+                        steal_state_[this_thread].data_.batch_size_,
+                        domain != d_lookup_[this_thread] &&
+                            !may_steal_numa_affine(this_thread));
                 };
 
             auto add_new_function = [&](std::size_t domain, std::size_t q_index,
                                         thread_holder_type* receiver,
                                         std::size_t& added, bool stealing,
                                         bool allow_stealing) {
-                return numa_holder_[domain].add_new(
-                    receiver, q_index, added, stealing, allow_stealing);
+                return numa_holder_[domain].add_new(receiver, q_index, added,
+                    stealing, allow_stealing,
+                    steal_state_[this_thread].data_.batch_size_,
+                    domain != d_lookup_[this_thread] &&
+                        !may_steal_numa_affine(this_thread));
             };
 
             std::size_t domain = d_lookup_[this_thread];
@@ -811,6 +920,22 @@ namespace hpx { namespace threads { namespace policies {
                     static_cast<std::size_t>(schedulehint.mode));
             }
 
+            // a thread tied to a NUMA domain is resumed on that domain unless
+            // a specific worker was requested
+            std::int16_t const affinity =
+                get_thread_id_data(thrd)->get_numa_affinity();
+            if (schedulehint.mode == thread_schedule_hint_mode::none &&
+                affinity >= 0)
+            {
+                std::size_t const home =
+                    fast_mod(static_cast<std::size_t>(affinity), num_domains_);
+                if (home != domain_num)
+                {
+                    domain_num = home;
+                    q_index = fast_mod(q_index, q_counts_[home]);
+                }
+            }
+
             spq_deb.debug(debug::str<>("thread scheduled"), msg, "Thread",
                 debug::dec<3>(thread_num), "D", debug::dec<2>(domain_num), "Q",
                 debug::dec<3>(q_index));
@@ -1202,6 +1327,9 @@ namespace hpx { namespace threads { namespace policies {
                 std::this_thread::yield();
             }
 
+            // all domain lookups are valid now, build our steal hierarchy
+            init_steal_hierarchy(topo, local_thread);
+
             lock.lock();
             if (!debug_init_)
             {
@@ -1220,6 +1348,69 @@ namespace hpx { namespace threads { namespace policies {
             }
         }
 
+        // Sort all other workers of this pool into the levels of the steal
+        // hierarchy of the given worker based on the caches and NUMA domains
+        // they share with it.
+        void init_steal_hierarchy(
+            topology const& topo, std::size_t local_thread)
+        {
+            using levels = steal_hierarchy_parameters;
+
+            std::size_t const pu_num = affinity_data_.get_pu_num(
+                local_to_global_thread_index(local_thread));
+            std::size_t const domain = d_lookup_[local_thread];
+
+            // if the machine does not expose an L2 cache, fall back to the
+            // PUs of the same core
+            mask_type l2_mask = topo.get_cache_affinity_mask(pu_num, 2);
+            if (!any(l2_mask))
+                l2_mask = topo.get_core_affinity_mask(pu_num);
+            mask_type const l3_mask = topo.get_cache_affinity_mask(pu_num, 3);
+
+            steal_state& state = steal_state_[local_thread].data_;
+            for (auto& victims : state.victims_)
+                victims.clear();
+
+            // visit the other workers starting with our neighbor to spread
+            // thieves across victims, remote domains are visited in order of
+            // their distance in the domain numbering
+            for (std::size_t d = 0; d != num_domains_; ++d)
+            {
+                std::size_t const dom = fast_mod(domain + d, num_domains_);
+                for (std::size_t i = 1; i <= num_workers_; ++i)
+                {
+                    std::size_t const victim =
+                        fast_mod(local_thread + i, num_workers_);
+                    if (victim == local_thread || d_lookup_[victim] != dom)
+                        continue;
+
+                    if (d != 0)
+                    {
+                        state.victims_[levels::remote].push_back(victim);
+                        continue;
+                    }
+
+                    std::size_t const victim_pu = affinity_data_.get_pu_num(
+                        local_to_global_thread_index(victim));
+                    if (test(l2_mask, victim_pu))
+                        state.victims_[levels::core].push_back(victim);
+                    else if (any(l3_mask) && test(l3_mask, victim_pu))
+                        state.victims_[levels::cache].push_back(victim);
+                    else
+                        state.victims_[levels::numa].push_back(victim);
+                }
+            }
+
+            state.failed_attempts_ = 0;
+            state.batch_size_ = steal_level_parameters::default_batch_size;
+
+            spq_deb.debug(debug::str<>("steal hierarchy"), "local_thread",
+                local_thread, "core", state.victims_[levels::core].size(),
+                "cache", state.victims_[levels::cache].size(), "numa",
+                state.victims_[levels::numa].size(), "remote",
+                state.victims_[levels::remote].size());
+        }
+
         void on_stop_thread(std::size_t thread_num) override
         {
             if (thread_num > num_workers_)
@@ -1399,6 +1590,25 @@ namespace hpx { namespace threads { namespace policies {
 
         const thread_queue_init_parameters queue_parameters_;
 
+        // per level backoff and batch size used by idle workers
+        const steal_hierarchy_parameters steal_hierarchy_;
+
+        // per worker state of the steal hierarchy, accessed by the owning
+        // worker only (after initialization)
+        struct steal_state
+        {
+            // local worker ids of the victims on each level
+            std::array<std::vector<std::size_t>,
+                steal_hierarchy_parameters::num_levels>
+                victims_;
+            // number of consecutive failed steal attempts
+            std::size_t failed_attempts_ = 0;
+            // batch size of the level currently being tried
+            std::size_t batch_size_ =
+                steal_level_parameters::default_batch_size;
+        };
+        std::vector<util::cache_line_data<steal_state>> steal_state_;
+
         // used to make sure the scheduler is only initialized once on a thread
         std::mutex init_mutex;
         bool initialized_;
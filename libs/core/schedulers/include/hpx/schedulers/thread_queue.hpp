@@ -20,6 +20,7 @@
 #include <hpx/schedulers/maintain_queue_wait_times.hpp>
 #include <hpx/schedulers/queue_helpers.hpp>
 #include <hpx/thread_support/unlock_guard.hpp>
+#include <hpx/threading_base/queue_latency_histogram.hpp>
 #include <hpx/threading_base/scheduler_base.hpp>
 #include <hpx/threading_base/thread_data.hpp>
 #include <hpx/threading_base/thread_data_stackful.hpp>
@@ -110,9 +111,21 @@ namespace hpx { namespace threads { namespace policies {
             std::uint64_t waittime;
         };
         using thread_description_ptr = thread_description*;
+
+        static threads::thread_data* get_thread_data(
+            thread_description_ptr trd) noexcept
+        {
+            return get_thread_id_data(trd->data);
+        }
 #else
         using thread_description_ptr =
             typename thread_id_ref_type::thread_repr*;
+
+        static threads::thread_data* get_thread_data(
+            thread_description_ptr trd) noexcept
+        {
+            return static_cast<threads::thread_data*>(trd);
+        }
 #endif
 
         using work_items_type = typename PendingQueuing::template apply<
@@ -124,6 +137,86 @@ namespace hpx { namespace threads { namespace policies {
         using terminated_items_type =
             typename TerminatedQueuing::template apply<thread_data*>::type;
 
+        // Recycled thread objects of one stack size which can be reused
+        // without acquiring the queue mutex. The number of objects held is
+        // bounded by max_free_threads, any excess objects are kept in the
+        // (mutex protected) thread heaps instead.
+        struct thread_free_list
+        {
+            thread_free_list()
+              : items_(128)
+              , count_(0)
+            {
+            }
+
+            terminated_items_type items_;
+            std::atomic<std::int64_t> count_;
+        };
+
+        thread_free_list* get_free_list(std::ptrdiff_t stacksize) noexcept
+        {
+            if (stacksize == parameters_.small_stacksize_)
+            {
+                return &free_list_small_.data_;
+            }
+            else if (stacksize == parameters_.medium_stacksize_)
+            {
+                return &free_list_medium_.data_;
+            }
+            else if (stacksize == parameters_.large_stacksize_)
+            {
+                return &free_list_large_.data_;
+            }
+            else if (stacksize == parameters_.huge_stacksize_)
+            {
+                return &free_list_huge_.data_;
+            }
+            else if (stacksize == parameters_.nostack_stacksize_)
+            {
+                return &free_list_nostack_.data_;
+            }
+            return nullptr;
+        }
+
+        static void normalize_initial_state(threads::thread_init_data& data)
+        {
+            if (data.initial_state ==
+                    thread_schedule_state::pending_do_not_schedule ||
+                data.initial_state == thread_schedule_state::pending_boost)
+            {
+                data.initial_state = thread_schedule_state::pending;
+            }
+        }
+
+        // Try to reuse a recycled thread object from the free list, this
+        // does not require to hold the queue mutex.
+        bool reuse_thread_object(threads::thread_id_ref_type& thrd,
+            threads::thread_init_data& data)
+        {
+            // ASAN gets confused by reusing threads/stacks
+#if !defined(HPX_HAVE_ADDRESS_SANITIZER)
+            thread_free_list* free_list = get_free_list(
+                data.scheduler_base->get_stack_size(data.stacksize));
+            HPX_ASSERT(free_list);
+
+            threads::thread_data* p = nullptr;
+            if (free_list->items_.pop(p))
+            {
+                --free_list->count_;
+                normalize_initial_state(data);
+
+                // Take ownership of the thread object and rebind it.
+                thrd = thread_id_type(p);
+                p->rebind(data);
+                return true;
+            }
+#else
+            HPX_UNUSED(thrd);
+            HPX_UNUSED(data);
+#endif
+            return false;
+        }
+
     protected:
         template <typename Lock>
         void create_thread_object(threads::thread_id_ref_type& thrd,
@@ -158,13 +251,13 @@ namespace hpx { namespace threads { namespace policies {
             }
             HPX_ASSERT(heap);
 
-            if (data.initial_state ==
-                    thread_schedule_state::pending_do_not_schedule ||
-                data.initial_state == thread_schedule_state::pending_boost)
+            if (reuse_thread_object(thrd, data))
             {
-                data.initial_state = thread_schedule_state::pending;
+                return;
             }
 
+            normalize_initial_state(data);
+
             // ASAN gets confused by reusing threads/stacks
 #if !defined(HPX_HAVE_ADDRESS_SANITIZER)
 
@@ -328,6 +421,18 @@ namespace hpx { namespace threads { namespace policies {
             std::ptrdiff_t stacksize =
                 get_thread_id_data(thrd)->get_stack_size();
 
+            // prefer the free list, which allows for reusing the thread
+            // object without acquiring the mutex
+            thread_free_list* free_list = get_free_list(stacksize);
+            if (free_list != nullptr &&
+                free_list->count_.load(std::memory_order_relaxed) <
+                    parameters_.max_free_threads_)
+            {
+                free_list->items_.push(get_thread_id_data(thrd));
+                ++free_list->count_;
+                return;
+            }
+
             if (stacksize == parameters_.small_stacksize_)
             {
                 thread_heap_small_.push_back(thrd);
@@ -468,6 +573,11 @@ namespace hpx { namespace threads { namespace policies {
           , thread_heap_large_()
           , thread_heap_huge_()
           , thread_heap_nostack_()
+          , free_list_small_()
+          , free_list_medium_()
+          , free_list_large_()
+          , free_list_huge_()
+          , free_list_nostack_()
 #ifdef HPX_HAVE_THREAD_CREATION_AND_CLEANUP_RATES
           , add_new_time_(0)
           , cleanup_terminated_time_(0)
@@ -479,6 +589,8 @@ namespace hpx { namespace threads { namespace policies {
           , stolen_from_staged_(0)
           , stolen_to_pending_(0)
           , stolen_to_staged_(0)
+          , steal_batches_(0)
+          , stolen_in_batches_(0)
 #endif
         {
             new_tasks_count_.data_ = 0;
@@ -490,8 +602,23 @@ namespace hpx { namespace threads { namespace policies {
             p->destroy();
         }
 
+        static void deallocate(thread_free_list& free_list) noexcept
+        {
+            threads::thread_data* p = nullptr;
+            while (free_list.items_.pop(p))
+            {
+                deallocate(p);
+            }
+        }
+
         ~thread_queue()
         {
+            deallocate(free_list_small_.data_);
+            deallocate(free_list_medium_.data_);
+            deallocate(free_list_large_.data_);
+            deallocate(free_list_huge_.data_);
+            deallocate(free_list_nostack_.data_);
+
             for (auto t : thread_heap_small_)
                 deallocate(get_thread_id_data(t));
 
@@ -561,6 +688,14 @@ namespace hpx { namespace threads { namespace policies {
         }
 #endif
 
+        // adds the bucket counts of the queue latencies of the threads taken
+        // from this queue by its own worker, or by other workers if stolen
+        void get_queue_latency_counts(
+            std::vector<std::uint64_t>& counts, bool stolen, bool reset) const
+        {
+            queue_latencies_[stolen ? 1 : 0].add_counts(counts, reset);
+        }
+
 #ifdef HPX_HAVE_THREAD_STEALING_COUNTS
         std::int64_t get_num_pending_misses(bool reset)
         {
@@ -621,6 +756,16 @@ namespace hpx { namespace threads { namespace policies {
         {
             stolen_to_staged_.fetch_add(num, std::memory_order_relaxed);
         }
+
+        std::int64_t get_num_steal_batches(bool reset)
+        {
+            return util::get_and_reset_value(steal_batches_, reset);
+        }
+
+        std::int64_t get_num_stolen_in_batches(bool reset)
+        {
+            return util::get_and_reset_value(stolen_in_batches_, reset);
+        }
 #else
         constexpr void increment_num_pending_misses(std::size_t /* num */ = 1)
         {
@@ -670,12 +815,18 @@ namespace hpx { namespace threads { namespace policies {
                 // created, as it might have that the current HPX thread gets
                 // suspended.
                 {
-                    std::unique_lock<mutex_type> lk(mtx_);
-
                     bool schedule_now =
                         data.initial_state == thread_schedule_state::pending;
 
-                    create_thread_object(thrd, data, lk);
+                    // a recycled thread object is rebound before acquiring
+                    // the mutex, which is then needed for the thread map only
+                    bool const reused = reuse_thread_object(thrd, data);
+
+                    std::unique_lock<mutex_type> lk(mtx_);
+                    if (!reused)
+                    {
+                        create_thread_object(thrd, data, lk);
+                    }
 
                     // add a new entry in the map for this thread
                     std::pair<thread_map_type::iterator, bool> p =
@@ -749,6 +900,41 @@ namespace hpx { namespace threads { namespace policies {
                 ec = make_success_code();
         }
 
+        // Register task descriptions for the later creation of the threads
+        // *data[0], ..., *data[count - 1], all of which must be pending and
+        // must not be run immediately. The number of new tasks is updated
+        // once for all of them.
+        void create_thread_n(
+            thread_init_data* const* data, std::size_t count, error_code& ec)
+        {
+            new_tasks_count_.data_ += static_cast<std::int64_t>(count);
+
+            for (std::size_t i = 0; i != count; ++i)
+            {
+                thread_init_data& d = *data[i];
+
+                HPX_ASSERT(!d.run_now);
+                HPX_ASSERT(d.initial_state == thread_schedule_state::pending);
+
+                if (d.stacksize == threads::thread_stacksize::current)
+                {
+                    d.stacksize = get_self_stacksize_enum();
+                }
+
+                task_description* td = task_description_alloc_.allocate(1);
+#ifdef HPX_HAVE_THREAD_QUEUE_WAITTIME
+                new (td) task_description{
+                    HPX_MOVE(d), hpx::chrono::high_resolution_clock::now()};
+#else
+                new (td) task_description{HPX_MOVE(d)};    //-V106
+#endif
+                new_tasks_.push(td);
+            }
+
+            if (&ec != &throws)
+                ec = make_success_code();
+        }
+
         void move_work_items_from(thread_queue* src, std::int64_t count)
         {
             thread_description_ptr trd;
@@ -828,6 +1014,9 @@ namespace hpx { namespace threads { namespace policies {
             {
                 --work_items_count_.data_;
 
+                threads::detail::record_queue_latency(get_thread_data(tdesc),
+                    queue_latencies_[allow_stealing ? 1 : 0]);
+
                 if (get_maintain_queue_wait_times_enabled())
                 {
                     work_items_wait_ +=
@@ -845,6 +1034,10 @@ namespace hpx { namespace threads { namespace policies {
             thread_description_ptr next_thrd;
             if (0 != work_items_count && work_items_.pop(next_thrd, steal))
             {
+                threads::detail::record_queue_latency(
+                    get_thread_data(next_thrd),
+                    queue_latencies_[allow_stealing ? 1 : 0]);
+
                 thrd.reset(next_thrd, false);    // do not addref!
                 --work_items_count_.data_;
                 return true;
@@ -853,10 +1046,71 @@ namespace hpx { namespace threads { namespace policies {
             return false;
         }
 
+        /// Steal work from the given victim queue: return the next thread
+        /// to be executed and move up to steal_batch_size - 1 additional
+        /// pending threads of the victim into this queue in the same
+        /// operation. Returns the overall number of stolen threads.
+        std::size_t steal_next_thread(
+            thread_queue* victim, threads::thread_id_ref_type& thrd)
+        {
+            HPX_ASSERT(victim != this);
+
+            if (!victim->get_next_thread(thrd, true, true))
+            {
+                return 0;
+            }
+
+            std::int64_t count = parameters_.steal_batch_size_;
+            if (count <= 0)
+            {
+                // steal half of the pending threads (including the one
+                // returned above)
+                count = (victim->work_items_count_.data_.load(
+                             std::memory_order_relaxed) +
+                            1) /
+                    2;
+            }
+
+            std::size_t stolen = 1;
+            thread_description_ptr trd;
+            while (static_cast<std::int64_t>(stolen) < count &&
+                victim->work_items_.pop(trd, true))
+            {
+                --victim->work_items_count_.data_;
+
+                // the latency of the threads moved by a steal is recorded
+                // once, when they are stolen
+                threads::detail::record_queue_latency(
+                    get_thread_data(trd), victim->queue_latencies_[1]);
+
+#ifdef HPX_HAVE_THREAD_QUEUE_WAITTIME
+                if (get_maintain_queue_wait_times_enabled())
+                {
+                    std::uint64_t now =
+                        hpx::chrono::high_resolution_clock::now();
+                    victim->work_items_wait_ += now - trd->waittime;
+                    ++victim->work_items_wait_count_;
+                    trd->waittime = now;
+                }
+#endif
+                ++work_items_count_.data_;
+                work_items_.push(trd);
+                ++stolen;
+            }
+
+#ifdef HPX_HAVE_THREAD_STEALING_COUNTS
+            ++steal_batches_;
+            stolen_in_batches_.fetch_add(stolen, std::memory_order_relaxed);
+#endif
+            return stolen;
+        }
+
         /// Schedule the passed thread
         void schedule_thread(
             threads::thread_id_ref_type thrd, bool other_end = false)
         {
+            threads::detail::stamp_queue_latency(get_thread_id_data(thrd));
+
             ++work_items_count_.data_;
 #ifdef HPX_HAVE_THREAD_QUEUE_WAITTIME
             work_items_.push(new thread_description{HPX_MOVE(thrd),
@@ -869,6 +1123,28 @@ namespace hpx { namespace threads { namespace policies {
 #endif
         }
 
+        /// Schedule the passed threads, the number of work items is updated
+        /// once for all of them
+        void schedule_thread_n(
+            threads::thread_id_ref_type* thrds, std::size_t count)
+        {
+            work_items_count_.data_ += static_cast<std::int64_t>(count);
+
+            for (std::size_t i = 0; i != count; ++i)
+            {
+                threads::detail::stamp_queue_latency(
+                    get_thread_id_data(thrds[i]));
+#ifdef HPX_HAVE_THREAD_QUEUE_WAITTIME
+                work_items_.push(new thread_description{HPX_MOVE(thrds[i]),
+                    hpx::chrono::high_resolution_clock::now()});
+#else
+                // detach the thread from the id_ref without decrementing
+                // the reference count
+                work_items_.push(thrds[i].detach());
+#endif
+            }
+        }
+
         /// Destroy the passed thread as it has been terminated
         void destroy_thread(threads::thread_data* thrd)
         {
@@ -1131,6 +1407,13 @@ namespace hpx { namespace threads { namespace policies {
                 "fails you've most likely changed the default without changing "
                 "the code here.");
 
+            // Threads of the default stack size don't need a stack if they are
+            // run to completion.
+            if (parameters_.run_to_completion_)
+            {
+                return;
+            }
+
             std::lock_guard<mutex_type> lk(mtx_);
             for (std::int64_t i = 0; i < parameters_.init_threads_count_; ++i)
             {
@@ -1149,7 +1432,7 @@ namespace hpx { namespace threads { namespace policies {
                 p->init();
 
                 // Finally, store the thread for later use
-                thread_heap_small_.emplace_back(p);
+                recycle_thread(thread_id_type(p));
             }
         }
         void on_stop_thread(std::size_t /* num_thread */) {}
@@ -1196,6 +1479,15 @@ namespace hpx { namespace threads { namespace policies {
         thread_heap_type thread_heap_huge_;
         thread_heap_type thread_heap_nostack_;
 
+        // recycled thread objects which can be reused without locking, each
+        // list is placed on its own cache line as those are accessed
+        // concurrently by the threads creating and cleaning up threads
+        util::cache_aligned_data<thread_free_list> free_list_small_;
+        util::cache_aligned_data<thread_free_list> free_list_medium_;
+        util::cache_aligned_data<thread_free_list> free_list_large_;
+        util::cache_aligned_data<thread_free_list> free_list_huge_;
+        util::cache_aligned_data<thread_free_list> free_list_nostack_;
+
 #ifdef HPX_HAVE_THREAD_CREATION_AND_CLEANUP_RATES
         std::uint64_t add_new_time_;
         std::uint64_t cleanup_terminated_time_;
@@ -1216,7 +1508,15 @@ namespace hpx { namespace threads { namespace policies {
         std::atomic<std::int64_t> stolen_to_pending_;
         // count of new_tasks stolen to this queue from other queues
         std::atomic<std::int64_t> stolen_to_staged_;
+        // count of steal operations performed for this queue
+        std::atomic<std::int64_t> steal_batches_;
+        // count of work_items stolen by those steal operations
+        std::atomic<std::int64_t> stolen_in_batches_;
 #endif
+        // the latencies of the threads taken by the worker owning this queue
+        // (index 0) and of the threads stolen by other workers (index 1)
+        mutable threads::queue_latency_histogram queue_latencies_[2];
+
         // count of new tasks to run, separate to new cache line to avoid false
         // sharing
         util::cache_line_data<std::atomic<std::int64_t>> new_tasks_count_;
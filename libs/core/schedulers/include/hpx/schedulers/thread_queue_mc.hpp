@@ -95,8 +95,10 @@ namespace hpx { namespace threads { namespace policies {
         //
         // This is not thread safe, only the thread owning the holder should
         // call this function
-        std::size_t add_new(
-            std::int64_t add_count, thread_queue_type* addfrom, bool stealing)
+        // if skip_numa_affine is set, tasks created with a NUMA hint are
+        // left in the queue they are taken from
+        std::size_t add_new(std::int64_t add_count, thread_queue_type* addfrom,
+            bool stealing, bool skip_numa_affine = false)
         {
             if (addfrom->new_tasks_count_.data_.load(
                     std::memory_order_relaxed) == 0)
@@ -111,6 +113,14 @@ namespace hpx { namespace threads { namespace policies {
             {
                 // create the new thread
                 threads::thread_init_data& data = task;
+                if (skip_numa_affine &&
+                    data.schedulehint.mode ==
+                        threads::thread_schedule_hint_mode::numa)
+                {
+                    addfrom->new_task_items_.push(HPX_MOVE(task));
+                    continue;
+                }
+
                 threads::thread_id_ref_type tid;
 
                 holder_->create_thread_object(tid, data);
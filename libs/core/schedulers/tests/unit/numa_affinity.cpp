@@ -0,0 +1,83 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This test verifies that threads created with a NUMA hint keep their affinity
+// to the domain (also after being suspended) and that all of them are run by
+// the shared-priority scheduler, whether or not idle worker threads are
+// allowed to steal them (hpx.thread_queue.steal_numa_affinity_starvation).
+
+#include <hpx/local/execution.hpp>
+#include <hpx/local/future.hpp>
+#include <hpx/local/init.hpp>
+#include <hpx/local/thread.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/modules/threading_base.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+std::size_t const num_tasks = 10000;
+std::atomic<std::size_t> count(0);
+
+void check_affinity(std::int16_t expected)
+{
+    HPX_TEST_EQ(
+        hpx::threads::get_self_id_data()->get_numa_affinity(), expected);
+
+    // the affinity survives suspending the thread
+    hpx::this_thread::yield();
+    HPX_TEST_EQ(
+        hpx::threads::get_self_id_data()->get_numa_affinity(), expected);
+
+    ++count;
+}
+
+int hpx_main()
+{
+    count = 0;
+
+    hpx::execution::parallel_executor exec(hpx::threads::thread_schedule_hint(
+        hpx::threads::thread_schedule_hint_mode::numa, 0));
+
+    // create all tasks from this thread, other threads are bound to steal
+    std::vector<hpx::future<void>> futures;
+    futures.reserve(2 * num_tasks);
+    for (std::size_t i = 0; i != num_tasks; ++i)
+    {
+        futures.push_back(hpx::async(exec, &check_affinity, 0));
+        futures.push_back(hpx::async(&check_affinity, -1));
+    }
+    hpx::wait_all(futures);
+
+    HPX_TEST_EQ(count.load(), 2 * num_tasks);
+
+    return hpx::local::finalize();
+}
+
+void test_numa_affinity(int argc, char* argv[], std::size_t starvation)
+{
+    hpx::local::init_params init_args;
+    init_args.cfg = {"hpx.os_threads=4", "hpx.scheduler=shared-priority",
+        "hpx.thread_queue.steal_numa_affinity_starvation=" +
+            std::to_string(starvation)};
+
+    HPX_TEST_EQ(hpx::local::init(hpx_main, argc, argv, init_args), 0);
+}
+
+int main(int argc, char* argv[])
+{
+    // steal tied threads right away, after a couple of failed attempts, and
+    // (practically) never
+    test_numa_affinity(argc, argv, 0);
+    test_numa_affinity(argc, argv, 16);
+    test_numa_affinity(argc, argv, std::size_t(-1));
+
+    return hpx::util::report_errors();
+}
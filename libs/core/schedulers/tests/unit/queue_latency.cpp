@@ -0,0 +1,130 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This test verifies that the schedulers record the times the threads spend
+// in their queues once the queue latency histograms are enabled.
+
+#include <hpx/local/future.hpp>
+#include <hpx/local/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/modules/threading_base.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+using hpx::threads::queue_latency_histogram;
+using hpx::threads::thread_priority;
+
+std::size_t const num_tasks = 1000;
+bool has_priority_queues = false;
+
+std::uint64_t get_total(std::vector<std::uint64_t> const& counts)
+{
+    std::uint64_t total = 0;
+    for (std::uint64_t count : counts)
+    {
+        total += count;
+    }
+    return total;
+}
+
+void test_histogram()
+{
+    queue_latency_histogram histogram;
+    for (std::uint64_t value = 0; value != 100; ++value)
+    {
+        histogram.record(value);
+    }
+    histogram.record(1000000);
+
+    std::vector<std::uint64_t> counts;
+    histogram.add_counts(counts, false);
+    HPX_TEST_EQ(counts.size(), queue_latency_histogram::num_buckets);
+    HPX_TEST_EQ(get_total(counts), std::uint64_t(101));
+
+    // the small values are counted exactly, the others within 12.5%
+    HPX_TEST_EQ(queue_latency_histogram::get_percentile(counts, 0), 0u);
+    HPX_TEST_EQ(queue_latency_histogram::get_percentile(counts, 10), 10u);
+    std::uint64_t const median =
+        queue_latency_histogram::get_percentile(counts, 50);
+    HPX_TEST_LTE(std::uint64_t(50), median);
+    HPX_TEST_LTE(median, std::uint64_t(50 + 50 / 8));
+    std::uint64_t const max =
+        queue_latency_histogram::get_percentile(counts, 100);
+    HPX_TEST_LTE(std::uint64_t(1000000), max);
+    HPX_TEST_LTE(max, std::uint64_t(1000000 + 1000000 / 8));
+
+    // resetting while reading leaves an empty histogram
+    counts.clear();
+    histogram.add_counts(counts, true);
+    HPX_TEST_EQ(get_total(counts), std::uint64_t(101));
+    counts.clear();
+    histogram.add_counts(counts, false);
+    HPX_TEST_EQ(get_total(counts), std::uint64_t(0));
+    HPX_TEST_EQ(queue_latency_histogram::get_percentile(counts, 50), 0u);
+}
+
+int hpx_main()
+{
+    test_histogram();
+
+    hpx::threads::policies::scheduler_base* scheduler =
+        hpx::threads::get_self_id_data()->get_scheduler_base();
+
+    hpx::threads::set_queue_latency_histograms_enabled(true);
+    HPX_TEST(hpx::threads::get_queue_latency_histograms_enabled());
+
+    scheduler->get_queue_latency_counts(thread_priority::default_, false, true);
+    scheduler->get_queue_latency_counts(thread_priority::default_, true, true);
+
+    std::vector<hpx::future<void>> futures;
+    futures.reserve(num_tasks);
+    for (std::size_t i = 0; i != num_tasks; ++i)
+    {
+        futures.push_back(hpx::async([]() {}));
+    }
+    hpx::wait_all(futures);
+
+    hpx::threads::set_queue_latency_histograms_enabled(false);
+    HPX_TEST(!hpx::threads::get_queue_latency_histograms_enabled());
+
+    // some threads may have been run directly, without being queued
+    std::uint64_t const waited = get_total(scheduler->get_queue_latency_counts(
+        thread_priority::default_, false, false));
+    std::uint64_t const stolen = get_total(scheduler->get_queue_latency_counts(
+        thread_priority::default_, true, false));
+    HPX_TEST_LT(std::uint64_t(0), waited + stolen);
+    HPX_TEST_LTE(waited + stolen, std::uint64_t(num_tasks + 1));
+
+    // all threads above were created with normal priority
+    if (has_priority_queues)
+    {
+        HPX_TEST_EQ(get_total(scheduler->get_queue_latency_counts(
+                        thread_priority::low, false, false)),
+            std::uint64_t(0));
+    }
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    for (std::string const scheduler :
+        {"local-priority-fifo", "local-priority-lifo", "static-priority",
+            "local", "static"})
+    {
+        has_priority_queues = scheduler.find("priority") != std::string::npos;
+
+        hpx::local::init_params init_args;
+        init_args.cfg = {"hpx.os_threads=4", "hpx.scheduler=" + scheduler};
+
+        HPX_TEST_EQ(hpx::local::init(hpx_main, argc, argv, init_args), 0);
+    }
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,73 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This test verifies that terminated threads are correctly reused for new
+// threads, both from the lock-free free lists of the thread queues and from
+// the thread heaps taking the overflow (hpx.thread_queue.max_free_threads).
+
+#include <hpx/local/execution.hpp>
+#include <hpx/local/future.hpp>
+#include <hpx/local/init.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <vector>
+
+std::size_t const num_rounds = 10;
+std::size_t const num_tasks = 1000;
+std::atomic<std::size_t> count(0);
+
+void run_tasks(hpx::threads::thread_stacksize stacksize)
+{
+    hpx::execution::parallel_executor exec(stacksize);
+
+    for (std::size_t round = 0; round != num_rounds; ++round)
+    {
+        count = 0;
+
+        // the threads of one round are recycled and reused by the next
+        std::vector<hpx::future<void>> futures;
+        futures.reserve(num_tasks);
+        for (std::size_t i = 0; i != num_tasks; ++i)
+        {
+            futures.push_back(hpx::async(exec, []() { ++count; }));
+        }
+        hpx::wait_all(futures);
+
+        HPX_TEST_EQ(count.load(), num_tasks);
+    }
+}
+
+int hpx_main()
+{
+    run_tasks(hpx::threads::thread_stacksize::small_);
+    run_tasks(hpx::threads::thread_stacksize::medium);
+
+    return hpx::local::finalize();
+}
+
+void test_max_free_threads(int argc, char* argv[], int max_free_threads)
+{
+    hpx::local::init_params init_args;
+    init_args.cfg = {"hpx.os_threads=4",
+        "hpx.thread_queue.max_free_threads=" +
+            std::to_string(max_free_threads)};
+
+    HPX_TEST_EQ(hpx::local::init(hpx_main, argc, argv, init_args), 0);
+}
+
+int main(int argc, char* argv[])
+{
+    // no free list, a small one overflowing often, and the default size
+    test_max_free_threads(argc, argv, 0);
+    test_max_free_threads(argc, argv, 4);
+    test_max_free_threads(argc, argv, 128);
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,106 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This test verifies that threads of the default stack size are run without a
+// stack of their own if hpx.thread_queue.run_to_completion is enabled, and
+// that those threads can still yield, sleep, and wait for futures.
+
+#include <hpx/local/chrono.hpp>
+#include <hpx/local/execution.hpp>
+#include <hpx/local/future.hpp>
+#include <hpx/local/init.hpp>
+#include <hpx/local/thread.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/modules/threading_base.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <vector>
+
+std::size_t const num_tasks = 1000;
+std::atomic<std::size_t> count(0);
+
+bool is_stackless()
+{
+    return hpx::threads::get_self_id_data()->is_stackless();
+}
+
+void test_default_stacksize()
+{
+    count = 0;
+
+    std::vector<hpx::future<bool>> futures;
+    futures.reserve(num_tasks);
+    for (std::size_t i = 0; i != num_tasks; ++i)
+    {
+        futures.push_back(hpx::async([]() {
+            ++count;
+            return is_stackless();
+        }));
+    }
+
+    for (auto& f : futures)
+    {
+        HPX_TEST(f.get());
+    }
+    HPX_TEST_EQ(count.load(), num_tasks);
+}
+
+void test_explicit_stacksize()
+{
+    hpx::execution::parallel_executor exec(
+        hpx::threads::thread_stacksize::medium);
+    HPX_TEST(!hpx::async(exec, &is_stackless).get());
+}
+
+void test_blocking()
+{
+    count = 0;
+
+    // yielding and sleeping continue running the stackless thread
+    hpx::future<void> f1 = hpx::async([]() {
+        hpx::this_thread::yield();
+        hpx::this_thread::sleep_for(std::chrono::milliseconds(10));
+        ++count;
+    });
+
+    // waiting for a future blocks the worker thread until the future is ready
+    hpx::future<int> f2 = hpx::async([]() {
+        hpx::execution::parallel_executor exec(
+            hpx::threads::thread_stacksize::medium);
+        return hpx::async(exec, []() {
+            hpx::this_thread::sleep_for(std::chrono::milliseconds(10));
+            return 42;
+        }).get();
+    });
+
+    f1.get();
+    HPX_TEST_EQ(count.load(), std::size_t(1));
+    HPX_TEST_EQ(f2.get(), 42);
+}
+
+int hpx_main()
+{
+    test_default_stacksize();
+    test_explicit_stacksize();
+    test_blocking();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    hpx::local::init_params init_args;
+    init_args.cfg = {
+        "hpx.os_threads=4", "hpx.thread_queue.run_to_completion=1"};
+
+    HPX_TEST_EQ(hpx::local::init(hpx_main, argc, argv, init_args), 0);
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,63 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This test verifies that all tasks are run if idle worker threads steal
+// batches of pending threads (hpx.thread_queue.steal_batch_size).
+
+#include <hpx/local/future.hpp>
+#include <hpx/local/init.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <vector>
+
+std::size_t const num_tasks = 10000;
+std::atomic<std::size_t> count(0);
+
+int hpx_main()
+{
+    count = 0;
+
+    // create all tasks from this thread, other threads are bound to steal
+    std::vector<hpx::future<void>> futures;
+    futures.reserve(num_tasks);
+    for (std::size_t i = 0; i != num_tasks; ++i)
+    {
+        futures.push_back(hpx::async([]() { ++count; }));
+    }
+    hpx::wait_all(futures);
+
+    HPX_TEST_EQ(count.load(), num_tasks);
+
+    return hpx::local::finalize();
+}
+
+void test_steal_batch_size(
+    int argc, char* argv[], std::string const& scheduler, int batch_size)
+{
+    hpx::local::init_params init_args;
+    init_args.cfg = {"hpx.os_threads=4", "hpx.scheduler=" + scheduler,
+        "hpx.thread_queue.steal_batch_size=" + std::to_string(batch_size)};
+
+    HPX_TEST_EQ(hpx::local::init(hpx_main, argc, argv, init_args), 0);
+}
+
+int main(int argc, char* argv[])
+{
+    for (std::string const scheduler :
+        {"local-priority-fifo", "static-priority"})
+    {
+        // steal one, a couple, and half of the pending threads at once
+        test_steal_batch_size(argc, argv, scheduler, 1);
+        test_steal_batch_size(argc, argv, scheduler, 8);
+        test_steal_batch_size(argc, argv, scheduler, 0);
+    }
+
+    return hpx::util::report_errors();
+}
@@ -12,6 +12,9 @@
 #include <hpx/config.hpp>
 #include <hpx/config/endian.hpp>
 #include <hpx/assert.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/serialization/detail/reverse_bytes.hpp>
+#include <hpx/serialization/serialization_chunk.hpp>
 #include <hpx/serialization/serialization_fwd.hpp>
 #include <hpx/serialization/serialize.hpp>
 #include <hpx/serialization/traits/is_bitwise_serializable.hpp>
@@ -23,6 +26,7 @@
 
 #include <array>
 #include <cstddef>
+#include <cstdint>
 #include <type_traits>
 
 namespace hpx::serialization {
@@ -36,6 +40,17 @@ namespace hpx::serialization {
         constexpr array(value_type* t, std::size_t s) noexcept
           : m_t(t)
           , m_element_count(s)
+          , m_rkey(0)
+        {
+        }
+
+        // rkey names the memory the data should be received into if it is
+        // sent as a separate chunk
+        constexpr array(
+            value_type* t, std::size_t s, std::uint64_t rkey) noexcept
+          : m_t(t)
+          , m_element_count(s)
+          , m_rkey(rkey)
         {
         }
 
@@ -52,7 +67,38 @@ namespace hpx::serialization {
         template <typename Archive>
         void serialize(Archive& ar, unsigned int)
         {
+            using element_type = std::remove_const_t<T>;
+
+            // device memory can't be accessed element by element
+            if (is_device_memory_key(m_rkey) &&
+                (ar.disable_array_optimization() || ar.endianess_differs()))
+            {
+                HPX_THROW_EXCEPTION(serialization_error, "array::serialize",
+                    "device memory can only be serialized as a zero-copy "
+                    "chunk");
+            }
+
 #if !defined(HPX_SERIALIZATION_HAVE_ALL_TYPES_ARE_BITWISE_SERIALIZABLE)
+            if constexpr (detail::is_byte_reversible_v<element_type>)
+            {
+                // arithmetic types are sent in bulk, even if their bytes
+                // have to be reversed
+                if (!ar.disable_array_optimization() && ar.endianess_differs())
+                {
+                    if constexpr (std::is_same_v<Archive, input_archive>)
+                    {
+                        detail::load_reversed_bytes(
+                            ar, m_t, sizeof(T), m_element_count);
+                    }
+                    else
+                    {
+                        detail::save_reversed_bytes(
+                            ar, m_t, sizeof(T), m_element_count, m_rkey);
+                    }
+                    return;
+                }
+            }
+
             // NOLINTNEXTLINE(bugprone-branch-clone)
             if (ar.disable_array_optimization() || ar.endianess_differs())
             {
@@ -69,8 +115,6 @@ namespace hpx::serialization {
             HPX_ASSERT(
                 !(ar.disable_array_optimization() || ar.endianess_differs()));
 #endif
-            using element_type = std::remove_const_t<T>;
-
             constexpr bool use_optimized =
                 std::is_default_constructible_v<element_type> &&
                 (hpx::traits::is_bitwise_serializable_v<element_type> ||
@@ -81,15 +125,25 @@ namespace hpx::serialization {
                 // try using chunking
                 if constexpr (std::is_same_v<Archive, input_archive>)
                 {
-                    ar.load_binary_chunk(m_t, m_element_count * sizeof(T));
+                    ar.load_binary_chunk(
+                        m_t, m_element_count * sizeof(T), m_rkey);
                 }
                 else
                 {
-                    ar.save_binary_chunk(m_t, m_element_count * sizeof(T));
+                    ar.save_binary_chunk(
+                        m_t, m_element_count * sizeof(T), m_rkey);
                 }
             }
             else
             {
+                if (is_device_memory_key(m_rkey))
+                {
+                    HPX_THROW_EXCEPTION(serialization_error,
+                        "array::serialize",
+                        "device memory can only hold bitwise serializable "
+                        "types");
+                }
+
                 // normal serialization
                 for (std::size_t i = 0; i != m_element_count; ++i)
                 {
@@ -103,6 +157,7 @@ namespace hpx::serialization {
     private:
         value_type* m_t;
         std::size_t m_element_count;
+        std::uint64_t m_rkey;
     };
 
     // make_array function
@@ -113,6 +168,13 @@ namespace hpx::serialization {
         return array<T>(begin, size);
     }
 
+    template <typename T>
+    HPX_FORCEINLINE constexpr array<T> make_array(
+        T* begin, std::size_t size, std::uint64_t rkey) noexcept
+    {
+        return array<T>(begin, size, rkey);
+    }
+
 #if defined(HPX_SERIALIZATION_HAVE_BOOST_TYPES)
     // implement serialization for boost::array
     template <typename Archive, typename T, std::size_t N>
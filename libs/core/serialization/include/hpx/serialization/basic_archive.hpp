@@ -43,7 +43,9 @@ namespace hpx { namespace serialization {
         disable_data_chunking = 0x00020000,
         archive_is_saving = 0x00040000,
         archive_is_preprocessing = 0x00080000,
-        all_archive_flags = 0x000fe000    // all of the above
+        enable_varint_encoding = 0x00100000,
+        enable_parallel_serialization = 0x00200000,
+        all_archive_flags = 0x003fe000    // all of the above
     };
 
 #if defined(HPX_SERIALIZATION_HAVE_SUPPORTS_ENDIANESS)
@@ -124,6 +126,23 @@ namespace hpx { namespace serialization {
                 flags_ & std::uint32_t(archive_flags::disable_data_chunking));
         }
 
+        // integral values are stored as LEB128 variable length integers,
+        // signed values are zigzag encoded beforehand
+        constexpr bool enable_varint_encoding() const noexcept
+        {
+            return bool(
+                flags_ & std::uint32_t(archive_flags::enable_varint_encoding));
+        }
+
+        // large containers are split into segments which are serialized
+        // concurrently and are stored as separate chunks, the serialized
+        // segments are kept by the archive (see parallel_serialization.hpp)
+        constexpr bool enable_parallel_serialization() const noexcept
+        {
+            return bool(flags_ &
+                std::uint32_t(archive_flags::enable_parallel_serialization));
+        }
+
         constexpr std::uint32_t flags() const noexcept
         {
             return flags_;
@@ -12,6 +12,7 @@
 #include <hpx/serialization/binary_filter.hpp>
 
 #include <cstddef>
+#include <cstdint>
 
 namespace hpx::serialization {
 
@@ -26,7 +27,10 @@ namespace hpx::serialization {
         virtual void set_filter(binary_filter* filter) = 0;
         virtual void save_binary(void const* address, std::size_t count) = 0;
         virtual std::size_t save_binary_chunk(
-            void const* address, std::size_t count) = 0;
+            void const* address, std::size_t count, std::uint64_t rkey) = 0;
+        // return whether save_binary_chunk refers to data of the given size
+        // instead of copying it
+        virtual bool is_zero_copy_chunk(std::size_t count) const noexcept = 0;
         virtual void reset() = 0;
         virtual std::size_t get_num_chunks() const noexcept = 0;
         virtual void flush() = 0;
@@ -44,6 +48,13 @@ namespace hpx::serialization {
         virtual void set_zero_copy_serialization_threshold(
             std::size_t zero_copy_serialization_threshold) = 0;
         virtual void load_binary(void* address, std::size_t count) = 0;
-        virtual void load_binary_chunk(void* address, std::size_t count) = 0;
+        virtual void load_binary_chunk(
+            void* address, std::size_t count, std::uint64_t rkey) = 0;
+
+        // Return the address of the next count bytes instead of copying them,
+        // returns nullptr (without consuming the data) if those are not
+        // available in place.
+        virtual void const* view_binary(std::size_t count) = 0;
+        virtual void const* view_binary_chunk(std::size_t count) = 0;
     };
 }    // namespace hpx::serialization
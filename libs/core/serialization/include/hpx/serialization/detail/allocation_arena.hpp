@@ -0,0 +1,147 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/serialization/detail/extra_archive_data.hpp>
+#include <hpx/serialization/serialization_fwd.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+namespace hpx::serialization::detail {
+
+    ////////////////////////////////////////////////////////////////////////////
+    // A monotonic arena, memory is handed out sequentially from large blocks
+    // and is released all at once when the arena is destroyed.
+    class allocation_arena
+    {
+    public:
+        HPX_CORE_EXPORT explicit allocation_arena(
+            std::size_t block_size) noexcept;
+        HPX_CORE_EXPORT ~allocation_arena();
+
+        allocation_arena(allocation_arena const&) = delete;
+        allocation_arena(allocation_arena&&) = delete;
+        allocation_arena& operator=(allocation_arena const&) = delete;
+        allocation_arena& operator=(allocation_arena&&) = delete;
+
+        HPX_CORE_EXPORT void* allocate(
+            std::size_t bytes, std::size_t alignment);
+
+        std::size_t num_blocks() const noexcept
+        {
+            return num_blocks_;
+        }
+
+    private:
+        struct block;
+
+        block* blocks_;
+        char* current_;
+        std::size_t remaining_;
+        std::size_t block_size_;
+        std::size_t num_blocks_;
+    };
+
+    // An allocator handing out memory from an arena, which keeps the arena
+    // alive as long as any copy of the allocator exists.
+    template <typename T>
+    class arena_allocator
+    {
+    public:
+        using value_type = T;
+
+        explicit arena_allocator(
+            std::shared_ptr<allocation_arena> arena) noexcept
+          : arena_(HPX_MOVE(arena))
+        {
+        }
+
+        template <typename U>
+        arena_allocator(arena_allocator<U> const& rhs) noexcept
+          : arena_(rhs.arena_)
+        {
+        }
+
+        T* allocate(std::size_t n)
+        {
+            return static_cast<T*>(
+                arena_->allocate(n * sizeof(T), alignof(T)));
+        }
+
+        // the memory is released with the arena
+        static constexpr void deallocate(T*, std::size_t) noexcept {}
+
+        template <typename U>
+        friend bool operator==(arena_allocator const& lhs,
+            arena_allocator<U> const& rhs) noexcept
+        {
+            return lhs.arena_ == rhs.arena_;
+        }
+
+        template <typename U>
+        friend bool operator!=(arena_allocator const& lhs,
+            arena_allocator<U> const& rhs) noexcept
+        {
+            return lhs.arena_ != rhs.arena_;
+        }
+
+    private:
+        template <typename U>
+        friend class arena_allocator;
+
+        std::shared_ptr<allocation_arena> arena_;
+    };
+
+    ////////////////////////////////////////////////////////////////////////////
+    // The objects an input archive holding this creates for std::shared_ptr's
+    // are allocated from an arena which is shared by all objects created
+    // while loading the same archive. The arena is released once all of
+    // those objects were destroyed.
+    class pointer_arena
+    {
+    public:
+        // Allocate the objects from blocks of the given size, zero disables
+        // using the arena
+        void enable(std::size_t block_size) noexcept
+        {
+            block_size_ = block_size;
+        }
+
+        bool enabled() const noexcept
+        {
+            return block_size_ != 0;
+        }
+
+        // The arena is created on first use
+        HPX_CORE_EXPORT std::shared_ptr<allocation_arena> const& get();
+
+        void reset() noexcept
+        {
+            arena_.reset();
+        }
+
+    private:
+        std::size_t block_size_ = 0;
+        std::shared_ptr<allocation_arena> arena_;
+    };
+
+    // This is explicitly instantiated to ensure that the id is stable across
+    // shared libraries.
+    template <>
+    struct extra_archive_data_helper<pointer_arena>
+    {
+        HPX_CORE_EXPORT static extra_archive_data_id_type id() noexcept;
+        HPX_CORE_EXPORT static void reset(pointer_arena* data) noexcept;
+    };
+
+    // Return the arena of the given archive if it was enabled
+    HPX_CORE_EXPORT pointer_arena* try_get_pointer_arena(
+        input_archive& ar) noexcept;
+}    // namespace hpx::serialization::detail
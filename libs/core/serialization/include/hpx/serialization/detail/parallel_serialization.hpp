@@ -0,0 +1,191 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/serialization/detail/extra_archive_data.hpp>
+#include <hpx/serialization/input_archive.hpp>
+#include <hpx/serialization/output_archive.hpp>
+#include <hpx/serialization/serialize.hpp>
+#include <hpx/serialization/traits/is_parallel_serializable.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <vector>
+
+namespace hpx::serialization::detail {
+
+    ////////////////////////////////////////////////////////////////////////////
+    // The runtime installs a handler which invokes the given function for all
+    // indices concurrently, the indices are processed sequentially otherwise.
+    using parallel_for_handler_type = std::function<void(
+        std::size_t, std::function<void(std::size_t)> const&)>;
+
+    HPX_CORE_EXPORT void set_parallel_for_handler(parallel_for_handler_type f);
+
+    HPX_CORE_EXPORT void parallel_for(
+        std::size_t count, std::function<void(std::size_t)> const& f);
+
+    // Containers holding at least this many elements are split into segments
+    // of this many elements, zero disables splitting containers.
+    HPX_CORE_EXPORT void set_parallel_serialization_threshold(
+        std::size_t threshold) noexcept;
+    HPX_CORE_EXPORT std::size_t get_parallel_serialization_threshold() noexcept;
+
+    ////////////////////////////////////////////////////////////////////////////
+    struct serialized_segment
+    {
+        std::uint64_t elements_ = 0;
+        std::vector<char> data_;
+    };
+
+    using serialized_segments = std::vector<serialized_segment>;
+
+    // The segments are sent as zero-copy chunks referring to the memory held
+    // by this tracker, the owner of the archive has to keep the segments
+    // alive (see move_segments) until the data was sent. The segments
+    // serialized while preprocessing a parcel are handed to the archive
+    // serializing the parcel (see set_cached_segments), which avoids
+    // serializing them twice.
+    class segments_tracker
+    {
+    public:
+        HPX_CORE_EXPORT void set_cached_segments(serialized_segments&& cached);
+
+        // Return all segments referred to by the archive
+        HPX_CORE_EXPORT serialized_segments move_segments() noexcept;
+
+        // Make room for the segments of a container of the given size split
+        // into segments of the given number of elements, returns the index
+        // of the first segment. The cached segments are reused if they match.
+        HPX_CORE_EXPORT std::size_t acquire(std::size_t size,
+            std::size_t segment_size, std::size_t num_segments, bool& reused);
+
+        // Keep memory of the given size alive for as long as the segments,
+        // used for data which is sent as a zero-copy chunk but does not
+        // outlive the archive otherwise
+        HPX_CORE_EXPORT std::vector<char>& retain(std::size_t bytes);
+
+        serialized_segment& operator[](std::size_t i) noexcept
+        {
+            return segments_[i];
+        }
+
+        void reset() noexcept
+        {
+            cached_.clear();
+            next_cached_ = 0;
+            segments_.clear();
+        }
+
+    private:
+        serialized_segments cached_;
+        std::size_t next_cached_ = 0;
+        serialized_segments segments_;
+    };
+
+    // This is explicitly instantiated to ensure that the id is stable across
+    // shared libraries.
+    template <>
+    struct extra_archive_data_helper<segments_tracker>
+    {
+        HPX_CORE_EXPORT static extra_archive_data_id_type id() noexcept;
+        HPX_CORE_EXPORT static void reset(segments_tracker* data);
+    };
+
+    // The archives of the segments use the same encoding as the parent
+    // archive, nested containers are not split any further.
+    inline constexpr std::uint32_t segment_archive_flags(
+        std::uint32_t flags) noexcept
+    {
+        return flags &
+            ~(std::uint32_t(archive_flags::enable_compression) |
+                std::uint32_t(archive_flags::archive_is_saving) |
+                std::uint32_t(archive_flags::archive_is_preprocessing) |
+                std::uint32_t(archive_flags::disable_data_chunking) |
+                std::uint32_t(archive_flags::enable_parallel_serialization));
+    }
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Serialize the elements of a container which were not stored yet into
+    // separate segments, returns false if the container is stored as usual.
+    template <typename Iterator>
+    bool save_segments(output_archive& ar, Iterator begin, std::size_t size)
+    {
+        std::size_t const segment_size = get_parallel_serialization_threshold();
+        if (segment_size == 0 || size < segment_size)
+        {
+            ar << std::uint64_t(0);
+            return false;
+        }
+
+        std::size_t const num_segments =
+            (size + segment_size - 1) / segment_size;
+        ar << std::uint64_t(num_segments);
+
+        auto& tracker = ar.get_extra_data<segments_tracker>();
+
+        bool reused = false;
+        std::size_t const first =
+            tracker.acquire(size, segment_size, num_segments, reused);
+
+        if (!reused)
+        {
+            std::vector<Iterator> starts;
+            starts.reserve(num_segments);
+            for (std::size_t i = 0; i != num_segments; ++i)
+            {
+                starts.push_back(begin);
+                if (i + 1 != num_segments)
+                {
+                    std::advance(begin, segment_size);
+                }
+            }
+
+            std::uint32_t const flags = segment_archive_flags(ar.flags());
+            parallel_for(num_segments, [&](std::size_t i) {
+                serialized_segment& segment = tracker[first + i];
+                segment.elements_ =
+                    (std::min)(segment_size, size - i * segment_size);
+                segment.data_.clear();
+
+                output_archive archive(segment.data_, flags);
+
+                Iterator it = starts[i];
+                for (std::uint64_t j = 0; j != segment.elements_; ++j, ++it)
+                {
+                    archive << *it;
+                }
+                archive.flush();
+            });
+        }
+
+        for (std::size_t i = 0; i != num_segments; ++i)
+        {
+            serialized_segment const& segment = tracker[first + i];
+
+            ar << segment.elements_ << std::uint64_t(segment.data_.size());
+            ar.save_binary_chunk(segment.data_.data(), segment.data_.size());
+        }
+        return true;
+    }
+
+    // Receive the segments of a container of the given size, returns false
+    // if the container was stored as usual.
+    HPX_CORE_EXPORT bool load_segments(input_archive& ar, std::uint64_t size,
+        serialized_segments& segments);
+
+    // Invoke the function (possibly concurrently) for each of the segments
+    // with an archive holding its data, the index of the segment, and the
+    // index and number of the elements stored in the segment.
+    HPX_CORE_EXPORT void for_each_segment(serialized_segments& segments,
+        std::function<void(input_archive&, std::size_t, std::size_t,
+            std::size_t)> const& f);
+}    // namespace hpx::serialization::detail
@@ -11,11 +11,13 @@
 #include <hpx/config.hpp>
 #include <hpx/serialization/access.hpp>
 #include <hpx/serialization/basic_archive.hpp>
+#include <hpx/serialization/detail/allocation_arena.hpp>
 #include <hpx/serialization/detail/extra_archive_data.hpp>
 #include <hpx/serialization/detail/non_default_constructible.hpp>
 #include <hpx/serialization/detail/polymorphic_id_factory.hpp>
 #include <hpx/serialization/detail/polymorphic_intrusive_factory.hpp>
 #include <hpx/serialization/detail/polymorphic_nonintrusive_factory.hpp>
+#include <hpx/serialization/detail/polymorphic_type_names.hpp>
 #include <hpx/serialization/serialization_fwd.hpp>
 #include <hpx/serialization/string.hpp>
 #include <hpx/serialization/traits/polymorphic_traits.hpp>
@@ -87,6 +89,21 @@ namespace hpx::serialization {
             Pointer t_;
         };
 
+        // Objects referred to by std::shared_ptr's can be allocated from an
+        // arena, if they are created using their default constructor
+        template <typename Pointer, typename Enable = void>
+        struct uses_pointer_arena : std::false_type
+        {
+        };
+
+        template <typename T>
+        struct uses_pointer_arena<std::shared_ptr<T>,
+            std::void_t<typename constructor_selector_ptr<
+                std::remove_cv_t<T>>::default_selector>>
+          : std::is_default_constructible<std::remove_cv_t<T>>
+        {
+        };
+
         template <typename Pointer>
         class pointer_input_dispatcher
         {
@@ -96,11 +113,8 @@ namespace hpx::serialization {
             {
                 static Pointer call(input_archive& ar)
                 {
-                    std::string name;
-                    ar >> name;
-
                     Pointer t(polymorphic_intrusive_factory::instance()
-                                  .create<referred_type>(name));
+                                  .create<referred_type>(load_type_name(ar)));
                     ar >> *t;
                     return t;
                 }
@@ -145,6 +159,19 @@ namespace hpx::serialization {
             {
                 static Pointer call(input_archive& ar)
                 {
+                    if constexpr (uses_pointer_arena<Pointer>::value)
+                    {
+                        if (auto* arena = try_get_pointer_arena(ar))
+                        {
+                            using value_type = std::remove_cv_t<referred_type>;
+
+                            auto t = std::allocate_shared<value_type>(
+                                arena_allocator<value_type>(arena->get()));
+                            ar >> *t;
+                            return t;
+                        }
+                    }
+
                     Pointer t(
                         constructor_selector_ptr<referred_type>::create(ar));
                     return t;
@@ -173,8 +200,7 @@ namespace hpx::serialization {
             {
                 static void call(output_archive& ar, Pointer const& ptr)
                 {
-                    std::string const name = access::get_name(ptr.get());
-                    ar << name;
+                    save_type_name(ar, access::get_name(ptr.get()));
                     ar << *ptr;
                 }
             };
@@ -68,6 +68,10 @@ namespace hpx::serialization::detail {
     class constructor_selector_ptr
     {
     public:
+        // specializations for types with custom constructors do not define
+        // this
+        using default_selector = void;
+
         static T* create(input_archive& ar)
         {
             std::unique_ptr<T> t;
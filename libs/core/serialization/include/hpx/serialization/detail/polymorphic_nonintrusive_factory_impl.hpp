@@ -9,6 +9,7 @@
 #pragma once
 
 #include <hpx/serialization/detail/polymorphic_nonintrusive_factory.hpp>
+#include <hpx/serialization/detail/polymorphic_type_names.hpp>
 
 #include <hpx/serialization/input_archive.hpp>
 #include <hpx/serialization/output_archive.hpp>
@@ -24,8 +25,8 @@ namespace hpx { namespace serialization { namespace detail {
         // It's safe to call typeid here. The typeid(t) return value is
         // only used for local lookup to the portable string that goes over the
         // wire
-        std::string const class_name = typeinfo_map_.at(typeid(t).name());
-        ar << class_name;
+        std::string const& class_name = typeinfo_map_.at(typeid(t).name());
+        save_type_name(ar, class_name);
 
         map_.at(class_name).save_function(ar, &t);
     }
@@ -33,19 +34,13 @@ namespace hpx { namespace serialization { namespace detail {
     template <typename T>
     void polymorphic_nonintrusive_factory::load(input_archive& ar, T& t)
     {
-        std::string class_name;
-        ar >> class_name;
-
-        map_.at(class_name).load_function(ar, &t);
+        map_.at(load_type_name(ar)).load_function(ar, &t);
     }
 
     template <typename T>
     T* polymorphic_nonintrusive_factory::load(input_archive& ar)
     {
-        std::string class_name;
-        ar >> class_name;
-
-        const function_bunch_type& bunch = map_.at(class_name);
+        const function_bunch_type& bunch = map_.at(load_type_name(ar));
         T* t = static_cast<T*>(bunch.create_function(ar));
 
         return t;
@@ -0,0 +1,61 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/serialization/detail/extra_archive_data.hpp>
+#include <hpx/serialization/serialization_fwd.hpp>
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace hpx::serialization {
+
+    ////////////////////////////////////////////////////////////////////////////
+    namespace detail {
+
+        // The names of polymorphic types are sent only once per archive,
+        // every later occurrence of the same name is replaced by the index
+        // of its first occurrence.
+        struct output_type_name_tracker
+        {
+            std::unordered_map<std::string, std::uint16_t> ids_;
+        };
+
+        struct input_type_name_tracker
+        {
+            std::vector<std::string> names_;
+            std::string overflow_;
+        };
+
+        // This is explicitly instantiated to ensure that the id is stable
+        // across shared libraries.
+        template <>
+        struct extra_archive_data_helper<input_type_name_tracker>
+        {
+            HPX_CORE_EXPORT static extra_archive_data_id_type id() noexcept;
+            static constexpr void reset(input_type_name_tracker*) noexcept {}
+        };
+
+        template <>
+        struct extra_archive_data_helper<output_type_name_tracker>
+        {
+            HPX_CORE_EXPORT static extra_archive_data_id_type id() noexcept;
+            HPX_CORE_EXPORT static void reset(output_type_name_tracker* data);
+        };
+    }    // namespace detail
+
+    ////////////////////////////////////////////////////////////////////////////
+    HPX_CORE_EXPORT void save_type_name(
+        output_archive& ar, std::string const& name);
+
+    // The returned reference is valid until the next call to load_type_name
+    // for the same archive.
+    HPX_CORE_EXPORT std::string const& load_type_name(input_archive& ar);
+}    // namespace hpx::serialization
@@ -0,0 +1,100 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/serialization/detail/extra_archive_data.hpp>
+#include <hpx/serialization/input_archive.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace hpx::serialization::detail {
+
+    // The owner of the memory an input archive reads from. Views handed out
+    // into the received data (see string_view_arg and span_arg) share the
+    // ownership of that memory, which keeps it alive as long as they exist.
+    class retained_buffer
+    {
+    public:
+        void set_owner(std::shared_ptr<void const> owner) noexcept
+        {
+            owner_ = HPX_MOVE(owner);
+        }
+
+        std::shared_ptr<void const> const& owner() const noexcept
+        {
+            return owner_;
+        }
+
+        void reset() noexcept
+        {
+            owner_.reset();
+        }
+
+    private:
+        std::shared_ptr<void const> owner_;
+    };
+
+    // This is explicitly instantiated to ensure that the id is stable across
+    // shared libraries.
+    template <>
+    struct extra_archive_data_helper<retained_buffer>
+    {
+        HPX_CORE_EXPORT static extra_archive_data_id_type id() noexcept;
+        HPX_CORE_EXPORT static void reset(retained_buffer* data) noexcept;
+    };
+
+    // Return the address of the next count bytes of the archive in place and
+    // set owner to the owner of that memory. Returns nullptr (without
+    // consuming any data) if the data is not available in place or if the
+    // memory is not retained.
+    HPX_CORE_EXPORT void const* view_retained_binary_chunk(input_archive& ar,
+        std::size_t count, std::shared_ptr<void const>& owner);
+
+    // Load size elements of the given type which were stored using
+    // save_binary_chunk, returns the address of the elements in the retained
+    // memory if possible, or of a copy of them otherwise. Owner is set to the
+    // owner of the returned memory.
+    template <typename T>
+    T const* load_view(input_archive& ar, std::size_t size,
+        std::shared_ptr<void const>& owner)
+    {
+        owner.reset();
+        if (size == 0)
+        {
+            return nullptr;
+        }
+
+        std::size_t const count = size * sizeof(T);
+        void const* data = view_retained_binary_chunk(ar, count, owner);
+        if (data != nullptr &&
+            reinterpret_cast<std::uintptr_t>(data) % alignof(T) == 0)
+        {
+            return static_cast<T const*>(data);
+        }
+
+        // the data is either not retained or not properly aligned
+        auto copy = std::make_shared<std::vector<T>>(size);
+        if (data != nullptr)
+        {
+            std::memcpy(copy->data(), data, count);
+        }
+        else
+        {
+            ar.load_binary_chunk(copy->data(), count);
+        }
+
+        T const* result = copy->data();
+        owner = HPX_MOVE(copy);
+        return result;
+    }
+}    // namespace hpx::serialization::detail
@@ -0,0 +1,39 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/serialization/serialization_fwd.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace hpx::serialization::detail {
+
+    // Arrays of these types are sent as a single chunk holding the elements
+    // with the byte order of the archive, even if that differs from the
+    // native byte order.
+    template <typename T>
+    inline constexpr bool is_byte_reversible_v =
+        (std::is_integral_v<T> && !std::is_same_v<T, bool>) ||
+        std::is_same_v<T, float> || std::is_same_v<T, double>;
+
+    // Copy count elements of the given size while reversing the bytes of
+    // each of them, source and destination may be the same
+    HPX_CORE_EXPORT void copy_reversed_bytes(void* dest, void const* src,
+        std::size_t size, std::size_t count) noexcept;
+
+    // Save or load count elements of the given size as a single chunk,
+    // reversing the bytes of each element
+    HPX_CORE_EXPORT void save_reversed_bytes(output_archive& ar,
+        void const* address, std::size_t size, std::size_t count,
+        std::uint64_t rkey);
+
+    HPX_CORE_EXPORT void load_reversed_bytes(input_archive& ar, void* address,
+        std::size_t size, std::size_t count);
+}    // namespace hpx::serialization::detail
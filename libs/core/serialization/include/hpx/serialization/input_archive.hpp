@@ -143,14 +143,24 @@ namespace hpx::serialization {
                     access::serialize(*this, t, 0);
                 }
             }
-#if defined(HPX_SERIALIZATION_HAVE_SUPPORTS_ENDIANESS)
             else if constexpr (std::is_unsigned_v<T>)
             {
                 static_assert(sizeof(T) <= sizeof(std::uint64_t),
                     "integral type is larger than supported");
 
                 std::uint64_t ul;
-                load_integral(ul);
+                if (enable_varint_encoding())
+                {
+                    load_varint(ul);
+                }
+                else
+                {
+#if defined(HPX_SERIALIZATION_HAVE_SUPPORTS_ENDIANESS)
+                    load_integral(ul);
+#else
+                    load_binary(&ul, sizeof(std::uint64_t));
+#endif
+                }
                 t = static_cast<T>(ul);
             }
             else
@@ -159,29 +169,23 @@ namespace hpx::serialization {
                     "integral type is larger than supported");
 
                 std::int64_t l;
-                load_integral(l);
-                t = static_cast<T>(l);
-            }
+                if (enable_varint_encoding())
+                {
+                    std::uint64_t ul;
+                    load_varint(ul);
+                    l = static_cast<std::int64_t>(
+                        (ul >> 1) ^ (~(ul & 1) + 1));
+                }
+                else
+                {
+#if defined(HPX_SERIALIZATION_HAVE_SUPPORTS_ENDIANESS)
+                    load_integral(l);
 #else
-            else if constexpr (std::is_unsigned_v<T>)
-            {
-                static_assert(sizeof(T) <= sizeof(std::uint64_t),
-                    "integral type is larger than supported");
-
-                std::uint64_t ul;
-                load_binary(&ul, sizeof(std::uint64_t));
-                t = static_cast<T>(ul);
-            }
-            else
-            {
-                static_assert(sizeof(T) <= sizeof(std::int64_t),
-                    "integral type is larger than supported");
-
-                std::int64_t ul;
-                load_binary(&ul, sizeof(std::int64_t));
-                t = static_cast<T>(ul);
-            }
+                    load_binary(&l, sizeof(std::int64_t));
 #endif
+                }
+                t = static_cast<T>(l);
+            }
         }
 
         void load(float& f)
@@ -254,6 +258,26 @@ namespace hpx::serialization {
         }
 #endif
 
+        void load_varint(std::uint64_t& value)
+        {
+            value = 0;
+            for (unsigned shift = 0; shift < 64; shift += 7)
+            {
+                std::uint8_t byte = 0;
+                load_binary(&byte, sizeof(std::uint8_t));
+
+                value |= static_cast<std::uint64_t>(byte & 0x7f) << shift;
+                if ((byte & 0x80) == 0)
+                {
+                    return;
+                }
+            }
+
+            HPX_THROW_EXCEPTION(hpx::serialization_error,
+                "hpx::serialization::input_archive::load_varint",
+                "variable length integer is longer than supported");
+        }
+
     public:
         void load_binary(void* address, std::size_t count)
         {
@@ -265,19 +289,49 @@ namespace hpx::serialization {
             size_ += count;
         }
 
-        void load_binary_chunk(void* address, std::size_t count)
+        // rkey is the key the chunk was saved with, chunks of device memory
+        // are never copied
+        void load_binary_chunk(
+            void* address, std::size_t count, std::uint64_t rkey = 0)
         {
             if (0 == count)
                 return;
 
             if (disable_data_chunking())
+            {
+                if (is_device_memory_key(rkey))
+                {
+                    HPX_THROW_EXCEPTION(serialization_error,
+                        "input_archive::load_binary_chunk",
+                        "device memory can't be copied from an archive which "
+                        "does not support zero-copy chunks");
+                }
                 buffer_->load_binary(address, count);
+            }
             else
-                buffer_->load_binary_chunk(address, count);
+            {
+                buffer_->load_binary_chunk(address, count, rkey);
+            }
 
             size_ += count;
         }
 
+        // Return the address of the data load_binary_chunk would copy, the
+        // data is not consumed if nullptr is returned.
+        void const* view_binary_chunk(std::size_t count)
+        {
+            if (0 == count)
+                return nullptr;
+
+            void const* data = disable_data_chunking() ?
+                buffer_->view_binary(count) :
+                buffer_->view_binary_chunk(count);
+
+            if (data != nullptr)
+                size_ += count;
+            return data;
+        }
+
     private:
         std::unique_ptr<erased_input_container> buffer_;
     };
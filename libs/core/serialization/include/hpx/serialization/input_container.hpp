@@ -122,52 +122,52 @@ namespace hpx::serialization {
             }
             else
             {
-                std::size_t new_current = current_ + count;
-                if (new_current > access_traits::size(cont_))
-                {
-                    HPX_THROW_EXCEPTION(serialization_error,
-                        "input_container::load_binary",
-                        "archive data bstream is too short");
-                    return;
-                }
+                check_size(count, "input_container::load_binary");
 
                 access_traits::read(cont_, count, current_, address);
 
-                current_ = new_current;
+                advance(count);
+            }
+        }
 
-                if (chunks_ != nullptr)
-                {
-                    current_chunk_size_ += count;
-
-                    // make sure we switch to the next serialization_chunk if
-                    // necessary
-                    std::size_t current_chunk_size =
-                        get_chunk_size(current_chunk_);
-                    if (current_chunk_size != 0 &&
-                        current_chunk_size_ >= current_chunk_size)
-                    {
-                        // raise an error if we read past the serialization_chunk
-                        if (current_chunk_size_ > current_chunk_size)
-                        {
-                            HPX_THROW_EXCEPTION(serialization_error,
-                                "input_container::load_binary",
-                                "archive data bstream structure mismatch");
-                            return;
-                        }
-                        ++current_chunk_;
-                        current_chunk_size_ = 0;
-                    }
-                }
+        void const* view_binary(std::size_t count) override
+        {
+            // compressed data is not available in place
+            if (filter_ != nullptr)
+            {
+                return nullptr;
+            }
+
+            check_size(count, "input_container::view_binary");
+
+            void const* data = access_traits::data(cont_, current_);
+            if (data != nullptr)
+            {
+                advance(count);
             }
+            return data;
         }
 
-        void load_binary_chunk(void* address, std::size_t count) override
+        void load_binary_chunk(
+            void* address, std::size_t count, std::uint64_t rkey) override
         {
             HPX_ASSERT((std::int64_t) count >= 0);
 
-            if (chunks_ == nullptr ||
-                count < zero_copy_serialization_threshold_ ||
-                filter_ != nullptr)
+            // chunks of device memory are always sent as zero-copy chunks
+            bool const device_memory = is_device_memory_key(rkey);
+            if (device_memory && chunks_ == nullptr)
+            {
+                HPX_THROW_EXCEPTION(serialization_error,
+                    "input_container::load_binary_chunk",
+                    "archive data bstream is missing the chunk referring to "
+                    "device memory");
+                return;
+            }
+
+            if (!device_memory &&
+                (chunks_ == nullptr ||
+                    count < zero_copy_serialization_threshold_ ||
+                    filter_ != nullptr))
             {
                 // fall back to serialization_chunk-less archive
                 this->input_container::load_binary(address, count);
@@ -186,15 +186,86 @@ namespace hpx::serialization {
                     return;
                 }
 
-                // unfortunately we can't implement a zero copy policy on
-                // the receiving end
-                // as the memory was already allocated by the serialization code
-                std::memcpy(
-                    address, get_chunk_data(current_chunk_).pos_, count);
+                // the data was received in place if the memory allocated by
+                // the serialization code is the chunk itself
+                void const* data = get_chunk_data(current_chunk_).pos_;
+                if (address != data)
+                {
+                    std::memcpy(address, data, count);
+                }
                 ++current_chunk_;
             }
         }
 
+        void const* view_binary_chunk(std::size_t count) override
+        {
+            HPX_ASSERT((std::int64_t) count >= 0);
+
+            if (chunks_ == nullptr ||
+                count < zero_copy_serialization_threshold_ ||
+                filter_ != nullptr)
+            {
+                // fall back to serialization_chunk-less archive
+                return this->input_container::view_binary(count);
+            }
+
+            HPX_ASSERT(current_chunk_ != std::size_t(-1));
+            HPX_ASSERT(get_chunk_type(current_chunk_) ==
+                chunk_type::chunk_type_pointer);
+
+            if (get_chunk_size(current_chunk_) != count)
+            {
+                HPX_THROW_EXCEPTION(serialization_error,
+                    "input_container::view_binary_chunk",
+                    "archive data bstream data chunk size mismatch");
+                return nullptr;
+            }
+
+            void const* data = get_chunk_data(current_chunk_).pos_;
+            ++current_chunk_;
+            return data;
+        }
+
+    private:
+        void check_size(std::size_t count, char const* function) const
+        {
+            if (current_ + count > access_traits::size(cont_))
+            {
+                HPX_THROW_EXCEPTION(serialization_error, function,
+                    "archive data bstream is too short");
+            }
+        }
+
+        void advance(std::size_t count)
+        {
+            current_ += count;
+
+            if (chunks_ != nullptr)
+            {
+                current_chunk_size_ += count;
+
+                // make sure we switch to the next serialization_chunk if
+                // necessary
+                std::size_t current_chunk_size =
+                    get_chunk_size(current_chunk_);
+                if (current_chunk_size != 0 &&
+                    current_chunk_size_ >= current_chunk_size)
+                {
+                    // raise an error if we read past the serialization_chunk
+                    if (current_chunk_size_ > current_chunk_size)
+                    {
+                        HPX_THROW_EXCEPTION(serialization_error,
+                            "input_container::load_binary",
+                            "archive data bstream structure mismatch");
+                        return;
+                    }
+                    ++current_chunk_;
+                    current_chunk_size_ = 0;
+                }
+            }
+        }
+
+    public:
         Container const& cont_;
         std::size_t current_;
         std::unique_ptr<binary_filter> filter_;
@@ -9,16 +9,19 @@
 
 #include <hpx/config/endian.hpp>
 #include <hpx/assert.hpp>
+#include <hpx/serialization/detail/parallel_serialization.hpp>
 #include <hpx/serialization/serialization_fwd.hpp>
 #include <hpx/serialization/serialize.hpp>
 #include <hpx/serialization/traits/is_bitwise_serializable.hpp>
 #include <hpx/serialization/traits/is_not_bitwise_serializable.hpp>
+#include <hpx/serialization/traits/is_parallel_serializable.hpp>
 
 #include <cstddef>
 #include <cstdint>
 #include <map>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 namespace hpx::traits {
 
@@ -116,6 +119,38 @@ namespace hpx::serialization {
         ar >> size;    //-V128
 
         t.clear();
+
+        if constexpr (hpx::traits::is_parallel_serializable_v<value_type>)
+        {
+            // the segments are loaded concurrently, the elements are inserted
+            // in order afterwards
+            detail::serialized_segments segments;
+            if (ar.enable_parallel_serialization() &&
+                detail::load_segments(ar, size, segments))
+            {
+                std::vector<std::vector<std::pair<Key, Value>>> elements(
+                    segments.size());
+                detail::for_each_segment(segments,
+                    [&elements](input_archive& segment, std::size_t i,
+                        std::size_t, std::size_t count) {
+                        elements[i].resize(count);
+                        for (auto& element : elements[i])
+                        {
+                            segment >> element;
+                        }
+                    });
+
+                for (auto& part : elements)
+                {
+                    for (auto& element : part)
+                    {
+                        t.insert(t.end(), HPX_MOVE(element));
+                    }
+                }
+                return;
+            }
+        }
+
         for (std::size_t i = 0; i < size; ++i)
         {
             value_type v;
@@ -133,6 +168,16 @@ namespace hpx::serialization {
 
         std::uint64_t size = t.size();
         ar << size;
+
+        if constexpr (hpx::traits::is_parallel_serializable_v<value_type>)
+        {
+            if (ar.enable_parallel_serialization() &&
+                detail::save_segments(ar, t.begin(), t.size()))
+            {
+                return;
+            }
+        }
+
         for (value_type const& val : t)
         {
             ar << val;
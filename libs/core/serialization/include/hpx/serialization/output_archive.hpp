@@ -12,6 +12,7 @@
 #include <hpx/config/endian.hpp>
 #include <hpx/serialization/config/defines.hpp>
 #include <hpx/assert.hpp>
+#include <hpx/modules/errors.hpp>
 #include <hpx/serialization/basic_archive.hpp>
 #include <hpx/serialization/detail/polymorphic_nonintrusive_factory.hpp>
 #include <hpx/serialization/detail/raw_ptr.hpp>
@@ -129,14 +130,19 @@ namespace hpx::serialization {
             }
 
             // endianness needs to be saved separately as it is needed to
-            // properly interpret the flags
-            // FIXME: make bool once integer compression is implemented
+            // properly interpret the flags, both are saved with their full
+            // width regardless of the integer encoding
+            std::uint32_t const saved_flags = flags_;
+            flags_ = flags_ &
+                ~std::uint32_t(archive_flags::enable_varint_encoding);
+
             std::uint64_t const endianness = endian_big() ? ~0ul : 0ul;
             save(endianness);
 
             // send flags sent by the other end to make sure both ends have
             // the same assumptions about the archive format
-            save(flags_);
+            save(saved_flags);
+            flags_ = saved_flags;
 
             // send the zero-copy limit
             save(zero_copy_serialization_threshold);
@@ -241,29 +247,22 @@ namespace hpx::serialization {
                     access::serialize(*this, t, 0);
                 }
             }
-#if defined(HPX_SERIALIZATION_HAVE_SUPPORTS_ENDIANESS)
-            else if constexpr (std::is_unsigned_v<T>)
-            {
-                static_assert(sizeof(T) <= sizeof(std::uint64_t),
-                    "integral type is larger than supported");
-
-                save_integral(static_cast<std::uint64_t>(t));
-            }
-            else
-            {
-                static_assert(sizeof(T) <= sizeof(std::int64_t),
-                    "integral type is larger than supported");
-
-                save_integral(static_cast<std::int64_t>(t));
-            }
-#else
             else if constexpr (std::is_unsigned_v<T>)
             {
                 static_assert(sizeof(T) <= sizeof(std::uint64_t),
                     "integral type is larger than supported");
 
                 auto val = static_cast<std::uint64_t>(t);
+                if (enable_varint_encoding())
+                {
+                    save_varint(val);
+                    return;
+                }
+#if defined(HPX_SERIALIZATION_HAVE_SUPPORTS_ENDIANESS)
+                save_integral(val);
+#else
                 save_binary(&val, sizeof(std::uint64_t));
+#endif
             }
             else
             {
@@ -271,9 +270,20 @@ namespace hpx::serialization {
                     "integral type is larger than supported");
 
                 auto val = static_cast<std::int64_t>(t);
+                if (enable_varint_encoding())
+                {
+                    // zigzag encoding maps small negative values to small
+                    // unsigned values
+                    save_varint((static_cast<std::uint64_t>(val) << 1) ^
+                        static_cast<std::uint64_t>(-std::int64_t(val < 0)));
+                    return;
+                }
+#if defined(HPX_SERIALIZATION_HAVE_SUPPORTS_ENDIANESS)
+                save_integral(val);
+#else
                 save_binary(&val, sizeof(std::int64_t));
-            }
 #endif
+            }
         }
 
         void save(float f)
@@ -335,6 +345,19 @@ namespace hpx::serialization {
         }
 #endif
 
+        void save_varint(std::uint64_t value)
+        {
+            std::uint8_t data[10];
+            std::size_t count = 0;
+            while (value >= 0x80)
+            {
+                data[count++] = static_cast<std::uint8_t>(value | 0x80);
+                value >>= 7;
+            }
+            data[count++] = static_cast<std::uint8_t>(value);
+            save_binary(data, count);
+        }
+
     public:
         void save_binary(void const* address, std::size_t count)
         {
@@ -345,23 +368,40 @@ namespace hpx::serialization {
             buffer_->save_binary(address, count);
         }
 
-        void save_binary_chunk(void const* address, std::size_t count)
+        // rkey optionally names the memory the chunk should be received into
+        void save_binary_chunk(
+            void const* address, std::size_t count, std::uint64_t rkey = 0)
         {
             if (count == 0)
                 return;
 
             if (disable_data_chunking())
             {
+                if (is_device_memory_key(rkey))
+                {
+                    HPX_THROW_EXCEPTION(serialization_error,
+                        "output_archive::save_binary_chunk",
+                        "device memory can't be copied into an archive which "
+                        "does not support zero-copy chunks");
+                }
                 size_ += count;
                 buffer_->save_binary(address, count);
             }
             else
             {
                 // the size might grow if optimizations are not used
-                size_ += buffer_->save_binary_chunk(address, count);
+                size_ += buffer_->save_binary_chunk(address, count, rkey);
             }
         }
 
+        // Return whether save_binary_chunk refers to data of the given size
+        // instead of copying it into the archive
+        bool is_zero_copy_chunk(std::size_t count) const noexcept
+        {
+            return count != 0 && !disable_data_chunking() &&
+                buffer_->is_zero_copy_chunk(count);
+        }
+
     private:
         std::unique_ptr<erased_output_container> buffer_;
     };
@@ -244,10 +244,11 @@ namespace hpx::serialization {
             current_ = new_current;
         }
 
-        std::size_t save_binary_chunk(
-            void const* address, std::size_t count) override
+        std::size_t save_binary_chunk(void const* address, std::size_t count,
+            std::uint64_t rkey) override
         {
-            if (count < zero_copy_serialization_threshold_)
+            if (count < zero_copy_serialization_threshold_ &&
+                !is_device_memory_key(rkey))
             {
                 // fall back to serialization_chunk-less archive
                 this->output_container::save_binary(address, count);
@@ -272,13 +273,18 @@ namespace hpx::serialization {
 
                 // add a new serialization_chunk referring to the external
                 // buffer
-                chunker_.push_back(create_pointer_chunk(address, count));
+                chunker_.push_back(create_pointer_chunk(address, count, rkey));
 
                 // the container did not grow
                 return 0;
             }
         }
 
+        bool is_zero_copy_chunk(std::size_t count) const noexcept override
+        {
+            return count >= zero_copy_serialization_threshold_;
+        }
+
         bool is_preprocessing() const noexcept override
         {
             return access_traits::is_preprocessing();
@@ -328,14 +334,15 @@ namespace hpx::serialization {
                 if (flushed)
                     break;
 
-                // resize container
-                std::size_t size = access_traits::size(this->cont_);
-                access_traits::resize(this->cont_, 2 * size);
+                // double the size of the container (resize adds to the
+                // current size)
+                access_traits::resize(
+                    this->cont_, access_traits::size(this->cont_));
 
             } while (true);
 
             // truncate container
-            access_traits::resize(this->cont_, this->current_);
+            access_traits::truncate(this->cont_, this->current_);
         }
 
         void set_filter(binary_filter* filter) override
@@ -357,10 +364,11 @@ namespace hpx::serialization {
             this->current_ += count;
         }
 
-        std::size_t save_binary_chunk(
-            void const* address, std::size_t count) override
+        std::size_t save_binary_chunk(void const* address, std::size_t count,
+            std::uint64_t rkey) override
         {
-            if (count < this->zero_copy_serialization_threshold_)
+            if (count < this->zero_copy_serialization_threshold_ &&
+                !is_device_memory_key(rkey))
             {
                 // fall back to serialization_chunk-less archive
                 HPX_ASSERT(count != 0);
@@ -370,7 +378,8 @@ namespace hpx::serialization {
             }
             else
             {
-                return this->base_type::save_binary_chunk(address, count);
+                return this->base_type::save_binary_chunk(
+                    address, count, rkey);
             }
         }
 
@@ -43,6 +43,17 @@ namespace hpx::serialization {
         chunk_type type_;       // chunk_type
     };
 
+    // The receive key of chunks referring to memory which is not accessible
+    // from the host (e.g. the memory of a GPU) has this bit set. Such chunks
+    // are always sent as zero-copy chunks and their data is never copied by
+    // the serialization code.
+    inline constexpr std::uint32_t device_memory_key = 0x80000000;
+
+    constexpr bool is_device_memory_key(std::uint64_t rkey) noexcept
+    {
+        return (static_cast<std::uint32_t>(rkey) & device_memory_key) != 0;
+    }
+
     ///////////////////////////////////////////////////////////////////////
     inline serialization_chunk create_index_chunk(
         std::size_t index, std::size_t size) noexcept
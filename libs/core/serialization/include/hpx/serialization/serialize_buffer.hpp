@@ -23,9 +23,27 @@
 #include <cstddef>
 #include <memory>
 #include <type_traits>
+#include <utility>
 
 namespace hpx::serialization {
 
+    namespace detail {
+
+        // Allocators may name the memory the data of a buffer should be
+        // received into on the destination locality.
+        template <typename Allocator, typename Enable = void>
+        struct has_receive_key : std::false_type
+        {
+        };
+
+        template <typename Allocator>
+        struct has_receive_key<Allocator,
+            std::void_t<decltype(std::declval<Allocator const&>()
+                                     .receive_key())>> : std::true_type
+        {
+        };
+    }    // namespace detail
+
     ///////////////////////////////////////////////////////////////////////////
     template <typename T, typename Allocator = std::allocator<T>>
     class serialize_buffer
@@ -306,7 +324,15 @@ namespace hpx::serialization {
 
             if (size_ != 0)
             {
-                ar << hpx::serialization::make_array(data_.get(), size_);
+                if constexpr (detail::has_receive_key<Allocator>::value)
+                {
+                    ar << hpx::serialization::make_array(
+                        data_.get(), size_, alloc_.receive_key());
+                }
+                else
+                {
+                    ar << hpx::serialization::make_array(data_.get(), size_);
+                }
             }
         }
 
@@ -323,7 +349,15 @@ namespace hpx::serialization {
 
             if (size_ != 0)
             {
-                ar >> hpx::serialization::make_array(data_.get(), size_);
+                if constexpr (detail::has_receive_key<Allocator>::value)
+                {
+                    ar >> hpx::serialization::make_array(
+                        data_.get(), size_, alloc_.receive_key());
+                }
+                else
+                {
+                    ar >> hpx::serialization::make_array(data_.get(), size_);
+                }
             }
         }
 
@@ -0,0 +1,149 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/serialization/detail/retained_buffer.hpp>
+#include <hpx/serialization/input_archive.hpp>
+#include <hpx/serialization/output_archive.hpp>
+#include <hpx/serialization/serialization_fwd.hpp>
+#include <hpx/serialization/serialize.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx::serialization {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // A read-only sequence of trivially copyable elements to be used as an
+    // action parameter to avoid copying the received data. When deserialized
+    // from a parcel the sequence refers to the receive buffer of the parcel,
+    // which is kept alive as long as the sequence exists. Otherwise (and if
+    // the received data is not available in place, e.g. because it was
+    // compressed or is not properly aligned) the sequence owns its data.
+    template <typename T>
+    class span_arg
+    {
+        static_assert(std::is_trivially_copyable_v<T> &&
+                !std::is_same_v<std::remove_cv_t<T>, bool>,
+            "span_arg requires trivially copyable elements");
+
+    public:
+        using value_type = T;
+        using size_type = std::size_t;
+        using const_iterator = T const*;
+        using iterator = const_iterator;
+
+        span_arg() = default;
+
+        span_arg(std::vector<T> v)
+          : size_(v.size())
+        {
+            auto data = std::make_shared<std::vector<T>>(HPX_MOVE(v));
+            data_ = data->data();
+            owner_ = HPX_MOVE(data);
+        }
+
+        span_arg(T const* data, std::size_t size)
+          : span_arg(std::vector<T>(data, data + size))
+        {
+        }
+
+        T const* data() const noexcept
+        {
+            return data_;
+        }
+        std::size_t size() const noexcept
+        {
+            return size_;
+        }
+        bool empty() const noexcept
+        {
+            return size_ == 0;
+        }
+
+        const_iterator begin() const noexcept
+        {
+            return data_;
+        }
+        const_iterator end() const noexcept
+        {
+            return data_ + size_;
+        }
+
+        T const& operator[](std::size_t i) const noexcept
+        {
+            return data_[i];
+        }
+
+        std::vector<T> to_vector() const
+        {
+            return std::vector<T>(begin(), end());
+        }
+
+        friend bool operator==(span_arg const& lhs, span_arg const& rhs)
+        {
+            return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+        }
+        friend bool operator!=(span_arg const& lhs, span_arg const& rhs)
+        {
+            return !(lhs == rhs);
+        }
+
+    private:
+        friend class hpx::serialization::access;
+
+        void load(input_archive& ar, unsigned)
+        {
+            std::uint64_t size = 0;
+            ar >> size;    //-V128
+
+            size_ = size;
+            if (ar.disable_array_optimization() || ar.endianess_differs())
+            {
+                auto data = std::make_shared<std::vector<T>>(size_);
+                for (T& t : *data)
+                {
+                    ar >> t;
+                }
+                data_ = data->data();
+                owner_ = HPX_MOVE(data);
+                return;
+            }
+
+            data_ = detail::load_view<T>(ar, size_, owner_);
+        }
+
+        void save(output_archive& ar, unsigned) const
+        {
+            std::uint64_t size = size_;
+            ar << size;
+
+            if (ar.disable_array_optimization() || ar.endianess_differs())
+            {
+                for (T const& t : *this)
+                {
+                    ar << t;
+                }
+                return;
+            }
+
+            ar.save_binary_chunk(data_, size_ * sizeof(T));
+        }
+
+        HPX_SERIALIZATION_SPLIT_MEMBER()
+
+        T const* data_ = nullptr;
+        std::size_t size_ = 0;
+        std::shared_ptr<void const> owner_;
+    };
+}    // namespace hpx::serialization
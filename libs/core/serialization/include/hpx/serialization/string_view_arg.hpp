@@ -0,0 +1,134 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/serialization/detail/retained_buffer.hpp>
+#include <hpx/serialization/input_archive.hpp>
+#include <hpx/serialization/output_archive.hpp>
+#include <hpx/serialization/serialization_fwd.hpp>
+#include <hpx/serialization/serialize.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
+
+namespace hpx::serialization {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // A read-only string to be used as an action parameter to avoid copying
+    // the received data. When deserialized from a parcel the string refers
+    // to the receive buffer of the parcel, which is kept alive as long as the
+    // string exists. Otherwise (and if the received data is not available in
+    // place, e.g. because it was compressed) the string owns its data.
+    class string_view_arg
+    {
+    public:
+        using value_type = char;
+        using size_type = std::size_t;
+        using const_iterator = char const*;
+        using iterator = const_iterator;
+
+        string_view_arg() = default;
+
+        string_view_arg(std::string s)
+        {
+            auto data = std::make_shared<std::string>(HPX_MOVE(s));
+            view_ = *data;
+            owner_ = HPX_MOVE(data);
+        }
+
+        string_view_arg(char const* s)
+          : string_view_arg(std::string(s))
+        {
+        }
+
+        explicit string_view_arg(std::string_view s)
+          : string_view_arg(std::string(s))
+        {
+        }
+
+        char const* data() const noexcept
+        {
+            return view_.data();
+        }
+        std::size_t size() const noexcept
+        {
+            return view_.size();
+        }
+        bool empty() const noexcept
+        {
+            return view_.empty();
+        }
+
+        const_iterator begin() const noexcept
+        {
+            return view_.data();
+        }
+        const_iterator end() const noexcept
+        {
+            return view_.data() + view_.size();
+        }
+
+        char operator[](std::size_t i) const noexcept
+        {
+            return view_[i];
+        }
+
+        std::string_view view() const noexcept
+        {
+            return view_;
+        }
+        operator std::string_view() const noexcept
+        {
+            return view_;
+        }
+
+        std::string str() const
+        {
+            return std::string(view_);
+        }
+
+        friend bool operator==(
+            string_view_arg const& lhs, string_view_arg const& rhs) noexcept
+        {
+            return lhs.view_ == rhs.view_;
+        }
+        friend bool operator!=(
+            string_view_arg const& lhs, string_view_arg const& rhs) noexcept
+        {
+            return lhs.view_ != rhs.view_;
+        }
+
+    private:
+        friend class hpx::serialization::access;
+
+        void load(input_archive& ar, unsigned)
+        {
+            std::uint64_t size = 0;
+            ar >> size;    //-V128
+
+            char const* data = detail::load_view<char>(ar, size, owner_);
+            view_ = std::string_view(data, size);
+        }
+
+        void save(output_archive& ar, unsigned) const
+        {
+            std::uint64_t size = view_.size();
+            ar << size;
+            ar.save_binary_chunk(view_.data(), view_.size());
+        }
+
+        HPX_SERIALIZATION_SPLIT_MEMBER()
+
+        std::string_view view_;
+        std::shared_ptr<void const> owner_;
+    };
+}    // namespace hpx::serialization
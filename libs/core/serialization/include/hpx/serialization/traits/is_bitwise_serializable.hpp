@@ -8,21 +8,115 @@
 #pragma once
 
 #include <hpx/config.hpp>
+#include <hpx/serialization/access.hpp>
+#include <hpx/serialization/traits/brace_initializable_traits.hpp>
 
 #include <type_traits>
+#include <utility>
 
 namespace hpx::traits {
 
+    template <typename T>
+    struct is_bitwise_serializable;
+
+    namespace detail {
+
+        ///////////////////////////////////////////////////////////////////////
+        // Aggregates without a serialize function of their own are bitwise
+        // serializable if all of their members are. The member types are
+        // found by decomposing the aggregate into as many elements as it can
+        // be brace-initialized from.
+        template <typename... Ts>
+        struct aggregate_members
+        {
+        };
+
+        template <typename... Ts>
+        aggregate_members<std::remove_cv_t<Ts>...> make_aggregate_members(
+            Ts&...) noexcept;
+
+#define HPX_AGGREGATE_MEMBERS_FUNC(count, ...)                                 \
+    template <typename T>                                                      \
+    auto aggregate_members_of(T& t, size<count>) noexcept                      \
+    {                                                                          \
+        auto& [__VA_ARGS__] = t;                                               \
+        return make_aggregate_members(__VA_ARGS__);                            \
+    }                                                                          \
+    /**/
+
+        HPX_AGGREGATE_MEMBERS_FUNC(1, p1)
+        HPX_AGGREGATE_MEMBERS_FUNC(2, p1, p2)
+        HPX_AGGREGATE_MEMBERS_FUNC(3, p1, p2, p3)
+        HPX_AGGREGATE_MEMBERS_FUNC(4, p1, p2, p3, p4)
+        HPX_AGGREGATE_MEMBERS_FUNC(5, p1, p2, p3, p4, p5)
+        HPX_AGGREGATE_MEMBERS_FUNC(6, p1, p2, p3, p4, p5, p6)
+        HPX_AGGREGATE_MEMBERS_FUNC(7, p1, p2, p3, p4, p5, p6, p7)
+        HPX_AGGREGATE_MEMBERS_FUNC(8, p1, p2, p3, p4, p5, p6, p7, p8)
+        HPX_AGGREGATE_MEMBERS_FUNC(9, p1, p2, p3, p4, p5, p6, p7, p8, p9)
+        HPX_AGGREGATE_MEMBERS_FUNC(10, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10)
+        HPX_AGGREGATE_MEMBERS_FUNC(
+            11, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11)
+        HPX_AGGREGATE_MEMBERS_FUNC(
+            12, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12)
+        HPX_AGGREGATE_MEMBERS_FUNC(
+            13, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13)
+        HPX_AGGREGATE_MEMBERS_FUNC(
+            14, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14)
+        HPX_AGGREGATE_MEMBERS_FUNC(15, p1, p2, p3, p4, p5, p6, p7, p8, p9,
+            p10, p11, p12, p13, p14, p15)
+
+#undef HPX_AGGREGATE_MEMBERS_FUNC
+
+        template <typename T>
+        struct is_bitwise_serializable_member
+          : std::disjunction<std::is_enum<T>, is_bitwise_serializable<T>>
+        {
+        };
+
+        template <typename Members>
+        struct are_bitwise_serializable_members;
+
+        template <typename... Ts>
+        struct are_bitwise_serializable_members<aggregate_members<Ts...>>
+          : std::conjunction<is_bitwise_serializable_member<Ts>...>
+        {
+        };
+
+        template <typename T>
+        struct has_bitwise_serializable_members
+          : are_bitwise_serializable_members<decltype(aggregate_members_of(
+                std::declval<T&>(), arity<T>()))>
+        {
+        };
+
+        // The conditions are evaluated in order, the members are inspected
+        // only for trivially copyable aggregates which can be serialized
+        // member by member.
+        template <typename T>
+        struct is_bitwise_serializable_aggregate
+          : std::conjunction<std::is_class<T>, std::is_aggregate<T>,
+                std::negation<std::is_empty<T>>, std::is_trivially_copyable<T>,
+                std::is_trivially_copy_assignable<T>,
+                std::negation<serialization::access::has_serialize<T>>,
+                std::negation<serialization::has_serialize_adl<T>>,
+                serialization::has_struct_serialization<T>,
+                has_bitwise_serializable_members<T>>
+        {
+        };
+    }    // namespace detail
+
 #if !defined(HPX_SERIALIZATION_HAVE_ALLOW_RAW_POINTER_SERIALIZATION)
     template <typename T>
-    struct is_bitwise_serializable : std::is_arithmetic<T>
+    struct is_bitwise_serializable
+      : std::disjunction<std::is_arithmetic<T>,
+            detail::is_bitwise_serializable_aggregate<T>>
     {
     };
 #else
     template <typename T>
     struct is_bitwise_serializable
-      : std::integral_constant<bool,
-            std::is_arithmetic<T>::value || std::is_pointer<T>::value>
+      : std::disjunction<std::is_arithmetic<T>, std::is_pointer<T>,
+            detail::is_bitwise_serializable_aggregate<T>>
     {
     };
 #endif
@@ -0,0 +1,63 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/serialization/traits/is_bitwise_serializable.hpp>
+
+#include <map>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx::traits {
+
+    // Large containers of elements of these types may be split into segments
+    // which are serialized concurrently into separate archives. This is safe
+    // only for types which do not rely on any state kept by the archive
+    // (like the credit splitting of id_types).
+    template <typename T, typename Enable = void>
+    struct is_parallel_serializable
+      : std::integral_constant<bool,
+            is_bitwise_serializable_v<T> || std::is_enum_v<T>>
+    {
+    };
+
+    template <typename T>
+    inline constexpr bool is_parallel_serializable_v =
+        is_parallel_serializable<std::remove_const_t<T>>::value;
+
+    template <typename Char, typename CharTraits, typename Allocator>
+    struct is_parallel_serializable<
+        std::basic_string<Char, CharTraits, Allocator>> : std::true_type
+    {
+    };
+
+    template <typename T, typename Allocator>
+    struct is_parallel_serializable<std::vector<T, Allocator>>
+      : std::integral_constant<bool, is_parallel_serializable_v<T>>
+    {
+    };
+
+    template <typename Key, typename Value>
+    struct is_parallel_serializable<std::pair<Key, Value>>
+      : std::integral_constant<bool,
+            is_parallel_serializable_v<Key> &&
+                is_parallel_serializable_v<Value>>
+    {
+    };
+
+    template <typename Key, typename Value, typename Compare,
+        typename Allocator>
+    struct is_parallel_serializable<std::map<Key, Value, Compare, Allocator>>
+      : std::integral_constant<bool,
+            is_parallel_serializable_v<Key> &&
+                is_parallel_serializable_v<Value>>
+    {
+    };
+}    // namespace hpx::traits
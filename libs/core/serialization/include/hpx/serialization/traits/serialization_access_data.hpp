@@ -50,6 +50,13 @@ namespace hpx::traits {
         {
         }
 
+        // the address of the data at the given position, if available
+        static constexpr void const* data(Container const& /* cont */,
+            std::size_t /* current */) noexcept
+        {
+            return nullptr;
+        }
+
         static constexpr std::size_t init_data(Container const& /* cont */,
             serialization::binary_filter* /* filter */,
             std::size_t /* current */, std::size_t decompressed_size) noexcept
@@ -58,6 +65,11 @@ namespace hpx::traits {
         }
 
         static constexpr void reset(Container& /* cont */) noexcept {}
+
+        static constexpr void truncate(
+            Container& /* cont */, std::size_t /* size */) noexcept
+        {
+        }
     };
 
     ///////////////////////////////////////////////////////////////////////
@@ -75,6 +87,11 @@ namespace hpx::traits {
             return cont.resize(cont.size() + count);
         }
 
+        static void truncate(Container& cont, std::size_t size)
+        {
+            cont.resize(size);
+        }
+
         static void write(Container& cont, std::size_t count,
             std::size_t current, void const* address) noexcept
         {
@@ -148,6 +165,12 @@ namespace hpx::traits {
             }
         }
 
+        static void const* data(
+            Container const& cont, std::size_t current) noexcept
+        {
+            return &cont[current];
+        }
+
         static std::size_t init_data(Container const& cont,
             serialization::binary_filter* filter, std::size_t current,
             std::size_t decompressed_size)
@@ -11,15 +11,18 @@
 #include <hpx/config/endian.hpp>
 #include <hpx/assert.hpp>
 #include <hpx/serialization/array.hpp>
+#include <hpx/serialization/detail/parallel_serialization.hpp>
 #include <hpx/serialization/detail/serialize_collection.hpp>
 #include <hpx/serialization/serialization_fwd.hpp>
 #include <hpx/serialization/serialize.hpp>
 #include <hpx/serialization/traits/is_bitwise_serializable.hpp>
 #include <hpx/serialization/traits/is_not_bitwise_serializable.hpp>
+#include <hpx/serialization/traits/is_parallel_serializable.hpp>
 
 #include <cstddef>
 #include <cstdint>
 #include <type_traits>
+#include <utility>
 #include <vector>
 
 namespace hpx::serialization {
@@ -69,7 +72,9 @@ namespace hpx::serialization {
         if constexpr (use_optimized)
         {
 #if !defined(HPX_SERIALIZATION_HAVE_ALL_TYPES_ARE_BITWISE_SERIALIZABLE)
-            if (ar.disable_array_optimization() || ar.endianess_differs())
+            if (ar.disable_array_optimization() ||
+                (ar.endianess_differs() &&
+                    !detail::is_byte_reversible_v<element_type>))
             {
                 detail::load_collection(ar, v, size);
                 return;
@@ -88,6 +93,26 @@ namespace hpx::serialization {
         }
         else
         {
+            if constexpr (hpx::traits::is_parallel_serializable_v<
+                              element_type>)
+            {
+                detail::serialized_segments segments;
+                if (ar.enable_parallel_serialization() &&
+                    detail::load_segments(ar, size, segments))
+                {
+                    v.resize(size);
+                    detail::for_each_segment(segments,
+                        [&v](input_archive& segment, std::size_t,
+                            std::size_t first, std::size_t count) {
+                            for (std::size_t i = 0; i != count; ++i)
+                            {
+                                segment >> v[first + i];
+                            }
+                        });
+                    return;
+                }
+            }
+
             // normal load ...
             detail::load_collection(ar, v, size);
         }
@@ -134,7 +159,9 @@ namespace hpx::serialization {
         if constexpr (use_optimized)
         {
 #if !defined(HPX_SERIALIZATION_HAVE_ALL_TYPES_ARE_BITWISE_SERIALIZABLE)
-            if (ar.disable_array_optimization() || ar.endianess_differs())
+            if (ar.disable_array_optimization() ||
+                (ar.endianess_differs() &&
+                    !detail::is_byte_reversible_v<element_type>))
             {
                 detail::save_collection(ar, v);
                 return;
@@ -148,6 +175,16 @@ namespace hpx::serialization {
         }
         else
         {
+            if constexpr (hpx::traits::is_parallel_serializable_v<
+                              element_type>)
+            {
+                if (ar.enable_parallel_serialization() &&
+                    detail::save_segments(ar, v.begin(), v.size()))
+                {
+                    return;
+                }
+            }
+
             // normal save ...
             detail::save_collection(ar, v);
         }
@@ -0,0 +1,107 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/serialization/detail/allocation_arena.hpp>
+#include <hpx/serialization/detail/extra_archive_data.hpp>
+#include <hpx/serialization/input_archive.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+
+namespace hpx::serialization::detail {
+
+    // the memory of a block follows its header
+    struct alignas(std::max_align_t) allocation_arena::block
+    {
+        block* next_;
+    };
+
+    allocation_arena::allocation_arena(std::size_t block_size) noexcept
+      : blocks_(nullptr)
+      , current_(nullptr)
+      , remaining_(0)
+      , block_size_(block_size)
+      , num_blocks_(0)
+    {
+    }
+
+    allocation_arena::~allocation_arena()
+    {
+        while (blocks_ != nullptr)
+        {
+            block* next = blocks_->next_;
+            ::operator delete(blocks_);
+            blocks_ = next;
+        }
+    }
+
+    void* allocation_arena::allocate(std::size_t bytes, std::size_t alignment)
+    {
+        auto padding = [&]() {
+            std::size_t const misalignment =
+                reinterpret_cast<std::uintptr_t>(current_) % alignment;
+            return misalignment == 0 ? 0 : alignment - misalignment;
+        };
+
+        std::size_t pad = padding();
+        if (current_ == nullptr || pad + bytes > remaining_)
+        {
+            // objects larger than a block get a block of their own
+            std::size_t const size =
+                (std::max)(block_size_, bytes + alignment);
+
+            block* b =
+                static_cast<block*>(::operator new(sizeof(block) + size));
+            b->next_ = blocks_;
+            blocks_ = b;
+            ++num_blocks_;
+
+            current_ = reinterpret_cast<char*>(b + 1);
+            remaining_ = size;
+            pad = padding();
+        }
+
+        char* result = current_ + pad;
+        current_ = result + bytes;
+        remaining_ -= pad + bytes;
+        return result;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////
+    std::shared_ptr<allocation_arena> const& pointer_arena::get()
+    {
+        if (!arena_)
+        {
+            arena_ = std::make_shared<allocation_arena>(block_size_);
+        }
+        return arena_;
+    }
+
+    // This is explicitly instantiated to ensure that the id is stable across
+    // shared libraries.
+    extra_archive_data_id_type
+    extra_archive_data_helper<pointer_arena>::id() noexcept
+    {
+        static std::uint8_t id = 0;
+        return &id;
+    }
+
+    void extra_archive_data_helper<pointer_arena>::reset(
+        pointer_arena* data) noexcept
+    {
+        data->reset();
+    }
+
+    pointer_arena* try_get_pointer_arena(input_archive& ar) noexcept
+    {
+        auto* arena = ar.try_get_extra_data<pointer_arena>();
+        return arena != nullptr && arena->enabled() ? arena : nullptr;
+    }
+}    // namespace hpx::serialization::detail
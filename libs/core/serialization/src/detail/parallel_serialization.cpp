@@ -0,0 +1,202 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/serialization/detail/extra_archive_data.hpp>
+#include <hpx/serialization/detail/parallel_serialization.hpp>
+#include <hpx/serialization/input_archive.hpp>
+#include <hpx/serialization/serialize.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <utility>
+#include <vector>
+
+namespace hpx::serialization::detail {
+
+    namespace {
+
+        parallel_for_handler_type& get_parallel_for_handler()
+        {
+            static parallel_for_handler_type f;
+            return f;
+        }
+
+        std::atomic<std::size_t>& get_threshold() noexcept
+        {
+            static std::atomic<std::size_t> threshold(0);
+            return threshold;
+        }
+    }    // namespace
+
+    void set_parallel_for_handler(parallel_for_handler_type f)
+    {
+        get_parallel_for_handler() = HPX_MOVE(f);
+    }
+
+    void parallel_for(
+        std::size_t count, std::function<void(std::size_t)> const& f)
+    {
+        auto const& handler = get_parallel_for_handler();
+        if (handler && count > 1)
+        {
+            handler(count, f);
+            return;
+        }
+
+        for (std::size_t i = 0; i != count; ++i)
+        {
+            f(i);
+        }
+    }
+
+    void set_parallel_serialization_threshold(std::size_t threshold) noexcept
+    {
+        get_threshold().store(threshold, std::memory_order_relaxed);
+    }
+
+    std::size_t get_parallel_serialization_threshold() noexcept
+    {
+        return get_threshold().load(std::memory_order_relaxed);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////
+    void segments_tracker::set_cached_segments(serialized_segments&& cached)
+    {
+        cached_ = HPX_MOVE(cached);
+        next_cached_ = 0;
+    }
+
+    serialized_segments segments_tracker::move_segments() noexcept
+    {
+        serialized_segments segments;
+        std::swap(segments, segments_);
+        return segments;
+    }
+
+    std::size_t segments_tracker::acquire(std::size_t size,
+        std::size_t segment_size, std::size_t num_segments, bool& reused)
+    {
+        std::size_t const first = segments_.size();
+
+        // the cached segments are used in the same sequence as they were
+        // created, stop using them as soon as they do not match anymore
+        reused = next_cached_ + num_segments <= cached_.size();
+        for (std::size_t i = 0; reused && i != num_segments; ++i)
+        {
+            std::size_t const elements =
+                (std::min)(segment_size, size - i * segment_size);
+            reused = cached_[next_cached_ + i].elements_ == elements;
+        }
+
+        if (reused)
+        {
+            for (std::size_t i = 0; i != num_segments; ++i)
+            {
+                segments_.push_back(HPX_MOVE(cached_[next_cached_ + i]));
+            }
+            next_cached_ += num_segments;
+        }
+        else
+        {
+            cached_.clear();
+            next_cached_ = 0;
+            segments_.resize(first + num_segments);
+        }
+        return first;
+    }
+
+    std::vector<char>& segments_tracker::retain(std::size_t bytes)
+    {
+        // the memory does not hold any elements of a container
+        serialized_segment& segment = segments_.emplace_back();
+        segment.data_.resize(bytes);
+        return segment.data_;
+    }
+
+    // This is explicitly instantiated to ensure that the id is stable across
+    // shared libraries.
+    extra_archive_data_id_type
+    extra_archive_data_helper<segments_tracker>::id() noexcept
+    {
+        static std::uint8_t id = 0;
+        return &id;
+    }
+
+    void extra_archive_data_helper<segments_tracker>::reset(
+        segments_tracker* data)
+    {
+        data->reset();
+    }
+
+    ////////////////////////////////////////////////////////////////////////////
+    bool load_segments(input_archive& ar, std::uint64_t size,
+        serialized_segments& segments)
+    {
+        std::uint64_t num_segments = 0;
+        ar >> num_segments;
+        if (num_segments == 0)
+        {
+            return false;
+        }
+
+        if (num_segments > size)
+        {
+            HPX_THROW_EXCEPTION(serialization_error,
+                "hpx::serialization::detail::load_segments",
+                "invalid number of segments: {}", num_segments);
+            return false;
+        }
+
+        segments.resize(num_segments);
+
+        std::uint64_t elements = 0;
+        for (serialized_segment& segment : segments)
+        {
+            std::uint64_t bytes = 0;
+            ar >> segment.elements_ >> bytes;
+
+            segment.data_.resize(bytes);
+            ar.load_binary_chunk(segment.data_.data(), bytes);
+
+            elements += segment.elements_;
+        }
+
+        if (elements != size)
+        {
+            HPX_THROW_EXCEPTION(serialization_error,
+                "hpx::serialization::detail::load_segments",
+                "the segments hold {} elements instead of {}", elements, size);
+            return false;
+        }
+        return true;
+    }
+
+    void for_each_segment(serialized_segments& segments,
+        std::function<void(input_archive&, std::size_t, std::size_t,
+            std::size_t)> const& f)
+    {
+        std::vector<std::size_t> offsets;
+        offsets.reserve(segments.size());
+
+        std::size_t first = 0;
+        for (serialized_segment const& segment : segments)
+        {
+            offsets.push_back(first);
+            first += segment.elements_;
+        }
+
+        parallel_for(segments.size(), [&](std::size_t i) {
+            serialized_segment& segment = segments[i];
+            input_archive archive(segment.data_, segment.data_.size());
+            f(archive, i, offsets[i], segment.elements_);
+        });
+    }
+}    // namespace hpx::serialization::detail
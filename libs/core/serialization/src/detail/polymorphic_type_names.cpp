@@ -0,0 +1,103 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/serialization/detail/extra_archive_data.hpp>
+#include <hpx/serialization/detail/polymorphic_type_names.hpp>
+#include <hpx/serialization/input_archive.hpp>
+#include <hpx/serialization/output_archive.hpp>
+#include <hpx/serialization/serialize.hpp>
+#include <hpx/serialization/string.hpp>
+
+#include <cstdint>
+#include <string>
+#include <utility>
+
+namespace hpx::serialization {
+
+    namespace detail {
+
+        // the index sent with the first occurrence of a name
+        constexpr std::uint16_t new_type_name = std::uint16_t(-1);
+
+        // This is explicitly instantiated to ensure that the id is stable
+        // across shared libraries.
+        extra_archive_data_id_type
+        extra_archive_data_helper<input_type_name_tracker>::id() noexcept
+        {
+            static std::uint8_t id = 0;
+            return &id;
+        }
+
+        extra_archive_data_id_type
+        extra_archive_data_helper<output_type_name_tracker>::id() noexcept
+        {
+            static std::uint8_t id = 0;
+            return &id;
+        }
+
+        void extra_archive_data_helper<output_type_name_tracker>::reset(
+            output_type_name_tracker* data)
+        {
+            data->ids_.clear();
+        }
+    }    // namespace detail
+
+    void save_type_name(output_archive& ar, std::string const& name)
+    {
+        auto& tracker = ar.get_extra_data<detail::output_type_name_tracker>();
+
+        auto it = tracker.ids_.find(name);
+        if (it != tracker.ids_.end())
+        {
+            ar << it->second;
+            return;
+        }
+
+        // names beyond the range of the indices are always sent in full,
+        // both ends stop assigning indices at the same point
+        if (tracker.ids_.size() < detail::new_type_name)
+        {
+            std::uint16_t const id =
+                static_cast<std::uint16_t>(tracker.ids_.size());
+            tracker.ids_.emplace(name, id);
+        }
+
+        ar << detail::new_type_name << name;
+    }
+
+    std::string const& load_type_name(input_archive& ar)
+    {
+        auto& tracker = ar.get_extra_data<detail::input_type_name_tracker>();
+
+        std::uint16_t id = 0;
+        ar >> id;
+        if (id != detail::new_type_name)
+        {
+            if (id >= tracker.names_.size())
+            {
+                HPX_THROW_EXCEPTION(hpx::serialization_error,
+                    "hpx::serialization::load_type_name",
+                    "unknown type name index {}", id);
+            }
+            return tracker.names_[id];
+        }
+
+        std::string name;
+        ar >> name;
+
+        if (tracker.names_.size() < detail::new_type_name)
+        {
+            tracker.names_.push_back(HPX_MOVE(name));
+            return tracker.names_.back();
+        }
+
+        // keep the name alive until the next call as no index is assigned
+        tracker.overflow_ = HPX_MOVE(name);
+        return tracker.overflow_;
+    }
+}    // namespace hpx::serialization
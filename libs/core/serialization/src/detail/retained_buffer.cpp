@@ -0,0 +1,49 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/serialization/detail/extra_archive_data.hpp>
+#include <hpx/serialization/detail/retained_buffer.hpp>
+#include <hpx/serialization/input_archive.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace hpx::serialization::detail {
+
+    // This is explicitly instantiated to ensure that the id is stable across
+    // shared libraries.
+    extra_archive_data_id_type
+    extra_archive_data_helper<retained_buffer>::id() noexcept
+    {
+        static std::uint8_t id = 0;
+        return &id;
+    }
+
+    void extra_archive_data_helper<retained_buffer>::reset(
+        retained_buffer* data) noexcept
+    {
+        data->reset();
+    }
+
+    void const* view_retained_binary_chunk(input_archive& ar,
+        std::size_t count, std::shared_ptr<void const>& owner)
+    {
+        auto* retained = ar.try_get_extra_data<retained_buffer>();
+        if (retained == nullptr || !retained->owner())
+        {
+            return nullptr;
+        }
+
+        void const* data = ar.view_binary_chunk(count);
+        if (data != nullptr)
+        {
+            owner = retained->owner();
+        }
+        return data;
+    }
+}    // namespace hpx::serialization::detail
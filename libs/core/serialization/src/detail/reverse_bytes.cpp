@@ -0,0 +1,143 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/serialization/detail/parallel_serialization.hpp>
+#include <hpx/serialization/detail/reverse_bytes.hpp>
+#include <hpx/serialization/input_archive.hpp>
+#include <hpx/serialization/output_archive.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+namespace hpx::serialization::detail {
+
+    namespace {
+
+        // The shifts are recognized by the compilers, which turn the loops
+        // below into vectorized byte shuffles.
+        constexpr std::uint16_t reverse(std::uint16_t v) noexcept
+        {
+            return std::uint16_t((v >> 8) | (v << 8));
+        }
+
+        constexpr std::uint32_t reverse(std::uint32_t v) noexcept
+        {
+            return ((v & 0x000000ffu) << 24) | ((v & 0x0000ff00u) << 8) |
+                ((v & 0x00ff0000u) >> 8) | ((v & 0xff000000u) >> 24);
+        }
+
+        constexpr std::uint64_t reverse(std::uint64_t v) noexcept
+        {
+            return (std::uint64_t(reverse(std::uint32_t(v))) << 32) |
+                reverse(std::uint32_t(v >> 32));
+        }
+
+        template <typename Word>
+        void copy_reversed(
+            char* dest, char const* src, std::size_t count) noexcept
+        {
+            for (std::size_t i = 0; i != count; ++i)
+            {
+                Word w;
+                std::memcpy(&w, src + i * sizeof(Word), sizeof(Word));
+                w = reverse(w);
+                std::memcpy(dest + i * sizeof(Word), &w, sizeof(Word));
+            }
+        }
+    }    // namespace
+
+    void copy_reversed_bytes(void* dest, void const* src, std::size_t size,
+        std::size_t count) noexcept
+    {
+        char* d = static_cast<char*>(dest);
+        char const* s = static_cast<char const*>(src);
+
+        switch (size)
+        {
+        case 1:
+            if (d != s)
+            {
+                std::memcpy(d, s, count);
+            }
+            break;
+
+        case 2:
+            copy_reversed<std::uint16_t>(d, s, count);
+            break;
+
+        case 4:
+            copy_reversed<std::uint32_t>(d, s, count);
+            break;
+
+        case 8:
+            copy_reversed<std::uint64_t>(d, s, count);
+            break;
+
+        default:
+            for (std::size_t i = 0; i != count; ++i, d += size, s += size)
+            {
+                if (d != s)
+                {
+                    std::memcpy(d, s, size);
+                }
+                std::reverse(d, d + size);
+            }
+            break;
+        }
+    }
+
+    void save_reversed_bytes(output_archive& ar, void const* address,
+        std::size_t size, std::size_t count, std::uint64_t rkey)
+    {
+        std::size_t const bytes = size * count;
+
+        // the data is not touched while preprocessing
+        if (ar.is_preprocessing())
+        {
+            ar.save_binary_chunk(address, bytes, rkey);
+            return;
+        }
+
+        if (ar.is_zero_copy_chunk(bytes))
+        {
+            auto& tracker = ar.get_extra_data<segments_tracker>();
+            std::vector<char>& data = tracker.retain(bytes);
+            copy_reversed_bytes(data.data(), address, size, count);
+            ar.save_binary_chunk(data.data(), bytes, rkey);
+            return;
+        }
+
+        // the data is copied into the archive, use a small buffer
+        constexpr std::size_t buffer_size = 1024;
+        alignas(std::uint64_t) char buffer[buffer_size];
+
+        HPX_ASSERT(size <= buffer_size);
+        std::size_t const elements_per_block = buffer_size / size;
+
+        char const* src = static_cast<char const*>(address);
+        while (count != 0)
+        {
+            std::size_t const elements = (std::min)(count, elements_per_block);
+            copy_reversed_bytes(buffer, src, size, elements);
+            ar.save_binary(buffer, elements * size);
+
+            src += elements * size;
+            count -= elements;
+        }
+    }
+
+    void load_reversed_bytes(input_archive& ar, void* address,
+        std::size_t size, std::size_t count)
+    {
+        ar.load_binary_chunk(address, size * count);
+        copy_reversed_bytes(address, address, size, count);
+    }
+}    // namespace hpx::serialization::detail
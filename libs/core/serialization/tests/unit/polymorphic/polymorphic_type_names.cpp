@@ -0,0 +1,157 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify that the name of a polymorphic type is sent only once per archive.
+
+#include <hpx/serialization/base_object.hpp>
+#include <hpx/serialization/input_archive.hpp>
+#include <hpx/serialization/output_archive.hpp>
+#include <hpx/serialization/serialize.hpp>
+#include <hpx/serialization/shared_ptr.hpp>
+#include <hpx/serialization/vector.hpp>
+
+#include <hpx/modules/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+struct intrusive_base
+{
+    int a = 0;
+
+    virtual ~intrusive_base() = default;
+
+    virtual int value() const = 0;
+
+    template <typename Archive>
+    void serialize(Archive& ar, unsigned)
+    {
+        ar& a;
+    }
+    HPX_SERIALIZATION_POLYMORPHIC_ABSTRACT(intrusive_base);
+};
+
+struct intrusive_derived : intrusive_base
+{
+    int b = 0;
+
+    int value() const override
+    {
+        return a + b;
+    }
+
+    template <typename Archive>
+    void serialize(Archive& ar, unsigned)
+    {
+        ar& hpx::serialization::base_object<intrusive_base>(*this);
+        ar& b;
+    }
+    HPX_SERIALIZATION_POLYMORPHIC(intrusive_derived, override)
+};
+
+///////////////////////////////////////////////////////////////////////////////
+struct nonintrusive_base
+{
+    int a = 0;
+
+    virtual ~nonintrusive_base() = default;
+
+    virtual int value() const
+    {
+        return a;
+    }
+};
+
+HPX_TRAITS_NONINTRUSIVE_POLYMORPHIC(nonintrusive_base)
+
+template <typename Archive>
+void serialize(Archive& ar, nonintrusive_base& b, unsigned)
+{
+    ar& b.a;
+}
+
+struct nonintrusive_derived : nonintrusive_base
+{
+    int b = 0;
+
+    int value() const override
+    {
+        return a * b;
+    }
+};
+
+template <typename Archive>
+void serialize(Archive& ar, nonintrusive_derived& d, unsigned)
+{
+    ar& hpx::serialization::base_object<nonintrusive_base>(d);
+    ar& d.b;
+}
+HPX_SERIALIZATION_REGISTER_CLASS(nonintrusive_derived)
+
+///////////////////////////////////////////////////////////////////////////////
+std::size_t count_occurrences(
+    std::vector<char> const& buffer, std::string const& name)
+{
+    std::size_t count = 0;
+    auto it = buffer.begin();
+    while (true)
+    {
+        it = std::search(it, buffer.end(), name.begin(), name.end());
+        if (it == buffer.end())
+        {
+            break;
+        }
+        ++count;
+        ++it;
+    }
+    return count;
+}
+
+template <typename Base, typename Derived>
+void test_type_names(std::string const& name)
+{
+    std::vector<std::shared_ptr<Base>> objects;
+    for (int i = 0; i != 16; ++i)
+    {
+        auto d = std::make_shared<Derived>();
+        d->a = i;
+        d->b = i + 1;
+        objects.push_back(d);
+    }
+
+    std::vector<char> buffer;
+    {
+        hpx::serialization::output_archive archive(buffer);
+        archive << objects;
+    }
+
+    HPX_TEST_EQ(count_occurrences(buffer, name), std::size_t(1));
+
+    std::vector<std::shared_ptr<Base>> received;
+    {
+        hpx::serialization::input_archive archive(buffer, buffer.size());
+        archive >> received;
+    }
+
+    HPX_TEST_EQ(received.size(), objects.size());
+    for (std::size_t i = 0; i != objects.size(); ++i)
+    {
+        HPX_TEST(dynamic_cast<Derived*>(received[i].get()) != nullptr);
+        HPX_TEST_EQ(received[i]->value(), objects[i]->value());
+    }
+}
+
+int main()
+{
+    test_type_names<intrusive_base, intrusive_derived>("intrusive_derived");
+    test_type_names<nonintrusive_base, nonintrusive_derived>(
+        "nonintrusive_derived");
+
+    return hpx::util::report_errors();
+}
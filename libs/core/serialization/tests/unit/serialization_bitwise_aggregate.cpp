@@ -0,0 +1,166 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify that aggregates of bitwise serializable members are detected as
+// being bitwise serializable themselves, and that vectors of those are sent
+// as a single zero-copy chunk.
+
+#include <hpx/config.hpp>
+
+#include <hpx/modules/serialization.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+enum class color : std::uint8_t
+{
+    red,
+    green,
+    blue
+};
+
+struct point
+{
+    double x;
+    double y;
+    double z;
+};
+
+struct particle
+{
+    point position;
+    point velocity;
+    std::int32_t id;
+    color c;
+};
+
+struct named_point
+{
+    point p;
+    std::string name;
+};
+
+struct custom_point
+{
+    double x;
+    double y;
+
+    template <typename Archive>
+    void serialize(Archive& ar, unsigned)
+    {
+        // clang-format off
+        ar & x & y;
+        // clang-format on
+    }
+};
+
+struct empty
+{
+};
+
+static_assert(hpx::traits::is_bitwise_serializable_v<point>,
+    "hpx::traits::is_bitwise_serializable_v<point>");
+static_assert(hpx::traits::is_bitwise_serializable_v<particle>,
+    "hpx::traits::is_bitwise_serializable_v<particle>");
+static_assert(!hpx::traits::is_bitwise_serializable_v<named_point>,
+    "!hpx::traits::is_bitwise_serializable_v<named_point>");
+static_assert(!hpx::traits::is_bitwise_serializable_v<custom_point>,
+    "!hpx::traits::is_bitwise_serializable_v<custom_point>");
+static_assert(!hpx::traits::is_bitwise_serializable_v<empty>,
+    "!hpx::traits::is_bitwise_serializable_v<empty>");
+static_assert(!hpx::traits::is_bitwise_serializable_v<std::string>,
+    "!hpx::traits::is_bitwise_serializable_v<std::string>");
+
+bool operator==(point const& lhs, point const& rhs)
+{
+    return lhs.x == rhs.x && lhs.y == rhs.y && lhs.z == rhs.z;
+}
+
+bool operator==(particle const& lhs, particle const& rhs)
+{
+    return lhs.position == rhs.position && lhs.velocity == rhs.velocity &&
+        lhs.id == rhs.id && lhs.c == rhs.c;
+}
+
+void test_aggregate(std::uint32_t flags)
+{
+    std::vector<char> buffer;
+
+    particle const p{{1.0, 2.0, 3.0}, {4.0, 5.0, 6.0}, 42, color::blue};
+    named_point const n{{7.0, 8.0, 9.0}, "point"};
+    {
+        hpx::serialization::output_archive archive(buffer, flags);
+        archive << p << n;
+    }
+
+    particle q{};
+    named_point m{};
+    {
+        hpx::serialization::input_archive archive(buffer, buffer.size());
+        archive >> q >> m;
+    }
+
+    HPX_TEST(p == q);
+    HPX_TEST(n.p == m.p);
+    HPX_TEST_EQ(n.name, m.name);
+}
+
+void test_vector()
+{
+    std::vector<particle> particles(1024);
+    for (std::size_t i = 0; i != particles.size(); ++i)
+    {
+        double const d = static_cast<double>(i);
+        particles[i] = particle{{d, d + 1, d + 2}, {-d, -d - 1, -d - 2},
+            static_cast<std::int32_t>(i), color::green};
+    }
+
+    std::vector<char> buffer;
+    std::vector<hpx::serialization::serialization_chunk> chunks;
+    std::size_t size = 0;
+    {
+        hpx::serialization::output_archive archive(buffer, 0, &chunks);
+        archive << particles;
+        size = archive.bytes_written();
+    }
+
+    // the elements were sent as one zero-copy chunk
+    std::size_t pointer_chunks = 0;
+    for (auto const& c : chunks)
+    {
+        if (c.type_ == hpx::serialization::chunk_type::chunk_type_pointer)
+        {
+            HPX_TEST_EQ(c.size_, particles.size() * sizeof(particle));
+            ++pointer_chunks;
+        }
+    }
+    HPX_TEST_EQ(pointer_chunks, std::size_t(1));
+
+    std::vector<particle> received;
+    {
+        hpx::serialization::input_archive archive(buffer, size, &chunks);
+        archive >> received;
+    }
+
+    HPX_TEST(received == particles);
+}
+
+int main()
+{
+    test_aggregate(0);
+
+    // the members are serialized one by one if the array optimization is
+    // disabled
+    test_aggregate(std::uint32_t(
+        hpx::serialization::archive_flags::disable_array_optimization));
+
+    test_vector();
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,209 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify that the size computed by a preprocessing archive matches the size
+// of the data serialized into the main buffer, and that filtered archives
+// do not leave any excess data in the buffer.
+
+#include <hpx/serialization/binary_filter.hpp>
+#include <hpx/serialization/detail/preprocess_container.hpp>
+#include <hpx/serialization/input_archive.hpp>
+#include <hpx/serialization/output_archive.hpp>
+#include <hpx/serialization/serialize.hpp>
+#include <hpx/serialization/string.hpp>
+#include <hpx/serialization/vector.hpp>
+
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <cstring>
+#include <numeric>
+#include <string>
+#include <vector>
+
+struct payload
+{
+    int id_ = 0;
+    std::string name_;
+    std::vector<double> small_;
+    std::vector<double> large_;
+
+    template <typename Archive>
+    void serialize(Archive& ar, unsigned)
+    {
+        // clang-format off
+        ar & id_ & name_ & small_ & large_;
+        // clang-format on
+    }
+};
+
+payload make_payload()
+{
+    payload p;
+    p.id_ = 42;
+    p.name_ = "payload";
+    p.small_.resize(16);
+    std::iota(p.small_.begin(), p.small_.end(), 0.0);
+    p.large_.resize(64 * 1024);
+    std::iota(p.large_.begin(), p.large_.end(), 1.0);
+    return p;
+}
+
+void test_preprocess_size(std::size_t threshold)
+{
+    payload const p = make_payload();
+
+    // compute the size of the main buffer
+    hpx::serialization::detail::preprocess_container data;
+    std::vector<hpx::serialization::serialization_chunk> counted_chunks;
+    std::size_t num_chunks = 0;
+    std::size_t size = 0;
+    {
+        hpx::serialization::output_archive archive(
+            data, 0, &counted_chunks, nullptr, threshold);
+        archive << p;
+        archive.flush();
+
+        num_chunks = archive.get_num_chunks();
+        size = archive.bytes_written();
+        HPX_TEST_EQ(data.size(), size);
+    }
+
+    // the data is not chunked if the archive is not given any chunks
+    {
+        hpx::serialization::detail::preprocess_container unchunked;
+        hpx::serialization::output_archive archive(unchunked);
+        archive << p;
+        archive.flush();
+
+        HPX_TEST_LT(size, archive.bytes_written());
+    }
+
+    std::vector<char> buffer;
+    buffer.reserve(size);
+    char const* data_address = buffer.data();
+
+    std::vector<hpx::serialization::serialization_chunk> chunks;
+    {
+        hpx::serialization::output_archive archive(
+            buffer, 0, &chunks, nullptr, threshold);
+        archive << p;
+        archive.flush();
+
+        HPX_TEST_EQ(archive.bytes_written(), size);
+    }
+
+    // the buffer was allocated exactly once
+    HPX_TEST_EQ(buffer.size(), size);
+    HPX_TEST(buffer.data() == data_address);
+    HPX_TEST_EQ(chunks.size(), num_chunks);
+    HPX_TEST_LT(buffer.size(), p.large_.size() * sizeof(double));
+
+    payload q;
+    {
+        hpx::serialization::input_archive archive(buffer, size, &chunks);
+        archive >> q;
+    }
+
+    HPX_TEST_EQ(q.id_, p.id_);
+    HPX_TEST_EQ(q.name_, p.name_);
+    HPX_TEST(q.small_ == p.small_);
+    HPX_TEST(q.large_ == p.large_);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// A filter which stores the data unmodified
+struct copy_filter : hpx::serialization::binary_filter
+{
+    void set_max_length(std::size_t size) override
+    {
+        buffer_.reserve(size);
+    }
+
+    void save(void const* src, std::size_t src_count) override
+    {
+        char const* p = static_cast<char const*>(src);
+        buffer_.insert(buffer_.end(), p, p + src_count);
+    }
+
+    bool flush(void* dst, std::size_t dst_count, std::size_t& written) override
+    {
+        if (dst_count < buffer_.size())
+        {
+            written = 0;
+            return false;
+        }
+
+        std::memcpy(dst, buffer_.data(), buffer_.size());
+        written = buffer_.size();
+        return true;
+    }
+
+    std::size_t init_data(void const* buffer, std::size_t size,
+        std::size_t /* buffer_size */) override
+    {
+        char const* p = static_cast<char const*>(buffer);
+        buffer_.assign(p, p + size);
+        current_ = 0;
+        return buffer_.size();
+    }
+
+    void load(void* dst, std::size_t dst_count) override
+    {
+        HPX_TEST(current_ + dst_count <= buffer_.size());
+        std::memcpy(dst, &buffer_[current_], dst_count);
+        current_ += dst_count;
+    }
+
+    template <typename Archive>
+    void serialize(Archive&, unsigned)
+    {
+    }
+
+    HPX_SERIALIZATION_POLYMORPHIC(copy_filter, override);
+
+    std::vector<char> buffer_;
+    std::size_t current_ = 0;
+};
+
+void test_filtered_size()
+{
+    payload const p = make_payload();
+
+    copy_filter filter;
+    std::vector<char> buffer;
+    std::size_t size = 0;
+    {
+        hpx::serialization::output_archive archive(buffer,
+            hpx::serialization::archive_flags::enable_compression, nullptr,
+            &filter);
+        archive << p;
+        archive.flush();
+        size = archive.bytes_written();
+    }
+
+    // the buffer holds exactly the data written by the filter
+    HPX_TEST_EQ(buffer.size(), size);
+
+    payload q;
+    {
+        hpx::serialization::input_archive archive(buffer, buffer.size());
+        archive >> q;
+    }
+
+    HPX_TEST_EQ(q.id_, p.id_);
+    HPX_TEST_EQ(q.name_, p.name_);
+    HPX_TEST(q.large_ == p.large_);
+}
+
+int main()
+{
+    test_preprocess_size(0);
+    test_preprocess_size(128);
+    test_filtered_size();
+
+    return hpx::util::report_errors();
+}
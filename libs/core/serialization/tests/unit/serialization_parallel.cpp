@@ -0,0 +1,157 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify that large containers are round-tripped if they are split into
+// separately serialized segments, both with and without zero-copy chunks and
+// independently of the order in which the segments are processed.
+
+#include <hpx/config.hpp>
+
+#include <hpx/modules/serialization.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/serialization/detail/parallel_serialization.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <string>
+#include <vector>
+
+using hpx::serialization::detail::segments_tracker;
+using hpx::serialization::detail::serialized_segments;
+
+constexpr std::uint32_t parallel = std::uint32_t(
+    hpx::serialization::archive_flags::enable_parallel_serialization);
+
+template <typename T>
+void test_round_trip(T const& value, bool zero_copy)
+{
+    std::vector<char> buffer;
+    std::vector<hpx::serialization::serialization_chunk> chunks;
+
+    // the zero-copy chunks refer to the data of the segments
+    serialized_segments segments;
+    {
+        hpx::serialization::output_archive archive(buffer, parallel,
+            zero_copy ? &chunks : nullptr, nullptr, zero_copy ? 8 : 0);
+        archive << value;
+        archive.flush();
+
+        if (auto* tracker = archive.try_get_extra_data<segments_tracker>())
+        {
+            segments = tracker->move_segments();
+        }
+    }
+
+    T received;
+    {
+        hpx::serialization::input_archive archive(
+            buffer, buffer.size(), zero_copy ? &chunks : nullptr);
+        archive >> received;
+    }
+
+    HPX_TEST(value == received);
+}
+
+std::vector<std::string> make_strings(std::size_t size)
+{
+    std::vector<std::string> v;
+    v.reserve(size);
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        v.push_back(std::string(i % 17, char('a' + i % 26)));
+    }
+    return v;
+}
+
+std::map<int, std::string> make_map(std::size_t size)
+{
+    std::map<int, std::string> m;
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        m[int(i) * 3] = std::to_string(i);
+    }
+    return m;
+}
+
+void test_containers(bool zero_copy)
+{
+    // below and above the threshold
+    for (std::size_t size : {0, 3, 4, 5, 8, 13, 100})
+    {
+        test_round_trip(make_strings(size), zero_copy);
+        test_round_trip(make_map(size), zero_copy);
+
+        std::vector<double> doubles(size, 1.5);
+        test_round_trip(doubles, zero_copy);
+    }
+
+    // nested containers are split only at the outermost level
+    std::vector<std::vector<std::string>> nested;
+    for (std::size_t i = 0; i != 10; ++i)
+    {
+        nested.push_back(make_strings(i * 2));
+    }
+    test_round_trip(nested, zero_copy);
+
+    std::map<int, std::vector<std::string>> nested_map;
+    for (int i = 0; i != 10; ++i)
+    {
+        nested_map[i] = make_strings(std::size_t(i) * 3);
+    }
+    test_round_trip(nested_map, zero_copy);
+}
+
+void test_num_segments()
+{
+    std::vector<char> buffer;
+    hpx::serialization::output_archive archive(buffer, parallel);
+    archive << make_strings(3) << make_strings(10) << make_map(8);
+    archive.flush();
+
+    auto* tracker = archive.try_get_extra_data<segments_tracker>();
+    HPX_TEST(tracker != nullptr);
+    if (tracker != nullptr)
+    {
+        serialized_segments segments = tracker->move_segments();
+        HPX_TEST_EQ(segments.size(), std::size_t(5));
+        if (segments.size() == 5)
+        {
+            HPX_TEST_EQ(segments[2].elements_, std::uint64_t(2));
+            HPX_TEST_EQ(segments[4].elements_, std::uint64_t(4));
+        }
+    }
+}
+
+int main()
+{
+    hpx::serialization::detail::set_parallel_serialization_threshold(4);
+
+    test_num_segments();
+
+    // the segments are processed sequentially by default
+    test_containers(false);
+    test_containers(true);
+
+    // process the segments in reverse order
+    hpx::serialization::detail::set_parallel_for_handler(
+        [](std::size_t count, std::function<void(std::size_t)> const& f) {
+            for (std::size_t i = count; i != 0; --i)
+            {
+                f(i - 1);
+            }
+        });
+
+    test_containers(false);
+    test_containers(true);
+
+    // splitting containers can be disabled
+    hpx::serialization::detail::set_parallel_serialization_threshold(0);
+    test_containers(false);
+
+    return hpx::util::report_errors();
+}
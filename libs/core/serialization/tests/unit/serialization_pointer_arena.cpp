@@ -0,0 +1,221 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify that the objects referred to by std::shared_ptr's are allocated from
+// the arena of the input archive, if enabled, and that they outlive the
+// archive.
+
+#include <hpx/config.hpp>
+
+#include <hpx/modules/serialization.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/serialization/detail/allocation_arena.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+using hpx::serialization::detail::allocation_arena;
+using hpx::serialization::detail::pointer_arena;
+
+struct node
+{
+    int value = 0;
+    std::string name;
+    std::vector<std::shared_ptr<node>> children;
+
+    template <typename Archive>
+    void serialize(Archive& ar, unsigned)
+    {
+        // clang-format off
+        ar & value & name & children;
+        // clang-format on
+    }
+};
+
+// objects of types with a custom constructor are created as usual
+struct custom
+{
+    explicit custom(int value)
+      : value(value)
+    {
+    }
+
+    int value;
+};
+
+template <typename Archive>
+void serialize(Archive& ar, custom& c, unsigned)
+{
+    // clang-format off
+    ar & c.value;
+    // clang-format on
+}
+
+custom* custom_factory(hpx::serialization::input_archive& ar)
+{
+    custom* c = new custom(0);
+    ar >> *c;
+    return c;
+}
+
+HPX_SERIALIZATION_WITH_CUSTOM_CONSTRUCTOR(custom, custom_factory)
+
+std::shared_ptr<node> make_tree(int depth, int& next,
+    std::shared_ptr<node> const& shared)
+{
+    auto n = std::make_shared<node>();
+    n->value = next++;
+    n->name = std::to_string(n->value);
+    if (depth != 0)
+    {
+        n->children.push_back(make_tree(depth - 1, next, shared));
+        n->children.push_back(make_tree(depth - 1, next, shared));
+    }
+    n->children.push_back(shared);
+    return n;
+}
+
+bool equal(node const& lhs, node const& rhs)
+{
+    if (lhs.value != rhs.value || lhs.name != rhs.name ||
+        lhs.children.size() != rhs.children.size())
+    {
+        return false;
+    }
+    for (std::size_t i = 0; i != lhs.children.size(); ++i)
+    {
+        if (!equal(*lhs.children[i], *rhs.children[i]))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+template <typename T>
+std::vector<char> save(T const& value)
+{
+    std::vector<char> buffer;
+    hpx::serialization::output_archive archive(buffer);
+    archive << value;
+    return buffer;
+}
+
+void test_tree(std::size_t block_size)
+{
+    auto shared = std::make_shared<node>();
+    shared->value = -1;
+
+    int next = 0;
+    auto const tree = make_tree(5, next, shared);
+    auto const buffer = save(tree);
+
+    std::shared_ptr<node> received;
+    std::size_t num_blocks = 0;
+    {
+        hpx::serialization::input_archive archive(buffer, buffer.size());
+        archive.get_extra_data<pointer_arena>().enable(block_size);
+        archive >> received;
+
+        auto const& arena = archive.get_extra_data<pointer_arena>().get();
+        num_blocks = arena->num_blocks();
+
+        // all objects keep the arena alive
+        HPX_TEST(arena.use_count() > next);
+    }
+
+    HPX_TEST(num_blocks != 0);
+    HPX_TEST(equal(*tree, *received));
+
+    // objects referred to more than once are created once
+    std::shared_ptr<node> const& leaf = received->children.front();
+    HPX_TEST(leaf->children.back() == received->children.back());
+    HPX_TEST_EQ(received->children.back()->value, -1);
+
+    // the objects outlive the archive and each other
+    std::shared_ptr<node> child = received->children.front();
+    received.reset();
+    HPX_TEST_EQ(child->value, 1);
+    HPX_TEST(child->children.back() != nullptr);
+}
+
+void test_disabled()
+{
+    auto const value = std::make_shared<node>();
+    auto const buffer = save(value);
+
+    hpx::serialization::input_archive archive(buffer, buffer.size());
+    std::shared_ptr<node> received;
+    archive >> received;
+    HPX_TEST(received != nullptr);
+
+    auto const* arena = archive.try_get_extra_data<pointer_arena>();
+    HPX_TEST(arena == nullptr);
+}
+
+void test_fallback()
+{
+    auto const buffer = save(std::make_shared<custom>(42));
+
+    hpx::serialization::input_archive archive(buffer, buffer.size());
+    archive.get_extra_data<pointer_arena>().enable(1024);
+
+    std::shared_ptr<custom> received;
+    archive >> received;
+    HPX_TEST_EQ(received->value, 42);
+
+    // the arena was never created
+    auto const& arena = archive.get_extra_data<pointer_arena>().get();
+    HPX_TEST_EQ(arena.use_count(), 1);
+    HPX_TEST_EQ(arena->num_blocks(), std::size_t(0));
+}
+
+void test_unique_ptr()
+{
+    auto value = std::make_unique<node>();
+    value->value = 7;
+    auto const buffer = save(value);
+
+    hpx::serialization::input_archive archive(buffer, buffer.size());
+    archive.get_extra_data<pointer_arena>().enable(1024);
+
+    std::unique_ptr<node> received;
+    archive >> received;
+    HPX_TEST_EQ(received->value, 7);
+}
+
+void test_allocation_arena()
+{
+    allocation_arena arena(64);
+
+    void* p1 = arena.allocate(1, 1);
+    void* p2 = arena.allocate(8, 8);
+    HPX_TEST(reinterpret_cast<std::uintptr_t>(p2) % 8 == 0);
+    HPX_TEST(p1 != p2);
+    HPX_TEST_EQ(arena.num_blocks(), std::size_t(1));
+
+    // large allocations get a block of their own
+    void* p3 = arena.allocate(256, 16);
+    HPX_TEST(reinterpret_cast<std::uintptr_t>(p3) % 16 == 0);
+    HPX_TEST_EQ(arena.num_blocks(), std::size_t(2));
+}
+
+int main()
+{
+    test_allocation_arena();
+
+    test_tree(16384);
+    test_tree(64);    // more than one block
+
+    test_disabled();
+    test_fallback();
+    test_unique_ptr();
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,165 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify that arrays of arithmetic types are round-tripped in bulk if the
+// byte order of the archive differs from the native byte order.
+
+#include <hpx/config.hpp>
+#include <hpx/config/endian.hpp>
+
+#include <hpx/modules/serialization.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/serialization/detail/parallel_serialization.hpp>
+#include <hpx/serialization/detail/reverse_bytes.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+using hpx::serialization::detail::copy_reversed_bytes;
+
+void test_copy_reversed_bytes()
+{
+    std::uint64_t const values[] = {
+        0x0102030405060708ull, 0x1112131415161718ull, 0x2122232425262728ull};
+
+    std::uint64_t reversed[3];
+    copy_reversed_bytes(reversed, values, sizeof(std::uint64_t), 3);
+    HPX_TEST_EQ(reversed[0], std::uint64_t(0x0807060504030201ull));
+    HPX_TEST_EQ(reversed[2], std::uint64_t(0x2827262524232221ull));
+
+    // in place
+    copy_reversed_bytes(reversed, reversed, sizeof(std::uint64_t), 3);
+    HPX_TEST(std::memcmp(reversed, values, sizeof(values)) == 0);
+
+    std::uint32_t words[] = {0x01020304u, 0x05060708u};
+    copy_reversed_bytes(words, words, sizeof(std::uint32_t), 2);
+    HPX_TEST_EQ(words[0], std::uint32_t(0x04030201u));
+    HPX_TEST_EQ(words[1], std::uint32_t(0x08070605u));
+
+    std::uint16_t halves[] = {0x0102u};
+    copy_reversed_bytes(halves, halves, sizeof(std::uint16_t), 1);
+    HPX_TEST_EQ(halves[0], std::uint16_t(0x0201u));
+
+    // odd sizes
+    char bytes[] = {1, 2, 3, 4, 5, 6};
+    copy_reversed_bytes(bytes, bytes, 3, 2);
+    HPX_TEST_EQ(int(bytes[0]), 3);
+    HPX_TEST_EQ(int(bytes[3]), 6);
+}
+
+#if defined(HPX_SERIALIZATION_HAVE_SUPPORTS_ENDIANESS)
+using chunks_type = std::vector<hpx::serialization::serialization_chunk>;
+
+// use the byte order which is not the native one
+constexpr std::uint32_t reversed_flags =
+    std::uint32_t(hpx::endian::native == hpx::endian::big ?
+            hpx::serialization::archive_flags::endian_little :
+            hpx::serialization::archive_flags::endian_big);
+
+template <typename T>
+void test_round_trip(T const& value, bool zero_copy)
+{
+    std::vector<char> buffer;
+    chunks_type chunks;
+
+    // the zero-copy chunks refer to the reversed data held by the segments
+    hpx::serialization::detail::serialized_segments segments;
+    {
+        hpx::serialization::output_archive archive(buffer, reversed_flags,
+            zero_copy ? &chunks : nullptr, nullptr, zero_copy ? 64 : 0);
+        HPX_TEST(archive.endianess_differs());
+
+        archive << value;
+        archive.flush();
+
+        if (auto* tracker = archive.try_get_extra_data<
+                hpx::serialization::detail::segments_tracker>())
+        {
+            segments = tracker->move_segments();
+        }
+    }
+
+    T received;
+    {
+        hpx::serialization::input_archive archive(
+            buffer, buffer.size(), zero_copy ? &chunks : nullptr);
+        HPX_TEST(archive.endianess_differs());
+
+        archive >> received;
+    }
+    HPX_TEST(value == received);
+}
+
+void test_arrays(bool zero_copy)
+{
+    for (std::size_t size : {1, 7, 100, 1000})
+    {
+        std::vector<double> doubles(size);
+        std::vector<std::int32_t> ints(size);
+        std::vector<std::uint16_t> shorts(size);
+        std::vector<char> chars(size);
+        for (std::size_t i = 0; i != size; ++i)
+        {
+            doubles[i] = double(i) / 7.0;
+            ints[i] = std::int32_t(i * 1000003) - 5;
+            shorts[i] = std::uint16_t(i * 31);
+            chars[i] = char(i);
+        }
+        test_round_trip(doubles, zero_copy);
+        test_round_trip(ints, zero_copy);
+        test_round_trip(shorts, zero_copy);
+        test_round_trip(chars, zero_copy);
+    }
+
+    std::array<float, 33> floats;
+    for (std::size_t i = 0; i != floats.size(); ++i)
+    {
+        floats[i] = float(i) * 0.25f;
+    }
+    test_round_trip(floats, zero_copy);
+}
+
+void test_wire_format()
+{
+    std::vector<std::uint32_t> const values(100, 0x01020304u);
+
+    std::vector<char> buffer;
+    chunks_type chunks;
+    hpx::serialization::output_archive archive(
+        buffer, reversed_flags, &chunks, nullptr, 64);
+    archive << values;
+    archive.flush();
+
+    // the elements are sent as a single chunk in the byte order of the
+    // archive
+    HPX_TEST_EQ(chunks.size(), std::size_t(2));
+    if (chunks.size() == 2)
+    {
+        auto const& chunk = chunks[1];
+        HPX_TEST_EQ(chunk.size_, values.size() * sizeof(std::uint32_t));
+
+        std::uint32_t first = 0;
+        std::memcpy(&first, chunk.data_.cpos_, sizeof(first));
+        HPX_TEST_EQ(first, std::uint32_t(0x04030201u));
+    }
+}
+#endif
+
+int main()
+{
+    test_copy_reversed_bytes();
+
+#if defined(HPX_SERIALIZATION_HAVE_SUPPORTS_ENDIANESS)
+    test_arrays(false);
+    test_arrays(true);
+    test_wire_format();
+#endif
+
+    return hpx::util::report_errors();
+}
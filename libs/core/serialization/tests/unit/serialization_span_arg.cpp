@@ -0,0 +1,152 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify that string_view_arg and span_arg refer to the received data if the
+// memory the archive reads from is retained, and that they hold a copy of the
+// data otherwise.
+
+#include <hpx/config.hpp>
+
+#include <hpx/modules/serialization.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/serialization/detail/retained_buffer.hpp>
+#include <hpx/serialization/span_arg.hpp>
+#include <hpx/serialization/string_view_arg.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+using hpx::serialization::span_arg;
+using hpx::serialization::string_view_arg;
+
+using buffer_type = std::vector<char>;
+using chunks_type = std::vector<hpx::serialization::serialization_chunk>;
+
+template <typename T>
+std::shared_ptr<buffer_type> save(
+    T const& value, chunks_type* chunks, std::uint32_t flags = 0)
+{
+    auto buffer = std::make_shared<buffer_type>();
+    hpx::serialization::output_archive archive(
+        *buffer, flags, chunks, nullptr, chunks != nullptr ? 64 : 0);
+    archive << value;
+    return buffer;
+}
+
+template <typename T>
+T load(std::shared_ptr<buffer_type> const& buffer, chunks_type const* chunks,
+    bool retain)
+{
+    hpx::serialization::input_archive archive(
+        *buffer, buffer->size(), chunks);
+    if (retain)
+    {
+        archive.get_extra_data<hpx::serialization::detail::retained_buffer>()
+            .set_owner(buffer);
+    }
+
+    T value;
+    archive >> value;
+    return value;
+}
+
+bool refers_to(void const* p, buffer_type const& buffer)
+{
+    char const* c = static_cast<char const*>(p);
+    return c >= buffer.data() && c < buffer.data() + buffer.size();
+}
+
+void test_string_view_arg()
+{
+    string_view_arg const key("lookup key");
+    HPX_TEST(key.view() == "lookup key");
+
+    // without a retained buffer the data is copied
+    auto buffer = save(key, nullptr);
+    auto copied = load<string_view_arg>(buffer, nullptr, false);
+    HPX_TEST(copied == key);
+    HPX_TEST(!refers_to(copied.data(), *buffer));
+
+    // the retained buffer is kept alive by the view
+    auto view = load<string_view_arg>(buffer, nullptr, true);
+    HPX_TEST(view == key);
+    HPX_TEST(refers_to(view.data(), *buffer));
+
+    long const use_count = buffer.use_count();
+    buffer.reset();
+    HPX_TEST(use_count > 1);
+    HPX_TEST(view.str() == "lookup key");
+
+    // large strings refer to the zero-copy chunk they were received from
+    string_view_arg const blob(std::string(1024, 'x'));
+    chunks_type chunks;
+    buffer = save(blob, &chunks);
+    HPX_TEST(!chunks.empty());
+
+    view = load<string_view_arg>(buffer, &chunks, true);
+    HPX_TEST(view == blob);
+    HPX_TEST(view.data() == blob.data());
+
+    // empty strings
+    buffer = save(string_view_arg(), nullptr);
+    view = load<string_view_arg>(buffer, nullptr, true);
+    HPX_TEST(view.empty());
+}
+
+void test_span_arg()
+{
+    std::vector<double> values(100);
+    for (std::size_t i = 0; i != values.size(); ++i)
+    {
+        values[i] = double(i) / 3.0;
+    }
+    span_arg<double> const span(values);
+    HPX_TEST_EQ(span.size(), values.size());
+    HPX_TEST(span.to_vector() == values);
+
+    auto buffer = save(span, nullptr);
+    auto copied = load<span_arg<double>>(buffer, nullptr, false);
+    HPX_TEST(copied == span);
+    HPX_TEST(!refers_to(copied.data(), *buffer));
+
+    // the values are copied if they are not properly aligned
+    auto view = load<span_arg<double>>(buffer, nullptr, true);
+    HPX_TEST(view == span);
+    HPX_TEST(
+        reinterpret_cast<std::uintptr_t>(view.data()) % alignof(double) == 0);
+
+    chunks_type chunks;
+    buffer = save(span, &chunks);
+    view = load<span_arg<double>>(buffer, &chunks, true);
+    HPX_TEST(view == span);
+    HPX_TEST(view.data() == span.data());
+
+    // bytes are always referred to in place
+    span_arg<char> const bytes(std::vector<char>(32, 'b'));
+    buffer = save(bytes, nullptr);
+    auto bytes_view = load<span_arg<char>>(buffer, nullptr, true);
+    HPX_TEST(bytes_view == bytes);
+    HPX_TEST(refers_to(bytes_view.data(), *buffer));
+
+    // element-wise serialization
+    constexpr std::uint32_t no_arrays = std::uint32_t(
+        hpx::serialization::archive_flags::disable_array_optimization);
+    buffer = save(span, nullptr, no_arrays);
+    view = load<span_arg<double>>(buffer, nullptr, true);
+    HPX_TEST(view == span);
+    HPX_TEST(!refers_to(view.data(), *buffer));
+}
+
+int main()
+{
+    test_string_view_arg();
+    test_span_arg();
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,124 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify that integral values are round-tripped if they are stored as
+// variable length integers, and that small values take less space.
+
+#include <hpx/config.hpp>
+
+#include <hpx/modules/serialization.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <vector>
+
+constexpr std::uint32_t varint =
+    std::uint32_t(hpx::serialization::archive_flags::enable_varint_encoding);
+
+enum class kind : std::int16_t
+{
+    negative = -3,
+    positive = 300
+};
+
+template <typename T>
+void test_value(T value)
+{
+    std::vector<char> buffer;
+    {
+        hpx::serialization::output_archive archive(buffer, varint);
+        archive << value;
+    }
+
+    T received = T();
+    {
+        hpx::serialization::input_archive archive(buffer, buffer.size());
+        archive >> received;
+    }
+
+    HPX_TEST(value == received);
+}
+
+template <typename T>
+void test_limits()
+{
+    test_value(T(0));
+    test_value(T(1));
+    test_value(T(127));
+    test_value((std::numeric_limits<T>::min)());
+    test_value((std::numeric_limits<T>::max)());
+    if constexpr (std::is_signed_v<T>)
+    {
+        test_value(T(-1));
+        test_value(T(-64));
+        test_value(T(-65));
+    }
+}
+
+std::size_t archive_size(std::uint32_t flags)
+{
+    std::vector<char> buffer;
+    hpx::serialization::output_archive archive(buffer, flags);
+
+    std::vector<std::string> strings = {"a", "b", "c"};
+    archive << std::size_t(3) << -2 << 42u << strings << kind::negative;
+    return archive.bytes_written();
+}
+
+void test_mixed()
+{
+    std::vector<char> buffer;
+
+    std::vector<std::string> const strings = {"varint", "", "zigzag"};
+    std::vector<double> const doubles = {1.0, 2.0, 3.0};
+    {
+        hpx::serialization::output_archive archive(buffer, varint);
+        archive << std::size_t(12345) << std::int64_t(-12345) << strings
+                << doubles << kind::positive << kind::negative << 'c';
+    }
+
+    std::size_t s = 0;
+    std::int64_t l = 0;
+    std::vector<std::string> received_strings;
+    std::vector<double> received_doubles;
+    kind k1 = kind::negative, k2 = kind::positive;
+    char c = 0;
+    {
+        hpx::serialization::input_archive archive(buffer, buffer.size());
+        archive >> s >> l >> received_strings >> received_doubles >> k1 >>
+            k2 >> c;
+    }
+
+    HPX_TEST_EQ(s, std::size_t(12345));
+    HPX_TEST_EQ(l, std::int64_t(-12345));
+    HPX_TEST(received_strings == strings);
+    HPX_TEST(received_doubles == doubles);
+    HPX_TEST(k1 == kind::positive);
+    HPX_TEST(k2 == kind::negative);
+    HPX_TEST_EQ(c, 'c');
+}
+
+int main()
+{
+    test_limits<short>();
+    test_limits<unsigned short>();
+    test_limits<int>();
+    test_limits<unsigned int>();
+    test_limits<long>();
+    test_limits<unsigned long>();
+    test_limits<long long>();
+    test_limits<unsigned long long>();
+
+    test_mixed();
+
+    // small values take less space if stored as variable length integers
+    HPX_TEST_LT(archive_size(varint), archive_size(0));
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,100 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/synchronization/detail/condition_variable.hpp>
+#include <hpx/synchronization/spinlock.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace hpx {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // A mutex which spins for a while before suspending the HPX thread on
+    // contention. Each mutex keeps a moving average of the time it is held,
+    // a contended lock spins for (at most) twice that time as the owner is
+    // likely to release the mutex soon. Mutexes which are held for longer
+    // than max_spin_time suspend the waiting threads right away, like
+    // hpx::mutex.
+    class adaptive_mutex
+    {
+    public:
+        HPX_NON_COPYABLE(adaptive_mutex);
+
+    private:
+        typedef hpx::spinlock mutex_type;
+
+    public:
+        // the longest time (in nanoseconds) a contended lock spins
+        static constexpr std::uint64_t max_spin_time = 20000;
+
+        // the hold time assumed for a new mutex
+        static constexpr std::uint64_t initial_hold_time = 1000;
+
+        HPX_CORE_EXPORT adaptive_mutex(char const* const description = "");
+
+        HPX_CORE_EXPORT ~adaptive_mutex();
+
+        HPX_CORE_EXPORT void lock(
+            char const* description, error_code& ec = throws);
+
+        void lock(error_code& ec = throws)
+        {
+            return lock("adaptive_mutex::lock", ec);
+        }
+
+        HPX_CORE_EXPORT bool try_lock(
+            char const* description, error_code& ec = throws);
+
+        bool try_lock(error_code& ec = throws)
+        {
+            return try_lock("adaptive_mutex::try_lock", ec);
+        }
+
+        HPX_CORE_EXPORT void unlock(error_code& ec = throws);
+
+        // the time (in nanoseconds) the next contended lock will spin for
+        std::uint64_t spin_time() const noexcept
+        {
+            std::uint64_t const hold_time =
+                hold_time_.load(std::memory_order_relaxed);
+            return hold_time <= max_spin_time / 2 ? 2 * hold_time : 0;
+        }
+
+    private:
+        bool acquire() noexcept
+        {
+            return !locked_.load(std::memory_order_relaxed) &&
+                !locked_.exchange(true, std::memory_order_acquire);
+        }
+
+        bool spin(std::uint64_t spin_time) noexcept;
+
+        void acquired() noexcept;
+
+        std::atomic<bool> locked_;
+
+        // the number of suspended (or suspending) threads
+        std::atomic<std::size_t> waiting_;
+
+        // moving average of the hold times, in nanoseconds
+        std::atomic<std::uint64_t> hold_time_;
+
+        // written by the owner only
+        std::uint64_t acquired_at_;
+
+        mutable mutex_type mtx_;
+        hpx::lcos::local::detail::condition_variable cond_;
+#if defined(HPX_HAVE_LOCK_CONTENTION_PROFILING)
+        char const* description_;
+#endif
+    };
+}    // namespace hpx
@@ -0,0 +1,93 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/synchronization/detail/async_waiters.hpp>
+#include <hpx/synchronization/spinlock.hpp>
+
+#include <cstddef>
+#include <mutex>
+
+namespace hpx { namespace experimental {
+
+    /// Latch which is waited for through a sender.
+    ///
+    /// wait returns a sender which calls set_value (with no values) on a
+    /// connected receiver once the counter of the latch has reached zero.
+    /// Waiting does not suspend a thread: the waiting operation states are
+    /// queued and the count_down reaching zero continues all of them on the
+    /// counting thread.
+    ///
+    /// The operation states have to stay alive until they complete. The
+    /// latch is non-copyable and non-movable.
+    class async_latch
+    {
+    public:
+        using sender_type = detail::async_waiter_sender<async_latch>;
+
+        explicit async_latch(std::ptrdiff_t count) noexcept
+          : counter_(count)
+        {
+            HPX_ASSERT(count >= 0);
+        }
+
+        async_latch(async_latch const&) = delete;
+        async_latch& operator=(async_latch const&) = delete;
+
+        void count_down(std::ptrdiff_t update = 1) noexcept
+        {
+            HPX_ASSERT(update >= 0);
+
+            detail::async_waiter_queue ready;
+            {
+                std::lock_guard<mutex_type> l(mtx_);
+                HPX_ASSERT(counter_ >= update);
+
+                counter_ -= update;
+                if (counter_ != 0)
+                {
+                    return;
+                }
+                ready = HPX_MOVE(waiters_);
+            }
+            ready.complete_all();
+        }
+
+        bool try_wait() const noexcept
+        {
+            std::lock_guard<mutex_type> l(mtx_);
+            return counter_ == 0;
+        }
+
+        sender_type wait() noexcept
+        {
+            return sender_type{this};
+        }
+
+    private:
+        friend sender_type;
+
+        bool add_waiter(detail::async_waiter* w) noexcept
+        {
+            std::lock_guard<mutex_type> l(mtx_);
+            if (counter_ == 0)
+            {
+                return false;
+            }
+            waiters_.push(w);
+            return true;
+        }
+
+        using mutex_type = hpx::spinlock;
+
+        mutable mutex_type mtx_{"hpx::experimental::async_latch"};
+        std::ptrdiff_t counter_;
+        detail::async_waiter_queue waiters_;
+    };
+}}    // namespace hpx::experimental
@@ -0,0 +1,94 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/synchronization/detail/async_waiters.hpp>
+#include <hpx/synchronization/spinlock.hpp>
+
+#include <mutex>
+
+namespace hpx { namespace experimental {
+
+    /// Mutex which is acquired through a sender.
+    ///
+    /// lock returns a sender which calls set_value (with no values) on a
+    /// connected receiver once the mutex is owned by the operation. The
+    /// owner releases the mutex by calling unlock. Waiting for the mutex
+    /// does not suspend a thread: the waiting operation states are queued
+    /// and unlock passes the ownership to the oldest of them, continuing it
+    /// on the unlocking thread.
+    ///
+    /// The operation states have to stay alive until they complete. The
+    /// mutex is non-copyable and non-movable.
+    class async_mutex
+    {
+    public:
+        using sender_type = detail::async_waiter_sender<async_mutex>;
+
+        async_mutex() = default;
+
+        async_mutex(async_mutex const&) = delete;
+        async_mutex& operator=(async_mutex const&) = delete;
+
+        sender_type lock() noexcept
+        {
+            return sender_type{this};
+        }
+
+        bool try_lock() noexcept
+        {
+            std::lock_guard<mutex_type> l(mtx_);
+            if (locked_)
+            {
+                return false;
+            }
+            locked_ = true;
+            return true;
+        }
+
+        void unlock() noexcept
+        {
+            std::unique_lock<mutex_type> l(mtx_);
+            HPX_ASSERT_MSG(
+                locked_, "async_mutex::unlock: the mutex is not locked");
+
+            detail::async_waiter* w = waiters_.pop();
+            if (w == nullptr)
+            {
+                locked_ = false;
+                return;
+            }
+
+            // the mutex stays locked, it is owned by the waiter now
+            l.unlock();
+            w->complete();
+        }
+
+    private:
+        friend sender_type;
+
+        bool add_waiter(detail::async_waiter* w) noexcept
+        {
+            std::lock_guard<mutex_type> l(mtx_);
+            if (!locked_)
+            {
+                locked_ = true;
+                return false;
+            }
+            waiters_.push(w);
+            return true;
+        }
+
+        using mutex_type = hpx::spinlock;
+
+        mutex_type mtx_{"hpx::experimental::async_mutex"};
+        bool locked_ = false;
+        detail::async_waiter_queue waiters_;
+    };
+}}    // namespace hpx::experimental
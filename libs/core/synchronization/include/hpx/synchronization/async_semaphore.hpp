@@ -0,0 +1,103 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/synchronization/detail/async_waiters.hpp>
+#include <hpx/synchronization/spinlock.hpp>
+
+#include <cstddef>
+#include <mutex>
+
+namespace hpx { namespace experimental {
+
+    /// Counting semaphore which is acquired through a sender.
+    ///
+    /// acquire returns a sender which calls set_value (with no values) on a
+    /// connected receiver once it has decremented the counter. Waiting for
+    /// the counter to become positive does not suspend a thread: the
+    /// waiting operation states are queued and release continues them, in
+    /// the order they started, on the releasing thread.
+    ///
+    /// The operation states have to stay alive until they complete. The
+    /// semaphore is non-copyable and non-movable.
+    class async_semaphore
+    {
+    public:
+        using sender_type = detail::async_waiter_sender<async_semaphore>;
+
+        explicit async_semaphore(std::ptrdiff_t value = 0) noexcept
+          : value_(value)
+        {
+            HPX_ASSERT(value >= 0);
+        }
+
+        async_semaphore(async_semaphore const&) = delete;
+        async_semaphore& operator=(async_semaphore const&) = delete;
+
+        sender_type acquire() noexcept
+        {
+            return sender_type{this};
+        }
+
+        bool try_acquire() noexcept
+        {
+            std::lock_guard<mutex_type> l(mtx_);
+            if (value_ == 0 || !waiters_.empty())
+            {
+                return false;
+            }
+            --value_;
+            return true;
+        }
+
+        void release(std::ptrdiff_t update = 1) noexcept
+        {
+            HPX_ASSERT(update >= 0);
+
+            detail::async_waiter_queue ready;
+            {
+                std::lock_guard<mutex_type> l(mtx_);
+                value_ += update;
+                while (value_ != 0 && !waiters_.empty())
+                {
+                    ready.push(waiters_.pop());
+                    --value_;
+                }
+            }
+            ready.complete_all();
+        }
+
+        std::ptrdiff_t get_value() const noexcept
+        {
+            std::lock_guard<mutex_type> l(mtx_);
+            return value_;
+        }
+
+    private:
+        friend sender_type;
+
+        bool add_waiter(detail::async_waiter* w) noexcept
+        {
+            std::lock_guard<mutex_type> l(mtx_);
+            if (value_ != 0 && waiters_.empty())
+            {
+                --value_;
+                return false;
+            }
+            waiters_.push(w);
+            return true;
+        }
+
+        using mutex_type = hpx::spinlock;
+
+        mutable mutex_type mtx_{"hpx::experimental::async_semaphore"};
+        std::ptrdiff_t value_;
+        detail::async_waiter_queue waiters_;
+    };
+}}    // namespace hpx::experimental
@@ -10,14 +10,16 @@
 
 #include <hpx/config.hpp>
 #include <hpx/assert.hpp>
+#include <hpx/execution_base/this_thread.hpp>
 #include <hpx/modules/concurrency.hpp>
 #include <hpx/modules/errors.hpp>
 #include <hpx/modules/thread_support.hpp>
 #include <hpx/synchronization/spinlock.hpp>
 
+#include <atomic>
 #include <cstddef>
+#include <cstdint>
 #include <memory>
-#include <mutex>
 #include <utility>
 
 namespace hpx { namespace lcos { namespace local {
@@ -27,189 +29,232 @@ namespace hpx { namespace lcos { namespace local {
     // This channel is bounded to a size given at construction time and supports
     // multiple producers and multiple consumers. The data is stored in a
     // ring-buffer.
+    //
+    // The channel is lock-free: each slot of the ring-buffer carries a
+    // sequence number telling whether it is ready to be written to or read
+    // from for a given position (D. Vyukov's bounded MPMC queue). Producers
+    // and consumers claim positions by incrementing the tail and the head.
+    // The Mutex template parameter is not used anymore, it is kept for
+    // compatibility.
     template <typename T, typename Mutex = util::spinlock>
     class bounded_channel
     {
     private:
-        using mutex_type = Mutex;
-
-        bool is_full(std::size_t tail) const noexcept
+        struct cell
         {
-            std::size_t numitems = size_ + tail - head_.data_;
-            if (numitems < size_)
-            {
-                return numitems == size_ - 1;
-            }
-            return numitems - size_ == size_ - 1;
-        }
+            std::atomic<std::size_t> sequence_;
+            T data_;
+        };
 
-        bool is_empty(std::size_t head) const noexcept
+        static std::ptrdiff_t distance(
+            std::size_t sequence, std::size_t pos) noexcept
         {
-            return head == tail_.data_;
+            return static_cast<std::ptrdiff_t>(sequence - pos);
         }
 
     public:
         explicit bounded_channel(std::size_t size)
-          : size_(size + 1)
-          , buffer_(new T[size + 1])
+          : size_(size)
+          , buffer_(new cell[size])
           , closed_(false)
         {
             HPX_ASSERT(size != 0);
 
-            // invoke constructors for allocated buffer
             for (std::size_t i = 0; i != size_; ++i)
             {
-                new (&buffer_[i]) T();
+                buffer_[i].sequence_.store(i, std::memory_order_relaxed);
             }
 
-            head_.data_ = 0;
-            tail_.data_ = 0;
+            head_.data_.store(0, std::memory_order_relaxed);
+            tail_.data_.store(0, std::memory_order_relaxed);
         }
 
         bounded_channel(bounded_channel&& rhs) noexcept
-          : head_(rhs.head_)
-          , tail_(rhs.tail_)
-          , size_(rhs.size_)
+          : size_(rhs.size_)
           , buffer_(HPX_MOVE(rhs.buffer_))
-          , closed_(rhs.closed_)
         {
+            head_.data_.store(rhs.head_.data_.load(std::memory_order_acquire),
+                std::memory_order_relaxed);
+            tail_.data_.store(rhs.tail_.data_.load(std::memory_order_acquire),
+                std::memory_order_relaxed);
+            closed_.store(rhs.closed_.load(std::memory_order_acquire),
+                std::memory_order_relaxed);
+
             rhs.size_ = 0;
-            rhs.closed_ = true;
+            rhs.closed_.store(true, std::memory_order_release);
         }
 
         bounded_channel& operator=(bounded_channel&& rhs) noexcept
         {
-            head_ = rhs.head_;
-            tail_ = rhs.tail_;
+            head_.data_.store(rhs.head_.data_.load(std::memory_order_acquire),
+                std::memory_order_relaxed);
+            tail_.data_.store(rhs.tail_.data_.load(std::memory_order_acquire),
+                std::memory_order_relaxed);
             size_ = rhs.size_;
             buffer_ = HPX_MOVE(rhs.buffer_);
-            closed_ = rhs.closed_;
-            rhs.closed_ = true;
+            closed_.store(rhs.closed_.load(std::memory_order_acquire),
+                std::memory_order_relaxed);
+
+            rhs.size_ = 0;
+            rhs.closed_.store(true, std::memory_order_release);
             return *this;
         }
 
         ~bounded_channel()
         {
-            std::unique_lock<mutex_type> l(mtx_.data_);
-
-            // invoke destructors for allocated buffer
-            for (std::size_t i = 0; i != size_; ++i)
+            if (!closed_.load(std::memory_order_relaxed))
             {
-                (&buffer_[i])->~T();
-            }
-
-            if (!closed_)
-            {
-                close(l);
+                close();
             }
         }
 
         bool get(T* val = nullptr) const noexcept
         {
-            std::unique_lock<mutex_type> l(mtx_.data_);
-            if (closed_)
+            if (closed_.load(std::memory_order_relaxed))
             {
                 return false;
             }
 
-            std::size_t head = head_.data_;
-
-            if (is_empty(head))
-            {
-                return false;
-            }
-
-            if (val == nullptr)
-            {
-                return true;
-            }
-
-            *val = HPX_MOVE(buffer_[head]);
-            if (++head >= size_)
+            std::size_t pos = head_.data_.load(std::memory_order_relaxed);
+            while (true)
             {
-                head = 0;
+                cell& c = buffer_[pos % size_];
+                std::ptrdiff_t const dist = distance(
+                    c.sequence_.load(std::memory_order_acquire), pos + 1);
+
+                if (dist == 0)
+                {
+                    // the slot was written to for this position
+                    if (val == nullptr)
+                    {
+                        return true;
+                    }
+
+                    if (head_.data_.compare_exchange_weak(
+                            pos, pos + 1, std::memory_order_relaxed))
+                    {
+                        *val = HPX_MOVE(c.data_);
+
+                        // the slot can be written to one round later
+                        c.sequence_.store(
+                            pos + size_, std::memory_order_release);
+                        return true;
+                    }
+                }
+                else if (dist < 0)
+                {
+                    return false;    // empty
+                }
+                else
+                {
+                    // another consumer got this position
+                    pos = head_.data_.load(std::memory_order_relaxed);
+                }
             }
-            head_.data_ = head;
-
-            return true;
         }
 
         bool set(T&& t) noexcept
         {
-            std::unique_lock<mutex_type> l(mtx_.data_);
-            if (closed_)
+            if (closed_.load(std::memory_order_relaxed))
             {
                 return false;
             }
 
-            std::size_t tail = tail_.data_;
-
-            if (is_full(tail))
+            std::size_t pos = tail_.data_.load(std::memory_order_relaxed);
+            while (true)
             {
-                return false;
+                cell& c = buffer_[pos % size_];
+                std::ptrdiff_t const dist =
+                    distance(c.sequence_.load(std::memory_order_acquire), pos);
+
+                if (dist == 0)
+                {
+                    // the slot was read from for this position
+                    if (tail_.data_.compare_exchange_weak(
+                            pos, pos + 1, std::memory_order_relaxed))
+                    {
+                        c.data_ = HPX_MOVE(t);
+                        c.sequence_.store(pos + 1, std::memory_order_release);
+                        return true;
+                    }
+                }
+                else if (dist < 0)
+                {
+                    return false;    // full
+                }
+                else
+                {
+                    // another producer got this position
+                    pos = tail_.data_.load(std::memory_order_relaxed);
+                }
             }
-
-            buffer_[tail] = HPX_MOVE(t);
-            if (++tail >= size_)
-            {
-                tail = 0;
-            }
-            tail_.data_ = tail;
-
-            return true;
         }
 
-        std::size_t close()
+        // Wait for a value to be available, returns false if the channel was
+        // closed. HPX threads yield to other threads while waiting.
+        bool get_wait(T* val = nullptr) const
         {
-            std::unique_lock<mutex_type> l(mtx_.data_);
-            return close(l);
+            bool result = false;
+            hpx::util::yield_while(
+                [&]() {
+                    result = get(val);
+                    return !result &&
+                        !closed_.load(std::memory_order_relaxed);
+                },
+                "hpx::lcos::local::bounded_channel::get_wait");
+            return result;
         }
 
-        std::size_t capacity() const
+        // Wait for a slot to be available, returns false if the channel was
+        // closed. HPX threads yield to other threads while waiting.
+        bool set_wait(T&& t)
         {
-            return size_ - 1;
+            bool result = false;
+            hpx::util::yield_while(
+                [&]() {
+                    result = set(HPX_MOVE(t));
+                    return !result &&
+                        !closed_.load(std::memory_order_relaxed);
+                },
+                "hpx::lcos::local::bounded_channel::set_wait");
+            return result;
         }
 
-    protected:
-        std::size_t close(std::unique_lock<mutex_type>& l)
+        std::size_t close()
         {
-            HPX_ASSERT_OWNS_LOCK(l);
-
-            if (closed_)
+            bool expected = false;
+            if (!closed_.compare_exchange_strong(expected, true))
             {
-                l.unlock();
                 HPX_THROW_EXCEPTION(hpx::invalid_status,
                     "hpx::lcos::local::bounded_channel::close",
                     "attempting to close an already closed channel");
             }
-
-            closed_ = true;
             return 0;
         }
 
+        std::size_t capacity() const
+        {
+            return size_;
+        }
+
     private:
-        // keep the mutex, the head, and the tail pointer in separate cache
-        // lines
-        mutable hpx::util::cache_aligned_data<mutex_type> mtx_;
-        mutable hpx::util::cache_aligned_data<std::size_t> head_;
-        hpx::util::cache_aligned_data<std::size_t> tail_;
+        // keep the head and the tail in separate cache lines
+        mutable hpx::util::cache_aligned_data<std::atomic<std::size_t>> head_;
+        hpx::util::cache_aligned_data<std::atomic<std::size_t>> tail_;
 
-        // a channel of size n can buffer n-1 items
         std::size_t size_;
 
         // channel buffer
-        std::unique_ptr<T[]> buffer_;
+        std::unique_ptr<cell[]> buffer_;
 
         // this channel was closed, i.e. no further operations are possible
-        bool closed_;
+        std::atomic<bool> closed_;
     };
 
     ////////////////////////////////////////////////////////////////////////////
     // For use with HPX threads, the channel_mpmc defined here is the fastest
-    // (even faster than the channel_spsc). Using hpx::util::spinlock as the
-    // means of synchronization enables the use of this channel with non-HPX
-    // threads, however the performance degrades by a factor of ten compared to
-    // using hpx::spinlock.
+    // (even faster than the channel_spsc). As it is lock-free, this channel
+    // can be used with non-HPX threads as well.
     template <typename T>
     using channel_mpmc = bounded_channel<T, hpx::spinlock>;
 
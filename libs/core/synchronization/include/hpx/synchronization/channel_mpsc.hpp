@@ -10,6 +10,7 @@
 
 #include <hpx/config.hpp>
 #include <hpx/assert.hpp>
+#include <hpx/execution_base/this_thread.hpp>
 #include <hpx/modules/concurrency.hpp>
 #include <hpx/modules/errors.hpp>
 #include <hpx/modules/thread_support.hpp>
@@ -17,8 +18,8 @@
 
 #include <atomic>
 #include <cstddef>
+#include <cstdint>
 #include <memory>
-#include <mutex>
 #include <utility>
 
 namespace hpx { namespace lcos { namespace local {
@@ -28,45 +29,44 @@ namespace hpx { namespace lcos { namespace local {
     // This channel is bounded to a size given at construction time and supports
     // a multiple producers and a single consumer. The data is stored in a
     // ring-buffer.
+    //
+    // The channel is lock-free: each slot of the ring-buffer carries a
+    // sequence number telling whether it is ready to be written to or read
+    // from for a given position (D. Vyukov's bounded MPMC queue). Producers
+    // claim positions by incrementing the tail, the single consumer owns the
+    // head. The Mutex template parameter is not used anymore, it is kept for
+    // compatibility.
     template <typename T, typename Mutex = util::spinlock>
     class base_channel_mpsc
     {
     private:
-        using mutex_type = Mutex;
-
-        bool is_full(std::size_t tail) const noexcept
+        struct cell
         {
-            std::size_t numitems =
-                size_ + tail - head_.data_.load(std::memory_order_relaxed);
-
-            if (numitems < size_)
-            {
-                return numitems == size_ - 1;
-            }
-            return (numitems - size_ == size_ - 1);
-        }
+            std::atomic<std::size_t> sequence_;
+            T data_;
+        };
 
-        bool is_empty(std::size_t head) const noexcept
+        static std::ptrdiff_t distance(
+            std::size_t sequence, std::size_t pos) noexcept
         {
-            return head == tail_.data_.tail_.load(std::memory_order_relaxed);
+            return static_cast<std::ptrdiff_t>(sequence - pos);
         }
 
     public:
         explicit base_channel_mpsc(std::size_t size)
-          : size_(size + 1)
-          , buffer_(new T[size + 1])
+          : size_(size)
+          , buffer_(new cell[size])
           , closed_(false)
         {
             HPX_ASSERT(size != 0);
 
-            // invoke constructors for allocated buffer
             for (std::size_t i = 0; i != size_; ++i)
             {
-                new (&buffer_[i]) T();
+                buffer_[i].sequence_.store(i, std::memory_order_relaxed);
             }
 
             head_.data_.store(0, std::memory_order_relaxed);
-            tail_.data_.tail_.store(0, std::memory_order_relaxed);
+            tail_.data_.store(0, std::memory_order_relaxed);
         }
 
         base_channel_mpsc(base_channel_mpsc&& rhs) noexcept
@@ -75,12 +75,12 @@ namespace hpx { namespace lcos { namespace local {
         {
             head_.data_.store(rhs.head_.data_.load(std::memory_order_acquire),
                 std::memory_order_relaxed);
-            tail_.data_.tail_.store(
-                rhs.tail_.data_.tail_.load(std::memory_order_acquire),
+            tail_.data_.store(rhs.tail_.data_.load(std::memory_order_acquire),
                 std::memory_order_relaxed);
-
             closed_.store(rhs.closed_.load(std::memory_order_acquire),
                 std::memory_order_relaxed);
+
+            rhs.size_ = 0;
             rhs.closed_.store(true, std::memory_order_release);
         }
 
@@ -88,28 +88,20 @@ namespace hpx { namespace lcos { namespace local {
         {
             head_.data_.store(rhs.head_.data_.load(std::memory_order_acquire),
                 std::memory_order_relaxed);
-            tail_.data_.tail_.store(
-                rhs.tail_.data_.tail_.load(std::memory_order_acquire),
+            tail_.data_.store(rhs.tail_.data_.load(std::memory_order_acquire),
                 std::memory_order_relaxed);
-
             size_ = rhs.size_;
             buffer_ = HPX_MOVE(rhs.buffer_);
-
             closed_.store(rhs.closed_.load(std::memory_order_acquire),
                 std::memory_order_relaxed);
-            rhs.closed_.store(true, std::memory_order_release);
 
+            rhs.size_ = 0;
+            rhs.closed_.store(true, std::memory_order_release);
             return *this;
         }
 
         ~base_channel_mpsc()
         {
-            // invoke destructors for allocated buffer
-            for (std::size_t i = 0; i != size_; ++i)
-            {
-                (&buffer_[i])->~T();
-            }
-
             if (!closed_.load(std::memory_order_relaxed))
             {
                 close();
@@ -123,11 +115,11 @@ namespace hpx { namespace lcos { namespace local {
                 return false;
             }
 
-            std::size_t head = head_.data_.load(std::memory_order_relaxed);
-
-            if (is_empty(head))
+            std::size_t const pos = head_.data_.load(std::memory_order_relaxed);
+            cell& c = buffer_[pos % size_];
+            if (c.sequence_.load(std::memory_order_acquire) != pos + 1)
             {
-                return false;
+                return false;    // empty
             }
 
             if (val == nullptr)
@@ -135,13 +127,11 @@ namespace hpx { namespace lcos { namespace local {
                 return true;
             }
 
-            *val = HPX_MOVE(buffer_[head]);
-            if (++head >= size_)
-            {
-                head = 0;
-            }
-            head_.data_.store(head, std::memory_order_release);
+            *val = HPX_MOVE(c.data_);
+            head_.data_.store(pos + 1, std::memory_order_relaxed);
 
+            // the slot can be written to one round later
+            c.sequence_.store(pos + size_, std::memory_order_release);
             return true;
         }
 
@@ -152,30 +142,70 @@ namespace hpx { namespace lcos { namespace local {
                 return false;
             }
 
-            std::unique_lock<mutex_type> l(tail_.data_.mtx_);
-
-            std::size_t tail =
-                tail_.data_.tail_.load(std::memory_order_acquire);
-
-            if (is_full(tail))
+            std::size_t pos = tail_.data_.load(std::memory_order_relaxed);
+            while (true)
             {
-                return false;
+                cell& c = buffer_[pos % size_];
+                std::ptrdiff_t const dist =
+                    distance(c.sequence_.load(std::memory_order_acquire), pos);
+
+                if (dist == 0)
+                {
+                    // the slot was read from for this position
+                    if (tail_.data_.compare_exchange_weak(
+                            pos, pos + 1, std::memory_order_relaxed))
+                    {
+                        c.data_ = HPX_MOVE(t);
+                        c.sequence_.store(pos + 1, std::memory_order_release);
+                        return true;
+                    }
+                }
+                else if (dist < 0)
+                {
+                    return false;    // full
+                }
+                else
+                {
+                    // another producer got this position
+                    pos = tail_.data_.load(std::memory_order_relaxed);
+                }
             }
+        }
 
-            buffer_[tail] = HPX_MOVE(t);
-            if (++tail >= size_)
-            {
-                tail = 0;
-            }
-            tail_.data_.tail_.store(tail, std::memory_order_relaxed);
+        // Wait for a value to be available, returns false if the channel was
+        // closed. HPX threads yield to other threads while waiting.
+        bool get_wait(T* val = nullptr) const
+        {
+            bool result = false;
+            hpx::util::yield_while(
+                [&]() {
+                    result = get(val);
+                    return !result &&
+                        !closed_.load(std::memory_order_relaxed);
+                },
+                "hpx::lcos::local::base_channel_mpsc::get_wait");
+            return result;
+        }
 
-            return true;
+        // Wait for a slot to be available, returns false if the channel was
+        // closed. HPX threads yield to other threads while waiting.
+        bool set_wait(T&& t)
+        {
+            bool result = false;
+            hpx::util::yield_while(
+                [&]() {
+                    result = set(HPX_MOVE(t));
+                    return !result &&
+                        !closed_.load(std::memory_order_relaxed);
+                },
+                "hpx::lcos::local::base_channel_mpsc::set_wait");
+            return result;
         }
 
         std::size_t close()
         {
             bool expected = false;
-            if (!closed_.compare_exchange_weak(expected, true))
+            if (!closed_.compare_exchange_strong(expected, true))
             {
                 HPX_THROW_EXCEPTION(hpx::invalid_status,
                     "hpx::lcos::local::base_channel_mpsc::close",
@@ -186,34 +216,26 @@ namespace hpx { namespace lcos { namespace local {
 
         std::size_t capacity() const
         {
-            return size_ - 1;
+            return size_;
         }
 
     private:
-        // keep the mutex with the tail and the head pointer in separate cache
-        // lines
-        struct tail_data
-        {
-            mutex_type mtx_;
-            std::atomic<std::size_t> tail_;
-        };
-
+        // keep the head and the tail in separate cache lines
         mutable hpx::util::cache_aligned_data<std::atomic<std::size_t>> head_;
-        hpx::util::cache_aligned_data<tail_data> tail_;
+        hpx::util::cache_aligned_data<std::atomic<std::size_t>> tail_;
 
-        // a channel of size n can buffer n-1 items
         std::size_t size_;
 
         // channel buffer
-        std::unique_ptr<T[]> buffer_;
+        std::unique_ptr<cell[]> buffer_;
 
         // this channel was closed, i.e. no further operations are possible
         std::atomic<bool> closed_;
     };
 
     ////////////////////////////////////////////////////////////////////////////
-    // Using hpx::util::spinlock as the means of synchronization enables the use
-    // of this channel with non-HPX threads.
+    // As it is lock-free, this channel can be used with non-HPX threads as
+    // well.
     template <typename T>
     using channel_mpsc = base_channel_mpsc<T, hpx::spinlock>;
 
@@ -0,0 +1,217 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/execution_base/completion_signatures.hpp>
+#include <hpx/execution_base/operation_state.hpp>
+#include <hpx/execution_base/receiver.hpp>
+#include <hpx/execution_base/sender.hpp>
+
+#include <exception>
+#include <type_traits>
+#include <utility>
+
+namespace hpx { namespace experimental { namespace detail {
+
+    // A waiter is embedded in the operation state of a sender waiting on one
+    // of the asynchronous synchronization primitives. Waiting does not
+    // suspend a thread, the waiters are linked into an intrusive list and
+    // are completed by the thread releasing the primitive.
+    struct async_waiter
+    {
+        using complete_function_type = void (*)(async_waiter*) noexcept;
+
+        explicit constexpr async_waiter(complete_function_type f) noexcept
+          : complete_(f)
+        {
+        }
+
+        void complete() noexcept
+        {
+            complete_(this);
+        }
+
+        async_waiter* next_ = nullptr;
+        complete_function_type complete_;
+    };
+
+    // FIFO list of waiters, not thread-safe
+    class async_waiter_queue
+    {
+    public:
+        constexpr async_waiter_queue() noexcept = default;
+
+        async_waiter_queue(async_waiter_queue const&) = delete;
+        async_waiter_queue& operator=(async_waiter_queue const&) = delete;
+
+        async_waiter_queue(async_waiter_queue&& rhs) noexcept
+          : head_(rhs.head_)
+          , tail_(rhs.tail_)
+        {
+            rhs.head_ = nullptr;
+            rhs.tail_ = nullptr;
+        }
+
+        async_waiter_queue& operator=(async_waiter_queue&& rhs) noexcept
+        {
+            head_ = rhs.head_;
+            tail_ = rhs.tail_;
+            rhs.head_ = nullptr;
+            rhs.tail_ = nullptr;
+            return *this;
+        }
+
+        ~async_waiter_queue()
+        {
+            HPX_ASSERT_MSG(head_ == nullptr,
+                "an asynchronous synchronization primitive was destroyed "
+                "while senders were still waiting on it");
+        }
+
+        constexpr bool empty() const noexcept
+        {
+            return head_ == nullptr;
+        }
+
+        void push(async_waiter* w) noexcept
+        {
+            w->next_ = nullptr;
+            if (tail_ == nullptr)
+            {
+                head_ = w;
+            }
+            else
+            {
+                tail_->next_ = w;
+            }
+            tail_ = w;
+        }
+
+        async_waiter* pop() noexcept
+        {
+            async_waiter* w = head_;
+            if (w != nullptr)
+            {
+                head_ = w->next_;
+                if (head_ == nullptr)
+                {
+                    tail_ = nullptr;
+                }
+                w->next_ = nullptr;
+            }
+            return w;
+        }
+
+        // completes all waiters, in the order they were added
+        void complete_all() noexcept
+        {
+            while (async_waiter* w = pop())
+            {
+                w->complete();
+            }
+        }
+
+    private:
+        async_waiter* head_ = nullptr;
+        async_waiter* tail_ = nullptr;
+    };
+
+    // The sender returned by the asynchronous synchronization primitives. It
+    // completes (with no values) as soon as the primitive, which has to
+    // expose
+    //
+    //     // returns false if the waiter can continue right away, true if it
+    //     // was added to the waiters and will be completed later
+    //     bool add_waiter(async_waiter* w);
+    //
+    // lets the waiter continue. The receiver is called on the thread that
+    // started the operation or on the thread that released the primitive.
+    template <typename Primitive>
+    struct async_waiter_sender
+    {
+        Primitive* primitive;
+
+        // the primitives befriend the sender
+        static bool add_waiter(Primitive* p, async_waiter* w)
+        {
+            return p->add_waiter(w);
+        }
+
+        template <typename Env>
+        struct generate_completion_signatures
+        {
+            template <template <typename...> typename Tuple,
+                template <typename...> typename Variant>
+            using value_types = Variant<Tuple<>>;
+
+            template <template <typename...> typename Variant>
+            using error_types = Variant<std::exception_ptr>;
+
+            static constexpr bool sends_stopped = false;
+        };
+
+        template <typename Env>
+        friend auto tag_invoke(
+            hpx::execution::experimental::get_completion_signatures_t,
+            async_waiter_sender const&, Env)
+            -> generate_completion_signatures<Env>;
+
+        template <typename R>
+        struct operation_state : async_waiter
+        {
+            std::decay_t<R> r;
+            Primitive* primitive;
+
+            template <typename R_>
+            operation_state(R_&& r, Primitive* primitive)
+              : async_waiter(&operation_state::complete_waiter)
+              , r(HPX_FORWARD(R_, r))
+              , primitive(primitive)
+            {
+            }
+
+            operation_state(operation_state&&) = delete;
+            operation_state& operator=(operation_state&&) = delete;
+            operation_state(operation_state const&) = delete;
+            operation_state& operator=(operation_state const&) = delete;
+
+            static void complete_waiter(async_waiter* w) noexcept
+            {
+                auto& os = static_cast<operation_state&>(*w);
+                try
+                {
+                    hpx::execution::experimental::set_value(HPX_MOVE(os.r));
+                }
+                catch (...)
+                {
+                    hpx::execution::experimental::set_error(
+                        HPX_MOVE(os.r), std::current_exception());
+                }
+            }
+
+            friend void tag_invoke(hpx::execution::experimental::start_t,
+                operation_state& os) noexcept
+            {
+                HPX_ASSERT(os.primitive != nullptr);
+                if (!async_waiter_sender::add_waiter(os.primitive, &os))
+                {
+                    complete_waiter(&os);
+                }
+            }
+        };
+
+        template <typename R>
+        friend operation_state<R> tag_invoke(
+            hpx::execution::experimental::connect_t,
+            async_waiter_sender const& s, R&& r)
+        {
+            return operation_state<R>{HPX_FORWARD(R, r), s.primitive};
+        }
+    };
+}}}    // namespace hpx::experimental::detail
@@ -179,7 +179,8 @@ namespace hpx { namespace lcos { namespace local { namespace detail {
         typedef hpx::spinlock mutex_type;
 
         condition_variable_data()
-          : count_(1)
+          : mtx_(std::in_place, "hpx::condition_variable")
+          , count_(1)
         {
         }
 
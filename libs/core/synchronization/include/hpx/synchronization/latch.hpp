@@ -98,16 +98,13 @@ namespace hpx {
                 std::unique_lock l(mtx_.data_);
                 notified_ = true;
 
-                // Note: we use notify_one repeatedly instead of notify_all as we
-                // know that our implementation of condition_variable::notify_one
-                // relinquishes the lock before resuming the waiting thread
-                // which avoids suspension of this thread when it tries to
-                // re-lock the mutex while exiting from condition_variable::wait
-                while (cond_.data_.notify_one(
-                    HPX_MOVE(l), threads::thread_priority::boost))
-                {
-                    l = std::unique_lock(mtx_.data_);
-                }
+                // Note: our implementation of condition_variable::notify_all
+                // relinquishes the lock before resuming the waiting threads
+                // (which are scheduled in one batch) which avoids suspension
+                // of the resumed threads when they try to re-lock the mutex
+                // while exiting from condition_variable::wait
+                cond_.data_.notify_all(
+                    HPX_MOVE(l), threads::thread_priority::boost);
             }
         }
 
@@ -162,16 +159,13 @@ namespace hpx {
             {
                 notified_ = true;
 
-                // Note: we use notify_one repeatedly instead of notify_all as we
-                // know that our implementation of condition_variable::notify_one
-                // relinquishes the lock before resuming the waiting thread
-                // which avoids suspension of this thread when it tries to
-                // re-lock the mutex while exiting from condition_variable::wait
-                while (cond_.data_.notify_one(
-                    HPX_MOVE(l), threads::thread_priority::boost))
-                {
-                    l = std::unique_lock(mtx_.data_);
-                }
+                // Note: our implementation of condition_variable::notify_all
+                // relinquishes the lock before resuming the waiting threads
+                // (which are scheduled in one batch) which avoids suspension
+                // of the resumed threads when they try to re-lock the mutex
+                // while exiting from condition_variable::wait
+                cond_.data_.notify_all(
+                    HPX_MOVE(l), threads::thread_priority::boost);
             }
         }
 
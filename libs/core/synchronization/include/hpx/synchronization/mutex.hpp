@@ -68,6 +68,9 @@ namespace hpx {
         mutable mutex_type mtx_;
         threads::thread_id_type owner_id_;
         hpx::lcos::local::detail::condition_variable cond_;
+#if defined(HPX_HAVE_LOCK_CONTENTION_PROFILING)
+        char const* description_;
+#endif
     };
 
     ///////////////////////////////////////////////////////////////////////////
@@ -9,6 +9,7 @@
 #pragma once
 
 #include <hpx/config.hpp>
+#include <hpx/lock_registration/detail/lock_contention.hpp>
 #include <hpx/synchronization/condition_variable.hpp>
 #include <hpx/synchronization/mutex.hpp>
 
@@ -55,10 +56,13 @@ namespace hpx {
 
             void lock_shared()
             {
+                util::detail::lock_contention_timer contention(
+                    "hpx::shared_mutex");
                 std::unique_lock<mutex_type> lk(state_change);
 
                 while (state.exclusive || state.exclusive_waiting_blocked)
                 {
+                    contention.contended();
                     shared_cond.wait(lk);
                 }
 
@@ -75,6 +79,8 @@ namespace hpx {
                 else
                 {
                     ++state.shared_count;
+                    util::detail::record_lock_acquisition(
+                        "hpx::shared_mutex", 0, false);
                     return true;
                 }
             }
@@ -105,10 +111,13 @@ namespace hpx {
 
             void lock()
             {
+                util::detail::lock_contention_timer contention(
+                    "hpx::shared_mutex");
                 std::unique_lock<mutex_type> lk(state_change);
 
                 while (state.shared_count || state.exclusive)
                 {
+                    contention.contended();
                     state.exclusive_waiting_blocked = true;
                     exclusive_cond.wait(lk);
                 }
@@ -126,6 +135,8 @@ namespace hpx {
                 else
                 {
                     state.exclusive = true;
+                    util::detail::record_lock_acquisition(
+                        "hpx::shared_mutex", 0, false);
                     return true;
                 }
             }
@@ -140,11 +151,14 @@ namespace hpx {
 
             void lock_upgrade()
             {
+                util::detail::lock_contention_timer contention(
+                    "hpx::shared_mutex");
                 std::unique_lock<mutex_type> lk(state_change);
 
                 while (state.exclusive || state.exclusive_waiting_blocked ||
                     state.upgrade)
                 {
+                    contention.contended();
                     shared_cond.wait(lk);
                 }
 
@@ -164,6 +178,8 @@ namespace hpx {
                 {
                     ++state.shared_count;
                     state.upgrade = true;
+                    util::detail::record_lock_acquisition(
+                        "hpx::shared_mutex", 0, false);
                     return true;
                 }
             }
@@ -183,11 +199,14 @@ namespace hpx {
 
             void unlock_upgrade_and_lock()
             {
+                util::detail::lock_contention_timer contention(
+                    "hpx::shared_mutex");
                 std::unique_lock<mutex_type> lk(state_change);
                 --state.shared_count;
 
                 while (state.shared_count)
                 {
+                    contention.contended();
                     upgrade_cond.wait(lk);
                 }
 
@@ -16,6 +16,7 @@
 #include <hpx/config.hpp>
 
 #include <hpx/execution_base/this_thread.hpp>
+#include <hpx/lock_registration/detail/lock_contention.hpp>
 #include <hpx/lock_registration/detail/register_locks.hpp>
 #include <hpx/modules/itt_notify.hpp>
 
@@ -42,16 +43,25 @@ namespace hpx {
 
         private:
             std::atomic<bool> v_;
+#if defined(HPX_HAVE_LOCK_CONTENTION_PROFILING)
+            char const* desc_;
+#endif
 
         public:
             spinlock() noexcept
               : v_(false)
+#if defined(HPX_HAVE_LOCK_CONTENTION_PROFILING)
+              , desc_("hpx::spinlock")
+#endif
             {
                 HPX_ITT_SYNC_CREATE(this, "hpx::spinlock", nullptr);
             }
 
             explicit spinlock(char const* const desc) noexcept
               : v_(false)
+#if defined(HPX_HAVE_LOCK_CONTENTION_PROFILING)
+              , desc_(desc != nullptr && *desc != '\0' ? desc : "hpx::spinlock")
+#endif
             {
                 HPX_ITT_SYNC_CREATE(this, "hpx::spinlock", desc);
             }
@@ -68,6 +78,9 @@ namespace hpx {
             void lock()
             {
                 HPX_ITT_SYNC_PREPARE(this);
+#if defined(HPX_HAVE_LOCK_CONTENTION_PROFILING)
+                util::detail::lock_contention_timer contention(desc_);
+#endif
 
                 // Checking for the value in is_locked() ensures that
                 // acquire_lock is only called when is_locked computes
@@ -94,6 +107,9 @@ namespace hpx {
                 //      same.
                 if (!acquire_lock())
                 {
+#if defined(HPX_HAVE_LOCK_CONTENTION_PROFILING)
+                    contention.contended();
+#endif
                     do
                     {
                         util::yield_while(
@@ -115,6 +131,9 @@ namespace hpx {
                 if (r)
                 {
                     HPX_ITT_SYNC_ACQUIRED(this);
+#if defined(HPX_HAVE_LOCK_CONTENTION_PROFILING)
+                    util::detail::record_lock_acquisition(desc_, 0, false);
+#endif
                     util::register_lock(this);
                     return true;
                 }
@@ -28,7 +28,22 @@ namespace hpx {
     class spinlock_pool
     {
     private:
-        static util::cache_aligned_data<hpx::spinlock> pool_[N];
+#if defined(HPX_HAVE_LOCK_CONTENTION_PROFILING)
+        // the spinlocks of all pools are profiled as one lock site
+        struct pool_spinlock : hpx::spinlock
+        {
+            pool_spinlock() noexcept
+              : hpx::spinlock("hpx::spinlock_pool")
+            {
+            }
+        };
+
+        using spinlock_type = pool_spinlock;
+#else
+        using spinlock_type = hpx::spinlock;
+#endif
+
+        static util::cache_aligned_data<spinlock_type> pool_[N];
 
     public:
         static hpx::spinlock& spinlock_for(void const* pv) noexcept
@@ -74,7 +89,8 @@ namespace hpx {
     };
 
     template <typename Tag, std::size_t N>
-    util::cache_aligned_data<hpx::spinlock> spinlock_pool<Tag, N>::pool_[N];
+    util::cache_aligned_data<typename spinlock_pool<Tag, N>::spinlock_type>
+        spinlock_pool<Tag, N>::pool_[N];
 }    // namespace hpx
 
 namespace hpx::lcos::local {
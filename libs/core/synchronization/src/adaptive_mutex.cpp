@@ -0,0 +1,179 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/synchronization/adaptive_mutex.hpp>
+
+#include <hpx/assert.hpp>
+#include <hpx/coroutines/thread_enums.hpp>
+#include <hpx/lock_registration/detail/lock_contention.hpp>
+#include <hpx/lock_registration/detail/register_locks.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/modules/itt_notify.hpp>
+#include <hpx/threading_base/thread_data.hpp>
+#include <hpx/timing/high_resolution_clock.hpp>
+#include <hpx/type_support/unused.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <utility>
+
+namespace hpx {
+
+    ///////////////////////////////////////////////////////////////////////////
+    adaptive_mutex::adaptive_mutex(char const* const description)
+      : locked_(false)
+      , waiting_(0)
+      , hold_time_(initial_hold_time)
+      , acquired_at_(0)
+#if defined(HPX_HAVE_LOCK_CONTENTION_PROFILING)
+      , description_(description != nullptr && *description != '\0' ?
+                description :
+                "hpx::adaptive_mutex")
+#endif
+    {
+        HPX_ITT_SYNC_CREATE(this, "hpx::adaptive_mutex", description);
+        HPX_ITT_SYNC_RENAME(this, "hpx::adaptive_mutex");
+    }
+
+    adaptive_mutex::~adaptive_mutex()
+    {
+        HPX_ITT_SYNC_DESTROY(this);
+    }
+
+    bool adaptive_mutex::spin(std::uint64_t spin_time) noexcept
+    {
+        std::uint64_t const deadline =
+            hpx::chrono::high_resolution_clock::now() + spin_time;
+        do
+        {
+            // spinning is pointless if other threads are suspended already,
+            // the mutex will be handed to them first
+            if (waiting_.load(std::memory_order_relaxed) != 0)
+            {
+                return false;
+            }
+
+            for (int i = 0; i != 16; ++i)
+            {
+                if (acquire())
+                {
+                    return true;
+                }
+                HPX_SMT_PAUSE;
+            }
+        } while (hpx::chrono::high_resolution_clock::now() < deadline);
+
+        return false;
+    }
+
+    void adaptive_mutex::acquired() noexcept
+    {
+        util::register_lock(this);
+        HPX_ITT_SYNC_ACQUIRED(this);
+        acquired_at_ = hpx::chrono::high_resolution_clock::now();
+    }
+
+    void adaptive_mutex::lock(char const* description, error_code& ec)
+    {
+        HPX_ASSERT(threads::get_self_ptr() != nullptr);
+
+        HPX_ITT_SYNC_PREPARE(this);
+#if defined(HPX_HAVE_LOCK_CONTENTION_PROFILING)
+        util::detail::lock_contention_timer contention(description_);
+#endif
+        if (acquire())
+        {
+            acquired();
+            return;
+        }
+
+#if defined(HPX_HAVE_LOCK_CONTENTION_PROFILING)
+        contention.contended();
+#endif
+        std::uint64_t const spin_duration = spin_time();
+        if (spin_duration != 0 && spin(spin_duration))
+        {
+            acquired();
+            return;
+        }
+
+        // suspend until the owner releases the mutex
+        std::unique_lock<mutex_type> l(mtx_);
+        waiting_.fetch_add(1, std::memory_order_seq_cst);
+        while (locked_.exchange(true, std::memory_order_seq_cst))
+        {
+            cond_.wait(l, description, ec);
+            if (ec)
+            {
+                waiting_.fetch_sub(1, std::memory_order_relaxed);
+                HPX_ITT_SYNC_CANCEL(this);
+#if defined(HPX_HAVE_LOCK_CONTENTION_PROFILING)
+                contention.cancel();
+#endif
+                return;
+            }
+        }
+        waiting_.fetch_sub(1, std::memory_order_relaxed);
+
+        acquired();
+    }
+
+    bool adaptive_mutex::try_lock(
+        char const* /* description */, error_code& /* ec */)
+    {
+        HPX_ITT_SYNC_PREPARE(this);
+        if (!acquire())
+        {
+            HPX_ITT_SYNC_CANCEL(this);
+            return false;
+        }
+
+        acquired();
+#if defined(HPX_HAVE_LOCK_CONTENTION_PROFILING)
+        util::detail::record_lock_acquisition(description_, 0, false);
+#endif
+        return true;
+    }
+
+    void adaptive_mutex::unlock(error_code& ec)
+    {
+        HPX_ITT_SYNC_RELEASING(this);
+        // Unregister lock early as the lock guard below may suspend.
+        util::unregister_lock(this);
+
+        if (HPX_UNLIKELY(!locked_.load(std::memory_order_relaxed)))
+        {
+            HPX_THROWS_IF(ec, lock_error, "adaptive_mutex::unlock",
+                "The mutex is not locked");
+            return;
+        }
+
+        // update the moving average of the hold times (weight 1/8), only the
+        // owner writes to it
+        std::uint64_t const hold_time =
+            hpx::chrono::high_resolution_clock::now() - acquired_at_;
+        std::uint64_t const average =
+            hold_time_.load(std::memory_order_relaxed);
+        hold_time_.store(
+            average - average / 8 + hold_time / 8, std::memory_order_relaxed);
+
+        HPX_ITT_SYNC_RELEASED(this);
+        locked_.store(false, std::memory_order_seq_cst);
+
+        // the waiters increment waiting_ while holding mtx_ before checking
+        // locked_, they can't miss this notification
+        if (waiting_.load(std::memory_order_seq_cst) != 0)
+        {
+            std::unique_lock<mutex_type> l(mtx_);
+
+            util::ignore_while_checking il(&l);
+            HPX_UNUSED(il);
+
+            cond_.notify_one(HPX_MOVE(l), threads::thread_priority::boost, ec);
+        }
+    }
+}    // namespace hpx
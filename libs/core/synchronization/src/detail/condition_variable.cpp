@@ -15,6 +15,8 @@
 #include <hpx/synchronization/spinlock.hpp>
 #include <hpx/thread_support/assert_owns_lock.hpp>
 #include <hpx/thread_support/unlock_guard.hpp>
+#include <hpx/threading_base/execution_agent.hpp>
+#include <hpx/threading_base/set_thread_state.hpp>
 #include <hpx/threading_base/thread_helpers.hpp>
 #include <hpx/timing/steady_clock.hpp>
 #include <hpx/type_support/unused.hpp>
@@ -23,6 +25,7 @@
 #include <exception>
 #include <mutex>
 #include <utility>
+#include <vector>
 
 namespace hpx { namespace lcos { namespace local { namespace detail {
 
@@ -99,45 +102,82 @@ namespace hpx { namespace lcos { namespace local { namespace detail {
     }
 
     void condition_variable::notify_all(std::unique_lock<mutex_type> lock,
-        threads::thread_priority /* priority */, error_code& ec)
+        threads::thread_priority priority, error_code& ec)
     {
         HPX_ASSERT_OWNS_LOCK(lock);
 
-        // swap the list
-        queue_type queue;
-        queue.swap(queue_);
+        // a single waiting thread is handled the same way as by notify_one
+        if (queue_.size() <= 1)
+        {
+            notify_one(HPX_MOVE(lock), priority, ec);
+            return;
+        }
 
-        if (!queue.empty())
+        // Remove all entries from the queue while holding the lock, but wake
+        // up the waiting threads only after the lock was released. Otherwise,
+        // all woken threads would have to wait for the lock until the last
+        // waiting thread was resumed.
+        std::vector<hpx::execution_base::agent_ref> ctxs;
+        ctxs.reserve(queue_.size());
+
+        bool found_null_ctx = false;
+        while (!queue_.empty())
         {
-            // update reference to queue for all queue entries
-            for (queue_entry& qe : queue)
-                qe.q_ = &queue;
+            auto ctx = queue_.front().ctx_;
 
-            do
-            {
-                auto ctx = queue.front().ctx_;
+            // remove item from queue before error handling
+            queue_.front().ctx_.reset();
+            queue_.pop_front();
 
-                // remove item from queue before error handling
-                queue.front().ctx_.reset();
-                queue.pop_front();
+            // skip a null entry, but still wake up all other waiting threads
+            if (HPX_UNLIKELY(!ctx))
+            {
+                found_null_ctx = true;
+                continue;
+            }
 
-                if (HPX_UNLIKELY(!ctx))
-                {
-                    prepend_entries(lock, queue);
-                    lock.unlock();
+            ctxs.push_back(ctx);
+        }
 
-                    HPX_THROWS_IF(ec, null_thread_id,
-                        "condition_variable::notify_all",
-                        "null thread id encountered");
-                    return;
-                }
+        lock.unlock();
 
-                util::ignore_while_checking il(&lock);
-                HPX_UNUSED(il);
+        // HPX threads are handed to the scheduler in one batch, other agents
+        // are resumed one at a time.
+        std::vector<threads::thread_id_type> ids;
+        ids.reserve(ctxs.size());
 
+        for (auto& ctx : ctxs)
+        {
+            auto* agent = dynamic_cast<threads::execution_agent*>(&ctx.ref());
+            if (agent != nullptr)
+            {
+                ids.push_back(agent->get_thread_id());
+            }
+            else
+            {
                 ctx.resume();
+            }
+        }
+
+        // all threads are scheduled even if one of them fails, but the error
+        // is reported only once
+        error_code state_ec(throwmode::lightweight);
+        threads::detail::set_thread_state_n(ids.data(), ids.size(),
+            threads::thread_restart_state::signaled, state_ec);
 
-            } while (!queue.empty());
+        if (HPX_UNLIKELY(found_null_ctx))
+        {
+            HPX_THROWS_IF(ec, null_thread_id, "condition_variable::notify_all",
+                "null thread id encountered");
+            return;
+        }
+
+        if (HPX_UNLIKELY(state_ec))
+        {
+            HPX_THROWS_IF(ec, static_cast<hpx::error>(state_ec.value()),
+                "condition_variable::notify_all", "{}",
+                state_ec.get_message());
+            return;
         }
 
         if (&ec != &throws)
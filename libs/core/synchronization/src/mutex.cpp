@@ -9,6 +9,7 @@
 
 #include <hpx/assert.hpp>
 #include <hpx/coroutines/thread_enums.hpp>
+#include <hpx/lock_registration/detail/lock_contention.hpp>
 #include <hpx/lock_registration/detail/register_locks.hpp>
 #include <hpx/modules/errors.hpp>
 #include <hpx/modules/itt_notify.hpp>
@@ -26,6 +27,11 @@ namespace hpx {
     ///////////////////////////////////////////////////////////////////////////
     mutex::mutex(char const* const description)
       : owner_id_(threads::invalid_thread_id)
+#if defined(HPX_HAVE_LOCK_CONTENTION_PROFILING)
+      , description_(description != nullptr && *description != '\0' ?
+                description :
+                "hpx::mutex")
+#endif
     {
         HPX_ITT_SYNC_CREATE(this, "hpx::mutex", description);
         HPX_ITT_SYNC_RENAME(this, "hpx::mutex");
@@ -41,12 +47,18 @@ namespace hpx {
         HPX_ASSERT(threads::get_self_ptr() != nullptr);
 
         HPX_ITT_SYNC_PREPARE(this);
+#if defined(HPX_HAVE_LOCK_CONTENTION_PROFILING)
+        util::detail::lock_contention_timer contention(description_);
+#endif
         std::unique_lock<mutex_type> l(mtx_);
 
         threads::thread_id_type self_id = threads::get_self_id();
         if (owner_id_ == self_id)
         {
             HPX_ITT_SYNC_CANCEL(this);
+#if defined(HPX_HAVE_LOCK_CONTENTION_PROFILING)
+            contention.cancel();
+#endif
             l.unlock();
             HPX_THROWS_IF(ec, deadlock, description,
                 "The calling thread already owns the mutex");
@@ -55,10 +67,16 @@ namespace hpx {
 
         while (owner_id_ != threads::invalid_thread_id)
         {
+#if defined(HPX_HAVE_LOCK_CONTENTION_PROFILING)
+            contention.contended();
+#endif
             cond_.wait(l, ec);
             if (ec)
             {
                 HPX_ITT_SYNC_CANCEL(this);
+#if defined(HPX_HAVE_LOCK_CONTENTION_PROFILING)
+                contention.cancel();
+#endif
                 return;
             }
         }
@@ -85,6 +103,9 @@ namespace hpx {
         util::register_lock(this);
         HPX_ITT_SYNC_ACQUIRED(this);
         owner_id_ = self_id;
+#if defined(HPX_HAVE_LOCK_CONTENTION_PROFILING)
+        util::detail::record_lock_acquisition(description_, 0, false);
+#endif
         return true;
     }
 
@@ -132,28 +153,43 @@ namespace hpx {
         HPX_ASSERT(threads::get_self_ptr() != nullptr);
 
         HPX_ITT_SYNC_PREPARE(this);
+#if defined(HPX_HAVE_LOCK_CONTENTION_PROFILING)
+        util::detail::lock_contention_timer contention(description_);
+#endif
         std::unique_lock<mutex_type> l(mtx_);
 
         threads::thread_id_type self_id = threads::get_self_id();
         if (owner_id_ != threads::invalid_thread_id)
         {
+#if defined(HPX_HAVE_LOCK_CONTENTION_PROFILING)
+            contention.contended();
+#endif
             threads::thread_restart_state const reason =
                 cond_.wait_until(l, abs_time, ec);
             if (ec)
             {
                 HPX_ITT_SYNC_CANCEL(this);
+#if defined(HPX_HAVE_LOCK_CONTENTION_PROFILING)
+                contention.cancel();
+#endif
                 return false;
             }
 
             if (reason == threads::thread_restart_state::timeout)    //-V110
             {
                 HPX_ITT_SYNC_CANCEL(this);
+#if defined(HPX_HAVE_LOCK_CONTENTION_PROFILING)
+                contention.cancel();
+#endif
                 return false;
             }
 
             if (owner_id_ != threads::invalid_thread_id)    //-V110
             {
                 HPX_ITT_SYNC_CANCEL(this);
+#if defined(HPX_HAVE_LOCK_CONTENTION_PROFILING)
+                contention.cancel();
+#endif
                 return false;
             }
         }
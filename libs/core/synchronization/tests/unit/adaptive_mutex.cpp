@@ -0,0 +1,122 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/local/future.hpp>
+#include <hpx/local/init.hpp>
+#include <hpx/local/thread.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/synchronization/adaptive_mutex.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+void test_lock_unlock()
+{
+    hpx::adaptive_mutex mtx("adaptive_mutex_test");
+
+    {
+        std::unique_lock<hpx::adaptive_mutex> l(mtx);
+        HPX_TEST(l.owns_lock());
+        HPX_TEST(!mtx.try_lock());
+    }
+
+    HPX_TEST(mtx.try_lock());
+    mtx.unlock();
+
+    // unlocking a mutex which is not locked is an error
+    bool caught_exception = false;
+    try
+    {
+        mtx.unlock();
+    }
+    catch (hpx::exception const& e)
+    {
+        HPX_TEST_EQ(e.get_error(), hpx::error::lock_error);
+        caught_exception = true;
+    }
+    HPX_TEST(caught_exception);
+}
+
+void test_mutual_exclusion(std::chrono::microseconds hold_time)
+{
+    hpx::adaptive_mutex mtx;
+
+    // not atomic, protected by the mutex
+    std::size_t count = 0;
+    std::atomic<bool> owned(false);
+
+    std::size_t const num_tasks = 100;
+    std::size_t const num_iterations = 100;
+
+    std::vector<hpx::future<void>> futures;
+    for (std::size_t i = 0; i != num_tasks; ++i)
+    {
+        futures.push_back(hpx::async([&]() {
+            for (std::size_t j = 0; j != num_iterations; ++j)
+            {
+                std::lock_guard<hpx::adaptive_mutex> l(mtx);
+                HPX_TEST(!owned.exchange(true));
+
+                auto const end = std::chrono::steady_clock::now() + hold_time;
+                while (std::chrono::steady_clock::now() < end)
+                {
+                }
+
+                ++count;
+                owned.store(false);
+            }
+        }));
+    }
+    hpx::wait_all(futures);
+
+    HPX_TEST_EQ(count, num_tasks * num_iterations);
+}
+
+void test_spin_time_adapts()
+{
+    hpx::adaptive_mutex mtx;
+    HPX_TEST_EQ(mtx.spin_time(), 2 * hpx::adaptive_mutex::initial_hold_time);
+
+    // long critical sections don't spin
+    for (std::size_t i = 0; i != 50; ++i)
+    {
+        std::lock_guard<hpx::adaptive_mutex> l(mtx);
+        hpx::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    HPX_TEST_EQ(mtx.spin_time(), std::uint64_t(0));
+
+    // short critical sections do
+    for (std::size_t i = 0; i != 200; ++i)
+    {
+        std::lock_guard<hpx::adaptive_mutex> l(mtx);
+    }
+    HPX_TEST_LT(std::uint64_t(0), mtx.spin_time());
+    HPX_TEST_LTE(mtx.spin_time(), hpx::adaptive_mutex::max_spin_time);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    test_lock_unlock();
+    test_mutual_exclusion(std::chrono::microseconds(0));
+    test_mutual_exclusion(std::chrono::microseconds(50));
+    test_spin_time_adapts();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
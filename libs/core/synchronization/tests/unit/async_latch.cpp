@@ -0,0 +1,87 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/local/execution.hpp>
+#include <hpx/local/future.hpp>
+#include <hpx/local/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/synchronization/async_latch.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+using hpx::execution::experimental::start_detached;
+using hpx::execution::experimental::then;
+using hpx::experimental::async_latch;
+using hpx::this_thread::experimental::sync_wait;
+
+///////////////////////////////////////////////////////////////////////////////
+void test_count_down()
+{
+    async_latch l(3);
+    HPX_TEST(!l.try_wait());
+
+    // the waiters don't block the current thread
+    std::atomic<std::size_t> count(0);
+    for (std::size_t i = 0; i != 5; ++i)
+    {
+        start_detached(l.wait() | then([&]() { ++count; }));
+    }
+
+    l.count_down();
+    l.count_down();
+    HPX_TEST_EQ(count.load(), std::size_t(0));
+    HPX_TEST(!l.try_wait());
+
+    // the last count_down continues all waiters
+    l.count_down();
+    HPX_TEST_EQ(count.load(), std::size_t(5));
+    HPX_TEST(l.try_wait());
+
+    // waiting on a released latch completes right away
+    bool called = false;
+    l.wait() | then([&]() { called = true; }) | sync_wait();
+    HPX_TEST(called);
+}
+
+void test_concurrent_count_down()
+{
+    std::size_t const num_tasks = 100;
+    async_latch l(static_cast<std::ptrdiff_t>(num_tasks));
+
+    std::atomic<std::size_t> count(0);
+    std::vector<hpx::future<void>> futures;
+    for (std::size_t i = 0; i != num_tasks; ++i)
+    {
+        futures.push_back(hpx::async([&]() {
+            ++count;
+            l.count_down();
+        }));
+    }
+
+    l.wait() | sync_wait();
+    HPX_TEST_EQ(count.load(), num_tasks);
+
+    hpx::wait_all(futures);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    test_count_down();
+    test_concurrent_count_down();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,111 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/local/execution.hpp>
+#include <hpx/local/future.hpp>
+#include <hpx/local/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/synchronization/async_mutex.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+using hpx::execution::experimental::start_detached;
+using hpx::execution::experimental::then;
+using hpx::execution::experimental::thread_pool_scheduler;
+using hpx::execution::experimental::transfer;
+using hpx::experimental::async_mutex;
+using hpx::this_thread::experimental::sync_wait;
+
+///////////////////////////////////////////////////////////////////////////////
+void test_uncontended()
+{
+    async_mutex mtx;
+
+    bool called = false;
+    mtx.lock() | then([&]() { called = true; }) | sync_wait();
+    HPX_TEST(called);
+
+    HPX_TEST(!mtx.try_lock());
+    mtx.unlock();
+    HPX_TEST(mtx.try_lock());
+    mtx.unlock();
+}
+
+void test_waiters_are_continued_by_unlock()
+{
+    async_mutex mtx;
+    HPX_TEST(mtx.try_lock());
+
+    // the waiters don't block the current thread
+    std::atomic<std::size_t> count(0);
+    for (std::size_t i = 0; i != 3; ++i)
+    {
+        start_detached(mtx.lock() | then([&]() { ++count; }));
+    }
+    HPX_TEST_EQ(count.load(), std::size_t(0));
+
+    // each unlock hands the mutex to the next waiter
+    for (std::size_t i = 1; i <= 3; ++i)
+    {
+        mtx.unlock();
+        HPX_TEST_EQ(count.load(), i);
+        HPX_TEST(!mtx.try_lock());
+    }
+
+    mtx.unlock();
+    HPX_TEST(mtx.try_lock());
+    mtx.unlock();
+}
+
+void test_mutual_exclusion()
+{
+    async_mutex mtx;
+    thread_pool_scheduler sched{};
+
+    std::size_t const num_tasks = 1000;
+
+    // not atomic, protected by the mutex
+    std::size_t count = 0;
+    std::atomic<bool> owned(false);
+
+    std::vector<hpx::future<void>> futures;
+    for (std::size_t i = 0; i != num_tasks; ++i)
+    {
+        futures.push_back(hpx::async([&]() {
+            mtx.lock() | transfer(sched) | then([&]() {
+                HPX_TEST(!owned.exchange(true));
+                ++count;
+                owned.store(false);
+                mtx.unlock();
+            }) | sync_wait();
+        }));
+    }
+    hpx::wait_all(futures);
+
+    HPX_TEST_EQ(count, num_tasks);
+    HPX_TEST(mtx.try_lock());
+    mtx.unlock();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    test_uncontended();
+    test_waiters_are_continued_by_unlock();
+    test_mutual_exclusion();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,104 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/local/execution.hpp>
+#include <hpx/local/future.hpp>
+#include <hpx/local/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/synchronization/async_semaphore.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+using hpx::execution::experimental::start_detached;
+using hpx::execution::experimental::then;
+using hpx::execution::experimental::thread_pool_scheduler;
+using hpx::execution::experimental::transfer;
+using hpx::experimental::async_semaphore;
+using hpx::this_thread::experimental::sync_wait;
+
+///////////////////////////////////////////////////////////////////////////////
+void test_acquire_release()
+{
+    async_semaphore sem(2);
+
+    sem.acquire() | sync_wait();
+    HPX_TEST_EQ(sem.get_value(), std::ptrdiff_t(1));
+    HPX_TEST(sem.try_acquire());
+    HPX_TEST(!sem.try_acquire());
+
+    // the waiters are continued by release, in the order they started
+    std::atomic<std::size_t> count(0);
+    std::vector<std::size_t> order;
+    for (std::size_t i = 0; i != 4; ++i)
+    {
+        start_detached(sem.acquire() | then([&, i]() {
+            order.push_back(i);
+            ++count;
+        }));
+    }
+    HPX_TEST_EQ(count.load(), std::size_t(0));
+
+    sem.release(3);
+    HPX_TEST_EQ(count.load(), std::size_t(3));
+    HPX_TEST_EQ(sem.get_value(), std::ptrdiff_t(0));
+
+    sem.release();
+    HPX_TEST_EQ(count.load(), std::size_t(4));
+    for (std::size_t i = 0; i != order.size(); ++i)
+    {
+        HPX_TEST_EQ(order[i], i);
+    }
+
+    sem.release(2);
+    HPX_TEST_EQ(sem.get_value(), std::ptrdiff_t(2));
+}
+
+void test_concurrency_limit()
+{
+    std::ptrdiff_t const max_concurrency = 3;
+    async_semaphore sem(max_concurrency);
+    thread_pool_scheduler sched{};
+
+    std::atomic<std::ptrdiff_t> active(0);
+    std::atomic<std::size_t> count(0);
+
+    std::size_t const num_tasks = 1000;
+    std::vector<hpx::future<void>> futures;
+    for (std::size_t i = 0; i != num_tasks; ++i)
+    {
+        futures.push_back(hpx::async([&]() {
+            sem.acquire() | transfer(sched) | then([&]() {
+                HPX_TEST_LTE(++active, max_concurrency);
+                ++count;
+                --active;
+                sem.release();
+            }) | sync_wait();
+        }));
+    }
+    hpx::wait_all(futures);
+
+    HPX_TEST_EQ(count.load(), num_tasks);
+    HPX_TEST_EQ(sem.get_value(), max_concurrency);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    test_acquire_release();
+    test_concurrency_limit();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -13,6 +13,7 @@
 #include <hpx/synchronization/channel_mpmc.hpp>
 
 #include <cstddef>
+#include <cstdint>
 #include <functional>
 #include <utility>
 #include <vector>
@@ -48,6 +49,59 @@ int thread_func(int i, hpx::lcos::local::channel_mpmc<int>& channel,
     return channel_get(next);
 }
 
+///////////////////////////////////////////////////////////////////////////////
+constexpr int NUM_PRODUCERS = 32;
+constexpr int NUM_CONSUMERS = 4;
+constexpr int NUM_VALUES = 1000;
+
+// many producers and several consumers share one small channel
+void test_many_producers()
+{
+    hpx::lcos::local::channel_mpmc<int> channel(8);
+
+    std::vector<hpx::future<void>> producers;
+    producers.reserve(NUM_PRODUCERS);
+    for (int i = 0; i != NUM_PRODUCERS; ++i)
+    {
+        producers.push_back(hpx::async([&channel]() {
+            for (int j = 1; j <= NUM_VALUES; ++j)
+            {
+                HPX_TEST(channel.set_wait(int(j)));
+            }
+        }));
+    }
+
+    std::vector<hpx::future<std::int64_t>> consumers;
+    consumers.reserve(NUM_CONSUMERS);
+    for (int i = 0; i != NUM_CONSUMERS; ++i)
+    {
+        consumers.push_back(hpx::async([&channel]() {
+            std::int64_t sum = 0;
+            for (int j = 0; j != NUM_PRODUCERS * NUM_VALUES / NUM_CONSUMERS;
+                 ++j)
+            {
+                int value = 0;
+                HPX_TEST(channel.get_wait(&value));
+                sum += value;
+            }
+            return sum;
+        }));
+    }
+
+    hpx::wait_all(producers);
+
+    std::int64_t sum = 0;
+    for (auto& f : consumers)
+    {
+        sum += f.get();
+    }
+    HPX_TEST_EQ(sum,
+        std::int64_t(NUM_PRODUCERS) * NUM_VALUES * (NUM_VALUES + 1) / 2);
+
+    // the channel is empty now
+    HPX_TEST(!channel.get());
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 int hpx_main()
 {
@@ -75,6 +129,8 @@ int hpx_main()
         HPX_TEST_EQ((i + 1) % NUM_WORKERS, workers[i].get());
     }
 
+    test_many_producers();
+
     hpx::local::finalize();
     return hpx::util::report_errors();
 }
@@ -16,6 +16,7 @@
 #include <hpx/synchronization/mutex.hpp>
 #include <hpx/topology/topology.hpp>
 
+#include <atomic>
 #include <chrono>
 #include <cstddef>
 #include <functional>
@@ -432,6 +433,47 @@ void test_notify_all_following_notify_one_wakes_all_threads()
     thread3.join();
 }
 
+// notify_all meets waiting threads which are not suspended: threads which
+// timed out (and are pending or running already) and threads which were
+// queued but didn't suspend yet. All of them have to be woken up or time out.
+void test_notify_all_with_waiters_not_suspended()
+{
+    constexpr int num_threads = 16;
+    constexpr int num_waits = 200;
+
+    hpx::mutex mtx;
+    hpx::condition_variable cond;
+    std::atomic<int> done(0);
+    std::atomic<bool> stop(false);
+
+    hpx::thread notifier([&]() {
+        while (!stop.load())
+        {
+            cond.notify_all();
+            hpx::this_thread::yield();
+        }
+    });
+
+    std::vector<hpx::thread> group;
+    for (int i = 0; i != num_threads; ++i)
+    {
+        group.push_back(hpx::thread([&, i]() {
+            for (int j = 0; j != num_waits; ++j)
+            {
+                std::unique_lock<hpx::mutex> lk(mtx);
+                cond.wait_for(lk, std::chrono::microseconds((i + j) % 50));
+            }
+            ++done;
+        }));
+    }
+
+    join_all(group);
+    stop = true;
+    notifier.join();
+
+    HPX_TEST_EQ(done.load(), num_threads);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 struct condition_test_data
 {
@@ -705,6 +747,7 @@ int hpx_main(variables_map&)
         test_condition_notify_all_wakes_from_wait_until_with_predicate();
         test_condition_notify_all_wakes_from_relative_wait_until_with_predicate();
         test_notify_all_following_notify_one_wakes_all_threads();
+        test_notify_all_with_waiters_not_suspended();
     }
     {
         test_condition_waits();
@@ -0,0 +1,149 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/local/future.hpp>
+#include <hpx/local/init.hpp>
+#include <hpx/lock_registration/detail/lock_contention.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/synchronization/mutex.hpp>
+#include <hpx/synchronization/shared_mutex.hpp>
+#include <hpx/synchronization/spinlock.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <shared_mutex>
+#include <sstream>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+void spin(std::chrono::microseconds duration)
+{
+    auto const end = std::chrono::steady_clock::now() + duration;
+    while (std::chrono::steady_clock::now() < end)
+    {
+    }
+}
+
+template <typename F>
+void contend(std::size_t num_tasks, F&& f)
+{
+    std::vector<hpx::future<void>> futures;
+    futures.reserve(num_tasks);
+    for (std::size_t i = 0; i != num_tasks; ++i)
+    {
+        futures.push_back(hpx::async(f));
+    }
+    hpx::wait_all(futures);
+}
+
+template <typename Mutex>
+void test_lock_contention(char const* description, std::size_t num_tasks)
+{
+    hpx::util::get_lock_contention_site(description, true);
+
+    Mutex mtx(description);
+    std::size_t counter = 0;
+    contend(num_tasks, [&]() {
+        std::lock_guard<Mutex> l(mtx);
+        spin(std::chrono::microseconds(100));
+        ++counter;
+    });
+    HPX_TEST_EQ(counter, num_tasks);
+
+    HPX_TEST(mtx.try_lock());
+    mtx.unlock();
+
+    hpx::util::lock_contention_site const site =
+        hpx::util::get_lock_contention_site(description, true);
+    HPX_TEST_EQ(site.description, std::string(description));
+    HPX_TEST_EQ(site.acquisitions, std::uint64_t(num_tasks + 1));
+    HPX_TEST_LTE(site.contentions, std::uint64_t(num_tasks));
+    HPX_TEST(site.contentions == 0 || site.wait_time != 0);
+
+    // the counts were reset
+    HPX_TEST_EQ(
+        hpx::util::get_lock_contention_site(description).acquisitions,
+        std::uint64_t(0));
+}
+
+void test_shared_mutex(std::size_t num_tasks)
+{
+    hpx::util::get_lock_contention_site("hpx::shared_mutex", true);
+
+    hpx::shared_mutex mtx;
+    contend(num_tasks, [&]() {
+        {
+            std::shared_lock<hpx::shared_mutex> l(mtx);
+            spin(std::chrono::microseconds(10));
+        }
+        std::lock_guard<hpx::shared_mutex> l(mtx);
+        spin(std::chrono::microseconds(10));
+    });
+
+    hpx::util::lock_contention_site const site =
+        hpx::util::get_lock_contention_site("hpx::shared_mutex");
+    HPX_TEST_EQ(site.acquisitions, std::uint64_t(2 * num_tasks));
+}
+
+void test_lock_contention_sites()
+{
+    hpx::spinlock mtx("lock_contention_test_sites");
+    for (int i = 0; i != 10; ++i)
+    {
+        std::lock_guard<hpx::spinlock> l(mtx);
+    }
+
+    // the sites are sorted by decreasing wait time
+    std::vector<hpx::util::lock_contention_site> const sites =
+        hpx::util::get_lock_contention_sites();
+    bool found = false;
+    for (std::size_t i = 0; i != sites.size(); ++i)
+    {
+        if (i != 0)
+        {
+            HPX_TEST_LTE(sites[i].wait_time, sites[i - 1].wait_time);
+        }
+        if (sites[i].description == "lock_contention_test_sites")
+        {
+            HPX_TEST_EQ(sites[i].acquisitions, std::uint64_t(10));
+            found = true;
+        }
+    }
+    HPX_TEST(found);
+
+    HPX_TEST_LTE(hpx::util::get_lock_contention_sites(1).size(), 1u);
+
+    // all locks
+    HPX_TEST_LTE(std::uint64_t(10),
+        hpx::util::get_lock_contention_site("").acquisitions);
+
+    std::ostringstream os;
+    hpx::util::write_lock_contention_sites(os);
+    HPX_TEST_NEQ(
+        os.str().find("lock_contention_test_sites,10,"), std::string::npos);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    test_lock_contention<hpx::spinlock>("lock_contention_test_spinlock", 1000);
+    test_lock_contention<hpx::mutex>("lock_contention_test_mutex", 1000);
+    test_shared_mutex(1000);
+    test_lock_contention_sites();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,127 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file hpx/testing/count_allocations.hpp
+///
+/// Including this header in exactly one translation unit of a benchmark
+/// replaces the global (non-aligned) operator new and operator delete. The
+/// allocations done while the benchmarks are timed are then counted and
+/// added to the reports generated by \a hpx::util::perftests_report.
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/testing/performance.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+
+namespace hpx { namespace util { namespace detail {
+
+    // every thread increments its own counter to avoid contention, threads
+    // share a counter only if there are more of them than counters
+    struct alignas(64) allocation_counter
+    {
+        std::atomic<std::uint64_t> count{0};
+    };
+
+    inline constexpr std::size_t num_allocation_counters = 256;
+    inline allocation_counter allocation_counters[num_allocation_counters];
+    inline std::atomic<std::size_t> next_allocation_counter{0};
+
+    inline std::atomic<std::uint64_t>& get_allocation_counter() noexcept
+    {
+        thread_local std::size_t const index =
+            next_allocation_counter++ % num_allocation_counters;
+        return allocation_counters[index].count;
+    }
+
+    inline std::uint64_t count_allocations() noexcept
+    {
+        std::uint64_t count = 0;
+        for (allocation_counter const& counter : allocation_counters)
+        {
+            count += counter.count.load(std::memory_order_relaxed);
+        }
+        return count;
+    }
+
+    inline void* counted_allocate(std::size_t size) noexcept
+    {
+        get_allocation_counter().fetch_add(1, std::memory_order_relaxed);
+        return std::malloc(size != 0 ? size : 1);
+    }
+
+    struct register_allocation_counter
+    {
+        register_allocation_counter() noexcept
+        {
+            set_allocation_count_function(&count_allocations);
+        }
+    };
+
+    inline register_allocation_counter register_allocation_counter_;
+}}}    // namespace hpx::util::detail
+
+///////////////////////////////////////////////////////////////////////////////
+void* operator new(std::size_t size)
+{
+    void* p = hpx::util::detail::counted_allocate(size);
+    if (p == nullptr)
+        throw std::bad_alloc();
+    return p;
+}
+
+void* operator new[](std::size_t size)
+{
+    void* p = hpx::util::detail::counted_allocate(size);
+    if (p == nullptr)
+        throw std::bad_alloc();
+    return p;
+}
+
+void* operator new(std::size_t size, std::nothrow_t const&) noexcept
+{
+    return hpx::util::detail::counted_allocate(size);
+}
+
+void* operator new[](std::size_t size, std::nothrow_t const&) noexcept
+{
+    return hpx::util::detail::counted_allocate(size);
+}
+
+void operator delete(void* p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete[](void* p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept
+{
+    std::free(p);
+}
+
+void operator delete[](void* p, std::size_t) noexcept
+{
+    std::free(p);
+}
+
+void operator delete(void* p, std::nothrow_t const&) noexcept
+{
+    std::free(p);
+}
+
+void operator delete[](void* p, std::nothrow_t const&) noexcept
+{
+    std::free(p);
+}
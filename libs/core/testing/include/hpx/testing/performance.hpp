@@ -8,8 +8,11 @@
 
 #include <hpx/config.hpp>
 #include <hpx/functional/function.hpp>
+#include <hpx/program_options/options_description.hpp>
+#include <hpx/program_options/variables_map.hpp>
 
 #include <cstddef>
+#include <cstdint>
 #include <map>
 #include <ostream>
 #include <string>
@@ -18,13 +21,45 @@
 
 namespace hpx { namespace util {
 
+    /// Summary statistics of the timings of a benchmark [s], the confidence
+    /// interval is the distribution-free 95% confidence interval of the
+    /// median.
+    struct perftests_statistics
+    {
+        double median = 0.0;
+        double mean = 0.0;
+        double stddev = 0.0;
+        double min = 0.0;
+        double max = 0.0;
+        double p5 = 0.0;
+        double p25 = 0.0;
+        double p75 = 0.0;
+        double p95 = 0.0;
+        double ci_lower = 0.0;
+        double ci_upper = 0.0;
+    };
+
     namespace detail {
 
+        HPX_CORE_EXPORT perftests_statistics compute_statistics(
+            std::vector<double> series);
+
+        // The samples collected for a benchmark
+        struct perftests_result
+        {
+            std::vector<double> series;
+            std::size_t warmup_iterations = 0;
+            bool converged = false;
+
+            // allocations per iteration, negative if they were not counted
+            double allocations = -1.0;
+        };
+
         // Json output for performance reports
         class json_perf_times
         {
             using key_t = std::tuple<std::string, std::string>;
-            using value_t = std::vector<double>;
+            using value_t = perftests_result;
             using map_t = std::map<key_t, value_t>;
 
             map_t m_map;
@@ -36,7 +71,12 @@ namespace hpx { namespace util {
             void add(std::string const& name, std::string const& executor,
                 double time)
             {
-                m_map[key_t(name, executor)].push_back(time);
+                m_map[key_t(name, executor)].series.push_back(time);
+            }
+
+            value_t& get(std::string const& name, std::string const& executor)
+            {
+                return m_map[key_t(name, executor)];
             }
         };
 
@@ -45,12 +85,51 @@ namespace hpx { namespace util {
         // Add time to the map for performance report
         void add_time(std::string const& test_name, std::string const& executor,
             double time);
+
+        // Used by hpx/testing/count_allocations.hpp to make the number of
+        // allocations available to the reports
+        using allocation_count_type = std::uint64_t (*)();
+        HPX_CORE_EXPORT void set_allocation_count_function(
+            allocation_count_type f) noexcept;
     }    // namespace detail
 
-    HPX_CORE_EXPORT void perftests_report(std::string const& name,
-        std::string const& exec, const std::size_t steps,
-        hpx::function<void(void)>&& test);
+    /// Add the command line options controlling the benchmark harness to the
+    /// given options description:
+    ///
+    /// --perftests-min-iterations  minimal number of timed iterations
+    /// --perftests-max-iterations  maximal number of timed iterations
+    ///                             (default: the number of steps given to
+    ///                             \a perftests_report)
+    /// --perftests-ci              stop once the 95% confidence interval of
+    ///                             the median is narrower than this fraction
+    ///                             of the median (0 runs all iterations)
+    /// --perftests-max-warmup      maximal number of warmup iterations
+    /// --perftests-max-time        maximal time spent on a benchmark [s]
+    /// --perftests-output          file the report is written to (default:
+    ///                             standard output)
+    HPX_CORE_EXPORT void perftests_cfg(
+        hpx::program_options::options_description& cmdline);
+
+    /// Configure the benchmark harness from the options added by
+    /// \a perftests_cfg and check whether the machine is set up for
+    /// reproducible measurements (CPU frequency scaling, thread affinity,
+    /// build type). Warnings are printed to std::cerr and added to the
+    /// metadata of the report.
+    HPX_CORE_EXPORT void perftests_init(
+        hpx::program_options::variables_map const& vm,
+        std::string const& test_name = "");
+
+    /// Time the given function. The function is executed until its timings
+    /// are stable (warmup), then at least the configured minimal and at most
+    /// \a steps times, stopping early once the confidence interval of the
+    /// median of the timings reached the configured precision. Returns the
+    /// statistics of the timings measured by this call.
+    HPX_CORE_EXPORT perftests_statistics perftests_report(
+        std::string const& name, std::string const& exec,
+        const std::size_t steps, hpx::function<void(void)>&& test);
 
+    /// Print the timings of all benchmarks and the metadata of the machine
+    /// and of the configuration as JSON.
     HPX_CORE_EXPORT void perftests_print_times();
 
 }}    // namespace hpx::util
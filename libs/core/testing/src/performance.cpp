@@ -4,18 +4,79 @@
 //  Distributed under the Boost Software License, Version 1.0. (See accompanying
 //  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
 
+#include <hpx/config.hpp>
+#include <hpx/config/version.hpp>
+#include <hpx/preprocessor/stringize.hpp>
 #include <hpx/testing/performance.hpp>
 
+#include <algorithm>
 #include <chrono>
+#include <cmath>
 #include <cstddef>
+#include <cstdint>
+#include <fstream>
 #include <iostream>
+#include <numeric>
+#include <set>
+#include <sstream>
 #include <string>
+#include <thread>
 #include <type_traits>
+#include <utility>
+#include <vector>
+
+#if defined(__linux__)
+#include <sched.h>
+#include <sys/utsname.h>
+#include <unistd.h>
+#endif
 
 namespace hpx { namespace util {
 
     namespace detail {
 
+        struct perftests_config
+        {
+            std::size_t min_iterations = 10;
+            std::size_t max_iterations = 0;    // use the given steps
+            double target_ci = 0.01;
+            std::size_t max_warmup = 100;
+            double max_time = 60.0;
+            std::string output;
+        };
+
+        perftests_config& config()
+        {
+            static perftests_config cfg;
+            return cfg;
+        }
+
+        // The properties of the machine and of the configuration the
+        // benchmarks were run with
+        struct perftests_metadata
+        {
+            bool collected = false;
+            std::vector<std::pair<std::string, std::string>> properties;
+            std::vector<std::string> warnings;
+        };
+
+        perftests_metadata& metadata()
+        {
+            static perftests_metadata data;
+            return data;
+        }
+
+        allocation_count_type& allocation_count_function() noexcept
+        {
+            static allocation_count_type f = nullptr;
+            return f;
+        }
+
+        void set_allocation_count_function(allocation_count_type f) noexcept
+        {
+            allocation_count_function() = f;
+        }
+
         json_perf_times& times()
         {
             static json_perf_times res;
@@ -28,6 +89,320 @@ namespace hpx { namespace util {
             times().add(test_name, executor, time);
         }
 
+        ///////////////////////////////////////////////////////////////////////
+        double percentile(std::vector<double> const& sorted, double p)
+        {
+            if (sorted.empty())
+                return 0.0;
+
+            double const pos = p * static_cast<double>(sorted.size() - 1);
+            std::size_t const lower = static_cast<std::size_t>(pos);
+            std::size_t const upper = (std::min)(lower + 1, sorted.size() - 1);
+            double const fraction = pos - static_cast<double>(lower);
+            return sorted[lower] + fraction * (sorted[upper] - sorted[lower]);
+        }
+
+        perftests_statistics compute_statistics(std::vector<double> series)
+        {
+            perftests_statistics stats;
+            if (series.empty())
+                return stats;
+
+            std::sort(series.begin(), series.end());
+
+            std::size_t const n = series.size();
+            stats.min = series.front();
+            stats.max = series.back();
+            stats.median = percentile(series, 0.5);
+            stats.p5 = percentile(series, 0.05);
+            stats.p25 = percentile(series, 0.25);
+            stats.p75 = percentile(series, 0.75);
+            stats.p95 = percentile(series, 0.95);
+
+            stats.mean = std::accumulate(series.begin(), series.end(), 0.0) /
+                static_cast<double>(n);
+            double variance = 0.0;
+            for (double val : series)
+            {
+                variance += (val - stats.mean) * (val - stats.mean);
+            }
+            if (n > 1)
+            {
+                stats.stddev =
+                    std::sqrt(variance / static_cast<double>(n - 1));
+            }
+
+            // the ranks of the order statistics bounding the median with 95%
+            // confidence (normal approximation of the binomial distribution)
+            double const half_width = 1.96 * std::sqrt(static_cast<double>(n));
+            double const lower_rank =
+                std::floor((static_cast<double>(n) - half_width) / 2.0);
+            double const upper_rank =
+                std::ceil((static_cast<double>(n) + half_width) / 2.0) + 1.0;
+
+            std::size_t const lower = lower_rank < 1.0 ?
+                0 :
+                static_cast<std::size_t>(lower_rank) - 1;
+            std::size_t const upper = upper_rank > static_cast<double>(n) ?
+                n - 1 :
+                static_cast<std::size_t>(upper_rank) - 1;
+
+            stats.ci_lower = series[lower];
+            stats.ci_upper = series[upper];
+
+            return stats;
+        }
+
+        // the confidence interval of the median is narrow enough
+        bool has_converged(std::vector<double> const& series, double target)
+        {
+            perftests_statistics const stats = compute_statistics(series);
+            if (stats.median <= 0.0)
+                return true;
+
+            return (stats.ci_upper - stats.ci_lower) / 2.0 <=
+                target * stats.median;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        void add_property(std::string const& key, std::string const& value)
+        {
+            metadata().properties.emplace_back(key, value);
+        }
+
+        void add_warning(std::string const& warning)
+        {
+            std::cerr << "perftests warning: " << warning << "\n";
+            metadata().warnings.push_back(warning);
+        }
+
+#if defined(__linux__)
+        // return the first line of the given file, or an empty string
+        std::string read_line(std::string const& path)
+        {
+            std::ifstream strm(path);
+            std::string line;
+            if (!strm || !std::getline(strm, line))
+                return std::string();
+            return line;
+        }
+
+        void check_cpus()
+        {
+            cpu_set_t cpus;
+            CPU_ZERO(&cpus);
+            if (sched_getaffinity(0, sizeof(cpus), &cpus) != 0)
+                return;
+
+            int const affinity_count = CPU_COUNT(&cpus);
+            add_property("affinity_cpus", std::to_string(affinity_count));
+            if (affinity_count > 1)
+            {
+                add_warning("the benchmark thread is not bound to a single "
+                            "core, the timings may vary between runs (see "
+                            "--hpx:bind)");
+            }
+
+            std::set<std::string> governors;
+            double min_frequency = 0.0;
+            double max_frequency = 0.0;
+            for (int cpu = 0; cpu != CPU_SETSIZE; ++cpu)
+            {
+                if (!CPU_ISSET(cpu, &cpus))
+                    continue;
+
+                std::string const base =
+                    "/sys/devices/system/cpu/cpu" + std::to_string(cpu) +
+                    "/cpufreq/";
+
+                std::string const governor =
+                    read_line(base + "scaling_governor");
+                if (!governor.empty())
+                    governors.insert(governor);
+
+                std::string const frequency =
+                    read_line(base + "scaling_cur_freq");
+                if (!frequency.empty())
+                {
+                    // the frequency is given in kHz
+                    double const mhz = std::stod(frequency) / 1000.0;
+                    if (min_frequency == 0.0 || mhz < min_frequency)
+                        min_frequency = mhz;
+                    if (mhz > max_frequency)
+                        max_frequency = mhz;
+                }
+            }
+
+            if (!governors.empty())
+            {
+                std::string names;
+                for (std::string const& governor : governors)
+                {
+                    if (!names.empty())
+                        names += ",";
+                    names += governor;
+                }
+                add_property("cpu_governor", names);
+
+                if (governors.size() != 1 ||
+                    *governors.begin() != "performance")
+                {
+                    add_warning("the CPU frequency governor is '" + names +
+                        "' instead of 'performance', the CPU frequency may "
+                        "change while the benchmarks are running");
+                }
+            }
+
+            if (max_frequency != 0.0)
+            {
+                add_property(
+                    "cpu_frequency_min_mhz", std::to_string(min_frequency));
+                add_property(
+                    "cpu_frequency_max_mhz", std::to_string(max_frequency));
+            }
+
+            // frequency boosting makes the frequency depend on the load and
+            // on the temperature of the chip
+            std::string const no_turbo =
+                read_line("/sys/devices/system/cpu/intel_pstate/no_turbo");
+            std::string const boost =
+                read_line("/sys/devices/system/cpu/cpufreq/boost");
+            if (no_turbo == "0" || boost == "1")
+            {
+                add_property("cpu_boost", "1");
+                add_warning("CPU frequency boosting is enabled, the timings "
+                            "may depend on the load of the machine");
+            }
+        }
+#endif
+
+        void collect_metadata(std::string const& test_name)
+        {
+            perftests_metadata& data = metadata();
+            if (data.collected)
+                return;
+            data.collected = true;
+
+            if (!test_name.empty())
+                add_property("benchmark", test_name);
+
+            add_property("hpx_version",
+                std::to_string(HPX_VERSION_MAJOR) + "." +
+                    std::to_string(HPX_VERSION_MINOR) + "." +
+                    std::to_string(HPX_VERSION_SUBMINOR) + HPX_VERSION_TAG);
+            add_property("hpx_git_commit", HPX_HAVE_GIT_COMMIT);
+            add_property("build_type", HPX_PP_STRINGIZE(HPX_BUILD_TYPE));
+#if defined(__VERSION__)
+            add_property("compiler", __VERSION__);
+#elif defined(_MSC_FULL_VER)
+            add_property("compiler", "MSVC " HPX_PP_STRINGIZE(_MSC_FULL_VER));
+#endif
+#if defined(HPX_DEBUG)
+            add_warning("HPX was built in debug mode");
+#endif
+
+            add_property("hardware_concurrency",
+                std::to_string(std::thread::hardware_concurrency()));
+
+#if defined(__linux__)
+            char hostname[256] = {0};
+            if (gethostname(hostname, sizeof(hostname) - 1) == 0)
+                add_property("hostname", hostname);
+
+            struct utsname name;
+            if (uname(&name) == 0)
+            {
+                add_property("os",
+                    std::string(name.sysname) + " " +
+                        std::string(name.release));
+                add_property("machine", name.machine);
+            }
+
+            check_cpus();
+#endif
+
+            perftests_config const& cfg = config();
+            add_property("min_iterations", std::to_string(cfg.min_iterations));
+            add_property("max_iterations", std::to_string(cfg.max_iterations));
+            add_property("target_ci", std::to_string(cfg.target_ci));
+            add_property("max_warmup", std::to_string(cfg.max_warmup));
+            add_property("max_time", std::to_string(cfg.max_time));
+            add_property("allocations_counted",
+                allocation_count_function() != nullptr ? "1" : "0");
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        std::string escape(std::string const& str)
+        {
+            std::string result;
+            result.reserve(str.size());
+            for (char c : str)
+            {
+                switch (c)
+                {
+                case '"':
+                    result += "\\\"";
+                    break;
+                case '\\':
+                    result += "\\\\";
+                    break;
+                case '\n':
+                    result += "\\n";
+                    break;
+                case '\t':
+                    result += "\\t";
+                    break;
+                default:
+                    result += c;
+                    break;
+                }
+            }
+            return result;
+        }
+
+        void print_statistics(
+            std::ostream& strm, perftests_statistics const& stats)
+        {
+            strm << "      \"statistics\" : {\n";
+            strm << "        \"median\" : " << stats.median << ",\n";
+            strm << "        \"mean\" : " << stats.mean << ",\n";
+            strm << "        \"stddev\" : " << stats.stddev << ",\n";
+            strm << "        \"min\" : " << stats.min << ",\n";
+            strm << "        \"max\" : " << stats.max << ",\n";
+            strm << "        \"p5\" : " << stats.p5 << ",\n";
+            strm << "        \"p25\" : " << stats.p25 << ",\n";
+            strm << "        \"p75\" : " << stats.p75 << ",\n";
+            strm << "        \"p95\" : " << stats.p95 << ",\n";
+            strm << "        \"ci_lower\" : " << stats.ci_lower << ",\n";
+            strm << "        \"ci_upper\" : " << stats.ci_upper << "\n";
+            strm << "      },\n";
+        }
+
+        void print_metadata(std::ostream& strm)
+        {
+            perftests_metadata const& data = metadata();
+
+            strm << "  \"metadata\" : {";
+            for (auto&& property : data.properties)
+            {
+                strm << "\n    \"" << escape(property.first) << "\" : \""
+                     << escape(property.second) << "\",";
+            }
+            strm << "\n    \"warnings\" : [";
+            int warnings = 0;
+            for (auto&& warning : data.warnings)
+            {
+                if (warnings)
+                    strm << ",";
+                strm << "\n      \"" << escape(warning) << "\"";
+                ++warnings;
+            }
+            if (warnings)
+                strm << "\n    ";
+            strm << "]\n";
+            strm << "  }\n";
+        }
+
         HPX_CORE_EXPORT std::ostream& operator<<(
             std::ostream& strm, json_perf_times const& obj)
         {
@@ -39,13 +414,26 @@ namespace hpx { namespace util {
                 if (outputs)
                     strm << ",";
                 strm << "\n    {\n";
-                strm << "      \"name\" : \"" << std::get<0>(item.first)
-                     << "\",\n";
-                strm << "      \"executor\" : \"" << std::get<1>(item.first)
+                strm << "      \"name\" : \"" << escape(std::get<0>(item.first))
                      << "\",\n";
+                strm << "      \"executor\" : \""
+                     << escape(std::get<1>(item.first)) << "\",\n";
+
+                perftests_result const& result = item.second;
+                print_statistics(strm, compute_statistics(result.series));
+                strm << "      \"warmup_iterations\" : "
+                     << result.warmup_iterations << ",\n";
+                strm << "      \"converged\" : "
+                     << (result.converged ? "true" : "false") << ",\n";
+                if (result.allocations >= 0.0)
+                {
+                    strm << "      \"allocations\" : " << result.allocations
+                         << ",\n";
+                }
+
                 strm << "      \"series\" : [";
                 int series = 0;
-                for (auto val : item.second)
+                for (auto val : result.series)
                 {
                     if (series)
                         strm << ", ";
@@ -58,37 +446,234 @@ namespace hpx { namespace util {
             }
             if (outputs)
                 strm << "\n  ";
-            strm << "]\n";
+            strm << "],\n";
+            print_metadata(strm);
             strm << "}\n";
             return strm;
         }
-    }    // namespace detail
 
-    void perftests_report(std::string const& name, std::string const& exec,
-        const std::size_t steps, hpx::function<void(void)>&& test)
-    {
-        if (steps == 0)
-            return;
-        // First iteration to cache the data
-        test();
+        ///////////////////////////////////////////////////////////////////////
         using timer = std::chrono::high_resolution_clock;
-        timer::time_point start;
-        for (size_t i = 0; i != steps; ++i)
+
+        double elapsed(timer::time_point start)
+        {
+            // default is in seconds
+            return std::chrono::duration_cast<std::chrono::duration<double>>(
+                timer::now() - start)
+                .count();
+        }
+
+        double time_once(hpx::function<void(void)>& test)
         {
             // For now we don't flush the cache
             //flush_cache();
-            start = timer::now();
+            timer::time_point const start = timer::now();
             test();
-            // default is in seconds
-            auto time =
-                std::chrono::duration_cast<std::chrono::duration<double>>(
-                    timer::now() - start);
-            detail::add_time(name, exec, time.count());
+            return elapsed(start);
+        }
+
+        // Run the test until the median of consecutive windows of iterations
+        // changes by less than the tolerance, returns the number of
+        // iterations run.
+        std::size_t warmup(hpx::function<void(void)>& test,
+            std::size_t max_warmup, timer::time_point start)
+        {
+            constexpr std::size_t window = 5;
+            constexpr double tolerance = 0.05;
+
+            perftests_config const& cfg = config();
+
+            std::vector<double> current;
+            current.reserve(window);
+
+            double previous_median = -1.0;
+            std::size_t iterations = 0;
+            while (iterations != max_warmup)
+            {
+                current.clear();
+                for (std::size_t i = 0;
+                     i != window && iterations != max_warmup; ++i)
+                {
+                    current.push_back(time_once(test));
+                    ++iterations;
+                }
+
+                double const median = compute_statistics(current).median;
+                if (previous_median >= 0.0 &&
+                    std::abs(median - previous_median) <=
+                        tolerance * previous_median)
+                {
+                    break;
+                }
+                previous_median = median;
+
+                if (elapsed(start) > cfg.max_time)
+                    break;
+            }
+            return iterations;
         }
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    void perftests_cfg(hpx::program_options::options_description& cmdline)
+    {
+        using hpx::program_options::value;
+
+        detail::perftests_config const defaults;
+
+        // clang-format off
+        cmdline.add_options()
+            ("perftests-min-iterations",
+             value<std::size_t>()->default_value(defaults.min_iterations),
+             "minimal number of timed iterations of each benchmark")
+            ("perftests-max-iterations",
+             value<std::size_t>()->default_value(defaults.max_iterations),
+             "maximal number of timed iterations of each benchmark (default: "
+             "the number of repetitions given by the benchmark)")
+            ("perftests-ci",
+             value<double>()->default_value(defaults.target_ci),
+             "stop once the half width of the 95% confidence interval of the "
+             "median is smaller than this fraction of the median (0: run all "
+             "iterations)")
+            ("perftests-max-warmup",
+             value<std::size_t>()->default_value(defaults.max_warmup),
+             "maximal number of warmup iterations of each benchmark")
+            ("perftests-max-time",
+             value<double>()->default_value(defaults.max_time),
+             "maximal time spent on each benchmark [s]")
+            ("perftests-output", value<std::string>(),
+             "write the report to the given file instead of the standard "
+             "output")
+            ;
+        // clang-format on
+    }
+
+    void perftests_init(hpx::program_options::variables_map const& vm,
+        std::string const& test_name)
+    {
+        detail::perftests_config& cfg = detail::config();
+
+        if (vm.count("perftests-min-iterations"))
+        {
+            cfg.min_iterations =
+                vm["perftests-min-iterations"].as<std::size_t>();
+        }
+        if (vm.count("perftests-max-iterations"))
+        {
+            cfg.max_iterations =
+                vm["perftests-max-iterations"].as<std::size_t>();
+        }
+        if (vm.count("perftests-ci"))
+        {
+            cfg.target_ci = vm["perftests-ci"].as<double>();
+        }
+        if (vm.count("perftests-max-warmup"))
+        {
+            cfg.max_warmup = vm["perftests-max-warmup"].as<std::size_t>();
+        }
+        if (vm.count("perftests-max-time"))
+        {
+            cfg.max_time = vm["perftests-max-time"].as<double>();
+        }
+        if (vm.count("perftests-output"))
+        {
+            cfg.output = vm["perftests-output"].as<std::string>();
+        }
+
+        detail::collect_metadata(test_name);
+    }
+
+    perftests_statistics perftests_report(std::string const& name,
+        std::string const& exec, const std::size_t steps,
+        hpx::function<void(void)>&& test)
+    {
+        if (steps == 0)
+            return perftests_statistics();
+
+        detail::collect_metadata("");
+
+        detail::perftests_config const& cfg = detail::config();
+        std::size_t const max_iterations =
+            cfg.max_iterations != 0 ? cfg.max_iterations : steps;
+        std::size_t const min_iterations =
+            (std::min)(cfg.min_iterations, max_iterations);
+
+        detail::perftests_result& result = detail::times().get(name, exec);
+
+        detail::timer::time_point const start = detail::timer::now();
+        // a benchmark is not warmed up for longer than it is timed
+        result.warmup_iterations += detail::warmup(
+            test, (std::min)(cfg.max_warmup, max_iterations), start);
+
+        detail::allocation_count_type const count_allocations =
+            detail::allocation_count_function();
+        std::uint64_t allocations = 0;
+
+        std::vector<double> series;
+        series.reserve(max_iterations);
+
+        bool converged = false;
+        std::size_t next_check = min_iterations;
+        while (series.size() != max_iterations)
+        {
+            std::uint64_t const before =
+                count_allocations ? count_allocations() : 0;
+
+            series.push_back(detail::time_once(test));
+
+            if (count_allocations)
+                allocations += count_allocations() - before;
+
+            // checking for convergence requires sorting the samples, do it
+            // less often the more samples there are
+            if (cfg.target_ci > 0.0 && series.size() >= next_check)
+            {
+                if (detail::has_converged(series, cfg.target_ci))
+                {
+                    converged = true;
+                    break;
+                }
+                next_check += (std::max)(
+                    std::size_t(1), series.size() / std::size_t(10));
+            }
+
+            if (series.size() >= min_iterations &&
+                detail::elapsed(start) > cfg.max_time)
+            {
+                break;
+            }
+        }
+
+        result.converged = converged;
+        if (count_allocations)
+        {
+            result.allocations = static_cast<double>(allocations) /
+                static_cast<double>(series.size());
+        }
+        result.series.insert(result.series.end(), series.begin(), series.end());
+
+        return detail::compute_statistics(HPX_MOVE(series));
     }
 
     void perftests_print_times()
     {
-        std::cout << detail::times();
+        detail::collect_metadata("");
+
+        std::string const& output = detail::config().output;
+        if (output.empty())
+        {
+            std::cout << detail::times();
+            return;
+        }
+
+        std::ofstream strm(output);
+        if (!strm)
+        {
+            std::cerr << "perftests: could not open " << output
+                      << ", printing the report to the standard output\n";
+            std::cout << detail::times();
+            return;
+        }
+        strm << detail::times();
     }
 }}    // namespace hpx::util
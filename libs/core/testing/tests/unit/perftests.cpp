@@ -0,0 +1,90 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/modules/program_options.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/testing/count_allocations.hpp>
+
+#include <cstddef>
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+void test_statistics()
+{
+    std::vector<double> series;
+    for (int i = 100; i != 0; --i)
+    {
+        series.push_back(static_cast<double>(i));
+    }
+
+    hpx::util::perftests_statistics const stats =
+        hpx::util::detail::compute_statistics(series);
+
+    HPX_TEST_EQ(stats.min, 1.0);
+    HPX_TEST_EQ(stats.max, 100.0);
+    HPX_TEST_EQ(stats.median, 50.5);
+    HPX_TEST_EQ(stats.mean, 50.5);
+    HPX_TEST_EQ(stats.p25, 25.75);
+    HPX_TEST_EQ(stats.p75, 75.25);
+
+    // the 40th and the 61st smallest samples bound the median of 100 samples
+    HPX_TEST_EQ(stats.ci_lower, 40.0);
+    HPX_TEST_EQ(stats.ci_upper, 61.0);
+}
+
+int main()
+{
+    test_statistics();
+
+    std::string const output = "perftests_test.json";
+
+    hpx::program_options::options_description desc;
+    hpx::util::perftests_cfg(desc);
+
+    std::vector<std::string> const args = {"--perftests-min-iterations=5",
+        "--perftests-max-warmup=20", "--perftests-output=" + output};
+
+    hpx::program_options::variables_map vm;
+    hpx::program_options::store(
+        hpx::program_options::command_line_parser(args).options(desc).run(),
+        vm);
+    hpx::program_options::notify(vm);
+
+    hpx::util::perftests_init(vm, "perftests_test");
+
+    // every iteration allocates once
+    std::vector<std::unique_ptr<int>> data;
+    data.reserve(1000);
+    hpx::util::perftests_report("allocate", "none", 100,
+        [&]() { data.push_back(std::make_unique<int>(42)); });
+
+    hpx::util::perftests_print_times();
+
+    std::ifstream strm(output);
+    HPX_TEST(strm.is_open());
+
+    std::stringstream report;
+    report << strm.rdbuf();
+    std::string const json = report.str();
+
+    HPX_TEST_NEQ(json.find("\"name\" : \"allocate\""), std::string::npos);
+    HPX_TEST_NEQ(json.find("\"median\""), std::string::npos);
+    HPX_TEST_NEQ(json.find("\"allocations\" : 1,"), std::string::npos);
+    HPX_TEST_NEQ(
+        json.find("\"benchmark\" : \"perftests_test\""), std::string::npos);
+    HPX_TEST_NEQ(json.find("\"warnings\""), std::string::npos);
+
+    HPX_TEST_LTE(data.size(), std::size_t(120));
+
+    strm.close();
+    std::remove(output.c_str());
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,117 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/threading_base/thread_pool_base.hpp>
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <thread>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx { namespace threads {
+    /// Parameters controlling how an \a elastic_thread_pool adapts the number
+    /// of active processing units of a thread pool to its load.
+    struct elasticity_parameters
+    {
+        /// The number of processing units which are never suspended.
+        std::size_t min_processing_units = 1;
+
+        /// The maximum number of processing units to run on. Processing units
+        /// beyond this number are suspended right away.
+        std::size_t max_processing_units = std::size_t(-1);
+
+        /// The time between two samples of the load of the thread pool. If
+        /// this is zero the load is sampled only when
+        /// \a elastic_thread_pool::adjust is called.
+        std::chrono::steady_clock::duration interval =
+            std::chrono::milliseconds(10);
+
+        /// A processing unit is resumed whenever more than this number of
+        /// tasks per active processing unit are queued.
+        std::size_t grow_threshold = 2;
+
+        /// A processing unit is suspended once some of the active processing
+        /// units have been idle with no tasks queued for this number of
+        /// consecutive samples.
+        std::size_t shrink_delay = 10;
+    };
+
+    /// Grows and shrinks the set of processing units a thread pool runs on
+    /// with its load, leaving the cores it doesn't need to other thread pools
+    /// or processes. The load is sampled periodically from a separate OS
+    /// thread, one processing unit at a time is resumed or suspended using
+    /// \a thread_pool_base::resume_processing_unit_direct and
+    /// \a thread_pool_base::suspend_processing_unit_direct. Processing units
+    /// are suspended starting from the highest index.
+    ///
+    /// \note Requires that the pool has threads::policies::enable_elasticity
+    ///       set. All processing units are resumed when the object is
+    ///       stopped or destroyed, which has to happen before the runtime is
+    ///       stopped.
+    class HPX_CORE_EXPORT elastic_thread_pool
+    {
+    public:
+        /// Start adapting the number of processing units of the given pool.
+        ///
+        /// \param pool   [in] The thread pool to grow and shrink.
+        /// \param params [in] The parameters controlling the adaption.
+        /// \param ec     [in,out] this represents the error status on exit, if
+        ///               this is pre-initialized to \a hpx#throws the function
+        ///               will throw on error instead.
+        explicit elastic_thread_pool(thread_pool_base& pool,
+            elasticity_parameters const& params = elasticity_parameters(),
+            error_code& ec = throws);
+
+        ~elastic_thread_pool();
+
+        elastic_thread_pool(elastic_thread_pool const&) = delete;
+        elastic_thread_pool& operator=(elastic_thread_pool const&) = delete;
+
+        /// Stop adapting the number of processing units and resume all
+        /// processing units of the pool.
+        void stop();
+
+        /// Sample the load of the thread pool once and resume or suspend at
+        /// most one processing unit accordingly.
+        ///
+        /// \note Must not be called from an HPX thread running on the pool
+        ///       itself.
+        ///
+        /// \returns The change of the number of active processing units (-1,
+        ///          0, or 1).
+        int adjust(error_code& ec = throws);
+
+        /// Return the number of processing units the pool currently runs on.
+        std::size_t get_active_processing_units() const;
+
+    private:
+        void run();
+
+        thread_pool_base& pool_;
+        elasticity_parameters params_;
+        std::size_t num_threads_;
+
+        // the processing units [0, active_) are running, the others are
+        // suspended
+        mutable std::mutex adjust_mtx_;
+        std::size_t active_;
+        std::size_t idle_samples_;
+
+        std::mutex mtx_;
+        std::condition_variable cond_;
+        bool stopped_;
+        std::thread thread_;
+    };
+}}    // namespace hpx::threads
+
+#include <hpx/config/warnings_suffix.hpp>
@@ -0,0 +1,182 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/thread_pool_util/thread_pool_elasticity.hpp>
+#include <hpx/threading_base/scheduler_base.hpp>
+#include <hpx/threading_base/scheduler_mode.hpp>
+#include <hpx/threading_base/thread_pool_base.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+
+namespace hpx { namespace threads {
+    elastic_thread_pool::elastic_thread_pool(thread_pool_base& pool,
+        elasticity_parameters const& params, error_code& ec)
+      : pool_(pool)
+      , params_(params)
+      , num_threads_(pool.get_os_thread_count())
+      , active_(num_threads_)
+      , idle_samples_(0)
+      , stopped_(true)
+    {
+        if (!pool_.get_scheduler()->has_scheduler_mode(
+                policies::scheduler_mode::enable_elasticity))
+        {
+            HPX_THROWS_IF(ec, invalid_status,
+                "elastic_thread_pool::elastic_thread_pool",
+                "this thread pool does not support suspending "
+                "processing units");
+            return;
+        }
+
+        params_.max_processing_units =
+            (std::min)(params_.max_processing_units, num_threads_);
+        params_.min_processing_units = (std::max)(std::size_t(1),
+            (std::min)(
+                params_.min_processing_units, params_.max_processing_units));
+
+        {
+            std::lock_guard<std::mutex> l(adjust_mtx_);
+            while (active_ > params_.max_processing_units)
+            {
+                pool_.suspend_processing_unit_direct(active_ - 1, ec);
+                if (ec)
+                {
+                    return;
+                }
+                --active_;
+            }
+        }
+
+        stopped_ = false;
+        if (params_.interval != std::chrono::steady_clock::duration::zero())
+        {
+            thread_ = std::thread([this]() { run(); });
+        }
+
+        if (&ec != &throws)
+        {
+            ec = make_success_code();
+        }
+    }
+
+    elastic_thread_pool::~elastic_thread_pool()
+    {
+        stop();
+    }
+
+    void elastic_thread_pool::stop()
+    {
+        {
+            std::lock_guard<std::mutex> l(mtx_);
+            stopped_ = true;
+        }
+        cond_.notify_all();
+
+        if (thread_.joinable())
+        {
+            thread_.join();
+        }
+
+        // don't leave any processing units suspended, this fails only if
+        // the pool has been stopped already
+        std::lock_guard<std::mutex> l(adjust_mtx_);
+        while (active_ != num_threads_)
+        {
+            error_code ec(throwmode::lightweight);
+            pool_.resume_processing_unit_direct(active_, ec);
+            if (ec)
+            {
+                break;
+            }
+            ++active_;
+        }
+        idle_samples_ = 0;
+    }
+
+    int elastic_thread_pool::adjust(error_code& ec)
+    {
+        std::lock_guard<std::mutex> l(adjust_mtx_);
+
+        if (&ec != &throws)
+        {
+            ec = make_success_code();
+        }
+
+        std::int64_t const queued =
+            pool_.get_queue_length(std::size_t(-1), false);
+
+        // suspended processing units are counted as idle as well
+        std::int64_t const idle = pool_.get_idle_core_count() -
+            std::int64_t(num_threads_ - active_);
+
+        if (active_ < params_.max_processing_units &&
+            queued > std::int64_t(params_.grow_threshold * active_))
+        {
+            idle_samples_ = 0;
+            pool_.resume_processing_unit_direct(active_, ec);
+            if (ec)
+            {
+                return 0;
+            }
+            ++active_;
+            return 1;
+        }
+
+        if (queued != 0 || idle <= 0)
+        {
+            idle_samples_ = 0;
+            return 0;
+        }
+
+        if (++idle_samples_ < params_.shrink_delay ||
+            active_ <= params_.min_processing_units)
+        {
+            return 0;
+        }
+
+        idle_samples_ = 0;
+        pool_.suspend_processing_unit_direct(active_ - 1, ec);
+        if (ec)
+        {
+            return 0;
+        }
+        --active_;
+        return -1;
+    }
+
+    std::size_t elastic_thread_pool::get_active_processing_units() const
+    {
+        std::lock_guard<std::mutex> l(adjust_mtx_);
+        return active_;
+    }
+
+    void elastic_thread_pool::run()
+    {
+        std::unique_lock<std::mutex> l(mtx_);
+        while (!cond_.wait_for(
+            l, params_.interval, [this]() { return stopped_; }))
+        {
+            l.unlock();
+
+            error_code ec(throwmode::lightweight);
+            adjust(ec);
+            if (ec)
+            {
+                // the pool is shutting down
+                return;
+            }
+
+            l.lock();
+        }
+    }
+}}    // namespace hpx::threads
@@ -77,6 +77,9 @@ namespace hpx { namespace threads { namespace detail {
         thread_id_ref_type create_work(
             thread_init_data& data, error_code& ec) override;
 
+        void create_work_n(thread_init_data* data, std::size_t count,
+            error_code& ec) override;
+
         thread_state set_state(thread_id_type const& id,
             thread_schedule_state new_state, thread_restart_state new_state_ex,
             thread_priority priority, error_code& ec) override;
@@ -218,6 +221,12 @@ namespace hpx { namespace threads { namespace detail {
         {
             return sched_->Scheduler::get_num_stolen_to_staged(num, reset);
         }
+
+        std::int64_t get_average_steal_batch_size(
+            std::size_t num, bool reset) override
+        {
+            return sched_->Scheduler::get_average_steal_batch_size(num, reset);
+        }
 #endif
         std::int64_t get_queue_length(
             std::size_t num_thread, bool /* reset */) override
@@ -8,13 +8,17 @@
 
 #include <hpx/config.hpp>
 #include <hpx/assert.hpp>
+#include <hpx/concurrency/epoch_reclamation.hpp>
 #include <hpx/execution_base/this_thread.hpp>
 #include <hpx/functional/move_only_function.hpp>
 #include <hpx/hardware/timestamp.hpp>
 #include <hpx/modules/itt_notify.hpp>
 #include <hpx/modules/logging.hpp>
+#include <hpx/threading_base/sampling_profiler.hpp>
 #include <hpx/threading_base/scheduler_base.hpp>
 #include <hpx/threading_base/scheduler_state.hpp>
+#include <hpx/threading_base/task_profiles.hpp>
+#include <hpx/threading_base/task_trace.hpp>
 #include <hpx/threading_base/thread_data.hpp>
 
 #if defined(HPX_HAVE_BACKGROUND_THREAD_COUNTERS) &&                            \
@@ -571,6 +575,102 @@ namespace hpx { namespace threads { namespace detail {
         return true;
     }
 
+    // Run one pending thread of the scheduler the calling worker thread lends
+    // itself to. The thread stays owned by its own scheduler, which is why it
+    // is rescheduled there if it doesn't terminate. Returns false if there
+    // was nothing to run.
+    inline bool execute_lent_thread(policies::scheduler_base& owner,
+        hpx::execution_base::this_thread::detail::agent_storage*
+            context_storage)
+    {
+        thread_id_ref_type thrd;
+        if (!owner.lend_thread(thrd))
+        {
+            return false;
+        }
+
+        auto* thrdptr = get_thread_id_data(thrd);
+        HPX_ASSERT(thrdptr->get_scheduler_base() == &owner);
+
+        thread_state state = thrdptr->get_state();
+        thread_schedule_state state_val = state.state();
+        if (state_val == thread_schedule_state::active)
+        {
+            // give the thread back, its state has not been reset yet
+            owner.schedule_thread(HPX_MOVE(thrd), thread_schedule_hint(), true,
+                thrdptr->get_priority());
+            owner.do_some_work(std::size_t(-1));
+            return true;
+        }
+        else if (state_val != thread_schedule_state::pending)
+        {
+            return true;
+        }
+
+        thread_id_ref_type next_thrd;
+        {
+            detail::switch_status thrd_stat(thrd, state);
+            if (!thrd_stat.is_valid() ||
+                thrd_stat.get_previous() != thread_schedule_state::pending)
+            {
+                // some other worker-thread got in between
+                thrd_stat.disable_restore();
+                return true;
+            }
+
+            detail::trace_task_event(task_trace_event::begin, thrdptr);
+            detail::profile_task_begin(thrdptr);
+            detail::sample_task_begin(thrdptr);
+
+            thrd_stat = (*thrdptr)(context_storage);
+
+            bool const terminated =
+                thrd_stat.get_previous() == thread_schedule_state::terminated;
+            detail::trace_task_event(terminated ? task_trace_event::end :
+                                                  task_trace_event::suspend,
+                thrdptr);
+            detail::profile_task_end(thrdptr, terminated);
+            detail::sample_task_end();
+
+            if (!thrd_stat.store_state(state))
+            {
+                return true;
+            }
+
+            state_val = state.state();
+            next_thrd = thrd_stat.move_next_thread();
+        }
+
+        if (next_thrd)
+        {
+            // let the owner of the thread to switch to run it
+            auto* nextptr = get_thread_id_data(next_thrd);
+            policies::scheduler_base* next_owner =
+                nextptr->get_scheduler_base();
+            next_owner->schedule_thread(HPX_MOVE(next_thrd),
+                thread_schedule_hint(), true, nextptr->get_priority());
+            next_owner->do_some_work(std::size_t(-1));
+        }
+
+        if (state_val == thread_schedule_state::pending)
+        {
+            owner.schedule_thread_last(
+                HPX_MOVE(thrd), thread_schedule_hint(), true);
+            owner.do_some_work(std::size_t(-1));
+        }
+        else if (state_val == thread_schedule_state::pending_boost)
+        {
+            thrdptr->set_state(thread_schedule_state::pending);
+            owner.schedule_thread(HPX_MOVE(thrd), thread_schedule_hint(), true,
+                thread_priority::boost);
+            owner.do_some_work(std::size_t(-1));
+        }
+
+        // terminated threads are deleted by their scheduler once the last
+        // reference goes away
+        return true;
+    }
+
     template <typename SchedulingPolicy>
     void scheduling_loop(std::size_t num_thread, SchedulingPolicy& scheduler,
         scheduling_counters& counters, scheduling_callbacks& params)
@@ -623,6 +723,13 @@ namespace hpx { namespace threads { namespace detail {
         thread_id_ref_type next_thrd;
         while (true)
         {
+            // the scheduling loop doesn't hold any references into lock-free
+            // data structures in between running HPX threads
+            hpx::util::epoch_quiescent_state();
+
+            // wake up the threads whose timers have expired
+            scheduler.SchedulingPolicy::process_timers(num_thread);
+
             thread_id_ref_type thrd = HPX_MOVE(next_thrd);
 
             // Get the next HPX thread from the queue
@@ -705,6 +812,11 @@ namespace hpx { namespace threads { namespace detail {
                                 exec_time_wrapper exec_time_collector(
                                     idle_rate);
 
+                                detail::trace_task_event(
+                                    task_trace_event::begin, thrdptr);
+                                detail::profile_task_begin(thrdptr);
+                                detail::sample_task_begin(thrdptr);
+
 #if defined(HPX_HAVE_APEX)
                                 // get the APEX data pointer, in case we are resuming the
                                 // thread and have to restore any leaf timers from
@@ -731,6 +843,16 @@ namespace hpx { namespace threads { namespace detail {
 #else
                                 thrd_stat = (*thrdptr)(context_storage);
 #endif
+
+                                bool const terminated =
+                                    thrd_stat.get_previous() ==
+                                    thread_schedule_state::terminated;
+                                detail::trace_task_event(terminated ?
+                                        task_trace_event::end :
+                                        task_trace_event::suspend,
+                                    thrdptr);
+                                detail::profile_task_end(thrdptr, terminated);
+                                detail::sample_task_end();
                             }
 
                             detail::write_state_log(scheduler, num_thread, thrd,
@@ -883,6 +1005,19 @@ namespace hpx { namespace threads { namespace detail {
             {
                 ++idle_loop_count;
 
+                // once there has been nothing to do for a while, run the
+                // work of the pool we lend our worker threads to
+                policies::scheduler_base* lending_target =
+                    scheduler.get_lending_target();
+                if (lending_target != nullptr && running &&
+                    idle_loop_count > params.max_idle_loop_count_ / 2 &&
+                    execute_lent_thread(*lending_target, context_storage))
+                {
+                    idle_loop_count = 0;
+                    may_exit = false;
+                    continue;
+                }
+
                 if (scheduler.SchedulingPolicy::wait_or_add_new(num_thread,
                         running, idle_loop_count, enable_stealing_staged,
                         added))
@@ -898,6 +1033,9 @@ namespace hpx { namespace threads { namespace detail {
                     {
                         if (can_exit)
                         {
+                            // don't hold back the memory reclamation while
+                            // being suspended
+                            hpx::util::epoch_thread_offline();
                             scheduler.SchedulingPolicy::suspend(num_thread);
                         }
                     }
@@ -1047,9 +1185,11 @@ namespace hpx { namespace threads { namespace detail {
                 if (idle_loop_count > params.max_idle_loop_count_)
                     idle_loop_count = 0;
 
-                // call back into invoking context
+                // call back into invoking context, this may put the worker
+                // thread to sleep
                 if (!params.outer_.empty())
                 {
+                    hpx::util::epoch_thread_offline();
                     params.outer_();
                     context_storage = hpx::execution_base::this_thread::detail::
                         get_agent_storage();
@@ -1105,6 +1245,8 @@ namespace hpx { namespace threads { namespace detail {
                 }
             }
         }
+
+        hpx::util::epoch_thread_offline();
     }
 }}}    // namespace hpx::threads::detail
 
@@ -0,0 +1,81 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file hpx/threading_base/allocation_profiling.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_ALLOCATION_PROFILING)
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace hpx { namespace threads {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The allocation profiling counts the memory allocated through the global
+    // operator new by every OS thread. If HPX_WITH_ALLOCATION_PROFILING is
+    // ON, the core library replaces the global operator new and delete, the
+    // memory is still allocated with std::malloc, i.e. by the allocator
+    // selected by HPX_WITH_MALLOC. The allocations of the HPX threads are
+    // accumulated into the task profiles of their annotation as well (see
+    // task_profiles.hpp).
+    //
+    // Counting costs a relaxed load per allocation while the profiling is
+    // disabled. The deallocations are not counted.
+    struct allocation_counts
+    {
+        std::uint64_t count = 0;
+        std::uint64_t bytes = 0;
+    };
+
+    /// The call stack of a large allocation
+    struct allocation_backtrace
+    {
+        std::size_t size = 0;
+        std::string annotation;    // of the allocating HPX thread, if any
+        std::string backtrace;
+    };
+
+    /// Start or stop counting the allocations
+    HPX_CORE_EXPORT void enable_allocation_profiling(
+        bool enable = true) noexcept;
+
+    /// Returns whether the allocations are being counted
+    HPX_CORE_EXPORT bool is_allocation_profiling_enabled() noexcept;
+
+    /// Returns the allocations made by the worker thread with the given
+    /// global number, by all OS threads (including the ones not managed by
+    /// HPX) if \a global_thread_num is std::size_t(-1)
+    HPX_CORE_EXPORT allocation_counts get_allocation_counts(
+        std::size_t global_thread_num = std::size_t(-1), bool reset = false);
+
+    /// Record the call stack of all allocations of at least \a size bytes
+    /// while the profiling is enabled, 0 disables the call stacks (the
+    /// default). Only the most recent 256 call stacks are kept.
+    HPX_CORE_EXPORT void set_allocation_backtrace_threshold(
+        std::size_t size) noexcept;
+
+    /// Returns the recorded call stacks of the large allocations, oldest
+    /// first
+    HPX_CORE_EXPORT std::vector<allocation_backtrace> get_allocation_backtraces(
+        bool reset = false);
+
+    namespace detail {
+        HPX_CORE_EXPORT extern std::atomic<bool> allocation_profiling_enabled;
+
+        // Returns the allocations made by the calling OS thread since it
+        // was first seen allocating, never reset
+        HPX_CORE_EXPORT allocation_counts
+        get_thread_allocation_counts() noexcept;
+    }    // namespace detail
+}}       // namespace hpx::threads
+
+#endif
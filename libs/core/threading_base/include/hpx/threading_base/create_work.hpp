@@ -11,9 +11,18 @@
 #include <hpx/threading_base/thread_init_data.hpp>
 #include <hpx/threading_base/threading_base_fwd.hpp>
 
+#include <cstddef>
+
 namespace hpx { namespace threads { namespace detail {
 
     HPX_CORE_EXPORT thread_id_ref_type create_work(
         policies::scheduler_base* scheduler, threads::thread_init_data& data,
         error_code& ec = throws);
+
+    // Create the work items data[0], ..., data[count - 1] using a single call
+    // into the scheduler and notify the scheduler about the new work once.
+    // All work items must have the initial state 'pending'.
+    HPX_CORE_EXPORT void create_work_n(policies::scheduler_base* scheduler,
+        threads::thread_init_data* data, std::size_t count,
+        error_code& ec = throws);
 }}}    // namespace hpx::threads::detail
@@ -0,0 +1,158 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/thread_support/spinlock.hpp>
+#include <hpx/threading_base/thread_data.hpp>
+#include <hpx/threading_base/threading_base_fwd.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx { namespace threads { namespace detail {
+
+    class timer_wheel;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // A state change of a (suspended) thread which is due at a given point in
+    // time. Entries are linked into the timer wheel of a worker thread, which
+    // performs the state change from its scheduling loop once the entry
+    // expired.
+    struct timer_wheel_entry
+    {
+        timer_wheel_entry(thread_id_ref_type thrd,
+            std::chrono::steady_clock::time_point const& abs_time,
+            thread_schedule_state newstate = thread_schedule_state::pending,
+            thread_restart_state newstate_ex = thread_restart_state::timeout,
+            thread_priority priority = thread_priority::boost,
+            bool delete_on_expiry = false) noexcept
+          : thrd_(HPX_MOVE(thrd))
+          , abs_time_(abs_time)
+          , newstate_(newstate)
+          , newstate_ex_(newstate_ex)
+          , priority_(priority)
+          , delete_on_expiry_(delete_on_expiry)
+        {
+        }
+
+        timer_wheel_entry(timer_wheel_entry const&) = delete;
+        timer_wheel_entry& operator=(timer_wheel_entry const&) = delete;
+
+        // Return whether the state change has been performed
+        bool expired() const noexcept
+        {
+            return expired_.load(std::memory_order_acquire);
+        }
+
+        timer_wheel_entry* prev_ = nullptr;
+        timer_wheel_entry* next_ = nullptr;
+        timer_wheel* wheel_ = nullptr;
+        std::uint64_t tick_ = 0;
+        std::size_t level_ = 0;
+        std::size_t slot_ = 0;
+        bool linked_ = false;
+
+        thread_id_ref_type thrd_;
+        std::chrono::steady_clock::time_point abs_time_;
+        thread_schedule_state newstate_;
+        thread_restart_state newstate_ex_;
+        thread_priority priority_;
+
+        // heap allocated entries which can't be canceled are owned (and
+        // deleted) by the timer wheel
+        bool delete_on_expiry_;
+        std::atomic<bool> expired_{false};
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // A hierarchical timing wheel with insertion and cancellation in constant
+    // time. Each level has 256 slots, a slot of the lowest level covers one
+    // tick of 2^16 nanoseconds. An entry is stored at the lowest level at
+    // which its expiry tick shares all higher bits with the current tick and
+    // is moved down a level whenever the wheel below wraps around.
+    class timer_wheel
+    {
+    public:
+        static constexpr std::size_t slot_bits = 8;
+        static constexpr std::size_t num_slots = std::size_t(1) << slot_bits;
+        static constexpr std::size_t num_levels = 4;
+        static constexpr std::size_t tick_bits = 16;
+
+        HPX_CORE_EXPORT timer_wheel();
+        HPX_CORE_EXPORT ~timer_wheel();
+
+        timer_wheel(timer_wheel const&) = delete;
+        timer_wheel& operator=(timer_wheel const&) = delete;
+
+        // Add the given entry, it will be returned by expire once its time
+        // has been reached
+        HPX_CORE_EXPORT void insert(timer_wheel_entry& entry);
+
+        // Remove the given entry, returns false if it has expired already
+        HPX_CORE_EXPORT bool cancel(timer_wheel_entry& entry);
+
+        // Remove all entries which have expired at the given time and return
+        // them as a list linked through timer_wheel_entry::next_
+        HPX_CORE_EXPORT timer_wheel_entry* expire(
+            std::chrono::steady_clock::time_point const& now);
+
+        // Return a point in time at which the wheel has to be processed
+        // next (no later than the earliest expiry)
+        HPX_CORE_EXPORT std::chrono::steady_clock::time_point
+        next_expiry() const;
+
+        bool empty() const noexcept
+        {
+            return size_.load(std::memory_order_relaxed) == 0;
+        }
+
+        // Return whether expire could return any entries at the given time
+        bool is_due(std::chrono::steady_clock::time_point const& now)
+            const noexcept
+        {
+            return !empty() &&
+                to_tick(now) >= current_.load(std::memory_order_relaxed);
+        }
+
+        // Return the last tick starting at or before the given time
+        static std::uint64_t to_tick(
+            std::chrono::steady_clock::time_point const& t) noexcept
+        {
+            std::int64_t const ns =
+                std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    t.time_since_epoch())
+                    .count();
+            return ns <= 0 ? 0 : std::uint64_t(ns) >> tick_bits;
+        }
+
+    private:
+        void link(timer_wheel_entry& entry) noexcept;
+        void unlink(timer_wheel_entry& entry) noexcept;
+        void cascade(std::size_t level) noexcept;
+
+        mutable hpx::util::detail::spinlock mtx_;
+
+        // the next tick to process
+        std::atomic<std::uint64_t> current_;
+        std::atomic<std::size_t> size_{0};
+
+        std::size_t counts_[num_levels] = {};
+        timer_wheel_entry* slots_[num_levels][num_slots] = {};
+    };
+
+    // Cancel the given entry and wait for its state change to finish if it
+    // has expired already. This has to be called by the thread waiting for
+    // the timer before the entry goes out of scope.
+    HPX_CORE_EXPORT void cancel_timer(timer_wheel_entry& entry);
+}}}    // namespace hpx::threads::detail
+
+#include <hpx/config/warnings_suffix.hpp>
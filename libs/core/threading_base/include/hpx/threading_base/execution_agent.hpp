@@ -40,6 +40,11 @@ namespace hpx { namespace threads {
 
         std::string description() const override;
 
+        threads::thread_id get_thread_id() const
+        {
+            return self_.get_thread_id();
+        }
+
         execution_context const& context() const override
         {
             return context_;
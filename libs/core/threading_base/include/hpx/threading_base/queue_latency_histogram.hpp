@@ -0,0 +1,197 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file hpx/threading_base/queue_latency_histogram.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/threading_base/thread_data.hpp>
+#include <hpx/timing/high_resolution_clock.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace hpx { namespace threads {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The queue latencies are the times the HPX threads spend in the queues
+    // of pending threads before a worker picks them up. They are recorded
+    // separately for the threads taken by the worker owning the queue (the
+    // wait time) and for the threads stolen by other workers (the steal
+    // latency). A high wait time with few steals means that there are not
+    // enough workers, a low wait time with a high steal latency points to
+    // tasks too fine-grained to amortize the stealing.
+    //
+    // Recording costs a relaxed load per queue operation while disabled.
+    // Only the threads queued after the recording was enabled are counted.
+    HPX_CORE_EXPORT void set_queue_latency_histograms_enabled(
+        bool enabled) noexcept;
+    HPX_CORE_EXPORT bool get_queue_latency_histograms_enabled() noexcept;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // A histogram of latencies (in nanoseconds) using log-linear buckets:
+    // every power of two range is split into 8 buckets, which bounds the
+    // relative error of the reported percentiles by 12.5%. Recording is
+    // lock-free.
+    class queue_latency_histogram
+    {
+        static constexpr unsigned sub_bucket_half_bits = 3;
+        static constexpr std::size_t sub_bucket_half_count =
+            std::size_t(1) << sub_bucket_half_bits;
+
+    public:
+        static constexpr std::size_t num_buckets =
+            (64 - sub_bucket_half_bits + 1) * sub_bucket_half_count;
+
+        queue_latency_histogram() noexcept
+        {
+            reset();
+        }
+
+        queue_latency_histogram(queue_latency_histogram const&) = delete;
+        queue_latency_histogram& operator=(
+            queue_latency_histogram const&) = delete;
+
+        void record(std::uint64_t value) noexcept
+        {
+            counts_[get_index(value)].fetch_add(1, std::memory_order_relaxed);
+        }
+
+        // adds the bucket counts to the given ones, resizing them to
+        // num_buckets elements if necessary
+        void add_counts(std::vector<std::uint64_t>& counts, bool reset) noexcept
+        {
+            counts.resize(num_buckets);
+            for (std::size_t i = 0; i != num_buckets; ++i)
+            {
+                counts[i] += reset ?
+                    counts_[i].exchange(0, std::memory_order_relaxed) :
+                    counts_[i].load(std::memory_order_relaxed);
+            }
+        }
+
+        void reset() noexcept
+        {
+            for (auto& count : counts_)
+            {
+                count.store(0, std::memory_order_relaxed);
+            }
+        }
+
+        // the highest value which is counted in the bucket with the given
+        // index
+        static std::uint64_t get_bucket_limit(std::size_t index) noexcept
+        {
+            std::size_t shift = 0;
+            std::size_t sub_bucket = index;
+            if (index >= 2 * sub_bucket_half_count)
+            {
+                shift = index / sub_bucket_half_count - 1;
+                sub_bucket = index - shift * sub_bucket_half_count;
+            }
+
+            std::uint64_t const lowest = std::uint64_t(sub_bucket) << shift;
+            return lowest + ((std::uint64_t(1) << shift) - 1);
+        }
+
+        // Returns the value below which the given percentage (0..100) of the
+        // values counted by the given buckets lie, 0 if there are none
+        static std::uint64_t get_percentile(
+            std::vector<std::uint64_t> const& counts, double percentile)
+        {
+            std::uint64_t total = 0;
+            for (std::uint64_t count : counts)
+            {
+                total += count;
+            }
+            if (total == 0)
+            {
+                return 0;
+            }
+
+            percentile = (std::min)((std::max)(percentile, 0.0), 100.0);
+            std::uint64_t const rank = (std::max)(std::uint64_t(1),
+                static_cast<std::uint64_t>(std::ceil(
+                    percentile / 100.0 * static_cast<double>(total))));
+
+            std::uint64_t seen = 0;
+            for (std::size_t i = 0; i != counts.size(); ++i)
+            {
+                seen += counts[i];
+                if (seen >= rank)
+                {
+                    return get_bucket_limit(i);
+                }
+            }
+            return get_bucket_limit(counts.size() - 1);
+        }
+
+    private:
+        static std::size_t get_index(std::uint64_t value) noexcept
+        {
+            unsigned bits = 0;
+#if defined(HPX_GCC_VERSION) || defined(HPX_CLANG_VERSION)
+            bits = value == 0 ? 0 : 64 - __builtin_clzll(value);
+#else
+            for (std::uint64_t v = value; v != 0; v >>= 1)
+            {
+                ++bits;
+            }
+#endif
+            unsigned const shift = bits > sub_bucket_half_bits + 1 ?
+                bits - sub_bucket_half_bits - 1 :
+                0;
+
+            std::size_t const index =
+                shift * sub_bucket_half_count + (value >> shift);
+            HPX_ASSERT(index < num_buckets);
+            return index;
+        }
+
+        std::atomic<std::uint64_t> counts_[num_buckets];
+    };
+
+    namespace detail {
+        // the time the recording was enabled, 0 while disabled
+        HPX_CORE_EXPORT extern std::atomic<std::uint64_t>
+            queue_latency_enabled_since;
+
+        // called when a thread is added to a queue
+        HPX_FORCEINLINE void stamp_queue_latency(thread_data* thrd) noexcept
+        {
+            if (HPX_UNLIKELY(queue_latency_enabled_since.load(
+                                 std::memory_order_relaxed) != 0))
+            {
+                thrd->set_queue_timestamp(
+                    hpx::chrono::high_resolution_clock::now());
+            }
+        }
+
+        // called when a thread is taken from a queue
+        HPX_FORCEINLINE void record_queue_latency(
+            thread_data* thrd, queue_latency_histogram& histogram) noexcept
+        {
+            std::uint64_t const since =
+                queue_latency_enabled_since.load(std::memory_order_relaxed);
+            if (HPX_UNLIKELY(since != 0))
+            {
+                std::uint64_t const timestamp = thrd->get_queue_timestamp();
+                if (timestamp >= since)
+                {
+                    histogram.record(
+                        hpx::chrono::high_resolution_clock::now() - timestamp);
+                }
+                thrd->set_queue_timestamp(0);
+            }
+        }
+    }    // namespace detail
+}}    // namespace hpx::threads
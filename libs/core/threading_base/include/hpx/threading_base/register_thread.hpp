@@ -209,6 +209,37 @@ namespace hpx { namespace threads {
     {
         return register_work(data, detail::get_self_or_default_pool(), ec);
     }
+
+    /// \brief Create new work items using the given data on the given thread
+    ///        pool. All work items are handed to the scheduler of the pool
+    ///        at once, which wakes up its worker threads only once.
+    ///
+    /// \param data       [in] The data to use for creating the work items,
+    ///                   which have to be in the 'pending' state.
+    /// \param count      [in] The number of elements of \a data.
+    /// \param pool       [in] The thread pool to use for launching the work.
+    /// \param ec         [in,out] This represents the error status on exit,
+    ///                   if this is pre-initialized to \a hpx#throws
+    ///                   the function will throw on error instead.
+    ///
+    /// \throws invalid_status if the runtime system has not been started yet.
+    ///
+    /// \note             As long as \a ec is not pre-initialized to
+    ///                   \a hpx#throws this function doesn't
+    ///                   throw but returns the result code using the
+    ///                   parameter \a ec. Otherwise it throws an instance
+    ///                   of hpx#exception.
+    inline void register_work_n(threads::thread_init_data* data,
+        std::size_t count, threads::thread_pool_base* pool,
+        error_code& ec = throws)
+    {
+        HPX_ASSERT(pool);
+        for (std::size_t i = 0; i != count; ++i)
+        {
+            data[i].run_now = false;
+        }
+        pool->create_work_n(data, count, ec);
+    }
 }}    // namespace hpx::threads
 
 /// \endcond
@@ -0,0 +1,95 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file hpx/threading_base/sampling_profiler.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/threading_base/threading_base_fwd.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace threads {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The sampling profiler is a statistical profiler of the HPX threads. A
+    // background OS thread periodically looks at what every worker thread is
+    // running: the description of the HPX thread (its annotation, or the
+    // address of its thread function) and optionally the call stack of the
+    // HPX thread. As the stacks are taken from the running coroutine, they
+    // end at the entry point of the HPX thread instead of at the scheduling
+    // loop. The samples are aggregated as folded stacks, ready to be turned
+    // into a flame graph (for instance by flamegraph.pl).
+    //
+    // The call stacks are sampled by interrupting the worker threads with
+    // SIGPROF, which is supported on Linux only. Elsewhere only the
+    // descriptions are sampled.
+    //
+    // The profiler can also be enabled for the whole run of an application
+    // with --hpx:sampling-profiler=<file>, the profile is written to the file
+    // when the runtime stops.
+
+    /// Start sampling the worker threads every \a interval. The folded stacks
+    /// start with \a root if it is not empty, followed by the description of
+    /// the sampled HPX thread ("[idle]" for idle worker threads) and its call
+    /// stack if \a stacks is true. Throws bad_parameter if the profiler is
+    /// already running.
+    HPX_CORE_EXPORT void start_sampling_profiler(
+        std::chrono::microseconds interval = std::chrono::milliseconds(1),
+        bool stacks = false, std::string const& root = "");
+
+    /// Stop sampling, the collected samples are kept. Does nothing if the
+    /// profiler is not running.
+    HPX_CORE_EXPORT void stop_sampling_profiler();
+
+    /// Returns whether the worker threads are being sampled
+    HPX_CORE_EXPORT bool is_sampling_profiler_running() noexcept;
+
+    /// Returns the folded stacks collected so far and the number of samples
+    /// of each of them, sorted by stack
+    HPX_CORE_EXPORT std::vector<std::pair<std::string, std::uint64_t>>
+    get_sampling_profile(bool reset = false);
+
+    /// Writes the folded stacks collected so far, one line per stack: the
+    /// frames separated by ';', followed by a space and the number of samples
+    HPX_CORE_EXPORT void write_sampling_profile(
+        std::ostream& os, bool reset = false);
+
+    namespace detail {
+        HPX_CORE_EXPORT extern std::atomic<bool> sampling_profiler_enabled;
+
+        HPX_CORE_EXPORT void record_sample_begin(
+            thread_data const* thrd) noexcept;
+        HPX_CORE_EXPORT void record_sample_end() noexcept;
+
+        // Called from the scheduling loop, cost a relaxed load while the
+        // profiler is not running.
+        HPX_FORCEINLINE void sample_task_begin(thread_data const* thrd) noexcept
+        {
+            if (HPX_UNLIKELY(
+                    sampling_profiler_enabled.load(std::memory_order_relaxed)))
+            {
+                record_sample_begin(thrd);
+            }
+        }
+
+        HPX_FORCEINLINE void sample_task_end() noexcept
+        {
+            if (HPX_UNLIKELY(
+                    sampling_profiler_enabled.load(std::memory_order_relaxed)))
+            {
+                record_sample_end();
+            }
+        }
+    }    // namespace detail
+}}       // namespace hpx::threads
@@ -12,6 +12,7 @@
 #include <hpx/functional/function.hpp>
 #include <hpx/modules/errors.hpp>
 #include <hpx/modules/format.hpp>
+#include <hpx/threading_base/detail/timer_wheel.hpp>
 #include <hpx/threading_base/scheduler_mode.hpp>
 #include <hpx/threading_base/scheduler_state.hpp>
 #include <hpx/threading_base/thread_data.hpp>
@@ -24,6 +25,7 @@
 #endif
 
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
 #include <cstddef>
 #include <cstdint>
@@ -97,8 +99,43 @@ namespace hpx { namespace threads { namespace policies {
 
         /// This function gets called by the thread-manager whenever new work
         /// has been added, allowing the scheduler to reactivate one or more of
-        /// possibly idling OS threads
-        void do_some_work(std::size_t);
+        /// possibly idling OS threads. If idle parking is enabled, up to
+        /// \a count parked threads close to \a num_thread are woken up,
+        /// std::size_t(-1) wakes up all of them.
+        void do_some_work(std::size_t num_thread, std::size_t count = 1);
+
+        /// Add the given timed state change to the timer wheel of the
+        /// calling worker thread. Returns false (and does not add the entry)
+        /// if the calling thread does not run on a worker of this scheduler.
+        bool schedule_timer(threads::detail::timer_wheel_entry& entry);
+
+        /// This function gets called by the scheduling loop to perform the
+        /// timed state changes which have expired on the given worker thread
+        void process_timers(std::size_t num_thread)
+        {
+            HPX_ASSERT(num_thread < timers_.size());
+            threads::detail::timer_wheel& wheel = timers_[num_thread].data_;
+            if (!wheel.empty())
+            {
+                expire_timers(wheel, num_thread);
+            }
+        }
+
+        /// Let the idle worker threads of this scheduler execute the pending
+        /// threads of the given scheduler (with a lower priority than their
+        /// own work), nullptr disables this.
+        void lend_workers_to(scheduler_base* target) noexcept
+        {
+            HPX_ASSERT(target != this);
+            lending_target_.store(target, std::memory_order_release);
+        }
+
+        /// Return the scheduler this scheduler lends its idle worker threads
+        /// to, if any.
+        scheduler_base* get_lending_target() const noexcept
+        {
+            return lending_target_.load(std::memory_order_acquire);
+        }
 
         virtual void suspend(std::size_t num_thread);
         virtual void resume(std::size_t num_thread);
@@ -188,11 +225,32 @@ namespace hpx { namespace threads { namespace policies {
             std::size_t num_thread, bool reset) = 0;
         virtual std::int64_t get_num_stolen_to_staged(
             std::size_t num_thread, bool reset) = 0;
+
+        // schedulers stealing one thread at a time do not need to override
+        // this
+        virtual std::int64_t get_average_steal_batch_size(
+            std::size_t /* num_thread */, bool /* reset */)
+        {
+            return 0;
+        }
 #endif
 
         virtual std::int64_t get_queue_length(
             std::size_t num_thread = std::size_t(-1)) const = 0;
 
+        // Returns the bucket counts of the queue latency histogram (see
+        // queue_latency_histogram.hpp) of the threads with the given
+        // priority (of all threads for thread_priority::default_), either of
+        // the threads taken by the workers owning the queues or of the
+        // stolen ones. Schedulers not recording the latencies return no
+        // buckets.
+        virtual std::vector<std::uint64_t> get_queue_latency_counts(
+            thread_priority /* priority */, bool /* stolen */,
+            bool /* reset */) const
+        {
+            return {};
+        }
+
         virtual std::int64_t get_thread_count(
             thread_schedule_state state = thread_schedule_state::unknown,
             thread_priority priority = thread_priority::default_,
@@ -222,6 +280,13 @@ namespace hpx { namespace threads { namespace policies {
         virtual void create_thread(
             thread_init_data& data, thread_id_ref_type* id, error_code& ec) = 0;
 
+        // Create the threads data[0], ..., data[count - 1], all of which must
+        // have the initial state 'pending'. Schedulers may override this to
+        // add all threads targeting the same queue in one go, the default
+        // creates the threads one at a time.
+        virtual void create_thread_n(
+            thread_init_data* data, std::size_t count, error_code& ec);
+
         virtual bool get_next_thread(std::size_t num_thread, bool running,
             threads::thread_id_ref_type& thrd, bool enable_stealing) = 0;
 
@@ -230,6 +295,13 @@ namespace hpx { namespace threads { namespace policies {
             bool allow_fallback = false,
             thread_priority priority = thread_priority::normal) = 0;
 
+        // Schedule the threads thrds[0], ..., thrds[count - 1] using their
+        // own priorities. Schedulers may override this to add all threads
+        // targeting the same queue in one go, the default schedules the
+        // threads one at a time.
+        virtual void schedule_thread_n(
+            threads::thread_id_ref_type* thrds, std::size_t count);
+
         virtual void schedule_thread_last(threads::thread_id_ref_type thrd,
             threads::thread_schedule_hint schedulehint,
             bool allow_fallback = false,
@@ -237,6 +309,14 @@ namespace hpx { namespace threads { namespace policies {
 
         virtual void destroy_thread(threads::thread_data* thrd) = 0;
 
+        // Take a pending thread from any of the queues for a worker thread
+        // outside of this scheduler (see lend_workers_to). Returns false if
+        // there is nothing to take or the scheduler doesn't support this.
+        virtual bool lend_thread(threads::thread_id_ref_type& /* thrd */)
+        {
+            return false;
+        }
+
         virtual bool wait_or_add_new(std::size_t num_thread, bool running,
             std::int64_t& idle_loop_count, bool enable_stealing,
             std::size_t& added) = 0;
@@ -267,6 +347,10 @@ namespace hpx { namespace threads { namespace policies {
             switch (stacksize)
             {
             case thread_stacksize::small_:
+                if (thread_queue_init_.run_to_completion_)
+                {
+                    return thread_queue_init_.nostack_stacksize_;
+                }
                 return thread_queue_init_.small_stacksize_;
 
             case thread_stacksize::medium:
@@ -335,6 +419,22 @@ namespace hpx { namespace threads { namespace policies {
                 &null_polling_work_count_function, std::memory_order_relaxed);
         }
 
+        void set_io_polling_functions(polling_function_ptr io_func,
+            polling_work_count_function_ptr io_work_count_func)
+        {
+            polling_function_io_.store(io_func, std::memory_order_relaxed);
+            polling_work_count_function_io_.store(
+                io_work_count_func, std::memory_order_relaxed);
+        }
+
+        void clear_io_polling_function()
+        {
+            polling_function_io_.store(
+                &null_polling_function, std::memory_order_relaxed);
+            polling_work_count_function_io_.store(
+                &null_polling_work_count_function, std::memory_order_relaxed);
+        }
+
         detail::polling_status custom_polling_function() const
         {
             detail::polling_status status = detail::polling_status::idle;
@@ -351,6 +451,13 @@ namespace hpx { namespace threads { namespace policies {
             {
                 status = detail::polling_status::busy;
             }
+#endif
+#if defined(HPX_HAVE_MODULE_ASYNC_IO)
+            if ((*polling_function_io_.load(std::memory_order_relaxed))() ==
+                detail::polling_status::busy)
+            {
+                status = detail::polling_status::busy;
+            }
 #endif
             return status;
         }
@@ -365,6 +472,10 @@ namespace hpx { namespace threads { namespace policies {
 #if defined(HPX_HAVE_MODULE_ASYNC_CUDA)
             work_count += polling_work_count_function_cuda_.load(
                 std::memory_order_relaxed)();
+#endif
+#if defined(HPX_HAVE_MODULE_ASYNC_IO)
+            work_count += polling_work_count_function_io_.load(
+                std::memory_order_relaxed)();
 #endif
             return work_count;
         }
@@ -383,8 +494,36 @@ namespace hpx { namespace threads { namespace policies {
             double max_idle_backoff_time_;
         };
         std::vector<util::cache_line_data<idle_backoff_data>> wait_counts_;
+
+        // support for parking idle threads until new work arrives
+        struct idle_park_data
+        {
+            pu_mutex_type mtx_;
+            std::condition_variable cond_;
+            std::atomic<bool> parked_{false};
+            bool notified_ = false;
+        };
+        std::vector<util::cache_line_data<idle_park_data>> parking_;
+        std::atomic<std::size_t> num_parked_{0};
+
+        void park(std::size_t num_thread,
+            std::chrono::steady_clock::duration const& period);
+        bool unpark(std::size_t num_thread);
 #endif
 
+        // the timed state changes of suspended threads, one timer wheel per
+        // worker thread
+        std::vector<util::cache_line_data<threads::detail::timer_wheel>>
+            timers_;
+
+        void expire_timers(
+            threads::detail::timer_wheel& wheel, std::size_t num_thread);
+
+        // limit the time the given worker may sleep to the next expiry of its
+        // timers
+        std::chrono::steady_clock::duration get_idle_time(
+            std::size_t num_thread, double max_idle_time) const;
+
         // support for suspension of pus
         std::vector<pu_mutex_type> suspend_mtxs_;
         std::vector<std::condition_variable> suspend_conds_;
@@ -399,14 +538,20 @@ namespace hpx { namespace threads { namespace policies {
         // the pool that owns this scheduler
         threads::thread_pool_base* parent_pool_;
 
+        // the scheduler whose work our idle worker threads execute
+        std::atomic<scheduler_base*> lending_target_;
+
         std::atomic<std::int64_t> background_thread_count_;
 
         std::atomic<polling_function_ptr> polling_function_mpi_;
         std::atomic<polling_function_ptr> polling_function_cuda_;
+        std::atomic<polling_function_ptr> polling_function_io_;
         std::atomic<polling_work_count_function_ptr>
             polling_work_count_function_mpi_;
         std::atomic<polling_work_count_function_ptr>
             polling_work_count_function_cuda_;
+        std::atomic<polling_work_count_function_ptr>
+            polling_work_count_function_io_;
 
 #if defined(HPX_HAVE_SCHEDULER_LOCAL_STORAGE)
     public:
@@ -61,6 +61,11 @@ namespace hpx { namespace threads { namespace policies {
         /// This option allows for certain schedulers to explicitly disable
         /// exponential idle-back off
         enable_idle_backoff = 0x0800,
+        /// This option tells schedulers to park idle threads until new work
+        /// arrives (waking up only one of them per new task) instead of
+        /// putting them to sleep for exponentially growing times, this
+        /// requires enable_idle_backoff to be set as well
+        enable_idle_parking = 0x1000,
 
         // clang-format off
         /// This option represents the default mode.
@@ -72,7 +77,8 @@ namespace hpx { namespace threads { namespace policies {
             enable_stealing_numa |
             assign_work_round_robin |
             steal_after_local |
-            enable_idle_backoff,
+            enable_idle_backoff |
+            enable_idle_parking,
         /// This enables all available options.
         all_flags =
             do_background_work |
@@ -86,7 +92,8 @@ namespace hpx { namespace threads { namespace policies {
             assign_work_thread_parent |
             steal_high_priority_first |
             steal_after_local |
-            enable_idle_backoff
+            enable_idle_backoff |
+            enable_idle_parking
         // clang-format on
     };
 
@@ -12,6 +12,7 @@
 #include <hpx/threading_base/threading_base_fwd.hpp>
 
 #include <atomic>
+#include <cstddef>
 #include <memory>
 
 namespace hpx { namespace threads { namespace detail {
@@ -21,4 +22,14 @@ namespace hpx { namespace threads { namespace detail {
         thread_priority priority,
         thread_schedule_hint schedulehint = thread_schedule_hint(),
         bool retry_on_active = true, error_code& ec = throws);
+
+    // Set the threads ids[0], ..., ids[count - 1], all of which must have
+    // been suspended, to 'pending'. The threads are handed to their
+    // schedulers in one batch per scheduler, followed by a single wakeup of
+    // the worker threads. If the state of one of the threads can't be
+    // changed, all other threads are still scheduled before the (first)
+    // error is reported.
+    HPX_CORE_EXPORT void set_thread_state_n(thread_id_type const* ids,
+        std::size_t count, thread_restart_state new_state_ex,
+        error_code& ec = throws);
 }}}    // namespace hpx::threads::detail
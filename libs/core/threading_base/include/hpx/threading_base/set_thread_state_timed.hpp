@@ -28,6 +28,18 @@ namespace hpx { namespace threads { namespace detail {
         thread_schedule_hint schedulehint, std::atomic<bool>* started,
         bool retry_on_active, error_code& ec);
 
+    /// Set the state of the given \a thread to the given new value at the
+    /// given time. This uses the timer wheel of the calling worker thread if
+    /// it belongs to the given scheduler and falls back to
+    /// set_thread_state_timed otherwise. Unlike with set_thread_state_timed
+    /// the state change can't be canceled.
+    HPX_CORE_EXPORT void set_thread_state_at(
+        policies::scheduler_base* scheduler,
+        hpx::chrono::steady_time_point const& abs_time,
+        thread_id_type const& thrd, thread_schedule_state newstate,
+        thread_restart_state newstate_ex, thread_priority priority,
+        error_code& ec);
+
     inline thread_id_ref_type set_thread_state_timed(
         policies::scheduler_base* scheduler,
         hpx::chrono::steady_time_point const& abs_time,
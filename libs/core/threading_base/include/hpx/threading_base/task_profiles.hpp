@@ -0,0 +1,148 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file hpx/threading_base/task_profiles.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/threading_base/threading_base_fwd.hpp>
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace hpx { namespace threads {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The task profiles aggregate the execution of the HPX threads by their
+    // description, i.e. the name given by annotated_function, a
+    // scoped_annotation active while the thread starts running, or the
+    // address of the thread function if no name was given. The scheduling
+    // loops update tables owned by their worker thread, the tables are merged
+    // when the profiles are queried.
+    //
+    // The profiles are exposed as the performance counters
+    // /threads{locality#N/total}/profile/...@<annotation>, creating one of
+    // those enables the profiling.
+    enum class task_profile_value
+    {
+        count,          // number of terminated HPX threads
+        time,           // cumulative execution time [ns]
+        average,        // average execution time of a terminated thread [ns]
+        max,            // maximum time a thread ran without suspending [ns]
+        suspensions,    // number of times a thread yielded or was suspended
+        steals,         // number of times a thread resumed on another worker
+        samples,        // number of times the task counters were sampled
+        allocations,    // number of allocations (allocation profiling only)
+        allocated_bytes    // allocated memory [bytes] (allocation profiling)
+    };
+
+    /// The maximum number of hardware counters read by a task counter sampler
+    inline constexpr std::size_t max_task_counters = 8;
+
+    /// A set of (hardware) counters read whenever a sampled HPX thread starts
+    /// and stops running. The difference of the values is accumulated into
+    /// the profile of the annotation of the thread. The functions are called
+    /// by the scheduling loops of all worker threads.
+    struct task_counter_sampler
+    {
+        virtual ~task_counter_sampler() = default;
+
+        // the number of counters read by read(), at most max_task_counters
+        virtual std::size_t size() const noexcept = 0;
+
+        // reads the current values of the counters of the calling OS thread,
+        // returns false if they can't be read on this thread
+        virtual bool read(std::int64_t* values) noexcept = 0;
+    };
+
+    struct task_profile
+    {
+        std::string name;
+        std::uint64_t count = 0;
+        std::uint64_t time = 0;
+        std::uint64_t max = 0;
+        std::uint64_t suspensions = 0;
+        std::uint64_t steals = 0;
+
+        // the memory allocated through the global operator new, counted only
+        // if HPX_WITH_ALLOCATION_PROFILING is ON and the allocation profiling
+        // is enabled (see allocation_profiling.hpp)
+        std::uint64_t allocations = 0;
+        std::uint64_t allocated_bytes = 0;
+
+        // the accumulated counters of the sampled thread phases
+        std::uint64_t samples = 0;
+        std::array<std::uint64_t, max_task_counters> counters{};
+    };
+
+    /// Enable or disable the collection of the task profiles. The collected
+    /// values are kept while the profiling is disabled.
+    HPX_CORE_EXPORT void enable_task_profiling(bool enable = true) noexcept;
+
+    /// Returns whether the task profiles are being collected
+    HPX_CORE_EXPORT bool is_task_profiling_enabled() noexcept;
+
+    /// Returns the profiles of all descriptions which have been executed
+    /// since the profiling was enabled (or the profiles were reset), sorted
+    /// by name. Resets all profiles if \a reset is true.
+    HPX_CORE_EXPORT std::vector<task_profile> get_task_profiles(
+        bool reset = false);
+
+    /// Returns the given value of the profile of the description \a name, 0
+    /// if no HPX thread with that description has been executed. Resets only
+    /// the requested value if \a reset is true.
+    HPX_CORE_EXPORT std::int64_t get_task_profile_value(
+        std::string const& name, task_profile_value which, bool reset = false);
+
+    /// Install the counters sampled by the task profiling, each worker thread
+    /// samples every \a interval-th thread phase it runs. Passing an empty \a
+    /// sampler stops the sampling. The samplers are kept alive until the end
+    /// of the program, a worker may still be reading them.
+    HPX_CORE_EXPORT void set_task_counter_sampler(
+        std::shared_ptr<task_counter_sampler> sampler,
+        std::size_t interval = 1);
+
+    /// Returns the accumulated value of the sampled counter with the given
+    /// index of the profile of the description \a name, 0 if no HPX thread
+    /// with that description has been sampled
+    HPX_CORE_EXPORT std::int64_t get_task_profile_counter(
+        std::string const& name, std::size_t index, bool reset = false);
+
+    namespace detail {
+        HPX_CORE_EXPORT extern std::atomic<bool> task_profiling_enabled;
+
+        HPX_CORE_EXPORT void record_task_begin(thread_data const* thrd);
+        HPX_CORE_EXPORT void record_task_end(
+            thread_data const* thrd, bool terminated);
+
+        // Called from the scheduling loop, cost a relaxed load while the
+        // profiling is disabled.
+        HPX_FORCEINLINE void profile_task_begin(thread_data const* thrd)
+        {
+            if (HPX_UNLIKELY(
+                    task_profiling_enabled.load(std::memory_order_relaxed)))
+            {
+                record_task_begin(thrd);
+            }
+        }
+
+        HPX_FORCEINLINE void profile_task_end(
+            thread_data const* thrd, bool terminated)
+        {
+            if (HPX_UNLIKELY(
+                    task_profiling_enabled.load(std::memory_order_relaxed)))
+            {
+                record_task_end(thrd, terminated);
+            }
+        }
+    }    // namespace detail
+}}       // namespace hpx::threads
@@ -0,0 +1,106 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file hpx/threading_base/task_trace.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/threading_base/threading_base_fwd.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace hpx { namespace threads {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The task trace is a timeline of the HPX threads executed by the
+    // scheduling loops. Every worker thread appends fixed size binary records
+    // to its own lock-free ring buffer, a background OS thread periodically
+    // drains the buffers into the trace file. Records are dropped (and
+    // counted) if a buffer is full. The file can be converted to the Chrome
+    // trace format understood by Perfetto with
+    // tools/task_trace/task_trace_to_chrome.py.
+    //
+    // The trace file starts with a task_trace_header followed by
+    // task_trace_records. A record of type task_trace_event::name maps a
+    // description id to its name, the name (thread_id bytes, not null
+    // terminated) follows the record, padded to a multiple of the record size.
+    enum class task_trace_event : std::uint8_t
+    {
+        begin = 0,      // an HPX thread (re)starts running on a worker
+        end = 1,        // the HPX thread has terminated
+        suspend = 2,    // the HPX thread has yielded or was suspended
+        steal = 3,      // the HPX thread resumes on another worker than the
+                        // one it was suspended on (stored as description),
+                        // precedes its begin record
+        name = 255      // the name of a description id
+    };
+
+    struct task_trace_header
+    {
+        char magic[8];               // "HPXTRACE"
+        std::uint32_t version;       // 1
+        std::uint32_t record_size;   // sizeof(task_trace_record)
+    };
+
+    struct task_trace_record
+    {
+        std::uint64_t timestamp;      // nanoseconds (high_resolution_clock)
+        std::uint64_t thread_id;      // address of the thread data
+        std::uint64_t description;    // description id (begin records only)
+        std::uint32_t worker;         // global worker thread number
+        std::uint8_t event;           // task_trace_event
+        std::uint8_t description_kind;    // 0: name, 1: function address
+        std::uint16_t reserved;
+    };
+
+    static_assert(sizeof(task_trace_record) == 32,
+        "the trace file format requires records of 32 bytes");
+
+    /// Start recording the task trace into the given file, which is
+    /// truncated. Each worker thread uses a ring buffer of \a buffer_size
+    /// records (rounded up to a power of two). Throws bad_parameter if the
+    /// file can't be opened or the trace is already being recorded.
+    ///
+    /// The trace can also be enabled for the whole run of an application by
+    /// setting hpx.task_trace.file (for instance using
+    /// --hpx:ini=hpx.task_trace.file=trace.bin).
+    HPX_CORE_EXPORT void start_task_trace(
+        std::string const& filename, std::size_t buffer_size = 8192);
+
+    /// Stop recording the task trace, writes all buffered records and closes
+    /// the file. Does nothing if no trace is being recorded.
+    HPX_CORE_EXPORT void stop_task_trace();
+
+    /// Returns whether the task trace is being recorded
+    HPX_CORE_EXPORT bool is_task_trace_enabled() noexcept;
+
+    /// Returns the number of records dropped because a ring buffer was full,
+    /// since the trace was started
+    HPX_CORE_EXPORT std::uint64_t get_task_trace_dropped_records() noexcept;
+
+    namespace detail {
+        HPX_CORE_EXPORT extern std::atomic<bool> task_trace_enabled;
+
+        HPX_CORE_EXPORT void record_task_event(
+            task_trace_event event, thread_data const* thrd) noexcept;
+
+        // Called from the scheduling loop, costs a relaxed load while no
+        // trace is being recorded.
+        HPX_FORCEINLINE void trace_task_event(
+            task_trace_event event, thread_data const* thrd) noexcept
+        {
+            if (HPX_UNLIKELY(
+                    task_trace_enabled.load(std::memory_order_relaxed)))
+            {
+                record_task_event(event, thrd);
+            }
+        }
+    }    // namespace detail
+}}       // namespace hpx::threads
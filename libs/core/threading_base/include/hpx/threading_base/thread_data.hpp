@@ -464,6 +464,14 @@ namespace hpx { namespace threads {
             priority_ = priority;
         }
 
+        /// Return the NUMA domain this thread was created for using a
+        /// thread_schedule_hint_mode::numa hint, or -1 if it may run anywhere.
+        /// Schedulers keep such threads on their domain where possible.
+        constexpr std::int16_t get_numa_affinity() const noexcept
+        {
+            return numa_affinity_;
+        }
+
         // handle thread interruption
         bool interruption_requested() const noexcept
         {
@@ -531,6 +539,19 @@ namespace hpx { namespace threads {
             last_worker_thread_num_ = last_worker_thread_num;
         }
 
+        // the time the thread was added to a queue of pending threads, 0 if
+        // the queue latencies are not being recorded (see
+        // queue_latency_histogram.hpp)
+        std::uint64_t get_queue_timestamp() const noexcept
+        {
+            return queue_timestamp_;
+        }
+
+        void set_queue_timestamp(std::uint64_t timestamp) noexcept
+        {
+            queue_timestamp_ = timestamp;
+        }
+
         std::ptrdiff_t get_stack_size() const noexcept
         {
             return stacksize_;
@@ -640,6 +661,7 @@ namespace hpx { namespace threads {
 #endif
         ///////////////////////////////////////////////////////////////////////
         thread_priority priority_;
+        std::int16_t numa_affinity_;
 
         bool requested_interrupt_;
         bool enabled_interrupt_;
@@ -652,6 +674,7 @@ namespace hpx { namespace threads {
         // reference to scheduler which created/manages this thread
         policies::scheduler_base* scheduler_base_;
         std::size_t last_worker_thread_num_;
+        std::uint64_t queue_timestamp_;
 
         std::ptrdiff_t stacksize_;
         thread_stacksize stacksize_enum_;
@@ -416,6 +416,50 @@ namespace hpx { namespace threads {
 
     HPX_CORE_EXPORT std::size_t& get_continuation_recursion_count() noexcept;
     HPX_CORE_EXPORT void reset_continuation_recursion_count() noexcept;
+
+    // Set the limits for running future continuations inline: the maximal
+    // number of nested continuations (hpx.continuation_max_recursion_depth)
+    // and the minimal remaining stack space needed for running another one
+    // (hpx.continuation_stack_budget).
+    HPX_CORE_EXPORT void set_continuation_limits(
+        std::size_t max_recursion_depth, std::size_t stack_budget) noexcept;
+
+    // Returns whether a continuation at the given nesting depth may be run
+    // inline on the calling thread. Continuations are never run inline on
+    // non-HPX threads.
+    HPX_CORE_EXPORT bool can_run_continuation_inline(
+        std::size_t recursion_depth);
+
+    namespace detail {
+
+        // Counts the continuations run inline on the calling thread while
+        // an instance is alive.
+        struct continuation_recursion_scope
+        {
+            continuation_recursion_scope() noexcept
+              : count_(get_continuation_recursion_count())
+            {
+                ++count_;
+            }
+
+            continuation_recursion_scope(
+                continuation_recursion_scope const&) = delete;
+            continuation_recursion_scope& operator=(
+                continuation_recursion_scope const&) = delete;
+
+            ~continuation_recursion_scope()
+            {
+                --count_;
+            }
+
+            bool can_run_inline() const
+            {
+                return can_run_continuation_inline(count_);
+            }
+
+            std::size_t& count_;
+        };
+    }    // namespace detail
     /// \endcond
 
     /// Returns a pointer to the pool that was used to run the current thread
@@ -189,6 +189,11 @@ namespace hpx { namespace threads {
         virtual thread_id_ref_type create_work(
             thread_init_data& data, error_code& ec) = 0;
 
+        // Create the work items data[0], ..., data[count - 1]. The default
+        // implementation creates the work items one at a time.
+        virtual void create_work_n(
+            thread_init_data* data, std::size_t count, error_code& ec);
+
         virtual thread_state set_state(thread_id_type const& id,
             thread_schedule_state new_state, thread_restart_state new_state_ex,
             thread_priority priority, error_code& ec) = 0;
@@ -220,6 +225,10 @@ namespace hpx { namespace threads {
         mask_type get_used_processing_units() const;
         hwloc_bitmap_ptr get_numa_domain_bitmap() const;
 
+        // Return the NUMA domain of the processing unit the given (pool
+        // local) worker thread is bound to.
+        std::size_t get_numa_domain(std::size_t num_thread) const;
+
         // performance counters
 #if defined(HPX_HAVE_THREAD_CUMULATIVE_COUNTS)
         virtual std::int64_t get_executed_threads(
@@ -382,6 +391,11 @@ namespace hpx { namespace threads {
         {
             return 0;
         }
+        virtual std::int64_t get_average_steal_batch_size(
+            std::size_t /*thread_num*/, bool /*reset*/)
+        {
+            return 0;
+        }
 #endif
 
         virtual std::int64_t get_thread_count(thread_schedule_state /*state*/,
@@ -39,7 +39,12 @@ namespace hpx { namespace threads { namespace policies {
             std::ptrdiff_t small_stacksize = HPX_SMALL_STACK_SIZE,
             std::ptrdiff_t medium_stacksize = HPX_MEDIUM_STACK_SIZE,
             std::ptrdiff_t large_stacksize = HPX_LARGE_STACK_SIZE,
-            std::ptrdiff_t huge_stacksize = HPX_HUGE_STACK_SIZE)
+            std::ptrdiff_t huge_stacksize = HPX_HUGE_STACK_SIZE,
+            std::int64_t steal_batch_size = std::int64_t(
+                HPX_THREAD_QUEUE_STEAL_BATCH_SIZE),
+            std::int64_t max_free_threads = std::int64_t(
+                HPX_THREAD_QUEUE_MAX_FREE_THREADS),
+            bool run_to_completion = HPX_THREAD_QUEUE_RUN_TO_COMPLETION != 0)
           : max_thread_count_(max_thread_count)
           , min_tasks_to_steal_pending_(min_tasks_to_steal_pending)
           , min_tasks_to_steal_staged_(min_tasks_to_steal_staged)
@@ -55,6 +60,9 @@ namespace hpx { namespace threads { namespace policies {
           , large_stacksize_(large_stacksize)
           , huge_stacksize_(huge_stacksize)
           , nostack_stacksize_((std::numeric_limits<std::ptrdiff_t>::max)())
+          , steal_batch_size_(steal_batch_size)
+          , max_free_threads_(max_free_threads)
+          , run_to_completion_(run_to_completion)
         {
         }
 
@@ -73,5 +81,14 @@ namespace hpx { namespace threads { namespace policies {
         std::ptrdiff_t const large_stacksize_;
         std::ptrdiff_t const huge_stacksize_;
         std::ptrdiff_t const nostack_stacksize_;
+        // maximal number of pending tasks taken from a victim at once, zero
+        // means half of the victim's pending tasks
+        std::int64_t steal_batch_size_;
+        // maximal number of recycled threads per stack size which can be
+        // reused without locking
+        std::int64_t max_free_threads_;
+        // run threads of the small stack size without a stack of their own,
+        // i.e. as stackless threads on the stack of the worker thread
+        bool run_to_completion_;
     };
 }}}    // namespace hpx::threads::policies
@@ -50,7 +50,11 @@ namespace hpx { namespace threads {
     using thread_arg_type = thread_restart_state;
 
     using thread_function_sig = thread_result_type(thread_arg_type);
-    using thread_function_type = hpx::move_only_function<thread_function_sig>;
+
+    // the thread functions use a larger embedded storage than the default
+    // hpx::move_only_function (see HPX_WITH_THREAD_FUNCTION_STORAGE_SIZE)
+    using thread_function_type = hpx::move_only_function<thread_function_sig,
+        false, util::detail::thread_function_storage_size>;
 
     using thread_self = coroutines::detail::coroutine_self;
     using thread_self_impl_type = coroutines::detail::coroutine_impl;
@@ -0,0 +1,148 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file worker_local.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
+#include <hpx/concurrency/spinlock.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace threads {
+
+    namespace detail {
+
+        /// \cond NOINTERNAL
+        // Identifies a slot of the storage every OS thread holds for the
+        // worker_local instances. Slots are reused after being released, the
+        // generation tells the values of different owners apart.
+        struct worker_local_slot
+        {
+            std::size_t index;
+            std::uint64_t generation;
+        };
+
+        HPX_CORE_EXPORT worker_local_slot allocate_worker_local_slot();
+        HPX_CORE_EXPORT void release_worker_local_slot(
+            worker_local_slot const& slot) noexcept;
+
+        // Returns the data stored by the calling OS thread in the given slot,
+        // nullptr if there is none.
+        HPX_CORE_EXPORT void* get_worker_local_data(
+            worker_local_slot const& slot) noexcept;
+        HPX_CORE_EXPORT void set_worker_local_data(
+            worker_local_slot const& slot, void* data);
+        /// \endcond
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// The class template \a worker_local holds a separate instance of \a T
+    /// for every worker (OS-) thread accessing it. The instance of the
+    /// calling worker is found through a slot index assigned when the
+    /// \a worker_local is constructed. Accessing it takes neither a lock nor
+    /// a lookup by key, which makes it suitable for per-core accumulators,
+    /// caches and pools.
+    ///
+    /// The instances are created on first access by every worker and live
+    /// until the \a worker_local is destroyed.
+    ///
+    /// \note HPX threads may be resumed on a different worker after having
+    ///       been suspended. The reference returned by \a local() should
+    ///       therefore not be used across suspension points.
+    template <typename T>
+    class worker_local
+    {
+    private:
+        using instance_type = util::cache_aligned_data<T>;
+
+    public:
+        /// Every worker gets a value initialized instance of \a T.
+        worker_local()
+          : slot_(detail::allocate_worker_local_slot())
+        {
+        }
+
+        /// Every worker gets a copy of \a init.
+        explicit worker_local(T const& init)
+          : slot_(detail::allocate_worker_local_slot())
+          , init_(std::make_unique<T>(init))
+        {
+        }
+
+        worker_local(worker_local const&) = delete;
+        worker_local(worker_local&&) = delete;
+        worker_local& operator=(worker_local const&) = delete;
+        worker_local& operator=(worker_local&&) = delete;
+
+        ~worker_local()
+        {
+            detail::release_worker_local_slot(slot_);
+        }
+
+        /// Returns the instance of the calling worker, creating it if needed.
+        T& local()
+        {
+            void* data = detail::get_worker_local_data(slot_);
+            if (HPX_LIKELY(data != nullptr))
+            {
+                return static_cast<instance_type*>(data)->data_;
+            }
+            return create_local();
+        }
+
+        /// Invokes \a f with every instance created so far. The instances may
+        /// be accessed concurrently by their workers while this runs.
+        template <typename F>
+        void for_each(F&& f)
+        {
+            std::lock_guard<mutex_type> l(mtx_);
+            for (std::unique_ptr<instance_type> const& p : instances_)
+            {
+                f(p->data_);
+            }
+        }
+
+        /// Returns the number of instances created so far.
+        std::size_t size() const
+        {
+            std::lock_guard<mutex_type> l(mtx_);
+            return instances_.size();
+        }
+
+    private:
+        HPX_NOINLINE T& create_local()
+        {
+            auto p = init_ ? std::make_unique<instance_type>(*init_) :
+                             std::make_unique<instance_type>();
+            instance_type* data = p.get();
+
+            {
+                std::lock_guard<mutex_type> l(mtx_);
+                instances_.push_back(HPX_MOVE(p));
+            }
+
+            detail::set_worker_local_data(slot_, data);
+            return data->data_;
+        }
+
+    private:
+        using mutex_type = util::spinlock;
+
+        detail::worker_local_slot slot_;
+        std::unique_ptr<T> init_;
+
+        mutable mutex_type mtx_;
+        std::vector<std::unique_ptr<instance_type>> instances_;
+    };
+}}    // namespace hpx::threads
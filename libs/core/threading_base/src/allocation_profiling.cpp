@@ -0,0 +1,464 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_ALLOCATION_PROFILING)
+#include <hpx/concurrency/spinlock.hpp>
+#include <hpx/debugging/backtrace.hpp>
+#include <hpx/threading_base/allocation_profiling.hpp>
+#include <hpx/threading_base/thread_data.hpp>
+#include <hpx/threading_base/thread_description.hpp>
+#include <hpx/threading_base/thread_num_tss.hpp>
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <string>
+#include <vector>
+
+namespace hpx { namespace threads {
+
+    namespace detail {
+        std::atomic<bool> allocation_profiling_enabled{false};
+    }    // namespace detail
+
+    namespace {
+        ///////////////////////////////////////////////////////////////////////
+        // The counters of one OS thread, written by that thread only
+        struct thread_allocations
+        {
+            std::atomic<std::uint64_t> count{0};
+            std::atomic<std::uint64_t> bytes{0};
+            std::atomic<std::size_t> global_thread_num{std::size_t(-1)};
+
+            // the values at the last reset, protected by the registry lock
+            allocation_counts base;
+        };
+
+        constexpr std::size_t max_backtrace_frames = 16;
+        constexpr std::size_t max_backtraces = 256;
+
+        struct backtrace_record
+        {
+            std::size_t size;
+            char const* annotation;
+            std::size_t num_frames;
+            void* frames[max_backtrace_frames];
+        };
+
+        // The counters are never released, the OS threads may still allocate
+        // while the runtime shuts down.
+        struct allocation_registry
+        {
+            std::mutex mtx;    // protects threads
+            std::vector<std::unique_ptr<thread_allocations>> threads;
+
+            std::atomic<std::size_t> backtrace_threshold{0};
+
+            hpx::util::spinlock backtraces_mtx;
+            std::array<backtrace_record, max_backtraces> backtraces;
+            std::size_t backtraces_written = 0;
+        };
+
+        allocation_registry& get_registry()
+        {
+            static allocation_registry registry;
+            return registry;
+        }
+
+        // both are constant initialized, they are accessed while the
+        // thread allocates
+        thread_local thread_allocations* current_allocations = nullptr;
+        thread_local bool in_allocation_hook = false;
+
+        thread_allocations* register_thread()
+        {
+            allocation_registry& registry = get_registry();
+
+            std::lock_guard<std::mutex> l(registry.mtx);
+            registry.threads.push_back(std::make_unique<thread_allocations>());
+            return registry.threads.back().get();
+        }
+
+        void record_backtrace(std::size_t size)
+        {
+            backtrace_record record;
+            record.size = size;
+            record.annotation = nullptr;
+            record.num_frames = hpx::util::stack_trace::trace(
+                record.frames, max_backtrace_frames);
+
+            thread_data* self = get_self_id_data();
+            if (self != nullptr)
+            {
+                util::thread_description const desc = self->get_description();
+                if (desc.kind() ==
+                    util::thread_description::data_type_description)
+                {
+                    record.annotation = desc.get_description();
+                }
+            }
+
+            allocation_registry& registry = get_registry();
+            std::lock_guard<hpx::util::spinlock> l(registry.backtraces_mtx);
+            registry.backtraces[registry.backtraces_written++ %
+                max_backtraces] = record;
+        }
+
+        void count_allocation(std::size_t size) noexcept
+        {
+            // the allocations made while counting are not counted
+            if (in_allocation_hook)
+            {
+                return;
+            }
+            in_allocation_hook = true;
+
+            try
+            {
+                thread_allocations* c = current_allocations;
+                if (HPX_UNLIKELY(c == nullptr))
+                {
+                    c = current_allocations = register_thread();
+                }
+
+                // the worker threads allocate before their number is known
+                if (HPX_UNLIKELY(c->global_thread_num.load(
+                                     std::memory_order_relaxed) ==
+                        std::size_t(-1)))
+                {
+                    c->global_thread_num.store(
+                        detail::get_global_thread_num_tss(),
+                        std::memory_order_relaxed);
+                }
+
+                c->count.store(c->count.load(std::memory_order_relaxed) + 1,
+                    std::memory_order_relaxed);
+                c->bytes.store(c->bytes.load(std::memory_order_relaxed) + size,
+                    std::memory_order_relaxed);
+
+                std::size_t const threshold =
+                    get_registry().backtrace_threshold.load(
+                        std::memory_order_relaxed);
+                if (threshold != 0 && size >= threshold)
+                {
+                    record_backtrace(size);
+                }
+            }
+            catch (...)
+            {
+                // the allocation is not counted if the thread can't be
+                // registered
+            }
+
+            in_allocation_hook = false;
+        }
+
+        HPX_FORCEINLINE void record_allocation(std::size_t size) noexcept
+        {
+            if (HPX_UNLIKELY(detail::allocation_profiling_enabled.load(
+                    std::memory_order_relaxed)))
+            {
+                count_allocation(size);
+            }
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        void* allocate(std::size_t size)
+        {
+            if (size == 0)
+            {
+                size = 1;
+            }
+            for (;;)
+            {
+                if (void* p = std::malloc(size))
+                {
+                    record_allocation(size);
+                    return p;
+                }
+
+                std::new_handler handler = std::get_new_handler();
+                if (handler == nullptr)
+                {
+                    throw std::bad_alloc();
+                }
+                handler();
+            }
+        }
+
+        void* allocate(std::size_t size, std::nothrow_t const&) noexcept
+        {
+            try
+            {
+                return allocate(size);
+            }
+            catch (...)
+            {
+                return nullptr;
+            }
+        }
+
+        void* allocate_aligned(std::size_t size, std::align_val_t alignment)
+        {
+            std::size_t const align = static_cast<std::size_t>(alignment);
+            if (size == 0)
+            {
+                size = 1;
+            }
+            // aligned_alloc requires the size to be a multiple of the
+            // alignment
+            size = (size + align - 1) & ~(align - 1);
+            for (;;)
+            {
+                if (void* p = std::aligned_alloc(align, size))
+                {
+                    record_allocation(size);
+                    return p;
+                }
+
+                std::new_handler handler = std::get_new_handler();
+                if (handler == nullptr)
+                {
+                    throw std::bad_alloc();
+                }
+                handler();
+            }
+        }
+
+        void* allocate_aligned(std::size_t size, std::align_val_t alignment,
+            std::nothrow_t const&) noexcept
+        {
+            try
+            {
+                return allocate_aligned(size, alignment);
+            }
+            catch (...)
+            {
+                return nullptr;
+            }
+        }
+
+    }    // namespace
+
+    ///////////////////////////////////////////////////////////////////////////
+    void enable_allocation_profiling(bool enable) noexcept
+    {
+        detail::allocation_profiling_enabled.store(
+            enable, std::memory_order_relaxed);
+    }
+
+    bool is_allocation_profiling_enabled() noexcept
+    {
+        return detail::allocation_profiling_enabled.load(
+            std::memory_order_relaxed);
+    }
+
+    allocation_counts get_allocation_counts(
+        std::size_t global_thread_num, bool reset)
+    {
+        allocation_registry& registry = get_registry();
+
+        allocation_counts result;
+        std::lock_guard<std::mutex> l(registry.mtx);
+        for (auto& c : registry.threads)
+        {
+            if (global_thread_num != std::size_t(-1) &&
+                c->global_thread_num.load(std::memory_order_relaxed) !=
+                    global_thread_num)
+            {
+                continue;
+            }
+
+            std::uint64_t const count =
+                c->count.load(std::memory_order_relaxed);
+            std::uint64_t const bytes =
+                c->bytes.load(std::memory_order_relaxed);
+            result.count += count - c->base.count;
+            result.bytes += bytes - c->base.bytes;
+            if (reset)
+            {
+                c->base.count = count;
+                c->base.bytes = bytes;
+            }
+        }
+        return result;
+    }
+
+    void set_allocation_backtrace_threshold(std::size_t size) noexcept
+    {
+        get_registry().backtrace_threshold.store(
+            size, std::memory_order_relaxed);
+    }
+
+    std::vector<allocation_backtrace> get_allocation_backtraces(bool reset)
+    {
+        allocation_registry& registry = get_registry();
+
+        // the records are copied first, the symbols are resolved without
+        // holding the lock
+        std::vector<backtrace_record> records;
+        {
+            std::lock_guard<hpx::util::spinlock> l(registry.backtraces_mtx);
+
+            std::size_t const written = registry.backtraces_written;
+            std::size_t const first =
+                written > max_backtraces ? written - max_backtraces : 0;
+            records.reserve(written - first);
+            for (std::size_t i = first; i != written; ++i)
+            {
+                records.push_back(registry.backtraces[i % max_backtraces]);
+            }
+            if (reset)
+            {
+                registry.backtraces_written = 0;
+            }
+        }
+
+        std::vector<allocation_backtrace> result;
+        result.reserve(records.size());
+        for (backtrace_record const& record : records)
+        {
+            allocation_backtrace bt;
+            bt.size = record.size;
+            if (record.annotation != nullptr)
+            {
+                bt.annotation = record.annotation;
+            }
+            bt.backtrace = hpx::util::stack_trace::get_symbols(
+                record.frames, record.num_frames);
+            result.push_back(HPX_MOVE(bt));
+        }
+        return result;
+    }
+
+    namespace detail {
+        allocation_counts get_thread_allocation_counts() noexcept
+        {
+            thread_allocations const* c = current_allocations;
+            if (c == nullptr)
+            {
+                return allocation_counts();
+            }
+            return allocation_counts{c->count.load(std::memory_order_relaxed),
+                c->bytes.load(std::memory_order_relaxed)};
+        }
+    }    // namespace detail
+}}       // namespace hpx::threads
+
+///////////////////////////////////////////////////////////////////////////////
+// The replacements of the global allocation functions
+void* operator new(std::size_t size)
+{
+    return hpx::threads::allocate(size);
+}
+
+void* operator new[](std::size_t size)
+{
+    return hpx::threads::allocate(size);
+}
+
+void* operator new(std::size_t size, std::nothrow_t const& tag) noexcept
+{
+    return hpx::threads::allocate(size, tag);
+}
+
+void* operator new[](std::size_t size, std::nothrow_t const& tag) noexcept
+{
+    return hpx::threads::allocate(size, tag);
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment)
+{
+    return hpx::threads::allocate_aligned(size, alignment);
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment)
+{
+    return hpx::threads::allocate_aligned(size, alignment);
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment,
+    std::nothrow_t const& tag) noexcept
+{
+    return hpx::threads::allocate_aligned(size, alignment, tag);
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment,
+    std::nothrow_t const& tag) noexcept
+{
+    return hpx::threads::allocate_aligned(size, alignment, tag);
+}
+
+void operator delete(void* p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete[](void* p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept
+{
+    std::free(p);
+}
+
+void operator delete[](void* p, std::size_t) noexcept
+{
+    std::free(p);
+}
+
+void operator delete(void* p, std::nothrow_t const&) noexcept
+{
+    std::free(p);
+}
+
+void operator delete[](void* p, std::nothrow_t const&) noexcept
+{
+    std::free(p);
+}
+
+void operator delete(void* p, std::align_val_t) noexcept
+{
+    std::free(p);
+}
+
+void operator delete[](void* p, std::align_val_t) noexcept
+{
+    std::free(p);
+}
+
+void operator delete(void* p, std::size_t, std::align_val_t) noexcept
+{
+    std::free(p);
+}
+
+void operator delete[](void* p, std::size_t, std::align_val_t) noexcept
+{
+    std::free(p);
+}
+
+void operator delete(
+    void* p, std::align_val_t, std::nothrow_t const&) noexcept
+{
+    std::free(p);
+}
+
+void operator delete[](
+    void* p, std::align_val_t, std::nothrow_t const&) noexcept
+{
+    std::free(p);
+}
+
+#endif
@@ -15,6 +15,7 @@
 #include <hpx/threading_base/thread_num_tss.hpp>
 
 #include <hpx/threading_base/detail/reset_lco_description.hpp>
+#include <hpx/threading_base/detail/timer_wheel.hpp>
 #include <hpx/threading_base/execution_agent.hpp>
 #include <hpx/threading_base/scheduler_base.hpp>
 #include <hpx/threading_base/set_thread_state.hpp>
@@ -98,10 +99,37 @@ namespace hpx { namespace threads {
         sleep_until(sleep_duration.from_now(), desc);
     }
 
+    namespace {
+
+        struct on_exit_cancel_timer
+        {
+            ~on_exit_cancel_timer()
+            {
+                detail::cancel_timer(timer_);
+            }
+
+            detail::timer_wheel_entry& timer_;
+        };
+    }    // namespace
+
     void execution_agent::sleep_until(
         hpx::chrono::steady_time_point const& sleep_time, const char* desc)
     {
-        // Just yield until time has passed by...
+        // Suspend until the timer wheel of this worker thread wakes us up,
+        // this returns early if the thread is resumed in the meantime.
+        thread_id_ref_type id = self_.get_thread_id();    // keep alive
+        detail::timer_wheel_entry timer(id, sleep_time.value(),
+            thread_schedule_state::pending, thread_restart_state::timeout,
+            thread_priority::boost);
+        if (get_thread_id_data(id)->get_scheduler_base()->schedule_timer(
+                timer))
+        {
+            on_exit_cancel_timer cancel{timer};
+            do_yield(desc, thread_schedule_state::suspended);
+            return;
+        }
+
+        // Otherwise just yield until time has passed by...
         auto now = std::chrono::steady_clock::now();
 
         // Note: we yield at least once to allow for other threads to
@@ -0,0 +1,32 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/threading_base/queue_latency_histogram.hpp>
+#include <hpx/timing/high_resolution_clock.hpp>
+
+#include <atomic>
+#include <cstdint>
+
+namespace hpx { namespace threads {
+
+    namespace detail {
+        std::atomic<std::uint64_t> queue_latency_enabled_since{0};
+    }    // namespace detail
+
+    void set_queue_latency_histograms_enabled(bool enabled) noexcept
+    {
+        detail::queue_latency_enabled_since.store(
+            enabled ? hpx::chrono::high_resolution_clock::now() : 0,
+            std::memory_order_relaxed);
+    }
+
+    bool get_queue_latency_histograms_enabled() noexcept
+    {
+        return detail::queue_latency_enabled_since.load(
+                   std::memory_order_relaxed) != 0;
+    }
+}}    // namespace hpx::threads
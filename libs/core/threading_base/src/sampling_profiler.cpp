@@ -0,0 +1,534 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/debugging/backtrace.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/modules/format.hpp>
+#include <hpx/threading_base/sampling_profiler.hpp>
+#include <hpx/threading_base/thread_data.hpp>
+#include <hpx/threading_base/thread_description.hpp>
+#include <hpx/timing/high_resolution_clock.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#if defined(__linux__) && defined(HPX_HAVE_STACKTRACES)
+#define HPX_SAMPLING_PROFILER_HAVE_STACKS
+#include <cerrno>
+#include <csignal>
+#include <pthread.h>
+#endif
+
+namespace hpx { namespace threads {
+
+    namespace detail {
+        std::atomic<bool> sampling_profiler_enabled{false};
+    }    // namespace detail
+
+    namespace {
+        ///////////////////////////////////////////////////////////////////////
+        // the kind of the first element of a sample
+        constexpr std::uintptr_t sample_idle = 0;
+        constexpr std::uintptr_t sample_name = 1;
+        constexpr std::uintptr_t sample_address = 2;
+
+#if defined(HPX_SAMPLING_PROFILER_HAVE_STACKS)
+        constexpr std::size_t max_frames = 64;
+
+        // the innermost frames belong to the signal handler
+        constexpr std::size_t skipped_frames = 3;
+
+        // the states of a stack sampling request
+        constexpr int stack_idle = 0;
+        constexpr int stack_requested = 1;
+        constexpr int stack_writing = 2;
+        constexpr int stack_written = 3;
+#endif
+
+        // What a worker thread is running, written by the worker only
+        struct worker_slot
+        {
+            std::atomic<std::uintptr_t> kind{sample_idle};
+            std::atomic<std::uintptr_t> key{0};
+
+            // the OS thread has exited, protected by the registry lock
+            bool alive = true;
+
+#if defined(HPX_SAMPLING_PROFILER_HAVE_STACKS)
+            pthread_t thread;
+
+            // written by the signal handler while request is stack_writing
+            std::atomic<int> request{stack_idle};
+            std::uintptr_t sampled_kind = sample_idle;
+            std::uintptr_t sampled_key = 0;
+            std::size_t num_frames = 0;
+            void* frames[max_frames];
+#endif
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        // The slots are never released, the worker threads may still touch
+        // them right after the profiler has been stopped.
+        struct profiler_registry
+        {
+            ~profiler_registry()
+            {
+                // the profiler wasn't stopped before the end of the program
+                if (sampler.joinable())
+                {
+                    {
+                        std::lock_guard<std::mutex> l(sample_mtx);
+                        stop_requested = true;
+                    }
+                    cond.notify_one();
+                    sampler.join();
+                }
+            }
+
+            void sample_loop();
+            void sample();
+
+            std::mutex mtx;    // protects slots
+            std::vector<std::unique_ptr<worker_slot>> slots;
+
+            std::mutex sample_mtx;    // protects everything below
+            std::condition_variable cond;
+            bool stop_requested = false;
+            std::thread sampler;
+            std::chrono::microseconds interval{1000};
+            bool stacks = false;
+            std::string root;
+
+            // the samples, the elements are the kind and key of the
+            // description followed by the stack frames (outermost first)
+            std::map<std::vector<std::uintptr_t>, std::uint64_t> samples;
+            std::vector<std::uintptr_t> current;
+        };
+
+        profiler_registry& get_registry()
+        {
+            static profiler_registry registry;
+            return registry;
+        }
+
+        // constant initialized, it is accessed by the signal handler
+        thread_local worker_slot* current_slot = nullptr;
+
+        // marks the slot of an exiting OS thread
+        struct slot_guard
+        {
+            ~slot_guard()
+            {
+                if (current_slot != nullptr)
+                {
+                    std::lock_guard<std::mutex> l(get_registry().mtx);
+                    current_slot->alive = false;
+                }
+            }
+        };
+
+        worker_slot* get_slot()
+        {
+            if (HPX_LIKELY(current_slot != nullptr))
+            {
+                return current_slot;
+            }
+
+            static thread_local slot_guard guard;
+            (void) guard;
+
+            profiler_registry& registry = get_registry();
+            auto slot = std::make_unique<worker_slot>();
+#if defined(HPX_SAMPLING_PROFILER_HAVE_STACKS)
+            slot->thread = pthread_self();
+#endif
+
+            std::lock_guard<std::mutex> l(registry.mtx);
+            registry.slots.push_back(HPX_MOVE(slot));
+            current_slot = registry.slots.back().get();
+            return current_slot;
+        }
+
+#if defined(HPX_SAMPLING_PROFILER_HAVE_STACKS)
+        ///////////////////////////////////////////////////////////////////////
+        void sample_stack_handler(int)
+        {
+            worker_slot* slot = current_slot;
+            if (slot == nullptr)
+            {
+                return;
+            }
+
+            int expected = stack_requested;
+            if (!slot->request.compare_exchange_strong(expected, stack_writing,
+                    std::memory_order_acquire))
+            {
+                return;
+            }
+
+            int const saved_errno = errno;
+            slot->sampled_kind = slot->kind.load(std::memory_order_relaxed);
+            slot->sampled_key = slot->key.load(std::memory_order_relaxed);
+            slot->num_frames =
+                hpx::util::stack_trace::trace(slot->frames, max_frames);
+            errno = saved_errno;
+
+            slot->request.store(stack_written, std::memory_order_release);
+        }
+
+        void install_stack_handler()
+        {
+            struct sigaction action = {};
+            action.sa_handler = &sample_stack_handler;
+            action.sa_flags = SA_RESTART;
+            sigemptyset(&action.sa_mask);
+            sigaction(SIGPROF, &action, nullptr);
+
+            // the first stack trace may load the unwinder, which is not
+            // allowed in a signal handler
+            void* frames[max_frames];
+            hpx::util::stack_trace::trace(frames, max_frames);
+        }
+
+        // Interrupts the worker of the given slot to take the stack of the
+        // HPX thread it is running, returns false if the worker didn't
+        // answer in time.
+        bool sample_stack(worker_slot& slot, std::vector<std::uintptr_t>& out)
+        {
+            slot.request.store(stack_requested, std::memory_order_release);
+            if (pthread_kill(slot.thread, SIGPROF) != 0)
+            {
+                slot.request.store(stack_idle, std::memory_order_relaxed);
+                return false;
+            }
+
+            // a worker blocked in a system call answers once it returns
+            std::uint64_t const deadline =
+                hpx::chrono::high_resolution_clock::now() + 1000000;
+            while (slot.request.load(std::memory_order_acquire) !=
+                stack_written)
+            {
+                if (hpx::chrono::high_resolution_clock::now() > deadline)
+                {
+                    int expected = stack_requested;
+                    if (slot.request.compare_exchange_strong(
+                            expected, stack_idle, std::memory_order_relaxed))
+                    {
+                        return false;
+                    }
+                    // the handler is writing the stack right now
+                }
+                std::this_thread::yield();
+            }
+
+            out.push_back(slot.sampled_kind);
+            out.push_back(slot.sampled_key);
+            for (std::size_t i = slot.num_frames; i > skipped_frames; --i)
+            {
+                out.push_back(
+                    reinterpret_cast<std::uintptr_t>(slot.frames[i - 1]));
+            }
+
+            slot.request.store(stack_idle, std::memory_order_relaxed);
+            return true;
+        }
+
+        // the function name of a frame as returned by get_symbol:
+        // "<address>: <name> [<offset>] in <module>"
+        std::string get_frame_name(std::uintptr_t address)
+        {
+            std::string symbol = hpx::util::stack_trace::get_symbol(
+                reinterpret_cast<void*>(address));
+
+            std::string::size_type const begin = symbol.find(": ");
+            if (begin != std::string::npos)
+            {
+                symbol.erase(0, begin + 2);
+            }
+            std::string::size_type end = symbol.find(" [0x");
+            if (end == std::string::npos)
+            {
+                end = symbol.find(" in ");
+            }
+            if (end != std::string::npos)
+            {
+                symbol.erase(end);
+            }
+
+            // ';' separates the frames of the folded stacks
+            for (char& c : symbol)
+            {
+                if (c == ';')
+                {
+                    c = ',';
+                }
+            }
+            return symbol.empty() ? hpx::util::format("{:#x}", address) :
+                                    symbol;
+        }
+#endif
+
+        ///////////////////////////////////////////////////////////////////////
+        void profiler_registry::sample()
+        {
+            std::lock_guard<std::mutex> l(mtx);
+            for (auto& slot : slots)
+            {
+                if (!slot->alive)
+                {
+                    continue;
+                }
+
+                current.clear();
+#if defined(HPX_SAMPLING_PROFILER_HAVE_STACKS)
+                if (!(stacks &&
+                        slot->kind.load(std::memory_order_acquire) !=
+                            sample_idle &&
+                        sample_stack(*slot, current)))
+#endif
+                {
+                    std::uintptr_t const kind =
+                        slot->kind.load(std::memory_order_acquire);
+                    current.push_back(kind);
+                    current.push_back(
+                        slot->key.load(std::memory_order_relaxed));
+                }
+
+                auto it = samples.find(current);
+                if (it == samples.end())
+                {
+                    samples.emplace(current, 1);
+                }
+                else
+                {
+                    ++it->second;
+                }
+            }
+        }
+
+        void profiler_registry::sample_loop()
+        {
+            std::unique_lock<std::mutex> l(sample_mtx);
+            while (!stop_requested)
+            {
+                cond.wait_for(l, interval);
+                if (!stop_requested)
+                {
+                    sample();
+                }
+            }
+        }
+
+        std::string get_description_name(
+            std::uintptr_t kind, std::uintptr_t key)
+        {
+            if (kind == sample_name && key != 0)
+            {
+                return std::string(reinterpret_cast<char const*>(key));
+            }
+            if (kind == sample_address)
+            {
+                return hpx::util::format("{:#x}", key);
+            }
+            return "[idle]";
+        }
+    }    // namespace
+
+    ///////////////////////////////////////////////////////////////////////////
+    void start_sampling_profiler(std::chrono::microseconds interval,
+        bool stacks, std::string const& root)
+    {
+        profiler_registry& registry = get_registry();
+
+        std::lock_guard<std::mutex> l(registry.sample_mtx);
+        if (registry.sampler.joinable())
+        {
+            HPX_THROW_EXCEPTION(bad_parameter,
+                "hpx::threads::start_sampling_profiler",
+                "the sampling profiler is already running");
+        }
+        if (interval.count() <= 0)
+        {
+            HPX_THROW_EXCEPTION(bad_parameter,
+                "hpx::threads::start_sampling_profiler",
+                "the sampling interval must be positive");
+        }
+
+#if defined(HPX_SAMPLING_PROFILER_HAVE_STACKS)
+        if (stacks)
+        {
+            install_stack_handler();
+        }
+#else
+        // the call stacks can't be sampled on this platform
+        stacks = false;
+#endif
+
+        registry.interval = interval;
+        registry.stacks = stacks;
+        registry.root = root;
+        registry.stop_requested = false;
+        registry.sampler =
+            std::thread([&registry]() { registry.sample_loop(); });
+
+        detail::sampling_profiler_enabled.store(
+            true, std::memory_order_release);
+    }
+
+    void stop_sampling_profiler()
+    {
+        profiler_registry& registry = get_registry();
+
+        detail::sampling_profiler_enabled.store(
+            false, std::memory_order_release);
+
+        std::thread sampler;
+        {
+            std::lock_guard<std::mutex> l(registry.sample_mtx);
+            if (!registry.sampler.joinable())
+            {
+                return;
+            }
+            registry.stop_requested = true;
+            sampler = HPX_MOVE(registry.sampler);
+        }
+        registry.cond.notify_one();
+        sampler.join();
+
+        // the workers don't update their slots anymore
+        std::lock_guard<std::mutex> l(registry.mtx);
+        for (auto& slot : registry.slots)
+        {
+            slot->kind.store(sample_idle, std::memory_order_relaxed);
+            slot->key.store(0, std::memory_order_relaxed);
+        }
+    }
+
+    bool is_sampling_profiler_running() noexcept
+    {
+        return detail::sampling_profiler_enabled.load(
+            std::memory_order_relaxed);
+    }
+
+    std::vector<std::pair<std::string, std::uint64_t>> get_sampling_profile(
+        bool reset)
+    {
+        profiler_registry& registry = get_registry();
+
+        std::string root;
+        std::map<std::vector<std::uintptr_t>, std::uint64_t> samples;
+        {
+            std::lock_guard<std::mutex> l(registry.sample_mtx);
+            root = registry.root;
+            if (reset)
+            {
+                samples.swap(registry.samples);
+            }
+            else
+            {
+                samples = registry.samples;
+            }
+        }
+
+        // different samples may resolve to the same names
+        std::map<std::string, std::uint64_t> stacks;
+#if defined(HPX_SAMPLING_PROFILER_HAVE_STACKS)
+        std::unordered_map<std::uintptr_t, std::string> frame_names;
+#endif
+        for (auto const& sample : samples)
+        {
+            std::vector<std::uintptr_t> const& key = sample.first;
+
+            std::string stack = root;
+            if (!stack.empty())
+            {
+                stack += ';';
+            }
+            stack += get_description_name(key[0], key[1]);
+
+#if defined(HPX_SAMPLING_PROFILER_HAVE_STACKS)
+            for (std::size_t i = 2; i < key.size(); ++i)
+            {
+                auto it = frame_names.find(key[i]);
+                if (it == frame_names.end())
+                {
+                    it = frame_names
+                             .emplace(key[i], get_frame_name(key[i]))
+                             .first;
+                }
+                stack += ';';
+                stack += it->second;
+            }
+#endif
+            stacks[stack] += sample.second;
+        }
+
+        return std::vector<std::pair<std::string, std::uint64_t>>(
+            stacks.begin(), stacks.end());
+    }
+
+    void write_sampling_profile(std::ostream& os, bool reset)
+    {
+        for (auto const& stack : get_sampling_profile(reset))
+        {
+            os << stack.first << ' ' << stack.second << '\n';
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    namespace detail {
+        void record_sample_begin(thread_data const* thrd) noexcept
+        {
+            try
+            {
+                worker_slot* slot = get_slot();
+
+                util::thread_description const desc = thrd->get_description();
+                if (desc.kind() ==
+                    util::thread_description::data_type_description)
+                {
+                    slot->key.store(reinterpret_cast<std::uintptr_t>(
+                                        desc.get_description()),
+                        std::memory_order_relaxed);
+                    slot->kind.store(sample_name, std::memory_order_release);
+                }
+                else
+                {
+                    slot->key.store(
+                        desc.get_address(), std::memory_order_relaxed);
+                    slot->kind.store(
+                        sample_address, std::memory_order_release);
+                }
+            }
+            catch (...)
+            {
+                // the worker is not sampled if its slot can't be allocated
+            }
+        }
+
+        void record_sample_end() noexcept
+        {
+            worker_slot* slot = current_slot;
+            if (slot != nullptr)
+            {
+                slot->kind.store(sample_idle, std::memory_order_release);
+            }
+        }
+    }    // namespace detail
+}}       // namespace hpx::threads
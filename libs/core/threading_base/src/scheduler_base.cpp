@@ -10,7 +10,9 @@
 #include <hpx/threading_base/scheduler_base.hpp>
 #include <hpx/threading_base/scheduler_mode.hpp>
 #include <hpx/threading_base/scheduler_state.hpp>
+#include <hpx/threading_base/set_thread_state.hpp>
 #include <hpx/threading_base/thread_init_data.hpp>
+#include <hpx/threading_base/thread_num_tss.hpp>
 #include <hpx/threading_base/thread_pool_base.hpp>
 #if defined(HPX_HAVE_SCHEDULER_LOCAL_STORAGE)
 #include <hpx/coroutines/detail/tss.hpp>
@@ -38,18 +40,22 @@ namespace hpx { namespace threads { namespace policies {
     scheduler_base::scheduler_base(std::size_t num_threads,
         char const* description, thread_queue_init_parameters thread_queue_init,
         scheduler_mode mode)
-      : suspend_mtxs_(num_threads)
+      : timers_(num_threads)
+      , suspend_mtxs_(num_threads)
       , suspend_conds_(num_threads)
       , pu_mtxs_(num_threads)
       , states_(num_threads)
       , description_(description)
       , thread_queue_init_(thread_queue_init)
       , parent_pool_(nullptr)
+      , lending_target_(nullptr)
       , background_thread_count_(0)
       , polling_function_mpi_(&null_polling_function)
       , polling_function_cuda_(&null_polling_function)
+      , polling_function_io_(&null_polling_function)
       , polling_work_count_function_mpi_(&null_polling_work_count_function)
       , polling_work_count_function_cuda_(&null_polling_work_count_function)
+      , polling_work_count_function_io_(&null_polling_work_count_function)
     {
         set_scheduler_mode(mode);
 
@@ -62,6 +68,9 @@ namespace hpx { namespace threads { namespace policies {
             data.data_.wait_count_ = 0;
             data.data_.max_idle_backoff_time_ = max_time;
         }
+
+        parking_ = std::vector<util::cache_line_data<idle_park_data>>(
+            num_threads);
 #endif
 
         for (std::size_t i = 0; i != num_threads; ++i)
@@ -70,21 +79,49 @@ namespace hpx { namespace threads { namespace policies {
 
     void scheduler_base::idle_callback(std::size_t num_thread)
     {
+        // the timers of suspended worker threads are handled by the idle ones
+        for (std::size_t i = 0; i != timers_.size(); ++i)
+        {
+            if (i != num_thread && !timers_[i].data_.empty() &&
+                states_[i].load(std::memory_order_relaxed) ==
+                    hpx::state::sleeping)
+            {
+                expire_timers(timers_[i].data_, num_thread);
+            }
+        }
+
 #if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
         if (mode_.data_.load(std::memory_order_relaxed) &
             policies::scheduler_mode::enable_idle_backoff)
         {
+            idle_backoff_data& data = wait_counts_[num_thread].data_;
+
+            if (mode_.data_.load(std::memory_order_relaxed) &
+                policies::scheduler_mode::enable_idle_parking)
+            {
+                // Park this thread until it is explicitly woken up on new
+                // work. The wait is still bounded to keep background work
+                // (parcel and network polling) going.
+                park(num_thread,
+                    get_idle_time(num_thread, data.max_idle_backoff_time_));
+                return;
+            }
+
             // Put this thread to sleep for some time, additionally it gets
             // woken up on new work.
 
-            idle_backoff_data& data = wait_counts_[num_thread].data_;
-
             // Exponential back-off with a maximum sleep time.
             double exponent = (std::min)(double(data.wait_count_),
                 double(std::numeric_limits<double>::max_exponent - 1));
 
-            std::chrono::milliseconds period(std::lround((std::min)(
-                data.max_idle_backoff_time_, std::pow(2.0, exponent))));
+            std::chrono::steady_clock::duration const period =
+                get_idle_time(num_thread,
+                    (std::min)(data.max_idle_backoff_time_,
+                        std::pow(2.0, exponent)));
+            if (period == std::chrono::steady_clock::duration::zero())
+            {
+                return;
+            }
 
             ++data.wait_count_;
 
@@ -100,20 +137,220 @@ namespace hpx { namespace threads { namespace policies {
 #endif
     }
 
+    std::chrono::steady_clock::duration scheduler_base::get_idle_time(
+        std::size_t num_thread, double max_idle_time) const
+    {
+        std::chrono::steady_clock::duration period =
+            std::chrono::milliseconds(std::lround(max_idle_time));
+
+        auto const next = timers_[num_thread].data_.next_expiry();
+        if (next != (std::chrono::steady_clock::time_point::max)())
+        {
+            auto const now = std::chrono::steady_clock::now();
+            period = next <= now ? std::chrono::steady_clock::duration::zero() :
+                                   (std::min)(period, next - now);
+        }
+        return period;
+    }
+
+    bool scheduler_base::schedule_timer(
+        threads::detail::timer_wheel_entry& entry)
+    {
+        // the entry goes to the timer wheel of the calling worker thread,
+        // which has to be one of ours
+        std::size_t const num_thread =
+            threads::detail::get_local_thread_num_tss();
+        thread_data* self = get_self_id_data();
+        if (num_thread >= timers_.size() || self == nullptr ||
+            self->get_scheduler_base() != this)
+        {
+            return false;
+        }
+
+        timers_[num_thread].data_.insert(entry);
+        return true;
+    }
+
+    void scheduler_base::expire_timers(
+        threads::detail::timer_wheel& wheel, std::size_t num_thread)
+    {
+        auto const now = std::chrono::steady_clock::now();
+        if (!wheel.is_due(now))
+        {
+            return;
+        }
+
+        threads::detail::timer_wheel_entry* entry = wheel.expire(now);
+        while (entry != nullptr)
+        {
+            threads::detail::timer_wheel_entry* next = entry->next_;
+
+            thread_id_ref_type thrd = HPX_MOVE(entry->thrd_);
+            thread_schedule_state const newstate = entry->newstate_;
+            thread_restart_state const newstate_ex = entry->newstate_ex_;
+            thread_priority const priority = entry->priority_;
+
+            bool const owned = entry->delete_on_expiry_;
+            if (owned)
+            {
+                delete entry;
+            }
+
+            // don't create a new thread if the target is still active, it is
+            // about to suspend itself or waits in cancel_timer
+            error_code ec(throwmode::lightweight);    // do not throw
+            threads::detail::set_thread_state(thrd.noref(), newstate,
+                newstate_ex, priority,
+                thread_schedule_hint(static_cast<std::int16_t>(num_thread)),
+                false, ec);
+
+            // the waiting thread may release the entry from now on
+            if (!owned)
+            {
+                entry->expired_.store(true, std::memory_order_release);
+            }
+
+            entry = next;
+        }
+    }
+
+#if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
+    void scheduler_base::park(std::size_t num_thread,
+        std::chrono::steady_clock::duration const& period)
+    {
+        idle_park_data& data = parking_[num_thread].data_;
+
+        std::unique_lock<pu_mutex_type> l(data.mtx_);
+
+        data.parked_.store(true, std::memory_order_relaxed);
+        num_parked_.fetch_add(1, std::memory_order_relaxed);
+
+        // Pairs with the fence in do_some_work: either the producer sees this
+        // thread as parked, or this thread sees the newly added work.
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        if (get_queue_length() == 0 &&
+            period != std::chrono::steady_clock::duration::zero())
+        {
+            data.cond_.wait_for(l, period, [&] { return data.notified_; });
+        }
+
+        data.notified_ = false;
+        data.parked_.store(false, std::memory_order_relaxed);
+        num_parked_.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    bool scheduler_base::unpark(std::size_t num_thread)
+    {
+        idle_park_data& data = parking_[num_thread].data_;
+        if (!data.parked_.load(std::memory_order_relaxed))
+        {
+            return false;
+        }
+
+        {
+            std::lock_guard<pu_mutex_type> l(data.mtx_);
+            if (!data.parked_.load(std::memory_order_relaxed) ||
+                data.notified_)
+            {
+                return false;
+            }
+            data.notified_ = true;
+        }
+
+        data.cond_.notify_one();
+        return true;
+    }
+#endif
+
     /// This function gets called by the thread-manager whenever new work
     /// has been added, allowing the scheduler to reactivate one or more of
     /// possibly idling OS threads
-    void scheduler_base::do_some_work(std::size_t)
+    void scheduler_base::do_some_work(std::size_t num_thread, std::size_t count)
     {
 #if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
-        if (mode_.data_.load(std::memory_order_relaxed) &
-            policies::scheduler_mode::enable_idle_backoff)
+        scheduler_mode const mode = mode_.data_.load(std::memory_order_relaxed);
+        if (!(mode & policies::scheduler_mode::enable_idle_backoff))
         {
+            return;
+        }
+
+        if (!(mode & policies::scheduler_mode::enable_idle_parking) ||
+            count == std::size_t(-1))
+        {
+            // Wake up all threads, either sleeping or parked.
             cond_.notify_all();
+            for (std::size_t i = 0; i != parking_.size(); ++i)
+            {
+                unpark(i);
+            }
+            return;
+        }
+
+        // Pairs with the fence in park.
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (num_parked_.load(std::memory_order_relaxed) == 0)
+        {
+            return;
         }
+
+        // Wake up the parked threads closest to the one the work was
+        // scheduled for, either the hinted or the current worker thread.
+        std::size_t const size = parking_.size();
+        if (num_thread >= size)
+        {
+            num_thread = threads::detail::get_local_thread_num_tss();
+            if (num_thread >= size)
+            {
+                num_thread = 0;
+            }
+        }
+
+        std::size_t woken = 0;
+        for (std::size_t distance = 0;
+             distance <= size / 2 && woken != count; ++distance)
+        {
+            if (unpark((num_thread + distance) % size))
+            {
+                ++woken;
+            }
+            if (distance != 0 && 2 * distance != size && woken != count &&
+                unpark((num_thread + size - distance) % size))
+            {
+                ++woken;
+            }
+        }
+#else
+        (void) num_thread;
+        (void) count;
 #endif
     }
 
+    void scheduler_base::create_thread_n(
+        thread_init_data* data, std::size_t count, error_code& ec)
+    {
+        for (std::size_t i = 0; i != count; ++i)
+        {
+            create_thread(data[i], nullptr, ec);
+            if (ec)
+            {
+                return;
+            }
+        }
+    }
+
+    void scheduler_base::schedule_thread_n(
+        threads::thread_id_ref_type* thrds, std::size_t count)
+    {
+        for (std::size_t i = 0; i != count; ++i)
+        {
+            thread_priority const priority =
+                get_thread_id_data(thrds[i])->get_priority();
+            schedule_thread(
+                HPX_MOVE(thrds[i]), thread_schedule_hint(), false, priority);
+        }
+    }
+
     void scheduler_base::suspend(std::size_t num_thread)
     {
         HPX_ASSERT(num_thread < suspend_conds_.size());
@@ -321,7 +558,7 @@ namespace hpx { namespace threads { namespace policies {
     {
         // distribute the same value across all cores
         mode_.data_.store(mode, std::memory_order_release);
-        do_some_work(std::size_t(-1));
+        do_some_work(std::size_t(-1), std::size_t(-1));
     }
 
     void scheduler_base::add_scheduler_mode(scheduler_mode mode)
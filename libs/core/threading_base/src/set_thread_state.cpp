@@ -17,10 +17,12 @@
 #include <hpx/threading_base/thread_data.hpp>
 #include <hpx/threading_base/threading_base_fwd.hpp>
 
+#include <algorithm>
 #include <cstddef>
 #include <functional>
 #include <string>
 #include <utility>
+#include <vector>
 
 namespace hpx { namespace threads { namespace detail {
 
@@ -67,10 +69,13 @@ namespace hpx { namespace threads { namespace detail {
     }
 
     ///////////////////////////////////////////////////////////////////////////
-    thread_state set_thread_state(thread_id_type const& thrd,
+    // Change the state of the given thread and return its previous state.
+    // The thread has to be scheduled by the caller if needs_scheduling was
+    // set.
+    static thread_state change_thread_state(thread_id_type const& thrd,
         thread_schedule_state new_state, thread_restart_state new_state_ex,
-        thread_priority priority, thread_schedule_hint schedulehint,
-        bool retry_on_active, error_code& ec)
+        thread_priority priority, bool retry_on_active, bool& needs_scheduling,
+        error_code& ec)
     {
         if (HPX_UNLIKELY(!thrd))
         {
@@ -253,10 +258,30 @@ namespace hpx { namespace threads { namespace detail {
         } while (true);
 
         thread_schedule_state previous_state_val = previous_state.state();
-        if (!(previous_state_val == thread_schedule_state::pending ||
+        needs_scheduling =
+            !(previous_state_val == thread_schedule_state::pending ||
                 previous_state_val == thread_schedule_state::pending_boost) &&
             (new_state == thread_schedule_state::pending ||
-                new_state == thread_schedule_state::pending_boost))
+                new_state == thread_schedule_state::pending_boost);
+
+        if (&ec != &throws)
+            ec = make_success_code();
+
+        return previous_state;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    thread_state set_thread_state(thread_id_type const& thrd,
+        thread_schedule_state new_state, thread_restart_state new_state_ex,
+        thread_priority priority, thread_schedule_hint schedulehint,
+        bool retry_on_active, error_code& ec)
+    {
+        bool needs_scheduling = false;
+        thread_state const previous_state = change_thread_state(thrd,
+            new_state, new_state_ex, priority, retry_on_active,
+            needs_scheduling, ec);
+
+        if (needs_scheduling)
         {
             // REVIEW: Passing a specific target thread may interfere with the
             // round robin queuing.
@@ -270,9 +295,80 @@ namespace hpx { namespace threads { namespace detail {
             scheduler->do_some_work(schedulehint.hint);
         }
 
+        return previous_state;
+    }
+
+    void set_thread_state_n(thread_id_type const* ids, std::size_t count,
+        thread_restart_state new_state_ex, error_code& ec)
+    {
+        std::vector<thread_id_ref_type> thrds;
+        thrds.reserve(count);
+
+        // An error for one of the threads must not keep the others from being
+        // scheduled, all threads already set to pending would never run
+        // otherwise. The first error is reported once all of them were
+        // scheduled.
+        error_code first_error(throwmode::lightweight);
+
+        for (std::size_t i = 0; i != count; ++i)
+        {
+            // Threads which are still active will suspend shortly,
+            // change_thread_state waits for this.
+            bool needs_scheduling = false;
+            error_code state_ec(throwmode::lightweight);
+            change_thread_state(ids[i], thread_schedule_state::pending,
+                new_state_ex, thread_priority::normal, false,
+                needs_scheduling, state_ec);
+            if (state_ec)
+            {
+                if (!first_error)
+                    first_error = state_ec;
+                continue;
+            }
+
+            if (needs_scheduling)
+            {
+                thrds.emplace_back(ids[i]);
+            }
+        }
+
+        // Group the threads by scheduler, there is usually just one.
+        auto const scheduler_of = [](thread_id_ref_type const& id) {
+            return get_thread_id_data(id)->get_scheduler_base();
+        };
+        std::stable_sort(thrds.begin(), thrds.end(),
+            [&](thread_id_ref_type const& lhs, thread_id_ref_type const& rhs) {
+                return std::less<policies::scheduler_base*>()(
+                    scheduler_of(lhs), scheduler_of(rhs));
+            });
+
+        std::size_t first = 0;
+        while (first != thrds.size())
+        {
+            policies::scheduler_base* scheduler = scheduler_of(thrds[first]);
+
+            std::size_t last = first + 1;
+            while (last != thrds.size() &&
+                scheduler_of(thrds[last]) == scheduler)
+            {
+                ++last;
+            }
+
+            scheduler->schedule_thread_n(&thrds[first], last - first);
+            scheduler->do_some_work(std::size_t(-1), last - first);
+
+            first = last;
+        }
+
+        if (HPX_UNLIKELY(first_error))
+        {
+            HPX_THROWS_IF(ec, static_cast<hpx::error>(first_error.value()),
+                "threads::detail::set_thread_state_n", "{}",
+                first_error.get_message());
+            return;
+        }
+
         if (&ec != &throws)
             ec = make_success_code();
-
-        return previous_state;
     }
 }}}    // namespace hpx::threads::detail
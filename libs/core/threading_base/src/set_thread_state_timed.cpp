@@ -13,6 +13,7 @@
 #include <hpx/modules/errors.hpp>
 #include <hpx/threading_base/create_thread.hpp>
 #include <hpx/threading_base/detail/get_default_timer_service.hpp>
+#include <hpx/threading_base/detail/timer_wheel.hpp>
 #include <hpx/threading_base/set_thread_state_timed.hpp>
 #include <hpx/threading_base/threading_base_fwd.hpp>
 
@@ -192,4 +193,34 @@ namespace hpx { namespace threads { namespace detail {
         create_thread(scheduler, data, newid, ec);    //-V601
         return newid;
     }
+
+    void set_thread_state_at(policies::scheduler_base* scheduler,
+        hpx::chrono::steady_time_point const& abs_time,
+        thread_id_type const& thrd, thread_schedule_state newstate,
+        thread_restart_state newstate_ex, thread_priority priority,
+        error_code& ec)
+    {
+        if (HPX_UNLIKELY(!thrd))
+        {
+            HPX_THROWS_IF(ec, null_thread_id,
+                "threads::detail::set_thread_state_at",
+                "null thread id encountered");
+            return;
+        }
+
+        // the timer wheel owns the entry once it has been added
+        timer_wheel_entry* entry = new timer_wheel_entry(
+            thread_id_ref_type(thrd), abs_time.value(), newstate, newstate_ex,
+            priority, true);
+        if (scheduler->schedule_timer(*entry))
+        {
+            if (&ec != &throws)
+                ec = make_success_code();
+            return;
+        }
+        delete entry;
+
+        set_thread_state_timed(scheduler, abs_time, thrd, newstate,
+            newstate_ex, priority, thread_schedule_hint(), nullptr, true, ec);
+    }
 }}}    // namespace hpx::threads::detail
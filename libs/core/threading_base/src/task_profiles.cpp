@@ -0,0 +1,433 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/concurrency/spinlock.hpp>
+#include <hpx/modules/format.hpp>
+#include <hpx/threading_base/allocation_profiling.hpp>
+#include <hpx/threading_base/task_profiles.hpp>
+#include <hpx/threading_base/thread_data.hpp>
+#include <hpx/threading_base/thread_description.hpp>
+#include <hpx/threading_base/thread_num_tss.hpp>
+#include <hpx/timing/high_resolution_clock.hpp>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace threads {
+
+    namespace detail {
+        std::atomic<bool> task_profiling_enabled{false};
+
+        std::atomic<task_counter_sampler*> task_sampler{nullptr};
+        std::atomic<std::size_t> task_sample_interval{1};
+    }    // namespace detail
+
+    namespace {
+        ///////////////////////////////////////////////////////////////////////
+        struct profile_entry
+        {
+            bool is_name = true;    // the key is a name, not an address
+            std::uint64_t count = 0;
+            std::uint64_t time = 0;
+            std::uint64_t max = 0;
+            std::uint64_t suspensions = 0;
+            std::uint64_t steals = 0;
+            std::uint64_t allocations = 0;
+            std::uint64_t allocated_bytes = 0;
+            std::uint64_t samples = 0;
+            std::array<std::uint64_t, max_task_counters> counters{};
+
+            // the average is reset independently of count and time
+            std::uint64_t average_count = 0;
+            std::uint64_t average_time = 0;
+        };
+
+        // The table of a worker thread, keyed by the address of the name or
+        // the thread function. The lock is contended by queries only.
+        struct profile_table
+        {
+            hpx::util::spinlock mtx;
+            std::unordered_map<std::uintptr_t, profile_entry> entries;
+        };
+
+        // The state of the HPX thread currently running on a worker
+        struct running_task
+        {
+            bool active = false;
+            bool is_name = true;
+            bool stolen = false;
+            std::uintptr_t key = 0;
+            std::uint64_t start = 0;
+#if defined(HPX_HAVE_ALLOCATION_PROFILING)
+            allocation_counts allocations;
+#endif
+
+            // the number of thread phases run by the worker and the counters
+            // read when the current phase started (if it is sampled)
+            std::size_t phases = 0;
+            task_counter_sampler* sampler = nullptr;
+            std::array<std::int64_t, max_task_counters> counters{};
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        // The tables are never released, the worker threads may still touch
+        // them while the runtime shuts down.
+        struct task_profile_registry
+        {
+            std::mutex mtx;    // protects tables and samplers
+            std::vector<std::unique_ptr<profile_table>> tables;
+            std::vector<std::shared_ptr<task_counter_sampler>> samplers;
+        };
+
+        task_profile_registry& get_registry()
+        {
+            static task_profile_registry registry;
+            return registry;
+        }
+
+        profile_table* register_table()
+        {
+            task_profile_registry& registry = get_registry();
+
+            std::lock_guard<std::mutex> l(registry.mtx);
+            registry.tables.push_back(std::make_unique<profile_table>());
+            return registry.tables.back().get();
+        }
+
+        profile_table& get_table()
+        {
+            static thread_local profile_table* table = register_table();
+            return *table;
+        }
+
+        running_task& get_running_task() noexcept
+        {
+            static thread_local running_task task;
+            return task;
+        }
+
+        std::string get_name(std::uintptr_t key, bool is_name)
+        {
+            if (is_name)
+            {
+                return std::string(reinterpret_cast<char const*>(key));
+            }
+            return hpx::util::format("{:#x}", key);
+        }
+
+        template <typename F>
+        void for_each_entry(F&& f)
+        {
+            task_profile_registry& registry = get_registry();
+
+            std::lock_guard<std::mutex> l(registry.mtx);
+            for (auto& table : registry.tables)
+            {
+                std::lock_guard<hpx::util::spinlock> ll(table->mtx);
+                for (auto& entry : table->entries)
+                {
+                    f(entry.first, entry.second);
+                }
+            }
+        }
+    }    // namespace
+
+    ///////////////////////////////////////////////////////////////////////////
+    void enable_task_profiling(bool enable) noexcept
+    {
+        detail::task_profiling_enabled.store(
+            enable, std::memory_order_release);
+    }
+
+    bool is_task_profiling_enabled() noexcept
+    {
+        return detail::task_profiling_enabled.load(std::memory_order_relaxed);
+    }
+
+    void set_task_counter_sampler(
+        std::shared_ptr<task_counter_sampler> sampler, std::size_t interval)
+    {
+        HPX_ASSERT(!sampler || sampler->size() <= max_task_counters);
+
+        task_counter_sampler* p = sampler.get();
+        if (sampler)
+        {
+            task_profile_registry& registry = get_registry();
+
+            std::lock_guard<std::mutex> l(registry.mtx);
+            registry.samplers.push_back(HPX_MOVE(sampler));
+        }
+
+        detail::task_sample_interval.store(
+            interval == 0 ? 1 : interval, std::memory_order_relaxed);
+        detail::task_sampler.store(p, std::memory_order_release);
+    }
+
+    std::vector<task_profile> get_task_profiles(bool reset)
+    {
+        std::map<std::string, task_profile> profiles;
+        for_each_entry([&](std::uintptr_t key, profile_entry& entry) {
+            std::string name = get_name(key, entry.is_name);
+            task_profile& profile = profiles[name];
+            if (profile.name.empty())
+            {
+                profile.name = HPX_MOVE(name);
+            }
+
+            profile.count += entry.count;
+            profile.time += entry.time;
+            profile.max = (std::max)(profile.max, entry.max);
+            profile.suspensions += entry.suspensions;
+            profile.steals += entry.steals;
+            profile.allocations += entry.allocations;
+            profile.allocated_bytes += entry.allocated_bytes;
+            profile.samples += entry.samples;
+            for (std::size_t i = 0; i != max_task_counters; ++i)
+            {
+                profile.counters[i] += entry.counters[i];
+            }
+
+            if (reset)
+            {
+                entry = profile_entry{entry.is_name};
+            }
+        });
+
+        std::vector<task_profile> result;
+        result.reserve(profiles.size());
+        for (auto& profile : profiles)
+        {
+            result.push_back(HPX_MOVE(profile.second));
+        }
+        return result;
+    }
+
+    std::int64_t get_task_profile_value(
+        std::string const& name, task_profile_value which, bool reset)
+    {
+        std::uint64_t value = 0;
+        std::uint64_t average_count = 0;
+        for_each_entry([&](std::uintptr_t key, profile_entry& entry) {
+            if (get_name(key, entry.is_name) != name)
+            {
+                return;
+            }
+
+            switch (which)
+            {
+            case task_profile_value::count:
+                value += entry.count;
+                if (reset)
+                    entry.count = 0;
+                break;
+
+            case task_profile_value::time:
+                value += entry.time;
+                if (reset)
+                    entry.time = 0;
+                break;
+
+            case task_profile_value::average:
+                value += entry.average_time;
+                average_count += entry.average_count;
+                if (reset)
+                {
+                    entry.average_time = 0;
+                    entry.average_count = 0;
+                }
+                break;
+
+            case task_profile_value::max:
+                value = (std::max)(value, entry.max);
+                if (reset)
+                    entry.max = 0;
+                break;
+
+            case task_profile_value::suspensions:
+                value += entry.suspensions;
+                if (reset)
+                    entry.suspensions = 0;
+                break;
+
+            case task_profile_value::steals:
+                value += entry.steals;
+                if (reset)
+                    entry.steals = 0;
+                break;
+
+            case task_profile_value::allocations:
+                value += entry.allocations;
+                if (reset)
+                    entry.allocations = 0;
+                break;
+
+            case task_profile_value::allocated_bytes:
+                value += entry.allocated_bytes;
+                if (reset)
+                    entry.allocated_bytes = 0;
+                break;
+
+            case task_profile_value::samples:
+                value += entry.samples;
+                if (reset)
+                    entry.samples = 0;
+                break;
+            }
+        });
+
+        if (which == task_profile_value::average)
+        {
+            return average_count == 0 ?
+                0 :
+                static_cast<std::int64_t>(value / average_count);
+        }
+        return static_cast<std::int64_t>(value);
+    }
+
+    std::int64_t get_task_profile_counter(
+        std::string const& name, std::size_t index, bool reset)
+    {
+        if (index >= max_task_counters)
+        {
+            return 0;
+        }
+
+        std::uint64_t value = 0;
+        for_each_entry([&](std::uintptr_t key, profile_entry& entry) {
+            if (get_name(key, entry.is_name) == name)
+            {
+                value += entry.counters[index];
+                if (reset)
+                    entry.counters[index] = 0;
+            }
+        });
+        return static_cast<std::int64_t>(value);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    namespace detail {
+        void record_task_begin(thread_data const* thrd)
+        {
+            running_task& task = get_running_task();
+
+            // the last worker number is recorded whenever a thread yields
+            std::size_t const last_worker = thrd->get_last_worker_thread_num();
+            task.stolen = last_worker != std::size_t(-1) &&
+                last_worker != get_local_thread_num_tss();
+
+            // the description is taken when the thread starts running, a
+            // scoped_annotation active in the thread is usually reverted
+            // before it terminates
+            util::thread_description const desc = thrd->get_description();
+            if (desc.kind() == util::thread_description::data_type_description)
+            {
+                task.key =
+                    reinterpret_cast<std::uintptr_t>(desc.get_description());
+                task.is_name = true;
+            }
+            else
+            {
+                task.key = desc.get_address();
+                task.is_name = false;
+            }
+
+            task.active = true;
+#if defined(HPX_HAVE_ALLOCATION_PROFILING)
+            task.allocations = get_thread_allocation_counts();
+#endif
+            task.start = hpx::chrono::high_resolution_clock::now();
+
+            // the counters are read last to leave out the profiling itself
+            task.sampler = nullptr;
+            task_counter_sampler* sampler =
+                task_sampler.load(std::memory_order_acquire);
+            if (sampler != nullptr &&
+                ++task.phases %
+                        task_sample_interval.load(std::memory_order_relaxed) ==
+                    0 &&
+                sampler->read(task.counters.data()))
+            {
+                task.sampler = sampler;
+            }
+        }
+
+        void record_task_end(thread_data const*, bool terminated)
+        {
+            running_task& task = get_running_task();
+
+            std::array<std::int64_t, max_task_counters> counters;
+            bool const sampled = task.sampler != nullptr &&
+                task.sampler == task_sampler.load(std::memory_order_relaxed) &&
+                task.sampler->read(counters.data());
+
+            std::uint64_t const now = hpx::chrono::high_resolution_clock::now();
+#if defined(HPX_HAVE_ALLOCATION_PROFILING)
+            allocation_counts const allocations =
+                get_thread_allocation_counts();
+#endif
+
+            if (!task.active)
+            {
+                // the profiling was enabled while the thread was running
+                return;
+            }
+            task.active = false;
+
+            std::uint64_t const duration = now - task.start;
+
+            profile_table& table = get_table();
+            std::lock_guard<hpx::util::spinlock> l(table.mtx);
+
+            profile_entry& entry = table.entries[task.key];
+            entry.is_name = task.is_name;
+            entry.time += duration;
+            entry.average_time += duration;
+            entry.max = (std::max)(entry.max, duration);
+            if (terminated)
+            {
+                ++entry.count;
+                ++entry.average_count;
+            }
+            else
+            {
+                ++entry.suspensions;
+            }
+            if (task.stolen)
+            {
+                ++entry.steals;
+            }
+#if defined(HPX_HAVE_ALLOCATION_PROFILING)
+            entry.allocations += allocations.count - task.allocations.count;
+            entry.allocated_bytes += allocations.bytes - task.allocations.bytes;
+#endif
+            if (sampled)
+            {
+                ++entry.samples;
+                std::size_t const size = task.sampler->size();
+                for (std::size_t i = 0; i != size; ++i)
+                {
+                    if (counters[i] > task.counters[i])
+                    {
+                        entry.counters[i] += static_cast<std::uint64_t>(
+                            counters[i] - task.counters[i]);
+                    }
+                }
+            }
+        }
+    }    // namespace detail
+}}       // namespace hpx::threads
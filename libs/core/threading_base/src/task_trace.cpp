@@ -0,0 +1,361 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/threading_base/task_trace.hpp>
+#include <hpx/threading_base/thread_data.hpp>
+#include <hpx/threading_base/thread_description.hpp>
+#include <hpx/threading_base/thread_num_tss.hpp>
+#include <hpx/timing/high_resolution_clock.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace threads {
+
+    namespace detail {
+        std::atomic<bool> task_trace_enabled{false};
+    }    // namespace detail
+
+    namespace {
+        ///////////////////////////////////////////////////////////////////////
+        // Single producer (the worker thread owning it), single consumer (the
+        // flushing thread) ring buffer of trace records.
+        class trace_buffer
+        {
+        public:
+            explicit trace_buffer(std::size_t capacity)
+              : records_(capacity)
+              , mask_(capacity - 1)
+            {
+                head_.data_.store(0, std::memory_order_relaxed);
+                tail_.data_.store(0, std::memory_order_relaxed);
+            }
+
+            bool push(task_trace_record const& record) noexcept
+            {
+                std::uint64_t const head =
+                    head_.data_.load(std::memory_order_relaxed);
+                if (head - tail_.data_.load(std::memory_order_acquire) >
+                    mask_)
+                {
+                    return false;
+                }
+                records_[head & mask_] = record;
+                head_.data_.store(head + 1, std::memory_order_release);
+                return true;
+            }
+
+            // appends all available records to the given vector
+            void drain(std::vector<task_trace_record>& records)
+            {
+                std::uint64_t const tail =
+                    tail_.data_.load(std::memory_order_relaxed);
+                std::uint64_t const head =
+                    head_.data_.load(std::memory_order_acquire);
+                for (std::uint64_t i = tail; i != head; ++i)
+                {
+                    records.push_back(records_[i & mask_]);
+                }
+                tail_.data_.store(head, std::memory_order_release);
+            }
+
+            // drops all available records, called by the consumer only
+            void clear() noexcept
+            {
+                tail_.data_.store(head_.data_.load(std::memory_order_acquire),
+                    std::memory_order_release);
+            }
+
+        private:
+            std::vector<task_trace_record> records_;
+            std::uint64_t const mask_;
+            util::cache_aligned_data<std::atomic<std::uint64_t>> head_;
+            util::cache_aligned_data<std::atomic<std::uint64_t>> tail_;
+        };
+
+        std::size_t round_to_power_of_two(std::size_t size) noexcept
+        {
+            std::size_t result = 2;
+            while (result < size)
+            {
+                result <<= 1;
+            }
+            return result;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // The buffers are never released, the worker threads may still touch
+        // them right after the trace has been stopped.
+        struct task_trace_registry
+        {
+            ~task_trace_registry()
+            {
+                // the trace wasn't stopped before the end of the program
+                if (flusher.joinable())
+                {
+                    {
+                        std::lock_guard<std::mutex> l(flush_mtx);
+                        stop_requested = true;
+                    }
+                    cond.notify_one();
+                    flusher.join();
+                }
+            }
+
+            void flush_loop();
+            void flush();
+
+            std::mutex mtx;    // protects buffers
+            std::vector<std::unique_ptr<trace_buffer>> buffers;
+            std::size_t buffer_size = 0;
+
+            std::atomic<std::uint64_t> dropped{0};
+
+            std::mutex flush_mtx;    // protects everything below
+            std::condition_variable cond;
+            bool stop_requested = false;
+            std::thread flusher;
+            std::ofstream out;
+            std::unordered_set<std::uint64_t> names;
+            std::vector<task_trace_record> records;
+        };
+
+        task_trace_registry& get_registry()
+        {
+            static task_trace_registry registry;
+            return registry;
+        }
+
+        trace_buffer* register_buffer()
+        {
+            task_trace_registry& registry = get_registry();
+
+            std::lock_guard<std::mutex> l(registry.mtx);
+            registry.buffers.push_back(
+                std::make_unique<trace_buffer>(registry.buffer_size));
+            return registry.buffers.back().get();
+        }
+
+        trace_buffer& get_buffer()
+        {
+            static thread_local trace_buffer* buffer = register_buffer();
+            return *buffer;
+        }
+
+        void write_name(std::ofstream& out, std::uint64_t id, char const* name)
+        {
+            std::size_t const size = std::strlen(name);
+
+            task_trace_record record{};
+            record.thread_id = size;
+            record.description = id;
+            record.event = static_cast<std::uint8_t>(task_trace_event::name);
+            out.write(reinterpret_cast<char const*>(&record), sizeof(record));
+
+            std::size_t const padding =
+                (sizeof(record) - size % sizeof(record)) % sizeof(record);
+            char const zeros[sizeof(record)] = {};
+            out.write(name, static_cast<std::streamsize>(size));
+            out.write(zeros, static_cast<std::streamsize>(padding));
+        }
+
+        void task_trace_registry::flush()
+        {
+            records.clear();
+            {
+                std::lock_guard<std::mutex> l(mtx);
+                for (auto& buffer : buffers)
+                {
+                    buffer->drain(records);
+                }
+            }
+
+            for (task_trace_record const& record : records)
+            {
+                // the names are static strings, they are written once before
+                // the first record referring to them
+                if (record.event ==
+                        static_cast<std::uint8_t>(task_trace_event::begin) &&
+                    record.description_kind == 0 &&
+                    names.insert(record.description).second)
+                {
+                    write_name(out, record.description,
+                        reinterpret_cast<char const*>(record.description));
+                }
+                out.write(
+                    reinterpret_cast<char const*>(&record), sizeof(record));
+            }
+            out.flush();
+        }
+
+        void task_trace_registry::flush_loop()
+        {
+            std::unique_lock<std::mutex> l(flush_mtx);
+            while (!stop_requested)
+            {
+                cond.wait_for(l, std::chrono::milliseconds(10));
+                flush();
+            }
+        }
+    }    // namespace
+
+    ///////////////////////////////////////////////////////////////////////////
+    void start_task_trace(std::string const& filename, std::size_t buffer_size)
+    {
+        task_trace_registry& registry = get_registry();
+
+        std::lock_guard<std::mutex> l(registry.flush_mtx);
+        if (registry.flusher.joinable())
+        {
+            HPX_THROW_EXCEPTION(bad_parameter, "hpx::threads::start_task_trace",
+                "the task trace is already being recorded");
+        }
+
+        registry.out.open(filename, std::ios::binary | std::ios::trunc);
+        if (!registry.out)
+        {
+            HPX_THROW_EXCEPTION(bad_parameter, "hpx::threads::start_task_trace",
+                "can't open the task trace file: " + filename);
+        }
+
+        task_trace_header header{};
+        std::memcpy(header.magic, "HPXTRACE", sizeof(header.magic));
+        header.version = 1;
+        header.record_size = sizeof(task_trace_record);
+        registry.out.write(
+            reinterpret_cast<char const*>(&header), sizeof(header));
+
+        {
+            // the size applies to the buffers of workers recording their
+            // first event, existing buffers are reused
+            std::lock_guard<std::mutex> ll(registry.mtx);
+            registry.buffer_size =
+                round_to_power_of_two((std::max)(buffer_size, std::size_t(2)));
+
+            // discard the records added after the previous trace was stopped
+            for (auto& buffer : registry.buffers)
+            {
+                buffer->clear();
+            }
+        }
+
+        registry.names.clear();
+        registry.dropped.store(0, std::memory_order_relaxed);
+        registry.stop_requested = false;
+        registry.flusher =
+            std::thread([&registry]() { registry.flush_loop(); });
+
+        detail::task_trace_enabled.store(true, std::memory_order_release);
+    }
+
+    void stop_task_trace()
+    {
+        task_trace_registry& registry = get_registry();
+
+        detail::task_trace_enabled.store(false, std::memory_order_release);
+
+        std::thread flusher;
+        {
+            std::lock_guard<std::mutex> l(registry.flush_mtx);
+            if (!registry.flusher.joinable())
+            {
+                return;
+            }
+            registry.stop_requested = true;
+            flusher = HPX_MOVE(registry.flusher);
+        }
+        registry.cond.notify_one();
+        flusher.join();
+
+        std::lock_guard<std::mutex> l(registry.flush_mtx);
+        registry.flush();
+        registry.out.close();
+    }
+
+    bool is_task_trace_enabled() noexcept
+    {
+        return detail::task_trace_enabled.load(std::memory_order_relaxed);
+    }
+
+    std::uint64_t get_task_trace_dropped_records() noexcept
+    {
+        return get_registry().dropped.load(std::memory_order_relaxed);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    namespace detail {
+        void record_task_event(
+            task_trace_event event, thread_data const* thrd) noexcept
+        {
+            trace_buffer& buffer = get_buffer();
+
+            task_trace_record record{};
+            record.timestamp = hpx::chrono::high_resolution_clock::now();
+            record.thread_id = reinterpret_cast<std::uintptr_t>(thrd);
+            record.worker =
+                static_cast<std::uint32_t>(get_global_thread_num_tss());
+
+            if (event == task_trace_event::begin)
+            {
+                // the last worker number is recorded whenever a thread yields
+                std::size_t const last_worker =
+                    thrd->get_last_worker_thread_num();
+                if (last_worker != std::size_t(-1) &&
+                    last_worker != get_local_thread_num_tss())
+                {
+                    record.event =
+                        static_cast<std::uint8_t>(task_trace_event::steal);
+                    record.description = last_worker;
+                    if (!buffer.push(record))
+                    {
+                        get_registry().dropped.fetch_add(
+                            1, std::memory_order_relaxed);
+                    }
+                }
+
+                util::thread_description const desc = thrd->get_description();
+                if (desc.kind() ==
+                    util::thread_description::data_type_description)
+                {
+                    record.description = reinterpret_cast<std::uintptr_t>(
+                        desc.get_description());
+                    record.description_kind = 0;
+                }
+                else
+                {
+                    record.description = desc.get_address();
+                    record.description_kind = 1;
+                }
+            }
+            else
+            {
+                record.description = 0;
+            }
+
+            record.event = static_cast<std::uint8_t>(event);
+            if (!buffer.push(record))
+            {
+                get_registry().dropped.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+    }    // namespace detail
+}}       // namespace hpx::threads
@@ -43,6 +43,14 @@ namespace hpx { namespace threads {
             // same as naming::invalid_locality_id
             return ~static_cast<std::uint32_t>(0);
         }
+
+        constexpr std::int16_t get_numa_affinity(
+            thread_schedule_hint const& hint) noexcept
+        {
+            return hint.mode == thread_schedule_hint_mode::numa ?
+                hint.hint :
+                std::int16_t(-1);
+        }
     }    // namespace detail
 
     thread_data::thread_data(thread_init_data& init_data, void* queue,
@@ -66,12 +74,14 @@ namespace hpx { namespace threads {
       , backtrace_(nullptr)
 #endif
       , priority_(init_data.priority)
+      , numa_affinity_(detail::get_numa_affinity(init_data.schedulehint))
       , requested_interrupt_(false)
       , enabled_interrupt_(true)
       , ran_exit_funcs_(false)
       , is_stackless_(is_stackless)
       , scheduler_base_(init_data.scheduler_base)
       , last_worker_thread_num_(std::size_t(-1))
+      , queue_timestamp_(0)
       , stacksize_(stacksize)
       , stacksize_enum_(init_data.stacksize)
       , queue_(queue)
@@ -215,12 +225,14 @@ namespace hpx { namespace threads {
         backtrace_ = nullptr;
 #endif
         priority_ = init_data.priority;
+        numa_affinity_ = detail::get_numa_affinity(init_data.schedulehint);
         requested_interrupt_ = false;
         enabled_interrupt_ = true;
         ran_exit_funcs_ = false;
         exit_funcs_.clear();
         scheduler_base_ = init_data.scheduler_base;
         last_worker_thread_num_ = std::size_t(-1);
+        queue_timestamp_ = 0;
 
         // We explicitly set the logical stack size again as it can be different
         // from what the previous use required. However, the physical stack size
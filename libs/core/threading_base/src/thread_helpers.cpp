@@ -15,6 +15,7 @@
 #endif
 #include <hpx/execution_base/this_thread.hpp>
 #include <hpx/threading_base/detail/reset_lco_description.hpp>
+#include <hpx/threading_base/detail/timer_wheel.hpp>
 #include <hpx/threading_base/scheduler_base.hpp>
 #include <hpx/threading_base/scheduler_state.hpp>
 #include <hpx/threading_base/set_thread_state.hpp>
@@ -34,6 +35,7 @@
 #include <limits>
 #include <memory>
 #include <string>
+#include <thread>
 #include <utility>
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -312,6 +314,32 @@ namespace hpx { namespace threads {
         continuation_recursion_count = 0;
     }
 
+    namespace {
+
+        std::size_t continuation_max_recursion_depth =
+            HPX_CONTINUATION_MAX_RECURSION_DEPTH;
+        std::size_t continuation_stack_budget = 8 * HPX_THREADS_STACK_OVERHEAD;
+    }    // namespace
+
+    void set_continuation_limits(
+        std::size_t max_recursion_depth, std::size_t stack_budget) noexcept
+    {
+        continuation_max_recursion_depth = max_recursion_depth;
+        continuation_stack_budget = stack_budget;
+    }
+
+    bool can_run_continuation_inline(std::size_t recursion_depth)
+    {
+        if (recursion_depth > continuation_max_recursion_depth)
+        {
+            return false;
+        }
+
+        // this returns false for non-HPX threads
+        return this_thread::has_sufficient_stack_space(
+            continuation_stack_budget);
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     void run_thread_exit_callbacks(thread_id_type const& id, error_code& ec)
     {
@@ -425,6 +453,23 @@ namespace hpx { namespace threads {
 
 namespace hpx { namespace this_thread {
 
+    namespace {
+
+        // Stackless threads are run to completion and can't give control
+        // back to the thread manager. Any thread they were asked to yield to
+        // is scheduled instead.
+        void schedule_next_thread(threads::thread_id_type nextid)
+        {
+            if (nextid)
+            {
+                auto* scheduler =
+                    get_thread_id_data(nextid)->get_scheduler_base();
+                scheduler->schedule_thread(
+                    HPX_MOVE(nextid), threads::thread_schedule_hint());
+            }
+        }
+    }    // namespace
+
     /// The function \a suspend will return control to the thread manager
     /// (suspends the current thread). It sets the new state of this thread
     /// to the thread state passed as the parameter.
@@ -446,6 +491,25 @@ namespace hpx { namespace this_thread {
         if (ec)
             return threads::thread_restart_state::unknown;
 
+        if (get_thread_id_data(id)->is_stackless())
+        {
+            // yielding a stackless thread simply continues running it
+            if (state != threads::thread_schedule_state::pending)
+            {
+                HPX_THROWS_IF(ec, invalid_status, "suspend",
+                    "thread({}, {}) is stackless and can't be suspended",
+                    id.noref(), threads::get_thread_description(id.noref()));
+                return threads::thread_restart_state::unknown;
+            }
+
+            schedule_next_thread(HPX_MOVE(nextid));
+
+            if (&ec != &throws)
+                ec = make_success_code();
+
+            return threads::thread_restart_state::signaled;
+        }
+
         threads::thread_restart_state statex =
             threads::thread_restart_state::unknown;
 
@@ -518,6 +582,18 @@ namespace hpx { namespace this_thread {
         if (ec)
             return threads::thread_restart_state::unknown;
 
+        if (get_thread_id_data(id)->is_stackless())
+        {
+            // a stackless thread blocks the worker thread while sleeping
+            schedule_next_thread(HPX_MOVE(nextid));
+            std::this_thread::sleep_until(abs_time.value());
+
+            if (&ec != &throws)
+                ec = make_success_code();
+
+            return threads::thread_restart_state::timeout;
+        }
+
         // let the thread manager do other things while waiting
         threads::thread_restart_state statex =
             threads::thread_restart_state::unknown;
@@ -536,48 +612,67 @@ namespace hpx { namespace this_thread {
 #ifdef HPX_HAVE_THREAD_BACKTRACE_ON_SUSPENSION
             threads::detail::reset_backtrace bt(id, ec);
 #endif
-            std::atomic<bool> timer_started(false);
-            threads::thread_id_ref_type timer_id =
-                threads::set_thread_state(id.noref(), abs_time, &timer_started,
-                    threads::thread_schedule_state::pending,
-                    threads::thread_restart_state::timeout,
-                    threads::thread_priority::boost, true, ec);
-            if (ec)
-                return threads::thread_restart_state::unknown;
-
-            // We might need to dispatch 'nextid' to it's correct scheduler
-            // only if our current scheduler is the same, we should yield the id
-            if (nextid &&
-                get_thread_id_data(nextid)->get_scheduler_base() !=
-                    get_thread_id_data(id)->get_scheduler_base())
-            {
-                auto* scheduler =
-                    get_thread_id_data(nextid)->get_scheduler_base();
-                scheduler->schedule_thread(
-                    HPX_MOVE(nextid), threads::thread_schedule_hint());
-                statex = self.yield(threads::thread_result_type(
-                    threads::thread_schedule_state::suspended,
-                    threads::invalid_thread_id));
-            }
-            else
-            {
-                statex = self.yield(threads::thread_result_type(
+            auto yield = [&]() {
+                // We might need to dispatch 'nextid' to it's correct scheduler
+                // only if our current scheduler is the same, we should yield
+                // the id
+                if (nextid &&
+                    get_thread_id_data(nextid)->get_scheduler_base() !=
+                        get_thread_id_data(id)->get_scheduler_base())
+                {
+                    auto* scheduler =
+                        get_thread_id_data(nextid)->get_scheduler_base();
+                    scheduler->schedule_thread(
+                        HPX_MOVE(nextid), threads::thread_schedule_hint());
+                    return self.yield(threads::thread_result_type(
+                        threads::thread_schedule_state::suspended,
+                        threads::invalid_thread_id));
+                }
+                return self.yield(threads::thread_result_type(
                     threads::thread_schedule_state::suspended,
                     HPX_MOVE(nextid)));
-            }
+            };
+
+            // prefer the timer wheel of this worker thread, which does not
+            // need a helper thread and a timer of the timer service
+            threads::detail::timer_wheel_entry timer(id, abs_time.value(),
+                threads::thread_schedule_state::pending,
+                threads::thread_restart_state::timeout,
+                threads::thread_priority::boost);
+            if (get_thread_id_data(id)->get_scheduler_base()->schedule_timer(
+                    timer))
+            {
+                statex = yield();
 
-            if (statex != threads::thread_restart_state::timeout)
+                // make sure the timer doesn't refer to this thread anymore
+                threads::detail::cancel_timer(timer);
+            }
+            else
             {
-                HPX_ASSERT(statex == threads::thread_restart_state::abort ||
-                    statex == threads::thread_restart_state::signaled);
-                error_code ec1(throwmode::lightweight);    // do not throw
-                hpx::util::yield_while(
-                    [&timer_started]() { return !timer_started.load(); },
-                    "set_thread_state_timed");
-                threads::set_thread_state(timer_id.noref(),
-                    threads::thread_schedule_state::pending,
-                    threads::thread_restart_state::abort,
-                    threads::thread_priority::boost, true, ec1);
+                std::atomic<bool> timer_started(false);
+                threads::thread_id_ref_type timer_id =
+                    threads::set_thread_state(id.noref(), abs_time,
+                        &timer_started, threads::thread_schedule_state::pending,
+                        threads::thread_restart_state::timeout,
+                        threads::thread_priority::boost, true, ec);
+                if (ec)
+                    return threads::thread_restart_state::unknown;
+
+                statex = yield();
+
+                if (statex != threads::thread_restart_state::timeout)
+                {
+                    HPX_ASSERT(statex == threads::thread_restart_state::abort ||
+                        statex == threads::thread_restart_state::signaled);
+                    error_code ec1(throwmode::lightweight);    // do not throw
+                    hpx::util::yield_while(
+                        [&timer_started]() { return !timer_started.load(); },
+                        "set_thread_state_timed");
+                    threads::set_thread_state(timer_id.noref(),
+                        threads::thread_schedule_state::pending,
+                        threads::thread_restart_state::abort,
+                        threads::thread_priority::boost, true, ec1);
+                }
             }
         }
 
@@ -64,6 +64,13 @@ namespace hpx { namespace threads {
         return topo.cpuset_to_nodeset(used_processing_units);
     }
 
+    std::size_t thread_pool_base::get_numa_domain(std::size_t num_thread) const
+    {
+        auto const& topo = create_topology();
+        return topo.get_numa_node_number(
+            affinity_data_.get_pu_num(num_thread + get_thread_offset()));
+    }
+
     std::size_t thread_pool_base::get_active_os_thread_count() const
     {
         std::size_t active_os_thread_count = 0;
@@ -81,6 +88,19 @@ namespace hpx { namespace threads {
         return active_os_thread_count;
     }
 
+    void thread_pool_base::create_work_n(
+        thread_init_data* data, std::size_t count, error_code& ec)
+    {
+        for (std::size_t i = 0; i != count; ++i)
+        {
+            create_work(data[i], ec);
+            if (ec)
+            {
+                return;
+            }
+        }
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     void thread_pool_base::init_pool_time_scale()
     {
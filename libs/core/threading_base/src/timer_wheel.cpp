@@ -0,0 +1,314 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/execution_base/this_thread.hpp>
+#include <hpx/threading_base/detail/timer_wheel.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+
+namespace hpx { namespace threads { namespace detail {
+
+    namespace {
+
+        constexpr std::uint64_t slot_mask = timer_wheel::num_slots - 1;
+
+        // the first tick starting at or after the given time
+        std::uint64_t to_tick_ceil(
+            std::chrono::steady_clock::time_point const& t) noexcept
+        {
+            std::int64_t const ns =
+                std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    t.time_since_epoch())
+                    .count();
+            if (ns <= 0)
+            {
+                return 0;
+            }
+            std::uint64_t const tick_ns = std::uint64_t(1)
+                << timer_wheel::tick_bits;
+            return (std::uint64_t(ns) + tick_ns - 1) >> timer_wheel::tick_bits;
+        }
+
+        std::chrono::steady_clock::time_point from_tick(
+            std::uint64_t tick) noexcept
+        {
+            return std::chrono::steady_clock::time_point(
+                std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                    std::chrono::nanoseconds(
+                        std::int64_t(tick << timer_wheel::tick_bits))));
+        }
+    }    // namespace
+
+    ///////////////////////////////////////////////////////////////////////////
+    timer_wheel::timer_wheel()
+      : current_(to_tick(std::chrono::steady_clock::now()))
+    {
+    }
+
+    timer_wheel::~timer_wheel()
+    {
+        for (auto& level : slots_)
+        {
+            for (timer_wheel_entry*& head : level)
+            {
+                while (head != nullptr)
+                {
+                    timer_wheel_entry* next = head->next_;
+                    head->linked_ = false;
+                    if (head->delete_on_expiry_)
+                    {
+                        delete head;
+                    }
+                    head = next;
+                }
+            }
+        }
+    }
+
+    // Link the entry into the slot for its tick relative to the current
+    // tick, entries which are already due go into the current slot.
+    void timer_wheel::link(timer_wheel_entry& entry) noexcept
+    {
+        std::uint64_t const current = current_.load(std::memory_order_relaxed);
+        std::uint64_t const tick = (std::max)(entry.tick_, current);
+
+        std::size_t level = 0;
+        while (level != num_levels - 1 &&
+            (tick >> (slot_bits * (level + 1))) !=
+                (current >> (slot_bits * (level + 1))))
+        {
+            ++level;
+        }
+
+        std::size_t slot = 0;
+        if ((tick >> (slot_bits * num_levels)) !=
+            (current >> (slot_bits * num_levels)))
+        {
+            // beyond the range of the wheel, park the entry in the top level
+            // slot reached last, it is moved again when that slot is
+            // processed
+            slot = std::size_t(
+                ((current >> (slot_bits * (num_levels - 1))) - 1) & slot_mask);
+        }
+        else
+        {
+            slot = std::size_t((tick >> (slot_bits * level)) & slot_mask);
+        }
+
+        entry.level_ = level;
+        entry.slot_ = slot;
+        entry.prev_ = nullptr;
+        entry.next_ = slots_[level][slot];
+        if (entry.next_ != nullptr)
+        {
+            entry.next_->prev_ = &entry;
+        }
+        slots_[level][slot] = &entry;
+        ++counts_[level];
+    }
+
+    void timer_wheel::unlink(timer_wheel_entry& entry) noexcept
+    {
+        if (entry.prev_ != nullptr)
+        {
+            entry.prev_->next_ = entry.next_;
+        }
+        else
+        {
+            slots_[entry.level_][entry.slot_] = entry.next_;
+        }
+
+        if (entry.next_ != nullptr)
+        {
+            entry.next_->prev_ = entry.prev_;
+        }
+
+        entry.prev_ = nullptr;
+        entry.next_ = nullptr;
+        --counts_[entry.level_];
+    }
+
+    // Move the entries of the current slot of the given level down
+    void timer_wheel::cascade(std::size_t level) noexcept
+    {
+        std::size_t const slot =
+            std::size_t((current_.load(std::memory_order_relaxed) >>
+                            (slot_bits * level)) &
+                slot_mask);
+
+        timer_wheel_entry* entry = slots_[level][slot];
+        slots_[level][slot] = nullptr;
+
+        while (entry != nullptr)
+        {
+            timer_wheel_entry* next = entry->next_;
+            --counts_[level];
+            link(*entry);
+            entry = next;
+        }
+    }
+
+    void timer_wheel::insert(timer_wheel_entry& entry)
+    {
+        HPX_ASSERT(!entry.linked_);
+
+        entry.wheel_ = this;
+        entry.tick_ = to_tick_ceil(entry.abs_time_);
+
+        std::lock_guard<hpx::util::detail::spinlock> l(mtx_);
+
+        if (size_.load(std::memory_order_relaxed) == 0)
+        {
+            // nothing had to be processed while the wheel was empty
+            std::uint64_t const now =
+                to_tick(std::chrono::steady_clock::now());
+            if (now > current_.load(std::memory_order_relaxed))
+            {
+                current_.store(now, std::memory_order_relaxed);
+            }
+        }
+
+        link(entry);
+        entry.linked_ = true;
+        size_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    bool timer_wheel::cancel(timer_wheel_entry& entry)
+    {
+        std::lock_guard<hpx::util::detail::spinlock> l(mtx_);
+
+        if (!entry.linked_)
+        {
+            return false;
+        }
+
+        unlink(entry);
+        entry.linked_ = false;
+        size_.fetch_sub(1, std::memory_order_relaxed);
+        return true;
+    }
+
+    timer_wheel_entry* timer_wheel::expire(
+        std::chrono::steady_clock::time_point const& now)
+    {
+        std::uint64_t const now_tick = to_tick(now);
+        timer_wheel_entry* expired = nullptr;
+
+        std::lock_guard<hpx::util::detail::spinlock> l(mtx_);
+
+        std::uint64_t current = current_.load(std::memory_order_relaxed);
+        while (
+            current <= now_tick && size_.load(std::memory_order_relaxed) != 0)
+        {
+            if (counts_[0] == 0)
+            {
+                // skip the empty remainder of the lowest level
+                std::uint64_t const next = (current | slot_mask) + 1;
+                if (next > now_tick + 1)
+                {
+                    current = now_tick + 1;
+                    current_.store(current, std::memory_order_relaxed);
+                    break;
+                }
+                current = next;
+            }
+            else
+            {
+                std::size_t const slot = std::size_t(current & slot_mask);
+                timer_wheel_entry* entry = slots_[0][slot];
+                slots_[0][slot] = nullptr;
+
+                while (entry != nullptr)
+                {
+                    timer_wheel_entry* next = entry->next_;
+                    --counts_[0];
+                    size_.fetch_sub(1, std::memory_order_relaxed);
+
+                    entry->linked_ = false;
+                    entry->prev_ = nullptr;
+                    entry->next_ = expired;
+                    expired = entry;
+
+                    entry = next;
+                }
+
+                ++current;
+            }
+
+            current_.store(current, std::memory_order_relaxed);
+
+            // the lowest level wrapped around, move entries down from the
+            // higher levels, starting at the highest one which wrapped
+            if ((current & slot_mask) == 0)
+            {
+                std::size_t level = 1;
+                while (level != num_levels - 1 &&
+                    ((current >> (slot_bits * level)) & slot_mask) == 0)
+                {
+                    ++level;
+                }
+
+                for (/**/; level != 0; --level)
+                {
+                    cascade(level);
+                }
+            }
+        }
+
+        if (size_.load(std::memory_order_relaxed) == 0 && current <= now_tick)
+        {
+            current_.store(now_tick + 1, std::memory_order_relaxed);
+        }
+
+        return expired;
+    }
+
+    std::chrono::steady_clock::time_point timer_wheel::next_expiry() const
+    {
+        std::lock_guard<hpx::util::detail::spinlock> l(mtx_);
+
+        if (size_.load(std::memory_order_relaxed) == 0)
+        {
+            return (std::chrono::steady_clock::time_point::max)();
+        }
+
+        std::uint64_t const current = current_.load(std::memory_order_relaxed);
+        if (counts_[0] != 0)
+        {
+            // all entries of the lowest level expire in the current round
+            for (std::uint64_t slot = current & slot_mask; slot != num_slots;
+                 ++slot)
+            {
+                if (slots_[0][slot] != nullptr)
+                {
+                    return from_tick((current & ~slot_mask) | slot);
+                }
+            }
+        }
+
+        // entries of the higher levels are moved down at the next wrap
+        // around of the lowest level at the earliest
+        return from_tick((current | slot_mask) + 1);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    void cancel_timer(timer_wheel_entry& entry)
+    {
+        if (entry.wheel_ != nullptr && !entry.wheel_->cancel(entry))
+        {
+            // the timer has expired, wait for the state change to finish as
+            // it still refers to the entry
+            hpx::util::yield_while(
+                [&entry]() { return !entry.expired(); }, "cancel_timer");
+        }
+    }
+}}}    // namespace hpx::threads::detail
@@ -0,0 +1,110 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/concurrency/spinlock.hpp>
+#include <hpx/threading_base/worker_local.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace hpx { namespace threads { namespace detail {
+
+    namespace {
+
+        struct worker_local_entry
+        {
+            void* data;
+            std::uint64_t generation;
+        };
+
+        // this lives next to the thread numbers of the worker (see
+        // thread_num_tss.cpp)
+        std::vector<worker_local_entry>& worker_local_entries()
+        {
+            static thread_local std::vector<worker_local_entry> entries;
+            return entries;
+        }
+
+        struct worker_local_slots
+        {
+            util::spinlock mtx;
+            std::uint64_t generation = 0;
+            std::size_t size = 0;
+            std::vector<std::size_t> free_slots;
+        };
+
+        worker_local_slots& get_worker_local_slots()
+        {
+            static worker_local_slots slots;
+            return slots;
+        }
+    }    // namespace
+
+    worker_local_slot allocate_worker_local_slot()
+    {
+        worker_local_slots& slots = get_worker_local_slots();
+        std::lock_guard<util::spinlock> l(slots.mtx);
+
+        // generation zero marks unused entries
+        worker_local_slot slot{0, ++slots.generation};
+        if (slots.free_slots.empty())
+        {
+            slot.index = slots.size++;
+        }
+        else
+        {
+            slot.index = slots.free_slots.back();
+            slots.free_slots.pop_back();
+        }
+        return slot;
+    }
+
+    void release_worker_local_slot(worker_local_slot const& slot) noexcept
+    {
+        worker_local_slots& slots = get_worker_local_slots();
+        std::lock_guard<util::spinlock> l(slots.mtx);
+
+        try
+        {
+            slots.free_slots.push_back(slot.index);
+        }
+        catch (...)
+        {
+            // the slot is not reused
+        }
+    }
+
+    void* get_worker_local_data(worker_local_slot const& slot) noexcept
+    {
+        std::vector<worker_local_entry> const& entries =
+            worker_local_entries();
+        if (slot.index < entries.size())
+        {
+            worker_local_entry const& entry = entries[slot.index];
+            if (entry.generation == slot.generation)
+            {
+                return entry.data;
+            }
+        }
+        return nullptr;
+    }
+
+    void set_worker_local_data(worker_local_slot const& slot, void* data)
+    {
+        HPX_ASSERT(slot.generation != 0);
+
+        std::vector<worker_local_entry>& entries = worker_local_entries();
+        if (slot.index >= entries.size())
+        {
+            entries.resize(slot.index + 1, worker_local_entry{nullptr, 0});
+        }
+        entries[slot.index] = worker_local_entry{data, slot.generation};
+    }
+}}}    // namespace hpx::threads::detail
@@ -76,7 +76,11 @@ int main(int argc, char** argv)
         "abp-priority-fifo",
         "abp-priority-lifo",
 #endif
-        "shared-priority"
+        "shared-priority",
+        "local-workrequesting-fifo",
+#if defined(HPX_HAVE_CXX11_STD_ATOMIC_128BIT)
+        "local-workrequesting-lifo",
+#endif
     };
     // clang-format on
     for (auto const& scheduler : schedulers)
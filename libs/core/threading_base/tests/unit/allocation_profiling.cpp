@@ -0,0 +1,144 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/local/functional.hpp>
+#include <hpx/local/future.hpp>
+#include <hpx/local/init.hpp>
+#include <hpx/local/runtime.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/modules/threading_base.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#if defined(HPX_HAVE_ALLOCATION_PROFILING)
+using hpx::threads::task_profile_value;
+
+#if defined(HPX_HAVE_THREAD_DESCRIPTION)
+char const* const allocating = "allocation_profiling_test_allocating";
+#else
+char const* const allocating = "<unknown>";
+#endif
+
+std::size_t const allocation_size = 1000;
+std::size_t const large_allocation_size = 4 * 1024 * 1024;
+
+// keeps the compiler from eliding the allocations
+std::atomic<char*> sink(nullptr);
+
+void allocate(std::size_t size)
+{
+    std::unique_ptr<char[]> p(new char[size]);
+    sink.store(p.get());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_allocation_counts(std::size_t num_tasks)
+{
+    hpx::threads::get_task_profiles(true);
+    hpx::threads::get_allocation_counts(std::size_t(-1), true);
+    hpx::threads::enable_allocation_profiling();
+    hpx::threads::enable_task_profiling();
+    HPX_TEST(hpx::threads::is_allocation_profiling_enabled());
+
+    std::vector<hpx::future<void>> futures;
+    futures.reserve(num_tasks);
+    for (std::size_t i = 0; i != num_tasks; ++i)
+    {
+        futures.push_back(hpx::async(hpx::annotated_function(
+            []() { allocate(allocation_size); }, allocating)));
+    }
+    hpx::wait_all(futures);
+
+    hpx::threads::enable_task_profiling(false);
+    hpx::threads::enable_allocation_profiling(false);
+    HPX_TEST(!hpx::threads::is_allocation_profiling_enabled());
+
+    hpx::threads::allocation_counts const total =
+        hpx::threads::get_allocation_counts();
+    HPX_TEST_LTE(std::uint64_t(num_tasks), total.count);
+    HPX_TEST_LTE(std::uint64_t(num_tasks * allocation_size), total.bytes);
+
+    // the allocations of the worker threads are part of the total
+    hpx::threads::allocation_counts workers;
+    std::size_t const num_threads = hpx::get_os_thread_count();
+    for (std::size_t i = 0; i != num_threads; ++i)
+    {
+        hpx::threads::allocation_counts const counts =
+            hpx::threads::get_allocation_counts(i);
+        workers.count += counts.count;
+        workers.bytes += counts.bytes;
+    }
+    HPX_TEST_LTE(workers.count, total.count);
+    HPX_TEST_LTE(workers.bytes, total.bytes);
+
+    // the futures may become ready before their threads have terminated
+    std::int64_t const count = hpx::threads::get_task_profile_value(
+        allocating, task_profile_value::count);
+    HPX_TEST_LTE(count,
+        hpx::threads::get_task_profile_value(
+            allocating, task_profile_value::allocations));
+    HPX_TEST_LTE(count * std::int64_t(allocation_size),
+        hpx::threads::get_task_profile_value(
+            allocating, task_profile_value::allocated_bytes));
+
+    // resetting keeps counting from the current values
+    hpx::threads::get_allocation_counts(std::size_t(-1), true);
+    HPX_TEST_EQ(hpx::threads::get_allocation_counts().count, std::uint64_t(0));
+}
+
+void test_allocation_backtraces()
+{
+    hpx::threads::get_allocation_backtraces(true);
+    hpx::threads::set_allocation_backtrace_threshold(large_allocation_size);
+    hpx::threads::enable_allocation_profiling();
+
+    hpx::async(hpx::annotated_function(
+                   []() { allocate(large_allocation_size); }, allocating))
+        .get();
+    allocate(allocation_size);
+
+    hpx::threads::enable_allocation_profiling(false);
+    hpx::threads::set_allocation_backtrace_threshold(0);
+
+    bool found = false;
+    for (auto const& bt : hpx::threads::get_allocation_backtraces(true))
+    {
+        HPX_TEST_LTE(large_allocation_size, bt.size);
+        if (bt.annotation == allocating)
+        {
+            HPX_TEST(!bt.backtrace.empty());
+            found = true;
+        }
+    }
+    HPX_TEST(found);
+    HPX_TEST(hpx::threads::get_allocation_backtraces().empty());
+}
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+#if defined(HPX_HAVE_ALLOCATION_PROFILING)
+    test_allocation_counts(10);
+    test_allocation_counts(1000);
+    test_allocation_backtraces();
+#endif
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
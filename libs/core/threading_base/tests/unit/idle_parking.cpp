@@ -0,0 +1,89 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify that idle worker threads are woken up for new work, both in idle
+// parking and in exponential idle backoff mode. The idle times are configured
+// to be long, a missing wake up makes the test time out.
+
+#include <hpx/local/chrono.hpp>
+#include <hpx/local/future.hpp>
+#include <hpx/local/init.hpp>
+#include <hpx/local/thread.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/modules/threading_base.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <vector>
+
+using hpx::threads::policies::scheduler_mode;
+
+///////////////////////////////////////////////////////////////////////////////
+// All tasks have to run concurrently, which requires all worker threads to be
+// woken up.
+void test_wake_up(std::size_t num_threads)
+{
+    // give the other worker threads the chance to go idle
+    hpx::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+    hpx::chrono::high_resolution_timer t;
+
+    std::atomic<std::size_t> arrived(0);
+    auto task = [&]() {
+        ++arrived;
+        while (arrived.load() != num_threads)
+        {
+            // block the worker thread
+        }
+    };
+
+    std::vector<hpx::future<void>> tasks;
+    for (std::size_t i = 1; i != num_threads; ++i)
+    {
+        tasks.push_back(hpx::async(task));
+    }
+    task();
+
+    hpx::wait_all(tasks);
+
+    // the idle time is configured to be 10 seconds
+    HPX_TEST_LT(t.elapsed(), 5.0);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    auto* pool = hpx::threads::detail::get_self_or_default_pool();
+    auto* scheduler = pool->get_scheduler();
+    std::size_t const num_threads = pool->get_os_thread_count();
+
+    scheduler->add_scheduler_mode(scheduler_mode::enable_idle_backoff |
+        scheduler_mode::enable_idle_parking);
+    for (int i = 0; i != 10; ++i)
+    {
+        test_wake_up(num_threads);
+    }
+
+    scheduler->remove_scheduler_mode(scheduler_mode::enable_idle_parking);
+    for (int i = 0; i != 10; ++i)
+    {
+        test_wake_up(num_threads);
+    }
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    hpx::local::init_params init_args;
+    init_args.cfg = {"hpx.max_idle_backoff_time=10000"};
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
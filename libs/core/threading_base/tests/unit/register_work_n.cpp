@@ -0,0 +1,95 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/local/init.hpp>
+#include <hpx/local/latch.hpp>
+#include <hpx/local/thread.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/modules/threading_base.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+using hpx::threads::make_thread_function_nullary;
+using hpx::threads::register_work_n;
+using hpx::threads::thread_init_data;
+using hpx::threads::thread_priority;
+using hpx::threads::thread_schedule_hint;
+
+///////////////////////////////////////////////////////////////////////////////
+void test_register_work_n(std::size_t num_tasks)
+{
+    auto* pool = hpx::threads::detail::get_self_or_default_pool();
+    std::size_t const num_threads = pool->get_os_thread_count();
+
+    std::atomic<std::size_t> count(0);
+    hpx::latch l(static_cast<std::ptrdiff_t>(num_tasks + 1));
+
+    thread_priority const priorities[] = {thread_priority::default_,
+        thread_priority::normal, thread_priority::low, thread_priority::high};
+
+    std::vector<thread_init_data> tasks;
+    tasks.reserve(num_tasks);
+    for (std::size_t i = 0; i != num_tasks; ++i)
+    {
+        // alternate between tasks with and without a hint
+        thread_schedule_hint hint;
+        if (i % 2 == 0)
+        {
+            hint = thread_schedule_hint(
+                static_cast<std::int16_t>((i / 2) % num_threads));
+        }
+
+        tasks.emplace_back(make_thread_function_nullary([&]() {
+            ++count;
+            l.count_down(1);
+        }),
+            "test_register_work_n", priorities[i % 4], hint);
+    }
+
+    register_work_n(tasks.data(), tasks.size(), pool);
+
+    l.arrive_and_wait();
+    HPX_TEST_EQ(count.load(), num_tasks);
+}
+
+void test_register_work_n_invalid_state()
+{
+    auto* pool = hpx::threads::detail::get_self_or_default_pool();
+
+    std::vector<thread_init_data> tasks;
+    tasks.emplace_back(make_thread_function_nullary([]() {}),
+        "test_register_work_n_invalid_state", thread_priority::normal,
+        thread_schedule_hint(), hpx::threads::thread_stacksize::default_,
+        hpx::threads::thread_schedule_state::suspended);
+
+    hpx::error_code ec(hpx::throwmode::lightweight);
+    register_work_n(tasks.data(), tasks.size(), pool, ec);
+    HPX_TEST(ec);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    test_register_work_n(0);
+    test_register_work_n(1);
+    test_register_work_n(7);
+    test_register_work_n(1000);
+
+    test_register_work_n_invalid_state();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
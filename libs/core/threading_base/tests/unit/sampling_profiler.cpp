@@ -0,0 +1,103 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/local/functional.hpp>
+#include <hpx/local/future.hpp>
+#include <hpx/local/init.hpp>
+#include <hpx/local/thread.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/modules/threading_base.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#if defined(HPX_HAVE_THREAD_DESCRIPTION)
+char const* const busy = "sampling_profiler_test_busy";
+#else
+// all threads share the same description
+char const* const busy = "<unknown>";
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+void spin(std::chrono::milliseconds duration)
+{
+    auto const end = std::chrono::steady_clock::now() + duration;
+    while (std::chrono::steady_clock::now() < end)
+    {
+    }
+}
+
+void test_sampling_profiler(bool stacks)
+{
+    hpx::threads::get_sampling_profile(true);
+    hpx::threads::start_sampling_profiler(
+        std::chrono::microseconds(100), stacks, "root");
+    HPX_TEST(hpx::threads::is_sampling_profiler_running());
+
+    // the profiler can't be started twice
+    bool caught_exception = false;
+    try
+    {
+        hpx::threads::start_sampling_profiler();
+    }
+    catch (hpx::exception const& e)
+    {
+        HPX_TEST_EQ(e.get_error(), hpx::error::bad_parameter);
+        caught_exception = true;
+    }
+    HPX_TEST(caught_exception);
+
+    std::vector<hpx::future<void>> futures;
+    for (std::size_t i = 0; i != 8; ++i)
+    {
+        futures.push_back(hpx::async(hpx::annotated_function(
+            []() { spin(std::chrono::milliseconds(50)); }, busy)));
+    }
+    hpx::wait_all(futures);
+
+    hpx::threads::stop_sampling_profiler();
+    HPX_TEST(!hpx::threads::is_sampling_profiler_running());
+
+    std::uint64_t busy_samples = 0;
+    std::string const prefix = std::string("root;") + busy;
+    for (auto const& stack : hpx::threads::get_sampling_profile())
+    {
+        HPX_TEST_EQ(stack.first.compare(0, 5, "root;"), 0);
+        HPX_TEST_LT(std::uint64_t(0), stack.second);
+        if (stack.first.compare(0, prefix.size(), prefix) == 0)
+        {
+            busy_samples += stack.second;
+        }
+    }
+    HPX_TEST_LT(std::uint64_t(0), busy_samples);
+
+    // the folded stacks are written one per line, followed by their count
+    std::ostringstream os;
+    hpx::threads::write_sampling_profile(os, true);
+    HPX_TEST_NEQ(os.str().find(prefix), std::string::npos);
+    HPX_TEST(hpx::threads::get_sampling_profile().empty());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    test_sampling_profiler(false);
+    test_sampling_profiler(true);
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,124 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/local/init.hpp>
+#include <hpx/local/thread.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/modules/threading_base.hpp>
+#include <hpx/threading_base/set_thread_state.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+#include <vector>
+
+using hpx::threads::thread_id_type;
+using hpx::threads::thread_restart_state;
+using hpx::threads::thread_schedule_state;
+
+///////////////////////////////////////////////////////////////////////////////
+// Suspend num_threads threads and wake all of them using set_thread_state_n,
+// the list of ids handed to it contains a null id in the middle.
+template <typename F>
+void test_set_thread_state_n(std::size_t num_threads, F&& wake_up)
+{
+    std::mutex mtx;
+    std::vector<thread_id_type> ids;
+    std::atomic<std::size_t> signaled(0);
+
+    std::vector<hpx::thread> threads;
+    for (std::size_t i = 0; i != num_threads; ++i)
+    {
+        threads.emplace_back([&]() {
+            {
+                std::lock_guard<std::mutex> l(mtx);
+                ids.push_back(hpx::threads::get_self_id());
+            }
+            if (hpx::this_thread::suspend(thread_schedule_state::suspended) ==
+                thread_restart_state::signaled)
+            {
+                ++signaled;
+            }
+        });
+    }
+
+    // wait for all threads to be suspended
+    for (std::size_t i = 0; i != num_threads; /**/)
+    {
+        std::unique_lock<std::mutex> l(mtx);
+        if (i == ids.size() ||
+            hpx::threads::get_thread_state(ids[i]).state() !=
+                thread_schedule_state::suspended)
+        {
+            l.unlock();
+            hpx::this_thread::yield();
+            continue;
+        }
+        ++i;
+    }
+
+    ids.insert(ids.begin() + ids.size() / 2, hpx::threads::invalid_thread_id);
+    wake_up(ids);
+
+    // all threads were woken up despite the error
+    for (auto& t : threads)
+        t.join();
+
+    HPX_TEST_EQ(signaled.load(), num_threads);
+}
+
+void test_report_error(std::size_t num_threads)
+{
+    test_set_thread_state_n(
+        num_threads, [](std::vector<thread_id_type> const& ids) {
+            hpx::error_code ec(hpx::throwmode::lightweight);
+            hpx::threads::detail::set_thread_state_n(ids.data(), ids.size(),
+                thread_restart_state::signaled, ec);
+
+            HPX_TEST(ec);
+            HPX_TEST_EQ(ec.value(), hpx::error::null_thread_id);
+        });
+}
+
+void test_throw_error(std::size_t num_threads)
+{
+    test_set_thread_state_n(
+        num_threads, [](std::vector<thread_id_type> const& ids) {
+            bool caught_exception = false;
+            try
+            {
+                hpx::threads::detail::set_thread_state_n(
+                    ids.data(), ids.size(), thread_restart_state::signaled);
+                HPX_TEST(false);
+            }
+            catch (hpx::exception const& e)
+            {
+                HPX_TEST_EQ(e.get_error(), hpx::error::null_thread_id);
+                caught_exception = true;
+            }
+            HPX_TEST(caught_exception);
+        });
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    test_report_error(1);
+    test_report_error(10);
+    test_throw_error(1);
+    test_throw_error(10);
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,182 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/local/functional.hpp>
+#include <hpx/local/future.hpp>
+#include <hpx/local/init.hpp>
+#include <hpx/local/thread.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/modules/threading_base.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+using hpx::threads::task_profile_value;
+
+#if defined(HPX_HAVE_THREAD_DESCRIPTION)
+char const* const yielding = "task_profiles_test_yielding";
+char const* const plain = "task_profiles_test_plain";
+#else
+// all threads share the same description
+char const* const yielding = "<unknown>";
+char const* const plain = "<unknown>";
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+void test_task_profiles(std::size_t num_tasks)
+{
+    hpx::threads::get_task_profiles(true);
+    hpx::threads::enable_task_profiling();
+    HPX_TEST(hpx::threads::is_task_profiling_enabled());
+
+    std::vector<hpx::future<void>> futures;
+    futures.reserve(2 * num_tasks);
+    for (std::size_t i = 0; i != num_tasks; ++i)
+    {
+        futures.push_back(hpx::async(hpx::annotated_function(
+            []() { hpx::this_thread::yield(); }, yielding)));
+        futures.push_back(
+            hpx::async(hpx::annotated_function([]() {}, plain)));
+    }
+    hpx::wait_all(futures);
+
+    hpx::threads::enable_task_profiling(false);
+    HPX_TEST(!hpx::threads::is_task_profiling_enabled());
+
+    std::int64_t const count = hpx::threads::get_task_profile_value(
+        yielding, task_profile_value::count);
+    std::int64_t const suspensions = hpx::threads::get_task_profile_value(
+        yielding, task_profile_value::suspensions);
+    std::int64_t const time = hpx::threads::get_task_profile_value(
+        yielding, task_profile_value::time);
+    std::int64_t const average = hpx::threads::get_task_profile_value(
+        yielding, task_profile_value::average);
+    std::int64_t const max = hpx::threads::get_task_profile_value(
+        yielding, task_profile_value::max);
+
+#if defined(HPX_HAVE_THREAD_DESCRIPTION)
+    // the futures may become ready before their threads have terminated
+    HPX_TEST_LTE(count, std::int64_t(num_tasks));
+    HPX_TEST_LTE(suspensions, std::int64_t(num_tasks));
+    HPX_TEST_LTE(hpx::threads::get_task_profile_value(
+                     plain, task_profile_value::suspensions),
+        std::int64_t(0));
+#endif
+    HPX_TEST_LT(std::int64_t(0), suspensions);
+    HPX_TEST_LTE(max, time);
+    HPX_TEST_LTE(average, time);
+
+    bool found = false;
+    for (auto const& profile : hpx::threads::get_task_profiles())
+    {
+        if (profile.name == yielding)
+        {
+            HPX_TEST_EQ(profile.count, std::uint64_t(count));
+            HPX_TEST_EQ(profile.suspensions, std::uint64_t(suspensions));
+            found = true;
+        }
+    }
+    HPX_TEST(found);
+
+    // resetting one value keeps the others
+    hpx::threads::get_task_profile_value(
+        yielding, task_profile_value::count, true);
+    HPX_TEST_EQ(hpx::threads::get_task_profile_value(
+                    yielding, task_profile_value::count),
+        std::int64_t(0));
+    HPX_TEST_EQ(hpx::threads::get_task_profile_value(
+                    yielding, task_profile_value::suspensions),
+        suspensions);
+
+    hpx::threads::get_task_profiles(true);
+    HPX_TEST_EQ(hpx::threads::get_task_profile_value(
+                    yielding, task_profile_value::suspensions),
+        std::int64_t(0));
+    HPX_TEST_EQ(hpx::threads::get_task_profile_value(
+                    "task_profiles_test_nonexistent", task_profile_value::time),
+        std::int64_t(0));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// every read advances the first counter of the calling OS thread by one, the
+// second by two
+struct test_sampler : hpx::threads::task_counter_sampler
+{
+    std::size_t size() const noexcept override
+    {
+        return 2;
+    }
+
+    bool read(std::int64_t* values) noexcept override
+    {
+        static thread_local std::int64_t reads = 0;
+        ++reads;
+        values[0] = reads;
+        values[1] = 2 * reads;
+        return true;
+    }
+};
+
+void test_task_counter_sampling(std::size_t num_tasks, std::size_t interval)
+{
+    hpx::threads::get_task_profiles(true);
+    hpx::threads::set_task_counter_sampler(
+        std::make_shared<test_sampler>(), interval);
+    hpx::threads::enable_task_profiling();
+
+    std::vector<hpx::future<void>> futures;
+    futures.reserve(num_tasks);
+    for (std::size_t i = 0; i != num_tasks; ++i)
+    {
+        futures.push_back(
+            hpx::async(hpx::annotated_function([]() {}, plain)));
+    }
+    hpx::wait_all(futures);
+
+    hpx::threads::enable_task_profiling(false);
+    hpx::threads::set_task_counter_sampler(nullptr);
+
+    std::int64_t const samples = hpx::threads::get_task_profile_value(
+        plain, task_profile_value::samples);
+    std::int64_t const count =
+        hpx::threads::get_task_profile_value(plain, task_profile_value::count);
+
+    HPX_TEST_LTE(samples, count);
+    if (interval == 1)
+    {
+        HPX_TEST_LT(std::int64_t(0), samples);
+    }
+    HPX_TEST_EQ(hpx::threads::get_task_profile_counter(plain, 0), samples);
+    HPX_TEST_EQ(
+        hpx::threads::get_task_profile_counter(plain, 1), 2 * samples);
+    HPX_TEST_EQ(hpx::threads::get_task_profile_counter(plain, 2), 0);
+
+    hpx::threads::get_task_profile_counter(plain, 0, true);
+    HPX_TEST_EQ(hpx::threads::get_task_profile_counter(plain, 0), 0);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    test_task_profiles(10);
+    test_task_profiles(1000);
+
+    test_task_counter_sampling(1000, 1);
+    test_task_counter_sampling(1000, 7);
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,178 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/local/future.hpp>
+#include <hpx/local/init.hpp>
+#include <hpx/local/thread.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/modules/threading_base.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+using hpx::threads::task_trace_event;
+using hpx::threads::task_trace_header;
+using hpx::threads::task_trace_record;
+
+std::string const filename = "task_trace_test.bin";
+
+///////////////////////////////////////////////////////////////////////////////
+std::vector<task_trace_record> read_trace(std::size_t& names)
+{
+    std::ifstream in(filename, std::ios::binary);
+    std::vector<char> data(
+        (std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+
+    HPX_TEST(data.size() >= sizeof(task_trace_header));
+
+    task_trace_header header;
+    std::memcpy(&header, data.data(), sizeof(header));
+    HPX_TEST(std::memcmp(header.magic, "HPXTRACE", 8) == 0);
+    HPX_TEST_EQ(header.version, std::uint32_t(1));
+    HPX_TEST_EQ(header.record_size, std::uint32_t(sizeof(task_trace_record)));
+
+    names = 0;
+    std::vector<task_trace_record> records;
+    std::size_t offset = sizeof(header);
+    while (offset + sizeof(task_trace_record) <= data.size())
+    {
+        task_trace_record record;
+        std::memcpy(&record, data.data() + offset, sizeof(record));
+        offset += sizeof(record);
+
+        if (record.event == static_cast<std::uint8_t>(task_trace_event::name))
+        {
+            std::size_t const size = record.thread_id;
+            offset += (size + sizeof(record) - 1) / sizeof(record) *
+                sizeof(record);
+            ++names;
+        }
+        else
+        {
+            records.push_back(record);
+        }
+    }
+    HPX_TEST_EQ(offset, data.size());
+    return records;
+}
+
+void test_task_trace(std::size_t num_tasks)
+{
+    HPX_TEST(!hpx::threads::is_task_trace_enabled());
+    hpx::threads::start_task_trace(filename, 1024);
+    HPX_TEST(hpx::threads::is_task_trace_enabled());
+
+    std::vector<hpx::future<void>> futures;
+    futures.reserve(num_tasks);
+    for (std::size_t i = 0; i != num_tasks; ++i)
+    {
+        // every second task is suspended once
+        futures.push_back(hpx::async([i]() {
+            if (i % 2 == 0)
+            {
+                hpx::this_thread::yield();
+            }
+        }));
+    }
+    hpx::wait_all(futures);
+
+    hpx::threads::stop_task_trace();
+    HPX_TEST(!hpx::threads::is_task_trace_enabled());
+
+    std::size_t names = 0;
+    std::vector<task_trace_record> records = read_trace(names);
+
+    std::size_t begins = 0, ends = 0, suspends = 0;
+    for (task_trace_record const& record : records)
+    {
+        switch (static_cast<task_trace_event>(record.event))
+        {
+        case task_trace_event::begin:
+            ++begins;
+            break;
+        case task_trace_event::end:
+            ++ends;
+            break;
+        case task_trace_event::suspend:
+            ++suspends;
+            break;
+        default:
+            break;
+        }
+    }
+
+    // all records of the tasks have to be there unless they were dropped, the
+    // threads running while the trace was started (at most one per worker)
+    // have no begin record
+    std::uint64_t const dropped =
+        hpx::threads::get_task_trace_dropped_records();
+    HPX_TEST(ends + dropped >= num_tasks);
+    HPX_TEST(suspends + dropped >= num_tasks / 2);
+    HPX_TEST(begins + hpx::get_os_thread_count() + dropped >= ends + suspends);
+    HPX_TEST(names > 0);
+}
+
+void test_task_trace_errors()
+{
+    hpx::threads::start_task_trace(filename);
+
+    bool caught_exception = false;
+    try
+    {
+        hpx::threads::start_task_trace(filename);
+    }
+    catch (hpx::exception const& e)
+    {
+        HPX_TEST_EQ(e.get_error(), hpx::bad_parameter);
+        caught_exception = true;
+    }
+    HPX_TEST(caught_exception);
+
+    hpx::threads::stop_task_trace();
+
+    // stopping twice is harmless
+    hpx::threads::stop_task_trace();
+
+    caught_exception = false;
+    try
+    {
+        hpx::threads::start_task_trace("/nonexistent/directory/trace.bin");
+    }
+    catch (hpx::exception const& e)
+    {
+        HPX_TEST_EQ(e.get_error(), hpx::bad_parameter);
+        caught_exception = true;
+    }
+    HPX_TEST(caught_exception);
+    HPX_TEST(!hpx::threads::is_task_trace_enabled());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    test_task_trace(10);
+    test_task_trace(1000);
+    test_task_trace_errors();
+
+    std::remove(filename.c_str());
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,212 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/local/chrono.hpp>
+#include <hpx/local/condition_variable.hpp>
+#include <hpx/local/future.hpp>
+#include <hpx/local/init.hpp>
+#include <hpx/local/mutex.hpp>
+#include <hpx/local/thread.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/threading_base/detail/timer_wheel.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <set>
+#include <vector>
+
+using hpx::threads::detail::timer_wheel;
+using hpx::threads::detail::timer_wheel_entry;
+
+using steady_clock = std::chrono::steady_clock;
+
+///////////////////////////////////////////////////////////////////////////////
+// Entries expire no earlier than their time and no later than one tick after
+// it, however far in the future they are.
+void test_timer_wheel()
+{
+    std::mt19937_64 gen(std::random_device{}());
+
+    timer_wheel wheel;
+    HPX_TEST(wheel.empty());
+
+    std::chrono::nanoseconds const tick(std::int64_t(1)
+        << timer_wheel::tick_bits);
+    std::chrono::nanoseconds const ranges[] = {std::chrono::milliseconds(10),
+        std::chrono::seconds(10), std::chrono::hours(1),
+        std::chrono::hours(24 * 5)};
+
+    std::vector<std::unique_ptr<timer_wheel_entry>> entries;
+    std::set<timer_wheel_entry*> pending;
+
+    steady_clock::time_point now = steady_clock::now();
+    steady_clock::time_point previous = now;
+    for (int i = 0; i != 100000; ++i)
+    {
+        std::uint64_t const op = gen() % 10;
+        if (op < 4)
+        {
+            std::chrono::nanoseconds const range = ranges[gen() % 4];
+            entries.push_back(std::make_unique<timer_wheel_entry>(
+                hpx::threads::thread_id_ref_type(),
+                now + std::chrono::nanoseconds(gen() % range.count())));
+            wheel.insert(*entries.back());
+            pending.insert(entries.back().get());
+        }
+        else if (op < 5 && !pending.empty())
+        {
+            timer_wheel_entry* entry = *pending.begin();
+            HPX_TEST(wheel.cancel(*entry));
+            HPX_TEST(!wheel.cancel(*entry));
+            pending.erase(entry);
+        }
+        else
+        {
+            previous = now;
+            now += std::chrono::nanoseconds(
+                gen() % (op == 9 ? 100000000 : 200000));
+
+            timer_wheel_entry* entry = wheel.expire(now);
+            while (entry != nullptr)
+            {
+                HPX_TEST(entry->abs_time_ <= now);
+                HPX_TEST(entry->abs_time_ + tick > previous);
+                HPX_TEST_EQ(pending.erase(entry), std::size_t(1));
+                HPX_TEST(!wheel.cancel(*entry));
+                entry = entry->next_;
+            }
+
+            // the wheel has to be processed again before the earliest entry
+            // expires
+            steady_clock::time_point const next = wheel.next_expiry();
+            for (timer_wheel_entry* p : pending)
+            {
+                HPX_TEST(next <= p->abs_time_ + tick);
+            }
+        }
+    }
+
+    // all remaining entries expire eventually
+    for (int i = 0; i != 1000 && !pending.empty(); ++i)
+    {
+        now += std::chrono::hours(1);
+        timer_wheel_entry* entry = wheel.expire(now);
+        while (entry != nullptr)
+        {
+            HPX_TEST_EQ(pending.erase(entry), std::size_t(1));
+            entry = entry->next_;
+        }
+    }
+    HPX_TEST(pending.empty());
+    HPX_TEST(wheel.empty());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_sleep_for(std::size_t num_threads)
+{
+    std::atomic<std::size_t> early(0);
+
+    std::vector<hpx::future<void>> threads;
+    for (std::size_t i = 0; i != num_threads; ++i)
+    {
+        threads.push_back(hpx::async([i, &early]() {
+            auto const duration = std::chrono::microseconds(100 * (i % 50));
+            auto const start = steady_clock::now();
+            hpx::this_thread::sleep_for(duration);
+            if (steady_clock::now() - start < duration)
+            {
+                ++early;
+            }
+        }));
+    }
+
+    hpx::wait_all(threads);
+    HPX_TEST_EQ(early.load(), std::size_t(0));
+}
+
+void test_wait_for_notified()
+{
+    hpx::mutex mtx;
+    hpx::condition_variable cond;
+    bool ready = false;
+
+    hpx::future<void> f = hpx::async([&]() {
+        hpx::this_thread::sleep_for(std::chrono::milliseconds(10));
+        std::lock_guard<hpx::mutex> l(mtx);
+        ready = true;
+        cond.notify_one();
+    });
+
+    // the waiting thread is woken up by the notification not by the timeout
+    hpx::chrono::high_resolution_timer t;
+    {
+        std::unique_lock<hpx::mutex> l(mtx);
+        HPX_TEST(cond.wait_for(l, std::chrono::seconds(60), [&] {
+            return ready;
+        }));
+    }
+    HPX_TEST_LT(t.elapsed(), 30.0);
+
+    f.get();
+}
+
+void test_wait_for_timeout()
+{
+    hpx::mutex mtx;
+    hpx::condition_variable cond;
+
+    auto const duration = std::chrono::milliseconds(10);
+    auto const start = steady_clock::now();
+    {
+        std::unique_lock<hpx::mutex> l(mtx);
+        HPX_TEST(cond.wait_for(l, duration) == hpx::cv_status::timeout);
+    }
+    HPX_TEST(steady_clock::now() - start >= duration);
+}
+
+void test_ready_future_at()
+{
+    auto const start = steady_clock::now();
+    auto const duration = std::chrono::milliseconds(10);
+
+    std::vector<hpx::future<void>> futures;
+    for (int i = 0; i != 100; ++i)
+    {
+        futures.push_back(hpx::make_ready_future_after(duration));
+    }
+    hpx::wait_all(futures);
+
+    HPX_TEST(steady_clock::now() - start >= duration);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    test_timer_wheel();
+
+    test_sleep_for(1);
+    test_sleep_for(10000);
+
+    test_wait_for_notified();
+    test_wait_for_timeout();
+
+    test_ready_future_at();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
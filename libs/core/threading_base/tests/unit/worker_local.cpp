@@ -0,0 +1,87 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify that worker_local hands out one instance per worker thread and that
+// the instances of a destroyed worker_local are not visible to the next one
+// reusing its slot.
+
+#include <hpx/local/future.hpp>
+#include <hpx/local/init.hpp>
+#include <hpx/local/runtime.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/modules/threading_base.hpp>
+#include <hpx/threading_base/worker_local.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+constexpr std::size_t num_tasks = 10000;
+
+void test_accumulate()
+{
+    hpx::threads::worker_local<std::uint64_t> counts;
+
+    std::vector<hpx::future<void>> tasks;
+    tasks.reserve(num_tasks);
+    for (std::size_t i = 0; i != num_tasks; ++i)
+    {
+        tasks.push_back(hpx::async([&counts]() { ++counts.local(); }));
+    }
+    hpx::wait_all(tasks);
+
+    // every worker owns at most one instance
+    HPX_TEST_LTE(counts.size(), hpx::get_os_thread_count());
+
+    std::uint64_t sum = 0;
+    counts.for_each([&](std::uint64_t count) { sum += count; });
+    HPX_TEST_EQ(sum, std::uint64_t(num_tasks));
+}
+
+void test_initial_value()
+{
+    hpx::threads::worker_local<int> values(42);
+    HPX_TEST_EQ(values.local(), 42);
+
+    values.local() = 43;
+    HPX_TEST_EQ(values.local(), 43);
+    HPX_TEST_EQ(values.size(), std::size_t(1));
+}
+
+void test_reuse_slot()
+{
+    auto first = std::make_unique<hpx::threads::worker_local<int>>(1);
+    HPX_TEST_EQ(first->local(), 1);
+    first.reset();
+
+    // the next worker_local gets the released slot, but not the old data
+    hpx::threads::worker_local<int> second(2);
+    HPX_TEST_EQ(second.local(), 2);
+    HPX_TEST_EQ(second.size(), std::size_t(1));
+
+    // both exist at the same time
+    hpx::threads::worker_local<int> third(3);
+    HPX_TEST_EQ(third.local(), 3);
+    HPX_TEST_EQ(second.local(), 2);
+}
+
+int hpx_main()
+{
+    test_accumulate();
+    test_initial_value();
+    test_reuse_slot();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -390,6 +390,7 @@ namespace hpx { namespace threads {
         std::int64_t get_num_stolen_from_staged(bool reset);
         std::int64_t get_num_stolen_to_pending(bool reset);
         std::int64_t get_num_stolen_to_staged(bool reset);
+        std::int64_t get_average_steal_batch_size(bool reset);
 #endif
 
     private:
@@ -22,7 +22,9 @@
 #include <hpx/runtime_configuration/runtime_configuration.hpp>
 #include <hpx/thread_pool_util/thread_pool_suspension_helpers.hpp>
 #include <hpx/thread_pools/scheduled_thread_pool.hpp>
+#include <hpx/threading_base/sampling_profiler.hpp>
 #include <hpx/threading_base/set_thread_state.hpp>
+#include <hpx/threading_base/task_trace.hpp>
 #include <hpx/threading_base/thread_data.hpp>
 #include <hpx/threading_base/thread_helpers.hpp>
 #include <hpx/threading_base/thread_init_data.hpp>
@@ -32,7 +34,9 @@
 #include <hpx/util/get_entry_as.hpp>
 
 #include <cstddef>
+#include <chrono>
 #include <cstdint>
+#include <fstream>
 #include <functional>
 #include <iosfwd>
 #include <memory>
@@ -117,6 +121,10 @@ namespace hpx { namespace threads {
             hpx::util::get_entry_as<std::int64_t>(rtcfg_,
                 "hpx.thread_queue.min_tasks_to_steal_staged",
                 HPX_THREAD_QUEUE_MIN_TASKS_TO_STEAL_STAGED);
+        std::int64_t const steal_batch_size =
+            hpx::util::get_entry_as<std::int64_t>(rtcfg_,
+                "hpx.thread_queue.steal_batch_size",
+                HPX_THREAD_QUEUE_STEAL_BATCH_SIZE);
         std::int64_t const min_add_new_count =
             hpx::util::get_entry_as<std::int64_t>(rtcfg_,
                 "hpx.thread_queue.min_add_new_count",
@@ -141,6 +149,13 @@ namespace hpx { namespace threads {
             hpx::util::get_entry_as<std::int64_t>(rtcfg_,
                 "hpx.thread_queue.init_threads_count",
                 HPX_THREAD_QUEUE_INIT_THREADS_COUNT);
+        std::int64_t const max_free_threads =
+            hpx::util::get_entry_as<std::int64_t>(rtcfg_,
+                "hpx.thread_queue.max_free_threads",
+                HPX_THREAD_QUEUE_MAX_FREE_THREADS);
+        bool const run_to_completion = hpx::util::get_entry_as<int>(rtcfg_,
+            "hpx.thread_queue.run_to_completion",
+            HPX_THREAD_QUEUE_RUN_TO_COMPLETION) != 0;
         double const max_idle_backoff_time = hpx::util::get_entry_as<double>(
             rtcfg_, "hpx.max_idle_backoff_time", HPX_IDLE_BACKOFF_TIME_MAX);
 
@@ -158,7 +173,8 @@ namespace hpx { namespace threads {
             min_tasks_to_steal_staged, min_add_new_count, max_add_new_count,
             min_delete_count, max_delete_count, max_terminated_threads,
             init_threads_count, max_idle_backoff_time, small_stacksize,
-            medium_stacksize, large_stacksize, huge_stacksize);
+            medium_stacksize, large_stacksize, huge_stacksize,
+            steal_batch_size, max_free_threads, run_to_completion);
 
         if (!rtcfg_.enable_networking())
         {
@@ -489,6 +505,29 @@ namespace hpx { namespace threads {
 
             case resource::shared_priority:
             {
+                // read the parameters of the steal hierarchy
+                policies::steal_hierarchy_parameters steal_hierarchy;
+                char const* const steal_levels[] = {
+                    "core", "cache", "numa", "remote"};
+                for (std::size_t l = 0;
+                     l != policies::steal_hierarchy_parameters::num_levels; ++l)
+                {
+                    std::string const prefix =
+                        std::string("hpx.thread_queue.steal_") +
+                        steal_levels[l];
+                    policies::steal_level_parameters& level =
+                        steal_hierarchy.levels_[l];
+
+                    level.backoff = hpx::util::get_entry_as<std::size_t>(
+                        rtcfg_, prefix + "_backoff", level.backoff);
+                    level.batch_size = hpx::util::get_entry_as<std::size_t>(
+                        rtcfg_, prefix + "_batch_size", level.batch_size);
+                }
+                steal_hierarchy.numa_affinity_starvation =
+                    hpx::util::get_entry_as<std::size_t>(rtcfg_,
+                        "hpx.thread_queue.steal_numa_affinity_starvation",
+                        steal_hierarchy.numa_affinity_starvation);
+
                 // instantiate the scheduler
                 typedef hpx::threads::policies::
                     shared_priority_queue_scheduler<>
@@ -496,7 +535,7 @@ namespace hpx { namespace threads {
                 local_sched_type::init_parameter_type init(
                     thread_pool_init.num_threads_, {1, 1, 1},
                     thread_pool_init.affinity_data_, thread_queue_init,
-                    "core-shared_priority_queue_scheduler");
+                    "core-shared_priority_queue_scheduler", steal_hierarchy);
 
                 std::unique_ptr<local_sched_type> sched(
                     new local_sched_type(init));
@@ -515,6 +554,91 @@ namespace hpx { namespace threads {
                 pools_.push_back(HPX_MOVE(pool));
                 break;
             }
+            case resource::local_workrequesting_fifo:
+            {
+                // set parameters for scheduler and pool instantiation and
+                // perform compatibility checks
+                std::size_t num_high_priority_queues =
+                    hpx::util::get_entry_as<std::size_t>(rtcfg_,
+                        "hpx.thread_queue.high_priority_queues",
+                        thread_pool_init.num_threads_);
+                detail::check_num_high_priority_queues(
+                    thread_pool_init.num_threads_, num_high_priority_queues);
+
+                // instantiate the scheduler
+                using local_sched_type =
+                    hpx::threads::policies::local_workrequesting_scheduler<
+                        std::mutex, hpx::threads::policies::lockfree_fifo>;
+
+                local_sched_type::init_parameter_type init(
+                    thread_pool_init.num_threads_,
+                    thread_pool_init.affinity_data_, num_high_priority_queues,
+                    thread_queue_init, "core-local_workrequesting_scheduler");
+
+                std::unique_ptr<local_sched_type> sched(
+                    new local_sched_type(init));
+
+                // set the default scheduler flags
+                sched->set_scheduler_mode(thread_pool_init.mode_);
+                // conditionally set/unset this flag
+                sched->update_scheduler_mode(
+                    policies::scheduler_mode::enable_stealing_numa,
+                    !numa_sensitive);
+
+                // instantiate the pool
+                std::unique_ptr<thread_pool_base> pool(
+                    new hpx::threads::detail::scheduled_thread_pool<
+                        local_sched_type>(HPX_MOVE(sched), thread_pool_init));
+                pools_.push_back(HPX_MOVE(pool));
+                break;
+            }
+
+            case resource::local_workrequesting_lifo:
+            {
+#if defined(HPX_HAVE_CXX11_STD_ATOMIC_128BIT)
+                // set parameters for scheduler and pool instantiation and
+                // perform compatibility checks
+                std::size_t num_high_priority_queues =
+                    hpx::util::get_entry_as<std::size_t>(rtcfg_,
+                        "hpx.thread_queue.high_priority_queues",
+                        thread_pool_init.num_threads_);
+                detail::check_num_high_priority_queues(
+                    thread_pool_init.num_threads_, num_high_priority_queues);
+
+                // instantiate the scheduler
+                using local_sched_type =
+                    hpx::threads::policies::local_workrequesting_scheduler<
+                        std::mutex, hpx::threads::policies::lockfree_lifo>;
+
+                local_sched_type::init_parameter_type init(
+                    thread_pool_init.num_threads_,
+                    thread_pool_init.affinity_data_, num_high_priority_queues,
+                    thread_queue_init, "core-local_workrequesting_scheduler");
+
+                std::unique_ptr<local_sched_type> sched(
+                    new local_sched_type(init));
+
+                // set the default scheduler flags
+                sched->set_scheduler_mode(thread_pool_init.mode_);
+                // conditionally set/unset this flag
+                sched->update_scheduler_mode(
+                    policies::scheduler_mode::enable_stealing_numa,
+                    !numa_sensitive);
+
+                // instantiate the pool
+                std::unique_ptr<thread_pool_base> pool(
+                    new hpx::threads::detail::scheduled_thread_pool<
+                        local_sched_type>(HPX_MOVE(sched), thread_pool_init));
+                pools_.push_back(HPX_MOVE(pool));
+#else
+                throw hpx::detail::command_line_error(
+                    "Command line option "
+                    "--hpx:queuing=local-workrequesting-lifo "
+                    "is not configured in this build. Please make sure 128bit "
+                    "atomics are available.");
+#endif
+                break;
+            }
             }
 
             // update the thread_offset for the next pool
@@ -530,6 +654,17 @@ namespace hpx { namespace threads {
                 threads_lookup_.push_back(pool_iter->get_pool_id());
             }
         }
+
+        // let the pools lend their idle worker threads to other pools
+        for (std::size_t i = 0; i != num_pools; ++i)
+        {
+            std::string const target = rp.get_lending_target(i);
+            if (!target.empty())
+            {
+                pools_[i]->get_scheduler()->lend_workers_to(
+                    pools_[rp.get_pool_index(target)]->get_scheduler());
+            }
+        }
     }
 
     threadmanager::~threadmanager() {}
@@ -1013,6 +1148,24 @@ namespace hpx { namespace threads {
             result += pool_iter->get_num_stolen_to_staged(all_threads, reset);
         return result;
     }
+
+    std::int64_t threadmanager::get_average_steal_batch_size(bool reset)
+    {
+        // average over all pools which have performed any steal operations
+        std::int64_t result = 0;
+        std::int64_t count = 0;
+        for (auto const& pool_iter : pools_)
+        {
+            std::int64_t average =
+                pool_iter->get_average_steal_batch_size(all_threads, reset);
+            if (average != 0)
+            {
+                result += average;
+                ++count;
+            }
+        }
+        return count == 0 ? 0 : result / count;
+    }
 #endif
 
     ///////////////////////////////////////////////////////////////////////////
@@ -1030,6 +1183,38 @@ namespace hpx { namespace threads {
         timer_pool_.run(false);
 #endif
 
+        // start recording the task trace if requested
+        std::string const task_trace_file =
+            rtcfg_.get_entry("hpx.task_trace.file", "");
+        if (!task_trace_file.empty() && !is_task_trace_enabled())
+        {
+            start_task_trace(task_trace_file,
+                hpx::util::get_entry_as<std::size_t>(
+                    rtcfg_, "hpx.task_trace.buffer_size", 8192));
+        }
+
+        // start the sampling profiler if requested
+        std::string const sampling_profiler_file =
+            rtcfg_.get_entry("hpx.sampling_profiler.file", "");
+        if (!sampling_profiler_file.empty() && !is_sampling_profiler_running())
+        {
+            // fail early rather than losing the profile at shutdown
+            if (!std::ofstream(sampling_profiler_file))
+            {
+                HPX_THROW_EXCEPTION(bad_parameter, "threadmanager::run",
+                    "can't open the sampling profiler output file: {}",
+                    sampling_profiler_file);
+            }
+
+            start_sampling_profiler(
+                std::chrono::microseconds(hpx::util::get_entry_as<
+                    std::int64_t>(rtcfg_, "hpx.sampling_profiler.interval",
+                    1000)),
+                hpx::util::get_entry_as<int>(
+                    rtcfg_, "hpx.sampling_profiler.stacks", 0) != 0,
+                "locality#" + rtcfg_.get_entry("hpx.locality", "0"));
+        }
+
         for (auto& pool_iter : pools_)
         {
             std::size_t num_threads_in_pool =
@@ -1068,6 +1253,22 @@ namespace hpx { namespace threads {
         {
             pool_iter->stop(lk, blocking);
         }
+
+        // the trace started in run() covers the whole run of the pools
+        if (blocking && !rtcfg_.get_entry("hpx.task_trace.file", "").empty())
+        {
+            stop_task_trace();
+        }
+
+        std::string const sampling_profiler_file =
+            rtcfg_.get_entry("hpx.sampling_profiler.file", "");
+        if (blocking && !sampling_profiler_file.empty())
+        {
+            stop_sampling_profiler();
+
+            std::ofstream out(sampling_profiler_file);
+            write_sampling_profile(out, true);
+        }
         deinit_tss();
     }
 
@@ -187,6 +187,19 @@ namespace hpx { namespace threads {
         mask_cref_type get_core_affinity_mask(
             std::size_t num_thread, error_code& ec = throws) const;
 
+        /// \brief Return a bit mask where each set bit corresponds to a
+        ///        processing unit sharing the data cache of the given level
+        ///        (1 for L1, 2 for L2, etc.) with the given thread.
+        ///
+        /// \param ec         [in,out] this represents the error status on exit,
+        ///                   if this is pre-initialized to \a hpx#throws
+        ///                   the function will throw on error instead.
+        ///
+        /// \note  The returned mask is empty if the machine does not expose
+        ///        a data cache of the given level for the thread.
+        mask_type get_cache_affinity_mask(std::size_t num_thread,
+            std::size_t cache_level, error_code& ec = throws) const;
+
         /// \brief Return a bit mask where each set bit corresponds to a
         ///        processing unit available to the given thread.
         ///
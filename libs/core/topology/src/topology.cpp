@@ -18,7 +18,12 @@
 #include <hpx/type_support/unused.hpp>
 #include <hpx/util/ios_flags_saver.hpp>
 
+#include <cctype>
 #include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
 #include <iomanip>
 #include <iostream>
 #include <memory>
@@ -118,6 +123,21 @@ namespace hpx { namespace threads { namespace detail {
         return node;
     }
 
+    bool is_data_cache_obj(hwloc_obj_t obj, std::size_t level) noexcept
+    {
+#if HWLOC_API_VERSION >= 0x00020000
+        if (!hwloc_obj_type_is_dcache(obj->type))
+            return false;
+#else
+        if (obj->type != HWLOC_OBJ_CACHE ||
+            obj->attr->cache.type == HWLOC_OBJ_CACHE_INSTRUCTION)
+        {
+            return false;
+        }
+#endif
+        return obj->attr->cache.depth == level;
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     // abstract away memory page size
     std::size_t get_memory_page_size_impl()
@@ -133,6 +153,104 @@ namespace hpx { namespace threads { namespace detail {
 #endif
     }
 
+    ///////////////////////////////////////////////////////////////////////////
+    // The hwloc discovery of the topology of large systems can take a
+    // considerable amount of time. If HPX_TOPOLOGY_CACHE names a directory,
+    // the discovered topology is stored there as a hwloc XML file and loaded
+    // instead by later runs on the same system.
+    std::string read_first_line(char const* filename)
+    {
+        std::string line;
+        std::ifstream f(filename);
+        if (f)
+            std::getline(f, line);
+        return line;
+    }
+
+    std::string get_host_name()
+    {
+#if defined(HPX_HAVE_UNISTD_H)
+        char name[256] = {};
+        if (gethostname(name, sizeof(name) - 1) == 0)
+            return name;
+        return "";
+#else
+        char const* name = std::getenv("COMPUTERNAME");
+        return name != nullptr ? name : "";
+#endif
+    }
+
+    std::string get_topology_cache_file()
+    {
+        char const* dir = std::getenv("HPX_TOPOLOGY_CACHE");
+        if (dir == nullptr || *dir == '\0')
+            return "";
+
+        // anything that changes the discovered topology has to change the
+        // fingerprint
+        std::string fingerprint = hpx::util::format("{}:{}:{}",
+            HWLOC_API_VERSION, hwloc_get_api_version(),
+            std::thread::hardware_concurrency());
+#if defined(__linux__)
+        fingerprint += ':';
+        fingerprint += read_first_line("/sys/devices/system/cpu/present");
+        fingerprint += ':';
+        fingerprint += read_first_line("/sys/devices/system/node/possible");
+        fingerprint += ':';
+        fingerprint += read_first_line("/proc/meminfo");
+#endif
+
+        std::string host = get_host_name();
+        for (char& c : host)
+        {
+            if (!std::isalnum(static_cast<unsigned char>(c)) && c != '-')
+                c = '_';
+        }
+
+        return hpx::util::format("{}/hpx-topology-{}-{:016llx}.xml", dir,
+            host,
+            static_cast<unsigned long long>(
+                std::hash<std::string>()(fingerprint)));
+    }
+
+    bool load_topology_cache(hwloc_topology_t topo, std::string const& file)
+    {
+        if (hwloc_topology_set_xml(topo, file.c_str()) != 0)
+            return false;
+
+        // the cached topology describes the system we are running on, this
+        // enables binding threads and memory. The resources available to this
+        // process are still determined from the system.
+#if HWLOC_API_VERSION >= 0x00020000
+        hwloc_topology_set_flags(topo,
+            HWLOC_TOPOLOGY_FLAG_IS_THISSYSTEM |
+                HWLOC_TOPOLOGY_FLAG_THISSYSTEM_ALLOWED_RESOURCES);
+#else
+        hwloc_topology_set_flags(topo, HWLOC_TOPOLOGY_FLAG_IS_THISSYSTEM);
+#endif
+        return hwloc_topology_load(topo) == 0;
+    }
+
+    void save_topology_cache(hwloc_topology_t topo, std::string const& file)
+    {
+        // write to a temporary file first to never expose a partially
+        // written cache to concurrently starting processes
+#if defined(HPX_HAVE_UNISTD_H)
+        std::string const tmp = hpx::util::format("{}.{}", file, getpid());
+#else
+        std::string const tmp = hpx::util::format("{}.{}", file,
+            std::hash<std::thread::id>()(std::this_thread::get_id()));
+#endif
+#if HWLOC_API_VERSION >= 0x00020000
+        int err = hwloc_topology_export_xml(topo, tmp.c_str(), 0);
+#else
+        int err = hwloc_topology_export_xml(topo, tmp.c_str());
+#endif
+        if (err != 0 || std::rename(tmp.c_str(), file.c_str()) != 0)
+        {
+            std::remove(tmp.c_str());
+        }
+    }
 }}}    // namespace hpx::threads::detail
 
 std::size_t hpx::threads::topology::memory_page_size_ =
@@ -214,26 +332,50 @@ namespace hpx { namespace threads {
                 "Failed to init hwloc topology");
         }
 
+        std::string const cache_file = detail::get_topology_cache_file();
+        if (cache_file.empty() ||
+            !detail::load_topology_cache(topo, cache_file))
+        {
+            if (!cache_file.empty())
+            {
+                // start over, the cache is missing or can't be used
+                hwloc_topology_destroy(topo);
+                err = hwloc_topology_init(&topo);
+                if (err != 0)
+                {
+                    topo = nullptr;
+                    HPX_THROW_EXCEPTION(no_success, "topology::topology",
+                        "Failed to init hwloc topology");
+                }
+            }
+
 #if HWLOC_API_VERSION >= 0x00020000
 #if defined(HPX_TOPOLOGY_HAVE_ADDITIONAL_HWLOC_TESTING)
-        // Enable HWLOC filtering that makes it report no cores. This is purely
-        // an option allowing to test whether things work properly on systems
-        // that may not report cores in the topology at all (e.g. FreeBSD).
-        err = hwloc_topology_set_type_filter(
-            topo, HWLOC_OBJ_CORE, HWLOC_TYPE_FILTER_KEEP_NONE);
-        if (err != 0)
-        {
-            HPX_THROW_EXCEPTION(no_success, "topology::topology",
-                "Failed to set core filter for hwloc topology");
-        }
+            // Enable HWLOC filtering that makes it report no cores. This is
+            // purely an option allowing to test whether things work properly
+            // on systems that may not report cores in the topology at all
+            // (e.g. FreeBSD).
+            err = hwloc_topology_set_type_filter(
+                topo, HWLOC_OBJ_CORE, HWLOC_TYPE_FILTER_KEEP_NONE);
+            if (err != 0)
+            {
+                HPX_THROW_EXCEPTION(no_success, "topology::topology",
+                    "Failed to set core filter for hwloc topology");
+            }
 #endif
 #endif
 
-        err = hwloc_topology_load(topo);
-        if (err != 0)
-        {
-            HPX_THROW_EXCEPTION(no_success, "topology::topology",
-                "Failed to load hwloc topology");
+            err = hwloc_topology_load(topo);
+            if (err != 0)
+            {
+                HPX_THROW_EXCEPTION(no_success, "topology::topology",
+                    "Failed to load hwloc topology");
+            }
+
+            if (!cache_file.empty())
+            {
+                detail::save_topology_cache(topo, cache_file);
+            }
         }
 
         init_num_of_pus();
@@ -457,6 +599,45 @@ namespace hpx { namespace threads {
         return empty_mask;
     }
 
+    mask_type topology::get_cache_affinity_mask(
+        std::size_t num_thread, std::size_t cache_level, error_code& ec) const
+    {    // {{{
+        std::size_t num_pu = num_thread % num_of_pus_;
+        if (num_pu >= thread_affinity_masks_.size())
+        {
+            HPX_THROWS_IF(ec, bad_parameter,
+                "hpx::threads::topology::get_cache_affinity_mask",
+                "thread number {1} is out of range", num_thread);
+            return empty_mask;
+        }
+
+        if (&ec != &throws)
+            ec = make_success_code();
+
+        hwloc_obj_t obj = nullptr;
+        {
+            std::unique_lock<mutex_type> lk(topo_mtx);
+            obj = hwloc_get_obj_by_type(
+                topo, HWLOC_OBJ_PU, static_cast<unsigned>(num_pu));
+
+            // find the enclosing data cache object of the requested level
+            while (obj != nullptr &&
+                !detail::is_data_cache_obj(obj, cache_level))
+            {
+                obj = obj->parent;
+            }
+        }
+
+        mask_type cache_affinity_mask = mask_type();
+        resize(cache_affinity_mask, get_number_of_pus());
+
+        if (obj != nullptr)
+        {
+            extract_node_mask(obj, cache_affinity_mask);
+        }
+        return cache_affinity_mask;
+    }    // }}}
+
     mask_cref_type topology::get_thread_affinity_mask(
         std::size_t num_thread, error_code& ec) const
     {    // {{{
@@ -10,15 +10,18 @@
 #include <hpx/config.hpp>
 #include <hpx/actions/apply_helper_fwd.hpp>
 #include <hpx/actions_base/actions_base_support.hpp>
+#include <hpx/actions_base/detail/action_execution_cost.hpp>
 #include <hpx/actions_base/traits/action_continuation.hpp>
 #include <hpx/actions_base/traits/action_decorate_continuation.hpp>
 #include <hpx/actions_base/traits/action_priority.hpp>
 #include <hpx/actions_base/traits/action_schedule_thread.hpp>
 #include <hpx/actions_base/traits/action_select_direct_execution.hpp>
 #include <hpx/actions_base/traits/action_stacksize.hpp>
+#include <hpx/components_base/traits/action_decorate_function.hpp>
 #include <hpx/async_base/launch_policy.hpp>
 #include <hpx/coroutines/thread_enums.hpp>
 #include <hpx/naming_base/address.hpp>
+#include <hpx/parcelset_base/parcel_flight_recorder.hpp>
 #include <hpx/runtime_local/state.hpp>
 #include <hpx/threading_base/thread_helpers.hpp>
 
@@ -82,6 +85,13 @@ namespace hpx { namespace applier { namespace detail {
                 std::chrono::milliseconds(HPX_NETWORK_RETRIES_SLEEP));
         }
 
+#if defined(HPX_HAVE_PARCEL_PROFILING) && defined(HPX_HAVE_NETWORKING)
+        // record the scheduling and execution of the action of a received
+        // parcel
+        parcelset::detail::received_parcel_flight::wrap_thread_function(
+            data.func);
+#endif
+
         traits::action_schedule_thread<Action>::call(lva, comptype, data);
     }
 
@@ -118,6 +128,13 @@ namespace hpx { namespace applier { namespace detail {
                 std::chrono::milliseconds(HPX_NETWORK_RETRIES_SLEEP));
         }
 
+#if defined(HPX_HAVE_PARCEL_PROFILING) && defined(HPX_HAVE_NETWORKING)
+        // record the scheduling and execution of the action of a received
+        // parcel
+        parcelset::detail::received_parcel_flight::wrap_thread_function(
+            data.func);
+#endif
+
         traits::action_schedule_thread<Action>::call(lva, comptype, data);
     }
 
@@ -125,6 +142,9 @@ namespace hpx { namespace applier { namespace detail {
     HPX_FORCEINLINE void call_sync(naming::address::address_type lva,
         naming::address::component_type comptype, Ts&&... vs)
     {
+#if defined(HPX_HAVE_PARCEL_PROFILING) && defined(HPX_HAVE_NETWORKING)
+        parcelset::detail::received_parcel_flight::execute_inline();
+#endif
         Action::execute_function(lva, comptype, HPX_FORWARD(Ts, vs)...);
     }
 
@@ -133,6 +153,9 @@ namespace hpx { namespace applier { namespace detail {
         naming::address::address_type lva,
         naming::address::component_type comptype, Ts&&... vs)
     {
+#if defined(HPX_HAVE_PARCEL_PROFILING) && defined(HPX_HAVE_NETWORKING)
+        parcelset::detail::received_parcel_flight::execute_inline();
+#endif
         try
         {
             cont.trigger_value(Action::execute_function(
@@ -245,4 +268,73 @@ namespace hpx { namespace applier { namespace detail {
             }
         }
     };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Used for the actions of received parcels. Actions which are not direct
+    // actions are executed directly as well if they were measured to be short
+    // running (see hpx.parcel.adaptive_direct_execution). Actions which need
+    // a larger stack or whose component decorates the thread function are
+    // always run on a new thread.
+    template <typename Action>
+    struct received_apply_helper
+    {
+        static bool execute_directly()
+        {
+            if constexpr (Action::direct_execution::value ||
+                traits::action_decorate_function<Action>::value ||
+                (traits::action_stacksize_v<Action> !=
+                        threads::thread_stacksize::default_ &&
+                    traits::action_stacksize_v<Action> !=
+                        threads::thread_stacksize::nostack))
+            {
+                return false;
+            }
+            else
+            {
+                return Action::get_execution_cost().execute_directly(
+                           actions::detail::
+                               get_adaptive_direct_execution_parameters()) &&
+                    this_thread::has_sufficient_stack_space() &&
+                    threads::threadmanager_is_at_least(hpx::state::running);
+            }
+        }
+
+        template <typename... Ts>
+        static void call(threads::thread_init_data&& data,
+            hpx::id_type const& target, naming::address::address_type lva,
+            naming::address::component_type comptype,
+            threads::thread_priority priority, Ts&&... vs)
+        {
+            if (execute_directly())
+            {
+                actions::detail::action_execution_timer<Action> timer(true);
+                call_sync<Action>(lva, comptype, HPX_FORWARD(Ts, vs)...);
+            }
+            else
+            {
+                apply_helper<Action>::call(HPX_MOVE(data), target, lva,
+                    comptype, priority, HPX_FORWARD(Ts, vs)...);
+            }
+        }
+
+        template <typename Continuation, typename... Ts>
+        static void call(threads::thread_init_data&& data, Continuation&& cont,
+            hpx::id_type const& target, naming::address::address_type lva,
+            naming::address::component_type comptype,
+            threads::thread_priority priority, Ts&&... vs)
+        {
+            if (execute_directly())
+            {
+                actions::detail::action_execution_timer<Action> timer(true);
+                call_sync<Action>(HPX_FORWARD(Continuation, cont), lva,
+                    comptype, HPX_FORWARD(Ts, vs)...);
+            }
+            else
+            {
+                apply_helper<Action>::call(HPX_MOVE(data),
+                    HPX_FORWARD(Continuation, cont), target, lva, comptype,
+                    priority, HPX_FORWARD(Ts, vs)...);
+            }
+        }
+    };
 }}}    // namespace hpx::applier::detail
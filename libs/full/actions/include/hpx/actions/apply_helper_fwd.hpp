@@ -40,4 +40,7 @@ namespace hpx { namespace applier { namespace detail {
     template <typename Action,
         bool DirectExecute = Action::direct_execution::value>
     struct apply_helper;
+
+    template <typename Action>
+    struct received_apply_helper;
 }}}    // namespace hpx::applier::detail
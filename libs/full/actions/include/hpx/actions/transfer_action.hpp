@@ -19,6 +19,7 @@
 
 #if defined(HPX_HAVE_NETWORKING)
 #include <hpx/datastructures/serialization/tuple.hpp>
+#include <hpx/parcelset_base/parcel_flight_recorder.hpp>
 #include <hpx/serialization/input_archive.hpp>
 #include <hpx/serialization/output_archive.hpp>
 #include <hpx/serialization/serialization_fwd.hpp>
@@ -181,8 +182,9 @@ namespace hpx { namespace actions {
         data.timer_data = hpx::util::external_timer::new_task(
             data.description, data.parent_locality_id, data.parent_id);
 #endif
-        applier::detail::apply_helper<typename base_type::derived_type>::call(
-            HPX_MOVE(data), target, lva, comptype, this->priority_,
+        applier::detail::received_apply_helper<
+            typename base_type::derived_type>::call(HPX_MOVE(data), target,
+            lva, comptype, this->priority_,
             HPX_MOVE(hpx::get<Is>(this->arguments_))...);
     }
 
@@ -218,6 +220,9 @@ namespace hpx { namespace actions {
     {
         // First, serialize, then schedule
         load(ar);
+#if defined(HPX_HAVE_PARCEL_PROFILING) && defined(HPX_HAVE_NETWORKING)
+        parcelset::detail::received_parcel_flight::deserialized();
+#endif
 
         if (deferred_schedule)
         {
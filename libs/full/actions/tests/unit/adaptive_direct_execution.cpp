@@ -0,0 +1,162 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify that the execution time of actions is measured and that only short
+// running actions are considered for direct execution.
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/actions_base/detail/action_execution_cost.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/actions.hpp>
+#include <hpx/include/async.hpp>
+#include <hpx/include/runtime.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/thread.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+using hpx::actions::detail::action_execution_cost;
+using hpx::actions::detail::adaptive_direct_execution_parameters;
+
+///////////////////////////////////////////////////////////////////////////////
+int cheap(int i)
+{
+    return i + 1;
+}
+
+HPX_PLAIN_ACTION(cheap, cheap_action)
+
+int expensive(int i)
+{
+    hpx::this_thread::sleep_for(std::chrono::milliseconds(1));
+    return i + 1;
+}
+
+HPX_PLAIN_ACTION(expensive, expensive_action)
+
+// whether the actions would be executed directly on this locality
+std::vector<bool> executed_directly()
+{
+    adaptive_direct_execution_parameters const& params =
+        hpx::actions::detail::get_adaptive_direct_execution_parameters();
+
+    return {cheap_action::get_execution_cost().execute_directly(params),
+        expensive_action::get_execution_cost().execute_directly(params)};
+}
+
+HPX_PLAIN_ACTION(executed_directly, executed_directly_action)
+
+///////////////////////////////////////////////////////////////////////////////
+void test_execution_cost()
+{
+    adaptive_direct_execution_parameters params;
+    params.enabled_ = true;
+    params.threshold_ = 1000;
+    params.min_samples_ = 4;
+
+    action_execution_cost cost;
+    HPX_TEST(!cost.execute_directly(params));
+
+    // enough short executions have to be measured first
+    for (int i = 0; i != 3; ++i)
+    {
+        cost.record(params, 100, false);
+        HPX_TEST(!cost.execute_directly(params));
+    }
+    cost.record(params, 100, false);
+    HPX_TEST(cost.execute_directly(params));
+    HPX_TEST_EQ(cost.average(), std::int64_t(100));
+
+    // never when disabled
+    adaptive_direct_execution_parameters disabled = params;
+    disabled.enabled_ = false;
+    HPX_TEST(!cost.execute_directly(disabled));
+
+    // a single long direct execution switches back to new threads
+    cost.record(params, 5000, true);
+    HPX_TEST(!cost.execute_directly(params));
+    HPX_TEST_EQ(cost.samples(), std::int64_t(1));
+
+    // repeated short executions bring the average down again
+    for (int i = 0; i != 64; ++i)
+    {
+        cost.record(params, 100, false);
+    }
+    HPX_TEST(cost.execute_directly(params));
+
+    // long executions on new threads raise the average
+    for (int i = 0; i != 64; ++i)
+    {
+        cost.record(params, 10000, false);
+    }
+    HPX_TEST(!cost.execute_directly(params));
+
+    cost.reset();
+    HPX_TEST_EQ(cost.samples(), std::int64_t(0));
+    HPX_TEST(!cost.execute_directly(params));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_actions(hpx::id_type const& id)
+{
+    for (int i = 0; i != 100; ++i)
+    {
+        HPX_TEST_EQ(hpx::async<cheap_action>(id, i).get(), i + 1);
+    }
+    for (int i = 0; i != 20; ++i)
+    {
+        HPX_TEST_EQ(hpx::async<expensive_action>(id, i).get(), i + 1);
+    }
+
+    std::vector<bool> const direct =
+        hpx::async<executed_directly_action>(id).get();
+    HPX_TEST(direct[0]);
+    HPX_TEST(!direct[1]);
+
+    // the results are still correct when executed directly
+    std::vector<hpx::future<int>> results;
+    for (int i = 0; i != 1000; ++i)
+    {
+        results.push_back(hpx::async<cheap_action>(id, i));
+    }
+    for (int i = 0; i != 1000; ++i)
+    {
+        HPX_TEST_EQ(results[i].get(), i + 1);
+    }
+}
+
+int hpx_main()
+{
+    test_execution_cost();
+
+    // the actions of received parcels are measured
+    for (hpx::id_type const& id : hpx::find_remote_localities())
+    {
+        test_actions(id);
+    }
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // the threshold is generous to be robust on loaded systems
+    std::vector<std::string> const cfg = {
+        "hpx.parcel.adaptive_direct_execution=1",
+        "hpx.parcel.adaptive_direct_execution_threshold=500",
+        "hpx.parcel.adaptive_direct_execution_samples=8"};
+
+    hpx::init_params init_args;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ(hpx::init(argc, argv, init_args), 0);
+    return hpx::util::report_errors();
+}
+#endif
@@ -14,6 +14,7 @@
 #include <hpx/actions_base/actions_base_fwd.hpp>
 #include <hpx/actions_base/actions_base_support.hpp>
 #include <hpx/actions_base/basic_action_fwd.hpp>
+#include <hpx/actions_base/detail/action_execution_cost.hpp>
 #include <hpx/actions_base/detail/action_factory.hpp>
 #include <hpx/actions_base/detail/invocation_count_registry.hpp>
 #include <hpx/actions_base/detail/per_action_data_counter_registry.hpp>
@@ -107,6 +108,8 @@ namespace hpx { namespace actions {
                     LTM_(debug).format(
                         "Executing {}.", Action::get_action_name(lva_));
 
+                    action_execution_timer<Action> timer(false);
+
                     // invoke the action, ignoring the return value
                     util::invoke_fused(action_invoke<Action>{lva_, comptype_},
                         HPX_MOVE(args_));
@@ -177,10 +180,14 @@ namespace hpx { namespace actions {
                 LTM_(debug).format("Executing {} with continuation({})",
                     Action::get_action_name(lva_), cont_.get_id());
 
-                traits::action_trigger_continuation<
-                    typename Action::continuation_type>::call(HPX_MOVE(cont_),
-                    util::functional::invoke_fused{},
-                    action_invoke<Action>{lva_, comptype_}, HPX_MOVE(args_));
+                {
+                    action_execution_timer<Action> timer(false);
+                    traits::action_trigger_continuation<
+                        typename Action::continuation_type>::call(
+                        HPX_MOVE(cont_), util::functional::invoke_fused{},
+                        action_invoke<Action>{lva_, comptype_},
+                        HPX_MOVE(args_));
+                }
 
                 return threads::thread_result_type(
                     threads::thread_schedule_state::terminated,
@@ -449,8 +456,15 @@ namespace hpx { namespace actions {
             return util::get_and_reset_value(invocation_count_, reset);
         }
 
+        /// Access the measured execution time of this action
+        static detail::action_execution_cost& get_execution_cost() noexcept
+        {
+            return execution_cost_;
+        }
+
     private:
         static std::atomic<std::int64_t> invocation_count_;
+        static detail::action_execution_cost execution_cost_;
 
     protected:
         static void increment_invocation_count()
@@ -464,6 +478,11 @@ namespace hpx { namespace actions {
     std::atomic<std::int64_t>
         basic_action<Component, R(Args...), Derived>::invocation_count_(0);
 
+    template <typename Component, typename R, typename... Args,
+        typename Derived>
+    detail::action_execution_cost
+        basic_action<Component, R(Args...), Derived>::execution_cost_;
+
     namespace detail {
         template <typename Action>
         void register_local_action_invocation_count(
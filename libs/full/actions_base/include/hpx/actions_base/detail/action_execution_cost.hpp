@@ -0,0 +1,142 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/timing/high_resolution_clock.hpp>
+
+#include <atomic>
+#include <cstdint>
+
+namespace hpx { namespace actions { namespace detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    struct adaptive_direct_execution_parameters
+    {
+        // execute short running actions of received parcels directly instead
+        // of creating a new thread for them
+        bool enabled_ = false;
+
+        // actions whose average execution time (nanoseconds) is at least
+        // this are always run on a new thread
+        std::int64_t threshold_ = 10000;
+
+        // the number of executions which have to be measured before an
+        // action is executed directly
+        std::int64_t min_samples_ = 16;
+    };
+
+    // The parameters as configured by the hpx.parcel.adaptive_direct_execution
+    // settings
+    HPX_EXPORT adaptive_direct_execution_parameters const&
+    get_adaptive_direct_execution_parameters();
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The measured execution time of one action type. The time is averaged
+    // exponentially over all executions, the measurements of actions running
+    // concurrently are not synchronized as an occasional lost measurement
+    // does not matter.
+    class action_execution_cost
+    {
+    public:
+        action_execution_cost() = default;
+
+        // Return whether the action is known to be short running
+        bool execute_directly(
+            adaptive_direct_execution_parameters const& params) const noexcept
+        {
+            return params.enabled_ &&
+                samples_.load(std::memory_order_relaxed) >=
+                params.min_samples_ &&
+                average_.load(std::memory_order_relaxed) < params.threshold_;
+        }
+
+        // Record the time (nanoseconds) one execution of the action took,
+        // direct is true if the action was executed directly
+        void record(adaptive_direct_execution_parameters const& params,
+            std::int64_t time, bool direct) noexcept
+        {
+            std::int64_t const samples =
+                samples_.load(std::memory_order_relaxed);
+
+            if (samples == 0 || (direct && time >= params.threshold_))
+            {
+                // a directly executed action which ran long (or blocked) has
+                // delayed the handling of other parcels, run it on new
+                // threads until enough short executions have been measured
+                // again
+                average_.store(time, std::memory_order_relaxed);
+                samples_.store(1, std::memory_order_relaxed);
+                return;
+            }
+
+            std::int64_t const average =
+                average_.load(std::memory_order_relaxed);
+            average_.store(
+                average + (time - average) / 8, std::memory_order_relaxed);
+            samples_.store(samples + 1, std::memory_order_relaxed);
+        }
+
+        // the average execution time (nanoseconds)
+        std::int64_t average() const noexcept
+        {
+            return average_.load(std::memory_order_relaxed);
+        }
+
+        // the number of measurements the average is based on
+        std::int64_t samples() const noexcept
+        {
+            return samples_.load(std::memory_order_relaxed);
+        }
+
+        void reset() noexcept
+        {
+            average_.store(0, std::memory_order_relaxed);
+            samples_.store(0, std::memory_order_relaxed);
+        }
+
+    private:
+        std::atomic<std::int64_t> average_{0};
+        std::atomic<std::int64_t> samples_{0};
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Measure the execution of an action if adaptive direct execution is
+    // enabled
+    template <typename Action>
+    class action_execution_timer
+    {
+        using clock_type = hpx::chrono::high_resolution_clock;
+
+    public:
+        explicit action_execution_timer(bool direct) noexcept
+          : params_(get_adaptive_direct_execution_parameters())
+          , direct_(direct)
+          , start_(params_.enabled_ ? clock_type::now() : 0)
+        {
+        }
+
+        action_execution_timer(action_execution_timer const&) = delete;
+        action_execution_timer& operator=(
+            action_execution_timer const&) = delete;
+
+        ~action_execution_timer()
+        {
+            if (params_.enabled_)
+            {
+                std::uint64_t const time = clock_type::now() - start_;
+                Action::get_execution_cost().record(
+                    params_, static_cast<std::int64_t>(time), direct_);
+            }
+        }
+
+    private:
+        adaptive_direct_execution_parameters const& params_;
+        bool const direct_;
+        std::uint64_t const start_;
+    };
+}}}    // namespace hpx::actions::detail
@@ -20,6 +20,7 @@ namespace hpx { namespace actions {
     {
         register_worker_action_id = 0,
         notify_worker_action_id,
+        notify_locality_table_action_id,
         allocate_action_id,
         base_connect_action_id,
         base_disconnect_action_id,
@@ -82,8 +83,10 @@ namespace hpx { namespace actions {
         primary_namespace_end_migration_action_id,
         primary_namespace_increment_credit_action_id,
         primary_namespace_resolve_gid_action_id,
+        primary_namespace_resolve_gids_action_id,
         primary_namespace_route_action_id,
         primary_namespace_unbind_gid_action_id,
+        primary_namespace_update_migrated_object_action_id,
         primary_namespace_statistics_counter_action_id,
         remove_from_connection_cache_action_id,
         set_value_action_agas_bool_response_type_id,
@@ -97,7 +100,9 @@ namespace hpx { namespace actions {
         store8_action_id,
         symbol_namespace_bind_action_id,
         symbol_namespace_resolve_action_id,
+        symbol_namespace_resolve_cached_action_id,
         symbol_namespace_unbind_action_id,
+        symbol_namespace_invalidate_action_id,
         symbol_namespace_iterate_action_id,
         symbol_namespace_on_event_action_id,
         symbol_namespace_statistics_counter_action_id,
@@ -159,6 +164,8 @@ namespace hpx { namespace actions {
         base_lco_with_value_naming_address_set,
         base_lco_with_value_gva_tuple_get,
         base_lco_with_value_gva_tuple_set,
+        base_lco_with_value_vector_gva_tuple_get,
+        base_lco_with_value_vector_gva_tuple_set,
         base_lco_with_value_std_pair_address_id_type_get,
         base_lco_with_value_std_pair_address_id_type_set,
         base_lco_with_value_std_pair_gid_type_get,
@@ -0,0 +1,63 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/actions_base/detail/action_execution_cost.hpp>
+#include <hpx/runtime_local/config_entry.hpp>
+#include <hpx/runtime_local/detail/runtime_local_fwd.hpp>
+#include <hpx/util/from_string.hpp>
+
+#include <algorithm>
+#include <cstdint>
+
+namespace hpx { namespace actions { namespace detail {
+
+    namespace {
+
+        adaptive_direct_execution_parameters read_parameters()
+        {
+            adaptive_direct_execution_parameters params;
+
+            params.enabled_ =
+                hpx::util::from_string<int>(
+                    get_config_entry(
+                        "hpx.parcel.adaptive_direct_execution", "0"),
+                    0) != 0;
+
+            // the threshold is configured in microseconds
+            std::int64_t const threshold = hpx::util::from_string<std::int64_t>(
+                get_config_entry(
+                    "hpx.parcel.adaptive_direct_execution_threshold", "10"),
+                10);
+            params.threshold_ = (std::max)(threshold, std::int64_t(0)) * 1000;
+
+            std::int64_t const min_samples =
+                hpx::util::from_string<std::int64_t>(
+                    get_config_entry(
+                        "hpx.parcel.adaptive_direct_execution_samples", "16"),
+                    16);
+            params.min_samples_ = (std::max)(min_samples, std::int64_t(1));
+
+            return params;
+        }
+    }    // namespace
+
+    adaptive_direct_execution_parameters const&
+    get_adaptive_direct_execution_parameters()
+    {
+        // actions are executed only while the runtime is up, the
+        // configuration is not available before
+        if (hpx::get_runtime_ptr() == nullptr)
+        {
+            static adaptive_direct_execution_parameters const disabled;
+            return disabled;
+        }
+
+        static adaptive_direct_execution_parameters const params =
+            read_parameters();
+        return params;
+    }
+}}}    // namespace hpx::actions::detail
@@ -11,9 +11,9 @@
 
 #include <hpx/config.hpp>
 #include <hpx/agas/agas_fwd.hpp>
-#include <hpx/cache/lru_cache.hpp>
-#include <hpx/cache/statistics/local_full_statistics.hpp>
+#include <hpx/agas/detail/gva_cache.hpp>
 #include <hpx/components_base/pinned_ptr.hpp>
+#include <hpx/concurrency/flat_combining.hpp>
 #include <hpx/datastructures/detail/dynamic_bitset.hpp>
 #include <hpx/functional/function.hpp>
 #include <hpx/modules/agas_base.hpp>
@@ -60,32 +60,55 @@ namespace hpx { namespace agas {
 
         using mutex_type = hpx::spinlock;
 
-        // gva cache
-        struct gva_cache_key;
+        // gva cache, lookups don't acquire any locks
+        using gva_cache_type = detail::gva_cache;
 
-        using gva_cache_type = hpx::util::cache::lru_cache<gva_cache_key, gva,
-            hpx::util::cache::statistics::local_full_statistics>;
-
-        using migrated_objects_table_type = std::set<naming::gid_type>;
+        // Objects migrated away from this locality, mapped onto their new
+        // address once the migration has completed (invalid before that).
+        using migrated_objects_table_type =
+            std::map<naming::gid_type, naming::address>;
         using refcnt_requests_type = std::map<naming::gid_type, std::int64_t>;
 
-        mutable mutex_type gva_cache_mtx_;
         std::shared_ptr<gva_cache_type> gva_cache_;
 
-        mutable mutex_type migrated_objects_mtx_;
+        mutable mutex_type migrated_objects_mtx_{
+            "addressing_service::migrated_objects_mtx_"};
         migrated_objects_table_type migrated_objects_table_;
 
-        mutable mutex_type console_cache_mtx_;
+        // The number of entries in migrated_objects_table_. Address lookups
+        // check this first to avoid acquiring migrated_objects_mtx_ as long
+        // as no object has been migrated away from this locality.
+        std::atomic<std::size_t> migrated_objects_count_;
+
+        // Resolve requests sent to the primary namespace which have not
+        // completed yet. Callers missing the cache for the same gid attach
+        // to the pending request instead of sending their own.
+        using pending_resolves_type =
+            std::map<naming::gid_type, hpx::shared_future<naming::address>>;
+
+        mutable mutex_type pending_resolves_mtx_{
+            "addressing_service::pending_resolves_mtx_"};
+        pending_resolves_type pending_resolves_;
+        std::atomic<std::uint64_t> coalesced_resolves_;
+
+        mutable mutex_type console_cache_mtx_{
+            "addressing_service::console_cache_mtx_"};
         std::uint32_t console_cache_;
 
         std::size_t const max_refcnt_requests_;
 
-        mutex_type refcnt_requests_mtx_;
+        mutex_type refcnt_requests_mtx_{
+            "addressing_service::refcnt_requests_mtx_"};
         std::size_t refcnt_requests_count_;
         bool enable_refcnt_caching_;
 
         std::shared_ptr<refcnt_requests_type> refcnt_requests_;
 
+        // concurrent decref requests are added to refcnt_requests_ in
+        // batches by the thread holding refcnt_requests_mtx_
+        util::flat_combining<mutex_type> refcnt_requests_combiner_{
+            refcnt_requests_mtx_};
+
         service_mode const service_type;
         runtime_mode const runtime_type;
 
@@ -103,7 +126,8 @@ namespace hpx { namespace agas {
         std::atomic<hpx::state> state_;
         naming::gid_type locality_;
 
-        mutable mutex_type resolved_localities_mtx_;
+        mutable mutex_type resolved_localities_mtx_{
+            "addressing_service::resolved_localities_mtx_"};
         using resolved_localities_type =
             std::map<naming::gid_type, parcelset::endpoints_type>;
         resolved_localities_type resolved_localities_;
@@ -221,12 +245,22 @@ namespace hpx { namespace agas {
 
         naming::address resolve_full_postproc(naming::gid_type const& id,
             future<primary_namespace::resolved_type> f);
+
+        // convert the answer of the primary namespace into an address and
+        // update the cache
+        naming::address make_resolved_address(naming::gid_type const& id,
+            primary_namespace::resolved_type const& rep);
         bool bind_postproc(
             naming::gid_type const& id, gva const& g, future<bool> f);
 
         /// Maintain list of migrated objects
         bool was_object_migrated_locked(naming::gid_type const& id);
 
+        // retrieve the new address of an object migrated away from this
+        // locality, if known
+        bool get_migrated_object_address(
+            naming::gid_type const& id, naming::address& addr);
+
     private:
         /// Assumes that \a refcnt_requests_mtx_ is locked.
         void send_refcnt_requests(
@@ -257,6 +291,9 @@ namespace hpx { namespace agas {
         std::uint64_t get_cache_update_entry_count(bool reset);
         std::uint64_t get_cache_erase_entry_count(bool reset);
 
+        // number of resolves which attached to a request already in flight
+        std::uint64_t get_coalesced_resolves_count(bool reset);
+
         std::uint64_t get_cache_get_entry_time(bool reset);
         std::uint64_t get_cache_insertion_entry_time(bool reset);
         std::uint64_t get_cache_update_entry_time(bool reset);
@@ -859,6 +896,23 @@ namespace hpx { namespace agas {
             return resolve_async(id.get_gid());
         }
 
+        /// \brief Resolve the given global addresses to their associated
+        ///        local addresses.
+        ///
+        /// The global addresses which are not found in the cache are grouped
+        /// by the primary namespace service instance managing them, a single
+        /// request is sent to each of those. The cache is updated with all
+        /// answers.
+        ///
+        /// \returns The addresses in the order of the given global addresses.
+        ///          The future holds an exception if any of the global
+        ///          addresses could not be resolved.
+        hpx::future<std::vector<naming::address>> resolve_async(
+            std::vector<naming::gid_type> const& ids);
+
+        hpx::future<std::vector<naming::address>> resolve_async(
+            std::vector<hpx::id_type> const& ids);
+
         ///////////////////////////////////////////////////////////////////////////
         hpx::future<hpx::id_type> get_colocation_id_async(
             hpx::id_type const& id);
@@ -908,7 +962,6 @@ namespace hpx { namespace agas {
 
         ///////////////////////////////////////////////////////////////////////////
         // Bulk version.
-        // TODO: Add versions that take std::vector<id_type> for convenience.
         bool resolve_local(naming::gid_type const* gids, naming::address* addrs,
             std::size_t size, hpx::detail::dynamic_bitset<>& locals,
             error_code& ec = throws)
@@ -1190,6 +1243,12 @@ namespace hpx { namespace agas {
         /// Remove the given object from the table of migrated objects
         void unmark_as_migrated(naming::gid_type const& gid);
 
+        /// Record the new address of an object which was migrated away from
+        /// this locality. Parcels routed to the object from this locality are
+        /// then sent to the new address directly.
+        void update_migrated_object(
+            naming::gid_type const& gid, naming::address const& addr);
+
         // Pre-cache locality endpoints in hosted locality namespace
         void pre_cache_endpoints(std::vector<parcelset::endpoints_type> const&);
     };
@@ -0,0 +1,223 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/agas_base/gva.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
+#include <hpx/naming_base/gid_type.hpp>
+#include <hpx/synchronization/spinlock.hpp>
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx::agas::detail {
+
+    /// The cache of the addressing service, mapping gids (or ranges of gids)
+    /// to their GVAs.
+    ///
+    /// The gids are hashed onto sets of a few entries each. Every set is
+    /// protected by a sequence lock: lookups never block, they read the set
+    /// optimistically and retry only if a writer modified it concurrently.
+    /// The entries of a full set are replaced using the CLOCK algorithm, an
+    /// approximation of LRU which lookups maintain by setting a flag.
+    ///
+    /// Ranges of gids are stored in the set of their base gid and in a
+    /// separate table. A lookup of a gid which is not found in its set
+    /// consults that table and copies the range into the set of the gid,
+    /// later lookups of the same gid don't need to touch the table anymore.
+    class HPX_EXPORT gva_cache
+    {
+    public:
+        using mutex_type = hpx::spinlock;
+
+        // the number of entries per set
+        static constexpr std::size_t ways = 4;
+
+        gva_cache() = default;
+        ~gva_cache();
+
+        gva_cache(gva_cache const&) = delete;
+        gva_cache(gva_cache&&) = delete;
+        gva_cache& operator=(gva_cache const&) = delete;
+        gva_cache& operator=(gva_cache&&) = delete;
+
+        /// Make room for (at least) the given number of entries. This drops
+        /// all entries currently held by the cache.
+        void reserve(std::size_t capacity);
+
+        std::size_t capacity() const noexcept;
+
+        /// Look up the entry covering the given gid, returns the base gid of
+        /// the entry and its GVA.
+        bool get_entry(naming::gid_type const& gid, naming::gid_type& idbase,
+            gva& g) noexcept;
+
+        /// Insert the range of gids [gid, gid + count) or update the GVA of
+        /// an existing entry for exactly that range. Returns false if an
+        /// entry for a different range overlapping the given range exists,
+        /// \a collision is set to the base gid and count of that entry.
+        bool update_entry(naming::gid_type const& gid, std::uint64_t count,
+            gva const& g,
+            std::pair<naming::gid_type, std::uint64_t>& collision);
+
+        /// Remove all entries with the given base gid
+        void erase(naming::gid_type const& gid);
+
+        void clear();
+
+        /// The number of entries held by the sets of the cache. Ranges are
+        /// counted once for every set they have been copied into.
+        std::size_t size() const noexcept;
+
+        // statistics
+        std::int64_t hits(bool reset) noexcept;
+        std::int64_t misses(bool reset) noexcept;
+        std::int64_t evictions(bool reset) noexcept;
+        std::int64_t insertions(bool reset) noexcept;
+
+        std::int64_t get_entry_count(bool reset) noexcept;
+        std::int64_t insert_entry_count(bool reset) noexcept;
+        std::int64_t update_entry_count(bool reset) noexcept;
+        std::int64_t erase_entry_count(bool reset) noexcept;
+
+        std::int64_t get_entry_time(bool reset) noexcept;
+        std::int64_t insert_entry_time(bool reset) noexcept;
+        std::int64_t update_entry_time(bool reset) noexcept;
+        std::int64_t erase_entry_time(bool reset) noexcept;
+
+    private:
+        // All fields are atomics as they are read while a writer could be
+        // modifying them. An entry with a count of zero is empty.
+        struct entry
+        {
+            std::atomic<std::uint64_t> msb_{0};
+            std::atomic<std::uint64_t> lsb_{0};
+            std::atomic<std::uint64_t> count_{0};
+
+            std::atomic<std::uint64_t> prefix_msb_{0};
+            std::atomic<std::uint64_t> prefix_lsb_{0};
+            std::atomic<std::int32_t> type_{0};
+            std::atomic<std::uint64_t> gva_count_{0};
+            std::atomic<std::uint64_t> lva_{0};
+            std::atomic<std::uint64_t> offset_{0};
+
+            // set by lookups, cleared by the CLOCK hand
+            std::atomic<bool> referenced_{false};
+        };
+
+        struct set
+        {
+            // odd while a writer modifies the set
+            std::atomic<std::uint64_t> sequence_{0};
+            std::size_t hand_ = 0;    // protected by the sequence lock
+            entry entries_[ways];
+        };
+
+        struct table
+        {
+            explicit table(std::size_t num_sets)
+              : mask_(num_sets - 1)
+              , sets_(new set[num_sets])
+            {
+            }
+
+            std::size_t mask_;
+            std::unique_ptr<set[]> sets_;
+        };
+
+        struct range_data
+        {
+            std::uint64_t count_;
+            gva gva_;
+        };
+
+        using range_table_type = std::map<naming::gid_type, range_data>;
+
+        struct api_counter_data
+        {
+            std::atomic<std::int64_t> count_{0};
+            std::atomic<std::int64_t> time_{0};
+        };
+
+        // the statistics are spread over the worker threads to avoid
+        // contention on the counters
+        struct statistics_data
+        {
+            std::atomic<std::int64_t> hits_{0};
+            std::atomic<std::int64_t> misses_{0};
+            std::atomic<std::int64_t> evictions_{0};
+            std::atomic<std::int64_t> insertions_{0};
+
+            api_counter_data get_entry_;
+            api_counter_data insert_entry_;
+            api_counter_data update_entry_;
+            api_counter_data erase_entry_;
+        };
+
+        static constexpr std::size_t num_statistics = 32;
+
+        struct update_on_exit;
+
+        statistics_data& get_statistics() noexcept;
+
+        template <typename F>
+        std::int64_t accumulate(F&& f, bool reset) noexcept;
+
+        set& get_set(table& t, naming::gid_type const& gid) const noexcept;
+
+        static std::uint64_t lock(set& s) noexcept;
+        static void unlock(set& s, std::uint64_t sequence) noexcept;
+
+        static bool find(set& s, naming::gid_type const& gid,
+            naming::gid_type& idbase, gva& g) noexcept;
+
+        // store the given range in the set, the set has to be locked
+        void store(set& s, naming::gid_type const& gid, std::uint64_t count,
+            gva const& g) noexcept;
+
+        // remove all entries with the given base gid from the set, the set
+        // has to be locked, returns whether a range was removed
+        bool remove(set& s, naming::gid_type const& gid) noexcept;
+
+        // remove the copies of a range from all sets
+        void remove_everywhere(table& t, naming::gid_type const& gid) noexcept;
+
+        // find a range overlapping the given one, ranges_mtx_ has to be
+        // locked
+        range_table_type::iterator find_range(naming::gid_type const& gid,
+            std::uint64_t count) noexcept;
+
+        std::atomic<table*> table_{nullptr};
+
+        // protects the replacement of the table, the old tables are kept
+        // alive as lookups might still be accessing them
+        mutable mutex_type mtx_;
+        std::vector<std::unique_ptr<table>> tables_;
+
+        std::atomic<std::size_t> size_{0};
+
+        mutable mutex_type ranges_mtx_;
+        range_table_type ranges_;
+        std::atomic<std::size_t> num_ranges_{0};
+        std::size_t capacity_ = 0;
+
+        std::array<util::cache_aligned_data_derived<statistics_data>,
+            num_statistics>
+            statistics_;
+    };
+}    // namespace hpx::agas::detail
+
+#include <hpx/config/warnings_suffix.hpp>
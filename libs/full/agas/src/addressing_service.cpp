@@ -21,6 +21,7 @@
 #include <hpx/functional/bind.hpp>
 #include <hpx/functional/bind_back.hpp>
 #include <hpx/functional/bind_front.hpp>
+#include <hpx/futures/promise.hpp>
 #include <hpx/lock_registration/detail/register_locks.hpp>
 #include <hpx/modules/async_distributed.hpp>
 #include <hpx/modules/errors.hpp>
@@ -28,17 +29,20 @@
 #include <hpx/modules/format.hpp>
 #include <hpx/modules/logging.hpp>
 #include <hpx/naming/split_gid.hpp>
+#include <hpx/parcelset/parcel.hpp>
 #include <hpx/runtime_configuration/runtime_configuration.hpp>
 #include <hpx/runtime_local/runtime_local_fwd.hpp>
 #include <hpx/serialization/serialize.hpp>
 #include <hpx/serialization/vector.hpp>
 #include <hpx/thread_support/unlock_guard.hpp>
 #include <hpx/type_support/unused.hpp>
+#include <hpx/util/get_and_reset_value.hpp>
 #include <hpx/util/get_entry_as.hpp>
 #include <hpx/util/insert_checked.hpp>
 
 #include <cstddef>
 #include <cstdint>
+#include <exception>
 #include <functional>
 #include <map>
 #include <memory>
@@ -51,75 +55,11 @@
 
 namespace hpx { namespace agas {
 
-    struct addressing_service::gva_cache_key
-    {    // {{{ gva_cache_key implementation
-    private:
-        using key_type = std::pair<naming::gid_type, naming::gid_type>;
-
-        key_type key_;
-
-    public:
-        gva_cache_key()
-          : key_()
-        {
-        }
-
-        explicit gva_cache_key(
-            naming::gid_type const& id, std::uint64_t count = 1)
-          : key_(naming::detail::get_stripped_gid(id),
-                naming::detail::get_stripped_gid(id) + (count - 1))
-        {
-            HPX_ASSERT(count);
-        }
-
-        naming::gid_type get_gid() const
-        {
-            return key_.first;
-        }
-
-        std::uint64_t get_count() const
-        {
-            naming::gid_type const size = key_.second - key_.first;
-            HPX_ASSERT(size.get_msb() == 0);
-            return size.get_lsb();
-        }
-
-        friend bool operator<(
-            gva_cache_key const& lhs, gva_cache_key const& rhs)
-        {
-            return lhs.key_.second < rhs.key_.first;
-        }
-
-        friend bool operator==(
-            gva_cache_key const& lhs, gva_cache_key const& rhs)
-        {
-            // Direct hit
-            if (lhs.key_ == rhs.key_)
-            {
-                return true;
-            }
-
-            // Is lhs in rhs?
-            if (1 == lhs.get_count() && 1 != rhs.get_count())
-            {
-                return rhs.key_.first <= lhs.key_.first &&
-                    lhs.key_.second <= rhs.key_.second;
-            }
-
-            // Is rhs in lhs?
-            else if (1 != lhs.get_count() && 1 == rhs.get_count())
-            {
-                return lhs.key_.first <= rhs.key_.first &&
-                    rhs.key_.second <= lhs.key_.second;
-            }
-
-            return false;
-        }
-    };    // }}}
-
     addressing_service::addressing_service(
         util::runtime_configuration const& ini_)
       : gva_cache_(new gva_cache_type)
+      , migrated_objects_count_(0)
+      , coalesced_resolves_(0)
       , console_cache_(naming::invalid_locality_id)
       , max_refcnt_requests_(ini_.get_agas_max_pending_refcnt_requests())
       , refcnt_requests_count_(0)
@@ -742,7 +682,11 @@ namespace hpx { namespace agas {
             naming::detail::get_stripped_gid_except_dont_cache(gid));
 
 #if defined(HPX_HAVE_NETWORKING)
-        if (naming::detail::is_migratable(gid))
+        // A stale count only means that a parcel is sent to the old location
+        // of the object, which will route it on. Invoking actions locally
+        // checks the table again while pinning the object.
+        if (naming::detail::is_migratable(gid) &&
+            migrated_objects_count_.load(std::memory_order_relaxed) != 0)
         {
             std::lock_guard<mutex_type> lock(migrated_objects_mtx_);
             if (was_object_migrated_locked(id))
@@ -968,7 +912,8 @@ namespace hpx { namespace agas {
         }
 
         // force routing if target object was migrated
-        if (naming::detail::is_migratable(id))
+        if (naming::detail::is_migratable(id) &&
+            migrated_objects_count_.load(std::memory_order_relaxed) != 0)
         {
             std::lock_guard<mutex_type> lock(migrated_objects_mtx_);
             if (was_object_migrated_locked(id))
@@ -1033,6 +978,111 @@ namespace hpx { namespace agas {
         return resolve_full_async(gid);
     }
 
+    hpx::future<std::vector<naming::address>>
+    addressing_service::resolve_async(std::vector<naming::gid_type> const& ids)
+    {
+        std::vector<naming::address> addrs(ids.size());
+
+        // the indices of the gids which were not found in the cache, grouped
+        // by the primary namespace instance managing them
+        std::map<naming::gid_type, std::vector<std::size_t>> misses;
+        for (std::size_t i = 0; i != ids.size(); ++i)
+        {
+            naming::gid_type const& gid = ids[i];
+            if (!gid)
+            {
+                return hpx::make_exceptional_future<
+                    std::vector<naming::address>>(
+                    HPX_GET_EXCEPTION(bad_parameter,
+                        "addressing_service::resolve_async",
+                        "invalid reference id"));
+            }
+
+            if (caching_)
+            {
+                error_code ec;
+                if (resolve_cached(gid, addrs[i], ec))
+                    continue;
+
+                if (ec)
+                {
+                    return hpx::make_exceptional_future<
+                        std::vector<naming::address>>(
+                        hpx::detail::access_exception(ec));
+                }
+            }
+
+            error_code ec;
+            naming::gid_type const service =
+                primary_namespace::get_service_instance(gid, ec);
+            if (ec)
+            {
+                return hpx::make_exceptional_future<
+                    std::vector<naming::address>>(
+                    hpx::detail::access_exception(ec));
+            }
+            misses[service].push_back(i);
+        }
+
+        if (misses.empty())
+        {
+            return hpx::make_ready_future(HPX_MOVE(addrs));
+        }
+
+        // send one request to each of the involved instances
+        std::vector<std::vector<std::size_t>> indices;
+        std::vector<hpx::future<std::vector<primary_namespace::resolved_type>>>
+            requests;
+        indices.reserve(misses.size());
+        requests.reserve(misses.size());
+
+        for (auto& miss : misses)
+        {
+            std::vector<naming::gid_type> gids;
+            gids.reserve(miss.second.size());
+            for (std::size_t i : miss.second)
+            {
+                gids.push_back(ids[i]);
+            }
+
+            requests.push_back(primary_ns_.resolve_full(HPX_MOVE(gids)));
+            indices.push_back(HPX_MOVE(miss.second));
+        }
+
+        return hpx::when_all(requests).then(hpx::launch::sync,
+            [this, ids, addrs = HPX_MOVE(addrs), indices = HPX_MOVE(indices)](
+                hpx::future<std::vector<hpx::future<
+                    std::vector<primary_namespace::resolved_type>>>>&&
+                    f) mutable -> std::vector<naming::address> {
+                auto replies = f.get();
+                for (std::size_t j = 0; j != replies.size(); ++j)
+                {
+                    auto const resolved = replies[j].get();
+                    std::vector<std::size_t> const& group = indices[j];
+
+                    HPX_ASSERT(resolved.size() == group.size());
+                    for (std::size_t k = 0; k != group.size(); ++k)
+                    {
+                        std::size_t const i = group[k];
+                        addrs[i] = make_resolved_address(ids[i], resolved[k]);
+                    }
+                }
+                return HPX_MOVE(addrs);
+            });
+    }
+
+    hpx::future<std::vector<naming::address>>
+    addressing_service::resolve_async(std::vector<hpx::id_type> const& ids)
+    {
+        std::vector<naming::gid_type> gids;
+        gids.reserve(ids.size());
+        for (hpx::id_type const& id : ids)
+        {
+            gids.push_back(id.get_gid());
+        }
+        return resolve_async(gids);
+    }
+
     hpx::future<hpx::id_type> addressing_service::get_colocation_id_async(
         hpx::id_type const& id)
     {
@@ -1050,12 +1100,17 @@ namespace hpx { namespace agas {
     ///////////////////////////////////////////////////////////////////////////
     naming::address addressing_service::resolve_full_postproc(
         naming::gid_type const& id, future<primary_namespace::resolved_type> f)
+    {
+        return make_resolved_address(id, f.get());
+    }
+
+    naming::address addressing_service::make_resolved_address(
+        naming::gid_type const& id, primary_namespace::resolved_type const& rep)
     {
         using hpx::get;
 
         naming::address addr;
 
-        auto rep = f.get();
         if (get<0>(rep) == naming::invalid_gid ||
             get<2>(rep) == naming::invalid_gid)
         {
@@ -1104,13 +1159,57 @@ namespace hpx { namespace agas {
             return make_ready_future(naming::address());
         }
 
+        naming::gid_type const id(
+            naming::detail::get_stripped_gid_except_dont_cache(gid));
+
+        // attach to a request for the same gid which is still in flight, if
+        // any, insert a new pending request otherwise
+        hpx::promise<naming::address> p;
+        hpx::shared_future<naming::address> result;
+        {
+            std::lock_guard<mutex_type> l(pending_resolves_mtx_);
+
+            pending_resolves_type::const_iterator it =
+                pending_resolves_.find(id);
+            if (it != pending_resolves_.end())
+            {
+                ++coalesced_resolves_;
+                return hpx::make_future<naming::address>(it->second);
+            }
+
+            result = p.get_future().share();
+            pending_resolves_.emplace(id, result);
+        }
+
         // ask server
         future<primary_namespace::resolved_type> f =
             primary_ns_.resolve_full(gid);
 
-        return f.then(hpx::launch::sync,
-            util::one_shot(hpx::bind_front(
-                &addressing_service::resolve_full_postproc, this, gid)));
+        // the cache is updated before the request is removed, later callers
+        // will find the entry there
+        f.then(hpx::launch::sync,
+            [this, id, p = HPX_MOVE(p)](
+                future<primary_namespace::resolved_type>&& f) mutable {
+                auto remove_pending = [this, &id]() {
+                    std::lock_guard<mutex_type> l(pending_resolves_mtx_);
+                    pending_resolves_.erase(id);
+                };
+
+                try
+                {
+                    naming::address addr =
+                        resolve_full_postproc(id, HPX_MOVE(f));
+                    remove_pending();
+                    p.set_value(HPX_MOVE(addr));
+                }
+                catch (...)
+                {
+                    remove_pending();
+                    p.set_exception(std::current_exception());
+                }
+            });
+
+        return hpx::make_future<naming::address>(HPX_MOVE(result));
     }
 
     ///////////////////////////////////////////////////////////////////////////
@@ -1241,6 +1340,16 @@ namespace hpx { namespace agas {
             return;
         }
 
+        // send parcels for objects which were migrated away from this locality
+        // directly to their new location, if known
+        naming::address addr;
+        if (get_migrated_object_address(p.destination(), addr))
+        {
+            p.addr() = addr;
+            parcelset::put_parcel(HPX_MOVE(p), HPX_MOVE(f));
+            return;
+        }
+
         primary_ns_.route(HPX_MOVE(p), HPX_MOVE(f));
     }
 #endif
@@ -1393,35 +1502,51 @@ namespace hpx { namespace agas {
 
         try
         {
-            std::unique_lock<mutex_type> l(refcnt_requests_mtx_);
+            // Concurrent decref requests are combined, this may be applied
+            // by another thread holding refcnt_requests_mtx_.
+            bool inserted = true;
+            bool send_requests = false;
+            refcnt_requests_combiner_.apply([&]() {
+                // Match the decref request with entries in the incref table
+                using iterator = refcnt_requests_type::iterator;
+                using mapping = refcnt_requests_type::value_type;
+
+                iterator matches = refcnt_requests_->find(raw);
+                if (matches != refcnt_requests_->end())
+                {
+                    matches->second -= credit;
+                }
+                else
+                {
+                    inserted =
+                        refcnt_requests_->insert(mapping(raw, -credit)).second;
+                    if (HPX_UNLIKELY(!inserted))
+                    {
+                        return;
+                    }
+                }
 
-            // Match the decref request with entries in the incref table
-            using iterator = refcnt_requests_type::iterator;
-            using mapping = refcnt_requests_type::value_type;
+                send_requests = !enable_refcnt_caching_ ||
+                    max_refcnt_requests_ == ++refcnt_requests_count_;
+            });
 
-            iterator matches = refcnt_requests_->find(raw);
-            if (matches != refcnt_requests_->end())
+            if (HPX_UNLIKELY(!inserted))
             {
-                matches->second -= credit;
+                HPX_THROWS_IF(ec, bad_parameter, "addressing_service::decref",
+                    "couldn't insert decref request for {1} ({2})", raw,
+                    credit);
+                return;
             }
-            else
-            {
-                std::pair<iterator, bool> p =
-                    refcnt_requests_->insert(mapping(raw, -credit));
-
-                if (HPX_UNLIKELY(!p.second))
-                {
-                    l.unlock();
 
-                    HPX_THROWS_IF(ec, bad_parameter,
-                        "addressing_service::decref",
-                        "couldn't insert decref request for {1} ({2})", raw,
-                        credit);
-                    return;
-                }
+            if (send_requests)
+            {
+                std::unique_lock<mutex_type> l(refcnt_requests_mtx_);
+                send_refcnt_requests_non_blocking(l, ec);
+            }
+            else if (&ec != &throws)
+            {
+                ec = make_success_code();
             }
-
-            send_refcnt_requests(l, ec);
         }
         catch (hpx::exception const& e)
         {
@@ -1562,8 +1687,30 @@ namespace hpx { namespace agas {
     future<hpx::id_type> addressing_service::on_symbol_namespace_event(
         std::string const& name, bool call_for_past_events)
     {
+        // names which are already known are served from the read cache of
+        // the symbol namespace, the entries are invalidated on unbind
+        server::symbol_namespace& service = symbol_ns_.get_service();
+        if (call_for_past_events)
+        {
+            hpx::id_type id;
+            if (service.get_cache_entry(name, id))
+            {
+                return hpx::make_ready_future(HPX_MOVE(id));
+            }
+        }
+
+        std::uint64_t const invalidations = service.get_cache_invalidations();
+
         hpx::distributed::promise<hpx::id_type, naming::gid_type> p;
-        auto result_f = p.get_future();
+        auto result_f = p.get_future().then(hpx::launch::sync,
+            [&service, name, invalidations](hpx::future<hpx::id_type>&& f) {
+                hpx::id_type id = f.get();
+                if (id)
+                {
+                    service.add_cache_entry(name, id, invalidations);
+                }
+                return id;
+            });
 
         hpx::future<bool> f =
             symbol_ns_.on_event(name, call_for_past_events, p.get_id());
@@ -1580,15 +1727,6 @@ namespace hpx { namespace agas {
         return symbol_ns_.iterate_async(pattern);
     }    // }}}
 
-    // This function has to return false if the key is already in the cache (true
-    // means go ahead with the cache update).
-    bool check_for_collisions(addressing_service::gva_cache_key const& new_key,
-        addressing_service::gva_cache_key const& old_key)
-    {
-        return (new_key.get_gid() != old_key.get_gid()) ||
-            (new_key.get_count() != old_key.get_count());
-    }
-
     void addressing_service::update_cache_entry(
         naming::gid_type const& id, gva const& g, error_code& ec)
     {    // {{{
@@ -1649,37 +1787,15 @@ namespace hpx { namespace agas {
                 "addressing_service::update_cache_entry, gid({1}), count({2})",
                 gid, count);
 
-            const gva_cache_key key(gid, count);
-
+            std::pair<naming::gid_type, std::uint64_t> collision;
+            if (!gva_cache_->update_entry(gid, count, g, collision))
             {
-                std::unique_lock<mutex_type> lock(gva_cache_mtx_);
-                if (!gva_cache_->update_if(key, g, check_for_collisions))
-                {
-                    if (LAGAS_ENABLED(warning))
-                    {
-                        // Figure out who we collided with.
-                        addressing_service::gva_cache_key idbase;
-                        addressing_service::gva_cache_type::entry_type e;
-
-                        if (!gva_cache_->get_entry(key, idbase, e))
-                        {
-                            // This is impossible under sane conditions.
-                            lock.unlock();
-                            HPX_THROWS_IF(ec, invalid_data,
-                                "addressing_service::update_cache_entry",
-                                "data corruption or lock error occurred in "
-                                "cache");
-                            return;
-                        }
-
-                        LAGAS_(warning).format(
-                            "addressing_service::update_cache_entry, aborting "
-                            "update due to key collision in cache, "
-                            "new_gid({1}), new_count({2}), old_gid({3}), "
-                            "old_count({4})",
-                            gid, count, idbase.get_gid(), idbase.get_count());
-                    }
-                }
+                LAGAS_(warning).format(
+                    "addressing_service::update_cache_entry, aborting "
+                    "update due to key collision in cache, "
+                    "new_gid({1}), new_count({2}), old_gid({3}), "
+                    "old_count({4})",
+                    gid, count, collision.first, collision.second);
             }
 
             if (&ec != &throws)
@@ -1692,36 +1808,14 @@ namespace hpx { namespace agas {
     }    // }}}
 
     bool addressing_service::get_cache_entry(naming::gid_type const& gid,
-        gva& gva, naming::gid_type& idbase, error_code& ec)
+        gva& gva, naming::gid_type& idbase, error_code& /* ec */)
     {
         // Don't use the cache while HPX is starting up
         if (hpx::is_starting())
         {
             return false;
         }
-        gva_cache_key k(gid);
-        gva_cache_key idbase_key;
-
-        std::unique_lock<mutex_type> lock(gva_cache_mtx_);
-        if (gva_cache_->get_entry(k, idbase_key, gva))
-        {
-            const std::uint64_t id_msb =
-                naming::detail::strip_internal_bits_from_gid(gid.get_msb());
-
-            if (HPX_UNLIKELY(id_msb != idbase_key.get_gid().get_msb()))
-            {
-                lock.unlock();
-                HPX_THROWS_IF(ec, internal_server_error,
-                    "addressing_service::get_cache_entry",
-                    "bad entry in cache, MSBs of GID base and GID do not "
-                    "match");
-                return false;
-            }
-            idbase = idbase_key.get_gid();
-            return true;
-        }
-
-        return false;
+        return gva_cache_->get_entry(gid, idbase, gva);
     }
 
     void addressing_service::clear_cache(error_code& ec)
@@ -1739,9 +1833,8 @@ namespace hpx { namespace agas {
             LAGAS_(warning).format(
                 "addressing_service::clear_cache, clearing cache");
 
-            std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-
             gva_cache_->clear();
+            symbol_ns_.get_service().clear_cache();
 
             if (&ec != &throws)
                 ec = make_success_code();
@@ -1786,11 +1879,7 @@ namespace hpx { namespace agas {
         {
             LAGAS_(warning).format("addressing_service::remove_cache_entry");
 
-            std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-
-            gva_cache_->erase([&gid](std::pair<gva_cache_key, gva> const& p) {
-                return gid == p.first.get_gid();
-            });
+            gva_cache_->erase(gid);
 
             if (&ec != &throws)
                 ec = make_success_code();
@@ -1817,82 +1906,74 @@ namespace hpx { namespace agas {
     // Helper functions to access the current cache statistics
     std::uint64_t addressing_service::get_cache_entries(bool /* reset */)
     {
-        std::lock_guard<mutex_type> lock(gva_cache_mtx_);
         return gva_cache_->size();
     }
 
     std::uint64_t addressing_service::get_cache_hits(bool reset)
     {
-        std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-        return gva_cache_->get_statistics().hits(reset);
+        return gva_cache_->hits(reset);
     }
 
     std::uint64_t addressing_service::get_cache_misses(bool reset)
     {
-        std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-        return gva_cache_->get_statistics().misses(reset);
+        return gva_cache_->misses(reset);
     }
 
     std::uint64_t addressing_service::get_cache_evictions(bool reset)
     {
-        std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-        return gva_cache_->get_statistics().evictions(reset);
+        return gva_cache_->evictions(reset);
     }
 
     std::uint64_t addressing_service::get_cache_insertions(bool reset)
     {
-        std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-        return gva_cache_->get_statistics().insertions(reset);
+        return gva_cache_->insertions(reset);
     }
 
     ///////////////////////////////////////////////////////////////////////////
     std::uint64_t addressing_service::get_cache_get_entry_count(bool reset)
     {
-        std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-        return gva_cache_->get_statistics().get_get_entry_count(reset);
+        return gva_cache_->get_entry_count(reset);
     }
 
     std::uint64_t addressing_service::get_cache_insertion_entry_count(
         bool reset)
     {
-        std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-        return gva_cache_->get_statistics().get_insert_entry_count(reset);
+        return gva_cache_->insert_entry_count(reset);
     }
 
     std::uint64_t addressing_service::get_cache_update_entry_count(bool reset)
     {
-        std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-        return gva_cache_->get_statistics().get_update_entry_count(reset);
+        return gva_cache_->update_entry_count(reset);
     }
 
     std::uint64_t addressing_service::get_cache_erase_entry_count(bool reset)
     {
-        std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-        return gva_cache_->get_statistics().get_erase_entry_count(reset);
+        return gva_cache_->erase_entry_count(reset);
+    }
+
+    std::uint64_t addressing_service::get_coalesced_resolves_count(bool reset)
+    {
+        return util::get_and_reset_value(coalesced_resolves_, reset);
     }
 
     std::uint64_t addressing_service::get_cache_get_entry_time(bool reset)
     {
-        std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-        return gva_cache_->get_statistics().get_get_entry_time(reset);
+        return gva_cache_->get_entry_time(reset);
     }
 
     std::uint64_t addressing_service::get_cache_insertion_entry_time(bool reset)
     {
-        std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-        return gva_cache_->get_statistics().get_insert_entry_time(reset);
+        return gva_cache_->insert_entry_time(reset);
     }
 
     std::uint64_t addressing_service::get_cache_update_entry_time(bool reset)
     {
-        std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-        return gva_cache_->get_statistics().get_update_entry_time(reset);
+        return gva_cache_->update_entry_time(reset);
     }
 
     std::uint64_t addressing_service::get_cache_erase_entry_time(bool reset)
     {
-        std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-        return gva_cache_->get_statistics().get_erase_entry_time(reset);
+        return gva_cache_->erase_entry_time(reset);
     }
 
     void addressing_service::register_server_instances()
@@ -2173,7 +2254,8 @@ namespace hpx { namespace agas {
             if (it == migrated_objects_table_.end())
             {
                 HPX_ASSERT(!expect_to_be_marked_as_migrating);
-                migrated_objects_table_.insert(gid);
+                migrated_objects_table_.emplace(gid, naming::address());
+                ++migrated_objects_count_;
             }
             else
             {
@@ -2213,6 +2295,7 @@ namespace hpx { namespace agas {
         if (it != migrated_objects_table_.end())
         {
             migrated_objects_table_.erase(it);
+            --migrated_objects_count_;
 
             // remove entry from cache
             if (caching_ && naming::detail::store_in_cache(gid_))
@@ -2266,6 +2349,56 @@ namespace hpx { namespace agas {
             migrated_objects_table_.end();
     }
 
+    bool addressing_service::get_migrated_object_address(
+        naming::gid_type const& gid_, naming::address& addr)
+    {
+        if (!naming::detail::is_migratable(gid_) ||
+            migrated_objects_count_.load(std::memory_order_relaxed) == 0)
+        {
+            return false;
+        }
+
+        naming::gid_type gid(naming::detail::get_stripped_gid(gid_));
+
+        std::lock_guard<mutex_type> lock(migrated_objects_mtx_);
+
+        migrated_objects_table_type::const_iterator it =
+            migrated_objects_table_.find(gid);
+        if (it == migrated_objects_table_.end() || !it->second)
+        {
+            return false;
+        }
+
+        addr = it->second;
+        return true;
+    }
+
+    void addressing_service::update_migrated_object(
+        naming::gid_type const& gid_, naming::address const& addr)
+    {
+        if (!gid_ || !addr)
+        {
+            HPX_THROW_EXCEPTION(bad_parameter,
+                "addressing_service::update_migrated_object",
+                "invalid reference gid or address");
+            return;
+        }
+
+        naming::gid_type gid(naming::detail::get_stripped_gid(gid_));
+
+        std::lock_guard<mutex_type> lock(migrated_objects_mtx_);
+
+        // the object may have been migrated back to this locality in the
+        // meantime
+        migrated_objects_table_type::iterator it =
+            migrated_objects_table_.find(gid);
+        if (it != migrated_objects_table_.end() &&
+            addr.locality_ != get_local_locality())
+        {
+            it->second = addr;
+        }
+    }
+
     std::pair<bool, components::pinned_ptr>
     addressing_service::was_object_migrated(naming::gid_type const& gid,
         hpx::move_only_function<components::pinned_ptr()>&& f    //-V669
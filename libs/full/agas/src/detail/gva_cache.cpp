@@ -0,0 +1,651 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/agas/detail/gva_cache.hpp>
+#include <hpx/agas_base/gva.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/naming_base/gid_type.hpp>
+#include <hpx/threading_base/thread_num_tss.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+namespace hpx::agas::detail {
+
+    namespace {
+
+        bool contains(std::uint64_t msb, std::uint64_t lsb,
+            std::uint64_t count, naming::gid_type const& gid) noexcept
+        {
+            return count != 0 && gid.get_msb() == msb &&
+                gid.get_lsb() - lsb < count && gid.get_lsb() >= lsb;
+        }
+
+        std::int64_t get_and_reset(
+            std::atomic<std::int64_t>& value, bool reset) noexcept
+        {
+            return reset ? value.exchange(0, std::memory_order_relaxed) :
+                           value.load(std::memory_order_relaxed);
+        }
+    }    // namespace
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Helper class to update timings and counts on function exit
+    struct gva_cache::update_on_exit
+    {
+        static std::int64_t now() noexcept
+        {
+            std::chrono::nanoseconds const ns =
+                std::chrono::steady_clock::now().time_since_epoch();
+            return static_cast<std::int64_t>(ns.count());
+        }
+
+        explicit update_on_exit(api_counter_data& data) noexcept
+          : started_at_(now())
+          , data_(data)
+        {
+        }
+
+        ~update_on_exit()
+        {
+            data_.time_.fetch_add(
+                now() - started_at_, std::memory_order_relaxed);
+            data_.count_.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        std::int64_t started_at_;
+        api_counter_data& data_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    gva_cache::~gva_cache() = default;
+
+    void gva_cache::reserve(std::size_t capacity)
+    {
+        std::unique_ptr<table> t;
+        if (capacity != 0)
+        {
+            std::size_t num_sets = 1;
+            while (num_sets * ways < capacity)
+            {
+                num_sets <<= 1;
+            }
+            t.reset(new table(num_sets));
+        }
+
+        std::lock_guard<mutex_type> l(mtx_);
+        std::lock_guard<mutex_type> lr(ranges_mtx_);
+
+        ranges_.clear();
+        num_ranges_.store(0, std::memory_order_relaxed);
+        capacity_ = capacity;
+
+        // concurrent lookups might still be reading the previous table, it is
+        // kept alive until the cache is destroyed
+        table_.store(t.get(), std::memory_order_release);
+        if (t)
+        {
+            tables_.push_back(HPX_MOVE(t));
+        }
+    }
+
+    std::size_t gva_cache::capacity() const noexcept
+    {
+        std::lock_guard<mutex_type> l(mtx_);
+        return capacity_;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    gva_cache::statistics_data& gva_cache::get_statistics() noexcept
+    {
+        // threads not managed by HPX share the last slot
+        std::size_t const num_thread = hpx::get_worker_thread_num();
+        return statistics_[num_thread % num_statistics];
+    }
+
+    template <typename F>
+    std::int64_t gva_cache::accumulate(F&& f, bool reset) noexcept
+    {
+        std::int64_t result = 0;
+        for (auto& stats : statistics_)
+        {
+            result += get_and_reset(f(stats), reset);
+        }
+        return result;
+    }
+
+    gva_cache::set& gva_cache::get_set(
+        table& t, naming::gid_type const& gid) const noexcept
+    {
+        std::uint64_t h = gid.get_lsb() ^ (gid.get_msb() * 0x9e3779b97f4a7c15);
+        h ^= h >> 33;
+        h *= 0xff51afd7ed558ccd;
+        h ^= h >> 33;
+        return t.sets_[static_cast<std::size_t>(h) & t.mask_];
+    }
+
+    std::uint64_t gva_cache::lock(set& s) noexcept
+    {
+        std::uint64_t sequence = s.sequence_.load(std::memory_order_relaxed);
+        while ((sequence & 1) != 0 ||
+            !s.sequence_.compare_exchange_weak(sequence, sequence + 1,
+                std::memory_order_acquire, std::memory_order_relaxed))
+        {
+            HPX_SMT_PAUSE;
+            sequence = s.sequence_.load(std::memory_order_relaxed);
+        }
+
+        // the modifications of the entries must not become visible before
+        // the sequence is marked odd
+        std::atomic_thread_fence(std::memory_order_release);
+        return sequence + 1;
+    }
+
+    void gva_cache::unlock(set& s, std::uint64_t sequence) noexcept
+    {
+        s.sequence_.store(sequence + 1, std::memory_order_release);
+    }
+
+    bool gva_cache::find(set& s, naming::gid_type const& gid,
+        naming::gid_type& idbase, gva& g) noexcept
+    {
+        constexpr auto relaxed = std::memory_order_relaxed;
+
+        while (true)
+        {
+            std::uint64_t const sequence =
+                s.sequence_.load(std::memory_order_acquire);
+            if ((sequence & 1) != 0)
+            {
+                HPX_SMT_PAUSE;
+                continue;
+            }
+
+            entry* found = nullptr;
+            for (entry& e : s.entries_)
+            {
+                std::uint64_t const msb = e.msb_.load(relaxed);
+                std::uint64_t const lsb = e.lsb_.load(relaxed);
+                if (contains(msb, lsb, e.count_.load(relaxed), gid))
+                {
+                    idbase = naming::gid_type(msb, lsb);
+                    g.prefix = naming::gid_type(e.prefix_msb_.load(relaxed),
+                        e.prefix_lsb_.load(relaxed));
+                    g.type = e.type_.load(relaxed);
+                    g.count = e.gva_count_.load(relaxed);
+                    g.lva(
+                        reinterpret_cast<gva::lva_type>(e.lva_.load(relaxed)));
+                    g.offset = e.offset_.load(relaxed);
+                    found = &e;
+                    break;
+                }
+            }
+
+            // the values read above are valid only if no writer modified the
+            // set in the meantime
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (s.sequence_.load(relaxed) != sequence)
+            {
+                continue;
+            }
+
+            if (found != nullptr)
+            {
+                found->referenced_.store(true, relaxed);
+                return true;
+            }
+            return false;
+        }
+    }
+
+    void gva_cache::store(set& s, naming::gid_type const& gid,
+        std::uint64_t count, gva const& g) noexcept
+    {
+        constexpr auto relaxed = std::memory_order_relaxed;
+
+        // overwrite the entry for the same range or fill an empty one,
+        // otherwise evict the first entry which was not referenced since the
+        // hand passed it the last time
+        entry* target = nullptr;
+        for (entry& e : s.entries_)
+        {
+            if (e.count_.load(relaxed) == 0)
+            {
+                if (target == nullptr)
+                {
+                    target = &e;
+                }
+            }
+            else if (e.msb_.load(relaxed) == gid.get_msb() &&
+                e.lsb_.load(relaxed) == gid.get_lsb())
+            {
+                target = &e;
+                break;
+            }
+        }
+
+        if (target == nullptr)
+        {
+            while (true)
+            {
+                entry& e = s.entries_[s.hand_];
+                s.hand_ = (s.hand_ + 1) % ways;
+                if (!e.referenced_.exchange(false, relaxed))
+                {
+                    target = &e;
+                    break;
+                }
+            }
+            get_statistics().evictions_.fetch_add(1, relaxed);
+        }
+
+        target->msb_.store(gid.get_msb(), relaxed);
+        target->lsb_.store(gid.get_lsb(), relaxed);
+        target->count_.store(count, relaxed);
+        target->prefix_msb_.store(g.prefix.get_msb(), relaxed);
+        target->prefix_lsb_.store(g.prefix.get_lsb(), relaxed);
+        target->type_.store(g.type, relaxed);
+        target->gva_count_.store(g.count, relaxed);
+        target->lva_.store(
+            reinterpret_cast<std::uint64_t>(g.lva()), relaxed);
+        target->offset_.store(g.offset, relaxed);
+        target->referenced_.store(false, relaxed);
+    }
+
+    bool gva_cache::remove(set& s, naming::gid_type const& gid) noexcept
+    {
+        constexpr auto relaxed = std::memory_order_relaxed;
+
+        bool removed_range = false;
+        for (entry& e : s.entries_)
+        {
+            std::uint64_t const count = e.count_.load(relaxed);
+            if (count != 0 && e.msb_.load(relaxed) == gid.get_msb() &&
+                e.lsb_.load(relaxed) == gid.get_lsb())
+            {
+                removed_range = removed_range || count > 1;
+                e.count_.store(0, relaxed);
+                e.referenced_.store(false, relaxed);
+            }
+        }
+        return removed_range;
+    }
+
+    void gva_cache::remove_everywhere(
+        table& t, naming::gid_type const& gid) noexcept
+    {
+        for (std::size_t i = 0; i <= t.mask_; ++i)
+        {
+            set& s = t.sets_[i];
+            std::uint64_t const sequence = lock(s);
+            remove(s, gid);
+            unlock(s, sequence);
+        }
+    }
+
+    gva_cache::range_table_type::iterator gva_cache::find_range(
+        naming::gid_type const& gid, std::uint64_t count) noexcept
+    {
+        // the ranges held by the table don't overlap, it is sufficient to
+        // look at the one with the largest base not after the given range
+        auto it = ranges_.upper_bound(gid + (count - 1));
+        if (it == ranges_.begin())
+        {
+            return ranges_.end();
+        }
+
+        --it;
+        if (it->first.get_msb() != gid.get_msb())
+        {
+            return ranges_.end();
+        }
+
+        std::uint64_t const last =
+            it->first.get_lsb() + (it->second.count_ - 1);
+        return last >= gid.get_lsb() ? it : ranges_.end();
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    bool gva_cache::get_entry(naming::gid_type const& id,
+        naming::gid_type& idbase, gva& g) noexcept
+    {
+        statistics_data& stats = get_statistics();
+        update_on_exit update(stats.get_entry_);
+
+        table* t = table_.load(std::memory_order_acquire);
+        if (t == nullptr)
+        {
+            stats.misses_.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+
+        naming::gid_type const gid = naming::detail::get_stripped_gid(id);
+        set& s = get_set(*t, gid);
+        if (find(s, gid, idbase, g))
+        {
+            stats.hits_.fetch_add(1, std::memory_order_relaxed);
+            return true;
+        }
+
+        // the gid might be part of a range which was not looked up through
+        // this set before
+        if (num_ranges_.load(std::memory_order_relaxed) != 0)
+        {
+            std::lock_guard<mutex_type> l(ranges_mtx_);
+
+            auto it = find_range(gid, 1);
+            if (it != ranges_.end() &&
+                t == table_.load(std::memory_order_relaxed))
+            {
+                idbase = it->first;
+                g = it->second.gva_;
+
+                // copy the range into the set of the gid, this is done while
+                // holding the lock to not race with the removal of the range
+                std::uint64_t const sequence = lock(s);
+                store(s, it->first, it->second.count_, g);
+                unlock(s, sequence);
+
+                stats.hits_.fetch_add(1, std::memory_order_relaxed);
+                return true;
+            }
+        }
+
+        stats.misses_.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    bool gva_cache::update_entry(naming::gid_type const& id,
+        std::uint64_t count, gva const& g,
+        std::pair<naming::gid_type, std::uint64_t>& collision)
+    {
+        HPX_ASSERT(count != 0);
+
+        statistics_data& stats = get_statistics();
+
+        table* t = table_.load(std::memory_order_acquire);
+        if (t == nullptr)
+        {
+            return true;
+        }
+
+        naming::gid_type const gid = naming::detail::get_stripped_gid(id);
+
+        std::unique_lock<mutex_type> l(ranges_mtx_, std::defer_lock);
+        if (count > 1 || num_ranges_.load(std::memory_order_relaxed) != 0)
+        {
+            l.lock();
+
+            auto it = find_range(gid, count);
+            if (it != ranges_.end())
+            {
+                if (it->first != gid || it->second.count_ != count)
+                {
+                    collision = std::make_pair(it->first, it->second.count_);
+                    return false;
+                }
+
+                // update the range, the copies held by other sets are dropped
+                // and recreated when the gids are looked up again
+                update_on_exit update(stats.update_entry_);
+
+                it->second.gva_ = g;
+                remove_everywhere(*t, gid);
+
+                set& s = get_set(*t, gid);
+                std::uint64_t const sequence = lock(s);
+                store(s, gid, count, g);
+                unlock(s, sequence);
+
+                stats.hits_.fetch_add(1, std::memory_order_relaxed);
+                return true;
+            }
+
+            if (count > 1)
+            {
+                update_on_exit update(stats.insert_entry_);
+
+                // make room for the new range, the range with the smallest
+                // base is dropped (this is a rare case)
+                if (ranges_.size() >= capacity_ && !ranges_.empty())
+                {
+                    auto first = ranges_.begin();
+                    remove_everywhere(*t, first->first);
+                    ranges_.erase(first);
+                    num_ranges_.fetch_sub(1, std::memory_order_relaxed);
+                    stats.evictions_.fetch_add(1, std::memory_order_relaxed);
+                }
+
+                ranges_.emplace(gid, range_data{count, g});
+                num_ranges_.fetch_add(1, std::memory_order_relaxed);
+
+                set& s = get_set(*t, gid);
+                std::uint64_t const sequence = lock(s);
+                remove(s, gid);
+                store(s, gid, count, g);
+                unlock(s, sequence);
+
+                stats.insertions_.fetch_add(1, std::memory_order_relaxed);
+                stats.misses_.fetch_add(1, std::memory_order_relaxed);
+                return true;
+            }
+        }
+
+        // a single gid
+        set& s = get_set(*t, gid);
+        std::uint64_t const sequence = lock(s);
+
+        bool exists = false;
+        for (entry& e : s.entries_)
+        {
+            constexpr auto relaxed = std::memory_order_relaxed;
+
+            std::uint64_t const msb = e.msb_.load(relaxed);
+            std::uint64_t const lsb = e.lsb_.load(relaxed);
+            std::uint64_t const entry_count = e.count_.load(relaxed);
+            if (contains(msb, lsb, entry_count, gid))
+            {
+                if (entry_count != 1)
+                {
+                    unlock(s, sequence);
+                    collision = std::make_pair(
+                        naming::gid_type(msb, lsb), entry_count);
+                    return false;
+                }
+                exists = true;
+                break;
+            }
+        }
+
+        {
+            update_on_exit update(
+                exists ? stats.update_entry_ : stats.insert_entry_);
+            store(s, gid, 1, g);
+        }
+        unlock(s, sequence);
+
+        if (exists)
+        {
+            stats.hits_.fetch_add(1, std::memory_order_relaxed);
+        }
+        else
+        {
+            stats.insertions_.fetch_add(1, std::memory_order_relaxed);
+            stats.misses_.fetch_add(1, std::memory_order_relaxed);
+        }
+        return true;
+    }
+
+    void gva_cache::erase(naming::gid_type const& id)
+    {
+        update_on_exit update(get_statistics().erase_entry_);
+
+        table* t = table_.load(std::memory_order_acquire);
+        if (t == nullptr)
+        {
+            return;
+        }
+
+        naming::gid_type const gid = naming::detail::get_stripped_gid(id);
+
+        std::unique_lock<mutex_type> l(ranges_mtx_, std::defer_lock);
+        if (num_ranges_.load(std::memory_order_relaxed) != 0)
+        {
+            l.lock();
+
+            auto it = ranges_.find(gid);
+            if (it != ranges_.end())
+            {
+                ranges_.erase(it);
+                num_ranges_.fetch_sub(1, std::memory_order_relaxed);
+                remove_everywhere(*t, gid);
+                return;
+            }
+        }
+
+        set& s = get_set(*t, gid);
+        std::uint64_t const sequence = lock(s);
+        remove(s, gid);
+        unlock(s, sequence);
+    }
+
+    void gva_cache::clear()
+    {
+        std::lock_guard<mutex_type> l(ranges_mtx_);
+
+        ranges_.clear();
+        num_ranges_.store(0, std::memory_order_relaxed);
+
+        table* t = table_.load(std::memory_order_acquire);
+        if (t == nullptr)
+        {
+            return;
+        }
+
+        for (std::size_t i = 0; i <= t->mask_; ++i)
+        {
+            set& s = t->sets_[i];
+            std::uint64_t const sequence = lock(s);
+            for (entry& e : s.entries_)
+            {
+                e.count_.store(0, std::memory_order_relaxed);
+                e.referenced_.store(false, std::memory_order_relaxed);
+            }
+            unlock(s, sequence);
+        }
+    }
+
+    std::size_t gva_cache::size() const noexcept
+    {
+        table* t = table_.load(std::memory_order_acquire);
+        if (t == nullptr)
+        {
+            return 0;
+        }
+
+        // this is an approximation if the cache is modified concurrently
+        std::size_t result = 0;
+        for (std::size_t i = 0; i <= t->mask_; ++i)
+        {
+            for (entry const& e : t->sets_[i].entries_)
+            {
+                if (e.count_.load(std::memory_order_relaxed) != 0)
+                {
+                    ++result;
+                }
+            }
+        }
+        return result;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    std::int64_t gva_cache::hits(bool reset) noexcept
+    {
+        return accumulate(
+            [](statistics_data& s) -> auto& { return s.hits_; }, reset);
+    }
+
+    std::int64_t gva_cache::misses(bool reset) noexcept
+    {
+        return accumulate(
+            [](statistics_data& s) -> auto& { return s.misses_; }, reset);
+    }
+
+    std::int64_t gva_cache::evictions(bool reset) noexcept
+    {
+        return accumulate(
+            [](statistics_data& s) -> auto& { return s.evictions_; }, reset);
+    }
+
+    std::int64_t gva_cache::insertions(bool reset) noexcept
+    {
+        return accumulate(
+            [](statistics_data& s) -> auto& { return s.insertions_; }, reset);
+    }
+
+    std::int64_t gva_cache::get_entry_count(bool reset) noexcept
+    {
+        return accumulate(
+            [](statistics_data& s) -> auto& { return s.get_entry_.count_; },
+            reset);
+    }
+
+    std::int64_t gva_cache::insert_entry_count(bool reset) noexcept
+    {
+        return accumulate(
+            [](statistics_data& s) -> auto& { return s.insert_entry_.count_; },
+            reset);
+    }
+
+    std::int64_t gva_cache::update_entry_count(bool reset) noexcept
+    {
+        return accumulate(
+            [](statistics_data& s) -> auto& { return s.update_entry_.count_; },
+            reset);
+    }
+
+    std::int64_t gva_cache::erase_entry_count(bool reset) noexcept
+    {
+        return accumulate(
+            [](statistics_data& s) -> auto& { return s.erase_entry_.count_; },
+            reset);
+    }
+
+    std::int64_t gva_cache::get_entry_time(bool reset) noexcept
+    {
+        return accumulate(
+            [](statistics_data& s) -> auto& { return s.get_entry_.time_; },
+            reset);
+    }
+
+    std::int64_t gva_cache::insert_entry_time(bool reset) noexcept
+    {
+        return accumulate(
+            [](statistics_data& s) -> auto& { return s.insert_entry_.time_; },
+            reset);
+    }
+
+    std::int64_t gva_cache::update_entry_time(bool reset) noexcept
+    {
+        return accumulate(
+            [](statistics_data& s) -> auto& { return s.update_entry_.time_; },
+            reset);
+    }
+
+    std::int64_t gva_cache::erase_entry_time(bool reset) noexcept
+    {
+        return accumulate(
+            [](statistics_data& s) -> auto& { return s.erase_entry_.time_; },
+            reset);
+    }
+}    // namespace hpx::agas::detail
@@ -155,6 +155,12 @@ namespace hpx { namespace agas { namespace detail { namespace impl {
         return naming::get_agas_client().resolve_async(id).get(ec);
     }
 
+    hpx::future<std::vector<naming::address>> resolve_bulk_async(
+        std::vector<hpx::id_type> const& ids)
+    {
+        return naming::get_agas_client().resolve_async(ids);
+    }
+
     bool resolve_local(
         naming::gid_type const& gid, naming::address& addr, error_code& ec)
     {
@@ -568,6 +574,7 @@ namespace hpx { namespace agas {
 
             detail::resolve_async = &detail::impl::resolve_async;
             detail::resolve = &detail::impl::resolve;
+            detail::resolve_bulk_async = &detail::impl::resolve_bulk_async;
             detail::resolve_cached = &detail::impl::resolve_cached;
             detail::resolve_local = &detail::impl::resolve_local;
 
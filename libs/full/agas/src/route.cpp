@@ -54,17 +54,18 @@ namespace hpx::agas::server {
         // resolve destination addresses, we should be able to resolve all of
         // them, otherwise it's an error
         {
-            std::unique_lock<mutex_type> l(mutex_);
+            gva_shard& shard = get_gva_shard(gid);
+            std::unique_lock<mutex_type> l = lock_shard(shard);
 
             error_code& ec = throws;
 
             // wait for any migration to be completed
             if (naming::detail::is_migratable(gid))
             {
-                wait_for_migration_locked(l, gid, ec);
+                wait_for_migration_locked(shard, l, gid, ec);
             }
 
-            cache_address = resolve_gid_locked(l, gid, ec);
+            cache_address = resolve_gid_locked(shard, l, gid, ec);
 
             if (ec || hpx::get<0>(cache_address) == naming::invalid_gid)
             {
@@ -130,6 +131,12 @@ namespace hpx::agas::server {
             }
         }
     }
+
+    void primary_namespace::update_migrated_object(
+        naming::gid_type const& id, naming::address const& addr)
+    {
+        naming::get_agas_client().update_migrated_object(id, addr);
+    }
 }    // namespace hpx::agas::server
 
 #endif
@@ -0,0 +1,217 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify the lookups, updates, and the eviction of the entries of the GVA
+// cache used by the addressing service, also while it is accessed
+// concurrently.
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx_main.hpp>
+#include <hpx/agas/detail/gva_cache.hpp>
+#include <hpx/include/async.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+using hpx::agas::gva;
+using hpx::agas::detail::gva_cache;
+using hpx::naming::gid_type;
+
+constexpr std::uint64_t locality_msb = 0x0000000200000000ull;
+
+gva make_gva(std::uint64_t lva, std::uint64_t count = 1)
+{
+    return gva(gid_type(locality_msb, std::uint64_t(0)), 42, count, lva, 8);
+}
+
+void test_single()
+{
+    gva_cache cache;
+    cache.reserve(64);
+    HPX_TEST_EQ(cache.capacity(), std::size_t(64));
+
+    std::pair<gid_type, std::uint64_t> collision;
+    gid_type const id(locality_msb, 100);
+
+    gid_type idbase;
+    gva g;
+    HPX_TEST(!cache.get_entry(id, idbase, g));
+
+    HPX_TEST(cache.update_entry(id, 1, make_gva(0x1000), collision));
+    HPX_TEST(cache.get_entry(id, idbase, g));
+    HPX_TEST_EQ(idbase, id);
+    HPX_TEST(g == make_gva(0x1000));
+    HPX_TEST_EQ(cache.size(), std::size_t(1));
+
+    // updating the entry replaces the GVA
+    HPX_TEST(cache.update_entry(id, 1, make_gva(0x2000), collision));
+    HPX_TEST(cache.get_entry(id, idbase, g));
+    HPX_TEST(g == make_gva(0x2000));
+    HPX_TEST_EQ(cache.size(), std::size_t(1));
+
+    cache.erase(id);
+    HPX_TEST(!cache.get_entry(id, idbase, g));
+    HPX_TEST_EQ(cache.size(), std::size_t(0));
+
+    // the update of the existing entry counts as a hit, the insertion as a
+    // miss
+    HPX_TEST_EQ(cache.hits(true), std::int64_t(3));
+    HPX_TEST_EQ(cache.misses(true), std::int64_t(3));
+    HPX_TEST_EQ(cache.insertions(true), std::int64_t(1));
+    HPX_TEST_EQ(cache.get_entry_count(true), std::int64_t(4));
+    HPX_TEST_EQ(cache.insert_entry_count(true), std::int64_t(1));
+    HPX_TEST_EQ(cache.update_entry_count(true), std::int64_t(1));
+    HPX_TEST_EQ(cache.erase_entry_count(true), std::int64_t(1));
+    HPX_TEST_EQ(cache.hits(false), std::int64_t(0));
+}
+
+void test_ranges()
+{
+    gva_cache cache;
+    cache.reserve(64);
+
+    std::pair<gid_type, std::uint64_t> collision;
+    gid_type const base(locality_msb, 1000);
+    std::uint64_t const count = 100;
+
+    HPX_TEST(
+        cache.update_entry(base, count, make_gva(0x1000, count), collision));
+
+    // all gids of the range are found, no matter which set they hash to
+    for (std::uint64_t i = 0; i != count; ++i)
+    {
+        gid_type idbase;
+        gva g;
+        HPX_TEST(cache.get_entry(base + i, idbase, g));
+        HPX_TEST_EQ(idbase, base);
+        HPX_TEST_EQ(g.count, count);
+    }
+
+    gid_type idbase;
+    gva g;
+    HPX_TEST(!cache.get_entry(base + count, idbase, g));
+
+    // single gids and ranges overlapping the range collide with it
+    HPX_TEST(!cache.update_entry(base + 10, 1, make_gva(0x3000), collision));
+    HPX_TEST_EQ(collision.first, base);
+    HPX_TEST_EQ(collision.second, count);
+    HPX_TEST(!cache.update_entry(
+        base + (count - 1), 10, make_gva(0x3000, 10), collision));
+    HPX_TEST(!cache.update_entry(base, 10, make_gva(0x3000, 10), collision));
+
+    // updating the range replaces all copies
+    HPX_TEST(
+        cache.update_entry(base, count, make_gva(0x2000, count), collision));
+    for (std::uint64_t i = 0; i != count; ++i)
+    {
+        HPX_TEST(cache.get_entry(base + i, idbase, g));
+        HPX_TEST(g == make_gva(0x2000, count));
+    }
+
+    // erasing the range removes all copies
+    cache.erase(base);
+    for (std::uint64_t i = 0; i != count; ++i)
+    {
+        HPX_TEST(!cache.get_entry(base + i, idbase, g));
+    }
+    HPX_TEST_EQ(cache.size(), std::size_t(0));
+
+    HPX_TEST(cache.update_entry(base + 10, 1, make_gva(0x3000), collision));
+}
+
+void test_eviction()
+{
+    gva_cache cache;
+    cache.reserve(16);
+
+    std::pair<gid_type, std::uint64_t> collision;
+    std::size_t const num_entries = 256;
+    for (std::size_t i = 0; i != num_entries; ++i)
+    {
+        gid_type const id(locality_msb, i + 1);
+        HPX_TEST(cache.update_entry(id, 1, make_gva(i), collision));
+    }
+
+    std::int64_t const evictions = cache.evictions(false);
+    HPX_TEST(evictions > 0);
+    HPX_TEST_EQ(cache.size() + std::size_t(evictions), num_entries);
+
+    // the entries still held by the cache are valid
+    std::size_t found = 0;
+    for (std::size_t i = 0; i != num_entries; ++i)
+    {
+        gid_type const id(locality_msb, i + 1);
+        gid_type idbase;
+        gva g;
+        if (cache.get_entry(id, idbase, g))
+        {
+            HPX_TEST(g == make_gva(i));
+            ++found;
+        }
+    }
+    HPX_TEST_EQ(found, cache.size());
+
+    cache.clear();
+    HPX_TEST_EQ(cache.size(), std::size_t(0));
+}
+
+void test_concurrent()
+{
+    gva_cache cache;
+    cache.reserve(1024);
+
+    std::size_t const num_entries = 512;
+    std::vector<hpx::future<void>> futures;
+    for (std::size_t t = 0; t != 4; ++t)
+    {
+        futures.push_back(hpx::async([&cache, t, num_entries]() {
+            std::pair<gid_type, std::uint64_t> collision;
+            for (std::size_t n = 0; n != 100; ++n)
+            {
+                for (std::size_t i = 0; i != num_entries; ++i)
+                {
+                    gid_type const id(locality_msb, i + 1);
+                    if ((i + n + t) % 4 == 0)
+                    {
+                        // the offset of the entries matches their address
+                        std::uint64_t const value = (i << 16) + n;
+                        gva const g(gid_type(locality_msb, std::uint64_t(0)),
+                            42, 1, value, value);
+                        cache.update_entry(id, 1, g, collision);
+                        continue;
+                    }
+
+                    // a lookup never sees a partially written entry
+                    gid_type idbase;
+                    gva g;
+                    if (cache.get_entry(id, idbase, g))
+                    {
+                        HPX_TEST_EQ(idbase, id);
+                        HPX_TEST_EQ(
+                            reinterpret_cast<std::uint64_t>(g.lva()), g.offset);
+                        HPX_TEST_EQ(g.offset >> 16, std::uint64_t(i));
+                    }
+                }
+            }
+        }));
+    }
+    hpx::wait_all(futures);
+}
+
+int main()
+{
+    test_single();
+    test_ranges();
+    test_eviction();
+    test_concurrent();
+
+    return hpx::util::report_errors();
+}
+#endif
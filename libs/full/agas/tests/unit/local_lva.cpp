@@ -0,0 +1,73 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify that the ids of non-migratable components created on this locality
+// are resolved directly from the address they carry, without looking at the
+// cache of the addressing service.
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx_main.hpp>
+#include <hpx/agas/addressing_service.hpp>
+#include <hpx/include/actions.hpp>
+#include <hpx/include/components.hpp>
+#include <hpx/include/runtime.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstdint>
+#include <memory>
+
+struct test_server : hpx::components::component_base<test_server>
+{
+    std::uint64_t call() const
+    {
+        return reinterpret_cast<std::uint64_t>(this);
+    }
+
+    HPX_DEFINE_COMPONENT_ACTION(test_server, call, call_action)
+};
+
+typedef hpx::components::component<test_server> server_type;
+HPX_REGISTER_COMPONENT(server_type, test_server)
+
+typedef test_server::call_action call_action;
+HPX_REGISTER_ACTION_DECLARATION(call_action)
+HPX_REGISTER_ACTION(call_action)
+
+int main()
+{
+    hpx::id_type const id = hpx::new_<test_server>(hpx::find_here()).get();
+    hpx::naming::gid_type const gid = id.get_gid();
+
+    HPX_TEST(hpx::naming::refers_to_local_lva(gid, hpx::get_locality_id()));
+    HPX_TEST(!hpx::naming::refers_to_local_lva(
+        gid, hpx::get_locality_id() + 1));
+
+    // the ids of localities don't carry an address
+    HPX_TEST(!hpx::naming::refers_to_local_lva(
+        hpx::find_here().get_gid(), hpx::get_locality_id()));
+
+    hpx::agas::addressing_service& agas_client = hpx::naming::get_agas_client();
+    agas_client.get_cache_get_entry_count(true);
+
+    hpx::naming::address addr;
+    HPX_TEST(hpx::agas::is_local_address_cached(id, addr));
+    HPX_TEST_EQ(addr.locality_, hpx::agas::get_locality());
+    HPX_TEST_EQ(addr.type_, hpx::components::get_component_type<test_server>());
+
+    std::shared_ptr<test_server> ptr =
+        hpx::get_ptr<test_server>(hpx::launch::sync, id);
+    HPX_TEST_EQ(reinterpret_cast<test_server*>(addr.address_), ptr.get());
+
+    // invoking an action resolves the id the same way
+    HPX_TEST_EQ(hpx::async<call_action>(id).get(),
+        reinterpret_cast<std::uint64_t>(ptr.get()));
+
+    HPX_TEST_EQ(agas_client.get_cache_get_entry_count(false), std::uint64_t(0));
+
+    return hpx::util::report_errors();
+}
+#endif
@@ -0,0 +1,106 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify that ranges of gids spanning several shards of the primary namespace
+// tables are resolved and unbound correctly, and that the lock statistics of
+// the shards are exposed as performance counters.
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx_main.hpp>
+#include <hpx/agas/addressing_service.hpp>
+#include <hpx/agas_base/server/primary_namespace.hpp>
+#include <hpx/include/performance_counters.hpp>
+#include <hpx/include/runtime.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+using hpx::agas::server::primary_namespace;
+
+constexpr std::uint64_t element_size = 8;
+
+std::uint64_t resolve_lva(hpx::naming::gid_type const& gid)
+{
+    hpx::naming::address addr;
+    if (!hpx::naming::get_agas_client().resolve_full_local(gid, addr))
+    {
+        return 0;
+    }
+    return reinterpret_cast<std::uint64_t>(addr.address_);
+}
+
+void test_range(std::uint64_t count)
+{
+    hpx::naming::gid_type const base = hpx::naming::detail::get_stripped_gid(
+        hpx::agas::get_next_id(count));
+
+    // the address is never dereferenced
+    std::uint64_t const lva = 0x10000;
+    hpx::naming::address const addr(hpx::agas::get_locality(),
+        hpx::components::component_base_lco_with_value,
+        reinterpret_cast<void*>(lva));
+
+    HPX_TEST(hpx::agas::bind_range_local(base, count, addr, element_size));
+
+    for (std::uint64_t i = 0; i != count; ++i)
+    {
+        HPX_TEST_EQ(resolve_lva(base + i), lva + i * element_size);
+    }
+    HPX_TEST_EQ(resolve_lva(base + count), std::uint64_t(0));
+
+    hpx::agas::unbind_range_local(base, count);
+
+    // none of the shards refers to the range anymore
+    for (std::uint64_t i = 0; i != count; ++i)
+    {
+        HPX_TEST_EQ(resolve_lva(base + i), std::uint64_t(0));
+    }
+}
+
+std::int64_t query_counter(std::string const& name)
+{
+    hpx::performance_counters::performance_counter counter(name);
+    return counter.get_value<std::int64_t>(hpx::launch::sync);
+}
+
+void test_counters()
+{
+    std::string const locks = "/agas{locality#0/total}/count/shard_locks";
+    std::string const contended =
+        "/agas{locality#0/total}/count/contended_shard_locks";
+
+    std::int64_t const contended_all = query_counter(contended);
+    std::int64_t const all = query_counter(locks);
+    HPX_TEST(all > 0);
+    HPX_TEST(contended_all <= all);
+
+    // the counts of the shards add up
+    std::int64_t sum = 0;
+    for (std::size_t i = 0; i != primary_namespace::num_shards; ++i)
+    {
+        sum += query_counter(locks + "@" + std::to_string(i));
+    }
+    HPX_TEST(sum >= all);
+}
+
+int main()
+{
+    test_range(1);
+
+    // within a single block, spanning a few shards, and spanning all of them
+    test_range(primary_namespace::num_shards / 2);
+    constexpr unsigned block_bits = primary_namespace::shard_block_bits;
+    test_range(std::uint64_t(3) << block_bits);
+    test_range(std::uint64_t(primary_namespace::num_shards + 4) << block_bits);
+
+    test_counters();
+
+    return hpx::util::report_errors();
+}
+#endif
@@ -0,0 +1,86 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify that many ids are resolved at once and that the addresses are
+// returned in the order of the ids.
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx_main.hpp>
+#include <hpx/agas/addressing_service.hpp>
+#include <hpx/include/runtime.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+constexpr std::uint64_t element_size = 8;
+
+hpx::id_type make_unmanaged(hpx::naming::gid_type const& gid)
+{
+    return hpx::id_type(gid, hpx::id_type::management_type::unmanaged);
+}
+
+void test_resolve(std::uint64_t count)
+{
+    hpx::naming::gid_type const base = hpx::naming::detail::get_stripped_gid(
+        hpx::agas::get_next_id(count));
+
+    // the address is never dereferenced
+    std::uint64_t const lva = 0x10000;
+    hpx::naming::address const addr(hpx::agas::get_locality(),
+        hpx::components::component_base_lco_with_value,
+        reinterpret_cast<void*>(lva));
+
+    HPX_TEST(hpx::agas::bind_range_local(base, count, addr, element_size));
+
+    // resolve the ids in reverse order
+    std::vector<hpx::id_type> ids;
+    ids.reserve(count);
+    for (std::uint64_t i = 0; i != count; ++i)
+    {
+        ids.push_back(make_unmanaged(base + (count - i - 1)));
+    }
+
+    std::vector<hpx::naming::address> addrs = hpx::agas::resolve(ids).get();
+    HPX_TEST_EQ(addrs.size(), ids.size());
+    for (std::size_t i = 0; i != addrs.size(); ++i)
+    {
+        std::uint64_t const expected = lva + (count - i - 1) * element_size;
+        HPX_TEST_EQ(
+            reinterpret_cast<std::uint64_t>(addrs[i].address_), expected);
+        HPX_TEST_EQ(addrs[i].locality_, hpx::agas::get_locality());
+    }
+
+    // a single unknown id makes the whole request fail
+    ids.push_back(make_unmanaged(base + count));
+
+    bool caught_exception = false;
+    try
+    {
+        hpx::agas::resolve(ids).get();
+    }
+    catch (hpx::exception const&)
+    {
+        caught_exception = true;
+    }
+    HPX_TEST(caught_exception);
+
+    hpx::agas::unbind_range_local(base, count);
+}
+
+int main()
+{
+    // nothing to resolve
+    HPX_TEST(hpx::agas::resolve(std::vector<hpx::id_type>()).get().empty());
+
+    test_resolve(1);
+    test_resolve(100);
+
+    return hpx::util::report_errors();
+}
+#endif
@@ -0,0 +1,77 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify that concurrent resolves of the same remote id which miss the cache
+// attach to a single request sent to the primary namespace.
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx_main.hpp>
+#include <hpx/agas/addressing_service.hpp>
+#include <hpx/include/components.hpp>
+#include <hpx/include/runtime.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// ids of migratable components are never stored in the cache, every resolve
+// goes to the primary namespace
+struct test_server
+  : hpx::components::migration_support<
+        hpx::components::component_base<test_server>>
+{
+};
+
+typedef hpx::components::component<test_server> server_type;
+HPX_REGISTER_COMPONENT(server_type, test_server)
+
+int main()
+{
+    std::vector<hpx::id_type> localities = hpx::find_remote_localities();
+    if (localities.empty())
+    {
+        return hpx::util::report_errors();
+    }
+
+    hpx::id_type const id = hpx::new_<test_server>(localities[0]).get();
+
+    hpx::agas::addressing_service& agas_client = hpx::naming::get_agas_client();
+    agas_client.get_coalesced_resolves_count(true);
+
+    constexpr std::size_t count = 100;
+
+    std::vector<hpx::future<hpx::naming::address>> resolves;
+    resolves.reserve(count);
+    for (std::size_t i = 0; i != count; ++i)
+    {
+        resolves.push_back(hpx::agas::resolve(id));
+    }
+
+    hpx::naming::gid_type const there =
+        hpx::naming::get_gid_from_locality_id(
+            hpx::naming::get_locality_id_from_id(localities[0]));
+
+    hpx::naming::address const first = resolves[0].get();
+    HPX_TEST_EQ(first.locality_, there);
+    for (std::size_t i = 1; i != count; ++i)
+    {
+        hpx::naming::address const addr = resolves[i].get();
+        HPX_TEST_EQ(addr.locality_, first.locality_);
+        HPX_TEST_EQ(addr.address_, first.address_);
+    }
+
+    // the requests were issued faster than the remote locality can answer
+    HPX_TEST_LT(std::uint64_t(0),
+        agas_client.get_coalesced_resolves_count(false));
+
+    // nothing is pending anymore, resolving again still succeeds
+    HPX_TEST_EQ(hpx::agas::resolve(id).get().address_, first.address_);
+
+    return hpx::util::report_errors();
+}
+#endif
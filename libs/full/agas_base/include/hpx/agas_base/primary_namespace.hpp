@@ -74,6 +74,11 @@ namespace hpx { namespace agas {
         resolved_type resolve_gid(naming::gid_type const& id);
         future<resolved_type> resolve_full(naming::gid_type id);
 
+        // All gids have to be managed by the same service instance, the
+        // results are returned in the order of the gids.
+        future<std::vector<resolved_type>> resolve_full(
+            std::vector<naming::gid_type> ids);
+
         future<id_type> colocate(naming::gid_type id);
 
         naming::address unbind_gid(
@@ -19,11 +19,13 @@
 #include <hpx/async_distributed/base_lco_with_value.hpp>
 #include <hpx/async_distributed/transfer_continuation_action.hpp>
 #include <hpx/components_base/server/fixed_component_base.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
 #include <hpx/datastructures/tuple.hpp>
 #include <hpx/naming_base/id_type.hpp>
 #include <hpx/parcelset_base/traits/action_get_embedded_parcel.hpp>
 #include <hpx/synchronization/condition_variable.hpp>
 
+#include <array>
 #include <atomic>
 #include <cstddef>
 #include <cstdint>
@@ -126,22 +128,67 @@ namespace hpx::agas::server {
         using resolved_type =
             hpx::tuple<naming::gid_type, gva, naming::gid_type>;
 
-    private:
-        // REVIEW: Separate mutexes might reduce contention here. This has to be
-        // investigated carefully.
-        mutex_type mutex_;
-
-        gva_table_type gvas_;
-        refcnt_table_type refcnts_;
+        // The GVA and the reference count tables are split into shards which
+        // are protected by separate locks. Consecutive blocks of gids are
+        // assigned to consecutive shards. A range of gids is stored in all
+        // shards its blocks are assigned to, any gid can therefore be
+        // resolved by looking at a single shard.
+        static constexpr std::size_t num_shards = 16;
+        static constexpr unsigned shard_block_bits = 4;
 
+    private:
+        // migrating, number of waiting threads, condition to wait on, and
+        // locality the object is migrated away from
         using migration_table_type = std::map<naming::gid_type,
             hpx::tuple<bool, std::size_t,
-                lcos::local::detail::condition_variable>>;
+                lcos::local::detail::condition_variable, naming::gid_type>>;
+
+        // lock statistics of a shard
+        struct shard_statistics
+        {
+            std::atomic<std::int64_t> locks_{0};
+            std::atomic<std::int64_t> contended_locks_{0};
+        };
+
+        struct gva_shard
+        {
+            mutex_type mtx_;
+            gva_table_type gvas_;
+            migration_table_type migrating_objects_;
+            shard_statistics statistics_;
+        };
+
+        struct refcnt_shard
+        {
+            mutex_type mtx_;
+            refcnt_table_type refcnts_;
+            shard_statistics statistics_;
+        };
+
+        // The shards storing a range of gids, these are the count shards
+        // following first (modulo num_shards).
+        struct shard_range
+        {
+            std::size_t first;
+            std::size_t count;
+
+            constexpr bool contains(std::size_t shard) const noexcept
+            {
+                return (shard + num_shards - first) % num_shards < count;
+            }
+        };
+
+        using shard_locks_type =
+            std::array<std::unique_lock<mutex_type>, num_shards>;
+
+        std::array<util::cache_aligned_data_derived<gva_shard>, num_shards>
+            gva_shards_;
+        std::array<util::cache_aligned_data_derived<refcnt_shard>, num_shards>
+            refcnt_shards_;
 
         std::string instance_name_;
         naming::gid_type next_id_;     // next available gid
         naming::gid_type locality_;    // our locality id
-        migration_table_type migrating_objects_;
 
         struct update_time_on_exit;
 
@@ -224,24 +271,62 @@ namespace hpx::agas::server {
 
         counter_data counter_data_;
 
+        // access the lock statistics of the given shard, or of all shards if
+        // shard is equal to num_shards
+        std::int64_t get_shard_lock_count(std::size_t shard, bool reset);
+        std::int64_t get_contended_shard_lock_count(
+            std::size_t shard, bool reset);
+
     private:
+        // the shard a gid (or the block of gids it belongs to) is assigned to
+        static std::size_t get_shard_index(naming::gid_type id) noexcept;
+
+        // the shards storing the gids [id, id + count)
+        static shard_range get_shard_range(
+            naming::gid_type id, std::uint64_t count) noexcept;
+
+        gva_shard& get_gva_shard(naming::gid_type const& id) noexcept
+        {
+            return gva_shards_[get_shard_index(id)];
+        }
+
+        refcnt_shard& get_refcnt_shard(naming::gid_type const& id) noexcept
+        {
+            return refcnt_shards_[get_shard_index(id)];
+        }
+
+        // acquire the lock of a shard, keeping track of contention
+        template <typename Shard>
+        static std::unique_lock<mutex_type> lock_shard(Shard& shard)
+        {
+            std::unique_lock<mutex_type> l(shard.mtx_, std::try_to_lock);
+            if (!l.owns_lock())
+            {
+                shard.statistics_.contended_locks_.fetch_add(
+                    1, std::memory_order_relaxed);
+                l.lock();
+            }
+            shard.statistics_.locks_.fetch_add(1, std::memory_order_relaxed);
+            return l;
+        }
+
+        // lock all gva shards of the given range in increasing order
+        void lock_gva_shards(shard_range const& r, shard_locks_type& locks);
+
 #if defined(HPX_HAVE_AGAS_DUMP_REFCNT_ENTRIES)
-        /// Dump the credit counts of all matching ranges. Expects that \p l
-        /// is locked.
-        void dump_refcnt_matches(refcnt_table_type::iterator lower_it,
-            refcnt_table_type::iterator upper_it, naming::gid_type const& lower,
-            naming::gid_type const& upper, std::unique_lock<mutex_type>& l,
-            const char* func_name);
+        /// Dump the credit counts of all matching ranges.
+        void dump_refcnt_matches(naming::gid_type const& lower,
+            naming::gid_type const& upper, const char* func_name);
 #endif
 
         // helper function
-        void wait_for_migration_locked(std::unique_lock<mutex_type>& l,
-            naming::gid_type const& id, error_code& ec);
+        void wait_for_migration_locked(gva_shard& shard,
+            std::unique_lock<mutex_type>& l, naming::gid_type const& id,
+            error_code& ec);
 
     public:
         primary_namespace()
           : base_type(agas::primary_ns_msb, agas::primary_ns_lsb)
-          , mutex_()
           , instance_name_()
           , next_id_(naming::invalid_gid)
           , locality_(naming::invalid_gid)
@@ -264,6 +349,11 @@ namespace hpx::agas::server {
 
 #if defined(HPX_HAVE_NETWORKING)
         void route(parcelset::parcel&& p);
+
+        // record the new address of an object which was migrated away from
+        // the locality of this instance
+        void update_migrated_object(
+            naming::gid_type const& id, naming::address const& addr);
 #endif
 
         bool bind_gid(gva const& g, naming::gid_type id,
@@ -276,6 +366,11 @@ namespace hpx::agas::server {
 
         resolved_type resolve_gid(naming::gid_type const& id);
 
+        // resolve all given gids at once, they have to be managed by this
+        // instance
+        std::vector<resolved_type> resolve_gids(
+            std::vector<naming::gid_type> const& ids);
+
         hpx::id_type colocate(naming::gid_type const& id);
 
         naming::address unbind_gid(std::uint64_t count, naming::gid_type id);
@@ -291,8 +386,9 @@ namespace hpx::agas::server {
             std::uint64_t count);
 
     private:
-        resolved_type resolve_gid_locked(std::unique_lock<mutex_type>& l,
-            naming::gid_type const& gid, error_code& ec);
+        resolved_type resolve_gid_locked(gva_shard& shard,
+            std::unique_lock<mutex_type>& l, naming::gid_type const& gid,
+            error_code& ec);
 
         void increment(naming::gid_type const& lower,
             naming::gid_type const& upper, std::int64_t& credits,
@@ -318,8 +414,7 @@ namespace hpx::agas::server {
         using free_entry_list_type =
             std::list<free_entry, free_entry_allocator_type>;
 
-        void resolve_free_list(std::unique_lock<mutex_type>& l,
-            std::list<refcnt_table_type::iterator> const& free_list,
+        void resolve_free_list(std::vector<naming::gid_type> const& free_list,
             free_entry_list_type& free_entry_list,
             naming::gid_type const& lower, naming::gid_type const& upper,
             error_code& ec);
@@ -341,9 +436,11 @@ namespace hpx::agas::server {
         HPX_DEFINE_COMPONENT_ACTION(primary_namespace, decrement_credit)
         HPX_DEFINE_COMPONENT_ACTION(primary_namespace, increment_credit)
         HPX_DEFINE_COMPONENT_ACTION(primary_namespace, resolve_gid)
+        HPX_DEFINE_COMPONENT_ACTION(primary_namespace, resolve_gids)
         HPX_DEFINE_COMPONENT_ACTION(primary_namespace, unbind_gid)
 #if defined(HPX_HAVE_NETWORKING)
         HPX_DEFINE_COMPONENT_ACTION(primary_namespace, route)
+        HPX_DEFINE_COMPONENT_ACTION(primary_namespace, update_migrated_object)
 #endif
     };
 }    // namespace hpx::agas::server
@@ -397,6 +494,13 @@ HPX_REGISTER_ACTION_DECLARATION(
     hpx::agas::server::primary_namespace::resolve_gid_action,
     primary_namespace_resolve_gid_action)
 
+HPX_ACTION_USES_MEDIUM_STACK(
+    hpx::agas::server::primary_namespace::resolve_gids_action)
+
+HPX_REGISTER_ACTION_DECLARATION(
+    hpx::agas::server::primary_namespace::resolve_gids_action,
+    primary_namespace_resolve_gids_action)
+
 HPX_ACTION_USES_MEDIUM_STACK(
     hpx::agas::server::primary_namespace::colocate_action)
 
@@ -417,6 +521,10 @@ HPX_ACTION_USES_MEDIUM_STACK(hpx::agas::server::primary_namespace::route_action)
 HPX_REGISTER_ACTION_DECLARATION(
     hpx::agas::server::primary_namespace::route_action,
     primary_namespace_route_action)
+
+HPX_REGISTER_ACTION_DECLARATION(
+    hpx::agas::server::primary_namespace::update_migrated_object_action,
+    primary_namespace_update_migrated_object_action)
 #endif
 
 HPX_REGISTER_BASE_LCO_WITH_VALUE_DECLARATION(
@@ -424,6 +532,9 @@ HPX_REGISTER_BASE_LCO_WITH_VALUE_DECLARATION(
 typedef hpx::tuple<hpx::naming::gid_type, hpx::agas::gva, hpx::naming::gid_type>
     gva_tuple_type;
 HPX_REGISTER_BASE_LCO_WITH_VALUE_DECLARATION(gva_tuple_type, gva_tuple)
+typedef std::vector<gva_tuple_type> vector_gva_tuple_type;
+HPX_REGISTER_BASE_LCO_WITH_VALUE_DECLARATION(
+    vector_gva_tuple_type, vector_gva_tuple_type)
 typedef std::pair<hpx::id_type, hpx::naming::address> std_pair_address_id_type;
 HPX_REGISTER_BASE_LCO_WITH_VALUE_DECLARATION(
     std_pair_address_id_type, std_pair_address_id_type)
@@ -25,6 +25,7 @@
 #include <cstdint>
 #include <map>
 #include <memory>
+#include <set>
 #include <string>
 #include <utility>
 #include <vector>
@@ -56,12 +57,25 @@ namespace hpx { namespace agas { namespace server {
 
         using on_event_data_map_type = std::multimap<std::string, hpx::id_type>;
 
+        using reader_table_type =
+            std::map<std::string, std::set<std::uint32_t>>;
+        using cache_type = std::map<std::string, hpx::id_type>;
+
     private:
         mutex_type mutex_;
         gid_table_type gids_;
         std::string instance_name_;
         on_event_data_map_type on_event_data_;
 
+        // the localities which hold entries of this instance in their read
+        // cache, those are notified when an entry is unbound
+        reader_table_type readers_;
+
+        // the read cache of this locality for entries of other instances
+        mutable mutex_type cache_mtx_;
+        cache_type cache_;
+        std::uint64_t cache_invalidations_ = 0;
+
     public:
         // data structure holding all counters for the omponent_namespace component
         struct counter_data
@@ -144,8 +158,28 @@ namespace hpx { namespace agas { namespace server {
 
         naming::gid_type resolve(std::string const& key);
 
+        // same as resolve, the given locality will be notified when the
+        // entry is unbound
+        naming::gid_type resolve_cached(
+            std::string const& key, std::uint32_t locality_id);
+
         naming::gid_type unbind(std::string const& key);
 
+        // remove the entry from the read cache of this locality
+        void invalidate(std::string const& key);
+
+        // access the read cache of this locality
+        bool get_cache_entry(std::string const& key, hpx::id_type& id) const;
+
+        // The number of invalidations seen so far. An entry is only added to
+        // the cache if no invalidation arrived since the entry was requested.
+        std::uint64_t get_cache_invalidations() const;
+
+        void add_cache_entry(std::string const& key, hpx::id_type const& id,
+            std::uint64_t invalidations);
+
+        void clear_cache();
+
         iterate_names_return_type iterate(std::string const& pattern);
 
         bool on_event(std::string const& name, bool call_for_past_events,
@@ -153,7 +187,9 @@ namespace hpx { namespace agas { namespace server {
 
         HPX_DEFINE_COMPONENT_ACTION(symbol_namespace, bind)
         HPX_DEFINE_COMPONENT_ACTION(symbol_namespace, resolve)
+        HPX_DEFINE_COMPONENT_ACTION(symbol_namespace, resolve_cached)
         HPX_DEFINE_COMPONENT_ACTION(symbol_namespace, unbind)
+        HPX_DEFINE_COMPONENT_ACTION(symbol_namespace, invalidate)
         HPX_DEFINE_COMPONENT_ACTION(symbol_namespace, iterate)
         HPX_DEFINE_COMPONENT_ACTION(symbol_namespace, on_event)
     };
@@ -173,12 +209,26 @@ HPX_REGISTER_ACTION_DECLARATION(
     hpx::agas::server::symbol_namespace::resolve_action,
     symbol_namespace_resolve_action)
 
+HPX_ACTION_USES_MEDIUM_STACK(
+    hpx::agas::server::symbol_namespace::resolve_cached_action)
+
+HPX_REGISTER_ACTION_DECLARATION(
+    hpx::agas::server::symbol_namespace::resolve_cached_action,
+    symbol_namespace_resolve_cached_action)
+
 HPX_ACTION_USES_MEDIUM_STACK(hpx::agas::server::symbol_namespace::unbind_action)
 
 HPX_REGISTER_ACTION_DECLARATION(
     hpx::agas::server::symbol_namespace::unbind_action,
     symbol_namespace_unbind_action)
 
+HPX_ACTION_USES_MEDIUM_STACK(
+    hpx::agas::server::symbol_namespace::invalidate_action)
+
+HPX_REGISTER_ACTION_DECLARATION(
+    hpx::agas::server::symbol_namespace::invalidate_action,
+    symbol_namespace_invalidate_action)
+
 HPX_ACTION_USES_MEDIUM_STACK(
     hpx::agas::server::symbol_namespace::iterate_action)
 
@@ -84,6 +84,103 @@ namespace hpx { namespace agas { namespace server {
         }
     }
 
+    ///////////////////////////////////////////////////////////////////////////
+    namespace {
+
+        template <typename Locks>
+        void unlock_all(Locks& locks)
+        {
+            for (auto& l : locks)
+            {
+                if (l.owns_lock())
+                {
+                    l.unlock();
+                }
+            }
+        }
+    }    // namespace
+
+    std::size_t primary_namespace::get_shard_index(
+        naming::gid_type id) noexcept
+    {
+        naming::detail::strip_internal_bits_from_gid(id);
+
+        // the locality prefix shifts the assignment of the blocks
+        std::uint64_t const msb = id.get_msb();
+        std::uint64_t const block = id.get_lsb() >> shard_block_bits;
+        return std::size_t((block + (msb ^ (msb >> 32))) % num_shards);
+    }
+
+    primary_namespace::shard_range primary_namespace::get_shard_range(
+        naming::gid_type id, std::uint64_t count) noexcept
+    {
+        std::size_t const first = get_shard_index(id);
+        if (count <= 1)
+        {
+            return shard_range{first, 1};
+        }
+
+        std::uint64_t const lower = id.get_lsb();
+        std::uint64_t const upper = lower + (count - 1);
+        if (upper < lower)
+        {
+            // ranges can't span more than one MSB, bind_gid will complain
+            return shard_range{first, num_shards};
+        }
+
+        std::uint64_t const blocks =
+            (upper >> shard_block_bits) - (lower >> shard_block_bits) + 1;
+        return shard_range{first,
+            blocks < num_shards ? std::size_t(blocks) : num_shards};
+    }
+
+    void primary_namespace::lock_gva_shards(
+        shard_range const& r, shard_locks_type& locks)
+    {
+        for (std::size_t i = 0; i != num_shards; ++i)
+        {
+            if (r.contains(i))
+            {
+                locks[i] = lock_shard(gva_shards_[i]);
+            }
+        }
+    }
+
+    std::int64_t primary_namespace::get_shard_lock_count(
+        std::size_t shard, bool reset)
+    {
+        std::int64_t result = 0;
+        for (std::size_t i = 0; i != num_shards; ++i)
+        {
+            if (shard == num_shards || shard == i)
+            {
+                result += util::get_and_reset_value(
+                              gva_shards_[i].statistics_.locks_, reset) +
+                    util::get_and_reset_value(
+                        refcnt_shards_[i].statistics_.locks_, reset);
+            }
+        }
+        return result;
+    }
+
+    std::int64_t primary_namespace::get_contended_shard_lock_count(
+        std::size_t shard, bool reset)
+    {
+        std::int64_t result = 0;
+        for (std::size_t i = 0; i != num_shards; ++i)
+        {
+            if (shard == num_shards || shard == i)
+            {
+                result += util::get_and_reset_value(
+                              gva_shards_[i].statistics_.contended_locks_,
+                              reset) +
+                    util::get_and_reset_value(
+                        refcnt_shards_[i].statistics_.contended_locks_, reset);
+            }
+        }
+        return result;
+    }
+
     // start migration of the given object
     std::pair<hpx::id_type, naming::address> primary_namespace::begin_migration(
         naming::gid_type id)
@@ -94,10 +191,11 @@ namespace hpx { namespace agas { namespace server {
         counter_data_.increment_begin_migration_count();
         using hpx::get;
 
-        std::unique_lock<mutex_type> l(mutex_);
+        gva_shard& shard = get_gva_shard(id);
+        std::unique_lock<mutex_type> l = lock_shard(shard);
 
-        wait_for_migration_locked(l, id, hpx::throws);
-        resolved_type r = resolve_gid_locked(l, id, hpx::throws);
+        wait_for_migration_locked(shard, l, id, hpx::throws);
+        resolved_type r = resolve_gid_locked(shard, l, id, hpx::throws);
         if (get<0>(r) == naming::invalid_gid)
         {
             l.unlock();
@@ -109,11 +207,12 @@ namespace hpx { namespace agas { namespace server {
             return std::make_pair(hpx::invalid_id, naming::address());
         }
 
-        migration_table_type::iterator it = migrating_objects_.find(id);
-        if (it == migrating_objects_.end())
+        migration_table_type& migrating_objects = shard.migrating_objects_;
+        migration_table_type::iterator it = migrating_objects.find(id);
+        if (it == migrating_objects.end())
         {
             std::pair<migration_table_type::iterator, bool> p =
-                migrating_objects_.emplace(std::piecewise_construct,
+                migrating_objects.emplace(std::piecewise_construct,
                     std::forward_as_tuple(id), std::forward_as_tuple());
             HPX_ASSERT(p.second);
             it = p.first;
@@ -127,6 +226,8 @@ namespace hpx { namespace agas { namespace server {
         hpx::get<0>(it->second) = true;    //-V601
 
         gva const& g(hpx::get<1>(r));
+        hpx::get<3>(it->second) = g.prefix;
+
         naming::address addr(g.prefix, g.type, g.lva());
         hpx::id_type loc(
             hpx::get<2>(r), hpx::id_type::management_type::unmanaged);
@@ -141,13 +242,31 @@ namespace hpx { namespace agas { namespace server {
             counter_data_.end_migration_.enabled_);
         counter_data_.increment_end_migration_count();
 
-        std::unique_lock<mutex_type> l(mutex_);
+        gva_shard& shard = get_gva_shard(id);
+        std::unique_lock<mutex_type> l = lock_shard(shard);
 
         using hpx::get;
 
-        migration_table_type::iterator it = migrating_objects_.find(id);
-        if (it != migrating_objects_.end())
+        naming::gid_type old_locality;
+        naming::address addr;
+
+        migration_table_type& migrating_objects = shard.migrating_objects_;
+        migration_table_type::iterator it = migrating_objects.find(id);
+        if (it != migrating_objects.end())
         {
+#if defined(HPX_HAVE_NETWORKING)
+            // the object is bound to its new address at this point
+            old_locality = get<3>(it->second);
+
+            error_code ec(throwmode::lightweight);
+            resolved_type r = resolve_gid_locked(shard, l, id, ec);
+            if (!ec && get<0>(r) != naming::invalid_gid)
+            {
+                gva const g = get<1>(r).resolve(id, get<0>(r));
+                addr = naming::address(g.prefix, g.type, g.lva());
+            }
+#endif
+
             // flag this id as not being migrated anymore
             get<0>(it->second) = false;
             if (get<1>(it->second) != 0)
@@ -156,15 +275,42 @@ namespace hpx { namespace agas { namespace server {
             }
             else
             {
-                migrating_objects_.erase(it);
+                migrating_objects.erase(it);
+            }
+        }
+
+#if defined(HPX_HAVE_NETWORKING)
+        if (l.owns_lock())
+        {
+            l.unlock();
+        }
+
+        // let the old location of the object forward parcels directly to the
+        // new location, instead of routing them through this instance
+        if (old_locality && addr && addr.locality_ != old_locality)
+        {
+            std::uint32_t const locality_id =
+                naming::get_locality_id_from_gid(old_locality);
+            if (locality_id == agas::get_locality_id())
+            {
+                update_migrated_object(id, addr);
+            }
+            else
+            {
+                hpx::id_type const target(
+                    naming::replace_locality_id(
+                        bootstrap_primary_namespace_gid(), locality_id),
+                    hpx::id_type::management_type::unmanaged);
+                hpx::apply<update_migrated_object_action>(target, id, addr);
             }
         }
+#endif
 
         return true;
     }
 
     // wait if given object is currently being migrated
-    void primary_namespace::wait_for_migration_locked(
+    void primary_namespace::wait_for_migration_locked(gva_shard& shard,
         std::unique_lock<mutex_type>& l, naming::gid_type const& id,
         error_code& ec)
     {
@@ -172,8 +318,9 @@ namespace hpx { namespace agas { namespace server {
 
         using hpx::get;
 
-        migration_table_type::iterator it = migrating_objects_.find(id);
-        if (it != migrating_objects_.end())
+        migration_table_type& migrating_objects = shard.migrating_objects_;
+        migration_table_type::iterator it = migrating_objects.find(id);
+        if (it != migrating_objects.end())
         {
             if (get<0>(it->second))
             {
@@ -182,13 +329,13 @@ namespace hpx { namespace agas { namespace server {
                 get<2>(it->second).wait(l, ec);
 
                 if (--get<1>(it->second) == 0)
-                    migrating_objects_.erase(it);
+                    migrating_objects.erase(it);
             }
             else
             {
                 if (get<1>(it->second) == 0)
                 {
-                    migrating_objects_.erase(it);
+                    migrating_objects.erase(it);
                 }
             }
         }
@@ -205,10 +352,16 @@ namespace hpx { namespace agas { namespace server {
         naming::gid_type gid = id;
         naming::detail::strip_internal_bits_from_gid(id);
 
-        std::unique_lock<mutex_type> l(mutex_);
+        // lock all shards the range of gids will be stored in
+        shard_range const r = get_shard_range(id, g.count);
+        shard_locks_type locks;
+        lock_gva_shards(r, locks);
+
+        std::size_t const index = get_shard_index(id);
+        gva_table_type& gvas = gva_shards_[index].gvas_;
 
-        gva_table_type::iterator it = gvas_.lower_bound(id),
-                                 begin = gvas_.begin(), end = gvas_.end();
+        gva_table_type::iterator it = gvas.lower_bound(id),
+                                 begin = gvas.begin(), end = gvas.end();
 
         if (it != end)
         {
@@ -220,7 +373,7 @@ namespace hpx { namespace agas { namespace server {
                 if (naming::refers_to_local_lva(gid) &&
                     !naming::refers_to_virtual_memory(gid))
                 {
-                    l.unlock();
+                    unlock_all(locks);
 
                     HPX_THROW_EXCEPTION(bad_parameter,
                         "primary_namespace::bind_gid",
@@ -237,7 +390,7 @@ namespace hpx { namespace agas { namespace server {
                 if (HPX_UNLIKELY(gaddr.count != g.count))
                 {
                     // REVIEW: Is this the right error code to use?
-                    l.unlock();
+                    unlock_all(locks);
 
                     HPX_THROW_EXCEPTION(bad_parameter,
                         "primary_namespace::bind_gid",
@@ -246,7 +399,7 @@ namespace hpx { namespace agas { namespace server {
 
                 if (HPX_UNLIKELY(components::component_invalid == g.type))
                 {
-                    l.unlock();
+                    unlock_all(locks);
 
                     HPX_THROW_EXCEPTION(bad_parameter,
                         "primary_namespace::bind_gid",
@@ -257,7 +410,7 @@ namespace hpx { namespace agas { namespace server {
 
                 if (HPX_UNLIKELY(!locality))
                 {
-                    l.unlock();
+                    unlock_all(locks);
 
                     HPX_THROW_EXCEPTION(bad_parameter,
                         "primary_namespace::bind_gid",
@@ -274,7 +427,19 @@ namespace hpx { namespace agas { namespace server {
                 gaddr.offset = g.offset;
                 loc = locality;
 
-                l.unlock();
+                // update the copies of the binding held by other shards
+                for (std::size_t i = 0; i != num_shards; ++i)
+                {
+                    if (i != index && r.contains(i))
+                    {
+                        gva_table_type::iterator other =
+                            gva_shards_[i].gvas_.find(id);
+                        HPX_ASSERT(other != gva_shards_[i].gvas_.end());
+                        other->second = it->second;
+                    }
+                }
+
+                unlock_all(locks);
 
                 LAGAS_(info).format(
                     "primary_namespace::bind_gid, gid({1}), gva({2}), "
@@ -294,7 +459,7 @@ namespace hpx { namespace agas { namespace server {
                 if (HPX_UNLIKELY((it->first + it->second.first.count) > id))
                 {
                     // REVIEW: Is this the right error code to use?
-                    l.unlock();
+                    unlock_all(locks);
 
                     HPX_THROW_EXCEPTION(bad_parameter,
                         "primary_namespace::bind_gid",
@@ -303,7 +468,7 @@ namespace hpx { namespace agas { namespace server {
             }
         }
 
-        else if (HPX_LIKELY(!gvas_.empty()))
+        else if (HPX_LIKELY(!gvas.empty()))
         {
             --it;
 
@@ -311,7 +476,7 @@ namespace hpx { namespace agas { namespace server {
             if ((it->first + it->second.first.count) > id)
             {
                 // REVIEW: Is this the right error code to use?
-                l.unlock();
+                unlock_all(locks);
 
                 HPX_THROW_EXCEPTION(bad_parameter,
                     "primary_namespace::bind_gid",
@@ -335,7 +500,7 @@ namespace hpx { namespace agas { namespace server {
 
         if (HPX_UNLIKELY(id.get_msb() != upper_bound.get_msb()))
         {
-            l.unlock();
+            unlock_all(locks);
 
             HPX_THROW_EXCEPTION(internal_server_error,
                 "primary_namespace::bind_gid",
@@ -344,7 +509,7 @@ namespace hpx { namespace agas { namespace server {
 
         if (HPX_UNLIKELY(components::component_invalid == g.type))
         {
-            l.unlock();
+            unlock_all(locks);
 
             HPX_THROW_EXCEPTION(bad_parameter, "primary_namespace::bind_gid",
                 "attempt to insert a GVA with an invalid type, "
@@ -352,19 +517,23 @@ namespace hpx { namespace agas { namespace server {
                 id, g, locality);
         }
 
-        // Insert a GID -> GVA entry into the GVA table.
-        if (HPX_UNLIKELY(!util::insert_checked(
-                gvas_.insert(std::make_pair(id, std::make_pair(g, locality))))))
+        // Insert a GID -> GVA entry into the GVA tables of all shards.
+        for (std::size_t i = 0; i != num_shards; ++i)
         {
-            l.unlock();
+            if (r.contains(i) &&
+                HPX_UNLIKELY(!util::insert_checked(gva_shards_[i].gvas_.insert(
+                    std::make_pair(id, std::make_pair(g, locality))))))
+            {
+                unlock_all(locks);
 
-            HPX_THROW_EXCEPTION(lock_error, "primary_namespace::bind_gid",
-                "GVA table insertion failed due to a locking error or "
-                "memory corruption, gid({1}), gva({2}), locality({3})",
-                id, g, locality);
+                HPX_THROW_EXCEPTION(lock_error, "primary_namespace::bind_gid",
+                    "GVA table insertion failed due to a locking error or "
+                    "memory corruption, gid({1}), gva({2}), locality({3})",
+                    id, g, locality);
+            }
         }
 
-        l.unlock();
+        unlock_all(locks);
 
         LAGAS_(info).format(
             "primary_namespace::bind_gid, gid({1}), gva({2}), locality({3})",
@@ -385,16 +554,17 @@ namespace hpx { namespace agas { namespace server {
         resolved_type r;
 
         {
-            std::unique_lock<mutex_type> l(mutex_);
+            gva_shard& shard = get_gva_shard(id);
+            std::unique_lock<mutex_type> l = lock_shard(shard);
 
             // wait for any migration to be completed
             if (naming::detail::is_migratable(id))
             {
-                wait_for_migration_locked(l, id, hpx::throws);
+                wait_for_migration_locked(shard, l, id, hpx::throws);
             }
 
             // now, resolve the id
-            r = resolve_gid_locked(l, id, hpx::throws);
+            r = resolve_gid_locked(shard, l, id, hpx::throws);
         }
 
         if (get<0>(r) == naming::invalid_gid)
@@ -415,6 +585,20 @@ namespace hpx { namespace agas { namespace server {
         return r;
     }    // }}}
 
+    std::vector<primary_namespace::resolved_type>
+    primary_namespace::resolve_gids(std::vector<naming::gid_type> const& ids)
+    {    // {{{ resolve_gids implementation
+        std::vector<resolved_type> results;
+        results.reserve(ids.size());
+
+        for (naming::gid_type const& id : ids)
+        {
+            results.push_back(resolve_gid(id));
+        }
+
+        return results;
+    }    // }}}
+
     hpx::id_type primary_namespace::colocate(naming::gid_type const& id)
     {
         return hpx::id_type(hpx::get<2>(resolve_gid(id)),
@@ -431,15 +615,18 @@ namespace hpx { namespace agas { namespace server {
 
         naming::detail::strip_internal_bits_from_gid(id);
 
-        std::unique_lock<mutex_type> l(mutex_);
+        shard_range const r = get_shard_range(id, count);
+        shard_locks_type locks;
+        lock_gva_shards(r, locks);
 
-        gva_table_type::iterator it = gvas_.find(id), end = gvas_.end();
+        gva_table_type& gvas = gva_shards_[get_shard_index(id)].gvas_;
+        gva_table_type::iterator it = gvas.find(id), end = gvas.end();
 
         if (it != end)
         {
             if (HPX_UNLIKELY(it->second.first.count != count))
             {
-                l.unlock();
+                unlock_all(locks);
 
                 HPX_THROW_EXCEPTION(bad_parameter,
                     "primary_namespace::unbind_gid", "block sizes must match");
@@ -447,9 +634,15 @@ namespace hpx { namespace agas { namespace server {
 
             gva_table_data_type data = it->second;
 
-            gvas_.erase(it);
+            for (std::size_t i = 0; i != num_shards; ++i)
+            {
+                if (r.contains(i))
+                {
+                    gva_shards_[i].gvas_.erase(id);
+                }
+            }
 
-            l.unlock();
+            unlock_all(locks);
             LAGAS_(info).format(
                 "primary_namespace::unbind_gid, gid({1}), count({2}), "
                 "gva({3}), locality_id({4})",
@@ -476,7 +669,7 @@ namespace hpx { namespace agas { namespace server {
             return naming::address(g.prefix, g.type, g.lva());
         }
 
-        l.unlock();
+        unlock_all(locks);
 
         LAGAS_(info).format(
             "primary_namespace::unbind_gid, gid({1}), count({2}), "
@@ -624,33 +817,38 @@ namespace hpx { namespace agas { namespace server {
     }    // }}}
 
 #if defined(HPX_HAVE_AGAS_DUMP_REFCNT_ENTRIES)
-    void primary_namespace::dump_refcnt_matches(
-        refcnt_table_type::iterator lower_it,
-        refcnt_table_type::iterator upper_it, naming::gid_type const& lower,
-        naming::gid_type const& upper, std::unique_lock<mutex_type>& l,
-        const char* func_name)
+    void primary_namespace::dump_refcnt_matches(naming::gid_type const& lower,
+        naming::gid_type const& upper, const char* func_name)
     {    // dump_refcnt_matches implementation
-        HPX_ASSERT(l.owns_lock());
-
-        if (lower_it == refcnts_.end() && upper_it == refcnts_.end())
-            // We got nothing, bail - our caller is probably about to throw.
-            return;
-
         std::stringstream ss;
         hpx::util::format_to(ss,
             "{1}, dumping server-side refcnt table matches, lower({2}), "
             "upper({3}):",
             func_name, lower, upper);
 
-        for (/**/; lower_it != upper_it; ++lower_it)
+        bool found = false;
+        for (naming::gid_type raw = lower; raw != upper; ++raw)
         {
-            // The [server] tag is in there to make it easier to filter
-            // through the logs.
-            hpx::util::format_to(ss, "\n  [server] lower({1}), credits({2})",
-                lower_it->first, lower_it->second);
+            refcnt_shard& shard = get_refcnt_shard(raw);
+            std::unique_lock<mutex_type> l = lock_shard(shard);
+
+            refcnt_table_type::const_iterator it = shard.refcnts_.find(raw);
+            if (it != shard.refcnts_.end())
+            {
+                // The [server] tag is in there to make it easier to filter
+                // through the logs.
+                hpx::util::format_to(ss,
+                    "\n  [server] lower({1}), credits({2})", it->first,
+                    it->second);
+                found = true;
+            }
         }
 
-        LAGAS_(debug) << ss.str();
+        // We got nothing, bail - our caller is probably about to throw.
+        if (found)
+        {
+            LAGAS_(debug) << ss.str();
+        }
     }    // dump_refcnt_matches implementation
 #endif
 
@@ -658,28 +856,11 @@ namespace hpx { namespace agas { namespace server {
     void primary_namespace::increment(naming::gid_type const& lower,
         naming::gid_type const& upper, std::int64_t& credits, error_code& ec)
     {    // {{{ increment implementation
-        std::unique_lock<mutex_type> l(mutex_);
-
 #if defined(HPX_HAVE_AGAS_DUMP_REFCNT_ENTRIES)
         if (LAGAS_ENABLED(debug))
         {
-            typedef refcnt_table_type::iterator iterator;
-
-            // Find the mappings that we're about to touch.
-            refcnt_table_type::iterator lower_it = refcnts_.find(lower);
-            refcnt_table_type::iterator upper_it;
-            if (lower != upper)
-            {
-                upper_it = refcnts_.find(upper);
-            }
-            else
-            {
-                upper_it = lower_it;
-                ++upper_it;
-            }
-
-            dump_refcnt_matches(lower_it, upper_it, lower, upper, l,
-                "primary_namespace::increment");
+            // Dump the mappings that we're about to touch.
+            dump_refcnt_matches(lower, upper, "primary_namespace::increment");
         }
 #endif
 
@@ -693,16 +874,33 @@ namespace hpx { namespace agas { namespace server {
         // allocate/bind them, so if a GID is not in the refcnt table, we know that
         // it's global reference count is the initial global reference count.
 
+        // the lock is switched whenever the next gid is stored in another shard
+        std::size_t index = num_shards;
+        std::unique_lock<mutex_type> l;
+
         for (naming::gid_type raw = lower; raw != upper; ++raw)
         {
-            refcnt_table_type::iterator it = refcnts_.find(raw);
-            if (it == refcnts_.end())
+            std::size_t const next = get_shard_index(raw);
+            if (next != index)
+            {
+                if (l.owns_lock())
+                {
+                    l.unlock();
+                }
+                index = next;
+                l = lock_shard(refcnt_shards_[index]);
+            }
+
+            refcnt_table_type& refcnts = refcnt_shards_[index].refcnts_;
+
+            refcnt_table_type::iterator it = refcnts.find(raw);
+            if (it == refcnts.end())
             {
                 std::int64_t count =
                     std::int64_t(HPX_GLOBALCREDIT_INITIAL) + credits;
 
                 std::pair<refcnt_table_type::iterator, bool> p =
-                    refcnts_.insert(refcnt_table_type::value_type(raw, count));
+                    refcnts.insert(refcnt_table_type::value_type(raw, count));
                 if (!p.second)
                 {
                     l.unlock();
@@ -732,33 +930,27 @@ namespace hpx { namespace agas { namespace server {
     }    // }}}
 
     ///////////////////////////////////////////////////////////////////////////////
-    void primary_namespace::resolve_free_list(std::unique_lock<mutex_type>& l,
-        std::list<refcnt_table_type::iterator> const& free_list,
+    void primary_namespace::resolve_free_list(
+        std::vector<naming::gid_type> const& free_list,
         free_entry_list_type& free_entry_list,
         naming::gid_type const& /* lower */,
         naming::gid_type const& /* upper */, error_code& ec)
     {
-        HPX_ASSERT_OWNS_LOCK(l);
-
         using hpx::get;
 
-        typedef refcnt_table_type::iterator iterator;
-
-        for (iterator const& it : free_list)
+        for (naming::gid_type const& gid : free_list)
         {
-            typedef refcnt_table_type::key_type key_type;
-
-            // The mapping's key space.
-            key_type gid = it->first;
+            gva_shard& shard = get_gva_shard(gid);
+            std::unique_lock<mutex_type> l = lock_shard(shard);
 
             if (naming::detail::is_migratable(gid))
             {
                 // wait for any migration to be completed
-                wait_for_migration_locked(l, gid, ec);
+                wait_for_migration_locked(shard, l, gid, ec);
             }
 
             // Resolve the query GID.
-            resolved_type r = resolve_gid_locked(l, gid, ec);
+            resolved_type r = resolve_gid_locked(shard, l, gid, ec);
             if (ec)
                 return;
 
@@ -813,9 +1005,6 @@ namespace hpx { namespace agas { namespace server {
             // Add the information needed to destroy these components to the
             // free list.
             free_entry_list.push_back(free_entry(resolved, gid, get<2>(r)));
-
-            // remove this entry from the refcnt table
-            refcnts_.erase(it);
         }
     }
 
@@ -831,32 +1020,18 @@ namespace hpx { namespace agas { namespace server {
 
         free_entry_list.clear();
 
-        {
-            std::unique_lock<mutex_type> l(mutex_);
-
 #if defined(HPX_HAVE_AGAS_DUMP_REFCNT_ENTRIES)
-            if (LAGAS_ENABLED(debug))
-            {
-                typedef refcnt_table_type::iterator iterator;
-
-                // Find the mappings that we just added or modified.
-                refcnt_table_type::iterator lower_it = refcnts_.find(lower);
-                refcnt_table_type::iterator upper_it;
-                if (lower != upper)
-                {
-                    upper_it = refcnts_.find(upper);
-                }
-                else
-                {
-                    upper_it = lower_it;
-                    ++upper_it;
-                }
-
-                dump_refcnt_matches(lower_it, upper_it, lower, upper, l,
-                    "primary_namespace::decrement_sweep");
-            }
+        if (LAGAS_ENABLED(debug))
+        {
+            // Dump the mappings that we're about to modify.
+            dump_refcnt_matches(
+                lower, upper, "primary_namespace::decrement_sweep");
+        }
 #endif
 
+        std::vector<naming::gid_type> free_list;
+
+        {
             ///////////////////////////////////////////////////////////////////////
             // Apply the decrement across the entire key space (e.g. [lower, upper]).
 
@@ -866,11 +1041,28 @@ namespace hpx { namespace agas { namespace server {
             // we know that it's global reference count is the initial global
             // reference count.
 
-            std::list<refcnt_table_type::iterator> free_list;
+            // the lock is switched whenever the next gid is stored in another
+            // shard
+            std::size_t index = num_shards;
+            std::unique_lock<mutex_type> l;
+
             for (naming::gid_type raw = lower; raw != upper; ++raw)
             {
-                refcnt_table_type::iterator it = refcnts_.find(raw);
-                if (it == refcnts_.end())
+                std::size_t const next = get_shard_index(raw);
+                if (next != index)
+                {
+                    if (l.owns_lock())
+                    {
+                        l.unlock();
+                    }
+                    index = next;
+                    l = lock_shard(refcnt_shards_[index]);
+                }
+
+                refcnt_table_type& refcnts = refcnt_shards_[index].refcnts_;
+
+                refcnt_table_type::iterator it = refcnts.find(raw);
+                if (it == refcnts.end())
                 {
                     if (credits > std::int64_t(HPX_GLOBALCREDIT_INITIAL))
                     {
@@ -889,7 +1081,7 @@ namespace hpx { namespace agas { namespace server {
                         std::int64_t(HPX_GLOBALCREDIT_INITIAL) - credits;
 
                     std::pair<refcnt_table_type::iterator, bool> p =
-                        refcnts_.insert(
+                        refcnts.insert(
                             refcnt_table_type::value_type(raw, count));
                     if (!p.second)
                     {
@@ -923,16 +1115,23 @@ namespace hpx { namespace agas { namespace server {
                     return;
                 }
 
-                // this objects needs to be deleted
+                // this objects needs to be deleted, remove it from the refcnt
+                // table
                 if (it->second == 0)
-                    free_list.push_back(it);
+                {
+                    free_list.push_back(raw);
+                    refcnts.erase(it);
+                }
             }
-
-            // Resolve the objects which have to be deleted.
-            resolve_free_list(l, free_list, free_entry_list, lower, upper, ec);
-
         }    // Unlock the mutex.
 
+        // Resolve the objects which have to be deleted. The GVA shards are
+        // locked separately, waiting for a migration to finish must not block
+        // the reference count tables.
+        resolve_free_list(free_list, free_entry_list, lower, upper, ec);
+        if (ec)
+            return;
+
         if (&ec != &throws)
             ec = make_success_code();
     }
@@ -993,8 +1192,8 @@ namespace hpx { namespace agas { namespace server {
     }    // }}}
 
     primary_namespace::resolved_type primary_namespace::resolve_gid_locked(
-        std::unique_lock<mutex_type>& l, naming::gid_type const& gid,
-        error_code& ec)
+        gva_shard& shard, std::unique_lock<mutex_type>& l,
+        naming::gid_type const& gid, error_code& ec)
     {    // {{{ resolve_gid_locked implementation
         HPX_ASSERT_OWNS_LOCK(l);
 
@@ -1013,8 +1212,10 @@ namespace hpx { namespace agas { namespace server {
         naming::gid_type id = gid;
         naming::detail::strip_internal_bits_from_gid(id);
 
-        gva_table_type::const_iterator it = gvas_.lower_bound(id),
-                                       begin = gvas_.begin(), end = gvas_.end();
+        // the shard holds all ranges covering the gid
+        gva_table_type const& gvas = shard.gvas_;
+        gva_table_type::const_iterator it = gvas.lower_bound(id),
+                                       begin = gvas.begin(), end = gvas.end();
 
         if (it != end)
         {
@@ -1058,7 +1259,7 @@ namespace hpx { namespace agas { namespace server {
             }
         }
 
-        else if (HPX_LIKELY(!gvas_.empty()))
+        else if (HPX_LIKELY(!gvas.empty()))
         {
             --it;
 
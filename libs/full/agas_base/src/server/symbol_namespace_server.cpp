@@ -31,6 +31,7 @@
 #include <memory>
 #include <mutex>
 #include <regex>
+#include <set>
 #include <string>
 #include <utility>
 #include <vector>
@@ -73,12 +74,15 @@ namespace hpx { namespace agas { namespace server {
 
     void symbol_namespace::unregister_server_instance(error_code& ec)
     {
+        clear_cache();
         agas::unregister_name(launch::sync, instance_name_, ec);
         this->base_type::finalize();
     }
 
     void symbol_namespace::finalize()
     {
+        clear_cache();
+
         if (!instance_name_.empty())
         {
             error_code ec(throwmode::lightweight);
@@ -184,6 +188,9 @@ namespace hpx { namespace agas { namespace server {
                 // hold on to the gid while the map is unlocked
                 std::shared_ptr<naming::gid_type> current_gid = gid_it->second;
 
+                // the locality of the LCO may cache the entry
+                readers_[key].insert(naming::get_locality_id_from_id(id));
+
                 {
                     util::unlock_guard<std::unique_lock<mutex_type>> ul(l);
 
@@ -271,14 +278,118 @@ namespace hpx { namespace agas { namespace server {
 
         gids_.erase(it);
 
+        std::set<std::uint32_t> readers;
+        reader_table_type::iterator rit = readers_.find(key);
+        if (rit != readers_.end())
+        {
+            readers = HPX_MOVE(rit->second);
+            readers_.erase(rit);
+        }
+
         l.unlock();
 
+        // drop the entry from the read caches holding it
+        std::uint32_t const here = agas::get_locality_id();
+        for (std::uint32_t locality_id : readers)
+        {
+            if (locality_id == here)
+            {
+                invalidate(key);
+                continue;
+            }
+
+            hpx::id_type const target(
+                naming::replace_locality_id(
+                    bootstrap_symbol_namespace_gid(), locality_id),
+                hpx::id_type::management_type::unmanaged);
+            hpx::apply<invalidate_action>(target, key);
+        }
+
         LAGAS_(info).format(
             "symbol_namespace::unbind, key({1}), gid({2})", key, gid);
 
         return gid;
     }    // }}}
 
+    naming::gid_type symbol_namespace::resolve_cached(
+        std::string const& key, std::uint32_t locality_id)
+    {    // {{{ resolve_cached implementation
+        {
+            std::lock_guard<mutex_type> l(mutex_);
+            if (gids_.find(key) != gids_.end())
+            {
+                readers_[key].insert(locality_id);
+            }
+        }
+        return resolve(key);
+    }    // }}}
+
+    void symbol_namespace::invalidate(std::string const& key)
+    {
+        hpx::id_type id;
+
+        {
+            std::lock_guard<mutex_type> l(cache_mtx_);
+            ++cache_invalidations_;
+
+            cache_type::iterator it = cache_.find(key);
+            if (it == cache_.end())
+            {
+                return;
+            }
+
+            // release the credits held by the entry outside of the lock
+            id = HPX_MOVE(it->second);
+            cache_.erase(it);
+        }
+
+        LAGAS_(info).format("symbol_namespace::invalidate, key({1})", key);
+    }
+
+    bool symbol_namespace::get_cache_entry(
+        std::string const& key, hpx::id_type& id) const
+    {
+        std::lock_guard<mutex_type> l(cache_mtx_);
+
+        cache_type::const_iterator it = cache_.find(key);
+        if (it == cache_.end())
+        {
+            return false;
+        }
+
+        id = it->second;
+        return true;
+    }
+
+    std::uint64_t symbol_namespace::get_cache_invalidations() const
+    {
+        std::lock_guard<mutex_type> l(cache_mtx_);
+        return cache_invalidations_;
+    }
+
+    void symbol_namespace::add_cache_entry(std::string const& key,
+        hpx::id_type const& id, std::uint64_t invalidations)
+    {
+        std::lock_guard<mutex_type> l(cache_mtx_);
+
+        // the entry might have been unbound while it was requested
+        if (invalidations == cache_invalidations_)
+        {
+            cache_.emplace(key, id);
+        }
+    }
+
+    void symbol_namespace::clear_cache()
+    {
+        cache_type cache;
+
+        {
+            std::lock_guard<mutex_type> l(cache_mtx_);
+            ++cache_invalidations_;
+            cache.swap(cache_);
+        }
+    }
+
     // TODO: catch exceptions
     symbol_namespace::iterate_names_return_type symbol_namespace::iterate(
         std::string const& pattern)
@@ -353,6 +464,9 @@ namespace hpx { namespace agas { namespace server {
                 // hold on to entry while map is unlocked
                 std::shared_ptr<naming::gid_type> current_gid(it->second);
 
+                // the locality of the LCO may cache the entry
+                readers_[name].insert(naming::get_locality_id_from_id(lco));
+
                 // split the credit as the receiving end will expect to keep the
                 // object alive
                 {
@@ -39,10 +39,18 @@ HPX_REGISTER_ACTION_ID(symbol_namespace::resolve_action,
     symbol_namespace_resolve_action,
     hpx::actions::symbol_namespace_resolve_action_id)
 
+HPX_REGISTER_ACTION_ID(symbol_namespace::resolve_cached_action,
+    symbol_namespace_resolve_cached_action,
+    hpx::actions::symbol_namespace_resolve_cached_action_id)
+
 HPX_REGISTER_ACTION_ID(symbol_namespace::unbind_action,
     symbol_namespace_unbind_action,
     hpx::actions::symbol_namespace_unbind_action_id)
 
+HPX_REGISTER_ACTION_ID(symbol_namespace::invalidate_action,
+    symbol_namespace_invalidate_action,
+    hpx::actions::symbol_namespace_invalidate_action_id)
+
 HPX_REGISTER_ACTION_ID(symbol_namespace::iterate_action,
     symbol_namespace_iterate_action,
     hpx::actions::symbol_namespace_iterate_action_id)
@@ -178,8 +186,30 @@ namespace hpx { namespace agas {
                 raw_gid, hpx::id_type::management_type::unmanaged));
         }
 #if !defined(HPX_COMPUTE_DEVICE_CODE)
-        server::symbol_namespace::resolve_action action;
-        return hpx::async(action, HPX_MOVE(dest), HPX_MOVE(key));
+        // entries of other instances are served from the read cache of this
+        // locality, the instance managing the entry invalidates it on unbind
+        hpx::id_type id;
+        if (server_->get_cache_entry(key, id))
+        {
+            return hpx::make_ready_future(HPX_MOVE(id));
+        }
+
+        std::uint64_t const invalidations = server_->get_cache_invalidations();
+
+        server::symbol_namespace::resolve_cached_action action;
+        hpx::future<hpx::id_type> f =
+            hpx::async(action, HPX_MOVE(dest), key, agas::get_locality_id());
+
+        return f.then(hpx::launch::sync,
+            [server = server_.get(), key = HPX_MOVE(key), invalidations](
+                hpx::future<hpx::id_type>&& f) {
+                hpx::id_type id = f.get();
+                if (id)
+                {
+                    server->add_cache_entry(key, id, invalidations);
+                }
+                return id;
+            });
 #else
         HPX_ASSERT(false);
         return hpx::make_ready_future(hpx::id_type{});
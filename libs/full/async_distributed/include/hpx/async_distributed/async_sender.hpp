@@ -0,0 +1,228 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file async_sender.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/actions_base/basic_action_fwd.hpp>
+#include <hpx/actions_base/traits/extract_action.hpp>
+#include <hpx/actions_base/traits/is_client.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/async_distributed/async.hpp>
+#include <hpx/datastructures/member_pack.hpp>
+#include <hpx/errors/try_catch_exception_ptr.hpp>
+#include <hpx/execution_base/completion_signatures.hpp>
+#include <hpx/execution_base/operation_state.hpp>
+#include <hpx/execution_base/receiver.hpp>
+#include <hpx/execution_base/sender.hpp>
+#include <hpx/futures/future.hpp>
+#include <hpx/futures/traits/acquire_shared_state.hpp>
+#include <hpx/futures/traits/promise_local_result.hpp>
+#include <hpx/naming_base/id_type.hpp>
+#include <hpx/type_support/pack.hpp>
+
+#include <cstddef>
+#include <exception>
+#include <type_traits>
+#include <utility>
+
+namespace hpx { namespace distributed { namespace experimental {
+
+    namespace detail {
+
+        template <typename Action>
+        using async_sender_result_t = typename hpx::traits::
+            promise_local_result<typename hpx::traits::extract_action<
+                Action>::remote_result_type>::type;
+
+        template <typename Result>
+        struct async_sender_value_signature
+        {
+            using type = hpx::execution::experimental::set_value_t(Result);
+        };
+
+        template <>
+        struct async_sender_value_signature<void>
+        {
+            using type = hpx::execution::experimental::set_value_t();
+        };
+
+        template <typename Action, typename Target, typename Is,
+            typename... Ts>
+        struct async_sender;
+
+        template <typename Action, typename Target, std::size_t... Is,
+            typename... Ts>
+        struct async_sender<Action, Target, hpx::util::index_pack<Is...>,
+            Ts...>
+        {
+            using result_type = async_sender_result_t<Action>;
+            using pack_type = hpx::util::member_pack_for<std::decay_t<Ts>...>;
+
+            std::decay_t<Target> target;
+            HPX_NO_UNIQUE_ADDRESS pack_type ts;
+
+            template <typename Target_, typename... Ts_>
+            explicit async_sender(Target_&& target, Ts_&&... ts)
+              : target(HPX_FORWARD(Target_, target))
+              , ts(std::piecewise_construct, HPX_FORWARD(Ts_, ts)...)
+            {
+            }
+
+            async_sender(async_sender&&) = default;
+            async_sender(async_sender const&) = default;
+            async_sender& operator=(async_sender&&) = default;
+            async_sender& operator=(async_sender const&) = default;
+
+            template <typename Receiver>
+            struct operation_state
+            {
+                HPX_NO_UNIQUE_ADDRESS std::decay_t<Receiver> receiver;
+                std::decay_t<Target> target;
+                pack_type ts;
+                hpx::future<result_type> future;
+
+                template <typename Receiver_>
+                operation_state(Receiver_&& receiver,
+                    std::decay_t<Target> target, pack_type ts)
+                  : receiver(HPX_FORWARD(Receiver_, receiver))
+                  , target(HPX_MOVE(target))
+                  , ts(HPX_MOVE(ts))
+                {
+                }
+
+                operation_state(operation_state&&) = delete;
+                operation_state& operator=(operation_state&&) = delete;
+                operation_state(operation_state const&) = delete;
+                operation_state& operator=(operation_state const&) = delete;
+
+                void set_result() noexcept
+                {
+                    HPX_ASSERT(future.is_ready());
+                    if (future.has_exception())
+                    {
+                        hpx::execution::experimental::set_error(
+                            HPX_MOVE(receiver), future.get_exception_ptr());
+                    }
+                    else if constexpr (std::is_void_v<result_type>)
+                    {
+                        hpx::execution::experimental::set_value(
+                            HPX_MOVE(receiver));
+                    }
+                    else
+                    {
+                        hpx::execution::experimental::set_value(
+                            HPX_MOVE(receiver), future.get());
+                    }
+                }
+
+                friend void tag_invoke(
+                    hpx::execution::experimental::start_t,
+                    operation_state& os) noexcept
+                {
+                    hpx::detail::try_catch_exception_ptr(
+                        [&]() {
+                            os.future = hpx::async<Action>(os.target,
+                                HPX_MOVE(os.ts).template get<Is>()...);
+
+                            auto state =
+                                hpx::traits::detail::get_shared_state(
+                                    os.future);
+                            HPX_ASSERT(state);
+
+                            // The receiver is completed by whoever makes the
+                            // result available, which for a remote target is
+                            // the thread handling the response parcel. The
+                            // operation state is kept alive until then.
+                            state->set_on_completed(
+                                [&os]() { os.set_result(); });
+                        },
+                        [&](std::exception_ptr ep) {
+                            hpx::execution::experimental::set_error(
+                                HPX_MOVE(os.receiver), HPX_MOVE(ep));
+                        });
+                }
+            };
+
+            template <typename Receiver>
+            friend operation_state<Receiver> tag_invoke(
+                hpx::execution::experimental::connect_t, async_sender&& s,
+                Receiver&& receiver)
+            {
+                return {HPX_FORWARD(Receiver, receiver), HPX_MOVE(s.target),
+                    HPX_MOVE(s.ts)};
+            }
+
+            template <typename Receiver>
+            friend operation_state<Receiver> tag_invoke(
+                hpx::execution::experimental::connect_t, async_sender& s,
+                Receiver&& receiver)
+            {
+                return {HPX_FORWARD(Receiver, receiver), s.target, s.ts};
+            }
+        };
+
+        template <typename Action, typename Target, typename Pack,
+            typename... Ts, typename Env>
+        auto tag_invoke(
+            hpx::execution::experimental::get_completion_signatures_t,
+            async_sender<Action, Target, Pack, Ts...> const&, Env) noexcept
+            -> hpx::execution::experimental::completion_signatures<
+                typename async_sender_value_signature<
+                    async_sender_result_t<Action>>::type,
+                hpx::execution::experimental::set_error_t(std::exception_ptr)>;
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Returns a sender which invokes the action \a Action on the given
+    /// target once it is started and sends the result of the action.
+    ///
+    /// In contrast to \a hpx::async, no future is handed out: the receiver is
+    /// completed directly by the thread which makes the result available. For
+    /// a remote target this is the thread handling the response parcel, for a
+    /// local target that is executed directly it is the thread starting the
+    /// sender. Continuations attached using \a then, \a when_all, or similar
+    /// algorithms run inline in that thread unless they are explicitly
+    /// transferred to another scheduler.
+    ///
+    /// \tparam Action  The action to invoke.
+    ///
+    /// \param target   The global id or client of the object to invoke the
+    ///                 action on.
+    /// \param ts       The arguments of the action. They are decay-copied
+    ///                 into the returned sender.
+    ///
+    /// \returns        A sender sending the value returned by the action
+    ///                 (nothing for actions returning void) or an
+    ///                 std::exception_ptr if the invocation failed.
+    template <typename Action, typename Target, typename... Ts,
+        typename = std::enable_if_t<
+            std::is_same_v<std::decay_t<Target>, hpx::id_type> ||
+            hpx::traits::is_client_v<std::decay_t<Target>>>>
+    auto async_sender(Target&& target, Ts&&... ts)
+    {
+        using action_type = typename hpx::traits::extract_action<Action>::type;
+        return detail::async_sender<action_type, std::decay_t<Target>,
+            hpx::util::make_index_pack_t<sizeof...(Ts)>, Ts...>(
+            HPX_FORWARD(Target, target), HPX_FORWARD(Ts, ts)...);
+    }
+
+    /// \copydoc async_sender
+    template <typename Component, typename Signature, typename Derived,
+        typename Target, typename... Ts,
+        typename = std::enable_if_t<
+            std::is_same_v<std::decay_t<Target>, hpx::id_type> ||
+            hpx::traits::is_client_v<std::decay_t<Target>>>>
+    auto async_sender(
+        hpx::actions::basic_action<Component, Signature, Derived> const&,
+        Target&& target, Ts&&... ts)
+    {
+        return async_sender<Derived>(
+            HPX_FORWARD(Target, target), HPX_FORWARD(Ts, ts)...);
+    }
+}}}    // namespace hpx::distributed::experimental
@@ -129,7 +129,7 @@ namespace hpx::parcelset {
             else
             {
                 future<naming::gid_type> split_gid =
-                    naming::detail::split_gid_if_needed(dest.get_gid());
+                    naming::detail::split_gid_if_needed(*dest.impl());
 
                 if (split_gid.is_ready())
                 {
@@ -19,6 +19,7 @@
 #include <hpx/actions_base/actions_base_support.hpp>
 #include <hpx/async_distributed/continuation.hpp>
 #include <hpx/async_distributed/traits/action_trigger_continuation.hpp>
+#include <hpx/parcelset_base/parcel_flight_recorder.hpp>
 
 #if defined(HPX_HAVE_NETWORKING)
 #include <hpx/serialization/input_archive.hpp>
@@ -199,9 +200,10 @@ namespace hpx { namespace actions {
         data.timer_data = hpx::util::external_timer::new_task(
             data.description, data.parent_locality_id, data.parent_id);
 #endif
-        applier::detail::apply_helper<typename base_type::derived_type>::call(
-            HPX_MOVE(data), HPX_MOVE(cont_), target, lva, comptype,
-            this->priority_, HPX_MOVE(hpx::get<Is>(this->arguments_))...);
+        applier::detail::received_apply_helper<
+            typename base_type::derived_type>::call(HPX_MOVE(data),
+            HPX_MOVE(cont_), target, lva, comptype, this->priority_,
+            HPX_MOVE(hpx::get<Is>(this->arguments_))...);
     }
 
     template <typename Action>
@@ -240,6 +242,9 @@ namespace hpx { namespace actions {
     {
         // First, serialize, then schedule
         load(ar);
+#if defined(HPX_HAVE_PARCEL_PROFILING) && defined(HPX_HAVE_NETWORKING)
+        parcelset::detail::received_parcel_flight::deserialized();
+#endif
 
         if (deferred_schedule)
         {
@@ -11,5 +11,6 @@
 #include <hpx/async_distributed/async_callback.hpp>
 #include <hpx/async_distributed/async_continue.hpp>
 #include <hpx/async_distributed/async_continue_callback.hpp>
+#include <hpx/async_distributed/async_sender.hpp>
 #include <hpx/async_distributed/dataflow.hpp>
 #include <hpx/async_distributed/sync.hpp>
@@ -0,0 +1,155 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/actions.hpp>
+#include <hpx/include/components.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/include/runtime.hpp>
+#include <hpx/modules/async_distributed.hpp>
+#include <hpx/modules/execution.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <exception>
+#include <stdexcept>
+#include <vector>
+
+namespace ex = hpx::execution::experimental;
+namespace tt = hpx::this_thread::experimental;
+
+///////////////////////////////////////////////////////////////////////////////
+std::int32_t increment(std::int32_t i)
+{
+    return i + 1;
+}
+HPX_PLAIN_ACTION(increment)
+
+std::atomic<std::int32_t> void_calls(0);
+
+void call_void()
+{
+    ++void_calls;
+}
+HPX_PLAIN_ACTION(call_void)
+
+std::int32_t throw_error()
+{
+    throw std::runtime_error("throw_error");
+    return 0;
+}
+HPX_PLAIN_ACTION(throw_error)
+
+///////////////////////////////////////////////////////////////////////////////
+struct decrement_server
+  : hpx::components::managed_component_base<decrement_server>
+{
+    std::int32_t call(std::int32_t i) const
+    {
+        return i - 1;
+    }
+
+    HPX_DEFINE_COMPONENT_ACTION(decrement_server, call)
+};
+
+typedef hpx::components::managed_component<decrement_server> server_type;
+HPX_REGISTER_COMPONENT(server_type, decrement_server)
+
+typedef decrement_server::call_action call_action;
+HPX_REGISTER_ACTION_DECLARATION(call_action)
+HPX_REGISTER_ACTION(call_action)
+
+///////////////////////////////////////////////////////////////////////////////
+void test_remote_async_sender(hpx::id_type const& target)
+{
+    using hpx::distributed::experimental::async_sender;
+
+    {
+        auto result = tt::sync_wait(async_sender<increment_action>(target, 42));
+        HPX_TEST_EQ(hpx::get<0>(*result), 43);
+
+        increment_action inc;
+        auto result2 = tt::sync_wait(async_sender(inc, target, 42));
+        HPX_TEST_EQ(hpx::get<0>(*result2), 43);
+    }
+
+    {
+        // a sender can be started more than once
+        auto s = async_sender<increment_action>(target, 42);
+        HPX_TEST_EQ(hpx::get<0>(*tt::sync_wait(s)), 43);
+        HPX_TEST_EQ(hpx::get<0>(*tt::sync_wait(s)), 43);
+    }
+
+    {
+        std::int32_t const calls = void_calls.load();
+        tt::sync_wait(async_sender<call_void_action>(target));
+        if (target == hpx::find_here())
+        {
+            HPX_TEST_EQ(void_calls.load(), calls + 1);
+        }
+    }
+
+    {
+        auto s = async_sender<increment_action>(target, 42) |
+            ex::then([](std::int32_t i) { return i * 2; });
+        HPX_TEST_EQ(hpx::get<0>(*tt::sync_wait(HPX_MOVE(s))), 86);
+    }
+
+    {
+        auto s = ex::when_all(async_sender<increment_action>(target, 1),
+                     async_sender<increment_action>(target, 2)) |
+            ex::then([](std::int32_t i, std::int32_t j) { return i + j; });
+        HPX_TEST_EQ(hpx::get<0>(*tt::sync_wait(HPX_MOVE(s))), 5);
+    }
+
+    {
+        bool caught_exception = false;
+        try
+        {
+            tt::sync_wait(async_sender<throw_error_action>(target));
+            HPX_TEST(false);
+        }
+        catch (std::exception const&)
+        {
+            caught_exception = true;
+        }
+        HPX_TEST(caught_exception);
+    }
+
+    {
+        hpx::id_type dec = hpx::new_<decrement_server>(target).get();
+
+        auto result = tt::sync_wait(async_sender<call_action>(dec, 42));
+        HPX_TEST_EQ(hpx::get<0>(*result), 41);
+
+        call_action call;
+        auto result2 = tt::sync_wait(async_sender(call, dec, 42));
+        HPX_TEST_EQ(hpx::get<0>(*result2), 41);
+    }
+}
+
+int hpx_main()
+{
+    std::vector<hpx::id_type> localities = hpx::find_all_localities();
+    for (hpx::id_type const& id : localities)
+    {
+        test_remote_async_sender(id);
+    }
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // Initialize and run HPX
+    HPX_TEST_EQ_MSG(
+        hpx::init(argc, argv), 0, "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
+#endif
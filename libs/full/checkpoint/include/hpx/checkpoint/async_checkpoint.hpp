@@ -0,0 +1,169 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// This header defines the async_checkpointer, which takes a snapshot of the
+/// objects to checkpoint and serializes and writes the snapshot in the
+/// background, so that checkpointing overlaps with the computation.
+
+/// \file hpx/checkpoint/async_checkpoint.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/checkpoint/checkpoint.hpp>
+#include <hpx/checkpoint/checkpoint_file.hpp>
+#include <hpx/checkpoint_base/checkpoint_data.hpp>
+#include <hpx/coroutines/thread_enums.hpp>
+#include <hpx/datastructures/tuple.hpp>
+#include <hpx/executors/async.hpp>
+#include <hpx/executors/parallel_executor.hpp>
+#include <hpx/functional/invoke_fused.hpp>
+#include <hpx/futures/future.hpp>
+#include <hpx/synchronization/counting_semaphore.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace util {
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Async_checkpointer
+    ///
+    /// The async_checkpointer decouples taking a snapshot of the application
+    /// state from serializing and writing it. Save and save_file copy (or
+    /// move, if passed rvalues) the given objects into a snapshot and return
+    /// right away, the snapshot is serialized by a task scheduled on the
+    /// given executor (by default with low priority), which lets the
+    /// application continue with its time loop.
+    ///
+    /// At most max_pending checkpoints are in flight at any time. If a new
+    /// checkpoint is started while max_pending checkpoints have not finished
+    /// yet, save and save_file block until one of them has finished, which
+    /// also bounds the memory held by the snapshots.
+    ///
+    /// Components are not supported, the objects are captured by value.
+    class async_checkpointer
+    {
+    public:
+        explicit async_checkpointer(std::size_t max_pending = 1,
+            hpx::execution::parallel_executor exec =
+                hpx::execution::parallel_executor(
+                    threads::thread_priority::low))
+          : exec_(exec)
+          , max_pending_(max_pending != 0 ? max_pending : 1)
+          , slots_(static_cast<std::ptrdiff_t>(max_pending_))
+          , pending_(0)
+        {
+        }
+
+        async_checkpointer(async_checkpointer const&) = delete;
+        async_checkpointer& operator=(async_checkpointer const&) = delete;
+
+        // waits for all checkpoints in flight
+        ~async_checkpointer()
+        {
+            wait();
+        }
+
+        /// Snapshot the given objects and serialize them into a checkpoint
+        /// in the background.
+        ///
+        /// \returns a future which becomes ready with the checkpoint once
+        ///          the snapshot was serialized.
+        template <typename... Ts>
+        hpx::future<checkpoint> save(Ts&&... ts)
+        {
+            return submit(
+                [](auto&... snapshot) {
+                    std::vector<char> data;
+                    hpx::util::save_checkpoint_data(data, snapshot...);
+                    return checkpoint(HPX_MOVE(data));
+                },
+                HPX_FORWARD(Ts, ts)...);
+        }
+
+        /// Snapshot the given objects and write them to the given file in
+        /// the background (see save_checkpoint_file).
+        ///
+        /// \returns a future which becomes ready once the file was written.
+        template <typename... Ts>
+        hpx::future<void> save_file(std::string const& filename, Ts&&... ts)
+        {
+            return submit(
+                [filename](auto&... snapshot) {
+                    checkpoint_file_writer writer(filename);
+                    hpx::util::save_checkpoint_data(writer, snapshot...);
+                    writer.close();
+                },
+                HPX_FORWARD(Ts, ts)...);
+        }
+
+        // the number of checkpoints in flight
+        std::size_t pending() const noexcept
+        {
+            return pending_.load(std::memory_order_relaxed);
+        }
+
+        // wait for all checkpoints which have been started so far
+        void wait()
+        {
+            auto const count = static_cast<std::ptrdiff_t>(max_pending_);
+            slots_.wait(count);
+            slots_.signal(count);
+        }
+
+    private:
+        template <typename F, typename... Ts>
+        auto submit(F&& f, Ts&&... ts)
+        {
+            // back-pressure, the snapshot is taken only once a slot is free
+            slots_.wait();
+
+            using snapshot_type = hpx::tuple<std::decay_t<Ts>...>;
+            using result_type = decltype(
+                hpx::util::invoke_fused(f, std::declval<snapshot_type&>()));
+
+            hpx::future<result_type> result;
+            try
+            {
+                pending_.fetch_add(1, std::memory_order_relaxed);
+
+                snapshot_type snapshot(HPX_FORWARD(Ts, ts)...);
+                result = hpx::async(exec_,
+                    [f = HPX_FORWARD(F, f),
+                        snapshot = HPX_MOVE(snapshot)]() mutable {
+                        return hpx::util::invoke_fused(f, snapshot);
+                    });
+            }
+            catch (...)
+            {
+                release();
+                throw;
+            }
+
+            return result.then(hpx::launch::sync,
+                [this](hpx::future<result_type>&& r) -> result_type {
+                    release();
+                    return r.get();
+                });
+        }
+
+        void release() noexcept
+        {
+            pending_.fetch_sub(1, std::memory_order_relaxed);
+            slots_.signal();
+        }
+
+        hpx::execution::parallel_executor exec_;
+        std::size_t max_pending_;
+        hpx::counting_semaphore_var<> slots_;
+        std::atomic<std::size_t> pending_;
+    };
+}}    // namespace hpx::util
@@ -0,0 +1,258 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// This header defines incremental checkpoints. A checkpoint is split into
+/// fixed size chunks which are identified by their content hashes. A
+/// checkpoint_delta stores only the chunks which changed relative to a base
+/// checkpoint together with a manifest describing the whole checkpoint,
+/// apply_checkpoint_delta reconstructs the checkpoint from the base and the
+/// delta.
+
+/// \file hpx/checkpoint/checkpoint_delta.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/checkpoint/checkpoint.hpp>
+#include <hpx/serialization/serialize.hpp>
+#include <hpx/serialization/vector.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <vector>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx { namespace util {
+
+    // Forward declarations
+    class checkpoint_manifest;
+    class checkpoint_delta;
+
+    HPX_EXPORT checkpoint_delta make_checkpoint_delta(
+        checkpoint_manifest const& base, checkpoint const& current);
+    HPX_EXPORT checkpoint_delta make_checkpoint_delta(checkpoint const& base,
+        checkpoint const& current, std::size_t chunk_size);
+    HPX_EXPORT checkpoint apply_checkpoint_delta(
+        checkpoint const& base, checkpoint_delta const& delta);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Checkpoint_manifest
+    ///
+    /// The manifest of a checkpoint holds the size of the checkpoint, the
+    /// size of its chunks and the content hash of each chunk. The last chunk
+    /// may be shorter than the others. A default constructed manifest
+    /// describes an empty checkpoint, a delta relative to it contains all
+    /// chunks.
+    class HPX_EXPORT checkpoint_manifest
+    {
+    public:
+        static constexpr std::size_t default_chunk_size = 64 * 1024;
+
+        checkpoint_manifest() noexcept
+          : chunk_size_(default_chunk_size)
+          , size_(0)
+        {
+        }
+
+        explicit checkpoint_manifest(checkpoint const& c,
+            std::size_t chunk_size = default_chunk_size);
+
+        std::size_t chunk_size() const noexcept
+        {
+            return chunk_size_;
+        }
+
+        // the size of the described checkpoint
+        std::size_t size() const noexcept
+        {
+            return size_;
+        }
+
+        std::size_t num_chunks() const noexcept
+        {
+            return hashes_.size();
+        }
+
+        // the number of bytes in the given chunk
+        std::size_t chunk_length(std::size_t chunk) const noexcept
+        {
+            HPX_ASSERT(chunk < num_chunks());
+            std::size_t const offset = chunk * chunk_size_;
+            return size_ - offset < chunk_size_ ? size_ - offset : chunk_size_;
+        }
+
+        std::uint64_t hash(std::size_t chunk) const noexcept
+        {
+            HPX_ASSERT(chunk < num_chunks());
+            return hashes_[chunk];
+        }
+
+        friend bool operator==(
+            checkpoint_manifest const& lhs, checkpoint_manifest const& rhs)
+        {
+            return lhs.chunk_size_ == rhs.chunk_size_ &&
+                lhs.size_ == rhs.size_ && lhs.hashes_ == rhs.hashes_;
+        }
+        friend bool operator!=(
+            checkpoint_manifest const& lhs, checkpoint_manifest const& rhs)
+        {
+            return !(lhs == rhs);
+        }
+
+        // the content hash of a chunk of data
+        static std::uint64_t hash_chunk(char const* data, std::size_t size);
+
+    private:
+        friend class hpx::serialization::access;
+
+        template <typename Archive>
+        void serialize(Archive& arch, const unsigned int /* version */)
+        {
+            // clang-format off
+            arch & chunk_size_ & size_ & hashes_;
+            // clang-format on
+        }
+
+        std::size_t chunk_size_;
+        std::size_t size_;
+        std::vector<std::uint64_t> hashes_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Checkpoint_delta
+    ///
+    /// A checkpoint_delta holds the manifest of a checkpoint and the
+    /// contents of those chunks which differ from the base checkpoint it was
+    /// created against. All other chunks are taken from the base checkpoint
+    /// when the delta is applied. The manifest of a delta can be used as the
+    /// base of the next delta, which allows for chains of deltas.
+    class HPX_EXPORT checkpoint_delta
+    {
+    public:
+        checkpoint_delta() = default;
+
+        // the manifest of the checkpoint described by this delta
+        checkpoint_manifest const& manifest() const noexcept
+        {
+            return manifest_;
+        }
+
+        // the number of chunks stored in this delta
+        std::size_t num_changed_chunks() const noexcept
+        {
+            return changed_.size();
+        }
+
+        // the number of data bytes stored in this delta
+        std::size_t size() const noexcept
+        {
+            return data_.size();
+        }
+
+        friend bool operator==(
+            checkpoint_delta const& lhs, checkpoint_delta const& rhs)
+        {
+            return lhs.manifest_ == rhs.manifest_ &&
+                lhs.changed_ == rhs.changed_ && lhs.data_ == rhs.data_;
+        }
+        friend bool operator!=(
+            checkpoint_delta const& lhs, checkpoint_delta const& rhs)
+        {
+            return !(lhs == rhs);
+        }
+
+    private:
+        friend checkpoint_delta make_checkpoint_delta(
+            checkpoint_manifest const& base, checkpoint const& current);
+        friend checkpoint_delta make_checkpoint_delta(checkpoint const& base,
+            checkpoint const& current, std::size_t chunk_size);
+        friend checkpoint apply_checkpoint_delta(
+            checkpoint const& base, checkpoint_delta const& delta);
+
+        friend class hpx::serialization::access;
+
+        template <typename Archive>
+        void serialize(Archive& arch, const unsigned int /* version */)
+        {
+            // clang-format off
+            arch & manifest_ & changed_ & data_;
+            // clang-format on
+        }
+
+        checkpoint_manifest manifest_;
+        std::vector<std::uint64_t> changed_;    // the stored chunks, ascending
+        std::vector<char> data_;                // their contents
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Make_checkpoint_delta
+    ///
+    /// \param base          The manifest of the base checkpoint.
+    ///
+    /// \param current       The checkpoint to store.
+    ///
+    /// Make_checkpoint_delta splits the current checkpoint into chunks of the
+    /// chunk size of the base manifest and stores all chunks whose content
+    /// hash differs from the hash of the corresponding chunk of the base
+    /// checkpoint. Only the manifest of the base checkpoint is needed.
+    ///
+    /// \returns Make_checkpoint_delta returns the delta which turns the base
+    ///          checkpoint into the current one.
+    HPX_EXPORT checkpoint_delta make_checkpoint_delta(
+        checkpoint_manifest const& base, checkpoint const& current);
+
+    /// Make_checkpoint_delta
+    ///
+    /// \param base          The base checkpoint.
+    ///
+    /// \param current       The checkpoint to store.
+    ///
+    /// \param chunk_size    The size of the chunks the checkpoints are split
+    ///                      into.
+    ///
+    /// Same as above, but the chunks are compared with the contents of the
+    /// base checkpoint directly instead of with their hashes.
+    HPX_EXPORT checkpoint_delta make_checkpoint_delta(checkpoint const& base,
+        checkpoint const& current,
+        std::size_t chunk_size = checkpoint_manifest::default_chunk_size);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Apply_checkpoint_delta
+    ///
+    /// \param base          The base checkpoint the delta was created against.
+    ///
+    /// \param delta         The delta to apply.
+    ///
+    /// Apply_checkpoint_delta reconstructs a checkpoint from its delta. The
+    /// chunks which are not stored in the delta are copied from the base
+    /// checkpoint after verifying their content hash, a mismatch (e.g. if
+    /// the delta is applied to the wrong base) is reported by throwing an
+    /// hpx::exception with the error code hpx::invalid_data.
+    ///
+    /// \returns Apply_checkpoint_delta returns the reconstructed checkpoint,
+    ///          which can be passed to restore_checkpoint.
+    HPX_EXPORT checkpoint apply_checkpoint_delta(
+        checkpoint const& base, checkpoint_delta const& delta);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Operator<< Overload
+    ///
+    /// Writes the delta to the stream in the same format as a checkpoint
+    /// holding the serialized delta.
+    HPX_EXPORT std::ostream& operator<<(
+        std::ostream& ost, checkpoint_delta const& delta);
+
+    /// Operator>> Overload
+    ///
+    /// Reads a delta which was written using operator<<.
+    HPX_EXPORT std::istream& operator>>(
+        std::istream& ist, checkpoint_delta& delta);
+}}    // namespace hpx::util
+
+#include <hpx/config/warnings_suffix.hpp>
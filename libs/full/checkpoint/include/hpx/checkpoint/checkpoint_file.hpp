@@ -0,0 +1,257 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// This header defines save_checkpoint_file and restore_checkpoint_file.
+/// These functions stream the serialized objects directly to (and from) a
+/// file instead of collecting them in a checkpoint object first. The files
+/// have the same layout as the ones produced by writing a checkpoint to an
+/// std::ostream using operator<<.
+
+/// \file hpx/checkpoint/checkpoint_file.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/async_distributed/dataflow.hpp>
+#include <hpx/checkpoint/checkpoint.hpp>
+#include <hpx/checkpoint_base/checkpoint_data.hpp>
+#include <hpx/futures/future.hpp>
+#include <hpx/serialization/traits/serialization_access_data.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx { namespace util {
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Checkpoint_file_writer
+    ///
+    /// An output container for save_checkpoint_data which streams the
+    /// serialized data into a file. The data is collected in a bounded set
+    /// of buffers, a full buffer is written to the file (using the I/O pool
+    /// if called from an HPX thread) while serialization continues in the
+    /// next one. Only the buffers are held in memory, independently of the
+    /// overall size of the checkpoint.
+    ///
+    /// The size of the checkpoint is written in front of the data once the
+    /// writer is closed.
+    class HPX_EXPORT checkpoint_file_writer
+    {
+    public:
+        static constexpr std::size_t default_buffer_size = 16 * 1024 * 1024;
+        static constexpr std::size_t default_max_buffers = 4;
+
+        explicit checkpoint_file_writer(std::string const& filename,
+            std::size_t buffer_size = default_buffer_size,
+            std::size_t max_buffers = default_max_buffers);
+
+        checkpoint_file_writer(checkpoint_file_writer const&) = delete;
+        checkpoint_file_writer& operator=(
+            checkpoint_file_writer const&) = delete;
+
+        // waits for the outstanding writes, errors are ignored
+        ~checkpoint_file_writer();
+
+        // the number of bytes serialized so far
+        std::size_t size() const noexcept
+        {
+            return size_;
+        }
+
+        // append count bytes, the appended bytes are contiguous in memory
+        void grow(std::size_t count);
+
+        // store the given data at the position current, which must refer to
+        // the bytes appended by the last call to grow
+        void write(std::size_t current, void const* address,
+            std::size_t count) noexcept
+        {
+            buffer& b = buffers_[current_buffer_];
+            HPX_ASSERT(current >= b.offset &&
+                current + count <= b.offset + b.size);
+            std::memcpy(b.data.data() + (current - b.offset), address, count);
+        }
+
+        // write the remaining data and the size of the checkpoint, wait for
+        // all writes to finish and close the file, throws on I/O errors
+        void close();
+
+    private:
+        struct buffer
+        {
+            std::vector<char> data;
+            std::size_t offset = 0;    // the position of data[0]
+            std::size_t size = 0;      // the number of bytes used
+            hpx::future<void> written;
+        };
+
+        void submit(buffer& b);
+        void wait_for_all();
+
+        std::string filename_;
+        int fd_;
+        std::size_t buffer_size_;
+        std::size_t max_buffers_;
+
+        std::vector<buffer> buffers_;
+        std::size_t current_buffer_;
+        std::size_t size_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Checkpoint_file_reader
+    ///
+    /// An input container for restore_checkpoint_data which maps a file
+    /// written by a checkpoint_file_writer (or by operator<<) into memory.
+    /// The data is paged in on demand while it is being deserialized.
+    class HPX_EXPORT checkpoint_file_reader
+    {
+    public:
+        explicit checkpoint_file_reader(std::string const& filename);
+
+        checkpoint_file_reader(checkpoint_file_reader const&) = delete;
+        checkpoint_file_reader& operator=(
+            checkpoint_file_reader const&) = delete;
+
+        ~checkpoint_file_reader();
+
+        std::size_t size() const noexcept
+        {
+            return size_;
+        }
+
+        char const* data() const noexcept
+        {
+            return data_;
+        }
+
+        char const& operator[](std::size_t i) const noexcept
+        {
+            HPX_ASSERT(i < size_);
+            return data_[i];
+        }
+
+    private:
+        void* mapping_;
+        std::size_t mapping_size_;
+#if defined(HPX_WINDOWS)
+        // memory mapping is not supported, the file is read instead
+        std::vector<char> contents_;
+#endif
+        char const* data_;
+        std::size_t size_;
+    };
+
+    namespace detail {
+
+        struct save_file_funct_obj
+        {
+            template <typename... Ts>
+            void operator()(std::string const& filename,
+                std::size_t buffer_size, Ts&&... ts) const
+            {
+                checkpoint_file_writer writer(filename, buffer_size);
+                hpx::util::save_checkpoint_data(writer, HPX_FORWARD(Ts, ts)...);
+                writer.close();
+            }
+        };
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Save_checkpoint_file
+    ///
+    /// \tparam Ts           Containers passed to save_checkpoint_file to be
+    ///                      serialized and written to the file.
+    ///
+    /// \param filename      The file to write to, an existing file is
+    ///                      overwritten.
+    ///
+    /// \param ts            The containers to store.
+    ///
+    /// Save_checkpoint_file serializes the given objects into the file in the
+    /// same way as save_checkpoint followed by writing the checkpoint with
+    /// operator<<, but without holding the whole checkpoint in memory.
+    /// Components are stored in the same way as by save_checkpoint.
+    ///
+    /// \returns Save_checkpoint_file returns a future which becomes ready once
+    ///          the file was written.
+    template <typename... Ts>
+    hpx::future<void> save_checkpoint_file(
+        std::string const& filename, Ts&&... ts)
+    {
+        return hpx::dataflow(detail::save_file_funct_obj{}, filename,
+            checkpoint_file_writer::default_buffer_size,
+            detail::prepare_client(HPX_FORWARD(Ts, ts))...);
+    }
+
+    /// \cond NOINTERNAL
+    // Same as above, synchronous
+    template <typename... Ts>
+    void save_checkpoint_file(hpx::launch::sync_policy sync_p,
+        std::string const& filename, Ts&&... ts)
+    {
+        hpx::dataflow(sync_p, detail::save_file_funct_obj{}, filename,
+            checkpoint_file_writer::default_buffer_size,
+            detail::prepare_client(HPX_FORWARD(Ts, ts))...)
+            .get();
+    }
+    /// \endcond
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Restore_checkpoint_file
+    ///
+    /// \tparam Ts           Containers to restore.
+    ///
+    /// \param filename      The file written by save_checkpoint_file (or by
+    ///                      writing a checkpoint using operator<<).
+    ///
+    /// \param ts            The containers to restore, they must be in the
+    ///                      same order that they were stored.
+    ///
+    /// Restore_checkpoint_file maps the file into memory and restores the
+    /// given objects from it.
+    template <typename... Ts>
+    void restore_checkpoint_file(std::string const& filename, Ts&... ts)
+    {
+        checkpoint_file_reader reader(filename);
+        hpx::util::restore_checkpoint_data_func(
+            reader, detail::restore_impl{}, ts...);
+    }
+}}    // namespace hpx::util
+
+namespace hpx { namespace traits {
+
+    template <>
+    struct serialization_access_data<util::checkpoint_file_writer>
+      : default_serialization_access_data<util::checkpoint_file_writer>
+    {
+        static std::size_t size(util::checkpoint_file_writer const& cont)
+        {
+            return cont.size();
+        }
+
+        static void resize(
+            util::checkpoint_file_writer& cont, std::size_t count)
+        {
+            cont.grow(count);
+        }
+
+        static void write(util::checkpoint_file_writer& cont, std::size_t count,
+            std::size_t current, void const* address) noexcept
+        {
+            cont.write(current, address, count);
+        }
+    };
+}}    // namespace hpx::traits
+
+#include <hpx/config/warnings_suffix.hpp>
@@ -0,0 +1,243 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// This header defines save_distributed_checkpoint and
+/// restore_distributed_checkpoint. A distributed checkpoint is a collective
+/// operation: all participating sites (usually all localities) enter the
+/// checkpoint together, write their parts into separate files in parallel,
+/// and the root site commits an index file once all parts have been written.
+/// The parts can be restored onto a different number of sites.
+
+/// \file hpx/checkpoint/distributed_checkpoint.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/async_distributed/dataflow.hpp>
+#include <hpx/checkpoint/checkpoint.hpp>
+#include <hpx/checkpoint/checkpoint_file.hpp>
+#include <hpx/checkpoint_base/checkpoint_data.hpp>
+#include <hpx/collectives/argument_types.hpp>
+#include <hpx/collectives/create_communicator.hpp>
+#include <hpx/futures/future.hpp>
+#include <hpx/modules/errors.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx { namespace util {
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Distributed_checkpoint_index
+    ///
+    /// The index of a distributed checkpoint lists the sizes of its parts.
+    /// It is written by the root site only after all parts were written
+    /// successfully, an existing index therefore denotes a complete
+    /// checkpoint.
+    class HPX_EXPORT distributed_checkpoint_index
+    {
+    public:
+        distributed_checkpoint_index() = default;
+
+        // read the index of the distributed checkpoint with the given base
+        // name, throws if there is no complete checkpoint
+        explicit distributed_checkpoint_index(std::string const& basename);
+
+        // the number of parts, i.e. the number of sites which saved the
+        // checkpoint
+        std::size_t num_parts() const noexcept
+        {
+            return sizes_.size();
+        }
+
+        // the size of the given part (excluding the size header of its file)
+        std::uint64_t part_size(std::size_t part) const
+        {
+            return sizes_.at(part);
+        }
+
+        // the range [first, last) of parts to be restored by this_site if
+        // the checkpoint is restored onto num_sites sites, the parts are
+        // distributed in contiguous blocks of (almost) equal size
+        std::pair<std::size_t, std::size_t> parts_for_site(
+            std::size_t num_sites, std::size_t this_site) const noexcept;
+
+        // the names of the files making up the distributed checkpoint
+        static std::string part_filename(
+            std::string const& basename, std::size_t part);
+        static std::string index_filename(std::string const& basename);
+
+    private:
+        std::vector<std::uint64_t> sizes_;
+    };
+
+    namespace detail {
+
+        ///////////////////////////////////////////////////////////////////////
+        // One invocation of save_distributed_checkpoint on one site. The
+        // constructor waits for all sites to enter the checkpoint, commit
+        // collects the outcome of all sites, writes the index and reports
+        // the same result on all sites.
+        class HPX_EXPORT distributed_checkpoint_epoch
+        {
+        public:
+            distributed_checkpoint_epoch(std::string const& basename,
+                collectives::num_sites_arg num_sites,
+                collectives::this_site_arg this_site);
+
+            distributed_checkpoint_epoch(
+                distributed_checkpoint_epoch const&) = delete;
+            distributed_checkpoint_epoch& operator=(
+                distributed_checkpoint_epoch const&) = delete;
+
+            std::string part_filename() const
+            {
+                return distributed_checkpoint_index::part_filename(
+                    basename_, this_site_);
+            }
+
+            // size is the size of the part written by this site, error is
+            // empty if it was written successfully
+            void commit(std::uint64_t size, std::string error);
+
+        private:
+            std::string basename_;
+            std::size_t num_sites_;
+            std::size_t this_site_;
+            collectives::communicator comm_;
+        };
+
+        struct save_distributed_funct_obj
+        {
+            template <typename... Ts>
+            void operator()(std::string const& basename,
+                collectives::num_sites_arg num_sites,
+                collectives::this_site_arg this_site, Ts&&... ts) const
+            {
+                distributed_checkpoint_epoch epoch(
+                    basename, num_sites, this_site);
+
+                // errors are reported to all sites by commit, which
+                // prevents the other sites from waiting forever
+                std::uint64_t size = 0;
+                std::string error;
+                try
+                {
+                    checkpoint_file_writer writer(epoch.part_filename());
+                    hpx::util::save_checkpoint_data(
+                        writer, HPX_FORWARD(Ts, ts)...);
+                    writer.close();
+                    size = writer.size();
+                }
+                catch (std::exception const& e)
+                {
+                    error = e.what();
+                }
+                catch (...)
+                {
+                    error = "unknown error";
+                }
+
+                epoch.commit(size, HPX_MOVE(error));
+            }
+        };
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Save_distributed_checkpoint
+    ///
+    /// \tparam Ts           Containers passed to save_distributed_checkpoint
+    ///                      to be serialized into the part of this site.
+    ///
+    /// \param basename      The base name of the files of the checkpoint,
+    ///                      it also identifies the collective operation and
+    ///                      has to be the same on all sites.
+    ///
+    /// \param num_sites     The number of participating sites (default: all
+    ///                      localities).
+    ///
+    /// \param this_site     The sequence number of this site (default: the
+    ///                      locality id).
+    ///
+    /// \param ts            The containers to store.
+    ///
+    /// Save_distributed_checkpoint has to be invoked by all participating
+    /// sites. The sites synchronize on a barrier before the containers are
+    /// serialized, each site then writes its part into the file
+    /// <basename>.<this_site>.chk (see save_checkpoint_file). Once all parts
+    /// were written, the root site writes the index <basename>.index. Any
+    /// existing index is removed before the parts are written.
+    ///
+    /// \returns Save_distributed_checkpoint returns a future which becomes
+    ///          ready once the checkpoint was committed. If any site failed
+    ///          to write its part, the futures of all sites hold an
+    ///          exception.
+    template <typename... Ts>
+    hpx::future<void> save_distributed_checkpoint(std::string const& basename,
+        collectives::num_sites_arg num_sites,
+        collectives::this_site_arg this_site, Ts&&... ts)
+    {
+        return hpx::dataflow(detail::save_distributed_funct_obj{}, basename,
+            num_sites, this_site,
+            detail::prepare_client(HPX_FORWARD(Ts, ts))...);
+    }
+
+    /// \cond NOINTERNAL
+    // Same as above, all localities participate
+    template <typename... Ts>
+    hpx::future<void> save_distributed_checkpoint(
+        std::string const& basename, Ts&&... ts)
+    {
+        return save_distributed_checkpoint(basename,
+            collectives::num_sites_arg(), collectives::this_site_arg(),
+            HPX_FORWARD(Ts, ts)...);
+    }
+    /// \endcond
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Restore_distributed_checkpoint
+    ///
+    /// \tparam Ts           Containers to restore.
+    ///
+    /// \param basename      The base name of the files of the checkpoint.
+    ///
+    /// \param part          The part to restore, usually the id of the site
+    ///                      which saved it. Distributed_checkpoint_index::
+    ///                      parts_for_site tells which parts to restore if
+    ///                      the number of sites changed.
+    ///
+    /// \param ts            The containers to restore, they must be in the
+    ///                      same order that they were stored.
+    ///
+    /// Restore_distributed_checkpoint restores the given part of a complete
+    /// distributed checkpoint, it is a local operation.
+    template <typename... Ts>
+    void restore_distributed_checkpoint(
+        std::string const& basename, std::size_t part, Ts&... ts)
+    {
+        distributed_checkpoint_index index(basename);
+        if (part >= index.num_parts())
+        {
+            HPX_THROW_EXCEPTION(bad_parameter,
+                "hpx::util::restore_distributed_checkpoint",
+                "the distributed checkpoint '{}' has {} parts, part {} "
+                "was requested",
+                basename, index.num_parts(), part);
+        }
+
+        hpx::util::restore_checkpoint_file(
+            distributed_checkpoint_index::part_filename(basename, part),
+            ts...);
+    }
+}}    // namespace hpx::util
+
+#include <hpx/config/warnings_suffix.hpp>
@@ -0,0 +1,181 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/checkpoint/checkpoint.hpp>
+#include <hpx/checkpoint/checkpoint_delta.hpp>
+#include <hpx/checkpoint_base/checkpoint_data.hpp>
+#include <hpx/hashing/wyhash.hpp>
+#include <hpx/modules/errors.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <istream>
+#include <ostream>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace util {
+
+    ///////////////////////////////////////////////////////////////////////////
+    checkpoint_manifest::checkpoint_manifest(
+        checkpoint const& c, std::size_t chunk_size)
+      : chunk_size_(chunk_size)
+      , size_(c.size())
+    {
+        if (chunk_size_ == 0)
+        {
+            HPX_THROW_EXCEPTION(bad_parameter,
+                "checkpoint_manifest::checkpoint_manifest",
+                "the chunk size must not be zero");
+        }
+
+        hashes_.reserve((size_ + chunk_size_ - 1) / chunk_size_);
+        for (std::size_t offset = 0; offset < size_; offset += chunk_size_)
+        {
+            std::size_t const length =
+                size_ - offset < chunk_size_ ? size_ - offset : chunk_size_;
+            hashes_.push_back(hash_chunk(c.data() + offset, length));
+        }
+    }
+
+    std::uint64_t checkpoint_manifest::hash_chunk(
+        char const* data, std::size_t size)
+    {
+        return wyhash(data, size);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    checkpoint_delta make_checkpoint_delta(
+        checkpoint_manifest const& base, checkpoint const& current)
+    {
+        checkpoint_delta delta;
+        delta.manifest_ = checkpoint_manifest(current, base.chunk_size());
+
+        checkpoint_manifest const& m = delta.manifest_;
+        for (std::size_t i = 0; i != m.num_chunks(); ++i)
+        {
+            std::size_t const length = m.chunk_length(i);
+            if (i < base.num_chunks() && base.chunk_length(i) == length &&
+                base.hash(i) == m.hash(i))
+            {
+                continue;
+            }
+
+            char const* data = current.data() + i * m.chunk_size();
+            delta.changed_.push_back(i);
+            delta.data_.insert(delta.data_.end(), data, data + length);
+        }
+        return delta;
+    }
+
+    checkpoint_delta make_checkpoint_delta(checkpoint const& base,
+        checkpoint const& current, std::size_t chunk_size)
+    {
+        checkpoint_delta delta;
+        delta.manifest_ = checkpoint_manifest(current, chunk_size);
+
+        checkpoint_manifest const& m = delta.manifest_;
+        for (std::size_t i = 0; i != m.num_chunks(); ++i)
+        {
+            std::size_t const offset = i * chunk_size;
+            std::size_t const length = m.chunk_length(i);
+            char const* data = current.data() + offset;
+
+            if (offset + length <= base.size() &&
+                (offset + length == base.size() || length == chunk_size) &&
+                std::memcmp(base.data() + offset, data, length) == 0)
+            {
+                continue;
+            }
+
+            delta.changed_.push_back(i);
+            delta.data_.insert(delta.data_.end(), data, data + length);
+        }
+        return delta;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    checkpoint apply_checkpoint_delta(
+        checkpoint const& base, checkpoint_delta const& delta)
+    {
+        checkpoint_manifest const& m = delta.manifest_;
+        std::size_t const chunk_size = m.chunk_size();
+        if (chunk_size == 0 ||
+            (m.size() + chunk_size - 1) / chunk_size != m.num_chunks())
+        {
+            HPX_THROW_EXCEPTION(invalid_data, "apply_checkpoint_delta",
+                "the manifest of the checkpoint delta is corrupt");
+        }
+
+        std::vector<char> data(m.size());
+
+        std::size_t next = 0;    // the next stored chunk
+        std::size_t pos = 0;     // its position in the stored data
+        for (std::size_t i = 0; i != m.num_chunks(); ++i)
+        {
+            std::size_t const offset = i * chunk_size;
+            std::size_t const length = m.chunk_length(i);
+
+            if (next != delta.changed_.size() && delta.changed_[next] == i)
+            {
+                if (delta.data_.size() - pos < length)
+                {
+                    HPX_THROW_EXCEPTION(invalid_data, "apply_checkpoint_delta",
+                        "the data of the checkpoint delta is incomplete");
+                }
+
+                std::memcpy(data.data() + offset, delta.data_.data() + pos,
+                    length);
+                pos += length;
+                ++next;
+                continue;
+            }
+
+            // the chunk is taken from the base checkpoint, make sure it is
+            // the one the delta was created against
+            if (offset + length > base.size() ||
+                checkpoint_manifest::hash_chunk(base.data() + offset,
+                    length) != m.hash(i))
+            {
+                HPX_THROW_EXCEPTION(invalid_data, "apply_checkpoint_delta",
+                    "chunk {} of the base checkpoint does not match the "
+                    "checkpoint delta",
+                    i);
+            }
+            std::memcpy(data.data() + offset, base.data() + offset, length);
+        }
+
+        if (next != delta.changed_.size() || pos != delta.data_.size())
+        {
+            HPX_THROW_EXCEPTION(invalid_data, "apply_checkpoint_delta",
+                "the checkpoint delta holds unexpected chunks");
+        }
+
+        return checkpoint(HPX_MOVE(data));
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    std::ostream& operator<<(std::ostream& ost, checkpoint_delta const& delta)
+    {
+        std::vector<char> data;
+        save_checkpoint_data(data, delta);
+        return ost << checkpoint(HPX_MOVE(data));
+    }
+
+    std::istream& operator>>(std::istream& ist, checkpoint_delta& delta)
+    {
+        checkpoint c;
+        ist >> c;
+        if (ist)
+        {
+            restore_checkpoint(c, delta);
+        }
+        return ist;
+    }
+}}    // namespace hpx::util
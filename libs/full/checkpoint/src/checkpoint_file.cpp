@@ -0,0 +1,377 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/checkpoint/checkpoint_file.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/modules/threading_base.hpp>
+#include <hpx/runtime_local/run_as_os_thread.hpp>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <exception>
+#include <string>
+#include <utility>
+#include <vector>
+
+#if defined(HPX_WINDOWS)
+#include <fcntl.h>
+#include <io.h>
+#include <sys/stat.h>
+
+#include <fstream>
+#include <iterator>
+#include <mutex>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace hpx { namespace util {
+
+    namespace {
+
+        // the size of the checkpoint is stored in front of the data
+        constexpr std::size_t header_size = sizeof(std::int64_t);
+
+        std::string error_message(char const* what, std::string const& filename)
+        {
+            return std::string(what) + " '" + filename +
+                "': " + std::strerror(errno);
+        }
+
+#if defined(HPX_WINDOWS)
+        // there is no positional write, writes are serialized instead
+        std::mutex& write_mutex()
+        {
+            static std::mutex mtx;
+            return mtx;
+        }
+#endif
+
+        void write_at(int fd, char const* data, std::size_t size,
+            std::size_t offset, std::string const& filename)
+        {
+#if defined(HPX_WINDOWS)
+            std::lock_guard<std::mutex> l(write_mutex());
+            if (_lseeki64(fd, static_cast<__int64>(offset), SEEK_SET) < 0)
+            {
+                HPX_THROW_EXCEPTION(filesystem_error,
+                    "checkpoint_file_writer::write",
+                    error_message("couldn't seek in", filename));
+            }
+#endif
+            while (size != 0)
+            {
+#if defined(HPX_WINDOWS)
+                auto written = _write(fd, data,
+                    static_cast<unsigned int>((std::min)(size,
+                        static_cast<std::size_t>(1) << 30)));
+#else
+                auto written =
+                    ::pwrite(fd, data, size, static_cast<off_t>(offset));
+#endif
+                if (written < 0)
+                {
+                    if (errno == EINTR)
+                    {
+                        continue;
+                    }
+                    HPX_THROW_EXCEPTION(filesystem_error,
+                        "checkpoint_file_writer::write",
+                        error_message("couldn't write to", filename));
+                }
+
+                data += written;
+                size -= static_cast<std::size_t>(written);
+                offset += static_cast<std::size_t>(written);
+            }
+        }
+    }    // namespace
+
+    ///////////////////////////////////////////////////////////////////////////
+    checkpoint_file_writer::checkpoint_file_writer(std::string const& filename,
+        std::size_t buffer_size, std::size_t max_buffers)
+      : filename_(filename)
+      , fd_(-1)
+      , buffer_size_(buffer_size)
+      , max_buffers_((std::max)(max_buffers, static_cast<std::size_t>(1)))
+      , current_buffer_(0)
+      , size_(0)
+    {
+#if defined(HPX_WINDOWS)
+        fd_ = _open(filename.c_str(),
+            _O_WRONLY | _O_CREAT | _O_TRUNC | _O_BINARY, _S_IREAD | _S_IWRITE);
+#else
+        fd_ = ::open(filename.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+#endif
+        if (fd_ < 0)
+        {
+            HPX_THROW_EXCEPTION(filesystem_error,
+                "checkpoint_file_writer::checkpoint_file_writer",
+                error_message("couldn't open", filename));
+        }
+
+        buffers_.reserve(max_buffers_);
+        buffers_.emplace_back();
+        buffers_.back().data.resize(buffer_size_);
+    }
+
+    checkpoint_file_writer::~checkpoint_file_writer()
+    {
+        if (fd_ >= 0)
+        {
+            try
+            {
+                wait_for_all();
+            }
+            catch (...)
+            {
+                // errors are reported by close only
+            }
+
+#if defined(HPX_WINDOWS)
+            _close(fd_);
+#else
+            ::close(fd_);
+#endif
+        }
+    }
+
+    void checkpoint_file_writer::grow(std::size_t count)
+    {
+        buffer* b = &buffers_[current_buffer_];
+        if (b->size + count > b->data.size())
+        {
+            if (b->size != 0)
+            {
+                // hand the full buffer to the I/O pool and continue in the
+                // next one, waiting for its previous write if necessary
+                submit(*b);
+
+                current_buffer_ = (current_buffer_ + 1) % max_buffers_;
+                if (current_buffer_ == buffers_.size())
+                {
+                    buffers_.emplace_back();
+                }
+
+                b = &buffers_[current_buffer_];
+                if (b->written.valid())
+                {
+                    b->written.get();
+                }
+                b->offset = size_;
+                b->size = 0;
+            }
+
+            // the appended bytes have to be contiguous
+            if (b->data.size() < count)
+            {
+                b->data.resize((std::max)(buffer_size_, count));
+            }
+        }
+
+        b->size += count;
+        size_ += count;
+    }
+
+    void checkpoint_file_writer::submit(buffer& b)
+    {
+        HPX_ASSERT(!b.written.valid());
+
+        char const* data = b.data.data();
+        std::size_t const size = b.size;
+        std::size_t const offset = header_size + b.offset;
+        int const fd = fd_;
+        std::string const* filename = &filename_;
+
+        auto f = [=]() { write_at(fd, data, size, offset, *filename); };
+
+        if (threads::get_self_ptr() != nullptr)
+        {
+            // the write must not block the worker threads
+            b.written = hpx::threads::run_as_os_thread(f);
+        }
+        else
+        {
+            try
+            {
+                f();
+                b.written = hpx::make_ready_future();
+            }
+            catch (...)
+            {
+                b.written = hpx::make_exceptional_future<void>(
+                    std::current_exception());
+            }
+        }
+    }
+
+    void checkpoint_file_writer::wait_for_all()
+    {
+        // wait for all writes before reporting the first error
+        std::exception_ptr e;
+        for (buffer& b : buffers_)
+        {
+            if (!b.written.valid())
+            {
+                continue;
+            }
+
+            try
+            {
+                b.written.get();
+            }
+            catch (...)
+            {
+                if (!e)
+                {
+                    e = std::current_exception();
+                }
+            }
+        }
+
+        if (e)
+        {
+            std::rethrow_exception(e);
+        }
+    }
+
+    void checkpoint_file_writer::close()
+    {
+        if (fd_ < 0)
+        {
+            return;
+        }
+
+        buffer& b = buffers_[current_buffer_];
+        if (b.size != 0)
+        {
+            submit(b);
+        }
+        wait_for_all();
+
+        std::int64_t const size = static_cast<std::int64_t>(size_);
+        write_at(fd_, reinterpret_cast<char const*>(&size), sizeof(size), 0,
+            filename_);
+
+#if defined(HPX_WINDOWS)
+        int const result = _close(fd_);
+#else
+        int const result = ::close(fd_);
+#endif
+        fd_ = -1;
+
+        if (result != 0)
+        {
+            HPX_THROW_EXCEPTION(filesystem_error,
+                "checkpoint_file_writer::close",
+                error_message("couldn't close", filename_));
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    checkpoint_file_reader::checkpoint_file_reader(std::string const& filename)
+      : mapping_(nullptr)
+      , mapping_size_(0)
+      , data_(nullptr)
+      , size_(0)
+    {
+#if defined(HPX_WINDOWS)
+        std::ifstream ifs(filename, std::ios::binary);
+        if (!ifs)
+        {
+            HPX_THROW_EXCEPTION(filesystem_error,
+                "checkpoint_file_reader::checkpoint_file_reader",
+                error_message("couldn't open", filename));
+        }
+        contents_.assign(std::istreambuf_iterator<char>(ifs),
+            std::istreambuf_iterator<char>());
+        mapping_size_ = contents_.size();
+        char const* contents = contents_.data();
+#else
+        int const fd = ::open(filename.c_str(), O_RDONLY);
+        if (fd < 0)
+        {
+            HPX_THROW_EXCEPTION(filesystem_error,
+                "checkpoint_file_reader::checkpoint_file_reader",
+                error_message("couldn't open", filename));
+        }
+
+        struct stat st;
+        if (::fstat(fd, &st) != 0)
+        {
+            ::close(fd);
+            HPX_THROW_EXCEPTION(filesystem_error,
+                "checkpoint_file_reader::checkpoint_file_reader",
+                error_message("couldn't stat", filename));
+        }
+
+        mapping_size_ = static_cast<std::size_t>(st.st_size);
+        if (mapping_size_ != 0)
+        {
+            mapping_ =
+                ::mmap(nullptr, mapping_size_, PROT_READ, MAP_PRIVATE, fd, 0);
+        }
+        ::close(fd);
+
+        if (mapping_ == MAP_FAILED)
+        {
+            mapping_ = nullptr;
+            HPX_THROW_EXCEPTION(filesystem_error,
+                "checkpoint_file_reader::checkpoint_file_reader",
+                error_message("couldn't map", filename));
+        }
+
+        // the data is deserialized front to back
+        if (mapping_ != nullptr)
+        {
+            ::madvise(mapping_, mapping_size_, MADV_SEQUENTIAL);
+        }
+        char const* contents = static_cast<char const*>(mapping_);
+#endif
+
+        std::int64_t size = 0;
+        if (mapping_size_ >= header_size)
+        {
+            std::memcpy(&size, contents, header_size);
+        }
+
+        if (mapping_size_ < header_size || size < 0 ||
+            static_cast<std::size_t>(size) > mapping_size_ - header_size)
+        {
+#if !defined(HPX_WINDOWS)
+            if (mapping_ != nullptr)
+            {
+                ::munmap(mapping_, mapping_size_);
+                mapping_ = nullptr;
+            }
+#endif
+            HPX_THROW_EXCEPTION(filesystem_error,
+                "checkpoint_file_reader::checkpoint_file_reader",
+                "'{}' is not a valid checkpoint file", filename);
+        }
+
+        data_ = contents + header_size;
+        size_ = static_cast<std::size_t>(size);
+    }
+
+    checkpoint_file_reader::~checkpoint_file_reader()
+    {
+#if !defined(HPX_WINDOWS)
+        if (mapping_ != nullptr)
+        {
+            ::munmap(mapping_, mapping_size_);
+        }
+#endif
+    }
+}}    // namespace hpx::util
@@ -0,0 +1,255 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/checkpoint/checkpoint.hpp>
+#include <hpx/checkpoint/distributed_checkpoint.hpp>
+#include <hpx/checkpoint_base/checkpoint_data.hpp>
+#include <hpx/collectives/all_gather.hpp>
+#include <hpx/collectives/barrier.hpp>
+#include <hpx/collectives/broadcast.hpp>
+#include <hpx/components_base/agas_interface.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/modules/format.hpp>
+#include <hpx/serialization/serialize.hpp>
+#include <hpx/serialization/string.hpp>
+#include <hpx/serialization/vector.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <exception>
+#include <fstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace util {
+
+    namespace detail {
+
+        // the outcome of writing the part of one site
+        struct distributed_checkpoint_part
+        {
+            std::uint64_t size = 0;
+            std::string error;
+
+            friend bool operator==(distributed_checkpoint_part const& lhs,
+                distributed_checkpoint_part const& rhs)
+            {
+                return lhs.size == rhs.size && lhs.error == rhs.error;
+            }
+
+            template <typename Archive>
+            void serialize(Archive& ar, unsigned)
+            {
+                // clang-format off
+                ar & size & error;
+                // clang-format on
+            }
+        };
+    }    // namespace detail
+
+    namespace {
+
+        std::string collective_basename(std::string const& basename)
+        {
+            return "/hpx/checkpoint/distributed/" + basename;
+        }
+
+        // the index is stored in the same layout as a checkpoint holding the
+        // serialized part sizes, it is renamed into place once it was written
+        void write_index(std::string const& basename,
+            std::vector<std::uint64_t> const& sizes)
+        {
+            std::vector<char> data;
+            save_checkpoint_data(data, sizes);
+
+            std::string const filename =
+                distributed_checkpoint_index::index_filename(basename);
+            std::string const tmp_filename = filename + ".tmp";
+            {
+                std::ofstream ofs(tmp_filename, std::ios::binary);
+                ofs << checkpoint(HPX_MOVE(data));
+                ofs.close();
+                if (!ofs)
+                {
+                    std::remove(tmp_filename.c_str());
+                    HPX_THROW_EXCEPTION(filesystem_error,
+                        "hpx::util::save_distributed_checkpoint",
+                        "couldn't write the index file '{}'", tmp_filename);
+                }
+            }
+
+            if (std::rename(tmp_filename.c_str(), filename.c_str()) != 0)
+            {
+                std::remove(tmp_filename.c_str());
+                HPX_THROW_EXCEPTION(filesystem_error,
+                    "hpx::util::save_distributed_checkpoint",
+                    "couldn't rename the index file '{}' to '{}'",
+                    tmp_filename, filename);
+            }
+        }
+    }    // namespace
+
+    ///////////////////////////////////////////////////////////////////////////
+    distributed_checkpoint_index::distributed_checkpoint_index(
+        std::string const& basename)
+    {
+        std::string const filename = index_filename(basename);
+
+        std::ifstream ifs(filename, std::ios::binary);
+        checkpoint c;
+        if (ifs)
+        {
+            ifs >> c;
+        }
+        if (!ifs)
+        {
+            HPX_THROW_EXCEPTION(filesystem_error,
+                "distributed_checkpoint_index::distributed_checkpoint_index",
+                "couldn't read the index file '{}', the distributed "
+                "checkpoint '{}' doesn't exist or is incomplete",
+                filename, basename);
+        }
+
+        restore_checkpoint(c, sizes_);
+    }
+
+    std::pair<std::size_t, std::size_t>
+    distributed_checkpoint_index::parts_for_site(
+        std::size_t num_sites, std::size_t this_site) const noexcept
+    {
+        HPX_ASSERT(num_sites != 0 && this_site < num_sites);
+
+        // the first (num_parts % num_sites) sites get one more part
+        std::size_t const num_parts = sizes_.size();
+        std::size_t const block = num_parts / num_sites;
+        std::size_t const remainder = num_parts % num_sites;
+
+        std::size_t const first = this_site * block +
+            (this_site < remainder ? this_site : remainder);
+        std::size_t const last = first + block + (this_site < remainder);
+        return {first, last};
+    }
+
+    std::string distributed_checkpoint_index::part_filename(
+        std::string const& basename, std::size_t part)
+    {
+        return basename + "." + std::to_string(part) + ".chk";
+    }
+
+    std::string distributed_checkpoint_index::index_filename(
+        std::string const& basename)
+    {
+        return basename + ".index";
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    namespace detail {
+
+        distributed_checkpoint_epoch::distributed_checkpoint_epoch(
+            std::string const& basename, collectives::num_sites_arg num_sites,
+            collectives::this_site_arg this_site)
+          : basename_(basename)
+          , num_sites_(num_sites)
+          , this_site_(this_site)
+        {
+            if (num_sites_ == std::size_t(-1))
+            {
+                num_sites_ = static_cast<std::size_t>(
+                    agas::get_num_localities(hpx::launch::sync));
+            }
+            if (this_site_ == std::size_t(-1))
+            {
+                this_site_ = static_cast<std::size_t>(agas::get_locality_id());
+            }
+
+            std::string const name = collective_basename(basename_);
+            comm_ = collectives::create_communicator(name.c_str(),
+                collectives::num_sites_arg(num_sites_),
+                collectives::this_site_arg(this_site_));
+
+            // a checkpoint which is being overwritten is not complete
+            if (this_site_ == 0)
+            {
+                std::remove(
+                    distributed_checkpoint_index::index_filename(basename_)
+                        .c_str());
+            }
+
+            // all sites take their snapshot in the same epoch
+            hpx::distributed::barrier b(name + "/barrier", num_sites_,
+                this_site_);
+            b.wait();
+        }
+
+        void distributed_checkpoint_epoch::commit(
+            std::uint64_t size, std::string error)
+        {
+            std::vector<distributed_checkpoint_part> parts =
+                collectives::all_gather(comm_,
+                    distributed_checkpoint_part{size, HPX_MOVE(error)},
+                    collectives::this_site_arg(this_site_),
+                    collectives::generation_arg(1))
+                    .get();
+            HPX_ASSERT(parts.size() == num_sites_);
+
+            // all sites see the same outcome, the root site additionally
+            // reports errors while writing the index
+            std::string message;
+            if (this_site_ == 0)
+            {
+                std::vector<std::uint64_t> sizes;
+                sizes.reserve(parts.size());
+                for (std::size_t i = 0; i != parts.size(); ++i)
+                {
+                    if (!parts[i].error.empty())
+                    {
+                        message = hpx::util::format(
+                            "part {} of the distributed checkpoint '{}' "
+                            "couldn't be written: {}",
+                            i, basename_, parts[i].error);
+                        break;
+                    }
+                    sizes.push_back(parts[i].size);
+                }
+
+                if (message.empty())
+                {
+                    try
+                    {
+                        write_index(basename_, sizes);
+                    }
+                    catch (std::exception const& e)
+                    {
+                        message = e.what();
+                    }
+                }
+
+                collectives::broadcast_to(comm_, message,
+                    collectives::this_site_arg(this_site_),
+                    collectives::generation_arg(2))
+                    .get();
+            }
+            else
+            {
+                hpx::future<std::string> f =
+                    collectives::broadcast_from<std::string>(comm_,
+                        collectives::this_site_arg(this_site_),
+                        collectives::generation_arg(2));
+                message = f.get();
+            }
+
+            if (!message.empty())
+            {
+                HPX_THROW_EXCEPTION(filesystem_error,
+                    "hpx::util::save_distributed_checkpoint", "{}", message);
+            }
+        }
+    }    // namespace detail
+}}    // namespace hpx::util
@@ -0,0 +1,162 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// This test verifies that the async_checkpointer serializes snapshots of the
+// given objects in the background and limits the checkpoints in flight.
+
+#include <hpx/hpx_main.hpp>
+
+#include <hpx/checkpoint/async_checkpoint.hpp>
+#include <hpx/checkpoint/checkpoint_file.hpp>
+#include <hpx/modules/checkpoint.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/thread.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+using hpx::util::async_checkpointer;
+using hpx::util::checkpoint;
+using hpx::util::restore_checkpoint;
+using hpx::util::save_checkpoint;
+
+///////////////////////////////////////////////////////////////////////////////
+// counts the objects being serialized concurrently
+std::atomic<int> serializing(0);
+std::atomic<int> max_serializing(0);
+
+struct slow_object
+{
+    int value = 0;
+
+    template <typename Archive>
+    void serialize(Archive& ar, unsigned)
+    {
+        int const current = ++serializing;
+        int prev = max_serializing.load();
+        while (prev < current &&
+            !max_serializing.compare_exchange_weak(prev, current))
+        {
+        }
+
+        hpx::this_thread::sleep_for(std::chrono::milliseconds(10));
+
+        // clang-format off
+        ar & value;
+        // clang-format on
+        --serializing;
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+void test_snapshot()
+{
+    async_checkpointer checkpointer;
+
+    std::vector<int> state(1000, 1);
+    hpx::future<checkpoint> f = checkpointer.save(state);
+
+    // the snapshot is independent of later modifications
+    state.assign(1000, 2);
+
+    checkpoint c = f.get();
+    HPX_TEST(
+        c == save_checkpoint(hpx::launch::sync, std::vector<int>(1000, 1)));
+
+    std::vector<int> restored;
+    restore_checkpoint(c, restored);
+    HPX_TEST(restored == std::vector<int>(1000, 1));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_save_file()
+{
+    async_checkpointer checkpointer;
+
+    std::string str = "a string";
+    std::vector<double> vec(100, 3.14);
+    hpx::future<void> f =
+        checkpointer.save_file("async_checkpoint_1.chk", str, vec);
+    f.get();
+
+    std::string str2;
+    std::vector<double> vec2;
+    hpx::util::restore_checkpoint_file("async_checkpoint_1.chk", str2, vec2);
+    HPX_TEST_EQ(str, str2);
+    HPX_TEST(vec == vec2);
+
+    std::remove("async_checkpoint_1.chk");
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_back_pressure()
+{
+    {
+        async_checkpointer checkpointer(2);
+
+        std::vector<hpx::future<checkpoint>> checkpoints;
+        for (int i = 0; i != 10; ++i)
+        {
+            slow_object obj;
+            obj.value = i;
+            checkpoints.push_back(checkpointer.save(obj));
+            HPX_TEST(checkpointer.pending() <= 2);
+        }
+
+        checkpointer.wait();
+        HPX_TEST_EQ(checkpointer.pending(), std::size_t(0));
+
+        for (int i = 0; i != 10; ++i)
+        {
+            slow_object obj;
+            restore_checkpoint(checkpoints[i].get(), obj);
+            HPX_TEST_EQ(obj.value, i);
+        }
+    }
+
+    HPX_TEST(max_serializing.load() <= 2);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_exception()
+{
+    async_checkpointer checkpointer;
+
+    // the directory doesn't exist
+    hpx::future<void> f = checkpointer.save_file(
+        "async_checkpoint_does_not_exist/ckp.chk", std::vector<int>(10));
+
+    bool caught = false;
+    try
+    {
+        f.get();
+    }
+    catch (hpx::exception const& e)
+    {
+        caught = e.get_error() == hpx::filesystem_error;
+    }
+    HPX_TEST(caught);
+
+    // the checkpointer can be used after a failure
+    HPX_TEST_EQ(checkpointer.pending(), std::size_t(0));
+    HPX_TEST(
+        checkpointer.save(42).get() == save_checkpoint(hpx::launch::sync, 42));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    test_snapshot();
+    test_save_file();
+    test_back_pressure();
+    test_exception();
+
+    return hpx::util::report_errors();
+}
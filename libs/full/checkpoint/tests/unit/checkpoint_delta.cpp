@@ -0,0 +1,162 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// This test verifies that checkpoint deltas hold only the changed chunks and
+// that applying them to their base restores the original checkpoint.
+
+#include <hpx/hpx_main.hpp>
+
+#include <hpx/checkpoint/checkpoint_delta.hpp>
+#include <hpx/modules/checkpoint.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <initializer_list>
+#include <sstream>
+#include <vector>
+
+using hpx::util::apply_checkpoint_delta;
+using hpx::util::checkpoint;
+using hpx::util::checkpoint_delta;
+using hpx::util::checkpoint_manifest;
+using hpx::util::make_checkpoint_delta;
+using hpx::util::restore_checkpoint;
+using hpx::util::save_checkpoint;
+
+constexpr std::size_t chunk_size = 1024;
+
+///////////////////////////////////////////////////////////////////////////////
+void test_unchanged_chunks()
+{
+    std::vector<double> state(10000);
+    for (std::size_t i = 0; i != state.size(); ++i)
+    {
+        state[i] = static_cast<double>(i);
+    }
+
+    checkpoint base = save_checkpoint(hpx::launch::sync, state);
+    checkpoint_manifest manifest(base, chunk_size);
+    HPX_TEST_EQ(manifest.size(), base.size());
+    HPX_TEST_EQ(
+        manifest.num_chunks(), (base.size() + chunk_size - 1) / chunk_size);
+
+    // nothing changed
+    checkpoint_delta delta = make_checkpoint_delta(manifest, base);
+    HPX_TEST_EQ(delta.num_changed_chunks(), std::size_t(0));
+    HPX_TEST_EQ(delta.size(), std::size_t(0));
+    HPX_TEST(delta.manifest() == manifest);
+    HPX_TEST(apply_checkpoint_delta(base, delta) == base);
+
+    // change two values which are far apart
+    state[10] = -1.0;
+    state[9000] = -2.0;
+    checkpoint current = save_checkpoint(hpx::launch::sync, state);
+
+    delta = make_checkpoint_delta(manifest, current);
+    HPX_TEST_EQ(delta.num_changed_chunks(), std::size_t(2));
+    HPX_TEST_EQ(delta.size(), 2 * chunk_size);
+    HPX_TEST(delta.manifest() == checkpoint_manifest(current, chunk_size));
+
+    // comparing with the base checkpoint directly gives the same delta
+    HPX_TEST(make_checkpoint_delta(base, current, chunk_size) == delta);
+
+    std::vector<double> restored;
+    restore_checkpoint(apply_checkpoint_delta(base, delta), restored);
+    HPX_TEST(restored == state);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_resized()
+{
+    std::vector<char> state(5000, 'a');
+    checkpoint base = save_checkpoint(hpx::launch::sync, state);
+
+    // the first delta against an empty checkpoint holds everything
+    checkpoint_delta full = make_checkpoint_delta(checkpoint_manifest(), base);
+    HPX_TEST_EQ(full.size(), base.size());
+    HPX_TEST(apply_checkpoint_delta(checkpoint(), full) == base);
+
+    for (std::size_t size : {std::size_t(3000), std::size_t(8000)})
+    {
+        std::vector<char> resized(state);
+        resized.resize(size, 'b');
+        checkpoint current = save_checkpoint(hpx::launch::sync, resized);
+
+        checkpoint_delta delta =
+            make_checkpoint_delta(base, current, chunk_size);
+        HPX_TEST(delta.size() < current.size());
+        HPX_TEST(delta ==
+            make_checkpoint_delta(checkpoint_manifest(base, chunk_size),
+                current));
+        HPX_TEST(apply_checkpoint_delta(base, delta) == current);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_chain()
+{
+    std::vector<int> state(4096, 0);
+    checkpoint base = save_checkpoint(hpx::launch::sync, state);
+
+    // each delta is created against the manifest of the previous one
+    checkpoint_manifest manifest(base, chunk_size);
+    checkpoint restored = base;
+    for (int step = 1; step != 5; ++step)
+    {
+        state[static_cast<std::size_t>(step) * 500] = step;
+        checkpoint current = save_checkpoint(hpx::launch::sync, state);
+
+        checkpoint_delta delta = make_checkpoint_delta(manifest, current);
+        HPX_TEST_EQ(delta.num_changed_chunks(), std::size_t(1));
+
+        // round trip through a stream
+        std::stringstream strm;
+        strm << delta;
+        checkpoint_delta read;
+        strm >> read;
+        HPX_TEST(read == delta);
+
+        restored = apply_checkpoint_delta(restored, read);
+        HPX_TEST(restored == current);
+        manifest = delta.manifest();
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_wrong_base()
+{
+    std::vector<int> state(4096, 0);
+    checkpoint base = save_checkpoint(hpx::launch::sync, state);
+
+    state[0] = 1;
+    checkpoint current = save_checkpoint(hpx::launch::sync, state);
+    checkpoint_delta delta = make_checkpoint_delta(base, current, chunk_size);
+
+    state[4000] = 1;
+    checkpoint other = save_checkpoint(hpx::launch::sync, state);
+
+    bool caught = false;
+    try
+    {
+        apply_checkpoint_delta(other, delta);
+    }
+    catch (hpx::exception const& e)
+    {
+        caught = e.get_error() == hpx::invalid_data;
+    }
+    HPX_TEST(caught);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    test_unchanged_chunks();
+    test_resized();
+    test_chain();
+    test_wrong_base();
+
+    return hpx::util::report_errors();
+}
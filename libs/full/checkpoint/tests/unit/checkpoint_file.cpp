@@ -0,0 +1,133 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// This test verifies that save_checkpoint_file and restore_checkpoint_file
+// produce and consume the same file layout as operator<< and operator>>.
+
+#include <hpx/hpx_main.hpp>
+
+#include <hpx/checkpoint/checkpoint_file.hpp>
+#include <hpx/modules/checkpoint.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+using hpx::util::checkpoint;
+using hpx::util::restore_checkpoint;
+using hpx::util::restore_checkpoint_file;
+using hpx::util::save_checkpoint;
+using hpx::util::save_checkpoint_file;
+
+///////////////////////////////////////////////////////////////////////////////
+void test_save_restore()
+{
+    int integer = 42;
+    std::string str = "I am a string of characters";
+    std::vector<double> vec(1000, 3.14);
+
+    save_checkpoint_file("checkpoint_file_1.chk", integer, str, vec).get();
+
+    int integer2 = 0;
+    std::string str2;
+    std::vector<double> vec2;
+    restore_checkpoint_file("checkpoint_file_1.chk", integer2, str2, vec2);
+
+    HPX_TEST_EQ(integer, integer2);
+    HPX_TEST_EQ(str, str2);
+    HPX_TEST(vec == vec2);
+
+    // the file can be read into a checkpoint as well
+    checkpoint archive;
+    std::ifstream ifs("checkpoint_file_1.chk", std::ios::binary);
+    ifs >> archive;
+    ifs.close();
+
+    HPX_TEST(archive == save_checkpoint(hpx::launch::sync, integer, str, vec));
+
+    std::remove("checkpoint_file_1.chk");
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_restore_from_stream()
+{
+    std::vector<int> vec(100);
+    for (std::size_t i = 0; i != vec.size(); ++i)
+    {
+        vec[i] = static_cast<int>(i);
+    }
+
+    std::ofstream ofs("checkpoint_file_2.chk", std::ios::binary);
+    ofs << save_checkpoint(hpx::launch::sync, vec);
+    ofs.close();
+
+    std::vector<int> vec2;
+    restore_checkpoint_file("checkpoint_file_2.chk", vec2);
+    HPX_TEST(vec == vec2);
+
+    std::remove("checkpoint_file_2.chk");
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_small_buffers()
+{
+    // more data than buffers, and objects larger than a buffer
+    std::vector<std::string> strings;
+    for (int i = 0; i != 100; ++i)
+    {
+        strings.emplace_back(static_cast<std::size_t>(i) * 7, 'a' + i % 26);
+    }
+    std::vector<char> large(1000, 'x');
+
+    {
+        hpx::util::checkpoint_file_writer writer(
+            "checkpoint_file_3.chk", 64, 2);
+        hpx::util::save_checkpoint_data(writer, strings, large);
+        writer.close();
+
+        HPX_TEST_EQ(writer.size(),
+            save_checkpoint(hpx::launch::sync, strings, large).size());
+    }
+
+    std::vector<std::string> strings2;
+    std::vector<char> large2;
+    restore_checkpoint_file("checkpoint_file_3.chk", strings2, large2);
+
+    HPX_TEST(strings == strings2);
+    HPX_TEST(large == large2);
+
+    std::remove("checkpoint_file_3.chk");
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_invalid_file()
+{
+    bool caught = false;
+    try
+    {
+        std::vector<int> vec;
+        restore_checkpoint_file("checkpoint_file_does_not_exist.chk", vec);
+    }
+    catch (hpx::exception const& e)
+    {
+        caught = e.get_error() == hpx::filesystem_error;
+    }
+    HPX_TEST(caught);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    test_save_restore();
+    test_restore_from_stream();
+    test_small_buffers();
+    test_invalid_file();
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,207 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// This test verifies that all localities can save a distributed checkpoint
+// and that its parts can be restored by any number of sites.
+
+#include <hpx/hpx_main.hpp>
+
+#include <hpx/checkpoint/distributed_checkpoint.hpp>
+#include <hpx/modules/checkpoint.hpp>
+#include <hpx/modules/collectives.hpp>
+#include <hpx/modules/runtime_distributed.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <utility>
+#include <vector>
+
+using hpx::util::distributed_checkpoint_index;
+using hpx::util::restore_distributed_checkpoint;
+using hpx::util::save_distributed_checkpoint;
+
+///////////////////////////////////////////////////////////////////////////////
+std::vector<double> make_state(std::size_t site)
+{
+    std::vector<double> state(1000 + site * 100);
+    for (std::size_t i = 0; i != state.size(); ++i)
+    {
+        state[i] = static_cast<double>(site * 10000 + i);
+    }
+    return state;
+}
+
+void remove_checkpoint(std::string const& basename, std::size_t num_parts)
+{
+    for (std::size_t part = 0; part != num_parts; ++part)
+    {
+        std::remove(
+            distributed_checkpoint_index::part_filename(basename, part)
+                .c_str());
+    }
+    std::remove(distributed_checkpoint_index::index_filename(basename).c_str());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_save_restore()
+{
+    std::size_t const num_localities =
+        hpx::get_num_localities(hpx::launch::sync);
+    std::size_t const here = hpx::get_locality_id();
+
+    std::string const basename = "distributed_checkpoint_1";
+    std::string const name = "step 42";
+    std::vector<double> state = make_state(here);
+
+    save_distributed_checkpoint(basename, name, state).get();
+
+    // every site restores its own part
+    std::string name2;
+    std::vector<double> state2;
+    restore_distributed_checkpoint(basename, here, name2, state2);
+    HPX_TEST_EQ(name, name2);
+    HPX_TEST(state == state2);
+
+    distributed_checkpoint_index index(basename);
+    HPX_TEST_EQ(index.num_parts(), num_localities);
+
+    if (here == 0)
+    {
+        // restore on a single site, which reads all parts
+        auto parts = index.parts_for_site(1, 0);
+        HPX_TEST_EQ(parts.first, std::size_t(0));
+        HPX_TEST_EQ(parts.second, num_localities);
+
+        for (std::size_t part = parts.first; part != parts.second; ++part)
+        {
+            std::vector<double> state3;
+            restore_distributed_checkpoint(basename, part, name2, state3);
+            HPX_TEST(state3 == make_state(part));
+        }
+
+        // invalid parts are reported
+        bool caught = false;
+        try
+        {
+            restore_distributed_checkpoint(
+                basename, num_localities, name2, state2);
+        }
+        catch (hpx::exception const& e)
+        {
+            caught = e.get_error() == hpx::bad_parameter;
+        }
+        HPX_TEST(caught);
+    }
+
+    hpx::distributed::barrier::synchronize();
+    if (here == 0)
+    {
+        remove_checkpoint(basename, num_localities);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_parts_for_site()
+{
+    std::size_t const here = hpx::get_locality_id();
+    std::string const basename = "distributed_checkpoint_2";
+
+    std::vector<std::vector<int>> parts;
+    for (std::size_t site = 0; site != 5; ++site)
+    {
+        parts.emplace_back(10, static_cast<int>(site));
+    }
+
+    // all sites of a checkpoint may be run on the same locality
+    if (here == 0)
+    {
+        std::vector<hpx::future<void>> saved;
+        for (std::size_t site = 0; site != 5; ++site)
+        {
+            saved.push_back(save_distributed_checkpoint(basename,
+                hpx::collectives::num_sites_arg(5),
+                hpx::collectives::this_site_arg(site), parts[site]));
+        }
+        for (auto& f : saved)
+        {
+            f.get();
+        }
+
+        distributed_checkpoint_index index(basename);
+        HPX_TEST_EQ(index.num_parts(), std::size_t(5));
+
+        // restore onto 3 sites
+        std::size_t next = 0;
+        std::vector<std::pair<std::size_t, std::size_t>> expected = {
+            {0, 2}, {2, 4}, {4, 5}};
+        for (std::size_t site = 0; site != 3; ++site)
+        {
+            auto range = index.parts_for_site(3, site);
+            HPX_TEST(range == expected[site]);
+            HPX_TEST_EQ(range.first, next);
+            next = range.second;
+
+            for (std::size_t part = range.first; part != range.second; ++part)
+            {
+                std::vector<int> restored;
+                restore_distributed_checkpoint(basename, part, restored);
+                HPX_TEST(restored == parts[part]);
+            }
+        }
+        HPX_TEST_EQ(next, std::size_t(5));
+
+        // restore onto more sites than parts
+        HPX_TEST(index.parts_for_site(8, 6) ==
+            std::make_pair(std::size_t(5), std::size_t(5)));
+
+        remove_checkpoint(basename, 5);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_failed_save()
+{
+    std::size_t const here = hpx::get_locality_id();
+
+    // the directory doesn't exist, all sites report the error
+    std::string const basename = "distributed_checkpoint_does_not_exist/ckp";
+
+    bool caught = false;
+    try
+    {
+        save_distributed_checkpoint(basename, make_state(here)).get();
+    }
+    catch (hpx::exception const& e)
+    {
+        caught = e.get_error() == hpx::filesystem_error;
+    }
+    HPX_TEST(caught);
+
+    // the checkpoint is not complete
+    caught = false;
+    try
+    {
+        distributed_checkpoint_index index(basename);
+    }
+    catch (hpx::exception const& e)
+    {
+        caught = e.get_error() == hpx::filesystem_error;
+    }
+    HPX_TEST(caught);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    test_save_restore();
+    test_parts_for_site();
+    test_failed_save();
+
+    return hpx::util::report_errors();
+}
@@ -105,6 +105,40 @@ namespace hpx { namespace collectives {
     all_gather(communicator comm, T&& result,
         generation_arg generation,
         this_site_arg this_site = this_site_arg());
+
+    /// AllGather a set of values from different call sites
+    ///
+    /// This function collects the values from all call sites using point to
+    /// point messages only, no single site has to receive the values of all
+    /// other sites.
+    ///
+    /// \param  comm        A channel communicator object returned from
+    ///                     \a create_channel_communicator
+    /// \param  local_result The value to transmit to all
+    ///                     participating sites from this call site.
+    /// \param  generation  The generational counter identifying the sequence
+    ///                     number of the all_gather operation performed on the
+    ///                     given communicator. This is optional and needs to be
+    ///                     supplied only if the all_gather operation on the
+    ///                     given communicator has to be performed more than
+    ///                     once. The generation number (if given) must be a
+    ///                     positive number greater than zero.
+    /// \param  algorithm   The algorithm used to distribute the values, either
+    ///                     collective_algorithm::recursive_doubling (requires
+    ///                     the number of sites to be a power of two) or
+    ///                     collective_algorithm::ring. By default recursive
+    ///                     doubling is used for small values if possible, the
+    ///                     ring otherwise.
+    ///
+    /// \returns    This function returns a future holding a vector with all
+    ///             values send by all participating sites. It will become
+    ///             ready once the all_gather operation has been completed.
+    ///
+    template <typename T>
+    hpx::future<std::vector<std::decay_t<T>>>
+    all_gather(channel_communicator comm, T&& result,
+        generation_arg generation = generation_arg(),
+        algorithm_arg algorithm = algorithm_arg());
 }}    // namespace hpx::collectives
 
 // clang-format on
@@ -117,7 +151,9 @@ namespace hpx { namespace collectives {
 #include <hpx/async_base/launch_policy.hpp>
 #include <hpx/async_distributed/async.hpp>
 #include <hpx/collectives/argument_types.hpp>
+#include <hpx/collectives/channel_communicator.hpp>
 #include <hpx/collectives/create_communicator.hpp>
+#include <hpx/collectives/detail/channel_algorithms.hpp>
 #include <hpx/components_base/agas_interface.hpp>
 #include <hpx/futures/future.hpp>
 #include <hpx/type_support/unused.hpp>
@@ -221,6 +257,59 @@ namespace hpx { namespace collectives {
                               generation, root_site),
             HPX_FORWARD(T, local_result), this_site);
     }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // all_gather based on point-to-point communication
+    template <typename T>
+    hpx::future<std::vector<std::decay_t<T>>> all_gather(
+        channel_communicator comm, T&& local_result,
+        generation_arg generation = generation_arg(),
+        algorithm_arg algorithm = algorithm_arg())
+    {
+        using arg_type = std::decay_t<T>;
+
+        if (generation == 0)
+        {
+            return hpx::make_exceptional_future<std::vector<arg_type>>(
+                HPX_GET_EXCEPTION(hpx::bad_parameter,
+                    "hpx::collectives::all_gather",
+                    "the generation number shouldn't be zero"));
+        }
+
+        std::size_t const num_sites = comm.get_info().first;
+        if (algorithm == collective_algorithm::automatic)
+        {
+            algorithm = detail::is_power_of_two(num_sites) &&
+                    num_sites * detail::payload_size(local_result) <=
+                        detail::all_gather_small_payload ?
+                collective_algorithm::recursive_doubling :
+                collective_algorithm::ring;
+        }
+
+        if (algorithm == collective_algorithm::binomial_tree ||
+            (algorithm == collective_algorithm::recursive_doubling &&
+                !detail::is_power_of_two(num_sites)))
+        {
+            return hpx::make_exceptional_future<std::vector<arg_type>>(
+                HPX_GET_EXCEPTION(hpx::bad_parameter,
+                    "hpx::collectives::all_gather",
+                    "the requested algorithm is not supported by all_gather "
+                    "for the given number of sites"));
+        }
+
+        return hpx::async([comm = HPX_MOVE(comm),
+                              local_result = HPX_FORWARD(T, local_result),
+                              generation,
+                              algorithm]() mutable -> std::vector<arg_type> {
+            if (algorithm == collective_algorithm::ring)
+            {
+                return detail::all_gather_ring(
+                    HPX_MOVE(comm), HPX_MOVE(local_result), generation);
+            }
+            return detail::all_gather_recursive_doubling(
+                HPX_MOVE(comm), HPX_MOVE(local_result), generation);
+        });
+    }
 }}    // namespace hpx::collectives
 
 ////////////////////////////////////////////////////////////////////////////////
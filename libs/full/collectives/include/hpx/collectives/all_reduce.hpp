@@ -110,6 +110,43 @@ namespace hpx { namespace collectives {
     all_reduce(communicator comm,
         T&& result, F&& op, generation_arg generation,
         this_site_arg this_site = this_site_arg());
+
+    /// AllReduce a set of values from different call sites
+    ///
+    /// This function combines the values from all call sites using point to
+    /// point messages only, no single site has to receive the values of all
+    /// other sites.
+    ///
+    /// \param  comm        A channel communicator object returned from
+    ///                     \a create_channel_communicator
+    /// \param  local_result The value to transmit to all
+    ///                     participating sites from this call site.
+    /// \param  op          Reduction operation to apply to all values supplied
+    ///                     from all participating sites. The operation has to
+    ///                     be associative and commutative.
+    /// \param  generation  The generational counter identifying the sequence
+    ///                     number of the all_reduce operation performed on the
+    ///                     given communicator. This is optional and needs to be
+    ///                     supplied only if the all_reduce operation on the
+    ///                     given communicator has to be performed more than
+    ///                     once. The generation number (if given) must be a
+    ///                     positive number greater than zero.
+    /// \param  algorithm   The algorithm used to combine the values, either
+    ///                     collective_algorithm::recursive_doubling or
+    ///                     collective_algorithm::binomial_tree. By default an
+    ///                     algorithm is selected based on the size of the
+    ///                     values: recursive doubling finishes in fewer steps,
+    ///                     the binomial tree sends fewer messages overall.
+    ///
+    /// \returns    This function returns a future holding the reduced value.
+    ///             It will become ready once the all_reduce operation has
+    ///             been completed.
+    ///
+    template <typename T, typename F>
+    hpx::future<std::decay_t<T>>
+    all_reduce(channel_communicator comm,
+        T&& result, F&& op, generation_arg generation = generation_arg(),
+        algorithm_arg algorithm = algorithm_arg());
 }}    // namespace hpx::collectives
 
 // clang-format on
@@ -123,7 +160,10 @@ namespace hpx { namespace collectives {
 #include <hpx/async_base/launch_policy.hpp>
 #include <hpx/async_distributed/async.hpp>
 #include <hpx/collectives/argument_types.hpp>
+#include <hpx/collectives/channel_communicator.hpp>
 #include <hpx/collectives/create_communicator.hpp>
+#include <hpx/collectives/detail/channel_algorithms.hpp>
+#include <hpx/collectives/detail/reduce_in_place.hpp>
 #include <hpx/components_base/agas_interface.hpp>
 #include <hpx/futures/future.hpp>
 #include <hpx/parallel/algorithms/reduce.hpp>
@@ -148,6 +188,40 @@ namespace hpx { namespace traits {
         template <typename Result, typename T, typename F>
         static Result get(Communicator& communicator, std::size_t which,
             std::size_t generation, T&& t, F&& op)
+        {
+            if constexpr (collectives::detail::is_in_place_reduction_v<T, F>)
+            {
+                // accumulate each contribution into a single buffer
+                return communicator.template handle_data<std::decay_t<T>>(
+                    which, generation,
+                    // step function (invoked for each get)
+                    [&](auto& data) {
+                        if (data[0].empty())
+                        {
+                            data[0] = HPX_FORWARD(T, t);
+                        }
+                        else
+                        {
+                            collectives::detail::reduce_in_place<F>(data[0], t);
+                        }
+                    },
+                    // finalizer (invoked after all data has been received)
+                    [](auto& data, bool&) {
+                        return Communicator::template handle_bool<
+                            std::decay_t<T>>(data[0]);
+                    },
+                    1);
+            }
+            else
+            {
+                return get_generic<Result>(communicator, which, generation,
+                    HPX_FORWARD(T, t), HPX_FORWARD(F, op));
+            }
+        }
+
+        template <typename Result, typename T, typename F>
+        static Result get_generic(Communicator& communicator,
+            std::size_t which, std::size_t generation, T&& t, F&& op)
         {
             return communicator.template handle_data<std::decay_t<T>>(
                 which, generation,
@@ -240,6 +314,50 @@ namespace hpx { namespace collectives {
                               generation, root_site),
             HPX_FORWARD(T, local_result), HPX_FORWARD(F, op), this_site);
     }
+
+    ////////////////////////////////////////////////////////////////////////////
+    // all_reduce based on point-to-point communication
+    template <typename T, typename F>
+    hpx::future<std::decay_t<T>> all_reduce(channel_communicator comm,
+        T&& local_result, F&& op, generation_arg generation = generation_arg(),
+        algorithm_arg algorithm = algorithm_arg())
+    {
+        using arg_type = std::decay_t<T>;
+
+        if (generation == 0)
+        {
+            return hpx::make_exceptional_future<arg_type>(HPX_GET_EXCEPTION(
+                hpx::bad_parameter, "hpx::collectives::all_reduce",
+                "the generation number shouldn't be zero"));
+        }
+        if (algorithm == collective_algorithm::ring)
+        {
+            return hpx::make_exceptional_future<arg_type>(HPX_GET_EXCEPTION(
+                hpx::bad_parameter, "hpx::collectives::all_reduce",
+                "the ring algorithm is not supported by all_reduce"));
+        }
+
+        if (algorithm == collective_algorithm::automatic)
+        {
+            algorithm = detail::payload_size(local_result) <=
+                    detail::all_reduce_small_payload ?
+                collective_algorithm::recursive_doubling :
+                collective_algorithm::binomial_tree;
+        }
+
+        return hpx::async([comm = HPX_MOVE(comm),
+                              local_result = HPX_FORWARD(T, local_result),
+                              op = HPX_FORWARD(F, op), generation,
+                              algorithm]() mutable -> arg_type {
+            if (algorithm == collective_algorithm::binomial_tree)
+            {
+                return detail::all_reduce_binomial_tree(
+                    HPX_MOVE(comm), HPX_MOVE(local_result), op, generation);
+            }
+            return detail::all_reduce_recursive_doubling(
+                HPX_MOVE(comm), HPX_MOVE(local_result), op, generation);
+        });
+    }
 }}    // namespace hpx::collectives
 
 ////////////////////////////////////////////////////////////////////////////////
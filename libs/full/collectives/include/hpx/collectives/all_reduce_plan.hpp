@@ -0,0 +1,215 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file all_reduce_plan.hpp
+
+#pragma once
+
+#if defined(DOXYGEN)
+// clang-format off
+namespace hpx { namespace collectives {
+
+    /// Create a plan for repeatedly invoking all_reduce with values of the
+    /// same shape
+    ///
+    /// The plan computes the sequence of messages exchanged by this site and
+    /// resolves the addresses of the sites it communicates with once. Every
+    /// invocation of the plan only moves the data.
+    ///
+    /// \param  comm        A communicator object returned from
+    ///                     \a create_channel_communicator
+    /// \param  value       A value of the same shape (for instance, of the
+    ///                     same size) as the values the plan will be invoked
+    ///                     with.
+    /// \param  op          Reduction operation to apply to all values supplied
+    ///                     from all participating sites
+    /// \param  generation  The generational counter used for the first
+    ///                     invocation of the plan. Every invocation uses the
+    ///                     next generation (optional, the first invocation
+    ///                     uses the generation one otherwise). The
+    ///                     generations used by a plan must not be used by
+    ///                     other operations on the same communicator.
+    /// \param  algorithm   The algorithm to use, either
+    ///                     \a collective_algorithm::recursive_doubling or
+    ///                     \a collective_algorithm::binomial_tree. It is
+    ///                     selected based on the size of \a value otherwise.
+    ///
+    /// \returns    This function returns a future holding the plan. It
+    ///             becomes ready once all sites this site communicates with
+    ///             were resolved.
+    ///
+    template <typename T, typename F>
+    hpx::future<all_reduce_plan<std::decay_t<T>, std::decay_t<F>>>
+    create_all_reduce_plan(channel_communicator comm, T const& value, F&& op,
+        generation_arg generation = generation_arg(),
+        algorithm_arg algorithm = algorithm_arg());
+
+    /// AllReduce a set of values from different call sites using a plan
+    ///
+    /// \param  plan        A plan returned from \a create_all_reduce_plan
+    /// \param  local_result The value to transmit to all participating sites
+    ///                     from this call site. It must have the same shape
+    ///                     as the value the plan was created with.
+    ///
+    /// \returns    This function returns a future holding the reduced value.
+    ///
+    template <typename T, typename F>
+    hpx::future<T> all_reduce(all_reduce_plan<T, F> const& plan,
+        T local_result);
+}}    // namespace hpx::collectives
+
+// clang-format on
+#else
+
+#include <hpx/config.hpp>
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+
+#include <hpx/async_base/launch_policy.hpp>
+#include <hpx/async_distributed/async.hpp>
+#include <hpx/collectives/argument_types.hpp>
+#include <hpx/collectives/channel_communicator.hpp>
+#include <hpx/collectives/detail/channel_algorithms.hpp>
+#include <hpx/collectives/detail/collective_schedule.hpp>
+#include <hpx/futures/future.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace hpx { namespace collectives {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // A plan holds everything that does not change in between invocations of
+    // all_reduce with values of the same shape: the schedule of messages,
+    // the algorithm, and the reduction operation.
+    template <typename T, typename F>
+    class all_reduce_plan
+    {
+    private:
+        struct plan_data
+        {
+            plan_data(channel_communicator&& comm, F&& op,
+                detail::collective_schedule&& schedule,
+                std::size_t payload_size, std::size_t generation)
+              : comm_(HPX_MOVE(comm))
+              , op_(HPX_MOVE(op))
+              , schedule_(HPX_MOVE(schedule))
+              , payload_size_(payload_size)
+              , generation_(generation)
+            {
+            }
+
+            channel_communicator comm_;
+            F op_;
+            detail::collective_schedule schedule_;
+            std::size_t payload_size_;
+            std::atomic<std::size_t> generation_;
+        };
+
+    public:
+        all_reduce_plan() = default;
+
+        all_reduce_plan(channel_communicator comm, F op,
+            detail::collective_schedule schedule, std::size_t payload_size,
+            std::size_t generation)
+          : data_(std::make_shared<plan_data>(HPX_MOVE(comm), HPX_MOVE(op),
+                HPX_MOVE(schedule), payload_size, generation))
+        {
+        }
+
+        hpx::future<T> operator()(T local_result) const
+        {
+            if (detail::payload_size(local_result) != data_->payload_size_)
+            {
+                return hpx::make_exceptional_future<T>(HPX_GET_EXCEPTION(
+                    hpx::bad_parameter, "hpx::collectives::all_reduce",
+                    "the value does not have the shape the plan was "
+                    "created for"));
+            }
+
+            std::size_t const generation = data_->generation_++;
+            return hpx::async(
+                [data = data_, local_result = HPX_MOVE(local_result),
+                    generation]() mutable -> T {
+                    std::size_t const tag_base = detail::get_tag_base(
+                        data->comm_.get_info().first, generation);
+                    return detail::run_schedule(data->comm_, data->schedule_,
+                        HPX_MOVE(local_result), data->op_, tag_base);
+                });
+        }
+
+        channel_communicator const& communicator() const noexcept
+        {
+            return data_->comm_;
+        }
+
+    private:
+        std::shared_ptr<plan_data> data_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T, typename F>
+    hpx::future<all_reduce_plan<std::decay_t<T>, std::decay_t<F>>>
+    create_all_reduce_plan(channel_communicator comm, T const& value, F&& op,
+        generation_arg generation = generation_arg(),
+        algorithm_arg algorithm = algorithm_arg())
+    {
+        using plan_type = all_reduce_plan<std::decay_t<T>, std::decay_t<F>>;
+
+        if (generation == 0)
+        {
+            return hpx::make_exceptional_future<plan_type>(HPX_GET_EXCEPTION(
+                hpx::bad_parameter, "hpx::collectives::create_all_reduce_plan",
+                "the generation number shouldn't be zero"));
+        }
+        if (algorithm == collective_algorithm::ring)
+        {
+            return hpx::make_exceptional_future<plan_type>(HPX_GET_EXCEPTION(
+                hpx::bad_parameter, "hpx::collectives::create_all_reduce_plan",
+                "the ring algorithm is not supported by all_reduce"));
+        }
+
+        std::size_t const payload_size = detail::payload_size(value);
+        if (algorithm == collective_algorithm::automatic)
+        {
+            algorithm = payload_size <= detail::all_reduce_small_payload ?
+                collective_algorithm::recursive_doubling :
+                collective_algorithm::binomial_tree;
+        }
+
+        auto [num_sites, this_site] = comm.get_info();
+        detail::collective_schedule schedule =
+            detail::make_all_reduce_schedule(num_sites, this_site, algorithm);
+
+        hpx::future<void> resolved =
+            comm.resolve(detail::get_schedule_partners(schedule));
+
+        std::size_t const first_generation =
+            generation == std::size_t(-1) ? 1 : generation.generation_;
+
+        return resolved.then(hpx::launch::sync,
+            [comm = HPX_MOVE(comm), op = HPX_FORWARD(F, op),
+                schedule = HPX_MOVE(schedule), payload_size,
+                first_generation](hpx::future<void>&& f) mutable {
+                f.get();    // propagate exceptions
+                return plan_type(HPX_MOVE(comm), HPX_MOVE(op),
+                    HPX_MOVE(schedule), payload_size, first_generation);
+            });
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T, typename F>
+    hpx::future<T> all_reduce(all_reduce_plan<T, F> const& plan, T local_result)
+    {
+        return plan(HPX_MOVE(local_result));
+    }
+}}    // namespace hpx::collectives
+
+#endif    // !HPX_COMPUTE_DEVICE_CODE
+#endif    // DOXYGEN
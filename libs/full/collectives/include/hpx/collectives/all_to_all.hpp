@@ -105,6 +105,36 @@ namespace hpx { namespace collectives {
     all_to_all(communicator comm, T&& result,
         generation_arg generation,
         this_site_arg this_site = this_site_arg());
+
+    /// AllToAll a set of values from different call sites
+    ///
+    /// This function exchanges the values directly between all pairs of
+    /// sites using point to point messages only, no single site has to
+    /// receive the values of all other sites. The pairs are scheduled such
+    /// that every site receives a single value at a time.
+    ///
+    /// \param  comm        A channel communicator object returned from
+    ///                     \a create_channel_communicator
+    /// \param  local_result The values to transmit to all participating
+    ///                     sites from this call site, the value at index
+    ///                     \a i is sent to site \a i.
+    /// \param  generation  The generational counter identifying the sequence
+    ///                     number of the all_to_all operation performed on the
+    ///                     given communicator. This is optional and needs to be
+    ///                     supplied only if the all_to_all operation on the
+    ///                     given communicator has to be performed more than
+    ///                     once. The generation number (if given) must be a
+    ///                     positive number greater than zero.
+    ///
+    /// \returns    This function returns a future holding a vector with all
+    ///             values send to this site by all participating sites. It
+    ///             will become ready once the all_to_all operation has been
+    ///             completed.
+    ///
+    template <typename T>
+    hpx::future<std::vector<T>>
+    all_to_all(channel_communicator comm, std::vector<T>&& local_result,
+        generation_arg generation = generation_arg());
 }}    // namespace hpx::collectives
 
 // clang-format on
@@ -117,7 +147,9 @@ namespace hpx { namespace collectives {
 #include <hpx/async_base/launch_policy.hpp>
 #include <hpx/async_distributed/async.hpp>
 #include <hpx/collectives/argument_types.hpp>
+#include <hpx/collectives/channel_communicator.hpp>
 #include <hpx/collectives/create_communicator.hpp>
+#include <hpx/collectives/detail/channel_algorithms.hpp>
 #include <hpx/components_base/agas_interface.hpp>
 #include <hpx/futures/future.hpp>
 #include <hpx/type_support/unused.hpp>
@@ -230,6 +262,38 @@ namespace hpx { namespace collectives {
                               generation, root_site),
             HPX_MOVE(local_result), this_site);
     }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // all_to_all based on point-to-point communication
+    template <typename T>
+    hpx::future<std::vector<T>> all_to_all(channel_communicator comm,
+        std::vector<T>&& local_result,
+        generation_arg generation = generation_arg())
+    {
+        if (generation == 0)
+        {
+            return hpx::make_exceptional_future<std::vector<T>>(
+                HPX_GET_EXCEPTION(hpx::bad_parameter,
+                    "hpx::collectives::all_to_all",
+                    "the generation number shouldn't be zero"));
+        }
+
+        if (local_result.size() != comm.get_info().first)
+        {
+            return hpx::make_exceptional_future<std::vector<T>>(
+                HPX_GET_EXCEPTION(hpx::bad_parameter,
+                    "hpx::collectives::all_to_all",
+                    "the number of values has to be equal to the number of "
+                    "sites"));
+        }
+
+        return hpx::async([comm = HPX_MOVE(comm),
+                              local_result = HPX_MOVE(local_result),
+                              generation]() mutable -> std::vector<T> {
+            return detail::all_to_all_pairwise(
+                HPX_MOVE(comm), HPX_MOVE(local_result), generation);
+        });
+    }
 }}    // namespace hpx::collectives
 
 ////////////////////////////////////////////////////////////////////////////////
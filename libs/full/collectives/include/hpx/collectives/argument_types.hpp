@@ -145,4 +145,71 @@ namespace hpx { namespace collectives {
 
         std::size_t tag_;
     };
+
+    /// The algorithm used by the collective operations that are implemented
+    /// on top of a \a channel_communicator.
+    enum class collective_algorithm
+    {
+        /// Select an algorithm based on the number of sites and the size of
+        /// the values that are exchanged
+        automatic = 0,
+        /// Combine values along a binomial tree rooted at site zero and
+        /// broadcast the result back down the same tree
+        binomial_tree = 1,
+        /// Exchange values pairwise with sites at doubling distances
+        recursive_doubling = 2,
+        /// Pass values around a ring of all sites
+        ring = 3,
+        /// Forward values along a chain of all sites starting at the root
+        chain = 4,
+        /// Forward values along a binary tree rooted at the root site
+        binary_tree = 5
+    };
+
+    struct algorithm_arg
+    {
+        explicit constexpr algorithm_arg(
+            collective_algorithm algorithm =
+                collective_algorithm::automatic) noexcept
+          : algorithm_(algorithm)
+        {
+        }
+
+        constexpr algorithm_arg& operator=(
+            collective_algorithm algorithm) noexcept
+        {
+            algorithm_ = algorithm;
+            return *this;
+        }
+
+        constexpr operator collective_algorithm() const noexcept
+        {
+            return algorithm_;
+        }
+
+        collective_algorithm algorithm_;
+    };
+
+    struct segment_size_arg
+    {
+        explicit constexpr segment_size_arg(
+            std::size_t segment_size = std::size_t(-1)) noexcept
+          : segment_size_(segment_size)
+        {
+        }
+
+        constexpr segment_size_arg& operator=(
+            std::size_t segment_size) noexcept
+        {
+            segment_size_ = segment_size;
+            return *this;
+        }
+
+        constexpr operator std::size_t() const noexcept
+        {
+            return segment_size_;
+        }
+
+        std::size_t segment_size_;
+    };
 }}    // namespace hpx::collectives
@@ -16,6 +16,7 @@
 #include <hpx/modules/memory.hpp>
 
 #include <cstddef>
+#include <memory>
 #include <string>
 #include <utility>
 #include <vector>
@@ -28,9 +29,26 @@ namespace hpx::distributed {
     namespace detail {
 
         struct barrier_node;
+        class barrier_local_step;
+        class point_to_point_barrier;
     }
     /// \endcond
 
+    /// The algorithms a barrier can use to synchronize its participants
+    enum class barrier_algorithm
+    {
+        /// The participants notify a root through a tree of barrier nodes,
+        /// which in turn releases all participants (default).
+        tree = 0,
+        /// Every participant notifies the participant at distance 1, 2, 4,
+        /// ... and waits for the notification of the one at the same
+        /// negative distance (ceil(log2(num)) rounds).
+        dissemination = 1,
+        /// The participants are paired in ceil(log2(num)) rounds, the winner
+        /// of the final round releases the others along the same tree.
+        tournament = 2
+    };
+
     /// The barrier is an implementation performing a barrier over a number of
     /// participating threads. The different threads don't have to be on the
     /// same locality. This barrier can be invoked in a distributed application.
@@ -85,6 +103,24 @@ namespace hpx::distributed {
         barrier(std::string const& base_name,
             std::vector<std::size_t> const& ranks, std::size_t rank);
 
+        /// Creates a barrier with a given size and rank using the given
+        /// algorithm
+        ///
+        /// \param base_name The name of the barrier
+        /// \param num The number of participating sites
+        /// \param rank The rank of the calling site for this invocation
+        /// \param algorithm The algorithm used to synchronize the sites
+        /// \param num_local_participants The number of threads invoking
+        ///              \a wait on this barrier object for every invocation
+        ///              of the barrier. The last of those threads entering
+        ///              the barrier synchronizes with the other sites.
+        ///
+        /// A barrier \a base_name is created. It expects that
+        /// \a num participate and the local rank is \a rank.
+        barrier(std::string const& base_name, std::size_t num,
+            std::size_t rank, barrier_algorithm algorithm,
+            std::size_t num_local_participants = 1);
+
         /// \cond NOINTERNAL
         barrier(barrier&& other);
         barrier& operator=(barrier&& other);
@@ -130,7 +166,11 @@ namespace hpx::distributed {
         /// \cond NOINTERNAL
         barrier();
 
+        hpx::future<void> wait_all_sites(bool async);
+
         hpx::intrusive_ptr<wrapping_type> node_;
+        std::shared_ptr<detail::point_to_point_barrier> point_to_point_;
+        std::shared_ptr<detail::barrier_local_step> local_step_;
         /// \endcond
     };
 }    // namespace hpx::distributed
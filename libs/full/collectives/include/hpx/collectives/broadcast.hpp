@@ -185,6 +185,71 @@ namespace hpx { namespace collectives {
     hpx::future<T> broadcast_from(communicator comm,
         generation_arg generation,
         this_site_arg this_site = this_site_arg());
+
+    /// Broadcast a large buffer to different call sites
+    ///
+    /// This function sends the given buffer to all call sites of the given
+    /// channel communicator. The buffer is split into segments which are
+    /// forwarded by every site as soon as they have been received, thus the
+    /// root site sends the data only once (chain) or twice (binary tree).
+    ///
+    /// \param  comm        A channel communicator object returned from
+    ///                     \a create_channel_communicator
+    /// \param  buffer      The data to transmit to all participating sites.
+    ///                     The data is not copied.
+    /// \param  generation  The generational counter identifying the sequence
+    ///                     number of the broadcast operation performed on the
+    ///                     given communicator. This is optional and needs to be
+    ///                     supplied only if the broadcast operation on the
+    ///                     given communicator has to be performed more than
+    ///                     once. The generation number (if given) must be a
+    ///                     positive number greater than zero.
+    /// \param  segment_size The size of the segments (in bytes). This value is
+    ///                     optional and defaults to 1MB.
+    /// \param  algorithm   The topology used to forward the segments, either
+    ///                     collective_algorithm::chain or
+    ///                     collective_algorithm::binary_tree. By default, a
+    ///                     chain is used for up to 16 sites.
+    ///
+    /// \note       The generation and algorithm values from corresponding
+    ///             \a broadcast_to and \a broadcast_from have to match.
+    ///
+    /// \returns    This function returns a future which will become ready
+    ///             once all segments have been sent.
+    ///
+    template <typename T, typename Allocator>
+    hpx::future<void> broadcast_to(channel_communicator comm,
+        serialization::serialize_buffer<T, Allocator> buffer,
+        generation_arg generation = generation_arg(),
+        segment_size_arg segment_size = segment_size_arg(),
+        algorithm_arg algorithm = algorithm_arg());
+
+    /// Receive a large buffer that was broadcast to different call sites
+    ///
+    /// \param  comm        A channel communicator object returned from
+    ///                     \a create_channel_communicator
+    /// \param  root_site   The site that has called \a broadcast_to.
+    ///                     This value is optional and defaults to '0' (zero).
+    /// \param  generation  The generational counter identifying the sequence
+    ///                     number of the broadcast operation performed on the
+    ///                     given communicator. This is optional and needs to be
+    ///                     supplied only if the broadcast operation on the
+    ///                     given communicator has to be performed more than
+    ///                     once. The generation number (if given) must be a
+    ///                     positive number greater than zero.
+    /// \param  algorithm   The topology used to forward the segments, see
+    ///                     \a broadcast_to.
+    ///
+    /// \returns    This function returns a future holding the buffer (a
+    ///             \a serialize_buffer) that was sent to all participating
+    ///             sites. It will become ready once all segments have been
+    ///             received and forwarded.
+    ///
+    template <typename Buffer>
+    hpx::future<Buffer> broadcast_from(channel_communicator comm,
+        root_site_arg root_site = root_site_arg(),
+        generation_arg generation = generation_arg(),
+        algorithm_arg algorithm = algorithm_arg());
 }}    // namespace hpx::collectives
 
 // clang-format on
@@ -199,7 +264,9 @@ namespace hpx { namespace collectives {
 #include <hpx/async_distributed/async.hpp>
 #include <hpx/async_local/dataflow.hpp>
 #include <hpx/collectives/argument_types.hpp>
+#include <hpx/collectives/channel_communicator.hpp>
 #include <hpx/collectives/create_communicator.hpp>
+#include <hpx/collectives/detail/channel_algorithms.hpp>
 #include <hpx/components_base/agas_interface.hpp>
 #include <hpx/futures/future.hpp>
 #include <hpx/modules/execution_base.hpp>
@@ -382,6 +449,75 @@ namespace hpx { namespace collectives {
                                      this_site, generation, root_site),
             this_site);
     }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // pipelined broadcast based on point-to-point communication
+    template <typename T, typename Allocator>
+    hpx::future<void> broadcast_to(channel_communicator comm,
+        serialization::serialize_buffer<T, Allocator> buffer,
+        generation_arg generation = generation_arg(),
+        segment_size_arg segment_size = segment_size_arg(),
+        algorithm_arg algorithm = algorithm_arg())
+    {
+        if (generation == 0)
+        {
+            return hpx::make_exceptional_future<void>(HPX_GET_EXCEPTION(
+                hpx::bad_parameter, "hpx::collectives::broadcast_to",
+                "the generation number shouldn't be zero"));
+        }
+
+        algorithm = detail::get_broadcast_algorithm(
+            algorithm, comm.get_info().first);
+        if (algorithm != collective_algorithm::chain &&
+            algorithm != collective_algorithm::binary_tree)
+        {
+            return hpx::make_exceptional_future<void>(HPX_GET_EXCEPTION(
+                hpx::bad_parameter, "hpx::collectives::broadcast_to",
+                "the requested algorithm is not supported by broadcast"));
+        }
+
+        if (segment_size == std::size_t(-1))
+        {
+            segment_size = detail::broadcast_segment_size;
+        }
+
+        return hpx::async([comm = HPX_MOVE(comm), buffer = HPX_MOVE(buffer),
+                              generation, segment_size, algorithm]() {
+            detail::broadcast_pipelined_to(
+                comm, buffer, segment_size, algorithm, generation);
+        });
+    }
+
+    template <typename Buffer>
+    hpx::future<Buffer> broadcast_from(channel_communicator comm,
+        root_site_arg root_site = root_site_arg(),
+        generation_arg generation = generation_arg(),
+        algorithm_arg algorithm = algorithm_arg())
+    {
+        if (generation == 0)
+        {
+            return hpx::make_exceptional_future<Buffer>(HPX_GET_EXCEPTION(
+                hpx::bad_parameter, "hpx::collectives::broadcast_from",
+                "the generation number shouldn't be zero"));
+        }
+
+        algorithm = detail::get_broadcast_algorithm(
+            algorithm, comm.get_info().first);
+        if (algorithm != collective_algorithm::chain &&
+            algorithm != collective_algorithm::binary_tree)
+        {
+            return hpx::make_exceptional_future<Buffer>(HPX_GET_EXCEPTION(
+                hpx::bad_parameter, "hpx::collectives::broadcast_from",
+                "the requested algorithm is not supported by broadcast"));
+        }
+
+        HPX_ASSERT(comm.get_info().second != root_site);
+        return hpx::async([comm = HPX_MOVE(comm), root_site, generation,
+                              algorithm]() -> Buffer {
+            return detail::broadcast_pipelined_from<Buffer>(
+                comm, root_site, algorithm, generation);
+        });
+    }
 }}    // namespace hpx::collectives
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,368 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file bulk_async.hpp
+
+#pragma once
+
+#if defined(DOXYGEN)
+namespace hpx { namespace lcos {
+
+    /// \brief Invoke an action on many targets using one parcel per locality
+    ///
+    /// The function hpx::lcos::bulk_async invokes the given action once for
+    /// each of the given global identifiers, passing along the corresponding
+    /// set of arguments. The invocations are grouped by the locality the
+    /// targets live on, each group is sent to its locality as a single
+    /// parcel and is executed there in parallel. The action can be either a
+    /// plain action (in which case the global identifiers have to refer to
+    /// localities) or a component action.
+    ///
+    /// \param ids       [in] A list of global identifiers identifying the
+    ///                  target objects for which the given action will be
+    ///                  invoked.
+    /// \param args      [in] The arguments for each of the invocations, this
+    ///                  has to have the same size as \a ids.
+    ///
+    /// \returns         This function returns a future representing the
+    ///                  results of all invocations, in the order of the given
+    ///                  identifiers. The future holds the first exception
+    ///                  thrown by any of the invocations.
+    ///
+    /// \note            If decltype(Action(...)) is void, then the result of
+    ///                  this function is future<void>.
+    ///
+    /// \note            The macros HPX_REGISTER_BULK_ASYNC_ACTION_DECLARATION
+    ///                  and HPX_REGISTER_BULK_ASYNC_ACTION have to be used
+    ///                  for each action used with this function.
+    ///
+    template <typename Action>
+    hpx::future<std::vector<decltype(Action(hpx::id_type, ArgN, ...))>>
+    bulk_async(std::vector<hpx::id_type> const& ids,
+        std::vector<typename Action::arguments_type> const& args);
+}}    // namespace hpx::lcos
+#else
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/actions/transfer_action.hpp>
+#include <hpx/actions_base/plain_action.hpp>
+#include <hpx/actions_base/traits/extract_action.hpp>
+#include <hpx/async_combinators/wait_all.hpp>
+#include <hpx/async_combinators/when_all.hpp>
+#include <hpx/async_distributed/async.hpp>
+#include <hpx/async_distributed/sync.hpp>
+#include <hpx/async_distributed/transfer_continuation_action.hpp>
+#include <hpx/datastructures/tuple.hpp>
+#include <hpx/functional/invoke_fused.hpp>
+#include <hpx/futures/future.hpp>
+#include <hpx/futures/traits/promise_local_result.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/naming_base/id_type.hpp>
+#include <hpx/naming_base/naming_base.hpp>
+#include <hpx/preprocessor/cat.hpp>
+#include <hpx/preprocessor/expand.hpp>
+#include <hpx/preprocessor/nargs.hpp>
+#include <hpx/serialization/vector.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <map>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if !defined(HPX_BULK_ASYNC_CHUNK_SIZE)
+#define HPX_BULK_ASYNC_CHUNK_SIZE 256
+#endif
+
+namespace hpx { namespace lcos {
+    namespace detail {
+        ///////////////////////////////////////////////////////////////////////
+        template <typename Action>
+        struct bulk_async_result
+        {
+            using action_result = typename traits::promise_local_result<
+                typename hpx::traits::extract_action<
+                    Action>::remote_result_type>::type;
+            using type = std::conditional_t<std::is_void_v<action_result>,
+                void, std::vector<action_result>>;
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        // Executed on the locality the targets live on, the invocations are
+        // run in chunks in parallel. The targets are usually local, anything
+        // else (like migrated objects) is forwarded as usual.
+        template <typename Action>
+        struct bulk_async_invoker
+        {
+            using action_type =
+                typename hpx::traits::extract_action<Action>::type;
+            using arguments_type = typename action_type::arguments_type;
+            using result_type = typename bulk_async_result<Action>::type;
+
+            static auto invoke(
+                hpx::id_type const& id, arguments_type const& args)
+            {
+                return hpx::util::invoke_fused(
+                    [&id](auto const&... vs) {
+                        return hpx::sync<action_type>(
+                            hpx::launch::sync, id, vs...);
+                    },
+                    args);
+            }
+
+            static result_type invoke_chunk(
+                std::vector<hpx::id_type> const& ids,
+                std::vector<arguments_type> const& args, std::size_t first,
+                std::size_t last)
+            {
+                if constexpr (std::is_void_v<result_type>)
+                {
+                    for (std::size_t i = first; i != last; ++i)
+                    {
+                        invoke(ids[i], args[i]);
+                    }
+                }
+                else
+                {
+                    result_type results;
+                    results.reserve(last - first);
+                    for (std::size_t i = first; i != last; ++i)
+                    {
+                        results.push_back(invoke(ids[i], args[i]));
+                    }
+                    return results;
+                }
+            }
+
+            static result_type call(std::vector<hpx::id_type> const& ids,
+                std::vector<arguments_type> const& args)
+            {
+                std::size_t const count = ids.size();
+                std::size_t const chunk_size = HPX_BULK_ASYNC_CHUNK_SIZE;
+                if (count <= chunk_size)
+                {
+                    return invoke_chunk(ids, args, 0, count);
+                }
+
+                std::vector<hpx::future<result_type>> chunks;
+                chunks.reserve((count + chunk_size - 1) / chunk_size);
+                for (std::size_t first = 0; first < count; first += chunk_size)
+                {
+                    std::size_t const last =
+                        (std::min)(first + chunk_size, count);
+                    chunks.push_back(hpx::async(&invoke_chunk, std::cref(ids),
+                        std::cref(args), first, last));
+                }
+                hpx::wait_all_nothrow(chunks);
+
+                if constexpr (std::is_void_v<result_type>)
+                {
+                    for (hpx::future<void>& f : chunks)
+                    {
+                        f.get();
+                    }
+                }
+                else
+                {
+                    result_type results;
+                    results.reserve(count);
+                    for (hpx::future<result_type>& f : chunks)
+                    {
+                        result_type r = f.get();
+                        std::move(r.begin(), r.end(),
+                            std::back_inserter(results));
+                    }
+                    return results;
+                }
+            }
+        };
+
+        template <typename Action>
+        struct make_bulk_async_action
+        {
+            using bulk_async_invoker_type = bulk_async_invoker<Action>;
+            using type = typename HPX_MAKE_ACTION(
+                bulk_async_invoker_type::call)::type;
+        };
+
+        template <typename Action>
+        using make_bulk_async_action_t =
+            typename make_bulk_async_action<Action>::type;
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Action>
+    hpx::future<typename detail::bulk_async_result<Action>::type> bulk_async(
+        std::vector<hpx::id_type> const& ids,
+        std::vector<typename hpx::traits::extract_action<
+            Action>::type::arguments_type> const& args)
+    {
+        using action_type = typename hpx::traits::extract_action<Action>::type;
+        using arguments_type = typename action_type::arguments_type;
+        using result_type = typename detail::bulk_async_result<Action>::type;
+        using bulk_action = detail::make_bulk_async_action_t<Action>;
+
+        if (ids.size() != args.size())
+        {
+            HPX_THROW_EXCEPTION(hpx::bad_parameter, "hpx::lcos::bulk_async",
+                "the number of targets and argument sets must be the same");
+        }
+
+        if (ids.empty())
+        {
+            if constexpr (std::is_void_v<result_type>)
+            {
+                return hpx::make_ready_future();
+            }
+            else
+            {
+                return hpx::make_ready_future(result_type());
+            }
+        }
+
+        // group the invocations by destination locality
+        struct group
+        {
+            std::vector<hpx::id_type> ids;
+            std::vector<arguments_type> args;
+        };
+
+        std::map<std::uint32_t, group> groups;
+        for (std::size_t i = 0; i != ids.size(); ++i)
+        {
+            group& g = groups[naming::get_locality_id_from_id(ids[i])];
+            g.ids.push_back(ids[i]);
+            g.args.push_back(args[i]);
+        }
+
+        // remember where the results of each invocation end up
+        std::vector<std::pair<std::size_t, std::size_t>> positions;
+        if constexpr (!std::is_void_v<result_type>)
+        {
+            std::map<std::uint32_t, std::size_t> group_index;
+            std::vector<std::size_t> group_size;
+            for (auto const& g : groups)
+            {
+                group_index[g.first] = group_size.size();
+                group_size.push_back(0);
+            }
+
+            positions.reserve(ids.size());
+            for (hpx::id_type const& id : ids)
+            {
+                std::size_t const index =
+                    group_index[naming::get_locality_id_from_id(id)];
+                positions.emplace_back(index, group_size[index]++);
+            }
+        }
+
+        std::vector<hpx::future<result_type>> futures;
+        futures.reserve(groups.size());
+        for (auto& g : groups)
+        {
+            futures.push_back(hpx::async<bulk_action>(
+                naming::get_id_from_locality_id(g.first),
+                HPX_MOVE(g.second.ids), HPX_MOVE(g.second.args)));
+        }
+
+        return hpx::when_all(futures).then(hpx::launch::sync,
+            [positions = HPX_MOVE(positions)](
+                hpx::future<std::vector<hpx::future<result_type>>>&& f)
+                -> result_type {
+                std::vector<hpx::future<result_type>> futures = f.get();
+                if constexpr (std::is_void_v<result_type>)
+                {
+                    for (hpx::future<void>& r : futures)
+                    {
+                        r.get();
+                    }
+                }
+                else
+                {
+                    std::vector<result_type> group_results;
+                    group_results.reserve(futures.size());
+                    for (hpx::future<result_type>& r : futures)
+                    {
+                        group_results.push_back(r.get());
+                    }
+
+                    result_type results;
+                    results.reserve(positions.size());
+                    for (auto const& p : positions)
+                    {
+                        results.push_back(
+                            HPX_MOVE(group_results[p.first][p.second]));
+                    }
+                    return results;
+                }
+            });
+    }
+
+    template <typename Component, typename Signature, typename Derived>
+    hpx::future<typename detail::bulk_async_result<Derived>::type> bulk_async(
+        hpx::actions::basic_action<Component, Signature, Derived> /* act */,
+        std::vector<hpx::id_type> const& ids,
+        std::vector<typename Derived::arguments_type> const& args)
+    {
+        return bulk_async<Derived>(ids, args);
+    }
+}}    // namespace hpx::lcos
+
+#define HPX_REGISTER_BULK_ASYNC_ACTION_DECLARATION(...)                        \
+    HPX_REGISTER_BULK_ASYNC_ACTION_DECLARATION_(__VA_ARGS__)                   \
+/**/
+#define HPX_REGISTER_BULK_ASYNC_ACTION_DECLARATION_(...)                       \
+    HPX_PP_EXPAND(HPX_PP_CAT(HPX_REGISTER_BULK_ASYNC_ACTION_DECLARATION_,      \
+        HPX_PP_NARGS(__VA_ARGS__))(__VA_ARGS__))                               \
+    /**/
+
+#define HPX_REGISTER_BULK_ASYNC_ACTION_DECLARATION_1(Action)                   \
+    HPX_REGISTER_BULK_ASYNC_ACTION_DECLARATION_2(Action, Action)               \
+/**/
+#define HPX_REGISTER_BULK_ASYNC_ACTION_DECLARATION_2(Action, Name)             \
+    HPX_REGISTER_ACTION_DECLARATION(                                           \
+        ::hpx::lcos::detail::make_bulk_async_action<Action>::type,             \
+        HPX_PP_CAT(bulk_async_, Name))                                         \
+/**/
+
+#define HPX_REGISTER_BULK_ASYNC_ACTION(...)                                    \
+    HPX_REGISTER_BULK_ASYNC_ACTION_(__VA_ARGS__)                               \
+/**/
+#define HPX_REGISTER_BULK_ASYNC_ACTION_(...)                                   \
+    HPX_PP_EXPAND(HPX_PP_CAT(HPX_REGISTER_BULK_ASYNC_ACTION_,                  \
+        HPX_PP_NARGS(__VA_ARGS__))(__VA_ARGS__))                               \
+    /**/
+
+#define HPX_REGISTER_BULK_ASYNC_ACTION_1(Action)                               \
+    HPX_REGISTER_BULK_ASYNC_ACTION_2(Action, Action)                           \
+/**/
+#define HPX_REGISTER_BULK_ASYNC_ACTION_2(Action, Name)                         \
+    HPX_REGISTER_ACTION(                                                       \
+        ::hpx::lcos::detail::make_bulk_async_action<Action>::type,             \
+        HPX_PP_CAT(bulk_async_, Name))                                         \
+/**/
+
+#else
+
+#define HPX_REGISTER_BULK_ASYNC_ACTION_DECLARATION(...)  /**/
+#define HPX_REGISTER_BULK_ASYNC_ACTION_DECLARATION_(...) /**/
+
+#define HPX_REGISTER_BULK_ASYNC_ACTION_DECLARATION_1(Action)       /**/
+#define HPX_REGISTER_BULK_ASYNC_ACTION_DECLARATION_2(Action, Name) /**/
+
+#define HPX_REGISTER_BULK_ASYNC_ACTION(...)  /**/
+#define HPX_REGISTER_BULK_ASYNC_ACTION_(...) /**/
+
+#define HPX_REGISTER_BULK_ASYNC_ACTION_1(Action)       /**/
+#define HPX_REGISTER_BULK_ASYNC_ACTION_2(Action, Name) /**/
+
+#endif    //COMPUTE_DEVICE_CODE
+#endif    // DOXYGEN
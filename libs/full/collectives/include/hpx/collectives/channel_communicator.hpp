@@ -160,6 +160,18 @@ namespace hpx { namespace collectives {
 
         HPX_EXPORT void free();
 
+        // return the number of sites and the sequence number of this site
+        std::pair<std::size_t, std::size_t> get_info() const noexcept
+        {
+            return comm_->get_info();
+        }
+
+        // The returned future becomes ready once the messages to the given
+        // sites (and the messages received on this site) are handled
+        // without an additional address resolution.
+        HPX_EXPORT hpx::future<void> resolve(
+            std::vector<std::size_t> const& sites) const;
+
     private:
         std::shared_ptr<detail::channel_communicator> comm_;
     };
@@ -0,0 +1,67 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+
+#include <hpx/collectives/barrier.hpp>
+#include <hpx/collectives/channel_communicator.hpp>
+#include <hpx/functional/function.hpp>
+#include <hpx/futures/future.hpp>
+#include <hpx/futures/promise.hpp>
+#include <hpx/synchronization/spinlock.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <string>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx::distributed::detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // A barrier built from point-to-point notifications exchanged through a
+    // channel_communicator, every invocation uses its own range of tags.
+    class HPX_EXPORT point_to_point_barrier
+    {
+    public:
+        point_to_point_barrier(std::string const& base_name, std::size_t num,
+            std::size_t rank, barrier_algorithm algorithm);
+
+        hpx::future<void> wait();
+
+    private:
+        hpx::collectives::channel_communicator comm_;
+        barrier_algorithm algorithm_;
+        std::atomic<std::size_t> generation_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Combines the arrivals of several threads sharing one barrier object,
+    // only the last arriving thread synchronizes with the other sites.
+    class HPX_EXPORT barrier_local_step
+    {
+    public:
+        explicit barrier_local_step(std::size_t num_local_participants);
+
+        hpx::future<void> arrive(
+            hpx::function<hpx::future<void>()> const& wait_all_sites);
+
+    private:
+        hpx::spinlock mtx_;
+        std::size_t num_local_participants_;
+        std::size_t arrived_;
+        hpx::promise<void> promise_;
+        hpx::shared_future<void> result_;
+    };
+}    // namespace hpx::distributed::detail
+
+#include <hpx/config/warnings_suffix.hpp>
+
+#endif    // !HPX_COMPUTE_DEVICE_CODE
@@ -0,0 +1,523 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+
+#include <hpx/assert.hpp>
+#include <hpx/async_combinators/wait_all.hpp>
+#include <hpx/collectives/argument_types.hpp>
+#include <hpx/collectives/channel_communicator.hpp>
+#include <hpx/collectives/detail/reduce_in_place.hpp>
+#include <hpx/futures/future.hpp>
+#include <hpx/serialization/serialize_buffer.hpp>
+#include <hpx/type_support/detected.hpp>
+#include <hpx/type_support/unused.hpp>
+
+#include <algorithm>
+#include <climits>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// The collective operations in this file are built from point-to-point
+// messages exchanged through a channel_communicator. Unlike the operations
+// based on communicator_server, no single site has to receive (and combine)
+// the values of all other sites.
+namespace hpx { namespace collectives { namespace detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // values (in bytes) up to which the latency bound algorithms are used
+    inline constexpr std::size_t all_reduce_small_payload = 16384;
+    inline constexpr std::size_t all_gather_small_payload = 65536;
+
+    // maximal number of steps of a tree based algorithm
+    inline constexpr std::size_t max_tree_steps = 64;
+
+    // Each invocation of a collective operation uses its own range of tags,
+    // the range is selected by the generation number.
+    inline std::size_t get_tag_base(
+        std::size_t num_sites, std::size_t generation) noexcept
+    {
+        if (generation == std::size_t(-1))
+        {
+            return 0;
+        }
+        return generation * (num_sites + 2 * max_tree_steps);
+    }
+
+    inline std::size_t log2(std::size_t value) noexcept
+    {
+        std::size_t result = 0;
+        while (value >>= 1)
+        {
+            ++result;
+        }
+        return result;
+    }
+
+    inline bool is_power_of_two(std::size_t value) noexcept
+    {
+        return value != 0 && (value & (value - 1)) == 0;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // estimate the number of bytes a value occupies on the wire
+    template <typename T>
+    using data_size_t = decltype(std::declval<T const&>().size() *
+        sizeof(*std::declval<T const&>().data()));
+
+    template <typename T>
+    std::size_t payload_size(T const& value) noexcept
+    {
+        if constexpr (util::is_detected_v<data_size_t, T>)
+        {
+            return value.size() * sizeof(*value.data());
+        }
+        else
+        {
+            HPX_UNUSED(value);
+            return sizeof(T);
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // point-to-point messages between two sites of a channel_communicator
+    using point_to_point_communicator = hpx::collectives::channel_communicator;
+
+    template <typename T>
+    hpx::future<void> send_to(point_to_point_communicator const& comm,
+        std::size_t site, T&& value, std::size_t tag)
+    {
+        return hpx::collectives::set(
+            comm, that_site_arg(site), HPX_FORWARD(T, value), tag_arg(tag));
+    }
+
+    template <typename T>
+    T receive_from(point_to_point_communicator const& comm, std::size_t site,
+        std::size_t tag)
+    {
+        return hpx::collectives::get<T>(comm, that_site_arg(site), tag_arg(tag))
+            .get();
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Every site exchanges its partial result with the site at distance
+    // 1, 2, 4, ... Sites beyond the largest power of two fold their value
+    // into a partner first and receive the final result from it.
+    template <typename T, typename F>
+    T all_reduce_recursive_doubling(point_to_point_communicator const& comm,
+        T value, F& op, std::size_t generation)
+    {
+        auto [num_sites, this_site] = comm.get_info();
+        std::size_t const tag_base = get_tag_base(num_sites, generation);
+
+        std::size_t const num_pairs = std::size_t(1) << log2(num_sites);
+        std::size_t const remaining = num_sites - num_pairs;
+        std::size_t const last_step = log2(num_pairs) + 1;
+
+        if (this_site >= num_pairs)
+        {
+            std::size_t const partner = this_site - num_pairs;
+            hpx::future<void> f = send_to(comm, partner, value, tag_base);
+            T result = receive_from<T>(comm, partner, tag_base + last_step);
+            f.get();
+            return result;
+        }
+
+        if (this_site < remaining)
+        {
+            value = reduce_values(op, HPX_MOVE(value),
+                receive_from<T>(comm, this_site + num_pairs, tag_base));
+        }
+
+        std::size_t step = 1;
+        for (std::size_t mask = 1; mask < num_pairs; mask <<= 1, ++step)
+        {
+            std::size_t const partner = this_site ^ mask;
+            hpx::future<void> f =
+                send_to(comm, partner, value, tag_base + step);
+            T other = receive_from<T>(comm, partner, tag_base + step);
+            f.get();
+
+            // combine values in the same order on both partners
+            if (this_site < partner)
+            {
+                value = reduce_values(op, HPX_MOVE(value), HPX_MOVE(other));
+            }
+            else
+            {
+                value = reduce_values(op, HPX_MOVE(other), HPX_MOVE(value));
+            }
+        }
+
+        HPX_ASSERT(step == last_step);
+        if (this_site < remaining)
+        {
+            send_to(comm, this_site + num_pairs, value, tag_base + last_step)
+                .get();
+        }
+        return value;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Reduce all values to site zero along a binomial tree and send the
+    // result back down the same tree. Every site sends (and receives) its
+    // value at most once during the reduction.
+    template <typename T, typename F>
+    T all_reduce_binomial_tree(point_to_point_communicator const& comm,
+        T value, F& op, std::size_t generation)
+    {
+        auto [num_sites, this_site] = comm.get_info();
+        std::size_t const tag_base = get_tag_base(num_sites, generation);
+
+        // reduction towards site zero
+        std::size_t mask = 1;
+        for (std::size_t step = 0; mask < num_sites; mask <<= 1, ++step)
+        {
+            if (this_site & mask)
+            {
+                send_to(comm, this_site - mask, value, tag_base + step).get();
+                break;
+            }
+            if (this_site + mask < num_sites)
+            {
+                value = reduce_values(op, HPX_MOVE(value),
+                    receive_from<T>(comm, this_site + mask, tag_base + step));
+            }
+        }
+
+        // broadcast from site zero, a site receives the result from the site
+        // it has sent its value to
+        std::size_t const bcast_base = tag_base + max_tree_steps;
+        if (this_site != 0)
+        {
+            value = receive_from<T>(
+                comm, this_site - mask, bcast_base + log2(mask));
+        }
+
+        std::vector<hpx::future<void>> sets;
+        sets.reserve(log2(mask) + 1);
+        for (mask >>= 1; mask != 0; mask >>= 1)
+        {
+            if (this_site + mask < num_sites)
+            {
+                sets.push_back(send_to(
+                    comm, this_site + mask, value, bcast_base + log2(mask)));
+            }
+        }
+        hpx::wait_all(sets);
+
+        return value;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Every site exchanges all values it has collected so far with the site
+    // at distance 1, 2, 4, ... The number of sites must be a power of two.
+    template <typename T>
+    std::vector<T> all_gather_recursive_doubling(
+        point_to_point_communicator const& comm, T value,
+        std::size_t generation)
+    {
+        auto [num_sites, this_site] = comm.get_info();
+        std::size_t const tag_base = get_tag_base(num_sites, generation);
+
+        HPX_ASSERT(is_power_of_two(num_sites));
+
+        std::vector<T> result(num_sites);
+        result[this_site] = HPX_MOVE(value);
+
+        std::size_t step = 0;
+        for (std::size_t mask = 1; mask < num_sites; mask <<= 1, ++step)
+        {
+            std::size_t const partner = this_site ^ mask;
+
+            // both partners own a block of 'mask' consecutive values
+            std::size_t const first = this_site & ~(mask - 1);
+            std::vector<T> block(
+                result.begin() + first, result.begin() + first + mask);
+
+            hpx::future<void> f =
+                send_to(comm, partner, HPX_MOVE(block), tag_base + step);
+            std::vector<T> other =
+                receive_from<std::vector<T>>(comm, partner, tag_base + step);
+            f.get();
+
+            HPX_ASSERT(other.size() == mask);
+            std::size_t const other_first = partner & ~(mask - 1);
+            for (std::size_t i = 0; i != mask; ++i)
+            {
+                result[other_first + i] = HPX_MOVE(other[i]);
+            }
+        }
+        return result;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Every site forwards the value it has received last to its successor.
+    // Each site sends num_sites - 1 messages of the size of a single value.
+    template <typename T>
+    std::vector<T> all_gather_ring(point_to_point_communicator const& comm,
+        T value, std::size_t generation)
+    {
+        auto [num_sites, this_site] = comm.get_info();
+        std::size_t const tag_base = get_tag_base(num_sites, generation);
+
+        std::size_t const next = (this_site + 1) % num_sites;
+        std::size_t const prev = (this_site + num_sites - 1) % num_sites;
+
+        std::vector<T> result(num_sites);
+        result[this_site] = HPX_MOVE(value);
+
+        std::vector<hpx::future<void>> sets;
+        sets.reserve(num_sites);
+        for (std::size_t step = 0; step + 1 < num_sites; ++step)
+        {
+            std::size_t const send = (this_site + num_sites - step) % num_sites;
+            std::size_t const recv = (prev + num_sites - step) % num_sites;
+
+            sets.push_back(
+                send_to(comm, next, T(result[send]), tag_base + step));
+            result[recv] = receive_from<T>(comm, prev, tag_base + step);
+        }
+        hpx::wait_all(sets);
+
+        return result;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Every site exchanges the blocks destined for another site directly with
+    // that site, one partner per step. The partners are chosen such that each
+    // site receives exactly one block per step (no incast): for a power of two
+    // number of sites the pairs exchange their blocks with each other,
+    // otherwise every site sends to the site at distance 'step' and receives
+    // from the one at distance -'step'. The blocks are moved into the
+    // messages, contiguous blocks of bitwise serializable data are sent
+    // without being copied by the serialization layer.
+    inline std::size_t get_all_to_all_partner(std::size_t num_sites,
+        std::size_t this_site, std::size_t step, bool send) noexcept
+    {
+        if (is_power_of_two(num_sites))
+        {
+            return this_site ^ step;
+        }
+        return send ? (this_site + step) % num_sites :
+                      (this_site + num_sites - step) % num_sites;
+    }
+
+    template <typename T>
+    std::vector<T> all_to_all_pairwise(point_to_point_communicator const& comm,
+        std::vector<T> values, std::size_t generation)
+    {
+        auto [num_sites, this_site] = comm.get_info();
+        std::size_t const tag_base = get_tag_base(num_sites, generation);
+
+        HPX_ASSERT(values.size() == num_sites);
+
+        std::vector<T> result(num_sites);
+        result[this_site] = HPX_MOVE(values[this_site]);
+
+        std::vector<hpx::future<void>> sets;
+        sets.reserve(num_sites);
+        for (std::size_t step = 1; step < num_sites; ++step)
+        {
+            std::size_t const send =
+                get_all_to_all_partner(num_sites, this_site, step, true);
+            std::size_t const recv =
+                get_all_to_all_partner(num_sites, this_site, step, false);
+
+            sets.push_back(
+                send_to(comm, send, HPX_MOVE(values[send]), tag_base));
+            result[recv] = receive_from<T>(comm, recv, tag_base);
+        }
+        hpx::wait_all(sets);
+
+        return result;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // default size (in bytes) of the segments of a pipelined broadcast
+    inline constexpr std::size_t broadcast_segment_size = 1048576;
+
+    // number of sites up to which a pipelined broadcast uses a chain
+    inline constexpr std::size_t broadcast_max_chain_sites = 16;
+
+    // The segments of a pipelined operation use tags from a range separate
+    // from the one used by get_tag_base, each generation has room for 2^32
+    // segments (on 64 bit platforms).
+    inline std::size_t get_segment_tag(
+        std::size_t generation, std::size_t segment) noexcept
+    {
+        constexpr std::size_t half_bits = sizeof(std::size_t) * CHAR_BIT / 2;
+        if (generation == std::size_t(-1))
+        {
+            generation = 0;
+        }
+        return (std::size_t(1) << (2 * half_bits - 1)) |
+            (generation << half_bits) | segment;
+    }
+
+    inline collective_algorithm get_broadcast_algorithm(
+        collective_algorithm algorithm, std::size_t num_sites) noexcept
+    {
+        if (algorithm == collective_algorithm::automatic)
+        {
+            return num_sites <= broadcast_max_chain_sites ?
+                collective_algorithm::chain :
+                collective_algorithm::binary_tree;
+        }
+        return algorithm;
+    }
+
+    // The sites of a pipelined broadcast form a chain or a binary tree,
+    // the sites are numbered relative to the root site.
+    inline std::size_t get_broadcast_parent(collective_algorithm algorithm,
+        std::size_t num_sites, std::size_t this_site,
+        std::size_t root_site) noexcept
+    {
+        std::size_t const site =
+            (this_site + num_sites - root_site) % num_sites;
+        HPX_ASSERT(site != 0);
+
+        std::size_t const parent = algorithm == collective_algorithm::chain ?
+            site - 1 :
+            (site - 1) / 2;
+        return (parent + root_site) % num_sites;
+    }
+
+    inline std::vector<std::size_t> get_broadcast_children(
+        collective_algorithm algorithm, std::size_t num_sites,
+        std::size_t this_site, std::size_t root_site)
+    {
+        std::size_t const site =
+            (this_site + num_sites - root_site) % num_sites;
+
+        std::vector<std::size_t> children;
+        if (algorithm == collective_algorithm::chain)
+        {
+            if (site + 1 < num_sites)
+            {
+                children.push_back((site + 1 + root_site) % num_sites);
+            }
+        }
+        else
+        {
+            for (std::size_t child = 2 * site + 1;
+                 child <= 2 * site + 2 && child < num_sites; ++child)
+            {
+                children.push_back((child + root_site) % num_sites);
+            }
+        }
+        return children;
+    }
+
+    // the header of a pipelined broadcast holds the overall number of
+    // elements and the number of elements per segment
+    using broadcast_header = std::pair<std::size_t, std::size_t>;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The root site splits the buffer into segments referring to its data.
+    // The segments share ownership of the data, the buffer is not copied.
+    template <typename T, typename Allocator>
+    void broadcast_pipelined_to(point_to_point_communicator const& comm,
+        serialization::serialize_buffer<T, Allocator> const& buffer,
+        std::size_t segment_size, collective_algorithm algorithm,
+        std::size_t generation)
+    {
+        using segment_type = serialization::serialize_buffer<T>;
+
+        auto [num_sites, this_site] = comm.get_info();
+        std::vector<std::size_t> const children =
+            get_broadcast_children(algorithm, num_sites, this_site, this_site);
+
+        std::size_t const size = buffer.size();
+        std::size_t const segment_elements =
+            (std::max)(segment_size / sizeof(T), std::size_t(1));
+
+        std::vector<hpx::future<void>> sets;
+        sets.reserve(children.size() * (size / segment_elements + 2));
+
+        std::size_t const tag_base = get_tag_base(num_sites, generation);
+        for (std::size_t child : children)
+        {
+            sets.push_back(send_to(comm, child,
+                broadcast_header(size, segment_elements), tag_base));
+        }
+
+        auto data = buffer.data_array();
+        std::size_t segment = 0;
+        for (std::size_t first = 0; first < size;
+             first += segment_elements, ++segment)
+        {
+            segment_type value(data.get() + first,
+                (std::min)(segment_elements, size - first),
+                segment_type::reference, [data](T*) noexcept {});
+
+            for (std::size_t child : children)
+            {
+                sets.push_back(send_to(
+                    comm, child, value, get_segment_tag(generation, segment)));
+            }
+        }
+        hpx::wait_all(sets);
+    }
+
+    // All other sites forward each segment to their children as soon as it
+    // has been received.
+    template <typename Buffer>
+    Buffer broadcast_pipelined_from(point_to_point_communicator const& comm,
+        std::size_t root_site, collective_algorithm algorithm,
+        std::size_t generation)
+    {
+        using segment_type =
+            serialization::serialize_buffer<typename Buffer::value_type>;
+
+        auto [num_sites, this_site] = comm.get_info();
+        std::size_t const parent =
+            get_broadcast_parent(algorithm, num_sites, this_site, root_site);
+        std::vector<std::size_t> const children =
+            get_broadcast_children(algorithm, num_sites, this_site, root_site);
+
+        std::size_t const tag_base = get_tag_base(num_sites, generation);
+        auto const header =
+            receive_from<broadcast_header>(comm, parent, tag_base);
+
+        std::vector<hpx::future<void>> sets;
+        sets.reserve(children.size() * (header.first / header.second + 2));
+
+        for (std::size_t child : children)
+        {
+            sets.push_back(send_to(comm, child, header, tag_base));
+        }
+
+        Buffer result(header.first);
+        std::size_t segment = 0;
+        for (std::size_t first = 0; first < header.first;
+             first += header.second, ++segment)
+        {
+            std::size_t const tag = get_segment_tag(generation, segment);
+            auto const value = receive_from<segment_type>(comm, parent, tag);
+
+            for (std::size_t child : children)
+            {
+                sets.push_back(send_to(comm, child, value, tag));
+            }
+
+            HPX_ASSERT(first + value.size() <= header.first);
+            std::copy(value.data(), value.data() + value.size(),
+                result.data() + first);
+        }
+        hpx::wait_all(sets);
+
+        return result;
+    }
+}}}    // namespace hpx::collectives::detail
+
+#endif    // !HPX_COMPUTE_DEVICE_CODE
@@ -12,18 +12,23 @@
 
 #include <hpx/actions_base/component_action.hpp>
 #include <hpx/assert.hpp>
+#include <hpx/async_distributed/packaged_action.hpp>
 #include <hpx/components/client.hpp>
 #include <hpx/components_base/server/component_base.hpp>
 #include <hpx/datastructures/any.hpp>
 #include <hpx/futures/future.hpp>
 #include <hpx/lcos_local/channel.hpp>
 #include <hpx/lock_registration/detail/register_locks.hpp>
+#include <hpx/naming_base/address.hpp>
 #include <hpx/synchronization/spinlock.hpp>
 #include <hpx/type_support/unused.hpp>
 
 #include <cstddef>
+#include <exception>
 #include <map>
+#include <memory>
 #include <mutex>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -60,13 +65,16 @@ namespace hpx { namespace collectives { namespace detail {
                 util::ignore_while_checking il(&l);
                 HPX_UNUSED(il);
 
-                channel_type& c = data_[which].channels_[tag];
-                f = c.get();
+                auto it = data_[which].channels_.try_emplace(tag).first;
+                f = it->second.channel_.get();
+                data_[which].release(it, -1);
             }
 
             return f.then(
                 hpx::launch::sync, [](hpx::future<unique_any_nonser>&& f) -> T {
-                    return hpx::any_cast<T const&>(f.get());
+                    // the channel holds the only reference to the value
+                    unique_any_nonser value = f.get();
+                    return HPX_MOVE(hpx::any_cast<T&>(value));
                 });
         }
 
@@ -87,7 +95,9 @@ namespace hpx { namespace collectives { namespace detail {
             util::ignore_while_checking il(&l);
             HPX_UNUSED(il);
 
-            data_[which].channels_[tag].set(HPX_MOVE(value));
+            auto it = data_[which].channels_.try_emplace(tag).first;
+            it->second.channel_.set(HPX_MOVE(value));
+            data_[which].release(it, 1);
         }
 
         template <typename T>
@@ -100,10 +110,30 @@ namespace hpx { namespace collectives { namespace detail {
         };
 
     private:
+        // A channel is removed as soon as every value sent through it was
+        // retrieved, tags are usually used for a single message only.
+        struct channel_data
+        {
+            channel_type channel_;
+            std::ptrdiff_t balance_ = 0;
+        };
+
         struct locality_data
         {
+            using channels_type = std::map<std::size_t, channel_data>;
+
+            void release(
+                channels_type::iterator it, std::ptrdiff_t count) noexcept
+            {
+                it->second.balance_ += count;
+                if (it->second.balance_ == 0)
+                {
+                    channels_.erase(it);
+                }
+            }
+
             hpx::spinlock mtx_;
-            std::map<std::size_t, channel_type> channels_;
+            channels_type channels_;
         };
 
         mutable std::vector<locality_data> data_;
@@ -131,6 +161,13 @@ namespace hpx { namespace collectives { namespace detail {
         hpx::future<T> get(std::size_t site, std::size_t tag) const
         {
             // all get operations refer to the channels located on this site
+            target_data const* target = get_target(this_site_);
+            if (target != nullptr)
+            {
+                HPX_ASSERT(target->local_);
+                return target->local_->template get<T>(site, tag);
+            }
+
             using action_type =
                 channel_communicator_server::template get_action<T>;
             return hpx::sync(action_type(), clients_[this_site_], site, tag);
@@ -144,8 +181,39 @@ namespace hpx { namespace collectives { namespace detail {
             using action_type =
                 channel_communicator_server::template set_action<
                     std::decay_t<T>>;
-            return hpx::async(action_type(), clients_[site], this_site_,
-                HPX_FORWARD(T, value), tag);
+
+            target_data const* target = get_target(site);
+            if (target == nullptr)
+            {
+                // the target site was not resolved yet
+                return hpx::async(action_type(), clients_[site], this_site_,
+                    HPX_FORWARD(T, value), tag);
+            }
+
+            if (target->local_)
+            {
+                // the target site lives on this locality, hand the value
+                // directly to its channel
+                try
+                {
+                    target->local_->set(this_site_,
+                        std::decay_t<T>(HPX_FORWARD(T, value)), tag);
+                }
+                catch (...)
+                {
+                    return hpx::make_exceptional_future<void>(
+                        std::current_exception());
+                }
+                return hpx::make_ready_future();
+            }
+
+            // send the value to the target site using its known address,
+            // this avoids resolving the target for every message
+            lcos::packaged_action<action_type, void> p;
+            hpx::future<void> f = p.get_future();
+            p.apply(naming::address(target->addr_), clients_[site].get_id(),
+                this_site_, HPX_FORWARD(T, value), tag);
+            return f;
         }
 
         std::pair<std::size_t, std::size_t> get_info() const noexcept
@@ -153,9 +221,35 @@ namespace hpx { namespace collectives { namespace detail {
             return std::make_pair(clients_.size(), this_site_);
         }
 
+        // the returned future becomes ready once the given sites (and this
+        // site) are resolved
+        HPX_EXPORT hpx::future<void> resolve(
+            std::vector<std::size_t> const& sites) const;
+
     private:
+        // the resolved target of the messages sent to a site
+        struct target_data
+        {
+            naming::address addr_;
+            std::shared_ptr<channel_communicator_server> local_;
+        };
+
+        target_data const* get_target(std::size_t site) const
+        {
+            auto const& target = targets_[site];
+            if (!target.is_ready() || target.has_exception())
+            {
+                return nullptr;
+            }
+            return &target.get();
+        }
+
+        static hpx::shared_future<target_data> resolve_target(
+            client_type client);
+
         std::size_t this_site_;
         std::vector<client_type> clients_;
+        std::vector<hpx::shared_future<target_data>> targets_;
     };
 }}}    // namespace hpx::collectives::detail
 
@@ -0,0 +1,127 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+
+#include <hpx/collectives/argument_types.hpp>
+#include <hpx/collectives/detail/channel_algorithms.hpp>
+#include <hpx/collectives/detail/reduce_in_place.hpp>
+#include <hpx/futures/future.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+// A schedule is the sequence of point-to-point messages a site of a
+// channel_communicator exchanges during one invocation of a collective
+// operation. It depends on the number of sites, the sequence number of the
+// site, and the algorithm only and can be computed once for any number of
+// invocations.
+namespace hpx { namespace collectives { namespace detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    struct schedule_step
+    {
+        enum kind_type : std::uint8_t
+        {
+            send = 0,        // send the value to the partner
+            receive = 1,     // replace the value with the one received
+            combine = 2,     // combine the value with the one received
+            exchange = 3     // send the value and combine it with the
+                             // value received from the partner
+        };
+
+        kind_type kind;
+
+        // combine the own value as the left hand side argument
+        bool value_first;
+
+        // the value is not used after it was sent
+        bool move_value;
+
+        std::size_t partner;
+        std::size_t tag;    // relative to the tag base of the invocation
+    };
+
+    using collective_schedule = std::vector<schedule_step>;
+
+    // compute the schedule of this site for all_reduce using either the
+    // recursive doubling or the binomial tree algorithm
+    HPX_EXPORT collective_schedule make_all_reduce_schedule(
+        std::size_t num_sites, std::size_t this_site,
+        collective_algorithm algorithm);
+
+    // return the sequence numbers of all sites this site sends messages to
+    HPX_EXPORT std::vector<std::size_t> get_schedule_partners(
+        collective_schedule const& schedule);
+
+    ///////////////////////////////////////////////////////////////////////////
+    // execute a precomputed schedule, all messages use tags relative to the
+    // given tag base
+    template <typename T, typename F>
+    T run_schedule(point_to_point_communicator const& comm,
+        collective_schedule const& schedule, T value, F& op,
+        std::size_t tag_base)
+    {
+        std::vector<hpx::future<void>> sets;
+        sets.reserve(schedule.size());
+
+        for (schedule_step const& step : schedule)
+        {
+            std::size_t const tag = tag_base + step.tag;
+            switch (step.kind)
+            {
+            case schedule_step::send:
+                if (step.move_value)
+                {
+                    sets.push_back(
+                        send_to(comm, step.partner, HPX_MOVE(value), tag));
+                }
+                else
+                {
+                    sets.push_back(send_to(comm, step.partner, value, tag));
+                }
+                break;
+
+            case schedule_step::receive:
+                value = receive_from<T>(comm, step.partner, tag);
+                break;
+
+            case schedule_step::exchange:
+                sets.push_back(send_to(comm, step.partner, value, tag));
+                [[fallthrough]];
+
+            case schedule_step::combine:
+            {
+                T other = receive_from<T>(comm, step.partner, tag);
+                if (step.value_first)
+                {
+                    value = reduce_values(op, HPX_MOVE(value), HPX_MOVE(other));
+                }
+                else
+                {
+                    value = reduce_values(op, HPX_MOVE(other), HPX_MOVE(value));
+                }
+            }
+            break;
+            }
+        }
+
+        // propagate exceptions
+        for (auto& f : sets)
+        {
+            f.get();
+        }
+        return value;
+    }
+}}}    // namespace hpx::collectives::detail
+
+#endif    // !HPX_COMPUTE_DEVICE_CODE
@@ -16,13 +16,16 @@
 #include <hpx/components/client.hpp>
 #include <hpx/components_base/server/component_base.hpp>
 #include <hpx/datastructures/any.hpp>
+#include <hpx/datastructures/detail/dynamic_bitset.hpp>
 #include <hpx/futures/future.hpp>
-#include <hpx/lcos_local/and_gate.hpp>
+#include <hpx/futures/promise.hpp>
+#include <hpx/modules/errors.hpp>
 #include <hpx/synchronization/spinlock.hpp>
 #include <hpx/thread_support/assert_owns_lock.hpp>
 #include <hpx/type_support/unused.hpp>
 
 #include <cstddef>
+#include <map>
 #include <mutex>
 #include <type_traits>
 #include <utility>
@@ -46,18 +49,13 @@ namespace hpx { namespace collectives { namespace detail {
     public:
         communicator_server() noexcept    //-V730
           : num_sites_(0)
-          , needs_initialization_(false)
-          , data_available_(false)
         {
             HPX_ASSERT(false);    // shouldn't ever be called
         }
 
-        explicit communicator_server(std::size_t num_sites) noexcept
-          : data_()
-          , gate_(num_sites)
-          , num_sites_(num_sites)
-          , needs_initialization_(true)
-          , data_available_(false)
+        explicit communicator_server(std::size_t num_sites)
+          : num_sites_(num_sites)
+          , site_generations_(num_sites, 0)
         {
             HPX_ASSERT(num_sites != 0);
         }
@@ -107,72 +105,115 @@ namespace hpx { namespace collectives { namespace detail {
         };
 
     private:
-        // re-initialize data
-        template <typename T, typename Lock>
-        void reinitialize_data(Lock& l, std::size_t num_values)
+        // Every generation of a collective operation has its own slot which
+        // is created by the first site checking in and which is removed once
+        // all sites have received their result. Sites may check in for later
+        // generations while earlier ones are still in flight.
+        struct generation_data
         {
-            HPX_ASSERT_OWNS_LOCK(l);
-            if (needs_initialization_)
+            explicit generation_data(std::size_t num_sites)
+              : received_(num_sites)
+              , ready_(promise_.get_shared_future())
             {
-                needs_initialization_ = false;
-                data_available_ = false;
-                data_ = std::vector<T>(
-                    num_values == std::size_t(-1) ? num_sites_ : num_values);
             }
-        }
 
-        template <typename T, typename Lock>
-        std::vector<T>& access_data(
-            Lock& l, std::size_t num_values = std::size_t(-1))
+            hpx::unique_any_nonser data_;
+            hpx::detail::dynamic_bitset<> received_;
+            hpx::promise<void> promise_;
+            hpx::shared_future<void> ready_;
+            std::size_t num_finished_ = 0;
+            bool data_available_ = false;
+        };
+
+        using generations_type = std::map<std::size_t, generation_data>;
+
+        // Calls without explicit generation number refer to the generation
+        // following the largest one the calling site has used so far. Calls
+        // with explicit generation numbers may arrive in any order.
+        template <typename Lock>
+        std::size_t get_generation(
+            Lock& l, std::size_t which, std::size_t generation)
         {
             HPX_ASSERT_OWNS_LOCK(l);
-            reinitialize_data<T>(l, num_values);
-            return hpx::any_cast<std::vector<T>&>(data_);
+
+            if (which >= num_sites_)
+            {
+                l.unlock();
+                HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                    "communicator_server::get_generation",
+                    "the site index is out of range for this communicator");
+            }
+
+            std::size_t& last_generation = site_generations_[which];
+            if (generation == std::size_t(-1))
+            {
+                generation = last_generation + 1;
+            }
+            if (generation > last_generation)
+            {
+                last_generation = generation;
+            }
+            return generation;
         }
 
-        template <typename Lock>
-        void invalidate_data(Lock& l) noexcept
+        template <typename T, typename Lock>
+        typename generations_type::iterator get_generation_data(
+            Lock& l, std::size_t generation, std::size_t num_values)
         {
             HPX_ASSERT_OWNS_LOCK(l);
-            if (!needs_initialization_)
+
+            auto it = generations_.find(generation);
+            if (it == generations_.end())
             {
-                needs_initialization_ = true;
-                data_available_ = false;
-                data_.reset();
+                it = generations_.emplace(generation, num_sites_).first;
+                it->second.data_ = std::vector<T>(
+                    num_values == std::size_t(-1) ? num_sites_ : num_values);
             }
+            return it;
         }
 
+        template <typename T>
+        static std::vector<T>& access_data(generation_data& data)
+        {
+            return hpx::any_cast<std::vector<T>&>(data.data_);
+        }
+
+        // record that a site has received its result, the slot is released
+        // as soon as all sites are done with it
         template <typename Lock>
-        void set_and_invalidate_data(
-            std::size_t which, std::size_t generation, Lock l) noexcept
+        void release_generation_data(
+            Lock& l, typename generations_type::iterator it) noexcept
         {
             HPX_ASSERT_OWNS_LOCK(l);
-
-            // set() consumes lock
-            if (gate_.set(which, HPX_MOVE(l)))
+            if (++it->second.num_finished_ == num_sites_)
             {
-                l = Lock(mtx_);
-                if (generation != std::size_t(-1))
-                {
-                    gate_.next_generation(l, generation);
-                }
-                invalidate_data(l);
+                generations_.erase(it);
             }
         }
 
-        template <typename F, typename Lock>
-        auto get_future_and_synchronize(std::size_t generation, F&& f, Lock& l)
+        template <typename Lock>
+        void set_received(Lock& l, std::size_t which,
+            typename generations_type::iterator it)
         {
             HPX_ASSERT_OWNS_LOCK(l);
-            auto fut = gate_.get_shared_future(l).then(
-                hpx::launch::sync, HPX_FORWARD(F, f));
 
-            gate_.synchronize(generation == std::size_t(-1) ?
-                    gate_.generation(l) :
-                    generation,
-                l);
+            generation_data& data = it->second;
+            if (data.received_.test(which))
+            {
+                l.unlock();
+                HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                    "communicator_server::set_received",
+                    "the given site has already checked in for this "
+                    "generation");
+            }
 
-            return fut;
+            data.received_.set(which);
+            if (data.received_.count() == num_sites_)
+            {
+                hpx::promise<void> p = HPX_MOVE(data.promise_);
+                l.unlock();
+                p.set_value();    // fire event
+            }
         }
 
         // Step will be invoked under lock for each site that checks in (either
@@ -183,48 +224,57 @@ namespace hpx { namespace collectives { namespace detail {
         auto handle_data(std::size_t which, std::size_t generation, Step&& step,
             Finalizer&& finalizer, std::size_t num_values = std::size_t(-1))
         {
-            auto on_ready = [this, num_values,
+            std::unique_lock l(mtx_);
+            util::ignore_while_checking il(&l);
+            HPX_UNUSED(il);
+
+            generation = get_generation(l, which, generation);
+            auto it = get_generation_data<Data>(l, generation, num_values);
+
+            auto on_ready = [this, generation,
                                 finalizer = HPX_FORWARD(Finalizer, finalizer)](
                                 shared_future<void>&& f) mutable {
                 f.get();    // propagate any exceptions
 
+                std::unique_lock l(mtx_);
+                util::ignore_while_checking il(&l);
+                HPX_UNUSED(il);
+
+                auto it = generations_.find(generation);
+                HPX_ASSERT(it != generations_.end());
+
                 if constexpr (!std::is_same_v<std::nullptr_t,
                                   std::decay_t<Finalizer>>)
                 {
-                    std::unique_lock l(mtx_);
-                    util::ignore_while_checking il(&l);
-                    HPX_UNUSED(il);
-
                     // call provided finalizer
-                    return HPX_FORWARD(Finalizer, finalizer)(
-                        access_data<Data>(l, num_values), data_available_);
+                    auto result = HPX_FORWARD(Finalizer, finalizer)(
+                        access_data<Data>(it->second),
+                        it->second.data_available_);
+
+                    release_generation_data(l, it);
+                    return result;
                 }
                 else
                 {
-                    HPX_UNUSED(this);
-                    HPX_UNUSED(num_values);
                     HPX_UNUSED(finalizer);
+                    release_generation_data(l, it);
                 }
             };
 
-            std::unique_lock l(mtx_);
-            util::ignore_while_checking il(&l);
-            HPX_UNUSED(il);
-
             auto f =
-                get_future_and_synchronize(generation, HPX_MOVE(on_ready), l);
+                it->second.ready_.then(hpx::launch::sync, HPX_MOVE(on_ready));
 
             if constexpr (!std::is_same_v<std::nullptr_t, std::decay_t<Step>>)
             {
                 // call provided step function for each invocation site
-                HPX_FORWARD(Step, step)(access_data<Data>(l, num_values));
+                HPX_FORWARD(Step, step)(access_data<Data>(it->second));
             }
             else
             {
                 HPX_UNUSED(step);
             }
 
-            set_and_invalidate_data(which, generation, HPX_MOVE(l));
+            set_received(l, which, it);
 
             return f;
         }
@@ -249,11 +299,9 @@ namespace hpx { namespace collectives { namespace detail {
 
     private:
         mutex_type mtx_;
-        hpx::unique_any_nonser data_;
-        lcos::local::and_gate gate_;
         std::size_t const num_sites_;
-        bool needs_initialization_;
-        bool data_available_;
+        std::vector<std::size_t> site_generations_;
+        generations_type generations_;
     };
 }}}    // namespace hpx::collectives::detail
 
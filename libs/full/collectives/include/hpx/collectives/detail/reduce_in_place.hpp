@@ -0,0 +1,110 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/modules/errors.hpp>
+
+#if defined(HPX_HAVE_DATAPAR)
+#include <hpx/parallel/algorithms/transform.hpp>
+#include <hpx/parallel/datapar.hpp>
+#endif
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace collectives { namespace detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Reducing vectors of arithmetic values using std::plus or
+    // std::multiplies is performed element-wise, accumulating all values into
+    // a single buffer.
+    template <typename F>
+    struct element_operation
+    {
+        using type = void;
+    };
+
+    template <typename U>
+    struct element_operation<std::plus<U>>
+    {
+        using type = std::plus<>;
+    };
+
+    template <typename U>
+    struct element_operation<std::multiplies<U>>
+    {
+        using type = std::multiplies<>;
+    };
+
+    template <typename T, typename F>
+    struct is_in_place_reduction : std::false_type
+    {
+    };
+
+    template <typename T, typename Allocator, typename U>
+    struct is_in_place_reduction<std::vector<T, Allocator>, std::plus<U>>
+      : std::integral_constant<bool,
+            std::is_arithmetic_v<T> && !std::is_same_v<T, bool> &&
+                (std::is_void_v<U> || std::is_same_v<T, U>)>
+    {
+    };
+
+    template <typename T, typename Allocator, typename U>
+    struct is_in_place_reduction<std::vector<T, Allocator>, std::multiplies<U>>
+      : std::integral_constant<bool,
+            std::is_arithmetic_v<T> && !std::is_same_v<T, bool> &&
+                (std::is_void_v<U> || std::is_same_v<T, U>)>
+    {
+    };
+
+    template <typename T, typename F>
+    inline constexpr bool is_in_place_reduction_v =
+        is_in_place_reduction<std::decay_t<T>, std::decay_t<F>>::value;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // accumulate the elements of value into accumulator
+    template <typename F, typename T, typename Allocator>
+    void reduce_in_place(std::vector<T, Allocator>& accumulator,
+        std::vector<T, Allocator> const& value)
+    {
+        if (accumulator.size() != value.size())
+        {
+            HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                "hpx::collectives::detail::reduce_in_place",
+                "all reduced vectors must have the same size");
+        }
+
+        using op_type = typename element_operation<std::decay_t<F>>::type;
+#if defined(HPX_HAVE_DATAPAR)
+        hpx::transform(hpx::execution::simd, accumulator.begin(),
+            accumulator.end(), value.begin(), accumulator.begin(), op_type{});
+#else
+        std::transform(accumulator.begin(), accumulator.end(), value.begin(),
+            accumulator.begin(), op_type{});
+#endif
+    }
+
+    // combine two values, reuses the storage of lhs if possible
+    template <typename T, typename F>
+    T reduce_values(F& op, T&& lhs, T&& rhs)
+    {
+        if constexpr (is_in_place_reduction_v<T, F>)
+        {
+            reduce_in_place<F>(lhs, rhs);
+            return HPX_MOVE(lhs);
+        }
+        else
+        {
+            return T(op(HPX_MOVE(lhs), HPX_MOVE(rhs)));
+        }
+    }
+}}}    // namespace hpx::collectives::detail
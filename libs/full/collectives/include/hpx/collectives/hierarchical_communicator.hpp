@@ -0,0 +1,303 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file hierarchical_communicator.hpp
+
+#pragma once
+
+#if defined(DOXYGEN)
+// clang-format off
+namespace hpx { namespace collectives {
+
+    /// Create a communicator for several sites on each locality
+    ///
+    /// The collective operations invoked on the returned communicator first
+    /// combine the values of all sites on the same locality, then exchange a
+    /// single value per locality between all localities, and finally hand
+    /// the result to all sites on the locality.
+    ///
+    /// \param  basename    The base name identifying the communicator. The
+    ///                     same name has to be used on all localities.
+    /// \param  num_local_sites The number of participating sites on this
+    ///                     locality.
+    /// \param  local_site  The sequence number of this site on this
+    ///                     locality.
+    /// \param  generation  The generational counter identifying the sequence
+    ///                     number of the communicator (optional).
+    ///
+    /// \returns    This function returns a communicator which can be used
+    ///             with \a all_reduce and \a all_gather.
+    ///
+    hierarchical_communicator create_hierarchical_communicator(
+        char const* basename, num_sites_arg num_local_sites,
+        this_site_arg local_site,
+        generation_arg generation = generation_arg());
+
+    /// AllReduce a set of values from all sites of a hierarchical communicator
+    ///
+    /// \param  comm        A communicator object returned from
+    ///                     \a create_hierarchical_communicator
+    /// \param  local_result The value to transmit to all participating sites
+    ///                     from this call site.
+    /// \param  op          Reduction operation to apply to all values supplied
+    ///                     from all participating sites
+    /// \param  generation  The generational counter identifying the sequence
+    ///                     number of the all_reduce operation performed on the
+    ///                     given communicator. This is optional, the
+    ///                     operations are numbered consecutively otherwise.
+    ///
+    /// \returns    This function returns a future holding the reduced value.
+    ///
+    template <typename T, typename F>
+    hpx::future<std::decay_t<T>> all_reduce(hierarchical_communicator comm,
+        T&& local_result, F&& op, generation_arg generation = generation_arg());
+
+    /// AllGather a set of values from all sites of a hierarchical communicator
+    ///
+    /// \param  comm        A communicator object returned from
+    ///                     \a create_hierarchical_communicator
+    /// \param  local_result The value to transmit to all participating sites
+    ///                     from this call site.
+    /// \param  generation  The generational counter identifying the sequence
+    ///                     number of the all_gather operation performed on the
+    ///                     given communicator. This is optional, the
+    ///                     operations are numbered consecutively otherwise.
+    ///
+    /// \returns    This function returns a future holding a vector with all
+    ///             values, ordered by locality and by the site on each
+    ///             locality.
+    ///
+    template <typename T>
+    hpx::future<std::vector<std::decay_t<T>>> all_gather(
+        hierarchical_communicator comm, T&& local_result,
+        generation_arg generation = generation_arg());
+}}    // namespace hpx::collectives
+
+// clang-format on
+#else
+
+#include <hpx/config.hpp>
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+
+#include <hpx/assert.hpp>
+#include <hpx/async_base/launch_policy.hpp>
+#include <hpx/async_local/dataflow.hpp>
+#include <hpx/collectives/all_gather.hpp>
+#include <hpx/collectives/all_reduce.hpp>
+#include <hpx/collectives/argument_types.hpp>
+#include <hpx/collectives/broadcast.hpp>
+#include <hpx/collectives/create_communicator.hpp>
+#include <hpx/collectives/gather.hpp>
+#include <hpx/collectives/reduce.hpp>
+#include <hpx/futures/future.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace collectives {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // A hierarchical communicator combines a communicator for all sites on
+    // this locality (rooted at local site zero) with a communicator for one
+    // site per locality (only available on local site zero).
+    class hierarchical_communicator
+    {
+    private:
+        friend HPX_EXPORT hierarchical_communicator
+        create_hierarchical_communicator(char const* basename,
+            num_sites_arg num_local_sites, this_site_arg local_site,
+            generation_arg generation);
+
+        HPX_EXPORT hierarchical_communicator(communicator local,
+            communicator global, std::size_t num_local_sites,
+            std::size_t local_site);
+
+    public:
+        hierarchical_communicator() = default;
+
+        // the communicator between the sites on this locality
+        communicator const& local() const noexcept
+        {
+            return local_;
+        }
+
+        // the communicator between the localities
+        communicator const& global() const noexcept
+        {
+            HPX_ASSERT(local_site_ == 0);
+            return global_;
+        }
+
+        // return the number of sites on this locality and the sequence
+        // number of this site on this locality
+        std::pair<std::size_t, std::size_t> get_info() const noexcept
+        {
+            return std::make_pair(num_local_sites_, local_site_);
+        }
+
+        std::size_t locality() const noexcept
+        {
+            return locality_;
+        }
+
+        // Every operation uses two generations of the local communicator
+        // (to combine the local values, and to hand out the result) and one
+        // generation of the global communicator.
+        HPX_EXPORT std::size_t next_generation(std::size_t generation);
+
+    private:
+        communicator local_;
+        communicator global_;
+        std::size_t num_local_sites_ = 0;
+        std::size_t local_site_ = 0;
+        std::size_t locality_ = 0;
+        std::shared_ptr<std::atomic<std::size_t>> generation_;
+    };
+
+    HPX_EXPORT hierarchical_communicator create_hierarchical_communicator(
+        char const* basename, num_sites_arg num_local_sites,
+        this_site_arg local_site, generation_arg generation = generation_arg());
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T, typename F>
+    hpx::future<std::decay_t<T>> all_reduce(hierarchical_communicator comm,
+        T&& local_result, F&& op, generation_arg generation = generation_arg())
+    {
+        using arg_type = std::decay_t<T>;
+
+        if (generation == 0)
+        {
+            return hpx::make_exceptional_future<arg_type>(HPX_GET_EXCEPTION(
+                hpx::bad_parameter, "hpx::collectives::all_reduce",
+                "the generation number shouldn't be zero"));
+        }
+
+        std::size_t const global_generation = comm.next_generation(generation);
+        generation_arg const combine_generation(2 * global_generation - 1);
+        generation_arg const result_generation(2 * global_generation);
+
+        std::size_t const local_site = comm.get_info().second;
+        if (local_site != 0)
+        {
+            // hand the value to the local root, receive the result from it
+            return hpx::dataflow(
+                hpx::launch::sync,
+                [](hpx::future<void>&& sent, hpx::future<arg_type>&& result) {
+                    sent.get();    // propagate exceptions
+                    return result.get();
+                },
+                reduce_there(comm.local(), HPX_FORWARD(T, local_result),
+                    this_site_arg(local_site), combine_generation),
+                broadcast_from<arg_type>(comm.local(),
+                    this_site_arg(local_site), result_generation));
+        }
+
+        std::decay_t<F> global_op = op;
+        hpx::future<arg_type> local_reduced =
+            reduce_here(comm.local(), HPX_FORWARD(T, local_result),
+                HPX_FORWARD(F, op), this_site_arg(0), combine_generation);
+
+        // exchange one value per locality
+        hpx::future<arg_type> reduced = local_reduced.then(hpx::launch::sync,
+            [comm, global_op = HPX_MOVE(global_op), global_generation](
+                hpx::future<arg_type>&& f) mutable {
+                return all_reduce(comm.global(), f.get(), HPX_MOVE(global_op),
+                    this_site_arg(comm.locality()),
+                    generation_arg(global_generation));
+            });
+
+        return reduced.then(hpx::launch::sync,
+            [comm, result_generation](hpx::future<arg_type>&& f) {
+                return broadcast_to(comm.local(), f.get(), this_site_arg(0),
+                    result_generation);
+            });
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T>
+    hpx::future<std::vector<std::decay_t<T>>> all_gather(
+        hierarchical_communicator comm, T&& local_result,
+        generation_arg generation = generation_arg())
+    {
+        using arg_type = std::decay_t<T>;
+        using result_type = std::vector<arg_type>;
+
+        if (generation == 0)
+        {
+            return hpx::make_exceptional_future<result_type>(
+                HPX_GET_EXCEPTION(hpx::bad_parameter,
+                    "hpx::collectives::all_gather",
+                    "the generation number shouldn't be zero"));
+        }
+
+        std::size_t const global_generation = comm.next_generation(generation);
+        generation_arg const combine_generation(2 * global_generation - 1);
+        generation_arg const result_generation(2 * global_generation);
+
+        std::size_t const local_site = comm.get_info().second;
+        if (local_site != 0)
+        {
+            // hand the value to the local root, receive the result from it
+            return hpx::dataflow(
+                hpx::launch::sync,
+                [](hpx::future<void>&& sent,
+                    hpx::future<result_type>&& result) {
+                    sent.get();    // propagate exceptions
+                    return result.get();
+                },
+                gather_there(comm.local(), HPX_FORWARD(T, local_result),
+                    this_site_arg(local_site), combine_generation),
+                broadcast_from<result_type>(comm.local(),
+                    this_site_arg(local_site), result_generation));
+        }
+
+        hpx::future<result_type> local_gathered =
+            gather_here(comm.local(), HPX_FORWARD(T, local_result),
+                this_site_arg(0), combine_generation);
+
+        // exchange the values of all sites of a locality at once
+        hpx::future<std::vector<result_type>> gathered =
+            local_gathered.then(hpx::launch::sync,
+                [comm, global_generation](hpx::future<result_type>&& f) {
+                    return all_gather(comm.global(), f.get(),
+                        this_site_arg(comm.locality()),
+                        generation_arg(global_generation));
+                });
+
+        return gathered.then(hpx::launch::sync,
+            [comm, result_generation](
+                hpx::future<std::vector<result_type>>&& f) {
+                std::vector<result_type> values = f.get();
+
+                std::size_t size = 0;
+                for (auto const& v : values)
+                {
+                    size += v.size();
+                }
+
+                result_type result;
+                result.reserve(size);
+                for (auto& v : values)
+                {
+                    result.insert(result.end(),
+                        std::make_move_iterator(v.begin()),
+                        std::make_move_iterator(v.end()));
+                }
+
+                return broadcast_to(comm.local(), HPX_MOVE(result),
+                    this_site_arg(0), result_generation);
+            });
+    }
+}}    // namespace hpx::collectives
+
+#endif    // !HPX_COMPUTE_DEVICE_CODE
+#endif    // DOXYGEN
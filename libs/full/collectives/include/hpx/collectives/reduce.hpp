@@ -221,6 +221,7 @@ namespace hpx { namespace collectives {
 #include <hpx/async_distributed/async.hpp>
 #include <hpx/collectives/argument_types.hpp>
 #include <hpx/collectives/create_communicator.hpp>
+#include <hpx/collectives/detail/reduce_in_place.hpp>
 #include <hpx/components_base/agas_interface.hpp>
 #include <hpx/futures/future.hpp>
 #include <hpx/parallel/algorithms/reduce.hpp>
@@ -253,14 +254,32 @@ namespace hpx { namespace traits {
                 // finalizer (invoked after all data has been received)
                 [op = HPX_FORWARD(F, op)](auto& data, bool&) mutable {
                     HPX_ASSERT(!data.empty());
-                    if (data.size() > 1)
+                    if constexpr (collectives::detail::is_in_place_reduction_v<
+                                      T, F>)
                     {
+                        // accumulate into the root's buffer, releasing the
+                        // other contributions as they are consumed
+                        for (std::size_t i = 1; i != data.size(); ++i)
+                        {
+                            collectives::detail::reduce_in_place<F>(
+                                data[0], data[i]);
+                            std::decay_t<T>().swap(data[i]);
+                        }
+                        HPX_UNUSED(op);
                         return Communicator::template handle_bool<
-                            std::decay_t<T>>(hpx::reduce(++data.begin(),
-                            data.end(), data[0], HPX_FORWARD(F, op)));
+                            std::decay_t<T>>(data[0]);
+                    }
+                    else
+                    {
+                        if (data.size() > 1)
+                        {
+                            return Communicator::template handle_bool<
+                                std::decay_t<T>>(hpx::reduce(++data.begin(),
+                                data.end(), data[0], HPX_FORWARD(F, op)));
+                        }
+                        return Communicator::template handle_bool<
+                            std::decay_t<T>>(data[0]);
                     }
-                    return Communicator::template handle_bool<std::decay_t<T>>(
-                        data[0]);
                 });
         }
 
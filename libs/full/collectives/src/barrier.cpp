@@ -8,6 +8,7 @@
 #include <hpx/async_base/launch_policy.hpp>
 #include <hpx/async_combinators/when_all.hpp>
 #include <hpx/collectives/barrier.hpp>
+#include <hpx/collectives/detail/barrier_algorithms.hpp>
 #include <hpx/components/basename_registration.hpp>
 #include <hpx/components_base/server/component_heap.hpp>
 #include <hpx/modules/execution.hpp>
@@ -19,6 +20,7 @@
 #include <hpx/type_support/unused.hpp>
 
 #include <cstddef>
+#include <memory>
 #include <string>
 #include <utility>
 #include <vector>
@@ -87,10 +89,42 @@ namespace hpx { namespace distributed {
         }
     }
 
+    barrier::barrier(std::string const& base_name, std::size_t num,
+        std::size_t rank, barrier_algorithm algorithm,
+        std::size_t num_local_participants)
+    {
+        if (algorithm == barrier_algorithm::tree)
+        {
+            node_.reset(
+                new (hpx::components::component_heap<wrapping_type>().alloc())
+                    wrapping_type(new wrapped_type(base_name, num, rank)));
+
+            if ((*node_)->num_ >= (*node_)->cut_off_ || (*node_)->rank_ == 0)
+            {
+                register_with_basename(
+                    base_name, node_->get_unmanaged_id(), (*node_)->rank_)
+                    .get();
+            }
+        }
+        else
+        {
+            point_to_point_ = std::make_shared<detail::point_to_point_barrier>(
+                base_name, num, rank, algorithm);
+        }
+
+        if (num_local_participants > 1)
+        {
+            local_step_ = std::make_shared<detail::barrier_local_step>(
+                num_local_participants);
+        }
+    }
+
     barrier::barrier() = default;
 
     barrier::barrier(barrier&& other)
       : node_(HPX_MOVE(other.node_))
+      , point_to_point_(HPX_MOVE(other.point_to_point_))
+      , local_step_(HPX_MOVE(other.local_step_))
     {
         other.node_.reset();
     }
@@ -99,6 +133,8 @@ namespace hpx { namespace distributed {
     {
         release();
         node_ = HPX_MOVE(other.node_);
+        point_to_point_ = HPX_MOVE(other.point_to_point_);
+        local_step_ = HPX_MOVE(other.local_step_);
         other.node_.reset();
 
         return *this;
@@ -109,18 +145,61 @@ namespace hpx { namespace distributed {
         release();
     }
 
+    hpx::future<void> barrier::wait_all_sites(bool async)
+    {
+        if (point_to_point_)
+        {
+            return point_to_point_->wait();
+        }
+        return (*node_)->wait(async);
+    }
+
     void barrier::wait()
     {
-        (*node_)->wait(false).get();
+        if (local_step_)
+        {
+            wait(hpx::launch::async).get();
+            return;
+        }
+        wait_all_sites(false).get();
     }
 
     hpx::future<void> barrier::wait(hpx::launch::async_policy)
     {
-        return (*node_)->wait(true);
+        if (local_step_)
+        {
+            // only the last local participant synchronizes with the other
+            // sites
+            return local_step_->arrive(
+                [this]() { return wait_all_sites(true); });
+        }
+        return wait_all_sites(true);
     }
 
     void barrier::release()
     {
+        local_step_.reset();
+
+        if (point_to_point_)
+        {
+            if (hpx::get_runtime_ptr() != nullptr &&
+                hpx::threads::threadmanager_is(hpx::state::running) &&
+                !hpx::is_stopped_or_shutting_down())
+            {
+                // make sure this runs as an HPX thread
+                if (hpx::threads::get_self_ptr() == nullptr)
+                {
+                    hpx::threads::run_as_hpx_thread(&barrier::release, this);
+                    return;
+                }
+
+                // we need to wait on everyone to be done with the barrier
+                // before its channels go away
+                point_to_point_->wait().get();
+            }
+            point_to_point_.reset();
+        }
+
         if (node_)
         {
             if (hpx::get_runtime_ptr() != nullptr &&
@@ -159,6 +238,9 @@ namespace hpx { namespace distributed {
 
     void barrier::detach()
     {
+        local_step_.reset();
+        point_to_point_.reset();
+
         if (node_)
         {
             if (hpx::get_runtime_ptr() != nullptr &&
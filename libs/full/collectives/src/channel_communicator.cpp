@@ -22,6 +22,7 @@
 #include <cstddef>
 #include <memory>
 #include <utility>
+#include <vector>
 
 ///////////////////////////////////////////////////////////////////////////////
 namespace hpx { namespace collectives {
@@ -42,6 +43,12 @@ namespace hpx { namespace collectives {
         comm_.reset();
     }
 
+    hpx::future<void> channel_communicator::resolve(
+        std::vector<std::size_t> const& sites) const
+    {
+        return comm_->resolve(sites);
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     hpx::future<channel_communicator> create_channel_communicator(
         char const* basename, num_sites_arg num_sites, this_site_arg this_site)
@@ -0,0 +1,87 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+
+#include <hpx/assert.hpp>
+#include <hpx/collectives/create_communicator.hpp>
+#include <hpx/collectives/hierarchical_communicator.hpp>
+#include <hpx/components_base/agas_interface.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <utility>
+
+namespace hpx { namespace collectives {
+
+    ///////////////////////////////////////////////////////////////////////////
+    hierarchical_communicator::hierarchical_communicator(communicator local,
+        communicator global, std::size_t num_local_sites,
+        std::size_t local_site)
+      : local_(HPX_MOVE(local))
+      , global_(HPX_MOVE(global))
+      , num_local_sites_(num_local_sites)
+      , local_site_(local_site)
+      , locality_(static_cast<std::size_t>(agas::get_locality_id()))
+      , generation_(std::make_shared<std::atomic<std::size_t>>(0))
+    {
+    }
+
+    std::size_t hierarchical_communicator::next_generation(
+        std::size_t generation)
+    {
+        HPX_ASSERT(generation_);
+        if (generation == std::size_t(-1))
+        {
+            return ++*generation_;
+        }
+
+        // operations without explicit generation number continue after the
+        // largest generation used so far
+        std::size_t current = generation_->load();
+        while (current < generation &&
+            !generation_->compare_exchange_weak(current, generation))
+        {
+        }
+        return generation;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    hierarchical_communicator create_hierarchical_communicator(
+        char const* basename, num_sites_arg num_local_sites,
+        this_site_arg local_site, generation_arg generation)
+    {
+        HPX_ASSERT(num_local_sites != std::size_t(-1));
+        HPX_ASSERT(local_site < num_local_sites);
+
+        std::size_t const locality =
+            static_cast<std::size_t>(agas::get_locality_id());
+
+        // the communicator between the sites on this locality is created by
+        // the local site zero, i.e. on this locality
+        std::string const name(basename);
+        communicator local = create_communicator(
+            (name + "/local/" + std::to_string(locality) + "/").c_str(),
+            num_local_sites, local_site, generation, root_site_arg(0));
+
+        communicator global;
+        if (local_site == 0)
+        {
+            global = create_communicator((name + "/global/").c_str(),
+                num_sites_arg(), this_site_arg(locality), generation,
+                root_site_arg(0));
+        }
+
+        return hierarchical_communicator(HPX_MOVE(local), HPX_MOVE(global),
+            num_local_sites, local_site);
+    }
+}}    // namespace hpx::collectives
+
+#endif    // !HPX_COMPUTE_DEVICE_CODE
@@ -0,0 +1,221 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+
+#include <hpx/assert.hpp>
+#include <hpx/async_base/launch_policy.hpp>
+#include <hpx/async_local/async.hpp>
+#include <hpx/collectives/argument_types.hpp>
+#include <hpx/collectives/barrier.hpp>
+#include <hpx/collectives/channel_communicator.hpp>
+#include <hpx/collectives/detail/barrier_algorithms.hpp>
+#include <hpx/functional/function.hpp>
+#include <hpx/futures/future.hpp>
+#include <hpx/futures/promise.hpp>
+#include <hpx/modules/logging.hpp>
+#include <hpx/type_support/unused.hpp>
+
+#include <cstddef>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace hpx::distributed::detail {
+
+    namespace {
+
+        // every invocation of a barrier uses a range of tags large enough
+        // for the notifications of all rounds
+        constexpr std::size_t max_rounds = 64;
+
+        hpx::future<void> notify(
+            hpx::collectives::channel_communicator const& comm,
+            std::size_t site, std::size_t generation, std::size_t tag)
+        {
+            return hpx::collectives::set(comm,
+                hpx::collectives::that_site_arg(site), generation,
+                hpx::collectives::tag_arg(tag));
+        }
+
+        void wait_for(hpx::collectives::channel_communicator const& comm,
+            std::size_t site, std::size_t generation, std::size_t tag)
+        {
+            hpx::future<std::size_t> f = hpx::collectives::get<std::size_t>(
+                comm, hpx::collectives::that_site_arg(site),
+                hpx::collectives::tag_arg(tag));
+
+            std::size_t const value = f.get();
+            HPX_ASSERT(value == generation);
+            HPX_UNUSED(value);
+            HPX_UNUSED(generation);
+        }
+
+        void wait_for_notifications(std::vector<hpx::future<void>>& sets)
+        {
+            for (auto& f : sets)
+            {
+                f.get();    // propagate exceptions
+            }
+        }
+
+        // In round k every site notifies the site at distance 2^k and waits
+        // for the notification from the site at distance -2^k.
+        void dissemination(hpx::collectives::channel_communicator const& comm,
+            std::size_t generation)
+        {
+            auto [num, rank] = comm.get_info();
+            std::size_t const tag_base = generation * 2 * max_rounds;
+
+            std::vector<hpx::future<void>> sets;
+            std::size_t round = 0;
+            for (std::size_t distance = 1; distance < num;
+                 distance <<= 1, ++round)
+            {
+                sets.push_back(notify(comm, (rank + distance) % num,
+                    generation, tag_base + round));
+                wait_for(comm, (rank + num - distance) % num, generation,
+                    tag_base + round);
+            }
+
+            wait_for_notifications(sets);
+        }
+
+        // In round k the site with the rank r (r % 2^(k+1) == 0) is matched
+        // with the site r + 2^k. The loser notifies the winner and waits to
+        // be released, the winner continues with the next round. The overall
+        // winner (rank zero) starts releasing the sites in reverse order.
+        void tournament(hpx::collectives::channel_communicator const& comm,
+            std::size_t generation)
+        {
+            auto [num, rank] = comm.get_info();
+            std::size_t const tag_base = generation * 2 * max_rounds;
+
+            std::vector<hpx::future<void>> sets;
+            std::size_t round = 0;
+            std::size_t distance = 1;
+            for (/**/; distance < num; distance <<= 1, ++round)
+            {
+                if (rank & distance)
+                {
+                    sets.push_back(notify(
+                        comm, rank - distance, generation, tag_base + round));
+                    wait_for(comm, rank - distance, generation,
+                        tag_base + max_rounds + round);
+                    break;
+                }
+
+                if (rank + distance < num)
+                {
+                    wait_for(comm, rank + distance, generation,
+                        tag_base + round);
+                }
+            }
+
+            // release all sites this site has won against
+            while (round != 0)
+            {
+                --round;
+                distance >>= 1;
+                if (rank + distance < num)
+                {
+                    sets.push_back(notify(comm, rank + distance, generation,
+                        tag_base + max_rounds + round));
+                }
+            }
+
+            wait_for_notifications(sets);
+        }
+    }    // namespace
+
+    ///////////////////////////////////////////////////////////////////////////
+    point_to_point_barrier::point_to_point_barrier(std::string const& base_name,
+        std::size_t num, std::size_t rank, barrier_algorithm algorithm)
+      : comm_(hpx::collectives::create_channel_communicator(hpx::launch::sync,
+            base_name.c_str(), hpx::collectives::num_sites_arg(num),
+            hpx::collectives::this_site_arg(rank)))
+      , algorithm_(algorithm)
+      , generation_(0)
+    {
+        HPX_ASSERT(algorithm == barrier_algorithm::dissemination ||
+            algorithm == barrier_algorithm::tournament);
+
+        LAPP_(info).format("creating point_to_point_barrier: base_name({}), "
+                           "num({}), rank({}), algorithm({})",
+            base_name, num, rank, static_cast<int>(algorithm));
+    }
+
+    hpx::future<void> point_to_point_barrier::wait()
+    {
+        std::size_t const generation = ++generation_;
+        if (comm_.get_info().first == 1)
+        {
+            return hpx::make_ready_future();
+        }
+
+        return hpx::async(
+            [comm = comm_, algorithm = algorithm_, generation]() {
+                if (algorithm == barrier_algorithm::dissemination)
+                {
+                    dissemination(comm, generation);
+                }
+                else
+                {
+                    tournament(comm, generation);
+                }
+            });
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    barrier_local_step::barrier_local_step(std::size_t num_local_participants)
+      : num_local_participants_(num_local_participants)
+      , arrived_(0)
+      , result_(promise_.get_shared_future())
+    {
+        HPX_ASSERT(num_local_participants != 0);
+    }
+
+    hpx::future<void> barrier_local_step::arrive(
+        hpx::function<hpx::future<void>()> const& wait_all_sites)
+    {
+        std::unique_lock<hpx::spinlock> l(mtx_);
+
+        hpx::shared_future<void> result = result_;
+        if (++arrived_ != num_local_participants_)
+        {
+            return hpx::make_future<void>(HPX_MOVE(result));
+        }
+
+        // the last local participant prepares the next invocation and
+        // synchronizes with the other sites
+        arrived_ = 0;
+        hpx::promise<void> p = HPX_MOVE(promise_);
+        promise_ = hpx::promise<void>();
+        result_ = promise_.get_shared_future();
+
+        l.unlock();
+
+        hpx::future<void> f = wait_all_sites().then(hpx::launch::sync,
+            [p = HPX_MOVE(p)](hpx::future<void>&& f) mutable {
+                if (f.has_exception())
+                {
+                    p.set_exception(f.get_exception_ptr());
+                }
+                else
+                {
+                    p.set_value();
+                }
+            });
+        (void) f;    // don't wait for the future
+
+        return hpx::make_future<void>(HPX_MOVE(result));
+    }
+}    // namespace hpx::distributed::detail
+
+#endif    // !HPX_COMPUTE_DEVICE_CODE
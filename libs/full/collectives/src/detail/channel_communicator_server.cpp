@@ -9,14 +9,21 @@
 #if !defined(HPX_COMPUTE_DEVICE_CODE)
 
 #include <hpx/assert.hpp>
+#include <hpx/async_base/launch_policy.hpp>
+#include <hpx/async_combinators/when_all.hpp>
 #include <hpx/collectives/channel_communicator.hpp>
 #include <hpx/collectives/detail/channel_communicator.hpp>
 #include <hpx/components/basename_registration.hpp>
+#include <hpx/components/get_ptr.hpp>
+#include <hpx/components_base/agas_interface.hpp>
 #include <hpx/components_base/server/component.hpp>
+#include <hpx/naming_base/id_type.hpp>
 #include <hpx/runtime_components/component_factory.hpp>
 
 #include <cstddef>
+#include <memory>
 #include <utility>
+#include <vector>
 
 ///////////////////////////////////////////////////////////////////////////////
 using channel_communicator_component = hpx::components::component<
@@ -35,6 +42,62 @@ namespace hpx { namespace collectives { namespace detail {
     {
         // replace reference to our own client (manages base-name registration)
         clients_[this_site] = HPX_MOVE(here);
+
+        // resolve all sites once, the messages are sent directly to the
+        // resolved targets afterwards
+        targets_.reserve(num_sites);
+        for (auto const& client : clients_)
+        {
+            targets_.push_back(resolve_target(client));
+        }
+    }
+
+    hpx::future<void> channel_communicator::resolve(
+        std::vector<std::size_t> const& sites) const
+    {
+        std::vector<hpx::shared_future<target_data>> targets;
+        targets.reserve(sites.size() + 1);
+        targets.push_back(targets_[this_site_]);
+        for (std::size_t site : sites)
+        {
+            HPX_ASSERT(site < targets_.size());
+            targets.push_back(targets_[site]);
+        }
+
+        return hpx::when_all(HPX_MOVE(targets))
+            .then(hpx::launch::sync,
+                [](hpx::future<std::vector<hpx::shared_future<target_data>>>&&
+                        f) {
+                    // propagate exceptions
+                    for (auto const& target : f.get())
+                    {
+                        target.get();
+                    }
+                });
+    }
+
+    hpx::shared_future<channel_communicator::target_data>
+    channel_communicator::resolve_target(client_type client)
+    {
+        return client.then(hpx::launch::sync,
+            [](client_type&& c) -> hpx::future<target_data> {
+                hpx::id_type const id = c.get_id();
+                if (naming::get_locality_id_from_id(id) ==
+                    agas::get_locality_id())
+                {
+                    return hpx::get_ptr<channel_communicator_server>(id).then(
+                        hpx::launch::sync,
+                        [](hpx::future<std::shared_ptr<
+                                channel_communicator_server>>&& f) {
+                            return target_data{naming::address(), f.get()};
+                        });
+                }
+
+                return agas::resolve(id).then(hpx::launch::sync,
+                    [](hpx::future<naming::address>&& f) {
+                        return target_data{f.get(), nullptr};
+                    });
+            });
     }
 }}}    // namespace hpx::collectives::detail
 
@@ -0,0 +1,151 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+
+#include <hpx/assert.hpp>
+#include <hpx/collectives/argument_types.hpp>
+#include <hpx/collectives/detail/channel_algorithms.hpp>
+#include <hpx/collectives/detail/collective_schedule.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+namespace hpx { namespace collectives { namespace detail {
+
+    namespace {
+
+        schedule_step make_step(schedule_step::kind_type kind,
+            std::size_t partner, std::size_t tag, bool value_first = true,
+            bool move_value = false)
+        {
+            return schedule_step{kind, value_first, move_value, partner, tag};
+        }
+
+        // see all_reduce_recursive_doubling
+        void all_reduce_recursive_doubling(collective_schedule& schedule,
+            std::size_t num_sites, std::size_t this_site)
+        {
+            std::size_t const num_pairs = std::size_t(1) << log2(num_sites);
+            std::size_t const remaining = num_sites - num_pairs;
+            std::size_t const last_step = log2(num_pairs) + 1;
+
+            if (this_site >= num_pairs)
+            {
+                // the value is replaced by the result received afterwards
+                std::size_t const partner = this_site - num_pairs;
+                schedule.push_back(
+                    make_step(schedule_step::send, partner, 0, true, true));
+                schedule.push_back(
+                    make_step(schedule_step::receive, partner, last_step));
+                return;
+            }
+
+            if (this_site < remaining)
+            {
+                schedule.push_back(make_step(
+                    schedule_step::combine, this_site + num_pairs, 0));
+            }
+
+            std::size_t step = 1;
+            for (std::size_t mask = 1; mask < num_pairs; mask <<= 1, ++step)
+            {
+                std::size_t const partner = this_site ^ mask;
+                schedule.push_back(make_step(schedule_step::exchange, partner,
+                    step, this_site < partner));
+            }
+
+            HPX_ASSERT(step == last_step);
+            if (this_site < remaining)
+            {
+                schedule.push_back(make_step(
+                    schedule_step::send, this_site + num_pairs, last_step));
+            }
+        }
+
+        // see all_reduce_binomial_tree
+        void all_reduce_binomial_tree(collective_schedule& schedule,
+            std::size_t num_sites, std::size_t this_site)
+        {
+            std::size_t mask = 1;
+            for (std::size_t step = 0; mask < num_sites; mask <<= 1, ++step)
+            {
+                if (this_site & mask)
+                {
+                    // the value is replaced by the result received afterwards
+                    schedule.push_back(make_step(schedule_step::send,
+                        this_site - mask, step, true, true));
+                    break;
+                }
+                if (this_site + mask < num_sites)
+                {
+                    schedule.push_back(make_step(
+                        schedule_step::combine, this_site + mask, step));
+                }
+            }
+
+            std::size_t const bcast_base = max_tree_steps;
+            if (this_site != 0)
+            {
+                schedule.push_back(make_step(schedule_step::receive,
+                    this_site - mask, bcast_base + log2(mask)));
+            }
+
+            for (mask >>= 1; mask != 0; mask >>= 1)
+            {
+                if (this_site + mask < num_sites)
+                {
+                    schedule.push_back(make_step(schedule_step::send,
+                        this_site + mask, bcast_base + log2(mask)));
+                }
+            }
+        }
+    }    // namespace
+
+    ///////////////////////////////////////////////////////////////////////////
+    collective_schedule make_all_reduce_schedule(std::size_t num_sites,
+        std::size_t this_site, collective_algorithm algorithm)
+    {
+        HPX_ASSERT(this_site < num_sites);
+
+        collective_schedule schedule;
+        if (algorithm == collective_algorithm::binomial_tree)
+        {
+            all_reduce_binomial_tree(schedule, num_sites, this_site);
+        }
+        else
+        {
+            HPX_ASSERT(algorithm == collective_algorithm::recursive_doubling);
+            all_reduce_recursive_doubling(schedule, num_sites, this_site);
+        }
+        return schedule;
+    }
+
+    std::vector<std::size_t> get_schedule_partners(
+        collective_schedule const& schedule)
+    {
+        std::vector<std::size_t> partners;
+        partners.reserve(schedule.size());
+        for (schedule_step const& step : schedule)
+        {
+            if (step.kind == schedule_step::send ||
+                step.kind == schedule_step::exchange)
+            {
+                partners.push_back(step.partner);
+            }
+        }
+
+        std::sort(partners.begin(), partners.end());
+        partners.erase(
+            std::unique(partners.begin(), partners.end()), partners.end());
+        return partners;
+    }
+}}}    // namespace hpx::collectives::detail
+
+#endif    // !HPX_COMPUTE_DEVICE_CODE
@@ -99,12 +99,92 @@ void test_multiple_use_with_generation()
     }
 }
 
+void test_channel_communicator(
+    collective_algorithm algorithm, std::string const& basename)
+{
+    std::uint32_t num_localities = hpx::get_num_localities(hpx::launch::sync);
+    std::uint32_t here = hpx::get_locality_id();
+
+    auto comm = create_channel_communicator(hpx::launch::sync,
+        basename.c_str(), num_sites_arg(num_localities), this_site_arg(here));
+
+    for (int i = 0; i != 10; ++i)
+    {
+        std::uint32_t value = here;
+
+        hpx::future<std::vector<std::uint32_t>> overall_result = all_gather(
+            comm, value, generation_arg(i + 1), algorithm_arg(algorithm));
+
+        std::vector<std::uint32_t> r = overall_result.get();
+        HPX_TEST_EQ(r.size(), num_localities);
+
+        for (std::size_t j = 0; j != r.size(); ++j)
+        {
+            HPX_TEST_EQ(r[j], j);
+        }
+    }
+}
+
+void test_channel_communicator_local_sites(std::uint32_t num_sites,
+    collective_algorithm algorithm, std::string const& basename)
+{
+    // all sites are run on this locality
+    std::vector<channel_communicator> comms;
+    comms.reserve(num_sites);
+    for (std::uint32_t i = 0; i != num_sites; ++i)
+    {
+        comms.push_back(create_channel_communicator(hpx::launch::sync,
+            basename.c_str(), num_sites_arg(num_sites), this_site_arg(i)));
+    }
+
+    std::vector<hpx::future<std::vector<std::uint32_t>>> results;
+    results.reserve(num_sites);
+    for (std::uint32_t i = 0; i != num_sites; ++i)
+    {
+        results.push_back(all_gather(
+            comms[i], i, generation_arg(1), algorithm_arg(algorithm)));
+    }
+
+    for (auto& result : results)
+    {
+        std::vector<std::uint32_t> r = result.get();
+        HPX_TEST_EQ(r.size(), num_sites);
+
+        for (std::size_t j = 0; j != r.size(); ++j)
+        {
+            HPX_TEST_EQ(r[j], j);
+        }
+    }
+}
+
 int hpx_main()
 {
     test_one_shot_use();
     test_multiple_use();
     test_multiple_use_with_generation();
 
+    test_channel_communicator(
+        collective_algorithm::automatic, "/test/all_gather_channel/automatic/");
+    test_channel_communicator(
+        collective_algorithm::ring, "/test/all_gather_channel/ring/");
+
+    if (hpx::get_locality_id() == 0)
+    {
+        for (std::uint32_t num_sites : {1, 4, 7, 16})
+        {
+            std::string const basename =
+                "/test/all_gather_channel/local/" + std::to_string(num_sites);
+            test_channel_communicator_local_sites(
+                num_sites, collective_algorithm::ring, basename + "/ring/");
+            if ((num_sites & (num_sites - 1)) == 0)
+            {
+                test_channel_communicator_local_sites(num_sites,
+                    collective_algorithm::recursive_doubling,
+                    basename + "/recursive_doubling/");
+            }
+        }
+    }
+
     return hpx::finalize();
 }
 
@@ -12,7 +12,9 @@
 #include <hpx/modules/collectives.hpp>
 #include <hpx/modules/testing.hpp>
 
+#include <cstddef>
 #include <cstdint>
+#include <functional>
 #include <string>
 #include <utility>
 #include <vector>
@@ -98,11 +100,259 @@ void test_multiple_use_with_generation()
     }
 }
 
+void test_overlapping_generations()
+{
+    std::uint32_t num_localities = hpx::get_num_localities(hpx::launch::sync);
+    std::uint32_t here = hpx::get_locality_id();
+
+    auto all_reduce_direct_client =
+        create_communicator("/test/all_reduce_overlapping/",
+            num_sites_arg(num_localities), this_site_arg(here));
+
+    // start all generations at once, the later ones in reverse order
+    std::vector<hpx::future<std::uint32_t>> overall_results(10);
+    overall_results[0] = all_reduce(all_reduce_direct_client, here,
+        std::plus<std::uint32_t>{}, generation_arg(1));
+    for (int i = 9; i != 0; --i)
+    {
+        overall_results[i] = all_reduce(all_reduce_direct_client, here + i,
+            std::plus<std::uint32_t>{}, generation_arg(i + 1));
+    }
+
+    for (std::uint32_t i = 0; i != 10; ++i)
+    {
+        std::uint32_t sum = 0;
+        for (std::uint32_t j = 0; j != num_localities; ++j)
+        {
+            sum += j + i;
+        }
+        HPX_TEST_EQ(sum, overall_results[i].get());
+    }
+}
+
+void test_channel_communicator(
+    collective_algorithm algorithm, std::string const& basename)
+{
+    std::uint32_t num_localities = hpx::get_num_localities(hpx::launch::sync);
+    std::uint32_t here = hpx::get_locality_id();
+
+    auto comm = create_channel_communicator(hpx::launch::sync,
+        basename.c_str(), num_sites_arg(num_localities), this_site_arg(here));
+
+    for (int i = 0; i != 10; ++i)
+    {
+        std::uint32_t value = here;
+
+        hpx::future<std::uint32_t> overall_result =
+            all_reduce(comm, value, std::plus<std::uint32_t>{},
+                generation_arg(i + 1), algorithm_arg(algorithm));
+
+        std::uint32_t sum = 0;
+        for (std::uint32_t j = 0; j != num_localities; ++j)
+        {
+            sum += j;
+        }
+        HPX_TEST_EQ(sum, overall_result.get());
+    }
+}
+
+void test_channel_communicator_local_sites(std::uint32_t num_sites,
+    collective_algorithm algorithm, std::string const& basename)
+{
+    // all sites are run on this locality
+    std::vector<channel_communicator> comms;
+    comms.reserve(num_sites);
+    for (std::uint32_t i = 0; i != num_sites; ++i)
+    {
+        comms.push_back(create_channel_communicator(hpx::launch::sync,
+            basename.c_str(), num_sites_arg(num_sites), this_site_arg(i)));
+    }
+
+    std::vector<hpx::future<std::uint32_t>> results;
+    results.reserve(num_sites);
+    for (std::uint32_t i = 0; i != num_sites; ++i)
+    {
+        results.push_back(all_reduce(comms[i], i, std::plus<std::uint32_t>{},
+            generation_arg(1), algorithm_arg(algorithm)));
+    }
+
+    std::uint32_t sum = 0;
+    for (std::uint32_t j = 0; j != num_sites; ++j)
+    {
+        sum += j;
+    }
+    for (auto& result : results)
+    {
+        HPX_TEST_EQ(sum, result.get());
+    }
+}
+
+void test_vector_plus()
+{
+    std::uint32_t num_localities = hpx::get_num_localities(hpx::launch::sync);
+    std::uint32_t here = hpx::get_locality_id();
+
+    auto all_reduce_client = create_communicator("/test/all_reduce_vector/",
+        num_sites_arg(num_localities), this_site_arg(here));
+    auto channel_comm = create_channel_communicator(hpx::launch::sync,
+        "/test/all_reduce_vector_channel/", num_sites_arg(num_localities),
+        this_site_arg(here));
+
+    // vectors of arithmetic values are accumulated element-wise
+    for (int i = 0; i != 10; ++i)
+    {
+        double sum = 0;
+        for (std::uint32_t j = 0; j != num_localities; ++j)
+        {
+            sum += j + i;
+        }
+
+        hpx::future<std::vector<double>> result = all_reduce(all_reduce_client,
+            std::vector<double>(1000, double(here + i)), std::plus<>{},
+            generation_arg(i + 1));
+        hpx::future<std::vector<double>> channel_result = all_reduce(
+            channel_comm, std::vector<double>(1000, double(here + i)),
+            std::plus<double>{}, generation_arg(i + 1));
+
+        for (std::vector<double> const& r :
+            {result.get(), channel_result.get()})
+        {
+            HPX_TEST_EQ(r.size(), std::size_t(1000));
+            for (double value : r)
+            {
+                HPX_TEST_EQ(sum, value);
+            }
+        }
+    }
+}
+
+void test_plan_local_sites(std::uint32_t num_sites,
+    collective_algorithm algorithm, std::string const& basename)
+{
+    using plan_type = all_reduce_plan<std::vector<double>, std::plus<double>>;
+
+    // all sites are run on this locality, a plan becomes ready once the
+    // sites it communicates with were created
+    std::vector<hpx::future<plan_type>> created;
+    created.reserve(num_sites);
+    for (std::uint32_t i = 0; i != num_sites; ++i)
+    {
+        auto comm = create_channel_communicator(hpx::launch::sync,
+            basename.c_str(), num_sites_arg(num_sites), this_site_arg(i));
+        created.push_back(create_all_reduce_plan(HPX_MOVE(comm),
+            std::vector<double>(100), std::plus<double>{}, generation_arg(),
+            algorithm_arg(algorithm)));
+    }
+
+    std::vector<plan_type> plans;
+    plans.reserve(num_sites);
+    for (auto& f : created)
+    {
+        plans.push_back(f.get());
+    }
+
+    // invocations of the same plan may overlap
+    std::vector<hpx::future<std::vector<double>>> results;
+    results.reserve(10 * num_sites);
+    for (int i = 0; i != 10; ++i)
+    {
+        for (std::uint32_t j = 0; j != num_sites; ++j)
+        {
+            results.push_back(
+                all_reduce(plans[j], std::vector<double>(100, double(j + i))));
+        }
+    }
+
+    for (int i = 0; i != 10; ++i)
+    {
+        double sum = 0;
+        for (std::uint32_t j = 0; j != num_sites; ++j)
+        {
+            sum += j + i;
+        }
+        for (std::uint32_t j = 0; j != num_sites; ++j)
+        {
+            std::vector<double> r = results[i * num_sites + j].get();
+            HPX_TEST_EQ(r.size(), std::size_t(100));
+            for (double value : r)
+            {
+                HPX_TEST_EQ(sum, value);
+            }
+        }
+    }
+
+    // the values must have the shape the plan was created for
+    bool caught_exception = false;
+    try
+    {
+        all_reduce(plans[0], std::vector<double>(10)).get();
+    }
+    catch (hpx::exception const&)
+    {
+        caught_exception = true;
+    }
+    HPX_TEST(caught_exception);
+}
+
+void test_plan()
+{
+    std::uint32_t num_localities = hpx::get_num_localities(hpx::launch::sync);
+    std::uint32_t here = hpx::get_locality_id();
+
+    auto comm = create_channel_communicator(hpx::launch::sync,
+        "/test/all_reduce_plan/", num_sites_arg(num_localities),
+        this_site_arg(here));
+    auto plan = create_all_reduce_plan(
+        comm, std::uint32_t(), std::plus<std::uint32_t>{})
+                    .get();
+
+    for (std::uint32_t i = 0; i != 10; ++i)
+    {
+        std::uint32_t sum = 0;
+        for (std::uint32_t j = 0; j != num_localities; ++j)
+        {
+            sum += j + i;
+        }
+        HPX_TEST_EQ(sum, all_reduce(plan, here + i).get());
+    }
+}
+
 int hpx_main()
 {
     test_one_shot_use();
     test_multiple_use();
     test_multiple_use_with_generation();
+    test_overlapping_generations();
+    test_vector_plus();
+
+    test_channel_communicator(collective_algorithm::automatic,
+        "/test/all_reduce_channel/automatic/");
+    test_channel_communicator(collective_algorithm::recursive_doubling,
+        "/test/all_reduce_channel/recursive_doubling/");
+    test_channel_communicator(collective_algorithm::binomial_tree,
+        "/test/all_reduce_channel/binomial_tree/");
+    test_plan();
+
+    if (hpx::get_locality_id() == 0)
+    {
+        for (std::uint32_t num_sites : {1, 5, 8, 13})
+        {
+            std::string const basename =
+                "/test/all_reduce_channel/local/" + std::to_string(num_sites);
+            test_channel_communicator_local_sites(num_sites,
+                collective_algorithm::recursive_doubling,
+                basename + "/recursive_doubling/");
+            test_channel_communicator_local_sites(num_sites,
+                collective_algorithm::binomial_tree,
+                basename + "/binomial_tree/");
+            test_plan_local_sites(num_sites,
+                collective_algorithm::recursive_doubling,
+                basename + "/plan/recursive_doubling/");
+            test_plan_local_sites(num_sites,
+                collective_algorithm::binomial_tree,
+                basename + "/plan/binomial_tree/");
+        }
+    }
 
     return hpx::finalize();
 }
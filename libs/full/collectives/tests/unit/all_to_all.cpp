@@ -12,6 +12,7 @@
 #include <hpx/modules/collectives.hpp>
 #include <hpx/modules/testing.hpp>
 
+#include <cstddef>
 #include <cstdint>
 #include <string>
 #include <utility>
@@ -103,12 +104,100 @@ void test_multiple_use_with_generation()
     }
 }
 
+// every block holds enough data to be sent using zero-copy serialization
+constexpr std::size_t block_size = 8192;
+
+std::vector<std::vector<double>> make_blocks(
+    std::size_t num_sites, std::size_t this_site, int generation)
+{
+    std::vector<std::vector<double>> blocks(num_sites);
+    for (std::size_t j = 0; j != num_sites; ++j)
+    {
+        blocks[j].assign(block_size,
+            static_cast<double>(
+                (this_site * num_sites + j) * 100 + generation));
+    }
+    return blocks;
+}
+
+void check_blocks(std::vector<std::vector<double>> const& blocks,
+    std::size_t num_sites, std::size_t this_site, int generation)
+{
+    HPX_TEST_EQ(blocks.size(), num_sites);
+    for (std::size_t j = 0; j != blocks.size(); ++j)
+    {
+        HPX_TEST_EQ(blocks[j].size(), block_size);
+        double const expected = static_cast<double>(
+            (j * num_sites + this_site) * 100 + generation);
+        for (double value : blocks[j])
+        {
+            HPX_TEST_EQ(value, expected);
+        }
+    }
+}
+
+void test_channel_communicator()
+{
+    std::uint32_t num_localities = hpx::get_num_localities(hpx::launch::sync);
+    std::uint32_t here = hpx::get_locality_id();
+
+    auto comm = create_channel_communicator(hpx::launch::sync,
+        "/test/all_to_all_channel/", num_sites_arg(num_localities),
+        this_site_arg(here));
+
+    for (int i = 0; i != 10; ++i)
+    {
+        hpx::future<std::vector<std::vector<double>>> overall_result =
+            all_to_all(comm, make_blocks(num_localities, here, i),
+                generation_arg(i + 1));
+
+        check_blocks(overall_result.get(), num_localities, here, i);
+    }
+}
+
+void test_channel_communicator_local_sites(std::uint32_t num_sites)
+{
+    std::string const basename =
+        "/test/all_to_all_channel/local/" + std::to_string(num_sites) + "/";
+
+    // all sites are run on this locality
+    std::vector<channel_communicator> comms;
+    comms.reserve(num_sites);
+    for (std::uint32_t i = 0; i != num_sites; ++i)
+    {
+        comms.push_back(create_channel_communicator(hpx::launch::sync,
+            basename.c_str(), num_sites_arg(num_sites), this_site_arg(i)));
+    }
+
+    std::vector<hpx::future<std::vector<std::vector<double>>>> results;
+    results.reserve(num_sites);
+    for (std::uint32_t i = 0; i != num_sites; ++i)
+    {
+        results.push_back(all_to_all(
+            comms[i], make_blocks(num_sites, i, 0), generation_arg(1)));
+    }
+
+    for (std::uint32_t i = 0; i != num_sites; ++i)
+    {
+        check_blocks(results[i].get(), num_sites, i, 0);
+    }
+}
+
 int hpx_main()
 {
     test_one_shot_use();
     test_multiple_use();
     test_multiple_use_with_generation();
 
+    test_channel_communicator();
+    if (hpx::get_locality_id() == 0)
+    {
+        for (std::uint32_t num_sites : {1, 4, 7})
+        {
+            test_channel_communicator_local_sites(num_sites);
+        }
+    }
+
     return hpx::finalize();
 }
 
@@ -99,6 +99,77 @@ void remote_test_single(hpx::program_options::variables_map& vm)
     }
 }
 
+///////////////////////////////////////////////////////////////////////////////
+void remote_test_algorithm(hpx::program_options::variables_map& vm,
+    hpx::distributed::barrier_algorithm algorithm, std::string const& name)
+{
+    std::size_t iterations = 0;
+    if (vm.count("iterations"))
+        iterations = vm["iterations"].as<std::size_t>();
+
+    std::size_t num_localities = hpx::get_num_localities(hpx::launch::sync);
+    hpx::distributed::barrier b(
+        name, num_localities, hpx::get_locality_id(), algorithm);
+    for (std::size_t i = 0; i != iterations; ++i)
+        b.wait();
+}
+
+void local_sites_test_algorithm(std::size_t num_sites,
+    hpx::distributed::barrier_algorithm algorithm, std::string const& name)
+{
+    // all sites are run on this locality, each of them counts its arrivals
+    std::vector<std::atomic<std::size_t>> arrivals(num_sites);
+
+    std::vector<hpx::future<void>> sites;
+    sites.reserve(num_sites);
+    for (std::size_t rank = 0; rank != num_sites; ++rank)
+    {
+        sites.push_back(hpx::async([&, rank]() {
+            hpx::distributed::barrier b(name, num_sites, rank, algorithm);
+            for (std::size_t i = 0; i != 10; ++i)
+            {
+                ++arrivals[rank];
+                b.wait();
+
+                // nobody may have left the barrier before all arrived
+                for (auto const& count : arrivals)
+                {
+                    HPX_TEST_LTE(i + 1, count.load());
+                }
+
+                b.wait();
+            }
+        }));
+    }
+    hpx::wait_all(sites);
+}
+
+void remote_test_local_participants(hpx::program_options::variables_map& vm,
+    hpx::distributed::barrier_algorithm algorithm, std::string const& name)
+{
+    std::size_t threads = 0;
+    if (vm.count("threads"))
+        threads = vm["threads"].as<std::size_t>();
+
+    // all threads on this locality share the barrier object
+    std::size_t num_localities = hpx::get_num_localities(hpx::launch::sync);
+    hpx::distributed::barrier b(
+        name, num_localities, hpx::get_locality_id(), algorithm, threads);
+
+    std::atomic<std::size_t> c(0);
+    std::vector<hpx::future<void>> participants;
+    participants.reserve(threads);
+    for (std::size_t j = 0; j != threads; ++j)
+    {
+        participants.push_back(hpx::async([&]() {
+            ++c;
+            b.wait();
+            HPX_TEST_EQ(threads, c.load());
+        }));
+    }
+    hpx::wait_all(participants);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 int hpx_main(hpx::program_options::variables_map& vm)
 {
@@ -107,6 +178,28 @@ int hpx_main(hpx::program_options::variables_map& vm)
     remote_test_single(vm);
     remote_test_multiple(vm);
 
+    using hpx::distributed::barrier_algorithm;
+    for (auto algorithm : {barrier_algorithm::dissemination,
+             barrier_algorithm::tournament})
+    {
+        std::string const name = hpx::util::format(
+            "/test/barrier/algorithm/{}", static_cast<int>(algorithm));
+
+        remote_test_algorithm(vm, algorithm, name + "/multiple");
+        remote_test_local_participants(vm, algorithm, name + "/local_step");
+
+        if (hpx::get_locality_id() == 0)
+        {
+            for (std::size_t num_sites : {1, 2, 5, 8})
+            {
+                local_sites_test_algorithm(num_sites, algorithm,
+                    hpx::util::format("{}/local/{}", name, num_sites));
+            }
+        }
+    }
+    remote_test_local_participants(vm, barrier_algorithm::tree,
+        "/test/barrier/algorithm/tree/local_step");
+
     return hpx::finalize();
 }
 
@@ -12,6 +12,7 @@
 #include <hpx/modules/collectives.hpp>
 #include <hpx/modules/testing.hpp>
 
+#include <cstddef>
 #include <cstdint>
 #include <string>
 #include <utility>
@@ -115,12 +116,116 @@ void test_multiple_use_with_generation()
     }
 }
 
+///////////////////////////////////////////////////////////////////////////////
+using buffer_type = hpx::serialization::serialize_buffer<double>;
+
+buffer_type make_buffer(std::size_t size, std::size_t generation)
+{
+    buffer_type buffer(size);
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        buffer[i] = static_cast<double>(i + generation);
+    }
+    return buffer;
+}
+
+void check_buffer(
+    buffer_type const& buffer, std::size_t size, std::size_t generation)
+{
+    HPX_TEST_EQ(buffer.size(), size);
+    for (std::size_t i = 0; i != buffer.size(); ++i)
+    {
+        HPX_TEST_EQ(buffer[i], static_cast<double>(i + generation));
+    }
+}
+
+void test_pipelined(collective_algorithm algorithm, std::string const& basename)
+{
+    std::uint32_t num_localities = hpx::get_num_localities(hpx::launch::sync);
+    std::uint32_t here = hpx::get_locality_id();
+
+    auto comm = create_channel_communicator(hpx::launch::sync,
+        basename.c_str(), num_sites_arg(num_localities), this_site_arg(here));
+
+    // use segments of 10 elements, the last segment is smaller
+    std::size_t const size = 1005;
+    for (std::size_t i = 0; i != 10; ++i)
+    {
+        if (here == 0)
+        {
+            broadcast_to(comm, make_buffer(size, i), generation_arg(i + 1),
+                segment_size_arg(10 * sizeof(double)), algorithm_arg(algorithm))
+                .get();
+        }
+        else
+        {
+            check_buffer(broadcast_from<buffer_type>(comm, root_site_arg(0),
+                             generation_arg(i + 1), algorithm_arg(algorithm))
+                             .get(),
+                size, i);
+        }
+    }
+}
+
+void test_pipelined_local_sites(std::size_t num_sites, std::size_t root_site,
+    collective_algorithm algorithm, std::string const& basename)
+{
+    // all sites are run on this locality
+    std::vector<channel_communicator> comms;
+    comms.reserve(num_sites);
+    for (std::size_t i = 0; i != num_sites; ++i)
+    {
+        comms.push_back(create_channel_communicator(hpx::launch::sync,
+            basename.c_str(), num_sites_arg(num_sites), this_site_arg(i)));
+    }
+
+    std::size_t const size = 1000;
+    std::vector<hpx::future<buffer_type>> results;
+    results.reserve(num_sites);
+    for (std::size_t i = 0; i != num_sites; ++i)
+    {
+        if (i != root_site)
+        {
+            results.push_back(broadcast_from<buffer_type>(comms[i],
+                root_site_arg(root_site), generation_arg(1),
+                algorithm_arg(algorithm)));
+        }
+    }
+
+    broadcast_to(comms[root_site], make_buffer(size, 0), generation_arg(1),
+        segment_size_arg(64 * sizeof(double)), algorithm_arg(algorithm))
+        .get();
+
+    for (auto& result : results)
+    {
+        check_buffer(result.get(), size, 0);
+    }
+}
+
 int hpx_main()
 {
     test_one_shot_use();
     test_multiple_use();
     test_multiple_use_with_generation();
 
+    test_pipelined(collective_algorithm::automatic,
+        "/test/broadcast_pipelined/automatic/");
+    test_pipelined(
+        collective_algorithm::binary_tree, "/test/broadcast_pipelined/tree/");
+
+    if (hpx::get_locality_id() == 0)
+    {
+        for (std::size_t num_sites : {2, 5, 20})
+        {
+            std::string const basename = "/test/broadcast_pipelined/local/" +
+                std::to_string(num_sites);
+            test_pipelined_local_sites(num_sites, 0,
+                collective_algorithm::chain, basename + "/chain/");
+            test_pipelined_local_sites(num_sites, num_sites - 1,
+                collective_algorithm::binary_tree, basename + "/tree/");
+        }
+    }
+
     return hpx::finalize();
 }
 
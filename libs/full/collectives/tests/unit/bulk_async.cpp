@@ -0,0 +1,170 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify that bulk_async invokes an action on many components spread over
+// all localities and returns the results in the order of the targets.
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/collectives/bulk_async.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/components.hpp>
+#include <hpx/include/runtime.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+std::atomic<std::size_t> invoked(0);
+
+struct test_server : hpx::components::component_base<test_server>
+{
+    std::uint32_t here_plus(std::uint32_t i, std::uint32_t j) const
+    {
+        return hpx::get_locality_id() * 100000 + i + j;
+    }
+    HPX_DEFINE_COMPONENT_ACTION(test_server, here_plus)
+
+    void touch(std::uint32_t i)
+    {
+        if (i == std::uint32_t(-1))
+        {
+            throw std::runtime_error("touch failed");
+        }
+        ++invoked;
+    }
+    HPX_DEFINE_COMPONENT_ACTION(test_server, touch)
+};
+
+using server_type = hpx::components::component<test_server>;
+HPX_REGISTER_COMPONENT(server_type, bulk_async_test_server)
+
+using here_plus_action = test_server::here_plus_action;
+using touch_action = test_server::touch_action;
+
+HPX_REGISTER_BULK_ASYNC_ACTION_DECLARATION(here_plus_action)
+HPX_REGISTER_BULK_ASYNC_ACTION(here_plus_action)
+HPX_REGISTER_BULK_ASYNC_ACTION_DECLARATION(touch_action)
+HPX_REGISTER_BULK_ASYNC_ACTION(touch_action)
+
+std::size_t get_invoked()
+{
+    return invoked.load();
+}
+
+HPX_PLAIN_ACTION(get_invoked, get_invoked_action)
+
+///////////////////////////////////////////////////////////////////////////////
+// interleave the components of all localities
+std::vector<hpx::id_type> create_components(std::size_t per_locality)
+{
+    std::vector<std::vector<hpx::id_type>> created;
+    for (hpx::id_type const& locality : hpx::find_all_localities())
+    {
+        created.push_back(
+            hpx::new_<test_server[]>(locality, per_locality).get());
+    }
+
+    std::vector<hpx::id_type> ids;
+    for (std::size_t i = 0; i != per_locality; ++i)
+    {
+        for (std::vector<hpx::id_type> const& c : created)
+        {
+            ids.push_back(c[i]);
+        }
+    }
+    return ids;
+}
+
+void test_results(std::vector<hpx::id_type> const& ids)
+{
+    std::vector<here_plus_action::arguments_type> args;
+    for (std::size_t i = 0; i != ids.size(); ++i)
+    {
+        args.emplace_back(static_cast<std::uint32_t>(i), 1);
+    }
+
+    std::vector<std::uint32_t> results =
+        hpx::lcos::bulk_async<here_plus_action>(ids, args).get();
+
+    HPX_TEST_EQ(results.size(), ids.size());
+    for (std::size_t i = 0; i != ids.size(); ++i)
+    {
+        HPX_TEST_EQ(results[i],
+            hpx::naming::get_locality_id_from_id(ids[i]) * 100000 +
+                static_cast<std::uint32_t>(i) + 1);
+    }
+
+    // no targets
+    HPX_TEST(hpx::lcos::bulk_async(here_plus_action(), {}, {}).get().empty());
+}
+
+void test_void(std::vector<hpx::id_type> const& ids)
+{
+    std::vector<touch_action::arguments_type> args(
+        ids.size(), touch_action::arguments_type(0));
+
+    hpx::lcos::bulk_async<touch_action>(ids, args).get();
+
+    std::size_t count = 0;
+    for (hpx::id_type const& locality : hpx::find_all_localities())
+    {
+        count += hpx::async<get_invoked_action>(locality).get();
+    }
+    HPX_TEST_EQ(count, ids.size());
+
+    // the exceptions of the invocations are reported
+    args.back() = touch_action::arguments_type(std::uint32_t(-1));
+
+    bool caught = false;
+    try
+    {
+        hpx::lcos::bulk_async<touch_action>(ids, args).get();
+    }
+    catch (std::exception const&)
+    {
+        caught = true;
+    }
+    HPX_TEST(caught);
+
+    // the number of argument sets has to match
+    args.pop_back();
+
+    caught = false;
+    try
+    {
+        hpx::lcos::bulk_async<touch_action>(ids, args).get();
+    }
+    catch (hpx::exception const& e)
+    {
+        HPX_TEST_EQ(e.get_error(), hpx::bad_parameter);
+        caught = true;
+    }
+    HPX_TEST(caught);
+}
+
+int hpx_main()
+{
+    // more invocations per locality than fit into a single chunk
+    std::vector<hpx::id_type> ids = create_components(1000);
+
+    test_results(ids);
+    test_void(ids);
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ_MSG(
+        hpx::init(argc, argv), 0, "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
+#endif
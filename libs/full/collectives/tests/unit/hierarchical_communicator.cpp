@@ -0,0 +1,99 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/modules/collectives.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace hpx::collectives;
+
+constexpr char const* hierarchical_basename = "/test/hierarchical/";
+
+constexpr std::size_t num_local_sites = 4;
+constexpr std::size_t num_generations = 10;
+
+void test_site(std::size_t local_site)
+{
+    std::size_t num_localities = hpx::get_num_localities(hpx::launch::sync);
+    std::size_t here = hpx::get_locality_id();
+
+    auto comm = create_hierarchical_communicator(hierarchical_basename,
+        num_sites_arg(num_local_sites), this_site_arg(local_site));
+
+    std::size_t const num_sites = num_localities * num_local_sites;
+    std::size_t const site = here * num_local_sites + local_site;
+
+    for (std::size_t i = 0; i != num_generations; ++i)
+    {
+        hpx::future<std::size_t> reduced =
+            all_reduce(comm, site + i, std::plus<std::size_t>{});
+
+        std::size_t sum = 0;
+        for (std::size_t j = 0; j != num_sites; ++j)
+        {
+            sum += j + i;
+        }
+        HPX_TEST_EQ(sum, reduced.get());
+
+        hpx::future<std::vector<std::size_t>> gathered =
+            all_gather(comm, site + i);
+
+        std::vector<std::size_t> values = gathered.get();
+        HPX_TEST_EQ(values.size(), num_sites);
+        for (std::size_t j = 0; j != values.size(); ++j)
+        {
+            HPX_TEST_EQ(values[j], j + i);
+        }
+    }
+}
+
+void test_hierarchical_communicator()
+{
+    std::vector<hpx::future<void>> sites;
+    sites.reserve(num_local_sites);
+
+    for (std::size_t local_site = 0; local_site != num_local_sites;
+         ++local_site)
+    {
+        sites.push_back(hpx::async(&test_site, local_site));
+    }
+
+    hpx::wait_all(sites);
+    for (auto& f : sites)
+    {
+        f.get();    // propagate exceptions
+    }
+}
+
+int hpx_main()
+{
+    test_hierarchical_communicator();
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    std::vector<std::string> const cfg = {"hpx.run_hpx_main!=1"};
+
+    hpx::init_params init_args;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ(hpx::init(argc, argv, init_args), 0);
+    return hpx::util::report_errors();
+}
+
+#endif
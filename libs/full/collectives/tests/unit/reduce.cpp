@@ -12,7 +12,9 @@
 #include <hpx/modules/collectives.hpp>
 #include <hpx/modules/testing.hpp>
 
+#include <cstddef>
 #include <cstdint>
+#include <functional>
 #include <string>
 #include <utility>
 #include <vector>
@@ -124,11 +126,53 @@ void test_multiple_use_with_generation()
     }
 }
 
+void test_vector_plus()
+{
+    std::uint32_t num_localities = hpx::get_num_localities(hpx::launch::sync);
+    std::uint32_t this_locality = hpx::get_locality_id();
+
+    auto reduce_direct_client = create_communicator("/test/reduce_vector/",
+        num_sites_arg(num_localities), this_site_arg(this_locality));
+
+    // vectors of arithmetic values are accumulated element-wise
+    for (int i = 0; i != 10; ++i)
+    {
+        std::vector<double> values(1000, double(this_locality + i));
+
+        if (this_locality == 0)
+        {
+            hpx::future<std::vector<double>> overall_result =
+                reduce_here(reduce_direct_client, std::move(values),
+                    std::plus<>{}, generation_arg(i + 1));
+
+            double sum = 0;
+            for (std::uint32_t j = 0; j != num_localities; ++j)
+            {
+                sum += j + i;
+            }
+
+            std::vector<double> result = overall_result.get();
+            HPX_TEST_EQ(result.size(), std::size_t(1000));
+            for (double value : result)
+            {
+                HPX_TEST_EQ(sum, value);
+            }
+        }
+        else
+        {
+            hpx::future<void> overall_result = reduce_there(
+                reduce_direct_client, std::move(values), generation_arg(i + 1));
+            overall_result.get();
+        }
+    }
+}
+
 int hpx_main()
 {
     test_one_shot_use();
     test_multiple_use();
     test_multiple_use_with_generation();
+    test_vector_plus();
 
     return hpx::finalize();
 }
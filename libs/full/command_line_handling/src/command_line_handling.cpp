@@ -1102,6 +1102,17 @@ namespace hpx { namespace util {
                 std::to_string(num_high_priority_queues));
         }
 
+        if (vm_.count("hpx:print-startup-timings"))
+        {
+            ini_config.emplace_back("hpx.print_startup_timings!=1");
+        }
+
+        if (vm_.count("hpx:polling-threads"))
+        {
+            ini_config.emplace_back("hpx.threadpools.polling_pool_size!=" +
+                std::to_string(vm_["hpx:polling-threads"].as<std::size_t>()));
+        }
+
         // map host names to ip addresses, if requested
         hpx_host = mapnames.map(hpx_host, hpx_port);
         agas_host = mapnames.map(agas_host, agas_port);
@@ -526,6 +526,14 @@ namespace hpx { namespace util {
                 ("hpx:print-bind",
                   "print to the console the bit masks calculated from the "
                   "arguments specified to all --hpx:bind options.")
+                ("hpx:print-startup-timings",
+                  "print to the console the time taken by the phases of the "
+                  "runtime startup before hpx_main is invoked")
+                ("hpx:polling-threads", value<std::size_t>(),
+                  "the number of processing units to set aside for a "
+                  "dedicated thread pool 'polling', running the network "
+                  "background work and the MPI and CUDA polling "
+                  "(default: 0, i.e. no dedicated pool)")
                 ("hpx:threads", value<std::string>(),
                  "the number of operating system threads to spawn for this HPX "
                  "locality (default: 1, using 'all' will spawn one thread for "
@@ -537,8 +545,9 @@ namespace hpx { namespace util {
                 ("hpx:queuing", value<std::string>(),
                   "the queue scheduling policy to use, options are "
                   "'local', 'local-priority-fifo','local-priority-lifo', "
-                  "'abp-priority-fifo', 'abp-priority-lifo', 'static', and "
-                  "'static-priority' (default: 'local-priority'; "
+                  "'abp-priority-fifo', 'abp-priority-lifo', "
+                  "'local-workrequesting-fifo', 'local-workrequesting-lifo', "
+                  "'static', and 'static-priority' (default: 'local-priority'; "
                   "all option values can be abbreviated)")
                 ("hpx:high-priority-threads", value<std::size_t>(),
                   "the number of operating system threads maintaining a high "
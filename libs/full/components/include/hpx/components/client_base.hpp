@@ -554,13 +554,15 @@ namespace hpx { namespace components {
         hpx::traits::future_then_result_t<Derived, F> then(
             launch::sync_policy l, F&& f)
         {
-            using func_result = decltype(HPX_FORWARD(F, f)(Derived(*this)));
+            using func_result = decltype(HPX_FORWARD(F, f)(
+                Derived(*static_cast<Derived const*>(this))));
             using future_result = hpx::traits::future_then_result_t<Derived, F>;
             if constexpr (std::is_convertible_v<func_result, future_result>)
             {
                 if (is_ready())
                 {
-                    return HPX_FORWARD(F, f)(Derived(*this));
+                    return HPX_FORWARD(F, f)(
+                        Derived(*static_cast<Derived const*>(this)));
                 }
             }
             return then(launch(l), HPX_FORWARD(F, f));
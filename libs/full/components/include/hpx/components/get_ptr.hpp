@@ -249,8 +249,7 @@ namespace hpx {
     {
         // shortcut for local, non-migratable objects
         naming::gid_type gid = id.get_gid();
-        if (naming::refers_to_local_lva(gid) &&
-            naming::get_locality_id_from_gid(gid) == agas::get_locality_id(ec))
+        if (naming::refers_to_local_lva(gid, agas::get_locality_id(ec)))
         {
             return std::shared_ptr<Component>(
                 get_lva<Component>::call(
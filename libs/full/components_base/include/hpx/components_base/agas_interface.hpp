@@ -155,6 +155,11 @@ namespace hpx { namespace agas {
     HPX_EXPORT naming::address resolve(
         launch::sync_policy, hpx::id_type const& id, error_code& ec = throws);
 
+    // Resolve all given ids at once, this sends at most one request to each
+    // of the localities managing the ids which are not cached.
+    HPX_EXPORT hpx::future<std::vector<naming::address>> resolve(
+        std::vector<hpx::id_type> const& ids);
+
     HPX_EXPORT bool resolve_local(naming::gid_type const& gid,
         naming::address& addr, error_code& ec = throws);
 
@@ -114,6 +114,9 @@ namespace hpx { namespace agas { namespace detail {
     extern HPX_EXPORT naming::address (*resolve)(
         hpx::id_type const& id, error_code& ec);
 
+    extern HPX_EXPORT hpx::future<std::vector<naming::address>> (
+        *resolve_bulk_async)(std::vector<hpx::id_type> const& ids);
+
     extern HPX_EXPORT bool (*resolve_local)(
         naming::gid_type const& gid, naming::address& addr, error_code& ec);
 
@@ -11,10 +11,18 @@
 #include <hpx/components_base/component_type.hpp>
 #include <hpx/components_base/server/component_heap.hpp>
 #include <hpx/components_base/server/create_component_fwd.hpp>
+#include <hpx/components_base/server/one_size_heap_list.hpp>
+#include <hpx/async_combinators/wait_all.hpp>
+#include <hpx/async_local/async.hpp>
+#include <hpx/futures/future.hpp>
 #include <hpx/modules/errors.hpp>
 #include <hpx/naming_base/address.hpp>
 
+#include <algorithm>
 #include <cstddef>
+#include <exception>
+#include <new>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -117,8 +125,99 @@ namespace hpx { namespace components { namespace server {
         return naming::invalid_gid;
     }
 
+    namespace detail {
+
+        // the number of components constructed by one task
+        inline constexpr std::size_t bulk_create_chunk_size = 4096;
+
+        // Construct count components into the contiguous storage in parallel,
+        // all components are destroyed again if any constructor throws.
+        template <typename Component, typename... Ts>
+        void bulk_construct(
+            Component* storage, std::size_t count, Ts const&... ts)
+        {
+            auto construct = [&](std::size_t first, std::size_t last) {
+                std::size_t i = first;
+                try
+                {
+                    for (/**/; i != last; ++i)
+                    {
+                        new (storage + i) Component(ts...);
+                    }
+                }
+                catch (...)
+                {
+                    while (i != first)
+                    {
+                        --i;
+                        storage[i].finalize();
+                        storage[i].~Component();
+                    }
+                    throw;
+                }
+            };
+
+            if (count <= bulk_create_chunk_size)
+            {
+                construct(0, count);
+                return;
+            }
+
+            std::vector<hpx::future<void>> chunks;
+            chunks.reserve(
+                (count + bulk_create_chunk_size - 1) / bulk_create_chunk_size);
+            for (std::size_t first = 0; first < count;
+                 first += bulk_create_chunk_size)
+            {
+                std::size_t const last =
+                    (std::min)(first + bulk_create_chunk_size, count);
+                chunks.push_back(hpx::async(construct, first, last));
+            }
+            hpx::wait_all_nothrow(chunks);
+
+            std::exception_ptr ex;
+            for (hpx::future<void> const& f : chunks)
+            {
+                if (f.has_exception())
+                {
+                    ex = f.get_exception_ptr();
+                    break;
+                }
+            }
+            if (!ex)
+            {
+                return;
+            }
+
+            // roll back the chunks which succeeded
+            for (std::size_t c = 0; c != chunks.size(); ++c)
+            {
+                if (chunks[c].has_exception())
+                {
+                    continue;
+                }
+
+                std::size_t const first = c * bulk_create_chunk_size;
+                std::size_t const last =
+                    (std::min)(first + bulk_create_chunk_size, count);
+                for (std::size_t i = first; i != last; ++i)
+                {
+                    storage[i].finalize();
+                    storage[i].~Component();
+                }
+            }
+            std::rethrow_exception(ex);
+        }
+    }    // namespace detail
+
     ///////////////////////////////////////////////////////////////////////////
     /// Create count components and forward the passed parameters
+    ///
+    /// If the heap of the component hands out contiguous storage (as the
+    /// heap of managed components does), the storage of all components is
+    /// allocated at once, the components are constructed in parallel, and
+    /// their global ids are registered with AGAS together. Otherwise the
+    /// components are created one by one.
     template <typename Component, typename... Ts>
     std::vector<naming::gid_type> bulk_create(std::size_t count, Ts&&... ts)
     {
@@ -133,44 +232,51 @@ namespace hpx { namespace components { namespace server {
             return gids;
         }
 
-        gids.reserve(count);
+        if (count == 0)
+        {
+            return gids;
+        }
 
-        Component* storage =
-            static_cast<Component*>(component_heap<Component>().alloc(count));
-        Component* storage_it = storage;
-        std::size_t succeeded = 0;
-        try
+        using heap_type = typename Component::heap_type;
+        if constexpr (std::is_base_of_v<util::one_size_heap_list, heap_type>)
         {
-            // Call constructors and try to get the GID...
-            for (std::size_t i = 0; i != count; ++i, ++storage_it)
+            heap_type& heap = component_heap<Component>();
+            Component* storage = static_cast<Component*>(heap.alloc(count));
+
+            try
+            {
+                detail::bulk_construct(storage, count, ts...);
+            }
+            catch (...)
             {
-                Component* c = nullptr;
-                c = new (storage_it) Component(HPX_FORWARD(Ts, ts)...);
-                naming::gid_type gid = c->get_base_gid();
-                if (!gid)
+                heap.free(storage, count);
+                throw;
+            }
+
+            gids = heap.get_gids(storage, count);
+            if (gids.size() != count)
+            {
+                for (std::size_t i = 0; i != count; ++i)
                 {
-                    c->finalize();
-                    c->~Component();
-                    HPX_THROW_EXCEPTION(hpx::unknown_component_address,
-                        "bulk_create<Component>", "can't assign global id");
+                    storage[i].finalize();
+                    storage[i].~Component();
                 }
-                gids.push_back(HPX_MOVE(gid));
-                ++instance_count(type);
-                ++succeeded;
+                heap.free(storage, count);
+
+                HPX_THROW_EXCEPTION(hpx::unknown_component_address,
+                    "bulk_create<Component>", "can't assign global ids");
+                return gids;
             }
+
+            instance_count(type) += static_cast<long>(count);
         }
-        catch (...)
+        else
         {
-            // If an exception was thrown, roll back
-            storage_it = storage;
-            for (std::size_t i = 0; i != succeeded; ++i, ++storage_it)
+            gids.reserve(count);
+            for (std::size_t i = 0; i != count; ++i)
             {
-                storage_it->finalize();
-                storage_it->~Component();
-                --instance_count(type);
+                gids.push_back(create<Component>(ts...));
             }
-            component_heap<Component>().free(storage, count);
-            throw;
         }
 
         return gids;
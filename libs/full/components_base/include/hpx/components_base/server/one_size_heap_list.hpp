@@ -10,8 +10,10 @@
 #include <hpx/config.hpp>
 #include <hpx/assert.hpp>
 #include <hpx/components_base/server/wrapper_heap_base.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
 #include <hpx/synchronization/spinlock.hpp>
 
+#include <atomic>
 #include <cstddef>
 #include <list>
 #include <memory>
@@ -23,8 +25,14 @@
 ///////////////////////////////////////////////////////////////////////////////
 namespace hpx { namespace util {
 
+    // The heaps are shared by all threads, however every worker thread
+    // allocates from its own heap (which it creates on demand) as long as it
+    // has space, which avoids contention on the list of heaps.
     class HPX_EXPORT one_size_heap_list
     {
+        using cache_type = util::cache_line_data<
+            std::atomic<util::wrapper_heap_base*>>;
+
     public:
         using list_type = std::list<std::shared_ptr<util::wrapper_heap_base>>;
         using iterator = typename list_type::iterator;
@@ -58,6 +66,8 @@ namespace hpx { namespace util {
 #endif
           , create_heap_(nullptr)
           , parameters_({0, 0, 0})
+          , caches_(nullptr)
+          , num_caches_(0)
         {
             HPX_ASSERT(false);    // shouldn't ever be called
         }
@@ -74,6 +84,8 @@ namespace hpx { namespace util {
 #endif
           , create_heap_(&one_size_heap_list::create_heap<Heap>)
           , parameters_(parameters)
+          , caches_(nullptr)
+          , num_caches_(0)
         {
         }
 
@@ -89,6 +101,8 @@ namespace hpx { namespace util {
 #endif
           , create_heap_(&one_size_heap_list::create_heap<Heap>)
           , parameters_(parameters)
+          , caches_(nullptr)
+          , num_caches_(0)
         {
         }
 
@@ -107,23 +121,37 @@ namespace hpx { namespace util {
         std::string name() const;
 
     protected:
+        // the heap the current worker thread allocates from (if any)
+        util::wrapper_heap_base* get_cached_heap() const noexcept;
+
         mutable mutex_type mtx_;
         list_type heap_list_;
 
     private:
+        void* alloc_shared(std::size_t count);
+        void* refill(cache_type& cache, std::size_t count);
+
+        cache_type* get_cache() const noexcept;
+        cache_type* init_caches() const;
+
         std::string const class_name_;
 
     public:
 #if defined(HPX_DEBUG)
-        std::size_t alloc_count_;
-        std::size_t free_count_;
-        std::size_t heap_count_;
-        std::size_t max_alloc_count_;
+        std::atomic<std::size_t> alloc_count_;
+        std::atomic<std::size_t> free_count_;
+        std::atomic<std::size_t> heap_count_;
+        std::atomic<std::size_t> max_alloc_count_;
 #endif
         std::shared_ptr<util::wrapper_heap_base> (*create_heap_)(
             char const*, std::size_t, heap_parameters);
 
         heap_parameters const parameters_;
+
+    private:
+        // one cached heap per worker thread, allocated on first use
+        mutable std::atomic<cache_type*> caches_;
+        mutable std::size_t num_caches_;
     };
 }}    // namespace hpx::util
 
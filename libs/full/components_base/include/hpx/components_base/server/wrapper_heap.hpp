@@ -16,6 +16,7 @@
 #include <hpx/naming_base/id_type.hpp>
 #include <hpx/synchronization/spinlock.hpp>
 
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <memory>
@@ -60,6 +61,11 @@ namespace hpx { namespace components { namespace detail {
     }    // namespace one_size_heap_allocators
 
     ///////////////////////////////////////////////////////////////////////////
+    // The elements are handed out in order and are not reused before the
+    // whole heap has been released, which keeps the global ids of destroyed
+    // components from being assigned again. Alloc and free are lock-free, the
+    // lock protects the binding of the global ids and the release of the
+    // pool only.
     class HPX_EXPORT wrapper_heap : public util::wrapper_heap_base
     {
     public:
@@ -106,16 +112,21 @@ namespace hpx { namespace components { namespace detail {
 
     protected:
         bool test_release(std::unique_lock<mutex_type>& lk);
-        bool ensure_pool(std::size_t count);
+        void try_release();
 
         bool init_pool();
         void tidy();
 
     protected:
         char* pool_;
-        char* first_free_;
+        char* pool_end_;
+        std::atomic<char*> first_free_;
         heap_parameters const parameters_;
-        std::size_t free_size_;
+
+        // the slots which are being allocated are subtracted before the
+        // allocation is attempted (and added again if it failed), free_size_
+        // reaches the capacity only if no allocation is in flight
+        std::atomic<std::size_t> free_size_;
 
         // these values are used for AGAS registration of all elements of this
         // managed_component heap
@@ -126,8 +137,8 @@ namespace hpx { namespace components { namespace detail {
     public:
         std::string const class_name_;
 #if defined(HPX_DEBUG)
-        std::size_t alloc_count_;
-        std::size_t free_count_;
+        std::atomic<std::size_t> alloc_count_;
+        std::atomic<std::size_t> free_count_;
         std::size_t heap_count_;
 #endif
 
@@ -12,7 +12,11 @@
 #include <hpx/naming_base/id_type.hpp>
 #include <hpx/thread_support/unlock_guard.hpp>
 
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
 #include <type_traits>
+#include <vector>
 
 ///////////////////////////////////////////////////////////////////////////////
 namespace hpx { namespace components { namespace detail {
@@ -52,6 +56,13 @@ namespace hpx { namespace components { namespace detail {
 
         naming::gid_type get_gid(void* p)
         {
+            // the object was most likely allocated by this worker thread
+            if (util::wrapper_heap_base* heap = this->get_cached_heap();
+                heap != nullptr && heap->did_alloc(p))
+            {
+                return heap->get_gid(id_range_, p, type_);
+            }
+
             std::unique_lock guard(this->mtx_);
 
             using iterator = typename base_type::const_iterator;
@@ -68,6 +79,29 @@ namespace hpx { namespace components { namespace detail {
             return naming::invalid_gid;
         }
 
+        // Return the global ids of count objects which were allocated
+        // together (starting at p), the ids of all objects of a heap are
+        // registered with AGAS in one step.
+        std::vector<naming::gid_type> get_gids(void* p, std::size_t count)
+        {
+            std::vector<naming::gid_type> gids;
+
+            naming::gid_type const first = get_gid(p);
+            if (!first)
+            {
+                return gids;
+            }
+
+            // objects allocated together live in the same heap, their ids
+            // are consecutive
+            gids.reserve(count);
+            for (std::size_t i = 0; i != count; ++i)
+            {
+                gids.push_back(first + i);
+            }
+            return gids;
+        }
+
         void set_range(
             naming::gid_type const& lower, naming::gid_type const& upper)
         {
@@ -116,14 +116,45 @@ namespace hpx { namespace agas {
     }
 
     ///////////////////////////////////////////////////////////////////////////
+    namespace {
+
+        // Non-migratable components located on this locality carry their
+        // address in the gid, invoking actions on those does not need to look
+        // at any of the AGAS tables or caches.
+        bool resolve_local_lva(naming::gid_type const& gid,
+            naming::address& addr, error_code& ec)
+        {
+            if (!naming::refers_to_local_lva(gid, detail::get_locality_id(ec)))
+            {
+                return false;
+            }
+
+            addr.locality_ = naming::get_locality_from_gid(gid);
+            addr.type_ =
+                naming::detail::get_component_type_from_gid(gid.get_msb());
+            addr.address_ =
+                reinterpret_cast<naming::address::address_type>(gid.get_lsb());
+            return true;
+        }
+    }    // namespace
+
     bool is_local_address_cached(naming::gid_type const& gid, error_code& ec)
     {
+        naming::address addr;
+        if (resolve_local_lva(gid, addr, ec))
+        {
+            return true;
+        }
         return detail::is_local_address_cached(gid, ec);
     }
 
     bool is_local_address_cached(
         naming::gid_type const& gid, naming::address& addr, error_code& ec)
     {
+        if (resolve_local_lva(gid, addr, ec))
+        {
+            return true;
+        }
         return detail::is_local_address_cached_addr(gid, addr, ec);
     }
 
@@ -151,6 +182,12 @@ namespace hpx { namespace agas {
         return detail::resolve(id, ec);
     }
 
+    hpx::future<std::vector<naming::address>> resolve(
+        std::vector<hpx::id_type> const& ids)
+    {
+        return detail::resolve_bulk_async(ids);
+    }
+
     bool resolve_local(
         naming::gid_type const& gid, naming::address& addr, error_code& ec)
     {
@@ -111,6 +111,9 @@ namespace hpx { namespace agas { namespace detail {
     naming::address (*resolve)(
         hpx::id_type const& id, error_code& ec) = nullptr;
 
+    hpx::future<std::vector<naming::address>> (*resolve_bulk_async)(
+        std::vector<hpx::id_type> const& ids) = nullptr;
+
     bool (*resolve_local)(naming::gid_type const& gid, naming::address& addr,
         error_code& ec) = nullptr;
 
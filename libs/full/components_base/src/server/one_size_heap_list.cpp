@@ -12,14 +12,17 @@
 #include <hpx/functional/bind_front.hpp>
 #include <hpx/modules/errors.hpp>
 #include <hpx/modules/format.hpp>
+#include <hpx/runtime_local/get_os_thread_count.hpp>
 #include <hpx/runtime_local/state.hpp>
 #include <hpx/thread_support/unlock_guard.hpp>
 #include <hpx/threading_base/register_thread.hpp>
 #include <hpx/threading_base/thread_data.hpp>
+#include <hpx/threading_base/thread_num_tss.hpp>
 #if defined(HPX_DEBUG)
 #include <hpx/modules/logging.hpp>
 #endif
 
+#include <atomic>
 #include <cstddef>
 #include <list>
 #include <memory>
@@ -34,7 +37,8 @@ namespace hpx { namespace util {
         LOSH_(info).format(
             "{1}::~{1}: size({2}), max_count({3}), alloc_count({4}), "
             "free_count({5})",
-            name(), heap_count_, max_alloc_count_, alloc_count_, free_count_);
+            name(), heap_count_.load(), max_alloc_count_.load(),
+            alloc_count_.load(), free_count_.load());
 
         if (alloc_count_ > free_count_)
         {
@@ -43,19 +47,163 @@ namespace hpx { namespace util {
                 alloc_count_ - free_count_);
         }
 #endif
+        delete[] caches_.load(std::memory_order_relaxed);
     }
 
-    void* one_size_heap_list::alloc(std::size_t count)
+    ///////////////////////////////////////////////////////////////////////////
+    one_size_heap_list::cache_type* one_size_heap_list::init_caches() const
     {
-        std::unique_lock guard(mtx_);
+        std::size_t const num_threads = hpx::get_os_thread_count();
+        if (num_threads == 0)
+        {
+            return nullptr;
+        }
+
+        std::lock_guard l(mtx_);
+
+        cache_type* caches = caches_.load(std::memory_order_relaxed);
+        if (caches == nullptr)
+        {
+            caches = new cache_type[num_threads];
+            for (std::size_t i = 0; i != num_threads; ++i)
+            {
+                caches[i].data_.store(nullptr, std::memory_order_relaxed);
+            }
+
+            num_caches_ = num_threads;
+            caches_.store(caches, std::memory_order_release);
+        }
+        return caches;
+    }
+
+    one_size_heap_list::cache_type* one_size_heap_list::get_cache()
+        const noexcept
+    {
+        std::size_t const worker = hpx::get_worker_thread_num();
+        if (worker == std::size_t(-1))
+        {
+            return nullptr;
+        }
+
+        cache_type* caches = caches_.load(std::memory_order_acquire);
+        if (HPX_UNLIKELY(caches == nullptr))
+        {
+            try
+            {
+                caches = init_caches();
+            }
+            catch (...)
+            {
+                return nullptr;
+            }
+            if (caches == nullptr)
+            {
+                return nullptr;
+            }
+        }
 
+        // the number of worker threads might have changed if the runtime
+        // was restarted
+        if (worker >= num_caches_)
+        {
+            return nullptr;
+        }
+        return &caches[worker];
+    }
+
+    util::wrapper_heap_base* one_size_heap_list::get_cached_heap()
+        const noexcept
+    {
+        cache_type* cache = get_cache();
+        if (cache == nullptr)
+        {
+            return nullptr;
+        }
+        return cache->data_.load(std::memory_order_relaxed);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    void* one_size_heap_list::alloc(std::size_t count)
+    {
         if (HPX_UNLIKELY(0 == count))
         {
-            guard.unlock();
             HPX_THROW_EXCEPTION(
                 bad_parameter, name() + "::alloc", "cannot allocate 0 objects");
         }
 
+        cache_type* cache = get_cache();
+        if (cache == nullptr || count > parameters_.capacity)
+        {
+            // not running on a worker thread, or a bulk allocation which
+            // needs a heap of its own
+            return alloc_shared(count);
+        }
+
+        // allocate from the heap of this worker thread
+        util::wrapper_heap_base* heap =
+            cache->data_.load(std::memory_order_relaxed);
+
+        void* p = nullptr;
+        if (heap != nullptr && heap->alloc(&p, count))
+        {
+#if defined(HPX_DEBUG)
+            // Allocation succeeded, update statistics.
+            std::size_t const allocated = (alloc_count_ += count);
+            std::size_t const in_use = allocated - free_count_;
+            if (in_use > max_alloc_count_)
+                max_alloc_count_ = in_use;
+#endif
+            return p;
+        }
+
+        return refill(*cache, count);
+    }
+
+    // the heap of this worker thread is exhausted, create a new one
+    void* one_size_heap_list::refill(cache_type& cache, std::size_t count)
+    {
+        std::unique_lock guard(mtx_);
+
+#if defined(HPX_DEBUG)
+        heap_list_.push_front(
+            create_heap_(class_name_.c_str(), heap_count_ + 1, parameters_));
+#else
+        heap_list_.push_front(
+            create_heap_(class_name_.c_str(), 0, parameters_));
+#endif
+        typename list_type::value_type heap = heap_list_.front();
+
+#if defined(HPX_DEBUG)
+        ++heap_count_;
+
+        LOSH_(info).format(
+            "{1}::refill: creating new heap[{2}], size is now {3}", name(),
+            heap_count_.load(), heap_list_.size());
+#endif
+        guard.unlock();
+
+        void* p = nullptr;
+        if (HPX_UNLIKELY(!heap->alloc(&p, count) || nullptr == p))
+        {
+            // out of memory
+            HPX_THROW_EXCEPTION(out_of_memory, name() + "::alloc",
+                "new heap failed to allocate {1} objects", count);
+        }
+
+#if defined(HPX_DEBUG)
+        alloc_count_ += count;
+#endif
+
+        // the heaps are not released before the list itself, the raw pointer
+        // stays valid
+        cache.data_.store(heap.get(), std::memory_order_relaxed);
+        return p;
+    }
+
+    void* one_size_heap_list::alloc_shared(std::size_t count)
+    {
+        std::unique_lock guard(mtx_);
+
         void* p = nullptr;
         {
             if (!heap_list_.empty())
@@ -73,9 +221,10 @@ namespace hpx { namespace util {
                     {
 #if defined(HPX_DEBUG)
                         // Allocation succeeded, update statistics.
-                        alloc_count_ += count;
-                        if (alloc_count_ - free_count_ > max_alloc_count_)
-                            max_alloc_count_ = alloc_count_ - free_count_;
+                        std::size_t const allocated = (alloc_count_ += count);
+                        std::size_t const in_use = allocated - free_count_;
+                        if (in_use > max_alloc_count_)
+                            max_alloc_count_ = in_use;
 #endif
                         return p;
                     }
@@ -92,15 +241,22 @@ namespace hpx { namespace util {
             }
         }
 
-        // Create new heap.
+        // Create new heap, large enough to hold all requested objects
+        // contiguously.
         bool did_create = false;
         {
+            heap_parameters parameters = parameters_;
+            if (count > parameters.capacity)
+            {
+                parameters.capacity = count;
+            }
+
 #if defined(HPX_DEBUG)
             heap_list_.push_front(create_heap_(
-                class_name_.c_str(), heap_count_ + 1, parameters_));
+                class_name_.c_str(), heap_count_ + 1, parameters));
 #else
             heap_list_.push_front(
-                create_heap_(class_name_.c_str(), 0, parameters_));
+                create_heap_(class_name_.c_str(), 0, parameters));
 #endif
 
             iterator itnew = heap_list_.begin();
@@ -126,7 +282,7 @@ namespace hpx { namespace util {
 
             LOSH_(info).format(
                 "{1}::alloc: creating new heap[{2}], size is now {3}", name(),
-                heap_count_, heap_list_.size());
+                heap_count_.load(), heap_list_.size());
 #endif
             did_create = true;
         }
@@ -139,7 +295,7 @@ namespace hpx { namespace util {
         guard.unlock();
 
         // Try again, we just got a new heap, so we should be good.
-        return alloc(count);
+        return alloc_shared(count);
     }
 
     bool one_size_heap_list::reschedule(void* p, std::size_t count)
@@ -168,6 +324,18 @@ namespace hpx { namespace util {
         if (reschedule(p, count))
             return;
 
+        // objects are usually freed on the worker thread which allocated
+        // them, try its heap first
+        if (util::wrapper_heap_base* heap = get_cached_heap();
+            heap != nullptr && heap->did_alloc(p))
+        {
+            heap->free(p, count);
+#if defined(HPX_DEBUG)
+            free_count_ += count;
+#endif
+            return;
+        }
+
         std::unique_lock ul(mtx_);
 
         // Find the heap which allocated this pointer.
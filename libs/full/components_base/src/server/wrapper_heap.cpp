@@ -16,6 +16,7 @@
 #include <hpx/synchronization/spinlock.hpp>
 #include <hpx/thread_support/unlock_guard.hpp>
 
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
 #if HPX_DEBUG_WRAPPER_HEAP != 0
@@ -75,6 +76,7 @@ namespace hpx { namespace components { namespace detail {
 #endif
         heap_parameters parameters)
       : pool_(nullptr)
+      , pool_end_(nullptr)
       , first_free_(nullptr)
       , parameters_(parameters)
       , free_size_(0)
@@ -99,6 +101,7 @@ namespace hpx { namespace components { namespace detail {
 
     wrapper_heap::wrapper_heap()
       : pool_(nullptr)
+      , pool_end_(nullptr)
       , first_free_(nullptr)
       , parameters_({0, 0, 0})
       , free_size_(0)
@@ -127,7 +130,10 @@ namespace hpx { namespace components { namespace detail {
         util::itt::heap_internal_access hia;
         HPX_UNUSED(hia);
 
-        return parameters_.capacity - free_size_;
+        std::size_t const free_size = free_size_.load();
+        return free_size < parameters_.capacity ?
+            parameters_.capacity - free_size :
+            0;
     }
 
     std::size_t wrapper_heap::free_size() const
@@ -135,7 +141,9 @@ namespace hpx { namespace components { namespace detail {
         util::itt::heap_internal_access hia;
         HPX_UNUSED(hia);
 
-        return free_size_;
+        std::size_t const free_size = free_size_.load();
+        return free_size < parameters_.capacity ? free_size :
+                                                  parameters_.capacity;
     }
 
     bool wrapper_heap::is_empty() const
@@ -151,9 +159,8 @@ namespace hpx { namespace components { namespace detail {
         util::itt::heap_internal_access hia;
         HPX_UNUSED(hia);
 
-        std::size_t const num_bytes =
-            parameters_.capacity * parameters_.element_size;
-        return first_free_ < pool_ + num_bytes;
+        char* first_free = first_free_.load();
+        return first_free != nullptr && first_free < pool_end_;
     }
 
     bool wrapper_heap::alloc(void** result, std::size_t count)
@@ -162,23 +169,38 @@ namespace hpx { namespace components { namespace detail {
             count * parameters_.element_size,
             HPX_WRAPPER_HEAP_INITIALIZED_MEMORY);
 
-        std::unique_lock l(mtx_);
+        std::size_t const num_bytes = count * parameters_.element_size;
 
-        if (!ensure_pool(count))
+        // the pool was released or is exhausted
+        char* p = first_free_.load();
+        if (p == nullptr ||
+            static_cast<std::size_t>(pool_end_ - p) < num_bytes)
+        {
             return false;
+        }
+
+        // reserve the slots, this prevents the heap from being released
+        // while the allocation is in flight
+        free_size_ -= count;
+
+        while (!first_free_.compare_exchange_weak(p, p + num_bytes))
+        {
+            if (p == nullptr ||
+                static_cast<std::size_t>(pool_end_ - p) < num_bytes)
+            {
+                // the last slots might have been freed in the meantime
+                if ((free_size_ += count) == parameters_.capacity)
+                {
+                    try_release();
+                }
+                return false;
+            }
+        }
 
 #if defined(HPX_DEBUG)
         alloc_count_ += count;
 #endif
 
-        void* p = first_free_;
-        HPX_ASSERT(p != nullptr);
-
-        first_free_ = first_free_ + count * parameters_.element_size;
-
-        HPX_ASSERT(free_size_ >= count);
-        free_size_ -= count;
-
 #if HPX_DEBUG_WRAPPER_HEAP != 0
         // init memory blocks
         debug::fill_bytes(p, initial_value, count * parameters_.element_size);
@@ -195,10 +217,8 @@ namespace hpx { namespace components { namespace detail {
 #if HPX_DEBUG_WRAPPER_HEAP != 0
         HPX_ASSERT(did_alloc(p));
 #endif
-        std::unique_lock l(mtx_);
-
 #if HPX_DEBUG_WRAPPER_HEAP != 0
-        char* p1 = p;
+        char* p1 = static_cast<char*>(p);
         std::size_t const total_num_bytes =
             parameters_.capacity * parameters_.element_size;
         std::size_t const num_bytes = count * parameters_.element_size;
@@ -206,8 +226,7 @@ namespace hpx { namespace components { namespace detail {
         HPX_ASSERT(nullptr != pool_ && p1 >= pool_);
         HPX_ASSERT(
             nullptr != pool_ && p1 + num_bytes <= pool_ + total_num_bytes);
-        HPX_ASSERT(first_free_ == nullptr || p1 != first_free_);
-        HPX_ASSERT(free_size_ + count <= parameters_.capacity);
+        HPX_ASSERT(p1 < first_free_.load());
         // make sure this has not been freed yet
         HPX_ASSERT(!debug::test_fill_bytes(p1, freed_value, num_bytes));
 
@@ -220,10 +239,12 @@ namespace hpx { namespace components { namespace detail {
 #if defined(HPX_DEBUG)
         free_count_ += count;
 #endif
-        free_size_ += count;
 
         // release the pool if this one was the last allocated item
-        test_release(l);
+        if (free_size_.fetch_add(count) + count == parameters_.capacity)
+        {
+            try_release();
+        }
     }
 
     bool wrapper_heap::did_alloc(void* p) const
@@ -302,6 +323,12 @@ namespace hpx { namespace components { namespace detail {
         base_gid_ = g;
     }
 
+    void wrapper_heap::try_release()
+    {
+        std::unique_lock l(mtx_);
+        test_release(l);
+    }
+
     bool wrapper_heap::test_release(std::unique_lock<mutex_type>& lk)
     {
         if (pool_ == nullptr)
@@ -309,18 +336,14 @@ namespace hpx { namespace components { namespace detail {
             return false;
         }
 
-        std::size_t const total_num_bytes =
-            parameters_.capacity * parameters_.element_size;
-
-        if (first_free_ < pool_ + total_num_bytes ||
-            free_size_ < parameters_.capacity)
+        // the heap can be released only once all of its slots have been
+        // handed out and were freed again
+        if (first_free_.load() < pool_end_ ||
+            free_size_.load() != parameters_.capacity)
         {
             return false;
         }
 
-        HPX_ASSERT(free_size_ == parameters_.capacity);
-        HPX_ASSERT(first_free_ == pool_ + total_num_bytes);
-
         // unbind in AGAS service
         if (base_gid_)
         {
@@ -335,24 +358,6 @@ namespace hpx { namespace components { namespace detail {
         return true;
     }
 
-    bool wrapper_heap::ensure_pool(std::size_t count)
-    {
-        if (nullptr == pool_)
-        {
-            return false;
-        }
-
-        std::size_t const num_bytes = count * parameters_.element_size;
-        std::size_t const total_num_bytes =
-            parameters_.capacity * parameters_.element_size;
-
-        if (first_free_ + num_bytes > pool_ + total_num_bytes)
-        {
-            return false;
-        }
-        return true;
-    }
-
     bool wrapper_heap::init_pool()
     {
         HPX_ASSERT(first_free_ == nullptr);
@@ -365,6 +370,7 @@ namespace hpx { namespace components { namespace detail {
             return false;
         }
 
+        pool_end_ = pool_ + total_num_bytes;
         first_free_ = (reinterpret_cast<std::size_t>(pool_) %
                               parameters_.element_alignment ==
                           0) ?
@@ -390,7 +396,7 @@ namespace hpx { namespace components { namespace detail {
                                                "<Unknown>")
 #if defined(HPX_DEBUG)
                     .format(": releasing heap: alloc count: {}, free count: {}",
-                        alloc_count_, free_count_)
+                        alloc_count_.load(), free_count_.load())
 #endif
                 << ".";
 
@@ -409,8 +415,8 @@ namespace hpx { namespace components { namespace detail {
             std::size_t const total_num_bytes =
                 parameters_.capacity * parameters_.element_size;
             allocator_type::free(pool_, total_num_bytes);
-            pool_ = first_free_ = nullptr;
-            free_size_ = 0;
+            pool_ = nullptr;
+            first_free_ = nullptr;
         }
     }
 }}}    // namespace hpx::components::detail
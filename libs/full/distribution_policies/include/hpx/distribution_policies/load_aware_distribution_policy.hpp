@@ -0,0 +1,455 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file load_aware_distribution_policy.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/actions_base/traits/extract_action.hpp>
+#include <hpx/actions_base/traits/is_distribution_policy.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/async_base/launch_policy.hpp>
+#include <hpx/async_distributed/applier/detail/apply_implementations_fwd.hpp>
+#include <hpx/async_distributed/dataflow.hpp>
+#include <hpx/async_distributed/detail/async_implementations_fwd.hpp>
+#include <hpx/components_base/agas_interface.hpp>
+#include <hpx/futures/future.hpp>
+#include <hpx/futures/traits/promise_local_result.hpp>
+#include <hpx/naming_base/id_type.hpp>
+#include <hpx/runtime_components/create_component_helpers.hpp>
+#include <hpx/serialization/serialization_fwd.hpp>
+#include <hpx/serialization/vector.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace components {
+
+    /// The load of a locality as known to the \a load_aware_distribution_policy
+    /// of the calling locality. Every locality samples its own load
+    /// periodically and gossips all loads it knows to a few other localities,
+    /// the values may therefore be slightly out of date.
+    struct locality_load
+    {
+        /// The id of the locality this load was sampled on
+        std::uint32_t locality_id = naming::invalid_locality_id;
+
+        /// The number of samples taken on that locality, newer samples
+        /// replace older ones while gossiping
+        std::uint64_t sequence = 0;
+
+        /// The number of HPX threads waiting to be executed
+        std::uint64_t queue_length = 0;
+
+        /// The number of worker threads
+        std::uint32_t num_threads = 0;
+
+        /// The fraction of idle cores in [0, 1]
+        double idle_rate = 1.0;
+
+        /// The resident memory of the locality (in bytes)
+        std::uint64_t memory = 0;
+
+    private:
+        friend class hpx::serialization::access;
+
+        template <typename Archive>
+        void serialize(Archive& ar, unsigned int const)
+        {
+            // clang-format off
+            ar & locality_id & sequence & queue_length & num_threads &
+                idle_rate & memory;
+            // clang-format on
+        }
+    };
+
+    /// The weights the criteria of the \a load_aware_distribution_policy
+    /// are combined with. A locality is scored with
+    ///
+    ///     queue_length * (queued threads / worker threads) +
+    ///     busy * (1 - idle rate) +
+    ///     memory * (resident memory / largest resident memory)
+    ///
+    /// and new items are placed on the locality with the lowest score.
+    struct load_weights
+    {
+        double queue_length = 1.0;
+        double busy = 1.0;
+        double memory = 0.0;
+
+    private:
+        friend class hpx::serialization::access;
+
+        template <typename Archive>
+        void serialize(Archive& ar, unsigned int const)
+        {
+            // clang-format off
+            ar & queue_length & busy & memory;
+            // clang-format on
+        }
+    };
+
+    /// Return the score of the given load as used for placing new items,
+    /// lower scores denote less loaded localities. The memory criterion is
+    /// taken into account only if the largest resident memory of all
+    /// localities compared is given.
+    inline double get_load_score(locality_load const& load,
+        load_weights const& weights, double max_memory = 0)
+    {
+        double const threads =
+            (std::max)(load.num_threads, std::uint32_t(1));
+        double score =
+            weights.queue_length * (double(load.queue_length) / threads) +
+            weights.busy * (1.0 - load.idle_rate);
+        if (max_memory > 0)
+        {
+            score += weights.memory * (double(load.memory) / max_memory);
+        }
+        return score;
+    }
+
+    /// Return the loads of the given localities as currently known to the
+    /// calling locality. This does not communicate with the other localities,
+    /// localities which were not heard of yet are reported with a sequence
+    /// number of zero.
+    HPX_EXPORT std::vector<locality_load> get_locality_loads(
+        std::vector<hpx::id_type> const& localities);
+
+    namespace detail {
+
+        /// \cond NOINTERNAL
+        // make the given localities known to the calling locality and start
+        // gossiping its load, if needed
+        HPX_EXPORT void start_load_gossip(
+            std::vector<hpx::id_type> const& localities);
+
+        HPX_EXPORT hpx::id_type get_least_loaded_locality(
+            std::vector<hpx::id_type> const& localities,
+            load_weights const& weights);
+
+        HPX_EXPORT std::vector<std::size_t> get_items_count_by_load(
+            std::size_t count, std::vector<hpx::id_type> const& localities,
+            load_weights const& weights);
+        /// \endcond
+    }    // namespace detail
+
+    /// This class specifies the parameters for a load-aware distribution
+    /// policy to use for creating components and invoking actions on a given
+    /// set of localities. New items are placed on the locality which is
+    /// currently the least loaded one (see \a load_weights).
+    ///
+    /// The placement decision doesn't query any performance counters. Instead,
+    /// every locality periodically samples its own queue length, idle rate,
+    /// and resident memory and gossips all loads it knows about to a few
+    /// randomly selected other localities. Items placed by a locality are
+    /// accounted for as queued work until a newer sample of the target
+    /// arrives, which prevents flooding a single locality in between two
+    /// updates. The gossiping starts once the policy is used for the first
+    /// time and is configured by:
+    ///
+    /// hpx.distribution_policies.load_gossip_interval  the time in between
+    ///                        two samples [ms] (default: 100)
+    /// hpx.distribution_policies.load_gossip_fanout    the number of
+    ///                        localities sent to after each sample (default: 2)
+    struct load_aware_distribution_policy
+    {
+    public:
+        /// Default-construct a new instance of a
+        /// \a load_aware_distribution_policy. This policy will represent one
+        /// locality (the local locality).
+        load_aware_distribution_policy() = default;
+
+        /// Create a new \a load_aware_distribution_policy representing the
+        /// given set of localities.
+        ///
+        /// \param locs     [in] The list of localities the new instance should
+        ///                 represent
+        /// \param weights  [in] The weights of the load criteria
+        ///
+        load_aware_distribution_policy operator()(
+            std::vector<id_type> const& locs,
+            load_weights const& weights = load_weights()) const
+        {
+#if defined(HPX_DEBUG)
+            for (id_type const& loc : locs)
+            {
+                HPX_ASSERT(naming::is_locality(loc));
+            }
+#endif
+            return load_aware_distribution_policy(locs, weights);
+        }
+
+        /// Create a new \a load_aware_distribution_policy representing the
+        /// given set of localities.
+        ///
+        /// \param locs     [in] The list of localities the new instance should
+        ///                 represent
+        /// \param weights  [in] The weights of the load criteria
+        ///
+        load_aware_distribution_policy operator()(std::vector<id_type>&& locs,
+            load_weights const& weights = load_weights()) const
+        {
+#if defined(HPX_DEBUG)
+            for (id_type const& loc : locs)
+            {
+                HPX_ASSERT(naming::is_locality(loc));
+            }
+#endif
+            return load_aware_distribution_policy(HPX_MOVE(locs), weights);
+        }
+
+        /// Create one object on the least loaded locality associated by
+        /// this policy instance
+        ///
+        /// \param vs  [in] The arguments which will be forwarded to the
+        ///            constructor of the new object.
+        ///
+        /// \note This function is part of the placement policy implemented by
+        ///       this class
+        ///
+        /// \returns A future holding the global address which represents
+        ///          the newly created object
+        ///
+        template <typename Component, typename... Ts>
+        hpx::future<hpx::id_type> create(Ts&&... vs) const
+        {
+            return create_async<Component>(
+                get_next_target(), HPX_FORWARD(Ts, vs)...);
+        }
+
+        /// \cond NOINTERNAL
+        using bulk_locality_result =
+            std::pair<hpx::id_type, std::vector<hpx::id_type>>;
+        /// \endcond
+
+        /// Create multiple objects on the localities associated by
+        /// this policy instance, the objects are distributed such that the
+        /// loads of the localities are evened out
+        ///
+        /// \param count [in] The number of objects to create
+        /// \param vs   [in] The arguments which will be forwarded to the
+        ///             constructors of the new objects.
+        ///
+        /// \note This function is part of the placement policy implemented by
+        ///       this class
+        ///
+        /// \returns A future holding the list of global addresses which
+        ///          represent the newly created objects
+        ///
+        template <typename Component, typename... Ts>
+        hpx::future<std::vector<bulk_locality_result>> bulk_create(
+            std::size_t count, Ts&&... vs) const
+        {
+            if (localities_.size() > 1)
+            {
+                std::vector<std::size_t> to_create =
+                    detail::get_items_count_by_load(
+                        count, localities_, weights_);
+
+                std::vector<hpx::id_type> targets;
+                std::vector<hpx::future<std::vector<hpx::id_type>>> objs;
+                for (std::size_t i = 0; i != to_create.size(); ++i)
+                {
+                    if (to_create[i] != 0)
+                    {
+                        targets.push_back(localities_[i]);
+                        objs.push_back(bulk_create_async<Component>(
+                            localities_[i], to_create[i], vs...));
+                    }
+                }
+
+                // consolidate all results
+                return hpx::dataflow(
+                    hpx::launch::sync,
+                    [targets = HPX_MOVE(targets)](
+                        std::vector<hpx::future<std::vector<hpx::id_type>>>&&
+                            v) mutable -> std::vector<bulk_locality_result> {
+                        HPX_ASSERT(targets.size() == v.size());
+
+                        std::vector<bulk_locality_result> result;
+                        result.reserve(v.size());
+
+                        for (std::size_t i = 0; i != v.size(); ++i)
+                        {
+                            result.emplace_back(
+                                HPX_MOVE(targets[i]), v[i].get());
+                        }
+                        return result;
+                    },
+                    HPX_MOVE(objs));
+            }
+
+            // handle special cases
+            hpx::id_type id = get_next_target();
+            hpx::future<std::vector<hpx::id_type>> f =
+                bulk_create_async<Component>(id, count, HPX_FORWARD(Ts, vs)...);
+
+            return f.then(hpx::launch::sync,
+                [id = HPX_MOVE(id)](hpx::future<std::vector<hpx::id_type>>&& f)
+                    -> std::vector<bulk_locality_result> {
+                    std::vector<bulk_locality_result> result;
+                    result.emplace_back(id, f.get());
+                    return result;
+                });
+        }
+
+        /// \note This function is part of the invocation policy implemented by
+        ///       this class
+        ///
+        template <typename Action>
+        struct async_result
+        {
+            using type = hpx::future<
+                typename traits::promise_local_result<typename hpx::traits::
+                        extract_action<Action>::remote_result_type>::type>;
+        };
+
+        template <typename Action, typename... Ts>
+        HPX_FORCEINLINE typename async_result<Action>::type async(
+            launch policy, Ts&&... vs) const
+        {
+            return hpx::detail::async_impl<Action>(
+                policy, get_next_target(), HPX_FORWARD(Ts, vs)...);
+        }
+
+        /// \note This function is part of the invocation policy implemented by
+        ///       this class
+        ///
+        template <typename Action, typename Callback, typename... Ts>
+        HPX_FORCEINLINE typename async_result<Action>::type async_cb(
+            launch policy, Callback&& cb, Ts&&... vs) const
+        {
+            return hpx::detail::async_cb_impl<Action>(policy, get_next_target(),
+                HPX_FORWARD(Callback, cb), HPX_FORWARD(Ts, vs)...);
+        }
+
+        /// \note This function is part of the invocation policy implemented by
+        ///       this class
+        ///
+        template <typename Action, typename Continuation, typename... Ts>
+        bool apply(Continuation&& c, threads::thread_priority priority,
+            Ts&&... vs) const
+        {
+            return hpx::detail::apply_impl<Action>(HPX_FORWARD(Continuation, c),
+                get_next_target(), priority, HPX_FORWARD(Ts, vs)...);
+        }
+
+        template <typename Action, typename... Ts>
+        bool apply(threads::thread_priority priority, Ts&&... vs) const
+        {
+            return hpx::detail::apply_impl<Action>(
+                get_next_target(), priority, HPX_FORWARD(Ts, vs)...);
+        }
+
+        /// \note This function is part of the invocation policy implemented by
+        ///       this class
+        ///
+        template <typename Action, typename Continuation, typename Callback,
+            typename... Ts>
+        bool apply_cb(Continuation&& c, threads::thread_priority priority,
+            Callback&& cb, Ts&&... vs) const
+        {
+            return hpx::detail::apply_cb_impl<Action>(
+                HPX_FORWARD(Continuation, c), get_next_target(), priority,
+                HPX_FORWARD(Callback, cb), HPX_FORWARD(Ts, vs)...);
+        }
+
+        template <typename Action, typename Callback, typename... Ts>
+        bool apply_cb(
+            threads::thread_priority priority, Callback&& cb, Ts&&... vs) const
+        {
+            return hpx::detail::apply_cb_impl<Action>(get_next_target(),
+                priority, HPX_FORWARD(Callback, cb), HPX_FORWARD(Ts, vs)...);
+        }
+
+        /// Returns the number of associated localities for this distribution
+        /// policy
+        ///
+        /// \note This function is part of the creation policy implemented by
+        ///       this class
+        ///
+        std::size_t get_num_localities() const
+        {
+            return localities_.empty() ? 1 : localities_.size();
+        }
+
+        /// Returns the locality which is the least loaded one at this point,
+        /// the returned locality is accounted for one more queued item
+        hpx::id_type get_next_target() const
+        {
+            if (localities_.empty())
+            {
+                return naming::get_id_from_locality_id(agas::get_locality_id());
+            }
+            if (localities_.size() == 1)
+            {
+                return localities_.front();
+            }
+            return detail::get_least_loaded_locality(localities_, weights_);
+        }
+
+        /// Returns the weights of the load criteria used by this policy
+        load_weights const& get_weights() const
+        {
+            return weights_;
+        }
+
+    protected:
+        /// \cond NOINTERNAL
+        load_aware_distribution_policy(
+            std::vector<id_type> const& localities, load_weights const& weights)
+          : localities_(localities)
+          , weights_(weights)
+        {
+        }
+
+        load_aware_distribution_policy(
+            std::vector<id_type>&& localities, load_weights const& weights)
+          : localities_(HPX_MOVE(localities))
+          , weights_(weights)
+        {
+        }
+
+        friend class hpx::serialization::access;
+
+        template <typename Archive>
+        void serialize(Archive& ar, unsigned int const)
+        {
+            // clang-format off
+            ar & localities_ & weights_;
+            // clang-format on
+        }
+
+        std::vector<id_type> localities_;    // localities to create things on
+        load_weights weights_;               // how to combine the criteria
+        /// \endcond
+    };
+
+    /// A predefined instance of the load-aware \a distribution_policy. It will
+    /// represent the local locality and will place all items to create here.
+    static load_aware_distribution_policy const load_aware{};
+}}    // namespace hpx::components
+
+/// \cond NOINTERNAL
+namespace hpx {
+
+    using hpx::components::load_aware;
+    using hpx::components::load_aware_distribution_policy;
+
+    namespace traits {
+        template <>
+        struct is_distribution_policy<
+            components::load_aware_distribution_policy> : std::true_type
+        {
+        };
+    }    // namespace traits
+}    // namespace hpx
+/// \endcond
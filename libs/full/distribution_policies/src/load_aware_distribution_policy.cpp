@@ -0,0 +1,403 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/actions_base/plain_action.hpp>
+#include <hpx/async_distributed/applier/apply.hpp>
+#include <hpx/components_base/agas_interface.hpp>
+#include <hpx/distribution_policies/load_aware_distribution_policy.hpp>
+#include <hpx/modules/threadmanager.hpp>
+#include <hpx/naming_base/id_type.hpp>
+#include <hpx/runtime_local/config_entry.hpp>
+#include <hpx/runtime_local/interval_timer.hpp>
+#include <hpx/runtime_local/runtime_local_fwd.hpp>
+#include <hpx/synchronization/spinlock.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <random>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+#if defined(__linux) || defined(linux) || defined(__linux__)
+#include <unistd.h>
+#endif
+
+namespace hpx { namespace components { namespace detail {
+
+    void receive_locality_loads(
+        std::uint32_t sender, std::vector<locality_load> const& loads);
+}}}    // namespace hpx::components::detail
+
+HPX_PLAIN_ACTION(hpx::components::detail::receive_locality_loads,
+    hpx_receive_locality_loads_action)
+
+namespace hpx { namespace components { namespace detail {
+
+    namespace {
+
+        std::uint64_t read_resident_memory()
+        {
+#if defined(__linux) || defined(linux) || defined(__linux__)
+            std::ifstream in("/proc/self/statm");
+            std::uint64_t size = 0, resident = 0;
+            if (in >> size >> resident)
+            {
+                return resident * std::uint64_t(sysconf(_SC_PAGESIZE));
+            }
+#endif
+            return 0;
+        }
+
+        locality_load sample_local_load(std::uint32_t locality_id)
+        {
+            auto& tm = hpx::threads::get_thread_manager();
+
+            locality_load load;
+            load.locality_id = locality_id;
+            load.num_threads = static_cast<std::uint32_t>(
+                (std::max)(tm.get_os_thread_count(), std::size_t(1)));
+            load.queue_length = static_cast<std::uint64_t>(
+                (std::max)(tm.get_queue_length(false), std::int64_t(0)));
+            load.idle_rate = (std::min)(
+                double(tm.get_idle_core_count()) / load.num_threads, 1.0);
+            load.memory = read_resident_memory();
+            return load;
+        }
+
+        struct load_entry
+        {
+            locality_load load;
+
+            // the number of items placed on this locality by the calling
+            // locality since the load was last updated
+            std::uint64_t pending = 0;
+        };
+
+        // The view of the loads of all localities known to this locality
+        class load_table
+        {
+            using mutex_type = hpx::spinlock;
+
+        public:
+            static load_table& get()
+            {
+                static load_table table;
+                return table;
+            }
+
+            // make the given localities known and start gossiping, if needed
+            void start(std::vector<hpx::id_type> const& localities)
+            {
+                std::unique_lock<mutex_type> l(mtx_);
+                for (hpx::id_type const& id : localities)
+                {
+                    add_peer(naming::get_locality_id_from_id(id));
+                }
+                start_locked(l);
+            }
+
+            void merge(
+                std::uint32_t sender, std::vector<locality_load> const& loads)
+            {
+                std::unique_lock<mutex_type> l(mtx_);
+                add_peer(sender);
+
+                for (locality_load const& load : loads)
+                {
+                    if (load.locality_id == here_ ||
+                        load.locality_id == naming::invalid_locality_id)
+                    {
+                        continue;
+                    }
+
+                    add_peer(load.locality_id);
+
+                    load_entry& entry = entries_[load.locality_id];
+                    if (load.sequence > entry.load.sequence)
+                    {
+                        entry.load = load;
+                        entry.pending = 0;
+                    }
+                }
+
+                // localities which never place anything themselves have to
+                // gossip their load as well
+                if (hpx::is_running())
+                {
+                    start_locked(l);
+                }
+            }
+
+            std::vector<locality_load> get_loads(
+                std::vector<hpx::id_type> const& localities)
+            {
+                std::vector<locality_load> result;
+                result.reserve(localities.size());
+
+                std::lock_guard<mutex_type> l(mtx_);
+                for (hpx::id_type const& id : localities)
+                {
+                    std::uint32_t locality_id =
+                        naming::get_locality_id_from_id(id);
+
+                    auto it = entries_.find(locality_id);
+                    if (it != entries_.end())
+                    {
+                        result.push_back(it->second.load);
+                    }
+                    else
+                    {
+                        result.emplace_back();
+                        result.back().locality_id = locality_id;
+                    }
+                }
+                return result;
+            }
+
+            // distribute count items onto the given localities, account for
+            // them as pending work
+            std::vector<std::size_t> place(std::size_t count,
+                std::vector<hpx::id_type> const& localities,
+                load_weights const& weights)
+            {
+                std::size_t const num_localities = localities.size();
+                std::vector<std::size_t> to_create(num_localities, 0);
+                if (count == 0 || num_localities == 0)
+                {
+                    return to_create;
+                }
+
+                std::lock_guard<mutex_type> l(mtx_);
+
+                std::vector<load_entry*> entries;
+                entries.reserve(num_localities);
+
+                double max_memory = 0;
+                for (hpx::id_type const& id : localities)
+                {
+                    std::uint32_t const locality_id =
+                        naming::get_locality_id_from_id(id);
+
+                    load_entry& entry = entries_[locality_id];
+                    entry.load.locality_id = locality_id;
+
+                    max_memory =
+                        (std::max)(max_memory, double(entry.load.memory));
+                    entries.push_back(&entry);
+                }
+
+                // placed items always count as queued work, otherwise all of
+                // them would end up on the same locality
+                double const pending_weight =
+                    weights.queue_length != 0 ? weights.queue_length : 1.0;
+
+                auto score = [&](load_entry const& e) {
+                    double const threads =
+                        (std::max)(e.load.num_threads, std::uint32_t(1));
+                    return get_load_score(e.load, weights, max_memory) +
+                        pending_weight * (double(e.pending) / threads);
+                };
+
+                if (count == 1)
+                {
+                    std::size_t best = 0;
+                    double best_score = score(*entries[0]);
+                    for (std::size_t i = 1; i != num_localities; ++i)
+                    {
+                        double const s = score(*entries[i]);
+                        if (s < best_score)
+                        {
+                            best_score = s;
+                            best = i;
+                        }
+                    }
+
+                    ++entries[best]->pending;
+                    to_create[best] = 1;
+                    return to_create;
+                }
+
+                // always place the next item on the locality with the lowest
+                // score
+                using item = std::pair<double, std::size_t>;
+                std::priority_queue<item, std::vector<item>,
+                    std::greater<item>>
+                    queue;
+                for (std::size_t i = 0; i != num_localities; ++i)
+                {
+                    queue.emplace(score(*entries[i]), i);
+                }
+
+                while (count-- != 0)
+                {
+                    std::size_t const i = queue.top().second;
+                    queue.pop();
+
+                    ++entries[i]->pending;
+                    ++to_create[i];
+                    queue.emplace(score(*entries[i]), i);
+                }
+                return to_create;
+            }
+
+        private:
+            load_table()
+              : here_(naming::invalid_locality_id)
+              , fanout_(2)
+              , started_(false)
+            {
+            }
+
+            void add_peer(std::uint32_t locality_id)
+            {
+                if (locality_id != here_ &&
+                    locality_id != naming::invalid_locality_id)
+                {
+                    peers_.insert(locality_id);
+                }
+            }
+
+            void start_locked(std::unique_lock<mutex_type>& l)
+            {
+                if (started_)
+                {
+                    return;
+                }
+                started_ = true;
+
+                here_ = agas::get_locality_id();
+                peers_.erase(here_);
+                gen_.seed(here_);
+
+                std::int64_t const interval = std::stoll(get_config_entry(
+                    "hpx.distribution_policies.load_gossip_interval", "100"));
+                fanout_ = std::stoul(get_config_entry(
+                    "hpx.distribution_policies.load_gossip_fanout", "2"));
+
+                timer_ = std::make_unique<hpx::util::interval_timer>(
+                    [this]() { return gossip(); },
+                    [this]() {
+                        std::lock_guard<mutex_type> l(mtx_);
+                        started_ = false;
+                    },
+                    (std::max)(interval, std::int64_t(1)) * 1000,
+                    "load_aware_distribution_policy", true);
+
+                l.unlock();
+                timer_->start();
+                l.lock();
+            }
+
+            // sample the local load and send all known loads to some of the
+            // peers
+            bool gossip()
+            {
+                locality_load load = sample_local_load(here_);
+
+                std::vector<locality_load> loads;
+                std::vector<std::uint32_t> targets;
+
+                {
+                    std::lock_guard<mutex_type> l(mtx_);
+
+                    load_entry& entry = entries_[here_];
+                    load.sequence = entry.load.sequence + 1;
+                    entry.load = load;
+                    entry.pending = 0;
+
+                    loads.reserve(entries_.size());
+                    for (auto const& e : entries_)
+                    {
+                        // skip localities which were never heard of
+                        if (e.second.load.sequence != 0)
+                        {
+                            loads.push_back(e.second.load);
+                        }
+                    }
+
+                    std::vector<std::uint32_t> peers(
+                        peers_.begin(), peers_.end());
+                    std::size_t const n = (std::min)(fanout_, peers.size());
+                    for (std::size_t i = 0; i != n; ++i)
+                    {
+                        std::uniform_int_distribution<std::size_t> dis(
+                            i, peers.size() - 1);
+                        std::swap(peers[i], peers[dis(gen_)]);
+                    }
+                    targets.assign(peers.begin(), peers.begin() + n);
+                }
+
+                for (std::uint32_t target : targets)
+                {
+                    hpx::apply<hpx_receive_locality_loads_action>(
+                        naming::get_id_from_locality_id(target), here_, loads);
+                }
+                return true;    // keep running
+            }
+
+            mutex_type mtx_;
+            std::map<std::uint32_t, load_entry> entries_;
+            std::set<std::uint32_t> peers_;
+            std::uint32_t here_;
+            std::size_t fanout_;
+            bool started_;
+            std::mt19937 gen_;
+            std::unique_ptr<hpx::util::interval_timer> timer_;
+        };
+    }    // namespace
+
+    void receive_locality_loads(
+        std::uint32_t sender, std::vector<locality_load> const& loads)
+    {
+        load_table::get().merge(sender, loads);
+    }
+
+    void start_load_gossip(std::vector<hpx::id_type> const& localities)
+    {
+        load_table::get().start(localities);
+    }
+
+    hpx::id_type get_least_loaded_locality(
+        std::vector<hpx::id_type> const& localities,
+        load_weights const& weights)
+    {
+        HPX_ASSERT(!localities.empty());
+
+        load_table& table = load_table::get();
+        table.start(localities);
+
+        std::vector<std::size_t> to_create =
+            table.place(1, localities, weights);
+        auto it = std::find(to_create.begin(), to_create.end(), 1);
+        return localities[std::distance(to_create.begin(), it)];
+    }
+
+    std::vector<std::size_t> get_items_count_by_load(std::size_t count,
+        std::vector<hpx::id_type> const& localities,
+        load_weights const& weights)
+    {
+        load_table& table = load_table::get();
+        table.start(localities);
+        return table.place(count, localities, weights);
+    }
+}    // namespace detail
+
+    std::vector<locality_load> get_locality_loads(
+        std::vector<hpx::id_type> const& localities)
+    {
+        return detail::load_table::get().get_loads(localities);
+    }
+}}    // namespace hpx::components
@@ -0,0 +1,147 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx_main.hpp>
+#include <hpx/include/actions.hpp>
+#include <hpx/include/components.hpp>
+#include <hpx/include/runtime.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/thread.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+struct test_server : hpx::components::component_base<test_server>
+{
+    hpx::id_type call() const
+    {
+        return hpx::find_here();
+    }
+
+    HPX_DEFINE_COMPONENT_ACTION(test_server, call)
+};
+
+typedef hpx::components::component<test_server> server_type;
+HPX_REGISTER_COMPONENT(server_type, test_server)
+
+typedef test_server::call_action call_action;
+HPX_REGISTER_ACTION(call_action)
+
+hpx::id_type get_locality()
+{
+    return hpx::find_here();
+}
+HPX_PLAIN_ACTION(get_locality, get_locality_action)
+
+///////////////////////////////////////////////////////////////////////////////
+bool is_one_of(hpx::id_type const& id, std::vector<hpx::id_type> const& ids)
+{
+    for (hpx::id_type const& i : ids)
+    {
+        if (i == id)
+            return true;
+    }
+    return false;
+}
+
+void test_load_aware_single(std::vector<hpx::id_type> const& localities)
+{
+    auto policy = hpx::load_aware(localities);
+
+    for (std::size_t i = 0; i != 10; ++i)
+    {
+        hpx::id_type id = hpx::new_<test_server>(policy).get();
+        HPX_TEST(is_one_of(hpx::async<call_action>(id).get(), localities));
+    }
+
+    for (std::size_t i = 0; i != 10; ++i)
+    {
+        HPX_TEST(is_one_of(
+            hpx::async<get_locality_action>(policy).get(), localities));
+    }
+}
+
+void test_load_aware_multiple(std::vector<hpx::id_type> const& localities)
+{
+    std::size_t const count = 10 * localities.size();
+
+    std::vector<hpx::id_type> ids =
+        hpx::new_<test_server[]>(hpx::load_aware(localities), count).get();
+    HPX_TEST_EQ(ids.size(), count);
+
+    // the items placed are accounted for as queued work until new load
+    // samples arrive, thus they end up spread over all localities
+    if (localities.size() > 1)
+    {
+        std::vector<hpx::id_type> used;
+        for (hpx::id_type const& id : ids)
+        {
+            hpx::id_type loc = hpx::async<call_action>(id).get();
+            HPX_TEST(is_one_of(loc, localities));
+            if (!is_one_of(loc, used))
+                used.push_back(loc);
+        }
+        HPX_TEST_LT(std::size_t(1), used.size());
+    }
+}
+
+void test_load_gossip(std::vector<hpx::id_type> const& localities)
+{
+    // give the localities some time to gossip their loads
+    std::vector<hpx::components::locality_load> loads;
+    for (int i = 0; i != 100; ++i)
+    {
+        loads = hpx::components::get_locality_loads(localities);
+
+        bool all_known = true;
+        for (auto const& load : loads)
+        {
+            if (load.sequence == 0)
+                all_known = false;
+        }
+        if (all_known)
+            break;
+
+        hpx::this_thread::sleep_for(std::chrono::milliseconds(50));
+    }
+
+    HPX_TEST_EQ(loads.size(), localities.size());
+    for (std::size_t i = 0; i != loads.size(); ++i)
+    {
+        HPX_TEST_EQ(loads[i].locality_id,
+            hpx::naming::get_locality_id_from_id(localities[i]));
+        HPX_TEST_NEQ(loads[i].sequence, std::uint64_t(0));
+        HPX_TEST_LT(std::uint32_t(0), loads[i].num_threads);
+        HPX_TEST(loads[i].idle_rate >= 0.0 && loads[i].idle_rate <= 1.0);
+    }
+}
+
+int main()
+{
+    std::vector<hpx::id_type> localities = hpx::find_all_localities();
+
+    test_load_aware_single(localities);
+    test_load_aware_multiple(localities);
+
+    // the loads are gossiped only if there is more than one locality
+    if (localities.size() > 1)
+    {
+        test_load_gossip(localities);
+    }
+
+    // a policy without localities places everything here
+    HPX_TEST_EQ(hpx::async<get_locality_action>(hpx::load_aware).get(),
+        hpx::find_here());
+
+    return hpx::util::report_errors();
+}
+#endif
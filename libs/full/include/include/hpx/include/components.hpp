@@ -40,11 +40,13 @@
 #include <hpx/components_base/server/migration_support.hpp>
 
 #include <hpx/runtime_distributed/copy_component.hpp>
+#include <hpx/runtime_distributed/load_balancing_support.hpp>
 #include <hpx/runtime_distributed/migrate_component.hpp>
 #include <hpx/runtime_distributed/runtime_support.hpp>
 #include <hpx/runtime_distributed/stubs/runtime_support.hpp>
 
 #include <hpx/distribution_policies/binpacking_distribution_policy.hpp>
 #include <hpx/distribution_policies/colocating_distribution_policy.hpp>
+#include <hpx/distribution_policies/load_aware_distribution_policy.hpp>
 #include <hpx/distribution_policies/target_distribution_policy.hpp>
 #include <hpx/distribution_policies/unwrapping_result_policy.hpp>
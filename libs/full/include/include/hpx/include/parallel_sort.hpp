@@ -11,3 +11,5 @@
 #include <hpx/parallel/algorithms/stable_sort.hpp>
 #include <hpx/parallel/container_algorithms/sort.hpp>
 #include <hpx/parallel/container_algorithms/stable_sort.hpp>
+
+#include <hpx/parallel/segmented_algorithms/sort.hpp>
@@ -20,10 +20,13 @@
 #include <hpx/modules/logging.hpp>
 #include <hpx/parcelset/message_handler_fwd.hpp>
 #include <hpx/performance_counters/agas_counter_types.hpp>
+#include <hpx/performance_counters/cuda_counter_types.hpp>
 #include <hpx/performance_counters/parcelhandler_counter_types.hpp>
+#include <hpx/performance_counters/registry.hpp>
 #include <hpx/performance_counters/threadmanager_counter_types.hpp>
 #include <hpx/runtime_components/console_logging.hpp>
 #include <hpx/runtime_configuration/runtime_mode.hpp>
+#include <hpx/runtime_configuration/startup_timings.hpp>
 #include <hpx/runtime_distributed.hpp>
 #include <hpx/runtime_distributed/applier.hpp>
 #include <hpx/runtime_distributed/runtime_fwd.hpp>
@@ -48,31 +51,47 @@ namespace hpx { namespace detail {
 
     ///////////////////////////////////////////////////////////////////////////
     // Install performance counter startup functions for core subsystems.
-    static void register_counter_types()
+    static void register_deferred_counter_types()
     {
-        auto& agas_client = naming::get_agas_client();
-        performance_counters::register_agas_counter_types(agas_client);
-        agas_client.register_server_instances();
-        lbt_ << "(2nd stage) pre_main: registered AGAS client-side "
-                "performance counter types";
+        performance_counters::register_agas_counter_types(
+            naming::get_agas_client());
+        lbt_ << "pre_main: registered AGAS client-side performance counter "
+                "types";
 
         get_runtime_distributed().register_counter_types();
-        lbt_ << "(2nd stage) pre_main: registered runtime performance "
-                "counter types";
+        lbt_ << "pre_main: registered runtime performance counter types";
 
         performance_counters::register_threadmanager_counter_types(
             threads::get_thread_manager());
-        lbt_ << "(2nd stage) pre_main: registered thread-manager performance "
-                "counter types";
+        lbt_ << "pre_main: registered thread-manager performance counter "
+                "types";
+
+#if defined(HPX_HAVE_GPU_SUPPORT)
+        performance_counters::register_cuda_counter_types();
+        lbt_ << "pre_main: registered cuda performance counter types";
+#endif
 
 #if defined(HPX_HAVE_NETWORKING)
         performance_counters::register_parcelhandler_counter_types(
             applier::get_applier().get_parcel_handler());
-        lbt_ << "(2nd stage) pre_main: registered parcelset performance "
-                "counter types";
+        lbt_ << "pre_main: registered parcelset performance counter types";
 #endif
     }
 
+    static void register_counter_types()
+    {
+        naming::get_agas_client().register_server_instances();
+        lbt_ << "(2nd stage) pre_main: registered AGAS server instances";
+
+        // Most applications never query any performance counters, the counter
+        // types of the core subsystems are registered only once the registry
+        // is queried for the first time.
+        performance_counters::registry::instance().add_deferred_counter_types(
+            &register_deferred_counter_types);
+        lbt_ << "(2nd stage) pre_main: deferred registering performance "
+                "counter types";
+    }
+
     ///////////////////////////////////////////////////////////////////////////
 #if defined(HPX_HAVE_NETWORKING)
     static void register_message_handlers()
@@ -110,7 +129,10 @@ namespace hpx { namespace detail {
             lbt_ << "(2nd stage) pre_main: addressing services enabled";
 
             // Load components, so that we can use the barrier LCO.
-            exit_code = runtime_support::load_components(find_here());
+            {
+                util::startup_timer t("component loading");
+                exit_code = runtime_support::load_components(find_here());
+            }
             lbt_ << "(2nd stage) pre_main: loaded components"
                  << (exit_code ? ", application exit has been requested" : "");
 
@@ -119,15 +141,21 @@ namespace hpx { namespace detail {
             register_message_handlers();
 #endif
             // Register all counter types before the startup functions are being
-            // executed.
+            // executed, the core counter types are registered on first use.
             register_counter_types();
 
             rt.set_state(hpx::state::pre_startup);
-            runtime_support::call_startup_functions(find_here(), true);
+            {
+                util::startup_timer t("pre-startup functions");
+                runtime_support::call_startup_functions(find_here(), true);
+            }
             lbt_ << "(3rd stage) pre_main: ran pre-startup functions";
 
             rt.set_state(hpx::state::startup);
-            runtime_support::call_startup_functions(find_here(), false);
+            {
+                util::startup_timer t("startup functions");
+                runtime_support::call_startup_functions(find_here(), false);
+            }
             lbt_ << "(4th stage) pre_main: ran startup functions";
         }
         else
@@ -135,7 +163,10 @@ namespace hpx { namespace detail {
             lbt_ << "(2nd stage) pre_main: addressing services enabled";
 
             // Load components, so that we can use the barrier LCO.
-            exit_code = runtime_support::load_components(find_here());
+            {
+                util::startup_timer t("component loading");
+                exit_code = runtime_support::load_components(find_here());
+            }
             lbt_ << "(2nd stage) pre_main: loaded components"
                  << (exit_code ? ", application exit has been requested" : "");
 
@@ -173,7 +204,7 @@ namespace hpx { namespace detail {
             register_message_handlers();
 #endif
             // Register all counter types before the startup functions are being
-            // executed.
+            // executed, the core counter types are registered on first use.
             register_counter_types();
 
             // Second stage bootstrap synchronizes performance counter loading
@@ -181,14 +212,20 @@ namespace hpx { namespace detail {
             distributed::barrier::synchronize();
             lbt_ << "(3rd stage) pre_main: passed 3rd stage boot barrier";
 
-            runtime_support::call_startup_functions(find_here(), true);
+            {
+                util::startup_timer t("pre-startup functions");
+                runtime_support::call_startup_functions(find_here(), true);
+            }
             lbt_ << "(3rd stage) pre_main: ran pre-startup functions";
 
             // Third stage separates pre-startup and startup function phase.
             distributed::barrier::synchronize();
             lbt_ << "(4th stage) pre_main: passed 4th stage boot barrier";
 
-            runtime_support::call_startup_functions(find_here(), false);
+            {
+                util::startup_timer t("startup functions");
+                runtime_support::call_startup_functions(find_here(), false);
+            }
             lbt_ << "(4th stage) pre_main: ran startup functions";
 
             // Forth stage bootstrap synchronizes startup functions across all
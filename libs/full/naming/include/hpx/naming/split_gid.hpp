@@ -11,12 +11,18 @@
 #include <hpx/config.hpp>
 #include <hpx/futures/future.hpp>
 #include <hpx/naming_base/gid_type.hpp>
+#include <hpx/naming_base/id_type.hpp>
 
 #include <mutex>
 
 namespace hpx::naming::detail {
 
     HPX_EXPORT hpx::future<gid_type> split_gid_if_needed(gid_type& id);
+
+    // This additionally starts replenishing the credit of the id in the
+    // background once it falls to HPX_GLOBALCREDIT_REPLENISH_LOG2, this avoids
+    // having to wait for AGAS when the credit is exhausted.
+    HPX_EXPORT hpx::future<gid_type> split_gid_if_needed(id_type_impl& id);
     HPX_EXPORT hpx::future<gid_type> split_gid_if_needed_locked(
         std::unique_lock<gid_type::mutex_type>& l, gid_type& gid);
 }    // namespace hpx::naming::detail
@@ -11,6 +11,7 @@
 #include <hpx/components_base/agas_interface.hpp>
 #include <hpx/components_base/detail/agas_interface_functions.hpp>
 #include <hpx/functional/bind.hpp>
+#include <hpx/functional/bind_front.hpp>
 #include <hpx/lcos_local/detail/preprocess_future.hpp>
 #include <hpx/memory/serialization/intrusive_ptr.hpp>
 #include <hpx/modules/checkpoint_base.hpp>
@@ -95,6 +96,12 @@
 // is performed synchronously. This is done to ensure that AGAS has accounted
 // for the requested credit increase.
 //
+// To avoid having to wait for AGAS in the common case, the credit of an
+// id_type which is being split is replenished asynchronously as soon as it
+// falls to HPX_GLOBALCREDIT_REPLENISH_LOG2. The additional credit is added to
+// the id_type only after AGAS has acknowledged the increment, in the meantime
+// the remaining credit continues to be split.
+//
 // Note that both the id_type instance staying behind and the one sent along
 // are replenished before sending out the parcel at the sending locality.
 //
@@ -295,6 +302,77 @@ namespace hpx::naming {
             return hpx::make_ready_future(new_gid);
         }
 
+        ///////////////////////////////////////////////////////////////////////
+        void postprocess_replenish(
+            hpx::intrusive_ptr<id_type_impl> const& p, future<std::int64_t> f)
+        {
+            id_type_impl& gid = *p;
+            std::unique_lock<gid_type::mutex_type> l(gid.get_mutex());
+
+            gid.set_replenishing(false);
+            if (f.has_exception())
+            {
+                // the credit will be replenished synchronously once exhausted
+                return;
+            }
+
+            constexpr std::int64_t initial_credit =
+                static_cast<std::int64_t>(HPX_GLOBALCREDIT_INITIAL);
+
+            // The credit held by the gid can't grow beyond the initial
+            // credit, the remaining credit is returned to AGAS instead.
+            std::int64_t const excess_credit = get_credit_from_gid(gid);
+
+            gid_type excess_gid = gid;    // strips lock-bit
+            set_credit_for_gid(gid, initial_credit);
+            set_credit_split_mask_for_gid(gid);
+
+            if (excess_credit != 0)
+            {
+                l.unlock();
+
+                // Note that this operation may be asynchronous
+                agas::decref(excess_gid, excess_credit);
+            }
+        }
+
+        void replenish_credits_async_locked(
+            std::unique_lock<gid_type::mutex_type>& l, id_type_impl& gid)
+        {
+            HPX_ASSERT_OWNS_LOCK(l);
+
+            if (gid.is_replenishing() || !has_credits(gid) ||
+                get_log2credit_from_gid(gid) > HPX_GLOBALCREDIT_REPLENISH_LOG2)
+            {
+                return;
+            }
+
+            gid.set_replenishing(true);
+
+            // keep the id alive until the credit has arrived
+            hpx::intrusive_ptr<id_type_impl> p(&gid);
+
+            gid_type unlocked_gid = gid;    // strips lock-bit
+            l.unlock();
+
+            agas::incref(unlocked_gid,
+                static_cast<std::int64_t>(HPX_GLOBALCREDIT_INITIAL))
+                .then(hpx::launch::sync,
+                    hpx::bind_front(postprocess_replenish, HPX_MOVE(p)));
+        }
+
+        hpx::future<gid_type> split_gid_if_needed(id_type_impl& gid)
+        {
+            std::unique_lock<gid_type::mutex_type> l(gid.get_mutex());
+
+            hpx::future<gid_type> f = split_gid_if_needed_locked(l, gid);
+            if (f.is_ready() && l.owns_lock())
+            {
+                replenish_credits_async_locked(l, gid);
+            }
+            return f;
+        }
+
         ///////////////////////////////////////////////////////////////////////
         gid_type move_gid(gid_type& gid)
         {
@@ -433,6 +433,19 @@ namespace hpx { namespace naming {
         return !(gid.get_msb() & gid_type::dynamically_assigned);
     }
 
+    // Return whether the gid carries the address of a (non-migratable)
+    // component located on the given locality. Such gids can be resolved
+    // without consulting AGAS. Gids of localities (and the runtime support
+    // objects) are not dynamically assigned either but don't encode an
+    // address.
+    inline bool refers_to_local_lva(
+        gid_type const& gid, std::uint32_t locality_id) noexcept
+    {
+        return refers_to_local_lva(gid) && gid.get_lsb() != 0 &&
+            (gid.get_msb() & gid_type::component_type_mask) != 0 &&
+            get_locality_id_from_gid(gid) == locality_id;
+    }
+
     inline gid_type replace_component_type(
         gid_type const& gid, std::uint32_t type) noexcept
     {
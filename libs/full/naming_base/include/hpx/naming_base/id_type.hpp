@@ -256,6 +256,17 @@ namespace hpx {
                 type_ = type;
             }
 
+            // whether an asynchronous replenishment of the credit is under
+            // way, this is protected by the lock of the gid
+            constexpr bool is_replenishing() const noexcept
+            {
+                return replenishing_;
+            }
+            constexpr void set_replenishing(bool replenishing) noexcept
+            {
+                replenishing_ = replenishing;
+            }
+
             // custom allocator support
             static void* operator new(std::size_t size)
             {
@@ -297,6 +308,7 @@ namespace hpx {
             util::atomic_count count_;
             id_type::management_type type_ =
                 id_type::management_type::unknown_deleter;
+            bool replenishing_ = false;
 
             static util::internal_allocator<id_type_impl> alloc_;
         };
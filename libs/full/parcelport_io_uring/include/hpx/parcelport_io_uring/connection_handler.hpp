@@ -0,0 +1,154 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_IO_URING)
+#include <hpx/modules/synchronization.hpp>
+
+#include <hpx/parcelport_io_uring/locality.hpp>
+#include <hpx/parcelport_io_uring/receiver.hpp>
+#include <hpx/parcelport_io_uring/ring.hpp>
+#include <hpx/parcelport_io_uring/sender.hpp>
+#include <hpx/parcelset/parcelport_impl.hpp>
+#include <hpx/parcelset_base/locality.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <set>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <vector>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx::parcelset {
+
+    namespace policies::io_uring {
+
+        class HPX_EXPORT connection_handler;
+    }    // namespace policies::io_uring
+
+    template <>
+    struct connection_handler_traits<policies::io_uring::connection_handler>
+    {
+        using connection_type = policies::io_uring::sender;
+        using send_early_parcel = std::true_type;
+        using do_background_work = std::true_type;
+        using send_immediate_parcels = std::false_type;
+
+        static constexpr const char* type() noexcept
+        {
+            return "io_uring";
+        }
+
+        static constexpr const char* pool_name() noexcept
+        {
+            return "parcel-pool-io_uring";
+        }
+
+        static constexpr const char* pool_name_postfix() noexcept
+        {
+            return "-io_uring";
+        }
+    };
+
+    namespace policies::io_uring {
+
+        parcelset::locality parcelport_address(
+            util::runtime_configuration const& ini);
+
+        class HPX_EXPORT connection_handler
+          : public parcelport_impl<connection_handler>
+        {
+            using base_type = parcelport_impl<connection_handler>;
+            using receiver_type = receiver<connection_handler>;
+
+        public:
+            static std::vector<std::string> runtime_configuration()
+            {
+                std::vector<std::string> lines;
+                return lines;
+            }
+
+            connection_handler(util::runtime_configuration const& ini,
+                threads::policies::callback_notifier const& notifier);
+
+            ~connection_handler();
+
+            // Start the handling of connections.
+            bool do_run();
+
+            // Stop the handling of connectons.
+            void do_stop();
+
+            // Return the name of this locality
+            std::string get_locality_name() const;
+
+            std::shared_ptr<sender> create_connection(
+                parcelset::locality const& l, error_code& ec);
+
+            parcelset::locality agas_locality(
+                util::runtime_configuration const& ini) const;
+
+            parcelset::locality create_locality() const;
+
+            // Submit the prepared operations and process the completed ones
+            bool background_work(
+                std::size_t num_thread, parcelport_background_mode mode);
+
+            // Invoked by a receiver once its connection was closed
+            void remove_receiver(std::shared_ptr<receiver_type> const& c,
+                std::error_code const& e);
+
+        private:
+            // Receives the completions of the multishot accept operation
+            struct acceptor : operation
+            {
+                explicit acceptor(connection_handler& handler) noexcept
+                  : handler_(handler)
+                {
+                }
+
+                void on_completion(
+                    std::int32_t res, std::uint32_t flags) override;
+
+                connection_handler& handler_;
+            };
+
+            void accept();
+            void handle_accept(std::int32_t res, std::uint32_t flags);
+
+            void io_service_work();
+
+            ring ring_;
+
+            /// Socket used to listen for incoming connections.
+            int listen_fd_;
+            acceptor acceptor_;
+            std::atomic<bool> accepting_;
+
+            std::atomic<bool> stopping_;
+            std::atomic<bool> stopped_;
+
+            /// The list of accepted connections
+            mutable hpx::spinlock connections_mtx_;
+
+            using accepted_connections_set =
+                std::set<std::shared_ptr<receiver_type>>;
+            accepted_connections_set accepted_connections_;
+        };
+    }    // namespace policies::io_uring
+}    // namespace hpx::parcelset
+
+#include <hpx/config/warnings_suffix.hpp>
+
+#endif
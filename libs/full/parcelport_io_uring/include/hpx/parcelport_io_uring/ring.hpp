@@ -0,0 +1,160 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_IO_URING)
+#include <hpx/assert.hpp>
+#include <hpx/modules/synchronization.hpp>
+
+#include <liburing.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace hpx::parcelset::policies::io_uring {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Base class of all objects waiting for the completion of operations
+    // submitted to the ring. The address of the object is stored as the user
+    // data of the submission queue entries.
+    struct operation
+    {
+        virtual ~operation() = default;
+
+        // Invoked for each completion queue entry of the operation. All
+        // completions are processed by one thread at a time, in the order
+        // they were posted by the kernel.
+        virtual void on_completion(std::int32_t res, std::uint32_t flags) = 0;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The io_uring instance shared by all connections of the parcelport,
+    // together with the buffers registered with it.
+    class HPX_EXPORT ring
+    {
+    public:
+        struct parameters
+        {
+            // number of submission queue entries
+            unsigned entries = 1024;
+
+            // buffers provided to the kernel for multishot receives, the
+            // number of buffers is rounded up to a power of two
+            unsigned num_receive_buffers = 256;
+            unsigned receive_buffer_size = 65536;
+
+            // registered buffers small messages are copied to for sending
+            unsigned num_send_buffers = 64;
+            unsigned send_buffer_size = 65536;
+
+            // use SEND_ZC if supported by the kernel
+            bool zero_copy = true;
+        };
+
+        explicit ring(parameters const& params);
+        ~ring();
+
+        ring(ring const&) = delete;
+        ring(ring&&) = delete;
+        ring& operator=(ring const&) = delete;
+        ring& operator=(ring&&) = delete;
+
+        // Prepare a submission queue entry for the given operation using f.
+        // The entry is handed to the kernel by the next call to submit().
+        template <typename F>
+        void prepare(operation* op, F&& f)
+        {
+            std::lock_guard<hpx::spinlock> l(submission_mtx_);
+
+            io_uring_sqe* sqe = get_sqe_locked();
+            f(sqe);
+            io_uring_sqe_set_data(sqe, op);
+
+            ++num_prepared_;
+        }
+
+        // Submit all prepared entries to the kernel using a single system
+        // call, returns whether any entry was submitted.
+        bool submit();
+
+        // Process the available completion queue entries, returns whether
+        // any was found.
+        bool poll();
+
+        // Buffers provided to the kernel for receive operations
+        static constexpr std::uint16_t receive_buffer_group() noexcept
+        {
+            return 0;
+        }
+
+        char const* receive_buffer(std::uint16_t id) const noexcept
+        {
+            HPX_ASSERT(id < num_receive_buffers_);
+            return receive_buffers_.get() +
+                std::size_t(id) * receive_buffer_size_;
+        }
+
+        // Give a buffer selected by a receive operation back to the kernel
+        void recycle_receive_buffer(std::uint16_t id);
+
+        // Registered send buffers, acquire_send_buffer returns -1 if no
+        // buffer is available
+        int acquire_send_buffer();
+        void release_send_buffer(int index);
+
+        char* send_buffer(int index) const noexcept
+        {
+            HPX_ASSERT(index >= 0 && unsigned(index) < num_send_buffers_);
+            return send_buffers_.get() +
+                std::size_t(index) * send_buffer_size_;
+        }
+
+        std::size_t send_buffer_size() const noexcept
+        {
+            return send_buffer_size_;
+        }
+
+        bool zero_copy() const noexcept
+        {
+            return zero_copy_;
+        }
+
+    private:
+        io_uring_sqe* get_sqe_locked();
+
+        ::io_uring ring_;
+
+        hpx::spinlock submission_mtx_;
+        std::size_t num_prepared_;
+
+        hpx::spinlock completion_mtx_;
+
+        // buffers provided for multishot receives
+        hpx::spinlock receive_buffers_mtx_;
+        io_uring_buf_ring* buffer_ring_;
+        unsigned num_receive_buffers_;
+        std::size_t receive_buffer_size_;
+        std::unique_ptr<char[]> receive_buffers_;
+
+        // registered buffers used for sending
+        hpx::spinlock send_buffers_mtx_;
+        unsigned num_send_buffers_;
+        std::size_t send_buffer_size_;
+        std::unique_ptr<char[]> send_buffers_;
+        std::vector<int> free_send_buffers_;
+
+        bool zero_copy_;
+    };
+}    // namespace hpx::parcelset::policies::io_uring
+
+#endif
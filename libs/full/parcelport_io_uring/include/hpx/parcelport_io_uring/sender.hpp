@@ -0,0 +1,413 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_IO_URING)
+#include <hpx/assert.hpp>
+#include <hpx/modules/functional.hpp>
+#include <hpx/modules/runtime_local.hpp>
+#include <hpx/modules/threading_base.hpp>
+#include <hpx/modules/timing.hpp>
+
+#include <hpx/parcelport_io_uring/ring.hpp>
+#include <hpx/parcelset/parcelport_connection.hpp>
+#include <hpx/parcelset_base/detail/data_point.hpp>
+#include <hpx/parcelset_base/locality.hpp>
+#include <hpx/parcelset_base/parcelport.hpp>
+
+#include <liburing.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+namespace hpx::parcelset::policies::io_uring {
+
+    class sender
+      : public parcelset::parcelport_connection<sender, std::vector<char>>
+      , public operation
+    {
+        using postprocess_handler_type =
+            hpx::move_only_function<void(std::error_code const&)>;
+
+        using parcel_postprocess_type =
+            hpx::move_only_function<void(std::error_code const&,
+                parcelset::locality const&, std::shared_ptr<sender>)>;
+
+    public:
+        // Construct a sending parcelport_connection for the given connected
+        // socket, the socket is closed when the object is destroyed.
+        sender(ring& r, int fd, parcelset::locality const& locality_id,
+            parcelset::parcelport* pp)
+          : ring_(r)
+          , fd_(fd)
+          , there_(locality_id)
+          , zero_copy_threshold_(pp->get_zero_copy_serialization_threshold())
+          , num_header_iovecs_(0)
+          , current_(0)
+          , send_buffer_(-1)
+          , pending_notifications_(0)
+          , done_(false)
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+          , pp_(pp)
+#endif
+        {
+        }
+
+        ~sender()
+        {
+            HPX_ASSERT(send_buffer_ == -1);
+
+            // the socket does not linger, data which was not transmitted yet
+            // is still delivered by the kernel
+            if (fd_ != -1)
+            {
+                ::close(fd_);
+            }
+        }
+
+        parcelset::locality const& destination() const noexcept
+        {
+            return there_;
+        }
+
+        void verify_(parcelset::locality const& parcel_locality_id) const
+        {
+            HPX_ASSERT(parcel_locality_id == there_);
+            HPX_UNUSED(parcel_locality_id);
+        }
+
+        template <typename Handler, typename ParcelPostprocess>
+        void async_write(
+            Handler&& handler, ParcelPostprocess&& parcel_postprocess)
+        {
+#if defined(HPX_TRACK_STATE_OF_OUTGOING_TCP_CONNECTION)
+            HPX_ASSERT(state_ == state_send_pending);
+#endif
+            HPX_ASSERT(!buffer_.data_.empty());
+            HPX_ASSERT(!handler_);
+            HPX_ASSERT(!postprocess_handler_);
+            HPX_ASSERT(!self_);
+
+            handler_ = HPX_FORWARD(Handler, handler);
+            postprocess_handler_ =
+                HPX_FORWARD(ParcelPostprocess, parcel_postprocess);
+            HPX_ASSERT(handler_);
+            HPX_ASSERT(postprocess_handler_);
+
+#if defined(HPX_TRACK_STATE_OF_OUTGOING_TCP_CONNECTION)
+            state_ = state_async_write;
+#endif
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+            buffer_.data_point_.time_ = timer_.elapsed_nanoseconds();
+#endif
+            // The message header, the chunk descriptions and the data which
+            // was serialized normally are sent first, using the same layout
+            // as the TCP parcelport.
+            iovecs_.clear();
+            add_iovec(&buffer_.size_, sizeof(buffer_.size_));
+            add_iovec(&buffer_.data_size_, sizeof(buffer_.data_size_));
+            add_iovec(&buffer_.num_chunks_, sizeof(buffer_.num_chunks_));
+
+            std::vector<parcel_buffer_type::transmission_chunk_type>& chunks =
+                buffer_.transmission_chunks_;
+            if (!chunks.empty())
+            {
+                add_iovec(chunks.data(),
+                    chunks.size() *
+                        sizeof(parcel_buffer_type::transmission_chunk_type));
+            }
+            add_iovec(buffer_.data_.data(), buffer_.data_.size());
+
+            // Small messages are copied into a registered buffer and sent
+            // using a single operation.
+            std::size_t header_size = 0;
+            for (iovec const& iov : iovecs_)
+            {
+                header_size += iov.iov_len;
+            }
+
+            if (header_size <= ring_.send_buffer_size() &&
+                (send_buffer_ = ring_.acquire_send_buffer()) != -1)
+            {
+                char* dest = ring_.send_buffer(send_buffer_);
+                for (iovec const& iov : iovecs_)
+                {
+                    std::memcpy(dest, iov.iov_base, iov.iov_len);
+                    dest += iov.iov_len;
+                }
+
+                iovecs_.clear();
+                add_iovec(ring_.send_buffer(send_buffer_), header_size);
+            }
+            num_header_iovecs_ = iovecs_.size();
+
+            // The chunks holding zero-copy serialized data are sent one by
+            // one, by definition those exceed the zero-copy threshold.
+            for (serialization::serialization_chunk& c : buffer_.chunks_)
+            {
+                if (c.type_ == serialization::chunk_type::chunk_type_pointer)
+                {
+                    add_iovec(c.data_.cpos_, c.size_);
+                }
+            }
+
+            current_ = 0;
+            error_ = std::error_code();
+
+            // keep this object alive until all operations have completed
+            self_ = shared_from_this();
+            send_next();
+        }
+
+    private:
+        void add_iovec(void const* data, std::size_t size)
+        {
+            iovecs_.push_back(iovec{const_cast<void*>(data), size});
+        }
+
+        static void reset_handler(postprocess_handler_type handler)
+        {
+            handler.reset();
+        }
+
+        // Submit the operation sending the next part of the message
+        void send_next()
+        {
+            while (current_ != iovecs_.size() && iovecs_[current_].iov_len == 0)
+            {
+                ++current_;
+            }
+
+            if (current_ == iovecs_.size())
+            {
+                done_ = true;
+                if (pending_notifications_ == 0)
+                {
+                    handle_write();
+                }
+                return;
+            }
+
+            iovec const& iov = iovecs_[current_];
+            if (current_ >= num_header_iovecs_)
+            {
+                // zero-copy chunk
+                bool const zero_copy = ring_.zero_copy();
+                ring_.prepare(this, [&](io_uring_sqe* sqe) {
+                    if (zero_copy)
+                    {
+                        io_uring_prep_send_zc(sqe, fd_, iov.iov_base,
+                            iov.iov_len, MSG_NOSIGNAL, 0);
+                    }
+                    else
+                    {
+                        io_uring_prep_send(
+                            sqe, fd_, iov.iov_base, iov.iov_len, MSG_NOSIGNAL);
+                    }
+                });
+            }
+            else if (send_buffer_ != -1)
+            {
+                // message copied into a registered buffer
+                bool const zero_copy =
+                    ring_.zero_copy() && iov.iov_len >= zero_copy_threshold_;
+                ring_.prepare(this, [&](io_uring_sqe* sqe) {
+                    if (zero_copy)
+                    {
+                        io_uring_prep_send_zc_fixed(sqe, fd_, iov.iov_base,
+                            iov.iov_len, MSG_NOSIGNAL, 0,
+                            unsigned(send_buffer_));
+                    }
+                    else
+                    {
+                        io_uring_prep_send(
+                            sqe, fd_, iov.iov_base, iov.iov_len, MSG_NOSIGNAL);
+                    }
+                });
+            }
+            else
+            {
+                // gather-write the parts of the message header
+                msg_ = msghdr();
+                msg_.msg_iov = &iovecs_[current_];
+                msg_.msg_iovlen = num_header_iovecs_ - current_;
+
+                ring_.prepare(this, [&](io_uring_sqe* sqe) {
+                    io_uring_prep_sendmsg(sqe, fd_, &msg_, MSG_NOSIGNAL);
+                });
+            }
+        }
+
+        // Account for the given number of bytes which were sent
+        void consume(std::size_t bytes) noexcept
+        {
+            while (bytes != 0)
+            {
+                HPX_ASSERT(current_ != iovecs_.size());
+
+                iovec& iov = iovecs_[current_];
+                std::size_t const n = (std::min)(bytes, iov.iov_len);
+                iov.iov_base = static_cast<char*>(iov.iov_base) + n;
+                iov.iov_len -= n;
+                bytes -= n;
+
+                if (iov.iov_len == 0)
+                {
+                    ++current_;
+                }
+            }
+        }
+
+        void on_completion(std::int32_t res, std::uint32_t flags) override
+        {
+            if (flags & IORING_CQE_F_NOTIF)
+            {
+                // the kernel does not access the data of a zero-copy send
+                // anymore
+                HPX_ASSERT(pending_notifications_ != 0);
+                if (--pending_notifications_ == 0 && done_)
+                {
+                    handle_write();
+                }
+                return;
+            }
+
+            if (flags & IORING_CQE_F_MORE)
+            {
+                // a notification will follow for this zero-copy send
+                ++pending_notifications_;
+            }
+
+            if (res < 0 && (res == -EINTR || res == -EAGAIN))
+            {
+                send_next();
+                return;
+            }
+
+            if (res <= 0)
+            {
+                error_ = res < 0 ?
+                    std::error_code(-res, std::system_category()) :
+                    std::make_error_code(std::errc::connection_reset);
+
+                done_ = true;
+                if (pending_notifications_ == 0)
+                {
+                    handle_write();
+                }
+                return;
+            }
+
+            // short sends are continued with the remaining data
+            consume(std::size_t(res));
+            send_next();
+        }
+
+        // handle completed write operation
+        void handle_write()
+        {
+            done_ = false;
+            if (send_buffer_ != -1)
+            {
+                ring_.release_send_buffer(send_buffer_);
+                send_buffer_ = -1;
+            }
+
+            std::error_code const e = error_;
+
+            // just call initial handler
+            handler_(e);
+
+            postprocess_handler_type handler;
+            std::swap(handler, handler_);
+
+            if (threads::threadmanager_is(hpx::state::running))
+            {
+                // the handler needs to be reset on an HPX thread (it destroys
+                // the parcel, which in turn might invoke HPX functions)
+                threads::thread_init_data data(
+                    threads::make_thread_function_nullary(util::deferred_call(
+                        &sender::reset_handler, HPX_MOVE(handler))),
+                    "sender::reset_handler");
+                threads::register_thread(data);
+            }
+            else
+            {
+                reset_handler(HPX_MOVE(handler));
+            }
+
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+            if (!e)
+            {
+                // complete data point and push back onto gatherer
+                buffer_.data_point_.time_ =
+                    timer_.elapsed_nanoseconds() - buffer_.data_point_.time_;
+                pp_->add_sent_data(buffer_.data_point_);
+            }
+#endif
+            buffer_.clear();
+
+#if defined(HPX_TRACK_STATE_OF_OUTGOING_TCP_CONNECTION)
+            state_ = state_handle_read_ack;
+#endif
+            // Call post-processing handler, which will send remaining pending
+            // parcels. Pass along the connection so it can be reused if more
+            // parcels have to be sent. This may destroy this object.
+            parcel_postprocess_type postprocess_handler;
+            std::swap(postprocess_handler, postprocess_handler_);
+
+            std::shared_ptr<sender> self = HPX_MOVE(self_);
+            postprocess_handler(e, there_, HPX_MOVE(self));
+        }
+
+        ring& ring_;
+        int fd_;
+
+        // the other (receiving) end of this connection
+        parcelset::locality there_;
+        std::size_t zero_copy_threshold_;
+
+        // the parts of the message which are still to be sent, the first
+        // num_header_iovecs_ entries are sent using a single operation
+        std::vector<iovec> iovecs_;
+        std::size_t num_header_iovecs_;
+        std::size_t current_;
+        msghdr msg_;
+
+        // registered buffer holding the copied message header, if any
+        int send_buffer_;
+
+        // zero-copy sends whose notification was not received yet
+        std::size_t pending_notifications_;
+        bool done_;
+        std::error_code error_;
+
+        std::shared_ptr<sender> self_;
+
+        // Counters and their data containers.
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+        hpx::chrono::high_resolution_timer timer_;
+        parcelset::parcelport* pp_;
+#endif
+
+        postprocess_handler_type handler_;
+        parcel_postprocess_type postprocess_handler_;
+    };
+}    // namespace hpx::parcelset::policies::io_uring
+
+#endif
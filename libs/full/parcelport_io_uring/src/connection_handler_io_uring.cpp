@@ -0,0 +1,488 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_IO_URING)
+#include <hpx/assert.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/modules/execution_base.hpp>
+#include <hpx/modules/functional.hpp>
+#include <hpx/modules/logging.hpp>
+#include <hpx/modules/runtime_configuration.hpp>
+#include <hpx/modules/runtime_local.hpp>
+#include <hpx/modules/threading_base.hpp>
+#include <hpx/modules/util.hpp>
+
+#include <hpx/parcelport_io_uring/connection_handler.hpp>
+#include <hpx/parcelport_io_uring/locality.hpp>
+#include <hpx/parcelport_io_uring/receiver.hpp>
+#include <hpx/parcelport_io_uring/ring.hpp>
+#include <hpx/parcelport_io_uring/sender.hpp>
+#include <hpx/parcelset_base/locality.hpp>
+
+#include <liburing.h>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <system_error>
+#include <thread>
+
+namespace hpx::parcelset::policies::io_uring {
+
+    namespace detail {
+
+        std::error_code last_error() noexcept
+        {
+            return std::error_code(errno, std::system_category());
+        }
+
+        // Disable the Nagle algorithm for the given socket
+        void set_no_delay(int fd) noexcept
+        {
+            int const enable = 1;
+            ::setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &enable, sizeof(enable));
+        }
+
+        using addrinfo_ptr = std::unique_ptr<addrinfo, void (*)(addrinfo*)>;
+
+        addrinfo_ptr resolve(std::string const& address, std::uint16_t port,
+            bool passive, std::error_code& ec)
+        {
+            addrinfo hints{};
+            hints.ai_family = AF_UNSPEC;
+            hints.ai_socktype = SOCK_STREAM;
+            hints.ai_flags = passive ? AI_PASSIVE : 0;
+
+            addrinfo* result = nullptr;
+            if (::getaddrinfo(address.c_str(), std::to_string(port).c_str(),
+                    &hints, &result) != 0)
+            {
+                ec = std::make_error_code(std::errc::host_unreachable);
+                result = nullptr;
+            }
+            return addrinfo_ptr(result, &::freeaddrinfo);
+        }
+
+        // Create a socket listening on the given endpoint
+        int listen(std::string const& address, std::uint16_t port,
+            std::error_code& ec)
+        {
+            addrinfo_ptr result = resolve(address, port, true, ec);
+            for (addrinfo* ai = result.get(); ai != nullptr; ai = ai->ai_next)
+            {
+                int const fd = ::socket(ai->ai_family,
+                    ai->ai_socktype | SOCK_CLOEXEC, ai->ai_protocol);
+                if (fd == -1)
+                {
+                    ec = last_error();
+                    continue;
+                }
+
+                int const enable = 1;
+                ::setsockopt(
+                    fd, SOL_SOCKET, SO_REUSEADDR, &enable, sizeof(enable));
+
+                if (::bind(fd, ai->ai_addr, ai->ai_addrlen) == 0 &&
+                    ::listen(fd, SOMAXCONN) == 0)
+                {
+                    return fd;
+                }
+
+                ec = last_error();
+                ::close(fd);
+            }
+            return -1;
+        }
+
+        // Create a socket connected to the given endpoint
+        int connect(std::string const& address, std::uint16_t port,
+            std::error_code& ec)
+        {
+            addrinfo_ptr result = resolve(address, port, false, ec);
+            for (addrinfo* ai = result.get(); ai != nullptr; ai = ai->ai_next)
+            {
+                int const fd = ::socket(ai->ai_family,
+                    ai->ai_socktype | SOCK_CLOEXEC, ai->ai_protocol);
+                if (fd == -1)
+                {
+                    ec = last_error();
+                    continue;
+                }
+
+                if (::connect(fd, ai->ai_addr, ai->ai_addrlen) == 0)
+                {
+                    return fd;
+                }
+
+                ec = last_error();
+                ::close(fd);
+            }
+            return -1;
+        }
+
+        ring::parameters ring_parameters(
+            util::runtime_configuration const& ini)
+        {
+            using hpx::util::get_entry_as;
+
+            ring::parameters params;
+            params.entries = get_entry_as<unsigned>(
+                ini, "hpx.parcel.io_uring.queue_depth", params.entries);
+            params.num_receive_buffers = get_entry_as<unsigned>(ini,
+                "hpx.parcel.io_uring.receive_buffers",
+                params.num_receive_buffers);
+            params.receive_buffer_size = get_entry_as<unsigned>(ini,
+                "hpx.parcel.io_uring.receive_buffer_size",
+                params.receive_buffer_size);
+            params.num_send_buffers = get_entry_as<unsigned>(ini,
+                "hpx.parcel.io_uring.send_buffers", params.num_send_buffers);
+            params.send_buffer_size = get_entry_as<unsigned>(ini,
+                "hpx.parcel.io_uring.send_buffer_size",
+                params.send_buffer_size);
+            params.zero_copy = get_entry_as<int>(
+                ini, "hpx.parcel.io_uring.zero_copy_send", 1) != 0;
+            return params;
+        }
+
+        // The endpoints of this parcelport are offset from the ones used by
+        // the TCP parcelport, which allows to enable both at the same time
+        parcelset::locality make_locality(
+            util::runtime_configuration const& ini, char const* section,
+            std::uint16_t default_port)
+        {
+            std::uint16_t const offset =
+                hpx::util::get_entry_as<std::uint16_t>(
+                    ini, "hpx.parcel.io_uring.port_offset", 1000);
+
+            if (ini.has_section(section))
+            {
+                util::section const* sec = ini.get_section(section);
+                if (nullptr != sec)
+                {
+                    std::uint16_t const port =
+                        hpx::util::get_entry_as<std::uint16_t>(
+                            *sec, "port", default_port);
+                    return parcelset::locality(locality(
+                        sec->get_entry("address", HPX_INITIAL_IP_ADDRESS),
+                        std::uint16_t(port + offset)));
+                }
+            }
+
+            return parcelset::locality(locality(HPX_INITIAL_IP_ADDRESS,
+                std::uint16_t(HPX_INITIAL_IP_PORT + offset)));
+        }
+    }    // namespace detail
+
+    parcelset::locality parcelport_address(
+        util::runtime_configuration const& ini)
+    {
+        return detail::make_locality(ini, "hpx.parcel", HPX_INITIAL_IP_PORT);
+    }
+
+    connection_handler::connection_handler(
+        util::runtime_configuration const& ini,
+        threads::policies::callback_notifier const& notifier)
+      : base_type(ini, parcelport_address(ini), notifier)
+      , ring_(detail::ring_parameters(ini))
+      , listen_fd_(-1)
+      , acceptor_(*this)
+      , accepting_(false)
+      , stopping_(false)
+      , stopped_(false)
+    {
+        if (here_.type() != std::string("io_uring"))
+        {
+            HPX_THROW_EXCEPTION(network_error,
+                "io_uring::parcelport::parcelport",
+                "this parcelport was instantiated to represent an unexpected "
+                "locality type: {}",
+                here_.type());
+        }
+    }
+
+    connection_handler::~connection_handler()
+    {
+        HPX_ASSERT(listen_fd_ == -1);
+        HPX_ASSERT(accepted_connections_.empty());
+    }
+
+    bool connection_handler::do_run()
+    {
+        locality const& here = here_.get<locality>();
+
+        std::error_code ec;
+        listen_fd_ = detail::listen(here.address(), here.port(), ec);
+        if (listen_fd_ == -1)
+        {
+            HPX_THROW_EXCEPTION(network_error, "io_uring::parcelport::run",
+                "{} (while trying to listen on: {})", ec.message(), here_);
+            return false;
+        }
+
+        accept();
+        ring_.submit();
+
+        // The background work is not executed while HPX is starting, the IO
+        // service threads drive the ring instead.
+        for (std::size_t i = 0; i != io_service_pool_.size(); ++i)
+        {
+            io_service_pool_.get_io_service(int(i)).post(
+                hpx::bind(&connection_handler::io_service_work, this));
+        }
+        return true;
+    }
+
+    void connection_handler::do_stop()
+    {
+        {
+            // stop accepting connections, shut down all accepted connections
+            // which terminates their receive operations
+            std::lock_guard<hpx::spinlock> l(connections_mtx_);
+            stopping_ = true;
+
+            if (listen_fd_ != -1)
+            {
+                ::shutdown(listen_fd_, SHUT_RDWR);
+            }
+
+            for (std::shared_ptr<receiver_type> const& c :
+                accepted_connections_)
+            {
+                c->shutdown();
+            }
+        }
+
+        // process completions until no operation refers to a connection
+        util::yield_while(
+            [this]() {
+                ring_.submit();
+                ring_.poll();
+
+                std::lock_guard<hpx::spinlock> l(connections_mtx_);
+                return accepting_ || !accepted_connections_.empty();
+            },
+            "io_uring::connection_handler::do_stop");
+
+        stopped_ = true;
+        if (listen_fd_ != -1)
+        {
+            ::close(listen_fd_);
+            listen_fd_ = -1;
+        }
+    }
+
+    std::string connection_handler::get_locality_name() const
+    {
+        char name[256] = {};
+        if (::gethostname(name, sizeof(name) - 1) != 0)
+        {
+            return "<unknown>";
+        }
+        return name;
+    }
+
+    std::shared_ptr<sender> connection_handler::create_connection(
+        parcelset::locality const& l, error_code& ec)
+    {
+        locality const& there = l.get<locality>();
+
+        // Connect to the target locality, retry if needed
+        int fd = -1;
+        std::error_code error =
+            std::make_error_code(std::errc::resource_unavailable_try_again);
+        for (std::size_t i = 0; i < HPX_MAX_NETWORK_RETRIES; ++i)
+        {
+            // An exit here, avoids hangs when late parcels are in flight
+            // (those are mainly decref requests).
+            if (stopped_)
+                return std::shared_ptr<sender>();
+
+            fd = detail::connect(there.address(), there.port(), error);
+            if (fd != -1)
+                break;
+
+            // wait for a really short amount of time
+            if (hpx::threads::get_self_ptr())
+            {
+                this_thread::suspend(
+                    hpx::threads::thread_schedule_state::pending,
+                    "connection_handler(io_uring)::create_connection");
+            }
+            else
+            {
+                std::this_thread::sleep_for(
+                    std::chrono::milliseconds(HPX_NETWORK_RETRIES_SLEEP));
+            }
+        }
+
+        if (fd == -1)
+        {
+            if (tolerate_node_faults())
+                return std::shared_ptr<sender>();
+
+            HPX_THROWS_IF(ec, network_error,
+                "io_uring::connection_handler::get_connection",
+                "{} (while trying to connect to: {})", error.message(), l);
+            return std::shared_ptr<sender>();
+        }
+
+        // make sure the Nagle algorithm is disabled for this socket
+        detail::set_no_delay(fd);
+
+        std::shared_ptr<sender> sender_connection =
+            std::make_shared<sender>(ring_, fd, l, this);
+
+        if (&ec != &throws)
+            ec = make_success_code();
+
+        return sender_connection;
+    }
+
+    parcelset::locality connection_handler::agas_locality(
+        util::runtime_configuration const& ini) const
+    {
+        return detail::make_locality(ini, "hpx.agas", HPX_INITIAL_IP_PORT);
+    }
+
+    parcelset::locality connection_handler::create_locality() const
+    {
+        return parcelset::locality(locality());
+    }
+
+    bool connection_handler::background_work(
+        std::size_t num_thread, parcelport_background_mode /* mode */)
+    {
+        if (stopped_ || num_thread >= max_background_thread_)
+        {
+            return false;
+        }
+
+        // sends and receives complete through the same ring, all operations
+        // prepared since the last call are submitted at once
+        bool has_work = ring_.submit();
+        has_work = ring_.poll() || has_work;
+        return has_work;
+    }
+
+    void connection_handler::io_service_work()
+    {
+        std::size_t k = 0;
+
+        // We only execute work on the IO service while HPX is starting
+        while (hpx::is_starting())
+        {
+            bool has_work = ring_.submit();
+            has_work = ring_.poll() || has_work;
+            if (has_work)
+            {
+                k = 0;
+            }
+            else
+            {
+                ++k;
+                util::detail::yield_k(k,
+                    "hpx::parcelset::policies::io_uring::connection_handler::"
+                    "io_service_work");
+            }
+        }
+    }
+
+    void connection_handler::accept()
+    {
+        accepting_ = true;
+        ring_.prepare(&acceptor_, [this](io_uring_sqe* sqe) {
+            io_uring_prep_multishot_accept(
+                sqe, listen_fd_, nullptr, nullptr, SOCK_CLOEXEC);
+        });
+    }
+
+    void connection_handler::acceptor::on_completion(
+        std::int32_t res, std::uint32_t flags)
+    {
+        handler_.handle_accept(res, flags);
+    }
+
+    // accepted new incoming connection
+    void connection_handler::handle_accept(
+        std::int32_t res, std::uint32_t flags)
+    {
+        if (res >= 0)
+        {
+            int const fd = res;
+            detail::set_no_delay(fd);
+
+            std::shared_ptr<receiver_type> c = std::make_shared<receiver_type>(
+                ring_, fd, get_max_inbound_message_size(), *this);
+
+            bool accepted = false;
+            {
+                // keep track of all accepted connections, connections
+                // accepted while stopping are closed by the destructor
+                std::lock_guard<hpx::spinlock> l(connections_mtx_);
+                if (!stopping_)
+                {
+                    accepted_connections_.insert(c);
+                    accepted = true;
+                }
+            }
+
+            // now accept the incoming connection by starting to read from the
+            // socket
+            if (accepted)
+            {
+                c->start();
+            }
+        }
+        else if (!stopping_)
+        {
+            LPT_(error).format("handle accept operation completion: error: {}",
+                std::error_code(-res, std::system_category()).message());
+        }
+
+        if (!(flags & IORING_CQE_F_MORE))
+        {
+            // the multishot operation terminated, re-arm it unless the
+            // parcelport is being stopped
+            if (stopping_)
+            {
+                accepting_ = false;
+            }
+            else
+            {
+                accept();
+            }
+        }
+    }
+
+    // the receive operation of an accepted connection terminated
+    void connection_handler::remove_receiver(
+        std::shared_ptr<receiver_type> const& c, std::error_code const& e)
+    {
+        if (!stopping_ && e != std::errc::connection_reset &&
+            e != std::errc::operation_canceled)
+        {
+            LPT_(error).format(
+                "handle read operation completion: error: {}", e.message());
+        }
+
+        // remove this connection from the list of known connections
+        std::lock_guard<hpx::spinlock> l(connections_mtx_);
+        accepted_connections_.erase(c);
+    }
+}    // namespace hpx::parcelset::policies::io_uring
+
+#endif
@@ -0,0 +1,68 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_IO_URING)
+#include <hpx/plugin/traits/plugin_config_data.hpp>
+
+#include <hpx/parcelport_io_uring/connection_handler.hpp>
+#include <hpx/plugin_factories/parcelport_factory.hpp>
+
+namespace hpx::traits {
+
+    // Inject additional configuration data into the factory registry for this
+    // type. This information ends up in the system wide configuration database
+    // under the plugin specific section:
+    //
+    //      [hpx.parcel.io_uring]
+    //      ...
+    //      priority = 10
+    //      port_offset = 1000
+    //      queue_depth = 1024
+    //      ...
+    //
+    template <>
+    struct plugin_config_data<
+        hpx::parcelset::policies::io_uring::connection_handler>
+    {
+        static constexpr char const* priority() noexcept
+        {
+            return "10";
+        }
+
+        static constexpr void init(int* /* argc */, char*** /* argv */,
+            util::command_line_handling& /* cfg */) noexcept
+        {
+        }
+
+        static constexpr void destroy() noexcept {}
+
+        static constexpr char const* call() noexcept
+        {
+            return
+                // offset added to the ports used by the TCP parcelport
+                "port_offset = ${HPX_PARCEL_IO_URING_PORT_OFFSET:1000}\n"
+                // number of submission queue entries
+                "queue_depth = ${HPX_PARCEL_IO_URING_QUEUE_DEPTH:1024}\n"
+                // buffers provided to the kernel for receiving
+                "receive_buffers = ${HPX_PARCEL_IO_URING_RECEIVE_BUFFERS:256}\n"
+                "receive_buffer_size = "
+                "${HPX_PARCEL_IO_URING_RECEIVE_BUFFER_SIZE:65536}\n"
+                // registered buffers small messages are sent from
+                "send_buffers = ${HPX_PARCEL_IO_URING_SEND_BUFFERS:64}\n"
+                "send_buffer_size = "
+                "${HPX_PARCEL_IO_URING_SEND_BUFFER_SIZE:65536}\n"
+                // use zero-copy sends if supported by the kernel
+                "zero_copy_send = ${HPX_PARCEL_IO_URING_ZERO_COPY_SEND:1}\n";
+        }
+    };
+}    // namespace hpx::traits
+
+HPX_REGISTER_PARCELPORT(
+    hpx::parcelset::policies::io_uring::connection_handler, io_uring)
+
+#endif
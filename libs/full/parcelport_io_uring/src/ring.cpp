@@ -0,0 +1,227 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_IO_URING)
+#include <hpx/assert.hpp>
+#include <hpx/modules/errors.hpp>
+
+#include <hpx/parcelport_io_uring/ring.hpp>
+
+#include <liburing.h>
+#include <sys/uio.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace hpx::parcelset::policies::io_uring {
+
+    namespace detail {
+
+        // the kernel requires the size of a provided buffer ring to be a
+        // power of two
+        unsigned round_up_to_power_of_two(unsigned n) noexcept
+        {
+            unsigned result = 1;
+            while (result < n && result < 32768)
+            {
+                result <<= 1;
+            }
+            return result;
+        }
+
+        // maximal number of completion queue entries handled at once
+        constexpr unsigned max_completion_batch = 64;
+    }    // namespace detail
+
+    ring::ring(parameters const& params)
+      : num_prepared_(0)
+      , buffer_ring_(nullptr)
+      , num_receive_buffers_(
+            detail::round_up_to_power_of_two(params.num_receive_buffers))
+      , receive_buffer_size_(params.receive_buffer_size)
+      , receive_buffers_(
+            new char[std::size_t(num_receive_buffers_) * receive_buffer_size_])
+      , num_send_buffers_(params.num_send_buffers)
+      , send_buffer_size_(params.send_buffer_size)
+      , send_buffers_(
+            new char[std::size_t(num_send_buffers_) * send_buffer_size_])
+      , zero_copy_(false)
+    {
+        int ret = io_uring_queue_init(params.entries, &ring_, 0);
+        if (ret < 0)
+        {
+            HPX_THROW_EXCEPTION(network_error, "io_uring::ring::ring",
+                "io_uring_queue_init failed: {}", std::strerror(-ret));
+        }
+
+        // provide the receive buffers to the kernel
+        buffer_ring_ = io_uring_setup_buf_ring(&ring_, num_receive_buffers_,
+            receive_buffer_group(), 0, &ret);
+        if (buffer_ring_ == nullptr)
+        {
+            io_uring_queue_exit(&ring_);
+            HPX_THROW_EXCEPTION(network_error, "io_uring::ring::ring",
+                "io_uring_setup_buf_ring failed: {}", std::strerror(-ret));
+        }
+
+        int const mask = io_uring_buf_ring_mask(num_receive_buffers_);
+        for (unsigned i = 0; i != num_receive_buffers_; ++i)
+        {
+            io_uring_buf_ring_add(buffer_ring_,
+                receive_buffers_.get() + std::size_t(i) * receive_buffer_size_,
+                unsigned(receive_buffer_size_), std::uint16_t(i), mask, int(i));
+        }
+        io_uring_buf_ring_advance(buffer_ring_, int(num_receive_buffers_));
+
+        // register the send buffers, this avoids mapping the pages of the
+        // buffers for each operation
+        if (num_send_buffers_ != 0)
+        {
+            std::vector<iovec> iovecs(num_send_buffers_);
+            for (unsigned i = 0; i != num_send_buffers_; ++i)
+            {
+                iovecs[i].iov_base = send_buffer(int(i));
+                iovecs[i].iov_len = send_buffer_size_;
+            }
+
+            ret = io_uring_register_buffers(
+                &ring_, iovecs.data(), num_send_buffers_);
+            if (ret < 0)
+            {
+                io_uring_free_buf_ring(&ring_, buffer_ring_,
+                    num_receive_buffers_, receive_buffer_group());
+                io_uring_queue_exit(&ring_);
+                HPX_THROW_EXCEPTION(network_error, "io_uring::ring::ring",
+                    "io_uring_register_buffers failed: {}",
+                    std::strerror(-ret));
+            }
+
+            free_send_buffers_.reserve(num_send_buffers_);
+            for (unsigned i = num_send_buffers_; i != 0; --i)
+            {
+                free_send_buffers_.push_back(int(i - 1));
+            }
+        }
+
+        if (params.zero_copy)
+        {
+            if (io_uring_probe* probe = io_uring_get_probe_ring(&ring_))
+            {
+                zero_copy_ =
+                    io_uring_opcode_supported(probe, IORING_OP_SEND_ZC) != 0;
+                io_uring_free_probe(probe);
+            }
+        }
+    }
+
+    ring::~ring()
+    {
+        io_uring_free_buf_ring(
+            &ring_, buffer_ring_, num_receive_buffers_, receive_buffer_group());
+        io_uring_queue_exit(&ring_);
+    }
+
+    io_uring_sqe* ring::get_sqe_locked()
+    {
+        io_uring_sqe* sqe = io_uring_get_sqe(&ring_);
+        if (sqe == nullptr)
+        {
+            // the submission queue is full, hand the prepared entries to the
+            // kernel to make room
+            io_uring_submit(&ring_);
+            num_prepared_ = 0;
+
+            sqe = io_uring_get_sqe(&ring_);
+        }
+        HPX_ASSERT(sqe != nullptr);
+        return sqe;
+    }
+
+    bool ring::submit()
+    {
+        std::unique_lock<hpx::spinlock> l(submission_mtx_, std::try_to_lock);
+        if (!l.owns_lock() || num_prepared_ == 0)
+        {
+            return false;
+        }
+
+        num_prepared_ = 0;
+        io_uring_submit(&ring_);
+        return true;
+    }
+
+    bool ring::poll()
+    {
+        // completions are processed by one thread at a time, this keeps the
+        // data received by multishot operations in order
+        std::unique_lock<hpx::spinlock> l(completion_mtx_, std::try_to_lock);
+        if (!l.owns_lock())
+        {
+            return false;
+        }
+
+        bool has_work = false;
+        io_uring_cqe* cqes[detail::max_completion_batch];
+        while (unsigned const count = io_uring_peek_batch_cqe(
+                   &ring_, cqes, detail::max_completion_batch))
+        {
+            for (unsigned i = 0; i != count; ++i)
+            {
+                auto* op =
+                    static_cast<operation*>(io_uring_cqe_get_data(cqes[i]));
+                std::int32_t const res = cqes[i]->res;
+                std::uint32_t const flags = cqes[i]->flags;
+
+                // this may destroy the operation object
+                op->on_completion(res, flags);
+            }
+            io_uring_cq_advance(&ring_, count);
+            has_work = true;
+        }
+        return has_work;
+    }
+
+    void ring::recycle_receive_buffer(std::uint16_t id)
+    {
+        HPX_ASSERT(id < num_receive_buffers_);
+
+        std::lock_guard<hpx::spinlock> l(receive_buffers_mtx_);
+        io_uring_buf_ring_add(buffer_ring_,
+            receive_buffers_.get() + std::size_t(id) * receive_buffer_size_,
+            unsigned(receive_buffer_size_), id,
+            io_uring_buf_ring_mask(num_receive_buffers_), 0);
+        io_uring_buf_ring_advance(buffer_ring_, 1);
+    }
+
+    int ring::acquire_send_buffer()
+    {
+        std::lock_guard<hpx::spinlock> l(send_buffers_mtx_);
+        if (free_send_buffers_.empty())
+        {
+            return -1;
+        }
+
+        int const index = free_send_buffers_.back();
+        free_send_buffers_.pop_back();
+        return index;
+    }
+
+    void ring::release_send_buffer(int index)
+    {
+        HPX_ASSERT(index >= 0 && unsigned(index) < num_send_buffers_);
+
+        std::lock_guard<hpx::spinlock> l(send_buffers_mtx_);
+        free_send_buffers_.push_back(index);
+    }
+}    // namespace hpx::parcelset::policies::io_uring
+
+#endif
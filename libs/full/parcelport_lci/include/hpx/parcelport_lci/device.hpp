@@ -0,0 +1,44 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_LCI)
+#include <hpx/modules/lci_base.hpp>
+#include <hpx/modules/runtime_local.hpp>
+
+#include <cstddef>
+
+namespace hpx::parcelset::policies::lci {
+
+    // Returns the index of the LCI device the calling thread injects its
+    // messages into. The worker threads are assigned to the devices in
+    // contiguous blocks. With the default (compact) thread binding the
+    // workers sharing a device run on the same socket, which puts every
+    // worker next to its NIC if the devices are opened in the order of the
+    // NUMA domains of the NICs.
+    inline std::size_t worker_device_index() noexcept
+    {
+        std::size_t const num_devices = util::lci_environment::num_devices();
+        if (num_devices <= 1)
+        {
+            return 0;
+        }
+
+        std::size_t const num_thread = hpx::get_worker_thread_num();
+        std::size_t const num_threads = hpx::get_os_thread_count();
+        if (num_thread >= num_threads)
+        {
+            // not a worker thread
+            return 0;
+        }
+        return num_thread * num_devices / num_threads;
+    }
+}    // namespace hpx::parcelset::policies::lci
+
+#endif
@@ -13,10 +13,12 @@
 #if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_LCI)
 
 #include <hpx/assert.hpp>
+#include <hpx/parcelport_lci/device.hpp>
 #include <hpx/parcelport_lci/header.hpp>
 #include <hpx/parcelport_lci/receiver_connection.hpp>
 
 #include <algorithm>
+#include <cstddef>
 #include <deque>
 #include <iterator>
 #include <list>
@@ -79,18 +81,39 @@ namespace hpx::parcelset::policies::lci {
             }
         }
 
+        // Accept a new connection from the header queues of the devices,
+        // starting with the device of the calling worker.
         connection_ptr accept() noexcept
+        {
+            std::size_t const num_devices =
+                util::lci_environment::num_devices();
+            std::size_t const first = worker_device_index();
+            for (std::size_t i = 0; i != num_devices; ++i)
+            {
+                std::size_t const device_index = (first + i) % num_devices;
+                connection_ptr res = accept(device_index);
+                if (res)
+                {
+                    return res;
+                }
+            }
+            return connection_ptr();
+        }
+
+        connection_ptr accept(std::size_t device_index) noexcept
         {
             connection_ptr res;
             LCI_request_t request;
-            LCI_error_t ret =
-                LCI_queue_pop(util::lci_environment::h_queue(), &request);
+            LCI_error_t ret = LCI_queue_pop(
+                util::lci_environment::get_device(device_index).h_queue,
+                &request);
             if (ret == LCI_OK)
             {
                 header h = *(header*) (request.data.mbuffer.address);
                 h.assert_valid();
 
-                res.reset(new connection_type(request.rank, h, pp_));
+                res.reset(
+                    new connection_type(request.rank, h, device_index, pp_));
                 LCI_mbuffer_free(request.data.mbuffer);
             }
             return res;
@@ -14,6 +14,7 @@
 #include <hpx/parcelport_lci/header.hpp>
 #include <hpx/parcelset/decode_parcels.hpp>
 #include <hpx/parcelset/parcel_buffer.hpp>
+#include <hpx/parcelset_base/buffer_pool.hpp>
 
 #include <cstddef>
 #include <cstdint>
@@ -38,9 +39,11 @@ namespace hpx::parcelset::policies::lci {
         using buffer_type = parcel_buffer<data_type, data_type>;
 
     public:
-        receiver_connection(int src, header h, Parcelport& pp) noexcept
+        receiver_connection(int src, header h, std::size_t device_index,
+            Parcelport& pp) noexcept
           : state_(initialized)
           , src_rank(src)
+          , device_index_(device_index)
           , tag_(h.tag())
           , header_(h)
           , sync_tchunks(nullptr)
@@ -55,14 +58,15 @@ namespace hpx::parcelset::policies::lci {
             data.time_ = timer_.elapsed_nanoseconds();
             data.bytes_ = static_cast<std::size_t>(header_.numbytes());
 #endif
-            buffer_.data_.resize(static_cast<std::size_t>(header_.size()));
+            buffer_.data_ = buffer_pool::instance().get(
+                static_cast<std::size_t>(header_.size()));
             buffer_.num_chunks_ = header_.num_chunks();
 
             // calculate how many long messages to recv
             int num_zero_copy_chunks =
                 static_cast<int>(buffer_.num_chunks_.first);
             if (num_zero_copy_chunks != 0)
-                LCI_sync_create(LCI_UR_DEVICE, 1, &sync_tchunks);
+                LCI_sync_create(device().device, 1, &sync_tchunks);
             else
                 sync_tchunks = nullptr;
 
@@ -74,11 +78,18 @@ namespace hpx::parcelset::policies::lci {
             recv_num += num_zero_copy_chunks;
             // create synchronizer
             if (recv_num > 0)
-                LCI_sync_create(LCI_UR_DEVICE, recv_num, &sync_others);
+                LCI_sync_create(device().device, recv_num, &sync_others);
             else
                 sync_others = nullptr;
         }
 
+        // the device the header was received through, the sender expects
+        // the rest of the message to be received through it as well
+        util::lci_environment::device& device() const
+        {
+            return util::lci_environment::get_device(device_index_);
+        }
+
         bool receive(std::size_t num_thread = -1)
         {
             switch (state_)
@@ -101,17 +112,19 @@ namespace hpx::parcelset::policies::lci {
             return false;
         }
 
-        bool unified_recv(
-            void* buffer, int length, int rank, LCI_tag_t tag, LCI_comp_t sync)
+        // chunks referring to device memory are always sent as long
+        // messages
+        bool unified_recv(void* buffer, int length, int rank, LCI_tag_t tag,
+            LCI_comp_t sync, bool long_message = false)
         {
             LCI_error_t ret;
-            if (length <= LCI_MEDIUM_SIZE)
+            if (!long_message && length <= LCI_MEDIUM_SIZE)
             {
                 LCI_mbuffer_t mbuffer;
                 mbuffer.address = buffer;
                 mbuffer.length = length;
-                ret = LCI_recvm(util::lci_environment::lci_endpoint(), mbuffer,
-                    rank, tag, sync, nullptr);
+                ret = LCI_recvm(
+                    device().endpoint, mbuffer, rank, tag, sync, nullptr);
             }
             else
             {
@@ -119,8 +132,8 @@ namespace hpx::parcelset::policies::lci {
                 lbuffer.address = buffer;
                 lbuffer.length = length;
                 lbuffer.segment = LCI_SEGMENT_ALL;
-                ret = LCI_recvl(util::lci_environment::lci_endpoint(), lbuffer,
-                    src_rank, tag_, sync, nullptr);
+                ret = LCI_recvl(
+                    device().endpoint, lbuffer, src_rank, tag_, sync, nullptr);
             }
             return ret == LCI_OK;
         }
@@ -182,15 +195,18 @@ namespace hpx::parcelset::policies::lci {
             while (chunks_idx_ < buffer_.chunks_.size())
             {
                 std::size_t idx = chunks_idx_;
-                std::size_t chunk_size =
-                    buffer_.transmission_chunks_[idx].second;
-
-                data_type& c = buffer_.chunks_[idx];
-                c.resize(chunk_size);
+                auto const& c = buffer_.transmission_chunks_[idx];
+                std::size_t chunk_size = c.second;
+                bool const device_memory =
+                    serialization::is_device_memory_key(
+                        parcelset::detail::decode_chunk_key(
+                            static_cast<std::uint64_t>(c.first)));
+
+                char* data = get_chunk_receive_address(buffer_, idx);
                 {
                     bool ret =
-                        unified_recv(c.data(), static_cast<int>(c.size()),
-                            src_rank, tag_, sync_others);
+                        unified_recv(data, static_cast<int>(chunk_size),
+                            src_rank, tag_, sync_others, device_memory);
                     if (!ret)
                         return false;
                 }
@@ -219,8 +235,8 @@ namespace hpx::parcelset::policies::lci {
             {
                 LCI_short_t short_rt_;
                 *(int*) &short_rt_ = tag_;
-                if (LCI_puts(util::lci_environment::rt_endpoint(), short_rt_,
-                        src_rank, 1, LCI_DEFAULT_COMP_REMOTE) != LCI_OK)
+                if (LCI_puts(device().rt_endpoint, short_rt_, src_rank, 1,
+                        LCI_DEFAULT_COMP_REMOTE) != LCI_OK)
                 {
                     return false;
                 }
@@ -237,6 +253,7 @@ namespace hpx::parcelset::policies::lci {
         connection_state state_;
 
         int src_rank;
+        std::size_t device_index_;
         int tag_;
         header header_;
         buffer_type buffer_;
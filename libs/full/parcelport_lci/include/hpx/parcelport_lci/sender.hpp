@@ -19,6 +19,7 @@
 #include <hpx/parcelport_lci/tag_provider.hpp>
 
 #include <algorithm>
+#include <cstddef>
 #include <iterator>
 #include <list>
 #include <memory>
@@ -100,16 +101,23 @@ namespace hpx::parcelset::policies::lci {
     private:
         tag_provider tag_provider_;
 
+        // the tags are released through the devices the messages were sent
+        // through
         void next_free_tag() noexcept
         {
-            LCI_request_t request;
-            LCI_error_t ret =
-                LCI_queue_pop(util::lci_environment::rt_queue(), &request);
-            if (ret == LCI_OK)
+            std::size_t const num_devices =
+                util::lci_environment::num_devices();
+            for (std::size_t i = 0; i != num_devices; ++i)
             {
-                int next_free = *(int*) &request.data.immediate;
-                HPX_ASSERT(next_free > 1);
-                tag_provider_.release(next_free);
+                LCI_request_t request;
+                LCI_error_t ret = LCI_queue_pop(
+                    util::lci_environment::get_device(i).rt_queue, &request);
+                if (ret == LCI_OK)
+                {
+                    int next_free = *(int*) &request.data.immediate;
+                    HPX_ASSERT(next_free > 1);
+                    tag_provider_.release(next_free);
+                }
             }
         }
 
@@ -13,6 +13,7 @@
 #include <hpx/modules/functional.hpp>
 #include <hpx/modules/timing.hpp>
 
+#include <hpx/parcelport_lci/device.hpp>
 #include <hpx/parcelport_lci/header.hpp>
 #include <hpx/parcelport_lci/locality.hpp>
 #include <hpx/parcelset/parcelport_connection.hpp>
@@ -63,6 +64,7 @@ namespace hpx::parcelset::policies::lci {
           , sender_(s)
           , tag_(-1)
           , dst_rank(dst)
+          , device_index_(0)
           , chunks_idx_(0)
           , pp_(pp)
           , there_(parcelset::locality(locality(dst_rank)))
@@ -92,6 +94,10 @@ namespace hpx::parcelset::policies::lci {
                 hpx::chrono::high_resolution_clock::now();
 #endif
             chunks_idx_ = 0;
+
+            // all parts of the message go through the device of the calling
+            // worker, the receiver answers through the same device
+            device_index_ = worker_device_index();
             tag_ = acquire_tag(sender_);
             header_ = header(buffer_, tag_);
             header_.assert_valid();
@@ -119,7 +125,7 @@ namespace hpx::parcelset::policies::lci {
                 {
                     if (chunk.type_ ==
                             serialization::chunk_type::chunk_type_pointer &&
-                        static_cast<int>(chunk.size_) > LCI_MEDIUM_SIZE)
+                        is_long_message(chunk))
                     {
                         ++long_msg_num;
                     }
@@ -127,7 +133,7 @@ namespace hpx::parcelset::policies::lci {
             }
             // create synchronizer
             if (long_msg_num > 0)
-                LCI_sync_create(LCI_UR_DEVICE, long_msg_num, &sync_);
+                LCI_sync_create(device().device, long_msg_num, &sync_);
             else
                 sync_ = nullptr;
 
@@ -149,6 +155,11 @@ namespace hpx::parcelset::policies::lci {
             }
         }
 
+        util::lci_environment::device& device() const
+        {
+            return util::lci_environment::get_device(device_index_);
+        }
+
         bool send()
         {
             switch (state_)
@@ -183,7 +194,7 @@ namespace hpx::parcelset::policies::lci {
                 LCI_mbuffer_t mbuffer;
                 mbuffer.length = header_.data_size_;
                 mbuffer.address = header_.data();
-                if (LCI_putma(util::lci_environment::h_endpoint(), mbuffer,
+                if (LCI_putma(device().h_endpoint, mbuffer,
                         dst_rank, 0, LCI_DEFAULT_COMP_REMOTE) != LCI_OK)
                 {
                     return false;
@@ -194,16 +205,25 @@ namespace hpx::parcelset::policies::lci {
             return send_transmission_chunks();
         }
 
-        bool unified_send(void* buffer, int length, int rank, LCI_tag_t tag)
+        // Medium messages are copied by LCI, chunks referring to device
+        // memory are therefore always sent as long messages.
+        static bool is_long_message(
+            serialization::serialization_chunk const& c) noexcept
+        {
+            return static_cast<int>(c.size_) > LCI_MEDIUM_SIZE ||
+                serialization::is_device_memory_key(c.rkey_);
+        }
+
+        bool unified_send(void* buffer, int length, int rank, LCI_tag_t tag,
+            bool long_message = false)
         {
             LCI_error_t ret;
-            if (length <= LCI_MEDIUM_SIZE)
+            if (!long_message && length <= LCI_MEDIUM_SIZE)
             {
                 LCI_mbuffer_t mbuffer;
                 mbuffer.address = buffer;
                 mbuffer.length = length;
-                ret = LCI_sendm(
-                    util::lci_environment::lci_endpoint(), mbuffer, rank, tag);
+                ret = LCI_sendm(device().endpoint, mbuffer, rank, tag);
             }
             else
             {
@@ -211,8 +231,8 @@ namespace hpx::parcelset::policies::lci {
                 lbuffer.address = buffer;
                 lbuffer.length = length;
                 lbuffer.segment = LCI_SEGMENT_ALL;
-                ret = LCI_sendl(util::lci_environment::lci_endpoint(), lbuffer,
-                    rank, tag, sync_, nullptr);
+                ret = LCI_sendl(
+                    device().endpoint, lbuffer, rank, tag, sync_, nullptr);
             }
             return ret == LCI_OK;
         }
@@ -266,7 +286,8 @@ namespace hpx::parcelset::policies::lci {
                 if (c.type_ == serialization::chunk_type::chunk_type_pointer)
                 {
                     bool ret = unified_send(const_cast<void*>(c.data_.cpos_),
-                        static_cast<int>(c.size_), dst_rank, tag_);
+                        static_cast<int>(c.size_), dst_rank, tag_,
+                        is_long_message(c));
                     if (!ret)
                         return false;
                 }
@@ -307,6 +328,7 @@ namespace hpx::parcelset::policies::lci {
         sender_type* sender_;
         int tag_;
         int dst_rank;
+        std::size_t device_index_;
         hpx::move_only_function<void(error_code const&)> handler_;
         hpx::move_only_function<void(error_code const&,
             parcelset::locality const&, std::shared_ptr<sender_connection>)>
@@ -100,12 +100,21 @@ namespace hpx::parcelset {
                     HPX_PARCEL_MAX_CONNECTIONS);
             }
 
+            // the LCI implementation has to be able to access device
+            // memory (e.g. a CUDA-aware LCI build)
+            static bool device_memory(util::runtime_configuration const& ini)
+            {
+                return hpx::util::get_entry_as<int>(
+                           ini, "hpx.parcel.lci.device_memory", 0) != 0;
+            }
+
         public:
             parcelport(util::runtime_configuration const& ini,
                 threads::policies::callback_notifier const& notifier)
               : base_type(ini, here(), notifier)
               , stopped_(false)
               , receiver_(*this)
+              , device_memory_(device_memory(ini))
             {
             }
 
@@ -166,6 +175,11 @@ namespace hpx::parcelset {
                 return parcelset::locality(locality());
             }
 
+            bool can_send_device_memory() const noexcept override
+            {
+                return device_memory_;
+            }
+
             bool background_work(
                 std::size_t /* num_thread */, parcelport_background_mode mode)
             {
@@ -191,6 +205,7 @@ namespace hpx::parcelset {
 
             sender sender_;
             receiver<parcelport> receiver_;
+            bool device_memory_;
 
             void io_service_work()
             {
@@ -243,6 +258,7 @@ namespace hpx::traits {
     //      [hpx.parcel.lci]
     //      ...
     //      priority = 200
+    //      num_devices = 1
     //
     template <>
     struct plugin_config_data<hpx::parcelset::policies::lci::parcelport>
@@ -280,7 +296,17 @@ namespace hpx::traits {
                 "}\n"
 #endif
                 "max_connections = "
-                "${HPX_HAVE_PARCELPORT_LCI_MAX_CONNECTIONS:8192}\n";
+                "${HPX_HAVE_PARCELPORT_LCI_MAX_CONNECTIONS:8192}\n"
+
+                // number of LCI devices (NICs) used for sending and
+                // receiving messages, has to be the same on all localities
+                "num_devices = "
+                "${HPX_HAVE_PARCELPORT_LCI_NUM_DEVICES:1}\n"
+
+                // set to 1 if LCI can send from and receive into device
+                // memory, default: 0
+                "device_memory = "
+                "${HPX_HAVE_PARCELPORT_LCI_DEVICE_MEMORY:0}\n";
         }
     };
 }    // namespace hpx::traits
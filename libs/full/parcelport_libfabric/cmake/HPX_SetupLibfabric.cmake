@@ -334,4 +334,40 @@ if(HPX_WITH_PARCELPORT_LIBFABRIC AND NOT TARGET Libfabric::libfabric)
     NAMESPACE PARCELPORT_LIBFABRIC
   )
 
+  # ------------------------------------------------------------------------------
+  # Completion queue options
+  # ------------------------------------------------------------------------------
+  hpx_option(
+    HPX_PARCELPORT_LIBFABRIC_CQ_BATCH_SIZE STRING
+    "The maximum number of completions read from a completion queue at once (default: 16)"
+    "16"
+    CATEGORY "Parcelport"
+    ADVANCED
+    MODULE PARCELPORT_LIBFABRIC
+  )
+
+  hpx_add_config_define_namespace(
+    DEFINE HPX_PARCELPORT_LIBFABRIC_CQ_BATCH_SIZE
+    VALUE ${HPX_PARCELPORT_LIBFABRIC_CQ_BATCH_SIZE}
+    NAMESPACE PARCELPORT_LIBFABRIC
+  )
+
+  # ------------------------------------------------------------------------------
+  # Memory registration options
+  # ------------------------------------------------------------------------------
+  hpx_option(
+    HPX_PARCELPORT_LIBFABRIC_REGISTRATION_CACHE_SIZE STRING
+    "The number of unused registrations of zero-copy send buffers kept for reuse (default: 0 - Warning, only safe if the application does not free/unmap buffers which may be sent again)"
+    "0"
+    CATEGORY "Parcelport"
+    ADVANCED
+    MODULE PARCELPORT_LIBFABRIC
+  )
+
+  hpx_add_config_define_namespace(
+    DEFINE HPX_PARCELPORT_LIBFABRIC_REGISTRATION_CACHE_SIZE
+    VALUE ${HPX_PARCELPORT_LIBFABRIC_REGISTRATION_CACHE_SIZE}
+    NAMESPACE PARCELPORT_LIBFABRIC
+  )
+
 endif()
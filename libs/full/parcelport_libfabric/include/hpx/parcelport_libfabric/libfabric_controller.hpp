@@ -92,6 +92,10 @@ namespace hpx { namespace parcelset { namespace policies { namespace libfabric {
         typedef hpx::parcelset::policies::libfabric::scoped_lock<mutex_type>
             scoped_lock;
 
+        // the maximum number of completions read from a queue at once
+        static constexpr std::size_t cq_batch_size =
+            HPX_PARCELPORT_LIBFABRIC_CQ_BATCH_SIZE;
+
         // NOTE: Connection maps are not used for endpoint type RDM
         // when a new connection is requested, it will be completed asynchronously
         // we need a promise/future for each endpoint so that we can set the new
@@ -800,44 +804,23 @@ namespace hpx { namespace parcelset { namespace policies { namespace libfabric {
             LOG_TIMED_BLOCK(
                 poll, DEVEL, 5.0, { LOG_DEBUG_MSG("poll_send_queue"); });
 
-            fi_cq_msg_entry entry;
+            // read as many completions as are available (up to the batch
+            // size) at once, the lock is released before handling them
+            std::array<fi_cq_msg_entry, cq_batch_size> entries;
             int ret = 0;
             {
                 std::unique_lock<mutex_type> l(
                     polling_mutex_, std::try_to_lock);
                 if (l)
-                    ret = fi_cq_read(txcq_, &entry, 1);
+                    ret = fi_cq_read(txcq_, entries.data(), entries.size());
             }
             if (ret > 0)
             {
-                LOG_DEBUG_MSG("Completion txcq wr_id "
-                    << fi_tostr(&entry.flags, FI_TYPE_OP_FLAGS) << " ("
-                    << decnumber(entry.flags) << ") "
-                    << "context " << hexpointer(entry.op_context) << "length "
-                    << hexuint32(entry.len));
-                if (entry.flags & FI_RMA)
-                {
-                    LOG_DEBUG_MSG("Received a txcq RMA completion "
-                        << "Context " << hexpointer(entry.op_context));
-                    rma_receiver* rcv =
-                        reinterpret_cast<rma_receiver*>(entry.op_context);
-                    rcv->handle_rma_read_completion();
-                }
-                else if (entry.flags == (FI_MSG | FI_SEND))
+                for (int i = 0; i != ret; ++i)
                 {
-                    LOG_DEBUG_MSG("Received a txcq RMA send completion");
-                    sender* handler =
-                        reinterpret_cast<sender*>(entry.op_context);
-                    handler->handle_send_completion();
+                    handle_send_queue_completion(entries[i]);
                 }
-                else
-                {
-                    LOG_DEBUG_MSG(
-                        "$$$$$ Received an unknown txcq completion ***** "
-                        << decnumber(entry.flags));
-                    std::terminate();
-                }
-                return 1;
+                return ret;
             }
             else if (ret == 0 || ret == -FI_EAGAIN)
             {
@@ -890,8 +873,8 @@ namespace hpx { namespace parcelset { namespace policies { namespace libfabric {
                 poll, DEVEL, 5.0, { LOG_DEBUG_MSG("poll_recv_queue"); });
 
             int result = 0;
-            fi_addr_t src_addr;
-            fi_cq_msg_entry entry;
+            std::array<fi_addr_t, cq_batch_size> src_addrs;
+            std::array<fi_cq_msg_entry, cq_batch_size> entries;
 
             // receives will use fi_cq_readfrom as we want the source address
             int ret = 0;
@@ -899,38 +882,16 @@ namespace hpx { namespace parcelset { namespace policies { namespace libfabric {
                 std::unique_lock<mutex_type> l(
                     polling_mutex_, std::try_to_lock);
                 if (l)
-                    ret = fi_cq_readfrom(rxcq_, &entry, 1, &src_addr);
+                    ret = fi_cq_readfrom(rxcq_, entries.data(), entries.size(),
+                        src_addrs.data());
             }
             if (ret > 0)
             {
-                LOG_DEBUG_MSG("Completion rxcq wr_id "
-                    << fi_tostr(&entry.flags, FI_TYPE_OP_FLAGS) << " ("
-                    << decnumber(entry.flags) << ") "
-                    << "source " << hexpointer(src_addr) << "context "
-                    << hexpointer(entry.op_context) << "length "
-                    << hexuint32(entry.len));
-                if (src_addr == FI_ADDR_NOTAVAIL)
-                {
-                    LOG_DEBUG_MSG("Source address not available...\n");
-                    std::terminate();
-                }
-                // if ((entry.flags & FI_RMA) == FI_RMA) {
-                //     LOG_DEBUG_MSG("Received an rxcq RMA completion");
-                // }
-                else if (entry.flags == (FI_MSG | FI_RECV))
+                for (int i = 0; i != ret; ++i)
                 {
-                    LOG_DEBUG_MSG("Received an rxcq recv completion "
-                        << hexpointer(entry.op_context));
-                    reinterpret_cast<receiver*>(entry.op_context)
-                        ->handle_recv(src_addr, entry.len);
+                    handle_recv_queue_completion(entries[i], src_addrs[i]);
                 }
-                else
-                {
-                    LOG_DEBUG_MSG("Received an unknown rxcq completion "
-                        << decnumber(entry.flags));
-                    std::terminate();
-                }
-                result = 1;
+                result = ret;
             }
             else if (ret == 0 || ret == -FI_EAGAIN)
             {
@@ -962,6 +923,69 @@ namespace hpx { namespace parcelset { namespace policies { namespace libfabric {
             return result;
         }
 
+        // --------------------------------------------------------------------
+        void handle_send_queue_completion(fi_cq_msg_entry const& entry)
+        {
+            LOG_DEBUG_MSG("Completion txcq wr_id "
+                << fi_tostr(&entry.flags, FI_TYPE_OP_FLAGS) << " ("
+                << decnumber(entry.flags) << ") "
+                << "context " << hexpointer(entry.op_context) << "length "
+                << hexuint32(entry.len));
+            if (entry.flags & FI_RMA)
+            {
+                LOG_DEBUG_MSG("Received a txcq RMA completion "
+                    << "Context " << hexpointer(entry.op_context));
+                rma_receiver* rcv =
+                    reinterpret_cast<rma_receiver*>(entry.op_context);
+                rcv->handle_rma_read_completion();
+            }
+            else if (entry.flags == (FI_MSG | FI_SEND))
+            {
+                LOG_DEBUG_MSG("Received a txcq RMA send completion");
+                sender* handler = reinterpret_cast<sender*>(entry.op_context);
+                handler->handle_send_completion();
+            }
+            else
+            {
+                LOG_DEBUG_MSG("$$$$$ Received an unknown txcq completion ***** "
+                    << decnumber(entry.flags));
+                std::terminate();
+            }
+        }
+
+        // --------------------------------------------------------------------
+        void handle_recv_queue_completion(
+            fi_cq_msg_entry const& entry, fi_addr_t const& src_addr)
+        {
+            LOG_DEBUG_MSG("Completion rxcq wr_id "
+                << fi_tostr(&entry.flags, FI_TYPE_OP_FLAGS) << " ("
+                << decnumber(entry.flags) << ") "
+                << "source " << hexpointer(src_addr) << "context "
+                << hexpointer(entry.op_context) << "length "
+                << hexuint32(entry.len));
+            if (src_addr == FI_ADDR_NOTAVAIL)
+            {
+                LOG_DEBUG_MSG("Source address not available...\n");
+                std::terminate();
+            }
+            // if ((entry.flags & FI_RMA) == FI_RMA) {
+            //     LOG_DEBUG_MSG("Received an rxcq RMA completion");
+            // }
+            else if (entry.flags == (FI_MSG | FI_RECV))
+            {
+                LOG_DEBUG_MSG("Received an rxcq recv completion "
+                    << hexpointer(entry.op_context));
+                reinterpret_cast<receiver*>(entry.op_context)
+                    ->handle_recv(src_addr, entry.len);
+            }
+            else
+            {
+                LOG_DEBUG_MSG("Received an unknown rxcq completion "
+                    << decnumber(entry.flags));
+                std::terminate();
+            }
+        }
+
         // --------------------------------------------------------------------
         int poll_event_queue(bool /*stopped*/ = false)
         {
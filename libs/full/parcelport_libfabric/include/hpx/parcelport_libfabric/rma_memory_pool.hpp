@@ -13,6 +13,7 @@
 #include <hpx/parcelport_libfabric/parcelport_logging.hpp>
 #include <hpx/parcelport_libfabric/performance_counter.hpp>
 #include <hpx/parcelport_libfabric/rma_memory_region.hpp>
+#include <hpx/parcelport_libfabric/rma_registration_cache.hpp>
 //
 #include <boost/lockfree/stack.hpp>
 //
@@ -77,7 +78,9 @@ static_assert(
 // new allocations and on-the-fly registration of the memory.
 // Additionally, it also provides a simple API so users may pass pre-allocated
 // memory to the pool for on-the-fly registration (rdma transfer of user memory chunks)
-// and later de-registration.
+// and later de-registration. If a registration cache size is configured, these
+// registrations are kept in a rma_registration_cache and reused when the same
+// memory is passed again.
 
 namespace hpx { namespace parcelset {
 
@@ -416,10 +419,41 @@ namespace hpx { namespace parcelset {
             return region;
         }
 
+        //----------------------------------------------------------------------------
+        // register user supplied memory, the region must be released using
+        // deallocate
+        inline region_type* register_user_region(
+            const void* buffer, std::size_t length)
+        {
+            region_type* region = nullptr;
+            if constexpr (HPX_PARCELPORT_LIBFABRIC_REGISTRATION_CACHE_SIZE > 0)
+            {
+                region = registration_cache_.acquire(
+                    protection_domain_, buffer, length);
+            }
+            else
+            {
+                region = new region_type(protection_domain_, buffer, length);
+            }
+            ++user_regions;
+            LOG_TRACE_MSG("Registered user region "
+                << *region << "user regions " << decnumber(user_regions));
+            return region;
+        }
+
         //----------------------------------------------------------------------------
         // release a region back to the pool
         inline void deallocate(region_type* region)
         {
+            // a cached registration goes back to the cache, it may be in use
+            // by other sends
+            if (region->get_cached_region())
+            {
+                --user_regions;
+                registration_cache_.release(region);
+                return;
+            }
+
             // if this region was registered on the fly, then don't return it to the pool
             if (region->get_temp_region() || region->get_user_region())
             {
@@ -497,6 +531,11 @@ namespace hpx { namespace parcelset {
             RDMA_POOL_LARGE_CHUNK_SIZE, RDMA_POOL_MAX_LARGE_CHUNKS>
             large_;
 
+        // registrations of user memory kept for reuse
+        rma_registration_cache<RegionProvider,
+            HPX_PARCELPORT_LIBFABRIC_REGISTRATION_CACHE_SIZE>
+            registration_cache_;
+
         // counters
         hpx::util::atomic_count temp_regions;
         hpx::util::atomic_count user_regions;
@@ -243,6 +243,7 @@ namespace hpx { namespace parcelset {
             BLOCK_USER = 1,
             BLOCK_TEMP = 2,
             BLOCK_PARTIAL = 4,
+            BLOCK_CACHED = 8,
         };
 
         // --------------------------------------------------------------------
@@ -285,6 +286,19 @@ namespace hpx { namespace parcelset {
             return (flags_ & BLOCK_PARTIAL) == BLOCK_PARTIAL;
         }
 
+        // --------------------------------------------------------------------
+        // a cached region is a user region owned by a registration cache,
+        // it is returned to the cache instead of being unregistered
+        inline void set_cached_region()
+        {
+            flags_ |= BLOCK_CACHED;
+        }
+
+        inline bool get_cached_region() const
+        {
+            return (flags_ & BLOCK_CACHED) == BLOCK_CACHED;
+        }
+
         // --------------------------------------------------------------------
         friend std::ostream& operator<<(
             std::ostream& os, rma_memory_region const& region)
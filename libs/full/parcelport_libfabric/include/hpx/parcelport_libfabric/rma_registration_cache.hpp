@@ -0,0 +1,173 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/assert.hpp>
+#include <hpx/modules/synchronization.hpp>
+//
+#include <hpx/parcelport_libfabric/config/defines.hpp>
+#include <hpx/parcelport_libfabric/parcelport_logging.hpp>
+#include <hpx/parcelport_libfabric/performance_counter.hpp>
+#include <hpx/parcelport_libfabric/rma_memory_region.hpp>
+//
+#include <cstddef>
+#include <list>
+#include <map>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+// Description of the registration cache:
+//
+// Zero-copy chunks of a parcel point into user memory, which has to be
+// registered before the remote end can rma-get it. Registering (and pinning)
+// memory is expensive, so when the same buffer is sent repeatedly it pays off
+// to keep the registration instead of releasing it after every send.
+//
+// rma_registration_cache:
+// Holds the registrations of user buffers keyed by address and length. A
+// registration may be used by several sends at once, it is reference counted.
+// Once unused, it is kept until MaxUnused other registrations became unused
+// after it (least recently used first), then it is released.
+//
+// Note that a registration refers to the pages the buffer occupied when it
+// was registered. If the application frees a buffer and later receives a new
+// one at the same address (with different pages underneath), a cached
+// registration is stale. The cache can therefore only be enabled for
+// applications which keep their send buffers alive (or never return them to
+// the OS), it is disabled by default.
+
+namespace hpx { namespace parcelset {
+
+    template <typename RegionProvider, std::size_t MaxUnused>
+    struct rma_registration_cache
+    {
+        HPX_NON_COPYABLE(rma_registration_cache);
+
+        typedef typename RegionProvider::provider_domain domain_type;
+        typedef rma_memory_region<RegionProvider> region_type;
+        typedef hpx::spinlock mutex_type;
+
+        // --------------------------------------------------------------------
+        rma_registration_cache() = default;
+
+        // --------------------------------------------------------------------
+        ~rma_registration_cache()
+        {
+            for (auto& e : entries_)
+            {
+                if (e.second.refs_ != 0)
+                {
+                    LOG_ERROR_MSG("Deleting registration cache: region still "
+                                  "in use "
+                        << *e.second.region_);
+                }
+                delete e.second.region_;
+            }
+        }
+
+        // --------------------------------------------------------------------
+        // return a registration of the user buffer, registering it if no
+        // cached one exists
+        region_type* acquire(
+            domain_type* pd, const void* buffer, std::size_t length)
+        {
+            key_type key(static_cast<const char*>(buffer), length);
+            {
+                std::lock_guard<mutex_type> l(mtx_);
+                auto it = entries_.find(key);
+                if (it != entries_.end())
+                {
+                    entry& e = it->second;
+                    if (e.refs_++ == 0)
+                    {
+                        unused_.erase(e.unused_pos_);
+                    }
+                    ++hits_;
+                    LOG_TRACE_MSG(
+                        "Reusing cached registration " << *e.region_);
+                    return e.region_;
+                }
+            }
+
+            // register the memory without holding the lock
+            region_type* region = new region_type(pd, buffer, length);
+
+            std::lock_guard<mutex_type> l(mtx_);
+            auto result = entries_.emplace(key, entry{region, 1, {}});
+            if (!result.second)
+            {
+                // another thread registered the same buffer in the meantime,
+                // return ours as a plain user region which is released after
+                // the send
+                return region;
+            }
+            region->set_cached_region();
+            ++misses_;
+            return region;
+        }
+
+        // --------------------------------------------------------------------
+        // return a registration obtained from acquire
+        void release(region_type* region)
+        {
+            HPX_ASSERT(region->get_cached_region());
+
+            std::vector<region_type*> evicted;
+            {
+                std::lock_guard<mutex_type> l(mtx_);
+                auto it = entries_.find(
+                    key_type(region->get_address(), region->get_size()));
+                HPX_ASSERT(
+                    it != entries_.end() && it->second.region_ == region);
+
+                entry& e = it->second;
+                if (--e.refs_ != 0)
+                {
+                    return;
+                }
+                e.unused_pos_ = unused_.insert(unused_.end(), it->first);
+
+                while (unused_.size() > MaxUnused)
+                {
+                    auto oldest = entries_.find(unused_.front());
+                    HPX_ASSERT(oldest != entries_.end());
+                    evicted.push_back(oldest->second.region_);
+                    entries_.erase(oldest);
+                    unused_.pop_front();
+                }
+            }
+
+            // unregister the memory without holding the lock
+            for (region_type* r : evicted)
+            {
+                LOG_TRACE_MSG("Evicting cached registration " << *r);
+                delete r;
+            }
+        }
+
+    private:
+        typedef std::pair<const char*, std::size_t> key_type;
+
+        struct entry
+        {
+            region_type* region_;
+            std::size_t refs_;
+            // the position in the list of unused entries, if refs_ == 0
+            typename std::list<key_type>::iterator unused_pos_;
+        };
+
+        mutex_type mtx_;
+        std::map<key_type, entry> entries_;
+        std::list<key_type> unused_;
+
+    public:
+        // counters
+        performance_counter<unsigned int> hits_;
+        performance_counter<unsigned int> misses_;
+    };
+}}    // namespace hpx::parcelset
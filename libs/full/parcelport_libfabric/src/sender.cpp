@@ -53,9 +53,10 @@ namespace hpx::parcelset::policies::libfabric {
             {
                 LOG_EXCLUSIVE(chrono::high_resolution_timer regtimer);
 
-                // create a new memory region from the user supplied pointer
+                // register the user supplied pointer, the registration may
+                // be reused from an earlier send of the same memory
                 region_type* zero_copy_region =
-                    new region_type(domain_, c.data_.cpos_, c.size_);
+                    memory_pool_->register_user_region(c.data_.cpos_, c.size_);
 
                 rma_regions_.push_back(zero_copy_region);
 
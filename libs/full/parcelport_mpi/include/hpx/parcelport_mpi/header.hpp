@@ -13,12 +13,15 @@
 #include <hpx/assert.hpp>
 
 #include <hpx/parcelset/parcel_buffer.hpp>
+#include <hpx/serialization/serialization_chunk.hpp>
 
 #include <array>
 #include <cstddef>
 #include <cstdint>
 #include <cstring>
+#include <limits>
 #include <utility>
+#include <vector>
 
 namespace hpx::parcelset::policies::mpi {
 
@@ -37,7 +40,27 @@ namespace hpx::parcelset::policies::mpi {
             pos_piggy_back_data = 5 * sizeof(value_type) + 1
         };
 
+        // The parts of the message which are sent as part of the header.
+        // The piggy-backed data is stored in this order: transmission chunks,
+        // main data, zero-copy chunks.
+        enum piggy_back_flags : char
+        {
+            piggy_backed_none = 0x00,
+            piggy_backed_data = 0x01,
+            piggy_backed_transmission_chunks = 0x02,
+            piggy_backed_chunks = 0x04
+        };
+
+#if defined(HPX_HAVE_PARCELPORT_MPI_HEADER_SIZE)
+        static constexpr int data_size_ = HPX_HAVE_PARCELPORT_MPI_HEADER_SIZE;
+#else
         static constexpr int data_size_ = 512;
+#endif
+        static_assert(data_size_ > pos_piggy_back_data,
+            "the header size is too small to hold the message description");
+
+        static constexpr std::size_t piggy_back_capacity =
+            data_size_ - pos_piggy_back_data;
 
         template <typename Buffer>
         header(Buffer const& buffer, int tag) noexcept
@@ -57,16 +80,75 @@ namespace hpx::parcelset::policies::mpi {
             set<pos_numchunks_second>(
                 static_cast<value_type>(buffer.num_chunks_.second));
 
-            if (buffer.data_.size() <= (data_size_ - pos_piggy_back_data))
+            // Small messages are sent eagerly: the transmission chunks and
+            // the main data are copied into the header if they fit, the
+            // zero-copy chunks only if the whole message fits and none of
+            // them refers to device memory.
+            char flags = piggy_backed_none;
+            std::size_t pos = pos_piggy_back_data;
+
+            std::size_t const transmission_chunks_size =
+                buffer.transmission_chunks_.size() *
+                sizeof(typename Buffer::transmission_chunk_type);
+            if (transmission_chunks_size + buffer.data_.size() <=
+                piggy_back_capacity)
             {
-                data_[pos_piggy_back_flag] = 1;
-                std::memcpy(&data_[pos_piggy_back_data], &buffer.data_[0],
-                    buffer.data_.size());
+                flags |= piggy_backed_transmission_chunks | piggy_backed_data;
+                if (transmission_chunks_size != 0)
+                {
+                    std::memcpy(&data_[pos], buffer.transmission_chunks_.data(),
+                        transmission_chunks_size);
+                    pos += transmission_chunks_size;
+                }
             }
-            else
+            else if (buffer.data_.size() <= piggy_back_capacity)
             {
-                data_[pos_piggy_back_flag] = 0;
+                flags |= piggy_backed_data;
             }
+
+            if (flags & piggy_backed_data)
+            {
+                if (!buffer.data_.empty())
+                {
+                    std::memcpy(
+                        &data_[pos], buffer.data_.data(), buffer.data_.size());
+                    pos += buffer.data_.size();
+                }
+
+                if (flags & piggy_backed_transmission_chunks)
+                {
+                    std::size_t chunks_size = 0;
+                    bool device_memory = false;
+                    for (auto const& c : buffer.chunks_)
+                    {
+                        if (c.type_ ==
+                            serialization::chunk_type::chunk_type_pointer)
+                        {
+                            chunks_size += c.size_;
+                            device_memory = device_memory ||
+                                serialization::is_device_memory_key(c.rkey_);
+                        }
+                    }
+
+                    if (!device_memory &&
+                        pos + chunks_size <= std::size_t(data_size_))
+                    {
+                        flags |= piggy_backed_chunks;
+                        for (auto const& c : buffer.chunks_)
+                        {
+                            if (c.type_ ==
+                                serialization::chunk_type::chunk_type_pointer)
+                            {
+                                std::memcpy(
+                                    &data_[pos], c.data_.cpos_, c.size_);
+                                pos += c.size_;
+                            }
+                        }
+                    }
+                }
+            }
+
+            data_[pos_piggy_back_flag] = flags;
         }
 
         header() noexcept
@@ -77,7 +159,7 @@ namespace hpx::parcelset::policies::mpi {
         void reset() noexcept
         {
             std::memset(&data_[0], -1, data_size_);
-            data_[pos_piggy_back_flag] = 1;
+            data_[pos_piggy_back_flag] = piggy_backed_data;
         }
 
         bool valid() const noexcept
@@ -120,13 +202,49 @@ namespace hpx::parcelset::policies::mpi {
                 get<pos_numchunks_first>(), get<pos_numchunks_second>());
         }
 
-        constexpr char* piggy_back() noexcept
+        // Returns the main data if it was sent as part of the header
+        char* piggy_back() noexcept
         {
-            if (data_[pos_piggy_back_flag])
+            if (!(data_[pos_piggy_back_flag] & piggy_backed_data))
+                return nullptr;
+
+            char* data = &data_[pos_piggy_back_data];
+            if (data_[pos_piggy_back_flag] & piggy_backed_transmission_chunks)
+                data += transmission_chunks_size();
+            return data;
+        }
+
+        // Returns the transmission chunks if they were sent as part of the
+        // header
+        char* piggy_back_transmission_chunks() noexcept
+        {
+            if (data_[pos_piggy_back_flag] & piggy_backed_transmission_chunks)
                 return &data_[pos_piggy_back_data];
             return nullptr;
         }
 
+        // Returns the zero-copy chunks (stored back to back) if they were
+        // sent as part of the header
+        char* piggy_back_chunks() noexcept
+        {
+            if (!(data_[pos_piggy_back_flag] & piggy_backed_chunks))
+                return nullptr;
+            return piggy_back() + size();
+        }
+
+        std::size_t transmission_chunks_size() const noexcept
+        {
+            // the transmission chunks are sent only if there are zero-copy
+            // chunks
+            std::pair<value_type, value_type> const chunks = num_chunks();
+            if (chunks.first == 0)
+                return 0;
+
+            return static_cast<std::size_t>(chunks.first + chunks.second) *
+                sizeof(parcel_buffer<std::vector<char>,
+                    std::vector<char>>::transmission_chunk_type);
+        }
+
     private:
         std::array<char, data_size_> data_;
 
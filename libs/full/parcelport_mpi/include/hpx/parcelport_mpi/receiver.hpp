@@ -38,8 +38,9 @@ namespace hpx::parcelset::policies::mpi {
         using connection_ptr = std::shared_ptr<connection_type>;
         using connection_list = std::deque<connection_ptr>;
 
-        explicit constexpr receiver(Parcelport& pp) noexcept
+        receiver(Parcelport& pp, util::mpi_request_poller& requests) noexcept
           : pp_(pp)
+          , requests_(requests)
           , hdr_request_(0)
         {
         }
@@ -110,7 +111,8 @@ namespace hpx::parcelset::policies::mpi {
                     l.unlock();
                     header_lock.unlock();
 
-                    res.reset(new connection_type(status.MPI_SOURCE, h, pp_));
+                    res.reset(new connection_type(
+                        status.MPI_SOURCE, h, pp_, requests_));
                     return res;
                 }
             }
@@ -130,6 +132,7 @@ namespace hpx::parcelset::policies::mpi {
         }
 
         Parcelport& pp_;
+        util::mpi_request_poller& requests_;
 
         hpx::spinlock headers_mtx_;
         MPI_Request hdr_request_;
@@ -17,7 +17,9 @@
 #include <hpx/parcelport_mpi/header.hpp>
 #include <hpx/parcelset/decode_parcels.hpp>
 #include <hpx/parcelset/parcel_buffer.hpp>
+#include <hpx/parcelset_base/buffer_pool.hpp>
 
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <cstring>
@@ -36,7 +38,6 @@ namespace hpx::parcelset::policies::mpi {
         {
             initialized,
             rcvd_transmission_chunks,
-            rcvd_data,
             rcvd_chunks,
             sent_release_tag
         };
@@ -45,14 +46,14 @@ namespace hpx::parcelset::policies::mpi {
         using buffer_type = parcel_buffer<data_type, data_type>;
 
     public:
-        receiver_connection(int src, header h, Parcelport& pp) noexcept
+        receiver_connection(int src, header h, Parcelport& pp,
+            util::mpi_request_poller& requests) noexcept
           : state_(initialized)
           , src_(src)
           , tag_(h.tag())
           , header_(h)
-          , request_(MPI_REQUEST_NULL)
-          , request_ptr_(nullptr)
-          , chunks_idx_(0)
+          , requests_(requests)
+          , pending_(0)
           , pp_(pp)
         {
             header_.assert_valid();
@@ -61,7 +62,8 @@ namespace hpx::parcelset::policies::mpi {
             data.time_ = timer_.elapsed_nanoseconds();
             data.bytes_ = static_cast<std::size_t>(header_.numbytes());
 #endif
-            buffer_.data_.resize(static_cast<std::size_t>(header_.size()));
+            buffer_.data_ = buffer_pool::instance().get(
+                static_cast<std::size_t>(header_.size()));
             buffer_.num_chunks_ = header_.num_chunks();
         }
 
@@ -73,9 +75,6 @@ namespace hpx::parcelset::policies::mpi {
                 return receive_transmission_chunks(num_thread);
 
             case rcvd_transmission_chunks:
-                return receive_data(num_thread);
-
-            case rcvd_data:
                 return receive_chunks(num_thread);
 
             case rcvd_chunks:
@@ -90,6 +89,8 @@ namespace hpx::parcelset::policies::mpi {
             return false;
         }
 
+        // Post the receives for the transmission chunks and the main data,
+        // or copy them from the header if they were piggy-backed.
         bool receive_transmission_chunks(std::size_t num_thread = -1)
         {
             // determine the size of the chunk buffer
@@ -99,73 +100,82 @@ namespace hpx::parcelset::policies::mpi {
                 static_cast<std::uint32_t>(buffer_.num_chunks_.second));
             buffer_.transmission_chunks_.resize(
                 num_zero_copy_chunks + num_non_zero_copy_chunks);
-            if (num_zero_copy_chunks != 0)
+
             {
-                buffer_.chunks_.resize(num_zero_copy_chunks);
+                util::mpi_environment::scoped_lock l;
+                if (num_zero_copy_chunks != 0)
+                {
+                    buffer_.chunks_.resize(num_zero_copy_chunks);
+
+                    char* transmission_chunks =
+                        header_.piggy_back_transmission_chunks();
+                    if (transmission_chunks)
+                    {
+                        std::memcpy(static_cast<void*>(
+                                        buffer_.transmission_chunks_.data()),
+                            transmission_chunks,
+                            header_.transmission_chunks_size());
+                    }
+                    else
+                    {
+                        irecv(buffer_.transmission_chunks_.data(),
+                            buffer_.transmission_chunks_.size() *
+                                sizeof(buffer_type::transmission_chunk_type));
+                    }
+                }
+
+                char* piggy_back = header_.piggy_back();
+                if (piggy_back)
+                {
+                    std::memcpy(
+                        &buffer_.data_[0], piggy_back, buffer_.data_.size());
+                }
+                else
                 {
-                    util::mpi_environment::scoped_lock l;
-                    MPI_Irecv(buffer_.transmission_chunks_.data(),
-                        static_cast<int>(buffer_.transmission_chunks_.size() *
-                            sizeof(buffer_type::transmission_chunk_type)),
-                        MPI_BYTE, src_, tag_,
-                        util::mpi_environment::communicator(), &request_);
-                    request_ptr_ = &request_;
+                    irecv(buffer_.data_.data(), buffer_.data_.size());
                 }
             }
 
             state_ = rcvd_transmission_chunks;
 
-            return receive_data(num_thread);
+            return receive_chunks(num_thread);
         }
 
-        bool receive_data(std::size_t num_thread = -1)
+        // Post the receives for all zero-copy chunks as soon as their sizes
+        // are known. The data is received directly into the chunk buffers
+        // used for deserialization.
+        bool receive_chunks(std::size_t num_thread = -1)
         {
-            if (!request_done())
+            if (buffer_.chunks_.empty())
             {
-                return false;
+                state_ = rcvd_chunks;
+                return send_release_tag(num_thread);
             }
 
-            char* piggy_back = header_.piggy_back();
-            if (piggy_back)
-            {
-                std::memcpy(
-                    &buffer_.data_[0], piggy_back, buffer_.data_.size());
-            }
-            else
+            if (!header_.piggy_back_transmission_chunks() && !request_done())
             {
-                util::mpi_environment::scoped_lock l;
-                MPI_Irecv(buffer_.data_.data(),
-                    static_cast<int>(buffer_.data_.size()), MPI_BYTE, src_,
-                    tag_, util::mpi_environment::communicator(), &request_);
-                request_ptr_ = &request_;
+                // the sizes of the chunks are not known yet
+                return false;
             }
 
-            state_ = rcvd_data;
-
-            return receive_chunks(num_thread);
-        }
-
-        bool receive_chunks(std::size_t num_thread = -1)
-        {
-            while (chunks_idx_ < buffer_.chunks_.size())
+            char* piggy_back = header_.piggy_back_chunks();
             {
-                if (!request_done())
-                {
-                    return false;
-                }
-
-                std::size_t idx = chunks_idx_++;
-                std::size_t chunk_size =
-                    buffer_.transmission_chunks_[idx].second;
-
-                data_type& c = buffer_.chunks_[idx];
-                c.resize(chunk_size);
+                util::mpi_environment::scoped_lock l;
+                for (std::size_t idx = 0; idx != buffer_.chunks_.size(); ++idx)
                 {
-                    util::mpi_environment::scoped_lock l;
-                    MPI_Irecv(c.data(), static_cast<int>(c.size()), MPI_BYTE,
-                        src_, tag_, util::mpi_environment::communicator(),
-                        &request_);
-                    request_ptr_ = &request_;
+                    std::size_t chunk_size =
+                        buffer_.transmission_chunks_[idx].second;
+
+                    char* data = get_chunk_receive_address(buffer_, idx);
+                    if (piggy_back)
+                    {
+                        std::memcpy(data, piggy_back, chunk_size);
+                        piggy_back += chunk_size;
+                    }
+                    else
+                    {
+                        irecv(data, chunk_size);
+                    }
                 }
             }
 
@@ -186,9 +196,10 @@ namespace hpx::parcelset::policies::mpi {
 #endif
             {
                 util::mpi_environment::scoped_lock l;
+                MPI_Request request;
                 MPI_Isend(&tag_, 1, MPI_INT, src_, 1,
-                    util::mpi_environment::communicator(), &request_);
-                request_ptr_ = &request_;
+                    util::mpi_environment::communicator(), &request);
+                add_request(request);
             }
 
             decode_parcels(pp_, HPX_MOVE(buffer_), num_thread);
@@ -203,30 +214,30 @@ namespace hpx::parcelset::policies::mpi {
             return request_done();
         }
 
-        bool request_done() noexcept
+        // The requests are tested by the request poller of the parcelport,
+        // which decrements the number of pending requests as they complete.
+        bool request_done() const noexcept
         {
-            if (request_ptr_ == nullptr)
-            {
-                return true;
-            }
+            return pending_.load(std::memory_order_acquire) == 0;
+        }
 
-            util::mpi_environment::scoped_try_lock l;
-            if (!l.locked)
-            {
-                return false;
-            }
+        // has to be called while holding the MPI lock
+        void irecv(void* data, std::size_t size)
+        {
+            MPI_Request request;
+            MPI_Irecv(data, static_cast<int>(size), MPI_BYTE, src_, tag_,
+                util::mpi_environment::communicator(), &request);
+            add_request(request);
+        }
 
-            int completed = 0;
-            int ret = 0;
-            ret = MPI_Test(request_ptr_, &completed, MPI_STATUS_IGNORE);
-            HPX_ASSERT(ret == MPI_SUCCESS);
-            (void) ret;
-            if (completed)
-            {
-                request_ptr_ = nullptr;
-                return true;
-            }
-            return false;
+        void add_request(MPI_Request request)
+        {
+            ++pending_;
+            requests_.add(request, [this](int status) {
+                HPX_ASSERT(status == MPI_SUCCESS);
+                (void) status;
+                pending_.fetch_sub(1, std::memory_order_release);
+            });
         }
 
 #if defined(HPX_HAVE_PARCELPORT_COUNTERS)
@@ -239,9 +250,8 @@ namespace hpx::parcelset::policies::mpi {
         header header_;
         buffer_type buffer_;
 
-        MPI_Request request_;
-        MPI_Request* request_ptr_;
-        std::size_t chunks_idx_;
+        util::mpi_request_poller& requests_;
+        std::atomic<std::size_t> pending_;
 
         Parcelport& pp_;
     };
@@ -37,8 +37,9 @@ namespace hpx::parcelset::policies::mpi {
 
         // different versions of clang-format disagree
         // clang-format off
-        sender() noexcept
-          : next_free_tag_request_((MPI_Request) (-1))
+        explicit sender(util::mpi_request_poller& requests) noexcept
+          : requests_(requests)
+          , next_free_tag_request_((MPI_Request) (-1))
           , next_free_tag_(-1)
         {
         }
@@ -51,7 +52,8 @@ namespace hpx::parcelset::policies::mpi {
 
         connection_ptr create_connection(int dest, parcelset::parcelport* pp)
         {
-            return std::make_shared<connection_type>(this, dest, pp);
+            return std::make_shared<connection_type>(
+                this, dest, pp, requests_);
         }
 
         void add(connection_ptr const& ptr)
@@ -155,6 +157,8 @@ namespace hpx::parcelset::policies::mpi {
             return next_free;
         }
 
+        util::mpi_request_poller& requests_;
+
         hpx::spinlock connections_mtx_;
         connection_list connections_;
 
@@ -22,6 +22,7 @@
 #include <hpx/parcelset_base/detail/gatherer.hpp>
 #include <hpx/parcelset_base/parcelport.hpp>
 
+#include <atomic>
 #include <cstddef>
 #include <memory>
 #include <system_error>
@@ -52,25 +53,21 @@ namespace hpx::parcelset::policies::mpi {
         enum connection_state
         {
             initialized,
-            sent_header,
-            sent_transmission_chunks,
-            sent_data,
-            sent_chunks
+            sent_message
         };
 
         using base_type =
             parcelset::parcelport_connection<sender_connection, data_type>;
 
     public:
-        sender_connection(sender_type* s, int dst, parcelset::parcelport* pp)
+        sender_connection(sender_type* s, int dst, parcelset::parcelport* pp,
+            util::mpi_request_poller& requests)
           : state_(initialized)
           , sender_(s)
           , tag_(-1)
           , dst_(dst)
-          , request_(MPI_REQUEST_NULL)
-          , request_ptr_(nullptr)
-          , chunks_idx_(0)
-          , ack_(0)
+          , requests_(requests)
+          , pending_(0)
           , pp_(pp)
           , there_(parcelset::locality(locality(dst_)))
         {
@@ -98,8 +95,6 @@ namespace hpx::parcelset::policies::mpi {
             buffer_.data_point_.time_ =
                 hpx::chrono::high_resolution_clock::now();
 #endif
-            request_ptr_ = nullptr;
-            chunks_idx_ = 0;
             tag_ = acquire_tag(sender_);
             header_ = header(buffer_, tag_);
             header_.assert_valid();
@@ -127,18 +122,9 @@ namespace hpx::parcelset::policies::mpi {
             switch (state_)
             {
             case initialized:
-                return send_header();
+                return send_message();
 
-            case sent_header:
-                return send_transmission_chunks();
-
-            case sent_transmission_chunks:
-                return send_data();
-
-            case sent_data:
-                return send_chunks();
-
-            case sent_chunks:
+            case sent_message:
                 return done();
 
             default:
@@ -147,97 +133,54 @@ namespace hpx::parcelset::policies::mpi {
             return false;
         }
 
-        bool send_header()
-        {
-            {
-                util::mpi_environment::scoped_lock l;
-                HPX_ASSERT(state_ == initialized);
-                HPX_ASSERT(request_ptr_ == nullptr);
-                MPI_Isend(header_.data(), header_.data_size_, MPI_BYTE, dst_, 0,
-                    util::mpi_environment::communicator(), &request_);
-                request_ptr_ = &request_;
-            }
-
-            state_ = sent_header;
-            return send_transmission_chunks();
-        }
-
-        bool send_transmission_chunks()
+        // Post all sends of the message at once. The parts which were not
+        // piggy-backed onto the header are sent directly from the parcel
+        // buffer. The receiver posts its receives for those right after the
+        // header has arrived, which lets the MPI implementation transfer
+        // large parts using its rendezvous protocol without buffering them.
+        bool send_message()
         {
-            HPX_ASSERT(state_ == sent_header);
-            HPX_ASSERT(request_ptr_ != nullptr);
-            if (!request_done())
-            {
-                return false;
-            }
-
-            HPX_ASSERT(request_ptr_ == nullptr);
+            HPX_ASSERT(state_ == initialized);
+            HPX_ASSERT(pending_ == 0);
 
-            std::vector<typename parcel_buffer_type::transmission_chunk_type>&
-                chunks = buffer_.transmission_chunks_;
-            if (!chunks.empty())
             {
                 util::mpi_environment::scoped_lock l;
-                MPI_Isend(chunks.data(),
-                    static_cast<int>(chunks.size() *
-                        sizeof(parcel_buffer_type::transmission_chunk_type)),
-                    MPI_BYTE, dst_, tag_, util::mpi_environment::communicator(),
-                    &request_);
-                request_ptr_ = &request_;
-            }
-
-            state_ = sent_transmission_chunks;
-            return send_data();
-        }
-
-        bool send_data()
-        {
-            HPX_ASSERT(state_ == sent_transmission_chunks);
-            if (!request_done())
-            {
-                return false;
-            }
 
-            if (!header_.piggy_back())
-            {
-                util::mpi_environment::scoped_lock l;
-                MPI_Isend(buffer_.data_.data(),
-                    static_cast<int>(buffer_.data_.size()), MPI_BYTE, dst_,
-                    tag_, util::mpi_environment::communicator(), &request_);
-                request_ptr_ = &request_;
-            }
-            state_ = sent_data;
+                isend(header_.data(), header_.data_size_, 0);
 
-            return send_chunks();
-        }
+                std::vector<
+                    typename parcel_buffer_type::transmission_chunk_type>&
+                    chunks = buffer_.transmission_chunks_;
+                if (!chunks.empty() &&
+                    !header_.piggy_back_transmission_chunks())
+                {
+                    isend(chunks.data(),
+                        chunks.size() *
+                            sizeof(
+                                parcel_buffer_type::transmission_chunk_type),
+                        tag_);
+                }
 
-        bool send_chunks()
-        {
-            HPX_ASSERT(state_ == sent_data);
+                if (!header_.piggy_back())
+                {
+                    isend(buffer_.data_.data(), buffer_.data_.size(), tag_);
+                }
 
-            while (chunks_idx_ < buffer_.chunks_.size())
-            {
-                serialization::serialization_chunk& c =
-                    buffer_.chunks_[chunks_idx_];
-                if (c.type_ == serialization::chunk_type::chunk_type_pointer)
+                if (!header_.piggy_back_chunks())
                 {
-                    if (!request_done())
+                    for (serialization::serialization_chunk& c :
+                        buffer_.chunks_)
                     {
-                        return false;
+                        if (c.type_ ==
+                            serialization::chunk_type::chunk_type_pointer)
+                        {
+                            isend(c.data_.cpos_, c.size_, tag_);
+                        }
                     }
-
-                    util::mpi_environment::scoped_lock l;
-                    MPI_Isend(const_cast<void*>(c.data_.cpos_),
-                        static_cast<int>(c.size_), MPI_BYTE, dst_, tag_,
-                        util::mpi_environment::communicator(), &request_);
-                    request_ptr_ = &request_;
                 }
-
-                chunks_idx_++;
             }
 
-            state_ = sent_chunks;
-
+            state_ = sent_message;
             return done();
         }
 
@@ -264,29 +207,27 @@ namespace hpx::parcelset::policies::mpi {
             return true;
         }
 
-        bool request_done()
+        // The requests are tested by the request poller of the parcelport,
+        // which decrements the number of pending requests as they complete.
+        bool request_done() const noexcept
         {
-            if (request_ptr_ == nullptr)
-            {
-                return true;
-            }
-
-            util::mpi_environment::scoped_try_lock l;
-            if (!l.locked)
-            {
-                return false;
-            }
+            return pending_.load(std::memory_order_acquire) == 0;
+        }
 
-            int completed = 0;
-            int ret = MPI_Test(request_ptr_, &completed, MPI_STATUS_IGNORE);
-            HPX_ASSERT(ret == MPI_SUCCESS);
-            (void) ret;
-            if (completed)
-            {
-                request_ptr_ = nullptr;
-                return true;
-            }
-            return false;
+        // has to be called while holding the MPI lock
+        void isend(void const* data, std::size_t size, int tag)
+        {
+            MPI_Request request;
+            MPI_Isend(const_cast<void*>(data), static_cast<int>(size),
+                MPI_BYTE, dst_, tag, util::mpi_environment::communicator(),
+                &request);
+
+            ++pending_;
+            requests_.add(request, [this](int status) {
+                HPX_ASSERT(status == MPI_SUCCESS);
+                (void) status;
+                pending_.fetch_sub(1, std::memory_order_release);
+            });
         }
 
         connection_state state_;
@@ -300,10 +241,8 @@ namespace hpx::parcelset::policies::mpi {
 
         header header_;
 
-        MPI_Request request_;
-        MPI_Request* request_ptr_;
-        std::size_t chunks_idx_;
-        char ack_;
+        util::mpi_request_poller& requests_;
+        std::atomic<std::size_t> pending_;
 
         parcelset::parcelport* pp_;
 
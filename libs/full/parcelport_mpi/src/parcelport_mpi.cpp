@@ -101,6 +101,14 @@ namespace hpx::parcelset {
                     HPX_PARCEL_MAX_CONNECTIONS);
             }
 
+            // the MPI implementation has to be able to access device
+            // memory (e.g. a CUDA-aware MPI build)
+            static bool device_memory(util::runtime_configuration const& ini)
+            {
+                return hpx::util::get_entry_as<int>(
+                           ini, "hpx.parcel.mpi.device_memory", 0) != 0;
+            }
+
             static std::size_t background_threads(
                 util::runtime_configuration const& ini)
             {
@@ -114,8 +122,10 @@ namespace hpx::parcelset {
                 threads::policies::callback_notifier const& notifier)
               : base_type(ini, here(), notifier)
               , stopped_(false)
-              , receiver_(*this)
+              , sender_(requests_)
+              , receiver_(*this, requests_)
               , background_threads_(background_threads(ini))
+              , device_memory_(device_memory(ini))
             {
             }
 
@@ -177,6 +187,11 @@ namespace hpx::parcelset {
                 return parcelset::locality(locality());
             }
 
+            bool can_send_device_memory() const noexcept override
+            {
+                return device_memory_;
+            }
+
             bool background_work(
                 std::size_t num_thread, parcelport_background_mode mode)
             {
@@ -185,7 +200,7 @@ namespace hpx::parcelset {
                     return false;
                 }
 
-                bool has_work = false;
+                bool has_work = poll_requests();
                 if (mode & parcelport_background_mode_send)
                 {
                     has_work = sender_.background_work();
@@ -200,9 +215,31 @@ namespace hpx::parcelset {
         private:
             std::atomic<bool> stopped_;
 
+            // all requests of the sender and receiver connections are tested
+            // at once
+            util::mpi_request_poller requests_;
+
             sender sender_;
             receiver<parcelport> receiver_;
 
+            // Test the outstanding requests, this marks the parts of the
+            // messages as done which have been transferred. Returns whether
+            // requests are still outstanding.
+            bool poll_requests()
+            {
+                if (requests_.empty())
+                {
+                    return false;
+                }
+
+                util::mpi_environment::scoped_try_lock l;
+                if (l.locked)
+                {
+                    requests_.poll();
+                }
+                return !requests_.empty();
+            }
+
             void io_service_work()
             {
                 std::size_t k = 0;
@@ -210,7 +247,8 @@ namespace hpx::parcelset {
                 // We only execute work on the IO service while HPX is starting
                 while (hpx::is_starting())
                 {
-                    bool has_work = sender_.background_work();
+                    bool has_work = poll_requests();
+                    has_work = sender_.background_work() || has_work;
                     has_work = receiver_.background_work() || has_work;
                     if (has_work)
                     {
@@ -243,6 +281,7 @@ namespace hpx::parcelset {
             }
 
             std::size_t background_threads_;
+            bool device_memory_;
         };
     }    // namespace policies::mpi
 }    // namespace hpx::parcelset
@@ -302,6 +341,11 @@ namespace hpx::traits {
                 "max_connections = "
                 "${HPX_HAVE_PARCELPORT_MPI_MAX_CONNECTIONS:8192}\n"
 
+                // set to 1 if MPI can send from and receive into device
+                // memory, default: 0
+                "device_memory = "
+                "${HPX_HAVE_PARCELPORT_MPI_DEVICE_MEMORY:0}\n"
+
                 // number of cores that do background work, default: all
                 "background_threads = "
                 "${HPX_HAVE_PARCELPORT_MPI_BACKGROUND_THREADS:-1}\n";
@@ -0,0 +1,142 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+#include <hpx/modules/synchronization.hpp>
+
+#include <hpx/parcelport_shmem/locality.hpp>
+#include <hpx/parcelport_shmem/receiver.hpp>
+#include <hpx/parcelport_shmem/segment.hpp>
+#include <hpx/parcelport_shmem/sender.hpp>
+#include <hpx/parcelset/parcelport_impl.hpp>
+#include <hpx/parcelset_base/locality.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx::parcelset {
+
+    namespace policies::shmem {
+
+        class HPX_EXPORT connection_handler;
+    }    // namespace policies::shmem
+
+    template <>
+    struct connection_handler_traits<policies::shmem::connection_handler>
+    {
+        using connection_type = policies::shmem::sender;
+
+        // the segments of the other localities are found through AGAS only
+        using send_early_parcel = std::false_type;
+        using do_background_work = std::true_type;
+        using send_immediate_parcels = std::false_type;
+
+        static constexpr const char* type() noexcept
+        {
+            return "shmem";
+        }
+
+        static constexpr const char* pool_name() noexcept
+        {
+            return "parcel-pool-shmem";
+        }
+
+        static constexpr const char* pool_name_postfix() noexcept
+        {
+            return "-shmem";
+        }
+    };
+
+    namespace policies::shmem {
+
+        parcelset::locality parcelport_address(
+            util::runtime_configuration const& ini);
+
+        class HPX_EXPORT connection_handler
+          : public parcelport_impl<connection_handler>
+        {
+            using base_type = parcelport_impl<connection_handler>;
+            using receiver_type = receiver<connection_handler>;
+
+        public:
+            static std::vector<std::string> runtime_configuration()
+            {
+                std::vector<std::string> lines;
+                return lines;
+            }
+
+            connection_handler(util::runtime_configuration const& ini,
+                threads::policies::callback_notifier const& notifier);
+
+            ~connection_handler();
+
+            // Only localities running on the same host can be reached
+            bool can_connect(parcelset::locality const& dest,
+                bool use_alternative_parcelport) override;
+
+            // Start the handling of connections.
+            bool do_run();
+
+            // Stop the handling of connectons.
+            void do_stop();
+
+            // Return the name of this locality
+            std::string get_locality_name() const;
+
+            std::shared_ptr<sender> create_connection(
+                parcelset::locality const& l, error_code& ec);
+
+            parcelset::locality agas_locality(
+                util::runtime_configuration const& ini) const;
+
+            parcelset::locality create_locality() const;
+
+            // Continue the pending sends and read from the channels
+            bool background_work(
+                std::size_t num_thread, parcelport_background_mode mode);
+
+        private:
+            // Return the mapping of the segment of the given locality
+            std::shared_ptr<segment> get_segment(
+                locality const& there, std::error_code& ec);
+
+            bool receive();
+
+            void io_service_work();
+
+            std::size_t num_channels_;
+            std::size_t channel_size_;
+
+            // the segment other localities write to and its receivers
+            std::shared_ptr<segment> segment_;
+            std::vector<std::unique_ptr<receiver_type>> receivers_;
+
+            pending_senders pending_senders_;
+
+            // the segments of the localities this one sends to
+            hpx::spinlock segments_mtx_;
+            std::map<std::int32_t, std::shared_ptr<segment>> segments_;
+
+            std::atomic<bool> stopped_;
+        };
+    }    // namespace policies::shmem
+}    // namespace hpx::parcelset
+
+#include <hpx/config/warnings_suffix.hpp>
+
+#endif
@@ -0,0 +1,311 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+#include <hpx/assert.hpp>
+#include <hpx/modules/logging.hpp>
+#include <hpx/modules/synchronization.hpp>
+#include <hpx/modules/timing.hpp>
+
+#include <hpx/parcelport_shmem/segment.hpp>
+#include <hpx/parcelset/decode_parcels.hpp>
+#include <hpx/parcelset/parcelport_connection.hpp>
+#include <hpx/parcelset_base/buffer_pool.hpp>
+#include <hpx/parcelset_base/detail/data_point.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+namespace hpx::parcelset::policies::shmem {
+
+    // The receiving end of one channel of the segment owned by this locality.
+    // The channel is polled by the background work, the available bytes are
+    // copied into the parcel buffer.
+    template <typename Parcelport>
+    class receiver
+      : public parcelport_connection<receiver<Parcelport>, std::vector<char>,
+            std::vector<char>>
+    {
+        using base_type = parcelport_connection<receiver<Parcelport>,
+            std::vector<char>, std::vector<char>>;
+        using parcel_buffer_type = typename base_type::parcel_buffer_type;
+        using transmission_chunk_type =
+            typename parcel_buffer_type::transmission_chunk_type;
+
+        enum class receive_state
+        {
+            header,
+            transmission_chunks,
+            data,
+            chunks
+        };
+
+    public:
+        receiver(channel c, std::uint64_t max_inbound_size,
+            Parcelport& parcelport)
+          : channel_(c)
+          , max_inbound_size_(max_inbound_size)
+          , parcelport_(parcelport)
+          , receive_state_(receive_state::header)
+          , target_(nullptr)
+          , remaining_(0)
+          , current_chunk_(0)
+          , failed_(false)
+        {
+            start_message();
+        }
+
+        // Process the data written to the channel since the last call,
+        // returns whether there was any. The channel is made available to
+        // other senders once the current one has closed it.
+        bool poll()
+        {
+            // only one thread at a time can read from the channel
+            std::unique_lock l(mtx_, std::try_to_lock);
+            if (!l.owns_lock())
+            {
+                return false;
+            }
+
+            channel_state const state = channel_.state();
+            if (state == channel_state::free || state == channel_state::claimed)
+            {
+                return false;
+            }
+
+            std::size_t const received =
+                channel_.read([this](char const* data, std::size_t size) {
+                    if (!failed_)
+                    {
+                        consume(data, size);
+                    }
+                });
+
+            // The state is published after all data was written, nothing
+            // more will arrive once the channel was seen as closed and empty.
+            if (state == channel_state::closed && channel_.empty())
+            {
+                HPX_ASSERT(failed_ ||
+                    (receive_state_ == receive_state::header &&
+                        remaining_ == sizeof(header_)));
+
+                this->buffer_ = parcel_buffer_type();
+                failed_ = false;
+                start_message();
+
+                channel_.release();
+            }
+            return received != 0;
+        }
+
+    private:
+        void start_message() noexcept
+        {
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+            parcelset::data_point& data = this->buffer_.data_point_;
+            data.time_ = timer_.elapsed_nanoseconds();
+            data.serialization_time_ = 0;
+            data.bytes_ = 0;
+            data.num_parcels_ = 0;
+#endif
+            // the message header has the same layout as used by the TCP
+            // parcelport
+            receive_state_ = receive_state::header;
+            target_ = header_;
+            remaining_ = sizeof(header_);
+        }
+
+        // The remaining data of this connection is discarded
+        void fail(std::error_code const& ec)
+        {
+            failed_ = true;
+            LPT_(error).format(
+                "shmem receiver: discarding incoming data: error: {}",
+                ec.message());
+        }
+
+        // Copy the received data to where it belongs
+        void consume(char const* data, std::size_t size)
+        {
+            while (size != 0 && !failed_)
+            {
+                std::size_t const n = (std::min)(size, remaining_);
+                std::memcpy(target_, data, n);
+                target_ += n;
+                remaining_ -= n;
+                data += n;
+                size -= n;
+
+                // zero sized parts are completed right away
+                while (remaining_ == 0 && !failed_)
+                {
+                    next_part();
+                }
+            }
+        }
+
+        // The current part of the message was received, determine the next
+        void next_part()
+        {
+            parcel_buffer_type& buffer = this->buffer_;
+            switch (receive_state_)
+            {
+            case receive_state::header:
+            {
+                std::memcpy(&buffer.size_, header_, sizeof(buffer.size_));
+                std::memcpy(&buffer.data_size_, header_ + sizeof(buffer.size_),
+                    sizeof(buffer.data_size_));
+                std::memcpy(static_cast<void*>(&buffer.num_chunks_),
+                    header_ + sizeof(buffer.size_) + sizeof(buffer.data_size_),
+                    sizeof(buffer.num_chunks_));
+
+                // Determine the length of the serialized data.
+                std::uint64_t const inbound_size = buffer.size_;
+                if (inbound_size > max_inbound_size_)
+                {
+                    fail(std::make_error_code(std::errc::message_size));
+                    return;
+                }
+
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+                buffer.data_point_.bytes_ =
+                    static_cast<std::size_t>(inbound_size);
+#endif
+                buffer.data_ = buffer_pool::instance().get(
+                    static_cast<std::size_t>(inbound_size));
+
+                std::size_t const num_zero_copy_chunks =
+                    static_cast<std::size_t>(
+                        static_cast<std::uint32_t>(buffer.num_chunks_.first));
+                if (num_zero_copy_chunks != 0)
+                {
+                    std::size_t const num_non_zero_copy_chunks =
+                        static_cast<std::size_t>(static_cast<std::uint32_t>(
+                            buffer.num_chunks_.second));
+
+                    buffer.transmission_chunks_.resize(
+                        num_zero_copy_chunks + num_non_zero_copy_chunks);
+
+                    receive_state_ = receive_state::transmission_chunks;
+                    target_ = reinterpret_cast<char*>(
+                        buffer.transmission_chunks_.data());
+                    remaining_ = buffer.transmission_chunks_.size() *
+                        sizeof(transmission_chunk_type);
+                }
+                else
+                {
+                    receive_state_ = receive_state::data;
+                    target_ = buffer.data_.data();
+                    remaining_ = buffer.data_.size();
+                }
+            }
+            break;
+
+            case receive_state::transmission_chunks:
+                receive_state_ = receive_state::data;
+                target_ = buffer.data_.data();
+                remaining_ = buffer.data_.size();
+                break;
+
+            case receive_state::data:
+            {
+                // add appropriately sized chunk buffers for the zero-copy data
+                std::size_t const num_zero_copy_chunks =
+                    static_cast<std::size_t>(
+                        static_cast<std::uint32_t>(buffer.num_chunks_.first));
+                if (num_zero_copy_chunks == 0)
+                {
+                    message_complete();
+                    return;
+                }
+
+                buffer.chunks_.resize(num_zero_copy_chunks);
+                current_chunk_ = 0;
+                start_chunk();
+            }
+            break;
+
+            case receive_state::chunks:
+                if (++current_chunk_ == buffer.chunks_.size())
+                {
+                    message_complete();
+                    return;
+                }
+                start_chunk();
+                break;
+            }
+        }
+
+        void start_chunk()
+        {
+            parcel_buffer_type& buffer = this->buffer_;
+
+            std::size_t const chunk_size = static_cast<std::size_t>(
+                buffer.transmission_chunks_[current_chunk_].second);
+            if (chunk_size > max_inbound_size_)
+            {
+                fail(std::make_error_code(std::errc::message_size));
+                return;
+            }
+
+            receive_state_ = receive_state::chunks;
+            target_ = get_chunk_receive_address(buffer, current_chunk_);
+            remaining_ = chunk_size;
+        }
+
+        void message_complete()
+        {
+            // complete data point and pass it along
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+            this->buffer_.data_point_.time_ = timer_.elapsed_nanoseconds() -
+                this->buffer_.data_point_.time_;
+#endif
+            // decode the received parcels.
+            decode_parcels(
+                parcelport_, HPX_MOVE(this->buffer_), std::size_t(-1));
+            this->buffer_ = parcel_buffer_type();
+
+            start_message();
+        }
+
+        hpx::spinlock mtx_;
+        channel channel_;
+
+        std::uint64_t max_inbound_size_;
+
+        // The handler used to process the incoming request.
+        Parcelport& parcelport_;
+
+        // where the next received bytes belong to
+        receive_state receive_state_;
+        char* target_;
+        std::size_t remaining_;
+        std::size_t current_chunk_;
+
+        // size_, data_size_, and num_chunks_ of the parcel buffer
+        char header_[sizeof(std::uint64_t) * 2 +
+            sizeof(typename parcel_buffer_type::count_chunks_type)];
+
+        bool failed_;
+
+        // Counters and timers for parcels received.
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+        hpx::chrono::high_resolution_timer timer_;
+#endif
+    };
+}    // namespace hpx::parcelset::policies::shmem
+
+#endif
@@ -0,0 +1,222 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+#include <hpx/assert.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <system_error>
+
+namespace hpx::parcelset::policies::shmem {
+
+    namespace detail {
+
+        static_assert(std::atomic<std::uint64_t>::is_always_lock_free &&
+                std::atomic<std::uint32_t>::is_always_lock_free,
+            "the shared memory parcelport requires lock-free atomics");
+
+        // The control block of a channel, the indices are only ever
+        // incremented and are placed on separate cache lines as they are
+        // written by different processes.
+        struct channel_header
+        {
+            // the number of bytes written so far, updated by the sender
+            alignas(64) std::atomic<std::uint64_t> head;
+
+            // the number of bytes read so far, updated by the receiver
+            alignas(64) std::atomic<std::uint64_t> tail;
+
+            alignas(64) std::atomic<std::uint32_t> state;
+            std::int32_t sender_pid;
+        };
+
+        struct segment_header
+        {
+            std::uint64_t magic;
+            std::uint32_t version;
+            std::uint32_t num_channels;
+            std::uint64_t channel_size;
+            std::uint64_t data_offset;
+
+            // set once the segment has been initialized by its owner
+            std::atomic<std::uint32_t> ready;
+        };
+    }    // namespace detail
+
+    enum class channel_state : std::uint32_t
+    {
+        free = 0,         // may be claimed by a sender
+        claimed = 1,      // being set up by a sender
+        connected = 2,    // in use
+        closed = 3        // the sender is gone, the data is still to be read
+    };
+
+    // One direction of a connection between two localities: a lock-free
+    // single producer single consumer ring of bytes living in the shared
+    // memory segment of the receiving locality.
+    class channel
+    {
+    public:
+        channel() noexcept
+          : header_(nullptr)
+          , data_(nullptr)
+          , size_(0)
+        {
+        }
+
+        channel(detail::channel_header* header, char* data,
+            std::size_t size) noexcept
+          : header_(header)
+          , data_(data)
+          , size_(size)
+        {
+            // the indices are mapped onto the ring by masking
+            HPX_ASSERT(size_ != 0 && (size_ & (size_ - 1)) == 0);
+        }
+
+        explicit operator bool() const noexcept
+        {
+            return header_ != nullptr;
+        }
+
+        std::size_t capacity() const noexcept
+        {
+            return size_;
+        }
+
+        channel_state state() const noexcept
+        {
+            return static_cast<channel_state>(
+                header_->state.load(std::memory_order_acquire));
+        }
+
+        bool empty() const noexcept
+        {
+            return header_->head.load(std::memory_order_acquire) ==
+                header_->tail.load(std::memory_order_relaxed);
+        }
+
+        // Copy as much of the given data into the ring as fits, returns the
+        // number of bytes written (must be called by the sender only).
+        HPX_EXPORT std::size_t write(
+            void const* data, std::size_t size) noexcept;
+
+        // Pass the data available for reading to the given function, which
+        // is invoked for at most two contiguous ranges. The ranges are
+        // released afterwards, returns the number of bytes read (must be
+        // called by the receiver only).
+        template <typename F>
+        std::size_t read(F&& f)
+        {
+            std::uint64_t const tail =
+                header_->tail.load(std::memory_order_relaxed);
+            std::uint64_t const head =
+                header_->head.load(std::memory_order_acquire);
+
+            std::size_t const available = static_cast<std::size_t>(head - tail);
+            if (available == 0)
+            {
+                return 0;
+            }
+
+            std::size_t const offset =
+                static_cast<std::size_t>(tail & (size_ - 1));
+            std::size_t const first = (std::min)(available, size_ - offset);
+
+            f(data_ + offset, first);
+            if (first != available)
+            {
+                f(data_, available - first);
+            }
+
+            header_->tail.store(head, std::memory_order_release);
+            return available;
+        }
+
+        // Mark the channel as abandoned by the sender, the receiver frees it
+        // once all data was read.
+        HPX_EXPORT void close() noexcept;
+
+        // Make the channel available to other senders again (must be called
+        // by the receiver only).
+        HPX_EXPORT void release() noexcept;
+
+    private:
+        friend class segment;
+
+        detail::channel_header* header_;
+        char* data_;
+        std::size_t size_;
+    };
+
+    // A shared memory segment holding the channels other localities on the
+    // same host use to send parcels to its owner
+    class HPX_EXPORT segment
+    {
+        segment(std::string const& name, void* base, std::size_t size,
+            bool owner) noexcept;
+
+    public:
+        segment(segment const&) = delete;
+        segment(segment&&) = delete;
+        segment& operator=(segment const&) = delete;
+        segment& operator=(segment&&) = delete;
+
+        ~segment();
+
+        // The name of the segment owned by the process with the given id
+        static std::string name(std::int32_t pid);
+
+        // Create the segment a locality receives from, a stale segment left
+        // behind by a terminated process with the same id is replaced.
+        static std::shared_ptr<segment> create(std::string const& name,
+            std::size_t num_channels, std::size_t channel_size,
+            std::error_code& ec);
+
+        // Map the segment of another locality, this fails if it hasn't been
+        // initialized yet.
+        static std::shared_ptr<segment> open(
+            std::string const& name, std::error_code& ec);
+
+        std::string const& name() const noexcept
+        {
+            return name_;
+        }
+
+        std::size_t num_channels() const noexcept
+        {
+            return header()->num_channels;
+        }
+
+        channel get_channel(std::size_t i) const noexcept;
+
+        // Claim a free channel on behalf of the given sending process,
+        // returns an invalid channel if all of them are in use.
+        channel claim(std::int32_t pid) noexcept;
+
+    private:
+        detail::segment_header* header() const noexcept
+        {
+            return static_cast<detail::segment_header*>(base_);
+        }
+
+        std::string name_;
+        void* base_;
+        std::size_t size_;
+        bool owner_;
+    };
+}    // namespace hpx::parcelset::policies::shmem
+
+#endif
@@ -0,0 +1,291 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+#include <hpx/assert.hpp>
+#include <hpx/modules/functional.hpp>
+#include <hpx/modules/runtime_local.hpp>
+#include <hpx/modules/synchronization.hpp>
+#include <hpx/modules/threading_base.hpp>
+#include <hpx/modules/timing.hpp>
+
+#include <hpx/parcelport_shmem/segment.hpp>
+#include <hpx/parcelset/parcelport_connection.hpp>
+#include <hpx/parcelset_base/detail/data_point.hpp>
+#include <hpx/parcelset_base/locality.hpp>
+#include <hpx/parcelset_base/parcelport.hpp>
+
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+namespace hpx::parcelset::policies::shmem {
+
+    class sender;
+
+    // The connections whose message did not fit into their channel, those
+    // are continued by the background work once the receiver made room.
+    class pending_senders
+    {
+    public:
+        using connection_ptr = std::shared_ptr<sender>;
+
+        void add(connection_ptr ptr)
+        {
+            std::unique_lock l(connections_mtx_);
+            connections_.push_back(HPX_MOVE(ptr));
+        }
+
+        bool background_work();
+
+    private:
+        hpx::spinlock connections_mtx_;
+        std::deque<connection_ptr> connections_;
+    };
+
+    class sender
+      : public parcelset::parcelport_connection<sender, std::vector<char>>
+    {
+        using postprocess_handler_type =
+            hpx::move_only_function<void(std::error_code const&)>;
+
+        using parcel_postprocess_type =
+            hpx::move_only_function<void(std::error_code const&,
+                parcelset::locality const&, std::shared_ptr<sender>)>;
+
+    public:
+        // Construct a sending parcelport_connection writing to the given
+        // channel, the channel is handed back to the receiver when the object
+        // is destroyed.
+        sender(std::shared_ptr<segment> seg, channel c,
+            parcelset::locality const& locality_id, pending_senders& pending,
+            parcelset::parcelport* pp)
+          : segment_(HPX_MOVE(seg))
+          , channel_(c)
+          , there_(locality_id)
+          , pending_(pending)
+          , current_(0)
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+          , pp_(pp)
+#endif
+        {
+            HPX_UNUSED(pp);
+        }
+
+        ~sender()
+        {
+            channel_.close();
+        }
+
+        parcelset::locality const& destination() const noexcept
+        {
+            return there_;
+        }
+
+        void verify_(parcelset::locality const& parcel_locality_id) const
+        {
+            HPX_ASSERT(parcel_locality_id == there_);
+            HPX_UNUSED(parcel_locality_id);
+        }
+
+        template <typename Handler, typename ParcelPostprocess>
+        void async_write(
+            Handler&& handler, ParcelPostprocess&& parcel_postprocess)
+        {
+#if defined(HPX_TRACK_STATE_OF_OUTGOING_TCP_CONNECTION)
+            HPX_ASSERT(state_ == state_send_pending);
+#endif
+            HPX_ASSERT(!buffer_.data_.empty());
+            HPX_ASSERT(!handler_);
+            HPX_ASSERT(!postprocess_handler_);
+
+            handler_ = HPX_FORWARD(Handler, handler);
+            postprocess_handler_ =
+                HPX_FORWARD(ParcelPostprocess, parcel_postprocess);
+            HPX_ASSERT(handler_);
+            HPX_ASSERT(postprocess_handler_);
+
+#if defined(HPX_TRACK_STATE_OF_OUTGOING_TCP_CONNECTION)
+            state_ = state_async_write;
+#endif
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+            buffer_.data_point_.time_ = timer_.elapsed_nanoseconds();
+#endif
+            // The message is written using the same layout as used by the
+            // TCP parcelport, the zero-copy chunks are copied directly from
+            // the memory they refer to.
+            parts_.clear();
+            add_part(&buffer_.size_, sizeof(buffer_.size_));
+            add_part(&buffer_.data_size_, sizeof(buffer_.data_size_));
+            add_part(&buffer_.num_chunks_, sizeof(buffer_.num_chunks_));
+
+            std::vector<parcel_buffer_type::transmission_chunk_type>& chunks =
+                buffer_.transmission_chunks_;
+            if (!chunks.empty())
+            {
+                add_part(chunks.data(),
+                    chunks.size() *
+                        sizeof(parcel_buffer_type::transmission_chunk_type));
+            }
+            add_part(buffer_.data_.data(), buffer_.data_.size());
+
+            for (serialization::serialization_chunk& c : buffer_.chunks_)
+            {
+                if (c.type_ == serialization::chunk_type::chunk_type_pointer)
+                {
+                    add_part(c.data_.cpos_, c.size_);
+                }
+            }
+            current_ = 0;
+
+            if (send())
+            {
+                handle_write();
+            }
+            else
+            {
+                pending_.add(shared_from_this());
+            }
+        }
+
+    private:
+        friend class pending_senders;
+
+        void add_part(void const* data, std::size_t size)
+        {
+            parts_.emplace_back(static_cast<char const*>(data), size);
+        }
+
+        static void reset_handler(postprocess_handler_type handler)
+        {
+            handler.reset();
+        }
+
+        // Write as much of the message as fits into the channel, returns
+        // whether the whole message was written
+        bool send() noexcept
+        {
+            while (current_ != parts_.size())
+            {
+                std::pair<char const*, std::size_t>& part = parts_[current_];
+
+                std::size_t const n = channel_.write(part.first, part.second);
+                part.first += n;
+                part.second -= n;
+
+                if (part.second != 0)
+                {
+                    return false;
+                }
+                ++current_;
+            }
+            return true;
+        }
+
+        // handle completed write operation
+        void handle_write()
+        {
+            std::error_code const e;
+
+            // just call initial handler
+            handler_(e);
+
+            postprocess_handler_type handler;
+            std::swap(handler, handler_);
+
+            if (threads::threadmanager_is(hpx::state::running))
+            {
+                // the handler needs to be reset on an HPX thread (it destroys
+                // the parcel, which in turn might invoke HPX functions)
+                threads::thread_init_data data(
+                    threads::make_thread_function_nullary(util::deferred_call(
+                        &sender::reset_handler, HPX_MOVE(handler))),
+                    "sender::reset_handler");
+                threads::register_thread(data);
+            }
+            else
+            {
+                reset_handler(HPX_MOVE(handler));
+            }
+
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+            // complete data point and push back onto gatherer
+            buffer_.data_point_.time_ =
+                timer_.elapsed_nanoseconds() - buffer_.data_point_.time_;
+            pp_->add_sent_data(buffer_.data_point_);
+#endif
+            buffer_.clear();
+
+#if defined(HPX_TRACK_STATE_OF_OUTGOING_TCP_CONNECTION)
+            state_ = state_handle_read_ack;
+#endif
+            // Call post-processing handler, which will send remaining pending
+            // parcels. Pass along the connection so it can be reused if more
+            // parcels have to be sent. This may destroy this object.
+            parcel_postprocess_type postprocess_handler;
+            std::swap(postprocess_handler, postprocess_handler_);
+
+            postprocess_handler(e, there_, shared_from_this());
+        }
+
+        // keeps the mapping of the receiving locality's segment alive
+        std::shared_ptr<segment> segment_;
+        channel channel_;
+
+        // the other (receiving) end of this connection
+        parcelset::locality there_;
+        pending_senders& pending_;
+
+        // the parts of the message which are still to be written
+        std::vector<std::pair<char const*, std::size_t>> parts_;
+        std::size_t current_;
+
+        // Counters and their data containers.
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+        hpx::chrono::high_resolution_timer timer_;
+        parcelset::parcelport* pp_;
+#endif
+
+        postprocess_handler_type handler_;
+        parcel_postprocess_type postprocess_handler_;
+    };
+
+    inline bool pending_senders::background_work()
+    {
+        connection_ptr connection;
+        {
+            std::unique_lock l(connections_mtx_, std::try_to_lock);
+            if (!l.owns_lock() || connections_.empty())
+            {
+                return false;
+            }
+
+            connection = HPX_MOVE(connections_.front());
+            connections_.pop_front();
+        }
+
+        // Check if sending has been completed....
+        if (connection->send())
+        {
+            connection->handle_write();
+        }
+        else
+        {
+            add(HPX_MOVE(connection));
+        }
+        return true;
+    }
+}    // namespace hpx::parcelset::policies::shmem
+
+#endif
@@ -0,0 +1,341 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+#include <hpx/assert.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/modules/execution_base.hpp>
+#include <hpx/modules/functional.hpp>
+#include <hpx/modules/runtime_configuration.hpp>
+#include <hpx/modules/runtime_local.hpp>
+#include <hpx/modules/threading_base.hpp>
+#include <hpx/modules/util.hpp>
+
+#include <hpx/parcelport_shmem/connection_handler.hpp>
+#include <hpx/parcelport_shmem/locality.hpp>
+#include <hpx/parcelport_shmem/receiver.hpp>
+#include <hpx/parcelport_shmem/segment.hpp>
+#include <hpx/parcelport_shmem/sender.hpp>
+#include <hpx/parcelset_base/locality.hpp>
+
+#include <unistd.h>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <system_error>
+#include <thread>
+
+namespace hpx::parcelset::policies::shmem {
+
+    namespace detail {
+
+        std::string host_name()
+        {
+            char name[256] = {};
+            if (::gethostname(name, sizeof(name) - 1) != 0)
+            {
+                return "<unknown>";
+            }
+            return name;
+        }
+
+        // Containers may share the host name but not the shared memory, the
+        // id of the running kernel discriminates between those.
+        std::string host_id()
+        {
+            std::string id = host_name();
+
+            std::ifstream boot_id("/proc/sys/kernel/random/boot_id");
+            std::string line;
+            if (std::getline(boot_id, line))
+            {
+                id += ":" + line;
+            }
+            return id;
+        }
+
+        std::size_t ring_size(util::runtime_configuration const& ini)
+        {
+            std::size_t const requested = hpx::util::get_entry_as<std::size_t>(
+                ini, "hpx.parcel.shmem.ring_size", 1048576);
+
+            // the channels require their size to be a power of two
+            std::size_t size = 4096;
+            while (size < requested)
+            {
+                size <<= 1;
+            }
+            return size;
+        }
+    }    // namespace detail
+
+    parcelset::locality parcelport_address(
+        util::runtime_configuration const& /* ini */)
+    {
+        return parcelset::locality(
+            locality(detail::host_id(), static_cast<std::int32_t>(::getpid())));
+    }
+
+    connection_handler::connection_handler(
+        util::runtime_configuration const& ini,
+        threads::policies::callback_notifier const& notifier)
+      : base_type(ini, parcelport_address(ini), notifier)
+      , num_channels_(hpx::util::get_entry_as<std::size_t>(
+            ini, "hpx.parcel.shmem.max_channels", 32))
+      , channel_size_(detail::ring_size(ini))
+      , stopped_(false)
+    {
+        if (here_.type() != std::string("shmem"))
+        {
+            HPX_THROW_EXCEPTION(network_error, "shmem::parcelport::parcelport",
+                "this parcelport was instantiated to represent an unexpected "
+                "locality type: {}",
+                here_.type());
+        }
+
+        if (num_channels_ == 0)
+        {
+            HPX_THROW_EXCEPTION(bad_parameter, "shmem::parcelport::parcelport",
+                "hpx.parcel.shmem.max_channels has to be at least one");
+        }
+    }
+
+    connection_handler::~connection_handler()
+    {
+        HPX_ASSERT(!segment_);
+        HPX_ASSERT(receivers_.empty());
+    }
+
+    bool connection_handler::can_connect(
+        parcelset::locality const& dest, bool use_alternative_parcelport)
+    {
+        return use_alternative_parcelport &&
+            dest.get<locality>().host() == here_.get<locality>().host();
+    }
+
+    bool connection_handler::do_run()
+    {
+        locality const& here = here_.get<locality>();
+
+        std::error_code ec;
+        segment_ = segment::create(
+            segment::name(here.pid()), num_channels_, channel_size_, ec);
+        if (!segment_)
+        {
+            HPX_THROW_EXCEPTION(network_error, "shmem::parcelport::run",
+                "{} (while trying to create the shared memory segment: {})",
+                ec.message(), segment::name(here.pid()));
+            return false;
+        }
+
+        receivers_.reserve(num_channels_);
+        for (std::size_t i = 0; i != num_channels_; ++i)
+        {
+            receivers_.push_back(
+                std::make_unique<receiver_type>(segment_->get_channel(i),
+                    get_max_inbound_message_size(), *this));
+        }
+
+        // The background work is not executed while HPX is starting, the IO
+        // service threads poll the channels instead.
+        for (std::size_t i = 0; i != io_service_pool_.size(); ++i)
+        {
+            io_service_pool_.get_io_service(int(i)).post(
+                hpx::bind(&connection_handler::io_service_work, this));
+        }
+        return true;
+    }
+
+    void connection_handler::do_stop()
+    {
+        stopped_ = true;
+
+        // this removes the name of the segment, senders which still refer to
+        // it keep their own mapping
+        receivers_.clear();
+        segment_.reset();
+
+        std::lock_guard<hpx::spinlock> l(segments_mtx_);
+        segments_.clear();
+    }
+
+    std::string connection_handler::get_locality_name() const
+    {
+        return detail::host_name();
+    }
+
+    std::shared_ptr<segment> connection_handler::get_segment(
+        locality const& there, std::error_code& ec)
+    {
+        {
+            std::lock_guard<hpx::spinlock> l(segments_mtx_);
+            auto it = segments_.find(there.pid());
+            if (it != segments_.end())
+            {
+                return it->second;
+            }
+        }
+
+        std::shared_ptr<segment> seg =
+            segment::open(segment::name(there.pid()), ec);
+        if (!seg)
+        {
+            return seg;
+        }
+
+        // another thread may have mapped the segment concurrently
+        std::lock_guard<hpx::spinlock> l(segments_mtx_);
+        return segments_.emplace(there.pid(), HPX_MOVE(seg)).first->second;
+    }
+
+    std::shared_ptr<sender> connection_handler::create_connection(
+        parcelset::locality const& l, error_code& ec)
+    {
+        locality const& there = l.get<locality>();
+        locality const& here = here_.get<locality>();
+
+        // Claim a channel of the target locality, retry if needed
+        std::shared_ptr<segment> seg;
+        channel c;
+        std::error_code error =
+            std::make_error_code(std::errc::resource_unavailable_try_again);
+        if (there.host() != here.host())
+        {
+            error = std::make_error_code(std::errc::host_unreachable);
+        }
+        else
+        {
+            for (std::size_t i = 0; i < HPX_MAX_NETWORK_RETRIES; ++i)
+            {
+                // An exit here, avoids hangs when late parcels are in flight
+                // (those are mainly decref requests).
+                if (stopped_)
+                    return std::shared_ptr<sender>();
+
+                if (!seg)
+                {
+                    seg = get_segment(there, error);
+                }
+
+                if (seg)
+                {
+                    c = seg->claim(here.pid());
+                    if (c)
+                        break;
+
+                    // all channels are in use
+                    error = std::make_error_code(std::errc::no_buffer_space);
+                }
+
+                // wait for a really short amount of time
+                if (hpx::threads::get_self_ptr())
+                {
+                    this_thread::suspend(
+                        hpx::threads::thread_schedule_state::pending,
+                        "connection_handler(shmem)::create_connection");
+                }
+                else
+                {
+                    std::this_thread::sleep_for(
+                        std::chrono::milliseconds(HPX_NETWORK_RETRIES_SLEEP));
+                }
+            }
+        }
+
+        if (!c)
+        {
+            if (tolerate_node_faults())
+                return std::shared_ptr<sender>();
+
+            HPX_THROWS_IF(ec, network_error,
+                "shmem::connection_handler::get_connection",
+                "{} (while trying to connect to: {})", error.message(), l);
+            return std::shared_ptr<sender>();
+        }
+
+        std::shared_ptr<sender> sender_connection = std::make_shared<sender>(
+            HPX_MOVE(seg), c, l, pending_senders_, this);
+
+        if (&ec != &throws)
+            ec = make_success_code();
+
+        return sender_connection;
+    }
+
+    parcelset::locality connection_handler::agas_locality(
+        util::runtime_configuration const& /* ini */) const
+    {
+        // this parcelport can't be used for bootstrapping
+        return parcelset::locality(locality());
+    }
+
+    parcelset::locality connection_handler::create_locality() const
+    {
+        return parcelset::locality(locality());
+    }
+
+    bool connection_handler::background_work(
+        std::size_t num_thread, parcelport_background_mode mode)
+    {
+        if (stopped_ || num_thread >= max_background_thread_)
+        {
+            return false;
+        }
+
+        bool has_work = false;
+        if (mode & parcelport_background_mode_send)
+        {
+            has_work = pending_senders_.background_work();
+        }
+        if (mode & parcelport_background_mode_receive)
+        {
+            has_work = receive() || has_work;
+        }
+        return has_work;
+    }
+
+    bool connection_handler::receive()
+    {
+        bool has_work = false;
+        for (std::unique_ptr<receiver_type> const& r : receivers_)
+        {
+            has_work = r->poll() || has_work;
+        }
+        return has_work;
+    }
+
+    void connection_handler::io_service_work()
+    {
+        std::size_t k = 0;
+
+        // We only execute work on the IO service while HPX is starting
+        while (hpx::is_starting())
+        {
+            bool has_work = pending_senders_.background_work();
+            has_work = receive() || has_work;
+            if (has_work)
+            {
+                k = 0;
+            }
+            else
+            {
+                ++k;
+                util::detail::yield_k(k,
+                    "hpx::parcelset::policies::shmem::connection_handler::"
+                    "io_service_work");
+            }
+        }
+    }
+}    // namespace hpx::parcelset::policies::shmem
+
+#endif
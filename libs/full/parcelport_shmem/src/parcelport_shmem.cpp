@@ -0,0 +1,61 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+#include <hpx/plugin/traits/plugin_config_data.hpp>
+
+#include <hpx/parcelport_shmem/connection_handler.hpp>
+#include <hpx/plugin_factories/parcelport_factory.hpp>
+
+namespace hpx::traits {
+
+    // Inject additional configuration data into the factory registry for this
+    // type. This information ends up in the system wide configuration database
+    // under the plugin specific section:
+    //
+    //      [hpx.parcel.shmem]
+    //      ...
+    //      priority = 200
+    //      max_channels = 32
+    //      ring_size = 1048576
+    //      ...
+    //
+    template <>
+    struct plugin_config_data<
+        hpx::parcelset::policies::shmem::connection_handler>
+    {
+        // preferred over the network parcelports for localities on the same
+        // host
+        static constexpr char const* priority() noexcept
+        {
+            return "200";
+        }
+
+        static constexpr void init(int* /* argc */, char*** /* argv */,
+            util::command_line_handling& /* cfg */) noexcept
+        {
+        }
+
+        static constexpr void destroy() noexcept {}
+
+        static constexpr char const* call() noexcept
+        {
+            return
+                // number of connections other localities can open to this
+                // one at the same time
+                "max_channels = ${HPX_PARCEL_SHMEM_MAX_CHANNELS:32}\n"
+                // size of the ring buffer of every connection
+                "ring_size = ${HPX_PARCEL_SHMEM_RING_SIZE:1048576}\n";
+        }
+    };
+}    // namespace hpx::traits
+
+HPX_REGISTER_PARCELPORT(
+    hpx::parcelset::policies::shmem::connection_handler, shmem)
+
+#endif
@@ -0,0 +1,303 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+#include <hpx/assert.hpp>
+
+#include <hpx/parcelport_shmem/segment.hpp>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <string>
+#include <system_error>
+
+namespace hpx::parcelset::policies::shmem {
+
+    namespace detail {
+
+        // "hpx.shme"
+        constexpr std::uint64_t segment_magic = 0x6870782e73686d65;
+        constexpr std::uint32_t segment_version = 1;
+
+        constexpr std::size_t align(std::size_t size, std::size_t alignment)
+        {
+            return (size + alignment - 1) & ~(alignment - 1);
+        }
+
+        constexpr std::size_t channel_headers_offset()
+        {
+            return align(sizeof(segment_header), alignof(channel_header));
+        }
+
+        std::size_t data_offset(std::size_t num_channels)
+        {
+            std::size_t const page_size =
+                static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+            return align(channel_headers_offset() +
+                    num_channels * sizeof(channel_header),
+                page_size);
+        }
+
+        std::error_code last_error() noexcept
+        {
+            return std::error_code(errno, std::system_category());
+        }
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    std::size_t channel::write(void const* data, std::size_t size) noexcept
+    {
+        std::uint64_t const head =
+            header_->head.load(std::memory_order_relaxed);
+        std::uint64_t const tail =
+            header_->tail.load(std::memory_order_acquire);
+
+        std::size_t const available =
+            size_ - static_cast<std::size_t>(head - tail);
+        std::size_t const count = (std::min)(size, available);
+        if (count == 0)
+        {
+            return 0;
+        }
+
+        std::size_t const offset = static_cast<std::size_t>(head & (size_ - 1));
+        std::size_t const first = (std::min)(count, size_ - offset);
+
+        char const* src = static_cast<char const*>(data);
+        std::memcpy(data_ + offset, src, first);
+        if (first != count)
+        {
+            std::memcpy(data_, src + first, count - first);
+        }
+
+        header_->head.store(head + count, std::memory_order_release);
+        return count;
+    }
+
+    void channel::close() noexcept
+    {
+        header_->state.store(static_cast<std::uint32_t>(channel_state::closed),
+            std::memory_order_release);
+    }
+
+    void channel::release() noexcept
+    {
+        HPX_ASSERT(state() == channel_state::closed && empty());
+
+        header_->head.store(0, std::memory_order_relaxed);
+        header_->tail.store(0, std::memory_order_relaxed);
+        header_->sender_pid = -1;
+        header_->state.store(static_cast<std::uint32_t>(channel_state::free),
+            std::memory_order_release);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    segment::segment(std::string const& name, void* base, std::size_t size,
+        bool owner) noexcept
+      : name_(name)
+      , base_(base)
+      , size_(size)
+      , owner_(owner)
+    {
+    }
+
+    segment::~segment()
+    {
+        ::munmap(base_, size_);
+        if (owner_)
+        {
+            ::shm_unlink(name_.c_str());
+        }
+    }
+
+    std::string segment::name(std::int32_t pid)
+    {
+        return "/hpx.shmem." + std::to_string(pid);
+    }
+
+    std::shared_ptr<segment> segment::create(std::string const& name,
+        std::size_t num_channels, std::size_t channel_size,
+        std::error_code& ec)
+    {
+        HPX_ASSERT(num_channels != 0);
+        HPX_ASSERT(
+            channel_size != 0 && (channel_size & (channel_size - 1)) == 0);
+
+        int fd = ::shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+        if (fd == -1 && errno == EEXIST)
+        {
+            // left behind by a process which wasn't shut down cleanly
+            ::shm_unlink(name.c_str());
+            fd = ::shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+        }
+        if (fd == -1)
+        {
+            ec = detail::last_error();
+            return {};
+        }
+
+        std::size_t const data_offset = detail::data_offset(num_channels);
+        std::size_t const size = data_offset + num_channels * channel_size;
+
+        void* base = MAP_FAILED;
+        if (::ftruncate(fd, static_cast<off_t>(size)) == 0)
+        {
+            base = ::mmap(
+                nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        }
+        if (base == MAP_FAILED)
+        {
+            ec = detail::last_error();
+            ::close(fd);
+            ::shm_unlink(name.c_str());
+            return {};
+        }
+        ::close(fd);
+
+        // the memory is zero initialized, the objects still have to be
+        // constructed
+        auto* header = new (base) detail::segment_header();
+        header->magic = detail::segment_magic;
+        header->version = detail::segment_version;
+        header->num_channels = static_cast<std::uint32_t>(num_channels);
+        header->channel_size = channel_size;
+        header->data_offset = data_offset;
+
+        char* channels =
+            static_cast<char*>(base) + detail::channel_headers_offset();
+        for (std::size_t i = 0; i != num_channels; ++i)
+        {
+            auto* channel = new (channels + i * sizeof(detail::channel_header))
+                detail::channel_header();
+            channel->head.store(0, std::memory_order_relaxed);
+            channel->tail.store(0, std::memory_order_relaxed);
+            channel->state.store(
+                static_cast<std::uint32_t>(channel_state::free),
+                std::memory_order_relaxed);
+            channel->sender_pid = -1;
+        }
+
+        // publish the segment to the other localities
+        header->ready.store(1, std::memory_order_release);
+
+        ec = std::error_code();
+        return std::shared_ptr<segment>(new segment(name, base, size, true));
+    }
+
+    std::shared_ptr<segment> segment::open(
+        std::string const& name, std::error_code& ec)
+    {
+        int fd = ::shm_open(name.c_str(), O_RDWR, 0600);
+        if (fd == -1)
+        {
+            ec = detail::last_error();
+            return {};
+        }
+
+        struct stat st;
+        if (::fstat(fd, &st) == -1)
+        {
+            ec = detail::last_error();
+            ::close(fd);
+            return {};
+        }
+
+        // the owner may not have sized the segment yet
+        std::size_t const size = static_cast<std::size_t>(st.st_size);
+        if (size < detail::data_offset(1))
+        {
+            ec = std::make_error_code(
+                std::errc::resource_unavailable_try_again);
+            ::close(fd);
+            return {};
+        }
+
+        void* base =
+            ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        ::close(fd);
+        if (base == MAP_FAILED)
+        {
+            ec = detail::last_error();
+            return {};
+        }
+
+        std::shared_ptr<segment> result(new segment(name, base, size, false));
+
+        auto* header = result->header();
+        if (header->ready.load(std::memory_order_acquire) == 0)
+        {
+            ec = std::make_error_code(
+                std::errc::resource_unavailable_try_again);
+            return {};
+        }
+
+        if (header->magic != detail::segment_magic ||
+            header->version != detail::segment_version ||
+            header->data_offset != detail::data_offset(header->num_channels) ||
+            size != header->data_offset +
+                    header->num_channels * header->channel_size)
+        {
+            ec = std::make_error_code(std::errc::invalid_argument);
+            return {};
+        }
+
+        ec = std::error_code();
+        return result;
+    }
+
+    channel segment::get_channel(std::size_t i) const noexcept
+    {
+        auto* header = this->header();
+        HPX_ASSERT(i < header->num_channels);
+
+        char* base = static_cast<char*>(base_);
+        auto* channel_header = reinterpret_cast<detail::channel_header*>(
+            base + detail::channel_headers_offset() +
+            i * sizeof(detail::channel_header));
+        char* data = base + header->data_offset + i * header->channel_size;
+
+        return channel(channel_header, data, header->channel_size);
+    }
+
+    channel segment::claim(std::int32_t pid) noexcept
+    {
+        std::size_t const num_channels = this->num_channels();
+        for (std::size_t i = 0; i != num_channels; ++i)
+        {
+            channel c = get_channel(i);
+
+            std::uint32_t expected =
+                static_cast<std::uint32_t>(channel_state::free);
+            if (c.header_->state.compare_exchange_strong(expected,
+                    static_cast<std::uint32_t>(channel_state::claimed),
+                    std::memory_order_acq_rel))
+            {
+                HPX_ASSERT(c.empty());
+                c.header_->sender_pid = pid;
+                c.header_->state.store(
+                    static_cast<std::uint32_t>(channel_state::connected),
+                    std::memory_order_release);
+                return c;
+            }
+        }
+        return channel();
+    }
+}    // namespace hpx::parcelset::policies::shmem
+
+#endif
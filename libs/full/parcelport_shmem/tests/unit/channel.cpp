@@ -0,0 +1,159 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify that the channels of a shared memory segment transfer the written
+// data unchanged and are handed out to one sender at a time.
+
+#include <hpx/config.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/parcelport_shmem/segment.hpp>
+
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <system_error>
+#include <vector>
+
+using hpx::parcelset::policies::shmem::channel;
+using hpx::parcelset::policies::shmem::channel_state;
+using hpx::parcelset::policies::shmem::segment;
+
+constexpr std::size_t num_channels = 4;
+constexpr std::size_t channel_size = 4096;
+
+std::string segment_name()
+{
+    return segment::name(static_cast<std::int32_t>(::getpid())) + ".test";
+}
+
+void test_claim(segment& receiving, segment& sending)
+{
+    std::int32_t const pid = static_cast<std::int32_t>(::getpid());
+
+    // every channel can be claimed once
+    std::vector<channel> channels;
+    for (std::size_t i = 0; i != num_channels; ++i)
+    {
+        channel c = sending.claim(pid);
+        HPX_TEST(static_cast<bool>(c));
+        HPX_TEST(c.state() == channel_state::connected);
+        channels.push_back(c);
+    }
+    HPX_TEST(!sending.claim(pid));
+
+    // a closed channel becomes available once the receiver released it
+    channels[1].close();
+    HPX_TEST(!sending.claim(pid));
+
+    channel c = receiving.get_channel(1);
+    HPX_TEST(c.state() == channel_state::closed);
+    c.release();
+    HPX_TEST(c.state() == channel_state::free);
+
+    HPX_TEST(static_cast<bool>(sending.claim(pid)));
+
+    for (std::size_t i = 0; i != num_channels; ++i)
+    {
+        receiving.get_channel(i).close();
+        receiving.get_channel(i).release();
+    }
+}
+
+void test_write_read(segment& receiving, segment& sending)
+{
+    channel sender = sending.claim(static_cast<std::int32_t>(::getpid()));
+    HPX_TEST(static_cast<bool>(sender));
+
+    channel receiver;
+    for (std::size_t i = 0; i != num_channels; ++i)
+    {
+        if (receiving.get_channel(i).state() == channel_state::connected)
+        {
+            receiver = receiving.get_channel(i);
+        }
+    }
+    HPX_TEST(static_cast<bool>(receiver));
+    HPX_TEST_EQ(receiver.capacity(), channel_size);
+
+    // transfer more data than fits into the ring, in parts which don't
+    // divide its size
+    std::vector<char> data(5 * channel_size + 123);
+    for (std::size_t i = 0; i != data.size(); ++i)
+    {
+        data[i] = static_cast<char>(i * 7);
+    }
+
+    std::vector<char> received;
+    auto append = [&](char const* p, std::size_t size) {
+        received.insert(received.end(), p, p + size);
+    };
+
+    std::size_t written = 0;
+    std::size_t iteration = 0;
+    while (written != data.size())
+    {
+        std::size_t const part =
+            (std::min)(std::size_t(1000), data.size() - written);
+        written += sender.write(data.data() + written, part);
+
+        // let the ring fill up before reading everything
+        if (++iteration % 3 == 0)
+        {
+            receiver.read(append);
+        }
+    }
+
+    receiver.read(append);
+    HPX_TEST(receiver.empty());
+    HPX_TEST(received == data);
+
+    // nothing fits into a full ring
+    std::vector<char> const fill(channel_size + 1);
+    HPX_TEST_EQ(sender.write(fill.data(), fill.size()), channel_size);
+    HPX_TEST_EQ(sender.write(fill.data(), fill.size()), std::size_t(0));
+
+    std::size_t const read = receiver.read([](char const*, std::size_t) {});
+    HPX_TEST_EQ(read, channel_size);
+
+    sender.close();
+    HPX_TEST(receiver.state() == channel_state::closed);
+    receiver.release();
+}
+
+int main()
+{
+    std::error_code ec;
+    std::shared_ptr<segment> receiving =
+        segment::create(segment_name(), num_channels, channel_size, ec);
+    HPX_TEST(!ec);
+    HPX_TEST(receiving != nullptr);
+
+    if (receiving)
+    {
+        std::shared_ptr<segment> sending = segment::open(segment_name(), ec);
+        HPX_TEST(!ec);
+        HPX_TEST(sending != nullptr);
+
+        if (sending)
+        {
+            HPX_TEST_EQ(sending->num_channels(), num_channels);
+
+            test_claim(*receiving, *sending);
+            test_write_read(*receiving, *sending);
+        }
+    }
+
+    // the segment is removed together with its owner
+    receiving.reset();
+    HPX_TEST(segment::open(segment_name(), ec) == nullptr);
+    HPX_TEST(ec == std::errc::no_such_file_or_directory);
+
+    return hpx::util::report_errors();
+}
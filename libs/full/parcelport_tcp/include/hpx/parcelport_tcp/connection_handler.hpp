@@ -114,6 +114,10 @@ namespace hpx::parcelset {
             /// Acceptor used to listen for incoming connections.
             asio::ip::tcp::acceptor* acceptor_;
 
+            /// Send parcels without waiting for an acknowledgment from the
+            /// receiving end (hpx.parcel.tcp.pipelined)
+            bool pipelined_;
+
             /// The list of accepted connections
             mutable hpx::spinlock connections_mtx_;
 
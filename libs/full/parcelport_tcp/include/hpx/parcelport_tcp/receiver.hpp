@@ -22,6 +22,7 @@
 
 #include <hpx/parcelset/decode_parcels.hpp>
 #include <hpx/parcelset/parcelport_connection.hpp>
+#include <hpx/parcelset_base/buffer_pool.hpp>
 #include <hpx/parcelset_base/detail/data_point.hpp>
 #include <hpx/parcelset_base/detail/gatherer.hpp>
 
@@ -56,10 +57,11 @@ namespace hpx::parcelset::policies::tcp {
     {
     public:
         receiver(asio::io_context& io_service, std::uint64_t max_inbound_size,
-            connection_handler& parcelport)
+            connection_handler& parcelport, bool pipelined = false)
           : socket_(io_service)
           , max_inbound_size_(max_inbound_size)
           , ack_(0)
+          , pipelined_(pipelined)
           , parcelport_(parcelport)
           , mtx_()
           , operation_in_flight_(0)
@@ -206,7 +208,7 @@ namespace hpx::parcelset::policies::tcp {
                         chunks.size() * sizeof(transmission_chunk_type)));
 
                     // add main buffer holding data which was serialized normally
-                    buffer_.data_.resize(
+                    buffer_.data_ = buffer_pool::instance().get(
                         static_cast<std::size_t>(inbound_size));
                     buffers.push_back(asio::buffer(buffer_.data_));
 
@@ -216,7 +218,7 @@ namespace hpx::parcelset::policies::tcp {
                 else
                 {
                     // add main buffer holding data which was serialized normally
-                    buffer_.data_.resize(
+                    buffer_.data_ = buffer_pool::instance().get(
                         static_cast<std::size_t>(inbound_size));
                     buffers.push_back(asio::buffer(buffer_.data_));
 
@@ -276,9 +278,8 @@ namespace hpx::parcelset::policies::tcp {
                 {
                     std::size_t chunk_size = static_cast<std::size_t>(
                         buffer_.transmission_chunks_[i].second);
-                    buffer_.chunks_[i].resize(chunk_size);
-                    buffers.push_back(
-                        asio::buffer(buffer_.chunks_[i].data(), chunk_size));
+                    buffers.push_back(asio::buffer(
+                        get_chunk_receive_address(buffer_, i), chunk_size));
                 }
 
                 // Start an asynchronous call to receive the data.
@@ -330,14 +331,22 @@ namespace hpx::parcelset::policies::tcp {
                 buffer_.data_point_.time_ =
                     timer_.elapsed_nanoseconds() - buffer_.data_point_.time_;
 #endif
-                // now send acknowledgment byte
-                void (receiver::*f)(std::error_code const&, Handler) =
-                    &receiver::handle_write_ack<Handler>;
-
                 // decode the received parcels.
                 decode_parcels(parcelport_, HPX_MOVE(buffer_), std::size_t(-1));
                 buffer_ = parcel_buffer_type();
 
+                // in pipelined mode the sender does not wait for an
+                // acknowledgment, directly read the next parcel
+                if (pipelined_)
+                {
+                    handle_write_ack(std::error_code(), handler);
+                    return;
+                }
+
+                // now send acknowledgment byte
+                void (receiver::*f)(std::error_code const&, Handler) =
+                    &receiver::handle_write_ack<Handler>;
+
                 ack_ = true;
                 {
                     std::unique_lock lk(mtx_);
@@ -382,6 +391,7 @@ namespace hpx::parcelset::policies::tcp {
         std::uint64_t max_inbound_size_;
 
         bool ack_;
+        bool pipelined_;
 
         // The handler used to process the incoming request.
         connection_handler& parcelport_;
@@ -56,10 +56,14 @@ namespace hpx::parcelset::policies::tcp {
 
     public:
         // Construct a sending parcelport_connection with the given io_context.
+        // In pipelined mode the receiver does not acknowledge the parcels,
+        // the connection can be reused as soon as the data was written.
         sender(asio::io_context& io_service,
-            parcelset::locality const& locality_id, parcelset::parcelport* pp)
+            parcelset::locality const& locality_id, parcelset::parcelport* pp,
+            bool pipelined = false)
           : socket_(io_service)
           , ack_(0)
+          , pipelined_(pipelined)
           , there_(locality_id)
 #if defined(HPX_HAVE_PARCELPORT_COUNTERS)
           , pp_(pp)
@@ -241,6 +245,14 @@ namespace hpx::parcelset::policies::tcp {
             pp_->add_sent_data(buffer_.data_point_);
 #endif
 
+            // the parcels are delimited by their headers only, there is no
+            // acknowledgment to wait for
+            if (pipelined_)
+            {
+                handle_read_ack(e);
+                return;
+            }
+
             // now handle the acknowledgment byte which is sent by the receiver
 #if defined(__linux) || defined(linux) || defined(__linux__)
             asio::detail::socket_option::boolean<IPPROTO_TCP, TCP_QUICKACK>
@@ -276,6 +288,7 @@ namespace hpx::parcelset::policies::tcp {
         asio::ip::tcp::socket socket_;
 
         bool ack_;
+        bool pipelined_;
 
         // the other (receiving) end of this connection
         parcelset::locality there_;
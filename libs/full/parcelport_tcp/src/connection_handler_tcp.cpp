@@ -64,6 +64,8 @@ namespace hpx::parcelset::policies::tcp {
         threads::policies::callback_notifier const& notifier)
       : base_type(ini, parcelport_address(ini), notifier)
       , acceptor_(nullptr)
+      , pipelined_(hpx::util::get_entry_as<int>(
+                       ini, "hpx.parcel.tcp.pipelined", 0) != 0)
     {
         if (here_.type() != std::string("tcp"))
         {
@@ -96,8 +98,9 @@ namespace hpx::parcelset::policies::tcp {
         {
             try
             {
-                std::shared_ptr<receiver> receiver_conn(new receiver(
-                    io_service, get_max_inbound_message_size(), *this));
+                std::shared_ptr<receiver> receiver_conn(
+                    new receiver(io_service, get_max_inbound_message_size(),
+                        *this, pipelined_));
 
                 tcp::endpoint ep = *it;
                 acceptor_->open(ep.protocol());
@@ -157,7 +160,7 @@ namespace hpx::parcelset::policies::tcp {
         // The parcel gets serialized inside the connection constructor, no
         // need to keep the original parcel alive after this call returned.
         std::shared_ptr<sender> sender_connection(
-            new sender(io_service, l, this));
+            new sender(io_service, l, this, pipelined_));
 
         // Connect to the target locality, retry if needed
         std::error_code error = asio::error::try_again;
@@ -227,7 +230,10 @@ namespace hpx::parcelset::policies::tcp {
         asio::ip::tcp::socket& s = sender_connection->socket();
 
         s.set_option(asio::ip::tcp::no_delay(true));
-        s.set_option(asio::socket_base::linger(true, 0));
+
+        // in pipelined mode parcels may still be in the send buffer when
+        // the connection is closed, those must not be discarded
+        s.set_option(asio::socket_base::linger(!pipelined_, 0));
 
 #if defined(HPX_HOLDON_TO_OUTGOING_CONNECTIONS)
         {
@@ -286,8 +292,8 @@ namespace hpx::parcelset::policies::tcp {
             std::shared_ptr<receiver> c(receiver_conn);
 
             asio::io_context& io_service = io_service_pool_.get_io_service();
-            receiver_conn.reset(new receiver(
-                io_service, get_max_inbound_message_size(), *this));
+            receiver_conn.reset(new receiver(io_service,
+                get_max_inbound_message_size(), *this, pipelined_));
             acceptor_->async_accept(receiver_conn->socket(),
                 hpx::bind(&connection_handler::handle_accept, this,
                     placeholders::_1, receiver_conn));
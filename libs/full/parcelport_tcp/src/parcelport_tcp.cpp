@@ -21,6 +21,7 @@ namespace hpx::traits {
     //      [hpx.parcel.tcp]
     //      ...
     //      priority = 1
+    //      pipelined = 0
     //
     template <>
     struct plugin_config_data<hpx::parcelset::policies::tcp::connection_handler>
@@ -39,7 +40,10 @@ namespace hpx::traits {
 
         static constexpr char const* call() noexcept
         {
-            return "";
+            // Send the parcels without acknowledgment, the connection can
+            // be reused as soon as a parcel was written. This has to be set
+            // consistently for all localities.
+            return "pipelined = ${HPX_PARCEL_TCP_PIPELINED:0}\n";
         }
     };
 }    // namespace hpx::traits
@@ -25,6 +25,7 @@
 #include <hpx/modules/synchronization.hpp>
 #include <hpx/modules/util.hpp>
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
 #include <deque>
@@ -34,17 +35,35 @@
 #include <mutex>
 #include <stdexcept>
 #include <string>
+#include <type_traits>
 #include <utility>
+#include <vector>
 
 ///////////////////////////////////////////////////////////////////////////////
 namespace hpx { namespace util {
 
+    namespace detail {
+
+        template <typename Key, typename Enable = void>
+        struct has_connection_cache_hash : std::false_type
+        {
+        };
+
+        template <typename Key>
+        struct has_connection_cache_hash<Key,
+            std::void_t<decltype(std::declval<Key const&>().hash())>>
+          : std::true_type
+        {
+        };
+    }    // namespace detail
+
     ///////////////////////////////////////////////////////////////////////////
     /// This class implements an LRU cache to hold connections. It includes
-    /// entries checked out from the cache in its cache size.
+    /// entries checked out from the cache in its cache size. It is used for
+    /// one shard of a \a connection_cache.
     // TODO: investigate usage of boost.cache.
     template <typename Connection, typename Key>
-    class connection_cache
+    class connection_cache_shard
     {
     public:
         using mutex_type = hpx::spinlock;
@@ -62,32 +81,17 @@ namespace hpx { namespace util {
         using cache_type = std::map<key_type, cache_value_type>;
         using size_type = typename cache_type::size_type;
 
-        connection_cache(
+        connection_cache_shard(
             size_type max_connections, size_type max_connections_per_locality)
-          : max_connections_(max_connections < 2 ? 2 : max_connections)
-          , max_connections_per_locality_(max_connections_per_locality < 2 ?
-                    2 :
-                    max_connections_per_locality)
+          : max_connections_(max_connections)
+          , max_connections_per_locality_(max_connections_per_locality)
           , connections_(0)
-          , shutting_down_(false)
           , insertions_(0)
           , evictions_(0)
           , hits_(0)
           , misses_(0)
           , reclaims_(0)
         {
-            if (max_connections_per_locality_ > max_connections_)
-            {
-                HPX_THROW_EXCEPTION(bad_parameter,
-                    "connection_cache::connection_cache",
-                    "the maximum number of connections per locality cannot "
-                    "exceed the overall maximum number of connections");
-            }
-        }
-
-        void shutdown()
-        {
-            shutting_down_ = true;
         }
 
     private:
@@ -484,7 +488,10 @@ namespace hpx { namespace util {
 
                 // the connection itself will go out of scope on return
 #if defined(HPX_TRACK_STATE_OF_OUTGOING_TCP_CONNECTION)
-                conn->set_state(Connection::state_deleting);
+                if (conn)
+                {
+                    conn->set_state(Connection::state_deleting);
+                }
 #else
                 HPX_UNUSED(conn);
 #endif
@@ -493,6 +500,13 @@ namespace hpx { namespace util {
             check_invariants();
         }
 
+        /// Returns the overall number of connections held by this shard.
+        size_type size() const
+        {
+            std::lock_guard<mutex_type> lock(mtx_);
+            return connections_;
+        }
+
         // access statistics
         std::int64_t get_cache_insertions(bool reset)
         {
@@ -629,7 +643,6 @@ namespace hpx { namespace util {
         key_tracker_type key_tracker_;
         cache_type cache_;
         size_type connections_;
-        bool shutting_down_;
 
         // statistics support
         std::int64_t insertions_;
@@ -638,6 +651,209 @@ namespace hpx { namespace util {
         std::int64_t misses_;
         std::int64_t reclaims_;
     };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// This class implements a cache to hold connections. It includes entries
+    /// checked out from the cache in its cache size.
+    ///
+    /// The destinations are distributed over independent shards (depending
+    /// on the hash value of the key, if the key type provides one), each
+    /// with its own lock and LRU list. Threads sending to different
+    /// destinations therefore rarely contend for the same lock. Every shard
+    /// holds an equal part of the overall maximum number of connections.
+    template <typename Connection, typename Key>
+    class connection_cache
+    {
+        using shard_type = connection_cache_shard<Connection, Key>;
+
+    public:
+        using mutex_type = typename shard_type::mutex_type;
+
+        using connection_type = typename shard_type::connection_type;
+        using key_type = Key;
+        using size_type = typename shard_type::size_type;
+
+        connection_cache(size_type max_connections,
+            size_type max_connections_per_locality, size_type num_shards = 16)
+          : max_connections_(max_connections < 2 ? 2 : max_connections)
+          , max_connections_per_locality_(max_connections_per_locality < 2 ?
+                    2 :
+                    max_connections_per_locality)
+          , shutting_down_(false)
+        {
+            if (max_connections_per_locality_ > max_connections_)
+            {
+                HPX_THROW_EXCEPTION(bad_parameter,
+                    "connection_cache::connection_cache",
+                    "the maximum number of connections per locality cannot "
+                    "exceed the overall maximum number of connections");
+            }
+
+            // every shard has to be able to hold the maximum number of
+            // connections to one locality
+            if (!detail::has_connection_cache_hash<key_type>::value)
+            {
+                num_shards = 1;
+            }
+            num_shards = (std::max)(size_type(1),
+                (std::min)(num_shards,
+                    max_connections_ / max_connections_per_locality_));
+
+            size_type const max_connections_per_shard =
+                max_connections_ / num_shards;
+
+            shards_.reserve(num_shards);
+            for (size_type i = 0; i != num_shards; ++i)
+            {
+                shards_.push_back(std::make_unique<shard_type>(
+                    max_connections_per_shard, max_connections_per_locality_));
+            }
+        }
+
+        void shutdown()
+        {
+            shutting_down_ = true;
+        }
+
+        /// Returns the number of shards the destinations are distributed over.
+        size_type num_shards() const noexcept
+        {
+            return shards_.size();
+        }
+
+        /// Try to get a connection to \a l from the cache.
+        ///
+        /// \returns A usable connection to \a l if a connection could be
+        ///          found, otherwise a default constructed connection.
+        ///
+        /// \note    The connection must be returned to the cache by calling
+        ///          \a reclaim().
+        connection_type get(key_type const& l)
+        {
+            return shard(l).get(l);
+        }
+
+        /// Try to get a connection to \a l from the cache, or reserve space for
+        /// a new connection to \a l. This function may evict entries from the
+        /// cache (of the shard \a l belongs to).
+        ///
+        /// \see connection_cache_shard::get_or_reserve
+        bool get_or_reserve(
+            key_type const& l, connection_type& conn, bool force_insert = false)
+        {
+            return shard(l).get_or_reserve(l, conn, force_insert);
+        }
+
+        /// Returns a connection for \a l to the cache.
+        ///
+        /// \note The cache must already be aware of the connection, through
+        ///       a prior call to \a get() or \a get_or_reserve().
+        void reclaim(key_type const& l, connection_type const& conn)
+        {
+            shard(l).reclaim(l, conn);
+        }
+
+        /// Returns true if the overall connection count is equal to or larger
+        /// than the maximum number of overall connections, and false otherwise.
+        bool full() const
+        {
+            size_type connections = 0;
+            for (auto const& s : shards_)
+            {
+                connections += s->size();
+            }
+            return connections >= max_connections_;
+        }
+
+        /// Returns true if the connection count for \a l is equal to or larger
+        /// than the maximum connection count per locality, and false otherwise.
+        bool full(key_type const& l) const
+        {
+            return shard(l).full(l);
+        }
+
+        /// Destroys all connections in the cache, and resets all counts.
+        ///
+        /// \note Calling this function while connections are still checked out
+        ///       of the cache is a bad idea, and will violate this class'
+        ///       invariants.
+        void clear()
+        {
+            for (auto& s : shards_)
+            {
+                s->clear();
+            }
+        }
+
+        /// Destroys all connections for the given locality in the cache, reset
+        /// all associated counts.
+        void clear(key_type const& l)
+        {
+            shard(l).clear(l);
+        }
+
+        /// Destroys all connections for the given locality in the cache, reset
+        /// all associated counts.
+        void clear(key_type const& l, connection_type const& conn)
+        {
+            shard(l).clear(l, conn);
+        }
+
+        // access statistics
+        std::int64_t get_cache_insertions(bool reset)
+        {
+            return accumulate(&shard_type::get_cache_insertions, reset);
+        }
+
+        std::int64_t get_cache_evictions(bool reset)
+        {
+            return accumulate(&shard_type::get_cache_evictions, reset);
+        }
+
+        std::int64_t get_cache_hits(bool reset)
+        {
+            return accumulate(&shard_type::get_cache_hits, reset);
+        }
+
+        std::int64_t get_cache_misses(bool reset)
+        {
+            return accumulate(&shard_type::get_cache_misses, reset);
+        }
+
+        std::int64_t get_cache_reclaims(bool reset)
+        {
+            return accumulate(&shard_type::get_cache_reclaims, reset);
+        }
+
+    private:
+        shard_type& shard(key_type const& l) const
+        {
+            if constexpr (detail::has_connection_cache_hash<key_type>::value)
+            {
+                return *shards_[l.hash() % shards_.size()];
+            }
+            else
+            {
+                return *shards_[0];
+            }
+        }
+
+        std::int64_t accumulate(
+            std::int64_t (shard_type::*f)(bool), bool reset)
+        {
+            std::int64_t result = 0;
+            for (auto& s : shards_)
+            {
+                result += ((*s).*f)(reset);
+            }
+            return result;
+        }
+
+        size_type const max_connections_;
+        size_type const max_connections_per_locality_;
+        std::vector<std::unique_ptr<shard_type>> shards_;
+        bool shutting_down_;
+    };
 }}    // namespace hpx::util
 
 #endif
@@ -17,12 +17,18 @@
 #include <hpx/modules/runtime_local.hpp>
 #include <hpx/modules/serialization.hpp>
 #include <hpx/modules/timing.hpp>
+#include <hpx/serialization/detail/allocation_arena.hpp>
+#include <hpx/serialization/detail/retained_buffer.hpp>
 
 #include <hpx/components_base/agas_interface.hpp>
 #include <hpx/naming_base/id_type.hpp>
+#include <hpx/parcelset/detail/parcel_stripes.hpp>
+#include <hpx/parcelset/parcel_buffer.hpp>
+#include <hpx/parcelset_base/buffer_pool.hpp>
 #include <hpx/parcelset_base/detail/data_point.hpp>
 #include <hpx/parcelset_base/detail/parcel_route_handler.hpp>
 #include <hpx/parcelset_base/parcel_interface.hpp>
+#include <hpx/parcelset_base/receive_buffers.hpp>
 
 #if ASIO_HAS_BOOST_THROW_EXCEPTION != 0
 #include <boost/exception/exception.hpp>
@@ -32,7 +38,9 @@
 #include <cstdint>
 #include <exception>
 #include <functional>
+#include <memory>
 #include <system_error>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -56,11 +64,12 @@ namespace hpx::parcelset {
         data.num_zchunks_per_msg_max_ =
             (std::max)(data.num_zchunks_per_msg_max_,
                 (std::int64_t) buffer.chunks_.size());
-        for (auto& chunk : buffer.chunks_)
+        for (std::size_t i = 0; i != num_zero_copy_chunks; ++i)
         {
-            data.size_zchunks_total_ += chunk.size();
-            data.size_zchunks_max_ =
-                (std::max)(data.size_zchunks_max_, (std::int64_t) chunk.size());
+            std::int64_t const size = static_cast<std::int64_t>(
+                buffer.transmission_chunks_[i].second);
+            data.size_zchunks_total_ += size;
+            data.size_zchunks_max_ = (std::max)(data.size_zchunks_max_, size);
         }
 #endif
 
@@ -76,11 +85,20 @@ namespace hpx::parcelset {
             for (std::size_t i = 0; i != num_zero_copy_chunks; ++i)
             {
                 transmission_chunk_type& c = buffer.transmission_chunks_[i];
-                std::size_t first = static_cast<std::size_t>(
+                std::size_t first = detail::decode_chunk_index(
                     static_cast<std::uint64_t>(c.first));
                 std::size_t second = static_cast<std::size_t>(
                     static_cast<std::uint64_t>(c.second));
 
+                // the chunk may have been received into registered memory
+                if (i < buffer.chunk_targets_.size() &&
+                    buffer.chunk_targets_[i] != nullptr)
+                {
+                    chunks[first] = serialization::create_pointer_chunk(
+                        buffer.chunk_targets_[i], second);
+                    continue;
+                }
+
                 HPX_ASSERT(buffer.chunks_[i].size() == second);
 
                 chunks[first] = serialization::create_pointer_chunk(
@@ -119,13 +137,80 @@ namespace hpx::parcelset {
         return chunks;
     }
 
+    // Prepare receiving the zero-copy chunk i of the given buffer, returns
+    // the address the chunk data has to be received into. This is the memory
+    // registered for the key the chunk was sent with, if any. Calling this
+    // again for the same chunk returns the same address.
+    template <typename Buffer>
+    char* get_chunk_receive_address(Buffer& buffer, std::size_t i)
+    {
+        auto const& c = buffer.transmission_chunks_[i];
+        std::size_t const size = static_cast<std::size_t>(c.second);
+
+        if (i < buffer.chunk_targets_.size() &&
+            buffer.chunk_targets_[i] != nullptr)
+        {
+            return static_cast<char*>(buffer.chunk_targets_[i]);
+        }
+        if (size != 0 && buffer.chunks_[i].size() == size)
+        {
+            return buffer.chunks_[i].data();
+        }
+
+        std::uint32_t const key =
+            detail::decode_chunk_key(static_cast<std::uint64_t>(c.first));
+        if (key != 0)
+        {
+            if (void* data = detail::claim_receive_buffer(key, size))
+            {
+                if (buffer.chunk_targets_.size() <= i)
+                {
+                    buffer.chunk_targets_.resize(buffer.chunks_.size());
+                }
+                buffer.chunk_targets_[i] = data;
+                buffer.chunks_[i].clear();
+                return static_cast<char*>(data);
+            }
+        }
+
+        buffer.chunks_[i] = buffer_pool::instance().get(size);
+        return buffer.chunks_[i].data();
+    }
+
+    // Hand the buffers of a decoded message back to the buffer pool
+    template <typename Buffer>
+    void release_buffers(Buffer& buffer)
+    {
+        using data_type = std::decay_t<decltype(buffer.data_)>;
+        using chunk_type =
+            typename std::decay_t<decltype(buffer.chunks_)>::value_type;
+
+        if constexpr (std::is_same_v<data_type, buffer_pool::buffer_type>)
+        {
+            buffer_pool::instance().put(HPX_MOVE(buffer.data_));
+        }
+        if constexpr (std::is_same_v<chunk_type, buffer_pool::buffer_type>)
+        {
+            for (auto& c : buffer.chunks_)
+            {
+                buffer_pool::instance().put(HPX_MOVE(c));
+            }
+        }
+    }
+
     ///////////////////////////////////////////////////////////////////////////
+    // If retain_buffer is set, the actions may refer to the received data
+    // (see serialization::string_view_arg) instead of copying it, which
+    // requires for the chunks to refer to memory owned by the buffer.
     template <typename Parcelport, typename Buffer>
-    void decode_message_with_chunks(Parcelport& pp, Buffer buffer,
+    void decode_message_with_chunks(Parcelport& pp, Buffer received,
         std::size_t parcel_count,
         std::vector<serialization::serialization_chunk>& chunks,
-        std::size_t num_thread = -1)
+        std::size_t num_thread = -1, bool retain_buffer = false)
     {
+        auto retained = std::make_shared<Buffer>(HPX_MOVE(received));
+        Buffer& buffer = *retained;
+
         std::size_t inbound_data_size = static_cast<std::size_t>(
             static_cast<std::uint64_t>(buffer.data_size_));
 
@@ -145,6 +230,21 @@ namespace hpx::parcelset {
                     // De-serialize the parcel data
                     serialization::input_archive archive(
                         buffer.data_, inbound_data_size, &chunks);
+                    if (retain_buffer)
+                    {
+                        auto& owner = archive.get_extra_data<
+                            serialization::detail::retained_buffer>();
+                        owner.set_owner(retained);
+                    }
+
+                    if (std::size_t const block_size =
+                            pp.get_arena_block_size();
+                        block_size != 0)
+                    {
+                        auto& arena = archive.get_extra_data<
+                            serialization::detail::pointer_arena>();
+                        arena.enable(block_size);
+                    }
 
                     if (parcel_count == 0)
                     {
@@ -273,6 +373,13 @@ namespace hpx::parcelset {
                     }
                 }
 
+                // all parcels were de-serialized, the buffers can be reused
+                // unless they are referred to by any of the actions
+                if (retained.use_count() == 1)
+                {
+                    release_buffers(buffer);
+                }
+
                 // store the time required for serialization
 #if defined(HPX_HAVE_PARCELPORT_COUNTERS)
                 data.serialization_time_ =
@@ -320,12 +427,69 @@ namespace hpx::parcelset {
     ///////////////////////////////////////////////////////////////////////////
     template <typename Parcelport, typename Buffer>
     void decode_message(Parcelport& pp, Buffer buffer, std::size_t parcel_count,
-        std::size_t num_thread = -1)
+        std::size_t num_thread = -1);
+
+    // Hand a received stripe of a larger message to the parcelport, the
+    // message is decoded once all of its stripes have been received
+    template <typename Parcelport, typename Buffer>
+    void decode_stripe(Parcelport& pp, Buffer buffer, std::size_t num_thread)
+    {
+        using stripe_buffer_type = detail::parcel_stripes::buffer_type;
+
+        // protect from unhandled exceptions bubbling up
+        try
+        {
+            std::vector<std::vector<char>> pieces;
+            pieces.reserve(buffer.chunks_.size());
+            for (auto& c : buffer.chunks_)
+            {
+                if constexpr (std::is_same_v<std::decay_t<decltype(c)>,
+                                  std::vector<char>>)
+                {
+                    pieces.push_back(HPX_MOVE(c));
+                }
+                else
+                {
+                    pieces.emplace_back(c.data(), c.data() + c.size());
+                }
+            }
+
+            stripe_buffer_type message;
+            if (!pp.get_parcel_stripes().add(
+                    reinterpret_cast<char const*>(buffer.data_.data()),
+                    buffer.data_.size(), HPX_MOVE(pieces), message))
+            {
+                return;
+            }
+
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+            message.data_point_.bytes_ =
+                static_cast<std::size_t>(message.size_);
+#endif
+            decode_message(pp, HPX_MOVE(message), 0, num_thread);
+        }
+        catch (...)
+        {
+            LPT_(error).format("decode_stripe: caught exception.");
+            hpx::report_error(std::current_exception());
+        }
+    }
+
+    template <typename Parcelport, typename Buffer>
+    void decode_message(Parcelport& pp, Buffer buffer, std::size_t parcel_count,
+        std::size_t num_thread)
     {
+        // stripes carry a descriptor instead of serialized parcels
+        if (parcel_count == 0 && detail::is_stripe(buffer))
+        {
+            decode_stripe(pp, HPX_MOVE(buffer), num_thread);
+            return;
+        }
+
         std::vector<serialization::serialization_chunk> chunks(
             decode_chunks(buffer));
         decode_message_with_chunks(
-            pp, HPX_MOVE(buffer), parcel_count, chunks, num_thread);
+            pp, HPX_MOVE(buffer), parcel_count, chunks, num_thread, true);
     }
 
     template <typename Parcelport, typename Buffer>
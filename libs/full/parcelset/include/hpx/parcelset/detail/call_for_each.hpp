@@ -13,9 +13,11 @@
 #include <hpx/assert.hpp>
 #include <hpx/modules/errors.hpp>
 
+#include <hpx/parcelset_base/parcel_flight_recorder.hpp>
 #include <hpx/parcelset_base/parcelport.hpp>
 
 #include <cstddef>
+#include <cstdint>
 #include <system_error>
 #include <utility>
 #include <vector>
@@ -30,10 +32,17 @@ namespace hpx::parcelset::detail {
 
         handlers_type handlers_;
         parcels_type parcels_;
+#if defined(HPX_HAVE_PARCEL_PROFILING)
+        // the time the parcels were encoded, if they are being recorded
+        std::uint64_t encoded_;
+#endif
 
         call_for_each(handlers_type&& handlers, parcels_type&& parcels) noexcept
           : handlers_(HPX_MOVE(handlers))
           , parcels_(HPX_MOVE(parcels))
+#if defined(HPX_HAVE_PARCEL_PROFILING)
+          , encoded_(parcel_flight_begin())
+#endif
         {
         }
 
@@ -43,8 +52,20 @@ namespace hpx::parcelset::detail {
         void operator()(std::error_code const& e)
         {
             HPX_ASSERT(parcels_.size() == handlers_.size());
+#if defined(HPX_HAVE_PARCEL_PROFILING)
+            std::uint64_t const written =
+                encoded_ != 0 && !e ? parcel_flight_begin() : 0;
+#endif
             for (std::size_t i = 0; i < parcels_.size(); ++i)
             {
+#if defined(HPX_HAVE_PARCEL_PROFILING)
+                if (written != 0)
+                {
+                    record_parcel_stage(parcels_[i].get_action_name(),
+                        parcels_[i].parcel_id(), parcel_stage::wire, encoded_,
+                        written);
+                }
+#endif
                 handlers_[i](e, parcels_[i]);
                 handlers_[i].reset();
             }
@@ -0,0 +1,304 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING)
+#include <hpx/assert.hpp>
+#include <hpx/modules/serialization.hpp>
+#include <hpx/synchronization/spinlock.hpp>
+
+#include <hpx/parcelset/parcel_buffer.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <map>
+#include <mutex>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx::parcelset::detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Large messages can be split into stripes which are sent over several
+    // connections to the same destination concurrently. Each stripe is a
+    // regular message whose main buffer holds a stripe descriptor instead of
+    // serialized parcels, and whose zero-copy chunks are pieces of the data
+    // of the original message. The descriptor is stored in native byte order:
+    //
+    //      std::uint64_t magic
+    //      std::uint64_t message_id
+    //      std::uint32_t source            (locality id of the sender)
+    //      std::uint32_t stripe
+    //      std::uint32_t num_stripes
+    //      std::uint32_t num_pieces
+    //      stripe 0 only:
+    //          std::uint64_t size, data_size
+    //          std::uint32_t num_zero_copy_chunks, num_non_zero_copy_chunks
+    //          transmission chunks of the original message
+    //      num_pieces times:
+    //          std::uint64_t chunk, offset, size
+    //
+    // A piece refers to the zero-copy chunk 'chunk' of the original message,
+    // or to its main buffer if 'chunk' is stripe_data_chunk.
+    inline constexpr std::uint64_t stripe_magic = 0x5345504952545350ull;
+    inline constexpr std::uint64_t stripe_data_chunk = ~std::uint64_t(0);
+
+    // Serialized parcels start with the endianness marker of the archive,
+    // which is never equal to the stripe magic.
+    template <typename Buffer>
+    bool is_stripe(Buffer const& buffer) noexcept
+    {
+        std::uint64_t magic = 0;
+        if (buffer.data_.size() < sizeof(magic))
+        {
+            return false;
+        }
+        std::memcpy(&magic, buffer.data_.data(), sizeof(magic));
+        return magic == stripe_magic;
+    }
+
+    template <typename T>
+    void append_stripe_descriptor(std::vector<char>& descriptor, T value)
+    {
+        char const* p = reinterpret_cast<char const*>(&value);
+        descriptor.insert(descriptor.end(), p, p + sizeof(T));
+    }
+
+    // Return the overall size of the zero-copy chunks of the given message
+    template <typename Buffer>
+    std::uint64_t zero_copy_size(Buffer const& buffer) noexcept
+    {
+        std::uint64_t size = 0;
+        std::size_t const num_zero_copy_chunks =
+            static_cast<std::size_t>(buffer.num_chunks_.first);
+        for (std::size_t i = 0; i != num_zero_copy_chunks; ++i)
+        {
+            size += buffer.transmission_chunks_[i].second;
+        }
+        return size;
+    }
+
+    // Split an encoded message into at most num_stripes stripes of similar
+    // size. The stripes refer to the memory of the original message, which
+    // has to be kept alive until all stripes have been sent.
+    template <typename Buffer>
+    std::vector<Buffer> split_into_stripes(Buffer const& buffer,
+        std::size_t num_stripes, std::uint32_t source,
+        std::uint64_t message_id)
+    {
+        struct piece
+        {
+            std::uint64_t chunk;
+            std::uint64_t offset;
+            std::uint64_t size;
+            char const* data;
+        };
+
+        HPX_ASSERT(num_stripes > 1);
+
+        std::uint64_t const total =
+            buffer.data_.size() + zero_copy_size(buffer);
+        std::uint64_t const per_stripe =
+            (total + num_stripes - 1) / num_stripes;
+
+        // the main buffer is always carried by the first stripe
+        std::vector<std::vector<piece>> pieces(1);
+        pieces[0].push_back(piece{stripe_data_chunk, 0, buffer.data_.size(),
+            reinterpret_cast<char const*>(buffer.data_.data())});
+        std::uint64_t load = buffer.data_.size();
+
+        std::uint64_t chunk = 0;
+        for (serialization::serialization_chunk const& c : buffer.chunks_)
+        {
+            if (c.type_ != serialization::chunk_type::chunk_type_pointer)
+            {
+                continue;
+            }
+
+            char const* data = static_cast<char const*>(c.data_.cpos_);
+            std::uint64_t offset = 0;
+            while (offset != c.size_)
+            {
+                if (load >= per_stripe && pieces.size() != num_stripes)
+                {
+                    pieces.emplace_back();
+                    load = 0;
+                }
+
+                std::uint64_t size = c.size_ - offset;
+                if (pieces.size() != num_stripes)
+                {
+                    size = (std::min)(size, per_stripe - load);
+                }
+
+                pieces.back().push_back(
+                    piece{chunk, offset, size, data + offset});
+                offset += size;
+                load += size;
+            }
+            ++chunk;
+        }
+
+        std::vector<Buffer> stripes(pieces.size());
+        for (std::size_t i = 0; i != pieces.size(); ++i)
+        {
+            std::vector<char> descriptor;
+            append_stripe_descriptor(descriptor, stripe_magic);
+            append_stripe_descriptor(descriptor, message_id);
+            append_stripe_descriptor(descriptor, source);
+            append_stripe_descriptor(descriptor, std::uint32_t(i));
+            append_stripe_descriptor(
+                descriptor, static_cast<std::uint32_t>(pieces.size()));
+            append_stripe_descriptor(
+                descriptor, static_cast<std::uint32_t>(pieces[i].size()));
+
+            if (i == 0)
+            {
+                append_stripe_descriptor(descriptor, buffer.size_);
+                append_stripe_descriptor(descriptor, buffer.data_size_);
+                append_stripe_descriptor(descriptor, buffer.num_chunks_.first);
+                append_stripe_descriptor(descriptor, buffer.num_chunks_.second);
+                for (auto const& tc : buffer.transmission_chunks_)
+                {
+                    append_stripe_descriptor(descriptor, tc.first);
+                    append_stripe_descriptor(descriptor, tc.second);
+                }
+            }
+
+            // all chunks of a stripe are zero-copy chunks
+            Buffer& stripe = stripes[i];
+            stripe.chunks_.reserve(pieces[i].size());
+            stripe.transmission_chunks_.reserve(pieces[i].size());
+            for (piece const& p : pieces[i])
+            {
+                append_stripe_descriptor(descriptor, p.chunk);
+                append_stripe_descriptor(descriptor, p.offset);
+                append_stripe_descriptor(descriptor, p.size);
+
+                stripe.transmission_chunks_.emplace_back(
+                    stripe.chunks_.size(), p.size);
+                stripe.chunks_.push_back(serialization::create_pointer_chunk(
+                    p.data, static_cast<std::size_t>(p.size)));
+            }
+
+            stripe.data_.assign(descriptor.begin(), descriptor.end());
+            stripe.size_ = stripe.data_.size();
+            stripe.data_size_ = stripe.data_.size();
+            stripe.num_chunks_ = typename Buffer::count_chunks_type(
+                static_cast<std::uint32_t>(stripe.chunks_.size()), 0);
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+            stripe.data_point_.bytes_ = stripe.data_.size();
+            stripe.data_point_.raw_bytes_ = stripe.data_.size();
+#endif
+        }
+        return stripes;
+    }
+
+    // Keeps the original message and the write handler alive until all
+    // stripes of the message have been sent
+    template <typename Buffer, typename Handler>
+    struct striped_write
+    {
+        striped_write(Buffer&& buffer, Handler&& handler) noexcept
+          : buffer_(HPX_MOVE(buffer))
+          , handler_(HPX_MOVE(handler))
+          , count_(0)
+        {
+        }
+
+        void done(std::error_code const& ec)
+        {
+            if (ec)
+            {
+                std::lock_guard l(mtx_);
+                if (!ec_)
+                {
+                    ec_ = ec;
+                }
+            }
+
+            if (--count_ == 0)
+            {
+                handler_(ec_);
+            }
+        }
+
+        Buffer buffer_;
+        Handler handler_;
+        std::atomic<std::size_t> count_;
+
+        hpx::spinlock mtx_;
+        std::error_code ec_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Collects the stripes received by a parcelport until all stripes of a
+    // message have arrived
+    class HPX_EXPORT parcel_stripes
+    {
+    public:
+        using buffer_type =
+            parcel_buffer<std::vector<char>, std::vector<char>>;
+
+        parcel_stripes() = default;
+
+        parcel_stripes(parcel_stripes const&) = delete;
+        parcel_stripes(parcel_stripes&&) = delete;
+        parcel_stripes& operator=(parcel_stripes const&) = delete;
+        parcel_stripes& operator=(parcel_stripes&&) = delete;
+
+        // Add a received stripe given its descriptor and the data of its
+        // pieces. Returns true and the reassembled message once all stripes
+        // of the message have been received.
+        bool add(char const* descriptor, std::size_t size,
+            std::vector<std::vector<char>>&& pieces, buffer_type& message);
+
+        // the number of messages for which stripes are outstanding
+        std::size_t size() const;
+
+    private:
+        struct piece
+        {
+            std::uint64_t chunk;
+            std::uint64_t offset;
+            std::uint64_t size;
+        };
+
+        struct message_stripes
+        {
+            std::uint32_t num_stripes = 0;
+            std::uint32_t received = 0;
+
+            // taken from the first stripe
+            bool has_header = false;
+            buffer_type message;
+
+            std::vector<piece> pieces;
+            std::vector<std::vector<char>> data;
+        };
+
+        static void assemble(message_stripes& stripes, buffer_type& message);
+
+        using mutex_type = hpx::spinlock;
+        using key_type = std::pair<std::uint32_t, std::uint64_t>;
+
+        mutable mutex_type mtx_;
+        std::map<key_type, message_stripes> messages_;
+    };
+}    // namespace hpx::parcelset::detail
+
+#include <hpx/config/warnings_suffix.hpp>
+
+#endif
@@ -0,0 +1,83 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING)
+#include <hpx/components_base/component_type.hpp>
+#include <hpx/modules/threading_base.hpp>
+#include <hpx/parcelset_base/parcel_interface.hpp>
+
+#include <algorithm>
+#include <cstdint>
+
+namespace hpx::parcelset::detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Parcels of high priority and parcels addressing one of the AGAS
+    // services are queued in a separate lane per destination, which allows
+    // them to bypass the bulk parcels waiting to be sent to the same
+    // destination.
+    inline bool is_priority_parcel(parcel const& p)
+    {
+        switch (p.get_thread_priority())
+        {
+        case threads::thread_priority::high_recursive:
+        case threads::thread_priority::boost:
+        case threads::thread_priority::high:
+            return true;
+
+        default:
+            break;
+        }
+
+        components::component_type const type =
+            components::get_base_type(p.get_component_type());
+        return type >= components::component_agas_locality_namespace &&
+            type <= components::component_agas_symbol_namespace;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Decides which lanes a message is assembled from while both lanes of a
+    // destination hold pending parcels. The share is the percentage of these
+    // messages which carry only the parcels of the priority lane, all other
+    // messages carry the parcels of both lanes (priority parcels first).
+    class priority_lane_schedule
+    {
+    public:
+        explicit constexpr priority_lane_schedule(std::int64_t share) noexcept
+          : share_((std::clamp)(share, std::int64_t(0), std::int64_t(100)))
+        {
+        }
+
+        constexpr std::int64_t share() const noexcept
+        {
+            return share_;
+        }
+
+        // Return whether the next message should carry the parcels of the
+        // priority lane only, the balance is kept per destination and starts
+        // out as zero.
+        constexpr bool priority_only(std::int64_t& balance) const noexcept
+        {
+            if (balance + (100 - share_) <= share_)
+            {
+                balance += 100 - share_;
+                return true;
+            }
+
+            balance -= share_;
+            return false;
+        }
+
+    private:
+        std::int64_t share_;
+    };
+}    // namespace hpx::parcelset::detail
+
+#endif
@@ -24,7 +24,9 @@
 #include <hpx/naming/detail/preprocess_gid_types.hpp>
 #include <hpx/naming/split_gid.hpp>
 #include <hpx/parcelset/parcel.hpp>
+#include <hpx/parcelset/parcel_buffer.hpp>
 #include <hpx/parcelset/parcelset_fwd.hpp>
+#include <hpx/parcelset_base/parcel_flight_recorder.hpp>
 #include <hpx/parcelset_base/parcelport.hpp>
 
 #if ASIO_HAS_BOOST_THROW_EXCEPTION != 0
@@ -112,7 +114,10 @@ namespace hpx::parcelset {
             for (serialization::serialization_chunk& c : buffer.chunks_)
             {
                 if (c.type_ == serialization::chunk_type::chunk_type_pointer)
-                    chunks.push_back(transmission_chunk_type(index, c.size_));
+                {
+                    chunks.push_back(transmission_chunk_type(
+                        encode_chunk_index(index, c.rkey_), c.size_));
+                }
                 ++index;
             }
 
@@ -173,14 +178,9 @@ namespace hpx::parcelset {
                 std::unique_ptr<serialization::binary_filter> filter(
                     ps[0].get_serialization_filter());
 
-                int archive_flags = archive_flags_;
-                if (filter.get() != nullptr)
-                {
-                    archive_flags = archive_flags |
-                        int(serialization::archive_flags::enable_compression);
-                }
-
-                // preallocate data
+                // preallocate data, the sizes of the parcels were computed
+                // while awaiting them and exclude the zero-copy chunks, the
+                // buffer is therefore not reallocated while serializing
                 std::size_t num_chunks = 0;
                 for (/**/; parcels_sent != parcels_size; ++parcels_sent)
                 {
@@ -190,6 +190,25 @@ namespace hpx::parcelset {
                     num_chunks += ps[parcels_sent].num_chunks();
                 }
 
+                // small messages and messages to destinations for which
+                // compression does not pay are sent uncompressed
+                if (filter.get() != nullptr &&
+                    !pp.compress_message(
+                        ps[0].destination_locality_id(), arg_size))
+                {
+                    filter.reset();
+                }
+
+                int archive_flags = archive_flags_;
+                std::uint64_t compression_start = 0;
+                if (filter.get() != nullptr)
+                {
+                    archive_flags = archive_flags |
+                        int(serialization::archive_flags::enable_compression);
+                    compression_start =
+                        hpx::chrono::high_resolution_clock::now();
+                }
+
                 buffer.data_.reserve(arg_size);
                 buffer.chunks_.reserve(num_chunks);
 
@@ -229,8 +248,38 @@ namespace hpx::parcelset {
                             split_gids.set_split_gids(HPX_MOVE(split_gids_map));
                         }
 
+                        // reuse the segments serialized while preprocessing
+                        auto cached_segments = ps[i].move_serialized_segments();
+                        if (!cached_segments.empty())
+                        {
+                            auto& segments = archive.get_extra_data<
+                                serialization::detail::segments_tracker>();
+                            segments.set_cached_segments(
+                                HPX_MOVE(cached_segments));
+                        }
+
+#if defined(HPX_HAVE_PARCEL_PROFILING)
+                        std::uint64_t const flight_start =
+                            detail::parcel_flight_begin();
+#endif
                         archive << ps[i];
 
+#if defined(HPX_HAVE_PARCEL_PROFILING)
+                        if (flight_start != 0)
+                        {
+                            // the start time of a parcel is given in seconds
+                            detail::record_parcel_stage(
+                                ps[i].get_action_name(), ps[i].parcel_id(),
+                                parcel_stage::send_queue,
+                                static_cast<std::uint64_t>(
+                                    ps[i].start_time() * 1e9),
+                                flight_start);
+                            detail::record_parcel_stage(
+                                ps[i].get_action_name(), ps[i].parcel_id(),
+                                parcel_stage::serialization, flight_start,
+                                hpx::chrono::high_resolution_clock::now());
+                        }
+#endif
 #if defined(HPX_HAVE_PARCELPORT_COUNTERS) &&                                   \
     defined(HPX_HAVE_PARCELPORT_ACTION_COUNTERS)
                         parcelset::data_point action_data;
@@ -240,12 +289,26 @@ namespace hpx::parcelset {
                             timer.elapsed_nanoseconds() - serialize_time;
                         action_data.num_parcels_ = 1;
                         pp.add_sent_data(ps[i].get_action_name(), action_data);
-#else
-                        HPX_UNUSED(pp);
 #endif
                     }
                     archive.flush();
                     arg_size = archive.bytes_written();
+
+                    // the zero-copy chunks may refer to the segments
+                    auto* segments = archive.try_get_extra_data<
+                        serialization::detail::segments_tracker>();
+                    if (segments)
+                    {
+                        buffer.segments_ = segments->move_segments();
+                    }
+
+                    if (filter.get() != nullptr)
+                    {
+                        pp.update_compression(ps[0].destination_locality_id(),
+                            arg_size, buffer.data_.size(),
+                            hpx::chrono::high_resolution_clock::now() -
+                                compression_start);
+                    }
                 }
 
                 // store the time required for serialization
@@ -253,6 +316,26 @@ namespace hpx::parcelset {
                 buffer.data_point_.serialization_time_ =
                     timer.elapsed_nanoseconds();
 #endif
+
+                // chunks referring to device memory can be sent by device
+                // aware parcelports only
+                if (!pp.can_send_device_memory())
+                {
+                    for (serialization::serialization_chunk const& c :
+                        buffer.chunks_)
+                    {
+                        if (c.type_ ==
+                                serialization::chunk_type::chunk_type_pointer &&
+                            serialization::is_device_memory_key(c.rkey_))
+                        {
+                            HPX_THROW_EXCEPTION(bad_parameter,
+                                "encode_parcels",
+                                "parcelport '{}' can't send data residing in "
+                                "device memory",
+                                pp.type());
+                        }
+                    }
+                }
             }
             catch (hpx::exception const& e)
             {
@@ -75,6 +75,10 @@ namespace hpx::parcelset::detail {
         parcel();
         ~parcel() override;
 
+        // parcels are allocated through the internal allocator
+        static void* operator new(std::size_t size);
+        static void operator delete(void* p, std::size_t size) noexcept;
+
     private:
         parcel(naming::gid_type&& dest, naming::address&& addr,
             std::unique_ptr<actions::base_action> act);
@@ -122,6 +126,10 @@ namespace hpx::parcelset::detail {
         split_gids_type move_split_gids() const override;
         void set_split_gids(split_gids_type&& split_gids) override;
 
+        serialized_segments_type move_serialized_segments() const override;
+        void set_serialized_segments(
+            serialized_segments_type&& segments) override;
+
         std::size_t num_chunks() const override;
         std::size_t& num_chunks() override;
 
@@ -155,6 +163,7 @@ namespace hpx::parcelset::detail {
         std::unique_ptr<actions::base_action> action_;
 
         mutable split_gids_type split_gids_;
+        mutable serialized_segments_type serialized_segments_;
         std::size_t size_;
         std::size_t num_chunks_;
     };
@@ -11,15 +11,41 @@
 
 #if defined(HPX_HAVE_NETWORKING)
 #include <hpx/modules/serialization.hpp>
+#include <hpx/serialization/detail/parallel_serialization.hpp>
 
 #include <hpx/parcelset_base/detail/data_point.hpp>
 
+#include <cstddef>
 #include <cstdint>
 #include <utility>
 #include <vector>
 
 namespace hpx::parcelset {
 
+    namespace detail {
+
+        // The index of a zero-copy transmission chunk carries the key of the
+        // registered buffer the chunk should be received into (if any) in its
+        // upper half.
+        constexpr std::uint64_t encode_chunk_index(
+            std::size_t index, std::uint64_t rkey) noexcept
+        {
+            return static_cast<std::uint64_t>(index) |
+                (static_cast<std::uint64_t>(static_cast<std::uint32_t>(rkey))
+                    << 32);
+        }
+
+        constexpr std::size_t decode_chunk_index(std::uint64_t first) noexcept
+        {
+            return static_cast<std::size_t>(first & 0xffffffffu);
+        }
+
+        constexpr std::uint32_t decode_chunk_key(std::uint64_t first) noexcept
+        {
+            return static_cast<std::uint32_t>(first >> 32);
+        }
+    }    // namespace detail
+
     template <typename BufferType,
         typename ChunkType = serialization::serialization_chunk>
     struct parcel_buffer
@@ -65,7 +91,9 @@ namespace hpx::parcelset {
         {
             data_.clear();
             chunks_.clear();
+            chunk_targets_.clear();
             transmission_chunks_.clear();
+            segments_.clear();
             num_chunks_ = count_chunks_type(0, 0);
             size_ = 0;
             data_size_ = 0;
@@ -80,6 +108,13 @@ namespace hpx::parcelset {
         std::vector<ChunkType> chunks_;
         std::vector<transmission_chunk_type> transmission_chunks_;
 
+        // registered memory the zero-copy chunks were received into, if any
+        std::vector<void*> chunk_targets_;
+
+        // separately serialized segments of large containers, the zero-copy
+        // chunks refer to their data
+        serialization::detail::serialized_segments segments_;
+
         // pair of (zero-copy, non-zero-copy) chunks
         count_chunks_type num_chunks_;
 
@@ -235,6 +235,20 @@ namespace hpx::parcelset {
         void remove_from_connection_cache(
             naming::gid_type const& gid, endpoints_type const& endpoints);
 
+        /// \brief Establish connections to the given localities ahead of
+        /// their first use
+        ///
+        /// \returns The number of localities a connection is available for
+        std::size_t warm_up_connections(
+            std::vector<naming::gid_type> const& locality_ids);
+
+        /// \brief Establish connections to the localities listed in
+        /// hpx.parcel.warm_up_connections ("all" or a comma separated list of
+        /// locality ids), this is done by the runtime during startup
+        ///
+        /// \returns The number of localities a connection is available for
+        std::size_t warm_up_connections();
+
         /// \brief return the endpoints associated with this parcelhandler
         /// \returns all connection information for the enabled parcelports
         endpoints_type const& endpoints() const
@@ -266,6 +280,10 @@ namespace hpx::parcelset {
         // number of parcels routed
         std::int64_t get_parcel_routed_count(bool reset);
 
+        // number of parcels targeting this locality which were invoked
+        // directly instead of being sent
+        std::int64_t get_parcel_local_invocation_count(bool reset);
+
 #if defined(HPX_HAVE_PARCELPORT_COUNTERS)
         // number of parcels sent
         std::int64_t get_parcel_send_count(
@@ -393,6 +411,9 @@ namespace hpx::parcelset {
         std::int64_t get_connection_cache_statistics(std::string const& pp_type,
             parcelport::connection_cache_statistics_type stat_type, bool) const;
 
+        std::int64_t get_compression_statistics(std::string const& pp_type,
+            parcelport::compression_statistics_type stat_type, bool) const;
+
         void list_parcelports(std::ostringstream& strm) const;
         void list_parcelport(std::ostringstream& strm,
             std::string const& ppname, int priority, bool bootstrap) const;
@@ -401,6 +422,19 @@ namespace hpx::parcelset {
         void put_parcels_impl(
             std::vector<parcel>&& p, std::vector<write_handler_type>&& f);
 
+        // schedule the action of a parcel targeting this locality right
+        // away, without serializing it, returns false if the parcel has to
+        // be sent
+        bool invoke_locally(parcel& p, write_handler_type& f);
+
+        // collect parcels for the same destination sent by a thread before
+        // it suspends, these are handed to the parcelport together
+        void aggregate_parcel(
+            std::pair<std::shared_ptr<parcelport>, locality> const& dest,
+            parcel&& p, write_handler_type&& f);
+        void flush_aggregated_parcels(locality const& dest);
+        bool flush_aggregated_parcels();
+
         // manage default exception handler
         void invoke_write_handler(
             std::error_code const& ec, parcel const& p) const;
@@ -452,16 +486,34 @@ namespace hpx::parcelset {
         std::atomic<bool> enable_parcel_handling_;
 
         /// Store message handlers for actions
-        mutex_type handlers_mtx_;
+        mutex_type handlers_mtx_{"parcelhandler::handlers_mtx_"};
         message_handler_map handlers_;
         bool const load_message_handlers_;
 
+        /// Parcels which are aggregated per destination
+        struct aggregated_parcels
+        {
+            std::shared_ptr<parcelport> pp;
+            std::vector<parcel> parcels;
+            std::vector<write_handler_type> handlers;
+        };
+        using aggregated_parcels_map = std::map<locality, aggregated_parcels>;
+
+        mutex_type aggregation_mtx_{"parcelhandler::aggregation_mtx_"};
+        aggregated_parcels_map aggregated_parcels_;
+        bool const aggregate_parcels_;
+        std::size_t const max_aggregated_parcels_;
+
         /// Count number of (outbound) parcels routed
         std::atomic<std::int64_t> count_routed_;
 
+        /// Parcels targeting this locality are invoked directly
+        bool const invoke_locally_;
+        std::atomic<std::int64_t> count_invoked_locally_;
+
         /// global exception handler for unhandled exceptions thrown from the
         /// parcel layer
-        mutable mutex_type mtx_;
+        mutable mutex_type mtx_{"parcelhandler::mtx_"};
         write_handler_type write_handler_;
 
         /// cache whether networking has been enabled
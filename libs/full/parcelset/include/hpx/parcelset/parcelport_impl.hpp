@@ -14,6 +14,7 @@
 
 #if defined(HPX_HAVE_NETWORKING)
 #include <hpx/assert.hpp>
+#include <hpx/concurrency/flat_combining.hpp>
 #include <hpx/modules/errors.hpp>
 #include <hpx/modules/execution_base.hpp>
 #include <hpx/modules/functional.hpp>
@@ -26,18 +27,25 @@
 #include <hpx/modules/util.hpp>
 #include <hpx/util/from_string.hpp>
 
+#include <hpx/components_base/agas_interface.hpp>
+#include <hpx/naming_base/naming_base.hpp>
 #include <hpx/parcelset/connection_cache.hpp>
 #include <hpx/parcelset/detail/call_for_each.hpp>
 #include <hpx/parcelset/detail/parcel_await.hpp>
+#include <hpx/parcelset/detail/parcel_stripes.hpp>
+#include <hpx/parcelset/detail/priority_lanes.hpp>
 #include <hpx/parcelset/encode_parcels.hpp>
 #include <hpx/parcelset_base/parcelport.hpp>
 
+#include <algorithm>
 #include <atomic>
 #include <chrono>
 #include <cstddef>
 #include <cstdint>
 #include <exception>
+#include <iterator>
 #include <limits>
+#include <map>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -118,6 +126,26 @@ namespace hpx::parcelset {
                 HPX_ZERO_COPY_SERIALIZATION_THRESHOLD);
         }
 
+        static std::size_t num_stripes(util::runtime_configuration const& ini)
+        {
+            std::string key("hpx.parcel.");
+            key += connection_handler_type();
+
+            return (std::max)(hpx::util::get_entry_as<std::size_t>(
+                                  ini, key + ".stripes", 1),
+                std::size_t(1));
+        }
+
+        static std::uint64_t stripe_threshold(
+            util::runtime_configuration const& ini)
+        {
+            std::string key("hpx.parcel.");
+            key += connection_handler_type();
+
+            return hpx::util::get_entry_as<std::uint64_t>(
+                ini, key + ".stripe_threshold", 1048576);
+        }
+
         static std::size_t max_background_threads(
             util::runtime_configuration const& ini)
         {
@@ -129,6 +157,39 @@ namespace hpx::parcelset {
                 (std::numeric_limits<std::size_t>::max)());
         }
 
+        static bool priority_lanes(util::runtime_configuration const& ini)
+        {
+            return hpx::util::get_entry_as<int>(
+                       ini, "hpx.parcel.priority_lanes", 1) != 0;
+        }
+
+        static bool varint_encoding(util::runtime_configuration const& ini)
+        {
+            return hpx::util::get_entry_as<int>(
+                       ini, "hpx.parcel.varint_encoding", 0) != 0;
+        }
+
+        static bool parallel_serialization(
+            util::runtime_configuration const& ini)
+        {
+            return hpx::util::get_entry_as<int>(
+                       ini, "hpx.parcel.parallel_serialization", 0) != 0;
+        }
+
+        static std::size_t parallel_serialization_threshold(
+            util::runtime_configuration const& ini)
+        {
+            return hpx::util::get_entry_as<std::size_t>(
+                ini, "hpx.parcel.parallel_serialization_threshold", 65536);
+        }
+
+        static std::int64_t priority_lane_share(
+            util::runtime_configuration const& ini)
+        {
+            return hpx::util::get_entry_as<std::int64_t>(
+                ini, "hpx.parcel.priority_lane_share", 75);
+        }
+
     public:
         /// Construct the parcelport on the given locality.
         parcelport_impl(util::runtime_configuration const& ini,
@@ -144,6 +205,12 @@ namespace hpx::parcelset {
           , operations_in_flight_(0)
           , num_thread_(0)
           , max_background_thread_(max_background_threads(ini))
+          , num_stripes_(num_stripes(ini))
+          , stripe_threshold_(stripe_threshold(ini))
+          , next_stripe_message_id_(0)
+          , priority_lanes_(priority_lanes(ini))
+          , priority_lane_schedule_(priority_lane_share(ini))
+          , enqueue_combiner_(mtx_)
         {
             std::string endian_out = get_config_entry("hpx.parcel.endian_out",
                 endian::native == endian::big ? "big" : "little");
@@ -175,6 +242,21 @@ namespace hpx::parcelset {
                 archive_flags_ = archive_flags_ |
                     int(serialization::archive_flags::disable_data_chunking);
             }
+
+            if (varint_encoding(ini))
+            {
+                archive_flags_ = archive_flags_ |
+                    int(serialization::archive_flags::enable_varint_encoding);
+            }
+
+            if (parallel_serialization(ini))
+            {
+                archive_flags_ = archive_flags_ |
+                    int(serialization::archive_flags::
+                            enable_parallel_serialization);
+                serialization::detail::set_parallel_serialization_threshold(
+                    parallel_serialization_threshold(ini));
+            }
         }
 
         ~parcelport_impl() override
@@ -260,7 +342,8 @@ namespace hpx::parcelset {
                         enqueue_parcel(dest, HPX_MOVE(p), HPX_MOVE(f));
                         get_connection_and_send_parcels(dest);
                     }
-                });
+                },
+                this->get_zero_copy_serialization_threshold());
         }
 
         void put_parcels(locality const& dest, std::vector<parcel> parcels,
@@ -304,7 +387,8 @@ namespace hpx::parcelset {
 
                         get_connection_and_send_parcels(dest);
                     }
-                });
+                },
+                this->get_zero_copy_serialization_threshold());
         }
 
         void send_early_parcel(locality const& dest, parcel p) override
@@ -326,6 +410,13 @@ namespace hpx::parcelset {
             return do_background_work_impl(num_thread, mode);
         }
 
+        /// Collects the stripes of large messages which were sent over
+        /// several connections
+        detail::parcel_stripes& get_parcel_stripes() noexcept
+        {
+            return parcel_stripes_;
+        }
+
         /// support enable_shared_from_this
         std::shared_ptr<parcelport_impl> shared_from_this()
         {
@@ -397,6 +488,65 @@ namespace hpx::parcelset {
 
         ////////////////////////////////////////////////////////////////////////
         // Return the given connection cache statistic
+        /// Establish connections to the given destinations concurrently, at
+        /// most hpx.parcel.warm_up_concurrency of them at a time in order
+        /// not to flood the network with connection requests.
+        std::size_t warm_up_connections(
+            std::vector<locality> const& dests) override
+        {
+            if constexpr (connection_handler_traits<
+                              ConnectionHandler>::send_immediate_parcels::value)
+            {
+                HPX_UNUSED(dests);
+                return 0;
+            }
+            else
+            {
+                std::size_t const concurrency = (std::max)(std::size_t(1),
+                    hpx::util::from_string<std::size_t>(get_config_entry(
+                        "hpx.parcel.warm_up_concurrency", "16")));
+
+                std::atomic<std::size_t> pending(0);
+                std::atomic<std::size_t> established(0);
+                auto warm_up = [&](locality const& dest) {
+                    if (warm_up_connection(dest))
+                    {
+                        ++established;
+                    }
+                    --pending;
+                };
+
+                for (locality const& dest : dests)
+                {
+                    hpx::util::yield_while(
+                        [&]() { return pending >= concurrency; },
+                        "parcelport_impl::warm_up_connections");
+
+                    ++pending;
+
+                    error_code ec(throwmode::lightweight);
+                    hpx::threads::thread_init_data data(
+                        hpx::threads::make_thread_function_nullary(
+                            [&warm_up, dest]() { warm_up(dest); }),
+                        "warm_up_connection", threads::thread_priority::normal,
+                        threads::thread_schedule_hint(
+                            static_cast<std::int16_t>(get_next_num_thread())),
+                        threads::thread_stacksize::default_,
+                        threads::thread_schedule_state::pending, true);
+                    hpx::threads::register_thread(data, ec);
+                    if (ec)
+                    {
+                        warm_up(dest);
+                    }
+                }
+
+                hpx::util::yield_while([&]() { return pending != 0; },
+                    "parcelport_impl::warm_up_connections");
+
+                return established;
+            }
+        }
+
         std::int64_t get_connection_cache_statistics(
             connection_cache_statistics_type t, bool reset) override
         {
@@ -605,120 +755,252 @@ namespace hpx::parcelset {
             return sender_connection;
         }
 
+        // Create a connection to the given destination (if there isn't one
+        // already) and put it into the connection cache
+        bool warm_up_connection(locality const& dest)
+        {
+            std::shared_ptr<connection> sender_connection;
+            if (!connection_cache_.get_or_reserve(dest, sender_connection))
+            {
+                return false;
+            }
+
+            if (!sender_connection)
+            {
+                error_code ec(throwmode::lightweight);
+                sender_connection =
+                    connection_handler().create_connection(dest, ec);
+                if (ec || !sender_connection)
+                {
+                    // release the reserved space again
+                    connection_cache_.clear(dest, sender_connection);
+                    return false;
+                }
+            }
+
+            connection_cache_.reclaim(dest, sender_connection);
+            return true;
+        }
+
         ///////////////////////////////////////////////////////////////////////
         void enqueue_parcel(
             locality const& locality_id, parcel&& p, write_handler_type&& f)
         {
             using mapped_type = pending_parcels_map::mapped_type;
 
-            std::unique_lock l(mtx_);
+            bool const priority =
+                priority_lanes_ && detail::is_priority_parcel(p);
+
+            // The operation is applied by whichever thread holds the lock.
+            enqueue_combiner_.apply([&]() {
+                // We ignore the lock here. It might happen that while
+                // enqueuing, we need to acquire a lock. This should not cause
+                // any problems (famous last words)
+                std::unique_lock l(mtx_, std::defer_lock);
+                util::ignore_while_checking il(&l);
+                HPX_UNUSED(il);
+
+                mapped_type& e = priority ?
+                    pending_priority_parcels_[locality_id] :
+                    pending_parcels_[locality_id];
+                hpx::get<0>(e).push_back(HPX_MOVE(p));
+                hpx::get<1>(e).push_back(HPX_MOVE(f));
+
+                parcel_destinations_.insert(locality_id);
+                ++num_parcel_destinations_;
+            });
+        }
 
-            // We ignore the lock here. It might happen that while enqueuing,
-            // we need to acquire a lock. This should not cause any problems
-            // (famous last words)
-            util::ignore_while_checking il(&l);
-            HPX_UNUSED(il);
+        // Append the given parcels and handlers to the existing ones
+        static void append_parcels(std::vector<parcel>& parcels,
+            std::vector<write_handler_type>& handlers,
+            std::vector<parcel>&& new_parcels,
+            std::vector<write_handler_type>&& new_handlers)
+        {
+            if (parcels.empty())
+            {
+                HPX_ASSERT(handlers.empty());
+                std::swap(parcels, new_parcels);
+                std::swap(handlers, new_handlers);
+            }
+            else
+            {
+                HPX_ASSERT(parcels.size() == handlers.size());
+                std::size_t new_size = parcels.size() + new_parcels.size();
+                parcels.reserve(new_size);
+
+                std::move(new_parcels.begin(), new_parcels.end(),
+                    std::back_inserter(parcels));
+                handlers.reserve(new_size);
+                std::move(new_handlers.begin(), new_handlers.end(),
+                    std::back_inserter(handlers));
+            }
+        }
 
-            mapped_type& e = pending_parcels_[locality_id];
-            hpx::get<0>(e).push_back(HPX_MOVE(p));
-            hpx::get<1>(e).push_back(HPX_MOVE(f));
+        // Move the parcels of high priority out of the given ones
+        static void extract_priority_parcels(std::vector<parcel>& parcels,
+            std::vector<write_handler_type>& handlers,
+            std::vector<parcel>& priority_parcels,
+            std::vector<write_handler_type>& priority_handlers)
+        {
+            std::size_t j = 0;
+            for (std::size_t i = 0; i != parcels.size(); ++i)
+            {
+                if (detail::is_priority_parcel(parcels[i]))
+                {
+                    priority_parcels.push_back(HPX_MOVE(parcels[i]));
+                    priority_handlers.push_back(HPX_MOVE(handlers[i]));
+                }
+                else
+                {
+                    if (i != j)
+                    {
+                        parcels[j] = HPX_MOVE(parcels[i]);
+                        handlers[j] = HPX_MOVE(handlers[i]);
+                    }
+                    ++j;
+                }
+            }
 
-            parcel_destinations_.insert(locality_id);
-            ++num_parcel_destinations_;
+            parcels.erase(parcels.begin() + j, parcels.end());
+            handlers.erase(handlers.begin() + j, handlers.end());
         }
 
         void enqueue_parcels(locality const& locality_id,
             std::vector<parcel>&& parcels,
             std::vector<write_handler_type>&& handlers)
         {
-            using mapped_type = pending_parcels_map::mapped_type;
-
-            std::unique_lock l(mtx_);
-
-            // We ignore the lock here. It might happen that while enqueuing,
-            // we need to acquire a lock. This should not cause any problems
-            // (famous last words)
-            util::ignore_while_checking il(&l);
-            HPX_UNUSED(il);
-
             HPX_ASSERT(parcels.size() == handlers.size());
 
-            mapped_type& e = pending_parcels_[locality_id];
-            if (hpx::get<0>(e).empty())
+            std::vector<parcel> priority_parcels;
+            std::vector<write_handler_type> priority_handlers;
+            if (priority_lanes_)
             {
-                HPX_ASSERT(hpx::get<1>(e).empty());
-                std::swap(hpx::get<0>(e), parcels);
-                std::swap(hpx::get<1>(e), handlers);
+                extract_priority_parcels(
+                    parcels, handlers, priority_parcels, priority_handlers);
             }
-            else
-            {
-                HPX_ASSERT(hpx::get<0>(e).size() == hpx::get<1>(e).size());
-                std::size_t new_size = hpx::get<0>(e).size() + parcels.size();
-                hpx::get<0>(e).reserve(new_size);
 
-                std::move(parcels.begin(), parcels.end(),
-                    std::back_inserter(hpx::get<0>(e)));
-                hpx::get<1>(e).reserve(new_size);
-                std::move(handlers.begin(), handlers.end(),
-                    std::back_inserter(hpx::get<1>(e)));
-            }
+            // The operation is applied by whichever thread holds the lock.
+            enqueue_combiner_.apply([&]() {
+                // We ignore the lock here. It might happen that while
+                // enqueuing, we need to acquire a lock. This should not cause
+                // any problems (famous last words)
+                std::unique_lock l(mtx_, std::defer_lock);
+                util::ignore_while_checking il(&l);
+                HPX_UNUSED(il);
 
-            parcel_destinations_.insert(locality_id);
-            ++num_parcel_destinations_;
+                if (!priority_parcels.empty())
+                {
+                    auto& e = pending_priority_parcels_[locality_id];
+                    append_parcels(hpx::get<0>(e), hpx::get<1>(e),
+                        HPX_MOVE(priority_parcels),
+                        HPX_MOVE(priority_handlers));
+                }
+                if (!parcels.empty())
+                {
+                    auto& e = pending_parcels_[locality_id];
+                    append_parcels(hpx::get<0>(e), hpx::get<1>(e),
+                        HPX_MOVE(parcels), HPX_MOVE(handlers));
+                }
+
+                parcel_destinations_.insert(locality_id);
+                ++num_parcel_destinations_;
+            });
         }
 
         bool dequeue_parcels(locality const& locality_id,
             std::vector<parcel>& parcels,
             std::vector<write_handler_type>& handlers)
         {
-            using iterator = pending_parcels_map::iterator;
+            HPX_ASSERT(parcels.empty() && handlers.empty());
+
+            std::unique_lock l(mtx_, std::try_to_lock);
+            if (!l.owns_lock())
+                return false;
 
+            auto it = pending_parcels_.find(locality_id);
+            bool const has_parcels = it != pending_parcels_.end() &&
+                !hpx::get<0>(it->second).empty();
+
+            auto pit = pending_priority_parcels_.find(locality_id);
+            bool const has_priority_parcels =
+                pit != pending_priority_parcels_.end() &&
+                !hpx::get<0>(pit->second).empty();
+
+            // do nothing if parcels have already been picked up by
+            // another thread
+            if (!has_parcels && !has_priority_parcels)
             {
-                std::unique_lock l(mtx_, std::try_to_lock);
-                if (!l.owns_lock())
-                    return false;
+                return false;
+            }
 
-                iterator it = pending_parcels_.find(locality_id);
+            if (has_priority_parcels)
+            {
+                std::swap(parcels, hpx::get<0>(pit->second));
+                std::swap(handlers, hpx::get<1>(pit->second));
 
-                // do nothing if parcels have already been picked up by
-                // another thread
-                if (it != pending_parcels_.end() &&
-                    !hpx::get<0>(it->second).empty())
+                if (has_parcels)
                 {
-                    HPX_ASSERT(it->first == locality_id);
-                    HPX_ASSERT(handlers.size() == 0);
-                    HPX_ASSERT(handlers.size() == parcels.size());
-                    std::swap(parcels, hpx::get<0>(it->second));
-                    HPX_ASSERT(hpx::get<0>(it->second).size() == 0);
-                    std::swap(handlers, hpx::get<1>(it->second));
-                    HPX_ASSERT(handlers.size() == parcels.size());
-
-                    HPX_ASSERT(!handlers.empty());
-                }
-                else
-                {
-                    HPX_ASSERT(hpx::get<1>(it->second).empty());
-                    return false;
+                    // the priority parcels bypass the bulk parcels as long
+                    // as the configured share is not exceeded, otherwise
+                    // both are sent together
+                    if (priority_lane_schedule_.priority_only(
+                            priority_lane_balance_[locality_id]))
+                    {
+                        // the bulk parcels are still pending
+                        HPX_ASSERT(handlers.size() == parcels.size());
+                        return true;
+                    }
+
+                    append_parcels(parcels, handlers,
+                        HPX_MOVE(hpx::get<0>(it->second)),
+                        HPX_MOVE(hpx::get<1>(it->second)));
+                    hpx::get<0>(it->second).clear();
+                    hpx::get<1>(it->second).clear();
                 }
+            }
+            else
+            {
+                std::swap(parcels, hpx::get<0>(it->second));
+                std::swap(handlers, hpx::get<1>(it->second));
+            }
 
-                parcel_destinations_.erase(locality_id);
+            if (!has_parcels || !has_priority_parcels)
+            {
+                priority_lane_balance_.erase(locality_id);
+            }
+
+            HPX_ASSERT(!handlers.empty());
+            HPX_ASSERT(handlers.size() == parcels.size());
+
+            parcel_destinations_.erase(locality_id);
 
-                HPX_ASSERT(0 != num_parcel_destinations_.load());
-                --num_parcel_destinations_;
+            HPX_ASSERT(0 != num_parcel_destinations_.load());
+            --num_parcel_destinations_;
+
+            return true;
+        }
 
+        // Return whether parcels are pending for the given destination, the
+        // lock has to be held by the caller
+        bool has_pending_parcels(locality const& locality_id) const
+        {
+            auto it = pending_priority_parcels_.find(locality_id);
+            if (it != pending_priority_parcels_.end() &&
+                !hpx::get<0>(it->second).empty())
+            {
                 return true;
             }
+
+            it = pending_parcels_.find(locality_id);
+            return it != pending_parcels_.end() &&
+                !hpx::get<0>(it->second).empty();
         }
 
-    protected:
-        bool dequeue_parcel(
+        static bool dequeue_parcel_from(pending_parcels_map& pending_parcels,
             locality& dest, parcel& p, write_handler_type& handler)
         {
-            std::unique_lock l(mtx_, std::try_to_lock);
-            if (!l.owns_lock())
-                return false;
-
-            for (auto& pending : pending_parcels_)
+            for (auto& pending : pending_parcels)
             {
                 auto& parcels = hpx::get<0>(pending.second);
                 if (!parcels.empty())
@@ -732,7 +1014,7 @@ namespace hpx::parcelset {
 
                     if (parcels.empty())
                     {
-                        pending_parcels_.erase(dest);
+                        pending_parcels.erase(dest);
                     }
                     return true;
                 }
@@ -740,6 +1022,19 @@ namespace hpx::parcelset {
             return false;
         }
 
+    protected:
+        bool dequeue_parcel(
+            locality& dest, parcel& p, write_handler_type& handler)
+        {
+            std::unique_lock l(mtx_, std::try_to_lock);
+            if (!l.owns_lock())
+                return false;
+
+            return dequeue_parcel_from(
+                       pending_priority_parcels_, dest, p, handler) ||
+                dequeue_parcel_from(pending_parcels_, dest, p, handler);
+        }
+
         bool trigger_pending_work()
         {
             if (0 == num_parcel_destinations_.load(std::memory_order_relaxed))
@@ -850,10 +1145,7 @@ namespace hpx::parcelset {
                 std::lock_guard l(mtx_);
 
                 // HPX_ASSERT(locality_id == sender_connection->destination());
-                pending_parcels_map::iterator it =
-                    pending_parcels_.find(locality_id);
-                if (it == pending_parcels_.end() ||
-                    hpx::get<0>(it->second).empty())
+                if (!has_pending_parcels(locality_id))
                 {
                     return;
                 }
@@ -889,11 +1181,8 @@ namespace hpx::parcelset {
                 ++operations_in_flight_;
 
                 // send all of the parcels
-                sender_connection->async_write(
-                    call_for_each(HPX_MOVE(handlers), HPX_MOVE(parcels)),
-                    hpx::bind_front(
-                        &parcelport_impl::send_pending_parcels_trampoline,
-                        this));
+                write_parcels(parcel_locality_id, sender_connection,
+                    call_for_each(HPX_MOVE(handlers), HPX_MOVE(parcels)));
             }
             else
             {
@@ -915,12 +1204,9 @@ namespace hpx::parcelset {
                     std::back_inserter(handled_parcels));
 
                 // send only part of the parcels
-                sender_connection->async_write(
+                write_parcels(parcel_locality_id, sender_connection,
                     call_for_each(
-                        HPX_MOVE(handled_handlers), HPX_MOVE(handled_parcels)),
-                    hpx::bind_front(
-                        &parcelport_impl::send_pending_parcels_trampoline,
-                        this));
+                        HPX_MOVE(handled_handlers), HPX_MOVE(handled_parcels)));
 
                 // give back unhandled parcels
                 parcels.erase(parcels.begin(), parcels.begin() + num_parcels);
@@ -934,6 +1220,105 @@ namespace hpx::parcelset {
             hpx::execution_base::this_thread::yield();
         }
 
+        // Write the encoded parcels, large messages are split into stripes
+        // which are sent over several connections at the same time
+        void write_parcels(locality const& dest,
+            std::shared_ptr<connection> const& sender_connection,
+            detail::call_for_each&& handler)
+        {
+            if (num_stripes_ > 1 &&
+                detail::zero_copy_size(sender_connection->buffer_) >=
+                    stripe_threshold_)
+            {
+                std::vector<std::shared_ptr<connection>> connections =
+                    get_stripe_connections(dest);
+                if (!connections.empty())
+                {
+                    connections.insert(connections.begin(), sender_connection);
+                    write_stripes(dest, connections, HPX_MOVE(handler));
+                    return;
+                }
+            }
+
+            sender_connection->async_write(HPX_MOVE(handler),
+                hpx::bind_front(
+                    &parcelport_impl::send_pending_parcels_trampoline, this));
+        }
+
+        // Get additional connections to the destination, as many as are
+        // available up to the configured number of stripes
+        std::vector<std::shared_ptr<connection>> get_stripe_connections(
+            locality const& dest)
+        {
+            std::vector<std::shared_ptr<connection>> connections;
+
+            // the stripes are identified using the id of the sending locality
+            if (agas::get_locality_id() == naming::invalid_locality_id)
+            {
+                return connections;
+            }
+
+            connections.reserve(num_stripes_ - 1);
+            for (std::size_t i = 1; i != num_stripes_; ++i)
+            {
+                error_code ec(throwmode::lightweight);
+                std::shared_ptr<connection> c = get_connection(dest, false, ec);
+                if (ec || !c)
+                {
+                    break;
+                }
+                connections.push_back(HPX_MOVE(c));
+            }
+            return connections;
+        }
+
+        void write_stripes(locality const& dest,
+            std::vector<std::shared_ptr<connection>>& connections,
+            detail::call_for_each&& handler)
+        {
+            using buffer_type = std::decay_t<decltype(connections[0]->buffer_)>;
+            using striped_write_type =
+                detail::striped_write<buffer_type, detail::call_for_each>;
+
+            // the original message is kept alive until all stripes were sent
+            auto state = std::make_shared<striped_write_type>(
+                HPX_MOVE(connections[0]->buffer_), HPX_MOVE(handler));
+
+            std::vector<buffer_type> stripes =
+                detail::split_into_stripes(state->buffer_, connections.size(),
+                    agas::get_locality_id(), ++next_stripe_message_id_);
+            HPX_ASSERT(
+                !stripes.empty() && stripes.size() <= connections.size());
+
+            // give back the connections which are not needed
+            for (std::size_t i = stripes.size(); i != connections.size(); ++i)
+            {
+                connection_cache_.reclaim(dest, connections[i]);
+            }
+
+            state->count_ = stripes.size();
+            for (std::size_t i = 0; i != stripes.size(); ++i)
+            {
+                std::shared_ptr<connection> const& c = connections[i];
+
+                // the first connection is accounted for by the caller
+                if (i != 0)
+                {
+                    ++operations_in_flight_;
+#if defined(HPX_TRACK_STATE_OF_OUTGOING_TCP_CONNECTION)
+                    c->set_state(connection::state_send_pending);
+#endif
+                }
+
+                c->buffer_ = HPX_MOVE(stripes[i]);
+                c->async_write(
+                    [state](std::error_code const& ec) { state->done(ec); },
+                    hpx::bind_front(
+                        &parcelport_impl::send_pending_parcels_trampoline,
+                        this));
+            }
+        }
+
     public:
         std::size_t get_next_num_thread()
         {
@@ -954,6 +1339,24 @@ namespace hpx::parcelset {
 
         std::atomic<std::size_t> num_thread_;
         std::size_t const max_background_thread_;
+
+        /// Large messages are split into this many stripes if their
+        /// zero-copy chunks are larger than the threshold
+        std::size_t const num_stripes_;
+        std::uint64_t const stripe_threshold_;
+        std::atomic<std::uint64_t> next_stripe_message_id_;
+        detail::parcel_stripes parcel_stripes_;
+
+        /// Parcels of high priority are queued separately and may bypass the
+        /// bulk parcels, the schedule limits the share of the messages
+        /// carrying only priority parcels while bulk parcels are waiting
+        bool const priority_lanes_;
+        detail::priority_lane_schedule const priority_lane_schedule_;
+        std::map<locality, std::int64_t> priority_lane_balance_;
+
+        /// Concurrent updates of the pending parcels are applied in batches
+        /// by the thread holding the lock
+        util::flat_combining<mutex_type> enqueue_combiner_;
     };
 }    // namespace hpx::parcelset
 
@@ -11,6 +11,7 @@
 #include <hpx/lcos_local/detail/preprocess_future.hpp>
 #include <hpx/modules/functional.hpp>
 #include <hpx/modules/serialization.hpp>
+#include <hpx/serialization/detail/parallel_serialization.hpp>
 #include <hpx/serialization/detail/preprocess_container.hpp>
 
 #include <hpx/actions/actions_fwd.hpp>
@@ -34,11 +35,14 @@ namespace hpx::parcelset::detail {
             hpx::move_only_function<void(Parcel&&, Handler&&)>;
 
         parcel_await_base(Parcel&& parcel, Handler&& handler,
-            std::uint32_t archive_flags, put_parcel_type pp) noexcept
+            std::uint32_t archive_flags, put_parcel_type pp,
+            std::size_t zero_copy_serialization_threshold)
           : put_parcel_(HPX_MOVE(pp))
           , parcel_(HPX_MOVE(parcel))
           , handler_(HPX_MOVE(handler))
-          , archive_(data_, archive_flags)
+          , archive_(data_, archive_flags,
+                zero_copy_serialization_threshold != 0 ? &chunks_ : nullptr,
+                nullptr, zero_copy_serialization_threshold)
           , overhead_(archive_.bytes_written())
         {
         }
@@ -83,6 +87,13 @@ namespace hpx::parcelset::detail {
                 p.set_split_gids(split_gids->move_split_gids());
             }
 
+            auto* segments = archive_.try_get_extra_data<
+                serialization::detail::segments_tracker>();
+            if (segments)
+            {
+                p.set_serialized_segments(segments->move_segments());
+            }
+
             return true;
         }
 
@@ -90,6 +101,10 @@ namespace hpx::parcelset::detail {
         Parcel parcel_;
         Handler handler_;
         hpx::serialization::detail::preprocess_container data_;
+
+        // The chunks are only counted, this enables data chunking while
+        // computing the size of the parcels
+        std::vector<serialization::serialization_chunk> chunks_;
         hpx::serialization::output_archive archive_;
         std::size_t overhead_;
     };
@@ -101,8 +116,10 @@ namespace hpx::parcelset::detail {
             write_handler_type, parcel_await>;
 
         parcel_await(parcelset::parcel&& p, write_handler_type&& f,
-            std::uint32_t archive_flags, put_parcel_type pp) noexcept
-          : base_type(HPX_MOVE(p), HPX_MOVE(f), archive_flags, HPX_MOVE(pp))
+            std::uint32_t archive_flags, put_parcel_type pp,
+            std::size_t zero_copy_serialization_threshold)
+          : base_type(HPX_MOVE(p), HPX_MOVE(f), archive_flags, HPX_MOVE(pp),
+                zero_copy_serialization_threshold)
         {
         }
 
@@ -124,8 +141,9 @@ namespace hpx::parcelset::detail {
 
         parcels_await(std::vector<parcelset::parcel>&& p,
             std::vector<write_handler_type>&& f, std::uint32_t archive_flags,
-            put_parcel_type pp) noexcept
-          : base_type(HPX_MOVE(p), HPX_MOVE(f), archive_flags, HPX_MOVE(pp))
+            put_parcel_type pp, std::size_t zero_copy_serialization_threshold)
+          : base_type(HPX_MOVE(p), HPX_MOVE(f), archive_flags, HPX_MOVE(pp),
+                zero_copy_serialization_threshold)
           , idx_(0)
         {
         }
@@ -145,19 +163,20 @@ namespace hpx::parcelset::detail {
 
     ///////////////////////////////////////////////////////////////////////////
     void parcel_await_apply(parcelset::parcel&& p, write_handler_type&& f,
-        std::uint32_t archive_flags, put_parcel_type pp)
+        std::uint32_t archive_flags, put_parcel_type pp,
+        std::size_t zero_copy_serialization_threshold)
     {
-        auto ptr = std::make_shared<parcel_await>(
-            HPX_MOVE(p), HPX_MOVE(f), archive_flags, HPX_MOVE(pp));
+        auto ptr = std::make_shared<parcel_await>(HPX_MOVE(p), HPX_MOVE(f),
+            archive_flags, HPX_MOVE(pp), zero_copy_serialization_threshold);
         ptr->apply();
     }
 
     void parcels_await_apply(std::vector<parcelset::parcel>&& p,
         std::vector<write_handler_type>&& f, std::uint32_t archive_flags,
-        put_parcels_type pp)
+        put_parcels_type pp, std::size_t zero_copy_serialization_threshold)
     {
-        auto ptr = std::make_shared<parcels_await>(
-            HPX_MOVE(p), HPX_MOVE(f), archive_flags, HPX_MOVE(pp));
+        auto ptr = std::make_shared<parcels_await>(HPX_MOVE(p), HPX_MOVE(f),
+            archive_flags, HPX_MOVE(pp), zero_copy_serialization_threshold);
         ptr->apply();
     }
 }    // namespace hpx::parcelset::detail
@@ -0,0 +1,250 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING)
+#include <hpx/assert.hpp>
+#include <hpx/modules/errors.hpp>
+
+#include <hpx/parcelset/detail/parcel_stripes.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace hpx::parcelset::detail {
+
+    namespace {
+
+        // reads the fields of a stripe descriptor
+        struct descriptor_reader
+        {
+            template <typename T>
+            T read()
+            {
+                if (size_ < sizeof(T))
+                {
+                    HPX_THROW_EXCEPTION(serialization_error,
+                        "parcel_stripes::add", "truncated stripe descriptor");
+                }
+
+                T value;
+                std::memcpy(&value, data_, sizeof(T));
+                data_ += sizeof(T);
+                size_ -= sizeof(T);
+                return value;
+            }
+
+            char const* data_;
+            std::size_t size_;
+        };
+    }    // namespace
+
+    bool parcel_stripes::add(char const* descriptor, std::size_t size,
+        std::vector<std::vector<char>>&& pieces, buffer_type& message)
+    {
+        descriptor_reader reader{descriptor, size};
+
+        [[maybe_unused]] auto const magic = reader.read<std::uint64_t>();
+        HPX_ASSERT(magic == stripe_magic);
+
+        auto const message_id = reader.read<std::uint64_t>();
+        auto const source = reader.read<std::uint32_t>();
+        auto const stripe = reader.read<std::uint32_t>();
+        auto const num_stripes = reader.read<std::uint32_t>();
+        auto const num_pieces = reader.read<std::uint32_t>();
+
+        if (stripe >= num_stripes || num_pieces != pieces.size())
+        {
+            HPX_THROW_EXCEPTION(serialization_error, "parcel_stripes::add",
+                "inconsistent stripe descriptor");
+        }
+
+        // the first stripe describes the original message
+        buffer_type header;
+        if (stripe == 0)
+        {
+            header.size_ = reader.read<std::uint64_t>();
+            header.data_size_ = reader.read<std::uint64_t>();
+            header.num_chunks_.first = reader.read<std::uint32_t>();
+            header.num_chunks_.second = reader.read<std::uint32_t>();
+
+            std::size_t const num_chunks =
+                std::size_t(header.num_chunks_.first) +
+                header.num_chunks_.second;
+            if (num_chunks * 2 * sizeof(std::uint64_t) > reader.size_)
+            {
+                HPX_THROW_EXCEPTION(serialization_error, "parcel_stripes::add",
+                    "truncated stripe descriptor");
+            }
+
+            header.transmission_chunks_.reserve(num_chunks);
+            for (std::size_t i = 0; i != num_chunks; ++i)
+            {
+                auto const first = reader.read<std::uint64_t>();
+                auto const second = reader.read<std::uint64_t>();
+                header.transmission_chunks_.emplace_back(first, second);
+            }
+        }
+
+        std::vector<piece> descriptors;
+        descriptors.reserve(num_pieces);
+        for (std::uint32_t i = 0; i != num_pieces; ++i)
+        {
+            piece p;
+            p.chunk = reader.read<std::uint64_t>();
+            p.offset = reader.read<std::uint64_t>();
+            p.size = reader.read<std::uint64_t>();
+            if (p.size != pieces[i].size())
+            {
+                HPX_THROW_EXCEPTION(serialization_error, "parcel_stripes::add",
+                    "stripe piece size mismatch");
+            }
+            descriptors.push_back(p);
+        }
+
+        message_stripes complete;
+        {
+            std::lock_guard l(mtx_);
+
+            message_stripes& stripes = messages_[key_type(source, message_id)];
+            if (stripes.received == 0)
+            {
+                stripes.num_stripes = num_stripes;
+            }
+            else if (stripes.num_stripes != num_stripes)
+            {
+                HPX_THROW_EXCEPTION(serialization_error, "parcel_stripes::add",
+                    "inconsistent number of stripes");
+            }
+
+            if (stripe == 0)
+            {
+                stripes.has_header = true;
+                stripes.message = HPX_MOVE(header);
+            }
+
+            stripes.pieces.insert(
+                stripes.pieces.end(), descriptors.begin(), descriptors.end());
+            for (std::vector<char>& data : pieces)
+            {
+                stripes.data.push_back(HPX_MOVE(data));
+            }
+
+            if (++stripes.received != stripes.num_stripes)
+            {
+                return false;
+            }
+
+            auto it = messages_.find(key_type(source, message_id));
+            complete = HPX_MOVE(it->second);
+            messages_.erase(it);
+        }
+
+        assemble(complete, message);
+        return true;
+    }
+
+    std::size_t parcel_stripes::size() const
+    {
+        std::lock_guard l(mtx_);
+        return messages_.size();
+    }
+
+    // Put the pieces of all stripes at their place in the original message.
+    // Zero-copy chunks which were sent as a whole are moved, only chunks
+    // which were split across stripes are copied.
+    void parcel_stripes::assemble(
+        message_stripes& stripes, buffer_type& message)
+    {
+        if (!stripes.has_header)
+        {
+            HPX_THROW_EXCEPTION(serialization_error,
+                "parcel_stripes::assemble",
+                "the stripe describing the message is missing");
+        }
+
+        message = HPX_MOVE(stripes.message);
+
+        std::size_t const num_zero_copy_chunks =
+            static_cast<std::size_t>(message.num_chunks_.first);
+        message.chunks_.resize(num_zero_copy_chunks);
+
+        std::vector<std::uint64_t> received(num_zero_copy_chunks, 0);
+        bool has_data = false;
+
+        for (std::size_t i = 0; i != stripes.pieces.size(); ++i)
+        {
+            piece const& p = stripes.pieces[i];
+            std::vector<char>& data = stripes.data[i];
+
+            if (p.chunk == stripe_data_chunk)
+            {
+                if (p.offset != 0 || p.size != message.size_)
+                {
+                    HPX_THROW_EXCEPTION(serialization_error,
+                        "parcel_stripes::assemble",
+                        "invalid main buffer of striped message");
+                }
+                message.data_ = HPX_MOVE(data);
+                has_data = true;
+                continue;
+            }
+
+            std::size_t const chunk = static_cast<std::size_t>(p.chunk);
+            if (chunk >= num_zero_copy_chunks)
+            {
+                HPX_THROW_EXCEPTION(serialization_error,
+                    "parcel_stripes::assemble",
+                    "invalid chunk index in striped message");
+            }
+
+            std::uint64_t const chunk_size =
+                message.transmission_chunks_[chunk].second;
+            if (p.offset > chunk_size || p.size > chunk_size - p.offset)
+            {
+                HPX_THROW_EXCEPTION(serialization_error,
+                    "parcel_stripes::assemble",
+                    "invalid chunk piece in striped message");
+            }
+
+            std::vector<char>& c = message.chunks_[chunk];
+            if (p.size == chunk_size)
+            {
+                c = HPX_MOVE(data);
+            }
+            else
+            {
+                c.resize(static_cast<std::size_t>(chunk_size));
+                std::memcpy(c.data() + p.offset, data.data(),
+                    static_cast<std::size_t>(p.size));
+            }
+            received[chunk] += p.size;
+        }
+
+        if (!has_data)
+        {
+            HPX_THROW_EXCEPTION(serialization_error,
+                "parcel_stripes::assemble",
+                "the main buffer of the striped message is missing");
+        }
+
+        for (std::size_t i = 0; i != num_zero_copy_chunks; ++i)
+        {
+            if (received[i] != message.transmission_chunks_[i].second)
+            {
+                HPX_THROW_EXCEPTION(serialization_error,
+                    "parcel_stripes::assemble", "incomplete striped message");
+            }
+        }
+    }
+}    // namespace hpx::parcelset::detail
+
+#endif
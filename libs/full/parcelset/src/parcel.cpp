@@ -9,6 +9,7 @@
 
 #if defined(HPX_HAVE_NETWORKING)
 #include <hpx/assert.hpp>
+#include <hpx/modules/allocator_support.hpp>
 #include <hpx/modules/datastructures.hpp>
 #include <hpx/modules/format.hpp>
 #include <hpx/modules/itt_notify.hpp>
@@ -24,6 +25,7 @@
 #include <hpx/naming/detail/preprocess_gid_types.hpp>
 #include <hpx/parcelset/parcel.hpp>
 #include <hpx/parcelset/parcelhandler.hpp>
+#include <hpx/parcelset_base/parcel_flight_recorder.hpp>
 #include <hpx/parcelset_base/parcel_interface.hpp>
 
 #include <cstddef>
@@ -186,6 +188,18 @@ namespace hpx::parcelset::detail {
 
     parcel::~parcel() = default;
 
+    void* parcel::operator new(std::size_t size)
+    {
+        util::internal_allocator<char> alloc;
+        return alloc.allocate(size);
+    }
+
+    void parcel::operator delete(void* p, std::size_t size) noexcept
+    {
+        util::internal_allocator<char> alloc;
+        alloc.deallocate(static_cast<char*>(p), size);
+    }
+
     parcel::parcel(naming::gid_type&& dest, naming::address&& addr,
         std::unique_ptr<actions::base_action> act)
       : data_(HPX_MOVE(dest), HPX_MOVE(addr), act->has_continuation())
@@ -367,6 +381,19 @@ namespace hpx::parcelset::detail {
         split_gids_ = HPX_MOVE(split_gids);
     }
 
+    parcel::serialized_segments_type parcel::move_serialized_segments() const
+    {
+        serialized_segments_type segments;
+        std::swap(segments, serialized_segments_);
+        return segments;
+    }
+
+    void parcel::set_serialized_segments(serialized_segments_type&& segments)
+    {
+        HPX_ASSERT(serialized_segments_.empty());
+        serialized_segments_ = HPX_MOVE(segments);
+    }
+
     std::size_t parcel::num_chunks() const
     {
         return num_chunks_;
@@ -438,6 +465,9 @@ namespace hpx::parcelset::detail {
     bool parcel::load_schedule(serialization::input_archive& ar,
         std::size_t num_thread, bool& deferred_schedule)
     {
+#if defined(HPX_HAVE_PARCEL_PROFILING)
+        std::uint64_t const flight_start = parcel_flight_begin();
+#endif
         load_data(ar);
 
         // make sure this parcel destination matches the proper locality
@@ -455,10 +485,19 @@ namespace hpx::parcelset::detail {
             return true;
         }
 
+#if defined(HPX_HAVE_PARCEL_PROFILING)
+        received_parcel_flight flight(
+            flight_start, action_->get_action_name(), data_.parcel_id_);
+#endif
+
         // continuation support, this is handled in the transfer action
         action_->load_schedule(ar, HPX_MOVE(data_.dest_), p.first, p.second,
             num_thread, deferred_schedule);
 
+#if defined(HPX_HAVE_PARCEL_PROFILING)
+        flight.finish(deferred_schedule);
+#endif
+
 #if HPX_HAVE_ITTNOTIFY != 0 && !defined(HPX_HAVE_APEX)
         static util::itt::event parcel_recv("recv_parcel");
         util::itt::event_tick(parcel_recv);
@@ -491,10 +530,20 @@ namespace hpx::parcelset::detail {
             return true;
         }
 
+#if defined(HPX_HAVE_PARCEL_PROFILING)
+        // the parcel was de-serialized already
+        received_parcel_flight flight(parcel_flight_begin(),
+            action_->get_action_name(), data_.parcel_id_, true);
+#endif
+
         // dispatch action, register work item either with or without
         // continuation support, this is handled in the transfer action
         action_->schedule_thread(
             HPX_MOVE(data_.dest_), p.first, p.second, num_thread);
+
+#if defined(HPX_HAVE_PARCEL_PROFILING)
+        flight.finish(false);
+#endif
         return false;
     }
 
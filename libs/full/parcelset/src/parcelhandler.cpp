@@ -35,6 +35,7 @@
 #include <hpx/parcelset/message_handler_fwd.hpp>
 #include <hpx/parcelset/parcelhandler.hpp>
 #include <hpx/parcelset/static_parcelports.hpp>
+#include <hpx/parcelset_base/buffer_pool.hpp>
 #include <hpx/parcelset_base/policies/message_handler.hpp>
 #include <hpx/plugin_factories/parcelport_factory_base.hpp>
 
@@ -86,7 +87,16 @@ namespace hpx::parcelset {
       , enable_parcel_handling_(true)
       , load_message_handlers_(
             util::get_entry_as<int>(cfg, "hpx.parcel.message_handlers", 0) != 0)
+      , aggregate_parcels_(
+            util::get_entry_as<int>(cfg, "hpx.parcel.aggregation", 1) != 0)
+      , max_aggregated_parcels_((std::max)(
+            util::get_entry_as<std::size_t>(
+                cfg, "hpx.parcel.aggregation_max_parcels", 64),
+            std::size_t(1)))
       , count_routed_(0)
+      , invoke_locally_(
+            util::get_entry_as<int>(cfg, "hpx.parcel.local_invocation", 1) != 0)
+      , count_invoked_locally_(0)
       , write_handler_(&default_write_handler)
 #if defined(HPX_HAVE_NETWORKING)
       , is_networking_enabled_(cfg.enable_networking())
@@ -94,6 +104,13 @@ namespace hpx::parcelset {
       , is_networking_enabled_(false)
 #endif
     {
+        buffer_pool::instance().configure(
+            util::get_entry_as<int>(cfg, "hpx.parcel.buffer_pool", 1) != 0,
+            util::get_entry_as<std::size_t>(
+                cfg, "hpx.parcel.buffer_pool_max_size", 16777216),
+            util::get_entry_as<std::size_t>(
+                cfg, "hpx.parcel.buffer_pool_max_buffers", 64));
+
         LPROGRESS_;
     }
 
@@ -335,12 +352,87 @@ namespace hpx::parcelset {
         agas::remove_resolved_locality(gid);
     }
 
+    ///////////////////////////////////////////////////////////////////////////
+    std::size_t parcelhandler::warm_up_connections(
+        std::vector<naming::gid_type> const& locality_ids)
+    {
+        // group the destinations by the parcelport used to reach them
+        std::map<parcelport*, std::vector<locality>> dests;
+        for (naming::gid_type const& gid : locality_ids)
+        {
+            if (gid == agas::get_locality())
+            {
+                continue;
+            }
+
+            try
+            {
+                std::pair<std::shared_ptr<parcelport>, locality> dest =
+                    find_appropriate_destination(gid);
+                dests[dest.first.get()].push_back(HPX_MOVE(dest.second));
+            }
+            catch (hpx::exception const&)
+            {
+                // the locality will be connected to lazily
+                LPT_(warning)
+                    << "parcelhandler::warm_up_connections: could not resolve "
+                    << "locality " << gid;
+            }
+        }
+
+        std::size_t connected = 0;
+        for (auto const& p : dests)
+        {
+            connected += p.first->warm_up_connections(p.second);
+        }
+        return connected;
+    }
+
+    std::size_t parcelhandler::warm_up_connections()
+    {
+        std::string const targets =
+            get_config_entry("hpx.parcel.warm_up_connections", "none");
+        if (targets.empty() || targets == "none")
+        {
+            return 0;
+        }
+
+        std::vector<naming::gid_type> locality_ids;
+        if (targets == "all")
+        {
+            get_raw_remote_localities(locality_ids);
+        }
+        else
+        {
+            std::vector<std::string> ids;
+            hpx::string_util::split(
+                ids, targets, hpx::string_util::is_any_of(","));
+
+            for (std::string const& id : ids)
+            {
+                if (!id.empty())
+                {
+                    locality_ids.push_back(naming::get_gid_from_locality_id(
+                        hpx::util::from_string<std::uint32_t>(id)));
+                }
+            }
+        }
+
+        return warm_up_connections(locality_ids);
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     bool parcelhandler::do_background_work(std::size_t num_thread,
         bool stop_buffering, parcelport_background_mode mode)
     {
         bool did_some_work = false;
 
+        // send all aggregated parcels if no more parcels should be buffered
+        if (stop_buffering)
+        {
+            did_some_work = flush_aggregated_parcels();
+        }
+
         // flush all parcel buffers
         if (is_networking_enabled_ && 0 == num_thread &&
             (mode & parcelport_background_mode_flush_buffers))
@@ -385,6 +477,9 @@ namespace hpx::parcelset {
 
     void parcelhandler::flush_parcels()
     {
+        // hand all aggregated parcels to the parcel ports
+        flush_aggregated_parcels();
+
         // now flush all parcel ports to be shut down
         for (pports_type::value_type& pp : pports_)
         {
@@ -590,6 +685,13 @@ namespace hpx::parcelset {
             resolved_locally = agas::resolve_local(gid, addr);
         }
 
+        // There is no need to send parcels to ourselves, the action is
+        // scheduled right away instead
+        if (resolved_locally && invoke_locally(p, f))
+        {
+            return;
+        }
+
         write_handler_type wrapped_f =
             hpx::bind_front(&detail::parcel_sent_handler, HPX_MOVE(f));
 
@@ -617,6 +719,15 @@ namespace hpx::parcelset {
                 }
             }
 
+            // collect the parcels sent by this thread to the same
+            // destination, they are sent together once it suspends
+            if (aggregate_parcels_ && nullptr != threads::get_self_ptr() &&
+                !hpx::is_stopped_or_shutting_down())
+            {
+                aggregate_parcel(dest, HPX_MOVE(p), HPX_MOVE(wrapped_f));
+                return;
+            }
+
             dest.first->put_parcel(
                 dest.second, HPX_MOVE(p), HPX_MOVE(wrapped_f));
             return;
@@ -629,6 +740,133 @@ namespace hpx::parcelset {
         agas::route(HPX_MOVE(p), HPX_MOVE(wrapped_f));
     }
 
+    bool parcelhandler::invoke_locally(parcel& p, write_handler_type& f)
+    {
+        if (!invoke_locally_ ||
+            p.destination_locality() != agas::get_locality() ||
+            !hpx::threads::threadmanager_is(hpx::state::running))
+        {
+            return false;
+        }
+
+        ++count_invoked_locally_;
+
+        // the parcel owns the arguments of the action already, scheduling it
+        // directly skips the serialization and the action factory
+        if (p.schedule_action())
+        {
+            // the object was migrated away in the meantime, route the parcel
+            // to its new location
+            ++count_routed_;
+            agas::route(HPX_MOVE(p),
+                hpx::bind_front(&detail::parcel_sent_handler, HPX_MOVE(f)));
+            return true;
+        }
+
+        f(std::error_code(), p);
+        return true;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    void parcelhandler::aggregate_parcel(
+        std::pair<std::shared_ptr<parcelport>, locality> const& dest,
+        parcel&& p, write_handler_type&& f)
+    {
+        aggregated_parcels full;
+        bool schedule_flush = false;
+
+        {
+            std::lock_guard<mutex_type> l(aggregation_mtx_);
+
+            auto it = aggregated_parcels_.find(dest.second);
+            if (it == aggregated_parcels_.end())
+            {
+                it = aggregated_parcels_
+                         .emplace(dest.second, aggregated_parcels())
+                         .first;
+                it->second.pp = dest.first;
+                schedule_flush = true;
+            }
+
+            it->second.parcels.push_back(HPX_MOVE(p));
+            it->second.handlers.push_back(HPX_MOVE(f));
+
+            if (it->second.parcels.size() >= max_aggregated_parcels_)
+            {
+                full = HPX_MOVE(it->second);
+                aggregated_parcels_.erase(it);
+            }
+        }
+
+        if (full.pp)
+        {
+            full.pp->put_parcels(
+                dest.second, HPX_MOVE(full.parcels), HPX_MOVE(full.handlers));
+            return;
+        }
+
+        if (schedule_flush)
+        {
+            // The new thread is scheduled with high priority, it will run
+            // as soon as the current thread suspends or terminates.
+            void (parcelhandler::*flush_ptr)(locality const&) =
+                &parcelhandler::flush_aggregated_parcels;
+
+            error_code ec(throwmode::lightweight);
+            threads::thread_init_data data(
+                threads::make_thread_function_nullary(
+                    util::deferred_call(flush_ptr, this, dest.second)),
+                "parcelhandler::flush_aggregated_parcels",
+                threads::thread_priority::boost,
+                threads::thread_schedule_hint(),
+                threads::thread_stacksize::medium,
+                threads::thread_schedule_state::pending, true);
+            threads::register_thread(data, ec);
+            if (ec)
+            {
+                flush_aggregated_parcels(dest.second);
+            }
+        }
+    }
+
+    void parcelhandler::flush_aggregated_parcels(locality const& dest)
+    {
+        aggregated_parcels parcels;
+
+        {
+            std::lock_guard<mutex_type> l(aggregation_mtx_);
+
+            auto it = aggregated_parcels_.find(dest);
+            if (it == aggregated_parcels_.end())
+            {
+                return;    // already sent
+            }
+
+            parcels = HPX_MOVE(it->second);
+            aggregated_parcels_.erase(it);
+        }
+
+        parcels.pp->put_parcels(
+            dest, HPX_MOVE(parcels.parcels), HPX_MOVE(parcels.handlers));
+    }
+
+    bool parcelhandler::flush_aggregated_parcels()
+    {
+        aggregated_parcels_map parcels;
+
+        {
+            std::lock_guard<mutex_type> l(aggregation_mtx_);
+            std::swap(parcels, aggregated_parcels_);
+        }
+
+        for (auto& p : parcels)
+        {
+            p.second.pp->put_parcels(p.first, HPX_MOVE(p.second.parcels),
+                HPX_MOVE(p.second.handlers));
+        }
+        return !parcels.empty();
+    }
+
     void parcelhandler::put_parcels(std::vector<parcel> parcels)
     {
         std::vector<write_handler_type> handlers(parcels.size(),
@@ -736,6 +974,11 @@ namespace hpx::parcelset {
                 return;
             }
 
+            if (resolved_locally && invoke_locally(p, handlers[i]))
+            {
+                continue;
+            }
+
             // If we were able to resolve the address(es) locally we would send
             // the parcel directly to the destination.
             if (resolved_locally)
@@ -983,6 +1226,12 @@ namespace hpx::parcelset {
     {
         return util::get_and_reset_value(count_routed_, reset);
     }
+
+    // number of parcels invoked locally
+    std::int64_t parcelhandler::get_parcel_local_invocation_count(bool reset)
+    {
+        return util::get_and_reset_value(count_invoked_locally_, reset);
+    }
 #if defined(HPX_HAVE_PARCELPORT_COUNTERS)
     // number of parcels sent
     std::int64_t parcelhandler::get_parcel_send_count(
@@ -1256,6 +1505,16 @@ namespace hpx::parcelset {
         return pp ? pp->get_connection_cache_statistics(stat_type, reset) : 0;
     }
 
+    // compression statistics
+    std::int64_t parcelhandler::get_compression_statistics(
+        std::string const& pp_type,
+        parcelport::compression_statistics_type stat_type, bool reset) const
+    {
+        error_code ec(throwmode::lightweight);
+        parcelport* pp = find_parcelport(pp_type, ec);
+        return pp ? pp->get_compression_statistics(stat_type, reset) : 0;
+    }
+
     std::vector<plugins::parcelport_factory_base*>&
     parcelhandler::get_parcelport_factories()
     {
@@ -1314,8 +1573,19 @@ namespace hpx::parcelset {
         ini_defs.emplace_back(
             "zero_copy_optimization = ${HPX_PARCEL_ZERO_COPY_OPTIMIZATION:"
             "$[hpx.parcel.array_optimization]}");
+        ini_defs.emplace_back(
+            "varint_encoding = ${HPX_PARCEL_VARINT_ENCODING:0}");
+        ini_defs.emplace_back("parallel_serialization = "
+                              "${HPX_PARCEL_PARALLEL_SERIALIZATION:0}");
+        ini_defs.emplace_back("parallel_serialization_threshold = "
+                              "${HPX_PARCEL_PARALLEL_SERIALIZATION_THRESHOLD:"
+                              "65536}");
         ini_defs.emplace_back(
             "async_serialization = ${HPX_PARCEL_ASYNC_SERIALIZATION:1}");
+        ini_defs.emplace_back(
+            "arena_allocation = ${HPX_PARCEL_ARENA_ALLOCATION:0}");
+        ini_defs.emplace_back(
+            "arena_block_size = ${HPX_PARCEL_ARENA_BLOCK_SIZE:16384}");
 #if defined(HPX_HAVE_PARCEL_COALESCING)
         ini_defs.emplace_back(
             "message_handlers = ${HPX_PARCEL_MESSAGE_HANDLERS:1}");
@@ -1329,6 +1599,50 @@ namespace hpx::parcelset {
                 HPX_ZERO_COPY_SERIALIZATION_THRESHOLD) "}");
         ini_defs.emplace_back("max_background_threads = "
                               "${HPX_PARCEL_MAX_BACKGROUND_THREADS:-1}");
+        ini_defs.emplace_back("stripes = ${HPX_PARCEL_STRIPES:1}");
+        ini_defs.emplace_back(
+            "stripe_threshold = ${HPX_PARCEL_STRIPE_THRESHOLD:1048576}");
+        ini_defs.emplace_back(
+            "local_invocation = ${HPX_PARCEL_LOCAL_INVOCATION:1}");
+        ini_defs.emplace_back("aggregation = ${HPX_PARCEL_AGGREGATION:1}");
+        ini_defs.emplace_back("aggregation_max_parcels = "
+                              "${HPX_PARCEL_AGGREGATION_MAX_PARCELS:64}");
+        ini_defs.emplace_back("buffer_pool = ${HPX_PARCEL_BUFFER_POOL:1}");
+        ini_defs.emplace_back("buffer_pool_max_size = "
+                              "${HPX_PARCEL_BUFFER_POOL_MAX_SIZE:16777216}");
+        ini_defs.emplace_back("buffer_pool_max_buffers = "
+                              "${HPX_PARCEL_BUFFER_POOL_MAX_BUFFERS:64}");
+        ini_defs.emplace_back(
+            "priority_lanes = ${HPX_PARCEL_PRIORITY_LANES:1}");
+        ini_defs.emplace_back("priority_lane_share = "
+                              "${HPX_PARCEL_PRIORITY_LANE_SHARE:75}");
+        ini_defs.emplace_back("compression_threshold = "
+                              "${HPX_PARCEL_COMPRESSION_THRESHOLD:0}");
+        ini_defs.emplace_back(
+            "adaptive_compression = ${HPX_PARCEL_ADAPTIVE_COMPRESSION:0}");
+        ini_defs.emplace_back(
+            "adaptive_compression_min_ratio = "
+            "${HPX_PARCEL_ADAPTIVE_COMPRESSION_MIN_RATIO:1.2}");
+        ini_defs.emplace_back(
+            "adaptive_compression_bandwidth = "
+            "${HPX_PARCEL_ADAPTIVE_COMPRESSION_BANDWIDTH:125}");
+        ini_defs.emplace_back("adaptive_compression_window = "
+                              "${HPX_PARCEL_ADAPTIVE_COMPRESSION_WINDOW:8}");
+        ini_defs.emplace_back(
+            "adaptive_compression_probe_interval = "
+            "${HPX_PARCEL_ADAPTIVE_COMPRESSION_PROBE_INTERVAL:64}");
+        ini_defs.emplace_back("adaptive_direct_execution = "
+                              "${HPX_PARCEL_ADAPTIVE_DIRECT_EXECUTION:0}");
+        ini_defs.emplace_back(
+            "adaptive_direct_execution_threshold = "
+            "${HPX_PARCEL_ADAPTIVE_DIRECT_EXECUTION_THRESHOLD:10}");
+        ini_defs.emplace_back(
+            "adaptive_direct_execution_samples = "
+            "${HPX_PARCEL_ADAPTIVE_DIRECT_EXECUTION_SAMPLES:16}");
+        ini_defs.emplace_back("warm_up_connections = "
+                              "${HPX_PARCEL_WARM_UP_CONNECTIONS:none}");
+        ini_defs.emplace_back("warm_up_concurrency = "
+                              "${HPX_PARCEL_WARM_UP_CONCURRENCY:16}");
 
         for (plugins::parcelport_factory_base* f :
             parcelhandler::get_parcelport_factories())
@@ -0,0 +1,115 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify that the connection cache distributes the destinations over its
+// shards without changing the caching behavior seen by one destination.
+
+#include <hpx/config.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/parcelset/connection_cache.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+struct connection
+{
+};
+
+// destination which can be hashed, like parcelset::locality
+struct destination
+{
+    std::size_t id;
+
+    std::size_t hash() const noexcept
+    {
+        return id;
+    }
+
+    friend bool operator<(destination const& lhs, destination const& rhs)
+    {
+        return lhs.id < rhs.id;
+    }
+};
+
+using cache_type = hpx::util::connection_cache<connection, destination>;
+using connection_type = cache_type::connection_type;
+
+void test_num_shards()
+{
+    // every shard has to be able to hold the connections to one destination
+    HPX_TEST_EQ(cache_type(512, 4).num_shards(), std::size_t(16));
+    HPX_TEST_EQ(cache_type(512, 4, 64).num_shards(), std::size_t(64));
+    HPX_TEST_EQ(cache_type(16, 4, 64).num_shards(), std::size_t(4));
+    HPX_TEST_EQ(cache_type(4, 4).num_shards(), std::size_t(1));
+
+    // keys which can't be hashed end up in a single shard
+    HPX_TEST_EQ((hpx::util::connection_cache<connection, int>(512, 4, 16)
+                        .num_shards()),
+        std::size_t(1));
+}
+
+void test_get_or_reserve()
+{
+    cache_type cache(64, 2, 8);
+    std::size_t const num_destinations = 16;
+
+    // reserve and reclaim one connection per destination
+    std::vector<connection_type> connections;
+    for (std::size_t i = 0; i != num_destinations; ++i)
+    {
+        connection_type conn;
+        HPX_TEST(cache.get_or_reserve(destination{i}, conn));
+        HPX_TEST(!conn);
+
+        conn = std::make_shared<connection>();
+        connections.push_back(conn);
+        cache.reclaim(destination{i}, conn);
+    }
+    HPX_TEST_EQ(cache.get_cache_insertions(false), std::int64_t(16));
+    HPX_TEST_EQ(cache.get_cache_reclaims(false), std::int64_t(16));
+
+    // every destination gets its own connection back
+    for (std::size_t i = 0; i != num_destinations; ++i)
+    {
+        connection_type conn;
+        HPX_TEST(cache.get_or_reserve(destination{i}, conn));
+        HPX_TEST(conn == connections[i]);
+
+        // a second connection may be created
+        connection_type second;
+        HPX_TEST(cache.get_or_reserve(destination{i}, second));
+        HPX_TEST(!second);
+
+        // but not more than the maximum per destination
+        connection_type third;
+        HPX_TEST(!cache.get_or_reserve(destination{i}, third));
+        HPX_TEST(cache.full(destination{i}));
+
+        cache.clear(destination{i}, second);
+        cache.reclaim(destination{i}, conn);
+    }
+    HPX_TEST_EQ(cache.get_cache_hits(true), std::int64_t(16));
+    HPX_TEST_EQ(cache.get_cache_hits(false), std::int64_t(0));
+    HPX_TEST(!cache.full());
+
+    // removing a destination doesn't affect the others
+    cache.clear(destination{0});
+    for (std::size_t i = 0; i != num_destinations; ++i)
+    {
+        connection_type conn = cache.get(destination{i});
+        HPX_TEST(i == 0 ? !conn : conn == connections[i]);
+    }
+}
+
+int main()
+{
+    test_num_shards();
+    test_get_or_reserve();
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,132 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify that parcels targeting the sending locality are invoked directly,
+// without serializing their arguments.
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+std::atomic<std::size_t> serialized(0);
+
+struct counted
+{
+    int value = 0;
+
+    template <typename Archive>
+    void serialize(Archive& ar, unsigned)
+    {
+        ++serialized;
+
+        // clang-format off
+        ar & value;
+        // clang-format on
+    }
+};
+
+int get_value(counted const& c)
+{
+    return c.value;
+}
+HPX_PLAIN_ACTION(get_value)
+
+///////////////////////////////////////////////////////////////////////////////
+hpx::parcelset::parcel generate_parcel(
+    hpx::id_type const& dest_id, hpx::id_type const& cont, int value)
+{
+    hpx::naming::address addr;
+    hpx::naming::gid_type dest = dest_id.get_gid();
+    hpx::parcelset::parcel p(hpx::parcelset::detail::create_parcel::call(
+        std::move(dest), std::move(addr),
+        hpx::actions::typed_continuation<int>(cont), get_value_action(),
+        hpx::threads::thread_priority::normal, counted{value}));
+
+    p.set_source_id(hpx::find_here());
+    return p;
+}
+
+hpx::parcelset::parcelhandler& get_parcel_handler()
+{
+    return hpx::get_runtime_distributed().get_parcel_handler();
+}
+
+void test_put_parcel()
+{
+    std::int64_t const invoked =
+        get_parcel_handler().get_parcel_local_invocation_count(false);
+
+    hpx::distributed::promise<int> p;
+    hpx::future<int> f = p.get_future();
+
+    get_parcel_handler().put_parcel(
+        generate_parcel(hpx::find_here(), p.get_id(), 42));
+
+    HPX_TEST_EQ(f.get(), 42);
+    HPX_TEST_EQ(get_parcel_handler().get_parcel_local_invocation_count(false),
+        invoked + 1);
+}
+
+void test_put_parcels()
+{
+    std::size_t const num_parcels = 10;
+
+    std::int64_t const invoked =
+        get_parcel_handler().get_parcel_local_invocation_count(false);
+
+    std::vector<hpx::future<int>> results;
+    std::vector<hpx::parcelset::parcel> parcels;
+    for (std::size_t i = 0; i != num_parcels; ++i)
+    {
+        hpx::distributed::promise<int> p;
+        results.push_back(p.get_future());
+        parcels.push_back(
+            generate_parcel(hpx::find_here(), p.get_id(), int(i)));
+    }
+
+    get_parcel_handler().put_parcels(std::move(parcels));
+
+    for (std::size_t i = 0; i != num_parcels; ++i)
+    {
+        HPX_TEST_EQ(results[i].get(), int(i));
+    }
+    HPX_TEST_EQ(get_parcel_handler().get_parcel_local_invocation_count(false),
+        invoked + std::int64_t(num_parcels));
+}
+
+int hpx_main()
+{
+    test_put_parcel();
+    test_put_parcels();
+
+    // none of the arguments had to be serialized
+    HPX_TEST_EQ(serialized.load(), std::size_t(0));
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // explicitly disable message handlers (parcel coalescing)
+    std::vector<std::string> const cfg = {"hpx.parcel.message_handlers=0"};
+
+    hpx::init_params init_args;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ(hpx::init(argc, argv, init_args), 0);
+    return hpx::util::report_errors();
+}
+#endif
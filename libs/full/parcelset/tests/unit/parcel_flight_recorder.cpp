@@ -0,0 +1,127 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify that the parcel flight recorder records all stages of the parcels
+// sent to the remote localities.
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_main.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/parcelset_base/parcel_flight_recorder.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#if defined(HPX_HAVE_PARCEL_PROFILING) && defined(HPX_HAVE_NETWORKING)
+using hpx::parcelset::parcel_stage;
+
+std::size_t const num_parcels = 100;
+char const* const action_name = "flight_work_action";
+
+///////////////////////////////////////////////////////////////////////////////
+int flight_work(int i)
+{
+    return i;
+}
+HPX_PLAIN_ACTION(flight_work)
+
+void enable_recording()
+{
+    hpx::parcelset::enable_parcel_flight_recording(true);
+}
+HPX_PLAIN_ACTION(enable_recording)
+
+std::uint64_t get_stage_count(int stage)
+{
+    return hpx::parcelset::get_parcel_stage_statistics(
+        action_name, static_cast<parcel_stage>(stage))
+        .count;
+}
+HPX_PLAIN_ACTION(get_stage_count)
+
+///////////////////////////////////////////////////////////////////////////////
+// the stages recorded after the result was sent may take a moment
+std::uint64_t wait_for_stage_count(hpx::id_type const& id, parcel_stage stage)
+{
+    std::uint64_t count = 0;
+    for (int i = 0; i != 100; ++i)
+    {
+        count = get_stage_count_action()(id, static_cast<int>(stage));
+        if (count >= num_parcels)
+        {
+            break;
+        }
+        hpx::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    return count;
+}
+
+void test_flight_recorder(hpx::id_type const& id)
+{
+    enable_recording_action()(id);
+
+    std::vector<hpx::future<int>> futures;
+    futures.reserve(num_parcels);
+    for (std::size_t i = 0; i != num_parcels; ++i)
+    {
+        futures.push_back(hpx::async<flight_work_action>(id, int(i)));
+    }
+    hpx::wait_all(futures);
+
+    // the stages recorded by the sending locality
+    hpx::id_type const here = hpx::find_here();
+    HPX_TEST_EQ(wait_for_stage_count(here, parcel_stage::send_queue),
+        std::uint64_t(num_parcels));
+    HPX_TEST_EQ(wait_for_stage_count(here, parcel_stage::serialization),
+        std::uint64_t(num_parcels));
+    HPX_TEST_EQ(wait_for_stage_count(here, parcel_stage::wire),
+        std::uint64_t(num_parcels));
+
+    // the stages recorded by the receiving locality
+    HPX_TEST_EQ(wait_for_stage_count(id, parcel_stage::deserialization),
+        std::uint64_t(num_parcels));
+    HPX_TEST_EQ(wait_for_stage_count(id, parcel_stage::execution),
+        std::uint64_t(num_parcels));
+
+    // the sent parcels are recorded individually
+    std::size_t serialized = 0;
+    for (auto const& record : hpx::parcelset::get_parcel_flight_records())
+    {
+        if (record.stage == parcel_stage::serialization &&
+            std::string(record.action) == action_name)
+        {
+            HPX_TEST(record.parcel_id);
+            ++serialized;
+        }
+    }
+    HPX_TEST_EQ(serialized, num_parcels);
+}
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+#if defined(HPX_HAVE_PARCEL_PROFILING) && defined(HPX_HAVE_NETWORKING)
+    hpx::parcelset::enable_parcel_flight_recording(true);
+    HPX_TEST(hpx::parcelset::is_parcel_flight_recording_enabled());
+
+    for (hpx::id_type const& id : hpx::find_remote_localities())
+    {
+        test_flight_recorder(id);
+    }
+
+    hpx::parcelset::enable_parcel_flight_recording(false);
+    HPX_TEST(!hpx::parcelset::is_parcel_flight_recording_enabled());
+#endif
+
+    return hpx::util::report_errors();
+}
+#endif
@@ -0,0 +1,123 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify that large messages which are split into stripes are reassembled
+// correctly, independently of the order the stripes are received in.
+
+#include <hpx/config.hpp>
+#include <hpx/modules/serialization.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/parcelset/detail/parcel_stripes.hpp>
+#include <hpx/parcelset/encode_parcels.hpp>
+#include <hpx/parcelset/parcel_buffer.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <random>
+#include <utility>
+#include <vector>
+
+using send_buffer_type = hpx::parcelset::parcel_buffer<std::vector<char>>;
+using receive_buffer_type = hpx::parcelset::detail::parcel_stripes::buffer_type;
+
+std::vector<char> make_data(std::size_t size, char first)
+{
+    std::vector<char> data(size);
+    std::iota(data.begin(), data.end(), first);
+    return data;
+}
+
+// emulate the transfer of a stripe, the zero-copy chunks end up in separate
+// buffers on the receiving end
+receive_buffer_type transfer(send_buffer_type const& stripe)
+{
+    receive_buffer_type received;
+    received.data_ = stripe.data_;
+    received.size_ = stripe.size_;
+    received.data_size_ = stripe.data_size_;
+    received.num_chunks_ = stripe.num_chunks_;
+    received.transmission_chunks_ = stripe.transmission_chunks_;
+    for (auto const& c : stripe.chunks_)
+    {
+        HPX_TEST(
+            c.type_ == hpx::serialization::chunk_type::chunk_type_pointer);
+        char const* data = static_cast<char const*>(c.data_.cpos_);
+        received.chunks_.emplace_back(data, data + c.size_);
+    }
+    return received;
+}
+
+void test_parcel_stripes(std::size_t num_stripes, unsigned seed)
+{
+    // a message with a small main buffer, two zero-copy chunks, and an index
+    // chunk referring to the main buffer
+    std::vector<char> const large = make_data(3 * 1024 * 1024 + 17, 'a');
+    std::vector<char> const small = make_data(1024 * 1024, 'x');
+
+    send_buffer_type buffer;
+    buffer.data_ = make_data(4096, '0');
+    buffer.chunks_.push_back(hpx::serialization::create_pointer_chunk(
+        large.data(), large.size()));
+    buffer.chunks_.push_back(hpx::serialization::create_index_chunk(0, 128));
+    buffer.chunks_.push_back(hpx::serialization::create_pointer_chunk(
+        small.data(), small.size()));
+    hpx::parcelset::detail::encode_finalize(buffer, buffer.data_.size());
+
+    HPX_TEST_EQ(hpx::parcelset::detail::zero_copy_size(buffer),
+        std::uint64_t(large.size() + small.size()));
+
+    std::vector<send_buffer_type> stripes =
+        hpx::parcelset::detail::split_into_stripes(
+            buffer, num_stripes, 1, 42);
+    HPX_TEST_EQ(stripes.size(), num_stripes);
+
+    std::vector<receive_buffer_type> received;
+    for (send_buffer_type const& stripe : stripes)
+    {
+        HPX_TEST(hpx::parcelset::detail::is_stripe(stripe));
+        received.push_back(transfer(stripe));
+    }
+    HPX_TEST(!hpx::parcelset::detail::is_stripe(buffer));
+
+    std::mt19937 gen(seed);
+    std::shuffle(received.begin(), received.end(), gen);
+
+    hpx::parcelset::detail::parcel_stripes parcel_stripes;
+    receive_buffer_type message;
+    for (std::size_t i = 0; i != received.size(); ++i)
+    {
+        bool const complete = parcel_stripes.add(received[i].data_.data(),
+            received[i].data_.size(), std::move(received[i].chunks_), message);
+        HPX_TEST_EQ(complete, i == received.size() - 1);
+    }
+    HPX_TEST_EQ(parcel_stripes.size(), std::size_t(0));
+
+    HPX_TEST(message.data_ == buffer.data_);
+    HPX_TEST_EQ(message.size_, buffer.size_);
+    HPX_TEST_EQ(message.data_size_, buffer.data_size_);
+    HPX_TEST(message.num_chunks_ == buffer.num_chunks_);
+    HPX_TEST(message.transmission_chunks_ == buffer.transmission_chunks_);
+    HPX_TEST_EQ(message.chunks_.size(), std::size_t(2));
+    if (message.chunks_.size() == 2)
+    {
+        HPX_TEST(message.chunks_[0] == large);
+        HPX_TEST(message.chunks_[1] == small);
+    }
+}
+
+int main()
+{
+    for (std::size_t num_stripes : {2, 3, 4, 7})
+    {
+        for (unsigned seed = 0; seed != 4; ++seed)
+        {
+            test_parcel_stripes(num_stripes, seed);
+        }
+    }
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,71 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify that the messages carrying only priority parcels make up the
+// configured share of the messages sent while bulk parcels are waiting.
+
+#include <hpx/config.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/parcelset/detail/priority_lanes.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+using hpx::parcelset::detail::priority_lane_schedule;
+
+void test_share(std::int64_t share)
+{
+    priority_lane_schedule const schedule(share);
+
+    std::int64_t balance = 0;
+    std::int64_t priority_only = 0;
+    std::size_t consecutive = 0;
+    std::size_t max_consecutive = 0;
+    for (int i = 0; i != 1000; ++i)
+    {
+        if (schedule.priority_only(balance))
+        {
+            ++priority_only;
+            if (++consecutive > max_consecutive)
+            {
+                max_consecutive = consecutive;
+            }
+        }
+        else
+        {
+            consecutive = 0;
+        }
+    }
+
+    HPX_TEST_EQ(priority_only, 10 * schedule.share());
+
+    // bulk parcels are delayed by a bounded number of messages only
+    if (schedule.share() != 100)
+    {
+        HPX_TEST_LTE(max_consecutive,
+            std::size_t(schedule.share() / (100 - schedule.share()) + 1));
+    }
+}
+
+int main()
+{
+    for (std::int64_t share = 0; share <= 100; ++share)
+    {
+        test_share(share);
+    }
+
+    // the share is limited to the range [0, 100]
+    HPX_TEST_EQ(priority_lane_schedule(-10).share(), std::int64_t(0));
+    HPX_TEST_EQ(priority_lane_schedule(200).share(), std::int64_t(100));
+
+    // the priority lane never bypasses bulk parcels for a share of zero, and
+    // always does for a share of 100 percent
+    std::int64_t balance = 0;
+    HPX_TEST(!priority_lane_schedule(0).priority_only(balance));
+    HPX_TEST(priority_lane_schedule(100).priority_only(balance));
+
+    return hpx::util::report_errors();
+}
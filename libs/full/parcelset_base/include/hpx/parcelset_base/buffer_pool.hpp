@@ -0,0 +1,130 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING)
+#include <hpx/modules/functional.hpp>
+#include <hpx/modules/synchronization.hpp>
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <unordered_set>
+#include <vector>
+
+namespace hpx::parcelset {
+
+    /// A process wide pool of message buffers shared by all parcelports.
+    ///
+    /// Buffers are kept in power-of-two size classes, a buffer handed out by
+    /// get() has a capacity of the size class of the requested size. Buffers
+    /// returned through put() are kept for reuse if their capacity still
+    /// matches a size class, which avoids allocating memory for every
+    /// received message once the application has reached a steady state.
+    ///
+    /// Network layers requiring registered (pinned) memory can install
+    /// registration hooks which are invoked whenever the pool allocates a new
+    /// buffer or releases one it owns. Registered buffers must not be grown
+    /// beyond their capacity while handed out.
+    class HPX_EXPORT buffer_pool
+    {
+    public:
+        using buffer_type = std::vector<char>;
+        using hook_type = hpx::function<void(void*, std::size_t)>;
+
+        // the smallest size class (256 bytes)
+        static constexpr std::size_t min_size_class = 8;
+        static constexpr std::size_t num_size_classes = 40;
+
+        buffer_pool() = default;
+
+        buffer_pool(buffer_pool const&) = delete;
+        buffer_pool(buffer_pool&&) = delete;
+        buffer_pool& operator=(buffer_pool const&) = delete;
+        buffer_pool& operator=(buffer_pool&&) = delete;
+
+        /// The pool used by the parcelports
+        static buffer_pool& instance();
+
+        /// Enable or disable the pool. Buffers larger than max_size are
+        /// never pooled, at most max_buffers are kept per size class. This
+        /// has to be called before any buffers are requested.
+        void configure(
+            bool enable, std::size_t max_size, std::size_t max_buffers);
+
+        bool enabled() const noexcept
+        {
+            return enabled_.load(std::memory_order_relaxed);
+        }
+
+        /// Install the functions to invoke whenever the pool allocates a new
+        /// buffer or releases one of its buffers. Only registered buffers
+        /// are pooled from this point on.
+        void set_registration_hooks(hook_type reg, hook_type dereg);
+
+        /// Return a buffer holding size elements
+        buffer_type get(std::size_t size);
+
+        /// Give a buffer back to the pool
+        void put(buffer_type&& buffer);
+
+        /// Release all pooled buffers
+        void clear();
+
+        // counter data
+        std::int64_t get_hits(bool reset);
+        std::int64_t get_misses(bool reset);
+
+        // the ratio of hits to all requests (in 0.01%)
+        std::int64_t get_hit_rate(bool reset);
+
+    private:
+        using mutex_type = hpx::spinlock;
+
+        static std::size_t size_class(std::size_t size) noexcept;
+
+        bool is_registered(buffer_type const& buffer);
+        void register_buffer(buffer_type& buffer);
+        void deregister_buffer(buffer_type& buffer);
+
+        struct size_class_data
+        {
+            mutex_type mtx_;
+            std::vector<buffer_type> buffers_;
+        };
+
+        std::atomic<bool> enabled_ = false;
+        std::size_t max_size_ = 0;
+        std::size_t max_capacity_ = 0;
+        std::size_t max_buffers_ = 0;
+
+        std::array<size_class_data, num_size_classes> size_classes_;
+
+        // registered buffers, only maintained if hooks were installed
+        std::atomic<bool> has_hooks_ = false;
+        mutex_type registration_mtx_;
+        hook_type register_;
+        hook_type deregister_;
+        std::unordered_set<void const*> registered_;
+
+        // the counters are never reset, resetting moves the baselines
+        std::atomic<std::int64_t> hits_ = 0;
+        std::atomic<std::int64_t> misses_ = 0;
+
+        mutex_type counters_mtx_;
+        std::int64_t hits_base_ = 0;
+        std::int64_t misses_base_ = 0;
+        std::int64_t hit_rate_hits_base_ = 0;
+        std::int64_t hit_rate_misses_base_ = 0;
+    };
+}    // namespace hpx::parcelset
+
+#endif
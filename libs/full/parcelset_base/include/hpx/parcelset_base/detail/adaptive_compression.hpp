@@ -0,0 +1,145 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace hpx::parcelset::detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    struct adaptive_compression_parameters
+    {
+        // messages smaller than this are never compressed
+        std::size_t threshold_ = 0;
+
+        // switch compression off for destinations for which it does not pay
+        bool adaptive_ = false;
+
+        // the compression ratio required for compression to be worth it
+        double min_ratio_ = 1.2;
+
+        // the maximal time (nanoseconds) spent per saved byte, this should
+        // correspond to the time it takes to send a byte to the destination
+        double max_cost_ = 8.0;
+
+        // the number of compressed messages evaluated at once
+        std::size_t window_ = 8;
+
+        // compress every n-th message while compression is disabled for a
+        // destination to detect changes of the data sent
+        std::size_t probe_interval_ = 64;
+    };
+
+    // The compression statistics gathered for one destination
+    struct adaptive_compression_state
+    {
+        bool enabled_ = true;
+        bool probing_ = false;
+        std::size_t samples_ = 0;
+        std::size_t skipped_ = 0;
+        std::uint64_t uncompressed_ = 0;
+        std::uint64_t compressed_ = 0;
+        std::uint64_t time_ = 0;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Decides whether a message of actions using a serialization filter is
+    // compressed. Compression is disabled for a destination if the measured
+    // compression ratio is too low or if compressing takes longer than
+    // sending the saved bytes would have taken.
+    class adaptive_compression
+    {
+    public:
+        explicit constexpr adaptive_compression(
+            adaptive_compression_parameters const& params) noexcept
+          : params_(params)
+        {
+        }
+
+        constexpr adaptive_compression_parameters const& parameters()
+            const noexcept
+        {
+            return params_;
+        }
+
+        // Return whether a message of the given size should be compressed
+        constexpr bool compress(
+            adaptive_compression_state& state, std::size_t size) const noexcept
+        {
+            if (size < params_.threshold_)
+            {
+                return false;
+            }
+
+            if (!params_.adaptive_ || state.enabled_)
+            {
+                return true;
+            }
+
+            if (++state.skipped_ >= params_.probe_interval_)
+            {
+                state.skipped_ = 0;
+                state.probing_ = true;
+                return true;
+            }
+            return false;
+        }
+
+        // Account for a compressed message, the time is the time spent
+        // serializing and compressing the message (nanoseconds)
+        constexpr void update(adaptive_compression_state& state,
+            std::size_t uncompressed, std::size_t compressed,
+            std::uint64_t time) const noexcept
+        {
+            if (!params_.adaptive_)
+            {
+                return;
+            }
+
+            state.uncompressed_ += uncompressed;
+            state.compressed_ += compressed;
+            state.time_ += time;
+
+            if (!state.probing_ && ++state.samples_ < params_.window_)
+            {
+                return;
+            }
+
+            state.enabled_ = worth_it(
+                state.uncompressed_, state.compressed_, state.time_);
+
+            state.probing_ = false;
+            state.samples_ = 0;
+            state.uncompressed_ = 0;
+            state.compressed_ = 0;
+            state.time_ = 0;
+        }
+
+    private:
+        constexpr bool worth_it(std::uint64_t uncompressed,
+            std::uint64_t compressed, std::uint64_t time) const noexcept
+        {
+            if (compressed >= uncompressed)
+            {
+                return false;
+            }
+
+            double const ratio = compressed == 0 ?
+                params_.min_ratio_ :
+                double(uncompressed) / double(compressed);
+            double const cost =
+                double(time) / double(uncompressed - compressed);
+
+            return ratio >= params_.min_ratio_ && cost <= params_.max_cost_;
+        }
+
+        adaptive_compression_parameters params_;
+    };
+}    // namespace hpx::parcelset::detail
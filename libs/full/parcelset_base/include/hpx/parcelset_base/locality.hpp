@@ -15,6 +15,7 @@
 #include <hpx/modules/iterator_support.hpp>
 #include <hpx/modules/serialization.hpp>
 
+#include <cstddef>
 #include <map>
 #include <memory>
 #include <string>
@@ -26,6 +27,21 @@
 ///////////////////////////////////////////////////////////////////////////////
 namespace hpx { namespace parcelset {
 
+    namespace detail {
+
+        template <typename Impl, typename Enable = void>
+        struct has_locality_hash : std::false_type
+        {
+        };
+
+        template <typename Impl>
+        struct has_locality_hash<Impl,
+            std::void_t<decltype(std::declval<Impl const&>().hash())>>
+          : std::true_type
+        {
+        };
+    }    // namespace detail
+
     //////////////////////////////////////////////////////////////////////////
     class HPX_EXPORT locality
     {
@@ -39,6 +55,7 @@ namespace hpx { namespace parcelset {
 
             virtual bool equal(impl_base const& rhs) const = 0;
             virtual bool less_than(impl_base const& rhs) const = 0;
+            virtual std::size_t hash() const = 0;
             virtual bool valid() const = 0;
             virtual const char* type() const = 0;
             virtual std::ostream& print(std::ostream& os) const = 0;
@@ -91,6 +108,13 @@ namespace hpx { namespace parcelset {
             return impl_ ? impl_->type() : "";
         }
 
+        // Return a hash value of this locality. Localities of parcelports
+        // which do not provide one all hash to the same value.
+        std::size_t hash() const
+        {
+            return impl_ ? impl_->hash() : 0;
+        }
+
         template <typename Impl>
         Impl& get()
         {
@@ -156,6 +180,18 @@ namespace hpx { namespace parcelset {
                     (type() == rhs.type() && impl_ < rhs.get<Impl>());
             }
 
+            std::size_t hash() const override
+            {
+                if constexpr (detail::has_locality_hash<Impl>::value)
+                {
+                    return impl_.hash();
+                }
+                else
+                {
+                    return 0;
+                }
+            }
+
             bool valid() const override
             {
                 return !!impl_;
@@ -0,0 +1,157 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file hpx/parcelset_base/parcel_flight_recorder.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_PARCEL_PROFILING) && defined(HPX_HAVE_NETWORKING)
+#include <hpx/modules/threading_base.hpp>
+#include <hpx/timing/high_resolution_clock.hpp>
+#include <hpx/naming_base/gid_type.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+namespace hpx::parcelset {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The parcel flight recorder breaks the latency of remote action
+    // invocations down into the stages a parcel goes through. The first three
+    // stages are recorded on the locality sending the parcel, the others on
+    // the locality receiving it, the records of both localities refer to the
+    // same parcel id.
+    enum class parcel_stage : std::uint8_t
+    {
+        send_queue = 0,         // from put_parcel until the serialization of
+                                // the parcel starts
+        serialization = 1,      // serialization of the parcel
+        wire = 2,               // from the end of the serialization of the
+                                // message until its write has completed
+        deserialization = 3,    // de-serialization of the parcel
+        scheduling = 4,         // from the creation of the thread running the
+                                // action until it starts running
+        execution = 5           // execution of the action (including the time
+                                // its thread was suspended)
+    };
+
+    inline constexpr std::size_t num_parcel_stages = 6;
+
+    /// Returns the name of the given stage, as used by the performance
+    /// counters
+    HPX_EXPORT char const* get_parcel_stage_name(parcel_stage stage) noexcept;
+
+    /// One stage of one parcel
+    struct parcel_flight_record
+    {
+        naming::gid_type parcel_id;
+        char const* action;         // the name of the action
+        std::uint64_t start;        // nanoseconds (high_resolution_clock)
+        std::uint64_t duration;     // nanoseconds
+        parcel_stage stage;
+    };
+
+    /// The statistics of one stage, aggregated over the parcels of one action
+    struct parcel_stage_statistics
+    {
+        std::uint64_t count = 0;
+        std::uint64_t time = 0;    // nanoseconds
+        std::uint64_t max = 0;     // nanoseconds
+    };
+
+    /// Start or stop recording the parcel stages. Recording costs a relaxed
+    /// load per stage while disabled.
+    HPX_EXPORT void enable_parcel_flight_recording(bool enable = true);
+
+    /// Returns whether the parcel stages are being recorded
+    HPX_EXPORT bool is_parcel_flight_recording_enabled() noexcept;
+
+    /// Returns the statistics of the given stage for the parcels of the given
+    /// action (of all actions if \a action is empty)
+    HPX_EXPORT parcel_stage_statistics get_parcel_stage_statistics(
+        std::string const& action, parcel_stage stage, bool reset = false);
+
+    /// Returns the most recently recorded stages (at most
+    /// hpx.parcel_flight_recorder.size, 16384 by default), ordered by the
+    /// time they were recorded
+    HPX_EXPORT std::vector<parcel_flight_record> get_parcel_flight_records(
+        bool reset = false);
+
+    /// Writes the recorded stages as comma separated values, one line per
+    /// record: parcel id, action, stage, start, duration
+    HPX_EXPORT void write_parcel_flight_records(
+        std::ostream& os, bool reset = false);
+
+    namespace detail {
+
+        HPX_EXPORT extern std::atomic<bool> parcel_flight_recording_enabled;
+
+        HPX_EXPORT void record_parcel_stage(char const* action,
+            naming::gid_type const& parcel_id, parcel_stage stage,
+            std::uint64_t start, std::uint64_t end) noexcept;
+
+        // Returns the current time if recording is enabled, 0 otherwise
+        HPX_FORCEINLINE std::uint64_t parcel_flight_begin() noexcept
+        {
+            if (HPX_UNLIKELY(parcel_flight_recording_enabled.load(
+                    std::memory_order_relaxed)))
+            {
+                return hpx::chrono::high_resolution_clock::now();
+            }
+            return 0;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // Tracks a received parcel while its action is de-serialized and
+        // scheduled on the current OS thread. The action either wraps the
+        // function of the thread it creates (wrap_thread_function) or is
+        // executed directly (execute_inline).
+        class HPX_EXPORT received_parcel_flight
+        {
+        public:
+            // start is the time the de-serialization of the parcel started,
+            // 0 if nothing is to be recorded (see parcel_flight_begin)
+            received_parcel_flight(std::uint64_t start, char const* action,
+                naming::gid_type const& parcel_id,
+                bool deserialized = false) noexcept;
+            ~received_parcel_flight();
+
+            received_parcel_flight(received_parcel_flight const&) = delete;
+            received_parcel_flight& operator=(
+                received_parcel_flight const&) = delete;
+
+            // called once the parcel was de-serialized, if the parcel was
+            // deferred its action is scheduled later by a new flight
+            void finish(bool deferred) noexcept;
+
+            // called by the actions once their arguments are de-serialized
+            static void deserialized() noexcept;
+
+            // called by the actions before they create their thread
+            static void wrap_thread_function(
+                threads::thread_function_type& f);
+
+            // called by the actions before they are run directly
+            static void execute_inline() noexcept;
+
+        private:
+            received_parcel_flight* previous_;
+            char const* action_;
+            naming::gid_type parcel_id_;
+            std::uint64_t start_;
+            std::uint64_t deserialized_;
+            bool scheduled_;
+        };
+    }    // namespace detail
+}    // namespace hpx::parcelset
+
+#endif
@@ -22,6 +22,7 @@
 #include <hpx/naming_base/id_type.hpp>
 #include <hpx/parcelset_base/locality.hpp>
 #include <hpx/parcelset_base/policies/message_handler.hpp>
+#include <hpx/serialization/detail/parallel_serialization.hpp>
 
 #include <cstddef>
 #include <cstdint>
@@ -39,6 +40,8 @@ namespace hpx::parcelset::detail {
     {
         using split_gids_type =
             std::map<naming::gid_type const*, naming::gid_type>;
+        using serialized_segments_type =
+            serialization::detail::serialized_segments;
 
         virtual ~parcel_base() = default;
 
@@ -84,6 +87,10 @@ namespace hpx::parcelset::detail {
         virtual split_gids_type move_split_gids() const = 0;
         virtual void set_split_gids(split_gids_type&& split_gids) = 0;
 
+        virtual serialized_segments_type move_serialized_segments() const = 0;
+        virtual void set_serialized_segments(
+            serialized_segments_type&& segments) = 0;
+
         virtual std::size_t num_chunks() const = 0;
         virtual std::size_t& num_chunks() = 0;
 
@@ -114,6 +121,8 @@ namespace hpx::parcelset {
     {
     private:
         using split_gids_type = typename detail::parcel_base::split_gids_type;
+        using serialized_segments_type =
+            typename detail::parcel_base::serialized_segments_type;
 
         bool is_valid() const;
 
@@ -169,6 +178,9 @@ namespace hpx::parcelset {
         split_gids_type move_split_gids() const;
         void set_split_gids(split_gids_type&& split_gids);
 
+        serialized_segments_type move_serialized_segments() const;
+        void set_serialized_segments(serialized_segments_type&& segments);
+
         std::size_t num_chunks() const;
         std::size_t& num_chunks();
 
@@ -19,6 +19,7 @@
 #include <hpx/modules/runtime_configuration.hpp>
 #include <hpx/modules/synchronization.hpp>
 
+#include <hpx/parcelset_base/detail/adaptive_compression.hpp>
 #include <hpx/parcelset_base/detail/data_point.hpp>
 #include <hpx/parcelset_base/detail/gatherer.hpp>
 #include <hpx/parcelset_base/detail/per_action_data_counter.hpp>
@@ -36,6 +37,7 @@
 #include <set>
 #include <string>
 #include <system_error>
+#include <unordered_map>
 #include <vector>
 
 #include <hpx/config/warnings_prefix.hpp>
@@ -84,6 +86,18 @@ namespace hpx::parcelset {
         // serialize an entity
         std::size_t get_zero_copy_serialization_threshold() const noexcept;
 
+        /// Return the size of the blocks of the arena the objects created
+        /// while decoding a message are allocated from (zero if disabled)
+        std::size_t get_arena_block_size() const noexcept;
+
+        /// Return whether zero-copy chunks referring to device memory (see
+        /// serialization::device_memory_key) can be sent and received by
+        /// this parcelport, which requires a device aware network layer
+        virtual bool can_send_device_memory() const noexcept
+        {
+            return false;
+        }
+
         /// Start the parcelport I/O thread pool.
         ///
         /// \param blocking [in] If blocking is set to \a true the routine will
@@ -155,6 +169,16 @@ namespace hpx::parcelset {
         /// Cache specific functionality
         virtual void remove_from_connection_cache(locality const& loc) = 0;
 
+        /// Establish connections to the given destinations ahead of their
+        /// first use and keep them in the connection cache. Returns the
+        /// number of destinations a connection is available for afterwards.
+        /// Parcelports which do not cache connections do nothing.
+        virtual std::size_t warm_up_connections(
+            std::vector<locality> const& /* dests */)
+        {
+            return 0;
+        }
+
         /// Return the thread pool if the name matches
         virtual util::io_service_pool* get_thread_pool(char const* name) = 0;
 
@@ -176,6 +200,29 @@ namespace hpx::parcelset {
         virtual std::int64_t get_connection_cache_statistics(
             connection_cache_statistics_type, bool reset) = 0;
 
+        /// Return the given statistic of the compression of messages
+        enum compression_statistics_type
+        {
+            compression_compressed_messages = 0,
+            compression_skipped_messages = 1,
+            compression_bytes_saved = 2
+        };
+
+        std::int64_t get_compression_statistics(
+            compression_statistics_type, bool reset);
+
+        /// Return whether a message of the given size using a serialization
+        /// filter should be compressed while sending it to the given
+        /// destination
+        bool compress_message(std::uint32_t destination, std::size_t size);
+
+        /// Account for a message compressed while sending it to the given
+        /// destination, the time is the time spent serializing and compressing
+        /// the message (nanoseconds)
+        void update_compression(std::uint32_t destination,
+            std::size_t uncompressed, std::size_t compressed,
+            std::uint64_t time);
+
         /// Return the name of this locality
         virtual std::string get_locality_name() const = 0;
 
@@ -328,6 +375,10 @@ namespace hpx::parcelset {
         using pending_parcels_map = std::map<locality, map_second_type>;
         pending_parcels_map pending_parcels_;
 
+        // The cache for pending parcels of high priority, these may bypass
+        // the parcels pending in pending_parcels_
+        pending_parcels_map pending_priority_parcels_;
+
         using pending_parcels_destinations = std::set<locality>;
         pending_parcels_destinations parcel_destinations_;
         std::atomic<std::uint32_t> num_parcel_destinations_;
@@ -363,6 +414,16 @@ namespace hpx::parcelset {
         std::string type_;
 
         std::size_t zero_copy_serialization_threshold_;
+        std::size_t arena_block_size_;
+
+        /// adaptive compression of messages using a serialization filter
+        detail::adaptive_compression compression_;
+        hpx::spinlock compression_mtx_;
+        std::unordered_map<std::uint32_t, detail::adaptive_compression_state>
+            compression_states_;
+        std::atomic<std::int64_t> compressed_messages_;
+        std::atomic<std::int64_t> skipped_messages_;
+        std::atomic<std::int64_t> compression_bytes_saved_;
     };
 }    // namespace hpx::parcelset
 
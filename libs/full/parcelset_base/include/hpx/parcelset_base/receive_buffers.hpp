@@ -0,0 +1,162 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file receive_buffers.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING)
+#include <hpx/modules/serialization.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace hpx::parcelset {
+
+    /// Register the memory the next zero-copy chunk sent with the given key
+    /// should be received into.
+    ///
+    /// \param key      The key identifying the buffer, senders refer to it
+    ///                 by using a \a receive_buffer_allocator constructed
+    ///                 from the same key. Keys have to be smaller than 2^31.
+    /// \param data     The address of the memory to receive the data into,
+    ///                 this may be device memory if the data is sent from
+    ///                 device memory as well
+    /// \param size     The size of the memory (in bytes)
+    ///
+    /// \note A registration is used for one message only and replaces any
+    ///       earlier registration for the same key which was not used yet.
+    ///       The memory has to stay valid until the data was delivered or
+    ///       the registration was withdrawn.
+    HPX_EXPORT void register_receive_buffer(
+        std::uint32_t key, void* data, std::size_t size);
+
+    /// Withdraw a registration made by \a register_receive_buffer. Returns
+    /// false if no unused registration for the given key exists.
+    HPX_EXPORT bool unregister_receive_buffer(std::uint32_t key);
+
+    namespace detail {
+
+        // Called by the parcelports before receiving a zero-copy chunk sent
+        // with the given key, returns nullptr if no buffer of sufficient
+        // size was registered.
+        HPX_EXPORT void* claim_receive_buffer(
+            std::uint32_t key, std::size_t size);
+
+        // Called while de-serializing the data sent with the given key,
+        // returns nullptr if no buffer of sufficient size was registered.
+        // Device memory is returned only if the data was received into it.
+        HPX_EXPORT void* take_receive_buffer(
+            std::uint32_t key, std::size_t size);
+
+        // Returns true if the given memory was obtained from
+        // take_receive_buffer and was not released yet.
+        HPX_EXPORT bool release_receive_buffer(void* data);
+    }    // namespace detail
+
+    /// An allocator for \a hpx::serialization::serialize_buffer which makes
+    /// the parcelports receive the buffer data directly into the memory
+    /// registered for the key of the allocator on the destination locality.
+    ///
+    /// If no memory was registered for the key by the time the data
+    /// arrives, memory is allocated as usual. Actions should therefore
+    /// compare the address of the received buffer with the registered
+    /// memory.
+    ///
+    /// A buffer referring to device memory (e.g. the memory of a GPU) is
+    /// sent by parcelports supporting this (see
+    /// \a parcelport::can_send_device_memory) straight from the device
+    /// memory. It is received straight into the memory registered for the
+    /// key which therefore should be device memory as well. As the
+    /// serialization code can't copy device memory, the received buffer
+    /// refers to host memory holding the data if no memory was registered by
+    /// the time the data arrived. Buffers referring to device memory should
+    /// be created in the \a serialize_buffer::reference mode.
+    template <typename T>
+    class receive_buffer_allocator
+    {
+    public:
+        using value_type = T;
+
+        receive_buffer_allocator() = default;
+
+        explicit constexpr receive_buffer_allocator(
+            std::uint32_t key, bool device_memory = false) noexcept
+          : key_(device_memory ? (key | serialization::device_memory_key) :
+                                 key)
+        {
+        }
+
+        template <typename U>
+        constexpr receive_buffer_allocator(
+            receive_buffer_allocator<U> const& rhs) noexcept
+          : key_(rhs.receive_key())
+        {
+        }
+
+        constexpr std::uint32_t receive_key() const noexcept
+        {
+            return key_;
+        }
+
+        // returns whether the buffers refer to device memory
+        constexpr bool device_memory() const noexcept
+        {
+            return serialization::is_device_memory_key(key_);
+        }
+
+        T* allocate(std::size_t n)
+        {
+            if (key_ != 0)
+            {
+                if (void* data =
+                        detail::take_receive_buffer(key_, n * sizeof(T)))
+                {
+                    return static_cast<T*>(data);
+                }
+            }
+            return std::allocator<T>().allocate(n);
+        }
+
+        void deallocate(T* p, std::size_t n) noexcept
+        {
+            if (key_ == 0 || !detail::release_receive_buffer(p))
+            {
+                std::allocator<T>().deallocate(p, n);
+            }
+        }
+
+        friend constexpr bool operator==(receive_buffer_allocator const& lhs,
+            receive_buffer_allocator const& rhs) noexcept
+        {
+            return lhs.key_ == rhs.key_;
+        }
+
+        friend constexpr bool operator!=(receive_buffer_allocator const& lhs,
+            receive_buffer_allocator const& rhs) noexcept
+        {
+            return lhs.key_ != rhs.key_;
+        }
+
+    private:
+        friend class hpx::serialization::access;
+
+        template <typename Archive>
+        void serialize(Archive& ar, unsigned int const)
+        {
+            // clang-format off
+            ar & key_;
+            // clang-format on
+        }
+
+        std::uint32_t key_ = 0;
+    };
+}    // namespace hpx::parcelset
+
+#endif
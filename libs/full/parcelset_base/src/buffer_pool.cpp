@@ -0,0 +1,253 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING)
+#include <hpx/parcelset_base/buffer_pool.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace hpx::parcelset {
+
+    buffer_pool& buffer_pool::instance()
+    {
+        static buffer_pool pool;
+        return pool;
+    }
+
+    std::size_t buffer_pool::size_class(std::size_t size) noexcept
+    {
+        std::size_t k = min_size_class;
+        while (k != min_size_class + num_size_classes - 1 &&
+            (std::size_t(1) << k) < size)
+        {
+            ++k;
+        }
+        return k - min_size_class;
+    }
+
+    void buffer_pool::configure(
+        bool enable, std::size_t max_size, std::size_t max_buffers)
+    {
+        // the largest buffer fitting into the last size class
+        std::size_t const largest = std::size_t(1)
+            << (min_size_class + num_size_classes - 1);
+
+        max_size_ = (std::min)(max_size, largest);
+        max_capacity_ = std::size_t(1)
+            << (size_class(max_size_) + min_size_class);
+        max_buffers_ = max_buffers;
+        enabled_.store(enable && max_buffers != 0, std::memory_order_relaxed);
+
+        if (!enabled())
+        {
+            clear();
+        }
+    }
+
+    void buffer_pool::set_registration_hooks(hook_type reg, hook_type dereg)
+    {
+        // buffers pooled so far were not registered
+        clear();
+
+        std::lock_guard l(registration_mtx_);
+        register_ = HPX_MOVE(reg);
+        deregister_ = HPX_MOVE(dereg);
+        has_hooks_.store(
+            static_cast<bool>(register_), std::memory_order_relaxed);
+    }
+
+    buffer_pool::buffer_type buffer_pool::get(std::size_t size)
+    {
+        if (!enabled())
+        {
+            return buffer_type(size);
+        }
+
+        if (size > max_size_)
+        {
+            misses_.fetch_add(1, std::memory_order_relaxed);
+            return buffer_type(size);
+        }
+
+        std::size_t const idx = size_class(size);
+        {
+            size_class_data& data = size_classes_[idx];
+
+            std::unique_lock l(data.mtx_);
+            if (!data.buffers_.empty())
+            {
+                buffer_type buffer = HPX_MOVE(data.buffers_.back());
+                data.buffers_.pop_back();
+                l.unlock();
+
+                hits_.fetch_add(1, std::memory_order_relaxed);
+                buffer.resize(size);
+                return buffer;
+            }
+        }
+
+        misses_.fetch_add(1, std::memory_order_relaxed);
+
+        buffer_type buffer;
+        buffer.reserve(std::size_t(1) << (idx + min_size_class));
+        register_buffer(buffer);
+        buffer.resize(size);
+        return buffer;
+    }
+
+    void buffer_pool::put(buffer_type&& buffer)
+    {
+        buffer_type released(HPX_MOVE(buffer));
+
+        std::size_t const capacity = released.capacity();
+        if (capacity == 0 || !enabled())
+        {
+            deregister_buffer(released);
+            return;
+        }
+
+        // only buffers handed out by the pool match a size class exactly
+        std::size_t const idx = size_class(capacity);
+        if (capacity > max_capacity_ ||
+            (std::size_t(1) << (idx + min_size_class)) != capacity ||
+            (has_hooks_.load(std::memory_order_relaxed) &&
+                !is_registered(released)))
+        {
+            deregister_buffer(released);
+            return;
+        }
+
+        {
+            size_class_data& data = size_classes_[idx];
+
+            std::lock_guard l(data.mtx_);
+            if (data.buffers_.size() < max_buffers_)
+            {
+                released.clear();
+                data.buffers_.push_back(HPX_MOVE(released));
+                return;
+            }
+        }
+
+        deregister_buffer(released);
+    }
+
+    void buffer_pool::clear()
+    {
+        for (size_class_data& data : size_classes_)
+        {
+            std::vector<buffer_type> buffers;
+            {
+                std::lock_guard l(data.mtx_);
+                std::swap(buffers, data.buffers_);
+            }
+
+            for (buffer_type& buffer : buffers)
+            {
+                deregister_buffer(buffer);
+            }
+        }
+    }
+
+    bool buffer_pool::is_registered(buffer_type const& buffer)
+    {
+        std::lock_guard l(registration_mtx_);
+        return registered_.find(buffer.data()) != registered_.end();
+    }
+
+    void buffer_pool::register_buffer(buffer_type& buffer)
+    {
+        if (!has_hooks_.load(std::memory_order_relaxed))
+        {
+            return;
+        }
+
+        register_(buffer.data(), buffer.capacity());
+
+        std::lock_guard l(registration_mtx_);
+        registered_.insert(buffer.data());
+    }
+
+    void buffer_pool::deregister_buffer(buffer_type& buffer)
+    {
+        if (!has_hooks_.load(std::memory_order_relaxed) ||
+            buffer.capacity() == 0)
+        {
+            return;
+        }
+
+        {
+            std::lock_guard l(registration_mtx_);
+            if (registered_.erase(buffer.data()) == 0)
+            {
+                return;
+            }
+        }
+
+        if (deregister_)
+        {
+            deregister_(buffer.data(), buffer.capacity());
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    std::int64_t buffer_pool::get_hits(bool reset)
+    {
+        std::int64_t const hits = hits_.load(std::memory_order_relaxed);
+
+        std::lock_guard l(counters_mtx_);
+        std::int64_t const result = hits - hits_base_;
+        if (reset)
+        {
+            hits_base_ = hits;
+        }
+        return result;
+    }
+
+    std::int64_t buffer_pool::get_misses(bool reset)
+    {
+        std::int64_t const misses = misses_.load(std::memory_order_relaxed);
+
+        std::lock_guard l(counters_mtx_);
+        std::int64_t const result = misses - misses_base_;
+        if (reset)
+        {
+            misses_base_ = misses;
+        }
+        return result;
+    }
+
+    std::int64_t buffer_pool::get_hit_rate(bool reset)
+    {
+        std::int64_t const hits = hits_.load(std::memory_order_relaxed);
+        std::int64_t const misses = misses_.load(std::memory_order_relaxed);
+
+        std::lock_guard l(counters_mtx_);
+        std::int64_t const num_hits = hits - hit_rate_hits_base_;
+        std::int64_t const num_requests =
+            num_hits + misses - hit_rate_misses_base_;
+        if (reset)
+        {
+            hit_rate_hits_base_ = hits;
+            hit_rate_misses_base_ = misses;
+        }
+
+        if (num_requests == 0)
+        {
+            return 0;
+        }
+        return (num_hits * 10000) / num_requests;
+    }
+}    // namespace hpx::parcelset
+
+#endif
@@ -0,0 +1,372 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_PARCEL_PROFILING) && defined(HPX_HAVE_NETWORKING)
+#include <hpx/assert.hpp>
+#include <hpx/modules/format.hpp>
+#include <hpx/modules/hashing.hpp>
+#include <hpx/modules/synchronization.hpp>
+#include <hpx/modules/threading_base.hpp>
+#include <hpx/timing/high_resolution_clock.hpp>
+#include <hpx/runtime_local/config_entry.hpp>
+#include <hpx/util/from_string.hpp>
+
+#include <hpx/parcelset_base/parcel_flight_recorder.hpp>
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace hpx::parcelset {
+
+    namespace detail {
+        std::atomic<bool> parcel_flight_recording_enabled(false);
+    }    // namespace detail
+
+    namespace {
+        // clang-format off
+        char const* const parcel_stage_names[] = {
+            "send-queue",
+            "serialization",
+            "wire",
+            "deserialization",
+            "scheduling",
+            "execution"
+        };
+        // clang-format on
+
+        using stage_statistics =
+            std::array<parcel_stage_statistics, num_parcel_stages>;
+
+        struct flight_recorder
+        {
+            using mutex_type = hpx::spinlock;
+
+            mutex_type mtx_;
+            std::unordered_map<std::string, stage_statistics,
+                hpx::util::jenkins_hash>
+                actions_;
+            stage_statistics total_;
+
+            // the most recent records, records_[written_ % capacity_] is
+            // overwritten next
+            std::vector<parcel_flight_record> records_;
+            std::size_t written_ = 0;
+            std::size_t capacity_ = 16384;
+        };
+
+        flight_recorder& get_flight_recorder()
+        {
+            static flight_recorder recorder;
+            return recorder;
+        }
+
+        void add_duration(
+            parcel_stage_statistics& statistics, std::uint64_t duration)
+        {
+            ++statistics.count;
+            statistics.time += duration;
+            if (duration > statistics.max)
+            {
+                statistics.max = duration;
+            }
+        }
+
+        // the records ordered by the time they were recorded
+        std::vector<parcel_flight_record> get_records(flight_recorder& r)
+        {
+            if (r.written_ <= r.capacity_)
+            {
+                return r.records_;
+            }
+
+            std::size_t const next = r.written_ % r.capacity_;
+            std::vector<parcel_flight_record> records;
+            records.reserve(r.records_.size());
+            records.insert(
+                records.end(), r.records_.begin() + next, r.records_.end());
+            records.insert(
+                records.end(), r.records_.begin(), r.records_.begin() + next);
+            return records;
+        }
+    }    // namespace
+
+    ///////////////////////////////////////////////////////////////////////////
+    char const* get_parcel_stage_name(parcel_stage stage) noexcept
+    {
+        std::size_t const index = static_cast<std::size_t>(stage);
+        if (index >= num_parcel_stages)
+        {
+            return "unknown";
+        }
+        return parcel_stage_names[index];
+    }
+
+    void enable_parcel_flight_recording(bool enable)
+    {
+        if (enable)
+        {
+            flight_recorder& r = get_flight_recorder();
+            std::size_t const capacity =
+                hpx::util::from_string<std::size_t>(get_config_entry(
+                    "hpx.parcel_flight_recorder.size", r.capacity_));
+
+            std::lock_guard l(r.mtx_);
+            if (capacity != 0 && capacity != r.capacity_)
+            {
+                r.records_ = get_records(r);
+                if (r.records_.size() > capacity)
+                {
+                    r.records_.erase(r.records_.begin(),
+                        r.records_.end() - capacity);
+                }
+                r.written_ = r.records_.size();
+                r.capacity_ = capacity;
+            }
+        }
+        detail::parcel_flight_recording_enabled.store(
+            enable, std::memory_order_relaxed);
+    }
+
+    bool is_parcel_flight_recording_enabled() noexcept
+    {
+        return detail::parcel_flight_recording_enabled.load(
+            std::memory_order_relaxed);
+    }
+
+    parcel_stage_statistics get_parcel_stage_statistics(
+        std::string const& action, parcel_stage stage, bool reset)
+    {
+        std::size_t const index = static_cast<std::size_t>(stage);
+        HPX_ASSERT(index < num_parcel_stages);
+
+        flight_recorder& r = get_flight_recorder();
+        std::lock_guard l(r.mtx_);
+
+        parcel_stage_statistics* statistics = &r.total_[index];
+        if (!action.empty())
+        {
+            auto it = r.actions_.find(action);
+            if (it == r.actions_.end())
+            {
+                return parcel_stage_statistics();
+            }
+            statistics = &it->second[index];
+        }
+
+        parcel_stage_statistics const result = *statistics;
+        if (reset)
+        {
+            *statistics = parcel_stage_statistics();
+        }
+        return result;
+    }
+
+    std::vector<parcel_flight_record> get_parcel_flight_records(bool reset)
+    {
+        flight_recorder& r = get_flight_recorder();
+        std::lock_guard l(r.mtx_);
+
+        std::vector<parcel_flight_record> records = get_records(r);
+        if (reset)
+        {
+            r.records_.clear();
+            r.written_ = 0;
+        }
+        return records;
+    }
+
+    void write_parcel_flight_records(std::ostream& os, bool reset)
+    {
+        for (parcel_flight_record const& record :
+            get_parcel_flight_records(reset))
+        {
+            hpx::util::format_to(os, "{:016x}{:016x},{},{},{},{}\n",
+                record.parcel_id.get_msb(), record.parcel_id.get_lsb(),
+                record.action, get_parcel_stage_name(record.stage),
+                record.start, record.duration);
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    namespace detail {
+
+        void record_parcel_stage(char const* action,
+            naming::gid_type const& parcel_id, parcel_stage stage,
+            std::uint64_t start, std::uint64_t end) noexcept
+        {
+            if (start == 0 || end < start)
+            {
+                return;
+            }
+
+            std::size_t const index = static_cast<std::size_t>(stage);
+            HPX_ASSERT(index < num_parcel_stages);
+
+            std::uint64_t const duration = end - start;
+            parcel_flight_record const record{
+                parcel_id, action, start, duration, stage};
+
+            flight_recorder& r = get_flight_recorder();
+            std::lock_guard l(r.mtx_);
+            try
+            {
+                add_duration(r.total_[index], duration);
+                add_duration(r.actions_[std::string(action)][index], duration);
+
+                if (r.records_.size() < r.capacity_)
+                {
+                    r.records_.push_back(record);
+                }
+                else
+                {
+                    r.records_[r.written_ % r.capacity_] = record;
+                }
+                ++r.written_;
+            }
+            catch (...)
+            {
+                // the record is dropped if the memory can't be allocated
+            }
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        namespace {
+            received_parcel_flight*& current_flight() noexcept
+            {
+                static thread_local received_parcel_flight* flight = nullptr;
+                return flight;
+            }
+
+            // records the scheduling and execution stages of the thread
+            // running the action of a received parcel
+            struct flight_thread_function
+            {
+                threads::thread_result_type operator()(
+                    threads::thread_restart_state state)
+                {
+                    std::uint64_t const start =
+                        hpx::chrono::high_resolution_clock::now();
+                    record_parcel_stage(action_, parcel_id_,
+                        parcel_stage::scheduling, scheduled_, start);
+
+                    threads::thread_result_type result = f_(state);
+
+                    record_parcel_stage(action_, parcel_id_,
+                        parcel_stage::execution, start,
+                        hpx::chrono::high_resolution_clock::now());
+                    return result;
+                }
+
+                threads::thread_function_type f_;
+                char const* action_;
+                naming::gid_type parcel_id_;
+                std::uint64_t scheduled_;
+            };
+        }    // namespace
+
+        received_parcel_flight::received_parcel_flight(std::uint64_t start,
+            char const* action, naming::gid_type const& parcel_id,
+            bool deserialized) noexcept
+          : previous_(current_flight())
+          , action_(action)
+          , parcel_id_(parcel_id)
+          , start_(start)
+          , deserialized_(deserialized ? start : 0)
+          , scheduled_(false)
+        {
+            if (start_ != 0)
+            {
+                current_flight() = this;
+            }
+        }
+
+        received_parcel_flight::~received_parcel_flight()
+        {
+            if (start_ != 0 && current_flight() == this)
+            {
+                current_flight() = previous_;
+            }
+        }
+
+        void received_parcel_flight::finish(bool deferred) noexcept
+        {
+            if (start_ == 0)
+            {
+                return;
+            }
+
+            if (current_flight() == this)
+            {
+                current_flight() = previous_;
+            }
+
+            // the action was executed directly unless it created a thread or
+            // will be scheduled later
+            if (!scheduled_ && !deferred && deserialized_ != 0)
+            {
+                record_parcel_stage(action_, parcel_id_,
+                    parcel_stage::execution, deserialized_,
+                    hpx::chrono::high_resolution_clock::now());
+            }
+            start_ = 0;
+        }
+
+        void received_parcel_flight::deserialized() noexcept
+        {
+            received_parcel_flight* flight = current_flight();
+            if (flight == nullptr || flight->deserialized_ != 0)
+            {
+                return;
+            }
+
+            flight->deserialized_ = hpx::chrono::high_resolution_clock::now();
+            record_parcel_stage(flight->action_, flight->parcel_id_,
+                parcel_stage::deserialization, flight->start_,
+                flight->deserialized_);
+        }
+
+        void received_parcel_flight::wrap_thread_function(
+            threads::thread_function_type& f)
+        {
+            received_parcel_flight* flight = current_flight();
+            if (flight == nullptr)
+            {
+                return;
+            }
+
+            // only the first thread created belongs to the parcel
+            flight->scheduled_ = true;
+            current_flight() = flight->previous_;
+
+            f = flight_thread_function{HPX_MOVE(f), flight->action_,
+                flight->parcel_id_, hpx::chrono::high_resolution_clock::now()};
+        }
+
+        void received_parcel_flight::execute_inline() noexcept
+        {
+            received_parcel_flight* flight = current_flight();
+            if (flight == nullptr)
+            {
+                return;
+            }
+
+            // the threads created by the action don't belong to the parcel
+            current_flight() = flight->previous_;
+        }
+    }    // namespace detail
+}    // namespace hpx::parcelset
+
+#endif
@@ -171,6 +171,16 @@ namespace hpx::parcelset {
         data_->set_split_gids(HPX_MOVE(split_gids));
     }
 
+    parcel::serialized_segments_type parcel::move_serialized_segments() const
+    {
+        return data_->move_serialized_segments();
+    }
+
+    void parcel::set_serialized_segments(serialized_segments_type&& segments)
+    {
+        data_->set_serialized_segments(HPX_MOVE(segments));
+    }
+
     std::size_t parcel::num_chunks() const
     {
         return data_->num_chunks();
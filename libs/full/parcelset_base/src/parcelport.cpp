@@ -20,17 +20,65 @@
 #include <hpx/modules/threading_base.hpp>
 #endif
 
+#include <hpx/parcelset_base/detail/adaptive_compression.hpp>
 #include <hpx/parcelset_base/parcelport.hpp>
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
 #include <exception>
+#include <mutex>
 #include <string>
 #include <system_error>
 #include <utility>
 
 namespace hpx::parcelset {
 
+    namespace {
+
+        detail::adaptive_compression_parameters get_compression_parameters(
+            util::runtime_configuration const& ini)
+        {
+            detail::adaptive_compression_parameters params;
+
+            params.threshold_ = hpx::util::get_entry_as<std::size_t>(
+                ini, "hpx.parcel.compression_threshold", 0);
+            params.adaptive_ = hpx::util::get_entry_as<int>(ini,
+                                   "hpx.parcel.adaptive_compression", 0) != 0;
+            params.min_ratio_ = hpx::util::get_entry_as<double>(
+                ini, "hpx.parcel.adaptive_compression_min_ratio", 1.2);
+
+            // the time to send a byte (nanoseconds) at the given bandwidth
+            // (MB/s)
+            double const bandwidth = hpx::util::get_entry_as<double>(
+                ini, "hpx.parcel.adaptive_compression_bandwidth", 125.0);
+            params.max_cost_ = 1000.0 / (std::max)(bandwidth, 1e-3);
+
+            std::size_t const window = hpx::util::get_entry_as<std::size_t>(
+                ini, "hpx.parcel.adaptive_compression_window", 8);
+            params.window_ = (std::max)(window, std::size_t(1));
+
+            std::size_t const probe_interval =
+                hpx::util::get_entry_as<std::size_t>(
+                    ini, "hpx.parcel.adaptive_compression_probe_interval", 64);
+            params.probe_interval_ = (std::max)(probe_interval, std::size_t(1));
+
+            return params;
+        }
+
+        std::size_t get_arena_block_size_entry(
+            util::runtime_configuration const& ini)
+        {
+            if (hpx::util::get_entry_as<int>(
+                    ini, "hpx.parcel.arena_allocation", 0) == 0)
+            {
+                return 0;
+            }
+            return hpx::util::get_entry_as<std::size_t>(
+                ini, "hpx.parcel.arena_block_size", 16384);
+        }
+    }    // namespace
+
     ///////////////////////////////////////////////////////////////////////////
     parcelport::parcelport(util::runtime_configuration const& ini,
         locality const& here, std::string const& type,
@@ -46,6 +94,11 @@ namespace hpx::parcelset {
             ini, "hpx.parcel." + type + ".priority", 0))
       , type_(type)
       , zero_copy_serialization_threshold_(zero_copy_serialization_threshold)
+      , arena_block_size_(get_arena_block_size_entry(ini))
+      , compression_(get_compression_parameters(ini))
+      , compressed_messages_(0)
+      , skipped_messages_(0)
+      , compression_bytes_saved_(0)
     {
         std::string key("hpx.parcel.");
         key += type;
@@ -88,11 +141,82 @@ namespace hpx::parcelset {
         return zero_copy_serialization_threshold_;
     }
 
+    std::size_t parcelport::get_arena_block_size() const noexcept
+    {
+        return arena_block_size_;
+    }
+
     locality const& parcelport::here() const noexcept
     {
         return here_;
     }
 
+    ///////////////////////////////////////////////////////////////////////////
+    bool parcelport::compress_message(
+        std::uint32_t destination, std::size_t size)
+    {
+        bool compress = true;
+        if (compression_.parameters().adaptive_)
+        {
+            std::lock_guard l(compression_mtx_);
+            compress =
+                compression_.compress(compression_states_[destination], size);
+        }
+        else
+        {
+            detail::adaptive_compression_state state;
+            compress = compression_.compress(state, size);
+        }
+
+        if (!compress)
+        {
+            ++skipped_messages_;
+        }
+        return compress;
+    }
+
+    void parcelport::update_compression(std::uint32_t destination,
+        std::size_t uncompressed, std::size_t compressed, std::uint64_t time)
+    {
+        ++compressed_messages_;
+        if (uncompressed > compressed)
+        {
+            compression_bytes_saved_ +=
+                static_cast<std::int64_t>(uncompressed - compressed);
+        }
+
+        if (compression_.parameters().adaptive_)
+        {
+            std::lock_guard l(compression_mtx_);
+            compression_.update(compression_states_[destination], uncompressed,
+                compressed, time);
+        }
+    }
+
+    std::int64_t parcelport::get_compression_statistics(
+        compression_statistics_type stat_type, bool reset)
+    {
+        switch (stat_type)
+        {
+        case compression_compressed_messages:
+            return util::get_and_reset_value(compressed_messages_, reset);
+
+        case compression_skipped_messages:
+            return util::get_and_reset_value(skipped_messages_, reset);
+
+        case compression_bytes_saved:
+            return util::get_and_reset_value(compression_bytes_saved_, reset);
+
+        default:
+            break;
+        }
+
+        HPX_THROW_EXCEPTION(bad_parameter,
+            "parcelport::get_compression_statistics",
+            "invalid compression statistics type");
+        return 0;
+    }
+
     bool parcelport::can_connect(
         locality const&, bool use_alternative_parcelport)
     {
@@ -333,6 +457,12 @@ namespace hpx::parcelset {
             HPX_ASSERT(
                 hpx::get<0>(p.second).size() == hpx::get<1>(p.second).size());
         }
+        for (auto&& p : pending_priority_parcels_)
+        {
+            count += hpx::get<0>(p.second).size();
+            HPX_ASSERT(
+                hpx::get<0>(p.second).size() == hpx::get<1>(p.second).size());
+        }
         return count;
     }
 
@@ -0,0 +1,145 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING)
+#include <hpx/assert.hpp>
+#include <hpx/modules/serialization.hpp>
+#include <hpx/modules/synchronization.hpp>
+#include <hpx/parcelset_base/receive_buffers.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace hpx::parcelset {
+
+    namespace {
+
+        struct receive_buffer
+        {
+            void* data_;
+            std::size_t size_;
+        };
+
+        // A registered buffer moves from registered_ to claimed_ once a
+        // parcelport received data into it and to in_use_ once it was handed
+        // to the de-serialized object.
+        struct receive_buffer_registry
+        {
+            using mutex_type = hpx::spinlock;
+
+            mutex_type mtx_;
+            std::unordered_map<std::uint32_t, receive_buffer> registered_;
+            std::unordered_map<std::uint32_t, receive_buffer> claimed_;
+            std::unordered_set<void*> in_use_;
+        };
+
+        receive_buffer_registry& get_receive_buffers()
+        {
+            static receive_buffer_registry registry;
+            return registry;
+        }
+    }    // namespace
+
+    void register_receive_buffer(
+        std::uint32_t key, void* data, std::size_t size)
+    {
+        HPX_ASSERT(!serialization::is_device_memory_key(key));
+
+        receive_buffer_registry& r = get_receive_buffers();
+
+        std::lock_guard l(r.mtx_);
+        r.registered_[key] = receive_buffer{data, size};
+    }
+
+    bool unregister_receive_buffer(std::uint32_t key)
+    {
+        receive_buffer_registry& r = get_receive_buffers();
+
+        std::lock_guard l(r.mtx_);
+        return r.registered_.erase(key) != 0;
+    }
+
+    namespace detail {
+
+        void* claim_receive_buffer(std::uint32_t key, std::size_t size)
+        {
+            receive_buffer_registry& r = get_receive_buffers();
+
+            // the memory is registered without the device memory flag
+            key &= ~serialization::device_memory_key;
+
+            std::lock_guard l(r.mtx_);
+            auto it = r.registered_.find(key);
+            if (it == r.registered_.end() || it->second.size_ < size)
+            {
+                return nullptr;
+            }
+
+            void* data = it->second.data_;
+            r.claimed_[key] = it->second;
+            r.registered_.erase(it);
+            return data;
+        }
+
+        void* take_receive_buffer(std::uint32_t key, std::size_t size)
+        {
+            receive_buffer_registry& r = get_receive_buffers();
+
+            bool const device_memory =
+                serialization::is_device_memory_key(key);
+            key &= ~serialization::device_memory_key;
+
+            std::lock_guard l(r.mtx_);
+
+            // prefer the buffer the data was received into
+            auto it = r.claimed_.find(key);
+            if (it != r.claimed_.end())
+            {
+                receive_buffer const buffer = it->second;
+                r.claimed_.erase(it);
+                if (buffer.size_ < size)
+                {
+                    return nullptr;
+                }
+                r.in_use_.insert(buffer.data_);
+                return buffer.data_;
+            }
+
+            // device memory registered after the data arrived can't be
+            // filled by copying the data
+            if (device_memory)
+            {
+                return nullptr;
+            }
+
+            it = r.registered_.find(key);
+            if (it == r.registered_.end() || it->second.size_ < size)
+            {
+                return nullptr;
+            }
+
+            void* data = it->second.data_;
+            r.registered_.erase(it);
+            r.in_use_.insert(data);
+            return data;
+        }
+
+        bool release_receive_buffer(void* data)
+        {
+            receive_buffer_registry& r = get_receive_buffers();
+
+            std::lock_guard l(r.mtx_);
+            return r.in_use_.erase(data) != 0;
+        }
+    }    // namespace detail
+}    // namespace hpx::parcelset
+
+#endif
@@ -0,0 +1,127 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify that messages are compressed only above the configured threshold and
+// that compression is switched off for destinations for which it does not
+// pay, until a probe shows that it does again.
+
+#include <hpx/config.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/parcelset_base/detail/adaptive_compression.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+using hpx::parcelset::detail::adaptive_compression;
+using hpx::parcelset::detail::adaptive_compression_parameters;
+using hpx::parcelset::detail::adaptive_compression_state;
+
+adaptive_compression_parameters make_parameters(bool adaptive)
+{
+    adaptive_compression_parameters params;
+    params.threshold_ = 1024;
+    params.adaptive_ = adaptive;
+    params.min_ratio_ = 1.5;
+    params.max_cost_ = 8.0;
+    params.window_ = 4;
+    params.probe_interval_ = 16;
+    return params;
+}
+
+void test_threshold()
+{
+    adaptive_compression const compression(make_parameters(false));
+    adaptive_compression_state state;
+
+    HPX_TEST(!compression.compress(state, 0));
+    HPX_TEST(!compression.compress(state, 1023));
+    HPX_TEST(compression.compress(state, 1024));
+
+    // without adaptation compression is never switched off
+    for (int i = 0; i != 16; ++i)
+    {
+        compression.update(state, 1024, 1024, 1000000);
+    }
+    HPX_TEST(state.enabled_);
+    HPX_TEST(compression.compress(state, 4096));
+}
+
+// the number of messages out of the given number which are compressed
+std::size_t count_compressed(adaptive_compression const& compression,
+    adaptive_compression_state& state, std::size_t messages,
+    std::size_t compressed, std::uint64_t time)
+{
+    std::size_t count = 0;
+    for (std::size_t i = 0; i != messages; ++i)
+    {
+        if (compression.compress(state, 4096))
+        {
+            ++count;
+            compression.update(state, 4096, compressed, time);
+        }
+    }
+    return count;
+}
+
+void test_ratio()
+{
+    adaptive_compression const compression(make_parameters(true));
+    adaptive_compression_state state;
+
+    // compression is kept while the data compresses well and quickly
+    HPX_TEST_EQ(count_compressed(compression, state, 64, 1024, 1000),
+        std::size_t(64));
+    HPX_TEST(state.enabled_);
+
+    // the data is compressed until the window is evaluated
+    HPX_TEST_EQ(count_compressed(compression, state, 4, 4000, 1000),
+        std::size_t(4));
+    HPX_TEST(!state.enabled_);
+
+    // only probes are compressed afterwards
+    HPX_TEST_EQ(count_compressed(compression, state, 64, 4000, 1000),
+        std::size_t(4));
+    HPX_TEST(!state.enabled_);
+
+    // a single probe showing compressible data enables compression again
+    HPX_TEST_EQ(count_compressed(compression, state, 16, 1024, 1000),
+        std::size_t(1));
+    HPX_TEST(state.enabled_);
+    HPX_TEST(compression.compress(state, 4096));
+
+    // messages below the threshold are never compressed
+    HPX_TEST(!compression.compress(state, 512));
+}
+
+void test_cost()
+{
+    adaptive_compression const compression(make_parameters(true));
+    adaptive_compression_state state;
+
+    // saving 3072 bytes is worth at most 8 ns per byte
+    HPX_TEST_EQ(count_compressed(compression, state, 4, 1024, 3072 * 8),
+        std::size_t(4));
+    HPX_TEST(state.enabled_);
+
+    HPX_TEST_EQ(count_compressed(compression, state, 4, 1024, 3072 * 9),
+        std::size_t(4));
+    HPX_TEST(!state.enabled_);
+
+    // data which does not shrink disables compression
+    adaptive_compression_state incompressible;
+    HPX_TEST_EQ(count_compressed(compression, incompressible, 4, 4200, 0),
+        std::size_t(4));
+    HPX_TEST(!incompressible.enabled_);
+}
+
+int main()
+{
+    test_threshold();
+    test_ratio();
+    test_cost();
+
+    return hpx::util::report_errors();
+}
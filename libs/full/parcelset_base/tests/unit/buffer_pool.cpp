@@ -0,0 +1,147 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify that message buffers are reused by the buffer pool and that
+// registration hooks are invoked for the buffers owned by the pool.
+
+#include <hpx/config.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/parcelset_base/buffer_pool.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+using hpx::parcelset::buffer_pool;
+
+void test_reuse()
+{
+    buffer_pool pool;
+    pool.configure(true, 4096, 2);
+
+    // buffers are allocated in the size class of the requested size
+    buffer_pool::buffer_type buffer = pool.get(100);
+    HPX_TEST_EQ(buffer.size(), std::size_t(100));
+    HPX_TEST_EQ(buffer.capacity(), std::size_t(256));
+    HPX_TEST_EQ(pool.get_misses(false), std::int64_t(1));
+
+    char const* data = buffer.data();
+    pool.put(HPX_MOVE(buffer));
+
+    // a request of the same size class reuses the buffer
+    buffer = pool.get(200);
+    HPX_TEST_EQ(buffer.size(), std::size_t(200));
+    HPX_TEST(buffer.data() == data);
+    HPX_TEST_EQ(pool.get_hits(false), std::int64_t(1));
+    HPX_TEST_EQ(pool.get_hit_rate(false), std::int64_t(5000));
+
+    // a request of a different size class does not
+    buffer_pool::buffer_type other = pool.get(1000);
+    HPX_TEST_EQ(other.capacity(), std::size_t(1024));
+    HPX_TEST_EQ(pool.get_misses(false), std::int64_t(2));
+
+    // buffers exceeding the maximal size are never pooled
+    buffer_pool::buffer_type large = pool.get(8192);
+    HPX_TEST_EQ(large.size(), std::size_t(8192));
+    pool.put(HPX_MOVE(large));
+    large = pool.get(8192);
+    HPX_TEST_EQ(pool.get_misses(true), std::int64_t(4));
+    HPX_TEST_EQ(pool.get_misses(false), std::int64_t(0));
+
+    // buffers not handed out by the pool are not pooled either
+    pool.put(std::vector<char>(300));
+    buffer_pool::buffer_type small = pool.get(300);
+    HPX_TEST_EQ(small.capacity(), std::size_t(512));
+    HPX_TEST_EQ(pool.get_misses(false), std::int64_t(1));
+
+    HPX_TEST_EQ(pool.get_hits(true), std::int64_t(1));
+    HPX_TEST_EQ(pool.get_hit_rate(true), std::int64_t(1666));
+    HPX_TEST_EQ(pool.get_hit_rate(false), std::int64_t(0));
+}
+
+void test_limits()
+{
+    buffer_pool pool;
+    pool.configure(true, 4096, 2);
+
+    std::vector<buffer_pool::buffer_type> buffers;
+    for (int i = 0; i != 3; ++i)
+    {
+        buffers.push_back(pool.get(64));
+    }
+    for (auto& buffer : buffers)
+    {
+        pool.put(HPX_MOVE(buffer));
+    }
+    buffers.clear();
+
+    // only two buffers were kept
+    for (int i = 0; i != 3; ++i)
+    {
+        buffers.push_back(pool.get(64));
+    }
+    HPX_TEST_EQ(pool.get_hits(false), std::int64_t(2));
+    HPX_TEST_EQ(pool.get_misses(false), std::int64_t(4));
+
+    // a disabled pool does not keep any buffers
+    pool.configure(false, 4096, 2);
+    pool.put(HPX_MOVE(buffers[0]));
+    buffer_pool::buffer_type buffer = pool.get(64);
+    HPX_TEST_EQ(buffer.size(), std::size_t(64));
+    HPX_TEST_EQ(pool.get_hits(false), std::int64_t(2));
+    HPX_TEST_EQ(pool.get_misses(false), std::int64_t(4));
+}
+
+void test_registration()
+{
+    std::size_t registered = 0;
+    std::size_t deregistered = 0;
+
+    buffer_pool pool;
+    pool.configure(true, 4096, 1);
+    pool.set_registration_hooks(
+        [&](void*, std::size_t size) {
+            HPX_TEST_EQ(size, std::size_t(256));
+            ++registered;
+        },
+        [&](void*, std::size_t size) {
+            HPX_TEST_EQ(size, std::size_t(256));
+            ++deregistered;
+        });
+
+    buffer_pool::buffer_type first = pool.get(10);
+    buffer_pool::buffer_type second = pool.get(20);
+    HPX_TEST_EQ(registered, std::size_t(2));
+
+    // the second buffer does not fit into the pool anymore
+    pool.put(HPX_MOVE(first));
+    pool.put(HPX_MOVE(second));
+    HPX_TEST_EQ(deregistered, std::size_t(1));
+
+    // reusing a registered buffer does not register it again
+    first = pool.get(30);
+    HPX_TEST_EQ(registered, std::size_t(2));
+    pool.put(HPX_MOVE(first));
+
+    // unregistered buffers are not pooled
+    std::vector<char> unregistered;
+    unregistered.reserve(256);
+    pool.put(HPX_MOVE(unregistered));
+    HPX_TEST_EQ(deregistered, std::size_t(1));
+
+    pool.clear();
+    HPX_TEST_EQ(deregistered, std::size_t(2));
+}
+
+int main()
+{
+    test_reuse();
+    test_limits();
+    test_registration();
+
+    return hpx::util::report_errors();
+}
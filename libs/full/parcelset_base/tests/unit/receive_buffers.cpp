@@ -0,0 +1,258 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify that serialize_buffer data sent as a zero-copy chunk is
+// de-serialized in place if it was received into registered memory, also if
+// it refers to device memory.
+
+#include <hpx/config.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/modules/serialization.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/parcelset_base/receive_buffers.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <numeric>
+#include <vector>
+
+using allocator_type = hpx::parcelset::receive_buffer_allocator<double>;
+using buffer_type =
+    hpx::serialization::serialize_buffer<double, allocator_type>;
+
+constexpr std::uint32_t key = 42;
+constexpr std::size_t size = 16384;
+
+struct message
+{
+    std::vector<char> data_;
+    std::vector<hpx::serialization::serialization_chunk> chunks_;
+    std::size_t size_ = 0;
+};
+
+message send(std::vector<double>& data, bool device_memory = false)
+{
+    message m;
+    hpx::serialization::output_archive archive(m.data_, 0, &m.chunks_);
+
+    buffer_type buffer(data.data(), data.size(), buffer_type::reference,
+        allocator_type(key, device_memory));
+    archive << buffer;
+    m.size_ = archive.bytes_written();
+    return m;
+}
+
+hpx::serialization::serialization_chunk* find_pointer_chunk(message& m)
+{
+    hpx::serialization::serialization_chunk* chunk = nullptr;
+    for (auto& c : m.chunks_)
+    {
+        if (c.type_ == hpx::serialization::chunk_type::chunk_type_pointer)
+        {
+            chunk = &c;
+        }
+    }
+    return chunk;
+}
+
+void test_in_place()
+{
+    std::vector<double> data(size);
+    std::iota(data.begin(), data.end(), 0.0);
+
+    message m = send(data);
+
+    // the chunk holding the buffer data carries the key
+    hpx::serialization::serialization_chunk* chunk = find_pointer_chunk(m);
+    HPX_TEST(chunk != nullptr);
+    if (chunk == nullptr)
+    {
+        return;
+    }
+    HPX_TEST_EQ(chunk->rkey_, std::uint64_t(key));
+    HPX_TEST_EQ(chunk->size_, size * sizeof(double));
+
+    // emulate the parcelport receiving the chunk into the registered memory
+    std::vector<double> target(size);
+    hpx::parcelset::register_receive_buffer(
+        key, target.data(), target.size() * sizeof(double));
+
+    void* address =
+        hpx::parcelset::detail::claim_receive_buffer(key, chunk->size_);
+    HPX_TEST(address == target.data());
+    std::memcpy(address, chunk->data_.cpos_, chunk->size_);
+    chunk->data_.cpos_ = address;
+
+    // the registration was used
+    HPX_TEST(!hpx::parcelset::unregister_receive_buffer(key));
+
+    {
+        hpx::serialization::input_archive archive(m.data_, m.size_, &m.chunks_);
+
+        buffer_type received;
+        archive >> received;
+
+        HPX_TEST(received.data() == target.data());
+        HPX_TEST_EQ(received.size(), size);
+        HPX_TEST(target == data);
+    }
+
+    // the registered memory was not released by the buffer
+    HPX_TEST(!hpx::parcelset::detail::release_receive_buffer(target.data()));
+}
+
+void test_fallback()
+{
+    std::vector<double> data(size);
+    std::iota(data.begin(), data.end(), 1.0);
+
+    message m = send(data);
+
+    // no memory was registered, the data is received as usual
+    std::vector<double> target(size);
+    HPX_TEST(hpx::parcelset::detail::claim_receive_buffer(
+                 key, size * sizeof(double)) == nullptr);
+
+    hpx::serialization::input_archive archive(m.data_, m.size_, &m.chunks_);
+
+    buffer_type received;
+    archive >> received;
+
+    HPX_TEST(received.data() != target.data());
+    HPX_TEST_EQ(received.size(), size);
+    HPX_TEST(std::equal(data.begin(), data.end(), received.data()));
+}
+
+void test_copy_into_registered()
+{
+    std::vector<double> data(size);
+    std::iota(data.begin(), data.end(), 2.0);
+
+    message m = send(data);
+
+    // memory registered after the data was received is still used
+    std::vector<double> target(size);
+    hpx::parcelset::register_receive_buffer(
+        key, target.data(), target.size() * sizeof(double));
+
+    hpx::serialization::input_archive archive(m.data_, m.size_, &m.chunks_);
+
+    buffer_type received;
+    archive >> received;
+
+    HPX_TEST(received.data() == target.data());
+    HPX_TEST(target == data);
+}
+
+// Host memory stands in for device memory below, the flag only tells the
+// serialization code and the parcelports to not copy the data.
+void test_device_memory_in_place()
+{
+    // the data of device memory is sent as a zero-copy chunk regardless of
+    // its size
+    constexpr std::size_t small_size = 16;
+
+    std::vector<double> data(small_size);
+    std::iota(data.begin(), data.end(), 3.0);
+
+    message m = send(data, true);
+
+    hpx::serialization::serialization_chunk* chunk = find_pointer_chunk(m);
+    HPX_TEST(chunk != nullptr);
+    if (chunk == nullptr)
+    {
+        return;
+    }
+    HPX_TEST(chunk->data_.cpos_ == data.data());
+    HPX_TEST(hpx::serialization::is_device_memory_key(chunk->rkey_));
+    HPX_TEST_EQ(std::uint32_t(chunk->rkey_),
+        key | hpx::serialization::device_memory_key);
+
+    // the memory is registered without the flag
+    std::vector<double> target(small_size);
+    hpx::parcelset::register_receive_buffer(
+        key, target.data(), target.size() * sizeof(double));
+
+    void* address = hpx::parcelset::detail::claim_receive_buffer(
+        std::uint32_t(chunk->rkey_), chunk->size_);
+    HPX_TEST(address == target.data());
+    std::memcpy(address, chunk->data_.cpos_, chunk->size_);
+    chunk->data_.cpos_ = address;
+
+    hpx::serialization::input_archive archive(m.data_, m.size_, &m.chunks_);
+
+    buffer_type received;
+    archive >> received;
+
+    HPX_TEST(received.data() == target.data());
+    HPX_TEST(target == data);
+}
+
+void test_device_memory_registered_late()
+{
+    std::vector<double> data(size);
+    std::iota(data.begin(), data.end(), 4.0);
+
+    message m = send(data, true);
+
+    // device memory registered after the data was received is not used as
+    // the data can't be copied into it
+    std::vector<double> target(size);
+    hpx::parcelset::register_receive_buffer(
+        key, target.data(), target.size() * sizeof(double));
+
+    {
+        hpx::serialization::input_archive archive(
+            m.data_, m.size_, &m.chunks_);
+
+        buffer_type received;
+        archive >> received;
+
+        HPX_TEST(received.data() != target.data());
+        HPX_TEST(std::equal(data.begin(), data.end(), received.data()));
+    }
+
+    HPX_TEST(hpx::parcelset::unregister_receive_buffer(key));
+}
+
+void test_device_memory_without_chunks()
+{
+    std::vector<double> data(size);
+
+    // device memory can't be copied into the archive
+    std::vector<char> archive_data;
+    hpx::serialization::output_archive archive(archive_data);
+
+    buffer_type buffer(data.data(), data.size(), buffer_type::reference,
+        allocator_type(key, true));
+
+    bool caught_exception = false;
+    try
+    {
+        archive << buffer;
+    }
+    catch (hpx::exception const& e)
+    {
+        HPX_TEST_EQ(e.get_error(), hpx::serialization_error);
+        caught_exception = true;
+    }
+    HPX_TEST(caught_exception);
+}
+
+int main()
+{
+    test_in_place();
+    test_fallback();
+    test_copy_into_registered();
+
+    test_device_memory_in_place();
+    test_device_memory_registered_late();
+    test_device_memory_without_chunks();
+
+    return hpx::util::report_errors();
+}
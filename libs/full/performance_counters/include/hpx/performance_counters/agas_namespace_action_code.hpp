@@ -44,6 +44,8 @@ namespace hpx { namespace agas {
         primary_ns_begin_migration = 0b1001001,
         primary_ns_end_migration = 0b1001010,
         primary_ns_statistics_counter = 0b1001011,
+        primary_ns_shard_locks = 0b1001100,
+        primary_ns_contended_shard_locks = 0b1001101,
 
         component_ns_service = 0b0100000,
         component_ns_bulk_service = 0b0100001,
@@ -195,6 +197,11 @@ namespace hpx { namespace agas { namespace detail {
             primary_ns_begin_migration, primary_ns_statistics_counter},
         {"count/end_migration", "", counter_target_count,
             primary_ns_end_migration, primary_ns_statistics_counter},
+    // counters exposing the lock statistics of the table shards
+        {"count/shard_locks", "", counter_target_count, primary_ns_shard_locks,
+            primary_ns_statistics_counter},
+        {"count/contended_shard_locks", "", counter_target_count,
+            primary_ns_contended_shard_locks, primary_ns_statistics_counter},
     // counters exposing API timings
 #if defined(HPX_HAVE_NETWORKING)
         {"time/route", "ns", counter_target_time, primary_ns_route,
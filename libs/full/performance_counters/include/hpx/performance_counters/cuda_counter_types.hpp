@@ -0,0 +1,19 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_GPU_SUPPORT)
+namespace hpx::performance_counters {
+
+    // registers the /cuda counters exposing the statistics of the work
+    // submitted to the devices through the cuda executors
+    HPX_EXPORT void register_cuda_counter_types();
+}    // namespace hpx::performance_counters
+
+#endif
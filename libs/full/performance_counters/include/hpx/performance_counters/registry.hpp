@@ -10,7 +10,9 @@
 #include <hpx/functional/function.hpp>
 #include <hpx/naming_base/id_type.hpp>
 #include <hpx/performance_counters/counters.hpp>
+#include <hpx/synchronization/spinlock.hpp>
 
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <map>
@@ -47,6 +49,14 @@ namespace hpx { namespace performance_counters {
         /// \brief Reset registry by deleting all stored counter types
         void clear();
 
+        /// \brief Add a function which registers a set of counter types the
+        ///        first time the registry is queried for any counter type.
+        ///
+        /// \note The counter types registered this way are not visible to
+        ///       \a add_counter_type, which does not trigger the deferred
+        ///       registration.
+        void add_deferred_counter_types(hpx::function<void()> f);
+
         /// \brief Add a new performance counter type to the (local) registry
         counter_status add_counter_type(counter_info const& info,
             create_counter_func const& create_counter,
@@ -166,8 +176,23 @@ namespace hpx { namespace performance_counters {
             std::string const& type_name) const;
 
     private:
+        // same as locate_counter_type without running the deferred counter
+        // type registrations
+        counter_type_map_type::iterator find_counter_type(
+            std::string const& type_name);
+        counter_type_map_type::const_iterator find_counter_type(
+            std::string const& type_name) const;
+
+        void register_deferred_counter_types() const;
+
         counter_type_map_type countertypes_;
 
+        // the deferred registrations run exactly once, the others querying
+        // the registry meanwhile wait for them to finish
+        mutable hpx::spinlock deferred_mtx_;
+        mutable std::atomic<bool> has_deferred_{false};
+        mutable std::vector<hpx::function<void()>> deferred_;
+
     public:
         static registry& instance();
     };
@@ -50,6 +50,10 @@ namespace hpx { namespace performance_counters {
             hpx::bind_front(
                 &agas::addressing_service::get_cache_erase_entry_count,
                 &client));
+        hpx::function<std::int64_t(bool)> coalesced_resolves_count(
+            hpx::bind_front(
+                &agas::addressing_service::get_coalesced_resolves_count,
+                &client));
 
         hpx::function<std::int64_t(bool)> cache_get_entry_time(hpx::bind_front(
             &agas::addressing_service::get_cache_get_entry_time, &client));
@@ -156,6 +160,16 @@ namespace hpx { namespace performance_counters {
                         &performance_counters::locality_raw_counter_creator, _1,
                         cache_erase_entry_count, _2),
                     &performance_counters::locality_counter_discoverer, ""},
+                {"/agas/count/cache/coalesced",
+                    performance_counters::counter_type::
+                        monotonically_increasing,
+                    "returns the number of address resolutions which were "
+                    "attached to a request for the same id already in flight",
+                    HPX_PERFORMANCE_COUNTER_V1,
+                    hpx::bind(
+                        &performance_counters::locality_raw_counter_creator, _1,
+                        coalesced_resolves_count, _2),
+                    &performance_counters::locality_counter_discoverer, ""},
                 {"/agas/time/cache/get_entry",
                     performance_counters::counter_type::
                         monotonically_increasing,
@@ -0,0 +1,308 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_GPU_SUPPORT)
+#include <hpx/async_cuda/cuda_statistics.hpp>
+#include <hpx/functional/bind_front.hpp>
+#include <hpx/functional/function.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/performance_counters/counter_creators.hpp>
+#include <hpx/performance_counters/counters.hpp>
+#include <hpx/performance_counters/cuda_counter_types.hpp>
+#include <hpx/performance_counters/manage_counter_type.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx::performance_counters {
+
+    namespace detail {
+
+        using cuda::experimental::device_statistics;
+
+        using device_counter_func =
+            std::int64_t (device_statistics::*)(bool) noexcept;
+
+        // the sum of the values of all devices
+        std::int64_t cuda_total_value(device_counter_func func, bool reset)
+        {
+            std::int64_t value = 0;
+            std::size_t const num_devices =
+                device_statistics::get_num_devices();
+            for (std::size_t i = 0; i != num_devices; ++i)
+            {
+                value += (device_statistics::get(static_cast<int>(i)).*func)(
+                    reset);
+            }
+            return value;
+        }
+
+        // the average time of the timed kernels of all devices
+        std::int64_t cuda_total_average_kernel_time(bool reset)
+        {
+            std::int64_t const count = cuda_total_value(
+                &device_statistics::get_timed_kernel_count, reset);
+            std::int64_t const time =
+                cuda_total_value(&device_statistics::get_kernel_time, reset);
+            return count == 0 ? 0 : time / count;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // Creation function for the counters of the devices, the counter
+        // instance name has to follow the scheme:
+        //
+        //   /cuda{locality#<locality_id>/total}/<instancename>
+        //   /cuda{locality#<locality_id>/device#<device_id>}/<instancename>
+        //
+        naming::gid_type cuda_device_counter_creator(device_counter_func func,
+            hpx::function<std::int64_t(bool)> const& total_func,
+            counter_info const& info, error_code& ec)
+        {
+            // verify the validity of the counter instance name
+            counter_path_elements paths;
+            get_counter_path_elements(info.fullname_, paths, ec);
+            if (ec)
+            {
+                return naming::invalid_gid;
+            }
+
+            if (paths.parentinstance_is_basename_)
+            {
+                HPX_THROWS_IF(ec, bad_parameter, "cuda_device_counter_creator",
+                    "invalid counter instance parent name: {}",
+                    paths.parentinstancename_);
+                return naming::invalid_gid;
+            }
+
+            if (paths.instancename_ == "total" && paths.instanceindex_ == -1)
+            {
+                // overall counter
+                using detail::create_raw_counter;
+                return create_raw_counter(info, total_func, ec);
+            }
+            else if (paths.instancename_ == "device" &&
+                paths.instanceindex_ >= 0 &&
+                std::size_t(paths.instanceindex_) <
+                    device_statistics::get_num_devices())
+            {
+                // specific device counter
+                using detail::create_raw_counter;
+                hpx::function<std::int64_t(bool)> f = hpx::bind_front(func,
+                    &device_statistics::get(
+                        static_cast<int>(paths.instanceindex_)));
+                return create_raw_counter(info, HPX_MOVE(f), ec);
+            }
+
+            HPX_THROWS_IF(ec, bad_parameter, "cuda_device_counter_creator",
+                "invalid counter instance name: {}", paths.instancename_);
+            return naming::invalid_gid;
+        }
+
+        // the kernels are only timed while a kernel time counter exists
+        naming::gid_type cuda_kernel_time_counter_creator(
+            counter_info const& info, error_code& ec)
+        {
+            naming::gid_type gid = cuda_device_counter_creator(
+                &device_statistics::get_average_kernel_time,
+                &cuda_total_average_kernel_time, info, ec);
+
+            if (!ec)
+            {
+                device_statistics::enable_kernel_timing(true);
+            }
+            return gid;
+        }
+
+        // the polls are only timed while a polling time counter exists
+        naming::gid_type cuda_polling_time_counter_creator(
+            counter_info const& info, error_code& ec)
+        {
+            naming::gid_type gid = locality_raw_counter_creator(
+                info, &device_statistics::get_polling_time, ec);
+
+            if (!ec)
+            {
+                device_statistics::enable_polling_timing(true);
+            }
+            return gid;
+        }
+
+        naming::gid_type cuda_polling_count_counter_creator(
+            counter_info const& info, error_code& ec)
+        {
+            return locality_raw_counter_creator(
+                info, &device_statistics::get_polling_count, ec);
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        bool cuda_device_counter_discoverer(counter_info const& info,
+            discover_counter_func const& f, discover_counters_mode mode,
+            error_code& ec)
+        {
+            counter_info i = info;
+
+            // compose the counter name templates
+            counter_path_elements p;
+            counter_status status =
+                get_counter_path_elements(info.fullname_, p, ec);
+            if (!status_is_valid(status))
+            {
+                return false;
+            }
+
+            std::size_t const num_devices =
+                device_statistics::get_num_devices();
+
+            bool expand_devices = false;
+            if (mode == discover_counters_mode::minimal ||
+                p.parentinstancename_.empty() || p.instancename_.empty())
+            {
+                if (p.parentinstancename_.empty())
+                {
+                    p.parentinstancename_ = "locality#*";
+                    p.parentinstanceindex_ = -1;
+                }
+
+                if (p.instancename_.empty())
+                {
+                    p.instancename_ = "total";
+                    p.instanceindex_ = -1;
+                }
+
+                status = get_counter_name(p, i.fullname_, ec);
+                if (!status_is_valid(status) || !f(i, ec) || ec)
+                {
+                    return false;
+                }
+
+                if (mode == discover_counters_mode::full)
+                {
+                    expand_devices = true;
+                }
+                else
+                {
+                    p.instancename_ = "device#*";
+                    p.instanceindex_ = -1;
+
+                    status = get_counter_name(p, i.fullname_, ec);
+                    if (!status_is_valid(status) || !f(i, ec) || ec)
+                    {
+                        return false;
+                    }
+                }
+            }
+            else if (p.instancename_ == "device#*")
+            {
+                expand_devices = true;
+            }
+            else if (!f(i, ec) || ec)
+            {
+                return false;
+            }
+
+            if (expand_devices)
+            {
+                for (std::size_t d = 0; d != num_devices; ++d)
+                {
+                    p.instancename_ = "device";
+                    p.instanceindex_ = static_cast<std::int32_t>(d);
+                    status = get_counter_name(p, i.fullname_, ec);
+                    if (!status_is_valid(status) || !f(i, ec) || ec)
+                    {
+                        return false;
+                    }
+                }
+            }
+
+            if (&ec != &throws)
+            {
+                ec = make_success_code();
+            }
+
+            return true;
+        }
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    void register_cuda_counter_types()
+    {
+        using detail::device_statistics;
+
+        generic_counter_type_data const counter_types[] = {
+            // /cuda{locality#%d/device#%d}/kernels/count
+            {"/cuda/kernels/count", counter_type::monotonically_increasing,
+                "returns the number of kernels launched on the referenced "
+                "device through the cuda executors",
+                HPX_PERFORMANCE_COUNTER_V1,
+                hpx::bind_front(&detail::cuda_device_counter_creator,
+                    &device_statistics::get_kernel_count,
+                    hpx::bind_front(&detail::cuda_total_value,
+                        &device_statistics::get_kernel_count)),
+                &detail::cuda_device_counter_discoverer, ""},
+            // /cuda{locality#%d/device#%d}/kernels/time/average
+            {"/cuda/kernels/time/average", counter_type::raw,
+                "returns the average time of the kernels launched on the "
+                "referenced device through the cuda executors, the kernels "
+                "are timed while this counter exists",
+                HPX_PERFORMANCE_COUNTER_V1,
+                &detail::cuda_kernel_time_counter_creator,
+                &detail::cuda_device_counter_discoverer, "ns"},
+            // /cuda{locality#%d/device#%d}/data/host-to-device
+            {"/cuda/data/host-to-device",
+                counter_type::monotonically_increasing,
+                "returns the number of bytes copied from the host to the "
+                "referenced device through the cuda executors",
+                HPX_PERFORMANCE_COUNTER_V1,
+                hpx::bind_front(&detail::cuda_device_counter_creator,
+                    &device_statistics::get_host_to_device_bytes,
+                    hpx::bind_front(&detail::cuda_total_value,
+                        &device_statistics::get_host_to_device_bytes)),
+                &detail::cuda_device_counter_discoverer, "bytes"},
+            // /cuda{locality#%d/device#%d}/data/device-to-host
+            {"/cuda/data/device-to-host",
+                counter_type::monotonically_increasing,
+                "returns the number of bytes copied from the referenced "
+                "device to the host through the cuda executors",
+                HPX_PERFORMANCE_COUNTER_V1,
+                hpx::bind_front(&detail::cuda_device_counter_creator,
+                    &device_statistics::get_device_to_host_bytes,
+                    hpx::bind_front(&detail::cuda_total_value,
+                        &device_statistics::get_device_to_host_bytes)),
+                &detail::cuda_device_counter_discoverer, "bytes"},
+            // /cuda{locality#%d/device#%d}/streams/queue-depth
+            {"/cuda/streams/queue-depth", counter_type::raw,
+                "returns the current number of completions awaited on the "
+                "streams of the referenced device",
+                HPX_PERFORMANCE_COUNTER_V1,
+                hpx::bind_front(&detail::cuda_device_counter_creator,
+                    &device_statistics::get_queue_depth,
+                    hpx::bind_front(&detail::cuda_total_value,
+                        &device_statistics::get_queue_depth)),
+                &detail::cuda_device_counter_discoverer, ""},
+            // /cuda{locality#%d/total}/polling/time
+            {"/cuda/polling/time", counter_type::elapsed_time,
+                "returns the overall time spent polling for completed cuda "
+                "events, the polls are timed while this counter exists",
+                HPX_PERFORMANCE_COUNTER_V1,
+                &detail::cuda_polling_time_counter_creator,
+                &locality_counter_discoverer, "ns"},
+            // /cuda{locality#%d/total}/polling/count
+            {"/cuda/polling/count", counter_type::monotonically_increasing,
+                "returns the number of timed polls for completed cuda events",
+                HPX_PERFORMANCE_COUNTER_V1,
+                &detail::cuda_polling_count_counter_creator,
+                &locality_counter_discoverer, ""}};
+
+        install_counter_types(
+            counter_types, sizeof(counter_types) / sizeof(counter_types[0]));
+    }
+}    // namespace hpx::performance_counters
+
+#endif
@@ -10,13 +10,17 @@
 #include <hpx/modules/format.hpp>
 #include <hpx/modules/functional.hpp>
 #include <hpx/parcelset/parcelhandler.hpp>
+#include <hpx/parcelset_base/buffer_pool.hpp>
+#include <hpx/parcelset_base/parcel_flight_recorder.hpp>
 #include <hpx/performance_counters/counter_creators.hpp>
 #include <hpx/performance_counters/counters.hpp>
 #include <hpx/performance_counters/manage_counter_type.hpp>
 #include <hpx/performance_counters/parcelhandler_counter_types.hpp>
 
+#include <cstddef>
 #include <cstdint>
 #include <string>
+#include <vector>
 
 namespace hpx::performance_counters {
 
@@ -590,6 +594,194 @@ namespace hpx::performance_counters {
             sizeof(connection_cache_types) / sizeof(connection_cache_types[0]));
     }
 
+    ///////////////////////////////////////////////////////////////////////////
+    // register connection specific performance counters related to the
+    // compression of messages
+    void register_compression_counter_types(
+        parcelset::parcelhandler& ph, std::string const& pp_type)
+    {
+        if (!ph.is_networking_enabled())
+        {
+            return;
+        }
+
+        using hpx::placeholders::_1;
+        using hpx::placeholders::_2;
+
+        using parcelset::parcelhandler;
+        using parcelset::parcelport;
+
+        hpx::function<std::int64_t(bool)> compressed_messages(
+            hpx::bind_front(&parcelhandler::get_compression_statistics, &ph,
+                pp_type, parcelport::compression_compressed_messages));
+        hpx::function<std::int64_t(bool)> skipped_messages(
+            hpx::bind_front(&parcelhandler::get_compression_statistics, &ph,
+                pp_type, parcelport::compression_skipped_messages));
+        hpx::function<std::int64_t(bool)> bytes_saved(
+            hpx::bind_front(&parcelhandler::get_compression_statistics, &ph,
+                pp_type, parcelport::compression_bytes_saved));
+
+        performance_counters::generic_counter_type_data const
+            compression_types[] = {
+                {hpx::util::format(
+                     "/parcelport/count/{}/compression/compressed", pp_type),
+                    performance_counters::counter_type::raw,
+                    hpx::util::format(
+                        "returns the number of messages compressed by the {} "
+                        "connection type on the referenced locality",
+                        pp_type),
+                    HPX_PERFORMANCE_COUNTER_V1,
+                    hpx::bind(
+                        &performance_counters::locality_raw_counter_creator, _1,
+                        HPX_MOVE(compressed_messages), _2),
+                    &performance_counters::locality_counter_discoverer, ""},
+                {hpx::util::format(
+                     "/parcelport/count/{}/compression/skipped", pp_type),
+                    performance_counters::counter_type::raw,
+                    hpx::util::format(
+                        "returns the number of messages using a serialization "
+                        "filter which were sent uncompressed by the {} "
+                        "connection type on the referenced locality",
+                        pp_type),
+                    HPX_PERFORMANCE_COUNTER_V1,
+                    hpx::bind(
+                        &performance_counters::locality_raw_counter_creator, _1,
+                        HPX_MOVE(skipped_messages), _2),
+                    &performance_counters::locality_counter_discoverer, ""},
+                {hpx::util::format(
+                     "/parcelport/count/{}/compression/bytes-saved", pp_type),
+                    performance_counters::counter_type::raw,
+                    hpx::util::format(
+                        "returns the number of bytes saved by compressing "
+                        "messages sent by the {} connection type on the "
+                        "referenced locality",
+                        pp_type),
+                    HPX_PERFORMANCE_COUNTER_V1,
+                    hpx::bind(
+                        &performance_counters::locality_raw_counter_creator, _1,
+                        HPX_MOVE(bytes_saved), _2),
+                    &performance_counters::locality_counter_discoverer,
+                    "bytes"}};
+
+        performance_counters::install_counter_types(compression_types,
+            sizeof(compression_types) / sizeof(compression_types[0]));
+    }
+
+#if defined(HPX_HAVE_PARCEL_PROFILING)
+    namespace detail {
+
+        enum class parcel_flight_value
+        {
+            count,
+            average,
+            max
+        };
+
+        // parcel flight counter creation function, the action name is given
+        // as the (optional) counter parameter
+        naming::gid_type parcel_flight_counter_creator(
+            parcelset::parcel_stage stage, parcel_flight_value which,
+            counter_info const& info, error_code& ec)
+        {
+            counter_path_elements paths;
+            get_counter_path_elements(info.fullname_, paths, ec);
+            if (ec)
+            {
+                return naming::invalid_gid;
+            }
+
+            hpx::function<std::int64_t(bool)> f =
+                [action = paths.parameters_, stage, which](
+                    bool reset) -> std::int64_t {
+                parcelset::parcel_stage_statistics const statistics =
+                    parcelset::get_parcel_stage_statistics(
+                        action, stage, reset);
+                switch (which)
+                {
+                case parcel_flight_value::count:
+                    return static_cast<std::int64_t>(statistics.count);
+                case parcel_flight_value::average:
+                    return statistics.count == 0 ?
+                        0 :
+                        static_cast<std::int64_t>(
+                            statistics.time / statistics.count);
+                case parcel_flight_value::max:
+                    return static_cast<std::int64_t>(statistics.max);
+                }
+                return 0;
+            };
+
+            naming::gid_type gid =
+                locality_raw_counter_creator(info, HPX_MOVE(f), ec);
+            if (!ec)
+            {
+                parcelset::enable_parcel_flight_recording(true);
+            }
+            return gid;
+        }
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    // register the counters of the parcel flight recorder, one set for each
+    // stage of the parcels
+    void register_parcel_flight_counter_types()
+    {
+        using hpx::placeholders::_1;
+        using hpx::placeholders::_2;
+
+        using parcelset::parcel_stage;
+        using value = detail::parcel_flight_value;
+
+        std::vector<performance_counters::generic_counter_type_data>
+            counter_types;
+        counter_types.reserve(3 * parcelset::num_parcel_stages);
+
+        for (std::size_t i = 0; i != parcelset::num_parcel_stages; ++i)
+        {
+            parcel_stage const stage = static_cast<parcel_stage>(i);
+            char const* const name = parcelset::get_parcel_stage_name(stage);
+
+            auto const add = [&](std::string&& counter_name,
+                                 counter_type type, std::string&& helptext,
+                                 value which, char const* unit) {
+                counter_types.push_back({HPX_MOVE(counter_name), type,
+                    HPX_MOVE(helptext), HPX_PERFORMANCE_COUNTER_V1,
+                    hpx::bind(&detail::parcel_flight_counter_creator, stage,
+                        which, _1, _2),
+                    &performance_counters::locality_counter_discoverer, unit});
+            };
+
+            add(hpx::util::format("/parcels/flight/count/{}", name),
+                counter_type::monotonically_increasing,
+                hpx::util::format(
+                    "returns the number of parcels (of the action given as "
+                    "the counter parameter) for which the {} stage was "
+                    "recorded on the referenced locality",
+                    name),
+                value::count, "");
+            add(hpx::util::format("/parcels/flight/time/{}", name),
+                counter_type::raw,
+                hpx::util::format(
+                    "returns the average time the parcels (of the action "
+                    "given as the counter parameter) spent in the {} stage on "
+                    "the referenced locality",
+                    name),
+                value::average, "ns");
+            add(hpx::util::format("/parcels/flight/time/{}/max", name),
+                counter_type::raw,
+                hpx::util::format(
+                    "returns the maximum time a parcel (of the action given "
+                    "as the counter parameter) spent in the {} stage on the "
+                    "referenced locality",
+                    name),
+                value::max, "ns");
+        }
+
+        performance_counters::install_counter_types(
+            counter_types.data(), counter_types.size());
+    }
+#endif
+
     ///////////////////////////////////////////////////////////////////////////
     void register_parcelhandler_counter_types(parcelset::parcelhandler& ph)
     {
@@ -597,9 +789,17 @@ namespace hpx::performance_counters {
         ph.enum_parcelports([&](std::string const& type) -> bool {
             register_parcelhandler_counter_types(ph, type);
             register_connection_cache_counter_types(ph, type);
+            register_compression_counter_types(ph, type);
             return true;
         });
 
+#if defined(HPX_HAVE_PARCEL_PROFILING)
+        if (ph.is_networking_enabled())
+        {
+            register_parcel_flight_counter_types();
+        }
+#endif
+
         using placeholders::_1;
         using placeholders::_2;
 
@@ -613,6 +813,15 @@ namespace hpx::performance_counters {
         hpx::function<std::int64_t(bool)> outgoing_routed_count(
             hpx::bind_front(&parcelhandler::get_parcel_routed_count, &ph));
 
+        using parcelset::buffer_pool;
+        hpx::function<std::int64_t(bool)> buffer_pool_hits(hpx::bind_front(
+            &buffer_pool::get_hits, &buffer_pool::instance()));
+        hpx::function<std::int64_t(bool)> buffer_pool_misses(hpx::bind_front(
+            &buffer_pool::get_misses, &buffer_pool::instance()));
+        hpx::function<std::int64_t(bool)> buffer_pool_hit_rate(
+            hpx::bind_front(
+                &buffer_pool::get_hit_rate, &buffer_pool::instance()));
+
         performance_counters::generic_counter_type_data const counter_types[] =
             {{"/parcelqueue/length/receive",
                  performance_counters::counter_type::raw,
@@ -640,7 +849,38 @@ namespace hpx::performance_counters {
                     hpx::bind(
                         &performance_counters::locality_raw_counter_creator, _1,
                         outgoing_routed_count, _2),
-                    &performance_counters::locality_counter_discoverer, ""}};
+                    &performance_counters::locality_counter_discoverer, ""},
+                {"/parcelport/count/buffer-pool-hits",
+                    performance_counters::counter_type::
+                        monotonically_increasing,
+                    "returns the number of message buffers which were "
+                    "reused from the buffer pool shared by all parcelports",
+                    HPX_PERFORMANCE_COUNTER_V1,
+                    hpx::bind(
+                        &performance_counters::locality_raw_counter_creator, _1,
+                        buffer_pool_hits, _2),
+                    &performance_counters::locality_counter_discoverer, ""},
+                {"/parcelport/count/buffer-pool-misses",
+                    performance_counters::counter_type::
+                        monotonically_increasing,
+                    "returns the number of message buffers which had to be "
+                    "allocated as the buffer pool shared by all parcelports "
+                    "had no matching buffer",
+                    HPX_PERFORMANCE_COUNTER_V1,
+                    hpx::bind(
+                        &performance_counters::locality_raw_counter_creator, _1,
+                        buffer_pool_misses, _2),
+                    &performance_counters::locality_counter_discoverer, ""},
+                {"/parcelport/buffer-pool-hit-rate",
+                    performance_counters::counter_type::raw,
+                    "returns the ratio of message buffers reused from the "
+                    "buffer pool to all requested message buffers",
+                    HPX_PERFORMANCE_COUNTER_V1,
+                    hpx::bind(
+                        &performance_counters::locality_raw_counter_creator, _1,
+                        buffer_pool_hit_rate, _2),
+                    &performance_counters::locality_counter_discoverer,
+                    "0.01%"}};
 
         performance_counters::install_counter_types(
             counter_types, sizeof(counter_types) / sizeof(counter_types[0]));
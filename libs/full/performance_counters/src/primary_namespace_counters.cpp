@@ -22,6 +22,7 @@
 #include <hpx/performance_counters/manage_counter_type.hpp>
 #include <hpx/performance_counters/primary_namespace_counters.hpp>
 #include <hpx/performance_counters/server/primary_namespace_counters.hpp>
+#include <hpx/util/from_string.hpp>
 
 #include <cstddef>
 #include <cstdint>
@@ -52,7 +53,21 @@ namespace hpx { namespace agas { namespace server {
             std::string::size_type p = name.find_last_of('/');
             HPX_ASSERT(p != std::string::npos);
 
-            if (agas::detail::primary_namespace_services[i].target_ ==
+            namespace_action_code const code =
+                agas::detail::primary_namespace_services[i].code_;
+            if (code == primary_ns_shard_locks ||
+                code == primary_ns_contended_shard_locks)
+            {
+                help = hpx::util::format("returns the number of {}locks "
+                                         "acquired for the table shards of the "
+                                         "AGAS primary namespace (the "
+                                         "parameter selects a single shard)",
+                    code == primary_ns_contended_shard_locks ? "contended " :
+                                                               "");
+                type = performance_counters::counter_type::
+                    monotonically_increasing;
+            }
+            else if (agas::detail::primary_namespace_services[i].target_ ==
                 agas::detail::counter_target_count)
             {
                 help = hpx::util::format("returns the number of invocations "
@@ -175,7 +190,37 @@ namespace hpx { namespace agas { namespace server {
         using cd = primary_namespace::counter_data;
 
         hpx::function<std::int64_t(bool)> get_data_func;
-        if (target == agas::detail::counter_target_count)
+        if (code == primary_ns_shard_locks ||
+            code == primary_ns_contended_shard_locks)
+        {
+            // the optional parameter selects a single shard
+            std::size_t shard = primary_namespace::num_shards;
+            if (!p.parameters_.empty())
+            {
+                shard = hpx::util::from_string<std::size_t>(
+                    p.parameters_, primary_namespace::num_shards);
+                if (shard >= primary_namespace::num_shards)
+                {
+                    HPX_THROW_EXCEPTION(bad_parameter,
+                        "primary_namespace::statistics_counter",
+                        "invalid shard index: {} (there are {} shards)",
+                        p.parameters_, primary_namespace::num_shards);
+                }
+            }
+
+            if (code == primary_ns_shard_locks)
+            {
+                get_data_func = hpx::bind_front(
+                    &primary_namespace::get_shard_lock_count, &service, shard);
+            }
+            else
+            {
+                get_data_func = hpx::bind_front(
+                    &primary_namespace::get_contended_shard_lock_count,
+                    &service, shard);
+            }
+        }
+        else if (target == agas::detail::counter_target_count)
         {
             switch (code)
             {
@@ -20,6 +20,7 @@
 #include <hpx/performance_counters/server/raw_counter.hpp>
 #include <hpx/performance_counters/server/raw_values_counter.hpp>
 #include <hpx/performance_counters/server/statistics_counter.hpp>
+#include <hpx/statistics/hdr_histogram.hpp>
 #include <hpx/statistics/rolling_max.hpp>
 #include <hpx/statistics/rolling_min.hpp>
 #include <hpx/util/regex_from_pattern.hpp>
@@ -30,6 +31,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <functional>
+#include <mutex>
 #include <regex>
 #include <string>
 #include <utility>
@@ -41,11 +43,58 @@ namespace hpx { namespace performance_counters {
     ///////////////////////////////////////////////////////////////////////////
     void registry::clear()
     {
+        {
+            std::lock_guard<hpx::spinlock> l(deferred_mtx_);
+            deferred_.clear();
+            has_deferred_ = false;
+        }
         countertypes_.clear();
     }
 
+    void registry::add_deferred_counter_types(hpx::function<void()> f)
+    {
+        std::lock_guard<hpx::spinlock> l(deferred_mtx_);
+        deferred_.push_back(HPX_MOVE(f));
+        has_deferred_ = true;
+    }
+
+    void registry::register_deferred_counter_types() const
+    {
+        if (!has_deferred_.load(std::memory_order_acquire))
+            return;
+
+        std::lock_guard<hpx::spinlock> l(deferred_mtx_);
+        if (!has_deferred_.load(std::memory_order_relaxed))
+            return;
+
+        // the registration functions add counter types only, which does not
+        // get here again
+        std::vector<hpx::function<void()>> deferred;
+        std::swap(deferred, deferred_);
+        for (auto const& f : deferred)
+        {
+            f();
+        }
+
+        has_deferred_.store(false, std::memory_order_release);
+    }
+
     registry::counter_type_map_type::iterator registry::locate_counter_type(
         std::string const& type_name)
+    {
+        register_deferred_counter_types();
+        return find_counter_type(type_name);
+    }
+
+    registry::counter_type_map_type::const_iterator
+    registry::locate_counter_type(std::string const& type_name) const
+    {
+        register_deferred_counter_types();
+        return find_counter_type(type_name);
+    }
+
+    registry::counter_type_map_type::iterator registry::find_counter_type(
+        std::string const& type_name)
     {
         counter_type_map_type::iterator it = countertypes_.find(type_name);
         if (it == countertypes_.end())
@@ -62,7 +111,7 @@ namespace hpx { namespace performance_counters {
     }
 
     registry::counter_type_map_type::const_iterator
-    registry::locate_counter_type(std::string const& type_name) const
+    registry::find_counter_type(std::string const& type_name) const
     {
         counter_type_map_type::const_iterator it =
             countertypes_.find(type_name);
@@ -91,7 +140,7 @@ namespace hpx { namespace performance_counters {
         if (!status_is_valid(status))
             return status;
 
-        counter_type_map_type::iterator it = locate_counter_type(type_name);
+        counter_type_map_type::iterator it = find_counter_type(type_name);
         if (it != countertypes_.end())
         {
             HPX_THROWS_IF(ec, bad_parameter, "registry::add_counter_type",
@@ -128,6 +177,8 @@ namespace hpx { namespace performance_counters {
         if (!status_is_valid(status))
             return status;
 
+        register_deferred_counter_types();
+
         if (type_name.find_first_of("*?[]") == std::string::npos)
         {
             counter_type_map_type::iterator it = locate_counter_type(type_name);
@@ -257,6 +308,8 @@ namespace hpx { namespace performance_counters {
             discover_counter_ = HPX_MOVE(discover_counter);
         }
 
+        register_deferred_counter_types();
+
         for (counter_type_map_type::value_type const& d : countertypes_)
         {
             if (!d.second.discover_counters_.empty() &&
@@ -370,7 +423,8 @@ namespace hpx { namespace performance_counters {
         if (!status_is_valid(status))
             return status;
 
-        counter_type_map_type::iterator it = locate_counter_type(type_name);
+        // don't run the deferred registrations just to remove a counter type
+        counter_type_map_type::iterator it = find_counter_type(type_name);
         if (it == countertypes_.end())
         {
             HPX_THROWS_IF(ec, bad_parameter, "registry::remove_counter_type",
@@ -847,6 +901,30 @@ namespace hpx { namespace performance_counters {
                     complemented_info, base_counter_name, sample_interval,
                     window_size, reset_base_counter);
             }
+            else if (p.countername_ == "p50" || p.countername_ == "p90" ||
+                p.countername_ == "p99" || p.countername_ == "p999")
+            {
+                typedef hpx::components::component<
+                    hpx::performance_counters::server::statistics_counter<
+                        hpx::util::tag::hdr_percentile>>
+                    counter_t;
+
+                // the percentile in tenths of a percent
+                std::size_t percentile = 999;
+                if (p.countername_ == "p50")
+                    percentile = 500;
+                else if (p.countername_ == "p90")
+                    percentile = 900;
+                else if (p.countername_ == "p99")
+                    percentile = 990;
+
+                if (parameters.size() > 1)
+                    reset_base_counter = (parameters[1] != 0) ? true : false;
+
+                gid = components::server::construct<counter_t>(
+                    complemented_info, base_counter_name, sample_interval,
+                    percentile, reset_base_counter);
+            }
             else
             {
                 HPX_THROWS_IF(ec, bad_parameter,
@@ -27,6 +27,7 @@
 #include <boost/accumulators/statistics/stats.hpp>
 #include <boost/accumulators/statistics/variance.hpp>
 
+#include <hpx/statistics/hdr_histogram.hpp>
 #include <hpx/statistics/rolling_max.hpp>
 #include <hpx/statistics/rolling_min.hpp>
 
@@ -373,6 +374,49 @@ namespace hpx { namespace performance_counters { namespace server {
         private:
             accumulator_type accum_;
         };
+
+        // The percentile (parameter2 in tenths of a percent) of all values
+        // added since the last reset, the values are recorded into a high
+        // dynamic range histogram, which bounds the error to 1/64 of the
+        // reported value.
+        template <>
+        struct counter_type_from_statistic<hpx::util::tag::hdr_percentile>
+          : counter_type_from_statistic_base
+        {
+            counter_type_from_statistic(std::size_t parameter2)
+              : percentile_(static_cast<double>(parameter2) / 10.0)
+              , histogram_(1)
+            {
+                if (parameter2 > 1000)
+                {
+                    HPX_THROW_EXCEPTION(bad_parameter,
+                        "counter_type_from_statistic<Statistic>",
+                        "percentile is specified to be larger than 100%");
+                }
+            }
+
+            double get_value() override
+            {
+                return static_cast<double>(
+                    histogram_.get_percentile(percentile_));
+            }
+
+            void add_value(double value) override
+            {
+                // negative values are counted as zero
+                histogram_.record(
+                    value > 0 ? static_cast<std::uint64_t>(value + 0.5) : 0);
+            }
+
+            bool need_reset() const override
+            {
+                return false;
+            }
+
+        private:
+            double percentile_;
+            hpx::util::hdr_histogram histogram_;
+        };
     }    // namespace detail
 
     ///////////////////////////////////////////////////////////////////////////
@@ -647,6 +691,8 @@ template class HPX_EXPORT hpx::performance_counters::server::statistics_counter<
     hpx::util::tag::rolling_min>;
 template class HPX_EXPORT hpx::performance_counters::server::statistics_counter<
     hpx::util::tag::rolling_max>;
+template class HPX_EXPORT hpx::performance_counters::server::statistics_counter<
+    hpx::util::tag::hdr_percentile>;
 
 ///////////////////////////////////////////////////////////////////////////////
 // Average
@@ -747,6 +793,17 @@ HPX_REGISTER_DERIVED_COMPONENT_FACTORY(rolling_max_count_counter_type,
     hpx::components::factory_enabled)
 HPX_DEFINE_GET_COMPONENT_TYPE(rolling_max_count_counter_type::wrapped_type)
 
+///////////////////////////////////////////////////////////////////////////////
+// Percentiles
+typedef hpx::components::component<hpx::performance_counters::server::
+        statistics_counter<hpx::util::tag::hdr_percentile>>
+    percentile_count_counter_type;
+
+HPX_REGISTER_DERIVED_COMPONENT_FACTORY(percentile_count_counter_type,
+    percentile_count_counter, "base_performance_counter",
+    hpx::components::factory_enabled)
+HPX_DEFINE_GET_COMPONENT_TYPE(percentile_count_counter_type::wrapped_type)
+
 ///////////////////////////////////////////////////////////////////////////////
 namespace hpx { namespace performance_counters { namespace detail {
     /// Creation function for aggregating performance counters to be registered
@@ -10,8 +10,10 @@
 
 #include <hpx/config.hpp>
 #include <hpx/assert.hpp>
+#include <hpx/executors/edf_scheduler.hpp>
 #include <hpx/functional/bind_back.hpp>
 #include <hpx/functional/bind_front.hpp>
+#include <hpx/lock_registration/detail/lock_contention.hpp>
 #include <hpx/modules/errors.hpp>
 #include <hpx/modules/threadmanager.hpp>
 #include <hpx/performance_counters/counter_creators.hpp>
@@ -20,9 +22,14 @@
 #include <hpx/performance_counters/threadmanager_counter_types.hpp>
 #include <hpx/runtime_local/thread_pool_helpers.hpp>
 #include <hpx/schedulers/maintain_queue_wait_times.hpp>
+#include <hpx/threading_base/allocation_profiling.hpp>
+#include <hpx/threading_base/queue_latency_histogram.hpp>
+#include <hpx/threading_base/task_profiles.hpp>
+#include <hpx/util/from_string.hpp>
 
 #include <cstddef>
 #include <cstdint>
+#include <string>
 #include <utility>
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -430,6 +437,308 @@ namespace hpx { namespace performance_counters { namespace detail {
         return naming::invalid_gid;
     }
 #endif
+
+    ///////////////////////////////////////////////////////////////////////
+    // edf_scheduler counter creation function
+    naming::gid_type edf_scheduler_counter_creator(
+        std::int64_t (*f)(bool), counter_info const& info, error_code& ec)
+    {
+        return locality_raw_counter_creator(
+            info, hpx::function<std::int64_t(bool)>(f), ec);
+    }
+
+    ///////////////////////////////////////////////////////////////////////
+    // task profile counter creation function, the annotation is given as
+    // the counter parameter
+    naming::gid_type task_profile_counter_creator(
+        threads::task_profile_value which, counter_info const& info,
+        error_code& ec)
+    {
+        counter_path_elements paths;
+        get_counter_path_elements(info.fullname_, paths, ec);
+        if (ec)
+            return naming::invalid_gid;
+
+        if (paths.parameters_.empty())
+        {
+            HPX_THROWS_IF(ec, bad_parameter, "task_profile_counter_creator",
+                "the annotation of the profiled tasks must be given as the "
+                "counter parameter: {}",
+                info.fullname_);
+            return naming::invalid_gid;
+        }
+
+        naming::gid_type gid = locality_raw_counter_creator(info,
+            [name = paths.parameters_, which](bool reset) {
+                return threads::get_task_profile_value(name, which, reset);
+            },
+            ec);
+
+        if (!ec)
+        {
+            threads::enable_task_profiling(true);
+#if defined(HPX_HAVE_ALLOCATION_PROFILING)
+            if (which == threads::task_profile_value::allocations ||
+                which == threads::task_profile_value::allocated_bytes)
+            {
+                threads::enable_allocation_profiling(true);
+            }
+#endif
+        }
+        return gid;
+    }
+
+#if defined(HPX_HAVE_ALLOCATION_PROFILING)
+    ///////////////////////////////////////////////////////////////////////
+    // allocation counter creation function, counts the allocations of all
+    // OS threads, of the worker threads of a pool, or of one worker thread
+    naming::gid_type allocation_counter_creator(threads::threadmanager* tm,
+        bool bytes, counter_info const& info, error_code& ec)
+    {
+        counter_path_elements paths;
+        get_counter_path_elements(info.fullname_, paths, ec);
+        if (ec)
+        {
+            return naming::invalid_gid;
+        }
+        if (paths.parentinstance_is_basename_)
+        {
+            HPX_THROWS_IF(ec, bad_parameter, "allocation_counter_creator",
+                "invalid counter instance parent name: {}",
+                paths.parentinstancename_);
+            return naming::invalid_gid;
+        }
+
+        // the range of global worker thread numbers to count
+        std::size_t first = std::size_t(-1);
+        std::size_t count = 1;
+        if (paths.instancename_ == "total" && paths.instanceindex_ == -1)
+        {
+            // all OS threads, including the ones not managed by HPX
+        }
+        else if (paths.instancename_ == "pool" && paths.instanceindex_ >= 0 &&
+            std::size_t(paths.instanceindex_) <
+                hpx::resource::get_num_thread_pools())
+        {
+            threads::thread_pool_base& pool =
+                hpx::resource::get_thread_pool(paths.instanceindex_);
+
+            first = pool.get_thread_offset();
+            count = pool.get_os_thread_count();
+            if (paths.subinstanceindex_ >= 0)
+            {
+                if (std::size_t(paths.subinstanceindex_) >= count)
+                {
+                    HPX_THROWS_IF(ec, bad_parameter,
+                        "allocation_counter_creator",
+                        "invalid counter instance name: {}",
+                        info.fullname_);
+                    return naming::invalid_gid;
+                }
+                first += paths.subinstanceindex_;
+                count = 1;
+            }
+        }
+        else if (paths.instancename_ == "worker-thread" &&
+            paths.instanceindex_ >= 0 &&
+            std::size_t(paths.instanceindex_) <
+                tm->default_pool().get_os_thread_count())
+        {
+            first = tm->default_pool().get_thread_offset() +
+                paths.instanceindex_;
+        }
+        else
+        {
+            HPX_THROWS_IF(ec, bad_parameter, "allocation_counter_creator",
+                "invalid counter instance name: {}", paths.instancename_);
+            return naming::invalid_gid;
+        }
+
+        hpx::function<std::int64_t(bool)> f =
+            [first, count, bytes](bool reset) -> std::int64_t {
+            std::uint64_t value = 0;
+            for (std::size_t i = 0; i != count; ++i)
+            {
+                threads::allocation_counts const counts =
+                    threads::get_allocation_counts(
+                        first == std::size_t(-1) ? first : first + i, reset);
+                value += bytes ? counts.bytes : counts.count;
+            }
+            return static_cast<std::int64_t>(value);
+        };
+        naming::gid_type gid = create_raw_counter(info, HPX_MOVE(f), ec);
+
+        if (!ec)
+        {
+            threads::enable_allocation_profiling(true);
+        }
+        return gid;
+    }
+#endif
+
+#if defined(HPX_HAVE_LOCK_CONTENTION_PROFILING)
+    ///////////////////////////////////////////////////////////////////////
+    // lock contention counter creation function, the lock site is given as
+    // the counter parameter: the description of the locks, #<n> for the
+    // site with the n-th highest wait time (starting at #0), or nothing for
+    // all locks
+    naming::gid_type lock_contention_counter_creator(
+        std::uint64_t util::lock_contention_site::*which,
+        counter_info const& info, error_code& ec)
+    {
+        counter_path_elements paths;
+        get_counter_path_elements(info.fullname_, paths, ec);
+        if (ec)
+        {
+            return naming::invalid_gid;
+        }
+
+        std::string const& site = paths.parameters_;
+        if (!site.empty() && site[0] == '#')
+        {
+            std::size_t const rank = hpx::util::from_string<std::size_t>(
+                site.substr(1), std::size_t(-1));
+            if (rank == std::size_t(-1))
+            {
+                HPX_THROWS_IF(ec, bad_parameter,
+                    "lock_contention_counter_creator",
+                    "invalid lock site rank: {}", site);
+                return naming::invalid_gid;
+            }
+
+            return locality_raw_counter_creator(info,
+                [rank, which](bool reset) -> std::int64_t {
+                    auto const sites =
+                        util::get_lock_contention_sites(rank + 1);
+                    if (sites.size() <= rank)
+                    {
+                        return 0;
+                    }
+                    if (reset)
+                    {
+                        util::get_lock_contention_site(
+                            sites[rank].description, true);
+                    }
+                    return static_cast<std::int64_t>(sites[rank].*which);
+                },
+                ec);
+        }
+
+        return locality_raw_counter_creator(info,
+            [site, which](bool reset) -> std::int64_t {
+                return static_cast<std::int64_t>(
+                    util::get_lock_contention_site(site, reset).*which);
+            },
+            ec);
+    }
+#endif
+
+    ///////////////////////////////////////////////////////////////////////
+    // queue latency counter creation function, the parameters are the
+    // percentile to report (default: 50) and optionally the priority of the
+    // threads (all, low, normal, or high, default: all)
+    // /threads{locality#%d/total}/queue-latency/wait@<percentile>,<priority>
+    // /threads{locality#%d/pool#%s}/queue-latency/steal@<percentile>
+    naming::gid_type queue_latency_counter_creator(threads::threadmanager* tm,
+        bool stolen, counter_info const& info, error_code& ec)
+    {
+        counter_path_elements paths;
+        get_counter_path_elements(info.fullname_, paths, ec);
+        if (ec)
+        {
+            return naming::invalid_gid;
+        }
+        if (paths.parentinstance_is_basename_)
+        {
+            HPX_THROWS_IF(ec, bad_parameter, "queue_latency_counter_creator",
+                "invalid counter instance parent name: {}",
+                paths.parentinstancename_);
+            return naming::invalid_gid;
+        }
+
+        std::string percentile = paths.parameters_;
+        std::string priority_name = "all";
+        std::string::size_type const comma = percentile.find(',');
+        if (comma != std::string::npos)
+        {
+            priority_name = percentile.substr(comma + 1);
+            percentile.erase(comma);
+        }
+
+        double const pct = percentile.empty() ?
+            50.0 :
+            hpx::util::from_string<double>(percentile, -1.0);
+        if (pct < 0.0 || pct > 100.0)
+        {
+            HPX_THROWS_IF(ec, bad_parameter, "queue_latency_counter_creator",
+                "invalid percentile given as the counter parameter: {}",
+                info.fullname_);
+            return naming::invalid_gid;
+        }
+
+        threads::thread_priority priority = threads::thread_priority::default_;
+        if (priority_name == "low")
+        {
+            priority = threads::thread_priority::low;
+        }
+        else if (priority_name == "normal")
+        {
+            priority = threads::thread_priority::normal;
+        }
+        else if (priority_name == "high")
+        {
+            priority = threads::thread_priority::high;
+        }
+        else if (priority_name != "all")
+        {
+            HPX_THROWS_IF(ec, bad_parameter, "queue_latency_counter_creator",
+                "invalid thread priority given as the counter parameter "
+                "(should be all, low, normal, or high): {}",
+                info.fullname_);
+            return naming::invalid_gid;
+        }
+
+        threads::thread_pool_base* pool = nullptr;
+        if ((paths.instancename_ == "total" && paths.instanceindex_ == -1) ||
+            (paths.instancename_ == "pool" && paths.instanceindex_ < 0))
+        {
+            pool = &tm->default_pool();
+        }
+        else if (paths.instancename_ == "pool" &&
+            std::size_t(paths.instanceindex_) <
+                hpx::resource::get_num_thread_pools())
+        {
+            pool = &hpx::resource::get_thread_pool(paths.instanceindex_);
+        }
+        else
+        {
+            HPX_THROWS_IF(ec, bad_parameter, "queue_latency_counter_creator",
+                "invalid counter instance name: {}", paths.instancename_);
+            return naming::invalid_gid;
+        }
+
+        hpx::function<std::int64_t(bool)> f =
+            [pool, priority, stolen, pct](bool reset) -> std::int64_t {
+            threads::policies::scheduler_base* scheduler =
+                pool->get_scheduler();
+            if (scheduler == nullptr)
+            {
+                return 0;
+            }
+            return static_cast<std::int64_t>(
+                threads::queue_latency_histogram::get_percentile(
+                    scheduler->get_queue_latency_counts(
+                        priority, stolen, reset),
+                    pct));
+        };
+        naming::gid_type gid = create_raw_counter(info, HPX_MOVE(f), ec);
+
+        if (!ec)
+        {
+            threads::set_queue_latency_histograms_enabled(true);
+        }
+        return gid;
+    }
 }}}    // namespace hpx::performance_counters::detail
 
 namespace hpx { namespace performance_counters {
@@ -765,6 +1074,15 @@ namespace hpx { namespace performance_counters {
                     &tm, &threads::threadmanager::get_num_stolen_to_staged,
                     &threads::thread_pool_base::get_num_stolen_to_staged),
                 &locality_pool_thread_counter_discoverer, ""},
+            {"/threads/count/average-steal-batch-size", counter_type::raw,
+                "returns the average number of HPX-threads taken from "
+                "neighboring schedulers in one steal operation for the "
+                "referenced locality",
+                HPX_PERFORMANCE_COUNTER_V1,
+                hpx::bind_front(&detail::locality_pool_thread_counter_creator,
+                    &tm, &threads::threadmanager::get_average_steal_batch_size,
+                    &threads::thread_pool_base::get_average_steal_batch_size),
+                &locality_pool_thread_counter_discoverer, ""},
 #endif
             // scheduler utilization
             {"/scheduler/utilization/instantaneous", counter_type::raw,
@@ -773,6 +1091,150 @@ namespace hpx { namespace performance_counters {
                 hpx::bind_front(
                     &detail::scheduler_utilization_counter_creator, &tm),
                 &locality_pool_counter_discoverer, "%"},
+            // edf_scheduler deadline misses
+            {"/scheduler/count/deadline-misses",
+                counter_type::monotonically_increasing,
+                "returns the overall number of work items with a deadline "
+                "scheduled on an edf_scheduler which were started after their "
+                "deadline",
+                HPX_PERFORMANCE_COUNTER_V1,
+                hpx::bind_front(&detail::edf_scheduler_counter_creator,
+                    &execution::experimental::detail::get_edf_deadline_misses),
+                &locality_counter_discoverer, ""},
+            {"/scheduler/count/deadline-work-items",
+                counter_type::monotonically_increasing,
+                "returns the overall number of work items with a deadline "
+                "scheduled on an edf_scheduler which were executed",
+                HPX_PERFORMANCE_COUNTER_V1,
+                hpx::bind_front(&detail::edf_scheduler_counter_creator,
+                    &execution::experimental::detail::get_edf_num_executed),
+                &locality_counter_discoverer, ""},
+            // task profiles aggregated by annotation
+            {"/threads/profile/count", counter_type::monotonically_increasing,
+                "returns the number of terminated HPX-threads with the "
+                "annotation given as the counter parameter",
+                HPX_PERFORMANCE_COUNTER_V1,
+                hpx::bind_front(&detail::task_profile_counter_creator,
+                    threads::task_profile_value::count),
+                &locality_counter_discoverer, ""},
+            {"/threads/profile/time", counter_type::elapsed_time,
+                "returns the cumulative execution time of the HPX-threads "
+                "with the annotation given as the counter parameter",
+                HPX_PERFORMANCE_COUNTER_V1,
+                hpx::bind_front(&detail::task_profile_counter_creator,
+                    threads::task_profile_value::time),
+                &locality_counter_discoverer, "ns"},
+            {"/threads/profile/time/average", counter_type::average_timer,
+                "returns the average execution time of the terminated "
+                "HPX-threads with the annotation given as the counter "
+                "parameter",
+                HPX_PERFORMANCE_COUNTER_V1,
+                hpx::bind_front(&detail::task_profile_counter_creator,
+                    threads::task_profile_value::average),
+                &locality_counter_discoverer, "ns"},
+            {"/threads/profile/time/max", counter_type::raw,
+                "returns the maximum time an HPX-thread with the annotation "
+                "given as the counter parameter ran without being suspended",
+                HPX_PERFORMANCE_COUNTER_V1,
+                hpx::bind_front(&detail::task_profile_counter_creator,
+                    threads::task_profile_value::max),
+                &locality_counter_discoverer, "ns"},
+            {"/threads/profile/count/suspensions",
+                counter_type::monotonically_increasing,
+                "returns the number of times the HPX-threads with the "
+                "annotation given as the counter parameter were suspended",
+                HPX_PERFORMANCE_COUNTER_V1,
+                hpx::bind_front(&detail::task_profile_counter_creator,
+                    threads::task_profile_value::suspensions),
+                &locality_counter_discoverer, ""},
+            {"/threads/profile/count/steals",
+                counter_type::monotonically_increasing,
+                "returns the number of times the HPX-threads with the "
+                "annotation given as the counter parameter were resumed on "
+                "another worker thread than the one they were suspended on",
+                HPX_PERFORMANCE_COUNTER_V1,
+                hpx::bind_front(&detail::task_profile_counter_creator,
+                    threads::task_profile_value::steals),
+                &locality_counter_discoverer, ""},
+#if defined(HPX_HAVE_ALLOCATION_PROFILING)
+            {"/threads/profile/allocations/count",
+                counter_type::monotonically_increasing,
+                "returns the number of allocations made by the HPX-threads "
+                "with the annotation given as the counter parameter",
+                HPX_PERFORMANCE_COUNTER_V1,
+                hpx::bind_front(&detail::task_profile_counter_creator,
+                    threads::task_profile_value::allocations),
+                &locality_counter_discoverer, ""},
+            {"/threads/profile/allocations/bytes",
+                counter_type::monotonically_increasing,
+                "returns the amount of memory allocated by the HPX-threads "
+                "with the annotation given as the counter parameter",
+                HPX_PERFORMANCE_COUNTER_V1,
+                hpx::bind_front(&detail::task_profile_counter_creator,
+                    threads::task_profile_value::allocated_bytes),
+                &locality_counter_discoverer, "bytes"},
+            // allocations per worker thread
+            {"/threads/allocations/count",
+                counter_type::monotonically_increasing,
+                "returns the number of allocations made by the referenced "
+                "worker thread(s)",
+                HPX_PERFORMANCE_COUNTER_V1,
+                hpx::bind_front(
+                    &detail::allocation_counter_creator, &tm, false),
+                &locality_pool_thread_counter_discoverer, ""},
+            {"/threads/allocations/bytes",
+                counter_type::monotonically_increasing,
+                "returns the amount of memory allocated by the referenced "
+                "worker thread(s)",
+                HPX_PERFORMANCE_COUNTER_V1,
+                hpx::bind_front(&detail::allocation_counter_creator, &tm, true),
+                &locality_pool_thread_counter_discoverer, "bytes"},
+#endif
+#if defined(HPX_HAVE_LOCK_CONTENTION_PROFILING)
+            // lock contention per lock site
+            {"/locks/count/acquisitions",
+                counter_type::monotonically_increasing,
+                "returns the number of acquisitions of the locks of the site "
+                "given as the counter parameter (the lock description, or "
+                "#<n> for the site with the n-th highest wait time)",
+                HPX_PERFORMANCE_COUNTER_V1,
+                hpx::bind_front(&detail::lock_contention_counter_creator,
+                    &util::lock_contention_site::acquisitions),
+                &locality_counter_discoverer, ""},
+            {"/locks/count/contentions",
+                counter_type::monotonically_increasing,
+                "returns the number of acquisitions of the locks of the site "
+                "given as the counter parameter which had to wait for the "
+                "lock to be released",
+                HPX_PERFORMANCE_COUNTER_V1,
+                hpx::bind_front(&detail::lock_contention_counter_creator,
+                    &util::lock_contention_site::contentions),
+                &locality_counter_discoverer, ""},
+            {"/locks/time/wait", counter_type::monotonically_increasing,
+                "returns the overall time spent waiting for the locks of the "
+                "site given as the counter parameter",
+                HPX_PERFORMANCE_COUNTER_V1,
+                hpx::bind_front(&detail::lock_contention_counter_creator,
+                    &util::lock_contention_site::wait_time),
+                &locality_counter_discoverer, "ns"},
+#endif
+            // queue latencies
+            {"/threads/queue-latency/wait", counter_type::raw,
+                "returns the given percentile (default: 50) of the times the "
+                "HPX-threads spent in the queues of the referenced pool "
+                "before being picked up by the worker thread owning the queue",
+                HPX_PERFORMANCE_COUNTER_V1,
+                hpx::bind_front(
+                    &detail::queue_latency_counter_creator, &tm, false),
+                &locality_pool_counter_discoverer, "ns"},
+            {"/threads/queue-latency/steal", counter_type::raw,
+                "returns the given percentile (default: 50) of the times the "
+                "HPX-threads spent in the queues of the referenced pool "
+                "before being stolen by another worker thread",
+                HPX_PERFORMANCE_COUNTER_V1,
+                hpx::bind_front(
+                    &detail::queue_latency_counter_creator, &tm, true),
+                &locality_pool_counter_discoverer, "ns"},
             // idle-loop count
             {"/threads/idle-loop-count/instantaneous", counter_type::raw,
                 "returns the current value of the scheduler idle-loop count",
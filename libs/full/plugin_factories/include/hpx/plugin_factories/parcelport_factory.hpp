@@ -118,6 +118,10 @@ namespace hpx::plugins {
                 name_uc +
                 "_MAX_BACKGROUND_THREADS:"
                 "$[hpx.parcel.max_background_threads]}");
+            fillini.emplace_back("stripes = ${HPX_PARCEL_" + name_uc +
+                "_STRIPES:$[hpx.parcel.stripes]}");
+            fillini.emplace_back("stripe_threshold = ${HPX_PARCEL_" + name_uc +
+                "_STRIPE_THRESHOLD:$[hpx.parcel.stripe_threshold]}");
             fillini.emplace_back("async_serialization = ${HPX_PARCEL_" +
                 name_uc +
                 "_ASYNC_SERIALIZATION:"
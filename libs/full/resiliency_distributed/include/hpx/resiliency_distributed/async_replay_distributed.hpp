@@ -11,12 +11,16 @@
 
 #include <hpx/resiliency/resiliency_cpos.hpp>
 #include <hpx/resiliency/util.hpp>
+#include <hpx/resiliency_distributed/replay_locality_selector.hpp>
 
 #include <hpx/assert.hpp>
+#include <hpx/async_combinators/when_any.hpp>
 #include <hpx/async_distributed/async.hpp>
 #include <hpx/futures/future.hpp>
+#include <hpx/modules/errors.hpp>
 #include <hpx/type_support/pack.hpp>
 
+#include <chrono>
 #include <cstddef>
 #include <exception>
 #include <memory>
@@ -117,6 +121,146 @@ namespace hpx { namespace resiliency { namespace experimental {
             Tuple t_;
         };
 
+        ///////////////////////////////////////////////////////////////////////
+        // Replays the task on the localities chosen by a
+        // replay_locality_selector, which is informed about the outcome of
+        // every attempt.
+        template <typename Result, typename Pred, typename Action,
+            typename Tuple>
+        struct distributed_async_replay_selector_helper
+          : std::enable_shared_from_this<
+                distributed_async_replay_selector_helper<Result, Pred, Action,
+                    Tuple>>
+        {
+            template <typename Pred_, typename Action_, typename Tuple_>
+            distributed_async_replay_selector_helper(
+                std::shared_ptr<replay_locality_selector> selector,
+                Pred_&& pred, Action_&& action, Tuple_&& tuple)
+              : selector_(HPX_MOVE(selector))
+              , pred_(HPX_FORWARD(Pred_, pred))
+              , action_(HPX_FORWARD(Action_, action))
+              , t_(HPX_FORWARD(Tuple_, tuple))
+            {
+            }
+
+            template <std::size_t... Is>
+            hpx::future<Result> invoke_distributed(
+                hpx::id_type id, hpx::util::index_pack<Is...>)
+            {
+                return hpx::async(action_, id, std::get<Is>(t_)...);
+            }
+
+            hpx::future<Result> invoke_with_timeout(hpx::id_type const& id)
+            {
+                hpx::future<Result> f = invoke_distributed(id,
+                    hpx::util::make_index_pack<
+                        std::tuple_size<Tuple>::value>{});
+
+                auto const timeout = selector_->attempt_timeout();
+                if (timeout == replay_locality_selector::duration::zero())
+                {
+                    return f;
+                }
+
+                // the result of an attempt which timed out is ignored
+                return hpx::when_any(f,
+                    hpx::make_ready_future_at(
+                        std::chrono::steady_clock::now() + timeout))
+                    .then(hpx::launch::sync,
+                        [id](auto&& r) -> hpx::future<Result> {
+                            auto result = r.get();
+                            if (result.index != 0)
+                            {
+                                HPX_THROW_EXCEPTION(hpx::service_unavailable,
+                                    "hpx::resiliency::experimental::"
+                                    "async_replay",
+                                    "the task didn't complete on locality {} "
+                                    "within the attempt timeout",
+                                    id);
+                            }
+                            return HPX_MOVE(hpx::get<0>(result.futures));
+                        });
+            }
+
+            hpx::future<Result> call(std::size_t n,
+                hpx::id_type const& previous = hpx::invalid_id,
+                std::size_t iteration = 0)
+            {
+                hpx::id_type id = selector_->select(previous);
+                hpx::future<Result> f = invoke_with_timeout(id);
+
+                // attach a continuation that will relaunch the task, if
+                // necessary
+                auto this_ = this->shared_from_this();
+                return f.then(hpx::launch::sync,
+                    [this_ = HPX_MOVE(this_), id, n, iteration](
+                        hpx::future<Result>&& f) {
+                        if (f.has_exception())
+                        {
+                            this_->selector_->report_failure(id);
+
+                            // rethrow abort_replay_exception, if caught
+                            auto ex = rethrow_on_abort_replay(f);
+
+                            // execute the task again if an error occurred and
+                            // this was not the last attempt
+                            if (iteration + 1 < n)
+                            {
+                                return this_->call(n, id, iteration + 1);
+                            }
+
+                            // rethrow exception if the number of replays has
+                            // been exhausted
+                            std::rethrow_exception(ex);
+                        }
+
+                        auto&& result = f.get();
+
+                        if (!HPX_INVOKE(this_->pred_, result))
+                        {
+                            // an invalid result is a silent error of the
+                            // locality
+                            this_->selector_->report_failure(id);
+
+                            if (iteration + 1 < n)
+                            {
+                                return this_->call(n, id, iteration + 1);
+                            }
+
+                            // throw aborting exception as attempts were
+                            // exhausted
+                            throw abort_replay_exception();
+                        }
+
+                        this_->selector_->report_success(id);
+                        return hpx::make_ready_future(HPX_MOVE(result));
+                    });
+            }
+
+            std::shared_ptr<replay_locality_selector> selector_;
+            Pred pred_;
+            Action action_;
+            Tuple t_;
+        };
+
+        template <typename Result, typename Pred, typename Action,
+            typename... Ts>
+        std::shared_ptr<distributed_async_replay_selector_helper<Result,
+            std::decay_t<Pred>, std::decay_t<Action>,
+            std::tuple<std::decay_t<Ts>...>>>
+        make_distributed_async_replay_selector_helper(
+            std::shared_ptr<replay_locality_selector> const& selector,
+            Pred&& pred, Action&& action, Ts&&... ts)
+        {
+            using return_type = distributed_async_replay_selector_helper<Result,
+                std::decay_t<Pred>, std::decay_t<Action>,
+                std::tuple<std::decay_t<Ts>...>>;
+
+            return std::make_shared<return_type>(selector,
+                HPX_FORWARD(Pred, pred), HPX_FORWARD(Action, action),
+                std::make_tuple(HPX_FORWARD(Ts, ts)...));
+        }
+
         template <typename Result, typename Pred, typename Action,
             typename... Ts>
         std::shared_ptr<distributed_async_replay_helper<Result,
@@ -182,6 +326,61 @@ namespace hpx { namespace resiliency { namespace experimental {
         return helper->call(ids);
     }
 
+    ///////////////////////////////////////////////////////////////////////////
+    // Asynchronously launch given Action \a action on the locality chosen
+    // by \a selector. Repeat launching on error (or on timeout) up to \a n
+    // times in total, every attempt is launched on the least loaded locality
+    // which has not failed recently (except if abort_replay_exception is
+    // thrown).
+    template <typename Action, typename... Ts>
+    hpx::future<typename hpx::util::detail::invoke_deferred_result<Action,
+        hpx::id_type, Ts...>::type>
+    tag_invoke(async_replay_t,
+        std::shared_ptr<replay_locality_selector> const& selector,
+        std::size_t n, Action&& action, Ts&&... ts)
+    {
+        HPX_ASSERT(selector && n > 0);
+
+        using result_type =
+            typename hpx::util::detail::invoke_deferred_result<Action,
+                hpx::id_type, Ts...>::type;
+
+        auto helper =
+            detail::make_distributed_async_replay_selector_helper<result_type>(
+                selector, detail::replay_validator{},
+                HPX_FORWARD(Action, action), HPX_FORWARD(Ts, ts)...);
+
+        return helper->call(n);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Asynchronously launch given Action \a action on the locality chosen
+    // by \a selector. Verify the result using the given predicate \a pred.
+    // Repeat launching on error, on timeout, or if the result is invalid up
+    // to \a n times in total, every attempt is launched on the least loaded
+    // locality which has not failed recently (except if
+    // abort_replay_exception is thrown).
+    template <typename Pred, typename Action, typename... Ts>
+    hpx::future<typename hpx::util::detail::invoke_deferred_result<Action,
+        hpx::id_type, Ts...>::type>
+    tag_invoke(async_replay_validate_t,
+        std::shared_ptr<replay_locality_selector> const& selector,
+        std::size_t n, Pred&& pred, Action&& action, Ts&&... ts)
+    {
+        HPX_ASSERT(selector && n > 0);
+
+        using result_type =
+            typename hpx::util::detail::invoke_deferred_result<Action,
+                hpx::id_type, Ts...>::type;
+
+        auto helper =
+            detail::make_distributed_async_replay_selector_helper<result_type>(
+                selector, HPX_FORWARD(Pred, pred), HPX_FORWARD(Action, action),
+                HPX_FORWARD(Ts, ts)...);
+
+        return helper->call(n);
+    }
+
 }}}    // namespace hpx::resiliency::experimental
 
 #endif
@@ -0,0 +1,255 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+
+#include <hpx/assert.hpp>
+#include <hpx/async_combinators/when_all.hpp>
+#include <hpx/futures/future.hpp>
+#include <hpx/naming_base/id_type.hpp>
+#include <hpx/performance_counters/performance_counter.hpp>
+#include <hpx/synchronization/spinlock.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace resiliency { namespace experimental {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Chooses the localities the distributed async_replay tries a task on.
+    // The least loaded locality is picked for every attempt, localities on
+    // which an attempt failed or timed out are skipped for a back-off period
+    // which doubles with every consecutive failure (up to max_backoff). If
+    // all localities are backing off, the one which becomes available first
+    // is used.
+    //
+    // The load of the localities is set explicitly using set_load or queried
+    // from a performance counter (by default the length of the thread queues)
+    // using update_loads.
+    class replay_locality_selector
+    {
+        using mutex_type = hpx::spinlock;
+        using clock_type = std::chrono::steady_clock;
+
+        struct locality_state
+        {
+            explicit locality_state(hpx::id_type const& id)
+              : id_(id)
+            {
+            }
+
+            hpx::id_type id_;
+            std::int64_t load_ = 0;
+            std::size_t failures_ = 0;
+            clock_type::time_point retry_at_{};
+        };
+
+    public:
+        using duration = clock_type::duration;
+
+        // the counter used by update_loads by default
+        static constexpr char const* default_load_counter =
+            "/threadqueue{locality#0/total}/length";
+
+        // A zero attempt_timeout disables the timeout of the attempts
+        explicit replay_locality_selector(std::vector<hpx::id_type> const& ids,
+            duration attempt_timeout = duration::zero(),
+            duration min_backoff = std::chrono::milliseconds(100),
+            duration max_backoff = std::chrono::seconds(10))
+          : attempt_timeout_(attempt_timeout)
+          , min_backoff_(min_backoff)
+          , max_backoff_(max_backoff)
+        {
+            HPX_ASSERT(!ids.empty());
+            localities_.reserve(ids.size());
+            for (hpx::id_type const& id : ids)
+            {
+                localities_.emplace_back(id);
+            }
+        }
+
+        replay_locality_selector(replay_locality_selector const&) = delete;
+        replay_locality_selector& operator=(
+            replay_locality_selector const&) = delete;
+
+        std::size_t size() const noexcept
+        {
+            return localities_.size();
+        }
+
+        duration attempt_timeout() const noexcept
+        {
+            return attempt_timeout_;
+        }
+
+        // Return the locality to use for the next attempt, previous (the
+        // locality of the last attempt, if any) is avoided if possible
+        hpx::id_type select(hpx::id_type const& previous = hpx::invalid_id)
+        {
+            std::lock_guard<mutex_type> l(mtx_);
+
+            auto const now = clock_type::now();
+            auto const is_better = [&](locality_state const& lhs,
+                                       locality_state const& rhs) {
+                bool const lhs_available = lhs.retry_at_ <= now;
+                bool const rhs_available = rhs.retry_at_ <= now;
+                if (lhs_available != rhs_available)
+                {
+                    return lhs_available;
+                }
+
+                bool const lhs_previous = lhs.id_ == previous;
+                bool const rhs_previous = rhs.id_ == previous;
+                if (lhs_previous != rhs_previous)
+                {
+                    return rhs_previous;
+                }
+
+                return lhs_available ? lhs.load_ < rhs.load_ :
+                                       lhs.retry_at_ < rhs.retry_at_;
+            };
+
+            locality_state* best = &localities_.front();
+            for (locality_state& s : localities_)
+            {
+                if (is_better(s, *best))
+                {
+                    best = &s;
+                }
+            }
+
+            // count the attempt until the load is refreshed, which spreads
+            // consecutive tasks over equally loaded localities
+            ++best->load_;
+            return best->id_;
+        }
+
+        // An attempt on the given locality failed or timed out
+        void report_failure(hpx::id_type const& id)
+        {
+            std::lock_guard<mutex_type> l(mtx_);
+            if (locality_state* s = find(id))
+            {
+                duration backoff = min_backoff_;
+                for (std::size_t i = 0; i != s->failures_; ++i)
+                {
+                    if (backoff >= max_backoff_)
+                    {
+                        break;
+                    }
+                    backoff *= 2;
+                }
+                if (backoff > max_backoff_)
+                {
+                    backoff = max_backoff_;
+                }
+
+                ++s->failures_;
+                s->retry_at_ = clock_type::now() + backoff;
+            }
+        }
+
+        // An attempt on the given locality succeeded
+        void report_success(hpx::id_type const& id)
+        {
+            std::lock_guard<mutex_type> l(mtx_);
+            if (locality_state* s = find(id))
+            {
+                s->failures_ = 0;
+                s->retry_at_ = clock_type::time_point();
+            }
+        }
+
+        // the number of consecutive failures on the given locality
+        std::size_t failures(hpx::id_type const& id)
+        {
+            std::lock_guard<mutex_type> l(mtx_);
+            locality_state const* s = find(id);
+            return s != nullptr ? s->failures_ : 0;
+        }
+
+        void set_load(hpx::id_type const& id, std::int64_t load)
+        {
+            std::lock_guard<mutex_type> l(mtx_);
+            if (locality_state* s = find(id))
+            {
+                s->load_ = load;
+            }
+        }
+
+        std::int64_t get_load(hpx::id_type const& id)
+        {
+            std::lock_guard<mutex_type> l(mtx_);
+            locality_state const* s = find(id);
+            return s != nullptr ? s->load_ : 0;
+        }
+
+        // Query the load of all localities from the given performance
+        // counter, localities which fail to report their load are treated
+        // as failed. The selector has to be kept alive until the returned
+        // future has become ready.
+        hpx::future<void> update_loads(
+            std::string const& counter = default_load_counter)
+        {
+            std::vector<hpx::future<std::int64_t>> loads;
+            loads.reserve(localities_.size());
+            for (locality_state const& s : localities_)
+            {
+                performance_counters::performance_counter c(counter, s.id_);
+                loads.push_back(c.get_value<std::int64_t>());
+            }
+
+            return hpx::when_all(loads).then(hpx::launch::sync,
+                [this](hpx::future<std::vector<hpx::future<std::int64_t>>>&&
+                        f) {
+                    std::vector<hpx::future<std::int64_t>> loads = f.get();
+                    for (std::size_t i = 0; i != loads.size(); ++i)
+                    {
+                        if (loads[i].has_exception())
+                        {
+                            report_failure(localities_[i].id_);
+                            continue;
+                        }
+
+                        std::int64_t const load = loads[i].get();
+
+                        std::lock_guard<mutex_type> l(mtx_);
+                        localities_[i].load_ = load;
+                    }
+                });
+        }
+
+    private:
+        locality_state* find(hpx::id_type const& id) noexcept
+        {
+            for (locality_state& s : localities_)
+            {
+                if (s.id_ == id)
+                {
+                    return &s;
+                }
+            }
+            return nullptr;
+        }
+
+        duration const attempt_timeout_;
+        duration const min_backoff_;
+        duration const max_backoff_;
+
+        mutex_type mtx_;
+        std::vector<locality_state> localities_;
+    };
+}}}    // namespace hpx::resiliency::experimental
+
+#endif
@@ -0,0 +1,169 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// This test verifies that the distributed async_replay picks the least loaded
+// locality and skips localities which failed recently.
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+
+#include <hpx/actions_base/plain_action.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/runtime.hpp>
+#include <hpx/modules/futures.hpp>
+#include <hpx/modules/resiliency.hpp>
+#include <hpx/modules/resiliency_distributed.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/resiliency_distributed/replay_locality_selector.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+using hpx::resiliency::experimental::replay_locality_selector;
+
+std::uint32_t where_am_i()
+{
+    return hpx::get_locality_id();
+}
+
+HPX_PLAIN_ACTION(where_am_i, where_am_i_action)
+
+// fails everywhere but on the given locality
+std::uint32_t fails_except_on(std::uint32_t locality)
+{
+    std::uint32_t const here = hpx::get_locality_id();
+    if (here != locality)
+    {
+        throw std::runtime_error("failure");
+    }
+    return here;
+}
+
+HPX_PLAIN_ACTION(fails_except_on, fails_except_on_action)
+
+bool never_valid(std::uint32_t)
+{
+    return false;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_least_loaded(std::vector<hpx::id_type> const& locals)
+{
+    auto selector = std::make_shared<replay_locality_selector>(locals);
+
+    // make the last locality the least loaded one
+    for (std::size_t i = 0; i != locals.size(); ++i)
+    {
+        selector->set_load(
+            locals[i], static_cast<std::int64_t>(100 * (locals.size() - i)));
+    }
+
+    std::uint32_t const where =
+        hpx::resiliency::experimental::async_replay(
+            selector, 3, where_am_i_action())
+            .get();
+    HPX_TEST_EQ(where, hpx::naming::get_locality_id_from_id(locals.back()));
+    HPX_TEST_EQ(selector->failures(locals.back()), std::size_t(0));
+
+    // the loads can be queried from the performance counters
+    selector->update_loads().get();
+    for (hpx::id_type const& id : locals)
+    {
+        HPX_TEST(selector->get_load(id) >= 0);
+        HPX_TEST_EQ(selector->failures(id), std::size_t(0));
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_skip_failed(std::vector<hpx::id_type> const& locals)
+{
+    auto selector = std::make_shared<replay_locality_selector>(locals,
+        std::chrono::seconds(0), std::chrono::seconds(10),
+        std::chrono::seconds(60));
+
+    // the task succeeds only on the first locality, which is the most loaded
+    for (std::size_t i = 0; i != locals.size(); ++i)
+    {
+        selector->set_load(locals[i], i == 0 ? 1000 : 0);
+    }
+
+    std::uint32_t const target =
+        hpx::naming::get_locality_id_from_id(locals.front());
+    std::uint32_t const where =
+        hpx::resiliency::experimental::async_replay(selector, locals.size(),
+            fails_except_on_action(), target)
+            .get();
+    HPX_TEST_EQ(where, target);
+
+    // all other localities are backing off now
+    for (std::size_t i = 1; i != locals.size(); ++i)
+    {
+        HPX_TEST_EQ(selector->failures(locals[i]), std::size_t(1));
+    }
+
+    // the next task is launched on the first locality even though it is
+    // still loaded more heavily
+    std::uint32_t const where2 =
+        hpx::resiliency::experimental::async_replay(
+            selector, 1, where_am_i_action())
+            .get();
+    HPX_TEST_EQ(where2, target);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_invalid_results(std::vector<hpx::id_type> const& locals)
+{
+    auto selector = std::make_shared<replay_locality_selector>(locals);
+
+    bool caught = false;
+    try
+    {
+        hpx::resiliency::experimental::async_replay_validate(
+            selector, 3, &never_valid, where_am_i_action())
+            .get();
+    }
+    catch (hpx::resiliency::experimental::abort_replay_exception const&)
+    {
+        caught = true;
+    }
+    HPX_TEST(caught);
+
+    // the invalid results count as failures
+    std::size_t failures = 0;
+    for (hpx::id_type const& id : locals)
+    {
+        failures += selector->failures(id);
+    }
+    HPX_TEST_EQ(failures, std::size_t(3));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    std::vector<hpx::id_type> locals = hpx::find_all_localities();
+
+    test_least_loaded(locals);
+    if (locals.size() > 1)
+    {
+        test_skip_failed(locals);
+    }
+    test_invalid_results(locals);
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // Initialize and run HPX
+    HPX_TEST(hpx::init(argc, argv) == 0);
+    return hpx::util::report_errors();
+}
+
+#endif
@@ -0,0 +1,118 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify that the credit of an id which is sent to another locality many times
+// is replenished before it is exhausted, and that the object is still
+// collected afterwards.
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/async.hpp>
+#include <hpx/include/plain_actions.hpp>
+#include <hpx/include/runtime.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "components/managed_refcnt_checker.hpp"
+#include "components/simple_refcnt_checker.hpp"
+
+using hpx::program_options::options_description;
+using hpx::program_options::value;
+using hpx::program_options::variables_map;
+
+using hpx::id_type;
+
+void receive(id_type const&) {}
+
+HPX_PLAIN_ACTION(receive)
+
+///////////////////////////////////////////////////////////////////////////////
+inline std::int64_t get_credit(id_type const& id)
+{
+    return hpx::naming::detail::get_credit_from_gid(id.get_gid());
+}
+
+template <typename Client>
+void hpx_test_main(variables_map& vm)
+{
+    std::uint64_t const delay = vm["delay"].as<std::uint64_t>();
+
+    using server_type = typename Client::server_type;
+
+    hpx::components::component_type ctype =
+        hpx::components::get_component_type<server_type>();
+    std::vector<id_type> remote_localities = hpx::find_remote_localities(ctype);
+
+    if (remote_localities.empty())
+        throw std::logic_error("this test cannot be run on one locality");
+
+    Client monitor(hpx::find_here());
+
+    {
+        id_type id = monitor.detach().get();
+
+        // every send splits the credit in half, without replenishment the
+        // credit would be exhausted after log2(HPX_GLOBALCREDIT_INITIAL)
+        // sends
+        std::int64_t min_credit = get_credit(id);
+        for (int i = 0; i != 64; ++i)
+        {
+            hpx::async<receive_action>(remote_localities[0], id).get();
+            min_credit = (std::min)(min_credit, get_credit(id));
+        }
+
+        HPX_TEST_LT(std::int64_t(2), min_credit);
+    }
+
+    // Flush pending reference counting operations.
+    hpx::agas::garbage_collect();
+    hpx::agas::garbage_collect(remote_localities[0]);
+    hpx::agas::garbage_collect();
+    hpx::agas::garbage_collect(remote_localities[0]);
+
+    // The component should be out of scope now.
+    HPX_TEST(monitor.is_ready(std::chrono::milliseconds(delay)));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(variables_map& vm)
+{
+    hpx_test_main<hpx::test::simple_refcnt_monitor>(vm);
+    hpx_test_main<hpx::test::managed_refcnt_monitor>(vm);
+
+    hpx::finalize();
+    return hpx::util::report_errors();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main(int argc, char* argv[])
+{
+    // Configure application-specific options.
+    options_description cmdline("usage: " HPX_APPLICATION_STRING " [options]");
+
+    cmdline.add_options()("delay", value<std::uint64_t>()->default_value(1000),
+        "number of milliseconds to wait for object destruction");
+
+    // We need to explicitly enable the test components used by this test.
+    std::vector<std::string> const cfg = {
+        "hpx.components.simple_refcnt_checker.enabled! = 1",
+        "hpx.components.managed_refcnt_checker.enabled! = 1"};
+
+    // Initialize and run HPX.
+    hpx::init_params init_args;
+    init_args.desc_cmdline = cmdline;
+    init_args.cfg = cfg;
+
+    return hpx::init(argc, argv, init_args);
+}
+#endif
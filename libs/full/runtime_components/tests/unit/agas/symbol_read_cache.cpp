@@ -0,0 +1,110 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify that names managed by the symbol namespace of another locality are
+// served from the local read cache once they have been resolved, and that
+// unregistering a name removes it from the cache.
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx_main.hpp>
+#include <hpx/hashing/jenkins_hash.hpp>
+#include <hpx/include/runtime.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+// find a name which is managed by the symbol namespace of another locality
+std::string remote_name(std::string const& prefix)
+{
+    std::uint32_t const num_localities = hpx::get_initial_num_localities();
+    hpx::util::jenkins_hash hash;
+    for (int i = 0;; ++i)
+    {
+        // all localities run this test, their names must not collide
+        std::string name = prefix + std::to_string(hpx::get_locality_id()) +
+            "/" + std::to_string(i);
+        if (hash(name) % num_localities != hpx::get_locality_id())
+        {
+            return name;
+        }
+    }
+}
+
+// the entry is dropped from the cache asynchronously
+bool wait_for_invalidation(std::string const& name)
+{
+    for (int i = 0; i != 100; ++i)
+    {
+        if (!hpx::agas::resolve_name(hpx::launch::sync, name))
+        {
+            return true;
+        }
+        hpx::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    return false;
+}
+
+void test_resolve_name()
+{
+    std::string const name = remote_name("/test/symbol_read_cache/resolve/");
+    hpx::id_type const here = hpx::find_here();
+
+    HPX_TEST(hpx::agas::register_name(hpx::launch::sync, name, here));
+
+    HPX_TEST_EQ(hpx::agas::resolve_name(hpx::launch::sync, name), here);
+
+    // the name is known locally now
+    hpx::future<hpx::id_type> f = hpx::agas::resolve_name(name);
+    HPX_TEST(f.is_ready());
+    HPX_TEST_EQ(f.get(), here);
+
+    HPX_TEST_EQ(hpx::agas::unregister_name(hpx::launch::sync, name), here);
+    HPX_TEST(wait_for_invalidation(name));
+
+    // the name can be bound to a different id afterwards
+    hpx::id_type const other = hpx::find_remote_localities()[0];
+    HPX_TEST(hpx::agas::register_name(hpx::launch::sync, name, other));
+    HPX_TEST_EQ(hpx::agas::resolve_name(hpx::launch::sync, name), other);
+
+    hpx::agas::unregister_name(hpx::launch::sync, name);
+}
+
+void test_on_event()
+{
+    std::string const name = remote_name("/test/symbol_read_cache/event/");
+    hpx::id_type const here = hpx::find_here();
+
+    hpx::future<hpx::id_type> f =
+        hpx::agas::on_symbol_namespace_event(name, true);
+
+    HPX_TEST(hpx::agas::register_name(hpx::launch::sync, name, here));
+    HPX_TEST_EQ(f.get(), here);
+
+    // waiting for the name again does not need to ask its symbol namespace
+    f = hpx::agas::on_symbol_namespace_event(name, true);
+    HPX_TEST(f.is_ready());
+    HPX_TEST_EQ(f.get(), here);
+
+    hpx::agas::unregister_name(hpx::launch::sync, name);
+    HPX_TEST(wait_for_invalidation(name));
+}
+
+int main()
+{
+    if (hpx::get_initial_num_localities() < 2)
+    {
+        return hpx::util::report_errors();
+    }
+
+    test_resolve_name();
+    test_on_event();
+
+    return hpx::util::report_errors();
+}
+#endif
@@ -0,0 +1,143 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// This test creates and destroys many managed components concurrently, which
+// exercises the per-worker heaps of the component heap list, and in bulk.
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx_main.hpp>
+#include <hpx/include/actions.hpp>
+#include <hpx/include/components.hpp>
+#include <hpx/include/parallel_for_loop.hpp>
+#include <hpx/include/runtime.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/thread.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+std::atomic<std::size_t> alive(0);
+
+struct test_server : hpx::components::managed_component_base<test_server>
+{
+    test_server()
+      : value_(0)
+    {
+        ++alive;
+    }
+
+    explicit test_server(std::size_t value)
+      : value_(value)
+    {
+        ++alive;
+    }
+
+    ~test_server()
+    {
+        --alive;
+    }
+
+    std::size_t call() const
+    {
+        return value_;
+    }
+
+    HPX_DEFINE_COMPONENT_ACTION(test_server, call)
+
+    std::size_t value_;
+};
+
+typedef hpx::components::managed_component<test_server> server_type;
+HPX_REGISTER_COMPONENT(server_type, managed_heap_test_server)
+
+typedef test_server::call_action call_action;
+HPX_REGISTER_ACTION(call_action)
+
+///////////////////////////////////////////////////////////////////////////////
+void test_concurrent_creation(std::size_t count)
+{
+    std::vector<hpx::id_type> ids(count);
+
+    hpx::experimental::for_loop(hpx::execution::par, std::size_t(0), count,
+        [&](std::size_t i) {
+            ids[i] = hpx::local_new<test_server>(hpx::launch::sync, i);
+        });
+    HPX_TEST_EQ(alive.load(), count);
+
+    // all components have a distinct id and are reachable
+    std::vector<hpx::id_type> sorted = ids;
+    std::sort(sorted.begin(), sorted.end());
+    HPX_TEST(std::adjacent_find(sorted.begin(), sorted.end()) == sorted.end());
+
+    hpx::experimental::for_loop(hpx::execution::par, std::size_t(0), count,
+        [&](std::size_t i) {
+            HPX_TEST_EQ(hpx::async<call_action>(ids[i]).get(), i);
+        });
+
+    // release the components from other threads than the ones which created
+    // them
+    sorted.clear();
+    hpx::experimental::for_loop(hpx::execution::par, std::size_t(0), count,
+        [&](std::size_t i) { ids[count - i - 1] = hpx::invalid_id; });
+
+    // the components are destroyed asynchronously
+    hpx::agas::garbage_collect();
+    while (alive.load() != 0)
+    {
+        hpx::this_thread::yield();
+    }
+    HPX_TEST_EQ(alive.load(), std::size_t(0));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_bulk_creation(std::size_t count)
+{
+    std::vector<hpx::id_type> ids =
+        hpx::new_<test_server[]>(hpx::find_here(), count, std::size_t(42))
+            .get();
+    HPX_TEST_EQ(ids.size(), count);
+    HPX_TEST_EQ(alive.load(), count);
+
+    // the components of a bulk creation have consecutive ids
+    for (std::size_t i = 1; i < ids.size(); ++i)
+    {
+        HPX_TEST(ids[i].get_gid() == ids[0].get_gid() + i);
+    }
+
+    hpx::experimental::for_loop(hpx::execution::par, std::size_t(0), count,
+        [&](std::size_t i) {
+            HPX_TEST_EQ(hpx::async<call_action>(ids[i]).get(), std::size_t(42));
+        });
+
+    ids.clear();
+
+    hpx::agas::garbage_collect();
+    while (alive.load() != 0)
+    {
+        hpx::this_thread::yield();
+    }
+    HPX_TEST_EQ(alive.load(), std::size_t(0));
+}
+
+int main()
+{
+    // more components than fit into a single heap
+    test_concurrent_creation(10000);
+
+    // once more after the heaps of the first round have been released
+    test_concurrent_creation(100000);
+
+    // fits into a regular heap, and needs a heap of its own
+    test_bulk_creation(100);
+    test_bulk_creation(50000);
+
+    return hpx::util::report_errors();
+}
+#endif
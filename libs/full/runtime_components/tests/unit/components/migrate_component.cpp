@@ -294,6 +294,44 @@ bool test_migrate_component(hpx::id_type source, hpx::id_type target)
     return true;
 }
 
+// Calls issued on the old location of a migrated object are forwarded to its
+// new location, this must not interfere with migrating the object back.
+bool test_migrate_component_forwarding(hpx::id_type target)
+{
+    hpx::id_type const here = hpx::find_here();
+
+    test_client t1 = hpx::new_<test_client>(here, 42);
+    HPX_TEST_NEQ(hpx::invalid_id, t1.get_id());
+
+    try
+    {
+        test_client t2(hpx::components::migrate(t1, target));
+        HPX_TEST_NEQ(hpx::invalid_id, t2.get_id());
+
+        for (int i = 0; i != 100; ++i)
+        {
+            HPX_TEST_EQ(t1.call(), target);
+            HPX_TEST_EQ(t1.get_data(), 42);
+        }
+
+        test_client t3(hpx::components::migrate(t1, here));
+        HPX_TEST_NEQ(hpx::invalid_id, t3.get_id());
+
+        for (int i = 0; i != 100; ++i)
+        {
+            HPX_TEST_EQ(t1.call(), here);
+            HPX_TEST_EQ(t1.get_data(), 42);
+        }
+    }
+    catch (hpx::exception const& e)
+    {
+        hpx::cout << hpx::get_error_what(e) << std::endl;
+        return false;
+    }
+
+    return true;
+}
+
 bool test_migrate_lazy_component(hpx::id_type source, hpx::id_type target)
 {
     // create component on given locality
@@ -862,6 +900,10 @@ int main()
         hpx::cout << "test_migrate_component: <-" << id << std::endl;
         HPX_TEST(test_migrate_component(id, hpx::find_here()));
 
+        hpx::cout << "test_migrate_component_forwarding: ->" << id
+                  << std::endl;
+        HPX_TEST(test_migrate_component_forwarding(id));
+
         hpx::cout << "test_migrate_lazy_component: ->" << id << std::endl;
         HPX_TEST(test_migrate_lazy_component(hpx::find_here(), id));
         hpx::cout << "test_migrate_lazy_component: <-" << id << std::endl;
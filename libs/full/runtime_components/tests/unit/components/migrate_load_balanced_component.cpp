@@ -0,0 +1,209 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/actions.hpp>
+#include <hpx/include/components.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/include/runtime.hpp>
+#include <hpx/include/serialization.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+struct test_server
+  : hpx::components::load_balancing_support<
+        hpx::components::migration_support<
+            hpx::components::component_base<test_server>>>
+{
+    typedef hpx::components::load_balancing_support<
+        hpx::components::migration_support<
+            hpx::components::component_base<test_server>>>
+        base_type;
+
+    test_server(int data = 0)
+      : data_(data)
+    {
+    }
+
+    test_server(test_server const& rhs)
+      : base_type(rhs)
+      , data_(rhs.data_)
+    {
+    }
+
+    test_server(test_server&& rhs)
+      : base_type(std::move(rhs))
+      , data_(rhs.data_)
+    {
+    }
+
+    test_server& operator=(test_server const& rhs)
+    {
+        data_ = rhs.data_;
+        return *this;
+    }
+    test_server& operator=(test_server&& rhs)
+    {
+        data_ = rhs.data_;
+        return *this;
+    }
+
+    int get_data() const
+    {
+        HPX_TEST_NEQ(pin_count(), std::uint32_t(0));
+        return data_;
+    }
+
+    std::uint64_t get_invocation_count() const
+    {
+        return invocation_count();
+    }
+
+    void busy_work() const
+    {
+        auto const until =
+            std::chrono::steady_clock::now() + std::chrono::milliseconds(2);
+        while (std::chrono::steady_clock::now() < until)
+        {
+        }
+    }
+
+    HPX_DEFINE_COMPONENT_ACTION(test_server, get_data, get_data_action)
+    HPX_DEFINE_COMPONENT_ACTION(
+        test_server, get_invocation_count, get_invocation_count_action)
+    HPX_DEFINE_COMPONENT_ACTION(test_server, busy_work, busy_work_action)
+
+    template <typename Archive>
+    void serialize(Archive& ar, unsigned)
+    {
+        // clang-format off
+        ar & data_;
+        // clang-format on
+    }
+
+private:
+    int data_;
+};
+
+typedef hpx::components::component<test_server> server_type;
+HPX_REGISTER_COMPONENT(server_type, test_server)
+
+typedef test_server::get_data_action get_data_action;
+HPX_REGISTER_ACTION_DECLARATION(get_data_action)
+HPX_REGISTER_ACTION(get_data_action)
+
+typedef test_server::get_invocation_count_action get_invocation_count_action;
+HPX_REGISTER_ACTION_DECLARATION(get_invocation_count_action)
+HPX_REGISTER_ACTION(get_invocation_count_action)
+
+typedef test_server::busy_work_action busy_work_action;
+HPX_REGISTER_ACTION_DECLARATION(busy_work_action)
+HPX_REGISTER_ACTION(busy_work_action)
+
+///////////////////////////////////////////////////////////////////////////////
+void test_invocation_count()
+{
+    hpx::id_type id = hpx::new_<test_server>(hpx::find_here(), 42).get();
+
+    hpx::components::load_balancer_statistics stats =
+        hpx::components::get_load_balancer_statistics();
+    HPX_TEST_LTE(std::size_t(1), stats.components);
+
+    for (int i = 0; i != 10; ++i)
+    {
+        HPX_TEST_EQ(hpx::async<get_data_action>(id).get(), 42);
+    }
+
+    // the call querying the count is counted as well
+    HPX_TEST_EQ(
+        hpx::async<get_invocation_count_action>(id).get(), std::uint64_t(11));
+
+    // a single locality is never imbalanced
+    if (hpx::get_num_localities(hpx::launch::sync) == 1)
+    {
+        HPX_TEST_EQ(hpx::components::balance_load(), std::size_t(0));
+    }
+}
+
+void test_balancing()
+{
+    std::vector<hpx::id_type> localities = hpx::find_remote_localities();
+    if (localities.empty())
+    {
+        return;
+    }
+
+    // create all components here and keep this locality busy
+    std::size_t const num_components = 16;
+    std::vector<hpx::id_type> ids;
+    for (std::size_t i = 0; i != num_components; ++i)
+    {
+        ids.push_back(
+            hpx::new_<test_server>(hpx::find_here(), int(i)).get());
+    }
+
+    auto const until =
+        std::chrono::steady_clock::now() + std::chrono::seconds(2);
+    while (std::chrono::steady_clock::now() < until)
+    {
+        std::vector<hpx::future<void>> work;
+        for (hpx::id_type const& id : ids)
+        {
+            for (int i = 0; i != 8; ++i)
+            {
+                work.push_back(hpx::async<busy_work_action>(id));
+            }
+        }
+
+        hpx::components::balance_load();
+        hpx::wait_all(work);
+    }
+
+    // the components are still usable, wherever they live now
+    for (std::size_t i = 0; i != num_components; ++i)
+    {
+        HPX_TEST_EQ(hpx::async<get_data_action>(ids[i]).get(), int(i));
+    }
+
+    hpx::components::load_balancer_statistics stats =
+        hpx::components::get_load_balancer_statistics();
+    HPX_TEST_LTE(std::uint64_t(1), stats.steps);
+    HPX_TEST_EQ(stats.failed_migrations, std::uint64_t(0));
+}
+
+int hpx_main()
+{
+    test_invocation_count();
+    test_balancing();
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // balance quickly, components may move right after their creation
+    std::vector<std::string> const cfg = {
+        "hpx.load_balancing.interval=50",
+        "hpx.load_balancing.cooldown=0",
+        "hpx.distribution_policies.load_gossip_interval=10",
+    };
+
+    hpx::init_params init_args;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ(hpx::init(argc, argv, init_args), 0);
+    return hpx::util::report_errors();
+}
+#endif
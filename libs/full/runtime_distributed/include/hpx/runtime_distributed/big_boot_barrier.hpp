@@ -36,6 +36,7 @@
 namespace hpx { namespace agas {
 
     struct notification_header;
+    struct locality_table_header;
 
     struct HPX_EXPORT big_boot_barrier
     {
@@ -60,8 +61,22 @@ namespace hpx { namespace agas {
 
         std::vector<parcelset::endpoints_type> localities;
 
+        // the number of localities the table of all localities is forwarded
+        // to by each locality, zero sends it to all localities directly
+        std::uint32_t fanout;
+
+        // start-up timing (in nanoseconds)
+        std::uint64_t created_time;
+        std::uint64_t registered_time;
+        std::uint64_t connected_time;
+
         void spin();
 
+        // send the table of all localities to the children of the given
+        // locality
+        void forward_locality_table(
+            std::uint32_t locality_id, std::uint32_t fanout);
+
         void notify();
 
     public:
@@ -129,6 +144,26 @@ namespace hpx { namespace agas {
 
         void add_locality_endpoints(std::uint32_t locality_id,
             parcelset::endpoints_type const& endpoints);
+
+        // store the table of all localities received during startup and
+        // forward it to the children of this locality in the tree spanning
+        // all localities, the bbb mutex has to be held
+        void notify_locality_table(locality_table_header const& hdr);
+
+        // send the table of all localities to a locality connecting late
+        void apply_late_locality_table(std::uint32_t target_locality_id,
+            parcelset::locality const& dest);
+
+        // the bbb mutex has to be held
+        void set_registered();
+
+        // time spent until this locality was registered with the root
+        // locality (root: until all localities were registered)
+        std::int64_t get_registration_time(bool reset);
+
+        // time spent after the registration until the table of all
+        // localities was received (root: until it was sent)
+        std::int64_t get_locality_table_time(bool reset);
     };
 
     HPX_EXPORT void create_big_boot_barrier(parcelset::parcelport* pp_,
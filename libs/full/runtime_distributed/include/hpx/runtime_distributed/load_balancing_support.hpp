@@ -0,0 +1,204 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file load_balancing_support.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/components_base/get_lva.hpp>
+#include <hpx/components_base/traits/action_decorate_function.hpp>
+#include <hpx/futures/future.hpp>
+#include <hpx/modules/threading_base.hpp>
+#include <hpx/naming_base/gid_type.hpp>
+#include <hpx/naming_base/id_type.hpp>
+#include <hpx/runtime_distributed/migrate_component.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+namespace hpx { namespace components {
+
+    /// The statistics of the load balancer running on the calling locality
+    struct load_balancer_statistics
+    {
+        /// The number of load balanced components living on this locality
+        std::size_t components = 0;
+
+        /// The number of balancing steps performed so far
+        std::uint64_t steps = 0;
+
+        /// The number of components migrated away from this locality
+        std::uint64_t migrations = 0;
+
+        /// The number of migrations which did not succeed
+        std::uint64_t failed_migrations = 0;
+
+        /// Whether the last step found the locality to be overloaded
+        bool balancing = false;
+    };
+
+    /// Return the statistics of the load balancer of the calling locality
+    HPX_EXPORT load_balancer_statistics get_load_balancer_statistics();
+
+    /// Perform one balancing step on the calling locality right away instead
+    /// of waiting for the next period of the load balancer. Returns the
+    /// number of migrations started.
+    HPX_EXPORT std::size_t balance_load();
+
+    namespace detail {
+
+        /// \cond NOINTERNAL
+        using migrate_balanced_component_function =
+            hpx::future<hpx::id_type> (*)(
+                hpx::id_type const& component, hpx::id_type const& target);
+
+        HPX_EXPORT void register_balanced_component(void const* component,
+            std::atomic<std::uint64_t> const& invocations,
+            migrate_balanced_component_function migrate);
+
+        HPX_EXPORT void unregister_balanced_component(
+            void const* component) noexcept;
+
+        HPX_EXPORT void set_balanced_component_id(
+            void const* component, naming::gid_type const& id);
+        /// \endcond
+    }    // namespace detail
+
+    /// This hook has to be inserted into the derivation chain of any
+    /// migratable component for it to be moved between localities
+    /// automatically:
+    ///
+    /// struct server
+    ///   : hpx::components::load_balancing_support<
+    ///         hpx::components::migration_support<
+    ///             hpx::components::component_base<server>>>
+    /// { ... };
+    ///
+    /// The number of actions invoked on every such component is counted. Each
+    /// locality periodically compares its own load with the loads gossiped by
+    /// the other localities (see \a load_aware_distribution_policy). Once the
+    /// difference to the least loaded locality exceeds
+    /// hpx.load_balancing.high_threshold, the components with the highest
+    /// invocation rates are migrated towards that locality until the
+    /// difference drops below hpx.load_balancing.low_threshold. At most
+    /// hpx.load_balancing.max_migrations components are moved per period
+    /// (hpx.load_balancing.interval), and components which arrived less than
+    /// hpx.load_balancing.cooldown milliseconds ago stay where they are.
+    template <typename BaseComponent>
+    struct load_balancing_support : BaseComponent
+    {
+    private:
+        using base_type = BaseComponent;
+        using this_component_type = typename base_type::wrapped_type;
+
+        static_assert(base_type::supports_migration(),
+            "load_balancing_support requires the component to derive from "
+            "migration_support");
+
+    public:
+        load_balancing_support()
+          : invocations_(0)
+        {
+            register_component();
+        }
+
+        template <typename T, typename... Ts,
+            typename Enable = std::enable_if_t<
+                !std::is_same_v<std::decay_t<T>, load_balancing_support>>>
+        explicit load_balancing_support(T&& t, Ts&&... ts)
+          : base_type(HPX_FORWARD(T, t), HPX_FORWARD(Ts, ts)...)
+          , invocations_(0)
+        {
+            register_component();
+        }
+
+        // copies (as created while migrating) are new components as far as
+        // the load balancer is concerned
+        load_balancing_support(load_balancing_support const& rhs)
+          : base_type(static_cast<base_type const&>(rhs))
+          , invocations_(0)
+        {
+            register_component();
+        }
+
+        load_balancing_support(load_balancing_support&& rhs)
+          : base_type(static_cast<base_type&&>(rhs))
+          , invocations_(0)
+        {
+            register_component();
+        }
+
+        load_balancing_support& operator=(load_balancing_support const& rhs)
+        {
+            base_type::operator=(static_cast<base_type const&>(rhs));
+            return *this;
+        }
+
+        load_balancing_support& operator=(load_balancing_support&& rhs)
+        {
+            base_type::operator=(static_cast<base_type&&>(rhs));
+            return *this;
+        }
+
+        ~load_balancing_support()
+        {
+            detail::unregister_balanced_component(this);
+        }
+
+        /// Return the number of actions invoked on this instance since it was
+        /// created (or has arrived on this locality)
+        std::uint64_t invocation_count() const noexcept
+        {
+            return invocations_.load(std::memory_order_relaxed);
+        }
+
+        using decorates_action = void;
+
+        // This is the hook implementation for decorate_action which counts
+        // the actions invoked on the component.
+        template <typename F>
+        static threads::thread_function_type decorate_action(
+            naming::address_type lva, F&& f)
+        {
+            get_lva<this_component_type>::call(lva)
+                ->load_balancing_support::count_invocation();
+            return traits::component_decorate_function<base_type>::call(
+                lva, HPX_FORWARD(F, f));
+        }
+
+    private:
+        void register_component()
+        {
+            detail::register_balanced_component(
+                this, invocations_, &load_balancing_support::migrate_to);
+        }
+
+        void count_invocation()
+        {
+            // the component has a global id once the first action reaches it,
+            // the load balancer needs it to migrate the component
+            if (invocations_.fetch_add(1, std::memory_order_relaxed) == 0)
+            {
+                detail::set_balanced_component_id(this,
+                    static_cast<this_component_type const*>(this)
+                        ->get_base_gid());
+            }
+        }
+
+        static hpx::future<hpx::id_type> migrate_to(
+            hpx::id_type const& component, hpx::id_type const& target)
+        {
+            return hpx::components::migrate<this_component_type>(
+                component, target);
+        }
+
+        std::atomic<std::uint64_t> invocations_;
+    };
+}}    // namespace hpx::components
@@ -36,6 +36,7 @@
 #include <hpx/topology/topology.hpp>
 #include <hpx/util/from_string.hpp>
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
 #include <cstdlib>
@@ -394,7 +395,6 @@ namespace hpx { namespace agas {
         std::uint32_t used_cores;
         parcelset::endpoints_type agas_endpoints;
         detail::assigned_id_sequence ids;
-        std::vector<parcelset::endpoints_type> endpoints;
 
         template <typename Archive>
         void serialize(Archive& ar, const unsigned int)
@@ -410,6 +410,41 @@ namespace hpx { namespace agas {
             ar & used_cores;
             ar & agas_endpoints;
             ar & ids;
+            // clang-format on
+        }
+    };
+
+    // This structure is used to distribute the endpoints of all localities
+    // once all of them have registered. Instead of sending it to every
+    // locality, node zero sends it to a few localities only which in turn
+    // forward it along a tree spanning all localities.
+    struct locality_table_header
+    {
+        locality_table_header()
+          : locality_id(0)
+          , fanout(0)
+        {
+        }
+
+        locality_table_header(std::uint32_t locality_id_,
+            std::uint32_t fanout_,
+            std::vector<parcelset::endpoints_type> const& endpoints_)
+          : locality_id(locality_id_)
+          , fanout(fanout_)
+          , endpoints(endpoints_)
+        {
+        }
+
+        std::uint32_t locality_id;    // the receiving locality
+        std::uint32_t fanout;         // zero: don't forward
+        std::vector<parcelset::endpoints_type> endpoints;
+
+        template <typename Archive>
+        void serialize(Archive& ar, const unsigned int)
+        {
+            // clang-format off
+            ar & locality_id;
+            ar & fanout;
             ar & endpoints;
             // clang-format on
         }
@@ -418,6 +453,7 @@ namespace hpx { namespace agas {
     // {{{ early action forwards
     void register_worker(registration_header const& header);
     void notify_worker(notification_header const& header);
+    void notify_locality_table(locality_table_header const& header);
     // }}}
 
     // {{{ early action types
@@ -428,23 +464,51 @@ namespace hpx { namespace agas {
     using notify_worker_action =
         actions::direct_action<void (*)(notification_header const&),
             notify_worker>;
+
+    using notify_locality_table_action =
+        actions::direct_action<void (*)(locality_table_header const&),
+            notify_locality_table>;
     // }}}
 
 }}    // namespace hpx::agas
 
+using hpx::agas::notify_locality_table_action;
 using hpx::agas::notify_worker_action;
 using hpx::agas::register_worker_action;
 
 HPX_ACTION_HAS_CRITICAL_PRIORITY(register_worker_action)
 HPX_ACTION_HAS_CRITICAL_PRIORITY(notify_worker_action)
+HPX_ACTION_HAS_CRITICAL_PRIORITY(notify_locality_table_action)
 
 HPX_REGISTER_ACTION_ID(register_worker_action, register_worker_action,
     hpx::actions::register_worker_action_id)
 HPX_REGISTER_ACTION_ID(notify_worker_action, notify_worker_action,
     hpx::actions::notify_worker_action_id)
+HPX_REGISTER_ACTION_ID(notify_locality_table_action,
+    notify_locality_table_action,
+    hpx::actions::notify_locality_table_action_id)
 
 namespace hpx { namespace agas {
 
+    namespace detail {
+
+        // find the endpoint of the given locality which is reachable through
+        // the bootstrap parcelport
+        parcelset::locality find_bootstrap_endpoint(
+            parcelset::endpoints_type const& endpoints,
+            parcelset::locality const& here)
+        {
+            for (parcelset::endpoints_type::value_type const& loc : endpoints)
+            {
+                if (loc.second.type() == here.type())
+                {
+                    return loc.second;
+                }
+            }
+            return parcelset::locality();
+        }
+    }    // namespace detail
+
     // remote call to AGAS
     void register_worker(registration_header const& header)
     {
@@ -513,17 +577,8 @@ namespace hpx { namespace agas {
             component_addr, symbol_addr, rt.get_config().get_num_localities(),
             first_core, bbb.get_endpoints(), assigned_ids);
 
-        parcelset::locality dest;
-        parcelset::locality here = bbb.here();
-        for (parcelset::endpoints_type::value_type const& loc :
-            header.endpoints)
-        {
-            if (loc.second.type() == here.type())
-            {
-                dest = loc.second;
-                break;
-            }
-        }
+        parcelset::locality dest =
+            detail::find_bootstrap_endpoint(header.endpoints, bbb.here());
 
         // collect endpoints from all registering localities
         bbb.add_locality_endpoints(
@@ -538,6 +593,8 @@ namespace hpx { namespace agas {
             get_big_boot_barrier().apply_late(0,
                 naming::get_locality_id_from_gid(prefix), dest,
                 notify_worker_action(), HPX_MOVE(hdr));
+            get_big_boot_barrier().apply_late_locality_table(
+                naming::get_locality_id_from_gid(prefix), dest);
         }
 
         else
@@ -613,8 +670,17 @@ namespace hpx { namespace agas {
         cfg.set_first_used_core(header.used_cores);
         rt.assign_cores();
 
-        // pre-cache all known locality endpoints in local AGAS
-        agas_client.pre_cache_endpoints(header.endpoints);
+        get_big_boot_barrier().set_registered();
+    }
+
+    // AGAS callback to client, sent by node zero or forwarded by another
+    // locality (second message)
+    void notify_locality_table(locality_table_header const& header)
+    {
+        // acquires the bbb mutex, big_boot_barrier::notify() is called on exit
+        big_boot_barrier::scoped_lock lock(get_big_boot_barrier());
+
+        get_big_boot_barrier().notify_locality_table(header);
     }
     // }}}
 
@@ -622,11 +688,88 @@ namespace hpx { namespace agas {
         std::uint32_t target_locality_id, parcelset::locality const& dest,
         notification_header&& hdr)
     {
-        hdr.endpoints = localities;
         apply(source_locality_id, target_locality_id, dest,
             notify_worker_action(), HPX_MOVE(hdr));
     }
 
+    void big_boot_barrier::notify_locality_table(
+        locality_table_header const& hdr)
+    {
+        localities = hdr.endpoints;
+        connected_time = hpx::chrono::high_resolution_clock::now();
+
+        forward_locality_table(hdr.locality_id, hdr.fanout);
+    }
+
+    void big_boot_barrier::forward_locality_table(
+        std::uint32_t locality_id, std::uint32_t fanout)
+    {
+        // The tree is formed by the registered localities in the order of
+        // their ids, the children of the locality at position p are found at
+        // the positions p * fanout + 1 ... p * fanout + fanout. A fanout of
+        // zero makes node zero send the table to all localities.
+        std::vector<std::uint32_t> ids;
+        std::size_t pos = 0;
+        for (std::size_t i = 0; i != localities.size(); ++i)
+        {
+            if (localities[i].empty())
+                continue;
+
+            if (i == locality_id)
+                pos = ids.size();
+            ids.push_back(static_cast<std::uint32_t>(i));
+        }
+
+        std::size_t first = 1;
+        std::size_t last = ids.size();
+        if (fanout != 0)
+        {
+            first = pos * fanout + 1;
+            last = (std::min)(first + fanout, ids.size());
+        }
+        else if (pos != 0)
+        {
+            return;
+        }
+
+        for (std::size_t i = first; i < last; ++i)
+        {
+            std::uint32_t const target = ids[i];
+            apply(locality_id, target,
+                detail::find_bootstrap_endpoint(localities[target], here()),
+                notify_locality_table_action(),
+                locality_table_header(target, fanout, localities));
+        }
+    }
+
+    void big_boot_barrier::apply_late_locality_table(
+        std::uint32_t target_locality_id, parcelset::locality const& dest)
+    {
+        apply_late(0, target_locality_id, dest, notify_locality_table_action(),
+            locality_table_header(target_locality_id, 0, localities));
+    }
+
+    void big_boot_barrier::set_registered()
+    {
+        registered_time = hpx::chrono::high_resolution_clock::now();
+    }
+
+    std::int64_t big_boot_barrier::get_registration_time(bool /* reset */)
+    {
+        std::lock_guard<std::mutex> l(mtx);
+        if (registered_time == 0)
+            return 0;
+        return static_cast<std::int64_t>(registered_time - created_time);
+    }
+
+    std::int64_t big_boot_barrier::get_locality_table_time(bool /* reset */)
+    {
+        std::lock_guard<std::mutex> l(mtx);
+        if (registered_time == 0 || connected_time < registered_time)
+            return 0;
+        return static_cast<std::int64_t>(connected_time - registered_time);
+    }
+
     void big_boot_barrier::add_locality_endpoints(std::uint32_t locality_id,
         parcelset::endpoints_type const& endpoints_data)
     {
@@ -644,19 +787,25 @@ namespace hpx { namespace agas {
         {
             cond.wait(lock);
         }
-        // pre-cache all known locality endpoints in local AGAS on locality 0 as well
+
+        // all localities have registered with node zero
         if (service_mode_bootstrap == service_type)
         {
-            naming::resolver_client& agas_client = naming::get_agas_client();
-            agas_client.pre_cache_endpoints(localities);
+            set_registered();
         }
+
+        // pre-cache all known locality endpoints in local AGAS
+        naming::resolver_client& agas_client = naming::get_agas_client();
+        agas_client.pre_cache_endpoints(localities);
     }
 
     inline std::size_t get_number_of_bootstrap_connections(
         util::runtime_configuration const& ini)
     {
         service_mode service_type = ini.get_agas_service_mode();
-        std::size_t result = 1;
+
+        // the notification and the table of all localities
+        std::size_t result = 2;
 
         if (service_mode_bootstrap == service_type)
         {
@@ -679,6 +828,11 @@ namespace hpx { namespace agas {
       , mtx()
       , connected(get_number_of_bootstrap_connections(ini_))
       , thunks(32)
+      , fanout(util::from_string<std::uint32_t>(
+            ini_.get_entry("hpx.agas.bootstrap_fanout", "8"), 8))
+      , created_time(hpx::chrono::high_resolution_clock::now())
+      , registered_time(0)
+      , connected_time(0)
     {
         // register all not registered typenames
         if (service_type == service_mode_bootstrap)
@@ -802,6 +956,13 @@ namespace hpx { namespace agas {
                 }
                 delete p;
             }
+
+            // start distributing the table of all localities
+            {
+                std::lock_guard<std::mutex> l(mtx);
+                forward_locality_table(0, fanout);
+                connected_time = hpx::chrono::high_resolution_clock::now();
+            }
         }
     }
 
@@ -0,0 +1,431 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/async_base/launch_policy.hpp>
+#include <hpx/components_base/agas_interface.hpp>
+#include <hpx/distribution_policies/load_aware_distribution_policy.hpp>
+#include <hpx/futures/future.hpp>
+#include <hpx/naming_base/gid_type.hpp>
+#include <hpx/naming_base/id_type.hpp>
+#include <hpx/runtime_distributed/find_all_localities.hpp>
+#include <hpx/runtime_distributed/load_balancing_support.hpp>
+#include <hpx/runtime_local/config_entry.hpp>
+#include <hpx/runtime_local/interval_timer.hpp>
+#include <hpx/runtime_local/runtime_local_fwd.hpp>
+#include <hpx/synchronization/spinlock.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace components { namespace detail {
+
+    namespace {
+
+        using clock_type = std::chrono::steady_clock;
+
+        struct balanced_component
+        {
+            std::atomic<std::uint64_t> const* invocations;
+            migrate_balanced_component_function migrate;
+
+            // invalid until the first action was invoked on the component
+            naming::gid_type id;
+
+            clock_type::time_point arrived;
+            std::uint64_t last_count = 0;
+
+            // smoothed number of invocations per second
+            double rate = 0;
+            bool migrating = false;
+        };
+
+        struct migration
+        {
+            void const* component;
+            naming::gid_type id;
+            migrate_balanced_component_function migrate;
+            hpx::id_type target;
+        };
+
+        // The load balancer of this locality, it pushes hot components away
+        // from this locality as long as it is overloaded
+        class load_balancer
+        {
+            using mutex_type = hpx::spinlock;
+
+        public:
+            static load_balancer& get()
+            {
+                static load_balancer balancer;
+                return balancer;
+            }
+
+            void add(void const* component,
+                std::atomic<std::uint64_t> const& invocations,
+                migrate_balanced_component_function migrate)
+            {
+                std::unique_lock<mutex_type> l(mtx_);
+
+                balanced_component& c = components_[component];
+                c.invocations = &invocations;
+                c.migrate = migrate;
+                c.arrived = clock_type::now();
+
+                if (!started_ && hpx::is_running())
+                {
+                    start_locked(l);
+                }
+            }
+
+            void remove(void const* component) noexcept
+            {
+                std::lock_guard<mutex_type> l(mtx_);
+                components_.erase(component);
+            }
+
+            void set_id(void const* component, naming::gid_type const& id)
+            {
+                std::lock_guard<mutex_type> l(mtx_);
+
+                auto it = components_.find(component);
+                if (it != components_.end())
+                {
+                    it->second.id = naming::detail::get_stripped_gid(id);
+                }
+            }
+
+            load_balancer_statistics statistics()
+            {
+                std::lock_guard<mutex_type> l(mtx_);
+
+                load_balancer_statistics result = statistics_;
+                result.components = components_.size();
+                result.balancing = balancing_;
+                return result;
+            }
+
+            // perform one balancing step, returns the number of started
+            // migrations
+            std::size_t step()
+            {
+                std::vector<hpx::id_type> localities =
+                    hpx::find_all_localities();
+
+                clock_type::time_point const now = clock_type::now();
+                {
+                    std::lock_guard<mutex_type> l(mtx_);
+
+                    ++statistics_.steps;
+                    update_rates_locked(now);
+
+                    // migrate at most one batch of components at a time
+                    if (localities.size() < 2 || in_flight_ != 0)
+                    {
+                        return 0;
+                    }
+                }
+
+                start_load_gossip(localities);
+
+                std::uint32_t const here = agas::get_locality_id();
+                std::vector<locality_load> loads =
+                    get_locality_loads(localities);
+
+                double my_score = -1;
+                std::vector<std::pair<double, std::size_t>> targets;
+                for (std::size_t i = 0; i != loads.size(); ++i)
+                {
+                    // skip localities which were never heard of
+                    if (loads[i].sequence == 0)
+                    {
+                        continue;
+                    }
+
+                    double const score = get_load_score(loads[i], weights_);
+                    if (loads[i].locality_id == here)
+                    {
+                        my_score = score;
+                    }
+                    else
+                    {
+                        targets.emplace_back(score, i);
+                    }
+                }
+
+                if (my_score < 0 || targets.empty())
+                {
+                    return 0;
+                }
+
+                std::vector<migration> migrations;
+                {
+                    std::lock_guard<mutex_type> l(mtx_);
+
+                    // start balancing only if the imbalance is large and
+                    // keep going until it has become small
+                    double const imbalance = my_score -
+                        std::min_element(targets.begin(), targets.end())->first;
+                    if (balancing_)
+                    {
+                        balancing_ = imbalance > low_threshold_;
+                    }
+                    else
+                    {
+                        balancing_ = imbalance > high_threshold_;
+                    }
+
+                    if (!balancing_)
+                    {
+                        return 0;
+                    }
+
+                    migrations = select_locked(
+                        now, my_score, imbalance, targets, localities);
+                    in_flight_ += migrations.size();
+                }
+
+                for (migration& m : migrations)
+                {
+                    start_migration(HPX_MOVE(m));
+                }
+                return migrations.size();
+            }
+
+        private:
+            load_balancer()
+              : started_(false)
+              , balancing_(false)
+              , in_flight_(0)
+              , max_migrations_(1)
+              , high_threshold_(0.5)
+              , low_threshold_(0.2)
+              , cooldown_(std::chrono::milliseconds(10000))
+              , last_step_(clock_type::now())
+            {
+            }
+
+            void start_locked(std::unique_lock<mutex_type>& l)
+            {
+                started_ = true;
+
+                std::int64_t const interval = std::stoll(
+                    get_config_entry("hpx.load_balancing.interval", "1000"));
+                max_migrations_ = std::stoul(get_config_entry(
+                    "hpx.load_balancing.max_migrations", "1"));
+                high_threshold_ = std::stod(get_config_entry(
+                    "hpx.load_balancing.high_threshold", "0.5"));
+                low_threshold_ = (std::min)(high_threshold_,
+                    std::stod(get_config_entry(
+                        "hpx.load_balancing.low_threshold", "0.2")));
+                cooldown_ = std::chrono::milliseconds(std::stoll(
+                    get_config_entry("hpx.load_balancing.cooldown", "10000")));
+
+                if (get_config_entry("hpx.load_balancing.enabled", "1") == "0")
+                {
+                    return;
+                }
+
+                timer_ = std::make_unique<hpx::util::interval_timer>(
+                    [this]() {
+                        step();
+                        return true;    // keep running
+                    },
+                    [this]() {
+                        std::lock_guard<mutex_type> l(mtx_);
+                        started_ = false;
+                    },
+                    (std::max)(interval, std::int64_t(1)) * 1000,
+                    "load_balancer", true);
+
+                l.unlock();
+                timer_->start();
+                l.lock();
+            }
+
+            void update_rates_locked(clock_type::time_point now)
+            {
+                double const elapsed =
+                    std::chrono::duration<double>(now - last_step_).count();
+                last_step_ = now;
+
+                if (elapsed <= 0)
+                {
+                    return;
+                }
+
+                for (auto& p : components_)
+                {
+                    balanced_component& c = p.second;
+
+                    std::uint64_t const count =
+                        c.invocations->load(std::memory_order_relaxed);
+                    double const rate = double(count - c.last_count) / elapsed;
+                    c.last_count = count;
+
+                    c.rate = c.rate == 0 ? rate : 0.5 * (c.rate + rate);
+                }
+            }
+
+            // pick the hottest components whose move would not turn the
+            // target into the most loaded locality
+            std::vector<migration> select_locked(clock_type::time_point now,
+                double my_score, double imbalance,
+                std::vector<std::pair<double, std::size_t>>& targets,
+                std::vector<hpx::id_type> const& localities)
+            {
+                double total_rate = 0;
+                std::vector<std::pair<double, void const*>> candidates;
+                for (auto const& p : components_)
+                {
+                    balanced_component const& c = p.second;
+                    total_rate += c.rate;
+
+                    if (c.rate > 0 && !c.migrating && c.id &&
+                        now - c.arrived >= cooldown_)
+                    {
+                        candidates.emplace_back(c.rate, p.first);
+                    }
+                }
+
+                std::vector<migration> migrations;
+                if (candidates.empty() || total_rate <= 0)
+                {
+                    return migrations;
+                }
+
+                std::sort(candidates.begin(), candidates.end(),
+                    [](auto const& lhs, auto const& rhs) {
+                        return lhs.first > rhs.first;
+                    });
+
+                // assume the load of this locality is caused by the balanced
+                // components in proportion to their invocation rates
+                double budget = imbalance / 2;
+                for (auto const& candidate : candidates)
+                {
+                    if (migrations.size() == max_migrations_)
+                    {
+                        break;
+                    }
+
+                    double const shift =
+                        my_score * (candidate.first / total_rate);
+                    if (shift > budget)
+                    {
+                        continue;
+                    }
+                    budget -= shift;
+
+                    auto target =
+                        std::min_element(targets.begin(), targets.end());
+                    target->first += shift;
+
+                    balanced_component& c = components_[candidate.second];
+                    c.migrating = true;
+
+                    migrations.push_back(migration{candidate.second, c.id,
+                        c.migrate, localities[target->second]});
+                }
+                return migrations;
+            }
+
+            void start_migration(migration&& m)
+            {
+                hpx::future<hpx::id_type> f;
+                try
+                {
+                    f = m.migrate(hpx::id_type(m.id, hpx::id_type::unmanaged),
+                        m.target);
+                }
+                catch (...)
+                {
+                    f = hpx::make_exceptional_future<hpx::id_type>(
+                        std::current_exception());
+                }
+
+                f.then(hpx::launch::sync,
+                    [this, component = m.component, id = m.id](
+                        hpx::future<hpx::id_type>&& f) {
+                        std::lock_guard<mutex_type> l(mtx_);
+                        --in_flight_;
+
+                        if (!f.has_exception())
+                        {
+                            ++statistics_.migrations;
+                            return;
+                        }
+                        ++statistics_.failed_migrations;
+
+                        // the component stayed here, don't try again right
+                        // away
+                        auto it = components_.find(component);
+                        if (it != components_.end() && it->second.id == id)
+                        {
+                            it->second.migrating = false;
+                            it->second.arrived = clock_type::now();
+                        }
+                    });
+            }
+
+            mutex_type mtx_;
+            std::map<void const*, balanced_component> components_;
+            load_weights weights_;
+            load_balancer_statistics statistics_;
+
+            bool started_;
+            bool balancing_;
+            std::size_t in_flight_;
+
+            std::size_t max_migrations_;
+            double high_threshold_;
+            double low_threshold_;
+            clock_type::duration cooldown_;
+
+            clock_type::time_point last_step_;
+            std::unique_ptr<hpx::util::interval_timer> timer_;
+        };
+    }    // namespace
+
+    void register_balanced_component(void const* component,
+        std::atomic<std::uint64_t> const& invocations,
+        migrate_balanced_component_function migrate)
+    {
+        load_balancer::get().add(component, invocations, migrate);
+    }
+
+    void unregister_balanced_component(void const* component) noexcept
+    {
+        load_balancer::get().remove(component);
+    }
+
+    void set_balanced_component_id(
+        void const* component, naming::gid_type const& id)
+    {
+        load_balancer::get().set_id(component, id);
+    }
+}    // namespace detail
+
+    load_balancer_statistics get_load_balancer_statistics()
+    {
+        return detail::load_balancer::get().statistics();
+    }
+
+    std::size_t balance_load()
+    {
+        return detail::load_balancer::get().step();
+    }
+}}    // namespace hpx::components
@@ -20,6 +20,7 @@
 #include <hpx/execution_base/this_thread.hpp>
 #include <hpx/format.hpp>
 #include <hpx/functional/bind.hpp>
+#include <hpx/functional/bind_front.hpp>
 #include <hpx/functional/function.hpp>
 #include <hpx/itt_notify/thread_name.hpp>
 #include <hpx/modules/errors.hpp>
@@ -40,6 +41,7 @@
 #include <hpx/runtime_components/console_logging.hpp>
 #include <hpx/runtime_components/server/console_error_sink.hpp>
 #include <hpx/runtime_configuration/runtime_configuration.hpp>
+#include <hpx/runtime_configuration/startup_timings.hpp>
 #include <hpx/runtime_distributed.hpp>
 #include <hpx/runtime_distributed/applier.hpp>
 #include <hpx/runtime_distributed/big_boot_barrier.hpp>
@@ -366,6 +368,10 @@ namespace hpx {
 
 #if defined(HPX_HAVE_NETWORKING)
             parcel_handler_.enable_alternative_parcelports();
+
+            // all localities are known now, connect to the requested ones
+            // before the application starts communicating
+            parcel_handler_.warm_up_connections();
 #endif
             // reset all counters right before running main, if requested
             if (get_config_entry("hpx.print_counter.startup", "0") == "1")
@@ -448,7 +454,10 @@ namespace hpx {
                 "I/O service pool";
 #endif
         // start the thread manager
-        thread_manager_->run();
+        {
+            util::startup_timer t("thread manager startup");
+            thread_manager_->run();
+        }
         lbt_ << "(1st stage) runtime_distributed::start: started "
                 "threadmanager";
         // }}}
@@ -1039,6 +1048,50 @@ namespace hpx {
                 &performance_counters::detail::statistics_counter_creator,
                 &performance_counters::default_counter_discoverer, ""},
 
+            // 50th percentile counter
+            {"/statistics/p50",
+                performance_counters::counter_type::aggregating,
+                "returns the 50th percentile of the values of its base "
+                "counter over an arbitrary time line; pass required base "
+                "counter as the instance name: "
+                "/statistics{<base_counter_name>}/p50",
+                HPX_PERFORMANCE_COUNTER_V1,
+                &performance_counters::detail::statistics_counter_creator,
+                &performance_counters::default_counter_discoverer, ""},
+
+            // 90th percentile counter
+            {"/statistics/p90",
+                performance_counters::counter_type::aggregating,
+                "returns the 90th percentile of the values of its base "
+                "counter over an arbitrary time line; pass required base "
+                "counter as the instance name: "
+                "/statistics{<base_counter_name>}/p90",
+                HPX_PERFORMANCE_COUNTER_V1,
+                &performance_counters::detail::statistics_counter_creator,
+                &performance_counters::default_counter_discoverer, ""},
+
+            // 99th percentile counter
+            {"/statistics/p99",
+                performance_counters::counter_type::aggregating,
+                "returns the 99th percentile of the values of its base "
+                "counter over an arbitrary time line; pass required base "
+                "counter as the instance name: "
+                "/statistics{<base_counter_name>}/p99",
+                HPX_PERFORMANCE_COUNTER_V1,
+                &performance_counters::detail::statistics_counter_creator,
+                &performance_counters::default_counter_discoverer, ""},
+
+            // 99.9th percentile counter
+            {"/statistics/p999",
+                performance_counters::counter_type::aggregating,
+                "returns the 99.9th percentile of the values of its base "
+                "counter over an arbitrary time line; pass required base "
+                "counter as the instance name: "
+                "/statistics{<base_counter_name>}/p999",
+                HPX_PERFORMANCE_COUNTER_V1,
+                &performance_counters::detail::statistics_counter_creator,
+                &performance_counters::default_counter_discoverer, ""},
+
             // uptime counters
             {
                 "/runtime/uptime",
@@ -1228,6 +1281,44 @@ namespace hpx {
         performance_counters::install_counter_types(arithmetic_counter_types,
             sizeof(arithmetic_counter_types) /
                 sizeof(arithmetic_counter_types[0]));
+
+#if defined(HPX_HAVE_NETWORKING)
+        // start-up timing counters
+        agas::big_boot_barrier& bbb = agas::get_big_boot_barrier();
+        hpx::function<std::int64_t(bool)> registration_time(hpx::bind_front(
+            &agas::big_boot_barrier::get_registration_time, &bbb));
+        hpx::function<std::int64_t(bool)> locality_table_time(hpx::bind_front(
+            &agas::big_boot_barrier::get_locality_table_time, &bbb));
+
+        using placeholders::_1;
+        using placeholders::_2;
+        performance_counters::generic_counter_type_data const
+            startup_counter_types[] = {
+                {"/runtime/time/startup/registration",
+                    performance_counters::counter_type::raw,
+                    "returns the time spent during startup until this "
+                    "locality was registered with the AGAS root locality "
+                    "(on the root locality: until all localities were "
+                    "registered)",
+                    HPX_PERFORMANCE_COUNTER_V1,
+                    hpx::bind(
+                        &performance_counters::locality_raw_counter_creator, _1,
+                        registration_time, _2),
+                    &performance_counters::locality_counter_discoverer, "ns"},
+                {"/runtime/time/startup/locality_table",
+                    performance_counters::counter_type::raw,
+                    "returns the time spent during startup after the "
+                    "registration until the table of all localities was "
+                    "received (on the root locality: until it was sent)",
+                    HPX_PERFORMANCE_COUNTER_V1,
+                    hpx::bind(
+                        &performance_counters::locality_raw_counter_creator, _1,
+                        locality_table_time, _2),
+                    &performance_counters::locality_counter_discoverer, "ns"},
+            };
+        performance_counters::install_counter_types(startup_counter_types,
+            sizeof(startup_counter_types) / sizeof(startup_counter_types[0]));
+#endif
     }
 
     ///////////////////////////////////////////////////////////////////////////
@@ -11,6 +11,7 @@
 
 #include <hpx/config.hpp>
 #include <hpx/algorithms/traits/segmented_iterator_traits.hpp>
+#include <hpx/async_combinators/when_all.hpp>
 #include <hpx/async_distributed/dataflow.hpp>
 #include <hpx/datastructures/tuple.hpp>
 #include <hpx/functional/invoke.hpp>
@@ -333,22 +334,20 @@ namespace hpx { namespace parallel { inline namespace v1 {
 
             segment_iterator_out sit_out = traits_out::segment(dest);
 
-            std::vector<T> results;
             std::vector<local_iterator_in_tuple> in_iters;
+            std::vector<segment_iterator_in> in_segments;
             std::vector<segment_iterator_out> out_iters;
 
-            // 1. Step: scan on each partition, push last T of scan into results
+            // collect the non-empty parts of all segments
             if (sit_in == send_in)
             {
                 // all elements on the same partition
                 local_iterator_type_in beg = traits_in::local(first);
-                local_iterator_type_in end = traits_in::end(sit_in);
+                local_iterator_type_in end = traits_in::local(last);
                 if (beg != end)
                 {
-                    results.push_back(dispatch(traits_in::get_id(sit_in),
-                        segmented_scan_T<T>(), policy, std::true_type(), beg,
-                        end, op, conv));
                     in_iters.push_back(hpx::make_tuple(beg, end));
+                    in_segments.push_back(sit_in);
                     out_iters.push_back(sit_out);
                 }
             }
@@ -360,10 +359,8 @@ namespace hpx { namespace parallel { inline namespace v1 {
 
                 if (beg != end)
                 {
-                    results.push_back(dispatch(traits_in::get_id(sit_in),
-                        segmented_scan_T<T>(), policy, std::true_type(), beg,
-                        end, op, conv));
                     in_iters.push_back(hpx::make_tuple(beg, end));
+                    in_segments.push_back(sit_in);
                     out_iters.push_back(sit_out);
                 }
 
@@ -375,10 +372,8 @@ namespace hpx { namespace parallel { inline namespace v1 {
                     end = traits_in::end(sit_in);
                     if (beg != end)
                     {
-                        results.push_back(dispatch(traits_in::get_id(sit_in),
-                            segmented_scan_T<T>(), policy, std::true_type(),
-                            beg, end, op, conv));
                         in_iters.push_back(hpx::make_tuple(beg, end));
+                        in_segments.push_back(sit_in);
                         out_iters.push_back(sit_out);
                     }
                 }
@@ -388,30 +383,45 @@ namespace hpx { namespace parallel { inline namespace v1 {
                 end = traits_in::local(last);
                 if (beg != end)
                 {
-                    results.push_back(dispatch(traits_in::get_id(sit_in),
-                        segmented_scan_T<T>(), policy, std::true_type(), beg,
-                        end, op, conv));
                     in_iters.push_back(hpx::make_tuple(beg, end));
+                    in_segments.push_back(sit_in);
                     out_iters.push_back(sit_out);
                 }
             }
 
             // first init value is the given init value
             T last_value = init;
-            for (std::size_t i = 0; i < results.size(); ++i)
+            for (std::size_t i = 0; i != in_iters.size(); ++i)
             {
                 using hpx::get;
+
                 local_iterator_type_out out = traits_out::begin(out_iters[i]);
 
-                // 2. Step: use the init values to dispatch final scan for each
-                // segment
+                if (i + 1 == in_iters.size())
+                {
+                    // the total of the last segment is not needed
+                    dispatch(traits_out::get_id(out_iters[i]),
+                        segmented_scan_void<Algo>(), policy, std::true_type(),
+                        get<0>(in_iters[i]), get<1>(in_iters[i]), out, conv,
+                        last_value, op);
+                    break;
+                }
+
+                // 1. Step: compute the total of the segment, this has to be
+                // done before the segment is scanned (which might be in place)
+                T total = dispatch(traits_in::get_id(in_segments[i]),
+                    segmented_scan_T<T>(), policy, std::true_type(),
+                    get<0>(in_iters[i]), get<1>(in_iters[i]), op, conv);
+
+                // 2. Step: use the init value to dispatch the final scan of
+                // the segment
                 dispatch(traits_out::get_id(out_iters[i]),
                     segmented_scan_void<Algo>(), policy, std::true_type(),
-                    get<0>(in_iters[i]), get<1>(in_iters[i]), out,
-                    HPX_FORWARD(Conv, conv), last_value, HPX_FORWARD(Op, op));
+                    get<0>(in_iters[i]), get<1>(in_iters[i]), out, conv,
+                    last_value, op);
 
-                // 3. Step: compute new init values for the next segment
-                last_value = op(results[i], last_value);
+                // 3. Step: compute the init value for the next segment
+                last_value = HPX_INVOKE(op, last_value, total);
             }
 
             OutIter final_dest = dest;
@@ -449,7 +459,7 @@ namespace hpx { namespace parallel { inline namespace v1 {
             {
                 // all elements on the same partition
                 local_iterator_type beg = traits::local(first);
-                local_iterator_type end = traits::end(sit);
+                local_iterator_type end = traits::local(last);
                 if (beg != end)
                 {
                     results.push_back(dispatch(traits::get_id(sit), Algo(),
@@ -505,6 +515,13 @@ namespace hpx { namespace parallel { inline namespace v1 {
         // parallel implementation
 
         // parallel segmented OutIter implementation
+        //
+        // 1. Step: all segments but the last one are reduced concurrently,
+        //          their totals are needed for the init values only
+        // 2. Step: the init values of all segments are computed at once as
+        //          an exclusive scan of the segment totals
+        // 3. Step: all segments are scanned concurrently, each starting at
+        //          its init value
         template <typename Algo, typename ExPolicy, typename SegIter,
             typename OutIter, typename T, typename Op, typename Conv>
         static typename util::detail::algorithm_result<ExPolicy, OutIter>::type
@@ -522,7 +539,6 @@ namespace hpx { namespace parallel { inline namespace v1 {
 
             typedef hpx::traits::segmented_iterator_traits<OutIter> traits_out;
             typedef typename traits_out::segment_iterator segment_iterator_out;
-            typedef typename traits_out::local_iterator local_iterator_type_out;
 
             typedef typename std::iterator_traits<
                 segment_iterator_in>::difference_type difference_type;
@@ -540,29 +556,27 @@ namespace hpx { namespace parallel { inline namespace v1 {
 
             segment_iterator_out sit_out = traits_out::segment(dest);
 
-            difference_type count = std::distance(sit_in, send_in);
+            difference_type count = std::distance(sit_in, send_in) + 1;
 
-            std::vector<hpx::shared_future<T>> results;
             std::vector<local_iterator_in_tuple> in_iters;
+            std::vector<segment_iterator_in> in_segments;
             std::vector<segment_iterator_out> out_iters;
 
-            results.reserve(count);
             in_iters.reserve(count);
+            in_segments.reserve(count);
             out_iters.reserve(count);
 
-            // 1. Step: scan on each partition, push last T of scan into results
+            // collect the non-empty parts of all segments
             if (sit_in == send_in)
             {
                 // all elements on the same partition
                 local_iterator_type_in beg = traits_in::local(first);
-                local_iterator_type_in end = traits_in::end(sit_in);
+                local_iterator_type_in end = traits_in::local(last);
                 if (beg != end)
                 {
                     in_iters.push_back(hpx::make_tuple(beg, end));
+                    in_segments.push_back(sit_in);
                     out_iters.push_back(sit_out);
-                    results.push_back(dispatch_async(traits_in::get_id(sit_in),
-                        segmented_scan_T<T>(), policy, forced_seq(), beg, end,
-                        op, conv));
                 }
             }
             else
@@ -574,10 +588,8 @@ namespace hpx { namespace parallel { inline namespace v1 {
                 if (beg != end)
                 {
                     in_iters.push_back(hpx::make_tuple(beg, end));
+                    in_segments.push_back(sit_in);
                     out_iters.push_back(sit_out);
-                    results.push_back(dispatch_async(traits_in::get_id(sit_in),
-                        segmented_scan_T<T>(), policy, forced_seq(), beg, end,
-                        op, conv));
                 }
 
                 // handle all partitions
@@ -589,10 +601,8 @@ namespace hpx { namespace parallel { inline namespace v1 {
                     if (beg != end)
                     {
                         in_iters.push_back(hpx::make_tuple(beg, end));
+                        in_segments.push_back(sit_in);
                         out_iters.push_back(sit_out);
-                        results.push_back(dispatch_async(
-                            traits_in::get_id(sit_in), segmented_scan_T<T>(),
-                            policy, forced_seq(), beg, end, op, conv));
                     }
                 }
 
@@ -602,62 +612,77 @@ namespace hpx { namespace parallel { inline namespace v1 {
                 if (beg != end)
                 {
                     in_iters.push_back(hpx::make_tuple(beg, end));
+                    in_segments.push_back(sit_in);
                     out_iters.push_back(sit_out);
-                    results.push_back(dispatch_async(traits_in::get_id(sit_in),
-                        segmented_scan_T<T>(), policy, forced_seq(), beg, end,
-                        op, conv));
                 }
             }
 
-            std::vector<hpx::shared_future<T>> workitems;
-            workitems.reserve(results.size() + 1);
-
-            std::vector<hpx::future<void>> finalitems;
-            finalitems.reserve(results.size());
+            OutIter final_dest = dest;
+            std::advance(final_dest, std::distance(first, last));
 
-            // first init value is the given init value
-            workitems.push_back(make_ready_future(init));
+            std::size_t const num_segments = in_iters.size();
+            if (num_segments == 0)
+                return result::get(HPX_MOVE(final_dest));
 
-            std::size_t i = 0;
+            // 1. Step: reduce all segments but the last one
+            std::vector<hpx::future<T>> totals;
+            totals.reserve(num_segments - 1);
 
-            for (auto const& res : results)
+            for (std::size_t i = 0; i != num_segments - 1; ++i)
             {
                 using hpx::get;
-                segment_iterator_out out_it = out_iters[i];
-                local_iterator_type_out out = traits_out::begin(out_it);
-                local_iterator_in_tuple in_tuple = in_iters[i];
-
-                // 2. Step: use the init values to dispatch final scan for each
-                // segment performed as soon as the init values are ready
-                // wait for 1. step of current partition to prevent race condition
-                // when used in place
-                finalitems.push_back(hpx::dataflow(policy.executor(),
-                    hpx::unwrapping([=, &op, &conv](T last_value, T) -> void {
-                        dispatch(traits_out::get_id(out_it),
-                            segmented_scan_void<Algo>(), hpx::execution::seq,
-                            std::true_type(), get<0>(in_tuple),
-                            get<1>(in_tuple), out, conv, last_value, op);
-                    }),
-                    workitems.back(), res));
-
-                // 3. Step: compute new init value for the next segment
-                // performed as soon as the needed results are ready
-                workitems.push_back(hpx::dataflow(policy.executor(),
-                    hpx::unwrapping(op), workitems.back(), res));
-                ++i;
+                totals.push_back(dispatch_async(
+                    traits_in::get_id(in_segments[i]), segmented_scan_T<T>(),
+                    policy, forced_seq(), get<0>(in_iters[i]),
+                    get<1>(in_iters[i]), op, conv));
             }
 
-            OutIter final_dest = dest;
-            std::advance(final_dest, std::distance(first, last));
+            // all totals have to be available before any of the segments is
+            // scanned, this prevents races when scanning in place
+            hpx::future<OutIter> scanned = hpx::dataflow(policy.executor(),
+                [policy, in_iters = HPX_MOVE(in_iters),
+                    out_iters = HPX_MOVE(out_iters), final_dest, init, op,
+                    conv](std::vector<hpx::future<T>>&& totals) mutable
+                -> hpx::future<OutIter> {
+                    std::size_t const num_segments = in_iters.size();
+
+                    std::vector<hpx::future<void>> scans;
+                    scans.reserve(num_segments);
+
+                    // 2. Step: exclusive scan of the segment totals
+                    T init_value = init;
+                    for (std::size_t i = 0; i != num_segments; ++i)
+                    {
+                        using hpx::get;
+                        if (i != 0)
+                        {
+                            init_value = HPX_INVOKE(
+                                op, init_value, totals[i - 1].get());
+                        }
+
+                        // 3. Step: scan the segment starting at its init
+                        // value
+                        scans.push_back(dispatch_async(
+                            traits_out::get_id(out_iters[i]),
+                            segmented_scan_void<Algo>(), policy, forced_seq(),
+                            get<0>(in_iters[i]), get<1>(in_iters[i]),
+                            traits_out::begin(out_iters[i]), conv, init_value,
+                            op));
+                    }
 
-            // wait for all tasks to finish
-            return result::get(hpx::dataflow(
-                [final_dest](std::vector<hpx::shared_future<T>>&&,
-                    std::vector<hpx::shared_future<T>>&&,
-                    std::vector<hpx::future<void>>&&) mutable -> OutIter {
-                    return final_dest;
+                    return hpx::when_all(scans).then(hpx::launch::sync,
+                        [final_dest](
+                            hpx::future<std::vector<hpx::future<void>>>&& f)
+                            -> OutIter {
+                            // propagate exceptions
+                            for (hpx::future<void>& scan : f.get())
+                                scan.get();
+                            return final_dest;
+                        });
                 },
-                HPX_MOVE(results), HPX_MOVE(workitems), HPX_MOVE(finalitems)));
+                HPX_MOVE(totals));
+
+            return result::get(HPX_MOVE(scanned));
         }
 
         // parallel non-segmented OutIter implementation
@@ -704,7 +729,7 @@ namespace hpx { namespace parallel { inline namespace v1 {
             {
                 // all elements on the same partition
                 local_iterator_type beg = traits::local(first);
-                local_iterator_type end = traits::end(sit);
+                local_iterator_type end = traits::local(last);
                 if (beg != end)
                 {
                     results.push_back(dispatch_async(traits::get_id(sit),
@@ -749,44 +774,50 @@ namespace hpx { namespace parallel { inline namespace v1 {
                 }
             }
 
-            std::vector<hpx::shared_future<T>> workitems;
-            workitems.reserve(results.size() + 1);
-
-            std::vector<hpx::future<void>> finalitems;
-            finalitems.reserve(results.size());
-
-            workitems.push_back(make_ready_future(init));
+            // the init values of all segments are computed at once as an
+            // exclusive scan of the segment totals, the results of all
+            // segments are merged concurrently afterwards
+            hpx::future<OutIter> merged = hpx::dataflow(policy.executor(),
+                [policy, segment_sizes = HPX_MOVE(segment_sizes), dest,
+                    final_dest, init, op, f1, f2](
+                    std::vector<hpx::shared_future<vector_type>>&&
+                        results) mutable -> hpx::future<OutIter> {
+                    std::vector<hpx::future<void>> merges;
+                    merges.reserve(results.size());
+
+                    T init_value = init;
+                    for (std::size_t i = 0; i != results.size(); ++i)
+                    {
+                        if (i != 0)
+                        {
+                            init_value = HPX_INVOKE(op, init_value,
+                                HPX_INVOKE(f2, results[i - 1].get()));
+                        }
 
-            std::size_t segment_index = 0;
+                        merges.push_back(execution::async_execute(
+                            policy.executor(),
+                            [res = results[i], dest, init_value, op,
+                                f1]() mutable -> void {
+                                vector_type const& r = res.get();
+                                f1(r.begin(), r.end(), dest, init_value, op);
+                            }));
 
-            for (auto const& res : results)
-            {
-                // collect all results with updated init values
-                finalitems.push_back(hpx::dataflow(policy.executor(),
-                    hpx::unwrapping([&, dest](T last_value, vector_type r) {
-                        // merge function
-                        f1(r.begin(), r.end(), dest, last_value, op);
-                    }),
-                    workitems.back(), res));
-
-                std::advance(dest, segment_sizes[segment_index++]);
-
-                // propagate results from left to right
-                // new init value is most right value combined with old init
-                workitems.push_back(hpx::dataflow(policy.executor(),
-                    hpx::unwrapping(op), workitems.back(),
-                    execution::async_execute(
-                        policy.executor(), hpx::unwrapping(f2), res)));
-            }
+                        std::advance(dest, segment_sizes[i]);
+                    }
 
-            // wait for all tasks to finish
-            return result::get(hpx::dataflow(
-                [final_dest](std::vector<hpx::shared_future<vector_type>>&&,
-                    std::vector<hpx::shared_future<T>>&&,
-                    std::vector<hpx::future<void>>&&) mutable -> OutIter {
-                    return final_dest;
+                    return hpx::when_all(merges).then(hpx::launch::sync,
+                        [final_dest](
+                            hpx::future<std::vector<hpx::future<void>>>&& f)
+                            -> OutIter {
+                            // propagate exceptions
+                            for (hpx::future<void>& merge : f.get())
+                                merge.get();
+                            return final_dest;
+                        });
                 },
-                HPX_MOVE(results), HPX_MOVE(workitems), HPX_MOVE(finalitems)));
+                HPX_MOVE(results));
+
+            return result::get(HPX_MOVE(merged));
         }
         /// \endcond
     }    // namespace detail
@@ -0,0 +1,734 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/algorithms/traits/projected.hpp>
+#include <hpx/algorithms/traits/segmented_iterator_traits.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/async_combinators/wait_all.hpp>
+#include <hpx/async_local/async.hpp>
+#include <hpx/execution/algorithms/detail/predicates.hpp>
+#include <hpx/executors/execution_policy.hpp>
+#include <hpx/naming_base/gid_type.hpp>
+#include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/algorithms/merge.hpp>
+#include <hpx/parallel/algorithms/sort.hpp>
+#include <hpx/parallel/algorithms/stable_sort.hpp>
+#include <hpx/parallel/segmented_algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/util/compare_projected.hpp>
+#include <hpx/parallel/util/detail/algorithm_result.hpp>
+#include <hpx/parallel/util/detail/handle_remote_exceptions.hpp>
+#include <hpx/parallel/util/projection_identity.hpp>
+#include <hpx/serialization/vector.hpp>
+#include <hpx/synchronization/spinlock.hpp>
+#include <hpx/type_support/unused.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <list>
+#include <map>
+#include <mutex>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace parallel { inline namespace v1 {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // segmented_sort
+    namespace detail {
+        ///////////////////////////////////////////////////////////////////////
+        /// \cond NOINTERNAL
+
+        // The sorted values of a segment are kept on the segment's locality
+        // from the time they were merged until they are written back. They
+        // can't be written right away, other segments might still have to
+        // read the original values.
+        template <typename T>
+        struct sorted_segments
+        {
+            using key_type = std::pair<naming::gid_type, std::size_t>;
+
+            static void store(key_type const& key, std::vector<T>&& values)
+            {
+                std::lock_guard<hpx::spinlock> l(mutex());
+                data()[key] = HPX_MOVE(values);
+            }
+
+            static std::vector<T> extract(key_type const& key)
+            {
+                std::lock_guard<hpx::spinlock> l(mutex());
+
+                auto it = data().find(key);
+                HPX_ASSERT(it != data().end());
+
+                std::vector<T> values = HPX_MOVE(it->second);
+                data().erase(it);
+                return values;
+            }
+
+        private:
+            static hpx::spinlock& mutex()
+            {
+                static hpx::spinlock mtx;
+                return mtx;
+            }
+
+            static std::map<key_type, std::vector<T>>& data()
+            {
+                static std::map<key_type, std::vector<T>> values;
+                return values;
+            }
+        };
+
+        // a sequence of values of a segment belonging to the same bucket
+        template <typename LocalIter>
+        struct sort_run
+        {
+            hpx::id_type id;
+            LocalIter first;
+            LocalIter last;
+
+            template <typename Archive>
+            void serialize(Archive& ar, unsigned /* version */)
+            {
+                // clang-format off
+                ar & id & first & last;
+                // clang-format on
+            }
+        };
+
+        template <typename LocalIter>
+        using sort_bucket = std::vector<sort_run<LocalIter>>;
+
+        ///////////////////////////////////////////////////////////////////////
+        // sort the values of a segment and return evenly spaced samples
+        template <typename LocalIter, typename T>
+        struct sort_segment
+          : public detail::algorithm<sort_segment<LocalIter, T>, std::vector<T>>
+        {
+            sort_segment()
+              : sort_segment::algorithm("sort_segment")
+            {
+            }
+
+            template <typename ExPolicy, typename Iter, typename Comp,
+                typename Proj>
+            static std::vector<T> sequential(ExPolicy&& policy, Iter first,
+                Iter last, Comp&& comp, Proj&& proj, bool stable,
+                std::size_t num_samples)
+            {
+                if (stable)
+                {
+                    hpx::stable_sort(policy, first, last, comp, proj);
+                }
+                else
+                {
+                    hpx::sort(policy, first, last, comp, proj);
+                }
+
+                std::size_t const count = std::distance(first, last);
+
+                std::vector<T> samples;
+                samples.reserve(num_samples);
+                for (std::size_t i = 1; i <= num_samples; ++i)
+                {
+                    samples.push_back(*std::next(
+                        first, (i * count) / (num_samples + 1)));
+                }
+                return samples;
+            }
+
+            template <typename ExPolicy, typename Iter, typename Comp,
+                typename Proj>
+            static std::vector<T> parallel(ExPolicy&& policy, Iter first,
+                Iter last, Comp&& comp, Proj&& proj, bool stable,
+                std::size_t num_samples)
+            {
+                return sequential(HPX_FORWARD(ExPolicy, policy), first, last,
+                    HPX_FORWARD(Comp, comp), HPX_FORWARD(Proj, proj), stable,
+                    num_samples);
+            }
+        };
+
+        // return the offsets of the first value of a sorted segment that
+        // is greater than each of the splitters
+        template <typename LocalIter, typename T>
+        struct sort_segment_bounds
+          : public detail::algorithm<sort_segment_bounds<LocalIter, T>,
+                std::vector<std::size_t>>
+        {
+            sort_segment_bounds()
+              : sort_segment_bounds::algorithm("sort_segment_bounds")
+            {
+            }
+
+            template <typename ExPolicy, typename Iter, typename Comp,
+                typename Proj>
+            static std::vector<std::size_t> sequential(ExPolicy&&, Iter first,
+                Iter last, std::vector<T> const& splitters, Comp&& comp,
+                Proj&& proj)
+            {
+                util::compare_projected<Comp&, Proj&> less(comp, proj);
+
+                std::vector<std::size_t> bounds;
+                bounds.reserve(splitters.size());
+                for (T const& splitter : splitters)
+                {
+                    bounds.push_back(std::distance(first,
+                        std::upper_bound(first, last, splitter, less)));
+                }
+                return bounds;
+            }
+
+            template <typename ExPolicy, typename Iter, typename Comp,
+                typename Proj>
+            static std::vector<std::size_t> parallel(ExPolicy&& policy,
+                Iter first, Iter last, std::vector<T> const& splitters,
+                Comp&& comp, Proj&& proj)
+            {
+                return sequential(HPX_FORWARD(ExPolicy, policy), first, last,
+                    splitters, HPX_FORWARD(Comp, comp),
+                    HPX_FORWARD(Proj, proj));
+            }
+        };
+
+        // return a copy of the values of a segment
+        template <typename LocalIter, typename T>
+        struct copy_segment
+          : public detail::algorithm<copy_segment<LocalIter, T>, std::vector<T>>
+        {
+            copy_segment()
+              : copy_segment::algorithm("copy_segment")
+            {
+            }
+
+            template <typename ExPolicy, typename Iter>
+            static std::vector<T> sequential(ExPolicy&&, Iter first, Iter last)
+            {
+                return std::vector<T>(first, last);
+            }
+
+            template <typename ExPolicy, typename Iter>
+            static std::vector<T> parallel(
+                ExPolicy&& policy, Iter first, Iter last)
+            {
+                return sequential(HPX_FORWARD(ExPolicy, policy), first, last);
+            }
+        };
+
+        // Collect the runs of all buckets overlapping with a segment, merge
+        // each bucket, and keep the values ending up in the segment.
+        template <typename LocalIter, typename T>
+        struct merge_segment
+          : public detail::algorithm<merge_segment<LocalIter, T>, std::size_t>
+        {
+            merge_segment()
+              : merge_segment::algorithm("merge_segment")
+            {
+            }
+
+            template <typename ExPolicy, typename Comp>
+            static std::vector<T> merge_runs(ExPolicy const& policy,
+                std::vector<std::vector<T>>&& runs, Comp const& less)
+            {
+                // merge adjacent runs until a single one is left, the values
+                // of an earlier run precede equal values of a later run
+                while (runs.size() > 1)
+                {
+                    std::vector<std::vector<T>> merged;
+                    merged.reserve((runs.size() + 1) / 2);
+                    for (std::size_t i = 0; i + 1 < runs.size(); i += 2)
+                    {
+                        std::vector<T> out(runs[i].size() + runs[i + 1].size());
+                        hpx::merge(policy, runs[i].begin(), runs[i].end(),
+                            runs[i + 1].begin(), runs[i + 1].end(), out.begin(),
+                            less);
+                        merged.push_back(HPX_MOVE(out));
+                    }
+                    if (runs.size() % 2 != 0)
+                    {
+                        merged.push_back(HPX_MOVE(runs.back()));
+                    }
+                    runs = HPX_MOVE(merged);
+                }
+                return runs.empty() ? std::vector<T>() : HPX_MOVE(runs[0]);
+            }
+
+            template <typename ExPolicy, typename Iter, typename Comp,
+                typename Proj>
+            static std::size_t sequential(ExPolicy&& policy, Iter first,
+                Iter last, std::vector<sort_bucket<LocalIter>> const& buckets,
+                std::size_t skip, Comp&& comp, Proj&& proj,
+                typename sorted_segments<T>::key_type const& key)
+            {
+                util::compare_projected<Comp&, Proj&> less(comp, proj);
+
+                // read the runs directly from the segments holding them
+                std::vector<std::vector<hpx::future<std::vector<T>>>> runs;
+                runs.reserve(buckets.size());
+                for (sort_bucket<LocalIter> const& bucket : buckets)
+                {
+                    std::vector<hpx::future<std::vector<T>>> bucket_runs;
+                    bucket_runs.reserve(bucket.size());
+                    for (sort_run<LocalIter> const& run : bucket)
+                    {
+                        bucket_runs.push_back(dispatch_async(run.id,
+                            copy_segment<LocalIter, T>(), hpx::execution::seq,
+                            std::true_type(), run.first, run.last));
+                    }
+                    runs.push_back(HPX_MOVE(bucket_runs));
+                }
+
+                std::size_t const count = std::distance(first, last);
+
+                std::vector<T> values;
+                values.reserve(count);
+                for (auto& bucket_runs : runs)
+                {
+                    std::vector<std::vector<T>> bucket_values;
+                    bucket_values.reserve(bucket_runs.size());
+                    for (auto& f : bucket_runs)
+                    {
+                        bucket_values.push_back(f.get());
+                    }
+
+                    std::vector<T> merged =
+                        merge_runs(policy, HPX_MOVE(bucket_values), less);
+
+                    // drop the values belonging to the preceding segments
+                    auto begin = merged.begin();
+                    if (skip != 0)
+                    {
+                        std::size_t const skipped = (std::min)(skip,
+                            static_cast<std::size_t>(merged.size()));
+                        begin += skipped;
+                        skip -= skipped;
+                    }
+
+                    std::size_t const remaining = count - values.size();
+                    auto end = std::distance(begin, merged.end()) >
+                            static_cast<std::ptrdiff_t>(remaining) ?
+                        begin + remaining :
+                        merged.end();
+
+                    values.insert(values.end(), std::make_move_iterator(begin),
+                        std::make_move_iterator(end));
+                }
+
+                HPX_ASSERT(values.size() == count);
+                sorted_segments<T>::store(key, HPX_MOVE(values));
+                return count;
+            }
+
+            template <typename ExPolicy, typename Iter, typename Comp,
+                typename Proj>
+            static std::size_t parallel(ExPolicy&& policy, Iter first,
+                Iter last, std::vector<sort_bucket<LocalIter>> const& buckets,
+                std::size_t skip, Comp&& comp, Proj&& proj,
+                typename sorted_segments<T>::key_type const& key)
+            {
+                return sequential(HPX_FORWARD(ExPolicy, policy), first, last,
+                    buckets, skip, HPX_FORWARD(Comp, comp),
+                    HPX_FORWARD(Proj, proj), key);
+            }
+        };
+
+        // write the merged values back into the segment (or drop them)
+        template <typename LocalIter, typename T>
+        struct store_segment
+          : public detail::algorithm<store_segment<LocalIter, T>, std::size_t>
+        {
+            store_segment()
+              : store_segment::algorithm("store_segment")
+            {
+            }
+
+            template <typename ExPolicy, typename Iter>
+            static std::size_t sequential(ExPolicy&&, Iter first, Iter last,
+                typename sorted_segments<T>::key_type const& key, bool write)
+            {
+                HPX_UNUSED(last);
+
+                std::vector<T> values = sorted_segments<T>::extract(key);
+                if (write)
+                {
+                    HPX_ASSERT(static_cast<std::size_t>(std::distance(
+                                   first, last)) == values.size());
+                    std::move(values.begin(), values.end(), first);
+                }
+                return values.size();
+            }
+
+            template <typename ExPolicy, typename Iter>
+            static std::size_t parallel(ExPolicy&& policy, Iter first,
+                Iter last, typename sorted_segments<T>::key_type const& key,
+                bool write)
+            {
+                return sequential(
+                    HPX_FORWARD(ExPolicy, policy), first, last, key, write);
+            }
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        template <typename ExPolicy, typename T>
+        void handle_sort_exceptions(std::vector<hpx::future<T>> const& results)
+        {
+            std::list<std::exception_ptr> errors;
+            util::detail::handle_remote_exceptions<ExPolicy>::call(
+                results, errors);
+        }
+
+        // Sort the values of all segments using a sample sort: every segment
+        // is sorted locally and contributes evenly spaced samples from which
+        // the splitters of the buckets are selected. Each segment then
+        // collects the parts of all buckets overlapping with its own range of
+        // positions and merges them. The values of a segment are sent to
+        // each of the segments they end up in only.
+        template <typename ExPolicy, typename SegIter, typename Comp,
+            typename Proj>
+        void segmented_sort(ExPolicy const& policy, SegIter first,
+            SegIter last, Comp&& comp, Proj&& proj, bool stable)
+        {
+            using traits = hpx::traits::segmented_iterator_traits<SegIter>;
+            using segment_iterator = typename traits::segment_iterator;
+            using local_iterator_type = typename traits::local_iterator;
+            using value_type =
+                typename std::iterator_traits<SegIter>::value_type;
+            using key_type = typename sorted_segments<value_type>::key_type;
+            using is_seq = hpx::is_sequenced_execution_policy<ExPolicy>;
+
+            struct segment_part
+            {
+                hpx::id_type id;
+                local_iterator_type first;
+                local_iterator_type last;
+                std::size_t size;
+                key_type key;
+            };
+
+            // collect the (non-empty) parts of all segments
+            std::vector<segment_part> parts;
+
+            auto add_part = [&](segment_iterator const& sit,
+                                local_iterator_type const& beg,
+                                local_iterator_type const& end) {
+                if (beg != end)
+                {
+                    hpx::id_type id = traits::get_id(sit);
+                    key_type key(id.get_gid(),
+                        std::distance(traits::begin(sit), beg));
+                    parts.push_back(segment_part{HPX_MOVE(id), beg, end,
+                        static_cast<std::size_t>(std::distance(beg, end)),
+                        HPX_MOVE(key)});
+                }
+            };
+
+            segment_iterator sit = traits::segment(first);
+            segment_iterator send = traits::segment(last);
+
+            if (sit == send)
+            {
+                // all elements are on the same partition
+                add_part(sit, traits::local(first), traits::local(last));
+            }
+            else
+            {
+                // handle the remaining part of the first partition
+                add_part(sit, traits::local(first), traits::end(sit));
+
+                // handle all of the full partitions
+                for (++sit; sit != send; ++sit)
+                {
+                    add_part(sit, traits::begin(sit), traits::end(sit));
+                }
+
+                // handle the beginning of the last partition
+                add_part(sit, traits::begin(sit), traits::local(last));
+            }
+
+            std::size_t const num_parts = parts.size();
+            if (num_parts == 0)
+            {
+                return;
+            }
+
+            // sort all parts, every part contributes one sample less than
+            // there are parts (regular sampling)
+            std::vector<hpx::future<std::vector<value_type>>> sampled;
+            sampled.reserve(num_parts);
+            for (segment_part const& part : parts)
+            {
+                sampled.push_back(dispatch_async(part.id,
+                    sort_segment<local_iterator_type, value_type>(), policy,
+                    is_seq(), part.first, part.last, comp, proj, stable,
+                    num_parts - 1));
+            }
+            hpx::wait_all(sampled);
+            handle_sort_exceptions<ExPolicy>(sampled);
+
+            if (num_parts == 1)
+            {
+                return;
+            }
+
+            // select the splitters from the samples
+            util::compare_projected<Comp&, Proj&> less(comp, proj);
+
+            std::vector<value_type> samples;
+            samples.reserve(num_parts * (num_parts - 1));
+            for (auto& f : sampled)
+            {
+                std::vector<value_type> s = f.get();
+                samples.insert(samples.end(),
+                    std::make_move_iterator(s.begin()),
+                    std::make_move_iterator(s.end()));
+            }
+            std::sort(samples.begin(), samples.end(), less);
+
+            std::vector<value_type> splitters;
+            splitters.reserve(num_parts - 1);
+            for (std::size_t i = 1; i != num_parts; ++i)
+            {
+                splitters.push_back(samples[(i * samples.size()) / num_parts]);
+            }
+
+            // find the bucket boundaries in each part
+            std::vector<hpx::future<std::vector<std::size_t>>> bounded;
+            bounded.reserve(num_parts);
+            for (segment_part const& part : parts)
+            {
+                bounded.push_back(dispatch_async(part.id,
+                    sort_segment_bounds<local_iterator_type, value_type>(),
+                    policy, is_seq(), part.first, part.last, splitters, comp,
+                    proj));
+            }
+            hpx::wait_all(bounded);
+            handle_sort_exceptions<ExPolicy>(bounded);
+
+            // bounds[k][j] is the offset of bucket j in part k
+            std::vector<std::vector<std::size_t>> bounds;
+            bounds.reserve(num_parts);
+            for (std::size_t k = 0; k != num_parts; ++k)
+            {
+                std::vector<std::size_t> b;
+                b.reserve(num_parts + 1);
+                b.push_back(0);
+                std::vector<std::size_t> inner = bounded[k].get();
+                b.insert(b.end(), inner.begin(), inner.end());
+                b.push_back(parts[k].size);
+                bounds.push_back(HPX_MOVE(b));
+            }
+
+            // the position of the first value of each bucket in the sorted
+            // sequence
+            std::vector<std::size_t> bucket_offsets(num_parts + 1, 0);
+            for (std::size_t j = 0; j != num_parts; ++j)
+            {
+                std::size_t size = 0;
+                for (std::size_t k = 0; k != num_parts; ++k)
+                {
+                    size += bounds[k][j + 1] - bounds[k][j];
+                }
+                bucket_offsets[j + 1] = bucket_offsets[j] + size;
+            }
+
+            // every part merges the buckets overlapping with its positions
+            std::vector<hpx::future<std::size_t>> merged;
+            merged.reserve(num_parts);
+
+            std::size_t part_offset = 0;
+            std::size_t bucket = 0;
+            for (segment_part const& part : parts)
+            {
+                std::size_t const part_end = part_offset + part.size;
+
+                // skip the buckets ending before this part
+                while (bucket_offsets[bucket + 1] <= part_offset)
+                {
+                    ++bucket;
+                }
+
+                std::size_t const skip = part_offset - bucket_offsets[bucket];
+
+                std::vector<sort_bucket<local_iterator_type>> buckets;
+                for (std::size_t j = bucket;
+                     j != num_parts && bucket_offsets[j] < part_end; ++j)
+                {
+                    sort_bucket<local_iterator_type> runs;
+                    for (std::size_t k = 0; k != num_parts; ++k)
+                    {
+                        if (bounds[k][j] != bounds[k][j + 1])
+                        {
+                            runs.push_back(sort_run<local_iterator_type>{
+                                parts[k].id,
+                                std::next(parts[k].first, bounds[k][j]),
+                                std::next(parts[k].first, bounds[k][j + 1])});
+                        }
+                    }
+                    buckets.push_back(HPX_MOVE(runs));
+                }
+
+                merged.push_back(dispatch_async(part.id,
+                    merge_segment<local_iterator_type, value_type>(), policy,
+                    is_seq(), part.first, part.last, buckets, skip, comp, proj,
+                    part.key));
+
+                part_offset = part_end;
+            }
+            hpx::wait_all(merged);
+
+            // write the merged values back once all of them were read, drop
+            // them if any of the parts failed
+            bool const write = std::all_of(merged.begin(), merged.end(),
+                [](hpx::future<std::size_t> const& f) {
+                    return !f.has_exception();
+                });
+
+            std::vector<hpx::future<std::size_t>> stored;
+            stored.reserve(num_parts);
+            for (std::size_t k = 0; k != num_parts; ++k)
+            {
+                if (!merged[k].has_exception())
+                {
+                    stored.push_back(dispatch_async(parts[k].id,
+                        store_segment<local_iterator_type, value_type>(),
+                        policy, is_seq(), parts[k].first, parts[k].last,
+                        parts[k].key, write));
+                }
+            }
+            hpx::wait_all(stored);
+
+            handle_sort_exceptions<ExPolicy>(merged);
+            handle_sort_exceptions<ExPolicy>(stored);
+        }
+
+        template <typename ExPolicy, typename SegIter, typename Comp,
+            typename Proj>
+        typename util::detail::algorithm_result<ExPolicy>::type
+        segmented_sort_(ExPolicy&& policy, SegIter first, SegIter last,
+            Comp&& comp, Proj&& proj, bool stable)
+        {
+            using result = util::detail::algorithm_result<ExPolicy>;
+
+            if (first == last)
+            {
+                return result::get();
+            }
+
+            if constexpr (hpx::is_async_execution_policy_v<
+                              std::decay_t<ExPolicy>>)
+            {
+                return result::get(hpx::async(
+                    [policy = policy(hpx::execution::non_task), first, last,
+                        comp = HPX_FORWARD(Comp, comp),
+                        proj = HPX_FORWARD(Proj, proj), stable]() mutable {
+                        segmented_sort(
+                            policy, first, last, comp, proj, stable);
+                    }));
+            }
+            else
+            {
+                segmented_sort(policy, first, last, HPX_FORWARD(Comp, comp),
+                    HPX_FORWARD(Proj, proj), stable);
+                return result::get();
+            }
+        }
+        /// \endcond
+    }    // namespace detail
+}}}      // namespace hpx::parallel::v1
+
+// The segmented overloads of sort and stable_sort sort the values of all
+// segments in place using a distributed sample sort. The number of values
+// in each segment does not change.
+namespace hpx { namespace segmented {
+
+    // clang-format off
+    template <typename SegIter,
+        typename Comp = hpx::parallel::v1::detail::less,
+        typename Proj = hpx::parallel::util::projection_identity,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::traits::is_iterator<SegIter>::value &&
+            hpx::traits::is_segmented_iterator<SegIter>::value
+        )>
+    // clang-format on
+    void tag_invoke(hpx::sort_t, SegIter first, SegIter last,
+        Comp&& comp = Comp(), Proj&& proj = Proj())
+    {
+        static_assert(hpx::traits::is_random_access_iterator<SegIter>::value,
+            "Requires a random access iterator.");
+
+        hpx::parallel::v1::detail::segmented_sort_(hpx::execution::seq, first,
+            last, HPX_FORWARD(Comp, comp), HPX_FORWARD(Proj, proj), false);
+    }
+
+    // clang-format off
+    template <typename ExPolicy, typename SegIter,
+        typename Comp = hpx::parallel::v1::detail::less,
+        typename Proj = hpx::parallel::util::projection_identity,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::is_execution_policy<ExPolicy>::value &&
+            hpx::traits::is_iterator<SegIter>::value &&
+            hpx::traits::is_segmented_iterator<SegIter>::value
+        )>
+    // clang-format on
+    typename hpx::parallel::util::detail::algorithm_result<ExPolicy>::type
+    tag_invoke(hpx::sort_t, ExPolicy&& policy, SegIter first, SegIter last,
+        Comp&& comp = Comp(), Proj&& proj = Proj())
+    {
+        static_assert(hpx::traits::is_random_access_iterator<SegIter>::value,
+            "Requires a random access iterator.");
+
+        return hpx::parallel::v1::detail::segmented_sort_(
+            HPX_FORWARD(ExPolicy, policy), first, last,
+            HPX_FORWARD(Comp, comp), HPX_FORWARD(Proj, proj), false);
+    }
+
+    // clang-format off
+    template <typename SegIter,
+        typename Comp = hpx::parallel::v1::detail::less,
+        typename Proj = hpx::parallel::util::projection_identity,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::traits::is_iterator<SegIter>::value &&
+            hpx::traits::is_segmented_iterator<SegIter>::value
+        )>
+    // clang-format on
+    void tag_invoke(hpx::stable_sort_t, SegIter first, SegIter last,
+        Comp&& comp = Comp(), Proj&& proj = Proj())
+    {
+        static_assert(hpx::traits::is_random_access_iterator<SegIter>::value,
+            "Requires a random access iterator.");
+
+        hpx::parallel::v1::detail::segmented_sort_(hpx::execution::seq, first,
+            last, HPX_FORWARD(Comp, comp), HPX_FORWARD(Proj, proj), true);
+    }
+
+    // clang-format off
+    template <typename ExPolicy, typename SegIter,
+        typename Comp = hpx::parallel::v1::detail::less,
+        typename Proj = hpx::parallel::util::projection_identity,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::is_execution_policy<ExPolicy>::value &&
+            hpx::traits::is_iterator<SegIter>::value &&
+            hpx::traits::is_segmented_iterator<SegIter>::value
+        )>
+    // clang-format on
+    typename hpx::parallel::util::detail::algorithm_result<ExPolicy>::type
+    tag_invoke(hpx::stable_sort_t, ExPolicy&& policy, SegIter first,
+        SegIter last, Comp&& comp = Comp(), Proj&& proj = Proj())
+    {
+        static_assert(hpx::traits::is_random_access_iterator<SegIter>::value,
+            "Requires a random access iterator.");
+
+        return hpx::parallel::v1::detail::segmented_sort_(
+            HPX_FORWARD(ExPolicy, policy), first, last,
+            HPX_FORWARD(Comp, comp), HPX_FORWARD(Proj, proj), true);
+    }
+}}    // namespace hpx::segmented
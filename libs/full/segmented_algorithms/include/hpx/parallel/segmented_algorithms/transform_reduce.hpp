@@ -386,8 +386,9 @@ namespace hpx { namespace segmented {
             hpx::traits::is_segmented_iterator<SegIter>::value
         )>
     // clang-format on
-    std::decay<T> tag_invoke(hpx::transform_reduce_t, SegIter first,
-        SegIter last, T&& init, Reduce&& red_op, Convert&& conv_op)
+    typename std::decay<T>::type tag_invoke(hpx::transform_reduce_t,
+        SegIter first, SegIter last, T&& init, Reduce&& red_op,
+        Convert&& conv_op)
     {
         static_assert(hpx::traits::is_input_iterator<SegIter>::value,
             "Requires at least input iterator.");
@@ -12,6 +12,7 @@
 #include <hpx/include/runtime.hpp>
 #include <hpx/modules/testing.hpp>
 
+#include <algorithm>
 #include <cstddef>
 #include <iostream>
 #include <vector>
@@ -106,6 +107,52 @@ void handle_values_tests_distributed_access(hpx::partitioned_vector<T>& v)
     compare_vectors(values2, result2);
 }
 
+template <typename T>
+void handle_values_tests_range(hpx::partitioned_vector<T>& v)
+{
+    fill_vector(v, T(42));
+
+    // the range crosses partition boundaries
+    std::size_t const first = 1;
+    std::size_t const last = v.size() - 1;
+
+    std::vector<T> values(last - first);
+    fill_vector(values, T(48), T(3));
+
+    v.set_values(hpx::launch::sync, first, values);
+    std::vector<T> result = v.get_values(hpx::launch::sync, first, last);
+    compare_vectors(values, result);
+
+    HPX_TEST(v.get_values(first, first).get().empty());
+    HPX_TEST_EQ(v.get_value(hpx::launch::sync, 0), T(42));
+    HPX_TEST_EQ(v.get_value(hpx::launch::sync, last), T(42));
+
+    // sequential iteration reads the values in blocks
+    std::vector<T> expected(v.size(), T(42));
+    std::copy(values.begin(), values.end(), expected.begin() + first);
+
+    hpx::partitioned_vector<T> const& cv = v;
+    HPX_TEST(std::equal(cv.begin(), cv.end(), expected.begin()));
+    HPX_TEST(std::equal(v.begin(), v.end(), expected.begin()));
+
+    // values written through an iterator are visible to later reads
+    typename hpx::partitioned_vector<T>::iterator it = v.begin();
+    for (std::size_t i = 0; i != v.size(); ++i, ++it)
+    {
+        T value = *it;
+        HPX_TEST_EQ(value, expected[i]);
+
+        *it = T(value + 1);
+        HPX_TEST_EQ(T(*it), T(expected[i] + 1));
+    }
+
+    result = v.get_values(hpx::launch::sync, 0, v.size());
+    for (std::size_t i = 0; i != v.size(); ++i)
+    {
+        HPX_TEST_EQ(result[i], T(expected[i] + 1));
+    }
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 
 template <typename T, typename DistPolicy>
@@ -121,6 +168,11 @@ void handle_values_tests_with_policy(
         hpx::partitioned_vector<T> v(size, policy);
         handle_values_tests_distributed_access(v);
     }
+
+    {
+        hpx::partitioned_vector<T> v(size, policy);
+        handle_values_tests_range(v);
+    }
 }
 
 template <typename T>
@@ -141,6 +193,10 @@ void handle_values_tests()
         hpx::partitioned_vector<T> v(length, T(42));
         handle_values_tests(v);
     }
+    {
+        hpx::partitioned_vector<T> v(length);
+        handle_values_tests_range(v);
+    }
 
     handle_values_tests_with_policy<T>(length, 1, hpx::container_layout);
     handle_values_tests_with_policy<T>(length, 3, hpx::container_layout(3));
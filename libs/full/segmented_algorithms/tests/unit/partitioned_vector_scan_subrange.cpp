@@ -0,0 +1,142 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx_main.hpp>
+#include <hpx/include/parallel_scan.hpp>
+#include <hpx/include/partitioned_vector_predef.hpp>
+#include <hpx/include/runtime.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <numeric>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// The vector types to be used are defined in partitioned_vector module.
+#if defined(HPX_HAVE_STATIC_LINKING)
+HPX_REGISTER_PARTITIONED_VECTOR(int)
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+// associative, but not commutative
+struct keep_left
+{
+    int operator()(int lhs, int) const
+    {
+        return lhs;
+    }
+};
+
+std::vector<int> read_vector(hpx::partitioned_vector<int> const& v)
+{
+    return v.get_values(hpx::launch::sync, 0, v.size());
+}
+
+hpx::partitioned_vector<int> make_vector(
+    std::size_t size, hpx::container_distribution_policy const& layout)
+{
+    std::vector<int> values(size);
+    std::iota(values.begin(), values.end(), 1);
+
+    hpx::partitioned_vector<int> v(size, layout);
+    v.set_values(hpx::launch::sync, 0, values);
+    return v;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// scan ranges starting and ending in the middle of the same partition
+template <typename ExPolicy>
+void subrange_test(ExPolicy const& policy, std::size_t size,
+    hpx::container_distribution_policy const& layout)
+{
+    hpx::partitioned_vector<int> v = make_vector(size, layout);
+    std::vector<int> values = read_vector(v);
+
+    std::size_t const first = 3;
+    std::size_t const last = 10;
+
+    std::vector<int> expected(last - first);
+    std::inclusive_scan(values.begin() + first, values.begin() + last,
+        expected.begin(), std::plus<int>(), 42);
+
+    std::vector<int> out(last - first + 1, -1);
+    auto it = hpx::inclusive_scan(policy, v.begin() + first,
+        v.begin() + last, out.begin(), std::plus<int>(), 42);
+    HPX_TEST(it == out.begin() + (last - first));
+    HPX_TEST(std::equal(expected.begin(), expected.end(), out.begin()));
+    HPX_TEST_EQ(out.back(), -1);
+
+    std::exclusive_scan(values.begin() + first, values.begin() + last,
+        expected.begin(), 42, std::plus<int>());
+
+    hpx::exclusive_scan(policy, v.begin() + first, v.begin() + last,
+        out.begin(), 42, std::plus<int>());
+    HPX_TEST(std::equal(expected.begin(), expected.end(), out.begin()));
+    HPX_TEST_EQ(out.back(), -1);
+
+    // segmented destination, in place
+    std::inclusive_scan(values.begin() + first, values.begin() + last,
+        values.begin() + first, std::plus<int>(), 42);
+
+    hpx::inclusive_scan(policy, v.begin() + first, v.begin() + last,
+        v.begin() + first, std::plus<int>(), 42);
+    HPX_TEST(read_vector(v) == values);
+}
+
+// the init values of the segments are combined in order
+template <typename ExPolicy>
+void non_commutative_test(ExPolicy const& policy, std::size_t size,
+    hpx::container_distribution_policy const& layout)
+{
+    hpx::partitioned_vector<int> v = make_vector(size, layout);
+    std::vector<int> const expected(size, 42);
+
+    std::vector<int> out(size);
+    hpx::inclusive_scan(
+        policy, v.begin(), v.end(), out.begin(), keep_left(), 42);
+    HPX_TEST(out == expected);
+
+    hpx::exclusive_scan(
+        policy, v.begin(), v.end(), out.begin(), 42, keep_left());
+    HPX_TEST(out == expected);
+
+    hpx::partitioned_vector<int> dest(size, layout);
+    hpx::inclusive_scan(
+        policy, v.begin(), v.end(), dest.begin(), keep_left(), 42);
+    HPX_TEST(read_vector(dest) == expected);
+
+    hpx::exclusive_scan(
+        policy, v.begin(), v.end(), dest.begin(), 42, keep_left());
+    HPX_TEST(read_vector(dest) == expected);
+}
+
+template <typename ExPolicy>
+void scan_tests(ExPolicy const& policy)
+{
+    std::vector<hpx::id_type> const localities = hpx::find_all_localities();
+
+    for (std::size_t size : {1007, 10007})
+    {
+        subrange_test(policy, size, hpx::container_layout(localities));
+        subrange_test(policy, size, hpx::container_layout(5, localities));
+
+        non_commutative_test(policy, size, hpx::container_layout(localities));
+        non_commutative_test(
+            policy, size, hpx::container_layout(7, localities));
+    }
+}
+
+int main()
+{
+    scan_tests(hpx::execution::seq);
+    scan_tests(hpx::execution::par);
+
+    return hpx::util::report_errors();
+}
+#endif
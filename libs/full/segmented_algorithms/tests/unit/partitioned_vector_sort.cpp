@@ -0,0 +1,180 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/runtime.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx_main.hpp>
+#include <hpx/include/parallel_sort.hpp>
+#include <hpx/include/partitioned_vector.hpp>
+
+#include <hpx/modules/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <random>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// Define the vector types to be used.
+HPX_REGISTER_PARTITIONED_VECTOR(int)
+
+///////////////////////////////////////////////////////////////////////////////
+// compares the values by their key, the remaining digits record the original
+// position of the value
+constexpr int key_factor = 100000;
+
+struct compare_keys
+{
+    bool operator()(int lhs, int rhs) const
+    {
+        return lhs / key_factor < rhs / key_factor;
+    }
+};
+
+std::vector<int> make_values(std::size_t size, int num_keys)
+{
+    std::mt19937 gen(std::random_device{}());
+    std::uniform_int_distribution<int> dist(0, num_keys - 1);
+
+    std::vector<int> values(size);
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        values[i] = dist(gen) * key_factor + static_cast<int>(i);
+    }
+    return values;
+}
+
+void fill_vector(
+    hpx::partitioned_vector<int>& v, std::vector<int> const& values)
+{
+    auto it = v.begin();
+    for (int value : values)
+    {
+        *it++ = value;
+    }
+}
+
+std::vector<int> read_vector(hpx::partitioned_vector<int> const& v)
+{
+    return std::vector<int>(v.begin(), v.end());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy>
+void sort_test(ExPolicy const& policy, std::size_t size,
+    hpx::container_distribution_policy const& layout)
+{
+    std::vector<int> values = make_values(size, 10000);
+
+    hpx::partitioned_vector<int> v(size, layout);
+    fill_vector(v, values);
+
+    hpx::sort(policy, v.begin(), v.end());
+
+    std::sort(values.begin(), values.end());
+    HPX_TEST(read_vector(v) == values);
+
+    // sort in descending order
+    hpx::sort(policy, v.begin(), v.end(), std::greater<int>());
+
+    std::sort(values.begin(), values.end(), std::greater<int>());
+    HPX_TEST(read_vector(v) == values);
+}
+
+template <typename ExPolicy>
+void sort_test_async(ExPolicy const& policy, std::size_t size,
+    hpx::container_distribution_policy const& layout)
+{
+    std::vector<int> values = make_values(size, 10000);
+
+    hpx::partitioned_vector<int> v(size, layout);
+    fill_vector(v, values);
+
+    hpx::sort(policy, v.begin(), v.end()).get();
+
+    std::sort(values.begin(), values.end());
+    HPX_TEST(read_vector(v) == values);
+}
+
+template <typename ExPolicy>
+void stable_sort_test(ExPolicy const& policy, std::size_t size,
+    hpx::container_distribution_policy const& layout)
+{
+    // many equal keys, the original order of equal keys has to be preserved
+    std::vector<int> values = make_values(size, 7);
+
+    hpx::partitioned_vector<int> v(size, layout);
+    fill_vector(v, values);
+
+    hpx::stable_sort(policy, v.begin(), v.end(), compare_keys());
+
+    std::stable_sort(values.begin(), values.end(), compare_keys());
+    HPX_TEST(read_vector(v) == values);
+}
+
+// sort a range starting and ending in the middle of a segment
+void sort_subrange_test(
+    std::size_t size, hpx::container_distribution_policy const& layout)
+{
+    std::vector<int> values = make_values(size, 10000);
+
+    hpx::partitioned_vector<int> v(size, layout);
+    fill_vector(v, values);
+
+    std::size_t const first = size / 7;
+    std::size_t const last = size - size / 5;
+    hpx::sort(hpx::execution::par, v.begin() + first, v.begin() + last);
+
+    std::sort(values.begin() + first, values.begin() + last);
+    HPX_TEST(read_vector(v) == values);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void sort_tests(
+    std::size_t size, hpx::container_distribution_policy const& layout)
+{
+    using namespace hpx::execution;
+
+    sort_test(seq, size, layout);
+    sort_test(par, size, layout);
+    sort_test_async(seq(task), size, layout);
+    sort_test_async(par(task), size, layout);
+
+    stable_sort_test(seq, size, layout);
+    stable_sort_test(par, size, layout);
+
+    sort_subrange_test(size, layout);
+
+    // sequential overloads
+    std::vector<int> values = make_values(size, 10000);
+    hpx::partitioned_vector<int> v(size, layout);
+    fill_vector(v, values);
+
+    hpx::sort(v.begin(), v.end());
+    std::sort(values.begin(), values.end());
+    HPX_TEST(read_vector(v) == values);
+
+    hpx::stable_sort(v.begin(), v.end(), std::greater<int>());
+    std::stable_sort(values.begin(), values.end(), std::greater<int>());
+    HPX_TEST(read_vector(v) == values);
+}
+
+int main()
+{
+    std::vector<hpx::id_type> const localities = hpx::find_all_localities();
+
+    for (std::size_t size : {1, 10, 1000, 10007})
+    {
+        sort_tests(size, hpx::container_layout(localities));
+        sort_tests(size, hpx::container_layout(5, localities));
+        sort_tests(size, hpx::container_layout(13, localities));
+    }
+
+    return hpx::util::report_errors();
+}
+#endif
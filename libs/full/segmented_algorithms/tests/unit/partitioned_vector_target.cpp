@@ -8,6 +8,7 @@
 #if !defined(HPX_COMPUTE_DEVICE_CODE)
 #include <hpx/hpx_main.hpp>
 #include <hpx/include/compute.hpp>
+#include <hpx/include/parallel_for_each.hpp>
 #include <hpx/include/partitioned_vector.hpp>
 #include <hpx/include/runtime.hpp>
 #include <hpx/modules/testing.hpp>
@@ -30,10 +31,30 @@ HPX_REGISTER_PARTITIONED_VECTOR(double, target_vector_double)
 
 ///////////////////////////////////////////////////////////////////////////////
 template <typename T>
-void allocation_tests()
+struct add_one
 {
-    std::size_t const length = 12;
+    void operator()(T& val) const
+    {
+        val += T(1);
+    }
+};
 
+template <typename T, typename Vector>
+void check_values(Vector const& v, std::size_t length, T val)
+{
+    HPX_TEST_EQ(v.size(), length);
+
+    std::size_t count = 0;
+    for (auto it = v.begin(); it != v.end(); ++it, ++count)
+    {
+        HPX_TEST_EQ(T(*it), val);
+    }
+    HPX_TEST_EQ(count, length);
+}
+
+template <typename T>
+void allocation_tests(std::size_t length)
+{
     typedef hpx::compute::host::block_allocator<T> target_allocator;
     typedef hpx::compute::vector<T, target_allocator> target_vector;
 
@@ -45,6 +66,19 @@ void allocation_tests()
         {
             hpx::partitioned_vector<T, target_vector> v(
                 length, T(42), hpx::compute::host::target_layout);
+            check_values(v, length, T(42));
+
+            // the elements are touched by the executors of the allocator
+            // the partitions were created with
+            hpx::for_each(hpx::execution::par, v.begin(), v.end(),
+                add_one<T>());
+            check_values(v, length, T(43));
+        }
+
+        {
+            hpx::partitioned_vector<T, target_vector> v(
+                length, hpx::compute::host::target_layout);
+            check_values(v, length, T());
         }
     }
 
@@ -73,9 +107,12 @@ void allocation_tests()
 ///////////////////////////////////////////////////////////////////////////////
 int main()
 {
-    allocation_tests<double>();
-    allocation_tests<int>();
+    for (std::size_t length : {1, 12, 1007})
+    {
+        allocation_tests<double>(length);
+        allocation_tests<int>(length);
+    }
 
-    return 0;
+    return hpx::util::report_errors();
 }
 #endif
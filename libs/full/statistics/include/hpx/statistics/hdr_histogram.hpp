@@ -0,0 +1,210 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <thread>
+
+namespace hpx { namespace util {
+
+    namespace detail {
+        // every thread records into the same shard of all histograms
+        inline std::size_t hdr_histogram_thread_index() noexcept
+        {
+            static std::atomic<std::size_t> next_index(0);
+            static thread_local std::size_t const index =
+                next_index.fetch_add(1, std::memory_order_relaxed);
+            return index;
+        }
+
+        // the number of bits needed to represent the value
+        inline unsigned hdr_histogram_bit_width(std::uint64_t value) noexcept
+        {
+#if defined(HPX_GCC_VERSION) || defined(HPX_CLANG_VERSION)
+            return value == 0 ? 0 : 64 - __builtin_clzll(value);
+#else
+            unsigned bits = 0;
+            while (value != 0)
+            {
+                value >>= 1;
+                ++bits;
+            }
+            return bits;
+#endif
+        }
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    // A high dynamic range histogram of non-negative integer values. The
+    // buckets are spaced logarithmically, each power of two range being split
+    // into 2^(significant_bits - 1) linear sub-buckets, which bounds the
+    // relative error of the reported percentiles by 2^-(significant_bits - 1)
+    // over the whole range of std::uint64_t.
+    //
+    // Recording a value is lock-free: the threads record into separate
+    // shards of atomic bucket counts, the shards are combined when a
+    // percentile is queried.
+    class hdr_histogram
+    {
+    public:
+        explicit hdr_histogram(
+            std::size_t num_shards = 0, unsigned significant_bits = 7)
+          : sub_bucket_half_bits_(
+                (std::max)((std::min)(significant_bits, 16u), 2u) - 1)
+          , sub_bucket_half_count_(std::size_t(1) << sub_bucket_half_bits_)
+          , num_buckets_(
+                (64 - sub_bucket_half_bits_ + 1) * sub_bucket_half_count_)
+          , num_shards_(num_shards != 0 ?
+                    num_shards :
+                    (std::max)(std::thread::hardware_concurrency(), 1u))
+          , shards_(new shard[num_shards_])
+        {
+            for (std::size_t i = 0; i != num_shards_; ++i)
+            {
+                shards_[i].data_.counts.reset(
+                    new std::atomic<std::uint64_t>[num_buckets_]);
+            }
+            reset();
+        }
+
+        hdr_histogram(hdr_histogram const&) = delete;
+        hdr_histogram& operator=(hdr_histogram const&) = delete;
+
+        void record(std::uint64_t value, std::uint64_t count = 1) noexcept
+        {
+            shard_data& s =
+                shards_[detail::hdr_histogram_thread_index() % num_shards_]
+                    .data_;
+            s.counts[get_index(value)].fetch_add(
+                count, std::memory_order_relaxed);
+            s.total.fetch_add(count, std::memory_order_relaxed);
+        }
+
+        // the number of recorded values
+        std::uint64_t get_count() const noexcept
+        {
+            std::uint64_t count = 0;
+            for (std::size_t i = 0; i != num_shards_; ++i)
+            {
+                count +=
+                    shards_[i].data_.total.load(std::memory_order_relaxed);
+            }
+            return count;
+        }
+
+        // Returns the value below which the given percentage (0..100) of the
+        // recorded values lie, or 0 if nothing was recorded. The result is the
+        // highest value which is equivalent to the values in its bucket.
+        std::uint64_t get_percentile(double percentile) const noexcept
+        {
+            std::uint64_t const count = get_count();
+            if (count == 0)
+            {
+                return 0;
+            }
+
+            percentile = (std::min)((std::max)(percentile, 0.0), 100.0);
+            std::uint64_t const rank = (std::max)(std::uint64_t(1),
+                static_cast<std::uint64_t>(std::ceil(
+                    percentile / 100.0 * static_cast<double>(count))));
+
+            std::uint64_t seen = 0;
+            for (std::size_t index = 0; index != num_buckets_; ++index)
+            {
+                for (std::size_t i = 0; i != num_shards_; ++i)
+                {
+                    seen += shards_[i].data_.counts[index].load(
+                        std::memory_order_relaxed);
+                }
+                if (seen >= rank)
+                {
+                    return get_highest_equivalent_value(index);
+                }
+            }
+
+            // values were recorded concurrently with this query
+            return get_highest_equivalent_value(num_buckets_ - 1);
+        }
+
+        // Not atomic with respect to concurrent recording, values recorded
+        // during the reset may or may not be kept.
+        void reset() noexcept
+        {
+            for (std::size_t i = 0; i != num_shards_; ++i)
+            {
+                shard_data& s = shards_[i].data_;
+                for (std::size_t index = 0; index != num_buckets_; ++index)
+                {
+                    s.counts[index].store(0, std::memory_order_relaxed);
+                }
+                s.total.store(0, std::memory_order_relaxed);
+            }
+        }
+
+    private:
+        std::size_t get_index(std::uint64_t value) const noexcept
+        {
+            // the number of bits beyond the ones resolved by the sub-buckets
+            unsigned const bits = detail::hdr_histogram_bit_width(value);
+            unsigned const shift = bits > sub_bucket_half_bits_ + 1 ?
+                bits - sub_bucket_half_bits_ - 1 :
+                0;
+
+            // the values of bucket 0 map to the sub-buckets [0, 2 * half),
+            // all other buckets to [half, 2 * half)
+            std::size_t const index =
+                shift * sub_bucket_half_count_ + (value >> shift);
+            HPX_ASSERT(index < num_buckets_);
+            return index;
+        }
+
+        std::uint64_t get_highest_equivalent_value(
+            std::size_t index) const noexcept
+        {
+            std::size_t shift = 0;
+            std::size_t sub_bucket = index;
+            if (index >= 2 * sub_bucket_half_count_)
+            {
+                shift = index / sub_bucket_half_count_ - 1;
+                sub_bucket = index - shift * sub_bucket_half_count_;
+            }
+
+            std::uint64_t const lowest = std::uint64_t(sub_bucket) << shift;
+            return lowest + ((std::uint64_t(1) << shift) - 1);
+        }
+
+        struct shard_data
+        {
+            std::unique_ptr<std::atomic<std::uint64_t>[]> counts;
+            std::atomic<std::uint64_t> total;
+        };
+        using shard = util::cache_aligned_data<shard_data>;
+
+        unsigned const sub_bucket_half_bits_;
+        std::size_t const sub_bucket_half_count_;
+        std::size_t const num_buckets_;
+        std::size_t const num_shards_;
+        std::unique_ptr<shard[]> shards_;
+    };
+
+    namespace tag {
+        // The tag of the percentile statistics_counters (/statistics/p50 etc.)
+        // which are based on an hdr_histogram of the sampled values.
+        struct hdr_percentile
+        {
+        };
+    }    // namespace tag
+}}       // namespace hpx::util
@@ -0,0 +1,116 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/modules/statistics.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <thread>
+#include <vector>
+
+using hpx::util::hdr_histogram;
+
+///////////////////////////////////////////////////////////////////////////////
+// the reported value is at least the exact one and within the relative error
+void test_accuracy(unsigned significant_bits)
+{
+    hdr_histogram h(4, significant_bits);
+    double const error = 1.0 / double(1u << (significant_bits - 1));
+
+    std::mt19937_64 gen(42);
+    std::vector<std::uint64_t> values;
+    for (std::size_t i = 0; i != 100000; ++i)
+    {
+        // spread the values over the whole range of std::uint64_t
+        std::uint64_t const value = gen() >> (gen() % 64);
+        values.push_back(value);
+        h.record(value);
+    }
+    HPX_TEST_EQ(h.get_count(), std::uint64_t(values.size()));
+
+    std::sort(values.begin(), values.end());
+    for (double p : {1.0, 50.0, 90.0, 99.0, 99.9, 100.0})
+    {
+        std::size_t const rank =
+            static_cast<std::size_t>(std::ceil(p / 100.0 * values.size()));
+        std::uint64_t const expected = values[rank - 1];
+        std::uint64_t const result = h.get_percentile(p);
+
+        HPX_TEST_LTE(expected, result);
+        HPX_TEST_LTE(static_cast<double>(result - expected),
+            error * static_cast<double>(expected));
+    }
+}
+
+void test_small_values()
+{
+    hdr_histogram h(1);
+    HPX_TEST_EQ(h.get_percentile(50), std::uint64_t(0));
+
+    // small values are recorded exactly
+    for (std::uint64_t i = 1; i <= 100; ++i)
+    {
+        h.record(i);
+    }
+    HPX_TEST_EQ(h.get_percentile(50), std::uint64_t(50));
+    HPX_TEST_EQ(h.get_percentile(99), std::uint64_t(99));
+    HPX_TEST_EQ(h.get_percentile(100), std::uint64_t(100));
+    HPX_TEST_EQ(h.get_percentile(0), std::uint64_t(1));
+
+    // the largest value ends up in the last bucket
+    h.record(~std::uint64_t(0));
+    HPX_TEST_EQ(h.get_percentile(100), ~std::uint64_t(0));
+
+    h.record(0, 1000);
+    HPX_TEST_EQ(h.get_count(), std::uint64_t(1101));
+    HPX_TEST_EQ(h.get_percentile(50), std::uint64_t(0));
+
+    h.reset();
+    HPX_TEST_EQ(h.get_count(), std::uint64_t(0));
+    HPX_TEST_EQ(h.get_percentile(99), std::uint64_t(0));
+}
+
+void test_concurrent_recording()
+{
+    std::size_t const num_threads = 4;
+    std::size_t const num_values = 10000;
+
+    hdr_histogram h(num_threads);
+
+    std::vector<std::thread> threads;
+    for (std::size_t t = 0; t != num_threads; ++t)
+    {
+        threads.emplace_back([&h]() {
+            for (std::uint64_t i = 0; i != num_values; ++i)
+            {
+                h.record(i % 100);
+            }
+        });
+    }
+    for (auto& t : threads)
+    {
+        t.join();
+    }
+
+    HPX_TEST_EQ(h.get_count(), std::uint64_t(num_threads * num_values));
+    HPX_TEST_EQ(h.get_percentile(50), std::uint64_t(49));
+    HPX_TEST_EQ(h.get_percentile(100), std::uint64_t(99));
+}
+
+int main()
+{
+    test_accuracy(7);
+    test_accuracy(3);
+    test_accuracy(12);
+    test_small_values();
+    test_concurrent_recording();
+
+    return hpx::util::report_errors();
+}
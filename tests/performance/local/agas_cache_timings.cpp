@@ -14,6 +14,7 @@
 #include <hpx/hpx.hpp>
 #include <hpx/hpx_init.hpp>
 
+#include <hpx/agas/detail/gva_cache.hpp>
 #include <hpx/cache/entries/lfu_entry.hpp>
 #include <hpx/cache/local_cache.hpp>
 #include <hpx/cache/statistics/local_full_statistics.hpp>
@@ -30,6 +31,7 @@
 #include <iomanip>
 #include <iostream>
 #include <map>
+#include <mutex>
 #include <string>
 #include <utility>
 #include <vector>
@@ -230,6 +232,77 @@ void test_update(gva_cache_type& cache, hpx::naming::gid_type first_key)
     calculate_histogram("update", timings);
 }
 
+///////////////////////////////////////////////////////////////////////////////
+// Look up the entries from all worker threads at the same time, this compares
+// the original cache protected by a lock with the cache currently used by the
+// addressing service.
+template <typename F>
+void test_concurrent_get(
+    char const* name, std::size_t num_lookups, F&& get_entry)
+{
+    std::size_t const num_threads = hpx::get_num_worker_threads();
+
+    hpx::chrono::high_resolution_timer t;
+
+    std::vector<hpx::future<void>> lookups;
+    lookups.reserve(num_threads);
+    for (std::size_t i = 0; i != num_threads; ++i)
+    {
+        lookups.push_back(hpx::async([&, i]() {
+            for (std::size_t j = 0; j != num_lookups; ++j)
+            {
+                get_entry(i + j);
+            }
+        }));
+    }
+    hpx::wait_all(lookups);
+
+    double const elapsed = t.elapsed();
+    std::cout << "concurrent get (" << name << ", " << num_threads
+              << " threads): " << std::setprecision(3)
+              << double(num_threads * num_lookups) / elapsed
+              << " lookups/s" << std::endl;
+}
+
+void test_concurrent(gva_cache_type& cache, std::size_t cache_size,
+    hpx::naming::gid_type first_key, std::size_t num_lookups)
+{
+    std::size_t const num_entries = cache.size();
+    if (num_entries == 0)
+    {
+        return;
+    }
+
+    hpx::spinlock mtx;
+    test_concurrent_get("locked", num_lookups, [&](std::size_t i) {
+        gva_cache_key key(first_key + (i % num_entries + 1), 1);
+        gva_cache_key idbase;
+        gva_cache_type::entry_type e;
+
+        std::lock_guard<hpx::spinlock> l(mtx);
+        cache.get_entry(key, idbase, e);
+    });
+
+    hpx::naming::gid_type locality = hpx::get_locality();
+    std::int32_t ct = hpx::components::component_invalid;
+
+    hpx::agas::detail::gva_cache gva_cache;
+    gva_cache.reserve(cache_size);
+
+    std::pair<hpx::naming::gid_type, std::uint64_t> collision;
+    for (std::size_t i = 0; i != num_entries; ++i)
+    {
+        hpx::agas::gva value(locality, ct, 1, std::uint64_t(0), 0);
+        gva_cache.update_entry(first_key + (i + 1), 1, value, collision);
+    }
+
+    test_concurrent_get("gva_cache", num_lookups, [&](std::size_t i) {
+        hpx::naming::gid_type idbase;
+        hpx::agas::gva g;
+        gva_cache.get_entry(first_key + (i % num_entries + 1), idbase, g);
+    });
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 int hpx_main(hpx::program_options::variables_map& vm)
 {
@@ -241,6 +314,10 @@ int hpx_main(hpx::program_options::variables_map& vm)
     if (vm.count("num_entries"))
         num_entries = vm["num_entries"].as<std::size_t>();
 
+    std::size_t num_lookups = 100000;
+    if (vm.count("num_lookups"))
+        num_lookups = vm["num_lookups"].as<std::size_t>();
+
     gva_cache_type cache;
     cache.reserve(cache_size);
 
@@ -251,6 +328,7 @@ int hpx_main(hpx::program_options::variables_map& vm)
     test_insert(cache, num_entries);
     test_get(cache, first_key);
     test_update(cache, first_key);
+    test_concurrent(cache, cache_size, first_key, num_lookups);
 
     double elapsed = t1.elapsed();
     hpx::util::print_cdash_timing("AGASCache", elapsed);
@@ -268,7 +346,9 @@ int main(int argc, char* argv[])
         "initial cache size (default: " HPX_PP_STRINGIZE(
             HPX_AGAS_LOCAL_CACHE_SIZE_PER_THREAD) ")")("num_entries,n",
         value<std::size_t>(),
-        "number of items to insert into cache (default: 1000)");
+        "number of items to insert into cache (default: 1000)")(
+        "num_lookups", value<std::size_t>(),
+        "number of concurrent lookups per worker thread (default: 100000)");
 
     // Initialize and run HPX
     hpx::init_params init_args;
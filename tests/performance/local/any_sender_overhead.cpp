@@ -0,0 +1,143 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark measures the overhead of type-erasing a sender, connecting it,
+// and starting the resulting operation state. The sender used does not fit the
+// default embedded storage of any_sender, which is compared to any_sender
+// types with embedded storage large enough for the sender and its operation
+// state.
+
+#include <hpx/execution_base/any_sender.hpp>
+#include <hpx/local/execution.hpp>
+#include <hpx/modules/program_options.hpp>
+#include <hpx/modules/timing.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <iostream>
+#include <type_traits>
+#include <utility>
+
+namespace ex = hpx::execution::experimental;
+
+using hpx::program_options::command_line_parser;
+using hpx::program_options::notify;
+using hpx::program_options::options_description;
+using hpx::program_options::store;
+using hpx::program_options::value;
+using hpx::program_options::variables_map;
+
+std::uint64_t iterations = 1000000;
+
+using payload_type = std::array<double, 12>;
+
+struct sink_receiver
+{
+    double& result;
+
+    template <typename T>
+    friend void tag_invoke(
+        ex::set_value_t, sink_receiver&& r, T&& payload) noexcept
+    {
+        r.result += payload[0];
+    }
+
+    friend void tag_invoke(
+        ex::set_error_t, sink_receiver&&, std::exception_ptr) noexcept
+    {
+        std::terminate();
+    }
+
+    friend void tag_invoke(ex::set_stopped_t, sink_receiver&&) noexcept
+    {
+        std::terminate();
+    }
+};
+
+// Wrap the sender in a Wrapper (if not void), connect it, and start it.
+template <typename Wrapper>
+void run(char const* name, std::uint64_t local_iterations)
+{
+    payload_type payload{};
+    payload[0] = 1.0;
+
+    double result = 0.0;
+    hpx::chrono::high_resolution_timer t;
+
+    for (std::uint64_t i = 0; i != local_iterations; ++i)
+    {
+        if constexpr (std::is_void_v<Wrapper>)
+        {
+            auto os = ex::connect(ex::just(payload), sink_receiver{result});
+            ex::start(os);
+        }
+        else
+        {
+            Wrapper s = ex::just(payload);
+            auto os = ex::connect(std::move(s), sink_receiver{result});
+            ex::start(os);
+        }
+    }
+
+    double const elapsed = t.elapsed();
+    std::cout << name << " walltime/iteration: "
+              << ((elapsed / double(local_iterations)) * 1e9) << " ns"
+              << (result == double(local_iterations) ? "" : " (wrong result)")
+              << "\n";
+}
+
+int app_main(variables_map&)
+{
+    constexpr std::size_t sender_storage_size = 16 * sizeof(void*);
+    constexpr std::size_t operation_state_storage_size = 48 * sizeof(void*);
+
+    run<void>("baseline", iterations);
+    run<ex::unique_any_sender<payload_type>>(
+        "unique_any_sender (default storage)", iterations);
+    run<ex::basic_unique_any_sender<sender_storage_size,
+        operation_state_storage_size, payload_type>>(
+        "basic_unique_any_sender (embedded storage)", iterations);
+    run<ex::any_sender<payload_type>>(
+        "any_sender (default storage)", iterations);
+    run<ex::basic_any_sender<sender_storage_size,
+        operation_state_storage_size, payload_type>>(
+        "basic_any_sender (embedded storage)", iterations);
+
+    return 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main(int argc, char* argv[])
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // Parse command line.
+    variables_map vm;
+
+    options_description cmdline("Usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    cmdline.add_options()
+        ("help,h", "print out program usage (this message)")
+        ("iterations",
+            value<std::uint64_t>(&iterations)->default_value(1000000),
+            "number of iterations to invoke for each test");
+    // clang-format on
+
+    store(command_line_parser(argc, argv).options(cmdline).run(), vm);
+
+    notify(vm);
+
+    // Print help screen.
+    if (vm.count("help"))
+    {
+        std::cout << cmdline;
+        return 0;
+    }
+
+    return app_main(vm);
+}
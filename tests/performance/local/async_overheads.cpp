@@ -5,7 +5,6 @@
 //  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
 
 #include <hpx/init.hpp>
-#include <hpx/local/chrono.hpp>
 #include <hpx/local/future.hpp>
 #include <hpx/modules/testing.hpp>
 
@@ -71,25 +70,27 @@ int hpx_main(hpx::program_options::variables_map& vm)
     if (vm.count("tasks"))
         num_tasks = vm["tasks"].as<std::size_t>();
 
-    double seqential_time_per_task = 0;
+    std::size_t const repetitions = vm["repetitions"].as<std::size_t>();
 
-    {
-        std::vector<hpx::future<void>> tasks;
-        tasks.reserve(num_tasks);
+    hpx::util::perftests_init(vm, "async_overheads");
 
-        std::uint64_t start = hpx::chrono::high_resolution_clock::now();
+    double seqential_time_per_task = 0;
 
-        for (std::size_t i = 0; i != num_tasks; ++i)
-            tasks.push_back(hpx::async(&test_func));
+    {
+        hpx::util::perftests_statistics const stats =
+            hpx::util::perftests_report(
+                "async overheads - sequential", "default", repetitions, [&]() {
+                    std::vector<hpx::future<void>> tasks;
+                    tasks.reserve(num_tasks);
 
-        hpx::wait_all(tasks);
+                    for (std::size_t i = 0; i != num_tasks; ++i)
+                        tasks.push_back(hpx::async(&test_func));
 
-        std::uint64_t end = hpx::chrono::high_resolution_clock::now();
+                    hpx::wait_all(tasks);
+                });
 
-        seqential_time_per_task =
-            static_cast<double>(end - start) / 1e9 / num_tasks;
-        std::cout << "Elapsed sequential time: "
-                  << static_cast<double>(end - start) / 1e9 << " [s], ("
+        seqential_time_per_task = stats.median / num_tasks;
+        std::cout << "Elapsed sequential time: " << stats.median << " [s], ("
                   << seqential_time_per_task << " [s])" << std::endl;
         hpx::util::print_cdash_timing(
             "AsyncSequential", seqential_time_per_task);
@@ -98,18 +99,17 @@ int hpx_main(hpx::program_options::variables_map& vm)
     double hierarchical_time_per_task = 0;
 
     {
-        std::uint64_t start = hpx::chrono::high_resolution_clock::now();
-
-        hpx::future<void> f = hpx::async(&spawn_level, num_tasks);
-        hpx::wait_all(f);
-
-        std::uint64_t end = hpx::chrono::high_resolution_clock::now();
-
-        hierarchical_time_per_task =
-            static_cast<double>(end - start) / 1e9 / num_tasks;
-        std::cout << "Elapsed hierarchical time: "
-                  << static_cast<double>(end - start) / 1e9 << " [s], ("
-                  << hierarchical_time_per_task << " [s])" << std::endl;
+        hpx::util::perftests_statistics const stats =
+            hpx::util::perftests_report("async overheads - hierarchical",
+                "default", repetitions, [&]() {
+                    hpx::future<void> f = hpx::async(&spawn_level, num_tasks);
+                    hpx::wait_all(f);
+                });
+
+        hierarchical_time_per_task = stats.median / num_tasks;
+        std::cout << "Elapsed hierarchical time: " << stats.median
+                  << " [s], (" << hierarchical_time_per_task << " [s])"
+                  << std::endl;
         hpx::util::print_cdash_timing(
             "AsyncHierarchical", hierarchical_time_per_task);
     }
@@ -121,6 +121,11 @@ int hpx_main(hpx::program_options::variables_map& vm)
     hpx::util::print_cdash_timing(
         "AsyncSpeedup", seqential_time_per_task / hierarchical_time_per_task);
 
+    if (vm.count("perftests-output"))
+    {
+        hpx::util::perftests_print_times();
+    }
+
     return hpx::finalize();
 }
 
@@ -139,9 +144,13 @@ int main(int argc, char* argv[])
         ("spread,p", value<std::size_t>(&spread)->default_value(2),
          "number of sub-spawns per level (default: 2)")
         ("delay,d", value<std::uint64_t>(&delay_ns)->default_value(0),
-        "time spent in the delay loop [ns]");
+        "time spent in the delay loop [ns]")
+        ("repetitions,r", value<std::size_t>()->default_value(10),
+         "maximal number of times each benchmark is repeated (default: 10)");
     // clang-format on
 
+    hpx::util::perftests_cfg(desc_commandline);
+
     // Initialize and run HPX
     hpx::init_params init_args;
     init_args.desc_cmdline = desc_commandline;
@@ -0,0 +1,169 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Compare the sequential and parallel execution policies with their
+// vectorizing counterparts for the algorithms supported by the datapar layer.
+
+#include <hpx/include/datapar.hpp>
+#include <hpx/local/algorithm.hpp>
+#include <hpx/local/chrono.hpp>
+#include <hpx/local/execution.hpp>
+#include <hpx/local/init.hpp>
+#include <hpx/local/numeric.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <iterator>
+#include <random>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+struct benchmark_data
+{
+    std::vector<float> data1;
+    std::vector<float> data2;
+    float value;
+};
+
+template <typename F>
+std::int64_t measure(int count, F&& f)
+{
+    // warm up caches
+    f();
+
+    std::int64_t start = hpx::chrono::high_resolution_clock::now();
+
+    for (int i = 0; i != count; ++i)
+        f();
+
+    return (hpx::chrono::high_resolution_clock::now() - start) / count;
+}
+
+template <typename ExPolicy>
+void measure_algorithms(int count, ExPolicy&& policy, benchmark_data& d,
+    char const* policy_name, bool csvoutput)
+{
+    auto const first1 = std::begin(d.data1);
+    auto const last1 = std::end(d.data1);
+    auto const first2 = std::begin(d.data2);
+    float const value = d.value;
+
+    auto larger = [value](auto const& v) { return v > value; };
+
+    std::int64_t const times[] = {
+        measure(count,
+            [&]() { return hpx::count(policy, first1, last1, value); }),
+        measure(count,
+            [&]() { return hpx::count_if(policy, first1, last1, larger); }),
+        measure(count,
+            [&]() { return hpx::equal(policy, first1, last1, first2); }),
+        measure(count,
+            [&]() { return hpx::find(policy, first1, last1, -value); }),
+        measure(count,
+            [&]() {
+                // both replacements are idempotent, the input does not
+                // change after the warm up run
+                hpx::replace_if(policy, first1, last1, larger, value);
+                return hpx::replace(policy, first1, last1, value, value);
+            }),
+        measure(count,
+            [&]() { return hpx::reduce(policy, first1, last1, 0.0f); }),
+    };
+
+    char const* const names[] = {
+        "count", "count_if", "equal", "find", "replace", "reduce"};
+
+    for (std::size_t i = 0; i != std::size(times); ++i)
+    {
+        if (csvoutput)
+        {
+            std::cout << names[i] << "," << policy_name << ","
+                      << times[i] / 1e9 << "\n";
+        }
+        else
+        {
+            std::cout << names[i] << "(" << policy_name << "): " << std::right
+                      << std::setw(15) << times[i] / 1e9 << "\n";
+        }
+    }
+    std::cout << std::flush;
+}
+
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    unsigned int seed = (unsigned int) std::random_device{}();
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    std::mt19937 gen(seed);
+
+    std::size_t size = vm["vector_size"].as<std::size_t>();
+    bool csvoutput = vm["csv_output"].as<int>() ? true : false;
+    int test_count = vm["test_count"].as<int>();
+
+    if (test_count <= 0)
+    {
+        std::cout << "test_count cannot be less than zero...\n" << std::flush;
+        return hpx::local::finalize();
+    }
+
+    std::uniform_real_distribution<float> dis(0.0f, 1.0f);
+
+    benchmark_data d;
+    d.data1.resize(size);
+    std::generate(
+        std::begin(d.data1), std::end(d.data1), [&]() { return dis(gen); });
+    d.data2 = d.data1;
+    d.value = dis(gen);
+
+    using namespace hpx::execution;
+
+    measure_algorithms(test_count, seq, d, "seq", csvoutput);
+    measure_algorithms(test_count, simd, d, "simd", csvoutput);
+    measure_algorithms(test_count, par, d, "par", csvoutput);
+    measure_algorithms(test_count, par_simd, d, "par_simd", csvoutput);
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    hpx::program_options::options_description cmdline(
+        "usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    cmdline.add_options()
+        ("vector_size"
+        , hpx::program_options::value<std::size_t>()->default_value(1048576)
+        , "size of vector")
+
+        ("csv_output"
+        , hpx::program_options::value<int>()->default_value(0)
+        , "print results in csv format")
+
+        ("test_count"
+        , hpx::program_options::value<int>()->default_value(10)
+        , "number of tests to take average from")
+
+        ("seed,s"
+        , hpx::program_options::value<unsigned int>()
+        , "the random number generator seed to use for this run")
+        ;
+    // clang-format on
+
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = cmdline;
+    init_args.cfg = cfg;
+
+    return hpx::local::init(hpx_main, argc, argv, init_args);
+}
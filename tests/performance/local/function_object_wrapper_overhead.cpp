@@ -8,11 +8,13 @@
 // make inspect happy: hpxinspect:nodeprecatedinclude hpxinspect:nodeprecatedname
 
 #include <hpx/functional/function.hpp>
+#include <hpx/functional/move_only_function.hpp>
 #include <hpx/hpx.hpp>
 #include <hpx/modules/timing.hpp>
 
 #include <hpx/modules/program_options.hpp>
 
+#include <cstddef>
 #include <cstdint>
 #include <functional>
 #include <iostream>
@@ -42,6 +44,17 @@ struct foo
     }
 };
 
+// doesn't fit the default embedded storage of hpx::function
+struct bar
+{
+    std::uint64_t values[5];
+
+    std::uint64_t operator()() const
+    {
+        return values[0] + values[4];
+    }
+};
+
 template <typename F>
 void run(F const& f, std::uint64_t local_iterations)
 {
@@ -55,6 +68,36 @@ void run(F const& f, std::uint64_t local_iterations)
     std::cout << " walltime/iteration: " << ((elapsed / i) * 1e9) << " ns\n";
 }
 
+// measures the creation of a function which binds a few arguments, the
+// function may have to allocate its target on the heap
+template <typename F>
+void run_construction(std::uint64_t local_iterations)
+{
+#if defined(HPX_HAVE_FUNCTION_ALLOCATION_COUNTER)
+    std::uint64_t const allocations =
+        hpx::util::detail::get_function_allocation_count();
+#endif
+
+    std::uint64_t i = 0;
+    std::uint64_t result = 0;
+    hpx::chrono::high_resolution_timer t;
+
+    for (; i < local_iterations; ++i)
+    {
+        F f = bar{{i, i, i, i, i}};
+        result += f();
+    }
+
+    double elapsed = t.elapsed();
+    std::cout << " walltime/iteration: " << ((elapsed / i) * 1e9) << " ns";
+#if defined(HPX_HAVE_FUNCTION_ALLOCATION_COUNTER)
+    std::cout << ", allocations: "
+              << (hpx::util::detail::get_function_allocation_count() -
+                     allocations);
+#endif
+    std::cout << " (" << (result != 0) << ")\n";
+}
+
 int app_main(variables_map& vm)
 {
     {
@@ -78,6 +121,29 @@ int app_main(variables_map& vm)
         run(f, iterations);
     }
 
+    std::cout << "construction, callable size " << sizeof(bar) << " bytes\n";
+    {
+        constexpr std::size_t storage_size =
+            hpx::util::detail::function_storage_size;
+        std::cout << "hpx::move_only_function (" << storage_size
+                  << " bytes storage)";
+        run_construction<hpx::move_only_function<std::uint64_t()>>(
+            iterations);
+    }
+    {
+        constexpr std::size_t storage_size =
+            hpx::util::detail::thread_function_storage_size;
+        std::cout << "hpx::move_only_function (" << storage_size
+                  << " bytes storage)";
+        run_construction<
+            hpx::move_only_function<std::uint64_t(), false, storage_size>>(
+            iterations);
+    }
+    {
+        std::cout << "std::function";
+        run_construction<std::function<std::uint64_t()>>(iterations);
+    }
+
     return 0;
 }
 
@@ -22,6 +22,7 @@
 #include <hpx/modules/format.hpp>
 #include <hpx/modules/synchronization.hpp>
 #include <hpx/modules/testing.hpp>
+#include <hpx/testing/count_allocations.hpp>
 #include <hpx/modules/timing.hpp>
 #include <hpx/threading_base/annotated_function.hpp>
 
@@ -44,13 +45,12 @@ using hpx::apply;
 using hpx::async;
 using hpx::future;
 
-using hpx::chrono::high_resolution_timer;
-
 // global vars we stick here to make printouts easy for plotting
 static std::string queuing = "default";
 static std::size_t numa_sensitive = 0;
 static std::uint64_t num_threads = 1;
 static std::string info_string = "";
+static std::size_t repetitions = 1;
 
 ///////////////////////////////////////////////////////////////////////////////
 void print_stats(const char* title, const char* wait, const char* exec,
@@ -79,6 +79,17 @@ void print_stats(const char* title, const char* wait, const char* exec,
     //hpx::util::print_cdash_timing(title, duration);
 }
 
+// Time the benchmark and print the median of the timings
+template <typename F>
+void report(const char* title, const char* wait, const char* exec,
+    std::int64_t count, bool csv, F&& f)
+{
+    hpx::util::perftests_statistics const stats =
+        hpx::util::perftests_report(std::string(title) + " - " + wait, exec,
+            repetitions, HPX_FORWARD(F, f));
+    print_stats(title, wait, exec, count, stats.median, csv);
+}
+
 const char* exec_name(hpx::execution::parallel_executor const&)
 {
     return "parallel_executor";
@@ -129,36 +140,30 @@ HPX_PLAIN_ACTION(null_function, null_action)
 void measure_action_futures_wait_each(std::uint64_t count, bool csv)
 {
     const hpx::id_type here = hpx::find_here();
-    std::vector<future<double>> futures;
-    futures.reserve(count);
-
-    // start the clock
-    high_resolution_timer walltime;
-    for (std::uint64_t i = 0; i < count; ++i)
-        futures.push_back(async<null_action>(here));
-    hpx::wait_each(scratcher(), futures);
-
-    // stop the clock
-    const double duration = walltime.elapsed();
-    print_stats("action", "WaitEach", "no-executor", count, duration, csv);
+
+    report("action", "WaitEach", "no-executor", count, csv, [&]() {
+        std::vector<future<double>> futures;
+        futures.reserve(count);
+
+        for (std::uint64_t i = 0; i < count; ++i)
+            futures.push_back(async<null_action>(here));
+        hpx::wait_each(scratcher(), futures);
+    });
 }
 
 // Time async action execution using wait each on futures vector
 void measure_action_futures_wait_all(std::uint64_t count, bool csv)
 {
     const hpx::id_type here = hpx::find_here();
-    std::vector<future<double>> futures;
-    futures.reserve(count);
-
-    // start the clock
-    high_resolution_timer walltime;
-    for (std::uint64_t i = 0; i < count; ++i)
-        futures.push_back(async<null_action>(here));
-    hpx::wait_all(futures);
-
-    // stop the clock
-    const double duration = walltime.elapsed();
-    print_stats("action", "WaitAll", "no-executor", count, duration, csv);
+
+    report("action", "WaitAll", "no-executor", count, csv, [&]() {
+        std::vector<future<double>> futures;
+        futures.reserve(count);
+
+        for (std::uint64_t i = 0; i < count; ++i)
+            futures.push_back(async<null_action>(here));
+        hpx::wait_all(futures);
+    });
 }
 #endif
 
@@ -167,35 +172,63 @@ template <typename Executor>
 void measure_function_futures_wait_each(
     std::uint64_t count, bool csv, Executor& exec)
 {
-    std::vector<future<double>> futures;
-    futures.reserve(count);
-
-    // start the clock
-    high_resolution_timer walltime;
-    for (std::uint64_t i = 0; i < count; ++i)
-        futures.push_back(async(exec, &null_function));
-    hpx::wait_each(scratcher(), futures);
-
-    // stop the clock
-    const double duration = walltime.elapsed();
-    print_stats("async", "WaitEach", exec_name(exec), count, duration, csv);
+    report("async", "WaitEach", exec_name(exec), count, csv, [&]() {
+        std::vector<future<double>> futures;
+        futures.reserve(count);
+
+        for (std::uint64_t i = 0; i < count; ++i)
+            futures.push_back(async(exec, &null_function));
+        hpx::wait_each(scratcher(), futures);
+    });
 }
 
 template <typename Executor>
 void measure_function_futures_wait_all(
     std::uint64_t count, bool csv, Executor& exec)
 {
-    std::vector<future<double>> futures;
-    futures.reserve(count);
-
-    // start the clock
-    high_resolution_timer walltime;
-    for (std::uint64_t i = 0; i < count; ++i)
-        futures.push_back(async(exec, &null_function));
-    hpx::wait_all(futures);
+    report("async", "WaitAll", exec_name(exec), count, csv, [&]() {
+        std::vector<future<double>> futures;
+        futures.reserve(count);
+
+        for (std::uint64_t i = 0; i < count; ++i)
+            futures.push_back(async(exec, &null_function));
+        hpx::wait_all(futures);
+    });
+}
 
-    const double duration = walltime.elapsed();
-    print_stats("async", "WaitAll", exec_name(exec), count, duration, csv);
+// Time creating ready futures (with and without a value) and attaching
+// continuations to them
+void measure_ready_futures(std::uint64_t count, bool csv)
+{
+    report("make_ready_future", "WaitAll", "none", count, csv, [&]() {
+        std::vector<future<double>> futures;
+        futures.reserve(count);
+
+        for (std::uint64_t i = 0; i < count; ++i)
+            futures.push_back(hpx::make_ready_future(null_function()));
+        hpx::wait_all(futures);
+    });
+
+    report("make_ready_void", "WaitAll", "none", count, csv, [&]() {
+        std::vector<future<void>> futures;
+        futures.reserve(count);
+
+        for (std::uint64_t i = 0; i < count; ++i)
+            futures.push_back(hpx::make_ready_future());
+        hpx::wait_all(futures);
+    });
+
+    report("then", "Get", "sync", count, csv, [&]() {
+        for (std::uint64_t i = 0; i < count; ++i)
+        {
+            future<double> ready = hpx::make_ready_future(null_function());
+            global_scratch +=
+                ready
+                    .then(hpx::launch::sync,
+                        [](future<double>&& f) { return f.get(); })
+                    .get();
+        }
+    });
 }
 
 template <typename Executor>
@@ -204,7 +237,6 @@ void measure_function_futures_limiting_executor(
 {
     std::uint64_t const num_threads = hpx::get_num_worker_threads();
     std::uint64_t const tasks = num_threads * 2000;
-    std::atomic<std::uint64_t> sanity_check(count);
 
     auto const sched = hpx::threads::get_self_id_data()->get_scheduler_base();
     if (std::string("core-shared_priority_queue_scheduler") ==
@@ -228,53 +260,45 @@ void measure_function_futures_limiting_executor(
     auto const chunk_size = count / (num_threads * 2);
     hpx::execution::static_chunk_size fixed(chunk_size);
 
-    // start the clock
-    high_resolution_timer walltime;
-    {
-        hpx::execution::experimental::limiting_executor<Executor> signal_exec(
-            exec, tasks, tasks + 1000);
-        hpx::experimental::for_loop(
-            hpx::execution::par.with(fixed), 0, count, [&](std::uint64_t) {
-                hpx::apply(signal_exec, [&]() {
-                    null_function();
-                    sanity_check--;
+    report("apply", "limiting-Exec", exec_name(exec), count, csv, [&]() {
+        std::atomic<std::uint64_t> sanity_check(count);
+        {
+            hpx::execution::experimental::limiting_executor<Executor>
+                signal_exec(exec, tasks, tasks + 1000);
+            hpx::experimental::for_loop(
+                hpx::execution::par.with(fixed), 0, count, [&](std::uint64_t) {
+                    hpx::apply(signal_exec, [&]() {
+                        null_function();
+                        sanity_check--;
+                    });
                 });
-            });
-    }
-
-    if (sanity_check != 0)
-    {
-        throw std::runtime_error(
-            "This test is faulty " + std::to_string(sanity_check));
-    }
+        }
 
-    // stop the clock
-    const double duration = walltime.elapsed();
-    print_stats(
-        "apply", "limiting-Exec", exec_name(exec), count, duration, csv);
+        if (sanity_check != 0)
+        {
+            throw std::runtime_error(
+                "This test is faulty " + std::to_string(sanity_check));
+        }
+    });
 }
 
 template <typename Executor>
 void measure_function_futures_sliding_semaphore(
     std::uint64_t count, bool csv, Executor& exec)
 {
-    // start the clock
-    high_resolution_timer walltime;
-    const int sem_count = 5000;
-    hpx::sliding_semaphore sem(sem_count);
-    for (std::uint64_t i = 0; i < count; ++i)
-    {
-        hpx::async(exec, [i, &sem]() {
-            null_function();
-            sem.signal(i);
-        });
-        sem.wait(i);
-    }
-    sem.wait(count + sem_count - 1);
-
-    // stop the clock
-    const double duration = walltime.elapsed();
-    print_stats("apply", "Sliding-Sem", exec_name(exec), count, duration, csv);
+    report("apply", "Sliding-Sem", exec_name(exec), count, csv, [&]() {
+        const int sem_count = 5000;
+        hpx::sliding_semaphore sem(sem_count);
+        for (std::uint64_t i = 0; i < count; ++i)
+        {
+            hpx::async(exec, [i, &sem]() {
+                null_function();
+                sem.signal(i);
+            });
+            sem.wait(i);
+        }
+        sem.wait(count + sem_count - 1);
+    });
 }
 
 struct unlimited_number_of_chunks
@@ -298,81 +322,68 @@ template <typename Executor>
 void measure_function_futures_for_loop(std::uint64_t count, bool csv,
     Executor& exec, char const* executor_name = nullptr)
 {
-    // start the clock
-    high_resolution_timer walltime;
-    hpx::experimental::for_loop(
-        hpx::execution::par.on(exec).with(
-            hpx::execution::static_chunk_size(1), unlimited_number_of_chunks()),
-        0, count, [](std::uint64_t) { null_function(); });
-
-    // stop the clock
-    const double duration = walltime.elapsed();
-    print_stats("for_loop", "par",
-        executor_name ? executor_name : exec_name(exec), count, duration, csv);
+    report("for_loop", "par", executor_name ? executor_name : exec_name(exec),
+        count, csv, [&]() {
+            hpx::experimental::for_loop(
+                hpx::execution::par.on(exec).with(
+                    hpx::execution::static_chunk_size(1),
+                    unlimited_number_of_chunks()),
+                0, count, [](std::uint64_t) { null_function(); });
+        });
 }
 
 void measure_function_futures_register_work(std::uint64_t count, bool csv)
 {
-    hpx::latch l(count);
-
-    // start the clock
-    high_resolution_timer walltime;
-    for (std::uint64_t i = 0; i < count; ++i)
-    {
-        hpx::threads::thread_init_data data(
-            hpx::threads::make_thread_function_nullary([&l]() {
-                null_function();
-                l.count_down(1);
-            }),
-            "null_function");
-        hpx::threads::register_work(data);
-    }
-    l.wait();
-
-    // stop the clock
-    const double duration = walltime.elapsed();
-    print_stats("register_work", "latch", "none", count, duration, csv);
+    report("register_work", "latch", "none", count, csv, [&]() {
+        hpx::latch l(count);
+        for (std::uint64_t i = 0; i < count; ++i)
+        {
+            hpx::threads::thread_init_data data(
+                hpx::threads::make_thread_function_nullary([&l]() {
+                    null_function();
+                    l.count_down(1);
+                }),
+                "null_function");
+            hpx::threads::register_work(data);
+        }
+        l.wait();
+    });
 }
 
 void measure_function_futures_create_thread(std::uint64_t count, bool csv)
 {
-    hpx::latch l(count);
-
     auto const sched = hpx::threads::get_self_id_data()->get_scheduler_base();
-    auto func = [&l]() {
-        null_function();
-        l.count_down(1);
-    };
-    auto const thread_func =
-        hpx::threads::detail::thread_function_nullary<decltype(func)>{func};
     auto const desc = hpx::util::thread_description();
     auto const prio = hpx::threads::thread_priority::normal;
     auto const hint = hpx::threads::thread_schedule_hint();
     auto const stack_size = hpx::threads::thread_stacksize::small_;
-    hpx::error_code ec;
 
-    // start the clock
-    high_resolution_timer walltime;
-    for (std::uint64_t i = 0; i < count; ++i)
-    {
-        auto init = hpx::threads::thread_init_data(
-            hpx::threads::thread_function_type(thread_func), desc, prio, hint,
-            stack_size, hpx::threads::thread_schedule_state::pending, false,
-            sched);
-        sched->create_thread(init, nullptr, ec);
-    }
-    l.wait();
+    report("create_thread", "latch", "none", count, csv, [&]() {
+        hpx::latch l(count);
 
-    // stop the clock
-    const double duration = walltime.elapsed();
-    print_stats("create_thread", "latch", "none", count, duration, csv);
+        auto func = [&l]() {
+            null_function();
+            l.count_down(1);
+        };
+        auto const thread_func =
+            hpx::threads::detail::thread_function_nullary<decltype(func)>{func};
+        hpx::error_code ec;
+
+        for (std::uint64_t i = 0; i < count; ++i)
+        {
+            auto init = hpx::threads::thread_init_data(
+                hpx::threads::thread_function_type(thread_func), desc, prio,
+                hint, stack_size, hpx::threads::thread_schedule_state::pending,
+                false, sched);
+            sched->create_thread(init, nullptr, ec);
+        }
+        l.wait();
+    });
 }
 
 void measure_function_futures_create_thread_hierarchical_placement(
     std::uint64_t count, bool csv)
 {
-    hpx::latch l(count);
-
     auto sched = hpx::threads::get_self_id_data()->get_scheduler_base();
 
     if (std::string("core-shared_priority_queue_scheduler") ==
@@ -388,93 +399,90 @@ void measure_function_futures_create_thread_hierarchical_placement(
                 hpx::threads::policies::scheduler_mode::
                     steal_high_priority_first);
     }
-    auto const func = [&l]() {
-        null_function();
-        l.count_down(1);
-    };
-    auto const thread_func =
-        hpx::threads::detail::thread_function_nullary<decltype(func)>{func};
     auto const desc = hpx::util::thread_description();
     auto prio = hpx::threads::thread_priority::normal;
     auto const stack_size = hpx::threads::thread_stacksize::small_;
     auto const num_threads = hpx::get_num_worker_threads();
-    hpx::error_code ec;
 
-    // start the clock
-    high_resolution_timer walltime;
-    for (std::size_t t = 0; t < num_threads; ++t)
-    {
-        auto const hint =
-            hpx::threads::thread_schedule_hint(static_cast<std::int16_t>(t));
-        auto spawn_func = [&thread_func, sched, hint, t, count, num_threads,
-                              desc, prio]() {
-            std::uint64_t const count_start = t * count / num_threads;
-            std::uint64_t const count_end = (t + 1) * count / num_threads;
-            hpx::error_code ec;
-            for (std::uint64_t i = count_start; i < count_end; ++i)
-            {
-                hpx::threads::thread_init_data init(
-                    hpx::threads::thread_function_type(thread_func), desc, prio,
-                    hint, stack_size,
-                    hpx::threads::thread_schedule_state::pending, false, sched);
-                sched->create_thread(init, nullptr, ec);
-            }
+    report("create_thread_hierarchical", "latch", "none", count, csv, [&]() {
+        hpx::latch l(count);
+
+        auto const func = [&l]() {
+            null_function();
+            l.count_down(1);
         };
-        auto const thread_spawn_func =
-            hpx::threads::detail::thread_function_nullary<decltype(spawn_func)>{
-                spawn_func};
-
-        hpx::threads::thread_init_data init(
-            hpx::threads::thread_function_type(thread_spawn_func), desc, prio,
-            hint, stack_size, hpx::threads::thread_schedule_state::pending,
-            false, sched);
-        sched->create_thread(init, nullptr, ec);
-    }
-    l.wait();
+        auto const thread_func =
+            hpx::threads::detail::thread_function_nullary<decltype(func)>{func};
+        hpx::error_code ec;
 
-    // stop the clock
-    const double duration = walltime.elapsed();
-    print_stats(
-        "create_thread_hierarchical", "latch", "none", count, duration, csv);
+        for (std::size_t t = 0; t < num_threads; ++t)
+        {
+            auto const hint = hpx::threads::thread_schedule_hint(
+                static_cast<std::int16_t>(t));
+            auto spawn_func = [&thread_func, sched, hint, t, count,
+                                  num_threads, desc, prio]() {
+                std::uint64_t const count_start = t * count / num_threads;
+                std::uint64_t const count_end = (t + 1) * count / num_threads;
+                hpx::error_code ec;
+                for (std::uint64_t i = count_start; i < count_end; ++i)
+                {
+                    hpx::threads::thread_init_data init(
+                        hpx::threads::thread_function_type(thread_func), desc,
+                        prio, hint, stack_size,
+                        hpx::threads::thread_schedule_state::pending, false,
+                        sched);
+                    sched->create_thread(init, nullptr, ec);
+                }
+            };
+            auto const thread_spawn_func =
+                hpx::threads::detail::thread_function_nullary<
+                    decltype(spawn_func)>{spawn_func};
+
+            hpx::threads::thread_init_data init(
+                hpx::threads::thread_function_type(thread_spawn_func), desc,
+                prio, hint, stack_size,
+                hpx::threads::thread_schedule_state::pending, false, sched);
+            sched->create_thread(init, nullptr, ec);
+        }
+        l.wait();
+    });
 }
 
 void measure_function_futures_apply_hierarchical_placement(
     std::uint64_t count, bool csv)
 {
-    hpx::latch l(count);
-
-    auto const func = [&l]() {
-        null_function();
-        l.count_down(1);
-    };
     auto const num_threads = hpx::get_num_worker_threads();
 
-    // start the clock
-    high_resolution_timer walltime;
-    for (std::size_t t = 0; t < num_threads; ++t)
-    {
-        auto const hint =
-            hpx::threads::thread_schedule_hint(static_cast<std::int16_t>(t));
-        auto spawn_func = [&func, hint, t, count, num_threads]() {
-            auto exec = hpx::execution::parallel_executor(hint);
-            std::uint64_t const count_start = t * count / num_threads;
-            std::uint64_t const count_end = (t + 1) * count / num_threads;
-
-            for (std::uint64_t i = count_start; i < count_end; ++i)
-            {
-                hpx::apply(exec, func);
-            }
-        };
+    report("apply_hierarchical", "latch", "parallel_executor", count, csv,
+        [&]() {
+            hpx::latch l(count);
 
-        auto exec = hpx::execution::parallel_executor(hint);
-        hpx::apply(exec, spawn_func);
-    }
-    l.wait();
+            auto const func = [&l]() {
+                null_function();
+                l.count_down(1);
+            };
 
-    // stop the clock
-    const double duration = walltime.elapsed();
-    print_stats("apply_hierarchical", "latch", "parallel_executor", count,
-        duration, csv);
+            for (std::size_t t = 0; t < num_threads; ++t)
+            {
+                auto const hint = hpx::threads::thread_schedule_hint(
+                    static_cast<std::int16_t>(t));
+                auto spawn_func = [&func, hint, t, count, num_threads]() {
+                    auto exec = hpx::execution::parallel_executor(hint);
+                    std::uint64_t const count_start = t * count / num_threads;
+                    std::uint64_t const count_end =
+                        (t + 1) * count / num_threads;
+
+                    for (std::uint64_t i = count_start; i < count_end; ++i)
+                    {
+                        hpx::apply(exec, func);
+                    }
+                };
+
+                auto exec = hpx::execution::parallel_executor(hint);
+                hpx::apply(exec, spawn_func);
+            }
+            l.wait();
+        });
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -490,7 +498,10 @@ int hpx_main(variables_map& vm)
             numa_sensitive = 0;
 
         bool test_all = (vm.count("test-all") > 0);
-        const int repetitions = vm["repetitions"].as<int>();
+        const int reps = vm["repetitions"].as<int>();
+        if (HPX_UNLIKELY(reps <= 0))
+            throw std::logic_error("error: repetitions must be positive\n");
+        repetitions = static_cast<std::size_t>(reps);
 
         if (vm.count("info"))
             info_string = vm["info"].as<std::string>();
@@ -512,29 +523,35 @@ int hpx_main(variables_map& vm)
             hpx::execution::experimental::thread_pool_scheduler>
             sched_exec_tps;
 
-        for (int i = 0; i < repetitions; i++)
+        hpx::util::perftests_init(vm, "future_overhead");
+
+        // every benchmark is repeated (at most) the given number of times
+        measure_function_futures_create_thread_hierarchical_placement(
+            count, csv);
+        if (test_all)
         {
-            measure_function_futures_create_thread_hierarchical_placement(
-                count, csv);
-            if (test_all)
-            {
-                measure_function_futures_limiting_executor(count, csv, par);
+            measure_function_futures_limiting_executor(count, csv, par);
 #if defined(HPX_HAVE_DISTRIBUTED_RUNTIME) && !defined(HPX_COMPUTE_DEVICE_CODE)
-                measure_action_futures_wait_each(count, csv);
-                measure_action_futures_wait_all(count, csv);
+            measure_action_futures_wait_each(count, csv);
+            measure_action_futures_wait_all(count, csv);
 #endif
-                measure_function_futures_wait_each(count, csv, par);
-                measure_function_futures_wait_all(count, csv, par);
-                measure_function_futures_sliding_semaphore(count, csv, par);
-                measure_function_futures_for_loop(count, csv, par);
-                measure_function_futures_for_loop(count, csv, sched_exec_tps);
-                measure_function_futures_for_loop(
-                    count, csv, par_nostack, "parallel_executor_nostack");
-                measure_function_futures_register_work(count, csv);
-                measure_function_futures_create_thread(count, csv);
-                measure_function_futures_apply_hierarchical_placement(
-                    count, csv);
-            }
+            measure_function_futures_wait_each(count, csv, par);
+            measure_function_futures_wait_all(count, csv, par);
+            measure_ready_futures(count, csv);
+            measure_function_futures_sliding_semaphore(count, csv, par);
+            measure_function_futures_for_loop(count, csv, par);
+            measure_function_futures_for_loop(count, csv, sched_exec_tps);
+            measure_function_futures_for_loop(
+                count, csv, par_nostack, "parallel_executor_nostack");
+            measure_function_futures_register_work(count, csv);
+            measure_function_futures_create_thread(count, csv);
+            measure_function_futures_apply_hierarchical_placement(count, csv);
+        }
+
+        // the human readable and the csv output are printed to std::cout
+        if (vm.count("perftests-output"))
+        {
+            hpx::util::perftests_print_times();
         }
     }
 
@@ -558,12 +575,14 @@ int main(int argc, char* argv[])
         ("csv", "output results as csv (format: count,duration)")
         ("test-all", "run all benchmarks")
         ("repetitions", value<int>()->default_value(1),
-         "number of repetitions of the full benchmark")
+         "maximal number of repetitions of each benchmark")
 
         ("info", value<std::string>()->default_value("no-info"),
          "extra info for plot output (e.g. branch name)");
     // clang-format on
 
+    hpx::util::perftests_cfg(cmdline);
+
     // Initialize and run HPX.
     hpx::init_params init_args;
     init_args.desc_cmdline = cmdline;
@@ -0,0 +1,280 @@
+////////////////////////////////////////////////////////////////////////////////
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+////////////////////////////////////////////////////////////////////////////////
+
+// This benchmark measures the per-operation cost of the queue backends usable
+// as the QueuingPolicy of the HPX thread queues. Each OS-thread operates on
+// its own queue, i.e. the numbers show the uncontended cost of pushing,
+// popping at the local end, and stealing from the other end.
+
+#include <hpx/concurrency/barrier.hpp>
+#include <hpx/modules/format.hpp>
+#include <hpx/modules/program_options.hpp>
+#include <hpx/modules/schedulers.hpp>
+#include <hpx/modules/timing.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <ctime>
+#include <functional>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+char const* benchmark_name = "Serial Queue Backend Overhead";
+
+using hpx::program_options::command_line_parser;
+using hpx::program_options::notify;
+using hpx::program_options::options_description;
+using hpx::program_options::store;
+using hpx::program_options::value;
+using hpx::program_options::variables_map;
+
+using hpx::chrono::high_resolution_timer;
+
+///////////////////////////////////////////////////////////////////////////////
+std::uint64_t threads = 1;
+std::uint64_t blocksize = 10000;
+std::uint64_t iterations = 2000000;
+bool header = true;
+
+///////////////////////////////////////////////////////////////////////////////
+// push, local pop, and steal time of one backend
+struct elapsed_times
+{
+    double push = 0.0;
+    double pop = 0.0;
+    double steal = 0.0;
+};
+
+struct backend_results
+{
+    char const* name;
+    std::vector<elapsed_times> elapsed;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+std::string format_build_date()
+{
+    std::chrono::time_point<std::chrono::system_clock> now =
+        std::chrono::system_clock::now();
+
+    std::time_t current_time = std::chrono::system_clock::to_time_t(now);
+
+    std::string ts = std::ctime(&current_time);
+    ts.resize(ts.size() - 1);    // remove trailing '\n'
+    return ts;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void print_results(std::vector<backend_results> const& results)
+{
+    if (header)
+    {
+        std::cout << "# BENCHMARK: " << benchmark_name << "\n";
+
+        std::cout << "# VERSION: " << format_build_date() << "\n"
+                  << "#\n";
+
+        std::cout
+            << "## 0:ITER:Iterations per OS-thread - Independent Variable\n"
+               "## 1:BSIZE:Maximum Queue Depth - Independent Variable\n"
+               "## 2:OSTHRDS:OS-thread - Independent Variable\n";
+
+        std::size_t field = 3;
+        for (backend_results const& r : results)
+        {
+            hpx::util::format_to(std::cout,
+                "## {}:WTIME_PUSH:Total Walltime/Push for {} [nanoseconds]\n"
+                "## {}:WTIME_POP:Total Walltime/Pop for {} [nanoseconds]\n"
+                "## {}:WTIME_STEAL:Total Walltime/Steal for {} "
+                "[nanoseconds]\n",
+                field, r.name, field + 1, r.name, field + 2, r.name);
+            field += 3;
+        }
+    }
+
+    double const divisor = iterations != 0 ? double(threads * iterations) : 1.0;
+
+    hpx::util::format_to(std::cout, "{} {} {}", iterations, blocksize, threads);
+    for (backend_results const& r : results)
+    {
+        elapsed_times total;
+        for (elapsed_times const& e : r.elapsed)
+        {
+            total.push += e.push;
+            total.pop += e.pop;
+            total.steal += e.steal;
+        }
+
+        hpx::util::format_to(std::cout, " {:.14g} {:.14g} {:.14g}",
+            (total.push / divisor) * 1e9, (total.pop / divisor) * 1e9,
+            (total.steal / divisor) * 1e9);
+    }
+    std::cout << "\n";
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename Queue>
+void fill_queue(
+    Queue& queue, typename Queue::value_type& seed, double& elapsed_push)
+{
+    high_resolution_timer t;
+
+    for (std::uint64_t i = 0; i < blocksize; ++i)
+    {
+        queue.push(seed);
+    }
+
+    elapsed_push += t.elapsed();
+}
+
+template <typename Queue>
+void drain_queue(Queue& queue, bool steal, double& elapsed_pop)
+{
+    typename Queue::value_type val;
+
+    high_resolution_timer t;
+
+    for (std::uint64_t i = 0; i < blocksize; ++i)
+    {
+        queue.pop(val, steal);
+    }
+
+    elapsed_pop += t.elapsed();
+}
+
+template <typename Queue>
+elapsed_times bench_queue(Queue& queue, std::uint64_t local_iterations)
+{
+    typename Queue::value_type seed = nullptr;
+    elapsed_times elapsed;
+
+    for (std::uint64_t block = 0; block < (local_iterations / blocksize);
+         ++block)
+    {
+        // measure pushing followed by popping at the local end
+        fill_queue(queue, seed, elapsed.push);
+        drain_queue(queue, false, elapsed.pop);
+
+        // measure stealing, the push time is accounted for above
+        double ignored = 0.0;
+        fill_queue(queue, seed, ignored);
+        drain_queue(queue, true, elapsed.steal);
+    }
+
+    return elapsed;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename QueuingPolicy>
+void perform_iterations(hpx::util::barrier& b, elapsed_times& elapsed)
+{
+    using queue_type =
+        typename QueuingPolicy::template apply<std::uint64_t*>::type;
+
+    queue_type queue(blocksize);
+
+    // Warmup.
+    bench_queue(queue, blocksize);
+
+    // all threads start measuring at the same time
+    b.wait();
+
+    elapsed = bench_queue(queue, iterations);
+}
+
+template <typename QueuingPolicy>
+void run_backend(char const* name, std::vector<backend_results>& results)
+{
+    backend_results r{name, std::vector<elapsed_times>(threads)};
+
+    std::vector<std::thread> workers;
+    hpx::util::barrier b(threads);
+
+    for (std::uint64_t i = 0; i != threads; ++i)
+    {
+        workers.push_back(std::thread(perform_iterations<QueuingPolicy>,
+            std::ref(b), std::ref(r.elapsed[i])));
+    }
+
+    for (std::thread& thread : workers)
+    {
+        if (thread.joinable())
+            thread.join();
+    }
+
+    results.push_back(HPX_MOVE(r));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int app_main(variables_map&)
+{
+    using namespace hpx::threads::policies;
+
+    std::vector<backend_results> results;
+
+    run_backend<lockfree_fifo>("lockfree_fifo", results);
+    run_backend<concurrentqueue_fifo>("concurrentqueue_fifo", results);
+#if defined(HPX_HAVE_CXX11_STD_ATOMIC_128BIT)
+    run_backend<lockfree_lifo>("lockfree_lifo", results);
+    run_backend<lockfree_abp_fifo>("lockfree_abp_fifo", results);
+    run_backend<lockfree_abp_lifo>("lockfree_abp_lifo", results);
+#endif
+    run_backend<chase_lev_lifo>("chase_lev_lifo", results);
+
+    // Print out the results.
+    print_results(results);
+
+    return 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main(int argc, char* argv[])
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // Parse command line.
+    variables_map vm;
+
+    options_description cmdline("Usage: queue_backends_overhead [options]");
+
+    // clang-format off
+    cmdline.add_options()
+        ("help,h", "print out program usage (this message)")
+        ("threads,t", value<std::uint64_t>(&threads)->default_value(1),
+         "number of threads to use")
+        ("iterations",
+         value<std::uint64_t>(&iterations)->default_value(2000000),
+         "number of iterations to perform (most be divisible by block size)")
+        ("blocksize", value<std::uint64_t>(&blocksize)->default_value(10000),
+         "size of each block")
+        ("no-header", "do not print out the header");
+    // clang-format on
+
+    store(command_line_parser(argc, argv).options(cmdline).run(), vm);
+
+    notify(vm);
+
+    // Print help screen.
+    if (vm.count("help"))
+    {
+        std::cout << cmdline;
+        return 0;
+    }
+
+    if (iterations % blocksize)
+        throw std::invalid_argument(
+            "iterations must be cleanly divisible by blocksize\n");
+
+    if (vm.count("no-header"))
+        header = false;
+
+    return app_main(vm);
+}
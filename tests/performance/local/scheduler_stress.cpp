@@ -0,0 +1,546 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark runs a set of workloads stressing the scheduler with every
+// scheduling policy (the runtime is restarted for each of them):
+//
+//  fan_out     a tree of tasks, every task spawns --fan-out children and
+//              waits for them
+//  chain       every task spawns its successor, only a single task is ready
+//              to run at any time
+//  dag         a layered graph of tasks, every task depends on two tasks of
+//              the previous layer, a few of the tasks are much longer than
+//              the others
+//  timed_wait  all tasks sleep for --sleep microseconds at the same time
+//  channel     pairs of producers and consumers exchanging values through
+//              a shared channel
+//
+// For every scheduler and workload the throughput (based on the median of
+// the timings of the workload), the latency between a task being created and
+// the task starting to run (50th and 99th percentile, for the timed waits
+// the time a task is woken up too late, for the channels the time between
+// sending and receiving a value) and the number of tasks stolen between
+// worker threads is reported. The latencies and the steal counts are
+// measured in a separate run of the workloads, the steal counts are only
+// available if HPX was configured with HPX_WITH_THREAD_STEALING_COUNTS=ON.
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/local/channel.hpp>
+#include <hpx/local/chrono.hpp>
+#include <hpx/local/future.hpp>
+#include <hpx/local/init.hpp>
+#include <hpx/local/latch.hpp>
+#include <hpx/local/runtime.hpp>
+#include <hpx/local/thread.hpp>
+#include <hpx/modules/format.hpp>
+#include <hpx/modules/program_options.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/threading_base/thread_pool_base.hpp>
+#include <hpx/type_support/unused.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "worker_timed.hpp"
+
+///////////////////////////////////////////////////////////////////////////////
+std::uint64_t num_tasks = 50000;
+std::uint64_t delay_ns = 0;
+std::uint64_t dag_delay_ns = 1000;
+std::uint64_t fan_out = 8;
+std::uint64_t sleep_us = 10;
+std::size_t repetitions = 10;
+bool csv = false;
+
+// all scheduling policies, in the order of hpx::resource::scheduling_policy
+char const* const schedulers[] = {"local", "local-priority-fifo",
+    "local-priority-lifo", "static", "static-priority", "abp-priority-fifo",
+    "abp-priority-lifo", "shared-priority", "local-workrequesting-fifo",
+    "local-workrequesting-lifo"};
+
+char const* const workloads[] = {
+    "fan_out", "chain", "dag", "timed_wait", "channel"};
+
+///////////////////////////////////////////////////////////////////////////////
+// The latencies are only recorded during the dedicated latency run, every
+// worker thread records them into its own buffer.
+struct alignas(64) latency_buffer
+{
+    std::vector<std::uint64_t> samples;
+};
+
+std::vector<latency_buffer> latencies;
+bool record_latencies = false;
+
+std::uint64_t now() noexcept
+{
+    return hpx::chrono::high_resolution_clock::now();
+}
+
+std::uint64_t timestamp() noexcept
+{
+    return record_latencies ? now() : 0;
+}
+
+void record_latency(std::uint64_t latency_ns)
+{
+    if (record_latencies)
+    {
+        std::size_t const thread_num = hpx::get_worker_thread_num();
+        latencies[thread_num % latencies.size()].samples.push_back(
+            latency_ns);
+    }
+}
+
+void record_start(std::uint64_t created)
+{
+    if (record_latencies)
+        record_latency(now() - created);
+}
+
+// Run the function as a new task, recording the time it took to start it
+template <typename F>
+hpx::future<void> async_task(F&& f)
+{
+    return hpx::async([created = timestamp(), f = HPX_FORWARD(F, f)]() {
+        record_start(created);
+        f();
+    });
+}
+
+template <typename F>
+void apply_task(F&& f)
+{
+    hpx::apply([created = timestamp(), f = HPX_FORWARD(F, f)]() {
+        record_start(created);
+        f();
+    });
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void fan_out_task(std::uint64_t tasks)
+{
+    worker_timed(delay_ns);
+
+    std::uint64_t const remaining = tasks - 1;
+    if (remaining == 0)
+        return;
+
+    std::uint64_t const children = (std::min)(fan_out, remaining);
+    std::vector<hpx::future<void>> futures;
+    futures.reserve(children);
+    for (std::uint64_t i = 0; i != children; ++i)
+    {
+        std::uint64_t const n =
+            remaining / children + (i < remaining % children ? 1 : 0);
+        futures.push_back(async_task([n]() { fan_out_task(n); }));
+    }
+    hpx::wait_all(futures);
+}
+
+void run_fan_out()
+{
+    async_task([]() { fan_out_task(num_tasks); }).get();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void chain_task(std::uint64_t remaining, hpx::latch& done)
+{
+    worker_timed(delay_ns);
+
+    if (remaining == 1)
+    {
+        done.count_down(1);
+        return;
+    }
+    apply_task([remaining, &done]() { chain_task(remaining - 1, done); });
+}
+
+void run_chain()
+{
+    hpx::latch done(1);
+    apply_task([&done]() { chain_task(num_tasks, done); });
+    done.wait();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Task (l, i) of the graph depends on the tasks (l - 1, i) and
+// (l - 1, (i + 1) % width), one in 16 tasks is 32 times longer than the
+// others.
+struct dag
+{
+    dag(std::size_t num_columns, std::size_t num_layers)
+      : width(num_columns)
+      , layers(num_layers)
+      , pending(num_columns * num_layers)
+      , done(static_cast<std::ptrdiff_t>(num_columns))
+    {
+        for (std::size_t node = 0; node != pending.size(); ++node)
+        {
+            pending[node].store(
+                node < width ? 0 : 2, std::memory_order_relaxed);
+        }
+    }
+
+    std::size_t width;
+    std::size_t layers;
+    std::vector<std::atomic<int>> pending;
+    hpx::latch done;
+};
+
+std::uint64_t dag_weight(std::size_t node) noexcept
+{
+    return (node * 2654435761u) % 16 == 0 ? 32 : 1;
+}
+
+void dag_task(dag& d, std::size_t node)
+{
+    worker_timed(dag_weight(node) * dag_delay_ns);
+
+    std::size_t const layer = node / d.width;
+    if (layer + 1 == d.layers)
+    {
+        d.done.count_down(1);
+        return;
+    }
+
+    std::size_t const i = node % d.width;
+    std::size_t const next = (layer + 1) * d.width;
+    std::size_t const successors[] = {
+        next + i, next + (i + d.width - 1) % d.width};
+    for (std::size_t successor : successors)
+    {
+        if (d.pending[successor].fetch_sub(1, std::memory_order_acq_rel) == 1)
+        {
+            apply_task([&d, successor]() { dag_task(d, successor); });
+        }
+    }
+}
+
+void run_dag()
+{
+    std::size_t const width =
+        (std::max)(std::size_t(2), 4 * hpx::get_num_worker_threads());
+    std::size_t const layers =
+        (std::max)(std::size_t(1), std::size_t(num_tasks / width));
+
+    dag d(width, layers);
+    for (std::size_t node = 0; node != width; ++node)
+    {
+        apply_task([&d, node]() { dag_task(d, node); });
+    }
+    d.done.wait();
+}
+
+std::uint64_t dag_tasks()
+{
+    std::size_t const width =
+        (std::max)(std::size_t(2), 4 * hpx::get_num_worker_threads());
+    return width * (std::max)(std::size_t(1), std::size_t(num_tasks / width));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// The latency of a timed wait is the time the task is woken up too late
+void run_timed_wait()
+{
+    std::uint64_t const tasks = (std::max)(std::uint64_t(1), num_tasks / 10);
+
+    std::vector<hpx::future<void>> futures;
+    futures.reserve(tasks);
+    for (std::uint64_t i = 0; i != tasks; ++i)
+    {
+        futures.push_back(hpx::async([]() {
+            std::uint64_t const start = now();
+            hpx::this_thread::sleep_for(std::chrono::microseconds(sleep_us));
+            std::uint64_t const elapsed = now() - start;
+            std::uint64_t const requested = sleep_us * 1000;
+            record_latency(elapsed > requested ? elapsed - requested : 0);
+        }));
+    }
+    hpx::wait_all(futures);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// The values sent through the channel are the times they were sent at
+std::size_t num_channel_pairs()
+{
+    return (std::max)(std::size_t(1), hpx::get_num_worker_threads() / 2);
+}
+
+void run_channel()
+{
+    std::size_t const pairs = num_channel_pairs();
+    std::uint64_t const values =
+        (std::max)(std::uint64_t(1), num_tasks / pairs);
+
+    hpx::lcos::local::channel<std::uint64_t> channel;
+
+    std::vector<hpx::future<void>> futures;
+    futures.reserve(2 * pairs);
+    for (std::size_t i = 0; i != pairs; ++i)
+    {
+        futures.push_back(hpx::async([&channel, values]() {
+            for (std::uint64_t j = 0; j != values; ++j)
+            {
+                std::uint64_t const sent = channel.get().get();
+                if (record_latencies)
+                    record_latency(now() - sent);
+            }
+        }));
+    }
+    for (std::size_t i = 0; i != pairs; ++i)
+    {
+        futures.push_back(hpx::async([&channel, values]() {
+            for (std::uint64_t j = 0; j != values; ++j)
+            {
+                worker_timed(delay_ns);
+                channel.set(timestamp());
+            }
+        }));
+    }
+    hpx::wait_all(futures);
+}
+
+std::uint64_t channel_tasks()
+{
+    std::size_t const pairs = num_channel_pairs();
+    return pairs * (std::max)(std::uint64_t(1), num_tasks / pairs);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::int64_t get_steal_count(bool reset)
+{
+#if defined(HPX_HAVE_THREAD_STEALING_COUNTS)
+    hpx::threads::thread_pool_base* pool = hpx::this_thread::get_pool();
+    return pool->get_num_stolen_from_pending(std::size_t(-1), reset) +
+        pool->get_num_stolen_from_staged(std::size_t(-1), reset);
+#else
+    HPX_UNUSED(reset);
+    return -1;
+#endif
+}
+
+struct workload_result
+{
+    std::uint64_t tasks = 0;
+    double median = 0.0;
+    double latency_p50 = 0.0;
+    double latency_p99 = 0.0;
+    std::int64_t steals = -1;
+};
+
+// returns the given percentile of the samples [us]
+double percentile(std::vector<std::uint64_t>& samples, double p)
+{
+    if (samples.empty())
+        return 0.0;
+
+    std::size_t const rank = (std::min)(samples.size() - 1,
+        static_cast<std::size_t>(p * static_cast<double>(samples.size())));
+    std::nth_element(samples.begin(), samples.begin() + rank, samples.end());
+    return static_cast<double>(samples[rank]) * 1e-3;
+}
+
+template <typename F>
+workload_result run_workload(char const* scheduler, char const* workload,
+    std::uint64_t tasks, F&& f)
+{
+    workload_result result;
+    result.tasks = tasks;
+    result.median = hpx::util::perftests_report(
+        std::string("scheduler stress - ") + workload, scheduler, repetitions,
+        f)
+                        .median;
+
+    // latency run
+    latencies.assign(hpx::get_num_worker_threads(), latency_buffer());
+    get_steal_count(true);
+    record_latencies = true;
+    f();
+    record_latencies = false;
+    result.steals = get_steal_count(true);
+
+    std::vector<std::uint64_t> samples;
+    for (latency_buffer& buffer : latencies)
+    {
+        samples.insert(
+            samples.end(), buffer.samples.begin(), buffer.samples.end());
+    }
+    latencies.clear();
+
+    result.latency_p50 = percentile(samples, 0.50);
+    result.latency_p99 = percentile(samples, 0.99);
+    return result;
+}
+
+void print_result(char const* scheduler, char const* workload,
+    workload_result const& result)
+{
+    double const throughput = result.median > 0.0 ?
+        static_cast<double>(result.tasks) / result.median :
+        0.0;
+    std::string const steals =
+        result.steals < 0 ? std::string("n/a") : std::to_string(result.steals);
+
+    if (csv)
+    {
+        hpx::util::format_to(std::cout, "{},{},{},{},{},{},{},{},{}\n",
+            scheduler, workload, hpx::get_num_worker_threads(), result.tasks,
+            result.median, throughput, result.latency_p50,
+            result.latency_p99, steals);
+    }
+    else
+    {
+        hpx::util::format_to(std::cout,
+            "{:25} {:10} {:8} tasks in {:10.6} [s], {:12.0} [tasks/s], "
+            "latency p50 {:10.3} [us], p99 {:10.3} [us], steals {}\n",
+            scheduler, workload, result.tasks, result.median, throughput,
+            result.latency_p50, result.latency_p99, steals);
+    }
+}
+
+bool selected(std::string const& list, std::string const& name)
+{
+    if (list == "all")
+        return true;
+
+    std::string::size_type start = 0;
+    while (start <= list.size())
+    {
+        std::string::size_type end = list.find(',', start);
+        if (end == std::string::npos)
+            end = list.size();
+        if (list.compare(start, end - start, name) == 0)
+            return true;
+        start = end + 1;
+    }
+    return false;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm, char const* scheduler)
+{
+    hpx::util::perftests_init(vm, "scheduler_stress");
+
+    std::string const selected_workloads = vm["workloads"].as<std::string>();
+    for (char const* workload : workloads)
+    {
+        if (!selected(selected_workloads, workload))
+            continue;
+
+        std::string const name = workload;
+        workload_result result;
+        if (name == "fan_out")
+        {
+            result = run_workload(scheduler, workload, num_tasks, &run_fan_out);
+        }
+        else if (name == "chain")
+        {
+            result = run_workload(scheduler, workload, num_tasks, &run_chain);
+        }
+        else if (name == "dag")
+        {
+            result = run_workload(scheduler, workload, dag_tasks(), &run_dag);
+        }
+        else if (name == "timed_wait")
+        {
+            result = run_workload(scheduler, workload,
+                (std::max)(std::uint64_t(1), num_tasks / 10), &run_timed_wait);
+        }
+        else
+        {
+            result = run_workload(
+                scheduler, workload, channel_tasks(), &run_channel);
+        }
+        print_result(scheduler, workload, result);
+    }
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    using namespace hpx::program_options;
+
+    options_description cmdline("usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    cmdline.add_options()
+        ("schedulers", value<std::string>()->default_value("all"),
+         "comma separated list of the schedulers to run the benchmarks with "
+         "(default: all)")
+        ("workloads", value<std::string>()->default_value("all"),
+         "comma separated list of the workloads to run, possible values: "
+         "fan_out, chain, dag, timed_wait, channel (default: all)")
+        ("tasks", value<std::uint64_t>(&num_tasks)->default_value(50000),
+         "number of tasks created by a workload (default: 50000)")
+        ("delay", value<std::uint64_t>(&delay_ns)->default_value(0),
+         "time spent in the delay loop of a task [ns] (default: 0)")
+        ("dag-delay", value<std::uint64_t>(&dag_delay_ns)->default_value(1000),
+         "time spent in the delay loop of a short task of the dag workload "
+         "[ns] (default: 1000)")
+        ("fan-out", value<std::uint64_t>(&fan_out)->default_value(8),
+         "number of children of a task of the fan_out workload (default: 8)")
+        ("sleep", value<std::uint64_t>(&sleep_us)->default_value(10),
+         "time a task of the timed_wait workload sleeps [us] (default: 10)")
+        ("repetitions", value<std::size_t>(&repetitions)->default_value(10),
+         "maximal number of times each workload is timed (default: 10)")
+        ("csv", "output results as csv (format: scheduler,workload,threads,"
+         "tasks,median,throughput,latency_p50,latency_p99,steals)")
+        ;
+    // clang-format on
+
+    hpx::util::perftests_cfg(cmdline);
+
+    variables_map vm;
+    store(command_line_parser(argc, argv)
+              .allow_unregistered()
+              .options(cmdline)
+              .run(),
+        vm);
+    notify(vm);
+
+    csv = vm.count("csv") != 0;
+    if (num_tasks == 0 || fan_out == 0)
+    {
+        std::cerr << "scheduler_stress: the number of tasks and the fan out "
+                     "have to be positive\n";
+        return 1;
+    }
+
+    std::string const selected_schedulers = vm["schedulers"].as<std::string>();
+    for (char const* scheduler : schedulers)
+    {
+        if (!selected(selected_schedulers, scheduler))
+            continue;
+
+        hpx::local::init_params init_args;
+        init_args.desc_cmdline = cmdline;
+        init_args.cfg = {std::string("hpx.scheduler=") + scheduler};
+
+        int const result = hpx::local::init(
+            [scheduler](variables_map& args) {
+                return hpx_main(args, scheduler);
+            },
+            argc, argv, init_args);
+        if (result != 0)
+            return result;
+    }
+
+    if (vm.count("perftests-output"))
+    {
+        hpx::util::perftests_print_times();
+    }
+    return 0;
+}
+#endif
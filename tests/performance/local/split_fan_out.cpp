@@ -0,0 +1,153 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark measures the overhead of broadcasting the result of a single
+// computation to many consumers, once using split and once using
+// shared_future. All consumers are attached before the computation finishes.
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/local/execution.hpp>
+#include <hpx/local/future.hpp>
+#include <hpx/local/init.hpp>
+#include <hpx/local/latch.hpp>
+#include <hpx/modules/format.hpp>
+#include <hpx/modules/program_options.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/modules/timing.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <utility>
+#include <vector>
+
+namespace ex = hpx::execution::experimental;
+
+///////////////////////////////////////////////////////////////////////////////
+double compute(std::size_t delay)
+{
+    double result = 0.0;
+    for (std::size_t i = 0; i != delay; ++i)
+    {
+        result += 1.0 / double(i + 1);
+    }
+    return result;
+}
+
+double fan_out_split(
+    std::size_t num_samples, std::size_t num_consumers, std::size_t delay)
+{
+    ex::thread_pool_scheduler sched;
+    std::atomic<std::uint64_t> count{0};
+
+    hpx::chrono::high_resolution_timer t;
+    for (std::size_t k = 0; k != num_samples; ++k)
+    {
+        hpx::latch l(static_cast<std::ptrdiff_t>(num_consumers + 1));
+
+        auto s = ex::schedule(sched) |
+            ex::then([delay]() { return compute(delay); }) | ex::split();
+
+        for (std::size_t i = 0; i != num_consumers; ++i)
+        {
+            ex::start_detached(s | ex::then([&](double) {
+                ++count;
+                l.count_down(1);
+            }));
+        }
+
+        l.arrive_and_wait();
+    }
+    double const elapsed = t.elapsed();
+
+    HPX_TEST_EQ(count.load(), std::uint64_t(num_samples * num_consumers));
+    return elapsed / double(num_samples);
+}
+
+double fan_out_shared_future(
+    std::size_t num_samples, std::size_t num_consumers, std::size_t delay)
+{
+    std::atomic<std::uint64_t> count{0};
+
+    hpx::chrono::high_resolution_timer t;
+    for (std::size_t k = 0; k != num_samples; ++k)
+    {
+        hpx::shared_future<double> f =
+            hpx::async([delay]() { return compute(delay); });
+
+        std::vector<hpx::future<void>> consumers;
+        consumers.reserve(num_consumers);
+        for (std::size_t i = 0; i != num_consumers; ++i)
+        {
+            consumers.push_back(f.then(hpx::launch::sync,
+                [&](hpx::shared_future<double>&&) { ++count; }));
+        }
+
+        hpx::wait_all(consumers);
+    }
+    double const elapsed = t.elapsed();
+
+    HPX_TEST_EQ(count.load(), std::uint64_t(num_samples * num_consumers));
+    return elapsed / double(num_samples);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    std::size_t const num_samples = vm["samples"].as<std::size_t>();
+    std::size_t const num_consumers = vm["consumers"].as<std::size_t>();
+    std::size_t const delay = vm["delay"].as<std::size_t>();
+
+    double const elapsed_split =
+        fan_out_split(num_samples, num_consumers, delay);
+    double const elapsed_shared_future =
+        fan_out_shared_future(num_samples, num_consumers, delay);
+
+    if (!vm.count("no-header"))
+    {
+        std::cout << "Consumers,Delay,split[s],shared_future[s]" << std::endl;
+    }
+
+    hpx::util::format_to(std::cout, "{},{},{:.12},{:.12}\n", num_consumers,
+        delay, elapsed_split, elapsed_shared_future)
+        << std::endl;
+
+    hpx::util::print_cdash_timing("SplitFanOut", elapsed_split);
+    hpx::util::print_cdash_timing(
+        "SharedFutureFanOut", elapsed_shared_future);
+
+    return hpx::local::finalize();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main(int argc, char* argv[])
+{
+    namespace po = hpx::program_options;
+
+    // Configure application-specific options.
+    po::options_description cmdline(
+        "usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    cmdline.add_options()
+        ("samples,s", po::value<std::size_t>()->default_value(1000),
+            "number of times the fan out is repeated (default: 1000)")
+        ("consumers,c", po::value<std::size_t>()->default_value(256),
+            "number of consumers of the shared result (default: 256)")
+        ("delay,d", po::value<std::size_t>()->default_value(10000),
+            "number of iterations of the shared computation (default: 10000)")
+        ("no-header,n", "do not print out the csv header row");
+    // clang-format on
+
+    // Initialize and run HPX.
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = cmdline;
+
+    return hpx::local::init(hpx_main, argc, argv, init_args);
+}
+#endif
@@ -23,6 +23,7 @@
 #include <hpx/local/thread.hpp>
 #include <hpx/modules/compute.hpp>
 #include <hpx/modules/format.hpp>
+#include <hpx/modules/testing.hpp>
 #include <hpx/type_support/unused.hpp>
 #include <hpx/version.hpp>
 
@@ -318,9 +319,9 @@ struct triad_step
 
 ///////////////////////////////////////////////////////////////////////////////
 template <typename Allocator, typename Policy>
-std::vector<std::vector<double>> run_benchmark(std::size_t warmup_iterations,
-    std::size_t iterations, std::size_t size, Allocator&& alloc,
-    Policy&& policy)
+std::vector<hpx::util::perftests_statistics> run_benchmark(
+    std::size_t warmup_iterations, std::size_t iterations, std::size_t size,
+    Allocator&& alloc, Policy&& policy, std::string const& exec_name)
 {
     // Allocate our data
     using vector_type = hpx::compute::vector<STREAM_TYPE, Allocator>;
@@ -410,36 +411,39 @@ std::vector<std::vector<double>> run_benchmark(std::size_t warmup_iterations,
     hpx::fill(policy, c.begin(), c.end(), 0.0);
 
     ///////////////////////////////////////////////////////////////////////////
-    // Main timing loop
-    std::vector<std::vector<double>> timing(4, std::vector<double>(iterations));
-    for (std::size_t iteration = 0; iteration != iterations; ++iteration)
-    {
-        // Copy
-        timing[0][iteration] = mysecond();
-        hpx::copy(policy, a.begin(), a.end(), c.begin());
-        timing[0][iteration] = mysecond() - timing[0][iteration];
-
-        // Scale
-        timing[1][iteration] = mysecond();
-        hpx::transform(policy, c.begin(), c.end(), b.begin(),
-            multiply_step<STREAM_TYPE>(scalar));
-        timing[1][iteration] = mysecond() - timing[1][iteration];
-
-        // Add
-        timing[2][iteration] = mysecond();
-        hpx::ranges::transform(policy, a.begin(), a.end(), b.begin(), b.end(),
-            c.begin(), add_step<STREAM_TYPE>());
-        timing[2][iteration] = mysecond() - timing[2][iteration];
-
-        // Triad
-        timing[3][iteration] = mysecond();
-        hpx::ranges::transform(policy, b.begin(), b.end(), c.begin(), c.end(),
-            a.begin(), triad_step<STREAM_TYPE>(scalar));
-        timing[3][iteration] = mysecond() - timing[3][iteration];
-    }
+    // Main timing loop, each kernel is timed on its own. The kernels give the
+    // same result no matter how often they are repeated, the arrays hold the
+    // values of a single iteration of all kernels afterwards.
+    std::vector<hpx::util::perftests_statistics> timing(4);
+
+    // Copy
+    timing[0] = hpx::util::perftests_report("Stream benchmark - Copy",
+        exec_name, iterations,
+        [&]() -> void { hpx::copy(policy, a.begin(), a.end(), c.begin()); });
+
+    // Scale
+    timing[1] = hpx::util::perftests_report("Stream benchmark - Scale",
+        exec_name, iterations, [&]() -> void {
+            hpx::transform(policy, c.begin(), c.end(), b.begin(),
+                multiply_step<STREAM_TYPE>(scalar));
+        });
+
+    // Add
+    timing[2] = hpx::util::perftests_report("Stream benchmark - Add",
+        exec_name, iterations, [&]() -> void {
+            hpx::ranges::transform(policy, a.begin(), a.end(), b.begin(),
+                b.end(), c.begin(), add_step<STREAM_TYPE>());
+        });
+
+    // Triad
+    timing[3] = hpx::util::perftests_report("Stream benchmark - Triad",
+        exec_name, iterations, [&]() -> void {
+            hpx::ranges::transform(policy, b.begin(), b.end(), c.begin(),
+                c.end(), a.begin(), triad_step<STREAM_TYPE>(scalar));
+        });
 
     // Check Results ...
-    check_results(iterations, a, b, c);
+    check_results(1, a, b, c);
 
     if (!csv)
     {
@@ -497,9 +501,10 @@ int hpx_main(hpx::program_options::variables_map& vm)
             << "(= "
                 <<  sizeof(STREAM_TYPE) * (vector_size / 1024. / 1024. / 1024.)
                 << " GiB).\n"
-            << "Each kernel will be executed " << iterations << " times.\n"
-            << " The *best* time for each kernel (excluding the first iteration)\n"
-            << " will be used to compute the reported bandwidth.\n"
+            << "Each kernel will be executed at most " << iterations
+                << " times.\n"
+            << " The *best* time for each kernel (excluding the warmup\n"
+            << " iterations) will be used to compute the reported bandwidth.\n"
             << "-------------------------------------------------------------\n"
             << "Number of Threads requested = "
                 << hpx::get_os_thread_count() << "\n"
@@ -510,15 +515,23 @@ int hpx_main(hpx::program_options::variables_map& vm)
     }
     // clang-format on
 
+    hpx::util::perftests_init(vm, "stream");
+
+    std::size_t const num_executors = 5;
+    const char* executors[num_executors] = {"parallel-serial", "block",
+        "parallel-parallel", "fork_join_executor", "scheduler_executor"};
+    std::string const exec_name =
+        executor < num_executors ? executors[executor] : "";
+
     double time_total = mysecond();
-    std::vector<std::vector<double>> timing;
+    std::vector<hpx::util::perftests_statistics> timing;
 
     {
         if (executor == 0)
         {
             // Default parallel policy with serial allocator.
             timing = run_benchmark<>(warmup_iterations, iterations, vector_size,
-                std::allocator<STREAM_TYPE>{}, hpx::execution::par);
+                std::allocator<STREAM_TYPE>{}, hpx::execution::par, exec_name);
         }
         else if (executor == 1)
         {
@@ -533,7 +546,7 @@ int hpx_main(hpx::program_options::variables_map& vm)
             auto policy = hpx::execution::par.on(exec);
 
             timing = run_benchmark<>(warmup_iterations, iterations, vector_size,
-                std::move(alloc), std::move(policy));
+                std::move(alloc), std::move(policy), exec_name);
         }
         else if (executor == 2)
         {
@@ -544,7 +557,7 @@ int hpx_main(hpx::program_options::variables_map& vm)
                 alloc(policy);
 
             timing = run_benchmark<>(warmup_iterations, iterations, vector_size,
-                std::move(alloc), std::move(policy));
+                std::move(alloc), std::move(policy), exec_name);
         }
         else if (executor == 3)
         {
@@ -559,7 +572,7 @@ int hpx_main(hpx::program_options::variables_map& vm)
                 alloc(policy);
 
             timing = run_benchmark<>(warmup_iterations, iterations, vector_size,
-                std::move(alloc), std::move(policy));
+                std::move(alloc), std::move(policy), exec_name);
         }
         else if (executor == 4)
         {
@@ -575,7 +588,7 @@ int hpx_main(hpx::program_options::variables_map& vm)
                 alloc(policy);
 
             timing = run_benchmark<>(warmup_iterations, iterations, vector_size,
-                std::move(alloc), std::move(policy));
+                std::move(alloc), std::move(policy), exec_name);
         }
         else
         {
@@ -602,28 +615,6 @@ int hpx_main(hpx::program_options::variables_map& vm)
         3 * sizeof(STREAM_TYPE) * static_cast<double>(vector_size),
         3 * sizeof(STREAM_TYPE) * static_cast<double>(vector_size)};
 
-    std::vector<double> avgtime(num_stream_tests, 0.0);
-    std::vector<double> mintime(
-        num_stream_tests, (std::numeric_limits<double>::max)());
-    std::vector<double> maxtime(num_stream_tests, 0.0);
-
-    for (std::size_t j = 0; j < num_stream_tests; j++)
-    {
-        avgtime[j] = timing[j][0];
-        mintime[j] = timing[j][0];
-        maxtime[j] = timing[j][0];
-    }
-
-    for (std::size_t iteration = 1; iteration != iterations; ++iteration)
-    {
-        for (std::size_t j = 0; j < num_stream_tests; j++)
-        {
-            avgtime[j] = avgtime[j] + timing[j][iteration];
-            mintime[j] = (std::min)(mintime[j], timing[j][iteration]);
-            maxtime[j] = (std::max)(maxtime[j], timing[j][iteration]);
-        }
-    }
-
     if (csv)
     {
         if (header)
@@ -634,10 +625,7 @@ int hpx_main(hpx::program_options::variables_map& vm)
                 "max,add_bytes,add_bw,add_avg,add_min,add_max,triad_bytes,"
                 "triad_bw,triad_avg,triad_min,triad_max\n");
         }
-        std::size_t const num_executors = 5;
-        const char* executors[num_executors] = {"parallel-serial", "block",
-            "parallel-parallel", "fork_join_executor", "scheduler_executor"};
-        hpx::util::format_to(std::cout, "{},{},{},", executors[executor],
+        hpx::util::format_to(std::cout, "{},{},{},", exec_name,
             hpx::get_os_thread_count(), vector_size);
     }
     else
@@ -648,27 +636,25 @@ int hpx_main(hpx::program_options::variables_map& vm)
 
     for (std::size_t j = 0; j < num_stream_tests; j++)
     {
-        avgtime[j] = avgtime[j] / (double) (iterations);
-
         if (csv)
         {
             hpx::util::format_to(std::cout, "{:.0},{:.2},{:.9},{:.9},{:.9}{}",
-                bytes[j], 1.0E-06 * bytes[j] / mintime[j], avgtime[j],
-                mintime[j], maxtime[j], j < num_stream_tests - 1 ? "," : "\n");
+                bytes[j], 1.0E-06 * bytes[j] / timing[j].min, timing[j].mean,
+                timing[j].min, timing[j].max,
+                j < num_stream_tests - 1 ? "," : "\n");
         }
         else
         {
             hpx::util::format_to(std::cout,
                 "{}{:12.1}  {:11.6}  {:11.6}  {:11.6}\n", label[j],
-                1.0E-06 * bytes[j] / mintime[j], avgtime[j], mintime[j],
-                maxtime[j]);
+                1.0E-06 * bytes[j] / timing[j].min, timing[j].mean,
+                timing[j].min, timing[j].max);
         }
     }
 
     if (!csv)
     {
-        std::cout << "\nTotal time: " << time_total
-                  << " (per iteration: " << time_total / iterations << ")\n";
+        std::cout << "\nTotal time: " << time_total << "\n";
     }
 
     if (!csv)
@@ -678,6 +664,12 @@ int hpx_main(hpx::program_options::variables_map& vm)
         // clang-format on
     }
 
+    // the human readable and the csv output are printed to std::cout
+    if (vm.count("perftests-output"))
+    {
+        hpx::util::perftests_print_times();
+    }
+
     return hpx::finalize();
 }
 
@@ -699,7 +691,7 @@ int main(int argc, char* argv[])
             "offset (default: 0)")
         (   "iterations",
             hpx::program_options::value<std::size_t>()->default_value(10),
-            "number of iterations to repeat each test. (default: 10)")
+            "maximal number of iterations to repeat each test. (default: 10)")
         (   "warmup_iterations",
             hpx::program_options::value<std::size_t>()->default_value(1),
             "number of warmup iterations to perform before timing. (default: 1)")
@@ -716,6 +708,8 @@ int main(int argc, char* argv[])
         ;
     // clang-format on
 
+    hpx::util::perftests_cfg(cmdline);
+
     // parse command line here to extract the necessary settings for HPX
     parsed_options opts = command_line_parser(argc, argv)
                               .allow_unregistered()
@@ -430,9 +430,9 @@ auto run_benchmark(std::size_t warmup_iterations, std::size_t iterations,
                 c.end(), a.begin(), triad_step<STREAM_TYPE>(scalar));
         });
 
-    // TODO: adapt the check result to work with the new version
-    //// Check Results ...
-    //check_results(iterations, a, b, c);
+    // Check Results, the kernels give the same result no matter how often
+    // they are repeated
+    check_results(1, a, b, c);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -459,6 +459,8 @@ int hpx_main(hpx::program_options::variables_map& vm)
             "Invalid number of iterations given, must be at least 1");
     }
 
+    hpx::util::perftests_init(vm, "stream_report");
+
     {
         {
             // Default parallel policy and allocator with default parallel policy.
@@ -534,6 +536,8 @@ int main(int argc, char* argv[])
         ;
     // clang-format on
 
+    hpx::util::perftests_cfg(cmdline);
+
     // parse command line here to extract the necessary settings for HPX
     parsed_options opts = command_line_parser(argc, argv)
                               .allow_unregistered()
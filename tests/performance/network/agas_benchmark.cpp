@@ -0,0 +1,526 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark drives the AGAS services (primary, symbol, component and
+// locality namespaces) from all localities at once. Each locality runs a
+// configurable number of concurrent HPX threads issuing a fixed number of
+// requests each. The requests of the primary namespace target the instances
+// on the other localities. For every operation the latency percentiles, the
+// overall throughput and the invocation counts and times reported by the
+// AGAS service counters are written to std::cout as JSON.
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/agas/addressing_service.hpp>
+#include <hpx/include/performance_counters.hpp>
+#include <hpx/include/serialization.hpp>
+#include <hpx/modules/format.hpp>
+#include <hpx/modules/timing.hpp>
+#include <hpx/version.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// the address the benchmark binds its ids to, it is never dereferenced
+constexpr std::uint64_t dummy_lva = 0x10000;
+
+hpx::naming::address dummy_address()
+{
+    return hpx::naming::address(hpx::agas::get_locality(),
+        hpx::components::component_base_lco_with_value,
+        reinterpret_cast<void*>(dummy_lva));
+}
+
+// The ids every locality provides for the requests targeting its primary
+// namespace instance: a range of bound ids used for resolve and credit
+// requests and a range of allocated, unbound ids used for bind requests.
+struct locality_ids
+{
+    hpx::naming::gid_type bound;
+    hpx::naming::gid_type unbound;
+
+    template <typename Archive>
+    void serialize(Archive& ar, unsigned)
+    {
+        // clang-format off
+        ar & bound & unbound;
+        // clang-format on
+    }
+};
+
+locality_ids prepare(std::size_t ids_per_locality, std::uint32_t localities)
+{
+    locality_ids ids;
+
+    ids.bound = hpx::naming::detail::get_stripped_gid(
+        hpx::agas::get_next_id(ids_per_locality));
+    hpx::agas::bind_range_local(
+        ids.bound, ids_per_locality, dummy_address(), 0);
+
+    ids.unbound = hpx::naming::detail::get_stripped_gid(
+        hpx::agas::get_next_id(ids_per_locality * localities));
+
+    return ids;
+}
+
+HPX_PLAIN_ACTION(prepare, prepare_action)
+
+void cleanup(std::size_t ids_per_locality, locality_ids const& ids)
+{
+    hpx::agas::unbind_range_local(ids.bound, ids_per_locality);
+
+    // flush pending decref requests
+    hpx::agas::garbage_collect();
+}
+
+HPX_PLAIN_ACTION(cleanup, cleanup_action)
+
+///////////////////////////////////////////////////////////////////////////////
+// the latencies measured for one (named) request type on one locality
+struct operation_result
+{
+    double seconds = 0.0;
+    std::vector<std::string> names;
+    std::vector<std::vector<std::uint64_t>> latencies;
+
+    template <typename Archive>
+    void serialize(Archive& ar, unsigned)
+    {
+        // clang-format off
+        ar & seconds & names & latencies;
+        // clang-format on
+    }
+};
+
+struct request_context
+{
+    std::uint32_t here;
+    std::vector<locality_ids> const& ids;
+    std::size_t ids_per_locality;
+    std::size_t task;
+    std::size_t iterations;
+
+    // the locality whose primary namespace instance is targeted by the given
+    // request, never this locality if there is more than one
+    std::uint32_t target(std::size_t i) const
+    {
+        std::size_t const n = ids.size();
+        if (n == 1)
+        {
+            return here;
+        }
+        return std::uint32_t((here + 1 + (task + i) % (n - 1)) % n);
+    }
+
+    std::size_t index(std::size_t i) const
+    {
+        return task * iterations + i;
+    }
+};
+
+using request_type =
+    std::function<void(request_context const&, std::size_t, std::uint64_t*)>;
+
+// A request may consist of several steps which are measured separately.
+struct operation
+{
+    char const* name;
+    std::vector<std::string> steps;
+    request_type request;
+};
+
+inline std::uint64_t now()
+{
+    return hpx::chrono::high_resolution_clock::now();
+}
+
+void resolve_request(
+    request_context const& ctx, std::size_t i, std::uint64_t* latencies)
+{
+    hpx::naming::gid_type const gid =
+        ctx.ids[ctx.target(i)].bound + ctx.index(i);
+
+    std::uint64_t const start = now();
+    hpx::naming::get_agas_client().resolve_full_async(gid).get();
+    latencies[0] = now() - start;
+}
+
+void bind_request(
+    request_context const& ctx, std::size_t i, std::uint64_t* latencies)
+{
+    hpx::agas::addressing_service& agas_client = hpx::naming::get_agas_client();
+
+    // every locality uses its own part of the range of unbound ids
+    hpx::naming::gid_type const gid = ctx.ids[ctx.target(i)].unbound +
+        ctx.here * ctx.ids_per_locality + ctx.index(i);
+
+    std::uint64_t start = now();
+    agas_client.bind_range_async(gid, 1, dummy_address(), 0, ctx.here).get();
+    latencies[0] = now() - start;
+
+    start = now();
+    agas_client.unbind_range_async(gid, 1).get();
+    latencies[1] = now() - start;
+}
+
+void credit_request(
+    request_context const& ctx, std::size_t i, std::uint64_t* latencies)
+{
+    hpx::naming::gid_type const gid =
+        ctx.ids[ctx.target(i)].bound + ctx.index(i);
+
+    std::uint64_t start = now();
+    hpx::agas::incref(gid, 1).get();
+    latencies[0] = now() - start;
+
+    // decref requests are collected and sent in batches
+    start = now();
+    hpx::agas::decref(gid, 1);
+    latencies[1] = now() - start;
+}
+
+void symbol_request(
+    request_context const& ctx, std::size_t i, std::uint64_t* latencies)
+{
+    std::string const name = hpx::util::format(
+        "/agas_benchmark/{}/{}", ctx.here, ctx.index(i));
+    hpx::id_type const here = hpx::find_here();
+
+    std::uint64_t start = now();
+    hpx::agas::register_name(name, here).get();
+    latencies[0] = now() - start;
+
+    start = now();
+    hpx::agas::resolve_name(name).get();
+    latencies[1] = now() - start;
+
+    start = now();
+    hpx::agas::unregister_name(name).get();
+    latencies[2] = now() - start;
+}
+
+void component_request(request_context const&, std::size_t, std::uint64_t* l)
+{
+    std::uint64_t const start = now();
+    hpx::naming::get_agas_client().get_component_id("agas_benchmark");
+    l[0] = now() - start;
+}
+
+void locality_request(request_context const&, std::size_t, std::uint64_t* l)
+{
+    std::uint64_t const start = now();
+    hpx::naming::get_agas_client().get_num_threads_async().get();
+    l[0] = now() - start;
+}
+
+std::vector<operation> const& operations()
+{
+    static std::vector<operation> const ops = {
+        {"resolve", {"resolve_gid"}, &resolve_request},
+        {"bind", {"bind_gid", "unbind_gid"}, &bind_request},
+        {"credit", {"increment_credit", "decrement_credit"}, &credit_request},
+        {"symbol", {"bind", "resolve", "unbind"}, &symbol_request},
+        {"component", {"bind_name"}, &component_request},
+        {"locality", {"num_threads"}, &locality_request},
+    };
+    return ops;
+}
+
+operation const* find_operation(std::string const& name)
+{
+    for (operation const& op : operations())
+    {
+        if (name == op.name)
+        {
+            return &op;
+        }
+    }
+    return nullptr;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+operation_result run(std::string const& name, std::size_t iterations,
+    std::size_t concurrency, std::vector<locality_ids> const& ids)
+{
+    operation const* op = find_operation(name);
+    HPX_ASSERT(op != nullptr);
+
+    std::size_t const steps = op->steps.size();
+    std::size_t const ids_per_locality = iterations * concurrency;
+
+    operation_result result;
+    result.names = op->steps;
+    result.latencies.resize(steps);
+    for (auto& l : result.latencies)
+    {
+        l.resize(ids_per_locality);
+    }
+
+    std::uint32_t const here = hpx::get_locality_id();
+    std::vector<hpx::future<void>> tasks;
+    tasks.reserve(concurrency);
+
+    hpx::chrono::high_resolution_timer timer;
+    for (std::size_t task = 0; task != concurrency; ++task)
+    {
+        tasks.push_back(hpx::async([&, task]() {
+            request_context const ctx = {
+                here, ids, ids_per_locality, task, iterations};
+
+            std::vector<std::uint64_t> latencies(steps);
+            for (std::size_t i = 0; i != iterations; ++i)
+            {
+                op->request(ctx, i, latencies.data());
+                for (std::size_t s = 0; s != steps; ++s)
+                {
+                    result.latencies[s][ctx.index(i)] = latencies[s];
+                }
+            }
+        }));
+    }
+    hpx::wait_all(tasks);
+    result.seconds = timer.elapsed();
+
+    return result;
+}
+
+HPX_PLAIN_ACTION(run, run_action)
+
+///////////////////////////////////////////////////////////////////////////////
+// Access the AGAS service counters for the given step (the name of the
+// service API function) on all localities hosting the service, the component
+// and locality namespaces are hosted on the root locality only.
+std::vector<hpx::performance_counters::performance_counter> service_counters(
+    std::string const& op, std::string const& kind, std::string const& step,
+    std::uint32_t localities)
+{
+    bool const root_only = op == "component" || op == "locality";
+
+    std::vector<hpx::performance_counters::performance_counter> counters;
+    for (std::uint32_t i = 0; i != (root_only ? 1 : localities); ++i)
+    {
+        try
+        {
+            hpx::performance_counters::performance_counter counter(
+                hpx::util::format(
+                    "/agas{{locality#{}/total}}/{}/{}", i, kind, step));
+            if (counter.get_id())
+            {
+                counters.push_back(HPX_MOVE(counter));
+            }
+        }
+        catch (hpx::exception const&)
+        {
+            // the counter is not available on this locality
+        }
+    }
+    return counters;
+}
+
+std::int64_t sum_counters(
+    std::vector<hpx::performance_counters::performance_counter>& counters,
+    bool reset)
+{
+    std::int64_t sum = 0;
+    for (auto& counter : counters)
+    {
+        hpx::error_code ec(hpx::throwmode::lightweight);
+        std::int64_t const value =
+            counter.get_value<std::int64_t>(hpx::launch::sync, reset, ec);
+        if (!ec)
+        {
+            sum += value;
+        }
+    }
+    return sum;
+}
+
+std::uint64_t percentile(std::vector<std::uint64_t> const& sorted, double p)
+{
+    if (sorted.empty())
+    {
+        return 0;
+    }
+    std::size_t const index = std::size_t(p * double(sorted.size() - 1));
+    return sorted[index];
+}
+
+// The results are collected and printed as a single JSON document
+std::vector<std::string> results;
+
+void print_results(std::uint32_t localities, std::size_t concurrency,
+    std::size_t iterations)
+{
+    std::cout << "{\n  \"version\": \"" << hpx::full_version_as_string()
+              << "\",\n  \"localities\": " << localities
+              << ",\n  \"concurrency\": " << concurrency
+              << ",\n  \"iterations\": " << iterations
+              << ",\n  \"results\": [";
+    for (std::size_t i = 0; i != results.size(); ++i)
+    {
+        std::cout << (i == 0 ? "\n    " : ",\n    ") << results[i];
+    }
+    std::cout << "\n  ]\n}" << std::endl;
+}
+
+void benchmark(operation const& op, std::size_t iterations,
+    std::size_t concurrency, std::vector<hpx::id_type> const& localities,
+    std::vector<locality_ids> const& ids)
+{
+    std::uint32_t const num_localities = std::uint32_t(localities.size());
+
+    using counters_type =
+        std::vector<hpx::performance_counters::performance_counter>;
+    std::vector<counters_type> count_counters, time_counters;
+    for (std::string const& step : op.steps)
+    {
+        count_counters.push_back(
+            service_counters(op.name, "count", step, num_localities));
+        time_counters.push_back(
+            service_counters(op.name, "time", step, num_localities));
+
+        sum_counters(count_counters.back(), true);
+        sum_counters(time_counters.back(), true);
+    }
+
+    std::vector<hpx::future<operation_result>> runs;
+    runs.reserve(num_localities);
+    for (hpx::id_type const& locality : localities)
+    {
+        runs.push_back(hpx::async<run_action>(
+            locality, std::string(op.name), iterations, concurrency, ids));
+    }
+
+    std::vector<std::vector<std::uint64_t>> latencies(op.steps.size());
+    double seconds = 0.0;
+    for (auto& f : runs)
+    {
+        operation_result r = f.get();
+        seconds = (std::max)(seconds, r.seconds);
+        for (std::size_t s = 0; s != op.steps.size(); ++s)
+        {
+            latencies[s].insert(latencies[s].end(), r.latencies[s].begin(),
+                r.latencies[s].end());
+        }
+    }
+
+    for (std::size_t s = 0; s != op.steps.size(); ++s)
+    {
+        std::vector<std::uint64_t>& l = latencies[s];
+        std::sort(l.begin(), l.end());
+
+        double mean = 0.0;
+        for (std::uint64_t v : l)
+        {
+            mean += double(v);
+        }
+        mean /= double(l.empty() ? 1 : l.size());
+
+        double const ops_per_s =
+            seconds != 0.0 ? double(l.size()) / seconds : 0.0;
+
+        results.push_back(hpx::util::format(
+            "{{\"operation\": \"{}\", \"step\": \"{}\", \"requests\": {}, "
+            "\"requests_per_s\": {:.1f}, \"latency_ns\": {{\"mean\": {:.1f}, "
+            "\"p50\": {}, \"p90\": {}, \"p99\": {}, \"max\": {}}}, "
+            "\"service\": {{\"count\": {}, \"time_ns\": {}}}}}",
+            op.name, op.steps[s], l.size(), ops_per_s, mean,
+            percentile(l, 0.5), percentile(l, 0.9), percentile(l, 0.99),
+            l.empty() ? 0 : l.back(), sum_counters(count_counters[s], false),
+            sum_counters(time_counters[s], false)));
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    std::size_t const iterations = vm["iterations"].as<std::size_t>();
+    std::size_t const concurrency = vm["concurrency"].as<std::size_t>();
+
+    std::vector<std::string> names;
+    if (vm.count("operation") != 0)
+    {
+        names = vm["operation"].as<std::vector<std::string>>();
+    }
+    else
+    {
+        for (operation const& op : operations())
+        {
+            names.push_back(op.name);
+        }
+    }
+
+    std::vector<hpx::id_type> const localities = hpx::find_all_localities();
+    std::uint32_t const num_localities = std::uint32_t(localities.size());
+    std::size_t const ids_per_locality = iterations * concurrency;
+
+    // the ids of a locality are at the position of its locality id
+    std::vector<locality_ids> ids(num_localities);
+    for (hpx::id_type const& locality : localities)
+    {
+        ids[hpx::naming::get_locality_id_from_id(locality)] =
+            hpx::async<prepare_action>(
+                locality, ids_per_locality, num_localities)
+                .get();
+    }
+
+    for (std::string const& name : names)
+    {
+        operation const* op = find_operation(name);
+        if (op == nullptr)
+        {
+            std::cerr << "unknown operation: " << name << "\n";
+            continue;
+        }
+        benchmark(*op, iterations, concurrency, localities, ids);
+    }
+
+    for (hpx::id_type const& locality : localities)
+    {
+        hpx::async<cleanup_action>(locality, ids_per_locality,
+            ids[hpx::naming::get_locality_id_from_id(locality)])
+            .get();
+    }
+
+    print_results(num_localities, concurrency, iterations);
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    namespace po = hpx::program_options;
+
+    po::options_description desc(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    desc.add_options()
+        ("iterations", po::value<std::size_t>()->default_value(1000),
+         "number of requests issued by each thread")
+        ("concurrency", po::value<std::size_t>()->default_value(8),
+         "number of threads issuing requests on each locality")
+        ("operation", po::value<std::vector<std::string>>()->composing(),
+         "operation to benchmark (resolve, bind, credit, symbol, component, "
+         "locality), may be given more than once (default: all)")
+        ;
+    // clang-format on
+
+    hpx::init_params init_args;
+    init_args.desc_cmdline = desc;
+
+    return hpx::init(argc, argv, init_args);
+}
+#endif
@@ -0,0 +1,531 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark measures the latency and the bandwidth of the collective
+// operations (broadcast, reduce, all_reduce, gather, scatter, all_to_all,
+// barrier) and of the point-to-point messages of a channel_communicator for
+// a range of message sizes. Every locality runs the given number of sites,
+// each operation is invoked by all sites at once. The operations built on a
+// channel_communicator are measured for each of their algorithms. For every
+// operation and message size one line is written to std::cout as CSV:
+//
+//   operation,algorithm,localities,sites,bytes,iterations,mean_us,min_us,
+//   max_us,bandwidth_mb_s
+//
+// where mean_us is the latency averaged over all sites, min_us and max_us are
+// the smallest and the largest latency of a single site (each averaged over
+// all iterations), and bandwidth_mb_s is the message size divided by mean_us.
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/modules/collectives.hpp>
+#include <hpx/modules/format.hpp>
+#include <hpx/modules/timing.hpp>
+#include <hpx/serialization/serialize_buffer.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace hpx::collectives;
+
+///////////////////////////////////////////////////////////////////////////////
+struct site_info
+{
+    std::size_t num_sites;
+    std::size_t this_site;
+};
+
+struct benchmark_config
+{
+    std::size_t iterations;
+    std::size_t warmup;
+    std::size_t min_size;
+    std::size_t max_size;
+    std::size_t sites_per_locality;
+    std::vector<std::string> operations;
+};
+
+// Preparing an invocation creates the arguments of the operation from the
+// message and returns the function performing the communication, only the
+// latter is timed.
+using invocation = hpx::function<void()>;
+using operation = hpx::function<invocation(
+    std::vector<double> const& message, std::size_t generation)>;
+
+using buffer_type = hpx::serialization::serialize_buffer<double>;
+
+///////////////////////////////////////////////////////////////////////////////
+operation make_broadcast(std::string const& basename, site_info site)
+{
+    communicator comm = create_communicator(basename.c_str(),
+        num_sites_arg(site.num_sites), this_site_arg(site.this_site));
+
+    return [comm, site](std::vector<double> const& message,
+               std::size_t generation) -> invocation {
+        if (site.this_site == 0)
+        {
+            return [comm, message, generation]() {
+                broadcast_to(comm, message, this_site_arg(0),
+                    generation_arg(generation))
+                    .get();
+            };
+        }
+        return [comm, site, generation]() {
+            broadcast_from<std::vector<double>>(comm,
+                this_site_arg(site.this_site), generation_arg(generation))
+                .get();
+        };
+    };
+}
+
+operation make_reduce(std::string const& basename, site_info site)
+{
+    communicator comm = create_communicator(basename.c_str(),
+        num_sites_arg(site.num_sites), this_site_arg(site.this_site));
+
+    return [comm, site](std::vector<double> const& message,
+               std::size_t generation) -> invocation {
+        if (site.this_site == 0)
+        {
+            return [comm, message, generation]() mutable {
+                reduce_here(comm, HPX_MOVE(message), std::plus<double>{},
+                    this_site_arg(0), generation_arg(generation))
+                    .get();
+            };
+        }
+        return [comm, message, site, generation]() mutable {
+            reduce_there(comm, HPX_MOVE(message),
+                this_site_arg(site.this_site), generation_arg(generation))
+                .get();
+        };
+    };
+}
+
+operation make_all_reduce(std::string const& basename, site_info site)
+{
+    communicator comm = create_communicator(basename.c_str(),
+        num_sites_arg(site.num_sites), this_site_arg(site.this_site));
+
+    return [comm, site](std::vector<double> const& message,
+               std::size_t generation) -> invocation {
+        return [comm, message, site, generation]() mutable {
+            all_reduce(comm, HPX_MOVE(message), std::plus<double>{},
+                this_site_arg(site.this_site), generation_arg(generation))
+                .get();
+        };
+    };
+}
+
+operation make_gather(std::string const& basename, site_info site)
+{
+    communicator comm = create_communicator(basename.c_str(),
+        num_sites_arg(site.num_sites), this_site_arg(site.this_site));
+
+    return [comm, site](std::vector<double> const& message,
+               std::size_t generation) -> invocation {
+        if (site.this_site == 0)
+        {
+            return [comm, message, generation]() mutable {
+                gather_here(comm, HPX_MOVE(message), this_site_arg(0),
+                    generation_arg(generation))
+                    .get();
+            };
+        }
+        return [comm, message, site, generation]() mutable {
+            gather_there(comm, HPX_MOVE(message),
+                this_site_arg(site.this_site), generation_arg(generation))
+                .get();
+        };
+    };
+}
+
+// the message is the block sent to each site
+operation make_scatter(std::string const& basename, site_info site)
+{
+    communicator comm = create_communicator(basename.c_str(),
+        num_sites_arg(site.num_sites), this_site_arg(site.this_site));
+
+    return [comm, site](std::vector<double> const& message,
+               std::size_t generation) -> invocation {
+        if (site.this_site == 0)
+        {
+            std::vector<std::vector<double>> blocks(site.num_sites, message);
+            return [comm, blocks, generation]() mutable {
+                scatter_to(comm, HPX_MOVE(blocks), this_site_arg(0),
+                    generation_arg(generation))
+                    .get();
+            };
+        }
+        return [comm, site, generation]() {
+            scatter_from<std::vector<double>>(comm,
+                this_site_arg(site.this_site), generation_arg(generation))
+                .get();
+        };
+    };
+}
+
+// the message is the block sent to each site
+operation make_all_to_all(std::string const& basename, site_info site)
+{
+    communicator comm = create_communicator(basename.c_str(),
+        num_sites_arg(site.num_sites), this_site_arg(site.this_site));
+
+    return [comm, site](std::vector<double> const& message,
+               std::size_t generation) -> invocation {
+        std::vector<std::vector<double>> blocks(site.num_sites, message);
+        return [comm, blocks, site, generation]() mutable {
+            all_to_all(comm, HPX_MOVE(blocks), this_site_arg(site.this_site),
+                generation_arg(generation))
+                .get();
+        };
+    };
+}
+
+operation make_barrier(std::string const& basename, site_info site)
+{
+    auto b = std::make_shared<hpx::distributed::barrier>(
+        basename, site.num_sites, site.this_site);
+
+    return [b](std::vector<double> const&, std::size_t) -> invocation {
+        return [b]() { b->wait(); };
+    };
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// every site sends the message to its successor and receives the one of its
+// predecessor
+operation make_channel(std::string const& basename, site_info site)
+{
+    channel_communicator comm = create_channel_communicator(hpx::launch::sync,
+        basename.c_str(), num_sites_arg(site.num_sites),
+        this_site_arg(site.this_site));
+
+    std::size_t const next = (site.this_site + 1) % site.num_sites;
+    std::size_t const prev =
+        (site.this_site + site.num_sites - 1) % site.num_sites;
+
+    return [comm, next, prev](std::vector<double> const& message,
+               std::size_t generation) -> invocation {
+        return [comm, message, next, prev, generation]() mutable {
+            hpx::future<void> sent = set(comm, that_site_arg(next),
+                HPX_MOVE(message), tag_arg(generation));
+            get<std::vector<double>>(
+                comm, that_site_arg(prev), tag_arg(generation))
+                .get();
+            sent.get();
+        };
+    };
+}
+
+operation make_broadcast_channel(std::string const& basename, site_info site,
+    collective_algorithm algorithm)
+{
+    channel_communicator comm = create_channel_communicator(hpx::launch::sync,
+        basename.c_str(), num_sites_arg(site.num_sites),
+        this_site_arg(site.this_site));
+
+    return [comm, site, algorithm](std::vector<double> const& message,
+               std::size_t generation) -> invocation {
+        if (site.this_site == 0)
+        {
+            buffer_type buffer(
+                message.data(), message.size(), buffer_type::copy);
+            return [comm, buffer, generation, algorithm]() {
+                broadcast_to(comm, buffer, generation_arg(generation),
+                    segment_size_arg(), algorithm_arg(algorithm))
+                    .get();
+            };
+        }
+        return [comm, generation, algorithm]() {
+            broadcast_from<buffer_type>(comm, root_site_arg(0),
+                generation_arg(generation), algorithm_arg(algorithm))
+                .get();
+        };
+    };
+}
+
+operation make_all_reduce_channel(std::string const& basename,
+    site_info site, collective_algorithm algorithm)
+{
+    channel_communicator comm = create_channel_communicator(hpx::launch::sync,
+        basename.c_str(), num_sites_arg(site.num_sites),
+        this_site_arg(site.this_site));
+
+    return [comm, algorithm](std::vector<double> const& message,
+               std::size_t generation) -> invocation {
+        return [comm, message, generation, algorithm]() mutable {
+            all_reduce(comm, HPX_MOVE(message), std::plus<double>{},
+                generation_arg(generation), algorithm_arg(algorithm))
+                .get();
+        };
+    };
+}
+
+// a new plan is created whenever the message size changes
+operation make_all_reduce_plan(std::string const& basename, site_info site,
+    collective_algorithm algorithm)
+{
+    channel_communicator comm = create_channel_communicator(hpx::launch::sync,
+        basename.c_str(), num_sites_arg(site.num_sites),
+        this_site_arg(site.this_site));
+
+    using plan_type = all_reduce_plan<std::vector<double>, std::plus<double>>;
+    auto plan = std::make_shared<plan_type>();
+    auto plan_size = std::make_shared<std::size_t>(std::size_t(-1));
+
+    return [comm, algorithm, plan, plan_size](
+               std::vector<double> const& message,
+               std::size_t generation) -> invocation {
+        if (*plan_size != message.size())
+        {
+            *plan = create_all_reduce_plan(comm, message, std::plus<double>{},
+                generation_arg(generation), algorithm_arg(algorithm))
+                        .get();
+            *plan_size = message.size();
+        }
+        return [plan, message]() mutable {
+            all_reduce(*plan, HPX_MOVE(message)).get();
+        };
+    };
+}
+
+operation make_all_to_all_channel(std::string const& basename, site_info site)
+{
+    channel_communicator comm = create_channel_communicator(hpx::launch::sync,
+        basename.c_str(), num_sites_arg(site.num_sites),
+        this_site_arg(site.this_site));
+
+    return [comm, site](std::vector<double> const& message,
+               std::size_t generation) -> invocation {
+        std::vector<std::vector<double>> blocks(site.num_sites, message);
+        return [comm, blocks, generation]() mutable {
+            all_to_all(comm, HPX_MOVE(blocks), generation_arg(generation))
+                .get();
+        };
+    };
+}
+
+///////////////////////////////////////////////////////////////////////////////
+struct benchmark_case
+{
+    std::string name;
+    std::string algorithm;
+    bool uses_message;
+    hpx::function<operation(std::string const&, site_info)> create;
+};
+
+std::vector<benchmark_case> const& benchmark_cases()
+{
+    auto channel_algorithm = [](auto make, collective_algorithm algorithm) {
+        return [make, algorithm](std::string const& basename, site_info site) {
+            return make(basename, site, algorithm);
+        };
+    };
+
+    static std::vector<benchmark_case> const cases = {
+        {"broadcast", "communicator", true, &make_broadcast},
+        {"broadcast", "chain", true,
+            channel_algorithm(
+                &make_broadcast_channel, collective_algorithm::chain)},
+        {"broadcast", "binary_tree", true,
+            channel_algorithm(
+                &make_broadcast_channel, collective_algorithm::binary_tree)},
+        {"reduce", "communicator", true, &make_reduce},
+        {"all_reduce", "communicator", true, &make_all_reduce},
+        {"all_reduce", "recursive_doubling", true,
+            channel_algorithm(&make_all_reduce_channel,
+                collective_algorithm::recursive_doubling)},
+        {"all_reduce", "binomial_tree", true,
+            channel_algorithm(&make_all_reduce_channel,
+                collective_algorithm::binomial_tree)},
+        {"all_reduce", "plan_recursive_doubling", true,
+            channel_algorithm(&make_all_reduce_plan,
+                collective_algorithm::recursive_doubling)},
+        {"all_reduce", "plan_binomial_tree", true,
+            channel_algorithm(
+                &make_all_reduce_plan, collective_algorithm::binomial_tree)},
+        {"gather", "communicator", true, &make_gather},
+        {"scatter", "communicator", true, &make_scatter},
+        {"all_to_all", "communicator", true, &make_all_to_all},
+        {"all_to_all", "pairwise", true, &make_all_to_all_channel},
+        {"barrier", "tree", false, &make_barrier},
+        {"channel", "ring", true, &make_channel},
+    };
+    return cases;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void run_site(benchmark_config const& config, site_info site)
+{
+    // collects the latencies measured by all sites on site zero
+    communicator results =
+        create_communicator("/collectives_benchmark/results/",
+            num_sites_arg(site.num_sites), this_site_arg(site.this_site));
+    std::size_t results_generation = 0;
+
+    for (benchmark_case const& c : benchmark_cases())
+    {
+        if (!config.operations.empty() &&
+            std::find(config.operations.begin(), config.operations.end(),
+                c.name) == config.operations.end())
+        {
+            continue;
+        }
+
+        std::string const basename = hpx::util::format(
+            "/collectives_benchmark/{}/{}/", c.name, c.algorithm);
+        operation op = c.create(basename, site);
+        std::size_t generation = 0;
+
+        std::size_t const min_size = c.uses_message ? config.min_size : 0;
+        std::size_t const max_size = c.uses_message ? config.max_size : 0;
+        for (std::size_t size = min_size; size <= max_size;
+             size = (std::max)(size * 2, std::size_t(1)))
+        {
+            std::vector<double> const message(
+                (std::max)(size / sizeof(double), std::size_t(1)), double(1));
+
+            std::int64_t elapsed = 0;
+            for (std::size_t i = 0; i != config.warmup + config.iterations;
+                 ++i)
+            {
+                invocation invoke = op(message, ++generation);
+
+                hpx::chrono::high_resolution_timer timer;
+                invoke();
+                if (i >= config.warmup)
+                {
+                    elapsed += timer.elapsed_nanoseconds();
+                }
+            }
+
+            double const mean_us = config.iterations != 0 ?
+                double(elapsed) / double(config.iterations) / 1000.0 :
+                0.0;
+
+            if (site.this_site != 0)
+            {
+                gather_there(results, mean_us, this_site_arg(site.this_site),
+                    generation_arg(++results_generation))
+                    .get();
+                continue;
+            }
+
+            std::vector<double> const latencies =
+                gather_here(results, mean_us, this_site_arg(0),
+                    generation_arg(++results_generation))
+                    .get();
+
+            double mean = 0.0;
+            for (double latency : latencies)
+            {
+                mean += latency;
+            }
+            mean /= double(latencies.size());
+
+            std::size_t const bytes =
+                c.uses_message ? message.size() * sizeof(double) : 0;
+
+            std::cout << hpx::util::format(
+                             "{},{},{},{},{},{},{:.3f},{:.3f},{:.3f},{:.3f}\n",
+                             c.name, c.algorithm,
+                             hpx::get_num_localities(hpx::launch::sync),
+                             site.num_sites, bytes, config.iterations, mean,
+                             *std::min_element(
+                                 latencies.begin(), latencies.end()),
+                             *std::max_element(
+                                 latencies.begin(), latencies.end()),
+                             mean != 0.0 ? double(bytes) / mean : 0.0)
+                      << std::flush;
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    benchmark_config config;
+    config.iterations = vm["iterations"].as<std::size_t>();
+    config.warmup = vm["warmup"].as<std::size_t>();
+    config.min_size = vm["min-size"].as<std::size_t>();
+    config.max_size = vm["max-size"].as<std::size_t>();
+    config.sites_per_locality = vm["sites-per-locality"].as<std::size_t>();
+    if (vm.count("operation") != 0)
+    {
+        config.operations = vm["operation"].as<std::vector<std::string>>();
+    }
+
+    std::size_t const num_localities =
+        hpx::get_num_localities(hpx::launch::sync);
+    std::size_t const here = hpx::get_locality_id();
+
+    if (here == 0 && vm.count("no-header") == 0)
+    {
+        std::cout << "operation,algorithm,localities,sites,bytes,iterations,"
+                     "mean_us,min_us,max_us,bandwidth_mb_s\n";
+    }
+
+    // the sites of a locality have consecutive sequence numbers
+    site_info site{num_localities * config.sites_per_locality, 0};
+
+    std::vector<hpx::future<void>> sites;
+    sites.reserve(config.sites_per_locality);
+    for (std::size_t i = 0; i != config.sites_per_locality; ++i)
+    {
+        site.this_site = here * config.sites_per_locality + i;
+        sites.push_back(hpx::async(&run_site, std::cref(config), site));
+    }
+    hpx::wait_all(sites);
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    namespace po = hpx::program_options;
+
+    po::options_description desc(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    desc.add_options()
+        ("iterations", po::value<std::size_t>()->default_value(100),
+         "number of timed invocations for each message size")
+        ("warmup", po::value<std::size_t>()->default_value(10),
+         "number of untimed invocations for each message size")
+        ("min-size", po::value<std::size_t>()->default_value(8),
+         "smallest message size (in bytes)")
+        ("max-size", po::value<std::size_t>()->default_value(1048576),
+         "largest message size (in bytes), the size is doubled in between")
+        ("sites-per-locality", po::value<std::size_t>()->default_value(1),
+         "number of participating sites on each locality")
+        ("operation", po::value<std::vector<std::string>>()->composing(),
+         "operation to benchmark (broadcast, reduce, all_reduce, gather, "
+         "scatter, all_to_all, barrier, channel), may be given more than "
+         "once (default: all)")
+        ("no-header", "do not print the CSV header line")
+        ;
+    // clang-format on
+
+    // run hpx_main on all localities
+    std::vector<std::string> const cfg = {"hpx.run_hpx_main!=1"};
+
+    hpx::init_params init_args;
+    init_args.desc_cmdline = desc;
+    init_args.cfg = cfg;
+
+    return hpx::init(argc, argv, init_args);
+}
+#endif
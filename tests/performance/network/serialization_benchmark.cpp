@@ -0,0 +1,617 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark measures the throughput and the number of memory allocations
+// of the serialization of typical payloads, both using the archives directly
+// and using full encode_parcels/decode_parcels round trips of parcels
+// holding those payloads. All measurements are repeated for each of the
+// available binary filters (compression plugins). The results are written to
+// std::cout as JSON, which allows tracking serialization performance across
+// HPX versions.
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/serialization.hpp>
+#include <hpx/modules/format.hpp>
+#include <hpx/modules/timing.hpp>
+#include <hpx/parcelset/decode_parcels.hpp>
+#include <hpx/parcelset/detail/parcel_stripes.hpp>
+#include <hpx/parcelset/encode_parcels.hpp>
+#include <hpx/parcelset/parcel_buffer.hpp>
+#include <hpx/parcelset_base/traits/action_serialization_filter.hpp>
+#include <hpx/version.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <new>
+#include <string>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// Count the allocations made by the thread running a measurement. The
+// benchmarks do not suspend, so the HPX thread stays on the same OS thread.
+namespace {
+
+    struct allocation_counters
+    {
+        std::uint64_t count;
+        std::uint64_t bytes;
+    };
+
+    thread_local allocation_counters counters = {0, 0};
+
+    void* allocate(std::size_t size)
+    {
+        ++counters.count;
+        counters.bytes += size;
+        if (void* p = std::malloc(size != 0 ? size : 1))
+        {
+            return p;
+        }
+        throw std::bad_alloc();
+    }
+}    // namespace
+
+void* operator new(std::size_t size)
+{
+    return allocate(size);
+}
+
+void* operator new[](std::size_t size)
+{
+    return allocate(size);
+}
+
+void operator delete(void* p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete[](void* p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept
+{
+    std::free(p);
+}
+
+void operator delete[](void* p, std::size_t) noexcept
+{
+    std::free(p);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// the payloads
+struct pod
+{
+    std::int64_t id;
+    double values[4];
+    char tag[16];
+
+    // used if the archive can't copy the object as a whole
+    template <typename Archive>
+    void serialize(Archive& ar, unsigned)
+    {
+        // clang-format off
+        ar & id & values & tag;
+        // clang-format on
+    }
+};
+
+HPX_IS_BITWISE_SERIALIZABLE(pod)
+
+struct aggregate
+{
+    std::int64_t id = 0;
+    std::string name;
+    std::vector<std::int32_t> values;
+
+    template <typename Archive>
+    void serialize(Archive& ar, unsigned)
+    {
+        // clang-format off
+        ar & id & name & values;
+        // clang-format on
+    }
+};
+
+struct shape
+{
+    virtual ~shape() = default;
+
+    double x = 0.0;
+    double y = 0.0;
+
+    template <typename Archive>
+    void serialize(Archive& ar, unsigned)
+    {
+        // clang-format off
+        ar & x & y;
+        // clang-format on
+    }
+    HPX_SERIALIZATION_POLYMORPHIC(shape);
+};
+
+struct circle : shape
+{
+    double radius = 1.0;
+
+    template <typename Archive>
+    void serialize(Archive& ar, unsigned)
+    {
+        // clang-format off
+        ar & hpx::serialization::base_object<shape>(*this) & radius;
+        // clang-format on
+    }
+    HPX_SERIALIZATION_POLYMORPHIC(circle);
+};
+
+struct rectangle : shape
+{
+    double width = 1.0;
+    double height = 1.0;
+
+    template <typename Archive>
+    void serialize(Archive& ar, unsigned)
+    {
+        // clang-format off
+        ar & hpx::serialization::base_object<shape>(*this) & width & height;
+        // clang-format on
+    }
+    HPX_SERIALIZATION_POLYMORPHIC(rectangle);
+};
+
+using shapes = std::vector<std::shared_ptr<shape>>;
+using string_map = std::map<std::int64_t, std::string>;
+
+///////////////////////////////////////////////////////////////////////////////
+pod make_pod()
+{
+    pod p = {42, {1.0, 2.0, 3.0, 4.0}, "pod"};
+    return p;
+}
+
+std::vector<aggregate> make_aggregates(std::size_t size)
+{
+    std::vector<aggregate> v(size);
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        v[i].id = std::int64_t(i);
+        v[i].name = "aggregate " + std::to_string(i);
+        v[i].values.assign(i % 16, std::int32_t(i));
+    }
+    return v;
+}
+
+std::vector<double> make_doubles(std::size_t size)
+{
+    std::vector<double> v(size);
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        v[i] = double(i) / 3.0;
+    }
+    return v;
+}
+
+std::vector<std::string> make_strings(std::size_t size)
+{
+    std::vector<std::string> v;
+    v.reserve(size);
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        v.push_back(std::string(8 + i % 56, char('a' + i % 26)));
+    }
+    return v;
+}
+
+string_map make_map(std::size_t size)
+{
+    string_map m;
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        m[std::int64_t(i) * 7] = std::to_string(i);
+    }
+    return m;
+}
+
+shapes make_shapes(std::size_t size)
+{
+    shapes v;
+    v.reserve(size);
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        if (i % 2 == 0)
+        {
+            v.push_back(std::make_shared<circle>());
+        }
+        else
+        {
+            v.push_back(std::make_shared<rectangle>());
+        }
+        v.back()->x = double(i);
+    }
+    return v;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+struct measurement
+{
+    double seconds = 0.0;
+    std::uint64_t allocations = 0;
+    std::uint64_t allocated_bytes = 0;
+};
+
+measurement measure(std::size_t iterations, std::function<void()> const& f)
+{
+    // warm up caches and pools
+    f();
+
+    allocation_counters const start_counters = counters;
+    hpx::chrono::high_resolution_timer timer;
+
+    for (std::size_t i = 0; i != iterations; ++i)
+    {
+        f();
+    }
+
+    measurement m;
+    m.seconds = timer.elapsed();
+    m.allocations = counters.count - start_counters.count;
+    m.allocated_bytes = counters.bytes - start_counters.bytes;
+    return m;
+}
+
+// The results are collected and printed as a single JSON document
+std::vector<std::string> results;
+
+void report(std::string const& benchmark, std::string const& payload,
+    std::string const& filter, std::size_t iterations, std::size_t bytes,
+    std::size_t encoded_bytes, measurement const& save,
+    measurement const& load)
+{
+    auto entry = [&](char const* name, measurement const& m) {
+        double const n = double(iterations);
+        double const seconds = m.seconds != 0.0 ? m.seconds : 1e-9;
+        return hpx::util::format(
+            "\"{}\": {{\"ns_per_op\": {:.1f}, \"mb_per_s\": {:.2f}, "
+            "\"allocations_per_op\": {:.2f}, "
+            "\"allocated_bytes_per_op\": {:.1f}}}",
+            name, m.seconds * 1e9 / n, n * double(bytes) / seconds / 1e6,
+            double(m.allocations) / n, double(m.allocated_bytes) / n);
+    };
+
+    results.push_back(hpx::util::format(
+        "{{\"benchmark\": \"{}\", \"payload\": \"{}\", \"filter\": \"{}\", "
+        "\"iterations\": {}, \"bytes\": {}, \"encoded_bytes\": {}, {}, {}}}",
+        benchmark, payload, filter, iterations, bytes, encoded_bytes,
+        entry("save", save), entry("load", load)));
+}
+
+void print_results()
+{
+    std::cout << "{\n  \"version\": \"" << hpx::full_version_as_string()
+              << "\",\n  \"results\": [";
+    for (std::size_t i = 0; i != results.size(); ++i)
+    {
+        std::cout << (i == 0 ? "\n    " : ",\n    ") << results[i];
+    }
+    std::cout << "\n  ]\n}" << std::endl;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Create a new instance of the named binary filter, returns nullptr if none
+// was requested or if it is not available
+hpx::serialization::binary_filter* create_filter(
+    std::string const& name, bool compress = true)
+{
+    if (name == "none")
+    {
+        return nullptr;
+    }
+
+    hpx::error_code ec(hpx::throwmode::lightweight);
+    return hpx::create_binary_filter(
+        (name + "_serialization_filter").c_str(), compress, nullptr, ec);
+}
+
+template <typename T>
+void benchmark_archive(std::string const& payload, T const& value,
+    std::string const& filter_name, std::size_t iterations)
+{
+    std::vector<char> buffer;
+
+    // determine the size of the uncompressed data
+    {
+        hpx::serialization::output_archive archive(buffer);
+        archive << value;
+        archive.flush();
+    }
+    std::size_t const bytes = buffer.size();
+
+    auto save = [&]() {
+        buffer.clear();
+
+        std::unique_ptr<hpx::serialization::binary_filter> filter(
+            create_filter(filter_name));
+        std::uint32_t flags = 0;
+        if (filter)
+        {
+            filter->set_max_length(bytes);
+            flags = std::uint32_t(
+                hpx::serialization::archive_flags::enable_compression);
+        }
+
+        hpx::serialization::output_archive archive(
+            buffer, flags, nullptr, filter.get());
+        archive << value;
+        archive.flush();
+    };
+
+    if (filter_name != "none")
+    {
+        std::unique_ptr<hpx::serialization::binary_filter> filter(
+            create_filter(filter_name));
+        if (!filter)
+        {
+            return;
+        }
+    }
+
+    measurement const saved = measure(iterations, save);
+    std::size_t const encoded_bytes = buffer.size();
+
+    T received;
+    auto load = [&]() {
+        hpx::serialization::input_archive archive(buffer, buffer.size());
+        archive >> received;
+    };
+    measurement const loaded = measure(iterations, load);
+
+    report("archive", payload, filter_name, iterations, bytes, encoded_bytes,
+        saved, loaded);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// The action the parcels are sent to, the parcels use the currently selected
+// binary filter
+std::atomic<std::size_t> received_parcels(0);
+std::string parcel_filter = "none";
+
+template <typename T>
+void receive_payload(T const&)
+{
+    ++received_parcels;
+}
+
+#define BENCHMARK_PARCEL_ACTION(type, name)                                    \
+    void name(type const& t)                                                   \
+    {                                                                          \
+        receive_payload(t);                                                    \
+    }                                                                          \
+    HPX_PLAIN_ACTION(name, name##_action)                                      \
+                                                                               \
+    namespace hpx::traits {                                                    \
+        template <>                                                            \
+        struct action_serialization_filter<name##_action>                      \
+        {                                                                      \
+            static serialization::binary_filter* call()                        \
+            {                                                                  \
+                return create_filter(parcel_filter);                           \
+            }                                                                  \
+        };                                                                     \
+    }                                                                          \
+    /**/
+
+BENCHMARK_PARCEL_ACTION(pod, receive_pod)
+BENCHMARK_PARCEL_ACTION(std::vector<aggregate>, receive_aggregates)
+BENCHMARK_PARCEL_ACTION(std::vector<double>, receive_doubles)
+BENCHMARK_PARCEL_ACTION(std::vector<std::string>, receive_strings)
+BENCHMARK_PARCEL_ACTION(std::string, receive_string)
+BENCHMARK_PARCEL_ACTION(string_map, receive_map)
+BENCHMARK_PARCEL_ACTION(shapes, receive_shapes)
+
+using send_buffer_type = hpx::parcelset::parcel_buffer<std::vector<char>>;
+using receive_buffer_type =
+    hpx::parcelset::detail::parcel_stripes::buffer_type;
+
+// emulate the transfer of a message, the zero-copy chunks end up in separate
+// buffers on the receiving end
+receive_buffer_type transfer(send_buffer_type const& sent)
+{
+    receive_buffer_type received;
+    received.data_ = sent.data_;
+    received.size_ = sent.size_;
+    received.data_size_ = sent.data_size_;
+    received.num_chunks_ = sent.num_chunks_;
+    received.transmission_chunks_ = sent.transmission_chunks_;
+    for (auto const& c : sent.chunks_)
+    {
+        if (c.type_ == hpx::serialization::chunk_type::chunk_type_pointer)
+        {
+            char const* data = static_cast<char const*>(c.data_.cpos_);
+            received.chunks_.emplace_back(data, data + c.size_);
+        }
+    }
+    return received;
+}
+
+template <typename Action, typename T>
+void benchmark_parcels(hpx::parcelset::parcelport& pp,
+    std::string const& payload, T const& value,
+    std::string const& filter_name, std::size_t iterations)
+{
+    parcel_filter = filter_name;
+    if (filter_name != "none")
+    {
+        std::unique_ptr<hpx::serialization::binary_filter> filter(
+            create_filter(filter_name));
+        if (!filter)
+        {
+            return;
+        }
+    }
+
+    hpx::id_type const here = hpx::find_here();
+    hpx::naming::gid_type dest = here.get_gid();
+    hpx::parcelset::parcel p(hpx::parcelset::detail::create_parcel::call(
+        HPX_MOVE(dest), hpx::naming::address(), Action(),
+        hpx::threads::thread_priority::normal, value));
+    p.set_source_id(here);
+
+    int const archive_flags = int(hpx::endian::native == hpx::endian::big ?
+            hpx::serialization::archive_flags::endian_big :
+            hpx::serialization::archive_flags::endian_little);
+
+    send_buffer_type buffer;
+    auto encode = [&]() {
+        buffer.clear();
+        hpx::parcelset::encode_parcels(
+            pp, &p, 1, buffer, archive_flags, std::uint64_t(-1));
+    };
+
+    // determine the size of the uncompressed message, the size is used to
+    // reserve the buffer while encoding
+    {
+        std::string const filter = parcel_filter;
+        parcel_filter = "none";
+        encode();
+        parcel_filter = filter;
+    }
+    std::size_t const bytes =
+        buffer.data_.size() + hpx::parcelset::detail::zero_copy_size(buffer);
+    p.size() = buffer.data_.size();
+
+    measurement const encoded = measure(iterations, encode);
+    std::size_t const encoded_bytes =
+        buffer.data_.size() + hpx::parcelset::detail::zero_copy_size(buffer);
+
+    std::size_t const expected = received_parcels + iterations + 1;
+    auto decode = [&]() {
+        receive_buffer_type received = transfer(buffer);
+        std::vector<hpx::serialization::serialization_chunk> chunks(
+            hpx::parcelset::decode_chunks(received));
+        hpx::parcelset::decode_message_with_chunks(
+            pp, HPX_MOVE(received), 0, chunks);
+    };
+    measurement const decoded = measure(iterations, decode);
+
+    // wait for all actions to have run
+    hpx::util::yield_while([&]() { return received_parcels < expected; });
+
+    report("parcel", payload, filter_name, iterations, bytes, encoded_bytes,
+        encoded, decoded);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    std::size_t const iterations = vm["iterations"].as<std::size_t>();
+    std::size_t const size = vm["size"].as<std::size_t>();
+
+    std::vector<std::string> filters = {
+        "none", "zlib", "snappy", "bzip2", "lz4", "zstd"};
+    if (vm.count("filter") != 0)
+    {
+        filters = vm["filter"].as<std::vector<std::string>>();
+    }
+
+    pod const small_pod = make_pod();
+    std::vector<aggregate> const aggregates = make_aggregates(size);
+    std::vector<double> const doubles = make_doubles(size);
+    std::vector<std::string> const strings = make_strings(size);
+    std::string const string(size * 8, 's');
+    string_map const map = make_map(size);
+    shapes const polymorphic = make_shapes(size);
+
+    std::shared_ptr<hpx::parcelset::parcelport> pp;
+    if (vm.count("no-parcels") == 0)
+    {
+        pp = hpx::get_runtime_distributed()
+                 .get_parcel_handler()
+                 .get_bootstrap_parcelport();
+        if (!pp)
+        {
+            std::cerr << "no parcelport available, skipping the parcel "
+                         "benchmarks (run with networking enabled)\n";
+        }
+    }
+
+    for (std::string const& filter : filters)
+    {
+        benchmark_archive("pod", small_pod, filter, iterations);
+        benchmark_archive("aggregates", aggregates, filter, iterations);
+        benchmark_archive("doubles", doubles, filter, iterations);
+        benchmark_archive("strings", strings, filter, iterations);
+        benchmark_archive("string", string, filter, iterations);
+        benchmark_archive("map", map, filter, iterations);
+        benchmark_archive("polymorphic", polymorphic, filter, iterations);
+
+        if (pp)
+        {
+            benchmark_parcels<receive_pod_action>(
+                *pp, "pod", small_pod, filter, iterations);
+            benchmark_parcels<receive_aggregates_action>(
+                *pp, "aggregates", aggregates, filter, iterations);
+            benchmark_parcels<receive_doubles_action>(
+                *pp, "doubles", doubles, filter, iterations);
+            benchmark_parcels<receive_strings_action>(
+                *pp, "strings", strings, filter, iterations);
+            benchmark_parcels<receive_string_action>(
+                *pp, "string", string, filter, iterations);
+            benchmark_parcels<receive_map_action>(
+                *pp, "map", map, filter, iterations);
+            benchmark_parcels<receive_shapes_action>(
+                *pp, "polymorphic", polymorphic, filter, iterations);
+        }
+    }
+
+    print_results();
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    namespace po = hpx::program_options;
+
+    po::options_description desc(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    desc.add_options()
+        ("iterations", po::value<std::size_t>()->default_value(1000),
+         "number of times each payload is serialized")
+        ("size", po::value<std::size_t>()->default_value(1000),
+         "number of elements of the container payloads")
+        ("filter", po::value<std::vector<std::string>>()->composing(),
+         "binary filter to use (none, zlib, snappy, bzip2, lz4, zstd), "
+         "may be given more than once (default: all available)")
+        ("no-parcels", "do not run the encode_parcels/decode_parcels "
+         "benchmarks")
+        ;
+    // clang-format on
+
+    // make sure the parcelport is loaded even if running on one locality
+    std::vector<std::string> const cfg = {"hpx.expect_connecting_localities=1"};
+
+    hpx::init_params init_args;
+    init_args.desc_cmdline = desc;
+    init_args.cfg = cfg;
+
+    return hpx::init(argc, argv, init_args);
+}
+#endif
@@ -37,9 +37,10 @@ class _OutputKey(typing.NamedTuple):
 
     @classmethod
     def outputs_by_key(cls, data):
+        # the outputs may contain statistics and other properties besides
+        # the series of timings
         def split_output(o):
-            return cls(**{k: v
-                          for k, v in o.items() if k != 'series'}), o['series']
+            return cls(name=o['name'], executor=o['executor']), o['series']
 
         return dict(split_output(o) for o in data['outputs'])
 
@@ -0,0 +1,91 @@
+#!/usr/bin/env python3
+'''
+Copyright (c) 2022 The STE||AR-Group
+
+SPDX-License-Identifier: BSL-1.0
+Distributed under the Boost Software License, Version 1.0. (See accompanying
+file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+Converts a task trace recorded by HPX (see hpx/threading_base/task_trace.hpp
+and the hpx.task_trace.file configuration entry) to the Chrome trace event
+format, which can be loaded into Perfetto (https://ui.perfetto.dev) or
+chrome://tracing.
+
+usage: task_trace_to_chrome.py trace.bin [trace.json]
+'''
+
+import json
+import struct
+import sys
+
+HEADER = struct.Struct('<8sII')
+RECORD = struct.Struct('<QQQIBBH')
+
+BEGIN, END, SUSPEND, STEAL, NAME = 0, 1, 2, 3, 255
+
+
+def read_records(data):
+    magic, version, record_size = HEADER.unpack_from(data, 0)
+    if magic != b'HPXTRACE' or version != 1 or record_size != RECORD.size:
+        raise ValueError('not an HPX task trace (version 1)')
+
+    names = {}
+    records = []
+    offset = HEADER.size
+    while offset + RECORD.size <= len(data):
+        record = RECORD.unpack_from(data, offset)
+        offset += RECORD.size
+        if record[4] == NAME:
+            size = record[1]
+            names[record[2]] = data[offset:offset + size].decode(
+                'utf-8', 'replace')
+            offset += (size + RECORD.size - 1) // RECORD.size * RECORD.size
+        else:
+            records.append(record)
+    return names, records
+
+
+def convert(names, records):
+    # the records of the workers are interleaved by the flushing
+    records.sort(key=lambda r: r[0])
+    start = records[0][0] if records else 0
+
+    events = []
+    for timestamp, thread_id, description, worker, event, kind, _ in records:
+        ts = (timestamp - start) / 1000.0
+        if event == BEGIN:
+            if kind == 0:
+                name = names.get(description, '<unknown>')
+            else:
+                name = hex(description)
+            events.append({'name': name, 'ph': 'B', 'ts': ts, 'pid': 0,
+                           'tid': worker,
+                           'args': {'thread': hex(thread_id)}})
+        elif event in (END, SUSPEND):
+            events.append({'ph': 'E', 'ts': ts, 'pid': 0, 'tid': worker,
+                           'args': {'state': 'terminated' if event == END
+                                    else 'suspended'}})
+        elif event == STEAL:
+            events.append({'name': 'steal', 'ph': 'i', 's': 't', 'ts': ts,
+                           'pid': 0, 'tid': worker,
+                           'args': {'thread': hex(thread_id),
+                                    'from_worker': description}})
+    return {'traceEvents': events, 'displayTimeUnit': 'ns'}
+
+
+def main(argv):
+    if len(argv) < 2:
+        print(__doc__)
+        return 1
+
+    with open(argv[1], 'rb') as f:
+        names, records = read_records(f.read())
+
+    output = argv[2] if len(argv) > 2 else argv[1] + '.json'
+    with open(output, 'w') as f:
+        json.dump(convert(names, records), f)
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main(sys.argv))